@@ -0,0 +1,2852 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast_boost
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__48703320;
+extern StructInfo __struct_info__dd194b1c;
+extern StructInfo __struct_info__c9d26a46;
+extern StructInfo __struct_info__22c33332;
+extern StructInfo __struct_info__8c142b59;
+extern StructInfo __struct_info__713aafe3;
+extern StructInfo __struct_info__102fc31;
+extern StructInfo __struct_info__7b81962f;
+extern StructInfo __struct_info__4d24e047;
+extern StructInfo __struct_info__fd84a243;
+extern StructInfo __struct_info__7cf9187b;
+extern StructInfo __struct_info__142c88df;
+extern StructInfo __struct_info__2e1fb8cc;
+extern StructInfo __struct_info__5478d544;
+extern StructInfo __struct_info__6d01e87b;
+extern TypeInfo __type_info__57b510b2;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__aea00813;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__2c29f04d;
+extern TypeInfo __type_info__a703f317;
+extern TypeInfo __type_info__47dfa545;
+extern TypeInfo __type_info__b6282f69;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__53c08386;
+extern TypeInfo __type_info__f955b4ec;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__8891fc55;
+extern TypeInfo __type_info__baa44de8;
+extern TypeInfo __type_info__9a94a3c7;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__6e24d8c9;
+extern TypeInfo __type_info__cb9836a1;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__3494694f;
+extern TypeInfo __type_info__a80e24ba;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__72f75c6a;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__b365c4dd;
+extern TypeInfo __type_info__36f3a6b;
+extern TypeInfo __type_info__7fa6728;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__3d22364;
+extern TypeInfo __type_info__9750d32;
+extern TypeInfo __type_info__7482134c;
+extern TypeInfo __type_info__1daca05d;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__bbd314ac;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__ca846bdd;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__be386f7a;
+extern VarInfo __var_info__77df9a66;
+extern VarInfo __var_info__6aad9d64;
+extern VarInfo __var_info__f9bc7965;
+extern VarInfo __var_info__a02fd513;
+extern VarInfo __var_info__c571b58f;
+extern VarInfo __var_info__57e53bec;
+extern VarInfo __var_info__6b329e8b;
+extern VarInfo __var_info__511e23ce;
+extern VarInfo __var_info__7c2d3e11;
+extern VarInfo __var_info__52044e11;
+extern VarInfo __var_info__d2609a4e;
+extern VarInfo __var_info__16a94dea;
+extern VarInfo __var_info__3460fe1f;
+extern VarInfo __var_info__2ffa1ee0;
+extern VarInfo __var_info__a43d6ff2;
+extern VarInfo __var_info__849ee7b1;
+extern VarInfo __var_info__d57e4fe4;
+extern VarInfo __var_info__4bcb951b;
+extern VarInfo __var_info__1f78c3bf;
+extern VarInfo __var_info__159c68d2;
+extern VarInfo __var_info__60d46062;
+extern VarInfo __var_info__f6145cb7;
+extern VarInfo __var_info__f00830bc;
+extern VarInfo __var_info__2b7f5817;
+extern VarInfo __var_info__bbdb4673;
+extern VarInfo __var_info__33d89d7e;
+extern VarInfo __var_info__a81b30fd;
+extern VarInfo __var_info__bf105019;
+extern VarInfo __var_info__b3114889;
+extern VarInfo __var_info__a4959c04;
+extern VarInfo __var_info__9531e073;
+extern VarInfo __var_info__dc83ac7f;
+extern VarInfo __var_info__39fe00b7;
+extern VarInfo __var_info__499e311a;
+extern VarInfo __var_info__45ad7657;
+extern VarInfo __var_info__6d57afde;
+extern VarInfo __var_info__cb901576;
+extern VarInfo __var_info__ca0e35c3;
+extern VarInfo __var_info__a77ea33c;
+extern VarInfo __var_info__602c8e49;
+extern VarInfo __var_info__86d294dc;
+extern VarInfo __var_info__1659989c;
+extern VarInfo __var_info__3d570b1b;
+extern VarInfo __var_info__1b5c47e2;
+extern VarInfo __var_info__8b673409;
+extern VarInfo __var_info__f179f1bf;
+extern VarInfo __var_info__f4603919;
+extern VarInfo __var_info__363b811a;
+extern VarInfo __var_info__436e3a45;
+extern VarInfo __var_info__3989b8f3;
+extern VarInfo __var_info__c44af8e7;
+extern VarInfo __var_info__1c223b0;
+extern VarInfo __var_info__b502e8e4;
+extern VarInfo __var_info__69d14413;
+extern VarInfo __var_info__8d0e6828;
+extern VarInfo __var_info__398b718a;
+extern VarInfo __var_info__e2c16af4;
+extern VarInfo __var_info__e700fb87;
+extern VarInfo __var_info__b2847daf;
+extern VarInfo __var_info__505bcf7f;
+extern VarInfo __var_info__7b225b17;
+extern VarInfo __var_info__c726bba6;
+extern VarInfo __var_info__e66a0596;
+extern VarInfo __var_info__4c663710;
+extern VarInfo __var_info__13af6b34;
+extern VarInfo __var_info__32542cd3;
+extern VarInfo __var_info__76a80546;
+extern VarInfo __var_info__43b9e565;
+extern VarInfo __var_info__44b6a0fd;
+extern VarInfo __var_info__4cb99b2c;
+extern VarInfo __var_info__cf642f18;
+extern VarInfo __var_info__755f9a83;
+extern VarInfo __var_info__b82f2817;
+extern VarInfo __var_info__d9124691;
+extern VarInfo __var_info__28e3bb56;
+extern VarInfo __var_info__6197a9c8;
+extern VarInfo __var_info__3f72b0d7;
+extern VarInfo __var_info__97d8818a;
+extern VarInfo __var_info__f4ff6d4;
+extern VarInfo __var_info__57b2361f;
+extern VarInfo __var_info__a0753bb2;
+extern VarInfo __var_info__5707734;
+extern VarInfo __var_info__efedf9da;
+extern VarInfo __var_info__ddae6cf;
+extern VarInfo __var_info__cf2022a;
+extern VarInfo __var_info__ed3d60ef;
+extern VarInfo __var_info__99cd789b;
+extern VarInfo __var_info__8f6dbdea;
+extern VarInfo __var_info__e61c1fde;
+extern VarInfo __var_info__79d250af;
+extern VarInfo __var_info__55fdf176;
+extern VarInfo __var_info__9b50411a;
+extern VarInfo __var_info__70fbc23b;
+extern VarInfo __var_info__d69970b7;
+extern FuncInfo __func_info__13ce5ebc;
+extern FuncInfo __func_info__53c874e9;
+extern FuncInfo __func_info__d7ff50a7;
+extern EnumInfo __enum_info__182f51f2;
+
+EnumValueInfo __enum_info__182f51f2_value_0 = { "none", 0 };
+EnumValueInfo __enum_info__182f51f2_value_1 = { "autoinfer", 1 };
+EnumValueInfo __enum_info__182f51f2_value_2 = { "alias", 2 };
+EnumValueInfo __enum_info__182f51f2_value_3 = { "fakeContext", 3 };
+EnumValueInfo __enum_info__182f51f2_value_4 = { "fakeLineInfo", 4 };
+EnumValueInfo __enum_info__182f51f2_value_5 = { "anyArgument", 5 };
+EnumValueInfo __enum_info__182f51f2_value_6 = { "tVoid", 6 };
+EnumValueInfo __enum_info__182f51f2_value_7 = { "tBool", 7 };
+EnumValueInfo __enum_info__182f51f2_value_8 = { "tInt64", 12 };
+EnumValueInfo __enum_info__182f51f2_value_9 = { "tUInt64", 13 };
+EnumValueInfo __enum_info__182f51f2_value_10 = { "tInt", 14 };
+EnumValueInfo __enum_info__182f51f2_value_11 = { "tInt2", 15 };
+EnumValueInfo __enum_info__182f51f2_value_12 = { "tInt3", 16 };
+EnumValueInfo __enum_info__182f51f2_value_13 = { "tInt4", 17 };
+EnumValueInfo __enum_info__182f51f2_value_14 = { "tUInt", 18 };
+EnumValueInfo __enum_info__182f51f2_value_15 = { "tUInt2", 19 };
+EnumValueInfo __enum_info__182f51f2_value_16 = { "tUInt3", 20 };
+EnumValueInfo __enum_info__182f51f2_value_17 = { "tUInt4", 21 };
+EnumValueInfo __enum_info__182f51f2_value_18 = { "tFloat", 22 };
+EnumValueInfo __enum_info__182f51f2_value_19 = { "tFloat2", 23 };
+EnumValueInfo __enum_info__182f51f2_value_20 = { "tFloat3", 24 };
+EnumValueInfo __enum_info__182f51f2_value_21 = { "tFloat4", 25 };
+EnumValueInfo __enum_info__182f51f2_value_22 = { "tDouble", 26 };
+EnumValueInfo __enum_info__182f51f2_value_23 = { "tRange", 27 };
+EnumValueInfo __enum_info__182f51f2_value_24 = { "tURange", 28 };
+EnumValueInfo __enum_info__182f51f2_value_25 = { "tString", 29 };
+EnumValueInfo __enum_info__182f51f2_value_26 = { "tStructure", 30 };
+EnumValueInfo __enum_info__182f51f2_value_27 = { "tHandle", 31 };
+EnumValueInfo __enum_info__182f51f2_value_28 = { "tEnumeration", 32 };
+EnumValueInfo __enum_info__182f51f2_value_29 = { "tPointer", 36 };
+EnumValueInfo __enum_info__182f51f2_value_30 = { "tFunction", 37 };
+EnumValueInfo __enum_info__182f51f2_value_31 = { "tLambda", 38 };
+EnumValueInfo __enum_info__182f51f2_value_32 = { "tIterator", 39 };
+EnumValueInfo __enum_info__182f51f2_value_33 = { "tArray", 40 };
+EnumValueInfo __enum_info__182f51f2_value_34 = { "tTable", 41 };
+EnumValueInfo __enum_info__182f51f2_value_35 = { "tBlock", 42 };
+EnumValueInfo __enum_info__182f51f2_value_36 = { "tInt8", 8 };
+EnumValueInfo __enum_info__182f51f2_value_37 = { "tUInt8", 9 };
+EnumValueInfo __enum_info__182f51f2_value_38 = { "tInt16", 10 };
+EnumValueInfo __enum_info__182f51f2_value_39 = { "tUInt16", 11 };
+EnumValueInfo __enum_info__182f51f2_value_40 = { "tTuple", 43 };
+EnumValueInfo __enum_info__182f51f2_value_41 = { "tEnumeration8", 33 };
+EnumValueInfo __enum_info__182f51f2_value_42 = { "tEnumeration16", 34 };
+EnumValueInfo __enum_info__182f51f2_value_43 = { "tVariant", 44 };
+EnumValueInfo __enum_info__182f51f2_value_44 = { "tBitfield", 35 };
+EnumValueInfo * __enum_info__182f51f2_values [] = { &__enum_info__182f51f2_value_0, &__enum_info__182f51f2_value_1, &__enum_info__182f51f2_value_2, &__enum_info__182f51f2_value_3, &__enum_info__182f51f2_value_4, &__enum_info__182f51f2_value_5, &__enum_info__182f51f2_value_6, &__enum_info__182f51f2_value_7, &__enum_info__182f51f2_value_8, &__enum_info__182f51f2_value_9, &__enum_info__182f51f2_value_10, &__enum_info__182f51f2_value_11, &__enum_info__182f51f2_value_12, &__enum_info__182f51f2_value_13, &__enum_info__182f51f2_value_14, &__enum_info__182f51f2_value_15, &__enum_info__182f51f2_value_16, &__enum_info__182f51f2_value_17, &__enum_info__182f51f2_value_18, &__enum_info__182f51f2_value_19, &__enum_info__182f51f2_value_20, &__enum_info__182f51f2_value_21, &__enum_info__182f51f2_value_22, &__enum_info__182f51f2_value_23, &__enum_info__182f51f2_value_24, &__enum_info__182f51f2_value_25, &__enum_info__182f51f2_value_26, &__enum_info__182f51f2_value_27, &__enum_info__182f51f2_value_28, &__enum_info__182f51f2_value_29, &__enum_info__182f51f2_value_30, &__enum_info__182f51f2_value_31, &__enum_info__182f51f2_value_32, &__enum_info__182f51f2_value_33, &__enum_info__182f51f2_value_34, &__enum_info__182f51f2_value_35, &__enum_info__182f51f2_value_36, &__enum_info__182f51f2_value_37, &__enum_info__182f51f2_value_38, &__enum_info__182f51f2_value_39, &__enum_info__182f51f2_value_40, &__enum_info__182f51f2_value_41, &__enum_info__182f51f2_value_42, &__enum_info__182f51f2_value_43, &__enum_info__182f51f2_value_44 };
+EnumInfo __enum_info__182f51f2 = { "Type", __enum_info__182f51f2_values, 45, 0x182f51f2 };
+VarInfo __struct_info__48703320_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70fbc23b, "__rtti", 0 };
+TypeInfo * __type_info__4c663710_arg_types_var_1215312672[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__48703320_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c663710_arg_types_var_1215312672, nullptr, 1, 0, nullptr, 28, 0x4c663710, "__finalize", 8 };
+TypeInfo * __type_info__1c223b0_arg_types_var_1215312672[3] = { &__type_info__a80e24ba, &__type_info__72f75c6a, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c223b0_arg_types_var_1215312672, nullptr, 3, 0, nullptr, 28, 0x1c223b0, "transform", 12 };
+TypeInfo * __type_info__6197a9c8_arg_types_var_1215312672[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6197a9c8_arg_types_var_1215312672, nullptr, 5, 0, nullptr, 28, 0x6197a9c8, "apply", 16 };
+TypeInfo * __type_info__3989b8f3_arg_types_var_1215312672[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3989b8f3_arg_types_var_1215312672, nullptr, 6, 0, nullptr, 28, 0x3989b8f3, "finish", 20 };
+VarInfo * __struct_info__48703320_fields[5] =  { &__struct_info__48703320_field_0, &__struct_info__48703320_field_1, &__struct_info__48703320_field_2, &__struct_info__48703320_field_3, &__struct_info__48703320_field_4 };
+StructInfo __struct_info__48703320 = {"AstFunctionAnnotation", __struct_info__48703320_fields, 5, 24, -1, nullptr, 0x48703320 };
+VarInfo __struct_info__dd194b1c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xddae6cf, "__rtti", 0 };
+TypeInfo * __type_info__e2c16af4_arg_types_var_3709422364[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__dd194b1c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e2c16af4_arg_types_var_3709422364, nullptr, 1, 0, nullptr, 28, 0xe2c16af4, "__finalize", 8 };
+TypeInfo * __type_info__d57e4fe4_arg_types_var_3709422364[3] = { &__type_info__a80e24ba, &__type_info__72f75c6a, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d57e4fe4_arg_types_var_3709422364, nullptr, 3, 0, nullptr, 28, 0xd57e4fe4, "transform", 12 };
+TypeInfo * __type_info__86d294dc_arg_types_var_3709422364[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__86d294dc_arg_types_var_3709422364, nullptr, 5, 0, nullptr, 28, 0x86d294dc, "apply", 16 };
+TypeInfo * __type_info__c44af8e7_arg_types_var_3709422364[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__dd194b1c_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__c44af8e7_arg_types_var_3709422364, nullptr, 6, 0, nullptr, 28, 0xc44af8e7, "finish", 20 };
+VarInfo * __struct_info__dd194b1c_fields[5] =  { &__struct_info__dd194b1c_field_0, &__struct_info__dd194b1c_field_1, &__struct_info__dd194b1c_field_2, &__struct_info__dd194b1c_field_3, &__struct_info__dd194b1c_field_4 };
+StructInfo __struct_info__dd194b1c = {"TagFunctionAnnotation", __struct_info__dd194b1c_fields, 5, 24, -1, nullptr, 0xdd194b1c };
+VarInfo __struct_info__c9d26a46_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf9bc7965, "__rtti", 0 };
+TypeInfo * __type_info__1b5c47e2_arg_types_var_3386010182[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__c9d26a46_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b5c47e2_arg_types_var_3386010182, nullptr, 1, 0, nullptr, 28, 0x1b5c47e2, "__finalize", 8 };
+TypeInfo * __type_info__b2847daf_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__c9d26a46_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b2847daf_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xb2847daf, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__e700fb87_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__c9d26a46_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e700fb87_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xe700fb87, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__f4ff6d4_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__c9d26a46_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4ff6d4_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xf4ff6d4, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__c9d26a46_fields[5] =  { &__struct_info__c9d26a46_field_0, &__struct_info__c9d26a46_field_1, &__struct_info__c9d26a46_field_2, &__struct_info__c9d26a46_field_3, &__struct_info__c9d26a46_field_4 };
+StructInfo __struct_info__c9d26a46 = {"AstVariantMacro", __struct_info__c9d26a46_fields, 5, 24, -1, nullptr, 0xc9d26a46 };
+VarInfo __struct_info__22c33332_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xbf105019, "__rtti", 0 };
+TypeInfo * __type_info__77df9a66_arg_types_var_583217970[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__22c33332_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__77df9a66_arg_types_var_583217970, nullptr, 1, 0, nullptr, 28, 0x77df9a66, "__finalize", 8 };
+TypeInfo * __type_info__755f9a83_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__22c33332_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__755f9a83_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x755f9a83, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__99cd789b_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__22c33332_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__99cd789b_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x99cd789b, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__8d0e6828_arg_types_var_583217970[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__22c33332_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8d0e6828_arg_types_var_583217970, nullptr, 4, 0, nullptr, 28, 0x8d0e6828, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__22c33332_fields[5] =  { &__struct_info__22c33332_field_0, &__struct_info__22c33332_field_1, &__struct_info__22c33332_field_2, &__struct_info__22c33332_field_3, &__struct_info__22c33332_field_4 };
+StructInfo __struct_info__22c33332 = {"BetterRttiVisitor", __struct_info__22c33332_fields, 5, 24, -1, nullptr, 0x22c33332 };
+VarInfo __struct_info__8c142b59_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa77ea33c, "__rtti", 0 };
+TypeInfo * __type_info__7b225b17_arg_types_var_2350132057[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__8c142b59_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b225b17_arg_types_var_2350132057, nullptr, 1, 0, nullptr, 28, 0x7b225b17, "__finalize", 8 };
+TypeInfo * __type_info__d9124691_arg_types_var_2350132057[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__8c142b59_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__d9124691_arg_types_var_2350132057, nullptr, 5, 0, nullptr, 28, 0xd9124691, "apply", 12 };
+TypeInfo * __type_info__cf642f18_arg_types_var_2350132057[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__8c142b59_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cf642f18_arg_types_var_2350132057, nullptr, 5, 0, nullptr, 28, 0xcf642f18, "finish", 16 };
+VarInfo __struct_info__8c142b59_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x57e53bec, "annotation_function_call", 24 };
+VarInfo __struct_info__8c142b59_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x1659989c, "name", 32 };
+TypeInfo * __type_info__7c2d3e11_arg_types_var_2350132057[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__8c142b59_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c2d3e11_arg_types_var_2350132057, nullptr, 3, 0, nullptr, 28, 0x7c2d3e11, "setup_call", 40 };
+VarInfo * __struct_info__8c142b59_fields[7] =  { &__struct_info__8c142b59_field_0, &__struct_info__8c142b59_field_1, &__struct_info__8c142b59_field_2, &__struct_info__8c142b59_field_3, &__struct_info__8c142b59_field_4, &__struct_info__8c142b59_field_5, &__struct_info__8c142b59_field_6 };
+StructInfo __struct_info__8c142b59 = {"SetupFunctionAnnotatoin", __struct_info__8c142b59_fields, 7, 48, -1, nullptr, 0x8c142b59 };
+VarInfo __struct_info__713aafe3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x159c68d2, "__rtti", 0 };
+TypeInfo * __type_info__43b9e565_arg_types_var_1899671523[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__713aafe3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43b9e565_arg_types_var_1899671523, nullptr, 1, 0, nullptr, 28, 0x43b9e565, "__finalize", 8 };
+TypeInfo * __type_info__1f78c3bf_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1f78c3bf_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0x1f78c3bf, "apply", 12 };
+TypeInfo * __type_info__cb901576_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb901576_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0xcb901576, "finish", 16 };
+VarInfo * __struct_info__713aafe3_fields[4] =  { &__struct_info__713aafe3_field_0, &__struct_info__713aafe3_field_1, &__struct_info__713aafe3_field_2, &__struct_info__713aafe3_field_3 };
+StructInfo __struct_info__713aafe3 = {"AstStructureAnnotation", __struct_info__713aafe3_fields, 4, 24, -1, nullptr, 0x713aafe3 };
+VarInfo __struct_info__102fc31_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x13af6b34, "__rtti", 0 };
+TypeInfo * __type_info__79d250af_arg_types_var_16972849[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__102fc31_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__79d250af_arg_types_var_16972849, nullptr, 1, 0, nullptr, 28, 0x79d250af, "__finalize", 8 };
+TypeInfo * __type_info__8b673409_arg_types_var_16972849[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__102fc31_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__8b673409_arg_types_var_16972849, nullptr, 5, 0, nullptr, 28, 0x8b673409, "apply", 12 };
+TypeInfo * __type_info__2ffa1ee0_arg_types_var_16972849[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__102fc31_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2ffa1ee0_arg_types_var_16972849, nullptr, 5, 0, nullptr, 28, 0x2ffa1ee0, "finish", 16 };
+VarInfo __struct_info__102fc31_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x5707734, "annotation_function_call", 24 };
+VarInfo __struct_info__102fc31_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6aad9d64, "name", 32 };
+TypeInfo * __type_info__b3114889_arg_types_var_16972849[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__102fc31_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b3114889_arg_types_var_16972849, nullptr, 3, 0, nullptr, 28, 0xb3114889, "setup_call", 40 };
+VarInfo * __struct_info__102fc31_fields[7] =  { &__struct_info__102fc31_field_0, &__struct_info__102fc31_field_1, &__struct_info__102fc31_field_2, &__struct_info__102fc31_field_3, &__struct_info__102fc31_field_4, &__struct_info__102fc31_field_5, &__struct_info__102fc31_field_6 };
+StructInfo __struct_info__102fc31 = {"SetupReaderMacro", __struct_info__102fc31_fields, 7, 48, -1, nullptr, 0x102fc31 };
+VarInfo __struct_info__7b81962f_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x55fdf176, "__rtti", 0 };
+TypeInfo * __type_info__f4603919_arg_types_var_2072090159[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__7b81962f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f4603919_arg_types_var_2072090159, nullptr, 1, 0, nullptr, 28, 0xf4603919, "__finalize", 8 };
+TypeInfo * __type_info__ca0e35c3_arg_types_var_2072090159[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7b81962f_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__ca0e35c3_arg_types_var_2072090159, nullptr, 5, 0, nullptr, 28, 0xca0e35c3, "apply", 12 };
+TypeInfo * __type_info__cf2022a_arg_types_var_2072090159[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7b81962f_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cf2022a_arg_types_var_2072090159, nullptr, 5, 0, nullptr, 28, 0xcf2022a, "finish", 16 };
+VarInfo * __struct_info__7b81962f_fields[4] =  { &__struct_info__7b81962f_field_0, &__struct_info__7b81962f_field_1, &__struct_info__7b81962f_field_2, &__struct_info__7b81962f_field_3 };
+StructInfo __struct_info__7b81962f = {"TagStructureAnnotation", __struct_info__7b81962f_fields, 4, 24, -1, nullptr, 0x7b81962f };
+VarInfo __struct_info__4d24e047_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2609a4e, "__rtti", 0 };
+TypeInfo * __type_info__52044e11_arg_types_var_1294262343[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__4d24e047_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__52044e11_arg_types_var_1294262343, nullptr, 1, 0, nullptr, 28, 0x52044e11, "__finalize", 8 };
+TypeInfo * __type_info__3d570b1b_arg_types_var_1294262343[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__4d24e047_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3d570b1b_arg_types_var_1294262343, nullptr, 5, 0, nullptr, 28, 0x3d570b1b, "apply", 12 };
+TypeInfo * __type_info__a43d6ff2_arg_types_var_1294262343[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__4d24e047_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a43d6ff2_arg_types_var_1294262343, nullptr, 5, 0, nullptr, 28, 0xa43d6ff2, "finish", 16 };
+VarInfo __struct_info__4d24e047_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xe66a0596, "annotation_function_call", 24 };
+VarInfo __struct_info__4d24e047_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x76a80546, "name", 32 };
+TypeInfo * __type_info__4bcb951b_arg_types_var_1294262343[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__4d24e047_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4bcb951b_arg_types_var_1294262343, nullptr, 3, 0, nullptr, 28, 0x4bcb951b, "setup_call", 40 };
+VarInfo __struct_info__4d24e047_field_7 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x9531e073, "tag", 48 };
+VarInfo * __struct_info__4d24e047_fields[8] =  { &__struct_info__4d24e047_field_0, &__struct_info__4d24e047_field_1, &__struct_info__4d24e047_field_2, &__struct_info__4d24e047_field_3, &__struct_info__4d24e047_field_4, &__struct_info__4d24e047_field_5, &__struct_info__4d24e047_field_6, &__struct_info__4d24e047_field_7 };
+StructInfo __struct_info__4d24e047 = {"TagFunctionMacro", __struct_info__4d24e047_fields, 8, 56, -1, nullptr, 0x4d24e047 };
+VarInfo __struct_info__fd84a243_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa0753bb2, "__rtti", 0 };
+TypeInfo * __type_info__436e3a45_arg_types_var_4253327939[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__fd84a243_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__436e3a45_arg_types_var_4253327939, nullptr, 1, 0, nullptr, 28, 0x436e3a45, "__finalize", 8 };
+TypeInfo * __type_info__ed3d60ef_arg_types_var_4253327939[3] = { &__type_info__a80e24ba, &__type_info__72f75c6a, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ed3d60ef_arg_types_var_4253327939, nullptr, 3, 0, nullptr, 28, 0xed3d60ef, "transform", 12 };
+TypeInfo * __type_info__3460fe1f_arg_types_var_4253327939[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3460fe1f_arg_types_var_4253327939, nullptr, 5, 0, nullptr, 28, 0x3460fe1f, "apply", 16 };
+TypeInfo * __type_info__28e3bb56_arg_types_var_4253327939[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__fd84a243_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__28e3bb56_arg_types_var_4253327939, nullptr, 6, 0, nullptr, 28, 0x28e3bb56, "finish", 20 };
+VarInfo * __struct_info__fd84a243_fields[5] =  { &__struct_info__fd84a243_field_0, &__struct_info__fd84a243_field_1, &__struct_info__fd84a243_field_2, &__struct_info__fd84a243_field_3, &__struct_info__fd84a243_field_4 };
+StructInfo __struct_info__fd84a243 = {"MacroMacro", __struct_info__fd84a243_fields, 5, 24, -1, nullptr, 0xfd84a243 };
+VarInfo __struct_info__7cf9187b_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x16a94dea, "__rtti", 0 };
+TypeInfo * __type_info__a81b30fd_arg_types_var_2096699515[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__7cf9187b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a81b30fd_arg_types_var_2096699515, nullptr, 1, 0, nullptr, 28, 0xa81b30fd, "__finalize", 8 };
+TypeInfo * __type_info__2b7f5817_arg_types_var_2096699515[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7cf9187b_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2b7f5817_arg_types_var_2096699515, nullptr, 5, 0, nullptr, 28, 0x2b7f5817, "apply", 12 };
+TypeInfo * __type_info__6d57afde_arg_types_var_2096699515[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__7cf9187b_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6d57afde_arg_types_var_2096699515, nullptr, 5, 0, nullptr, 28, 0x6d57afde, "finish", 16 };
+VarInfo __struct_info__7cf9187b_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x9b50411a, "annotation_function_call", 24 };
+VarInfo __struct_info__7cf9187b_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x97d8818a, "name", 32 };
+TypeInfo * __type_info__39fe00b7_arg_types_var_2096699515[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__7cf9187b_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__39fe00b7_arg_types_var_2096699515, nullptr, 3, 0, nullptr, 28, 0x39fe00b7, "setup_call", 40 };
+VarInfo * __struct_info__7cf9187b_fields[7] =  { &__struct_info__7cf9187b_field_0, &__struct_info__7cf9187b_field_1, &__struct_info__7cf9187b_field_2, &__struct_info__7cf9187b_field_3, &__struct_info__7cf9187b_field_4, &__struct_info__7cf9187b_field_5, &__struct_info__7cf9187b_field_6 };
+StructInfo __struct_info__7cf9187b = {"SetupAnyAnnotation", __struct_info__7cf9187b_fields, 7, 48, -1, nullptr, 0x7cf9187b };
+VarInfo __struct_info__142c88df_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc726bba6, "__rtti", 0 };
+TypeInfo * __type_info__602c8e49_arg_types_var_338462943[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__142c88df_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__602c8e49_arg_types_var_338462943, nullptr, 1, 0, nullptr, 28, 0x602c8e49, "__finalize", 8 };
+TypeInfo * __type_info__a02fd513_arg_types_var_338462943[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__142c88df_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a02fd513_arg_types_var_338462943, nullptr, 5, 0, nullptr, 28, 0xa02fd513, "apply", 12 };
+TypeInfo * __type_info__efedf9da_arg_types_var_338462943[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__142c88df_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__efedf9da_arg_types_var_338462943, nullptr, 5, 0, nullptr, 28, 0xefedf9da, "finish", 16 };
+VarInfo __struct_info__142c88df_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x33d89d7e, "annotation_function_call", 24 };
+VarInfo __struct_info__142c88df_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x511e23ce, "name", 32 };
+TypeInfo * __type_info__bbdb4673_arg_types_var_338462943[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__142c88df_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bbdb4673_arg_types_var_338462943, nullptr, 3, 0, nullptr, 28, 0xbbdb4673, "setup_call", 40 };
+VarInfo * __struct_info__142c88df_fields[7] =  { &__struct_info__142c88df_field_0, &__struct_info__142c88df_field_1, &__struct_info__142c88df_field_2, &__struct_info__142c88df_field_3, &__struct_info__142c88df_field_4, &__struct_info__142c88df_field_5, &__struct_info__142c88df_field_6 };
+StructInfo __struct_info__142c88df = {"SetupVariantMacro", __struct_info__142c88df_fields, 7, 48, -1, nullptr, 0x142c88df };
+VarInfo __struct_info__2e1fb8cc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x505bcf7f, "__rtti", 0 };
+TypeInfo * __type_info__b502e8e4_arg_types_var_773830860[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__2e1fb8cc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b502e8e4_arg_types_var_773830860, nullptr, 1, 0, nullptr, 28, 0xb502e8e4, "__finalize", 8 };
+TypeInfo * __type_info__4cb99b2c_arg_types_var_773830860[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__2e1fb8cc_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__4cb99b2c_arg_types_var_773830860, nullptr, 5, 0, nullptr, 28, 0x4cb99b2c, "apply", 12 };
+TypeInfo * __type_info__3f72b0d7_arg_types_var_773830860[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__2e1fb8cc_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3f72b0d7_arg_types_var_773830860, nullptr, 5, 0, nullptr, 28, 0x3f72b0d7, "finish", 16 };
+VarInfo __struct_info__2e1fb8cc_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xc571b58f, "annotation_function_call", 24 };
+VarInfo __struct_info__2e1fb8cc_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6b329e8b, "name", 32 };
+TypeInfo * __type_info__60d46062_arg_types_var_773830860[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__2e1fb8cc_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__60d46062_arg_types_var_773830860, nullptr, 3, 0, nullptr, 28, 0x60d46062, "setup_call", 40 };
+VarInfo * __struct_info__2e1fb8cc_fields[7] =  { &__struct_info__2e1fb8cc_field_0, &__struct_info__2e1fb8cc_field_1, &__struct_info__2e1fb8cc_field_2, &__struct_info__2e1fb8cc_field_3, &__struct_info__2e1fb8cc_field_4, &__struct_info__2e1fb8cc_field_5, &__struct_info__2e1fb8cc_field_6 };
+StructInfo __struct_info__2e1fb8cc = {"SetupCallMacro", __struct_info__2e1fb8cc_fields, 7, 48, -1, nullptr, 0x2e1fb8cc };
+VarInfo __struct_info__5478d544_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x45ad7657, "__rtti", 0 };
+TypeInfo * __type_info__f00830bc_arg_types_var_1417205060[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__5478d544_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f00830bc_arg_types_var_1417205060, nullptr, 1, 0, nullptr, 28, 0xf00830bc, "__finalize", 8 };
+TypeInfo * __type_info__a4959c04_arg_types_var_1417205060[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__5478d544_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__a4959c04_arg_types_var_1417205060, nullptr, 5, 0, nullptr, 28, 0xa4959c04, "apply", 12 };
+TypeInfo * __type_info__f179f1bf_arg_types_var_1417205060[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__5478d544_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__f179f1bf_arg_types_var_1417205060, nullptr, 5, 0, nullptr, 28, 0xf179f1bf, "finish", 16 };
+VarInfo __struct_info__5478d544_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xf6145cb7, "annotation_function_call", 24 };
+VarInfo __struct_info__5478d544_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x69d14413, "name", 32 };
+TypeInfo * __type_info__363b811a_arg_types_var_1417205060[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__5478d544_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__363b811a_arg_types_var_1417205060, nullptr, 3, 0, nullptr, 28, 0x363b811a, "setup_call", 40 };
+VarInfo * __struct_info__5478d544_fields[7] =  { &__struct_info__5478d544_field_0, &__struct_info__5478d544_field_1, &__struct_info__5478d544_field_2, &__struct_info__5478d544_field_3, &__struct_info__5478d544_field_4, &__struct_info__5478d544_field_5, &__struct_info__5478d544_field_6 };
+StructInfo __struct_info__5478d544 = {"SetupInferMacro", __struct_info__5478d544_fields, 7, 48, -1, nullptr, 0x5478d544 };
+VarInfo __struct_info__6d01e87b_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8f6dbdea, "__rtti", 0 };
+TypeInfo * __type_info__44b6a0fd_arg_types_var_1828841595[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__6d01e87b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44b6a0fd_arg_types_var_1828841595, nullptr, 1, 0, nullptr, 28, 0x44b6a0fd, "__finalize", 8 };
+TypeInfo * __type_info__b82f2817_arg_types_var_1828841595[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6d01e87b_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__b82f2817_arg_types_var_1828841595, nullptr, 5, 0, nullptr, 28, 0xb82f2817, "apply", 12 };
+TypeInfo * __type_info__e61c1fde_arg_types_var_1828841595[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6d01e87b_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__e61c1fde_arg_types_var_1828841595, nullptr, 5, 0, nullptr, 28, 0xe61c1fde, "finish", 16 };
+VarInfo __struct_info__6d01e87b_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x499e311a, "annotation_function_call", 24 };
+VarInfo __struct_info__6d01e87b_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x398b718a, "name", 32 };
+TypeInfo * __type_info__d69970b7_arg_types_var_1828841595[3] = { &__type_info__1daca05d, &__type_info__2d8fb614, &__type_info__f955b4ec };
+VarInfo __struct_info__6d01e87b_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d69970b7_arg_types_var_1828841595, nullptr, 3, 0, nullptr, 28, 0xd69970b7, "setup_call", 40 };
+VarInfo * __struct_info__6d01e87b_fields[7] =  { &__struct_info__6d01e87b_field_0, &__struct_info__6d01e87b_field_1, &__struct_info__6d01e87b_field_2, &__struct_info__6d01e87b_field_3, &__struct_info__6d01e87b_field_4, &__struct_info__6d01e87b_field_5, &__struct_info__6d01e87b_field_6 };
+StructInfo __struct_info__6d01e87b = {"SetupStructureMacro", __struct_info__6d01e87b_fields, 7, 48, -1, nullptr, 0x6d01e87b };
+VarInfo __func_info__13ce5ebc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x57b2361f, "func", 0 };
+VarInfo * __func_info__13ce5ebc_fields[1] =  { &__func_info__13ce5ebc_field_0 };
+FuncInfo __func_info__13ce5ebc = {"invoke block<(func:smart_ptr<ast::Function>):void> const", "", __func_info__13ce5ebc_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x13ce5ebc, 0x0 };
+VarInfo __func_info__53c874e9_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdc83ac7f, "pkey", 0 };
+VarInfo __func_info__53c874e9_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x849ee7b1, "pvalue", 0 };
+VarInfo * __func_info__53c874e9_fields[2] =  { &__func_info__53c874e9_field_0, &__func_info__53c874e9_field_1 };
+FuncInfo __func_info__53c874e9 = {"invoke block<(pkey:void?;pvalue:void?):void> const", "", __func_info__53c874e9_fields, 2, 32, &__type_info__48b5725f, nullptr,0,0x53c874e9, 0x0 };
+VarInfo __func_info__d7ff50a7_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x32542cd3, "value", 0 };
+VarInfo * __func_info__d7ff50a7_fields[1] =  { &__func_info__d7ff50a7_field_0 };
+FuncInfo __func_info__d7ff50a7 = {"invoke block<(value:void?):void> const", "", __func_info__d7ff50a7_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xd7ff50a7, 0x0 };
+TypeInfo __type_info__57b510b2 = { Type::tStructure, &__struct_info__5478d544, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x57b510b2 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__aea00813 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xaea00813 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__2c29f04d = { Type::anyArgument, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2c29f04d };
+TypeInfo __type_info__a703f317 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0xa703f317 };
+TypeInfo __type_info__47dfa545 = { Type::tStructure, &__struct_info__142c88df, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x47dfa545 };
+TypeInfo __type_info__b6282f69 = { Type::tStructure, &__struct_info__fd84a243, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb6282f69 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa0eb0f08 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__53c08386 = { Type::tStructure, &__struct_info__2e1fb8cc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x53c08386 };
+TypeInfo __type_info__f955b4ec = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xf955b4ec };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__8891fc55 = { Type::tStructure, &__struct_info__713aafe3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x8891fc55 };
+TypeInfo __type_info__baa44de8 = { Type::tStructure, &__struct_info__c9d26a46, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xbaa44de8 };
+TypeInfo __type_info__9a94a3c7 = { Type::tStructure, &__struct_info__8c142b59, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x9a94a3c7 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__6e24d8c9 = { Type::tStructure, &__struct_info__4d24e047, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x6e24d8c9 };
+TypeInfo __type_info__cb9836a1 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcb9836a1 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__3494694f = { Type::tStructure, &__struct_info__102fc31, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x3494694f };
+TypeInfo __type_info__a80e24ba = { Type::tStructure, &__struct_info__48703320, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa80e24ba };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__72f75c6a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bbd314ac, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x72f75c6a };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+TypeInfo __type_info__b365c4dd = { Type::tStructure, &__struct_info__7b81962f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb365c4dd };
+TypeInfo __type_info__36f3a6b = { Type::tEnumeration, nullptr, &__enum_info__182f51f2, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x36f3a6b };
+TypeInfo __type_info__7fa6728 = { Type::tStructure, &__struct_info__22c33332, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x7fa6728 };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__3d22364 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3d22364 };
+TypeInfo __type_info__9750d32 = { Type::tStructure, &__struct_info__dd194b1c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x9750d32 };
+TypeInfo * __type_info__7482134c_arg_types[9] = { &__type_info__c894953d, &__type_info__95e97e5e, &__type_info__cb9836a1, &__type_info__3d22364, &__type_info__aea00813, &__type_info__a6c45d85, &__type_info__a0eb0f08, &__type_info__17c16538, &__type_info__2c29f04d };
+const char * __type_info__7482134c_arg_names[9] = { "tBool", "tInt", "tUInt", "tInt64", "tUInt64", "tFloat", "tDouble", "tString", "nothing" };
+TypeInfo __type_info__7482134c = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__7482134c_arg_types, (char **)__type_info__7482134c_arg_names, 9, 0, nullptr, 6, 0x7482134c };
+TypeInfo __type_info__1daca05d = { Type::tStructure, &__struct_info__7cf9187b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0x1daca05d };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__bbd314ac = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallFunc"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbbd314ac };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__ca846bdd = { Type::tStructure, &__struct_info__6d01e87b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 6, 0xca846bdd };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_1[3] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__7482134c };
+TypeInfo * __tinfo_2[4] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_4[3] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_5[5] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_6[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_7[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_8[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_9[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_10[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_11[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_12[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_13[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_14[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_15[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_16[2] = { &__type_info__3ffbf730, &__type_info__36f3a6b };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+namespace ast {
+
+struct AstStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace ast {
+
+struct AstVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstVisitor
+namespace ast_boost {
+
+struct MacroMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(MacroMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(MacroMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(MacroMacro,finish)==20,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(TagFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(TagStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupAnyAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupAnyAnnotation)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupAnyAnnotation,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupFunctionAnnotatoin {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupFunctionAnnotatoin)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupFunctionAnnotatoin,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupReaderMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupReaderMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupVariantMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupVariantMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupCallMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupCallMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupCallMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupStructureMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupStructureMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupStructureMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct SetupInferMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+};
+static_assert(sizeof(SetupInferMacro)==48,"structure size mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SetupInferMacro,setup_call)==40,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct TagFunctionMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+	char * annotation_function_call;
+	char * name;
+	Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>)) setup_call;
+	char * tag;
+};
+static_assert(sizeof(TagFunctionMacro)==56,"structure size mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,finish)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,annotation_function_call)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,name)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,setup_call)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TagFunctionMacro,tag)==48,"structure field offset mismatch with DAS");
+}
+namespace ast_boost {
+
+struct BetterRttiVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterRttiVisitor)==24,"structure size mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterRttiVisitor,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+
+inline ast_boost::BetterRttiVisitor BetterRttiVisitor_b07efdfcacb5d90d ( Context * __context__ );
+inline void _FuncBetterRttiVisitor_0x27___finalize_d9e23e635a304c48 ( Context * __context__, ast_boost::BetterRttiVisitor & __self_rename_at_262 );
+inline smart_ptr_raw<Expression> _FuncBetterRttiVisitor_0x60_visitExprIsVariant_faeff279e0b1e25f ( Context * __context__, ast_boost::BetterRttiVisitor & __self_rename_at_263, smart_ptr_raw<Program> const  __prog_rename_at_263, Module * const  __mod_rename_at_263, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_263 );
+inline ast_boost::MacroMacro MacroMacro_e1497d11cb4c9357 ( Context * __context__ );
+inline void _FuncMacroMacro_0x27___finalize_d23afb69bbc0ad66 ( Context * __context__, ast_boost::MacroMacro & __self_rename_at_88 );
+inline bool _FuncMacroMacro_0x60_apply_6849666f6ec59ee0 ( Context * __context__, ast_boost::MacroMacro & __self_rename_at_89, smart_ptr_raw<Function> __func_rename_at_89, ModuleGroup & __group_rename_at_89, AnnotationArgumentList const  & __args_rename_at_89, das::string & __errors_rename_at_89 );
+inline ast_boost::SetupAnyAnnotation SetupAnyAnnotation_4e5756e76cdda45 ( Context * __context__ );
+inline void _FuncSetupAnyAnnotation_0x27___finalize_665dd6510ddaa2c6 ( Context * __context__, ast_boost::SetupAnyAnnotation & __self_rename_at_204 );
+inline bool _FuncSetupAnyAnnotation_0x60_apply_b225e56395db6bf7 ( Context * __context__, ast_boost::SetupAnyAnnotation & __self_rename_at_209, smart_ptr_raw<Structure> __st_rename_at_209, ModuleGroup & __group_rename_at_209, AnnotationArgumentList const  & __args_rename_at_209, das::string & __errors_rename_at_209 );
+inline void _FuncSetupAnyAnnotation_0x60_setup_call_bdbf2a6a804025da ( Context * __context__, ast_boost::SetupAnyAnnotation & __self_rename_at_207, smart_ptr_raw<Structure> __st_rename_at_207, smart_ptr_raw<ExprCall> __cll_rename_at_207 );
+inline ast_boost::SetupCallMacro SetupCallMacro_ce09ce16832b37e7 ( Context * __context__ );
+inline void _FuncSetupCallMacro_0x27___finalize_4bf8182c3246d27e ( Context * __context__, ast_boost::SetupCallMacro & __self_rename_at_236 );
+inline ast_boost::SetupFunctionAnnotatoin SetupFunctionAnnotatoin_6d9482648142635a ( Context * __context__ );
+inline void _FuncSetupFunctionAnnotatoin_0x27___finalize_f2a2f01a10844222 ( Context * __context__, ast_boost::SetupFunctionAnnotatoin & __self_rename_at_227 );
+inline ast_boost::SetupInferMacro SetupInferMacro_d7c7d678a18447e9 ( Context * __context__ );
+inline void _FuncSetupInferMacro_0x27___finalize_bb630fba91e4c9a4 ( Context * __context__, ast_boost::SetupInferMacro & __self_rename_at_242 );
+inline ast_boost::SetupReaderMacro SetupReaderMacro_8e8d3db9c197654c ( Context * __context__ );
+inline void _FuncSetupReaderMacro_0x27___finalize_d84da6b278dcb39a ( Context * __context__, ast_boost::SetupReaderMacro & __self_rename_at_230 );
+inline ast_boost::SetupStructureMacro SetupStructureMacro_e20ca428af1a3ebb ( Context * __context__ );
+inline void _FuncSetupStructureMacro_0x27___finalize_5949099692e44d16 ( Context * __context__, ast_boost::SetupStructureMacro & __self_rename_at_239 );
+inline ast_boost::SetupVariantMacro SetupVariantMacro_2a396ba9b134f200 ( Context * __context__ );
+inline void _FuncSetupVariantMacro_0x27___finalize_b79d909c1ea0f836 ( Context * __context__, ast_boost::SetupVariantMacro & __self_rename_at_233 );
+inline ast_boost::TagFunctionAnnotation TagFunctionAnnotation_57304080665d5131 ( Context * __context__ );
+inline void _FuncTagFunctionAnnotation_0x27___finalize_400b05223c4c5d5c ( Context * __context__, ast_boost::TagFunctionAnnotation & __self_rename_at_99 );
+inline bool _FuncTagFunctionAnnotation_0x60_apply_2bfa9b1b2f01b33 ( Context * __context__, ast_boost::TagFunctionAnnotation & __self_rename_at_100, smart_ptr_raw<Function> __func_rename_at_100, ModuleGroup & __group_rename_at_100, AnnotationArgumentList const  & __args_rename_at_100, das::string & __errors_rename_at_100 );
+inline ast_boost::TagFunctionMacro TagFunctionMacro_4a29167ac64eec83 ( Context * __context__ );
+inline void _FuncTagFunctionMacro_0x27___finalize_7c3d528f8f526926 ( Context * __context__, ast_boost::TagFunctionMacro & __self_rename_at_245 );
+inline bool _FuncTagFunctionMacro_0x60_apply_ed8a34771fbec73e ( Context * __context__, ast_boost::TagFunctionMacro & __self_rename_at_251, smart_ptr_raw<Structure> __st_rename_at_251, ModuleGroup & __group_rename_at_251, AnnotationArgumentList const  & __args_rename_at_251, das::string & __errors_rename_at_251 );
+inline void _FuncTagFunctionMacro_0x60_setup_call_dc398a9148370dbf ( Context * __context__, ast_boost::TagFunctionMacro & __self_rename_at_248, smart_ptr_raw<Structure> __st_rename_at_248, smart_ptr_raw<ExprCall> __cll_rename_at_248 );
+inline ast_boost::TagStructureAnnotation TagStructureAnnotation_d1eb037a439b188a ( Context * __context__ );
+inline void _FuncTagStructureAnnotation_0x27___finalize_d17ab9b248fa8dfe ( Context * __context__, ast_boost::TagStructureAnnotation & __self_rename_at_109 );
+inline bool _FuncTagStructureAnnotation_0x60_apply_fbfe797e327f843b ( Context * __context__, ast_boost::TagStructureAnnotation & __self_rename_at_110, smart_ptr_raw<Structure> __str_rename_at_110, ModuleGroup & __group_rename_at_110, AnnotationArgumentList const  & __args_rename_at_110, das::string & __errors_rename_at_110 );
+inline void apply_tag_annotation_defdf759f8201948 ( Context * __context__, char * const  __tag_rename_at_140, smart_ptr_raw<FunctionAnnotation> const  __ann_rename_at_140 );
+inline void _Funcast_0x60_add_new_function_annotation_507c1e335fe6fe98 ( Context * __context__, char * const  __name_rename_at_505, ast_boost::MacroMacro * const  __someClassPtr_rename_at_505 );
+inline void _Funcast_0x60_add_new_function_annotation_baad1a7e42f1eb30 ( Context * __context__, char * const  __name_rename_at_505, ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_505 );
+inline void _Funcast_0x60_add_new_structure_annotation_7d0a3036e0a7ce88 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_a8bfd79330be0a7a ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_372d7e51bf6d8f26 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_f78fa3f19ea0eb3a ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_67bcb17f50f22efe ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_5d7c8849960ddb6e ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_c1df48163ae77046 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_structure_annotation_ede197d780f77e76 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_511 );
+inline void _Funcast_0x60_add_new_variant_macro_be020d32f058f724 ( Context * __context__, char * const  __name_rename_at_517, ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_517 );
+inline char * _Funcast_0x60_describe_271182824caabcc8 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __decl_rename_at_24, bool __extra_rename_at_24, bool __contracts_rename_at_24, bool __modules_rename_at_24 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_31c399a85a11c1a8 ( Context * __context__, char * const  __name_rename_at_447, ast_boost::MacroMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_aeb0ef1420bb9f8 ( Context * __context__, char * const  __name_rename_at_447, ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_996b4c988528cd83 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_74e71f437665294d ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_7c86f1bc00cb4215 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_459d9c0aba749c91 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_15288689f6515f9 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_80119e96a7cfdea1 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_ee2ddebff91e8f69 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_cb4a1baea3ec7295 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_69733492c271937a ( Context * __context__, char * const  __name_rename_at_497, ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_497 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_186 );
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_436 );
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_436 );
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> & __Arr_rename_at_37, char * const  __value_rename_at_37 );
+inline void clone_1ef034caa879bc4c ( Context * __context__, smart_ptr<Enumeration> & __dest_rename_at_414, Enumeration * const  __src_rename_at_414 );
+inline void clone_71630f94910d7ae0 ( Context * __context__, smart_ptr_raw<Function> & __dest_rename_at_190, void * const  __src_rename_at_190 );
+inline void clone_52db9e6ecf8de48 ( Context * __context__, smart_ptr_raw<MakeFieldDecl> & __dest_rename_at_86, void * const  __src_rename_at_86 );
+inline void clone_acf198b9505dc74 ( Context * __context__, smart_ptr_raw<TypeDecl> & __dest_rename_at_372, void * const  __src_rename_at_372 );
+inline void clone_a077761c55200f4e ( Context * __context__, smart_ptr<TypeDecl> & __dest_rename_at_294, smart_ptr_raw<TypeDecl> const  __src_rename_at_294 );
+inline char * const  describe_af12bb9460e41077 ( Context * __context__, AnnotationArgumentList const  & __list_rename_at_11 );
+inline char * describe_5c90f6710f594395 ( Context * __context__, AnnotationDeclaration const  & __ann_rename_at_14 );
+inline char * const  describe_af25d3f328486703 ( Context * __context__, AnnotationList const  & __list_rename_at_20 );
+inline char * describe_function_short_d76957a2f59c1ab ( Context * __context__, smart_ptr_raw<Function> const  __func_rename_at_31 );
+inline void emplace_5e74981d9fc8c8a4 ( Context * __context__, MakeStruct & __vec_rename_at_84, smart_ptr_raw<MakeFieldDecl> __ptr_rename_at_84 );
+inline void emplace_new_b3a35ef7dd55c571 ( Context * __context__, das::vector<smart_ptr<Expression>> & __vec_rename_at_75, smart_ptr_raw<Expression> __ptr_rename_at_75 );
+inline void emplace_new_8114bb826d9cea6d ( Context * __context__, das::vector<smart_ptr<TypeDecl>> & __vec_rename_at_78, smart_ptr_raw<TypeDecl> __ptr_rename_at_78 );
+inline void emplace_new_459ce6f72cdf9c0d ( Context * __context__, das::vector<smart_ptr<Variable>> & __vec_rename_at_81, smart_ptr_raw<Variable> __ptr_rename_at_81 );
+inline void finalize_e39f6bf3901fe65e ( Context * __context__, ast_boost::BetterRttiVisitor & ____this_rename_at_262 );
+inline void finalize_1e05286024ffc9 ( Context * __context__, ast_boost::MacroMacro & ____this_rename_at_88 );
+inline void finalize_c692ee85a5c3705d ( Context * __context__, ast_boost::SetupAnyAnnotation & ____this_rename_at_204 );
+inline void finalize_7741f20af8b390dc ( Context * __context__, ast_boost::SetupCallMacro & ____this_rename_at_236 );
+inline void finalize_d2d8d932b76c8507 ( Context * __context__, ast_boost::SetupFunctionAnnotatoin & ____this_rename_at_227 );
+inline void finalize_549b36d594098850 ( Context * __context__, ast_boost::SetupInferMacro & ____this_rename_at_242 );
+inline void finalize_7fe48452de3177af ( Context * __context__, ast_boost::SetupReaderMacro & ____this_rename_at_230 );
+inline void finalize_408cec3a0eef18bd ( Context * __context__, ast_boost::SetupStructureMacro & ____this_rename_at_239 );
+inline void finalize_85331723c3a41f85 ( Context * __context__, ast_boost::SetupVariantMacro & ____this_rename_at_233 );
+inline void finalize_5c3a9a623f3d9b38 ( Context * __context__, ast_boost::TagFunctionAnnotation & ____this_rename_at_99 );
+inline void finalize_34eecdde29f42869 ( Context * __context__, ast_boost::TagFunctionMacro & ____this_rename_at_245 );
+inline void finalize_3bd74c4615c1a065 ( Context * __context__, ast_boost::TagStructureAnnotation & ____this_rename_at_109 );
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> find_arg_e807475ba6ab1a80 ( Context * __context__, char * const  __argn_rename_at_133, AnnotationArgumentList const  & __args_rename_at_133 );
+inline smart_ptr_raw<Function> find_unique_function_c1c726d6baf9b089 ( Context * __context__, Module * const  __mod_rename_at_151, char * const  __name_rename_at_151 );
+inline smart_ptr_raw<Function> find_unique_generic_996fda7c20037ea9 ( Context * __context__, Module * const  __mod_rename_at_161, char * const  __name_rename_at_161 );
+inline void for_each_tag_function_7aff7793ef528ba2 ( Context * __context__, Module * const  __mod_rename_at_119, char * const  __tag_rename_at_119, Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  & __blk_rename_at_119 );
+inline bool isExpression_c0b61513ca47d4ed ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_37, bool __top_rename_at_37 );
+inline bool is_class_method_88832b5548c6df12 ( Context * __context__, smart_ptr_raw<Structure> const  __cinfo_rename_at_60, smart_ptr_raw<TypeDecl> const  __finfo_rename_at_60 );
+inline bool is_same_or_inherited_c5c182a7778b0270 ( Context * __context__, Structure * const  __parent_rename_at_52, Structure * const  __child_rename_at_52 );
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d ( Context * __context__ );
+inline StructInfo const  * _Funcrtti_0x60_class_info_7493c4d5b10b66bf ( Context * __context__, ast_boost::BetterRttiVisitor const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_870220293f929e68 ( Context * __context__, ast_boost::MacroMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_cb28c2899eff6cd5 ( Context * __context__, ast_boost::SetupCallMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_c28e31b8ff3590ae ( Context * __context__, ast_boost::SetupFunctionAnnotatoin const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_a3367fd1365ead61 ( Context * __context__, ast_boost::SetupInferMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_207e1cace0edd01e ( Context * __context__, ast_boost::SetupReaderMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_569c358976380014 ( Context * __context__, ast_boost::SetupStructureMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_c647ffe64658895c ( Context * __context__, ast_boost::SetupVariantMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_de41e21f48cd79b9 ( Context * __context__, ast_boost::TagFunctionAnnotation const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_5155812a8dbff6f8 ( Context * __context__, ast_boost::TagFunctionMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_37a8fb9b7aaa6d7c ( Context * __context__, ast_boost::TagStructureAnnotation const  & __cl_rename_at_88 );
+inline void setup_3bef15dee5a72be1 ( Context * __context__ );
+inline ExprBlock * setup_macro_fa52c3d6afe8fb88 ( Context * __context__, char * const  __name_rename_at_171, LineInfo const  & __at_rename_at_171 );
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline smart_ptr_raw<Expression> walk_and_convert_823957177b065231 ( Context * __context__, uint8_t * const  __data_rename_at_417, smart_ptr_raw<TypeDecl> const  __info_rename_at_417, LineInfo const  & __at_rename_at_417 );
+inline smart_ptr_raw<Expression> walk_and_convert_array_15c3eaaaa9e32c7b ( Context * __context__, uint8_t * const  __data_rename_at_272, smart_ptr_raw<TypeDecl> const  __info_rename_at_272, LineInfo const  & __at_rename_at_272 );
+inline smart_ptr_raw<Expression> walk_and_convert_basic_3eef5a83c22b80c0 ( Context * __context__, uint8_t * const  __data_rename_at_379, smart_ptr_raw<TypeDecl> const  __info_rename_at_379, LineInfo const  & __at_rename_at_379 );
+inline smart_ptr_raw<Expression> walk_and_convert_dim_d846b0fdf0ada93e ( Context * __context__, uint8_t * const  __data_rename_at_289, smart_ptr_raw<TypeDecl> const  __info_rename_at_289, LineInfo const  & __at_rename_at_289 );
+inline smart_ptr_raw<Expression> walk_and_convert_enumeration_76789bc0e3daa7b8 ( Context * __context__, uint8_t * const  __data_rename_at_402, smart_ptr_raw<TypeDecl> const  __info_rename_at_402, LineInfo const  & __at_rename_at_402 );
+inline smart_ptr_raw<Expression> walk_and_convert_pointer_6a9b7fa29b76c567 ( Context * __context__, uint8_t * const  __data_rename_at_304, smart_ptr_raw<TypeDecl> const  __info_rename_at_304, LineInfo const  & __at_rename_at_304 );
+inline smart_ptr_raw<Expression> walk_and_convert_structure_9e45e99e96ea38dd ( Context * __context__, uint8_t * const  __data_rename_at_322, smart_ptr_raw<TypeDecl> const  __info_rename_at_322, LineInfo const  & __at_rename_at_322 );
+inline smart_ptr_raw<Expression> walk_and_convert_table_fb68009581f6e9ff ( Context * __context__, uint8_t * const  __data_rename_at_352, smart_ptr_raw<TypeDecl> const  __info_rename_at_352, LineInfo const  & __at_rename_at_352 );
+inline smart_ptr_raw<Expression> walk_and_convert_tuple_df011f26bdafd3ce ( Context * __context__, uint8_t * const  __data_rename_at_312, smart_ptr_raw<TypeDecl> const  __info_rename_at_312, LineInfo const  & __at_rename_at_312 );
+inline smart_ptr_raw<Expression> walk_and_convert_variant_1a992293e21ba33d ( Context * __context__, uint8_t * const  __data_rename_at_339, smart_ptr_raw<TypeDecl> const  __info_rename_at_339, LineInfo const  & __at_rename_at_339 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	setup_3bef15dee5a72be1(__context__);
+}
+
+inline ast_boost::BetterRttiVisitor BetterRttiVisitor_b07efdfcacb5d90d ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::BetterRttiVisitor>::cast((([&]() -> ast_boost::BetterRttiVisitor {
+		ast_boost::BetterRttiVisitor __mks_262;
+		das_zero(__mks_262);
+		das_copy((__mks_262.__rtti),(((void *)(&__type_info__7fa6728))));
+		das_copy((__mks_262.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVariantMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::BetterRttiVisitor'__finalize BetterRttiVisitor*/ 1965574790u)))));
+		das_copy((__mks_262.visitExprIsVariant),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::BetterRttiVisitor`visitExprIsVariant BetterRttiVisitor #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprIsVariant#const*/ 659042436u)))));
+		return __mks_262;
+	})()));
+}
+
+inline void _FuncBetterRttiVisitor_0x27___finalize_d9e23e635a304c48 ( Context * __context__, ast_boost::BetterRttiVisitor &  __self_rename_at_262 )
+{
+	finalize_e39f6bf3901fe65e(__context__,das_arg<ast_boost::BetterRttiVisitor>::pass(__self_rename_at_262));
+}
+
+inline smart_ptr_raw<Expression> _FuncBetterRttiVisitor_0x60_visitExprIsVariant_faeff279e0b1e25f ( Context * __context__, ast_boost::BetterRttiVisitor &  __self_rename_at_263, smart_ptr_raw<Program> const  __prog_rename_at_263, Module * const  __mod_rename_at_263, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_263 ) { das_stack_prologue __prologue(__context__,320,"BetterRttiVisitor`visitExprIsVariant " DAS_FILE_LINE);
+{
+	if ( isExpression_c0b61513ca47d4ed(__context__,__expr_rename_at_263->value /*value*/->type /*_type*/,true) )
+	{
+		smart_ptr_raw<ExprField> __vdr_rename_at_265; das_zero(__vdr_rename_at_265); das_move(__vdr_rename_at_265, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_265) {
+			das_copy((__mks_265.at /*at*/),(__expr_rename_at_263->at /*at*/));
+			das_move((__mks_265.value /*value*/),(clone_expression(__expr_rename_at_263->value /*value*/)));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_265.name /*name*/),((char *) "__rtti"));
+			}		}))));
+		smart_ptr_raw<ExprConstString> __cna_rename_at_266; das_zero(__cna_rename_at_266); das_move(__cna_rename_at_266, das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_266) {
+			das_copy((__mks_266.at /*at*/),(__expr_rename_at_263->at /*at*/));
+			{
+				das_clone(__mks_266.text /*value*/,__expr_rename_at_263->name /*name*/);
+			}		}))));
+		smart_ptr_raw<ExprOp2> __veq_rename_at_267; das_zero(__veq_rename_at_267); das_move(__veq_rename_at_267, das_ascend_handle<true,smart_ptr_raw<ExprOp2>>::make(__context__,nullptr,(([&](ExprOp2 & __mks_267) {
+			das_copy((__mks_267.at /*at*/),(__expr_rename_at_263->at /*at*/));
+			das_move((__mks_267.left /*left*/),(__vdr_rename_at_265));
+			das_move((__mks_267.right /*right*/),(__cna_rename_at_266));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_267.op /*op*/),((char *) "=="));
+			}		}))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__veq_rename_at_267);
+	} else {
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	};
+}}
+
+inline ast_boost::MacroMacro MacroMacro_e1497d11cb4c9357 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::MacroMacro>::cast((([&]() -> ast_boost::MacroMacro {
+		ast_boost::MacroMacro __mks_88;
+		das_zero(__mks_88);
+		das_copy((__mks_88.__rtti),(((void *)(&__type_info__b6282f69))));
+		das_copy((__mks_88.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::MacroMacro'__finalize MacroMacro*/ 875541486u)))));
+		das_copy((__mks_88.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::MacroMacro`apply MacroMacro #smart_ptr##handle#Function #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 2627544722u)))));
+		return __mks_88;
+	})()));
+}
+
+inline void _FuncMacroMacro_0x27___finalize_d23afb69bbc0ad66 ( Context * __context__, ast_boost::MacroMacro &  __self_rename_at_88 )
+{
+	finalize_1e05286024ffc9(__context__,das_arg<ast_boost::MacroMacro>::pass(__self_rename_at_88));
+}
+
+inline bool _FuncMacroMacro_0x60_apply_6849666f6ec59ee0 ( Context * __context__, ast_boost::MacroMacro &  __self_rename_at_89, smart_ptr_raw<Function> __func_rename_at_89, ModuleGroup &  __group_rename_at_89, AnnotationArgumentList const  &  __args_rename_at_89, das::string &  __errors_rename_at_89 ) { das_stack_prologue __prologue(__context__,192,"MacroMacro`apply " DAS_FILE_LINE);
+{
+	compileProgram(__context__)->flags /*flags*/ |= 0x20u;
+	__func_rename_at_89->flags /*flags*/ |= 0x100u;
+	smart_ptr_raw<ExprBlock> __blk_rename_at_92; das_zero(__blk_rename_at_92); das_move(__blk_rename_at_92, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_92) {
+		das_copy((__mks_92.at /*at*/),(__func_rename_at_89->at /*at*/));
+	}))));
+	smart_ptr_raw<ExprCall> __ifm_rename_at_93; das_zero(__ifm_rename_at_93); das_move(__ifm_rename_at_93, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_93) {
+		das_copy((__mks_93.at /*at*/),(__func_rename_at_89->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_93.name /*name*/),((char *) "is_compiling_macros"));
+		}	}))));
+	smart_ptr_raw<ExprIfThenElse> __ife_rename_at_94; das_zero(__ife_rename_at_94); das_move(__ife_rename_at_94, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_94) {
+		das_copy((__mks_94.at /*at*/),(__func_rename_at_89->at /*at*/));
+		das_move((__mks_94.cond /*cond*/),(__ifm_rename_at_93));
+		das_move((__mks_94.if_true /*if_true*/),(__func_rename_at_89->body /*body*/));
+	}))));
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_92->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__ife_rename_at_94));
+	das_move(__func_rename_at_89->body /*body*/,__blk_rename_at_92);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline ast_boost::SetupAnyAnnotation SetupAnyAnnotation_4e5756e76cdda45 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupAnyAnnotation>::cast((([&]() -> ast_boost::SetupAnyAnnotation {
+		ast_boost::SetupAnyAnnotation __mks_204;
+		das_zero(__mks_204);
+		das_copy((__mks_204.__rtti),(((void *)(&__type_info__1daca05d))));
+		das_copy((__mks_204.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation'__finalize SetupAnyAnnotation*/ 2681928366u)))));
+		das_copy((__mks_204.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_204.annotation_function_call),(((char *) "")));
+		das_copy((__mks_204.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_204;
+	})()));
+}
+
+inline void _FuncSetupAnyAnnotation_0x27___finalize_665dd6510ddaa2c6 ( Context * __context__, ast_boost::SetupAnyAnnotation &  __self_rename_at_204 )
+{
+	finalize_c692ee85a5c3705d(__context__,das_arg<ast_boost::SetupAnyAnnotation>::pass(__self_rename_at_204));
+}
+
+inline bool _FuncSetupAnyAnnotation_0x60_apply_b225e56395db6bf7 ( Context * __context__, ast_boost::SetupAnyAnnotation &  __self_rename_at_209, smart_ptr_raw<Structure> __st_rename_at_209, ModuleGroup &  __group_rename_at_209, AnnotationArgumentList const  &  __args_rename_at_209, das::string &  __errors_rename_at_209 ) { das_stack_prologue __prologue(__context__,224,"SetupAnyAnnotation`apply " DAS_FILE_LINE);
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __argName_rename_at_210_ConstRef = ((TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(find_arg_e807475ba6ab1a80(__context__,((char *) "name"),__args_rename_at_209)));
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __argName_rename_at_210 = __argName_rename_at_210_ConstRef; ;
+	if ( das_get_variant_field<vec4f,16,8>::is(__argName_rename_at_210) )
+	{
+		das_copy(__self_rename_at_209.name,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string &>::from(__st_rename_at_209->name /*name*/))));
+	} else if ( !das_get_variant_field<char *,16,7>::is(__argName_rename_at_210) )
+	{
+		builtin_throw(((char *) "name must be string"),__context__);
+	} else {
+		das_copy(__self_rename_at_209.name,das_get_variant_field<char *,16,7>::as(__argName_rename_at_210,__context__));
+	};
+	ExprBlock * __blk_rename_at_217; das_zero(__blk_rename_at_217); das_move(__blk_rename_at_217, setup_macro_fa52c3d6afe8fb88(__context__,((char *) "__setup_macros"),das_arg<LineInfo>::pass(__st_rename_at_209->at /*at*/)));
+	smart_ptr_raw<ExprCall> __cll_rename_at_218; das_zero(__cll_rename_at_218); das_move(__cll_rename_at_218, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_218) {
+		das_copy((__mks_218.at /*at*/),(__st_rename_at_209->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_218.name /*name*/),__self_rename_at_209.annotation_function_call);
+		}	}))));
+	das_invoke_function<void>::invoke<ast_boost::SetupAnyAnnotation &,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>>(__context__,__self_rename_at_209.setup_call,das_arg<ast_boost::SetupAnyAnnotation>::pass(__self_rename_at_209),__st_rename_at_209,__cll_rename_at_218);
+	smart_ptr_raw<ExprNew> __nee_rename_at_220; das_zero(__nee_rename_at_220); das_move(__nee_rename_at_220, das_ascend_handle<true,smart_ptr_raw<ExprNew>>::make(__context__,nullptr,(([&](ExprNew & __mks_220) {
+		das_copy((__mks_220.at /*at*/),(__st_rename_at_209->at /*at*/));
+		das_copy((__mks_220.initializer /*initializer*/),(true));
+	}))));
+	das_move(__nee_rename_at_220->typeexpr /*typeexpr*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_221) {
+		das_copy((__mks_221.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tStructure));
+		das_copy((__mks_221.structType /*structType*/),(_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_209)));
+		das_copy((__mks_221.at /*at*/),(__st_rename_at_209->at /*at*/));
+	}))));
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_218->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression>>::pass(__nee_rename_at_220));
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_217->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__cll_rename_at_218));
+	das_copy(__blk_rename_at_217,nullptr);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void _FuncSetupAnyAnnotation_0x60_setup_call_bdbf2a6a804025da ( Context * __context__, ast_boost::SetupAnyAnnotation &  __self_rename_at_207, smart_ptr_raw<Structure> __st_rename_at_207, smart_ptr_raw<ExprCall> __cll_rename_at_207 ) { das_stack_prologue __prologue(__context__,112,"SetupAnyAnnotation`setup_call " DAS_FILE_LINE);
+{
+	emplace_new_b3a35ef7dd55c571(__context__,das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_207->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_208) {
+		das_copy((__mks_208.at /*at*/),(__st_rename_at_207->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_208.text /*value*/),__self_rename_at_207.name);
+		}	})))));
+}}
+
+inline ast_boost::SetupCallMacro SetupCallMacro_ce09ce16832b37e7 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupCallMacro>::cast((([&]() -> ast_boost::SetupCallMacro {
+		ast_boost::SetupCallMacro __mks_236;
+		das_zero(__mks_236);
+		das_copy((__mks_236.__rtti),(((void *)(&__type_info__53c08386))));
+		das_copy((__mks_236.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupCallMacro'__finalize SetupCallMacro*/ 3551581034u)))));
+		das_copy((__mks_236.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_236.annotation_function_call),(((char *) "add_new_call_macro")));
+		das_copy((__mks_236.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_236;
+	})()));
+}
+
+inline void _FuncSetupCallMacro_0x27___finalize_4bf8182c3246d27e ( Context * __context__, ast_boost::SetupCallMacro &  __self_rename_at_236 )
+{
+	finalize_7741f20af8b390dc(__context__,das_arg<ast_boost::SetupCallMacro>::pass(__self_rename_at_236));
+}
+
+inline ast_boost::SetupFunctionAnnotatoin SetupFunctionAnnotatoin_6d9482648142635a ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupFunctionAnnotatoin>::cast((([&]() -> ast_boost::SetupFunctionAnnotatoin {
+		ast_boost::SetupFunctionAnnotatoin __mks_227;
+		das_zero(__mks_227);
+		das_copy((__mks_227.__rtti),(((void *)(&__type_info__9a94a3c7))));
+		das_copy((__mks_227.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupFunctionAnnotatoin'__finalize SetupFunctionAnnotatoin*/ 3051488728u)))));
+		das_copy((__mks_227.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_227.annotation_function_call),(((char *) "add_new_function_annotation")));
+		das_copy((__mks_227.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_227;
+	})()));
+}
+
+inline void _FuncSetupFunctionAnnotatoin_0x27___finalize_f2a2f01a10844222 ( Context * __context__, ast_boost::SetupFunctionAnnotatoin &  __self_rename_at_227 )
+{
+	finalize_d2d8d932b76c8507(__context__,das_arg<ast_boost::SetupFunctionAnnotatoin>::pass(__self_rename_at_227));
+}
+
+inline ast_boost::SetupInferMacro SetupInferMacro_d7c7d678a18447e9 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupInferMacro>::cast((([&]() -> ast_boost::SetupInferMacro {
+		ast_boost::SetupInferMacro __mks_242;
+		das_zero(__mks_242);
+		das_copy((__mks_242.__rtti),(((void *)(&__type_info__57b510b2))));
+		das_copy((__mks_242.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupInferMacro'__finalize SetupInferMacro*/ 2805165730u)))));
+		das_copy((__mks_242.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_242.annotation_function_call),(((char *) "add_new_infer_macro")));
+		das_copy((__mks_242.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_242;
+	})()));
+}
+
+inline void _FuncSetupInferMacro_0x27___finalize_bb630fba91e4c9a4 ( Context * __context__, ast_boost::SetupInferMacro &  __self_rename_at_242 )
+{
+	finalize_549b36d594098850(__context__,das_arg<ast_boost::SetupInferMacro>::pass(__self_rename_at_242));
+}
+
+inline ast_boost::SetupReaderMacro SetupReaderMacro_8e8d3db9c197654c ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupReaderMacro>::cast((([&]() -> ast_boost::SetupReaderMacro {
+		ast_boost::SetupReaderMacro __mks_230;
+		das_zero(__mks_230);
+		das_copy((__mks_230.__rtti),(((void *)(&__type_info__3494694f))));
+		das_copy((__mks_230.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupReaderMacro'__finalize SetupReaderMacro*/ 4009431518u)))));
+		das_copy((__mks_230.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_230.annotation_function_call),(((char *) "add_new_reader_macro")));
+		das_copy((__mks_230.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_230;
+	})()));
+}
+
+inline void _FuncSetupReaderMacro_0x27___finalize_d84da6b278dcb39a ( Context * __context__, ast_boost::SetupReaderMacro &  __self_rename_at_230 )
+{
+	finalize_7fe48452de3177af(__context__,das_arg<ast_boost::SetupReaderMacro>::pass(__self_rename_at_230));
+}
+
+inline ast_boost::SetupStructureMacro SetupStructureMacro_e20ca428af1a3ebb ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupStructureMacro>::cast((([&]() -> ast_boost::SetupStructureMacro {
+		ast_boost::SetupStructureMacro __mks_239;
+		das_zero(__mks_239);
+		das_copy((__mks_239.__rtti),(((void *)(&__type_info__ca846bdd))));
+		das_copy((__mks_239.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupStructureMacro'__finalize SetupStructureMacro*/ 4247392904u)))));
+		das_copy((__mks_239.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_239.annotation_function_call),(((char *) "add_new_structure_annotation")));
+		das_copy((__mks_239.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_239;
+	})()));
+}
+
+inline void _FuncSetupStructureMacro_0x27___finalize_5949099692e44d16 ( Context * __context__, ast_boost::SetupStructureMacro &  __self_rename_at_239 )
+{
+	finalize_408cec3a0eef18bd(__context__,das_arg<ast_boost::SetupStructureMacro>::pass(__self_rename_at_239));
+}
+
+inline ast_boost::SetupVariantMacro SetupVariantMacro_2a396ba9b134f200 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::SetupVariantMacro>::cast((([&]() -> ast_boost::SetupVariantMacro {
+		ast_boost::SetupVariantMacro __mks_233;
+		das_zero(__mks_233);
+		das_copy((__mks_233.__rtti),(((void *)(&__type_info__47dfa545))));
+		das_copy((__mks_233.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupVariantMacro'__finalize SetupVariantMacro*/ 3331394372u)))));
+		das_copy((__mks_233.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`apply SetupAnyAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3244528381u)))));
+		das_copy((__mks_233.annotation_function_call),(((char *) "add_new_variant_macro")));
+		das_copy((__mks_233.setup_call),(Func(__context__->fnIdxByMangledName(/*@ast_boost::SetupAnyAnnotation`setup_call SetupAnyAnnotation #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 2907559475u))));
+		return __mks_233;
+	})()));
+}
+
+inline void _FuncSetupVariantMacro_0x27___finalize_b79d909c1ea0f836 ( Context * __context__, ast_boost::SetupVariantMacro &  __self_rename_at_233 )
+{
+	finalize_85331723c3a41f85(__context__,das_arg<ast_boost::SetupVariantMacro>::pass(__self_rename_at_233));
+}
+
+inline ast_boost::TagFunctionAnnotation TagFunctionAnnotation_57304080665d5131 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::TagFunctionAnnotation>::cast((([&]() -> ast_boost::TagFunctionAnnotation {
+		ast_boost::TagFunctionAnnotation __mks_99;
+		das_zero(__mks_99);
+		das_copy((__mks_99.__rtti),(((void *)(&__type_info__9750d32))));
+		das_copy((__mks_99.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionAnnotation'__finalize TagFunctionAnnotation*/ 573253282u)))));
+		das_copy((__mks_99.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionAnnotation`apply TagFunctionAnnotation #smart_ptr##handle#Function #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3543694566u)))));
+		return __mks_99;
+	})()));
+}
+
+inline void _FuncTagFunctionAnnotation_0x27___finalize_400b05223c4c5d5c ( Context * __context__, ast_boost::TagFunctionAnnotation &  __self_rename_at_99 )
+{
+	finalize_5c3a9a623f3d9b38(__context__,das_arg<ast_boost::TagFunctionAnnotation>::pass(__self_rename_at_99));
+}
+
+inline bool _FuncTagFunctionAnnotation_0x60_apply_2bfa9b1b2f01b33 ( Context * __context__, ast_boost::TagFunctionAnnotation &  __self_rename_at_100, smart_ptr_raw<Function> __func_rename_at_100, ModuleGroup &  __group_rename_at_100, AnnotationArgumentList const  &  __args_rename_at_100, das::string &  __errors_rename_at_100 )
+{
+	{
+		bool __need_loop_101 = true;
+		// arg : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __arg_iterator(__args_rename_at_100);
+		AnnotationArgument const  * __arg_rename_at_101;
+		__need_loop_101 = __arg_iterator.first(__context__,(__arg_rename_at_101)) && __need_loop_101;
+		for ( ; __need_loop_101 ; __need_loop_101 = __arg_iterator.next(__context__,(__arg_rename_at_101)) )
+		{
+			TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __val_rename_at_102_ConstRef = ((TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_101),__context__)));
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __val_rename_at_102 = __val_rename_at_102_ConstRef; ;
+			if ( !das_get_variant_field<bool,16,0>::is(__val_rename_at_102) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_100),((char *) "tag_function annotation expects only tag names"));
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__arg_iterator.close(__context__,(__arg_rename_at_101));
+	};
+	__func_rename_at_100->flags /*flags*/ |= 0x80u;
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline ast_boost::TagFunctionMacro TagFunctionMacro_4a29167ac64eec83 ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::TagFunctionMacro>::cast((([&]() -> ast_boost::TagFunctionMacro {
+		ast_boost::TagFunctionMacro __mks_245;
+		das_zero(__mks_245);
+		das_copy((__mks_245.__rtti),(((void *)(&__type_info__6e24d8c9))));
+		das_copy((__mks_245.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro'__finalize TagFunctionMacro*/ 1859051822u)))));
+		das_copy((__mks_245.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro`apply TagFunctionMacro #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 793789613u)))));
+		das_copy((__mks_245.annotation_function_call),(((char *) "setup_tag_annotation")));
+		das_copy((__mks_245.setup_call),(das_cast<Func DAS_COMMENT((void,ast_boost::SetupAnyAnnotation,smart_ptr_raw<Structure>,smart_ptr_raw<ExprCall>))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagFunctionMacro`setup_call TagFunctionMacro #smart_ptr##handle#Structure #smart_ptr##handle#ExprCall*/ 103453331u)))));
+		return __mks_245;
+	})()));
+}
+
+inline void _FuncTagFunctionMacro_0x27___finalize_7c3d528f8f526926 ( Context * __context__, ast_boost::TagFunctionMacro &  __self_rename_at_245 )
+{
+	finalize_34eecdde29f42869(__context__,das_arg<ast_boost::TagFunctionMacro>::pass(__self_rename_at_245));
+}
+
+inline bool _FuncTagFunctionMacro_0x60_apply_ed8a34771fbec73e ( Context * __context__, ast_boost::TagFunctionMacro &  __self_rename_at_251, smart_ptr_raw<Structure> __st_rename_at_251, ModuleGroup &  __group_rename_at_251, AnnotationArgumentList const  &  __args_rename_at_251, das::string &  __errors_rename_at_251 )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __argTag_rename_at_252_ConstRef = ((TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(find_arg_e807475ba6ab1a80(__context__,((char *) "tag"),__args_rename_at_251)));
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __argTag_rename_at_252 = __argTag_rename_at_252_ConstRef; ;
+	if ( das_get_variant_field<vec4f,16,8>::is(__argTag_rename_at_252) )
+	{
+		builtin_throw(((char *) "missing tag argument"),__context__);
+	} else if ( !das_get_variant_field<char *,16,7>::is(__argTag_rename_at_252) )
+	{
+		builtin_throw(((char *) "tag must be string"),__context__);
+	};
+	das_copy(__self_rename_at_251.tag,das_get_variant_field<char *,16,7>::as(__argTag_rename_at_252,__context__));
+	return das_auto_cast<bool>::cast(_FuncSetupAnyAnnotation_0x60_apply_b225e56395db6bf7(__context__,das_arg<ast_boost::SetupAnyAnnotation>::pass(das_cast<ast_boost::SetupAnyAnnotation>::cast(__self_rename_at_251)),__st_rename_at_251,das_arg<ModuleGroup>::pass(__group_rename_at_251),__args_rename_at_251,das_arg<das::string>::pass(__errors_rename_at_251)));
+}
+
+inline void _FuncTagFunctionMacro_0x60_setup_call_dc398a9148370dbf ( Context * __context__, ast_boost::TagFunctionMacro &  __self_rename_at_248, smart_ptr_raw<Structure> __st_rename_at_248, smart_ptr_raw<ExprCall> __cll_rename_at_248 ) { das_stack_prologue __prologue(__context__,192,"TagFunctionMacro`setup_call " DAS_FILE_LINE);
+{
+	emplace_new_b3a35ef7dd55c571(__context__,das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_248->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_249) {
+		das_copy((__mks_249.at /*at*/),(__st_rename_at_248->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_249.text /*value*/),__self_rename_at_248.name);
+		}	})))));
+	emplace_new_b3a35ef7dd55c571(__context__,das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_248->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_250) {
+		das_copy((__mks_250.at /*at*/),(__st_rename_at_248->at /*at*/));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_250.text /*value*/),__self_rename_at_248.tag);
+		}	})))));
+}}
+
+inline ast_boost::TagStructureAnnotation TagStructureAnnotation_d1eb037a439b188a ( Context * __context__ )
+{
+	return das_auto_cast<ast_boost::TagStructureAnnotation>::cast((([&]() -> ast_boost::TagStructureAnnotation {
+		ast_boost::TagStructureAnnotation __mks_109;
+		das_zero(__mks_109);
+		das_copy((__mks_109.__rtti),(((void *)(&__type_info__b365c4dd))));
+		das_copy((__mks_109.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagStructureAnnotation'__finalize TagStructureAnnotation*/ 3613324266u)))));
+		das_copy((__mks_109.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@ast_boost::TagStructureAnnotation`apply TagStructureAnnotation #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 3369750713u)))));
+		return __mks_109;
+	})()));
+}
+
+inline void _FuncTagStructureAnnotation_0x27___finalize_d17ab9b248fa8dfe ( Context * __context__, ast_boost::TagStructureAnnotation &  __self_rename_at_109 )
+{
+	finalize_3bd74c4615c1a065(__context__,das_arg<ast_boost::TagStructureAnnotation>::pass(__self_rename_at_109));
+}
+
+inline bool _FuncTagStructureAnnotation_0x60_apply_fbfe797e327f843b ( Context * __context__, ast_boost::TagStructureAnnotation &  __self_rename_at_110, smart_ptr_raw<Structure> __str_rename_at_110, ModuleGroup &  __group_rename_at_110, AnnotationArgumentList const  &  __args_rename_at_110, das::string &  __errors_rename_at_110 )
+{
+	{
+		bool __need_loop_111 = true;
+		// arg : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __arg_iterator(__args_rename_at_110);
+		AnnotationArgument const  * __arg_rename_at_111;
+		__need_loop_111 = __arg_iterator.first(__context__,(__arg_rename_at_111)) && __need_loop_111;
+		for ( ; __need_loop_111 ; __need_loop_111 = __arg_iterator.next(__context__,(__arg_rename_at_111)) )
+		{
+			TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __val_rename_at_112_ConstRef = ((TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>)das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_111),__context__)));
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __val_rename_at_112 = __val_rename_at_112_ConstRef; ;
+			if ( !das_get_variant_field<bool,16,0>::is(__val_rename_at_112) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_110),((char *) "tag_structure annotation expects only tag names"));
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__arg_iterator.close(__context__,(__arg_rename_at_111));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void apply_tag_annotation_defdf759f8201948 ( Context * __context__, char * const  __tag_rename_at_140, smart_ptr_raw<FunctionAnnotation> const  __ann_rename_at_140 ) { das_stack_prologue __prologue(__context__,96,"apply_tag_annotation " DAS_FILE_LINE);
+{
+	for_each_tag_function_7aff7793ef528ba2(__context__,thisModule(__context__,nullptr),__tag_rename_at_140,das_make_block<void,smart_ptr_raw<Function>>(__context__,80,0,&__func_info__13ce5ebc,[&](smart_ptr_raw<Function> __func_rename_at_141)->void{
+		addFunctionFunctionAnnotation(__func_rename_at_141,__ann_rename_at_140,__context__);
+	}));
+}}
+
+inline void _Funcast_0x60_add_new_function_annotation_507c1e335fe6fe98 ( Context * __context__, char * const  __name_rename_at_505, ast_boost::MacroMacro * const  __someClassPtr_rename_at_505 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_506; das_zero(__ann_rename_at_506); das_move(__ann_rename_at_506, _Funcast_0x60_make_function_annotation_31c399a85a11c1a8(__context__,__name_rename_at_505,__someClassPtr_rename_at_505));
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_506,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_506);
+}
+
+inline void _Funcast_0x60_add_new_function_annotation_baad1a7e42f1eb30 ( Context * __context__, char * const  __name_rename_at_505, ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_505 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_506; das_zero(__ann_rename_at_506); das_move(__ann_rename_at_506, _Funcast_0x60_make_function_annotation_aeb0ef1420bb9f8(__context__,__name_rename_at_505,__someClassPtr_rename_at_505));
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_506,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_506);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_7d0a3036e0a7ce88 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_996b4c988528cd83(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_a8bfd79330be0a7a ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_74e71f437665294d(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_372d7e51bf6d8f26 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_7c86f1bc00cb4215(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_f78fa3f19ea0eb3a ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_459d9c0aba749c91(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_67bcb17f50f22efe ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_15288689f6515f9(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_5d7c8849960ddb6e ( Context * __context__, char * const  __name_rename_at_511, ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_80119e96a7cfdea1(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_c1df48163ae77046 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_ee2ddebff91e8f69(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_ede197d780f77e76 ( Context * __context__, char * const  __name_rename_at_511, ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_cb4a1baea3ec7295(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline void _Funcast_0x60_add_new_variant_macro_be020d32f058f724 ( Context * __context__, char * const  __name_rename_at_517, ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_517 )
+{
+	smart_ptr_raw<VariantMacro> __ann_rename_at_518; das_zero(__ann_rename_at_518); das_move(__ann_rename_at_518, _Funcast_0x60_make_variant_macro_69733492c271937a(__context__,__name_rename_at_517,__someClassPtr_rename_at_517));
+	addModuleVariantMacro(thisModule(__context__,nullptr),__ann_rename_at_518,__context__);
+	das_delete_handle<smart_ptr_raw<VariantMacro>>::clear(__context__,__ann_rename_at_518);
+}
+
+inline char * _Funcast_0x60_describe_271182824caabcc8 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __decl_rename_at_24, bool __extra_rename_at_24, bool __contracts_rename_at_24, bool __modules_rename_at_24 )
+{
+	return das_auto_cast<char *>::cast(((char *)(ast_describe_typedecl(__decl_rename_at_24,__extra_rename_at_24,__contracts_rename_at_24,__modules_rename_at_24,__context__))));
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_31c399a85a11c1a8 ( Context * __context__, char * const  __name_rename_at_447, ast_boost::MacroMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = ((StructInfo const  *)_Funcrtti_0x60_class_info_870220293f929e68(__context__,das_deref(__context__,__someClassPtr_rename_at_447)));
+	return das_auto_cast<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_447,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_447),__classInfo_rename_at_449,__context__));
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_aeb0ef1420bb9f8 ( Context * __context__, char * const  __name_rename_at_447, ast_boost::TagFunctionAnnotation * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = ((StructInfo const  *)_Funcrtti_0x60_class_info_de41e21f48cd79b9(__context__,das_deref(__context__,__someClassPtr_rename_at_447)));
+	return das_auto_cast<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_447,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_447),__classInfo_rename_at_449,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_996b4c988528cd83 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupCallMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_cb28c2899eff6cd5(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_74e71f437665294d ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupFunctionAnnotatoin * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_c28e31b8ff3590ae(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_7c86f1bc00cb4215 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupInferMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_a3367fd1365ead61(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_459d9c0aba749c91 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupReaderMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_207e1cace0edd01e(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_15288689f6515f9 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupStructureMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_569c358976380014(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_80119e96a7cfdea1 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::SetupVariantMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_c647ffe64658895c(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_ee2ddebff91e8f69 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::TagFunctionMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_5155812a8dbff6f8(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_cb4a1baea3ec7295 ( Context * __context__, char * const  __name_rename_at_455, ast_boost::TagStructureAnnotation * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_37a8fb9b7aaa6d7c(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_69733492c271937a ( Context * __context__, char * const  __name_rename_at_497, ast_boost::BetterRttiVisitor * const  __someClassPtr_rename_at_497 )
+{
+	StructInfo const  * __classInfo_rename_at_499 = ((StructInfo const  *)_Funcrtti_0x60_class_info_7493c4d5b10b66bf(__context__,das_deref(__context__,__someClassPtr_rename_at_497)));
+	return das_auto_cast<smart_ptr_raw<VariantMacro>>::cast(makeVariantMacro(__name_rename_at_497,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_497),__classInfo_rename_at_499,__context__));
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline ExprBlock * _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903 ( Context * __context__, smart_ptr_raw<ExprBlock> const  __src_rename_at_436 )
+{
+	return das_auto_cast<ExprBlock *>::cast(das_cast<ExprBlock *>::cast(__src_rename_at_436));
+}
+
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_436 )
+{
+	return das_auto_cast<Structure *>::cast(das_cast<Structure *>::cast(__src_rename_at_436));
+}
+
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> &  __Arr_rename_at_37, char * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void clone_1ef034caa879bc4c ( Context * __context__, smart_ptr<Enumeration> & __dest_rename_at_414, Enumeration * const  __src_rename_at_414 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_414),das_auto_cast<void * const >::cast(__src_rename_at_414));
+}
+
+inline void clone_71630f94910d7ae0 ( Context * __context__, smart_ptr_raw<Function> & __dest_rename_at_190, void * const  __src_rename_at_190 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_190),__src_rename_at_190);
+}
+
+inline void clone_52db9e6ecf8de48 ( Context * __context__, smart_ptr_raw<MakeFieldDecl> & __dest_rename_at_86, void * const  __src_rename_at_86 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_86),__src_rename_at_86);
+}
+
+inline void clone_acf198b9505dc74 ( Context * __context__, smart_ptr_raw<TypeDecl> & __dest_rename_at_372, void * const  __src_rename_at_372 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_372),__src_rename_at_372);
+}
+
+inline void clone_a077761c55200f4e ( Context * __context__, smart_ptr<TypeDecl> & __dest_rename_at_294, smart_ptr_raw<TypeDecl> const  __src_rename_at_294 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_294),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_294));
+}
+
+inline char * const  describe_af12bb9460e41077 ( Context * __context__, AnnotationArgumentList const  &  __list_rename_at_11 )
+{
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		TArray<char *> ____acomp_12_rename_at_12; das_zero(____acomp_12_rename_at_12);
+		{
+			bool __need_loop_12 = true;
+			// arg : rtti::AnnotationArgument const&
+			das_iterator<AnnotationArgumentList const > __arg_iterator(__list_rename_at_11);
+			AnnotationArgument const  * __arg_rename_at_12;
+			__need_loop_12 = __arg_iterator.first(__context__,(__arg_rename_at_12)) && __need_loop_12;
+			for ( ; __need_loop_12 ; __need_loop_12 = __arg_iterator.next(__context__,(__arg_rename_at_12)) )
+			{
+				TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_12_240;
+				_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_12_rename_at_12),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<das::string const  &>::from((*__arg_rename_at_12).name /*name*/), cast<char * const >::from(((char *) "=")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> &>::from((_temp_make_local_12_240 = (das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_12),__context__))))))));
+			}
+			__arg_iterator.close(__context__,(__arg_rename_at_12));
+		};
+		return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_12_rename_at_12);
+	})),((char *) ",")));
+}
+
+inline char * describe_5c90f6710f594395 ( Context * __context__, AnnotationDeclaration const  &  __ann_rename_at_14 )
+{
+	return das_auto_cast<char *>::cast((__ann_rename_at_14.arguments /*arguments*/.size() /*length*/ != 0) ? das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_2, cast<das::string const  &>::from(__ann_rename_at_14.annotation /*annotation*/->name /*name*/), cast<char * const >::from(((char *) "(")), cast<char * const >::from(describe_af12bb9460e41077(__context__,__ann_rename_at_14.arguments /*arguments*/)), cast<char * const >::from(((char *) ")"))))) : das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<das::string const  &>::from(__ann_rename_at_14.annotation /*annotation*/->name /*name*/)))));
+}
+
+inline char * const  describe_af25d3f328486703 ( Context * __context__, AnnotationList const  &  __list_rename_at_20 )
+{
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		TArray<char *> ____acomp_21_rename_at_21; das_zero(____acomp_21_rename_at_21);
+		{
+			bool __need_loop_21 = true;
+			// arg : smart_ptr<rtti::AnnotationDeclaration> const&
+			das_iterator<AnnotationList const > __arg_iterator(__list_rename_at_20);
+			smart_ptr<AnnotationDeclaration> const  * __arg_rename_at_21;
+			__need_loop_21 = __arg_iterator.first(__context__,(__arg_rename_at_21)) && __need_loop_21;
+			for ( ; __need_loop_21 ; __need_loop_21 = __arg_iterator.next(__context__,(__arg_rename_at_21)) )
+			{
+				_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_21_rename_at_21),describe_5c90f6710f594395(__context__,das_deref(__context__,(*__arg_rename_at_21))));
+			}
+			__arg_iterator.close(__context__,(__arg_rename_at_21));
+		};
+		return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_21_rename_at_21);
+	})),((char *) ",")));
+}
+
+inline char * describe_function_short_d76957a2f59c1ab ( Context * __context__, smart_ptr_raw<Function> const  __func_rename_at_31 )
+{
+	TArray<char *> __args_rename_at_32; das_zero(__args_rename_at_32); das_move(__args_rename_at_32, das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		TArray<char *> ____acomp_32_rename_at_32; das_zero(____acomp_32_rename_at_32);
+		{
+			bool __need_loop_32 = true;
+			// x : smart_ptr<ast::Variable> const&
+			das_iterator<das::vector<smart_ptr<Variable>> const > __x_iterator(__func_rename_at_31->arguments /*arguments*/);
+			smart_ptr<Variable> const  * __x_rename_at_32;
+			__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+			for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) )
+			{
+				_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_32_rename_at_32),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<das::string const  &>::from((*__x_rename_at_32)->name /*name*/), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Funcast_0x60_describe_271182824caabcc8(__context__,(*__x_rename_at_32)->type /*_type*/,false,true,true)))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_32));
+		};
+		return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_32_rename_at_32);
+	}));
+	char * __res_rename_at_33 = (char *)(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_5, cast<das::string const  &>::from(__func_rename_at_31->name /*name*/), cast<char * const >::from(((char *) " (")), cast<char * const >::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(__args_rename_at_32),((char *) ";"))), cast<char * const >::from(((char *) ") : ")), cast<char *>::from(_Funcast_0x60_describe_271182824caabcc8(__context__,__func_rename_at_31->result /*result*/,false,true,true)))));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__args_rename_at_32));
+	return das_auto_cast<char *>::cast(__res_rename_at_33);
+}
+
+inline void emplace_5e74981d9fc8c8a4 ( Context * __context__, MakeStruct &  __vec_rename_at_84, smart_ptr_raw<MakeFieldDecl> __ptr_rename_at_84 )
+{
+	mks_vector_push(das_arg<MakeStruct>::pass(__vec_rename_at_84),__ptr_rename_at_84);
+	clone_52db9e6ecf8de48(__context__,__ptr_rename_at_84,nullptr);
+}
+
+inline void emplace_new_b3a35ef7dd55c571 ( Context * __context__, das::vector<smart_ptr<Expression>> &  __vec_rename_at_75, smart_ptr_raw<Expression> __ptr_rename_at_75 )
+{
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__vec_rename_at_75),__ptr_rename_at_75);
+}
+
+inline void emplace_new_8114bb826d9cea6d ( Context * __context__, das::vector<smart_ptr<TypeDecl>> &  __vec_rename_at_78, smart_ptr_raw<TypeDecl> __ptr_rename_at_78 )
+{
+	das_vector_emplace(das_arg<das::vector<smart_ptr<TypeDecl>>>::pass(__vec_rename_at_78),__ptr_rename_at_78);
+}
+
+inline void emplace_new_459ce6f72cdf9c0d ( Context * __context__, das::vector<smart_ptr<Variable>> &  __vec_rename_at_81, smart_ptr_raw<Variable> __ptr_rename_at_81 )
+{
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Variable>>>::pass(__vec_rename_at_81),__ptr_rename_at_81);
+}
+
+inline void finalize_e39f6bf3901fe65e ( Context * __context__, ast_boost::BetterRttiVisitor &  ____this_rename_at_262 )
+{
+	memset(&(____this_rename_at_262), 0, 24);
+}
+
+inline void finalize_1e05286024ffc9 ( Context * __context__, ast_boost::MacroMacro &  ____this_rename_at_88 )
+{
+	memset(&(____this_rename_at_88), 0, 24);
+}
+
+inline void finalize_c692ee85a5c3705d ( Context * __context__, ast_boost::SetupAnyAnnotation &  ____this_rename_at_204 )
+{
+	memset(&(____this_rename_at_204), 0, 48);
+}
+
+inline void finalize_7741f20af8b390dc ( Context * __context__, ast_boost::SetupCallMacro &  ____this_rename_at_236 )
+{
+	memset(&(____this_rename_at_236), 0, 48);
+}
+
+inline void finalize_d2d8d932b76c8507 ( Context * __context__, ast_boost::SetupFunctionAnnotatoin &  ____this_rename_at_227 )
+{
+	memset(&(____this_rename_at_227), 0, 48);
+}
+
+inline void finalize_549b36d594098850 ( Context * __context__, ast_boost::SetupInferMacro &  ____this_rename_at_242 )
+{
+	memset(&(____this_rename_at_242), 0, 48);
+}
+
+inline void finalize_7fe48452de3177af ( Context * __context__, ast_boost::SetupReaderMacro &  ____this_rename_at_230 )
+{
+	memset(&(____this_rename_at_230), 0, 48);
+}
+
+inline void finalize_408cec3a0eef18bd ( Context * __context__, ast_boost::SetupStructureMacro &  ____this_rename_at_239 )
+{
+	memset(&(____this_rename_at_239), 0, 48);
+}
+
+inline void finalize_85331723c3a41f85 ( Context * __context__, ast_boost::SetupVariantMacro &  ____this_rename_at_233 )
+{
+	memset(&(____this_rename_at_233), 0, 48);
+}
+
+inline void finalize_5c3a9a623f3d9b38 ( Context * __context__, ast_boost::TagFunctionAnnotation &  ____this_rename_at_99 )
+{
+	memset(&(____this_rename_at_99), 0, 24);
+}
+
+inline void finalize_34eecdde29f42869 ( Context * __context__, ast_boost::TagFunctionMacro &  ____this_rename_at_245 )
+{
+	memset(&(____this_rename_at_245), 0, 56);
+}
+
+inline void finalize_3bd74c4615c1a065 ( Context * __context__, ast_boost::TagStructureAnnotation &  ____this_rename_at_109 )
+{
+	memset(&(____this_rename_at_109), 0, 24);
+}
+
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> find_arg_e807475ba6ab1a80 ( Context * __context__, char * const  __argn_rename_at_133, AnnotationArgumentList const  &  __args_rename_at_133 )
+{
+	{
+		bool __need_loop_134 = true;
+		// a : rtti::AnnotationArgument const&
+		das_iterator<AnnotationArgumentList const > __a_iterator(__args_rename_at_133);
+		AnnotationArgument const  * __a_rename_at_134;
+		__need_loop_134 = __a_iterator.first(__context__,(__a_rename_at_134)) && __need_loop_134;
+		for ( ; __need_loop_134 ; __need_loop_134 = __a_iterator.next(__context__,(__a_rename_at_134)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<das::string const  &>::from((*__a_rename_at_134).name /*name*/)))),cast<char *>::from(__argn_rename_at_133),*__context__) )
+			{
+				return das_auto_cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::cast(das_alias<RttiValue>::from(rtti_builtin_argument_value((*__a_rename_at_134),__context__)));
+			};
+		}
+		__a_iterator.close(__context__,(__a_rename_at_134));
+	};
+	return das_auto_cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::cast(_Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d(__context__));
+}
+
+inline smart_ptr_raw<Function> find_unique_function_c1c726d6baf9b089 ( Context * __context__, Module * const  __mod_rename_at_151, char * const  __name_rename_at_151 ) { das_stack_prologue __prologue(__context__,128,"find_unique_function " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __res_rename_at_152; das_zero(__res_rename_at_152);
+	int32_t __count_rename_at_153 = 0;
+	forEachFunction(__mod_rename_at_151,__name_rename_at_151,das_make_block<void,smart_ptr<Function>>(__context__,112,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_154)->void{
+		das_move(__res_rename_at_152,__func_rename_at_154);
+		__count_rename_at_153++;
+	}),__context__,nullptr);
+	if ( __count_rename_at_153 > 1 )
+	{
+		builtin_throw(((char *) "more than one function encountered"),__context__);
+	};
+	return das_auto_cast<smart_ptr_raw<Function>>::cast(__res_rename_at_152);
+}}
+
+inline smart_ptr_raw<Function> find_unique_generic_996fda7c20037ea9 ( Context * __context__, Module * const  __mod_rename_at_161, char * const  __name_rename_at_161 ) { das_stack_prologue __prologue(__context__,128,"find_unique_generic " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __res_rename_at_162; das_zero(__res_rename_at_162);
+	int32_t __count_rename_at_163 = 0;
+	forEachGenericFunction(__mod_rename_at_161,__name_rename_at_161,das_make_block<void,smart_ptr<Function>>(__context__,112,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_164)->void{
+		das_move(__res_rename_at_162,__func_rename_at_164);
+		__count_rename_at_163++;
+	}),__context__,nullptr);
+	if ( __count_rename_at_163 > 1 )
+	{
+		builtin_throw(((char *) "more than one generic function encountered"),__context__);
+	};
+	return das_auto_cast<smart_ptr_raw<Function>>::cast(__res_rename_at_162);
+}}
+
+inline void for_each_tag_function_7aff7793ef528ba2 ( Context * __context__, Module * const  __mod_rename_at_119, char * const  __tag_rename_at_119, Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  &  __blk_rename_at_119 ) { das_stack_prologue __prologue(__context__,352,"for_each_tag_function " DAS_FILE_LINE);
+{
+	forEachFunction(__mod_rename_at_119,((char *) ""),das_make_block<void,smart_ptr<Function>>(__context__,80,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_120)->void{
+		{
+			bool __need_loop_121 = true;
+			// ann : smart_ptr<rtti::AnnotationDeclaration>&
+			das_iterator<AnnotationList> __ann_iterator(__func_rename_at_120->annotations /*annotations*/);
+			smart_ptr<AnnotationDeclaration> * __ann_rename_at_121;
+			__need_loop_121 = __ann_iterator.first(__context__,(__ann_rename_at_121)) && __need_loop_121;
+			for ( ; __need_loop_121 ; __need_loop_121 = __ann_iterator.next(__context__,(__ann_rename_at_121)) )
+			{
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<das::string &>::from((*__ann_rename_at_121)->annotation /*annotation*/->name /*name*/)))),cast<char *>::from(((char *) "tag_function")),*__context__) )
+				{
+					{
+						bool __need_loop_123 = true;
+						// t : rtti::AnnotationArgument&
+						das_iterator<AnnotationArgumentList> __t_iterator((*__ann_rename_at_121)->arguments /*arguments*/);
+						AnnotationArgument * __t_rename_at_123;
+						__need_loop_123 = __t_iterator.first(__context__,(__t_rename_at_123)) && __need_loop_123;
+						for ( ; __need_loop_123 ; __need_loop_123 = __t_iterator.next(__context__,(__t_rename_at_123)) )
+						{
+							if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<das::string &>::from((*__t_rename_at_123).name /*name*/)))),cast<char *>::from(__tag_rename_at_119),*__context__) )
+							{
+								das_invoke<void>::invoke<smart_ptr<Function>>(__context__,__blk_rename_at_119,__func_rename_at_120);
+							};
+						}
+						__t_iterator.close(__context__,(__t_rename_at_123));
+					};
+				};
+			}
+			__ann_iterator.close(__context__,(__ann_rename_at_121));
+		};
+	}),__context__,nullptr);
+	forEachGenericFunction(__mod_rename_at_119,((char *) ""),das_make_block<void,smart_ptr<Function>>(__context__,240,0,&__func_info__13ce5ebc,[&](smart_ptr<Function> __func_rename_at_126)->void{
+		{
+			bool __need_loop_127 = true;
+			// ann : smart_ptr<rtti::AnnotationDeclaration>&
+			das_iterator<AnnotationList> __ann_iterator(__func_rename_at_126->annotations /*annotations*/);
+			smart_ptr<AnnotationDeclaration> * __ann_rename_at_127;
+			__need_loop_127 = __ann_iterator.first(__context__,(__ann_rename_at_127)) && __need_loop_127;
+			for ( ; __need_loop_127 ; __need_loop_127 = __ann_iterator.next(__context__,(__ann_rename_at_127)) )
+			{
+				if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<das::string &>::from((*__ann_rename_at_127)->annotation /*annotation*/->name /*name*/)))),cast<char *>::from(((char *) "tag_function")),*__context__) )
+				{
+					{
+						bool __need_loop_129 = true;
+						// t : rtti::AnnotationArgument&
+						das_iterator<AnnotationArgumentList> __t_iterator((*__ann_rename_at_127)->arguments /*arguments*/);
+						AnnotationArgument * __t_rename_at_129;
+						__need_loop_129 = __t_iterator.first(__context__,(__t_rename_at_129)) && __need_loop_129;
+						for ( ; __need_loop_129 ; __need_loop_129 = __t_iterator.next(__context__,(__t_rename_at_129)) )
+						{
+							if ( SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_10, cast<das::string &>::from((*__t_rename_at_129).name /*name*/)))),cast<char *>::from(__tag_rename_at_119),*__context__) )
+							{
+								das_invoke<void>::invoke<smart_ptr<Function>>(__context__,__blk_rename_at_119,__func_rename_at_126);
+							};
+						}
+						__t_iterator.close(__context__,(__t_rename_at_129));
+					};
+				};
+			}
+			__ann_iterator.close(__context__,(__ann_rename_at_127));
+		};
+	}),__context__,nullptr);
+}}
+
+inline bool isExpression_c0b61513ca47d4ed ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_37, bool __top_rename_at_37 )
+{
+	if ( equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__t_rename_at_37),nullptr) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __t_rename_at_37->dim /*dim*/.size() /*length*/ != 0 )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __t_rename_at_37->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		return das_auto_cast<bool>::cast((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_11, cast<das::string const  &>::from(__t_rename_at_37->annotation /*annotation*/->module /*_module*/->name /*name*/)))),cast<char *>::from(((char *) "ast")),*__context__)) ? das_auto_cast<bool>::cast(builtin_string_startswith(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_12, cast<das::string const  &>::from(__t_rename_at_37->annotation /*annotation*/->name /*name*/))),((char *) "Expr"),__context__)) : das_auto_cast<bool>::cast(false));
+	} else return das_auto_cast<bool>::cast(((__t_rename_at_37->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer) && __top_rename_at_37) ? das_auto_cast<bool>::cast(isExpression_c0b61513ca47d4ed(__context__,__t_rename_at_37->firstType /*firstType*/,false)) : das_auto_cast<bool>::cast(false));
+}
+
+inline bool is_class_method_88832b5548c6df12 ( Context * __context__, smart_ptr_raw<Structure> const  __cinfo_rename_at_60, smart_ptr_raw<TypeDecl> const  __finfo_rename_at_60 )
+{
+	return das_auto_cast<bool>::cast((__finfo_rename_at_60->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tFunction) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(((__finfo_rename_at_60->dim /*dim*/.size() /*length*/ != 0) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(((__finfo_rename_at_60->argTypes /*argTypes*/.size() /*length*/ == 0) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(((das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__finfo_rename_at_60->argTypes /*argTypes*/,0,__context__)->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(((das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__finfo_rename_at_60->argTypes /*argTypes*/,0,__context__)->dim /*dim*/.size() /*length*/ != 0) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast((!(is_same_or_inherited_c5c182a7778b0270(__context__,das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__finfo_rename_at_60->argTypes /*argTypes*/,0,__context__)->structType /*structType*/,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__cinfo_rename_at_60))) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(true))))))))))));
+}
+
+inline bool is_same_or_inherited_c5c182a7778b0270 ( Context * __context__, Structure * const  __parent_rename_at_52, Structure * const  __child_rename_at_52 )
+{
+	Structure * __ch_rename_at_53 = __child_rename_at_52;
+	while ( __ch_rename_at_53 != nullptr )
+	{
+		if ( __parent_rename_at_52 == __ch_rename_at_53 )
+		{
+			return das_auto_cast<bool>::cast(true);
+		} else {
+			das_copy(__ch_rename_at_53,__ch_rename_at_53->parent /*parent*/);
+		};
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d ( Context * __context__ )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> __t_rename_at_109; das_zero(__t_rename_at_109);
+	set_variant_index(das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass(das_alias<RttiValue>::from(__t_rename_at_109)),8);
+	return das_auto_cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::cast(das_alias<RttiValue>::from(__t_rename_at_109));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_7493c4d5b10b66bf ( Context * __context__, ast_boost::BetterRttiVisitor const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_870220293f929e68 ( Context * __context__, ast_boost::MacroMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_cb28c2899eff6cd5 ( Context * __context__, ast_boost::SetupCallMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_c28e31b8ff3590ae ( Context * __context__, ast_boost::SetupFunctionAnnotatoin const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_a3367fd1365ead61 ( Context * __context__, ast_boost::SetupInferMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_207e1cace0edd01e ( Context * __context__, ast_boost::SetupReaderMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_569c358976380014 ( Context * __context__, ast_boost::SetupStructureMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_c647ffe64658895c ( Context * __context__, ast_boost::SetupVariantMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_de41e21f48cd79b9 ( Context * __context__, ast_boost::TagFunctionAnnotation const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_5155812a8dbff6f8 ( Context * __context__, ast_boost::TagFunctionMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_37a8fb9b7aaa6d7c ( Context * __context__, ast_boost::TagStructureAnnotation const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline void setup_3bef15dee5a72be1 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "ast_boost"),__context__) )
+	{
+		_Funcast_0x60_add_new_function_annotation_507c1e335fe6fe98(__context__,((char *) "macro"),das_new<ast_boost::MacroMacro>::make_and_init(__context__,[&]() { return MacroMacro_e1497d11cb4c9357(__context__); }));
+		_Funcast_0x60_add_new_function_annotation_baad1a7e42f1eb30(__context__,((char *) "tag_function"),das_new<ast_boost::TagFunctionAnnotation>::make_and_init(__context__,[&]() { return TagFunctionAnnotation_57304080665d5131(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_a8bfd79330be0a7a(__context__,((char *) "function_macro"),das_new<ast_boost::SetupFunctionAnnotatoin>::make_and_init(__context__,[&]() { return SetupFunctionAnnotatoin_6d9482648142635a(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_f78fa3f19ea0eb3a(__context__,((char *) "reader_macro"),das_new<ast_boost::SetupReaderMacro>::make_and_init(__context__,[&]() { return SetupReaderMacro_8e8d3db9c197654c(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_7d0a3036e0a7ce88(__context__,((char *) "call_macro"),das_new<ast_boost::SetupCallMacro>::make_and_init(__context__,[&]() { return SetupCallMacro_ce09ce16832b37e7(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_5d7c8849960ddb6e(__context__,((char *) "variant_macro"),das_new<ast_boost::SetupVariantMacro>::make_and_init(__context__,[&]() { return SetupVariantMacro_2a396ba9b134f200(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_67bcb17f50f22efe(__context__,((char *) "structure_macro"),das_new<ast_boost::SetupStructureMacro>::make_and_init(__context__,[&]() { return SetupStructureMacro_e20ca428af1a3ebb(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_372d7e51bf6d8f26(__context__,((char *) "infer_macro"),das_new<ast_boost::SetupInferMacro>::make_and_init(__context__,[&]() { return SetupInferMacro_d7c7d678a18447e9(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_ede197d780f77e76(__context__,((char *) "tag_structure"),das_new<ast_boost::TagStructureAnnotation>::make_and_init(__context__,[&]() { return TagStructureAnnotation_d1eb037a439b188a(__context__); }));
+		_Funcast_0x60_add_new_structure_annotation_c1df48163ae77046(__context__,((char *) "tag_function_macro"),das_new<ast_boost::TagFunctionMacro>::make_and_init(__context__,[&]() { return TagFunctionMacro_4a29167ac64eec83(__context__); }));
+		_Funcast_0x60_add_new_variant_macro_be020d32f058f724(__context__,((char *) "better_rtti_in_expr"),das_new<ast_boost::BetterRttiVisitor>::make_and_init(__context__,[&]() { return BetterRttiVisitor_b07efdfcacb5d90d(__context__); }));
+	};
+}
+
+inline ExprBlock * setup_macro_fa52c3d6afe8fb88 ( Context * __context__, char * const  __name_rename_at_171, LineInfo const  &  __at_rename_at_171 ) { das_stack_prologue __prologue(__context__,480,"setup_macro " DAS_FILE_LINE);
+{
+	compileProgram(__context__)->flags /*flags*/ |= 0x20u;
+	smart_ptr_raw<Function> __fn_rename_at_173; das_zero(__fn_rename_at_173); das_move(__fn_rename_at_173, find_unique_function_c1c726d6baf9b089(__context__,compileModule(__context__),__name_rename_at_171));
+	if ( equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__fn_rename_at_173),nullptr) )
+	{
+		das_move(__fn_rename_at_173,das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_175) {
+			das_copy((__mks_175.at /*at*/),(__at_rename_at_171));
+			das_copy((__mks_175.atDecl /*atDecl*/),(__at_rename_at_171));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_175.name /*name*/),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<char * const >::from(__name_rename_at_171))));
+			}		}))));
+		__fn_rename_at_173->flags /*flags*/ |= 0x200000u;
+		__fn_rename_at_173->flags /*flags*/ |= 0x100u;
+		das_move(__fn_rename_at_173->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_178) {
+			das_copy((__mks_178.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::autoinfer));
+			das_copy((__mks_178.at /*at*/),(__at_rename_at_171));
+		}))));
+		smart_ptr_raw<ExprBlock> __blk_rename_at_179; das_zero(__blk_rename_at_179); das_move(__blk_rename_at_179, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_179) {
+			das_copy((__mks_179.at /*at*/),(__at_rename_at_171));
+		}))));
+		smart_ptr_raw<ExprBlock> __iblk_rename_at_180; das_zero(__iblk_rename_at_180); das_move(__iblk_rename_at_180, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_180) {
+			das_copy((__mks_180.at /*at*/),(__at_rename_at_171));
+		}))));
+		ExprBlock * __res_rename_at_181 = ((ExprBlock *)_Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903(__context__,__iblk_rename_at_180));
+		smart_ptr_raw<ExprCall> __ifm_rename_at_182; das_zero(__ifm_rename_at_182); das_move(__ifm_rename_at_182, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_182) {
+			das_copy((__mks_182.at /*at*/),(__at_rename_at_171));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_182.name /*name*/),((char *) "is_compiling_macros_in_module"));
+			}		}))));
+		smart_ptr_raw<ExprConstString> __ifmn_rename_at_183; das_zero(__ifmn_rename_at_183); das_move(__ifmn_rename_at_183, das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_183) {
+			das_copy((__mks_183.at /*at*/),(__at_rename_at_171));
+			{
+				das_clone(__mks_183.text /*value*/,compileModule(__context__)->name /*name*/);
+			}		}))));
+		das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__ifm_rename_at_182->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression>>::pass(__ifmn_rename_at_183));
+		smart_ptr_raw<ExprIfThenElse> __ife_rename_at_185; das_zero(__ife_rename_at_185); das_move(__ife_rename_at_185, das_ascend_handle<true,smart_ptr_raw<ExprIfThenElse>>::make(__context__,nullptr,(([&](ExprIfThenElse & __mks_185) {
+			das_copy((__mks_185.at /*at*/),(__at_rename_at_171));
+			das_move((__mks_185.cond /*cond*/),(__ifm_rename_at_182));
+			das_move((__mks_185.if_true /*if_true*/),(__iblk_rename_at_180));
+		}))));
+		das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_179->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__ife_rename_at_185));
+		das_move(__fn_rename_at_173->body /*body*/,__blk_rename_at_179);
+		if ( !addModuleFunction(compileModule(__context__),__fn_rename_at_173,__context__) )
+		{
+			builtin_throw(((char *) "can't setup"),__context__);
+		};
+		clone_71630f94910d7ae0(__context__,__fn_rename_at_173,nullptr);
+		return das_auto_cast<ExprBlock *>::cast(__res_rename_at_181);
+	} else {
+		if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__fn_rename_at_173->body /*body*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprBlock")),*__context__) )
+		{
+			builtin_throw(((char *) "expecting func.ExprBlock"),__context__);
+		};
+		ExprBlock * __blk_rename_at_196 = das_cast<ExprBlock *>::cast(__fn_rename_at_173->body /*body*/);
+		if ( (__blk_rename_at_196->list /*list*/.size() /*length*/ != 1) || (SimPolicy<char *>::NotEqu(cast<char *>::from(das_index<das::vector<smart_ptr<Expression>>>::at(__blk_rename_at_196->list /*list*/,0,__context__)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprIfThenElse")),*__context__)) )
+		{
+			builtin_throw(((char *) "expecting is_compiling_macros"),__context__);
+		};
+		ExprIfThenElse * __ife_rename_at_199 = das_cast<ExprIfThenElse *>::cast(das_index<das::vector<smart_ptr<Expression>>>::at(__blk_rename_at_196->list /*list*/,0,__context__));
+		if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__ife_rename_at_199->if_true /*if_true*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprBlock")),*__context__) )
+		{
+			builtin_throw(((char *) "expecting ife.if_true.ExprBlock"),__context__);
+		};
+		return das_auto_cast<ExprBlock *>::cast(das_cast<ExprBlock *>::cast(__ife_rename_at_199->if_true /*if_true*/));
+	};
+}}
+
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_16);
+			char * const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_14,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_15,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline smart_ptr_raw<Expression> walk_and_convert_823957177b065231 ( Context * __context__, uint8_t * const  __data_rename_at_417, smart_ptr_raw<TypeDecl> const  __info_rename_at_417, LineInfo const  &  __at_rename_at_417 )
+{
+	if ( __info_rename_at_417->dim /*dim*/.size() /*length*/ != 0 )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_dim_d846b0fdf0ada93e(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_array_15c3eaaaa9e32c7b(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		if ( das_deref(__context__,das_cast<uint8_t * *>::cast(__data_rename_at_417)) == nullptr )
+		{
+			return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstPtr>>::make(__context__,nullptr,(([&](ExprConstPtr & __mks_426) {
+				das_copy((__mks_426.at /*at*/),(__at_rename_at_417));
+			}))));
+		} else return das_auto_cast<smart_ptr_raw<Expression>>::cast(((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__info_rename_at_417->firstType /*firstType*/),nullptr)) || __info_rename_at_417->firstType /*firstType*/->isVoid() /*isVoid*/) ? das_auto_cast<smart_ptr_raw<ExprConstPtr>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstPtr>>::make(__context__,nullptr,(([&](ExprConstPtr & __mks_428) {
+			das_copy((__mks_428.at /*at*/),(__at_rename_at_417));
+		})))) : das_auto_cast<smart_ptr_raw<ExprConstPtr>>::cast(walk_and_convert_pointer_6a9b7fa29b76c567(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417)));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_structure_9e45e99e96ea38dd(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_variant_1a992293e21ba33d(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_tuple_df011f26bdafd3ce(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else if ( __info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_table_fb68009581f6e9ff(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417));
+	} else return das_auto_cast<smart_ptr_raw<Expression>>::cast((((__info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8) || (__info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16)) || (__info_rename_at_417->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration)) ? das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_enumeration_76789bc0e3daa7b8(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417)) : das_auto_cast<smart_ptr_raw<Expression>>::cast(walk_and_convert_basic_3eef5a83c22b80c0(__context__,__data_rename_at_417,__info_rename_at_417,__at_rename_at_417)));
+}
+
+inline smart_ptr_raw<Expression> walk_and_convert_array_15c3eaaaa9e32c7b ( Context * __context__, uint8_t * const  __data_rename_at_272, smart_ptr_raw<TypeDecl> const  __info_rename_at_272, LineInfo const  &  __at_rename_at_272 ) { das_stack_prologue __prologue(__context__,304,"walk_and_convert_array " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_273 = ((int32_t)any_array_size(das_auto_cast<void * const >::cast(__data_rename_at_272)));
+	if ( __total_rename_at_273 != 0 )
+	{
+		int32_t __stride_rename_at_275 = ((int32_t)__info_rename_at_272->firstType /*firstType*/->getSizeOf() /*sizeOf*/);
+		smart_ptr_raw<ExprMakeArray> __mkArr_rename_at_276; das_zero(__mkArr_rename_at_276); das_move(__mkArr_rename_at_276, das_ascend_handle<true,smart_ptr_raw<ExprMakeArray>>::make(__context__,nullptr,(([&](ExprMakeArray & __mks_276) {
+			das_copy((__mks_276.at /*at*/),(__at_rename_at_272));
+			das_move((__mks_276.makeType /*makeType*/),(clone_type(__info_rename_at_272->firstType /*firstType*/)));
+		}))));
+		any_array_foreach(das_auto_cast<void * const >::cast(__data_rename_at_272),__stride_rename_at_275,das_make_block<void,void *>(__context__,144,0,&__func_info__d7ff50a7,[&](void * __value_rename_at_277)->void{
+			smart_ptr_raw<Expression> __elem_rename_at_278; das_zero(__elem_rename_at_278); das_move(__elem_rename_at_278, walk_and_convert_823957177b065231(__context__,das_auto_cast<uint8_t * const >::cast(__value_rename_at_277),__info_rename_at_272->firstType /*firstType*/,__at_rename_at_272));
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkArr_rename_at_276->values /*values*/),__elem_rename_at_278);
+		}),__context__);
+		das_vector_push_value(das_arg<das::vector<int32_t>>::pass(__mkArr_rename_at_276->makeType /*makeType*/->dim /*dim*/),__total_rename_at_273);
+		smart_ptr_raw<ExprCall> __mkToArrayMove_rename_at_281; das_zero(__mkToArrayMove_rename_at_281); das_move(__mkToArrayMove_rename_at_281, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_281) {
+			das_copy((__mks_281.at /*at*/),(__at_rename_at_272));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_281.name /*name*/),((char *) "to_array_move"));
+			}		}))));
+		das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkToArrayMove_rename_at_281->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression>>::pass(__mkArr_rename_at_276));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkToArrayMove_rename_at_281);
+	} else {
+		smart_ptr_raw<ExprMakeStruct> __mkArr_rename_at_285; das_zero(__mkArr_rename_at_285); das_move(__mkArr_rename_at_285, das_ascend_handle<true,smart_ptr_raw<ExprMakeStruct>>::make(__context__,nullptr,(([&](ExprMakeStruct & __mks_285) {
+			das_copy((__mks_285.at /*at*/),(__at_rename_at_272));
+			das_move((__mks_285.makeType /*makeType*/),(clone_type(__info_rename_at_272)));
+		}))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkArr_rename_at_285);
+	};
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_basic_3eef5a83c22b80c0 ( Context * __context__, uint8_t * const  __data_rename_at_379, smart_ptr_raw<TypeDecl> const  __info_rename_at_379, LineInfo const  &  __at_rename_at_379 ) { das_stack_prologue __prologue(__context__,224,"walk_and_convert_basic " DAS_FILE_LINE);
+{
+	if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tInt )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstInt>>::make(__context__,nullptr,(([&](ExprConstInt & __mks_382) {
+			das_copy((__mks_382.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_382.cvalue<int32_t>() /*value*/),(das_deref(__context__,das_cast<int32_t *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tUInt )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstUInt>>::make(__context__,nullptr,(([&](ExprConstUInt & __mks_384) {
+			das_copy((__mks_384.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_384.cvalue<uint32_t>() /*value*/),(das_deref(__context__,das_cast<uint32_t *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tFloat )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstFloat>>::make(__context__,nullptr,(([&](ExprConstFloat & __mks_386) {
+			das_copy((__mks_386.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_386.cvalue<float>() /*value*/),(das_deref(__context__,das_cast<float *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tDouble )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstDouble>>::make(__context__,nullptr,(([&](ExprConstDouble & __mks_388) {
+			das_copy((__mks_388.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_388.cvalue<double>() /*value*/),(das_deref(__context__,das_cast<double *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tBool )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstBool>>::make(__context__,nullptr,(([&](ExprConstBool & __mks_390) {
+			das_copy((__mks_390.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_390.cvalue<bool>() /*value*/),(das_deref(__context__,das_cast<bool *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tRange )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstRange>>::make(__context__,nullptr,(([&](ExprConstRange & __mks_392) {
+			das_copy((__mks_392.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_392.cvalue<range>() /*value*/),(das_deref(__context__,das_cast<range *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tURange )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstURange>>::make(__context__,nullptr,(([&](ExprConstURange & __mks_394) {
+			das_copy((__mks_394.at /*at*/),(__at_rename_at_379));
+			das_copy((__mks_394.cvalue<urange>() /*value*/),(das_deref(__context__,das_cast<urange *>::cast(__data_rename_at_379))));
+		}))));
+	} else if ( __info_rename_at_379->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tString )
+	{
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstString>>::make(__context__,nullptr,(([&](ExprConstString & __mks_396) {
+			das_copy((__mks_396.at /*at*/),(__at_rename_at_379));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_396.text /*value*/),das_deref(__context__,das_cast<char * *>::cast(__data_rename_at_379)));
+			}		}))));
+	} else {
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_16, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(bound_enum) das::Type>::from(__info_rename_at_379->baseType /*baseType*/))),__context__);
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	};
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_dim_d846b0fdf0ada93e ( Context * __context__, uint8_t * const  __data_rename_at_289, smart_ptr_raw<TypeDecl> const  __info_rename_at_289, LineInfo const  &  __at_rename_at_289 ) { das_stack_prologue __prologue(__context__,208,"walk_and_convert_dim " DAS_FILE_LINE);
+{
+	int32_t __stride_rename_at_290 = ((int32_t)__info_rename_at_289->getBaseSizeOf() /*baseSizeOf*/);
+	int32_t __total_rename_at_291 = ((int32_t)__info_rename_at_289->getCountOf() /*countOf*/);
+	smart_ptr<TypeDecl> __einfo_rename_at_292; das_zero(__einfo_rename_at_292); das_move(__einfo_rename_at_292, clone_type(__info_rename_at_289));
+	das_vector_clear(das_arg<das::vector<int32_t>>::pass(__einfo_rename_at_292->dim /*dim*/));
+	smart_ptr_raw<ExprMakeArray> __mkArr_rename_at_294; das_zero(__mkArr_rename_at_294); das_move(__mkArr_rename_at_294, das_ascend_handle<true,smart_ptr_raw<ExprMakeArray>>::make(__context__,nullptr,(([&](ExprMakeArray & __mks_294) {
+		das_copy((__mks_294.at /*at*/),(__at_rename_at_289));
+		{
+			clone_a077761c55200f4e(__context__,__mks_294.makeType /*makeType*/,__info_rename_at_289);
+		}	}))));
+	{
+		bool __need_loop_295 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(mk_range(__total_rename_at_291));
+		int32_t __x_rename_at_295;
+		__need_loop_295 = __x_iterator.first(__context__,(__x_rename_at_295)) && __need_loop_295;
+		for ( ; __need_loop_295 ; __need_loop_295 = __x_iterator.next(__context__,(__x_rename_at_295)) )
+		{
+			smart_ptr_raw<Expression> __elem_rename_at_297; das_zero(__elem_rename_at_297); das_move(__elem_rename_at_297, walk_and_convert_823957177b065231(__context__,das_ptr_add(__data_rename_at_289,__stride_rename_at_290 * __x_rename_at_295,1),__einfo_rename_at_292,__at_rename_at_289));
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkArr_rename_at_294->values /*values*/),__elem_rename_at_297);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_295));
+	};
+	das_delete_handle<smart_ptr<TypeDecl>>::clear(__context__,__einfo_rename_at_292);
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkArr_rename_at_294);
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_enumeration_76789bc0e3daa7b8 ( Context * __context__, uint8_t * const  __data_rename_at_402, smart_ptr_raw<TypeDecl> const  __info_rename_at_402, LineInfo const  &  __at_rename_at_402 ) { das_stack_prologue __prologue(__context__,128,"walk_and_convert_enumeration " DAS_FILE_LINE);
+{
+	int32_t __eval_rename_at_403 = 0;
+	if ( __info_rename_at_402->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration )
+	{
+		das_copy(__eval_rename_at_403,int32_t(das_deref(__context__,das_cast<uint32_t *>::cast(__data_rename_at_402))));
+	} else if ( __info_rename_at_402->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8 )
+	{
+		das_copy(__eval_rename_at_403,int32_t(das_deref(__context__,__data_rename_at_402)));
+	} else if ( __info_rename_at_402->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16 )
+	{
+		das_copy(__eval_rename_at_403,int32_t(das_deref(__context__,das_cast<uint16_t *>::cast(__data_rename_at_402))));
+	} else {
+		builtin_throw(((char *) "unsupported enumeration"),__context__);
+	};
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprConstEnumeration>>::make(__context__,nullptr,(([&](ExprConstEnumeration & __mks_414) {
+		{
+			das_clone(__mks_414.text /*value*/,das_index<das::vector<Enumeration::EnumEntry> const >::at(__info_rename_at_402->enumType /*enumType*/->list /*list*/,__eval_rename_at_403,__context__).name /*name*/);
+			clone_1ef034caa879bc4c(__context__,__mks_414.enumType /*enumType*/,__info_rename_at_402->enumType /*enumType*/);
+		}	}))));
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_pointer_6a9b7fa29b76c567 ( Context * __context__, uint8_t * const  __data_rename_at_304, smart_ptr_raw<TypeDecl> const  __info_rename_at_304, LineInfo const  &  __at_rename_at_304 )
+{
+	uint8_t * __pdata_rename_at_306 = ((uint8_t *)das_deref(__context__,das_cast<uint8_t * *>::cast(__data_rename_at_304)));
+	smart_ptr_raw<Expression> __elem_rename_at_307; das_zero(__elem_rename_at_307); das_move(__elem_rename_at_307, walk_and_convert_823957177b065231(__context__,__pdata_rename_at_306,__info_rename_at_304->firstType /*firstType*/,__at_rename_at_304));
+	smart_ptr_raw<ExprAscend> __mkAsc_rename_at_308; das_zero(__mkAsc_rename_at_308); das_move(__mkAsc_rename_at_308, das_ascend_handle<true,smart_ptr_raw<ExprAscend>>::make(__context__,nullptr,(([&](ExprAscend & __mks_308) {
+		das_copy((__mks_308.at /*at*/),(__at_rename_at_304));
+		das_move((__mks_308.subexpr /*subexpr*/),(__elem_rename_at_307));
+	}))));
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkAsc_rename_at_308);
+}
+
+inline smart_ptr_raw<Expression> walk_and_convert_structure_9e45e99e96ea38dd ( Context * __context__, uint8_t * const  __data_rename_at_322, smart_ptr_raw<TypeDecl> const  __info_rename_at_322, LineInfo const  &  __at_rename_at_322 ) { das_stack_prologue __prologue(__context__,384,"walk_and_convert_structure " DAS_FILE_LINE);
+{
+	smart_ptr_raw<ExprMakeStruct> __mkStruct_rename_at_323; das_zero(__mkStruct_rename_at_323); das_move(__mkStruct_rename_at_323, das_ascend_handle<true,smart_ptr_raw<ExprMakeStruct>>::make(__context__,nullptr,(([&](ExprMakeStruct & __mks_323) {
+		das_copy((__mks_323.at /*at*/),(__at_rename_at_322));
+		das_move((__mks_323.makeType /*makeType*/),(clone_type(__info_rename_at_322)));
+	}))));
+	Structure * __stype_rename_at_324 = ((Structure *)__info_rename_at_322->structType /*structType*/);
+	smart_ptr_raw<MakeStruct> __mkS_rename_at_325; das_zero(__mkS_rename_at_325); das_move(__mkS_rename_at_325, das_ascend_handle<true,smart_ptr_raw<MakeStruct>>::make(__context__,nullptr,(([&](MakeStruct & __mks_325) {
+	}))));
+	{
+		bool __need_loop_326 = true;
+		// x : ast::FieldDeclaration const&
+		das_iterator<das::vector<Structure::FieldDeclaration> const > __x_iterator(__stype_rename_at_324->fields /*fields*/);
+		Structure::FieldDeclaration const  * __x_rename_at_326;
+		__need_loop_326 = __x_iterator.first(__context__,(__x_rename_at_326)) && __need_loop_326;
+		for ( ; __need_loop_326 ; __need_loop_326 = __x_iterator.next(__context__,(__x_rename_at_326)) )
+		{
+			TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_327_224;
+			if ( das_get_variant_field<vec4f,16,8>::is((_temp_make_local_327_224 = (das_alias<RttiValue>::from(find_arg_e807475ba6ab1a80(__context__,((char *) "do_not_convert"),(*__x_rename_at_326).annotation /*annotation*/))))) )
+			{
+				uint8_t * __fdata_rename_at_329 = ((uint8_t *)das_ptr_add(__data_rename_at_322,(*__x_rename_at_326).offset /*offset*/,1));
+				smart_ptr_raw<Expression> __elem_rename_at_330; das_zero(__elem_rename_at_330); das_move(__elem_rename_at_330, walk_and_convert_823957177b065231(__context__,__fdata_rename_at_329,(*__x_rename_at_326).type /*_type*/,__at_rename_at_322));
+				smart_ptr_raw<MakeFieldDecl> __mkF_rename_at_331; das_zero(__mkF_rename_at_331); das_move(__mkF_rename_at_331, das_ascend_handle<true,smart_ptr_raw<MakeFieldDecl>>::make(__context__,nullptr,(([&](MakeFieldDecl & __mks_331) {
+					das_copy((__mks_331.at /*at*/),(__at_rename_at_322));
+					das_move((__mks_331.value /*value*/),(__elem_rename_at_330));
+					{
+						das_clone(__mks_331.name /*name*/,(*__x_rename_at_326).name /*name*/);
+					}				}))));
+				if ( !(*__x_rename_at_326).type /*_type*/->canCopy() /*canCopy*/ )
+				{
+					das_copy(__mkF_rename_at_331->flags /*flags*/,0x1u);
+				};
+				emplace_5e74981d9fc8c8a4(__context__,das_arg<MakeStruct>::pass(das_deref(__context__,__mkS_rename_at_325)),__mkF_rename_at_331);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_326));
+	};
+	das_vector_emplace(das_arg<das::vector<smart_ptr<MakeStruct>>>::pass(__mkStruct_rename_at_323->structs /*structs*/),__mkS_rename_at_325);
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkStruct_rename_at_323);
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_table_fb68009581f6e9ff ( Context * __context__, uint8_t * const  __data_rename_at_352, smart_ptr_raw<TypeDecl> const  __info_rename_at_352, LineInfo const  &  __at_rename_at_352 ) { das_stack_prologue __prologue(__context__,416,"walk_and_convert_table " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_353 = ((int32_t)any_table_size(das_auto_cast<void * const >::cast(__data_rename_at_352)));
+	if ( __total_rename_at_353 != 0 )
+	{
+		smart_ptr_raw<TypeDecl> __tupT_rename_at_355; das_zero(__tupT_rename_at_355); das_move(__tupT_rename_at_355, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_355) {
+			das_copy((__mks_355.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tTuple));
+			das_copy((__mks_355.at /*at*/),(__at_rename_at_352));
+		}))));
+		emplace_new_8114bb826d9cea6d(__context__,das_arg<das::vector<smart_ptr<TypeDecl>>>::pass(__tupT_rename_at_355->argTypes /*argTypes*/),clone_type(__info_rename_at_352->firstType /*firstType*/));
+		emplace_new_8114bb826d9cea6d(__context__,das_arg<das::vector<smart_ptr<TypeDecl>>>::pass(__tupT_rename_at_355->argTypes /*argTypes*/),clone_type(__info_rename_at_352->secondType /*secondType*/));
+		smart_ptr<TypeDecl> __arrT_rename_at_358; das_zero(__arrT_rename_at_358); das_move(__arrT_rename_at_358, clone_type(__tupT_rename_at_355));
+		smart_ptr_raw<ExprMakeArray> __mkArr_rename_at_359; das_zero(__mkArr_rename_at_359); das_move(__mkArr_rename_at_359, das_ascend_handle<true,smart_ptr_raw<ExprMakeArray>>::make(__context__,nullptr,(([&](ExprMakeArray & __mks_359) {
+			das_copy((__mks_359.at /*at*/),(__at_rename_at_352));
+			das_move((__mks_359.makeType /*makeType*/),(__arrT_rename_at_358));
+		}))));
+		int32_t __key_stride_rename_at_360 = __info_rename_at_352->firstType /*firstType*/->getSizeOf() /*sizeOf*/;
+		int32_t __value_stride_rename_at_361 = __info_rename_at_352->secondType /*secondType*/->getSizeOf() /*sizeOf*/;
+		any_table_foreach(das_auto_cast<void * const >::cast(__data_rename_at_352),__key_stride_rename_at_360,__value_stride_rename_at_361,das_make_block<void,void *,void *>(__context__,208,0,&__func_info__53c874e9,[&](void * __pkey_rename_at_362, void * __pvalue_rename_at_362)->void{
+			smart_ptr_raw<Expression> __key_rename_at_363; das_zero(__key_rename_at_363); das_move(__key_rename_at_363, walk_and_convert_823957177b065231(__context__,das_auto_cast<uint8_t * const >::cast(__pkey_rename_at_362),__info_rename_at_352->firstType /*firstType*/,__at_rename_at_352));
+			smart_ptr_raw<Expression> __value_rename_at_364; das_zero(__value_rename_at_364); das_move(__value_rename_at_364, walk_and_convert_823957177b065231(__context__,das_auto_cast<uint8_t * const >::cast(__pvalue_rename_at_362),__info_rename_at_352->secondType /*secondType*/,__at_rename_at_352));
+			smart_ptr_raw<ExprMakeTuple> __mkTup_rename_at_365; das_zero(__mkTup_rename_at_365); das_move(__mkTup_rename_at_365, das_ascend_handle<true,smart_ptr_raw<ExprMakeTuple>>::make(__context__,nullptr,(([&](ExprMakeTuple & __mks_365) {
+				das_copy((__mks_365.at /*at*/),(__at_rename_at_352));
+				das_move((__mks_365.recordType /*recordType*/),(clone_type(__tupT_rename_at_355)));
+				das_copy((__mks_365.isKeyValue /*isKeyValue*/),(true));
+			}))));
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkTup_rename_at_365->values /*values*/),__key_rename_at_363);
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkTup_rename_at_365->values /*values*/),__value_rename_at_364);
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkArr_rename_at_359->values /*values*/),das_reinterpret<smart_ptr<Expression>>::pass(__mkTup_rename_at_365));
+		}),__context__);
+		das_vector_push_value(das_arg<das::vector<int32_t>>::pass(__mkArr_rename_at_359->makeType /*makeType*/->dim /*dim*/),__total_rename_at_353);
+		smart_ptr_raw<ExprCall> __mkToTableMove_rename_at_370; das_zero(__mkToTableMove_rename_at_370); das_move(__mkToTableMove_rename_at_370, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_370) {
+			das_copy((__mks_370.at /*at*/),(__at_rename_at_352));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_370.name /*name*/),((char *) "to_table_move"));
+			}		}))));
+		das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkToTableMove_rename_at_370->arguments /*arguments*/),das_reinterpret<smart_ptr<Expression>>::pass(__mkArr_rename_at_359));
+		clone_acf198b9505dc74(__context__,__tupT_rename_at_355,nullptr);
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkToTableMove_rename_at_370);
+	} else {
+		smart_ptr_raw<ExprMakeStruct> __mkArr_rename_at_375; das_zero(__mkArr_rename_at_375); das_move(__mkArr_rename_at_375, das_ascend_handle<true,smart_ptr_raw<ExprMakeStruct>>::make(__context__,nullptr,(([&](ExprMakeStruct & __mks_375) {
+			das_copy((__mks_375.at /*at*/),(__at_rename_at_352));
+			das_move((__mks_375.makeType /*makeType*/),(clone_type(__info_rename_at_352)));
+		}))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkArr_rename_at_375);
+	};
+}}
+
+inline smart_ptr_raw<Expression> walk_and_convert_tuple_df011f26bdafd3ce ( Context * __context__, uint8_t * const  __data_rename_at_312, smart_ptr_raw<TypeDecl> const  __info_rename_at_312, LineInfo const  &  __at_rename_at_312 )
+{
+	smart_ptr_raw<ExprMakeTuple> __mkArr_rename_at_313; das_zero(__mkArr_rename_at_313); das_move(__mkArr_rename_at_313, das_ascend_handle<true,smart_ptr_raw<ExprMakeTuple>>::make(__context__,nullptr,(([&](ExprMakeTuple & __mks_313) {
+		das_copy((__mks_313.at /*at*/),(__at_rename_at_312));
+		das_move((__mks_313.recordType /*recordType*/),(clone_type(__info_rename_at_312)));
+	}))));
+	{
+		bool __need_loop_314 = true;
+		// idx : int const
+		das_iterator<range> __idx_iterator(mk_range(__info_rename_at_312->argTypes /*argTypes*/.size() /*length*/));
+		int32_t __idx_rename_at_314;
+		__need_loop_314 = __idx_iterator.first(__context__,(__idx_rename_at_314)) && __need_loop_314;
+		for ( ; __need_loop_314 ; __need_loop_314 = __idx_iterator.next(__context__,(__idx_rename_at_314)) )
+		{
+			int32_t __offset_rename_at_315 = ((int32_t)get_tuple_field_offset(__info_rename_at_312,__idx_rename_at_314));
+			smart_ptr_raw<Expression> __elem_rename_at_317; das_zero(__elem_rename_at_317); das_move(__elem_rename_at_317, walk_and_convert_823957177b065231(__context__,das_ptr_add(__data_rename_at_312,__offset_rename_at_315,1),das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__info_rename_at_312->argTypes /*argTypes*/,__idx_rename_at_314,__context__),__at_rename_at_312));
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__mkArr_rename_at_313->values /*values*/),__elem_rename_at_317);
+		}
+		__idx_iterator.close(__context__,(__idx_rename_at_314));
+	};
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkArr_rename_at_313);
+}
+
+inline smart_ptr_raw<Expression> walk_and_convert_variant_1a992293e21ba33d ( Context * __context__, uint8_t * const  __data_rename_at_339, smart_ptr_raw<TypeDecl> const  __info_rename_at_339, LineInfo const  &  __at_rename_at_339 ) { das_stack_prologue __prologue(__context__,208,"walk_and_convert_variant " DAS_FILE_LINE);
+{
+	int32_t __vindex_rename_at_341 = ((int32_t)das_deref(__context__,das_cast<int32_t *>::cast(__data_rename_at_339)));
+	int32_t __offset_rename_at_342 = ((int32_t)get_variant_field_offset(__info_rename_at_339,__vindex_rename_at_341));
+	smart_ptr_raw<ExprMakeVariant> __mkVariant_rename_at_343; das_zero(__mkVariant_rename_at_343); das_move(__mkVariant_rename_at_343, das_ascend_handle<true,smart_ptr_raw<ExprMakeVariant>>::make(__context__,nullptr,(([&](ExprMakeVariant & __mks_343) {
+		das_copy((__mks_343.at /*at*/),(__at_rename_at_339));
+		das_move((__mks_343.makeType /*makeType*/),(clone_type(__info_rename_at_339)));
+	}))));
+	smart_ptr_raw<Expression> __elem_rename_at_344; das_zero(__elem_rename_at_344); das_move(__elem_rename_at_344, walk_and_convert_823957177b065231(__context__,das_ptr_add(__data_rename_at_339,__offset_rename_at_342,1),das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__info_rename_at_339->argTypes /*argTypes*/,__vindex_rename_at_341,__context__),__at_rename_at_339));
+	smart_ptr_raw<MakeFieldDecl> __mkS_rename_at_345; das_zero(__mkS_rename_at_345); das_move(__mkS_rename_at_345, das_ascend_handle<true,smart_ptr_raw<MakeFieldDecl>>::make(__context__,nullptr,(([&](MakeFieldDecl & __mks_345) {
+		das_copy((__mks_345.at /*at*/),(__at_rename_at_339));
+		das_move((__mks_345.value /*value*/),(__elem_rename_at_344));
+		{
+			das_clone(__mks_345.name /*name*/,das_index<das::vector<das::string> const >::at(__info_rename_at_339->argNames /*argNames*/,__vindex_rename_at_341,__context__));
+		}	}))));
+	if ( !das_index<das::vector<smart_ptr<TypeDecl>> const >::at(__info_rename_at_339->argTypes /*argTypes*/,__vindex_rename_at_341,__context__)->canCopy() /*canCopy*/ )
+	{
+		das_copy(__mkS_rename_at_345->flags /*flags*/,0x1u);
+	};
+	das_vector_emplace(das_arg<das::vector<smart_ptr<MakeFieldDecl>>>::pass(__mkVariant_rename_at_343->variants /*variants*/),__mkS_rename_at_345);
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(__mkVariant_rename_at_343);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// BetterRttiVisitor_b07efdfcacb5d90d
+		aotLib[0x69af5981deeeb520] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::BetterRttiVisitor (*) ( Context * __context__ ),&BetterRttiVisitor_b07efdfcacb5d90d>>();
+	};
+		// _FuncBetterRttiVisitor_0x27___finalize_d9e23e635a304c48
+		aotLib[0xcbbbb0dca292b2d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::BetterRttiVisitor &  ),&_FuncBetterRttiVisitor_0x27___finalize_d9e23e635a304c48>>();
+	};
+		// _FuncBetterRttiVisitor_0x60_visitExprIsVariant_faeff279e0b1e25f
+		aotLib[0x8a8fb9c893fa410f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, ast_boost::BetterRttiVisitor & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprIsVariant> const   ),&_FuncBetterRttiVisitor_0x60_visitExprIsVariant_faeff279e0b1e25f>>();
+	};
+		// MacroMacro_e1497d11cb4c9357
+		aotLib[0xf0de7bec7fbb6b55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::MacroMacro (*) ( Context * __context__ ),&MacroMacro_e1497d11cb4c9357>>();
+	};
+		// _FuncMacroMacro_0x27___finalize_d23afb69bbc0ad66
+		aotLib[0x6db0f4e2c99a5af0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::MacroMacro &  ),&_FuncMacroMacro_0x27___finalize_d23afb69bbc0ad66>>();
+	};
+		// _FuncMacroMacro_0x60_apply_6849666f6ec59ee0
+		aotLib[0x9ea02be6f3bbfb31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ast_boost::MacroMacro & , smart_ptr_raw<Function> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncMacroMacro_0x60_apply_6849666f6ec59ee0>>();
+	};
+		// SetupAnyAnnotation_4e5756e76cdda45
+		aotLib[0x928fb05e49152189] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupAnyAnnotation (*) ( Context * __context__ ),&SetupAnyAnnotation_4e5756e76cdda45>>();
+	};
+		// _FuncSetupAnyAnnotation_0x27___finalize_665dd6510ddaa2c6
+		aotLib[0xb8885df9ae3e28b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupAnyAnnotation &  ),&_FuncSetupAnyAnnotation_0x27___finalize_665dd6510ddaa2c6>>();
+	};
+		// _FuncSetupAnyAnnotation_0x60_apply_b225e56395db6bf7
+		aotLib[0x61b743cb5abb7919] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ast_boost::SetupAnyAnnotation & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncSetupAnyAnnotation_0x60_apply_b225e56395db6bf7>>();
+	};
+		// _FuncSetupAnyAnnotation_0x60_setup_call_bdbf2a6a804025da
+		aotLib[0xa129d31ba30d4972] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupAnyAnnotation & , smart_ptr_raw<Structure> , smart_ptr_raw<ExprCall>  ),&_FuncSetupAnyAnnotation_0x60_setup_call_bdbf2a6a804025da>>();
+	};
+		// SetupCallMacro_ce09ce16832b37e7
+		aotLib[0xac9a6e78f5d7c754] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupCallMacro (*) ( Context * __context__ ),&SetupCallMacro_ce09ce16832b37e7>>();
+	};
+		// _FuncSetupCallMacro_0x27___finalize_4bf8182c3246d27e
+		aotLib[0x15a1c87824060236] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupCallMacro &  ),&_FuncSetupCallMacro_0x27___finalize_4bf8182c3246d27e>>();
+	};
+		// SetupFunctionAnnotatoin_6d9482648142635a
+		aotLib[0x823691ddaec73ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupFunctionAnnotatoin (*) ( Context * __context__ ),&SetupFunctionAnnotatoin_6d9482648142635a>>();
+	};
+		// _FuncSetupFunctionAnnotatoin_0x27___finalize_f2a2f01a10844222
+		aotLib[0xd112f00a27ce889f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupFunctionAnnotatoin &  ),&_FuncSetupFunctionAnnotatoin_0x27___finalize_f2a2f01a10844222>>();
+	};
+		// SetupInferMacro_d7c7d678a18447e9
+		aotLib[0x7c51c69a87307572] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupInferMacro (*) ( Context * __context__ ),&SetupInferMacro_d7c7d678a18447e9>>();
+	};
+		// _FuncSetupInferMacro_0x27___finalize_bb630fba91e4c9a4
+		aotLib[0x11ffa9eb97517f34] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupInferMacro &  ),&_FuncSetupInferMacro_0x27___finalize_bb630fba91e4c9a4>>();
+	};
+		// SetupReaderMacro_8e8d3db9c197654c
+		aotLib[0xc6aa74d3407720d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupReaderMacro (*) ( Context * __context__ ),&SetupReaderMacro_8e8d3db9c197654c>>();
+	};
+		// _FuncSetupReaderMacro_0x27___finalize_d84da6b278dcb39a
+		aotLib[0xa0d81c9c99341c17] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupReaderMacro &  ),&_FuncSetupReaderMacro_0x27___finalize_d84da6b278dcb39a>>();
+	};
+		// SetupStructureMacro_e20ca428af1a3ebb
+		aotLib[0xe0563f6859924a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupStructureMacro (*) ( Context * __context__ ),&SetupStructureMacro_e20ca428af1a3ebb>>();
+	};
+		// _FuncSetupStructureMacro_0x27___finalize_5949099692e44d16
+		aotLib[0xc3cd99c275d20f3b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupStructureMacro &  ),&_FuncSetupStructureMacro_0x27___finalize_5949099692e44d16>>();
+	};
+		// SetupVariantMacro_2a396ba9b134f200
+		aotLib[0xf951e32eb4f966dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::SetupVariantMacro (*) ( Context * __context__ ),&SetupVariantMacro_2a396ba9b134f200>>();
+	};
+		// _FuncSetupVariantMacro_0x27___finalize_b79d909c1ea0f836
+		aotLib[0xfc92c95eb14f39e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupVariantMacro &  ),&_FuncSetupVariantMacro_0x27___finalize_b79d909c1ea0f836>>();
+	};
+		// TagFunctionAnnotation_57304080665d5131
+		aotLib[0xb7e37b8d9f8007d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::TagFunctionAnnotation (*) ( Context * __context__ ),&TagFunctionAnnotation_57304080665d5131>>();
+	};
+		// _FuncTagFunctionAnnotation_0x27___finalize_400b05223c4c5d5c
+		aotLib[0x10bef88411add666] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagFunctionAnnotation &  ),&_FuncTagFunctionAnnotation_0x27___finalize_400b05223c4c5d5c>>();
+	};
+		// _FuncTagFunctionAnnotation_0x60_apply_2bfa9b1b2f01b33
+		aotLib[0x4e8273aff33814d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ast_boost::TagFunctionAnnotation & , smart_ptr_raw<Function> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagFunctionAnnotation_0x60_apply_2bfa9b1b2f01b33>>();
+	};
+		// TagFunctionMacro_4a29167ac64eec83
+		aotLib[0x657f57d599a62edb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::TagFunctionMacro (*) ( Context * __context__ ),&TagFunctionMacro_4a29167ac64eec83>>();
+	};
+		// _FuncTagFunctionMacro_0x27___finalize_7c3d528f8f526926
+		aotLib[0x340ae4c0cad4de14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagFunctionMacro &  ),&_FuncTagFunctionMacro_0x27___finalize_7c3d528f8f526926>>();
+	};
+		// _FuncTagFunctionMacro_0x60_apply_ed8a34771fbec73e
+		aotLib[0xb4687b0446093054] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ast_boost::TagFunctionMacro & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagFunctionMacro_0x60_apply_ed8a34771fbec73e>>();
+	};
+		// _FuncTagFunctionMacro_0x60_setup_call_dc398a9148370dbf
+		aotLib[0x2835554b5123717e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagFunctionMacro & , smart_ptr_raw<Structure> , smart_ptr_raw<ExprCall>  ),&_FuncTagFunctionMacro_0x60_setup_call_dc398a9148370dbf>>();
+	};
+		// TagStructureAnnotation_d1eb037a439b188a
+		aotLib[0x19fbdcc812cd463d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<ast_boost::TagStructureAnnotation (*) ( Context * __context__ ),&TagStructureAnnotation_d1eb037a439b188a>>();
+	};
+		// _FuncTagStructureAnnotation_0x27___finalize_d17ab9b248fa8dfe
+		aotLib[0xc5a855da56b95d2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagStructureAnnotation &  ),&_FuncTagStructureAnnotation_0x27___finalize_d17ab9b248fa8dfe>>();
+	};
+		// _FuncTagStructureAnnotation_0x60_apply_fbfe797e327f843b
+		aotLib[0x57b45290d9dabf9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ast_boost::TagStructureAnnotation & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncTagStructureAnnotation_0x60_apply_fbfe797e327f843b>>();
+	};
+		// apply_tag_annotation_defdf759f8201948
+		aotLib[0xa010cb8ba685e61e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , smart_ptr_raw<FunctionAnnotation> const   ),&apply_tag_annotation_defdf759f8201948>>();
+	};
+		// _Funcast_0x60_add_new_function_annotation_507c1e335fe6fe98
+		aotLib[0x40544ca09da386b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::MacroMacro * const   ),&_Funcast_0x60_add_new_function_annotation_507c1e335fe6fe98>>();
+	};
+		// _Funcast_0x60_add_new_function_annotation_baad1a7e42f1eb30
+		aotLib[0x38344c92a2d0049c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::TagFunctionAnnotation * const   ),&_Funcast_0x60_add_new_function_annotation_baad1a7e42f1eb30>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_7d0a3036e0a7ce88
+		aotLib[0x5f9e3af84fea537c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupCallMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_7d0a3036e0a7ce88>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_a8bfd79330be0a7a
+		aotLib[0xe02e6d78689a3a8c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupFunctionAnnotatoin * const   ),&_Funcast_0x60_add_new_structure_annotation_a8bfd79330be0a7a>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_372d7e51bf6d8f26
+		aotLib[0x5416854b2463705d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupInferMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_372d7e51bf6d8f26>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_f78fa3f19ea0eb3a
+		aotLib[0x9f0bac8bc3be6507] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupReaderMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_f78fa3f19ea0eb3a>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_67bcb17f50f22efe
+		aotLib[0xdbec7f8b788a7730] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupStructureMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_67bcb17f50f22efe>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_5d7c8849960ddb6e
+		aotLib[0x8ee908051f29b382] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::SetupVariantMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_5d7c8849960ddb6e>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_c1df48163ae77046
+		aotLib[0xedcc7f1803df4743] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::TagFunctionMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_c1df48163ae77046>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_ede197d780f77e76
+		aotLib[0x2276a453aaa804ff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::TagStructureAnnotation * const   ),&_Funcast_0x60_add_new_structure_annotation_ede197d780f77e76>>();
+	};
+		// _Funcast_0x60_add_new_variant_macro_be020d32f058f724
+		aotLib[0x44eab2b7022a9490] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , ast_boost::BetterRttiVisitor * const   ),&_Funcast_0x60_add_new_variant_macro_be020d32f058f724>>();
+	};
+		// _Funcast_0x60_describe_271182824caabcc8
+		aotLib[0xae5c2537a15f0139] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const  , bool , bool , bool  ),&_Funcast_0x60_describe_271182824caabcc8>>();
+	};
+		// _Funcast_0x60_make_function_annotation_31c399a85a11c1a8
+		aotLib[0xec13bea033592742] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , ast_boost::MacroMacro * const   ),&_Funcast_0x60_make_function_annotation_31c399a85a11c1a8>>();
+	};
+		// _Funcast_0x60_make_function_annotation_aeb0ef1420bb9f8
+		aotLib[0xd66e7cd65ec0681c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , ast_boost::TagFunctionAnnotation * const   ),&_Funcast_0x60_make_function_annotation_aeb0ef1420bb9f8>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_996b4c988528cd83
+		aotLib[0x7c4f7403351ce17] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupCallMacro * const   ),&_Funcast_0x60_make_structure_annotation_996b4c988528cd83>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_74e71f437665294d
+		aotLib[0x4b054c7e5f5fca14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupFunctionAnnotatoin * const   ),&_Funcast_0x60_make_structure_annotation_74e71f437665294d>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_7c86f1bc00cb4215
+		aotLib[0xdbbd600355a8349c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupInferMacro * const   ),&_Funcast_0x60_make_structure_annotation_7c86f1bc00cb4215>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_459d9c0aba749c91
+		aotLib[0x24384ac6537f28c4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupReaderMacro * const   ),&_Funcast_0x60_make_structure_annotation_459d9c0aba749c91>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_15288689f6515f9
+		aotLib[0xb17600d684d5a52b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupStructureMacro * const   ),&_Funcast_0x60_make_structure_annotation_15288689f6515f9>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_80119e96a7cfdea1
+		aotLib[0xfdcdd51d4ba2b486] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::SetupVariantMacro * const   ),&_Funcast_0x60_make_structure_annotation_80119e96a7cfdea1>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_ee2ddebff91e8f69
+		aotLib[0x3bf4fbcc49154d44] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::TagFunctionMacro * const   ),&_Funcast_0x60_make_structure_annotation_ee2ddebff91e8f69>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_cb4a1baea3ec7295
+		aotLib[0x6c16a4f4d3d518b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , ast_boost::TagStructureAnnotation * const   ),&_Funcast_0x60_make_structure_annotation_cb4a1baea3ec7295>>();
+	};
+		// _Funcast_0x60_make_variant_macro_69733492c271937a
+		aotLib[0x945e3e0075173cbe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VariantMacro> (*) ( Context * __context__, char * const  , ast_boost::BetterRttiVisitor * const   ),&_Funcast_0x60_make_variant_macro_69733492c271937a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903
+		aotLib[0x190096f99e2fb7f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprBlock * (*) ( Context * __context__, smart_ptr_raw<ExprBlock> const   ),&_Funcbuiltin_0x60_get_ptr_ed2bb5ac2682e903>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9
+		aotLib[0x9295bc7cb9b31c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Structure * (*) ( Context * __context__, smart_ptr_raw<Structure> const   ),&_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9>>();
+	};
+		// _Funcbuiltin_0x60_push_5caef1f118709d18
+		aotLib[0x80f7de2e45124cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_5caef1f118709d18>>();
+	};
+		// clone_1ef034caa879bc4c
+		aotLib[0xc7ea4d2dd60a3f69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Enumeration> & , Enumeration * const   ),&clone_1ef034caa879bc4c>>();
+	};
+		// clone_71630f94910d7ae0
+		aotLib[0x5167a7889e524969] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> & , void * const   ),&clone_71630f94910d7ae0>>();
+	};
+		// clone_52db9e6ecf8de48
+		aotLib[0x4214660b4409d019] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<MakeFieldDecl> & , void * const   ),&clone_52db9e6ecf8de48>>();
+	};
+		// clone_acf198b9505dc74
+		aotLib[0xcf98fbf5cbb19dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TypeDecl> & , void * const   ),&clone_acf198b9505dc74>>();
+	};
+		// clone_a077761c55200f4e
+		aotLib[0x5e4b857e0f8a31c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<TypeDecl> & , smart_ptr_raw<TypeDecl> const   ),&clone_a077761c55200f4e>>();
+	};
+		// describe_af12bb9460e41077
+		aotLib[0x1800a4fd0764b7f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, AnnotationArgumentList const  &  ),&describe_af12bb9460e41077>>();
+	};
+		// describe_5c90f6710f594395
+		aotLib[0xbaccb628b4a27f60] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, AnnotationDeclaration const  &  ),&describe_5c90f6710f594395>>();
+	};
+		// describe_af25d3f328486703
+		aotLib[0x9cd3bb0956386fc7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, AnnotationList const  &  ),&describe_af25d3f328486703>>();
+	};
+		// describe_function_short_d76957a2f59c1ab
+		aotLib[0x3dacd50f27318502] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, smart_ptr_raw<Function> const   ),&describe_function_short_d76957a2f59c1ab>>();
+	};
+		// emplace_5e74981d9fc8c8a4
+		aotLib[0x7edf49138a6de954] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, MakeStruct & , smart_ptr_raw<MakeFieldDecl>  ),&emplace_5e74981d9fc8c8a4>>();
+	};
+		// emplace_new_b3a35ef7dd55c571
+		aotLib[0x92de6d876854b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, das::vector<smart_ptr<Expression>> & , smart_ptr_raw<Expression>  ),&emplace_new_b3a35ef7dd55c571>>();
+	};
+		// emplace_new_8114bb826d9cea6d
+		aotLib[0xcd4e3c0886a6d565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, das::vector<smart_ptr<TypeDecl>> & , smart_ptr_raw<TypeDecl>  ),&emplace_new_8114bb826d9cea6d>>();
+	};
+		// emplace_new_459ce6f72cdf9c0d
+		aotLib[0x4e313d673bfce305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, das::vector<smart_ptr<Variable>> & , smart_ptr_raw<Variable>  ),&emplace_new_459ce6f72cdf9c0d>>();
+	};
+		// finalize_e39f6bf3901fe65e
+		aotLib[0x3ace01a3076fbb79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::BetterRttiVisitor &  ),&finalize_e39f6bf3901fe65e>>();
+	};
+		// finalize_1e05286024ffc9
+		aotLib[0xca8bc021e6e207c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::MacroMacro &  ),&finalize_1e05286024ffc9>>();
+	};
+		// finalize_c692ee85a5c3705d
+		aotLib[0xb329a61362dbb989] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupAnyAnnotation &  ),&finalize_c692ee85a5c3705d>>();
+	};
+		// finalize_7741f20af8b390dc
+		aotLib[0x7e1b4285fe95fbb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupCallMacro &  ),&finalize_7741f20af8b390dc>>();
+	};
+		// finalize_d2d8d932b76c8507
+		aotLib[0xc129b0ec211a8021] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupFunctionAnnotatoin &  ),&finalize_d2d8d932b76c8507>>();
+	};
+		// finalize_549b36d594098850
+		aotLib[0xbb85c09e6a8f9ec9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupInferMacro &  ),&finalize_549b36d594098850>>();
+	};
+		// finalize_7fe48452de3177af
+		aotLib[0x1c52c8e16949747d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupReaderMacro &  ),&finalize_7fe48452de3177af>>();
+	};
+		// finalize_408cec3a0eef18bd
+		aotLib[0x642e7ba60baf0f75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupStructureMacro &  ),&finalize_408cec3a0eef18bd>>();
+	};
+		// finalize_85331723c3a41f85
+		aotLib[0x5b5a12fafa33b8b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::SetupVariantMacro &  ),&finalize_85331723c3a41f85>>();
+	};
+		// finalize_5c3a9a623f3d9b38
+		aotLib[0xe8a2161690589e01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagFunctionAnnotation &  ),&finalize_5c3a9a623f3d9b38>>();
+	};
+		// finalize_34eecdde29f42869
+		aotLib[0xaebc577076ceb195] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagFunctionMacro &  ),&finalize_34eecdde29f42869>>();
+	};
+		// finalize_3bd74c4615c1a065
+		aotLib[0x1d722c2222214bd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ast_boost::TagStructureAnnotation &  ),&finalize_3bd74c4615c1a065>>();
+	};
+		// find_arg_e807475ba6ab1a80
+		aotLib[0x97b805c5b0b1e30c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> (*) ( Context * __context__, char * const  , AnnotationArgumentList const  &  ),&find_arg_e807475ba6ab1a80>>();
+	};
+		// find_unique_function_c1c726d6baf9b089
+		aotLib[0x664d2565a2a800f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, Module * const  , char * const   ),&find_unique_function_c1c726d6baf9b089>>();
+	};
+		// find_unique_generic_996fda7c20037ea9
+		aotLib[0xadc1b011c2f34219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Function> (*) ( Context * __context__, Module * const  , char * const   ),&find_unique_generic_996fda7c20037ea9>>();
+	};
+		// for_each_tag_function_7aff7793ef528ba2
+		aotLib[0x82d838b8dfeff75d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const  , char * const  , Block DAS_COMMENT((void,smart_ptr_raw<Function>)) const  &  ),&for_each_tag_function_7aff7793ef528ba2>>();
+	};
+		// isExpression_c0b61513ca47d4ed
+		aotLib[0x8a7954f014548399] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const  , bool  ),&isExpression_c0b61513ca47d4ed>>();
+	};
+		// is_class_method_88832b5548c6df12
+		aotLib[0xf79ed9d57c90f1a2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<Structure> const  , smart_ptr_raw<TypeDecl> const   ),&is_class_method_88832b5548c6df12>>();
+	};
+		// is_same_or_inherited_c5c182a7778b0270
+		aotLib[0x39a886c5f8cf6871] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Structure * const  , Structure * const   ),&is_same_or_inherited_c5c182a7778b0270>>();
+	};
+		// _Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d
+		aotLib[0x7ee8ac03c0f1a9f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> (*) ( Context * __context__ ),&_Funcrtti_0x60_RttiValue_nothing_c4cebcf8f2cab65d>>();
+	};
+		// _Funcrtti_0x60_class_info_7493c4d5b10b66bf
+		aotLib[0xd5efe72025bc2f11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::BetterRttiVisitor const  &  ),&_Funcrtti_0x60_class_info_7493c4d5b10b66bf>>();
+	};
+		// _Funcrtti_0x60_class_info_870220293f929e68
+		aotLib[0x72a32d74dad22689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::MacroMacro const  &  ),&_Funcrtti_0x60_class_info_870220293f929e68>>();
+	};
+		// _Funcrtti_0x60_class_info_cb28c2899eff6cd5
+		aotLib[0xeb2d35b3370e8141] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupCallMacro const  &  ),&_Funcrtti_0x60_class_info_cb28c2899eff6cd5>>();
+	};
+		// _Funcrtti_0x60_class_info_c28e31b8ff3590ae
+		aotLib[0x75791b22fd870fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupFunctionAnnotatoin const  &  ),&_Funcrtti_0x60_class_info_c28e31b8ff3590ae>>();
+	};
+		// _Funcrtti_0x60_class_info_a3367fd1365ead61
+		aotLib[0xeb3b3281a84eb7ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupInferMacro const  &  ),&_Funcrtti_0x60_class_info_a3367fd1365ead61>>();
+	};
+		// _Funcrtti_0x60_class_info_207e1cace0edd01e
+		aotLib[0x8bda9218b13ec2ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupReaderMacro const  &  ),&_Funcrtti_0x60_class_info_207e1cace0edd01e>>();
+	};
+		// _Funcrtti_0x60_class_info_569c358976380014
+		aotLib[0xb68460e543bd4f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupStructureMacro const  &  ),&_Funcrtti_0x60_class_info_569c358976380014>>();
+	};
+		// _Funcrtti_0x60_class_info_c647ffe64658895c
+		aotLib[0x5a3c3acbb9a0c939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::SetupVariantMacro const  &  ),&_Funcrtti_0x60_class_info_c647ffe64658895c>>();
+	};
+		// _Funcrtti_0x60_class_info_de41e21f48cd79b9
+		aotLib[0xa96ebff127f2da01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::TagFunctionAnnotation const  &  ),&_Funcrtti_0x60_class_info_de41e21f48cd79b9>>();
+	};
+		// _Funcrtti_0x60_class_info_5155812a8dbff6f8
+		aotLib[0x52ae6fd7d908a0f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::TagFunctionMacro const  &  ),&_Funcrtti_0x60_class_info_5155812a8dbff6f8>>();
+	};
+		// _Funcrtti_0x60_class_info_37a8fb9b7aaa6d7c
+		aotLib[0xa8506b56d20e5995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, ast_boost::TagStructureAnnotation const  &  ),&_Funcrtti_0x60_class_info_37a8fb9b7aaa6d7c>>();
+	};
+		// setup_3bef15dee5a72be1
+		aotLib[0x6151cfb7d51b8d50] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&setup_3bef15dee5a72be1>>();
+	};
+		// setup_macro_fa52c3d6afe8fb88
+		aotLib[0xe9952e612e85f855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<ExprBlock * (*) ( Context * __context__, char * const  , LineInfo const  &  ),&setup_macro_fa52c3d6afe8fb88>>();
+	};
+		// _Funcstrings_boost_0x60_join_48fb6c570d4c5eba
+		aotLib[0xea1df6d3de6cdb39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_48fb6c570d4c5eba>>();
+	};
+		// walk_and_convert_823957177b065231
+		aotLib[0x6a60f561bfb91512] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_823957177b065231>>();
+	};
+		// walk_and_convert_array_15c3eaaaa9e32c7b
+		aotLib[0x1a4bd94a4be74c98] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_array_15c3eaaaa9e32c7b>>();
+	};
+		// walk_and_convert_basic_3eef5a83c22b80c0
+		aotLib[0xa55b04c8c6861b49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_basic_3eef5a83c22b80c0>>();
+	};
+		// walk_and_convert_dim_d846b0fdf0ada93e
+		aotLib[0x94a6f6dd4010a52c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_dim_d846b0fdf0ada93e>>();
+	};
+		// walk_and_convert_enumeration_76789bc0e3daa7b8
+		aotLib[0x2bf9d0d26da9c694] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_enumeration_76789bc0e3daa7b8>>();
+	};
+		// walk_and_convert_pointer_6a9b7fa29b76c567
+		aotLib[0xe1b6dcc6e593be06] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_pointer_6a9b7fa29b76c567>>();
+	};
+		// walk_and_convert_structure_9e45e99e96ea38dd
+		aotLib[0x7e3b4b4ba4724f04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_structure_9e45e99e96ea38dd>>();
+	};
+		// walk_and_convert_table_fb68009581f6e9ff
+		aotLib[0xee77645923b404a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_table_fb68009581f6e9ff>>();
+	};
+		// walk_and_convert_tuple_df011f26bdafd3ce
+		aotLib[0xc91f8b0829deb16b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_tuple_df011f26bdafd3ce>>();
+	};
+		// walk_and_convert_variant_1a992293e21ba33d
+		aotLib[0x1741fecdb9af0010] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, uint8_t * const  , smart_ptr_raw<TypeDecl> const  , LineInfo const  &  ),&walk_and_convert_variant_1a992293e21ba33d>>();
+	};
+		// [[ init script ]]
+		aotLib[0x129f131b628475f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
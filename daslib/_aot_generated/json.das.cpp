@@ -0,0 +1,1094 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__7dc9a8ce;
+extern StructInfo __struct_info__d029ecd8;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__e9ce9840;
+extern TypeInfo __type_info__302cf646;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__51dae110;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__bcfabebe;
+extern TypeInfo __type_info__7eca6aee;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__f55aa340;
+extern TypeInfo __type_info__91fcf360;
+extern TypeInfo __type_info__43f27e46;
+extern TypeInfo __type_info__84d9665d;
+extern TypeInfo __type_info__d9a3b228;
+extern TypeInfo __type_info__dca4ff17;
+extern VarInfo __var_info__ca17cf96;
+extern VarInfo __var_info__b9cb6af;
+extern VarInfo __var_info__8565e208;
+extern VarInfo __var_info__577418eb;
+extern VarInfo __var_info__68f57ea7;
+extern VarInfo __var_info__bb8afe71;
+extern VarInfo __var_info__2d8a6bb4;
+extern VarInfo __var_info__9f19b189;
+extern VarInfo __var_info__f322a3a3;
+extern VarInfo __var_info__43ef192d;
+
+TypeInfo * __type_info__f322a3a3_arg_types_var_2110367950[6] = { &__type_info__7eca6aee, &__type_info__84d9665d, &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17 };
+const char * __type_info__f322a3a3_arg_names_var_2110367950[6] = { "_object", "_array", "_string", "_number", "_bool", "_null" };
+VarInfo __struct_info__7dc9a8ce_field_0 =  { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__f322a3a3_arg_types_var_2110367950, (char **)__type_info__f322a3a3_arg_names_var_2110367950, 6, 0, nullptr, 2, 0xf322a3a3, "value", 0 };
+VarInfo * __struct_info__7dc9a8ce_fields[1] =  { &__struct_info__7dc9a8ce_field_0 };
+StructInfo __struct_info__7dc9a8ce = {"JsonValue", __struct_info__7dc9a8ce_fields, 1, 56, -1, nullptr, 0x7dc9a8ce };
+TypeInfo * __type_info__9f19b189_arg_types_var_3492408536[2] = { &__type_info__302cf646, &__type_info__43f27e46 };
+VarInfo __struct_info__d029ecd8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__9f19b189_arg_types_var_3492408536, nullptr, 2, 0, nullptr, 28, 0x9f19b189, "__lambda", 0 };
+TypeInfo * __type_info__8565e208_arg_types_var_3492408536[1] = { &__type_info__bcfabebe };
+VarInfo __struct_info__d029ecd8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8565e208_arg_types_var_3492408536, nullptr, 1, 0, nullptr, 28, 0x8565e208, "__finalize", 4 };
+VarInfo __struct_info__d029ecd8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb9cb6af, "__yield", 8 };
+VarInfo __struct_info__d029ecd8_field_3 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 132, 0xca17cf96, "stext", 16 };
+VarInfo __struct_info__d029ecd8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x68f57ea7, "tin", 24 };
+VarInfo __struct_info__d029ecd8_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x43ef192d, "ahead", 32 };
+VarInfo __struct_info__d029ecd8_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x577418eb, "str", 40 };
+VarInfo __struct_info__d029ecd8_field_7 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x2d8a6bb4, "__num_rename_at_109", 64 };
+VarInfo __struct_info__d029ecd8_field_8 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xbb8afe71, "__name_rename_at_118", 72 };
+VarInfo * __struct_info__d029ecd8_fields[9] =  { &__struct_info__d029ecd8_field_0, &__struct_info__d029ecd8_field_1, &__struct_info__d029ecd8_field_2, &__struct_info__d029ecd8_field_3, &__struct_info__d029ecd8_field_4, &__struct_info__d029ecd8_field_5, &__struct_info__d029ecd8_field_6, &__struct_info__d029ecd8_field_7, &__struct_info__d029ecd8_field_8 };
+StructInfo __struct_info__d029ecd8 = {"_lambda_json_62_8_1", __struct_info__d029ecd8_fields, 9, 80, -1, nullptr, 0xd029ecd8 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__e9ce9840 = { Type::tStructure, &__struct_info__7dc9a8ce, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe9ce9840 };
+TypeInfo __type_info__302cf646 = { Type::tStructure, &__struct_info__d029ecd8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x302cf646 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo * __type_info__51dae110_arg_types[6] = { &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17, &__type_info__95e97e5e, &__type_info__17c16538 };
+const char * __type_info__51dae110_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__51dae110 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__51dae110_arg_types, (char **)__type_info__51dae110_arg_names, 6, 0, nullptr, 262, 0x51dae110 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa0eb0f08 };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x199df2db };
+TypeInfo __type_info__bcfabebe = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__302cf646, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xbcfabebe };
+TypeInfo __type_info__7eca6aee = { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__d9a3b228, nullptr, nullptr, 0, 0, nullptr, 2, 0x7eca6aee };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__f55aa340 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xf55aa340 };
+TypeInfo __type_info__91fcf360 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e9ce9840, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x91fcf360 };
+TypeInfo * __type_info__43f27e46_arg_types[6] = { &__type_info__17c16538, &__type_info__a0eb0f08, &__type_info__c894953d, &__type_info__dca4ff17, &__type_info__95e97e5e, &__type_info__17c16538 };
+const char * __type_info__43f27e46_arg_names[6] = { "_string", "_number", "_bool", "_null", "_symbol", "_error" };
+TypeInfo __type_info__43f27e46 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__43f27e46_arg_types, (char **)__type_info__43f27e46_arg_names, 6, 0, nullptr, 6, 0x43f27e46 };
+TypeInfo __type_info__84d9665d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__d9a3b228, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x84d9665d };
+TypeInfo __type_info__d9a3b228 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e9ce9840, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd9a3b228 };
+TypeInfo __type_info__dca4ff17 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdca4ff17 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_1[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__95e97e5e };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[6] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_4[4] = { &__type_info__3ffbf730, &__type_info__43f27e46, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_5[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_7[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_8[4] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_9[1] = { &__type_info__51dae110 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_11[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_13[2] = { &__type_info__f7fba288, &__type_info__f55aa340 };
+TypeInfo * __tinfo_14[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_15[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_16[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_17[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_18[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_19[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_20[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_21[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_22[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_23[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_24[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_25[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_26[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_27[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_28[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_29[2] = { &__type_info__3ffbf730, &__type_info__91fcf360 };
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+namespace json {
+
+struct _lambda_json_62_8_1 {
+	Func DAS_COMMENT((bool,json::_lambda_json_62_8_1,TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lambda;
+	Func DAS_COMMENT((void,json::_lambda_json_62_8_1 *)) __finalize;
+	int32_t __yield;
+	char * stext;
+	Sequence DAS_COMMENT((int32_t)) tin;
+	int32_t ahead;
+	TArray<uint8_t> str;
+	char * __num_rename_at_109;
+	char * __name_rename_at_118;
+};
+static_assert(sizeof(_lambda_json_62_8_1)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,stext)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,tin)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,ahead)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,str)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,__num_rename_at_109)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_json_62_8_1,__name_rename_at_118)==72,"structure field offset mismatch with DAS");
+}
+
+inline json::JsonValue * JV_2c64f796dca9887e ( Context * __context__, TArray<json::JsonValue *> & __v_rename_at_46 );
+inline json::JsonValue * JV_e684d865c46c021a ( Context * __context__, void * const  __v_rename_at_40 );
+inline json::JsonValue * JV_b03c2c356e498d9c ( Context * __context__, TTable<char *,json::JsonValue *> & __v_rename_at_43 );
+inline json::JsonValue * JV_6e1bec90827eef39 ( Context * __context__, bool __v_rename_at_37 );
+inline json::JsonValue * JV_d05d664ae3a58630 ( Context * __context__, double __v_rename_at_34 );
+inline json::JsonValue * JV_8704751214e9d711 ( Context * __context__, char * const  __v_rename_at_31 );
+inline void _Func_lambda_json_62_8_1_0x60_finazlier_6021f7152918aa30 ( Context * __context__, json::_lambda_json_62_8_1 * ____this_rename_at_62 );
+inline bool _Func_lambda_json_62_8_1_0x60_function_b7ab68704b322a35 ( Context * __context__, json::_lambda_json_62_8_1 & ____this_rename_at_62, TVariant<16,char *,double,bool,void *,int32_t,char *> & ___yield_62_rename_at_62 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_3d9482716a5b7e62 ( Context * __context__, char * __stext_rename_at_60 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_9354ab97919d110b ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_244 );
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> & __a_rename_at_186 );
+inline bool _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2 ( Context * __context__, TTable<char *,json::JsonValue *> const  & __Tab_rename_at_120, char * const  __at_rename_at_120 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_98634c9938f02164 ( Context * __context__, TTable<char *,json::JsonValue *> const  & __a_rename_at_163 );
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & __it_rename_at_218, TVariant<16,char *,double,bool,void *,int32_t,char *> & __value_rename_at_218 );
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_218, int32_t & __value_rename_at_218 );
+inline void _Funcbuiltin_0x60_push_c93bba0c4fc39632 ( Context * __context__, TArray<json::JsonValue *> & __Arr_rename_at_37, json::JsonValue * const  __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_8bc837d3f5eead45 ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_37, uint8_t __value_rename_at_37 );
+inline Sequence DAS_COMMENT((json::JsonValue * const  &)) _Funcbuiltin_0x60_values_574eec0386138f1d ( Context * __context__, TTable<char *,json::JsonValue *> const  & __a_rename_at_168 );
+inline bool expect_symbol_b900161392087591 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_151, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_151, int32_t __sym_rename_at_151, char * & __error_rename_at_151 );
+inline bool expect_token_86f090ae8385eee5 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_140, TVariant<16,char *,double,bool,void *,int32_t,char *> & __ahead_rename_at_140, int32_t __vindex_rename_at_140, char * & __error_rename_at_140 );
+inline void finalize_e976f8b94c5e9c2c ( Context * __context__, json::_lambda_json_62_8_1 & ____this_rename_at_62 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_90f618f5a5740ad0 ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_55 );
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_1c9abefe8842ea1e ( Context * __context__, char * const  __text_rename_at_50 );
+inline json::JsonValue * parse_value_cdc5c7af14740695 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & __itv_rename_at_165, char * & __error_rename_at_165 );
+inline json::JsonValue * read_json_8e989a8bb3660cb9 ( Context * __context__, TArray<uint8_t> const  & __text_rename_at_247, char * & __error_rename_at_247 );
+inline json::JsonValue * read_json_f9f5c2d90a97284a ( Context * __context__, char * const  __text_rename_at_241, char * & __error_rename_at_241 );
+inline char * write_json_eb64e080ca704fd1 ( Context * __context__, json::JsonValue * const  __val_rename_at_308 );
+inline void write_value_8f03ac377cbfd99c ( Context * __context__, StringBuilderWriter & __writer_rename_at_254, json::JsonValue * const  __jsv_rename_at_254, int32_t __depth_rename_at_254 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x5518032d>(__context__) = 0;/*Token_string*/
+	das_global<int32_t,0xc6c2a34>(__context__) = 4;/*Token_symbol*/
+}
+
+inline json::JsonValue * JV_2c64f796dca9887e ( Context * __context__, TArray<json::JsonValue *> &  __v_rename_at_46 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_47;
+		das_zero(__mks_47);
+		das_move((__mks_47.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_47;
+			das_get_variant_field<TArray<json::JsonValue *>,8,1>::set(__mkv_47) = __v_rename_at_46;
+			return __mkv_47;
+		})())));
+		return __mks_47;
+	})())));
+}
+
+inline json::JsonValue * JV_e684d865c46c021a ( Context * __context__, void * const  __v_rename_at_40 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_41;
+		das_zero(__mks_41);
+		das_move((__mks_41.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_41;
+			das_get_variant_field<void *,8,5>::set(__mkv_41) = nullptr;
+			return __mkv_41;
+		})())));
+		return __mks_41;
+	})())));
+}
+
+inline json::JsonValue * JV_b03c2c356e498d9c ( Context * __context__, TTable<char *,json::JsonValue *> &  __v_rename_at_43 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_44;
+		das_zero(__mks_44);
+		das_move((__mks_44.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_44;
+			das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::set(__mkv_44) = __v_rename_at_43;
+			return __mkv_44;
+		})())));
+		return __mks_44;
+	})())));
+}
+
+inline json::JsonValue * JV_6e1bec90827eef39 ( Context * __context__, bool __v_rename_at_37 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_38;
+		das_zero(__mks_38);
+		das_move((__mks_38.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_38;
+			das_get_variant_field<bool,8,4>::set(__mkv_38) = __v_rename_at_37;
+			return __mkv_38;
+		})())));
+		return __mks_38;
+	})())));
+}
+
+inline json::JsonValue * JV_d05d664ae3a58630 ( Context * __context__, double __v_rename_at_34 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_35;
+		das_zero(__mks_35);
+		das_move((__mks_35.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_35;
+			das_get_variant_field<double,8,3>::set(__mkv_35) = __v_rename_at_34;
+			return __mkv_35;
+		})())));
+		return __mks_35;
+	})())));
+}
+
+inline json::JsonValue * JV_8704751214e9d711 ( Context * __context__, char * const  __v_rename_at_31 )
+{
+	return das_auto_cast<json::JsonValue *>::cast(das_ascend<json::JsonValue,json::JsonValue>::make(__context__,nullptr,(([&]() -> json::JsonValue {
+		json::JsonValue __mks_32;
+		das_zero(__mks_32);
+		das_move((__mks_32.value),((([&]() -> TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> {
+			TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> __mkv_32;
+			das_get_variant_field<char *,8,2>::set(__mkv_32) = __v_rename_at_31;
+			return __mkv_32;
+		})())));
+		return __mks_32;
+	})())));
+}
+
+inline void _Func_lambda_json_62_8_1_0x60_finazlier_6021f7152918aa30 ( Context * __context__, json::_lambda_json_62_8_1 * ____this_rename_at_62 )
+{
+	delete_string(das_deref(__context__,____this_rename_at_62).stext,__context__);
+	finalize_e976f8b94c5e9c2c(__context__,das_arg<json::_lambda_json_62_8_1>::pass(das_deref(__context__,____this_rename_at_62)));
+	das_delete_lambda_struct<json::_lambda_json_62_8_1 *>::clear(__context__,____this_rename_at_62);
+}
+
+inline bool _Func_lambda_json_62_8_1_0x60_function_b7ab68704b322a35 ( Context * __context__, json::_lambda_json_62_8_1 &  ____this_rename_at_62, TVariant<16,char *,double,bool,void *,int32_t,char *> &  ___yield_62_rename_at_62 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_64_32;
+	switch (____this_rename_at_62.__yield) {
+	case 0: goto label_0;
+	case 32: goto label_32;
+	case 1: goto label_1;
+	case 30: goto label_30;
+	case 7: goto label_7;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 11: goto label_11;
+	case 28: goto label_28;
+	case 12: goto label_12;
+	case 26: goto label_26;
+	case 13: goto label_13;
+	case 21: goto label_21;
+	case 14: goto label_14;
+	case 19: goto label_19;
+	case 15: goto label_15;
+	case 17: goto label_17;
+	case 16: goto label_16;
+	case 18: goto label_18;
+	case 20: goto label_20;
+	case 22: goto label_22;
+	case 24: goto label_24;
+	case 23: goto label_23;
+	case 25: goto label_25;
+	case 27: goto label_27;
+	case 29: goto label_29;
+	case 31: goto label_31;
+	case 33: goto label_33;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_62.tin), 0, 8);
+	das_move(____this_rename_at_62.tin,(_temp_make_local_64_32 = (_Funcbuiltin_0x60_each_3bd22e87ecbdcf79(__context__,____this_rename_at_62.stext))));
+	das_copy(____this_rename_at_62.ahead,32);
+	memset(&(____this_rename_at_62.str), 0, 24);
+	label_32:;;
+	if ( !!(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin))) )
+	{
+		goto label_33;
+	};
+	while ( is_white_space(____this_rename_at_62.ahead) && _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) )
+	{
+	};
+	if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin)) )
+	{
+		return das_auto_cast<bool>::cast(false);
+	};
+	if ( !((((((____this_rename_at_62.ahead == 91) || (____this_rename_at_62.ahead == 93)) || (____this_rename_at_62.ahead == 123)) || (____this_rename_at_62.ahead == 125)) || (____this_rename_at_62.ahead == 58)) || (____this_rename_at_62.ahead == 44)) )
+	{
+		goto label_30;
+	};
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_73;
+		das_get_variant_field<int32_t,8,4>::set(__mkv_73) = ____this_rename_at_62.ahead;
+		return __mkv_73;
+	})()));
+	das_copy(____this_rename_at_62.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead);
+	goto label_31;
+	label_30:;;
+	if ( !(____this_rename_at_62.ahead == 34) )
+	{
+		goto label_28;
+	};
+	label_7:;;
+	if ( !(_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) && (____this_rename_at_62.ahead != 34)) )
+	{
+		goto label_8;
+	};
+	if ( !(____this_rename_at_62.ahead == 92) )
+	{
+		goto label_5;
+	};
+	if ( !_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_62.ahead == 98 )
+	{
+		das_copy(____this_rename_at_62.ahead,8);
+	} else if ( ____this_rename_at_62.ahead == 102 )
+	{
+		das_copy(____this_rename_at_62.ahead,12);
+	} else if ( ____this_rename_at_62.ahead == 110 )
+	{
+		das_copy(____this_rename_at_62.ahead,10);
+	} else if ( ____this_rename_at_62.ahead == 114 )
+	{
+		das_copy(____this_rename_at_62.ahead,13);
+	} else if ( ____this_rename_at_62.ahead == 116 )
+	{
+		das_copy(____this_rename_at_62.ahead,9);
+	};
+	_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	goto label_4;
+	label_3:;;
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_91;
+		das_get_variant_field<char *,8,5>::set(__mkv_91) = ((char *) "string escape sequence exceeds text");
+		return __mkv_91;
+	})()));
+	das_copy(____this_rename_at_62.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	return das_auto_cast<bool>::cast(false);
+	label_4:;;
+	goto label_6;
+	label_5:;;
+	_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	label_6:;;
+	goto label_7;
+	label_8:;;
+	if ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin)) )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_96;
+		das_get_variant_field<char *,8,5>::set(__mkv_96) = ((char *) "string exceeds text");
+		return __mkv_96;
+	})()));
+	das_copy(____this_rename_at_62.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	return das_auto_cast<bool>::cast(false);
+	label_10:;;
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_98;
+		das_get_variant_field<char *,8,0>::set(__mkv_98) = ((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__)));
+		return __mkv_98;
+	})()));
+	das_copy(____this_rename_at_62.__yield,11);
+	return das_auto_cast<bool>::cast(true);
+	label_11:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__);
+	_Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead);
+	goto label_29;
+	label_28:;;
+	if ( !(((____this_rename_at_62.ahead == 43) || (____this_rename_at_62.ahead == 45)) || is_number(____this_rename_at_62.ahead)) )
+	{
+		goto label_26;
+	};
+	_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) && is_number(____this_rename_at_62.ahead) )
+	{
+		_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	};
+	if ( !(builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin))) && (____this_rename_at_62.ahead == 46) )
+	{
+		_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+		while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) && is_number(____this_rename_at_62.ahead) )
+		{
+			_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+		};
+	};
+	das_copy(____this_rename_at_62.__num_rename_at_109,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__))));
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_110;
+		das_get_variant_field<double,8,1>::set(__mkv_110) = string_to_double(____this_rename_at_62.__num_rename_at_109,__context__);
+		return __mkv_110;
+	})()));
+	das_copy(____this_rename_at_62.__yield,12);
+	return das_auto_cast<bool>::cast(true);
+	label_12:;;
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__);
+	delete_string(____this_rename_at_62.__num_rename_at_109,__context__);
+	goto label_27;
+	label_26:;;
+	if ( !is_alpha(____this_rename_at_62.ahead) )
+	{
+		goto label_24;
+	};
+	_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	while ( _Funcbuiltin_0x60_next_6a3c01874ce3fb9a(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),____this_rename_at_62.ahead) && is_alpha(____this_rename_at_62.ahead) )
+	{
+		_Funcbuiltin_0x60_push_8bc837d3f5eead45(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),uint8_t(____this_rename_at_62.ahead));
+	};
+	das_copy(____this_rename_at_62.__name_rename_at_118,((char *)(builtin_string_from_array(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__))));
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_62.__name_rename_at_118),cast<char *>::from(((char *) "true")),*__context__)) )
+	{
+		goto label_21;
+	};
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_120;
+		das_get_variant_field<bool,8,2>::set(__mkv_120) = true;
+		return __mkv_120;
+	})()));
+	das_copy(____this_rename_at_62.__yield,13);
+	return das_auto_cast<bool>::cast(true);
+	label_13:;;
+	goto label_22;
+	label_21:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_62.__name_rename_at_118),cast<char *>::from(((char *) "false")),*__context__)) )
+	{
+		goto label_19;
+	};
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_122;
+		das_get_variant_field<bool,8,2>::set(__mkv_122) = false;
+		return __mkv_122;
+	})()));
+	das_copy(____this_rename_at_62.__yield,14);
+	return das_auto_cast<bool>::cast(true);
+	label_14:;;
+	goto label_20;
+	label_19:;;
+	if ( !(SimPolicy<char *>::Equ(cast<char *>::from(____this_rename_at_62.__name_rename_at_118),cast<char *>::from(((char *) "null")),*__context__)) )
+	{
+		goto label_17;
+	};
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_124;
+		das_get_variant_field<void *,8,3>::set(__mkv_124) = nullptr;
+		return __mkv_124;
+	})()));
+	das_copy(____this_rename_at_62.__yield,15);
+	return das_auto_cast<bool>::cast(true);
+	label_15:;;
+	goto label_18;
+	label_17:;;
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_126;
+		das_get_variant_field<char *,8,5>::set(__mkv_126) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "invalid name ")), cast<char *>::from(____this_rename_at_62.__name_rename_at_118)));
+		return __mkv_126;
+	})()));
+	das_copy(____this_rename_at_62.__yield,16);
+	return das_auto_cast<bool>::cast(true);
+	label_16:;;
+	return das_auto_cast<bool>::cast(false);
+	label_18:;;
+	label_20:;;
+	label_22:;;
+	delete_string(____this_rename_at_62.__name_rename_at_118,__context__);
+	builtin_array_clear(das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str),__context__);
+	goto label_25;
+	label_24:;;
+	das_copy(___yield_62_rename_at_62,(([&]() -> TVariant<16,char *,double,bool,void *,int32_t,char *> {
+		TVariant<16,char *,double,bool,void *,int32_t,char *> __mkv_132;
+		das_get_variant_field<char *,8,5>::set(__mkv_132) = das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_1, cast<char * const >::from(((char *) "invalid character `")), cast<char *>::from(((char *)(to_string_char(____this_rename_at_62.ahead,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(____this_rename_at_62.ahead)));
+		return __mkv_132;
+	})()));
+	das_copy(____this_rename_at_62.__yield,23);
+	return das_auto_cast<bool>::cast(true);
+	label_23:;;
+	return das_auto_cast<bool>::cast(false);
+	label_25:;;
+	label_27:;;
+	label_29:;;
+	label_31:;;
+	goto label_32;
+	label_33:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _lexer_3d9482716a5b7e62 ( Context * __context__, char * __stext_rename_at_60 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_Funcbuiltin_0x60_each_9354ab97919d110b(__context__,das_ascend<bool,json::_lambda_json_62_8_1>::make(__context__,&__type_info__302cf646,(([&]() -> json::_lambda_json_62_8_1 {
+		json::_lambda_json_62_8_1 __mks_61;
+		das_zero(__mks_61);
+		das_copy((__mks_61.__lambda),(Func(__context__->fnIdxByMangledName(/*@json::_lambda_json_62_8_1`function _lambda_json_62_8_1 #variant#string#double#bool##ptr#void#int#string#`_string#`_number#`_bool#`_null#`_symbol#`_error*/ 3835459630u))));
+		das_copy((__mks_61.__finalize),(Func(__context__->fnIdxByMangledName(/*@json::_lambda_json_62_8_1`finazlier #ptr#_lambda_json_62_8_1#explicit*/ 941504112u))));
+		das_copy((__mks_61.stext),(__stext_rename_at_60));
+		return __mks_61;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) _Funcbuiltin_0x60_each_9354ab97919d110b ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_3bd22e87ecbdcf79 ( Context * __context__, char * const  __str_rename_at_244 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_245; das_zero(__it_rename_at_245);
+	builtin_make_string_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_245),__str_rename_at_244,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_245);
+}
+
+inline void _Funcbuiltin_0x60_finalize_7f972184337f6d1a ( Context * __context__, TArray<uint8_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<uint8_t>>::pass(__a_rename_at_186),1,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2 ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __Tab_rename_at_120, char * const  __at_rename_at_120 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_120,__at_rename_at_120));
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_98634c9938f02164 ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __a_rename_at_163 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_164; das_zero(__it_rename_at_164);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_164),__a_rename_at_163,8,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char * const  &))>::cast(__it_rename_at_164);
+}
+
+inline bool _Funcbuiltin_0x60_next_111e5cd76980442a ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  &  __it_rename_at_218, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __value_rename_at_218 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_218,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_218)),__context__));
+}
+
+inline bool _Funcbuiltin_0x60_next_6a3c01874ce3fb9a ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_218, int32_t & __value_rename_at_218 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_218,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_218)),__context__));
+}
+
+inline void _Funcbuiltin_0x60_push_c93bba0c4fc39632 ( Context * __context__, TArray<json::JsonValue *> &  __Arr_rename_at_37, json::JsonValue * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<json::JsonValue *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_8bc837d3f5eead45 ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_37, uint8_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_37),1,__context__),__context__),__value_rename_at_37);
+}
+
+inline Sequence DAS_COMMENT((json::JsonValue * const  &)) _Funcbuiltin_0x60_values_574eec0386138f1d ( Context * __context__, TTable<char *,json::JsonValue *> const  &  __a_rename_at_168 )
+{
+	Sequence DAS_COMMENT((json::JsonValue * *)) __it_rename_at_169; das_zero(__it_rename_at_169);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((json::JsonValue * const ))>::pass(__it_rename_at_169),__a_rename_at_168,8,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((json::JsonValue * const  &))>::cast(__it_rename_at_169);
+}
+
+inline bool expect_symbol_b900161392087591 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_151, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_151, int32_t __sym_rename_at_151, char * & __error_rename_at_151 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_151),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_151)) )
+	{
+		das_copy(__error_rename_at_151,((char *) "unexected eos"));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( !das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_151) )
+	{
+		das_copy(__error_rename_at_151,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_151), cast<char * const >::from(((char *) ", expecting symbol")))));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( !(das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_151,__context__) == __sym_rename_at_151) )
+	{
+		das_copy(__error_rename_at_151,das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_3, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_151), cast<char * const >::from(((char *) ", expecting symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_151,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_151))));
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline bool expect_token_86f090ae8385eee5 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_140, TVariant<16,char *,double,bool,void *,int32_t,char *> &  __ahead_rename_at_140, int32_t __vindex_rename_at_140, char * & __error_rename_at_140 )
+{
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_140),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_140)) )
+	{
+		das_copy(__error_rename_at_140,((char *) "unexected eos"));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( variant_index(das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_140)) != __vindex_rename_at_140 )
+	{
+		das_copy(__error_rename_at_140,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_4, cast<char * const >::from(((char *) "unexpected ")), cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_140), cast<char * const >::from(((char *) ", expecting variant ")), cast<int32_t>::from(__vindex_rename_at_140))));
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline void finalize_e976f8b94c5e9c2c ( Context * __context__, json::_lambda_json_62_8_1 &  ____this_rename_at_62 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_62.tin),__context__);
+	_Funcbuiltin_0x60_finalize_7f972184337f6d1a(__context__,das_arg<TArray<uint8_t>>::pass(____this_rename_at_62.str));
+	memset(&(____this_rename_at_62), 0, 80);
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_90f618f5a5740ad0 ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_55 )
+{
+	char * __stext_rename_at_56 = (char *)(((char *)(builtin_string_from_array(__text_rename_at_55,__context__))));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_lexer_3d9482716a5b7e62(__context__,__stext_rename_at_56));
+}
+
+inline Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) lexer_1c9abefe8842ea1e ( Context * __context__, char * const  __text_rename_at_50 )
+{
+	char * __stext_rename_at_51 = (char *)(((char *)(builtin_string_clone(__text_rename_at_50,__context__))));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::cast(_lexer_3d9482716a5b7e62(__context__,__stext_rename_at_51));
+}
+
+inline json::JsonValue * parse_value_cdc5c7af14740695 ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) &  __itv_rename_at_165, char * & __error_rename_at_165 )
+{
+	TVariant<16,char *,double,bool,void *,int32_t,char *> __ahead_rename_at_166; das_zero(__ahead_rename_at_166);
+	if ( !_Funcbuiltin_0x60_next_111e5cd76980442a(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_166)) )
+	{
+		return das_auto_cast<json::JsonValue *>::cast(nullptr);
+	} else {
+		if ( das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_166) )
+		{
+			int32_t __sym_rename_at_170 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_166,__context__));
+			if ( __sym_rename_at_170 == 93 )
+			{
+				das_copy(__error_rename_at_165,((char *) "unexpected ]"));
+				return das_auto_cast<json::JsonValue *>::cast(nullptr);
+			} else {
+				if ( __sym_rename_at_170 == 91 )
+				{
+					TArray<json::JsonValue *> __arr_rename_at_175; das_zero(__arr_rename_at_175);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165)) )
+					{
+						json::JsonValue * __value_rename_at_177 = parse_value_cdc5c7af14740695(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),__error_rename_at_165);
+						if ( __value_rename_at_177 == nullptr )
+						{
+							if ( (SimPolicy<char *>::Equ(cast<char *>::from(__error_rename_at_165),cast<char *>::from(((char *) "unexpected ]")),*__context__)) && (builtin_array_size(das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_175)) == 0) )
+							{
+								das_copy(__error_rename_at_165,((char *) ""));
+								return das_auto_cast<json::JsonValue *>::cast(JV_2c64f796dca9887e(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_175)));
+							} else {
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+						_Funcbuiltin_0x60_push_c93bba0c4fc39632(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_175),__value_rename_at_177);
+						if ( !expect_token_86f090ae8385eee5(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_166),4,__error_rename_at_165) )
+						{
+							return das_auto_cast<json::JsonValue *>::cast(nullptr);
+						} else {
+							int32_t __sepsym_rename_at_186 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_166,__context__));
+							if ( __sepsym_rename_at_186 == 93 )
+							{
+								break;
+							} else if ( __sepsym_rename_at_186 != 44 )
+							{
+								das_copy(__error_rename_at_165,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_5, cast<char * const >::from(((char *) "unsepected array seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_186,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_186))));
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165)) )
+					{
+						das_copy(__error_rename_at_165,((char *) "unexpected eos"));
+						return das_auto_cast<json::JsonValue *>::cast(nullptr);
+					} else {
+						return das_auto_cast<json::JsonValue *>::cast(JV_2c64f796dca9887e(__context__,das_arg<TArray<json::JsonValue *>>::pass(__arr_rename_at_175)));
+					};
+				} else if ( __sym_rename_at_170 == 123 )
+				{
+					TTable<char *,json::JsonValue *> __tab_rename_at_197; das_zero(__tab_rename_at_197);
+					while ( !builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165)) )
+					{
+						if ( !expect_token_86f090ae8385eee5(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_166),0,__error_rename_at_165) )
+						{
+							if ( (das_get_variant_field<int32_t,8,4>::is(__ahead_rename_at_166) && (das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_166,__context__) == 125)) && (builtin_table_size(das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_197)) == 0) )
+							{
+								das_copy(__error_rename_at_165,((char *) ""));
+								return das_auto_cast<json::JsonValue *>::cast(JV_b03c2c356e498d9c(__context__,das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_197)));
+							} else {
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							};
+						};
+						char * __key_rename_at_204 = (char *)(das_get_variant_field<char *,8,0>::as(__ahead_rename_at_166,__context__));
+						if ( !expect_symbol_b900161392087591(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_166),58,__error_rename_at_165) )
+						{
+							return das_auto_cast<json::JsonValue *>::cast(nullptr);
+						} else {
+							json::JsonValue * __value_rename_at_207 = parse_value_cdc5c7af14740695(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),__error_rename_at_165);
+							if ( __value_rename_at_207 == nullptr )
+							{
+								return das_auto_cast<json::JsonValue *>::cast(nullptr);
+							} else {
+								if ( __builtin_table_key_exists(__context__,__tab_rename_at_197,__key_rename_at_204) )
+								{
+									das_copy(__error_rename_at_165,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "duplicate key ")), cast<char *>::from(__key_rename_at_204))));
+									return das_auto_cast<json::JsonValue *>::cast(nullptr);
+								} else {
+									das_copy(__tab_rename_at_197(__key_rename_at_204,__context__),__value_rename_at_207);
+									if ( !expect_token_86f090ae8385eee5(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165),das_arg<TVariant<16,char *,double,bool,void *,int32_t,char *>>::pass(__ahead_rename_at_166),4,__error_rename_at_165) )
+									{
+										return das_auto_cast<json::JsonValue *>::cast(nullptr);
+									} else {
+										int32_t __sepsym_rename_at_216 = ((int32_t)das_get_variant_field<int32_t,8,4>::as(__ahead_rename_at_166,__context__));
+										if ( __sepsym_rename_at_216 == 125 )
+										{
+											break;
+										} else if ( __sepsym_rename_at_216 != 44 )
+										{
+											das_copy(__error_rename_at_165,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_7, cast<char * const >::from(((char *) "unsepected object seaprator symbol `")), cast<char *>::from(((char *)(to_string_char(__sepsym_rename_at_216,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sepsym_rename_at_216))));
+											return das_auto_cast<json::JsonValue *>::cast(nullptr);
+										};
+									};
+								};
+							};
+						};
+					};
+					if ( builtin_iterator_empty(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__itv_rename_at_165)) )
+					{
+						das_copy(__error_rename_at_165,((char *) "unexpected eos"));
+						return das_auto_cast<json::JsonValue *>::cast(nullptr);
+					} else {
+						return das_auto_cast<json::JsonValue *>::cast(JV_b03c2c356e498d9c(__context__,das_arg<TTable<char *,json::JsonValue *>>::pass(__tab_rename_at_197)));
+					};
+				} else {
+					das_copy(__error_rename_at_165,das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_8, cast<char * const >::from(((char *) "unexpected symbol `")), cast<char *>::from(((char *)(to_string_char(__sym_rename_at_170,__context__)))), cast<char * const >::from(((char *) "` aka ASCII ")), cast<int32_t>::from(__sym_rename_at_170))));
+					return das_auto_cast<json::JsonValue *>::cast(nullptr);
+				};
+			};
+		} else if ( das_get_variant_field<char *,8,0>::is(__ahead_rename_at_166) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_8704751214e9d711(__context__,das_get_variant_field<char *,8,0>::as(__ahead_rename_at_166,__context__)));
+		} else if ( das_get_variant_field<double,8,1>::is(__ahead_rename_at_166) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_d05d664ae3a58630(__context__,das_get_variant_field<double,8,1>::as(__ahead_rename_at_166,__context__)));
+		} else if ( das_get_variant_field<bool,8,2>::is(__ahead_rename_at_166) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_6e1bec90827eef39(__context__,das_get_variant_field<bool,8,2>::as(__ahead_rename_at_166,__context__)));
+		} else if ( das_get_variant_field<void *,8,3>::is(__ahead_rename_at_166) )
+		{
+			return das_auto_cast<json::JsonValue *>::cast(JV_e684d865c46c021a(__context__,nullptr));
+		} else {
+			das_copy(__error_rename_at_165,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<TVariant<16,char *,double,bool,void *,int32_t,char *> &>::from(__ahead_rename_at_166))));
+			return das_auto_cast<json::JsonValue *>::cast(nullptr);
+		};
+	};
+}
+
+inline json::JsonValue * read_json_8e989a8bb3660cb9 ( Context * __context__, TArray<uint8_t> const  &  __text_rename_at_247, char * & __error_rename_at_247 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_248; das_zero(__lex_rename_at_248); das_move(__lex_rename_at_248, lexer_90f618f5a5740ad0(__context__,__text_rename_at_247));
+	json::JsonValue * __res_rename_at_249 = ((json::JsonValue *)parse_value_cdc5c7af14740695(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_248),__error_rename_at_247));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_248),__context__);
+	return das_auto_cast<json::JsonValue *>::cast(__res_rename_at_249);
+}
+
+inline json::JsonValue * read_json_f9f5c2d90a97284a ( Context * __context__, char * const  __text_rename_at_241, char * & __error_rename_at_241 )
+{
+	Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) __lex_rename_at_242; das_zero(__lex_rename_at_242); das_move(__lex_rename_at_242, lexer_1c9abefe8842ea1e(__context__,__text_rename_at_241));
+	json::JsonValue * __res_rename_at_243 = ((json::JsonValue *)parse_value_cdc5c7af14740695(__context__,das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_242),__error_rename_at_241));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>))>::pass(__lex_rename_at_242),__context__);
+	return das_auto_cast<json::JsonValue *>::cast(__res_rename_at_243);
+}
+
+inline char * write_json_eb64e080ca704fd1 ( Context * __context__, json::JsonValue * const  __val_rename_at_308 )
+{
+	char * __st_rename_at_309 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_309)->void{
+		write_value_8f03ac377cbfd99c(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_309),__val_rename_at_308,0);
+	},__context__)))));
+	return das_auto_cast<char *>::cast(__st_rename_at_309);
+}
+
+inline void write_value_8f03ac377cbfd99c ( Context * __context__, StringBuilderWriter &  __writer_rename_at_254, json::JsonValue * const  __jsv_rename_at_254, int32_t __depth_rename_at_254 )
+{
+	if ( __jsv_rename_at_254 == nullptr )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "null"))));
+	} else if ( das_get_variant_field<char *,8,2>::is(__jsv_rename_at_254->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_11,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\""))));
+		write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),das_get_variant_field<char *,8,2>::as(__jsv_rename_at_254->value,__context__));
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_12,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\""))));
+	} else if ( das_get_variant_field<double,8,3>::is(__jsv_rename_at_254->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_13,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<double>::from(das_get_variant_field<double,8,3>::as(__jsv_rename_at_254->value,__context__))));
+	} else if ( das_get_variant_field<TArray<json::JsonValue *>,8,1>::is(__jsv_rename_at_254->value) )
+	{
+		if ( builtin_array_size(das_get_variant_field<TArray<json::JsonValue *>,8,1>::as(__jsv_rename_at_254->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_14,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "[]"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_15,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "[\n"))));
+			bool __first_rename_at_268 = true;
+			{
+				bool __need_loop_269 = true;
+				// elem : json::JsonValue? const&
+				das_iterator<TArray<json::JsonValue *> const > __elem_iterator(das_get_variant_field<TArray<json::JsonValue *>,8,1>::as(__jsv_rename_at_254->value,__context__));
+				json::JsonValue * const  * __elem_rename_at_269;
+				__need_loop_269 = __elem_iterator.first(__context__,(__elem_rename_at_269)) && __need_loop_269;
+				for ( ; __need_loop_269 ; __need_loop_269 = __elem_iterator.next(__context__,(__elem_rename_at_269)) )
+				{
+					if ( __first_rename_at_268 )
+					{
+						das_copy(__first_rename_at_268,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_16,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),9,__depth_rename_at_254 + 1);
+					write_value_8f03ac377cbfd99c(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),(*__elem_rename_at_269),__depth_rename_at_254 + 1);
+				}
+				__elem_iterator.close(__context__,(__elem_rename_at_269));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_17,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),9,__depth_rename_at_254);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_18,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "]"))));
+		};
+	} else if ( das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::is(__jsv_rename_at_254->value) )
+	{
+		if ( builtin_table_size(das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_254->value,__context__)) == 0 )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_19,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "{}"))));
+		} else {
+			Sequence DAS_COMMENT((char * *)) _temp_make_local_285_80;
+			Sequence DAS_COMMENT((json::JsonValue * *)) _temp_make_local_285_96;
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_20,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "{\n"))));
+			bool __first_rename_at_284 = true;
+			{
+				bool __need_loop_285 = true;
+				// elemK : string const&
+				das_iterator<Sequence DAS_COMMENT((char * const ))> __elemK_iterator((_temp_make_local_285_80 = (_Funcbuiltin_0x60_keys_98634c9938f02164(__context__,das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_254->value,__context__)))));
+				char * const  * __elemK_rename_at_285;
+				__need_loop_285 = __elemK_iterator.first(__context__,(__elemK_rename_at_285)) && __need_loop_285;
+				// elemV : json::JsonValue? const&
+				das_iterator<Sequence DAS_COMMENT((json::JsonValue * const ))> __elemV_iterator((_temp_make_local_285_96 = (_Funcbuiltin_0x60_values_574eec0386138f1d(__context__,das_get_variant_field<TTable<char *,json::JsonValue *>,8,0>::as(__jsv_rename_at_254->value,__context__)))));
+				json::JsonValue * const  * __elemV_rename_at_285;
+				__need_loop_285 = __elemV_iterator.first(__context__,(__elemV_rename_at_285)) && __need_loop_285;
+				for ( ; __need_loop_285 ; __need_loop_285 = __elemK_iterator.next(__context__,(__elemK_rename_at_285)) && __elemV_iterator.next(__context__,(__elemV_rename_at_285)) )
+				{
+					if ( __first_rename_at_284 )
+					{
+						das_copy(__first_rename_at_284,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_21,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) ",\n"))));
+					};
+					write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),9,__depth_rename_at_254 + 1);
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_22,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\""))));
+					write_escape_string(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),(*__elemK_rename_at_285));
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_23,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\" : "))));
+					write_value_8f03ac377cbfd99c(__context__,das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),(*__elemV_rename_at_285),__depth_rename_at_254 + 1);
+				}
+				__elemK_iterator.close(__context__,(__elemK_rename_at_285));
+				__elemV_iterator.close(__context__,(__elemV_rename_at_285));
+			};
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_24,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "\n"))));
+			write_string_chars(das_arg<StringBuilderWriter>::pass(__writer_rename_at_254),9,__depth_rename_at_254);
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_25,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "}"))));
+		};
+	} else if ( das_get_variant_field<bool,8,4>::is(__jsv_rename_at_254->value) )
+	{
+		if ( das_get_variant_field<bool,8,4>::as(__jsv_rename_at_254->value,__context__) )
+		{
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_26,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "true"))));
+		} else {
+			das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_27,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "false"))));
+		};
+	} else if ( das_get_variant_field<void *,8,5>::is(__jsv_rename_at_254->value) )
+	{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_28,cast<StringBuilderWriter &>::from(__writer_rename_at_254),cast<char * const >::from(((char *) "null"))));
+	} else {
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_29, cast<char * const >::from(((char *) "unexpected ")), cast<json::JsonValue * const >::from(__jsv_rename_at_254))),__context__);
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// JV_2c64f796dca9887e
+		aotLib[0x6bf6597179347d25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<json::JsonValue *> &  ),&JV_2c64f796dca9887e>>();
+	};
+		// JV_e684d865c46c021a
+		aotLib[0x8d8341858a541045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, void * const   ),&JV_e684d865c46c021a>>();
+	};
+		// JV_b03c2c356e498d9c
+		aotLib[0xbc706a586351dce5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TTable<char *,json::JsonValue *> &  ),&JV_b03c2c356e498d9c>>();
+	};
+		// JV_6e1bec90827eef39
+		aotLib[0x5ac77b3d56308205] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, bool  ),&JV_6e1bec90827eef39>>();
+	};
+		// JV_d05d664ae3a58630
+		aotLib[0xa291f32136dc4761] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, double  ),&JV_d05d664ae3a58630>>();
+	};
+		// JV_8704751214e9d711
+		aotLib[0x6556b3f5943c0319] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const   ),&JV_8704751214e9d711>>();
+	};
+		// _Func_lambda_json_62_8_1_0x60_finazlier_6021f7152918aa30
+		aotLib[0x6387d9c2cf5df1ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json::_lambda_json_62_8_1 *  ),&_Func_lambda_json_62_8_1_0x60_finazlier_6021f7152918aa30>>();
+	};
+		// _Func_lambda_json_62_8_1_0x60_function_b7ab68704b322a35
+		aotLib[0xfc48f5bd4210cf28] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, json::_lambda_json_62_8_1 & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Func_lambda_json_62_8_1_0x60_function_b7ab68704b322a35>>();
+	};
+		// _lexer_3d9482716a5b7e62
+		aotLib[0xceb3ed8969c1b3ab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char *  ),&_lexer_3d9482716a5b7e62>>();
+	};
+		// _Funcbuiltin_0x60_each_9354ab97919d110b
+		aotLib[0x82547a6ee0c6cb25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TVariant<16,char *,double,bool,void *,int32_t,char *>)) const   ),&_Funcbuiltin_0x60_each_9354ab97919d110b>>();
+	};
+		// _Funcbuiltin_0x60_each_3bd22e87ecbdcf79
+		aotLib[0x4c2de9cff1fb15e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, char * const   ),&_Funcbuiltin_0x60_each_3bd22e87ecbdcf79>>();
+	};
+		// _Funcbuiltin_0x60_finalize_7f972184337f6d1a
+		aotLib[0x561a74dd5f0a18cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> &  ),&_Funcbuiltin_0x60_finalize_7f972184337f6d1a>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2
+		aotLib[0x21fa5177d5105c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_cf25dd2b3c15ad2>>();
+	};
+		// _Funcbuiltin_0x60_keys_98634c9938f02164
+		aotLib[0x8ef32e892760fe51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_keys_98634c9938f02164>>();
+	};
+		// _Funcbuiltin_0x60_next_111e5cd76980442a
+		aotLib[0x827000f583a69705] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) const  & , TVariant<16,char *,double,bool,void *,int32_t,char *> &  ),&_Funcbuiltin_0x60_next_111e5cd76980442a>>();
+	};
+		// _Funcbuiltin_0x60_next_6a3c01874ce3fb9a
+		aotLib[0x858cb271b8b30095] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , int32_t &  ),&_Funcbuiltin_0x60_next_6a3c01874ce3fb9a>>();
+	};
+		// _Funcbuiltin_0x60_push_c93bba0c4fc39632
+		aotLib[0xd1dc4c3e7a9d5155] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<json::JsonValue *> & , json::JsonValue * const   ),&_Funcbuiltin_0x60_push_c93bba0c4fc39632>>();
+	};
+		// _Funcbuiltin_0x60_push_8bc837d3f5eead45
+		aotLib[0x14e8a037a1eff4d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , uint8_t  ),&_Funcbuiltin_0x60_push_8bc837d3f5eead45>>();
+	};
+		// _Funcbuiltin_0x60_values_574eec0386138f1d
+		aotLib[0xab919c1f22dc6501] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((json::JsonValue * const  &)) (*) ( Context * __context__, TTable<char *,json::JsonValue *> const  &  ),&_Funcbuiltin_0x60_values_574eec0386138f1d>>();
+	};
+		// expect_symbol_b900161392087591
+		aotLib[0x1e975addd70e4ac2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_symbol_b900161392087591>>();
+	};
+		// expect_token_86f090ae8385eee5
+		aotLib[0x8956bd8886fb2ad2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , TVariant<16,char *,double,bool,void *,int32_t,char *> & , int32_t , char * &  ),&expect_token_86f090ae8385eee5>>();
+	};
+		// finalize_e976f8b94c5e9c2c
+		aotLib[0xab73dfaa9c0f6e47] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json::_lambda_json_62_8_1 &  ),&finalize_e976f8b94c5e9c2c>>();
+	};
+		// lexer_90f618f5a5740ad0
+		aotLib[0x86d3f8a646e723a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, TArray<uint8_t> const  &  ),&lexer_90f618f5a5740ad0>>();
+	};
+		// lexer_1c9abefe8842ea1e
+		aotLib[0xab9e0450aa7a67ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) (*) ( Context * __context__, char * const   ),&lexer_1c9abefe8842ea1e>>();
+	};
+		// parse_value_cdc5c7af14740695
+		aotLib[0x7b6cafb0e0bba242] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, Sequence DAS_COMMENT((TVariant<16,char *,double,bool,void *,int32_t,char *>)) & , char * &  ),&parse_value_cdc5c7af14740695>>();
+	};
+		// read_json_8e989a8bb3660cb9
+		aotLib[0x9d7262f0885b2f40] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, TArray<uint8_t> const  & , char * &  ),&read_json_8e989a8bb3660cb9>>();
+	};
+		// read_json_f9f5c2d90a97284a
+		aotLib[0x993876ed4f8c28f2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<json::JsonValue * (*) ( Context * __context__, char * const  , char * &  ),&read_json_f9f5c2d90a97284a>>();
+	};
+		// write_json_eb64e080ca704fd1
+		aotLib[0x723eac287a301a4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, json::JsonValue * const   ),&write_json_eb64e080ca704fd1>>();
+	};
+		// write_value_8f03ac377cbfd99c
+		aotLib[0xf4d9217895d14a6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StringBuilderWriter & , json::JsonValue * const  , int32_t  ),&write_value_8f03ac377cbfd99c>>();
+	};
+		// [[ init script ]]
+		aotLib[0xd4f6ac7a4eed3466] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
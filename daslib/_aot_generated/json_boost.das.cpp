@@ -0,0 +1,615 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require json_boost
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require json
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__c9d26a46;
+extern StructInfo __struct_info__7876243e;
+extern StructInfo __struct_info__22ddbed;
+extern StructInfo __struct_info__92c3c52e;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__b676c5e0;
+extern TypeInfo __type_info__239a820b;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__56607ebd;
+extern TypeInfo __type_info__96c86dec;
+extern TypeInfo __type_info__cee18e8b;
+extern TypeInfo __type_info__baa44de8;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__8c0d0a29;
+extern VarInfo __var_info__5b1e2672;
+extern VarInfo __var_info__f9bc7965;
+extern VarInfo __var_info__4782b24d;
+extern VarInfo __var_info__bae603ca;
+extern VarInfo __var_info__5ad1fc43;
+extern VarInfo __var_info__627978da;
+extern VarInfo __var_info__1376ada8;
+extern VarInfo __var_info__1b5c47e2;
+extern VarInfo __var_info__269ec52a;
+extern VarInfo __var_info__e700fb87;
+extern VarInfo __var_info__b2847daf;
+extern VarInfo __var_info__7b690865;
+extern VarInfo __var_info__11a85b9d;
+extern VarInfo __var_info__fdfd8b7a;
+extern VarInfo __var_info__b7f3aed1;
+extern VarInfo __var_info__f4ff6d4;
+extern VarInfo __var_info__71702401;
+extern VarInfo __var_info__749d02ba;
+
+VarInfo __struct_info__c9d26a46_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf9bc7965, "__rtti", 0 };
+TypeInfo * __type_info__1b5c47e2_arg_types_var_3386010182[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__c9d26a46_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b5c47e2_arg_types_var_3386010182, nullptr, 1, 0, nullptr, 28, 0x1b5c47e2, "__finalize", 8 };
+TypeInfo * __type_info__b2847daf_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__c9d26a46_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b2847daf_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xb2847daf, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__e700fb87_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__c9d26a46_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e700fb87_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xe700fb87, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__f4ff6d4_arg_types_var_3386010182[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__c9d26a46_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4ff6d4_arg_types_var_3386010182, nullptr, 4, 0, nullptr, 28, 0xf4ff6d4, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__c9d26a46_fields[5] =  { &__struct_info__c9d26a46_field_0, &__struct_info__c9d26a46_field_1, &__struct_info__c9d26a46_field_2, &__struct_info__c9d26a46_field_3, &__struct_info__c9d26a46_field_4 };
+StructInfo __struct_info__c9d26a46 = {"AstVariantMacro", __struct_info__c9d26a46_fields, 5, 24, -1, nullptr, 0xc9d26a46 };
+VarInfo __struct_info__7876243e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x11a85b9d, "__rtti", 0 };
+TypeInfo * __type_info__749d02ba_arg_types_var_2021008446[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__7876243e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__749d02ba_arg_types_var_2021008446, nullptr, 1, 0, nullptr, 28, 0x749d02ba, "__finalize", 8 };
+TypeInfo * __type_info__fdfd8b7a_arg_types_var_2021008446[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__7876243e_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__fdfd8b7a_arg_types_var_2021008446, nullptr, 6, 0, nullptr, 28, 0xfdfd8b7a, "accept", 12 };
+TypeInfo * __type_info__71702401_arg_types_var_2021008446[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__7876243e_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__71702401_arg_types_var_2021008446, nullptr, 4, 0, nullptr, 28, 0x71702401, "visit", 16 };
+VarInfo * __struct_info__7876243e_fields[4] =  { &__struct_info__7876243e_field_0, &__struct_info__7876243e_field_1, &__struct_info__7876243e_field_2, &__struct_info__7876243e_field_3 };
+StructInfo __struct_info__7876243e = {"JsonReader", __struct_info__7876243e_fields, 4, 24, -1, nullptr, 0x7876243e };
+VarInfo __struct_info__22ddbed_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1376ada8, "__rtti", 0 };
+TypeInfo * __type_info__5ad1fc43_arg_types_var_36559853[1] = { &__type_info__baa44de8 };
+VarInfo __struct_info__22ddbed_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5ad1fc43_arg_types_var_36559853, nullptr, 1, 0, nullptr, 28, 0x5ad1fc43, "__finalize", 8 };
+TypeInfo * __type_info__5b1e2672_arg_types_var_36559853[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8c0d0a29 };
+VarInfo __struct_info__22ddbed_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b1e2672_arg_types_var_36559853, nullptr, 4, 0, nullptr, 28, 0x5b1e2672, "visitExprIsVariant", 12 };
+TypeInfo * __type_info__627978da_arg_types_var_36559853[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__b9a2b501 };
+VarInfo __struct_info__22ddbed_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__627978da_arg_types_var_36559853, nullptr, 4, 0, nullptr, 28, 0x627978da, "visitExprAsVariant", 16 };
+TypeInfo * __type_info__7b690865_arg_types_var_36559853[4] = { &__type_info__baa44de8, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__8fd2ec2e };
+VarInfo __struct_info__22ddbed_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7b690865_arg_types_var_36559853, nullptr, 4, 0, nullptr, 28, 0x7b690865, "visitExprSafeAsVariant", 20 };
+VarInfo * __struct_info__22ddbed_fields[5] =  { &__struct_info__22ddbed_field_0, &__struct_info__22ddbed_field_1, &__struct_info__22ddbed_field_2, &__struct_info__22ddbed_field_3, &__struct_info__22ddbed_field_4 };
+StructInfo __struct_info__22ddbed = {"BetterJsonMacro", __struct_info__22ddbed_fields, 5, 24, -1, nullptr, 0x22ddbed };
+VarInfo __struct_info__92c3c52e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4782b24d, "__rtti", 0 };
+TypeInfo * __type_info__269ec52a_arg_types_var_2462303534[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__92c3c52e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__269ec52a_arg_types_var_2462303534, nullptr, 1, 0, nullptr, 28, 0x269ec52a, "__finalize", 8 };
+TypeInfo * __type_info__bae603ca_arg_types_var_2462303534[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__92c3c52e_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bae603ca_arg_types_var_2462303534, nullptr, 6, 0, nullptr, 28, 0xbae603ca, "accept", 12 };
+TypeInfo * __type_info__b7f3aed1_arg_types_var_2462303534[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__92c3c52e_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7f3aed1_arg_types_var_2462303534, nullptr, 4, 0, nullptr, 28, 0xb7f3aed1, "visit", 16 };
+VarInfo * __struct_info__92c3c52e_fields[4] =  { &__struct_info__92c3c52e_field_0, &__struct_info__92c3c52e_field_1, &__struct_info__92c3c52e_field_2, &__struct_info__92c3c52e_field_3 };
+StructInfo __struct_info__92c3c52e = {"AstReaderMacro", __struct_info__92c3c52e_fields, 4, 24, -1, nullptr, 0x92c3c52e };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__b676c5e0 = { Type::tStructure, &__struct_info__92c3c52e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb676c5e0 };
+TypeInfo __type_info__239a820b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::LineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0x239a820b };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__56607ebd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x56607ebd };
+TypeInfo __type_info__96c86dec = { Type::tStructure, &__struct_info__7876243e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x96c86dec };
+TypeInfo __type_info__cee18e8b = { Type::tStructure, &__struct_info__22ddbed, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xcee18e8b };
+TypeInfo __type_info__baa44de8 = { Type::tStructure, &__struct_info__c9d26a46, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xbaa44de8 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_2[1] = { &__type_info__e8c29053 };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstStructureAnnotation
+namespace ast {
+
+struct AstVariantMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(AstVariantMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVariantMacro,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstVisitor
+namespace json {
+
+struct JsonValue {
+	TVariant<56,TTable<char *,json::JsonValue *>,TArray<json::JsonValue *>,char *,double,bool,void *> value;
+};
+static_assert(sizeof(JsonValue)==56,"structure size mismatch with DAS");
+static_assert(offsetof(JsonValue,value)==0,"structure field offset mismatch with DAS");
+}
+// unused structure _lambda_json_62_8_1
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace json_boost {
+
+struct BetterJsonMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVariantMacro)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+};
+static_assert(sizeof(BetterJsonMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprIsVariant)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprAsVariant)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(BetterJsonMacro,visitExprSafeAsVariant)==20,"structure field offset mismatch with DAS");
+}
+namespace json_boost {
+
+struct JsonReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(JsonReader)==24,"structure size mismatch with DAS");
+static_assert(offsetof(JsonReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(JsonReader,visit)==16,"structure field offset mismatch with DAS");
+}
+
+inline json_boost::BetterJsonMacro BetterJsonMacro_7369ed323c1a0ff9 ( Context * __context__ );
+inline void _FuncBetterJsonMacro_0x27___finalize_2c532f97d8f81cb2 ( Context * __context__, json_boost::BetterJsonMacro & __self_rename_at_30 );
+inline smart_ptr_raw<Expression> _FuncBetterJsonMacro_0x60_visitExprAsVariant_2cfe79672cf06e67 ( Context * __context__, json_boost::BetterJsonMacro & __self_rename_at_37, smart_ptr_raw<Program> const  __prog_rename_at_37, Module * const  __mod_rename_at_37, smart_ptr_raw<ExprAsVariant> const  __expr_rename_at_37 );
+inline smart_ptr_raw<Expression> _FuncBetterJsonMacro_0x60_visitExprIsVariant_2ff46c860c693497 ( Context * __context__, json_boost::BetterJsonMacro & __self_rename_at_31, smart_ptr_raw<Program> const  __prog_rename_at_31, Module * const  __mod_rename_at_31, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_31 );
+inline json_boost::JsonReader JsonReader_1316a3ed3d0c8ca8 ( Context * __context__ );
+inline void _FuncJsonReader_0x27___finalize_2c1c07c5e8ee7328 ( Context * __context__, json_boost::JsonReader & __self_rename_at_45 );
+inline bool _FuncJsonReader_0x60_accept_e5cd609e44eae913 ( Context * __context__, json_boost::JsonReader & __self_rename_at_46, smart_ptr_raw<Program> const  __prog_rename_at_46, Module * const  __mod_rename_at_46, ExprReader * __expr_rename_at_46, int32_t __ch_rename_at_46, LineInfo const  & __info_rename_at_46 );
+inline smart_ptr_raw<Expression> _FuncJsonReader_0x60_visit_8a3da05c2af28558 ( Context * __context__, json_boost::JsonReader & __self_rename_at_54, smart_ptr_raw<Program> const  __prog_rename_at_54, Module * const  __mod_rename_at_54, smart_ptr_raw<ExprReader> const  __expr_rename_at_54 );
+inline void __setup_macros_58159ef5b7a659ed ( Context * __context__ );
+inline void _Funcast_0x60_add_new_reader_macro_ad4ac622c1360d28 ( Context * __context__, char * const  __name_rename_at_523, json_boost::JsonReader * const  __someClassPtr_rename_at_523 );
+inline void _Funcast_0x60_add_new_variant_macro_20eb3c30657e8a2c ( Context * __context__, char * const  __name_rename_at_517, json_boost::BetterJsonMacro * const  __someClassPtr_rename_at_517 );
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_124904cf62cbe130 ( Context * __context__, char * const  __name_rename_at_473, json_boost::JsonReader * const  __someClassPtr_rename_at_473 );
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_c8e40c261eddebda ( Context * __context__, char * const  __name_rename_at_497, json_boost::BetterJsonMacro * const  __someClassPtr_rename_at_497 );
+inline void finalize_8bc0980268e4485b ( Context * __context__, json_boost::BetterJsonMacro & ____this_rename_at_30 );
+inline void finalize_65b3e63f49a7f2a ( Context * __context__, json_boost::JsonReader & ____this_rename_at_45 );
+inline bool is_json_ptr_value_6aba7f59196d1e2d ( Context * __context__, smart_ptr_raw<TypeDecl> const  __td_rename_at_13 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_ebd316273a7531e2 ( Context * __context__, json_boost::BetterJsonMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_3acedf7cff4f36fb ( Context * __context__, json_boost::JsonReader const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_58159ef5b7a659ed(__context__);
+}
+
+inline json_boost::BetterJsonMacro BetterJsonMacro_7369ed323c1a0ff9 ( Context * __context__ )
+{
+	return das_auto_cast<json_boost::BetterJsonMacro>::cast((([&]() -> json_boost::BetterJsonMacro {
+		json_boost::BetterJsonMacro __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.__rtti),(((void *)(&__type_info__cee18e8b))));
+		das_copy((__mks_30.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVariantMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::BetterJsonMacro'__finalize BetterJsonMacro*/ 210277448u)))));
+		das_copy((__mks_30.visitExprIsVariant),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprIsVariant> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::BetterJsonMacro`visitExprIsVariant BetterJsonMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprIsVariant#const*/ 1597821726u)))));
+		das_copy((__mks_30.visitExprAsVariant),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVariantMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprAsVariant> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::BetterJsonMacro`visitExprAsVariant BetterJsonMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprAsVariant#const*/ 4142301006u)))));
+		return __mks_30;
+	})()));
+}
+
+inline void _FuncBetterJsonMacro_0x27___finalize_2c532f97d8f81cb2 ( Context * __context__, json_boost::BetterJsonMacro &  __self_rename_at_30 )
+{
+	finalize_8bc0980268e4485b(__context__,das_arg<json_boost::BetterJsonMacro>::pass(__self_rename_at_30));
+}
+
+inline smart_ptr_raw<Expression> _FuncBetterJsonMacro_0x60_visitExprAsVariant_2cfe79672cf06e67 ( Context * __context__, json_boost::BetterJsonMacro &  __self_rename_at_37, smart_ptr_raw<Program> const  __prog_rename_at_37, Module * const  __mod_rename_at_37, smart_ptr_raw<ExprAsVariant> const  __expr_rename_at_37 ) { das_stack_prologue __prologue(__context__,224,"BetterJsonMacro`visitExprAsVariant " DAS_FILE_LINE);
+{
+	if ( is_json_ptr_value_6aba7f59196d1e2d(__context__,__expr_rename_at_37->value /*value*/->type /*_type*/) )
+	{
+		smart_ptr_raw<ExprField> __vdr_rename_at_39; das_zero(__vdr_rename_at_39); das_move(__vdr_rename_at_39, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_39) {
+			das_copy((__mks_39.at /*at*/),(__expr_rename_at_37->at /*at*/));
+			das_move((__mks_39.value /*value*/),(clone_expression(__expr_rename_at_37->value /*value*/)));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_39.name /*name*/),((char *) "value"));
+			}		}))));
+		smart_ptr_raw<ExprAsVariant> __isv_rename_at_40; das_zero(__isv_rename_at_40); das_move(__isv_rename_at_40, das_ascend_handle<true,smart_ptr_raw<ExprAsVariant>>::make(__context__,nullptr,(([&](ExprAsVariant & __mks_40) {
+			das_copy((__mks_40.at /*at*/),(__expr_rename_at_37->at /*at*/));
+			das_move((__mks_40.value /*value*/),(__vdr_rename_at_39));
+			{
+				das_clone(__mks_40.name /*name*/,__expr_rename_at_37->name /*name*/);
+			}		}))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__isv_rename_at_40);
+	} else {
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	};
+}}
+
+inline smart_ptr_raw<Expression> _FuncBetterJsonMacro_0x60_visitExprIsVariant_2ff46c860c693497 ( Context * __context__, json_boost::BetterJsonMacro &  __self_rename_at_31, smart_ptr_raw<Program> const  __prog_rename_at_31, Module * const  __mod_rename_at_31, smart_ptr_raw<ExprIsVariant> const  __expr_rename_at_31 ) { das_stack_prologue __prologue(__context__,224,"BetterJsonMacro`visitExprIsVariant " DAS_FILE_LINE);
+{
+	if ( is_json_ptr_value_6aba7f59196d1e2d(__context__,__expr_rename_at_31->value /*value*/->type /*_type*/) )
+	{
+		smart_ptr_raw<ExprField> __vdr_rename_at_33; das_zero(__vdr_rename_at_33); das_move(__vdr_rename_at_33, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_33) {
+			das_copy((__mks_33.at /*at*/),(__expr_rename_at_31->at /*at*/));
+			das_move((__mks_33.value /*value*/),(clone_expression(__expr_rename_at_31->value /*value*/)));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_33.name /*name*/),((char *) "value"));
+			}		}))));
+		smart_ptr_raw<ExprIsVariant> __isv_rename_at_34; das_zero(__isv_rename_at_34); das_move(__isv_rename_at_34, das_ascend_handle<true,smart_ptr_raw<ExprIsVariant>>::make(__context__,nullptr,(([&](ExprIsVariant & __mks_34) {
+			das_copy((__mks_34.at /*at*/),(__expr_rename_at_31->at /*at*/));
+			das_move((__mks_34.value /*value*/),(__vdr_rename_at_33));
+			{
+				das_clone(__mks_34.name /*name*/,__expr_rename_at_31->name /*name*/);
+			}		}))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__isv_rename_at_34);
+	} else {
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	};
+}}
+
+inline json_boost::JsonReader JsonReader_1316a3ed3d0c8ca8 ( Context * __context__ )
+{
+	return das_auto_cast<json_boost::JsonReader>::cast((([&]() -> json_boost::JsonReader {
+		json_boost::JsonReader __mks_45;
+		das_copy((__mks_45.__rtti),(((void *)(&__type_info__96c86dec))));
+		das_copy((__mks_45.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstReaderMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::JsonReader'__finalize JsonReader*/ 3916711942u)))));
+		das_copy((__mks_45.accept),(das_cast<Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const ))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::JsonReader`accept JsonReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #ptr##handle#ExprReader int#const #handle#LineInfo#const*/ 261520692u)))));
+		das_copy((__mks_45.visit),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@json_boost::JsonReader`visit JsonReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprReader#const*/ 2298793710u)))));
+		return __mks_45;
+	})()));
+}
+
+inline void _FuncJsonReader_0x27___finalize_2c1c07c5e8ee7328 ( Context * __context__, json_boost::JsonReader &  __self_rename_at_45 )
+{
+	finalize_65b3e63f49a7f2a(__context__,das_arg<json_boost::JsonReader>::pass(__self_rename_at_45));
+}
+
+inline bool _FuncJsonReader_0x60_accept_e5cd609e44eae913 ( Context * __context__, json_boost::JsonReader &  __self_rename_at_46, smart_ptr_raw<Program> const  __prog_rename_at_46, Module * const  __mod_rename_at_46, ExprReader * __expr_rename_at_46, int32_t __ch_rename_at_46, LineInfo const  &  __info_rename_at_46 )
+{
+	builtin_append_char_to_string(das_arg<das::string>::pass(__expr_rename_at_46->sequence /*sequence*/),__ch_rename_at_46);
+	if ( builtin_string_ends_with(das_arg<das::string>::pass(__expr_rename_at_46->sequence /*sequence*/),((char *) "%%"),__context__) )
+	{
+		int32_t __len_rename_at_49 = ((int32_t)builtin_ext_string_length(das_arg<das::string>::pass(__expr_rename_at_46->sequence /*sequence*/)));
+		builtin_resize_string(das_arg<das::string>::pass(__expr_rename_at_46->sequence /*sequence*/),__len_rename_at_49 - 2);
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncJsonReader_0x60_visit_8a3da05c2af28558 ( Context * __context__, json_boost::JsonReader &  __self_rename_at_54, smart_ptr_raw<Program> const  __prog_rename_at_54, Module * const  __mod_rename_at_54, smart_ptr_raw<ExprReader> const  __expr_rename_at_54 )
+{
+	char * __seqStr_rename_at_55 = ((char *)(char *)(((char *)(to_das_string(__expr_rename_at_54->sequence /*sequence*/,__context__)))));
+	char * __error_rename_at_56 = (char *)(((char *) ""));
+	json::JsonValue * __json_rename_at_57 = das_invoke_function<json::JsonValue *>::invoke<char * const ,char * &>(__context__,Func(__context__->fnIdxByMangledName(/*@json::read_json string#const#implicit string#ref*/ 3994206100u)),__seqStr_rename_at_55,__error_rename_at_56);
+	if ( __json_rename_at_57 == nullptr )
+	{
+		ast_error(__prog_rename_at_54,__expr_rename_at_54->at /*at*/,das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "json did not parse (")), cast<char *>::from(__error_rename_at_56), cast<char * const >::from(((char *) ")")))));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	} else {
+		smart_ptr_raw<Expression> __jsv_rename_at_62; das_zero(__jsv_rename_at_62); das_move(__jsv_rename_at_62, das_invoke_function<smart_ptr_raw<Expression>>::invoke<json::JsonValue * &,LineInfo const  &>(__context__,Func(__context__->fnIdxByMangledName(/*@json_boost::ast_boost`convert_to_expression #ptr#JsonValue#ref#explicit #handle#LineInfo#const*/ 3235892035u)),__json_rename_at_57,__expr_rename_at_54->at /*at*/));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__jsv_rename_at_62);
+	};
+}
+
+inline void __setup_macros_58159ef5b7a659ed ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "json_boost"),__context__) )
+	{
+		_Funcast_0x60_add_new_variant_macro_20eb3c30657e8a2c(__context__,((char *) "better_json"),das_new<json_boost::BetterJsonMacro>::make_and_init(__context__,[&]() { return BetterJsonMacro_7369ed323c1a0ff9(__context__); }));
+		_Funcast_0x60_add_new_reader_macro_ad4ac622c1360d28(__context__,((char *) "json"),das_new<json_boost::JsonReader>::make_and_init(__context__,[&]() { return JsonReader_1316a3ed3d0c8ca8(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_reader_macro_ad4ac622c1360d28 ( Context * __context__, char * const  __name_rename_at_523, json_boost::JsonReader * const  __someClassPtr_rename_at_523 )
+{
+	smart_ptr_raw<ReaderMacro> __ann_rename_at_524; das_zero(__ann_rename_at_524); das_move(__ann_rename_at_524, _Funcast_0x60_make_reader_macro_124904cf62cbe130(__context__,__name_rename_at_523,__someClassPtr_rename_at_523));
+	addModuleReaderMacro(thisModule(__context__,nullptr),__ann_rename_at_524,__context__);
+	das_delete_handle<smart_ptr_raw<ReaderMacro>>::clear(__context__,__ann_rename_at_524);
+}
+
+inline void _Funcast_0x60_add_new_variant_macro_20eb3c30657e8a2c ( Context * __context__, char * const  __name_rename_at_517, json_boost::BetterJsonMacro * const  __someClassPtr_rename_at_517 )
+{
+	smart_ptr_raw<VariantMacro> __ann_rename_at_518; das_zero(__ann_rename_at_518); das_move(__ann_rename_at_518, _Funcast_0x60_make_variant_macro_c8e40c261eddebda(__context__,__name_rename_at_517,__someClassPtr_rename_at_517));
+	addModuleVariantMacro(thisModule(__context__,nullptr),__ann_rename_at_518,__context__);
+	das_delete_handle<smart_ptr_raw<VariantMacro>>::clear(__context__,__ann_rename_at_518);
+}
+
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_124904cf62cbe130 ( Context * __context__, char * const  __name_rename_at_473, json_boost::JsonReader * const  __someClassPtr_rename_at_473 )
+{
+	StructInfo const  * __classInfo_rename_at_475 = ((StructInfo const  *)_Funcrtti_0x60_class_info_3acedf7cff4f36fb(__context__,das_deref(__context__,__someClassPtr_rename_at_473)));
+	return das_auto_cast<smart_ptr_raw<ReaderMacro>>::cast(makeReaderMacro(__name_rename_at_473,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_473),__classInfo_rename_at_475,__context__));
+}
+
+inline smart_ptr_raw<VariantMacro> _Funcast_0x60_make_variant_macro_c8e40c261eddebda ( Context * __context__, char * const  __name_rename_at_497, json_boost::BetterJsonMacro * const  __someClassPtr_rename_at_497 )
+{
+	StructInfo const  * __classInfo_rename_at_499 = ((StructInfo const  *)_Funcrtti_0x60_class_info_ebd316273a7531e2(__context__,das_deref(__context__,__someClassPtr_rename_at_497)));
+	return das_auto_cast<smart_ptr_raw<VariantMacro>>::cast(makeVariantMacro(__name_rename_at_497,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_497),__classInfo_rename_at_499,__context__));
+}
+
+inline void finalize_8bc0980268e4485b ( Context * __context__, json_boost::BetterJsonMacro &  ____this_rename_at_30 )
+{
+	memset(&(____this_rename_at_30), 0, 24);
+}
+
+inline void finalize_65b3e63f49a7f2a ( Context * __context__, json_boost::JsonReader &  ____this_rename_at_45 )
+{
+	memset(&(____this_rename_at_45), 0, 24);
+}
+
+inline bool is_json_ptr_value_6aba7f59196d1e2d ( Context * __context__, smart_ptr_raw<TypeDecl> const  __td_rename_at_13 )
+{
+	if ( __td_rename_at_13->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		if ( equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__td_rename_at_13->firstType /*firstType*/),nullptr) )
+		{
+			return das_auto_cast<bool>::cast(false);
+		} else {
+			if ( __td_rename_at_13->firstType /*firstType*/->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure )
+			{
+				return das_auto_cast<bool>::cast(false);
+			} else {
+				Structure * __st_rename_at_20 = ((Structure *)__td_rename_at_13->firstType /*firstType*/->structType /*structType*/);
+				return das_auto_cast<bool>::cast(((SimPolicy<char *>::NotEqu(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string const  &>::from(__st_rename_at_20->name /*name*/)))),cast<char *>::from(((char *) "JsonValue")),*__context__)) && (SimPolicy<char *>::NotEqu(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<das::string const  &>::from(__st_rename_at_20->module /*_module*/->name /*name*/)))),cast<char *>::from(((char *) "json")),*__context__))) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(true));
+			};
+		};
+	};
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_ebd316273a7531e2 ( Context * __context__, json_boost::BetterJsonMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_3acedf7cff4f36fb ( Context * __context__, json_boost::JsonReader const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// BetterJsonMacro_7369ed323c1a0ff9
+		aotLib[0xb308deb771551] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<json_boost::BetterJsonMacro (*) ( Context * __context__ ),&BetterJsonMacro_7369ed323c1a0ff9>>();
+	};
+		// _FuncBetterJsonMacro_0x27___finalize_2c532f97d8f81cb2
+		aotLib[0xd1c46b326fc52a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json_boost::BetterJsonMacro &  ),&_FuncBetterJsonMacro_0x27___finalize_2c532f97d8f81cb2>>();
+	};
+		// _FuncBetterJsonMacro_0x60_visitExprAsVariant_2cfe79672cf06e67
+		aotLib[0xfdb67e78ae719540] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, json_boost::BetterJsonMacro & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprAsVariant> const   ),&_FuncBetterJsonMacro_0x60_visitExprAsVariant_2cfe79672cf06e67>>();
+	};
+		// _FuncBetterJsonMacro_0x60_visitExprIsVariant_2ff46c860c693497
+		aotLib[0xf655d3d6f1d7f2ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, json_boost::BetterJsonMacro & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprIsVariant> const   ),&_FuncBetterJsonMacro_0x60_visitExprIsVariant_2ff46c860c693497>>();
+	};
+		// JsonReader_1316a3ed3d0c8ca8
+		aotLib[0x1924a0567a4ee52] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<json_boost::JsonReader (*) ( Context * __context__ ),&JsonReader_1316a3ed3d0c8ca8>>();
+	};
+		// _FuncJsonReader_0x27___finalize_2c1c07c5e8ee7328
+		aotLib[0x7271f2d8bf82a14c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json_boost::JsonReader &  ),&_FuncJsonReader_0x27___finalize_2c1c07c5e8ee7328>>();
+	};
+		// _FuncJsonReader_0x60_accept_e5cd609e44eae913
+		aotLib[0xcafa152790628755] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, json_boost::JsonReader & , smart_ptr_raw<Program> const  , Module * const  , ExprReader * , int32_t , LineInfo const  &  ),&_FuncJsonReader_0x60_accept_e5cd609e44eae913>>();
+	};
+		// _FuncJsonReader_0x60_visit_8a3da05c2af28558
+		aotLib[0x62ff7db14f2e4b92] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, json_boost::JsonReader & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprReader> const   ),&_FuncJsonReader_0x60_visit_8a3da05c2af28558>>();
+	};
+		// __setup_macros_58159ef5b7a659ed
+		aotLib[0x54e1a34862d91599] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_58159ef5b7a659ed>>();
+	};
+		// _Funcast_0x60_add_new_reader_macro_ad4ac622c1360d28
+		aotLib[0xb9caa1595fbf6c81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , json_boost::JsonReader * const   ),&_Funcast_0x60_add_new_reader_macro_ad4ac622c1360d28>>();
+	};
+		// _Funcast_0x60_add_new_variant_macro_20eb3c30657e8a2c
+		aotLib[0x3d5b3c7d7c0c6b2e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , json_boost::BetterJsonMacro * const   ),&_Funcast_0x60_add_new_variant_macro_20eb3c30657e8a2c>>();
+	};
+		// _Funcast_0x60_make_reader_macro_124904cf62cbe130
+		aotLib[0xc1d2692d5feacaf7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ReaderMacro> (*) ( Context * __context__, char * const  , json_boost::JsonReader * const   ),&_Funcast_0x60_make_reader_macro_124904cf62cbe130>>();
+	};
+		// _Funcast_0x60_make_variant_macro_c8e40c261eddebda
+		aotLib[0x772b65375c5b4618] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VariantMacro> (*) ( Context * __context__, char * const  , json_boost::BetterJsonMacro * const   ),&_Funcast_0x60_make_variant_macro_c8e40c261eddebda>>();
+	};
+		// finalize_8bc0980268e4485b
+		aotLib[0xf7a0dc5961b98785] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json_boost::BetterJsonMacro &  ),&finalize_8bc0980268e4485b>>();
+	};
+		// finalize_65b3e63f49a7f2a
+		aotLib[0x26095a2a34e2ca4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, json_boost::JsonReader &  ),&finalize_65b3e63f49a7f2a>>();
+	};
+		// is_json_ptr_value_6aba7f59196d1e2d
+		aotLib[0x22ef877730cd98d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&is_json_ptr_value_6aba7f59196d1e2d>>();
+	};
+		// _Funcrtti_0x60_class_info_ebd316273a7531e2
+		aotLib[0x6a14884b9f237781] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, json_boost::BetterJsonMacro const  &  ),&_Funcrtti_0x60_class_info_ebd316273a7531e2>>();
+	};
+		// _Funcrtti_0x60_class_info_3acedf7cff4f36fb
+		aotLib[0x2c38c40a2cce0e25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, json_boost::JsonReader const  &  ),&_Funcrtti_0x60_class_info_3acedf7cff4f36fb>>();
+	};
+		// [[ init script ]]
+		aotLib[0x6621f1cb7bacc097] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
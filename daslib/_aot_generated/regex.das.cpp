@@ -0,0 +1,1942 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__54d21be3;
+extern StructInfo __struct_info__814eb49d;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__23a62413;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__def08656;
+extern TypeInfo __type_info__fadc0cd2;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__90ba8218;
+extern TypeInfo __type_info__da4cf41c;
+extern TypeInfo __type_info__2fb08994;
+extern TypeInfo __type_info__79ec5fa3;
+extern TypeInfo __type_info__e7c33a17;
+extern VarInfo __var_info__683ffa2;
+extern VarInfo __var_info__8a9e2bc;
+extern VarInfo __var_info__622d762c;
+extern VarInfo __var_info__6ad39c4c;
+extern VarInfo __var_info__1b349211;
+extern VarInfo __var_info__85d2e124;
+extern VarInfo __var_info__edd95571;
+extern VarInfo __var_info__cc2d9212;
+extern VarInfo __var_info__886e4e7c;
+extern VarInfo __var_info__7e8b348f;
+extern VarInfo __var_info__d18c8a71;
+extern VarInfo __var_info__fb508c6e;
+extern VarInfo __var_info__c896daa2;
+extern VarInfo __var_info__fb0c5243;
+extern VarInfo __var_info__b9ead212;
+extern VarInfo __var_info__85e1ebae;
+extern VarInfo __var_info__8469f83e;
+extern VarInfo __var_info__63115269;
+extern VarInfo __var_info__af513868;
+extern VarInfo __var_info__85ce63f6;
+extern FuncInfo __func_info__d2e1683e;
+extern EnumInfo __enum_info__8d516ad4;
+
+EnumValueInfo __enum_info__8d516ad4_value_0 = { "Char", 0 };
+EnumValueInfo __enum_info__8d516ad4_value_1 = { "Set", 1 };
+EnumValueInfo __enum_info__8d516ad4_value_2 = { "Any", 2 };
+EnumValueInfo __enum_info__8d516ad4_value_3 = { "Eos", 3 };
+EnumValueInfo __enum_info__8d516ad4_value_4 = { "Group", 4 };
+EnumValueInfo __enum_info__8d516ad4_value_5 = { "Plus", 5 };
+EnumValueInfo __enum_info__8d516ad4_value_6 = { "Star", 6 };
+EnumValueInfo __enum_info__8d516ad4_value_7 = { "Question", 7 };
+EnumValueInfo __enum_info__8d516ad4_value_8 = { "Concat", 8 };
+EnumValueInfo __enum_info__8d516ad4_value_9 = { "Union", 9 };
+EnumValueInfo * __enum_info__8d516ad4_values [] = { &__enum_info__8d516ad4_value_0, &__enum_info__8d516ad4_value_1, &__enum_info__8d516ad4_value_2, &__enum_info__8d516ad4_value_3, &__enum_info__8d516ad4_value_4, &__enum_info__8d516ad4_value_5, &__enum_info__8d516ad4_value_6, &__enum_info__8d516ad4_value_7, &__enum_info__8d516ad4_value_8, &__enum_info__8d516ad4_value_9 };
+EnumInfo __enum_info__8d516ad4 = { "ReOp", __enum_info__8d516ad4_values, 10, 0x8d516ad4 };
+VarInfo __struct_info__54d21be3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xedd95571, "root", 0 };
+VarInfo __struct_info__54d21be3_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb9ead212, "match", 8 };
+VarInfo __struct_info__54d21be3_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__def08656, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x63115269, "groups", 16 };
+uint32_t __type_info__622d762c_dim_var_1423055843[1] = { 8 };
+VarInfo __struct_info__54d21be3_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__622d762c_dim_var_1423055843, 30, 0x622d762c, "earlyOut", 40 };
+VarInfo __struct_info__54d21be3_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x8a9e2bc, "canEarlyOut", 72 };
+VarInfo * __struct_info__54d21be3_fields[5] =  { &__struct_info__54d21be3_field_0, &__struct_info__54d21be3_field_1, &__struct_info__54d21be3_field_2, &__struct_info__54d21be3_field_3, &__struct_info__54d21be3_field_4 };
+StructInfo __struct_info__54d21be3 = {"Regex", __struct_info__54d21be3_fields, 5, 80, -1, nullptr, 0x54d21be3 };
+VarInfo __struct_info__814eb49d_field_0 =  { Type::tEnumeration, nullptr, &__enum_info__8d516ad4, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x85d2e124, "op", 0 };
+VarInfo __struct_info__814eb49d_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x85ce63f6, "id", 4 };
+TypeInfo * __type_info__fb508c6e_arg_types_var_2169418909[3] = { &__type_info__90ba8218, &__type_info__2fb08994, &__type_info__79ec5fa3 };
+VarInfo __struct_info__814eb49d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__23a62413, nullptr, (TypeInfo **)__type_info__fb508c6e_arg_types_var_2169418909, nullptr, 3, 0, nullptr, 28, 0xfb508c6e, "fun2", 8 };
+VarInfo __struct_info__814eb49d_field_3 =  { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x85e1ebae, "at", 12 };
+VarInfo __struct_info__814eb49d_field_4 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x6ad39c4c, "text", 24 };
+VarInfo __struct_info__814eb49d_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xfb0c5243, "textLen", 32 };
+VarInfo __struct_info__814eb49d_field_6 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2fb08994, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8469f83e, "all", 40 };
+VarInfo __struct_info__814eb49d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x683ffa2, "left", 64 };
+VarInfo __struct_info__814eb49d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7e8b348f, "right", 72 };
+VarInfo __struct_info__814eb49d_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x886e4e7c, "subexpr", 80 };
+VarInfo __struct_info__814eb49d_field_10 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcc2d9212, "next", 88 };
+uint32_t __type_info__af513868_dim_var_2169418909[1] = { 8 };
+VarInfo __struct_info__814eb49d_field_11 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__af513868_dim_var_2169418909, 30, 0xaf513868, "cset", 96 };
+VarInfo __struct_info__814eb49d_field_12 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd18c8a71, "index", 128 };
+VarInfo __struct_info__814eb49d_field_13 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1b349211, "tail", 136 };
+VarInfo * __struct_info__814eb49d_fields[14] =  { &__struct_info__814eb49d_field_0, &__struct_info__814eb49d_field_1, &__struct_info__814eb49d_field_2, &__struct_info__814eb49d_field_3, &__struct_info__814eb49d_field_4, &__struct_info__814eb49d_field_5, &__struct_info__814eb49d_field_6, &__struct_info__814eb49d_field_7, &__struct_info__814eb49d_field_8, &__struct_info__814eb49d_field_9, &__struct_info__814eb49d_field_10, &__struct_info__814eb49d_field_11, &__struct_info__814eb49d_field_12, &__struct_info__814eb49d_field_13 };
+StructInfo __struct_info__814eb49d = {"ReNode", __struct_info__814eb49d_fields, 14, 144, -1, nullptr, 0x814eb49d };
+VarInfo __func_info__d2e1683e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc896daa2, "node", 0 };
+VarInfo * __func_info__d2e1683e_fields[1] =  { &__func_info__d2e1683e_field_0 };
+FuncInfo __func_info__d2e1683e = {"invoke block<(node:regex::ReNode?):void> const", "", __func_info__d2e1683e_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xd2e1683e, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__23a62413 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x23a62413 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo * __type_info__def08656_arg_types[2] = { &__type_info__fadc0cd2, &__type_info__17c16538 };
+TypeInfo __type_info__def08656 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__def08656_arg_types, nullptr, 2, 0, nullptr, 6, 0xdef08656 };
+TypeInfo __type_info__fadc0cd2 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xfadc0cd2 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x199df2db };
+TypeInfo __type_info__90ba8218 = { Type::tStructure, &__struct_info__54d21be3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x90ba8218 };
+TypeInfo __type_info__da4cf41c = { Type::tStructure, &__struct_info__814eb49d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xda4cf41c };
+TypeInfo __type_info__2fb08994 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4cf41c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2fb08994 };
+TypeInfo __type_info__79ec5fa3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x79ec5fa3 };
+TypeInfo __type_info__e7c33a17 = { Type::tEnumeration, nullptr, &__enum_info__8d516ad4, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe7c33a17 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_4[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_5[3] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_7[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_8[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_9[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_10[2] = { &__type_info__3ffbf730, &__type_info__e7c33a17 };
+TypeInfo * __tinfo_11[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< regex::ReOp > : cast_enum < regex::ReOp > {};
+namespace {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,regex::Regex,regex::ReNode *,uint8_t * const )) fun2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==144,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==136,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_102, int32_t __offset_rename_at_102 );
+inline void _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46 ( Context * __context__, TArray<regex::ReNode *> & __a_rename_at_186 );
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  & __a_rename_at_71 );
+inline void _Funcbuiltin_0x60_push_51a9a782562eaa80 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_37, regex::ReNode * const  __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_2c5fcac663cf7939 ( Context * __context__, TArray<TTuple<16,range,char *>> & __Arr_rename_at_37, TTuple<16,range,char *> const  & __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_cb4608e1175cfa97 ( Context * __context__, TDim<regex::ReNode *,2> & __a_rename_at_298 );
+inline void debug_re_2e13921aef6c4915 ( Context * __context__, regex::ReNode * const  __node_rename_at_848, int32_t __tab_rename_at_848 );
+inline void debug_set_2bee8486efc5baef ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_839 );
+inline bool eos_e5043a1bfadf9b82 ( Context * __context__, char * const  __expr_rename_at_98, int32_t __offset_rename_at_98 );
+inline void finalize_34a3d5ec19efc0f8 ( Context * __context__, regex::ReNode * & ____this_rename_at_303 );
+inline void finalize_99d8b8a6e8d8847f ( Context * __context__, TVariant<16,regex::ReNode *,void *> & ____this_rename_at_303 );
+inline void finalize_4b5b3ac4f531983c ( Context * __context__, regex::ReNode & ____this_rename_at_23 );
+inline bool is_meta_character_b4bac6800864dee5 ( Context * __context__, int32_t __ch_rename_at_174 );
+inline bool is_set_character_7c422a785bea5d2e ( Context * __context__, int32_t __ch_rename_at_178 );
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_125 );
+inline bool is_valid_b903ff05fad46b66 ( Context * __context__, regex::Regex & __re_rename_at_748 );
+inline TVariant<16,regex::ReNode *,void *> maybe_984b4328d549f193 ( Context * __context__, regex::ReNode * const  __value_rename_at_93 );
+inline regex::ReNode * mk_concat_bbdcb54024f56b68 ( Context * __context__, regex::ReNode * __left_rename_at_331, regex::ReNode * __right_rename_at_331 );
+inline regex::ReNode * mk_union_d3d46eea9d41aee ( Context * __context__, regex::ReNode * __left_rename_at_354, regex::ReNode * __right_rename_at_354 );
+inline TVariant<16,regex::ReNode *,void *> nada_24ebaa7d6237c12e ( Context * __context__ );
+inline int32_t next_ed2c42f6e71d9107 ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  & __re_rename_at_118 );
+inline void note_fb609b665aef2329 ( Context * __context__, char * const  __msg_rename_at_69, int32_t __offset_rename_at_69 );
+inline TVariant<16,regex::ReNode *,void *> re_any_d1c11112b20d9d8a ( Context * __context__, char * const  __expr_rename_at_273, int32_t __offset_rename_at_273 );
+inline void re_assign_groups_d79bcfdca6696ebf ( Context * __context__, regex::Regex & __re_rename_at_459 );
+inline void re_assign_match_functions_87003d96082fb443 ( Context * __context__, regex::Regex & __re_rename_at_472 );
+inline void re_assign_next_e5ece72bb2e26bfd ( Context * __context__, regex::Regex & __re_rename_at_445 );
+inline TVariant<16,regex::ReNode *,void *> re_basic_b41e57f28b97c89a ( Context * __context__, char * const  __expr_rename_at_405, int32_t __offset_rename_at_405 );
+inline TVariant<16,regex::ReNode *,void *> re_char_d4c780dbba6f23e0 ( Context * __context__, char * const  __expr_rename_at_183, int32_t __offset_rename_at_183 );
+inline bool re_early_out_b3d9e6cba2d1404c ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_709, regex::ReNode * const  __node_rename_at_709 );
+inline TVariant<16,regex::ReNode *,void *> re_elementary_516fa992bc6f334 ( Context * __context__, char * const  __expr_rename_at_309, int32_t __offset_rename_at_309 );
+inline TVariant<16,regex::ReNode *,void *> re_eos_e4c7b3129b1a78c3 ( Context * __context__, char * const  __expr_rename_at_283, int32_t __offset_rename_at_283 );
+inline TVariant<16,regex::ReNode *,void *> re_group_cbd57221135d24ee ( Context * __context__, char * const  __expr_rename_at_293, int32_t __offset_rename_at_293 );
+inline uint8_t * re_match2_any_cc6fd5fe415900d0 ( Context * __context__, regex::Regex & __regex_rename_at_562, regex::ReNode * __node_rename_at_562, uint8_t * const  __str_rename_at_562 );
+inline uint8_t * re_match2_char_9e9990bc1ac5284 ( Context * __context__, regex::Regex & __regex_rename_at_521, regex::ReNode * __node_rename_at_521, uint8_t * const  __str_rename_at_521 );
+inline uint8_t * re_match2_concat_c7fe3b044b11a12 ( Context * __context__, regex::Regex & __regex_rename_at_577, regex::ReNode * __node_rename_at_577, uint8_t * const  __str_rename_at_577 );
+inline uint8_t * re_match2_eos_4c553106a86aa72a ( Context * __context__, regex::Regex & __regex_rename_at_588, regex::ReNode * __node_rename_at_588, uint8_t * const  __str_rename_at_588 );
+inline uint8_t * re_match2_group_4fef50fcef07ef6 ( Context * __context__, regex::Regex & __regex_rename_at_695, regex::ReNode * __node_rename_at_695, uint8_t * const  __str_rename_at_695 );
+inline uint8_t * re_match2_plus_ae83b0da355050f9 ( Context * __context__, regex::Regex & __regex_rename_at_616, regex::ReNode * __node_rename_at_616, uint8_t * const  __str_rename_at_616 );
+inline uint8_t * re_match2_plus_set_cf6261f9f7313b65 ( Context * __context__, regex::Regex & __regex_rename_at_641, regex::ReNode * __node_rename_at_641, uint8_t * const  __str_rename_at_641 );
+inline uint8_t * re_match2_question_23c4b87108b7d016 ( Context * __context__, regex::Regex & __regex_rename_at_601, regex::ReNode * __node_rename_at_601, uint8_t * const  __str_rename_at_601 );
+inline uint8_t * re_match2_set_7a2fc7b5818f8983 ( Context * __context__, regex::Regex & __regex_rename_at_547, regex::ReNode * __node_rename_at_547, uint8_t * const  __str_rename_at_547 );
+inline uint8_t * re_match2_single_char_40d44dcb4c4b60e0 ( Context * __context__, regex::Regex & __regex_rename_at_506, regex::ReNode * __node_rename_at_506, uint8_t * const  __str_rename_at_506 );
+inline uint8_t * re_match2_star_e627029314171e76 ( Context * __context__, regex::Regex & __regex_rename_at_672, regex::ReNode * __node_rename_at_672, uint8_t * const  __str_rename_at_672 );
+inline uint8_t * re_match2_union_311eec463d4db005 ( Context * __context__, regex::Regex & __regex_rename_at_536, regex::ReNode * __node_rename_at_536, uint8_t * const  __str_rename_at_536 );
+inline regex::ReNode * re_parse_ca3ce795963ab5e5 ( Context * __context__, char * const  __expr_rename_at_422 );
+inline TVariant<16,regex::ReNode *,void *> re_re_43df13b58032ae34 ( Context * __context__, char * const  __expr_rename_at_376, int32_t __offset_rename_at_376 );
+inline TVariant<16,regex::ReNode *,void *> re_set_87e4bfc6f6d63f91 ( Context * __context__, char * const  __expr_rename_at_247, int32_t __offset_rename_at_247 );
+inline TVariant<16,regex::ReNode *,void *> re_set_items_ae9f02db1f41117b ( Context * __context__, char * const  __expr_rename_at_207, int32_t __offset_rename_at_207 );
+inline regex::Regex regex_compile_646d4edb61acb47f ( Context * __context__, regex::Regex & __re_rename_at_767 );
+inline bool regex_compile_501be68ce327cfa0 ( Context * __context__, regex::Regex & __re_rename_at_751, char * const  __expr_rename_at_751 );
+inline regex::Regex regex_compile_ef31dd3c695567be ( Context * __context__, char * const  __expr_rename_at_761 );
+inline void regex_debug_f56a9de670083f7b ( Context * __context__, regex::Regex const  & __regex_rename_at_827 );
+inline void regex_foreach_19284c624c636c0d ( Context * __context__, regex::Regex & __regex_rename_at_790, char * const  __str_rename_at_790, Block DAS_COMMENT((bool,range)) const  & __blk_rename_at_790 );
+inline char * regex_group_142824080e38bc9 ( Context * __context__, regex::Regex const  & __regex_rename_at_785, int32_t __index_rename_at_785, char * const  __match_rename_at_785 );
+inline int32_t regex_match_3a95d7284016f622 ( Context * __context__, regex::Regex & __regex_rename_at_773, char * const  __str_rename_at_773, int32_t __offset_rename_at_773 );
+inline void set_invert_4b32fde10b9c6020 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_141 );
+inline void set_meta_ca9d28ab9ac7a054 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_156, int32_t __che_rename_at_156 );
+inline void set_negative_92d0a99efe9f2539 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_151 );
+inline void set_or_char_890ca4eb662c2e70 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_132, int32_t __ch_rename_at_132 );
+inline void set_or_range_14a99b9f3c7d1171 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_136, range __bits_rename_at_136 );
+inline void set_or_set_6b98d7be86d4da25 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_146, TDim<uint32_t,8> const  & __eset_rename_at_146 );
+inline void trace_fb609b665aef2329 ( Context * __context__, char * const  __msg_rename_at_63, int32_t __offset_rename_at_63 );
+inline void trace_backtrack_9879e3fe4fd34323 ( Context * __context__ );
+inline void trace_value_fd61f5515193b3d7 ( Context * __context__, regex::ReNode * const  __value_rename_at_80 );
+inline void visit_top_down_d1d52f47cb2c3db ( Context * __context__, regex::ReNode * __node_rename_at_433, Block DAS_COMMENT((void,regex::ReNode *)) const  & __blk_rename_at_433 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0xd44c2a60>(__context__) = false;/*log_parse_enabled*/
+	das_global<bool,0x640fb0f6>(__context__) = false;/*log_match_enabled*/
+	das_global<bool,0xf7b952ec>(__context__) = false;/*range_check_enabled*/
+	das_global<int32_t,0xc436fff8>(__context__) = 0;/*trace_tab*/
+	das_global<char *,0x2009753a>(__context__) = ((char *) "\\+-*.()[]|^");/*meta*/
+	das_global<char *,0x5902aaf7>(__context__) = ((char *) "wW");/*meta_set*/
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_102, int32_t __offset_rename_at_102 )
+{
+	return das_auto_cast<int32_t>::cast(get_character_uat(__expr_rename_at_102,__offset_rename_at_102));
+}
+
+inline void _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46 ( Context * __context__, TArray<regex::ReNode *> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<regex::ReNode *>> __aV_iterator(__a_rename_at_186);
+		regex::ReNode * * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_34a3d5ec19efc0f8(__context__,(*__aV_rename_at_188));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<regex::ReNode *>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  &  __a_rename_at_71 )
+{
+	return das_auto_cast<int32_t>::cast(2);
+}
+
+inline void _Funcbuiltin_0x60_push_51a9a782562eaa80 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_37, regex::ReNode * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_2c5fcac663cf7939 ( Context * __context__, TArray<TTuple<16,range,char *>> &  __Arr_rename_at_37, TTuple<16,range,char *> const  &  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<TTuple<16,range,char *>>>::pass(__Arr_rename_at_37),16,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_cb4608e1175cfa97 ( Context * __context__, TDim<regex::ReNode *,2> &  __a_rename_at_298 )
+{
+	TArray<regex::ReNode *> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_13e4a05653768251(__context__,das_arg<TArray<regex::ReNode *>>::pass(__arr_rename_at_299),2);
+	das_copy(das_cast<TDim<regex::ReNode *,2>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<regex::ReNode *>>::cast(__arr_rename_at_299);
+}
+
+inline void debug_re_2e13921aef6c4915 ( Context * __context__, regex::ReNode * const  __node_rename_at_848, int32_t __tab_rename_at_848 )
+{
+	builtin_print(((char *) "("),__context__);
+	if ( __node_rename_at_848 != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "#")), cast<int32_t>::from(__node_rename_at_848->id))),__context__);
+		if ( __node_rename_at_848->next != nullptr )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "->")), cast<int32_t>::from(__node_rename_at_848->next->id))),__context__);
+		} else {
+			builtin_print(((char *) "->!"),__context__);
+		};
+		builtin_print(((char *) " "),__context__);
+	};
+	if ( __node_rename_at_848 == nullptr )
+	{
+		builtin_print(((char *) "null)"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "Char `")), cast<char * const >::from(__node_rename_at_848->text), cast<char * const >::from(((char *) "`)")))),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		builtin_print(((char *) "Set "),__context__);
+		debug_set_2bee8486efc5baef(__context__,__node_rename_at_848->cset);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		builtin_print(((char *) "Any)"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		builtin_print(((char *) "Eos)"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		builtin_print(((char *) "Group "),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->subexpr,__tab_rename_at_848 + 1);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		builtin_print(((char *) "Plus "),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->subexpr,__tab_rename_at_848);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		builtin_print(((char *) "Star "),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->subexpr,__tab_rename_at_848);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		builtin_print(((char *) "Question "),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->subexpr,__tab_rename_at_848);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		builtin_print(((char *) "Contact"),__context__);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_848,__context__)))))),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->left,__tab_rename_at_848 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_4, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_848,__context__)))))),__context__);
+		debug_re_2e13921aef6c4915(__context__,__node_rename_at_848->right,__tab_rename_at_848 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_848 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else if ( __node_rename_at_848->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		builtin_print(((char *) "Union\n"),__context__);
+		{
+			bool __need_loop_894 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_848->all);
+			regex::ReNode * const  * __sub_rename_at_894;
+			__need_loop_894 = __sub_iterator.first(__context__,(__sub_rename_at_894)) && __need_loop_894;
+			for ( ; __need_loop_894 ; __need_loop_894 = __sub_iterator.next(__context__,(__sub_rename_at_894)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_848,__context__)))))),__context__);
+				debug_re_2e13921aef6c4915(__context__,(*__sub_rename_at_894),__tab_rename_at_848 + 1);
+				builtin_print(((char *) "\n"),__context__);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_894));
+		};
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_848 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else {
+		builtin_throw(((char *) "unsupported op"),__context__);
+	};
+}
+
+inline void debug_set_2bee8486efc5baef ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_839 )
+{
+	{
+		bool __need_loop_840 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,256));
+		int32_t __x_rename_at_840;
+		__need_loop_840 = __x_iterator.first(__context__,(__x_rename_at_840)) && __need_loop_840;
+		for ( ; __need_loop_840 ; __need_loop_840 = __x_iterator.next(__context__,(__x_rename_at_840)) )
+		{
+			if ( (__cset_rename_at_839((__x_rename_at_840 >> 5),__context__) & uint32_t(1 << (__x_rename_at_840 & 31))) != 0x0u )
+			{
+				if ( (__x_rename_at_840 >= 32) && (__x_rename_at_840 <= 127) )
+				{
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<char *>::from(((char *)(to_string_char(__x_rename_at_840,__context__)))))),__context__);
+				} else {
+					builtin_print(((char *) "{x}"),__context__);
+				};
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_840));
+	};
+}
+
+inline bool eos_e5043a1bfadf9b82 ( Context * __context__, char * const  __expr_rename_at_98, int32_t __offset_rename_at_98 )
+{
+	return das_auto_cast<bool>::cast(__offset_rename_at_98 >= builtin_string_length(__expr_rename_at_98,__context__));
+}
+
+inline void finalize_34a3d5ec19efc0f8 ( Context * __context__, regex::ReNode * & ____this_rename_at_303 )
+{
+	if ( ____this_rename_at_303 != nullptr )
+	{
+		finalize_4b5b3ac4f531983c(__context__,das_arg<regex::ReNode>::pass(das_deref(__context__,____this_rename_at_303)));
+		das_delete<regex::ReNode *>::clear(__context__,____this_rename_at_303);
+		das_copy(____this_rename_at_303,nullptr);
+	};
+}
+
+inline void finalize_99d8b8a6e8d8847f ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ____this_rename_at_303 )
+{
+	if ( das_get_variant_field<regex::ReNode *,8,0>::is(____this_rename_at_303) )
+	{
+		finalize_34a3d5ec19efc0f8(__context__,das_get_variant_field<regex::ReNode *,8,0>::get(____this_rename_at_303));
+	};
+	memset(&(____this_rename_at_303), 0, 16);
+}
+
+inline void finalize_4b5b3ac4f531983c ( Context * __context__, regex::ReNode &  ____this_rename_at_23 )
+{
+	_Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46(__context__,das_arg<TArray<regex::ReNode *>>::pass(____this_rename_at_23.all));
+	finalize_34a3d5ec19efc0f8(__context__,____this_rename_at_23.left);
+	finalize_34a3d5ec19efc0f8(__context__,____this_rename_at_23.right);
+	finalize_34a3d5ec19efc0f8(__context__,____this_rename_at_23.subexpr);
+	finalize_34a3d5ec19efc0f8(__context__,____this_rename_at_23.next);
+	memset(&(____this_rename_at_23), 0, 144);
+}
+
+inline bool is_meta_character_b4bac6800864dee5 ( Context * __context__, int32_t __ch_rename_at_174 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_174,__context__) != -1);
+}
+
+inline bool is_set_character_7c422a785bea5d2e ( Context * __context__, int32_t __ch_rename_at_178 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "wW"),__ch_rename_at_178,__context__) != -1);
+}
+
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_125 )
+{
+	{
+		bool __need_loop_126 = true;
+		// x : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __x_iterator(__cset_rename_at_125);
+		uint32_t const  * __x_rename_at_126;
+		__need_loop_126 = __x_iterator.first(__context__,(__x_rename_at_126)) && __need_loop_126;
+		for ( ; __need_loop_126 ; __need_loop_126 = __x_iterator.next(__context__,(__x_rename_at_126)) )
+		{
+			if ( (*__x_rename_at_126) != 0x0u )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_126));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool is_valid_b903ff05fad46b66 ( Context * __context__, regex::Regex &  __re_rename_at_748 )
+{
+	return das_auto_cast<bool>::cast(__re_rename_at_748.root != nullptr);
+}
+
+inline TVariant<16,regex::ReNode *,void *> maybe_984b4328d549f193 ( Context * __context__, regex::ReNode * const  __value_rename_at_93 )
+{
+	return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_95;
+		das_get_variant_field<regex::ReNode *,8,0>::set(__mkv_95) = __value_rename_at_93;
+		return __mkv_95;
+	})()));
+}
+
+inline regex::ReNode * mk_concat_bbdcb54024f56b68 ( Context * __context__, regex::ReNode * __left_rename_at_331, regex::ReNode * __right_rename_at_331 )
+{
+	if ( __left_rename_at_331 == nullptr )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_331);
+	} else if ( (__left_rename_at_331->op == DAS_COMMENT(enum) regex::ReOp::Char) && (__right_rename_at_331->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_331->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_331->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__left_rename_at_331->text),cast<char *>::from(__right_rename_at_331->text),*__context__);
+		__left_rename_at_331->textLen += __right_rename_at_331->textLen;
+		finalize_34a3d5ec19efc0f8(__context__,__right_rename_at_331);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_331);
+	} else if ( ((__left_rename_at_331->op == DAS_COMMENT(enum) regex::ReOp::Concat) && (__left_rename_at_331->right->op == DAS_COMMENT(enum) regex::ReOp::Char)) && (__right_rename_at_331->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		regex::ReNode * __lor_rename_at_343 = __left_rename_at_331->right;
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_331->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_331->at) /*y*/);
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__lor_rename_at_343->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_331->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__lor_rename_at_343->text),cast<char *>::from(__right_rename_at_331->text),*__context__);
+		__lor_rename_at_343->textLen += __right_rename_at_331->textLen;
+		finalize_34a3d5ec19efc0f8(__context__,__right_rename_at_331);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_331);
+	} else {
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_351;
+			das_zero(__mks_351);
+			das_copy((__mks_351.op),(DAS_COMMENT(enum) regex::ReOp::Concat));
+			das_copy((__mks_351.left),(__left_rename_at_331));
+			das_copy((__mks_351.right),(__right_rename_at_331));
+			das_copy((__mks_351.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_331->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_331->at)) /*y*/)));
+			return __mks_351;
+		})())));
+	};
+}
+
+inline regex::ReNode * mk_union_d3d46eea9d41aee ( Context * __context__, regex::ReNode * __left_rename_at_354, regex::ReNode * __right_rename_at_354 )
+{
+	if ( __left_rename_at_354->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_354->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_354->at) /*y*/);
+		if ( __right_rename_at_354->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_358 = true;
+				// x : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __x_iterator(__right_rename_at_354->all);
+				regex::ReNode * * __x_rename_at_358;
+				__need_loop_358 = __x_iterator.first(__context__,(__x_rename_at_358)) && __need_loop_358;
+				for ( ; __need_loop_358 ; __need_loop_358 = __x_iterator.next(__context__,(__x_rename_at_358)) )
+				{
+					_Funcbuiltin_0x60_push_51a9a782562eaa80(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_354->all),(*__x_rename_at_358));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_358));
+			};
+			finalize_34a3d5ec19efc0f8(__context__,__right_rename_at_354);
+		} else {
+			_Funcbuiltin_0x60_push_51a9a782562eaa80(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_354->all),__right_rename_at_354);
+		};
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_354);
+	} else if ( __right_rename_at_354->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__right_rename_at_354->at) /*x*/,das_swizzle_ref<int32_t,range,0>::swizzle(__left_rename_at_354->at) /*x*/);
+		_Funcbuiltin_0x60_push_51a9a782562eaa80(__context__,das_arg<TArray<regex::ReNode *>>::pass(__right_rename_at_354->all),__left_rename_at_354);
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_354);
+	} else {
+		TDim<regex::ReNode *,2> _temp_make_local_369_64;
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_369;
+			das_zero(__mks_369);
+			das_copy((__mks_369.op),(DAS_COMMENT(enum) regex::ReOp::Union));
+			das_move((__mks_369.all),(_Funcbuiltin_0x60_to_array_move_cb4608e1175cfa97(__context__,das_arg<TDim<regex::ReNode *,2>>::pass((([&]() -> TDim<regex::ReNode *,2>& {
+				_temp_make_local_369_64(0,__context__) = __left_rename_at_354;
+				_temp_make_local_369_64(1,__context__) = __right_rename_at_354;
+				return _temp_make_local_369_64;
+			})())))));
+			das_copy((__mks_369.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_354->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_354->at)) /*y*/)));
+			return __mks_369;
+		})())));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> nada_24ebaa7d6237c12e ( Context * __context__ )
+{
+	return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_90;
+		das_get_variant_field<void *,8,1>::set(__mkv_90) = nullptr;
+		return __mkv_90;
+	})()));
+}
+
+inline int32_t next_ed2c42f6e71d9107 ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  __re_rename_at_118 )
+{
+	if ( !das_get_variant_field<regex::ReNode *,8,0>::is(__re_rename_at_118) )
+	{
+		builtin_stackwalk(true,true,__context__,nullptr);
+		builtin_throw(((char *) "expecting value"),__context__);
+	};
+	return das_auto_cast<int32_t>::cast(v_extract_yi(v_cast_vec4i(das_get_variant_field<regex::ReNode *,8,0>::as(__re_rename_at_118,__context__)->at)) /*y*/);
+}
+
+inline void note_fb609b665aef2329 ( Context * __context__, char * const  __msg_rename_at_69, int32_t __offset_rename_at_69 )
+{
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_any_d1c11112b20d9d8a ( Context * __context__, char * const  __expr_rename_at_273, int32_t __offset_rename_at_273 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_276_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_278_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_279_80;
+	return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(eos_e5043a1bfadf9b82(__context__,__expr_rename_at_273,__offset_rename_at_273) ? das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_276_32 = (nada_24ebaa7d6237c12e(__context__)))) : das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_273,__offset_rename_at_273) == 46) ? das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_278_48 = (maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_278;
+		das_zero(__mks_278);
+		das_copy((__mks_278.op),(DAS_COMMENT(enum) regex::ReOp::Any));
+		das_copy((__mks_278.at),(range(__offset_rename_at_273,__offset_rename_at_273 + 1)));
+		return __mks_278;
+	})())))))) : das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_279_80 = (nada_24ebaa7d6237c12e(__context__)))))));
+}
+
+inline void re_assign_groups_d79bcfdca6696ebf ( Context * __context__, regex::Regex &  __re_rename_at_459 ) { das_stack_prologue __prologue(__context__,144,"re_assign_groups " DAS_FILE_LINE);
+{
+	TTuple<16,range,char *> _temp_make_local_460_32;
+	_Funcbuiltin_0x60_push_2c5fcac663cf7939(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_459.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+		das_get_tuple_field<range,0>::get(_temp_make_local_460_32) = range(0,0);
+		das_get_tuple_field<char *,8>::get(_temp_make_local_460_32) = ((char *) "");
+		return _temp_make_local_460_32;
+	})())));
+	visit_top_down_d1d52f47cb2c3db(__context__,__re_rename_at_459.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__d2e1683e,[&](regex::ReNode * __node_rename_at_461)->void{
+		if ( __node_rename_at_461->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			TTuple<16,range,char *> _temp_make_local_465_128;
+			int32_t __index_rename_at_463 = ((int32_t)builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_459.groups)));
+			das_copy(__node_rename_at_461->index,__index_rename_at_463);
+			_Funcbuiltin_0x60_push_2c5fcac663cf7939(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_459.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+				das_get_tuple_field<range,0>::get(_temp_make_local_465_128) = range(0,0);
+				das_get_tuple_field<char *,8>::get(_temp_make_local_465_128) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_9, cast<int32_t>::from(__index_rename_at_463)));
+				return _temp_make_local_465_128;
+			})())));
+		};
+	}));
+}}
+
+inline void re_assign_match_functions_87003d96082fb443 ( Context * __context__, regex::Regex &  __re_rename_at_472 ) { das_stack_prologue __prologue(__context__,96,"re_assign_match_functions " DAS_FILE_LINE);
+{
+	visit_top_down_d1d52f47cb2c3db(__context__,__re_rename_at_472.root,das_make_block<void,regex::ReNode *>(__context__,80,0,&__func_info__d2e1683e,[&](regex::ReNode * __node_rename_at_473)->void{
+		if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Char )
+		{
+			if ( __node_rename_at_473->textLen == 1 )
+			{
+				das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_single_char Regex #ptr#ReNode #ptr#uint8#const*/ 3226839771u)));
+			} else {
+				das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_char Regex #ptr#ReNode #ptr#uint8#const*/ 3089601592u)));
+			};
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_union Regex #ptr#ReNode #ptr#uint8#const*/ 1207848181u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Set )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_set Regex #ptr#ReNode #ptr#uint8#const*/ 2850924220u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Any )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_any Regex #ptr#ReNode #ptr#uint8#const*/ 657129790u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_eos Regex #ptr#ReNode #ptr#uint8#const*/ 2101372619u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_concat Regex #ptr#ReNode #ptr#uint8#const*/ 1497369900u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+		{
+			if ( __node_rename_at_473->subexpr->op == DAS_COMMENT(enum) regex::ReOp::Set )
+			{
+				das_copy(__node_rename_at_473->cset,__node_rename_at_473->subexpr->cset);
+				das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus_set Regex #ptr#ReNode #ptr#uint8#const*/ 3835863389u)));
+			} else {
+				das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus Regex #ptr#ReNode #ptr#uint8#const*/ 3049769048u)));
+			};
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_plus Regex #ptr#ReNode #ptr#uint8#const*/ 3049769048u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Star )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_star Regex #ptr#ReNode #ptr#uint8#const*/ 2464857604u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Question )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_question Regex #ptr#ReNode #ptr#uint8#const*/ 134306708u)));
+		} else if ( __node_rename_at_473->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_473->fun2,Func(__context__->fnIdxByMangledName(/*@regex::re_match2_group Regex #ptr#ReNode #ptr#uint8#const*/ 3941244897u)));
+		} else {
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(enum) regex::ReOp>::from(__node_rename_at_473->op))),__context__);
+		};
+	}));
+}}
+
+inline void re_assign_next_e5ece72bb2e26bfd ( Context * __context__, regex::Regex &  __re_rename_at_445 ) { das_stack_prologue __prologue(__context__,128,"re_assign_next " DAS_FILE_LINE);
+{
+	int32_t __id_rename_at_446 = 0;
+	visit_top_down_d1d52f47cb2c3db(__context__,__re_rename_at_445.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__d2e1683e,[&](regex::ReNode * __node_rename_at_447)->void{
+		das_copy(__node_rename_at_447->id,__id_rename_at_446++);
+		if ( __node_rename_at_447->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_447->left->next,__node_rename_at_447->right);
+			das_copy(__node_rename_at_447->right->next,__node_rename_at_447->next);
+		} else if ( __node_rename_at_447->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_447->subexpr->next,__node_rename_at_447->next);
+		} else if ( __node_rename_at_447->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_455 = true;
+				// sub : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_447->all);
+				regex::ReNode * * __sub_rename_at_455;
+				__need_loop_455 = __sub_iterator.first(__context__,(__sub_rename_at_455)) && __need_loop_455;
+				for ( ; __need_loop_455 ; __need_loop_455 = __sub_iterator.next(__context__,(__sub_rename_at_455)) )
+				{
+					das_copy((*__sub_rename_at_455)->next,__node_rename_at_447->next);
+				}
+				__sub_iterator.close(__context__,(__sub_rename_at_455));
+			};
+		};
+	}));
+}}
+
+inline TVariant<16,regex::ReNode *,void *> re_basic_b41e57f28b97c89a ( Context * __context__, char * const  __expr_rename_at_405, int32_t __offset_rename_at_405 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_405,__offset_rename_at_405) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __oelem_rename_at_409 = re_elementary_516fa992bc6f334(__context__,__expr_rename_at_405,__offset_rename_at_405);
+		if ( das_get_variant_field<void *,8,1>::is(__oelem_rename_at_409) )
+		{
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+		} else {
+			int32_t __ch_rename_at_412 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_405,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_409))));
+			if ( __ch_rename_at_412 == 42 )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_414;
+					das_zero(__mks_414);
+					das_copy((__mks_414.op),(DAS_COMMENT(enum) regex::ReOp::Star));
+					das_copy((__mks_414.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_409,__context__)));
+					das_copy((__mks_414.at),(range(__offset_rename_at_405,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_409)) + 1)));
+					return __mks_414;
+				})()))));
+			} else if ( __ch_rename_at_412 == 43 )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_416;
+					das_zero(__mks_416);
+					das_copy((__mks_416.op),(DAS_COMMENT(enum) regex::ReOp::Plus));
+					das_copy((__mks_416.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_409,__context__)));
+					das_copy((__mks_416.at),(range(__offset_rename_at_405,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_409)) + 1)));
+					return __mks_416;
+				})()))));
+			} else if ( __ch_rename_at_412 == 63 )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_418;
+					das_zero(__mks_418);
+					das_copy((__mks_418.op),(DAS_COMMENT(enum) regex::ReOp::Question));
+					das_copy((__mks_418.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_409,__context__)));
+					das_copy((__mks_418.at),(range(__offset_rename_at_405,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_409)) + 1)));
+					return __mks_418;
+				})()))));
+			};
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__oelem_rename_at_409);
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_char_d4c780dbba6f23e0 ( Context * __context__, char * const  __expr_rename_at_183, int32_t __offset_rename_at_183 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_183,__offset_rename_at_183) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		int32_t __ch_rename_at_187 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_183,__offset_rename_at_183));
+		if ( __ch_rename_at_187 == 92 )
+		{
+			int32_t __ech_rename_at_189 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_183,__offset_rename_at_183 + 1));
+			if ( __ech_rename_at_189 == 0 )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+			} else {
+				if ( is_set_character_7c422a785bea5d2e(__context__,__ech_rename_at_189) )
+				{
+					TDim<uint32_t,8> __cset_rename_at_194; das_zero(__cset_rename_at_194);
+					set_meta_ca9d28ab9ac7a054(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_194),__ech_rename_at_189);
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_196;
+						das_zero(__mks_196);
+						das_copy((__mks_196.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+						das_copy((__mks_196.cset),(__cset_rename_at_194));
+						das_copy((__mks_196.at),(range(__offset_rename_at_183,__offset_rename_at_183 + 2)));
+						return __mks_196;
+					})()))));
+				} else {
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_197;
+						das_zero(__mks_197);
+						das_copy((__mks_197.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+						das_copy((__mks_197.text),(((char *)(to_string_char(__ech_rename_at_189,__context__)))));
+						das_copy((__mks_197.textLen),(1));
+						das_copy((__mks_197.at),(range(__offset_rename_at_183,__offset_rename_at_183 + 2)));
+						return __mks_197;
+					})()))));
+				};
+			};
+		} else if ( is_meta_character_b4bac6800864dee5(__context__,__ch_rename_at_187) )
+		{
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+		};
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_200;
+			das_zero(__mks_200);
+			das_copy((__mks_200.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+			das_copy((__mks_200.text),(((char *)(to_string_char(__ch_rename_at_187,__context__)))));
+			das_copy((__mks_200.textLen),(1));
+			das_copy((__mks_200.at),(range(__offset_rename_at_183,__offset_rename_at_183 + 1)));
+			return __mks_200;
+		})()))));
+	};
+}
+
+inline bool re_early_out_b3d9e6cba2d1404c ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_709, regex::ReNode * const  __node_rename_at_709 )
+{
+	if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		set_or_char_890ca4eb662c2e70(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),get_character_at(__node_rename_at_709->text,0,__context__));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		set_or_set_6b98d7be86d4da25(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->cset);
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		{
+			bool __need_loop_717 = true;
+			// x : uint aka CharSet& -const
+			das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_709);
+			uint32_t * __x_rename_at_717;
+			__need_loop_717 = __x_iterator.first(__context__,(__x_rename_at_717)) && __need_loop_717;
+			for ( ; __need_loop_717 ; __need_loop_717 = __x_iterator.next(__context__,(__x_rename_at_717)) )
+			{
+				das_copy((*__x_rename_at_717),0xffffffffu);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_717));
+		};
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->subexpr));
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->subexpr));
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		bool __left_rename_at_733 = ((bool)re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->left));
+		return das_auto_cast<bool>::cast(__left_rename_at_733 ? das_auto_cast<bool>::cast(re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),__node_rename_at_709->right)) : das_auto_cast<bool>::cast(false));
+	} else if ( __node_rename_at_709->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		bool __any_rename_at_736 = false;
+		{
+			bool __need_loop_737 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_709->all);
+			regex::ReNode * const  * __sub_rename_at_737;
+			__need_loop_737 = __sub_iterator.first(__context__,(__sub_rename_at_737)) && __need_loop_737;
+			for ( ; __need_loop_737 ; __need_loop_737 = __sub_iterator.next(__context__,(__sub_rename_at_737)) )
+			{
+				das_copy(__any_rename_at_736,re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_709),(*__sub_rename_at_737)) || __any_rename_at_736);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_737));
+		};
+		return das_auto_cast<bool>::cast(__any_rename_at_736);
+	} else {
+		builtin_throw(((char *) "unsupported operation"),__context__);
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_elementary_516fa992bc6f334 ( Context * __context__, char * const  __expr_rename_at_309, int32_t __offset_rename_at_309 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_309,__offset_rename_at_309) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __ogr_rename_at_313 = re_group_cbd57221135d24ee(__context__,__expr_rename_at_309,__offset_rename_at_309);
+		if ( das_get_variant_field<regex::ReNode *,8,0>::is(__ogr_rename_at_313) )
+		{
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__ogr_rename_at_313);
+		} else {
+			TVariant<16,regex::ReNode *,void *> __oany_rename_at_316 = re_any_d1c11112b20d9d8a(__context__,__expr_rename_at_309,__offset_rename_at_309);
+			if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oany_rename_at_316) )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__oany_rename_at_316);
+			} else {
+				TVariant<16,regex::ReNode *,void *> __oeos_rename_at_319 = re_eos_e4c7b3129b1a78c3(__context__,__expr_rename_at_309,__offset_rename_at_309);
+				if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oeos_rename_at_319) )
+				{
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__oeos_rename_at_319);
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oset_rename_at_322 = re_set_87e4bfc6f6d63f91(__context__,__expr_rename_at_309,__offset_rename_at_309);
+					if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oset_rename_at_322) )
+					{
+						return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_322);
+					} else {
+						TVariant<16,regex::ReNode *,void *> _temp_make_local_328_112;
+						TVariant<16,regex::ReNode *,void *> __ochr_rename_at_325 = re_char_d4c780dbba6f23e0(__context__,__expr_rename_at_309,__offset_rename_at_309);
+						return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(das_get_variant_field<regex::ReNode *,8,0>::is(__ochr_rename_at_325) ? das_auto_cast<TVariant<16,regex::ReNode *,void *> &>::cast(__ochr_rename_at_325) : das_auto_cast<TVariant<16,regex::ReNode *,void *> &>::cast((_temp_make_local_328_112 = (nada_24ebaa7d6237c12e(__context__)))));
+					};
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_eos_e4c7b3129b1a78c3 ( Context * __context__, char * const  __expr_rename_at_283, int32_t __offset_rename_at_283 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_286_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_288_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_289_80;
+	return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(eos_e5043a1bfadf9b82(__context__,__expr_rename_at_283,__offset_rename_at_283) ? das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_286_32 = (nada_24ebaa7d6237c12e(__context__)))) : das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(((at_c9bade5ff7edd57d(__context__,__expr_rename_at_283,__offset_rename_at_283) == 36) ? das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_288_48 = (maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_288;
+		das_zero(__mks_288);
+		das_copy((__mks_288.op),(DAS_COMMENT(enum) regex::ReOp::Eos));
+		das_copy((__mks_288.at),(range(__offset_rename_at_283,__offset_rename_at_283 + 1)));
+		return __mks_288;
+	})())))))) : das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_289_80 = (nada_24ebaa7d6237c12e(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_group_cbd57221135d24ee ( Context * __context__, char * const  __expr_rename_at_293, int32_t __offset_rename_at_293 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_293,__offset_rename_at_293) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_293,__offset_rename_at_293) != 40 )
+		{
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+		} else {
+			TVariant<16,regex::ReNode *,void *> __ore_rename_at_299 = re_re_43df13b58032ae34(__context__,__expr_rename_at_293,__offset_rename_at_293 + 1);
+			if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_299) )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_293,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_299))) != 41 )
+				{
+					finalize_99d8b8a6e8d8847f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_299));
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				} else {
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_305;
+						das_zero(__mks_305);
+						das_copy((__mks_305.op),(DAS_COMMENT(enum) regex::ReOp::Group));
+						das_copy((__mks_305.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_299,__context__)));
+						das_copy((__mks_305.at),(range(__offset_rename_at_293,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_299)) + 1)));
+						return __mks_305;
+					})()))));
+				};
+			};
+		};
+	};
+}
+
+inline uint8_t * re_match2_any_cc6fd5fe415900d0 ( Context * __context__, regex::Regex &  __regex_rename_at_562, regex::ReNode * __node_rename_at_562, uint8_t * const  __str_rename_at_562 )
+{
+	if ( int32_t((*(__str_rename_at_562))) == 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_568 = das_ptr_add(__str_rename_at_562,1,1);
+		das_copy(__node_rename_at_562->tail,__tail_rename_at_568);
+		regex::ReNode * __node2_rename_at_570 = __node_rename_at_562->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_570 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_570->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_562),__node2_rename_at_570,__tail_rename_at_568)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_568));
+	};
+}
+
+inline uint8_t * re_match2_char_9e9990bc1ac5284 ( Context * __context__, regex::Regex &  __regex_rename_at_521, regex::ReNode * __node_rename_at_521, uint8_t * const  __str_rename_at_521 )
+{
+	if ( das_memcmp(das_auto_cast<void * const >::cast(das_cast<uint8_t *>::cast(__node_rename_at_521->text)),das_auto_cast<void * const >::cast(__str_rename_at_521),__node_rename_at_521->textLen) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_527 = das_ptr_add(__str_rename_at_521,__node_rename_at_521->textLen,1);
+		das_copy(__node_rename_at_521->tail,__tail_rename_at_527);
+		regex::ReNode * __node2_rename_at_529 = __node_rename_at_521->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_529 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_529->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_521),__node2_rename_at_529,__tail_rename_at_527)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_527));
+	};
+}
+
+inline uint8_t * re_match2_concat_c7fe3b044b11a12 ( Context * __context__, regex::Regex &  __regex_rename_at_577, regex::ReNode * __node_rename_at_577, uint8_t * const  __str_rename_at_577 )
+{
+	regex::ReNode * __left_rename_at_580 = __node_rename_at_577->left;
+	uint8_t * __oleft_rename_at_581 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,__left_rename_at_580->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_577),__left_rename_at_580,__str_rename_at_577));
+	if ( __oleft_rename_at_581 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_577->tail,__node_rename_at_577->right->tail);
+		return das_auto_cast<uint8_t *>::cast(__oleft_rename_at_581);
+	};
+}
+
+inline uint8_t * re_match2_eos_4c553106a86aa72a ( Context * __context__, regex::Regex &  __regex_rename_at_588, regex::ReNode * __node_rename_at_588, uint8_t * const  __str_rename_at_588 )
+{
+	if ( int32_t((*(__str_rename_at_588))) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_588->tail,__str_rename_at_588);
+		regex::ReNode * __node2_rename_at_594 = __node_rename_at_588->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_594 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,__node2_rename_at_594->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_588),__node2_rename_at_594,__str_rename_at_588)) : das_auto_cast<uint8_t *>::cast(__str_rename_at_588));
+	};
+}
+
+inline uint8_t * re_match2_group_4fef50fcef07ef6 ( Context * __context__, regex::Regex &  __regex_rename_at_695, regex::ReNode * __node_rename_at_695, uint8_t * const  __str_rename_at_695 )
+{
+	regex::ReNode * __nsub_rename_at_698 = __node_rename_at_695->subexpr;
+	uint8_t * __osub_rename_at_699 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_698->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_695),__nsub_rename_at_698,__str_rename_at_695));
+	if ( __osub_rename_at_699 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_695.groups(__node_rename_at_695->index,__context__)),range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__str_rename_at_695),das_auto_cast<void * const >::cast(__regex_rename_at_695.match),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__node_rename_at_695->subexpr->tail),das_auto_cast<void * const >::cast(__regex_rename_at_695.match),1))));
+		return das_auto_cast<uint8_t *>::cast(__osub_rename_at_699);
+	};
+}
+
+inline uint8_t * re_match2_plus_ae83b0da355050f9 ( Context * __context__, regex::Regex &  __regex_rename_at_616, regex::ReNode * __node_rename_at_616, uint8_t * const  __str_rename_at_616 )
+{
+	regex::ReNode * __nsub_rename_at_619 = __node_rename_at_616->subexpr;
+	uint8_t * __osym_rename_at_620 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_619->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_616),__nsub_rename_at_619,__str_rename_at_616);
+	if ( __osym_rename_at_620 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_623 = __osym_rename_at_620;
+		regex::ReNode * __node2_rename_at_624 = __node_rename_at_616->next;
+		if ( __node2_rename_at_624 != nullptr )
+		{
+			while ( __osym_rename_at_620 != nullptr )
+			{
+				das_copy(__node_rename_at_616->tail,__osym_rename_at_620);
+				uint8_t * __otail_rename_at_628 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_624->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_616),__node2_rename_at_624,__osym_rename_at_620);
+				if ( __otail_rename_at_628 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_628);
+				} else {
+					das_copy(__osym_rename_at_620,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_619->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_616),__nsub_rename_at_619,__osym_rename_at_620));
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_620 != nullptr )
+			{
+				das_copy(__ofs_rename_at_623,__osym_rename_at_620);
+				das_copy(__osym_rename_at_620,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_619->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_616),__nsub_rename_at_619,__ofs_rename_at_623));
+			};
+			das_copy(__node_rename_at_616->tail,__ofs_rename_at_623);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_623);
+		};
+	};
+}
+
+inline uint8_t * re_match2_plus_set_cf6261f9f7313b65 ( Context * __context__, regex::Regex &  __regex_rename_at_641, regex::ReNode * __node_rename_at_641, uint8_t * const  __str_rename_at_641 )
+{
+	builtin_throw(((char *) "oi"),__context__);
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_641))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_641->cset)) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_649 = das_ptr_add(__str_rename_at_641,1,1);
+		uint8_t * __osym_rename_at_650 = __ofs_rename_at_649;
+		regex::ReNode * __node2_rename_at_651 = __node_rename_at_641->next;
+		if ( __node2_rename_at_651 != nullptr )
+		{
+			while ( __osym_rename_at_650 != nullptr )
+			{
+				das_copy(__node_rename_at_641->tail,__osym_rename_at_650);
+				uint8_t * __otail_rename_at_655 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_651->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_641),__node2_rename_at_651,__osym_rename_at_650);
+				if ( __otail_rename_at_655 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_655);
+				} else {
+					if ( !is_char_in_set(int32_t((*(__osym_rename_at_650))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_641->cset)) )
+					{
+						return das_auto_cast<uint8_t *>::cast(nullptr);
+					} else {
+						das_ptr_inc(__osym_rename_at_650,1);
+					};
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_650 != nullptr )
+			{
+				das_copy(__ofs_rename_at_649,__osym_rename_at_650);
+				if ( !is_char_in_set(int32_t((*(__osym_rename_at_650))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_641->cset)) )
+				{
+					break;
+				} else {
+					das_ptr_inc(__osym_rename_at_650,1);
+				};
+			};
+			das_copy(__node_rename_at_641->tail,__ofs_rename_at_649);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_649);
+		};
+	};
+}
+
+inline uint8_t * re_match2_question_23c4b87108b7d016 ( Context * __context__, regex::Regex &  __regex_rename_at_601, regex::ReNode * __node_rename_at_601, uint8_t * const  __str_rename_at_601 )
+{
+	regex::ReNode * __nsub_rename_at_604 = __node_rename_at_601->subexpr;
+	uint8_t * __tail_rename_at_605 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,__nsub_rename_at_604->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_601),__nsub_rename_at_604,__str_rename_at_601);
+	if ( __tail_rename_at_605 == nullptr )
+	{
+		das_copy(__tail_rename_at_605,__str_rename_at_601);
+	};
+	das_copy(__node_rename_at_601->tail,__tail_rename_at_605);
+	regex::ReNode * __node2_rename_at_609 = __node_rename_at_601->next;
+	return das_auto_cast<uint8_t *>::cast((__node2_rename_at_609 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_609->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_601),__node2_rename_at_609,__tail_rename_at_605)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_605));
+}
+
+inline uint8_t * re_match2_set_7a2fc7b5818f8983 ( Context * __context__, regex::Regex &  __regex_rename_at_547, regex::ReNode * __node_rename_at_547, uint8_t * const  __str_rename_at_547 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_547))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_547->cset)) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_553 = das_ptr_add(__str_rename_at_547,1,1);
+		das_copy(__node_rename_at_547->tail,__tail_rename_at_553);
+		regex::ReNode * __node2_rename_at_555 = __node_rename_at_547->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_555 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_555->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_547),__node2_rename_at_555,__tail_rename_at_553)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_553));
+	};
+}
+
+inline uint8_t * re_match2_single_char_40d44dcb4c4b60e0 ( Context * __context__, regex::Regex &  __regex_rename_at_506, regex::ReNode * __node_rename_at_506, uint8_t * const  __str_rename_at_506 )
+{
+	if ( get_character_uat(__node_rename_at_506->text,0) != int32_t((*(__str_rename_at_506))) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_512 = das_ptr_add(__str_rename_at_506,1,1);
+		das_copy(__node_rename_at_506->tail,__tail_rename_at_512);
+		regex::ReNode * __node2_rename_at_514 = __node_rename_at_506->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_514 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_514->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_506),__node2_rename_at_514,__tail_rename_at_512)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_512));
+	};
+}
+
+inline uint8_t * re_match2_star_e627029314171e76 ( Context * __context__, regex::Regex &  __regex_rename_at_672, regex::ReNode * __node_rename_at_672, uint8_t * const  __str_rename_at_672 )
+{
+	uint8_t * __ofs_rename_at_675 = __str_rename_at_672;
+	regex::ReNode * __node2_rename_at_676 = __node_rename_at_672->next;
+	regex::ReNode * __nsub_rename_at_677 = __node_rename_at_672->subexpr;
+	if ( __node2_rename_at_676 != nullptr )
+	{
+		while ( __ofs_rename_at_675 != nullptr )
+		{
+			das_copy(__node_rename_at_672->tail,__ofs_rename_at_675);
+			uint8_t * __oany_rename_at_681 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__node2_rename_at_676->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_672),__node2_rename_at_676,__ofs_rename_at_675));
+			if ( __oany_rename_at_681 != nullptr )
+			{
+				return das_auto_cast<uint8_t *>::cast(__oany_rename_at_681);
+			} else {
+				das_copy(__ofs_rename_at_675,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_677->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_672),__nsub_rename_at_677,__ofs_rename_at_675));
+			};
+		};
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __osym_rename_at_687 = __ofs_rename_at_675;
+		while ( __osym_rename_at_687 != nullptr )
+		{
+			das_copy(__ofs_rename_at_675,__osym_rename_at_687);
+			das_copy(__osym_rename_at_687,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__nsub_rename_at_677->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_672),__nsub_rename_at_677,__ofs_rename_at_675));
+		};
+		das_copy(__node_rename_at_672->tail,__ofs_rename_at_675);
+		return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_675);
+	};
+}
+
+inline uint8_t * re_match2_union_311eec463d4db005 ( Context * __context__, regex::Regex &  __regex_rename_at_536, regex::ReNode * __node_rename_at_536, uint8_t * const  __str_rename_at_536 )
+{
+	{
+		bool __need_loop_539 = true;
+		// sub : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_536->all);
+		regex::ReNode * * __sub_rename_at_539;
+		__need_loop_539 = __sub_iterator.first(__context__,(__sub_rename_at_539)) && __need_loop_539;
+		for ( ; __need_loop_539 ; __need_loop_539 = __sub_iterator.next(__context__,(__sub_rename_at_539)) )
+		{
+			uint8_t * __osub_rename_at_540 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,(*__sub_rename_at_539)->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_536),(*__sub_rename_at_539),__str_rename_at_536));
+			if ( __osub_rename_at_540 != nullptr )
+			{
+				das_copy(__node_rename_at_536->tail,(*__sub_rename_at_539)->tail);
+				return das_auto_cast<uint8_t *>::cast(__osub_rename_at_540);
+			};
+		}
+		__sub_iterator.close(__context__,(__sub_rename_at_539));
+	};
+	return das_auto_cast<uint8_t *>::cast(nullptr);
+}
+
+inline regex::ReNode * re_parse_ca3ce795963ab5e5 ( Context * __context__, char * const  __expr_rename_at_422 )
+{
+	TVariant<16,regex::ReNode *,void *> __ore_rename_at_423 = re_re_43df13b58032ae34(__context__,__expr_rename_at_422,0);
+	if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_423) )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(nullptr);
+	} else {
+		int32_t __at_rename_at_426 = ((int32_t)next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_423)));
+		return das_auto_cast<regex::ReNode *>::cast((__at_rename_at_426 != builtin_string_length(__expr_rename_at_422,__context__)) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_423,__context__)));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_re_43df13b58032ae34 ( Context * __context__, char * const  __expr_rename_at_376, int32_t __offset_rename_at_376 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_376,__offset_rename_at_376) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		int32_t __cofs_rename_at_380 = __offset_rename_at_376;
+		regex::ReNode * __last_rename_at_381 = 0;
+		while ( !eos_e5043a1bfadf9b82(__context__,__expr_rename_at_376,__cofs_rename_at_380) )
+		{
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_376,__cofs_rename_at_380) == 124 )
+			{
+				if ( __last_rename_at_381 == nullptr )
+				{
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oright_rename_at_387 = re_re_43df13b58032ae34(__context__,__expr_rename_at_376,__cofs_rename_at_380 + 1);
+					if ( das_get_variant_field<void *,8,1>::is(__oright_rename_at_387) )
+					{
+						return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+					} else {
+						das_copy(__last_rename_at_381,mk_union_d3d46eea9d41aee(__context__,__last_rename_at_381,das_get_variant_field<regex::ReNode *,8,0>::as(__oright_rename_at_387,__context__)));
+						das_copy(__cofs_rename_at_380,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_381->at) /*y*/);
+					};
+				};
+			} else {
+				TVariant<16,regex::ReNode *,void *> __onext_rename_at_394 = re_basic_b41e57f28b97c89a(__context__,__expr_rename_at_376,__cofs_rename_at_380);
+				if ( das_get_variant_field<void *,8,1>::is(__onext_rename_at_394) )
+				{
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_396_96;
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_396_112;
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((__last_rename_at_381 == nullptr) ? das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_396_96 = (nada_24ebaa7d6237c12e(__context__)))) : das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_396_112 = (maybe_984b4328d549f193(__context__,__last_rename_at_381)))));
+				} else {
+					das_copy(__last_rename_at_381,mk_concat_bbdcb54024f56b68(__context__,__last_rename_at_381,das_get_variant_field<regex::ReNode *,8,0>::as(__onext_rename_at_394,__context__)));
+					das_copy(__cofs_rename_at_380,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_381->at) /*y*/);
+				};
+			};
+		};
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,__last_rename_at_381));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_87e4bfc6f6d63f91 ( Context * __context__, char * const  __expr_rename_at_247, int32_t __offset_rename_at_247 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_247,__offset_rename_at_247) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,__offset_rename_at_247) != 91 )
+		{
+			return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+		} else {
+			bool __negative_rename_at_253 = false;
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,__offset_rename_at_247 + 1) == 94 )
+			{
+				das_copy(__negative_rename_at_253,true);
+			};
+			TVariant<16,regex::ReNode *,void *> __oset_rename_at_256 = re_set_items_ae9f02db1f41117b(__context__,__expr_rename_at_247,__negative_rename_at_253 ? das_auto_cast<int32_t>::cast((__offset_rename_at_247 + 2)) : das_auto_cast<int32_t>::cast((__offset_rename_at_247 + 1)));
+			if ( das_get_variant_field<void *,8,1>::is(__oset_rename_at_256) )
+			{
+				return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_247,next_ed2c42f6e71d9107(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_256))) != 93 )
+				{
+					finalize_99d8b8a6e8d8847f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_256));
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				} else {
+					regex::ReNode * __oval_rename_at_262 = das_get_variant_field<regex::ReNode *,8,0>::as(__oset_rename_at_256,__context__);
+					das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__oval_rename_at_262->at) /*x*/,__offset_rename_at_247);
+					das_swizzle_ref<int32_t,range,1>::swizzle(__oval_rename_at_262->at) /*y*/++;
+					das_copy(__oval_rename_at_262->op,DAS_COMMENT(enum) regex::ReOp::Set);
+					if ( __negative_rename_at_253 )
+					{
+						set_negative_92d0a99efe9f2539(__context__,das_arg<TDim<uint32_t,8>>::pass(__oval_rename_at_262->cset));
+					};
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_256);
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_items_ae9f02db1f41117b ( Context * __context__, char * const  __expr_rename_at_207, int32_t __offset_rename_at_207 )
+{
+	if ( eos_e5043a1bfadf9b82(__context__,__expr_rename_at_207,__offset_rename_at_207) )
+	{
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+	} else {
+		TDim<uint32_t,8> __cset_rename_at_211; das_zero(__cset_rename_at_211);
+		int32_t __iofs_rename_at_212 = __offset_rename_at_207;
+		while ( !eos_e5043a1bfadf9b82(__context__,__expr_rename_at_207,__iofs_rename_at_212) )
+		{
+			int32_t __ch_rename_at_214 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_207,__iofs_rename_at_212));
+			if ( __ch_rename_at_214 == 93 )
+			{
+				break;
+			} else if ( __ch_rename_at_214 == 92 )
+			{
+				int32_t __che_rename_at_219 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_207,__iofs_rename_at_212 + 1));
+				if ( __che_rename_at_219 == 0 )
+				{
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				} else {
+					set_meta_ca9d28ab9ac7a054(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_211),__che_rename_at_219);
+					__iofs_rename_at_212 += 2;
+				};
+			} else if ( (at_c9bade5ff7edd57d(__context__,__expr_rename_at_207,__iofs_rename_at_212 + 1) == 45) && (at_c9bade5ff7edd57d(__context__,__expr_rename_at_207,__iofs_rename_at_212 + 2) != 93) )
+			{
+				int32_t __che_rename_at_227 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_207,__iofs_rename_at_212 + 2));
+				if ( __che_rename_at_227 == 0 )
+				{
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				} else if ( __ch_rename_at_214 > __che_rename_at_227 )
+				{
+					return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(nada_24ebaa7d6237c12e(__context__));
+				};
+				set_or_range_14a99b9f3c7d1171(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_211),range(__ch_rename_at_214,__che_rename_at_227));
+				__iofs_rename_at_212 += 3;
+			} else {
+				set_or_char_890ca4eb662c2e70(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_211),__ch_rename_at_214);
+				__iofs_rename_at_212 += 1;
+			};
+		};
+		return das_auto_cast<TVariant<16,regex::ReNode *,void *>>::cast(maybe_984b4328d549f193(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_241;
+			das_zero(__mks_241);
+			das_copy((__mks_241.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+			das_copy((__mks_241.cset),(__cset_rename_at_211));
+			das_copy((__mks_241.at),(range(__offset_rename_at_207,__iofs_rename_at_212)));
+			return __mks_241;
+		})()))));
+	};
+}
+
+inline regex::Regex regex_compile_646d4edb61acb47f ( Context * __context__, regex::Regex &  __re_rename_at_767 )
+{
+	if ( __re_rename_at_767.root != nullptr )
+	{
+		re_assign_next_e5ece72bb2e26bfd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_767));
+		re_assign_match_functions_87003d96082fb443(__context__,das_arg<regex::Regex>::pass(__re_rename_at_767));
+	};
+	return /* <- */ das_auto_cast<regex::Regex>::cast(__re_rename_at_767);
+}
+
+inline bool regex_compile_501be68ce327cfa0 ( Context * __context__, regex::Regex &  __re_rename_at_751, char * const  __expr_rename_at_751 )
+{
+	das_copy(__re_rename_at_751.root,re_parse_ca3ce795963ab5e5(__context__,__expr_rename_at_751));
+	if ( __re_rename_at_751.root != nullptr )
+	{
+		re_assign_next_e5ece72bb2e26bfd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_751));
+		re_assign_groups_d79bcfdca6696ebf(__context__,das_arg<regex::Regex>::pass(__re_rename_at_751));
+		re_assign_match_functions_87003d96082fb443(__context__,das_arg<regex::Regex>::pass(__re_rename_at_751));
+		re_early_out_b3d9e6cba2d1404c(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_751.earlyOut),__re_rename_at_751.root);
+		das_copy(__re_rename_at_751.canEarlyOut,!is_set_empty_fb12252b2129800d(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_751.earlyOut)));
+	};
+	return das_auto_cast<bool>::cast(__re_rename_at_751.root != nullptr);
+}
+
+inline regex::Regex regex_compile_ef31dd3c695567be ( Context * __context__, char * const  __expr_rename_at_761 )
+{
+	regex::Regex __re_rename_at_762; das_zero(__re_rename_at_762);
+	if ( !regex_compile_501be68ce327cfa0(__context__,das_arg<regex::Regex>::pass(__re_rename_at_762),__expr_rename_at_761) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_11, cast<char * const >::from(((char *) "regular expression ")), cast<char * const >::from(__expr_rename_at_761), cast<char * const >::from(((char *) " did not compile")))),__context__);
+	};
+	return /* <- */ das_auto_cast<regex::Regex>::cast(__re_rename_at_762);
+}
+
+inline void regex_debug_f56a9de670083f7b ( Context * __context__, regex::Regex const  &  __regex_rename_at_827 )
+{
+	debug_re_2e13921aef6c4915(__context__,__regex_rename_at_827.root,1);
+	builtin_print(((char *) "\n"),__context__);
+	if ( __regex_rename_at_827.canEarlyOut )
+	{
+		builtin_print(((char *) "early out: "),__context__);
+		debug_set_2bee8486efc5baef(__context__,__regex_rename_at_827.earlyOut);
+		builtin_print(((char *) "\n"),__context__);
+	};
+	if ( builtin_array_size(__regex_rename_at_827.groups) != 0 )
+	{
+		builtin_print(((char *) "groups:"),__context__);
+		{
+			bool __need_loop_836 = true;
+			// g : tuple<range;string> const&
+			das_iterator<TArray<TTuple<16,range,char *>> const > __g_iterator(__regex_rename_at_827.groups);
+			TTuple<16,range,char *> const  * __g_rename_at_836;
+			__need_loop_836 = __g_iterator.first(__context__,(__g_rename_at_836)) && __need_loop_836;
+			for ( ; __need_loop_836 ; __need_loop_836 = __g_iterator.next(__context__,(__g_rename_at_836)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(das_get_tuple_field<char *,8>::get((*__g_rename_at_836))), cast<char * const >::from(((char *) "\n")))),__context__);
+			}
+			__g_iterator.close(__context__,(__g_rename_at_836));
+		};
+	};
+}
+
+inline void regex_foreach_19284c624c636c0d ( Context * __context__, regex::Regex &  __regex_rename_at_790, char * const  __str_rename_at_790, Block DAS_COMMENT((bool,range)) const  &  __blk_rename_at_790 )
+{
+	if ( builtin_empty(__str_rename_at_790) )
+	{
+		return ;
+	} else {
+		regex::ReNode * __root_rename_at_794 = __regex_rename_at_790.root;
+		uint8_t * __pstr_rename_at_795 = das_cast<uint8_t *>::cast(__str_rename_at_790);
+		uint8_t * __cstr_rename_at_796 = __pstr_rename_at_795;
+		if ( __regex_rename_at_790.canEarlyOut )
+		{
+			while ( true )
+			{
+				int32_t __Ch_rename_at_800 = ((int32_t)int32_t((*(__cstr_rename_at_796))));
+				if ( __Ch_rename_at_800 == 0 )
+				{
+					break;
+				} else {
+					if ( is_char_in_set(__Ch_rename_at_800,das_arg<TDim<uint32_t,8>>::pass(__regex_rename_at_790.earlyOut)) )
+					{
+						uint8_t * __om_rename_at_804 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__root_rename_at_794->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_790),__root_rename_at_794,__cstr_rename_at_796));
+						if ( __om_rename_at_804 != nullptr )
+						{
+							if ( !das_invoke<bool>::invoke<range>(__context__,__blk_rename_at_790,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_796),das_auto_cast<void * const >::cast(__pstr_rename_at_795),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_804),das_auto_cast<void * const >::cast(__pstr_rename_at_795),1)))) )
+							{
+								break;
+							} else {
+								das_copy(__cstr_rename_at_796,__om_rename_at_804);
+							};
+						} else {
+							das_ptr_inc(__cstr_rename_at_796,1);
+						};
+					} else {
+						das_ptr_inc(__cstr_rename_at_796,1);
+					};
+				};
+			};
+		} else {
+			while ( int32_t((*(__cstr_rename_at_796))) != 0 )
+			{
+				uint8_t * __om_rename_at_815 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__root_rename_at_794->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_790),__root_rename_at_794,__cstr_rename_at_796));
+				if ( __om_rename_at_815 != nullptr )
+				{
+					if ( !das_invoke<bool>::invoke<range>(__context__,__blk_rename_at_790,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_796),das_auto_cast<void * const >::cast(__pstr_rename_at_795),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_815),das_auto_cast<void * const >::cast(__pstr_rename_at_795),1)))) )
+					{
+						break;
+					} else {
+						das_copy(__cstr_rename_at_796,__om_rename_at_815);
+					};
+				} else {
+					das_ptr_inc(__cstr_rename_at_796,1);
+				};
+			};
+		};
+	};
+}
+
+inline char * regex_group_142824080e38bc9 ( Context * __context__, regex::Regex const  &  __regex_rename_at_785, int32_t __index_rename_at_785, char * const  __match_rename_at_785 )
+{
+	range __sub_range_rename_at_786 = ((range)das_get_tuple_field<range,0>::get(__regex_rename_at_785.groups(__index_rename_at_785,__context__)));
+	return das_auto_cast<char *>::cast(((char *)(builtin_string_slice1(__match_rename_at_785,v_extract_xi(v_cast_vec4i(__sub_range_rename_at_786)) /*x*/,v_extract_yi(v_cast_vec4i(__sub_range_rename_at_786)) /*y*/,__context__))));
+}
+
+inline int32_t regex_match_3a95d7284016f622 ( Context * __context__, regex::Regex &  __regex_rename_at_773, char * const  __str_rename_at_773, int32_t __offset_rename_at_773 )
+{
+	if ( builtin_empty(__str_rename_at_773) )
+	{
+		return das_auto_cast<int32_t>::cast(-1);
+	} else {
+		das_copy(__regex_rename_at_773.match,das_cast<uint8_t *>::cast(__str_rename_at_773));
+		uint8_t * __mptr_rename_at_780 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,__regex_rename_at_773.root->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_773),__regex_rename_at_773.root,__regex_rename_at_773.match));
+		return das_auto_cast<int32_t>::cast((__mptr_rename_at_780 == nullptr) ? das_auto_cast<int32_t>::cast(-1) : das_auto_cast<int32_t>::cast(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__mptr_rename_at_780),das_auto_cast<void * const >::cast(__regex_rename_at_773.match),1))));
+	};
+}
+
+inline void set_invert_4b32fde10b9c6020 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_141 )
+{
+	{
+		bool __need_loop_142 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_141);
+		uint32_t * __x_rename_at_142;
+		__need_loop_142 = __x_iterator.first(__context__,(__x_rename_at_142)) && __need_loop_142;
+		for ( ; __need_loop_142 ; __need_loop_142 = __x_iterator.next(__context__,(__x_rename_at_142)) )
+		{
+			(*__x_rename_at_142) ^= 0xffffffffu;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_142));
+	};
+}
+
+inline void set_meta_ca9d28ab9ac7a054 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_156, int32_t __che_rename_at_156 )
+{
+	if ( __che_rename_at_156 == 119 )
+	{
+		set_or_range_14a99b9f3c7d1171(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),range(97,122));
+		set_or_range_14a99b9f3c7d1171(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),range(65,90));
+		set_or_range_14a99b9f3c7d1171(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),range(48,57));
+		set_or_char_890ca4eb662c2e70(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),95);
+	} else if ( __che_rename_at_156 == 87 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_163; das_zero(__eset_rename_at_163);
+		set_meta_ca9d28ab9ac7a054(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163),119);
+		set_or_set_6b98d7be86d4da25(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_163));
+	} else {
+		set_or_char_890ca4eb662c2e70(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_156),__che_rename_at_156);
+	};
+}
+
+inline void set_negative_92d0a99efe9f2539 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_151 )
+{
+	{
+		bool __need_loop_152 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_151);
+		uint32_t * __x_rename_at_152;
+		__need_loop_152 = __x_iterator.first(__context__,(__x_rename_at_152)) && __need_loop_152;
+		for ( ; __need_loop_152 ; __need_loop_152 = __x_iterator.next(__context__,(__x_rename_at_152)) )
+		{
+			das_copy((*__x_rename_at_152),~(*__x_rename_at_152));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_152));
+	};
+}
+
+inline void set_or_char_890ca4eb662c2e70 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_132, int32_t __ch_rename_at_132 )
+{
+	__cset_rename_at_132((__ch_rename_at_132 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_132 & 31));
+}
+
+inline void set_or_range_14a99b9f3c7d1171 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_136, range __bits_rename_at_136 )
+{
+	{
+		bool __need_loop_137 = true;
+		// ch : int const
+		das_iterator<range> __ch_iterator(range(v_extract_xi(v_cast_vec4i(__bits_rename_at_136)) /*x*/,v_extract_yi(v_cast_vec4i(__bits_rename_at_136)) /*y*/ + 1));
+		int32_t __ch_rename_at_137;
+		__need_loop_137 = __ch_iterator.first(__context__,(__ch_rename_at_137)) && __need_loop_137;
+		for ( ; __need_loop_137 ; __need_loop_137 = __ch_iterator.next(__context__,(__ch_rename_at_137)) )
+		{
+			__cset_rename_at_136((__ch_rename_at_137 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_137 & 31));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_137));
+	};
+}
+
+inline void set_or_set_6b98d7be86d4da25 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_146, TDim<uint32_t,8> const  &  __eset_rename_at_146 )
+{
+	{
+		bool __need_loop_147 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_146);
+		uint32_t * __x_rename_at_147;
+		__need_loop_147 = __x_iterator.first(__context__,(__x_rename_at_147)) && __need_loop_147;
+		// y : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __y_iterator(__eset_rename_at_146);
+		uint32_t const  * __y_rename_at_147;
+		__need_loop_147 = __y_iterator.first(__context__,(__y_rename_at_147)) && __need_loop_147;
+		for ( ; __need_loop_147 ; __need_loop_147 = __x_iterator.next(__context__,(__x_rename_at_147)) && __y_iterator.next(__context__,(__y_rename_at_147)) )
+		{
+			(*__x_rename_at_147) |= (*__y_rename_at_147);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_147));
+		__y_iterator.close(__context__,(__y_rename_at_147));
+	};
+}
+
+inline void trace_fb609b665aef2329 ( Context * __context__, char * const  __msg_rename_at_63, int32_t __offset_rename_at_63 )
+{
+}
+
+inline void trace_backtrack_9879e3fe4fd34323 ( Context * __context__ )
+{
+}
+
+inline void trace_value_fd61f5515193b3d7 ( Context * __context__, regex::ReNode * const  __value_rename_at_80 )
+{
+}
+
+inline void visit_top_down_d1d52f47cb2c3db ( Context * __context__, regex::ReNode * __node_rename_at_433, Block DAS_COMMENT((void,regex::ReNode *)) const  &  __blk_rename_at_433 )
+{
+	das_invoke<void>::invoke<regex::ReNode *>(__context__,__blk_rename_at_433,__node_rename_at_433);
+	{
+		bool __need_loop_435 = true;
+		// x : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __x_iterator(__node_rename_at_433->all);
+		regex::ReNode * * __x_rename_at_435;
+		__need_loop_435 = __x_iterator.first(__context__,(__x_rename_at_435)) && __need_loop_435;
+		for ( ; __need_loop_435 ; __need_loop_435 = __x_iterator.next(__context__,(__x_rename_at_435)) )
+		{
+			visit_top_down_d1d52f47cb2c3db(__context__,(*__x_rename_at_435),__blk_rename_at_433);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_435));
+	};
+	if ( __node_rename_at_433->subexpr != nullptr )
+	{
+		visit_top_down_d1d52f47cb2c3db(__context__,__node_rename_at_433->subexpr,__blk_rename_at_433);
+	};
+	if ( __node_rename_at_433->left != nullptr )
+	{
+		visit_top_down_d1d52f47cb2c3db(__context__,__node_rename_at_433->left,__blk_rename_at_433);
+	};
+	if ( __node_rename_at_433->right != nullptr )
+	{
+		visit_top_down_d1d52f47cb2c3db(__context__,__node_rename_at_433->right,__blk_rename_at_433);
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// at_c9bade5ff7edd57d
+		aotLib[0x9d976e8cdb634999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , int32_t  ),&at_c9bade5ff7edd57d>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46
+		aotLib[0x649b176ea5425e53] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_dd8c5cab6f6afc46>>();
+	};
+		// _Funcbuiltin_0x60_length_7938efcc1bc3eff1
+		aotLib[0x494cf457a90783a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<regex::ReNode *,2> const  &  ),&_Funcbuiltin_0x60_length_7938efcc1bc3eff1>>();
+	};
+		// _Funcbuiltin_0x60_push_51a9a782562eaa80
+		aotLib[0x7f62ae161d5eaaa9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , regex::ReNode * const   ),&_Funcbuiltin_0x60_push_51a9a782562eaa80>>();
+	};
+		// _Funcbuiltin_0x60_push_2c5fcac663cf7939
+		aotLib[0x8c89cd97a616ff5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> & , TTuple<16,range,char *> const  &  ),&_Funcbuiltin_0x60_push_2c5fcac663cf7939>>();
+	};
+		// _Funcbuiltin_0x60_resize_13e4a05653768251
+		aotLib[0xb8d697922f2109d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , int32_t  ),&_Funcbuiltin_0x60_resize_13e4a05653768251>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_cb4608e1175cfa97
+		aotLib[0x6d1c31d7a560a816] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<regex::ReNode *> (*) ( Context * __context__, TDim<regex::ReNode *,2> &  ),&_Funcbuiltin_0x60_to_array_move_cb4608e1175cfa97>>();
+	};
+		// debug_re_2e13921aef6c4915
+		aotLib[0xa403d10670336901] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const  , int32_t  ),&debug_re_2e13921aef6c4915>>();
+	};
+		// debug_set_2bee8486efc5baef
+		aotLib[0x42688d31a4a9416d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&debug_set_2bee8486efc5baef>>();
+	};
+		// eos_e5043a1bfadf9b82
+		aotLib[0x661a238b632e5a25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , int32_t  ),&eos_e5043a1bfadf9b82>>();
+	};
+		// finalize_34a3d5ec19efc0f8
+		aotLib[0xe0132ada4d5d5a26] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * &  ),&finalize_34a3d5ec19efc0f8>>();
+	};
+		// finalize_99d8b8a6e8d8847f
+		aotLib[0xa5c9492f80594e06] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ),&finalize_99d8b8a6e8d8847f>>();
+	};
+		// finalize_4b5b3ac4f531983c
+		aotLib[0x5e10c4a1b715cca4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode &  ),&finalize_4b5b3ac4f531983c>>();
+	};
+		// is_meta_character_b4bac6800864dee5
+		aotLib[0xd10a2525d7244fb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_meta_character_b4bac6800864dee5>>();
+	};
+		// is_set_character_7c422a785bea5d2e
+		aotLib[0xb9e2363594a629bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_set_character_7c422a785bea5d2e>>();
+	};
+		// is_set_empty_fb12252b2129800d
+		aotLib[0x920d0936973b20a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&is_set_empty_fb12252b2129800d>>();
+	};
+		// is_valid_b903ff05fad46b66
+		aotLib[0xbf110b1cd7c94bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex &  ),&is_valid_b903ff05fad46b66>>();
+	};
+		// maybe_984b4328d549f193
+		aotLib[0xa9cb85f3fde38845] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, regex::ReNode * const   ),&maybe_984b4328d549f193>>();
+	};
+		// mk_concat_bbdcb54024f56b68
+		aotLib[0x6ea3b109bd140d3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_concat_bbdcb54024f56b68>>();
+	};
+		// mk_union_d3d46eea9d41aee
+		aotLib[0x2bd464ac9a9b4c38] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_union_d3d46eea9d41aee>>();
+	};
+		// nada_24ebaa7d6237c12e
+		aotLib[0x2979849d692d32d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__ ),&nada_24ebaa7d6237c12e>>();
+	};
+		// next_ed2c42f6e71d9107
+		aotLib[0x83dca48dfe9882cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  ),&next_ed2c42f6e71d9107>>();
+	};
+		// note_fb609b665aef2329
+		aotLib[0x1a22b66e31a5e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&note_fb609b665aef2329>>();
+	};
+		// re_any_d1c11112b20d9d8a
+		aotLib[0x44ab0ba19476a957] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_any_d1c11112b20d9d8a>>();
+	};
+		// re_assign_groups_d79bcfdca6696ebf
+		aotLib[0x3d9bcc48bc2812c6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_groups_d79bcfdca6696ebf>>();
+	};
+		// re_assign_match_functions_87003d96082fb443
+		aotLib[0xc2d0caf944d01c58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_match_functions_87003d96082fb443>>();
+	};
+		// re_assign_next_e5ece72bb2e26bfd
+		aotLib[0x7e1789a687e1e6b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_next_e5ece72bb2e26bfd>>();
+	};
+		// re_basic_b41e57f28b97c89a
+		aotLib[0x83eeca9595c5c67f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_basic_b41e57f28b97c89a>>();
+	};
+		// re_char_d4c780dbba6f23e0
+		aotLib[0xef2d4678a5fed4a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_char_d4c780dbba6f23e0>>();
+	};
+		// re_early_out_b3d9e6cba2d1404c
+		aotLib[0xfb047e32159ef196] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> & , regex::ReNode * const   ),&re_early_out_b3d9e6cba2d1404c>>();
+	};
+		// re_elementary_516fa992bc6f334
+		aotLib[0x4fe95afb41ae6d1a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_elementary_516fa992bc6f334>>();
+	};
+		// re_eos_e4c7b3129b1a78c3
+		aotLib[0x7e769c7e43e56f97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_eos_e4c7b3129b1a78c3>>();
+	};
+		// re_group_cbd57221135d24ee
+		aotLib[0x1335fc6f07028d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_group_cbd57221135d24ee>>();
+	};
+		// re_match2_any_cc6fd5fe415900d0
+		aotLib[0x77c7e0b485b46f3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_any_cc6fd5fe415900d0>>();
+	};
+		// re_match2_char_9e9990bc1ac5284
+		aotLib[0x5b34d33eb9772931] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_char_9e9990bc1ac5284>>();
+	};
+		// re_match2_concat_c7fe3b044b11a12
+		aotLib[0x8b12ecaeaff9a4dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_concat_c7fe3b044b11a12>>();
+	};
+		// re_match2_eos_4c553106a86aa72a
+		aotLib[0x19d413c3a684a221] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_eos_4c553106a86aa72a>>();
+	};
+		// re_match2_group_4fef50fcef07ef6
+		aotLib[0xf6abef3656bdb815] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_group_4fef50fcef07ef6>>();
+	};
+		// re_match2_plus_ae83b0da355050f9
+		aotLib[0xd5922f4d82bd4085] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_ae83b0da355050f9>>();
+	};
+		// re_match2_plus_set_cf6261f9f7313b65
+		aotLib[0xcbabc7d47de51d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_set_cf6261f9f7313b65>>();
+	};
+		// re_match2_question_23c4b87108b7d016
+		aotLib[0x375afba012b0ba55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_question_23c4b87108b7d016>>();
+	};
+		// re_match2_set_7a2fc7b5818f8983
+		aotLib[0xa6f2866ced10a499] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_set_7a2fc7b5818f8983>>();
+	};
+		// re_match2_single_char_40d44dcb4c4b60e0
+		aotLib[0xf92fcdd3c07094bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_single_char_40d44dcb4c4b60e0>>();
+	};
+		// re_match2_star_e627029314171e76
+		aotLib[0x78c73c6f606777d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_star_e627029314171e76>>();
+	};
+		// re_match2_union_311eec463d4db005
+		aotLib[0xf026fff145528585] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_union_311eec463d4db005>>();
+	};
+		// re_parse_ca3ce795963ab5e5
+		aotLib[0xd59a7df5bc898be2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, char * const   ),&re_parse_ca3ce795963ab5e5>>();
+	};
+		// re_re_43df13b58032ae34
+		aotLib[0x7a3ad3507194ed54] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_re_43df13b58032ae34>>();
+	};
+		// re_set_87e4bfc6f6d63f91
+		aotLib[0x6edaf49279f93a13] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_87e4bfc6f6d63f91>>();
+	};
+		// re_set_items_ae9f02db1f41117b
+		aotLib[0x9f92d3d42ebd7e31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_items_ae9f02db1f41117b>>();
+	};
+		// regex_compile_646d4edb61acb47f
+		aotLib[0x2b7bd18fa8b9d2dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, regex::Regex &  ),&regex_compile_646d4edb61acb47f>>();
+	};
+		// regex_compile_501be68ce327cfa0
+		aotLib[0x10471409628d837e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex & , char * const   ),&regex_compile_501be68ce327cfa0>>();
+	};
+		// regex_compile_ef31dd3c695567be
+		aotLib[0x5a643e52af4c1e30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, char * const   ),&regex_compile_ef31dd3c695567be>>();
+	};
+		// regex_debug_f56a9de670083f7b
+		aotLib[0xcd2d51c26a6431fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex const  &  ),&regex_debug_f56a9de670083f7b>>();
+	};
+		// regex_foreach_19284c624c636c0d
+		aotLib[0xeab81c31313b6cdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex & , char * const  , Block DAS_COMMENT((bool,range)) const  &  ),&regex_foreach_19284c624c636c0d>>();
+	};
+		// regex_group_142824080e38bc9
+		aotLib[0xd17cafbc3fd1b155] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex const  & , int32_t , char * const   ),&regex_group_142824080e38bc9>>();
+	};
+		// regex_match_3a95d7284016f622
+		aotLib[0x2c647371a8e3da8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, regex::Regex & , char * const  , int32_t  ),&regex_match_3a95d7284016f622>>();
+	};
+		// set_invert_4b32fde10b9c6020
+		aotLib[0x5a6722006c79338d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_invert_4b32fde10b9c6020>>();
+	};
+		// set_meta_ca9d28ab9ac7a054
+		aotLib[0x289f7456ea12348a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_meta_ca9d28ab9ac7a054>>();
+	};
+		// set_negative_92d0a99efe9f2539
+		aotLib[0xabfc3cb06e3ac02d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_negative_92d0a99efe9f2539>>();
+	};
+		// set_or_char_890ca4eb662c2e70
+		aotLib[0xd792f494897f79e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_or_char_890ca4eb662c2e70>>();
+	};
+		// set_or_range_14a99b9f3c7d1171
+		aotLib[0x242b4ec89fe3dc85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , range  ),&set_or_range_14a99b9f3c7d1171>>();
+	};
+		// set_or_set_6b98d7be86d4da25
+		aotLib[0x42a94c267e08ba15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , TDim<uint32_t,8> const  &  ),&set_or_set_6b98d7be86d4da25>>();
+	};
+		// trace_fb609b665aef2329
+		aotLib[0x1a22b66e31a5e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&trace_fb609b665aef2329>>();
+	};
+		// trace_backtrack_9879e3fe4fd34323
+		aotLib[0x23e78f0e7f05e229] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&trace_backtrack_9879e3fe4fd34323>>();
+	};
+		// trace_value_fd61f5515193b3d7
+		aotLib[0xfecd83a20ab93f5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const   ),&trace_value_fd61f5515193b3d7>>();
+	};
+		// visit_top_down_d1d52f47cb2c3db
+		aotLib[0x292e90b96eddea25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Block DAS_COMMENT((void,regex::ReNode *)) const  &  ),&visit_top_down_d1d52f47cb2c3db>>();
+	};
+		// [[ init script ]]
+		aotLib[0x41f2561d98669525] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
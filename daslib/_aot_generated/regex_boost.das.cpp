@@ -0,0 +1,438 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require regex_boost
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require regex
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__6399c7e8;
+extern StructInfo __struct_info__92c3c52e;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__b676c5e0;
+extern TypeInfo __type_info__239a820b;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__56607ebd;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__d6c2593b;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__75b7ce79;
+extern VarInfo __var_info__4782b24d;
+extern VarInfo __var_info__bae603ca;
+extern VarInfo __var_info__db4c6b98;
+extern VarInfo __var_info__88942b34;
+extern VarInfo __var_info__754fb163;
+extern VarInfo __var_info__269ec52a;
+extern VarInfo __var_info__b7f3aed1;
+extern VarInfo __var_info__c98cc4f;
+
+VarInfo __struct_info__6399c7e8_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x754fb163, "__rtti", 0 };
+TypeInfo * __type_info__db4c6b98_arg_types_var_1671022568[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__6399c7e8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db4c6b98_arg_types_var_1671022568, nullptr, 1, 0, nullptr, 28, 0xdb4c6b98, "__finalize", 8 };
+TypeInfo * __type_info__88942b34_arg_types_var_1671022568[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__6399c7e8_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__88942b34_arg_types_var_1671022568, nullptr, 6, 0, nullptr, 28, 0x88942b34, "accept", 12 };
+TypeInfo * __type_info__c98cc4f_arg_types_var_1671022568[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__6399c7e8_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c98cc4f_arg_types_var_1671022568, nullptr, 4, 0, nullptr, 28, 0xc98cc4f, "visit", 16 };
+VarInfo * __struct_info__6399c7e8_fields[4] =  { &__struct_info__6399c7e8_field_0, &__struct_info__6399c7e8_field_1, &__struct_info__6399c7e8_field_2, &__struct_info__6399c7e8_field_3 };
+StructInfo __struct_info__6399c7e8 = {"RegexReader", __struct_info__6399c7e8_fields, 4, 24, -1, nullptr, 0x6399c7e8 };
+VarInfo __struct_info__92c3c52e_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4782b24d, "__rtti", 0 };
+TypeInfo * __type_info__269ec52a_arg_types_var_2462303534[1] = { &__type_info__b676c5e0 };
+VarInfo __struct_info__92c3c52e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__269ec52a_arg_types_var_2462303534, nullptr, 1, 0, nullptr, 28, 0x269ec52a, "__finalize", 8 };
+TypeInfo * __type_info__bae603ca_arg_types_var_2462303534[6] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__56607ebd, &__type_info__359c1b32, &__type_info__239a820b };
+VarInfo __struct_info__92c3c52e_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bae603ca_arg_types_var_2462303534, nullptr, 6, 0, nullptr, 28, 0xbae603ca, "accept", 12 };
+TypeInfo * __type_info__b7f3aed1_arg_types_var_2462303534[4] = { &__type_info__b676c5e0, &__type_info__8f3455dd, &__type_info__b049b391, &__type_info__2ba0095f };
+VarInfo __struct_info__92c3c52e_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7f3aed1_arg_types_var_2462303534, nullptr, 4, 0, nullptr, 28, 0xb7f3aed1, "visit", 16 };
+VarInfo * __struct_info__92c3c52e_fields[4] =  { &__struct_info__92c3c52e_field_0, &__struct_info__92c3c52e_field_1, &__struct_info__92c3c52e_field_2, &__struct_info__92c3c52e_field_3 };
+StructInfo __struct_info__92c3c52e = {"AstReaderMacro", __struct_info__92c3c52e_fields, 4, 24, -1, nullptr, 0x92c3c52e };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__b676c5e0 = { Type::tStructure, &__struct_info__92c3c52e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb676c5e0 };
+TypeInfo __type_info__239a820b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::LineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0x239a820b };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__56607ebd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x56607ebd };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__d6c2593b = { Type::tStructure, &__struct_info__6399c7e8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xd6c2593b };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__e8c29053 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+namespace ast {
+
+struct AstReaderMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(AstReaderMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstReaderMacro,visit)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< regex::ReOp > : cast_enum < regex::ReOp > {};
+namespace {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,regex::Regex,regex::ReNode *,uint8_t * const )) fun2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==144,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==136,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+namespace regex_boost {
+
+struct RegexReader {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstReaderMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const )) accept;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const )) visit;
+};
+static_assert(sizeof(RegexReader)==24,"structure size mismatch with DAS");
+static_assert(offsetof(RegexReader,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,accept)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(RegexReader,visit)==16,"structure field offset mismatch with DAS");
+}
+
+inline regex_boost::RegexReader RegexReader_de45aecfff49effa ( Context * __context__ );
+inline void _FuncRegexReader_0x27___finalize_8df65cc1688eb5d6 ( Context * __context__, regex_boost::RegexReader & __self_rename_at_12 );
+inline bool _FuncRegexReader_0x60_accept_2008df5635ee42 ( Context * __context__, regex_boost::RegexReader & __self_rename_at_13, smart_ptr_raw<Program> const  __prog_rename_at_13, Module * const  __mod_rename_at_13, ExprReader * __expr_rename_at_13, int32_t __ch_rename_at_13, LineInfo const  & __info_rename_at_13 );
+inline smart_ptr_raw<Expression> _FuncRegexReader_0x60_visit_139f7b3271d6b30c ( Context * __context__, regex_boost::RegexReader & __self_rename_at_22, smart_ptr_raw<Program> const  __prog_rename_at_22, Module * const  __mod_rename_at_22, smart_ptr_raw<ExprReader> const  __expr_rename_at_22 );
+inline void __setup_macros_facb78f72016f710 ( Context * __context__ );
+inline void _Funcast_0x60_add_new_reader_macro_76555ac8104a9344 ( Context * __context__, char * const  __name_rename_at_523, regex_boost::RegexReader * const  __someClassPtr_rename_at_523 );
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_d91a0555e1997288 ( Context * __context__, char * const  __name_rename_at_473, regex_boost::RegexReader * const  __someClassPtr_rename_at_473 );
+inline void _Funcbuiltin_0x60_finalize_6dda7ea5f2695554 ( Context * __context__, TArray<TTuple<16,range,char *>> & __a_rename_at_186 );
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> & ____this_rename_at_190 );
+inline void finalize_1eb5223d00df51b5 ( Context * __context__, regex::Regex & ____this_rename_at_39 );
+inline void finalize_a3a001a249ad2764 ( Context * __context__, regex_boost::RegexReader & ____this_rename_at_12 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_c79d1a890c262745 ( Context * __context__, regex_boost::RegexReader const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_facb78f72016f710(__context__);
+}
+
+inline regex_boost::RegexReader RegexReader_de45aecfff49effa ( Context * __context__ )
+{
+	return das_auto_cast<regex_boost::RegexReader>::cast((([&]() -> regex_boost::RegexReader {
+		regex_boost::RegexReader __mks_12;
+		das_copy((__mks_12.__rtti),(((void *)(&__type_info__d6c2593b))));
+		das_copy((__mks_12.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstReaderMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader'__finalize RegexReader*/ 2945045759u)))));
+		das_copy((__mks_12.accept),(das_cast<Func DAS_COMMENT((bool,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,ExprReader * const ,int32_t,LineInfo const ))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader`accept RegexReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #ptr##handle#ExprReader int#const #handle#LineInfo#const*/ 2556622803u)))));
+		das_copy((__mks_12.visit),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstReaderMacro,smart_ptr_raw<Program> const ,Module * const ,smart_ptr_raw<ExprReader> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@regex_boost::RegexReader`visit RegexReader #smart_ptr##handle#Program#const #ptr##handle#Module#const #smart_ptr##handle#ExprReader#const*/ 1006917069u)))));
+		return __mks_12;
+	})()));
+}
+
+inline void _FuncRegexReader_0x27___finalize_8df65cc1688eb5d6 ( Context * __context__, regex_boost::RegexReader &  __self_rename_at_12 )
+{
+	finalize_a3a001a249ad2764(__context__,das_arg<regex_boost::RegexReader>::pass(__self_rename_at_12));
+}
+
+inline bool _FuncRegexReader_0x60_accept_2008df5635ee42 ( Context * __context__, regex_boost::RegexReader &  __self_rename_at_13, smart_ptr_raw<Program> const  __prog_rename_at_13, Module * const  __mod_rename_at_13, ExprReader * __expr_rename_at_13, int32_t __ch_rename_at_13, LineInfo const  &  __info_rename_at_13 )
+{
+	if ( (__ch_rename_at_13 != 10) && (__ch_rename_at_13 != 13) )
+	{
+		builtin_append_char_to_string(das_arg<das::string>::pass(__expr_rename_at_13->sequence /*sequence*/),__ch_rename_at_13);
+	};
+	if ( builtin_string_ends_with(das_arg<das::string>::pass(__expr_rename_at_13->sequence /*sequence*/),((char *) "%%"),__context__) )
+	{
+		int32_t __len_rename_at_17 = ((int32_t)builtin_ext_string_length(das_arg<das::string>::pass(__expr_rename_at_13->sequence /*sequence*/)));
+		builtin_resize_string(das_arg<das::string>::pass(__expr_rename_at_13->sequence /*sequence*/),__len_rename_at_17 - 2);
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		return das_auto_cast<bool>::cast(true);
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncRegexReader_0x60_visit_139f7b3271d6b30c ( Context * __context__, regex_boost::RegexReader &  __self_rename_at_22, smart_ptr_raw<Program> const  __prog_rename_at_22, Module * const  __mod_rename_at_22, smart_ptr_raw<ExprReader> const  __expr_rename_at_22 ) { das_stack_prologue __prologue(__context__,224,"RegexReader`visit " DAS_FILE_LINE);
+{
+	regex::Regex __regex_rename_at_23; das_zero(__regex_rename_at_23);
+	das_invoke_function<bool>::invoke<regex::Regex &,char *>(__context__,Func(__context__->fnIdxByMangledName(/*@regex::regex_compile Regex string#const*/ 1215890493u)),das_arg<regex::Regex>::pass(__regex_rename_at_23),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string const  &>::from(__expr_rename_at_22->sequence /*sequence*/))));
+	if ( !das_invoke_function<bool>::invoke<regex::Regex &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex::is_valid Regex*/ 679979928u)),das_arg<regex::Regex>::pass(__regex_rename_at_23)) )
+	{
+		finalize_1eb5223d00df51b5(__context__,das_arg<regex::Regex>::pass(__regex_rename_at_23));
+		ast_error(__prog_rename_at_22,__expr_rename_at_22->at /*at*/,((char *) "regular expression did not compile"));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	} else {
+		smart_ptr_raw<Expression> __re_data_rename_at_30; das_zero(__re_data_rename_at_30); das_move(__re_data_rename_at_30, das_invoke_function<smart_ptr_raw<Expression>>::invoke<regex::Regex &,LineInfo const  &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex_boost::ast_boost`convert_to_expression Regex#explicit #handle#LineInfo#const*/ 1797467100u)),das_arg<regex::Regex>::pass(__regex_rename_at_23),__expr_rename_at_22->at /*at*/));
+		finalize_1eb5223d00df51b5(__context__,das_arg<regex::Regex>::pass(__regex_rename_at_23));
+		smart_ptr_raw<ExprCall> __creg_rename_at_32; das_zero(__creg_rename_at_32); das_move(__creg_rename_at_32, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_32) {
+			das_copy((__mks_32.at /*at*/),(__expr_rename_at_22->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_32.name /*name*/),((char *) "regex::regex_compile"));
+			}		}))));
+		das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__creg_rename_at_32->arguments /*arguments*/),__re_data_rename_at_30);
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__creg_rename_at_32);
+	};
+}}
+
+inline void __setup_macros_facb78f72016f710 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "regex_boost"),__context__) )
+	{
+		_Funcast_0x60_add_new_reader_macro_76555ac8104a9344(__context__,((char *) "regex"),das_new<regex_boost::RegexReader>::make_and_init(__context__,[&]() { return RegexReader_de45aecfff49effa(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_reader_macro_76555ac8104a9344 ( Context * __context__, char * const  __name_rename_at_523, regex_boost::RegexReader * const  __someClassPtr_rename_at_523 )
+{
+	smart_ptr_raw<ReaderMacro> __ann_rename_at_524; das_zero(__ann_rename_at_524); das_move(__ann_rename_at_524, _Funcast_0x60_make_reader_macro_d91a0555e1997288(__context__,__name_rename_at_523,__someClassPtr_rename_at_523));
+	addModuleReaderMacro(thisModule(__context__,nullptr),__ann_rename_at_524,__context__);
+	das_delete_handle<smart_ptr_raw<ReaderMacro>>::clear(__context__,__ann_rename_at_524);
+}
+
+inline smart_ptr_raw<ReaderMacro> _Funcast_0x60_make_reader_macro_d91a0555e1997288 ( Context * __context__, char * const  __name_rename_at_473, regex_boost::RegexReader * const  __someClassPtr_rename_at_473 )
+{
+	StructInfo const  * __classInfo_rename_at_475 = ((StructInfo const  *)_Funcrtti_0x60_class_info_c79d1a890c262745(__context__,das_deref(__context__,__someClassPtr_rename_at_473)));
+	return das_auto_cast<smart_ptr_raw<ReaderMacro>>::cast(makeReaderMacro(__name_rename_at_473,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_473),__classInfo_rename_at_475,__context__));
+}
+
+inline void _Funcbuiltin_0x60_finalize_6dda7ea5f2695554 ( Context * __context__, TArray<TTuple<16,range,char *>> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : tuple<range;string> aka TT&
+		das_iterator<TArray<TTuple<16,range,char *>>> __aV_iterator(__a_rename_at_186);
+		TTuple<16,range,char *> * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_1db505b7ad774ab5(__context__,das_arg<TTuple<16,range,char *>>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<16,range,char *>>>::pass(__a_rename_at_186),16,__context__);
+}
+
+inline void finalize_1db505b7ad774ab5 ( Context * __context__, TTuple<16,range,char *> &  ____this_rename_at_190 )
+{
+	memset(&(____this_rename_at_190), 0, 16);
+}
+
+inline void finalize_1eb5223d00df51b5 ( Context * __context__, regex::Regex &  ____this_rename_at_39 )
+{
+	das_invoke_function<void>::invoke<regex::ReNode * &>(__context__,Func(__context__->fnIdxByMangledName(/*@regex::finalize #ptr#ReNode#ref#explicit*/ 4120082102u)),____this_rename_at_39.root);
+	_Funcbuiltin_0x60_finalize_6dda7ea5f2695554(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(____this_rename_at_39.groups));
+	memset(&(____this_rename_at_39), 0, 80);
+}
+
+inline void finalize_a3a001a249ad2764 ( Context * __context__, regex_boost::RegexReader &  ____this_rename_at_12 )
+{
+	memset(&(____this_rename_at_12), 0, 24);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_c79d1a890c262745 ( Context * __context__, regex_boost::RegexReader const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// RegexReader_de45aecfff49effa
+		aotLib[0x26c53a8270159b20] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex_boost::RegexReader (*) ( Context * __context__ ),&RegexReader_de45aecfff49effa>>();
+	};
+		// _FuncRegexReader_0x27___finalize_8df65cc1688eb5d6
+		aotLib[0xc8a27ae1bc94c352] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex_boost::RegexReader &  ),&_FuncRegexReader_0x27___finalize_8df65cc1688eb5d6>>();
+	};
+		// _FuncRegexReader_0x60_accept_2008df5635ee42
+		aotLib[0xfcb03d0f9de89b2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex_boost::RegexReader & , smart_ptr_raw<Program> const  , Module * const  , ExprReader * , int32_t , LineInfo const  &  ),&_FuncRegexReader_0x60_accept_2008df5635ee42>>();
+	};
+		// _FuncRegexReader_0x60_visit_139f7b3271d6b30c
+		aotLib[0xd923496e3371721] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, regex_boost::RegexReader & , smart_ptr_raw<Program> const  , Module * const  , smart_ptr_raw<ExprReader> const   ),&_FuncRegexReader_0x60_visit_139f7b3271d6b30c>>();
+	};
+		// __setup_macros_facb78f72016f710
+		aotLib[0xe214ef27ea5d0ee1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_facb78f72016f710>>();
+	};
+		// _Funcast_0x60_add_new_reader_macro_76555ac8104a9344
+		aotLib[0x8527f344a45bc8b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , regex_boost::RegexReader * const   ),&_Funcast_0x60_add_new_reader_macro_76555ac8104a9344>>();
+	};
+		// _Funcast_0x60_make_reader_macro_d91a0555e1997288
+		aotLib[0x492ba9b023b13f4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ReaderMacro> (*) ( Context * __context__, char * const  , regex_boost::RegexReader * const   ),&_Funcast_0x60_make_reader_macro_d91a0555e1997288>>();
+	};
+		// _Funcbuiltin_0x60_finalize_6dda7ea5f2695554
+		aotLib[0xb076ff460383fbc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> &  ),&_Funcbuiltin_0x60_finalize_6dda7ea5f2695554>>();
+	};
+		// finalize_1db505b7ad774ab5
+		aotLib[0x4bc36dc46e50113d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<16,range,char *> &  ),&finalize_1db505b7ad774ab5>>();
+	};
+		// finalize_1eb5223d00df51b5
+		aotLib[0xed67f652b9ae819] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&finalize_1eb5223d00df51b5>>();
+	};
+		// finalize_a3a001a249ad2764
+		aotLib[0xeb809fe3791934f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex_boost::RegexReader &  ),&finalize_a3a001a249ad2764>>();
+	};
+		// _Funcrtti_0x60_class_info_c79d1a890c262745
+		aotLib[0x5bd7e6a0e41f4cd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, regex_boost::RegexReader const  &  ),&_Funcrtti_0x60_class_info_c79d1a890c262745>>();
+	};
+		// [[ init script ]]
+		aotLib[0xc9ffe54e955cae0b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
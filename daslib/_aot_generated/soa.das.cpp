@@ -0,0 +1,4027 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require soa
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__713aafe3;
+extern StructInfo __struct_info__476d1163;
+extern StructInfo __struct_info__d8299e85;
+extern StructInfo __struct_info__55a47493;
+extern StructInfo __struct_info__77bf9876;
+extern StructInfo __struct_info__5ed6db18;
+extern TypeInfo __type_info__10db1c1d;
+extern TypeInfo __type_info__da50b805;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__f42f651e;
+extern TypeInfo __type_info__dc52e0d5;
+extern TypeInfo __type_info__c0e5e0ad;
+extern TypeInfo __type_info__8bc5634d;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__bab365e;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__3737d9d1;
+extern TypeInfo __type_info__cd849a9b;
+extern TypeInfo __type_info__aaadd575;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__c2b9b42c;
+extern TypeInfo __type_info__6f381053;
+extern TypeInfo __type_info__261bce6f;
+extern TypeInfo __type_info__dd644f60;
+extern TypeInfo __type_info__e749bd33;
+extern TypeInfo __type_info__73c8114e;
+extern TypeInfo __type_info__7da04467;
+extern TypeInfo __type_info__b1ceb1d4;
+extern TypeInfo __type_info__653ef983;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__1cb4fa6d;
+extern TypeInfo __type_info__515c0a3;
+extern TypeInfo __type_info__ccb7c90a;
+extern TypeInfo __type_info__b3bcfd53;
+extern TypeInfo __type_info__46fed0f3;
+extern TypeInfo __type_info__523f6667;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6d1d425d;
+extern TypeInfo __type_info__ebcc21eb;
+extern TypeInfo __type_info__5ef84086;
+extern TypeInfo __type_info__7a1c4eb7;
+extern TypeInfo __type_info__2b3e54e5;
+extern TypeInfo __type_info__4de83811;
+extern TypeInfo __type_info__94ae69a3;
+extern TypeInfo __type_info__87a6e894;
+extern TypeInfo __type_info__a703f317;
+extern TypeInfo __type_info__a6a527e0;
+extern TypeInfo __type_info__f494d7e5;
+extern TypeInfo __type_info__83498580;
+extern TypeInfo __type_info__a960d6ab;
+extern TypeInfo __type_info__b108e3;
+extern TypeInfo __type_info__d7eb08f1;
+extern TypeInfo __type_info__f486e881;
+extern TypeInfo __type_info__fdd27932;
+extern TypeInfo __type_info__1683ec13;
+extern TypeInfo __type_info__1d5a02b1;
+extern TypeInfo __type_info__8f8da119;
+extern TypeInfo __type_info__5bc565f1;
+extern TypeInfo __type_info__819d499d;
+extern TypeInfo __type_info__81be117c;
+extern TypeInfo __type_info__b5d7ce5d;
+extern TypeInfo __type_info__32f7a66b;
+extern TypeInfo __type_info__cae7a171;
+extern TypeInfo __type_info__453f3d02;
+extern TypeInfo __type_info__30023ebb;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4edf488d;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8fce7587;
+extern TypeInfo __type_info__a01f8605;
+extern TypeInfo __type_info__15780d4b;
+extern TypeInfo __type_info__7ec0323f;
+extern TypeInfo __type_info__ae076c;
+extern TypeInfo __type_info__ff9fd5d3;
+extern TypeInfo __type_info__3c4f7906;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__c4ccbb7e;
+extern TypeInfo __type_info__8e3dc326;
+extern TypeInfo __type_info__d73ee2dd;
+extern TypeInfo __type_info__72ae9081;
+extern TypeInfo __type_info__c831b26a;
+extern TypeInfo __type_info__72374920;
+extern TypeInfo __type_info__d25748d6;
+extern TypeInfo __type_info__3a70d70f;
+extern TypeInfo __type_info__7c510f91;
+extern TypeInfo __type_info__b66d9ef1;
+extern TypeInfo __type_info__91c4dfb3;
+extern TypeInfo __type_info__15e14f92;
+extern TypeInfo __type_info__ebc70931;
+extern TypeInfo __type_info__3c8fd4b4;
+extern TypeInfo __type_info__b87fa7e0;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__8891fc55;
+extern TypeInfo __type_info__7ebfa292;
+extern TypeInfo __type_info__9773df12;
+extern TypeInfo __type_info__317f8d25;
+extern TypeInfo __type_info__3c6fa07f;
+extern TypeInfo __type_info__9920ba3b;
+extern TypeInfo __type_info__8f234b97;
+extern TypeInfo __type_info__87882376;
+extern TypeInfo __type_info__5f6a7cad;
+extern TypeInfo __type_info__10b7decc;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8494e015;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b867c43d;
+extern TypeInfo __type_info__9e20c21a;
+extern TypeInfo __type_info__b9491240;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__963c776b;
+extern TypeInfo __type_info__b58fe8a6;
+extern TypeInfo __type_info__5527f9ed;
+extern TypeInfo __type_info__fba33907;
+extern TypeInfo __type_info__51c55633;
+extern TypeInfo __type_info__84917dd0;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__68f47b8a;
+extern TypeInfo __type_info__34157e23;
+extern TypeInfo __type_info__37ca469d;
+extern TypeInfo __type_info__14c14bf4;
+extern TypeInfo __type_info__4fa9a2d8;
+extern TypeInfo __type_info__d4f3571c;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__10edfe53;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__2481035b;
+extern TypeInfo __type_info__a1ba446d;
+extern TypeInfo __type_info__9fee7340;
+extern TypeInfo __type_info__ada7aa90;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__664a2fe7;
+extern TypeInfo __type_info__655bd8a4;
+extern TypeInfo __type_info__2f1bdc9a;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__5dc56917;
+extern TypeInfo __type_info__d16acbbb;
+extern TypeInfo __type_info__d4aee91;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__d057deb9;
+extern TypeInfo __type_info__6dd946fa;
+extern TypeInfo __type_info__32b24044;
+extern TypeInfo __type_info__531e5432;
+extern TypeInfo __type_info__e0a995b4;
+extern TypeInfo __type_info__368fac4c;
+extern TypeInfo __type_info__df40cfd6;
+extern TypeInfo __type_info__76b8ad03;
+extern TypeInfo __type_info__48d9d78;
+extern TypeInfo __type_info__6535171f;
+extern TypeInfo __type_info__9ee277f5;
+extern TypeInfo __type_info__e7b89eff;
+extern TypeInfo __type_info__8f8b0275;
+extern TypeInfo __type_info__764dc75a;
+extern TypeInfo __type_info__e2deda56;
+extern TypeInfo __type_info__5a28d785;
+extern TypeInfo __type_info__9445fbcf;
+extern TypeInfo __type_info__7df5ef2c;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__6c2a86f9;
+extern TypeInfo __type_info__e97755bb;
+extern TypeInfo __type_info__295e937b;
+extern TypeInfo __type_info__1d3d6764;
+extern TypeInfo __type_info__251bccdc;
+extern TypeInfo __type_info__bd757ca;
+extern TypeInfo __type_info__5ac5645e;
+extern TypeInfo __type_info__e4d4c1e4;
+extern TypeInfo __type_info__d514cba4;
+extern TypeInfo __type_info__60d19370;
+extern TypeInfo __type_info__c5ddc6fa;
+extern TypeInfo __type_info__9f20c3ad;
+extern TypeInfo __type_info__1b3c6d8d;
+extern TypeInfo __type_info__6529db2b;
+extern TypeInfo __type_info__a8d37f6f;
+extern TypeInfo __type_info__d7ddca10;
+extern TypeInfo __type_info__130d26f9;
+extern TypeInfo __type_info__721467d3;
+extern TypeInfo __type_info__8728109a;
+extern TypeInfo __type_info__1bb5fdf7;
+extern TypeInfo __type_info__a65edd74;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__5ca338ad;
+extern TypeInfo __type_info__d180e781;
+extern TypeInfo __type_info__74b0f2db;
+extern TypeInfo __type_info__cf57dd26;
+extern TypeInfo __type_info__535415eb;
+extern TypeInfo __type_info__ccc9122b;
+extern TypeInfo __type_info__b2cb4a2b;
+extern TypeInfo __type_info__a5b6b194;
+extern TypeInfo __type_info__ccee123b;
+extern TypeInfo __type_info__374b4b09;
+extern TypeInfo __type_info__9338185;
+extern TypeInfo __type_info__cf52b1be;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__9a5b5986;
+extern TypeInfo __type_info__7856e79d;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__5f1adc0e;
+extern TypeInfo __type_info__cd57da00;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__a8981616;
+extern TypeInfo __type_info__88de8728;
+extern TypeInfo __type_info__1b9f61f8;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__231bc9b6;
+extern TypeInfo __type_info__8121e453;
+extern TypeInfo __type_info__d3ebcc43;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__d8ac9e75;
+extern TypeInfo __type_info__fc0d99dd;
+extern TypeInfo __type_info__c1e3d526;
+extern TypeInfo __type_info__c627fc0a;
+extern TypeInfo __type_info__a40a0d70;
+extern TypeInfo __type_info__858d2368;
+extern TypeInfo __type_info__26379cda;
+extern TypeInfo __type_info__c6cb0399;
+extern TypeInfo __type_info__f66d4d6;
+extern TypeInfo __type_info__fe4bfa47;
+extern TypeInfo __type_info__cb3ec93c;
+extern TypeInfo __type_info__27a9a437;
+extern TypeInfo __type_info__374bcd9;
+extern TypeInfo __type_info__39dd41c1;
+extern TypeInfo __type_info__d00bb3d6;
+extern TypeInfo __type_info__f1eeff10;
+extern TypeInfo __type_info__b081465d;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__cf76cec3;
+extern TypeInfo __type_info__be386f7a;
+extern TypeInfo __type_info__ed20bab;
+extern TypeInfo __type_info__309172d;
+extern VarInfo __var_info__21dc0f2b;
+extern VarInfo __var_info__15f87590;
+extern VarInfo __var_info__17b491;
+extern VarInfo __var_info__aefafc88;
+extern VarInfo __var_info__14bcb702;
+extern VarInfo __var_info__bc8f6ccd;
+extern VarInfo __var_info__40c8885b;
+extern VarInfo __var_info__6e97f0ea;
+extern VarInfo __var_info__11aeae1c;
+extern VarInfo __var_info__e7eb1ef9;
+extern VarInfo __var_info__3e3c759c;
+extern VarInfo __var_info__a1981da5;
+extern VarInfo __var_info__6f4d2d82;
+extern VarInfo __var_info__8965dfd1;
+extern VarInfo __var_info__2d5905b8;
+extern VarInfo __var_info__442b5d7f;
+extern VarInfo __var_info__e5425fa9;
+extern VarInfo __var_info__d4f9c662;
+extern VarInfo __var_info__fde3ac29;
+extern VarInfo __var_info__7607b7d3;
+extern VarInfo __var_info__d6c089cc;
+extern VarInfo __var_info__301336b9;
+extern VarInfo __var_info__d9a2ecfa;
+extern VarInfo __var_info__d561f037;
+extern VarInfo __var_info__eca62802;
+extern VarInfo __var_info__381761b7;
+extern VarInfo __var_info__a92f607e;
+extern VarInfo __var_info__545fa127;
+extern VarInfo __var_info__c84acfc5;
+extern VarInfo __var_info__7c486554;
+extern VarInfo __var_info__388eeafe;
+extern VarInfo __var_info__cdd492ca;
+extern VarInfo __var_info__7b75bbc7;
+extern VarInfo __var_info__128e68c7;
+extern VarInfo __var_info__35e4f53d;
+extern VarInfo __var_info__1b67d13a;
+extern VarInfo __var_info__98dc5351;
+extern VarInfo __var_info__de11b7cd;
+extern VarInfo __var_info__f3715aaa;
+extern VarInfo __var_info__db853894;
+extern VarInfo __var_info__24d03a3;
+extern VarInfo __var_info__267ea89b;
+extern VarInfo __var_info__7bab1cb8;
+extern VarInfo __var_info__e1903c80;
+extern VarInfo __var_info__99ce4b7;
+extern VarInfo __var_info__f7387f87;
+extern VarInfo __var_info__ad5a0405;
+extern VarInfo __var_info__dc98492c;
+extern VarInfo __var_info__a5daa336;
+extern VarInfo __var_info__f902c2de;
+extern VarInfo __var_info__6758a118;
+extern VarInfo __var_info__215e3c49;
+extern VarInfo __var_info__10557067;
+extern VarInfo __var_info__3b14171a;
+extern VarInfo __var_info__ebf48ac4;
+extern VarInfo __var_info__c77b45f7;
+extern VarInfo __var_info__e3a81c3e;
+extern VarInfo __var_info__e61a9508;
+extern VarInfo __var_info__4523a9da;
+extern VarInfo __var_info__148a69c2;
+extern VarInfo __var_info__228f51fa;
+extern VarInfo __var_info__a5d240e5;
+extern VarInfo __var_info__359e840f;
+extern VarInfo __var_info__ac40f6e7;
+extern VarInfo __var_info__80719338;
+extern VarInfo __var_info__d1222c0d;
+extern VarInfo __var_info__6d3d92b1;
+extern VarInfo __var_info__988afcfd;
+extern VarInfo __var_info__57dbac08;
+extern VarInfo __var_info__dc873d46;
+extern VarInfo __var_info__f3b76373;
+extern VarInfo __var_info__17789cd8;
+extern VarInfo __var_info__d11ed6d8;
+extern VarInfo __var_info__9d935f60;
+extern VarInfo __var_info__641ef8a0;
+extern VarInfo __var_info__3ef8faa2;
+extern VarInfo __var_info__943bf7fd;
+extern VarInfo __var_info__2eb68aac;
+extern VarInfo __var_info__d811ae5b;
+extern VarInfo __var_info__7e833523;
+extern VarInfo __var_info__80289013;
+extern VarInfo __var_info__6eaa7d50;
+extern VarInfo __var_info__626630f9;
+extern VarInfo __var_info__284e759;
+extern VarInfo __var_info__9cd677e8;
+extern VarInfo __var_info__cb496173;
+extern VarInfo __var_info__a8494a7a;
+extern VarInfo __var_info__2663c954;
+extern VarInfo __var_info__90ad04bc;
+extern VarInfo __var_info__57381fc4;
+extern VarInfo __var_info__2cbdc12a;
+extern VarInfo __var_info__ebe05fd5;
+extern VarInfo __var_info__5fa7d37b;
+extern VarInfo __var_info__f787ea3c;
+extern VarInfo __var_info__ab86735f;
+extern VarInfo __var_info__f447abf0;
+extern VarInfo __var_info__3faadbe1;
+extern VarInfo __var_info__9a81e2b9;
+extern VarInfo __var_info__915cd895;
+extern VarInfo __var_info__c8e5f55;
+extern VarInfo __var_info__9d59dc9b;
+extern VarInfo __var_info__fa998a5f;
+extern VarInfo __var_info__8369fc91;
+extern VarInfo __var_info__31003f6c;
+extern VarInfo __var_info__4ea380c9;
+extern VarInfo __var_info__5b5aed7e;
+extern VarInfo __var_info__ebfba41f;
+extern VarInfo __var_info__35318804;
+extern VarInfo __var_info__7ea03b0a;
+extern VarInfo __var_info__3f5db93a;
+extern VarInfo __var_info__d0c22ee;
+extern VarInfo __var_info__c3059e01;
+extern VarInfo __var_info__fb800a69;
+extern VarInfo __var_info__e01a8b96;
+extern VarInfo __var_info__345035e;
+extern VarInfo __var_info__e7a181e5;
+extern VarInfo __var_info__987deaed;
+extern VarInfo __var_info__e8f2b3b;
+extern VarInfo __var_info__56bc3b31;
+extern VarInfo __var_info__1edc59e4;
+extern VarInfo __var_info__e85d642a;
+extern VarInfo __var_info__123f4c77;
+extern VarInfo __var_info__a433d831;
+extern VarInfo __var_info__baf99fcf;
+extern VarInfo __var_info__cafe3512;
+extern VarInfo __var_info__c55061;
+extern VarInfo __var_info__16998229;
+extern VarInfo __var_info__c740cbba;
+extern VarInfo __var_info__fcdb84a;
+extern VarInfo __var_info__ad56015e;
+extern VarInfo __var_info__a0ed1634;
+extern VarInfo __var_info__cb3eecea;
+extern VarInfo __var_info__5bede5bc;
+extern VarInfo __var_info__344d19dc;
+extern VarInfo __var_info__4c957b89;
+extern VarInfo __var_info__dd9eb3e;
+extern VarInfo __var_info__884f50b1;
+extern VarInfo __var_info__cb50360b;
+extern VarInfo __var_info__85a87973;
+extern VarInfo __var_info__7a69d2c9;
+extern VarInfo __var_info__e3525bda;
+extern VarInfo __var_info__c35127d9;
+extern VarInfo __var_info__ba8cda98;
+extern VarInfo __var_info__2f8a192d;
+extern VarInfo __var_info__2dbd7de1;
+extern VarInfo __var_info__e4dec3a3;
+extern VarInfo __var_info__999f9e51;
+extern VarInfo __var_info__5abb5a86;
+extern VarInfo __var_info__7ebcbe55;
+extern VarInfo __var_info__9abc223a;
+extern VarInfo __var_info__43f7c55f;
+extern VarInfo __var_info__6eb30d52;
+extern VarInfo __var_info__94643ea5;
+extern VarInfo __var_info__955e0b53;
+extern VarInfo __var_info__491e734a;
+extern VarInfo __var_info__52c5da8;
+extern VarInfo __var_info__1f78c3bf;
+extern VarInfo __var_info__bb18d055;
+extern VarInfo __var_info__5e90f2e0;
+extern VarInfo __var_info__ae8a6712;
+extern VarInfo __var_info__159c68d2;
+extern VarInfo __var_info__f25a787;
+extern VarInfo __var_info__3924c25d;
+extern VarInfo __var_info__b2b960b1;
+extern VarInfo __var_info__f693aed4;
+extern VarInfo __var_info__9a902e68;
+extern VarInfo __var_info__4048a67e;
+extern VarInfo __var_info__88bd350e;
+extern VarInfo __var_info__7cfe7756;
+extern VarInfo __var_info__951d07d4;
+extern VarInfo __var_info__1f670b1f;
+extern VarInfo __var_info__89b1ed2f;
+extern VarInfo __var_info__ed636a01;
+extern VarInfo __var_info__134ae51;
+extern VarInfo __var_info__ad464f32;
+extern VarInfo __var_info__89674fa1;
+extern VarInfo __var_info__dfbbbe7e;
+extern VarInfo __var_info__f5e3c211;
+extern VarInfo __var_info__182a4292;
+extern VarInfo __var_info__989f9cbe;
+extern VarInfo __var_info__7050e891;
+extern VarInfo __var_info__c9d28329;
+extern VarInfo __var_info__b69afd24;
+extern VarInfo __var_info__d132dff3;
+extern VarInfo __var_info__754e508d;
+extern VarInfo __var_info__f73d4e52;
+extern VarInfo __var_info__c4a28f5d;
+extern VarInfo __var_info__a2e64a16;
+extern VarInfo __var_info__2965e55d;
+extern VarInfo __var_info__a6016d01;
+extern VarInfo __var_info__d15980dd;
+extern VarInfo __var_info__a80e5f39;
+extern VarInfo __var_info__2612c8ac;
+extern VarInfo __var_info__575beb97;
+extern VarInfo __var_info__88b468bd;
+extern VarInfo __var_info__d676fdc3;
+extern VarInfo __var_info__ac1f0992;
+extern VarInfo __var_info__f502f93d;
+extern VarInfo __var_info__a48d413a;
+extern VarInfo __var_info__d2d0dc3c;
+extern VarInfo __var_info__cbd679f5;
+extern VarInfo __var_info__4bbc29e0;
+extern VarInfo __var_info__2f87634a;
+extern VarInfo __var_info__880f2249;
+extern VarInfo __var_info__fc3d5bad;
+extern VarInfo __var_info__ce877190;
+extern VarInfo __var_info__9587f22d;
+extern VarInfo __var_info__978d6552;
+extern VarInfo __var_info__65ca1220;
+extern VarInfo __var_info__1c56de;
+extern VarInfo __var_info__35721f8f;
+extern VarInfo __var_info__9f981a7f;
+extern VarInfo __var_info__d6bd6ae8;
+extern VarInfo __var_info__23f1edc0;
+extern VarInfo __var_info__f3ae166d;
+extern VarInfo __var_info__67cfaaa3;
+extern VarInfo __var_info__1383e2a3;
+extern VarInfo __var_info__3c1f53f3;
+extern VarInfo __var_info__fbc56d3f;
+extern VarInfo __var_info__e71a969b;
+extern VarInfo __var_info__27f20dd9;
+extern VarInfo __var_info__37233ab;
+extern VarInfo __var_info__7a6458b4;
+extern VarInfo __var_info__7208fe79;
+extern VarInfo __var_info__fb9939a9;
+extern VarInfo __var_info__9b9fa177;
+extern VarInfo __var_info__5e4631a1;
+extern VarInfo __var_info__a10f6f08;
+extern VarInfo __var_info__d193f2b5;
+extern VarInfo __var_info__59a80c5a;
+extern VarInfo __var_info__8647be56;
+extern VarInfo __var_info__a0578de2;
+extern VarInfo __var_info__3012d86a;
+extern VarInfo __var_info__8644430a;
+extern VarInfo __var_info__c89fb3c8;
+extern VarInfo __var_info__55e7ce8c;
+extern VarInfo __var_info__f2348094;
+extern VarInfo __var_info__118e6734;
+extern VarInfo __var_info__6c08a2e5;
+extern VarInfo __var_info__827a7b9f;
+extern VarInfo __var_info__d295ffd4;
+extern VarInfo __var_info__c33efd7;
+extern VarInfo __var_info__21588a7a;
+extern VarInfo __var_info__2712ca3f;
+extern VarInfo __var_info__ec1a9e7a;
+extern VarInfo __var_info__aa30df58;
+extern VarInfo __var_info__b35acbb;
+extern VarInfo __var_info__336416a7;
+extern VarInfo __var_info__cc0f5e2c;
+extern VarInfo __var_info__503d22cb;
+extern VarInfo __var_info__64f4b569;
+extern VarInfo __var_info__70fd4e8e;
+extern VarInfo __var_info__ced10202;
+extern VarInfo __var_info__fa8008d6;
+extern VarInfo __var_info__c6bf2bd2;
+extern VarInfo __var_info__2d3a4cbf;
+extern VarInfo __var_info__136906a;
+extern VarInfo __var_info__dfbb50cb;
+extern VarInfo __var_info__3f48a4eb;
+extern VarInfo __var_info__fbd35c53;
+extern VarInfo __var_info__a9b0cc55;
+extern VarInfo __var_info__a246be3c;
+extern VarInfo __var_info__6d5c4cbf;
+extern VarInfo __var_info__e95012d3;
+extern VarInfo __var_info__6fc12b47;
+extern VarInfo __var_info__8e6ce11a;
+extern VarInfo __var_info__7a87bd0e;
+extern VarInfo __var_info__919eabb1;
+extern VarInfo __var_info__4b48f5cf;
+extern VarInfo __var_info__1c77d1c2;
+extern VarInfo __var_info__12214d06;
+extern VarInfo __var_info__dbe74630;
+extern VarInfo __var_info__97b1c4ed;
+extern VarInfo __var_info__8bdcb526;
+extern VarInfo __var_info__a0d20d9c;
+extern VarInfo __var_info__7df6e782;
+extern VarInfo __var_info__aaec7954;
+extern VarInfo __var_info__445534ca;
+extern VarInfo __var_info__772c0f1c;
+extern VarInfo __var_info__9b48f5d;
+extern VarInfo __var_info__bd3bde81;
+extern VarInfo __var_info__7f5b17d4;
+extern VarInfo __var_info__ef7d3016;
+extern VarInfo __var_info__cdf950db;
+extern VarInfo __var_info__e75da665;
+extern VarInfo __var_info__95f8f548;
+extern VarInfo __var_info__137fa837;
+extern VarInfo __var_info__86457fbf;
+extern VarInfo __var_info__5afbb756;
+extern VarInfo __var_info__cb901576;
+extern VarInfo __var_info__a10a361e;
+extern VarInfo __var_info__171280cf;
+extern VarInfo __var_info__f891e8e9;
+extern VarInfo __var_info__e4eb34d9;
+extern VarInfo __var_info__b632464e;
+extern VarInfo __var_info__85473ce6;
+extern VarInfo __var_info__1db39b29;
+extern VarInfo __var_info__9e9818ec;
+extern VarInfo __var_info__e6a0bda4;
+extern VarInfo __var_info__7df46418;
+extern VarInfo __var_info__271e6109;
+extern VarInfo __var_info__9af19895;
+extern VarInfo __var_info__221ec580;
+extern VarInfo __var_info__fb05f748;
+extern VarInfo __var_info__57bc3cc4;
+extern VarInfo __var_info__c053d161;
+extern VarInfo __var_info__392717d5;
+extern VarInfo __var_info__b8ba8abc;
+extern VarInfo __var_info__e49698a1;
+extern VarInfo __var_info__b873b4e2;
+extern VarInfo __var_info__64bce7f2;
+extern VarInfo __var_info__89c64b37;
+extern VarInfo __var_info__ac29e6b9;
+extern VarInfo __var_info__56569ad4;
+extern VarInfo __var_info__89e422d2;
+extern VarInfo __var_info__b0a906b6;
+extern VarInfo __var_info__cfe854bb;
+extern VarInfo __var_info__e78e1ae9;
+extern VarInfo __var_info__1bbde4e9;
+extern VarInfo __var_info__5ec67f5e;
+extern VarInfo __var_info__9b78bd2b;
+extern VarInfo __var_info__822a0a6f;
+extern VarInfo __var_info__da8e5bea;
+extern VarInfo __var_info__399c1f32;
+extern VarInfo __var_info__4396b97c;
+extern VarInfo __var_info__f1675330;
+extern VarInfo __var_info__63a3eac;
+extern VarInfo __var_info__3bbe5820;
+extern VarInfo __var_info__9bd0e54c;
+extern VarInfo __var_info__85616c49;
+extern VarInfo __var_info__d60f6d87;
+extern VarInfo __var_info__c2ec29d8;
+extern VarInfo __var_info__52a36b89;
+extern VarInfo __var_info__e8005be5;
+extern VarInfo __var_info__f2f1d3aa;
+extern VarInfo __var_info__9981e126;
+extern VarInfo __var_info__c9e983b7;
+extern VarInfo __var_info__3e48a358;
+extern VarInfo __var_info__6b82a61e;
+extern VarInfo __var_info__25f52395;
+extern VarInfo __var_info__91c6225a;
+extern VarInfo __var_info__5532d30;
+extern VarInfo __var_info__9edcbce;
+extern VarInfo __var_info__59156306;
+extern VarInfo __var_info__8f9f8e93;
+extern VarInfo __var_info__52ff6128;
+extern VarInfo __var_info__5fc680f1;
+extern VarInfo __var_info__dcc2db67;
+extern VarInfo __var_info__c32d1370;
+extern VarInfo __var_info__c7c8482d;
+extern VarInfo __var_info__bb163ec9;
+extern VarInfo __var_info__a14c8807;
+extern VarInfo __var_info__f9ec2860;
+extern VarInfo __var_info__d7a0c00a;
+extern VarInfo __var_info__1d7f511f;
+extern VarInfo __var_info__69dafa2d;
+extern VarInfo __var_info__d62685b2;
+extern VarInfo __var_info__5298a342;
+extern VarInfo __var_info__1106472f;
+extern VarInfo __var_info__10bf88c5;
+extern VarInfo __var_info__6650d8d3;
+extern VarInfo __var_info__5a979a8b;
+extern VarInfo __var_info__1c9914bb;
+extern VarInfo __var_info__f4999d8b;
+extern VarInfo __var_info__6fb30ee5;
+extern VarInfo __var_info__39d61341;
+extern VarInfo __var_info__6521e890;
+extern VarInfo __var_info__b5d2e047;
+extern VarInfo __var_info__2867194a;
+extern VarInfo __var_info__92e3d111;
+extern VarInfo __var_info__57cab833;
+extern VarInfo __var_info__a6e52524;
+extern VarInfo __var_info__8254701f;
+extern VarInfo __var_info__e7e29820;
+extern VarInfo __var_info__554a21ae;
+extern VarInfo __var_info__6c50e245;
+extern VarInfo __var_info__69c65b46;
+extern VarInfo __var_info__9cd84da2;
+extern VarInfo __var_info__be271e3a;
+extern VarInfo __var_info__67dfe9d3;
+extern VarInfo __var_info__4d5e247c;
+extern VarInfo __var_info__2367116b;
+extern VarInfo __var_info__187a9288;
+extern VarInfo __var_info__afac4da3;
+extern VarInfo __var_info__5938ed57;
+extern VarInfo __var_info__1dd0d240;
+extern VarInfo __var_info__dcd95cf7;
+extern VarInfo __var_info__1fff0112;
+extern VarInfo __var_info__a71516f4;
+extern VarInfo __var_info__7447bb4f;
+extern VarInfo __var_info__915be3cd;
+extern VarInfo __var_info__b74f83af;
+extern VarInfo __var_info__c5f99f7a;
+extern VarInfo __var_info__52fab456;
+extern VarInfo __var_info__a0ecfbb9;
+extern VarInfo __var_info__75442797;
+extern VarInfo __var_info__c53e4eed;
+extern VarInfo __var_info__149d1ff;
+extern VarInfo __var_info__3043b2c;
+extern VarInfo __var_info__bac4281b;
+extern VarInfo __var_info__4d168161;
+extern VarInfo __var_info__d0edde97;
+extern VarInfo __var_info__66cbf328;
+extern VarInfo __var_info__1c90ae44;
+extern VarInfo __var_info__8b73a850;
+extern VarInfo __var_info__490512e0;
+extern VarInfo __var_info__afd807ea;
+extern VarInfo __var_info__757540b8;
+extern VarInfo __var_info__4830da26;
+extern VarInfo __var_info__8734b689;
+extern VarInfo __var_info__75c92fd3;
+extern VarInfo __var_info__e3083f3d;
+extern VarInfo __var_info__9356e5ba;
+extern VarInfo __var_info__90a51465;
+extern VarInfo __var_info__c93a2179;
+extern VarInfo __var_info__1f7693d8;
+extern VarInfo __var_info__e9632d3b;
+extern VarInfo __var_info__2f133526;
+extern VarInfo __var_info__9d621ee9;
+extern VarInfo __var_info__f25fabc1;
+extern VarInfo __var_info__78bcb4df;
+extern VarInfo __var_info__6da7e6d7;
+extern VarInfo __var_info__e1345261;
+extern VarInfo __var_info__8f4c9038;
+extern VarInfo __var_info__6c97d67;
+extern VarInfo __var_info__d5146090;
+extern VarInfo __var_info__134dd6bf;
+extern VarInfo __var_info__21f91cf0;
+extern VarInfo __var_info__af8479d4;
+extern VarInfo __var_info__d711acc8;
+extern VarInfo __var_info__9f3db861;
+extern VarInfo __var_info__d9ea88c0;
+extern VarInfo __var_info__c93f0085;
+extern VarInfo __var_info__5aa52d1f;
+extern VarInfo __var_info__1e070140;
+extern VarInfo __var_info__2c383e55;
+extern VarInfo __var_info__6c244ef1;
+extern VarInfo __var_info__43b9e565;
+extern VarInfo __var_info__ae8d05f1;
+extern VarInfo __var_info__b08b6929;
+extern VarInfo __var_info__83de2c5f;
+extern VarInfo __var_info__da19e72c;
+extern VarInfo __var_info__7acd6d0b;
+extern VarInfo __var_info__ba5333e6;
+extern VarInfo __var_info__27764678;
+extern VarInfo __var_info__6dbb285b;
+extern VarInfo __var_info__57879e66;
+extern VarInfo __var_info__cc02d1d4;
+extern VarInfo __var_info__2f90ec93;
+extern VarInfo __var_info__83d50dee;
+extern VarInfo __var_info__19b2e566;
+extern VarInfo __var_info__a74c85b9;
+extern VarInfo __var_info__717f8e67;
+extern VarInfo __var_info__2af4d3dc;
+extern VarInfo __var_info__da29973a;
+extern VarInfo __var_info__23fa073a;
+extern VarInfo __var_info__a343220e;
+extern VarInfo __var_info__729d3793;
+extern VarInfo __var_info__7b134191;
+extern VarInfo __var_info__108e65a1;
+extern VarInfo __var_info__6550d740;
+extern VarInfo __var_info__20b5a83;
+extern VarInfo __var_info__b7d4d4bf;
+extern VarInfo __var_info__89631998;
+extern VarInfo __var_info__a216b644;
+extern VarInfo __var_info__5fa0ff2d;
+extern VarInfo __var_info__a42b136c;
+extern VarInfo __var_info__25c0eaac;
+extern VarInfo __var_info__e51104e3;
+extern VarInfo __var_info__a6d304fb;
+extern VarInfo __var_info__888bf034;
+extern VarInfo __var_info__1ad4800e;
+extern VarInfo __var_info__5be9ff7e;
+extern VarInfo __var_info__fdc2b8d7;
+extern VarInfo __var_info__ed1914f;
+extern VarInfo __var_info__24c62fdb;
+extern VarInfo __var_info__7705b54f;
+extern VarInfo __var_info__ebd6bd76;
+extern VarInfo __var_info__c1c5d10e;
+extern VarInfo __var_info__d2199019;
+extern VarInfo __var_info__9794b2fb;
+extern VarInfo __var_info__d6146223;
+extern VarInfo __var_info__319243ae;
+extern VarInfo __var_info__fd800d8f;
+extern VarInfo __var_info__169d2283;
+extern VarInfo __var_info__91427b33;
+extern VarInfo __var_info__51f34505;
+extern VarInfo __var_info__546203a;
+extern VarInfo __var_info__409e1923;
+extern VarInfo __var_info__3113384c;
+extern VarInfo __var_info__1eb24d9e;
+extern VarInfo __var_info__e44e1dcd;
+extern VarInfo __var_info__327e2124;
+extern VarInfo __var_info__c66f65f;
+extern VarInfo __var_info__ebb0b9dc;
+extern VarInfo __var_info__35133e98;
+extern VarInfo __var_info__9881df93;
+extern VarInfo __var_info__36bf6516;
+extern VarInfo __var_info__3021cb;
+extern VarInfo __var_info__31557040;
+extern VarInfo __var_info__ffd9fe3a;
+extern VarInfo __var_info__2c75bc93;
+extern VarInfo __var_info__2636b5f4;
+extern VarInfo __var_info__55bc399e;
+extern VarInfo __var_info__8d50ee2d;
+extern VarInfo __var_info__af00471;
+extern VarInfo __var_info__624b3d52;
+extern VarInfo __var_info__2a02779d;
+extern VarInfo __var_info__6cb30a2c;
+extern VarInfo __var_info__7776bab9;
+extern VarInfo __var_info__e9e73a57;
+extern VarInfo __var_info__29671add;
+extern VarInfo __var_info__14560d95;
+extern VarInfo __var_info__ee0efbc3;
+extern VarInfo __var_info__cea9756b;
+extern VarInfo __var_info__2412c586;
+extern VarInfo __var_info__b569a2ab;
+extern VarInfo __var_info__ea5d24a1;
+extern VarInfo __var_info__cc33673d;
+extern VarInfo __var_info__8069ca0f;
+extern VarInfo __var_info__aba9b214;
+extern VarInfo __var_info__3cb36c5c;
+extern VarInfo __var_info__a4a00a80;
+extern VarInfo __var_info__714fae6e;
+extern VarInfo __var_info__365edb51;
+extern VarInfo __var_info__2f4c15d8;
+extern VarInfo __var_info__d11ddf1;
+extern VarInfo __var_info__17bf2274;
+extern VarInfo __var_info__6bfbb18c;
+extern VarInfo __var_info__94bb64af;
+extern VarInfo __var_info__3a64130e;
+extern VarInfo __var_info__d407980f;
+extern VarInfo __var_info__6c164ebf;
+extern VarInfo __var_info__c985a48c;
+extern VarInfo __var_info__85eb4be6;
+extern VarInfo __var_info__1c524c4f;
+extern VarInfo __var_info__eee3bc09;
+extern VarInfo __var_info__f1edd27b;
+extern VarInfo __var_info__846d26c6;
+extern VarInfo __var_info__eb19ebf1;
+extern VarInfo __var_info__31ca940d;
+extern VarInfo __var_info__de2411c0;
+extern VarInfo __var_info__db146a02;
+extern VarInfo __var_info__88433070;
+extern VarInfo __var_info__a0702b69;
+extern VarInfo __var_info__4a66add7;
+extern VarInfo __var_info__c2023960;
+extern VarInfo __var_info__60c68284;
+extern VarInfo __var_info__fdcc980e;
+extern VarInfo __var_info__e5840522;
+extern VarInfo __var_info__9a94e224;
+extern VarInfo __var_info__531888d7;
+extern VarInfo __var_info__a2549a7a;
+extern VarInfo __var_info__d76915b6;
+extern VarInfo __var_info__da1fbddf;
+extern VarInfo __var_info__aff78d24;
+extern VarInfo __var_info__b8f0fdc9;
+extern VarInfo __var_info__12c1f55a;
+extern VarInfo __var_info__fa18d374;
+
+VarInfo __struct_info__713aafe3_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x159c68d2, "__rtti", 0 };
+TypeInfo * __type_info__43b9e565_arg_types_var_1899671523[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__713aafe3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43b9e565_arg_types_var_1899671523, nullptr, 1, 0, nullptr, 28, 0x43b9e565, "__finalize", 8 };
+TypeInfo * __type_info__1f78c3bf_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1f78c3bf_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0x1f78c3bf, "apply", 12 };
+TypeInfo * __type_info__cb901576_arg_types_var_1899671523[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__713aafe3_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb901576_arg_types_var_1899671523, nullptr, 5, 0, nullptr, 28, 0xcb901576, "finish", 16 };
+VarInfo * __struct_info__713aafe3_fields[4] =  { &__struct_info__713aafe3_field_0, &__struct_info__713aafe3_field_1, &__struct_info__713aafe3_field_2, &__struct_info__713aafe3_field_3 };
+StructInfo __struct_info__713aafe3 = {"AstStructureAnnotation", __struct_info__713aafe3_fields, 4, 24, -1, nullptr, 0x713aafe3 };
+VarInfo __struct_info__476d1163_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x624b3d52, "__rtti", 0 };
+TypeInfo * __type_info__e7a181e5_arg_types_var_1198330211[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__476d1163_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7a181e5_arg_types_var_1198330211, nullptr, 1, 0, nullptr, 28, 0xe7a181e5, "__finalize", 8 };
+TypeInfo * __type_info__fbc56d3f_arg_types_var_1198330211[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__476d1163_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__fbc56d3f_arg_types_var_1198330211, nullptr, 3, 0, nullptr, 28, 0xfbc56d3f, "apply", 12 };
+VarInfo * __struct_info__476d1163_fields[3] =  { &__struct_info__476d1163_field_0, &__struct_info__476d1163_field_1, &__struct_info__476d1163_field_2 };
+StructInfo __struct_info__476d1163 = {"SoaInferMacro", __struct_info__476d1163_fields, 3, 16, -1, nullptr, 0x476d1163 };
+VarInfo __struct_info__d8299e85_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0d240, "__rtti", 0 };
+TypeInfo * __type_info__1c9914bb_arg_types_var_3626606213[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__d8299e85_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c9914bb_arg_types_var_3626606213, nullptr, 1, 0, nullptr, 28, 0x1c9914bb, "__finalize", 8 };
+TypeInfo * __type_info__e1345261_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1345261_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe1345261, "preVisitProgram", 12 };
+TypeInfo * __type_info__f902c2de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f902c2de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf902c2de, "visitProgram", 16 };
+TypeInfo * __type_info__6d3d92b1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d3d92b1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d3d92b1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__7acd6d0b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7acd6d0b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7acd6d0b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9edcbce_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9edcbce_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9edcbce, "visitTypeDecl", 28 };
+TypeInfo * __type_info__4c957b89_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c957b89_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x4c957b89, "preVisitAlias", 32 };
+TypeInfo * __type_info__2cbdc12a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2cbdc12a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x2cbdc12a, "visitAlias", 36 };
+TypeInfo * __type_info__7ea03b0a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ea03b0a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7ea03b0a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__7607b7d3_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7607b7d3_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x7607b7d3, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__a92f607e_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a92f607e_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa92f607e, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__134ae51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__134ae51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x134ae51, "visitEnumeration", 52 };
+TypeInfo * __type_info__327e2124_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__327e2124_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x327e2124, "preVisitStructure", 56 };
+TypeInfo * __type_info__c2ec29d8_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2ec29d8_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc2ec29d8, "preVisitStructureField", 60 };
+TypeInfo * __type_info__e4eb34d9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4eb34d9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xe4eb34d9, "visitStructureField", 64 };
+TypeInfo * __type_info__6c97d67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__6c97d67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c97d67, "visitStructure", 68 };
+TypeInfo * __type_info__7447bb4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7447bb4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7447bb4f, "preVisitFunction", 72 };
+TypeInfo * __type_info__c6bf2bd2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__c6bf2bd2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc6bf2bd2, "visitFunction", 76 };
+TypeInfo * __type_info__63a3eac_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63a3eac_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x63a3eac, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__5fa0ff2d_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fa0ff2d_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5fa0ff2d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__ad56015e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad56015e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad56015e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f4999d8b_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4999d8b_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf4999d8b, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__f25a787_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25a787_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25a787, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__d76915b6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d76915b6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd76915b6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af00471_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af00471_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaf00471, "preVisitExpression", 104 };
+TypeInfo * __type_info__a246be3c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a246be3c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa246be3c, "visitExpression", 108 };
+TypeInfo * __type_info__2c383e55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c383e55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2c383e55, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__7a87bd0e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a87bd0e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7a87bd0e, "visitExprBlock", 116 };
+TypeInfo * __type_info__dc873d46_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc873d46_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdc873d46, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__f891e8e9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f891e8e9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf891e8e9, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5bede5bc_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5bede5bc_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5bede5bc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__4a66add7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4a66add7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4a66add7, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__b35acbb_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35acbb_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb35acbb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__d6c089cc_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6c089cc_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xd6c089cc, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__6fc12b47_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fc12b47_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6fc12b47, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__8644430a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8644430a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8644430a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__fde3ac29_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde3ac29_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xfde3ac29, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__89631998_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89631998_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x89631998, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__bd3bde81_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd3bde81_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbd3bde81, "preVisitExprLet", 160 };
+TypeInfo * __type_info__1c56de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c56de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c56de, "visitExprLet", 164 };
+TypeInfo * __type_info__4ea380c9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ea380c9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4ea380c9, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__d7a0c00a_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d7a0c00a_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xd7a0c00a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__dcd95cf7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcd95cf7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdcd95cf7, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__5e90f2e0_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e90f2e0_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5e90f2e0, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__284e759_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__284e759_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x284e759, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__554a21ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__554a21ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x554a21ae, "visitGlobalLet", 188 };
+TypeInfo * __type_info__a6016d01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6016d01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa6016d01, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__3b14171a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3b14171a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3b14171a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__78bcb4df_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bcb4df_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x78bcb4df, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__6521e890_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6521e890_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x6521e890, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__aefafc88_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aefafc88_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaefafc88, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__75c92fd3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__75c92fd3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x75c92fd3, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__6eaa7d50_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eaa7d50_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6eaa7d50, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ad5a0405_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad5a0405_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad5a0405, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__9356e5ba_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9356e5ba_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9356e5ba, "preVisitExprNew", 224 };
+TypeInfo * __type_info__c84acfc5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c84acfc5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc84acfc5, "visitExprNew", 228 };
+TypeInfo * __type_info__a9b0cc55_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b0cc55_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa9b0cc55, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__7cfe7756_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7cfe7756_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x7cfe7756, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__915be3cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__915be3cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x915be3cd, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__85473ce6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85473ce6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x85473ce6, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__345035e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__345035e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x345035e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__c053d161_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c053d161_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc053d161, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__359e840f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__359e840f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x359e840f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__c32d1370_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c32d1370_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc32d1370, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__31003f6c_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31003f6c_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x31003f6c, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__442b5d7f_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__442b5d7f_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x442b5d7f, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__11aeae1c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11aeae1c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x11aeae1c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__2965e55d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2965e55d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2965e55d, "visitExprCall", 276 };
+TypeInfo * __type_info__cdf950db_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf950db_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xcdf950db, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__a343220e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a343220e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa343220e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__ac29e6b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac29e6b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac29e6b9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__2663c954_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2663c954_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2663c954, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__f3715aaa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3715aaa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf3715aaa, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__bb163ec9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bb163ec9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbb163ec9, "preVisitExprAt", 300 };
+TypeInfo * __type_info__888bf034_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__888bf034_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x888bf034, "visitExprAt", 304 };
+TypeInfo * __type_info__43f7c55f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f7c55f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x43f7c55f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__aff78d24_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aff78d24_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaff78d24, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__880f2249_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__880f2249_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x880f2249, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__e1903c80_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1903c80_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xe1903c80, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__cc02d1d4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc02d1d4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcc02d1d4, "preVisitExprIs", 324 };
+TypeInfo * __type_info__7776bab9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7776bab9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7776bab9, "visitExprIs", 328 };
+TypeInfo * __type_info__3cb36c5c_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3cb36c5c_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3cb36c5c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__3f48a4eb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f48a4eb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f48a4eb, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9e9818ec_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e9818ec_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9e9818ec, "visitExprOp2", 340 };
+TypeInfo * __type_info__b7d4d4bf_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7d4d4bf_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb7d4d4bf, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__3e48a358_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e48a358_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3e48a358, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9f981a7f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f981a7f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9f981a7f, "visitExprOp3", 352 };
+TypeInfo * __type_info__eee3bc09_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eee3bc09_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xeee3bc09, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__f2f1d3aa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2f1d3aa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf2f1d3aa, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__c3059e01_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3059e01_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc3059e01, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__3bbe5820_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3bbe5820_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3bbe5820, "visitExprCopy", 368 };
+TypeInfo * __type_info__a0ecfbb9_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ecfbb9_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa0ecfbb9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__215e3c49_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__215e3c49_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x215e3c49, "preVisitExprMove", 376 };
+TypeInfo * __type_info__8f4c9038_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f4c9038_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f4c9038, "visitExprMove", 380 };
+TypeInfo * __type_info__98dc5351_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98dc5351_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x98dc5351, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__17b491_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17b491_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x17b491, "preVisitExprClone", 388 };
+TypeInfo * __type_info__1ad4800e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ad4800e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1ad4800e, "visitExprClone", 392 };
+TypeInfo * __type_info__b08b6929_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b08b6929_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb08b6929, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__f2348094_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2348094_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf2348094, "preVisitExprWith", 400 };
+TypeInfo * __type_info__f3ae166d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3ae166d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf3ae166d, "visitExprWith", 404 };
+TypeInfo * __type_info__f1675330_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1675330_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf1675330, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__92e3d111_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92e3d111_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x92e3d111, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__cafe3512_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cafe3512_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcafe3512, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed636a01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed636a01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xed636a01, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__25c0eaac_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c0eaac_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x25c0eaac, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__90a51465_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90a51465_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x90a51465, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__169d2283_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__169d2283_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x169d2283, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__8965dfd1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8965dfd1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8965dfd1, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__757540b8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__757540b8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x757540b8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__7705b54f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7705b54f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x7705b54f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__97b1c4ed_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97b1c4ed_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x97b1c4ed, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e95012d3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e95012d3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe95012d3, "preVisitExprFor", 452 };
+TypeInfo * __type_info__344d19dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__344d19dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x344d19dc, "visitExprFor", 456 };
+TypeInfo * __type_info__6c164ebf_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c164ebf_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6c164ebf, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__56569ad4_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__56569ad4_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x56569ad4, "visitExprForVariable", 464 };
+TypeInfo * __type_info__12214d06_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12214d06_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x12214d06, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__64f4b569_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64f4b569_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x64f4b569, "visitExprForSource", 472 };
+TypeInfo * __type_info__10bf88c5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10bf88c5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x10bf88c5, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__6dbb285b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6dbb285b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6dbb285b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__717f8e67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__717f8e67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x717f8e67, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__e6a0bda4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6a0bda4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe6a0bda4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__c35127d9_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c35127d9_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc35127d9, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__aa30df58_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__aa30df58_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xaa30df58, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__67cfaaa3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67cfaaa3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x67cfaaa3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__23fa073a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23fa073a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x23fa073a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__a74c85b9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a74c85b9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa74c85b9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__88bd350e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88bd350e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x88bd350e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__35e4f53d_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35e4f53d_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x35e4f53d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__83d50dee_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__83d50dee_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x83d50dee, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__6d5c4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d5c4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d5c4cbf, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__52c5da8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c5da8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52c5da8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__e8005be5_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8005be5_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xe8005be5, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__a216b644_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a216b644_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa216b644, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8b73a850_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b73a850_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8b73a850, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__955e0b53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__955e0b53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x955e0b53, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cc0f5e2c_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc0f5e2c_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xcc0f5e2c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__c9d28329_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9d28329_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc9d28329, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__e4dec3a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4dec3a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe4dec3a3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__12c1f55a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12c1f55a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x12c1f55a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__b69afd24_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69afd24_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb69afd24, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__491e734a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__491e734a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x491e734a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__d6bd6ae8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6bd6ae8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6bd6ae8, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__1bbde4e9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1bbde4e9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1bbde4e9, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__f25fabc1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25fabc1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25fabc1, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__546203a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__546203a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x546203a, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e85d642a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e85d642a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe85d642a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__919eabb1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__919eabb1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x919eabb1, "visitExprLabel", 592 };
+TypeInfo * __type_info__94bb64af_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94bb64af_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x94bb64af, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__fcdb84a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcdb84a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfcdb84a, "visitExprGoto", 600 };
+TypeInfo * __type_info__ebd6bd76_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebd6bd76_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xebd6bd76, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__754e508d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__754e508d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x754e508d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__e3083f3d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3083f3d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe3083f3d, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__fdcc980e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdcc980e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfdcc980e, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__822a0a6f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__822a0a6f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x822a0a6f, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__36bf6516_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36bf6516_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x36bf6516, "visitExprAddr", 624 };
+TypeInfo * __type_info__b632464e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b632464e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb632464e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__171280cf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__171280cf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x171280cf, "visitExprAssert", 632 };
+TypeInfo * __type_info__9cd677e8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd677e8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd677e8, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__3faadbe1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3faadbe1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3faadbe1, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__7df46418_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7df46418_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7df46418, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__24d03a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__24d03a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x24d03a3, "visitExprQuote", 648 };
+TypeInfo * __type_info__3021cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3021cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3021cb, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__db853894_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db853894_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb853894, "visitExprDebug", 656 };
+TypeInfo * __type_info__a42b136c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a42b136c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa42b136c, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__ae8d05f1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae8d05f1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xae8d05f1, "visitExprInvoke", 664 };
+TypeInfo * __type_info__5afbb756_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5afbb756_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5afbb756, "preVisitExprErase", 668 };
+TypeInfo * __type_info__a433d831_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433d831_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa433d831, "visitExprErase", 672 };
+TypeInfo * __type_info__89b1ed2f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89b1ed2f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89b1ed2f, "preVisitExprFind", 676 };
+TypeInfo * __type_info__ba5333e6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5333e6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba5333e6, "visitExprFind", 680 };
+TypeInfo * __type_info__9d59dc9b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d59dc9b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9d59dc9b, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__5532d30_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5532d30_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5532d30, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__ac1f0992_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac1f0992_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac1f0992, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__d676fdc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d676fdc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd676fdc3, "visitExprAscend", 696 };
+TypeInfo * __type_info__fbd35c53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbd35c53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfbd35c53, "preVisitExprCast", 700 };
+TypeInfo * __type_info__3f5db93a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3f5db93a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f5db93a, "visitExprCast", 704 };
+TypeInfo * __type_info__e9e73a57_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9e73a57_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe9e73a57, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__5b5aed7e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b5aed7e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5b5aed7e, "visitExprDelete", 712 };
+TypeInfo * __type_info__31ca940d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31ca940d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x31ca940d, "preVisitExprVar", 716 };
+TypeInfo * __type_info__64bce7f2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64bce7f2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x64bce7f2, "visitExprVar", 720 };
+TypeInfo * __type_info__490512e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__490512e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x490512e0, "preVisitExprField", 724 };
+TypeInfo * __type_info__cb496173_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb496173_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb496173, "visitExprField", 728 };
+TypeInfo * __type_info__afac4da3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afac4da3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafac4da3, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__c2023960_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c2023960_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc2023960, "visitExprSafeField", 736 };
+TypeInfo * __type_info__2f87634a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f87634a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f87634a, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__cbd679f5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbd679f5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcbd679f5, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__c93f0085_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93f0085_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc93f0085, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__c5f99f7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5f99f7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc5f99f7a, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__d15980dd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d15980dd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd15980dd, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__1fff0112_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1fff0112_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1fff0112, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__6f4d2d82_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4d2d82_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6f4d2d82, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__c4a28f5d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c4a28f5d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc4a28f5d, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__4048a67e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4048a67e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4048a67e, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__a1981da5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1981da5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa1981da5, "visitExprOp1", 776 };
+TypeInfo * __type_info__9cd84da2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd84da2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd84da2, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__e51104e3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e51104e3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe51104e3, "visitExprReturn", 784 };
+TypeInfo * __type_info__88b468bd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88b468bd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x88b468bd, "preVisitExprYield", 788 };
+TypeInfo * __type_info__b873b4e2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b873b4e2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb873b4e2, "visitExprYield", 792 };
+TypeInfo * __type_info__bac4281b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bac4281b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbac4281b, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__b8ba8abc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8ba8abc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb8ba8abc, "visitExprBreak", 800 };
+TypeInfo * __type_info__988afcfd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__988afcfd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x988afcfd, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__d11ed6d8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d11ed6d8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd11ed6d8, "visitExprContinue", 808 };
+TypeInfo * __type_info__80289013_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80289013_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80289013, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__c985a48c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c985a48c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc985a48c, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__37233ab_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37233ab_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x37233ab, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__6758a118_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6758a118_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6758a118, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__cea9756b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cea9756b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcea9756b, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__21f91cf0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21f91cf0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21f91cf0, "visitExprMemZero", 832 };
+TypeInfo * __type_info__827a7b9f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__827a7b9f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x827a7b9f, "preVisitExprConst", 836 };
+TypeInfo * __type_info__80719338_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80719338_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80719338, "visitExprConst", 840 };
+TypeInfo * __type_info__f1edd27b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1edd27b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf1edd27b, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__d4f9c662_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4f9c662_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd4f9c662, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__59a80c5a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59a80c5a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x59a80c5a, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__d561f037_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d561f037_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd561f037, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__319243ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319243ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x319243ae, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__f502f93d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f502f93d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf502f93d, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__35133e98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35133e98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35133e98, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__8f9f8e93_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f9f8e93_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f9f8e93, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__2d3a4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d3a4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2d3a4cbf, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__cb3eecea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb3eecea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb3eecea, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__ad464f32_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad464f32_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xad464f32, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__cb50360b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb50360b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb50360b, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__dbe74630_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbe74630_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdbe74630, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__a80e5f39_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80e5f39_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa80e5f39, "visitExprConstInt", 896 };
+TypeInfo * __type_info__2f133526_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f133526_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f133526, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__999f9e51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__999f9e51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x999f9e51, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__301336b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__301336b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x301336b9, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__989f9cbe_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__989f9cbe_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x989f9cbe, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__3113384c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3113384c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3113384c, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__9b9fa177_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b9fa177_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b9fa177, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__c8e5f55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e5f55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc8e5f55, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__4bbc29e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bbc29e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4bbc29e0, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__35318804_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35318804_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35318804, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__a14c8807_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a14c8807_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa14c8807, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__3924c25d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3924c25d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3924c25d, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__21588a7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21588a7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21588a7a, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__1c524c4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c524c4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c524c4f, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__ba8cda98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba8cda98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba8cda98, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__128e68c7_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__128e68c7_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x128e68c7, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__55bc399e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55bc399e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x55bc399e, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__118e6734_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__118e6734_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x118e6734, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__56bc3b31_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__56bc3b31_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x56bc3b31, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__108e65a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__108e65a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x108e65a1, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__57bc3cc4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57bc3cc4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x57bc3cc4, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__7c486554_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c486554_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7c486554, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__d1222c0d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1222c0d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd1222c0d, "visitExprConstRange", 984 };
+TypeInfo * __type_info__21dc0f2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21dc0f2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21dc0f2b, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__9bd0e54c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bd0e54c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9bd0e54c, "visitExprConstURange", 992 };
+TypeInfo * __type_info__cfe854bb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe854bb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcfe854bb, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__52ff6128_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52ff6128_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52ff6128, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__9b78bd2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b78bd2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b78bd2b, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__14bcb702_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14bcb702_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x14bcb702, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__d811ae5b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d811ae5b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd811ae5b, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__d5146090_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5146090_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd5146090, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__d711acc8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d711acc8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd711acc8, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__d6146223_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6146223_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6146223, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__de11b7cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de11b7cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xde11b7cd, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__db146a02_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db146a02_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb146a02, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__6e97f0ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e97f0ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6e97f0ea, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__ea5d24a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5d24a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xea5d24a1, "visitExprConstString", 1040 };
+TypeInfo * __type_info__89e422d2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89e422d2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89e422d2, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__6c08a2e5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c08a2e5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c08a2e5, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__2af4d3dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2af4d3dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2af4d3dc, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__5fa7d37b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fa7d37b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5fa7d37b, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__ee0efbc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0efbc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xee0efbc3, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__afd807ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afd807ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafd807ea, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__f7387f87_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7387f87_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf7387f87, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__d62685b2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d62685b2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd62685b2, "visitExprReader", 1072 };
+TypeInfo * __type_info__ffd9fe3a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ffd9fe3a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xffd9fe3a, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__dfbb50cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbb50cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdfbb50cb, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__a10f6f08_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a10f6f08_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa10f6f08, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__9794b2fb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9794b2fb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9794b2fb, "visitExprCallMacro", 1088 };
+VarInfo * __struct_info__d8299e85_fields[272] =  { &__struct_info__d8299e85_field_0, &__struct_info__d8299e85_field_1, &__struct_info__d8299e85_field_2, &__struct_info__d8299e85_field_3, &__struct_info__d8299e85_field_4, &__struct_info__d8299e85_field_5, &__struct_info__d8299e85_field_6, &__struct_info__d8299e85_field_7, &__struct_info__d8299e85_field_8, &__struct_info__d8299e85_field_9, &__struct_info__d8299e85_field_10, &__struct_info__d8299e85_field_11, &__struct_info__d8299e85_field_12, &__struct_info__d8299e85_field_13, &__struct_info__d8299e85_field_14, &__struct_info__d8299e85_field_15, &__struct_info__d8299e85_field_16, &__struct_info__d8299e85_field_17, &__struct_info__d8299e85_field_18, &__struct_info__d8299e85_field_19, &__struct_info__d8299e85_field_20, &__struct_info__d8299e85_field_21, &__struct_info__d8299e85_field_22, &__struct_info__d8299e85_field_23, &__struct_info__d8299e85_field_24, &__struct_info__d8299e85_field_25, &__struct_info__d8299e85_field_26, &__struct_info__d8299e85_field_27, &__struct_info__d8299e85_field_28, &__struct_info__d8299e85_field_29, &__struct_info__d8299e85_field_30, &__struct_info__d8299e85_field_31, &__struct_info__d8299e85_field_32, &__struct_info__d8299e85_field_33, &__struct_info__d8299e85_field_34, &__struct_info__d8299e85_field_35, &__struct_info__d8299e85_field_36, &__struct_info__d8299e85_field_37, &__struct_info__d8299e85_field_38, &__struct_info__d8299e85_field_39, &__struct_info__d8299e85_field_40, &__struct_info__d8299e85_field_41, &__struct_info__d8299e85_field_42, &__struct_info__d8299e85_field_43, &__struct_info__d8299e85_field_44, &__struct_info__d8299e85_field_45, &__struct_info__d8299e85_field_46, &__struct_info__d8299e85_field_47, &__struct_info__d8299e85_field_48, &__struct_info__d8299e85_field_49, &__struct_info__d8299e85_field_50, &__struct_info__d8299e85_field_51, &__struct_info__d8299e85_field_52, &__struct_info__d8299e85_field_53, &__struct_info__d8299e85_field_54, &__struct_info__d8299e85_field_55, &__struct_info__d8299e85_field_56, &__struct_info__d8299e85_field_57, &__struct_info__d8299e85_field_58, &__struct_info__d8299e85_field_59, &__struct_info__d8299e85_field_60, &__struct_info__d8299e85_field_61, &__struct_info__d8299e85_field_62, &__struct_info__d8299e85_field_63, &__struct_info__d8299e85_field_64, &__struct_info__d8299e85_field_65, &__struct_info__d8299e85_field_66, &__struct_info__d8299e85_field_67, &__struct_info__d8299e85_field_68, &__struct_info__d8299e85_field_69, &__struct_info__d8299e85_field_70, &__struct_info__d8299e85_field_71, &__struct_info__d8299e85_field_72, &__struct_info__d8299e85_field_73, &__struct_info__d8299e85_field_74, &__struct_info__d8299e85_field_75, &__struct_info__d8299e85_field_76, &__struct_info__d8299e85_field_77, &__struct_info__d8299e85_field_78, &__struct_info__d8299e85_field_79, &__struct_info__d8299e85_field_80, &__struct_info__d8299e85_field_81, &__struct_info__d8299e85_field_82, &__struct_info__d8299e85_field_83, &__struct_info__d8299e85_field_84, &__struct_info__d8299e85_field_85, &__struct_info__d8299e85_field_86, &__struct_info__d8299e85_field_87, &__struct_info__d8299e85_field_88, &__struct_info__d8299e85_field_89, &__struct_info__d8299e85_field_90, &__struct_info__d8299e85_field_91, &__struct_info__d8299e85_field_92, &__struct_info__d8299e85_field_93, &__struct_info__d8299e85_field_94, &__struct_info__d8299e85_field_95, &__struct_info__d8299e85_field_96, &__struct_info__d8299e85_field_97, &__struct_info__d8299e85_field_98, &__struct_info__d8299e85_field_99, &__struct_info__d8299e85_field_100, &__struct_info__d8299e85_field_101, &__struct_info__d8299e85_field_102, &__struct_info__d8299e85_field_103, &__struct_info__d8299e85_field_104, &__struct_info__d8299e85_field_105, &__struct_info__d8299e85_field_106, &__struct_info__d8299e85_field_107, &__struct_info__d8299e85_field_108, &__struct_info__d8299e85_field_109, &__struct_info__d8299e85_field_110, &__struct_info__d8299e85_field_111, &__struct_info__d8299e85_field_112, &__struct_info__d8299e85_field_113, &__struct_info__d8299e85_field_114, &__struct_info__d8299e85_field_115, &__struct_info__d8299e85_field_116, &__struct_info__d8299e85_field_117, &__struct_info__d8299e85_field_118, &__struct_info__d8299e85_field_119, &__struct_info__d8299e85_field_120, &__struct_info__d8299e85_field_121, &__struct_info__d8299e85_field_122, &__struct_info__d8299e85_field_123, &__struct_info__d8299e85_field_124, &__struct_info__d8299e85_field_125, &__struct_info__d8299e85_field_126, &__struct_info__d8299e85_field_127, &__struct_info__d8299e85_field_128, &__struct_info__d8299e85_field_129, &__struct_info__d8299e85_field_130, &__struct_info__d8299e85_field_131, &__struct_info__d8299e85_field_132, &__struct_info__d8299e85_field_133, &__struct_info__d8299e85_field_134, &__struct_info__d8299e85_field_135, &__struct_info__d8299e85_field_136, &__struct_info__d8299e85_field_137, &__struct_info__d8299e85_field_138, &__struct_info__d8299e85_field_139, &__struct_info__d8299e85_field_140, &__struct_info__d8299e85_field_141, &__struct_info__d8299e85_field_142, &__struct_info__d8299e85_field_143, &__struct_info__d8299e85_field_144, &__struct_info__d8299e85_field_145, &__struct_info__d8299e85_field_146, &__struct_info__d8299e85_field_147, &__struct_info__d8299e85_field_148, &__struct_info__d8299e85_field_149, &__struct_info__d8299e85_field_150, &__struct_info__d8299e85_field_151, &__struct_info__d8299e85_field_152, &__struct_info__d8299e85_field_153, &__struct_info__d8299e85_field_154, &__struct_info__d8299e85_field_155, &__struct_info__d8299e85_field_156, &__struct_info__d8299e85_field_157, &__struct_info__d8299e85_field_158, &__struct_info__d8299e85_field_159, &__struct_info__d8299e85_field_160, &__struct_info__d8299e85_field_161, &__struct_info__d8299e85_field_162, &__struct_info__d8299e85_field_163, &__struct_info__d8299e85_field_164, &__struct_info__d8299e85_field_165, &__struct_info__d8299e85_field_166, &__struct_info__d8299e85_field_167, &__struct_info__d8299e85_field_168, &__struct_info__d8299e85_field_169, &__struct_info__d8299e85_field_170, &__struct_info__d8299e85_field_171, &__struct_info__d8299e85_field_172, &__struct_info__d8299e85_field_173, &__struct_info__d8299e85_field_174, &__struct_info__d8299e85_field_175, &__struct_info__d8299e85_field_176, &__struct_info__d8299e85_field_177, &__struct_info__d8299e85_field_178, &__struct_info__d8299e85_field_179, &__struct_info__d8299e85_field_180, &__struct_info__d8299e85_field_181, &__struct_info__d8299e85_field_182, &__struct_info__d8299e85_field_183, &__struct_info__d8299e85_field_184, &__struct_info__d8299e85_field_185, &__struct_info__d8299e85_field_186, &__struct_info__d8299e85_field_187, &__struct_info__d8299e85_field_188, &__struct_info__d8299e85_field_189, &__struct_info__d8299e85_field_190, &__struct_info__d8299e85_field_191, &__struct_info__d8299e85_field_192, &__struct_info__d8299e85_field_193, &__struct_info__d8299e85_field_194, &__struct_info__d8299e85_field_195, &__struct_info__d8299e85_field_196, &__struct_info__d8299e85_field_197, &__struct_info__d8299e85_field_198, &__struct_info__d8299e85_field_199, &__struct_info__d8299e85_field_200, &__struct_info__d8299e85_field_201, &__struct_info__d8299e85_field_202, &__struct_info__d8299e85_field_203, &__struct_info__d8299e85_field_204, &__struct_info__d8299e85_field_205, &__struct_info__d8299e85_field_206, &__struct_info__d8299e85_field_207, &__struct_info__d8299e85_field_208, &__struct_info__d8299e85_field_209, &__struct_info__d8299e85_field_210, &__struct_info__d8299e85_field_211, &__struct_info__d8299e85_field_212, &__struct_info__d8299e85_field_213, &__struct_info__d8299e85_field_214, &__struct_info__d8299e85_field_215, &__struct_info__d8299e85_field_216, &__struct_info__d8299e85_field_217, &__struct_info__d8299e85_field_218, &__struct_info__d8299e85_field_219, &__struct_info__d8299e85_field_220, &__struct_info__d8299e85_field_221, &__struct_info__d8299e85_field_222, &__struct_info__d8299e85_field_223, &__struct_info__d8299e85_field_224, &__struct_info__d8299e85_field_225, &__struct_info__d8299e85_field_226, &__struct_info__d8299e85_field_227, &__struct_info__d8299e85_field_228, &__struct_info__d8299e85_field_229, &__struct_info__d8299e85_field_230, &__struct_info__d8299e85_field_231, &__struct_info__d8299e85_field_232, &__struct_info__d8299e85_field_233, &__struct_info__d8299e85_field_234, &__struct_info__d8299e85_field_235, &__struct_info__d8299e85_field_236, &__struct_info__d8299e85_field_237, &__struct_info__d8299e85_field_238, &__struct_info__d8299e85_field_239, &__struct_info__d8299e85_field_240, &__struct_info__d8299e85_field_241, &__struct_info__d8299e85_field_242, &__struct_info__d8299e85_field_243, &__struct_info__d8299e85_field_244, &__struct_info__d8299e85_field_245, &__struct_info__d8299e85_field_246, &__struct_info__d8299e85_field_247, &__struct_info__d8299e85_field_248, &__struct_info__d8299e85_field_249, &__struct_info__d8299e85_field_250, &__struct_info__d8299e85_field_251, &__struct_info__d8299e85_field_252, &__struct_info__d8299e85_field_253, &__struct_info__d8299e85_field_254, &__struct_info__d8299e85_field_255, &__struct_info__d8299e85_field_256, &__struct_info__d8299e85_field_257, &__struct_info__d8299e85_field_258, &__struct_info__d8299e85_field_259, &__struct_info__d8299e85_field_260, &__struct_info__d8299e85_field_261, &__struct_info__d8299e85_field_262, &__struct_info__d8299e85_field_263, &__struct_info__d8299e85_field_264, &__struct_info__d8299e85_field_265, &__struct_info__d8299e85_field_266, &__struct_info__d8299e85_field_267, &__struct_info__d8299e85_field_268, &__struct_info__d8299e85_field_269, &__struct_info__d8299e85_field_270, &__struct_info__d8299e85_field_271 };
+StructInfo __struct_info__d8299e85 = {"AstVisitor", __struct_info__d8299e85_fields, 272, 1096, -1, nullptr, 0xd8299e85 };
+VarInfo __struct_info__55a47493_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1c77d1c2, "__rtti", 0 };
+TypeInfo * __type_info__14560d95_arg_types_var_1436841107[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__55a47493_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__14560d95_arg_types_var_1436841107, nullptr, 1, 0, nullptr, 28, 0x14560d95, "__finalize", 8 };
+TypeInfo * __type_info__fdc2b8d7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__55a47493_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdc2b8d7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfdc2b8d7, "preVisitProgram", 12 };
+TypeInfo * __type_info__1edc59e4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__55a47493_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1edc59e4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1edc59e4, "visitProgram", 16 };
+TypeInfo * __type_info__b74f83af_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__55a47493_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b74f83af_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xb74f83af, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__271e6109_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__55a47493_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__271e6109_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x271e6109, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__2eb68aac_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__55a47493_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2eb68aac_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2eb68aac, "visitTypeDecl", 28 };
+TypeInfo * __type_info__d132dff3_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__55a47493_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d132dff3_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xd132dff3, "preVisitAlias", 32 };
+TypeInfo * __type_info__2636b5f4_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__55a47493_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2636b5f4_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x2636b5f4, "visitAlias", 36 };
+TypeInfo * __type_info__31557040_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__55a47493_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31557040_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x31557040, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__6c244ef1_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c244ef1_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x6c244ef1, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__3043b2c_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3043b2c_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x3043b2c, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__75442797_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__55a47493_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__75442797_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x75442797, "visitEnumeration", 52 };
+TypeInfo * __type_info__7df6e782_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__55a47493_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7df6e782_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7df6e782, "preVisitStructure", 56 };
+TypeInfo * __type_info__57879e66_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__57879e66_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x57879e66, "preVisitStructureField", 60 };
+TypeInfo * __type_info__fa998a5f_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fa998a5f_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xfa998a5f, "visitStructureField", 64 };
+TypeInfo * __type_info__9587f22d_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__55a47493_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__9587f22d_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9587f22d, "visitStructure", 68 };
+TypeInfo * __type_info__d193f2b5_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__55a47493_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d193f2b5_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd193f2b5, "preVisitFunction", 72 };
+TypeInfo * __type_info__641ef8a0_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__55a47493_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__641ef8a0_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x641ef8a0, "visitFunction", 76 };
+TypeInfo * __type_info__19b2e566_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__19b2e566_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x19b2e566, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__d407980f_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d407980f_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xd407980f, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__a0d20d9c_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0d20d9c_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xa0d20d9c, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__52a36b89_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52a36b89_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x52a36b89, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__94643ea5_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__55a47493_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94643ea5_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x94643ea5, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__6bfbb18c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__55a47493_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6bfbb18c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6bfbb18c, "visitFunctionBody", 100 };
+TypeInfo * __type_info__dcc2db67_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcc2db67_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xdcc2db67, "preVisitExpression", 104 };
+TypeInfo * __type_info__d9a2ecfa_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d9a2ecfa_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd9a2ecfa, "visitExpression", 108 };
+TypeInfo * __type_info__6da7e6d7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__55a47493_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6da7e6d7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6da7e6d7, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__f9ec2860_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__55a47493_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f9ec2860_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xf9ec2860, "visitExprBlock", 116 };
+TypeInfo * __type_info__7a6458b4_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7a6458b4_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x7a6458b4, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__baf99fcf_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__baf99fcf_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xbaf99fcf, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__a5daa336_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a5daa336_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xa5daa336, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__85616c49_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85616c49_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x85616c49, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__27f20dd9_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__27f20dd9_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x27f20dd9, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__148a69c2_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__148a69c2_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x148a69c2, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__9b48f5d_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__55a47493_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b48f5d_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9b48f5d, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__57dbac08_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__55a47493_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__57dbac08_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x57dbac08, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__7e833523_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e833523_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x7e833523, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__445534ca_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__445534ca_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x445534ca, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__267ea89b_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__55a47493_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__267ea89b_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x267ea89b, "preVisitExprLet", 160 };
+TypeInfo * __type_info__23f1edc0_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__55a47493_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23f1edc0_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x23f1edc0, "visitExprLet", 164 };
+TypeInfo * __type_info__10557067_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10557067_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x10557067, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__9d935f60_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__9d935f60_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x9d935f60, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__f5e3c211_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f5e3c211_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xf5e3c211, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__a0578de2_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a0578de2_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xa0578de2, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__20b5a83_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__55a47493_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__20b5a83_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x20b5a83, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__221ec580_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__55a47493_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__221ec580_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x221ec580, "visitGlobalLet", 188 };
+TypeInfo * __type_info__1106472f_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1106472f_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x1106472f, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__65ca1220_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__65ca1220_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x65ca1220, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__a0702b69_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0702b69_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xa0702b69, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__3ef8faa2_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3ef8faa2_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x3ef8faa2, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__228f51fa_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__55a47493_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__228f51fa_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x228f51fa, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__bb18d055_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__55a47493_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bb18d055_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xbb18d055, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__182a4292_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__182a4292_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x182a4292, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__336416a7_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__336416a7_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x336416a7, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__3e3c759c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__55a47493_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e3c759c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x3e3c759c, "preVisitExprNew", 224 };
+TypeInfo * __type_info__4b48f5cf_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__55a47493_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4b48f5cf_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4b48f5cf, "visitExprNew", 228 };
+TypeInfo * __type_info__40c8885b_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__40c8885b_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x40c8885b, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__dc98492c_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dc98492c_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xdc98492c, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__89c64b37_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__55a47493_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89c64b37_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x89c64b37, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__7bab1cb8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__55a47493_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7bab1cb8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7bab1cb8, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__f693aed4_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f693aed4_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xf693aed4, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__d60f6d87_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__d60f6d87_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xd60f6d87, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__b2b960b1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__55a47493_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b2b960b1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xb2b960b1, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__a48d413a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__55a47493_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a48d413a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa48d413a, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__e5840522_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e5840522_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xe5840522, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__392717d5_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__392717d5_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x392717d5, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__52fab456_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__55a47493_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__52fab456_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x52fab456, "preVisitExprCall", 272 };
+TypeInfo * __type_info__8254701f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__55a47493_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8254701f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8254701f, "visitExprCall", 276 };
+TypeInfo * __type_info__eb19ebf1_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eb19ebf1_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xeb19ebf1, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__ebb0b9dc_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ebb0b9dc_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xebb0b9dc, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__729d3793_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__55a47493_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__729d3793_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x729d3793, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__714fae6e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__55a47493_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__714fae6e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x714fae6e, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__1c90ae44_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c90ae44_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x1c90ae44, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__b5d2e047_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__55a47493_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b5d2e047_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xb5d2e047, "preVisitExprAt", 300 };
+TypeInfo * __type_info__9abc223a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__55a47493_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9abc223a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9abc223a, "visitExprAt", 304 };
+TypeInfo * __type_info__8d50ee2d_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d50ee2d_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x8d50ee2d, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__1b67d13a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__55a47493_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b67d13a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1b67d13a, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__ebfba41f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__55a47493_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ebfba41f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xebfba41f, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__3a64130e_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3a64130e_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x3a64130e, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__a2e64a16_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__55a47493_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a2e64a16_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa2e64a16, "preVisitExprIs", 324 };
+TypeInfo * __type_info__85a87973_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__55a47493_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85a87973_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x85a87973, "visitExprIs", 328 };
+TypeInfo * __type_info__69c65b46_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__55a47493_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__69c65b46_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x69c65b46, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__6fb30ee5_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__55a47493_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fb30ee5_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6fb30ee5, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9981e126_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__55a47493_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9981e126_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9981e126, "visitExprOp2", 340 };
+TypeInfo * __type_info__a5d240e5_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a5d240e5_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xa5d240e5, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__6eb30d52_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__55a47493_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eb30d52_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6eb30d52, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9a81e2b9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__55a47493_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9a81e2b9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9a81e2b9, "visitExprOp3", 352 };
+TypeInfo * __type_info__ab86735f_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ab86735f_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xab86735f, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__15f87590_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__15f87590_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x15f87590, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__83de2c5f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__55a47493_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__83de2c5f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x83de2c5f, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__1eb24d9e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__55a47493_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1eb24d9e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1eb24d9e, "visitExprCopy", 368 };
+TypeInfo * __type_info__503d22cb_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__503d22cb_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x503d22cb, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__35721f8f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__55a47493_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35721f8f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x35721f8f, "preVisitExprMove", 376 };
+TypeInfo * __type_info__846d26c6_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__55a47493_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__846d26c6_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x846d26c6, "visitExprMove", 380 };
+TypeInfo * __type_info__24c62fdb_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__24c62fdb_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x24c62fdb, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__c33efd7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__55a47493_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c33efd7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc33efd7, "preVisitExprClone", 388 };
+TypeInfo * __type_info__da19e72c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__55a47493_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__da19e72c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xda19e72c, "visitExprClone", 392 };
+TypeInfo * __type_info__67dfe9d3_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67dfe9d3_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x67dfe9d3, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__dd9eb3e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__55a47493_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dd9eb3e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xdd9eb3e, "preVisitExprWith", 400 };
+TypeInfo * __type_info__123f4c77_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__55a47493_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__123f4c77_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x123f4c77, "visitExprWith", 404 };
+TypeInfo * __type_info__399c1f32_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__399c1f32_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x399c1f32, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__381761b7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__55a47493_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__381761b7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x381761b7, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__de2411c0_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__55a47493_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__de2411c0_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xde2411c0, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed1914f_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed1914f_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xed1914f, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__5abb5a86_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__55a47493_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5abb5a86_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x5abb5a86, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__5938ed57_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__55a47493_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5938ed57_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x5938ed57, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__c93a2179_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93a2179_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xc93a2179, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__91427b33_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__55a47493_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__91427b33_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x91427b33, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__da29973a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__55a47493_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__da29973a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xda29973a, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__1db39b29_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1db39b29_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x1db39b29, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__5aa52d1f_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5aa52d1f_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x5aa52d1f, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e49698a1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__55a47493_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e49698a1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe49698a1, "preVisitExprFor", 452 };
+TypeInfo * __type_info__c740cbba_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__55a47493_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c740cbba_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc740cbba, "visitExprFor", 456 };
+TypeInfo * __type_info__e5425fa9_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e5425fa9_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xe5425fa9, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__5be9ff7e_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5be9ff7e_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x5be9ff7e, "visitExprForVariable", 464 };
+TypeInfo * __type_info__90ad04bc_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__90ad04bc_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x90ad04bc, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__545fa127_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__545fa127_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x545fa127, "visitExprForSource", 472 };
+TypeInfo * __type_info__e9632d3b_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__55a47493_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9632d3b_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe9632d3b, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__d11ddf1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__55a47493_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d11ddf1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd11ddf1, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__16998229_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__55a47493_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__16998229_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x16998229, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__d0c22ee_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__55a47493_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d0c22ee_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd0c22ee, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__1383e2a3_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1383e2a3_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x1383e2a3, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__e3525bda_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__e3525bda_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0xe3525bda, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__c55061_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__55a47493_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c55061_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc55061, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__27764678_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__55a47493_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__27764678_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x27764678, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__c77b45f7_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c77b45f7_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0xc77b45f7, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__7f5b17d4_arg_types_var_1436841107[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7f5b17d4_arg_types_var_1436841107, nullptr, 4, 0, nullptr, 28, 0x7f5b17d4, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__b569a2ab_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b569a2ab_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0xb569a2ab, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__d295ffd4_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__d295ffd4_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0xd295ffd4, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__51f34505_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__55a47493_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51f34505_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x51f34505, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__dfbbbe7e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__55a47493_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbbbe7e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xdfbbbe7e, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__5a979a8b_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5a979a8b_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x5a979a8b, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__5298a342_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5298a342_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x5298a342, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__e3a81c3e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__55a47493_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3a81c3e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe3a81c3e, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__e78e1ae9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__55a47493_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e78e1ae9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe78e1ae9, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__ced10202_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ced10202_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0xced10202, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__134dd6bf_arg_types_var_1436841107[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__55a47493_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__134dd6bf_arg_types_var_1436841107, nullptr, 5, 0, nullptr, 28, 0x134dd6bf, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__2f8a192d_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__55a47493_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f8a192d_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2f8a192d, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__fa18d374_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__55a47493_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fa18d374_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfa18d374, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__59156306_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59156306_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0x59156306, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__a4a00a80_arg_types_var_1436841107[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__55a47493_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a4a00a80_arg_types_var_1436841107, nullptr, 3, 0, nullptr, 28, 0xa4a00a80, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__91c6225a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__55a47493_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__91c6225a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x91c6225a, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__f3b76373_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__55a47493_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3b76373_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xf3b76373, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__57cab833_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__55a47493_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__57cab833_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x57cab833, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__9a94e224_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__55a47493_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9a94e224_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9a94e224, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__66cbf328_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__55a47493_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66cbf328_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x66cbf328, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__531888d7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__55a47493_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__531888d7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x531888d7, "visitExprLabel", 592 };
+TypeInfo * __type_info__b8f0fdc9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__55a47493_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b8f0fdc9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xb8f0fdc9, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__a71516f4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__55a47493_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a71516f4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa71516f4, "visitExprGoto", 600 };
+TypeInfo * __type_info__95f8f548_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__55a47493_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95f8f548_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x95f8f548, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__99ce4b7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__55a47493_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__99ce4b7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x99ce4b7, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__7b75bbc7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__55a47493_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b75bbc7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7b75bbc7, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__d9ea88c0_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__55a47493_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d9ea88c0_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd9ea88c0, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__89674fa1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__55a47493_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89674fa1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x89674fa1, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__187a9288_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__55a47493_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__187a9288_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x187a9288, "visitExprAddr", 624 };
+TypeInfo * __type_info__2d5905b8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__55a47493_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d5905b8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2d5905b8, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__9f3db861_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__55a47493_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f3db861_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9f3db861, "visitExprAssert", 632 };
+TypeInfo * __type_info__978d6552_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__55a47493_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__978d6552_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x978d6552, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__a6d304fb_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__55a47493_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a6d304fb_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa6d304fb, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__c1c5d10e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__55a47493_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c1c5d10e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc1c5d10e, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__d2199019_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__55a47493_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d2199019_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd2199019, "visitExprQuote", 648 };
+TypeInfo * __type_info__25f52395_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__55a47493_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25f52395_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x25f52395, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__70fd4e8e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__55a47493_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__70fd4e8e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x70fd4e8e, "visitExprDebug", 656 };
+TypeInfo * __type_info__f73d4e52_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__55a47493_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f73d4e52_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xf73d4e52, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__149d1ff_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__55a47493_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__149d1ff_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x149d1ff, "visitExprInvoke", 664 };
+TypeInfo * __type_info__1f7693d8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__55a47493_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f7693d8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1f7693d8, "preVisitExprErase", 668 };
+TypeInfo * __type_info__2c75bc93_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__55a47493_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2c75bc93_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2c75bc93, "visitExprErase", 672 };
+TypeInfo * __type_info__9af19895_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__55a47493_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9af19895_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9af19895, "preVisitExprFind", 676 };
+TypeInfo * __type_info__aba9b214_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__55a47493_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__aba9b214_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xaba9b214, "visitExprFind", 680 };
+TypeInfo * __type_info__39d61341_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__55a47493_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__39d61341_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x39d61341, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__a10a361e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__55a47493_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a10a361e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa10a361e, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__ebf48ac4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__55a47493_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebf48ac4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xebf48ac4, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__c53e4eed_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__55a47493_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c53e4eed_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc53e4eed, "visitExprAscend", 696 };
+TypeInfo * __type_info__4d168161_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__55a47493_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4d168161_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4d168161, "preVisitExprCast", 700 };
+TypeInfo * __type_info__88433070_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__55a47493_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__88433070_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x88433070, "visitExprCast", 704 };
+TypeInfo * __type_info__987deaed_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__55a47493_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__987deaed_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x987deaed, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__55e7ce8c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__55a47493_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55e7ce8c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x55e7ce8c, "visitExprDelete", 712 };
+TypeInfo * __type_info__c66f65f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__55a47493_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c66f65f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc66f65f, "preVisitExprVar", 716 };
+TypeInfo * __type_info__951d07d4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__55a47493_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__951d07d4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x951d07d4, "visitExprVar", 720 };
+TypeInfo * __type_info__b0a906b6_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__55a47493_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b0a906b6_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xb0a906b6, "preVisitExprField", 724 };
+TypeInfo * __type_info__8369fc91_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__55a47493_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8369fc91_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8369fc91, "visitExprField", 728 };
+TypeInfo * __type_info__7b134191_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__55a47493_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b134191_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7b134191, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__388eeafe_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__55a47493_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__388eeafe_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x388eeafe, "visitExprSafeField", 736 };
+TypeInfo * __type_info__a6e52524_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__55a47493_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6e52524_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa6e52524, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__1d7f511f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__55a47493_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1d7f511f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1d7f511f, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__ac40f6e7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__55a47493_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac40f6e7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xac40f6e7, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__57381fc4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__55a47493_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57381fc4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x57381fc4, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__8069ca0f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__55a47493_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8069ca0f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8069ca0f, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__4d5e247c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__55a47493_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4d5e247c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4d5e247c, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__4396b97c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__55a47493_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4396b97c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4396b97c, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__c9e983b7_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__55a47493_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9e983b7_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc9e983b7, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__6cb30a2c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__55a47493_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6cb30a2c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6cb30a2c, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__9881df93_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__55a47493_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9881df93_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9881df93, "visitExprOp1", 776 };
+TypeInfo * __type_info__772c0f1c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__55a47493_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__772c0f1c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x772c0f1c, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__fc3d5bad_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__55a47493_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fc3d5bad_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfc3d5bad, "visitExprReturn", 784 };
+TypeInfo * __type_info__da1fbddf_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__55a47493_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__da1fbddf_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xda1fbddf, "preVisitExprYield", 788 };
+TypeInfo * __type_info__d2d0dc3c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__55a47493_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d2d0dc3c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd2d0dc3c, "visitExprYield", 792 };
+TypeInfo * __type_info__e7eb1ef9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__55a47493_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7eb1ef9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe7eb1ef9, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__eca62802_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__55a47493_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eca62802_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xeca62802, "visitExprBreak", 800 };
+TypeInfo * __type_info__e8f2b3b_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__55a47493_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8f2b3b_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe8f2b3b, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__8bdcb526_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__55a47493_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8bdcb526_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8bdcb526, "visitExprContinue", 808 };
+TypeInfo * __type_info__626630f9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__55a47493_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__626630f9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x626630f9, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__a2549a7a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__55a47493_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a2549a7a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa2549a7a, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__7ebcbe55_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__55a47493_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ebcbe55_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7ebcbe55, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__cdd492ca_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__55a47493_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cdd492ca_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xcdd492ca, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__365edb51_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__55a47493_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__365edb51_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x365edb51, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__6b82a61e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__55a47493_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6b82a61e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6b82a61e, "visitExprMemZero", 832 };
+TypeInfo * __type_info__7208fe79_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__55a47493_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7208fe79_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7208fe79, "preVisitExprConst", 836 };
+TypeInfo * __type_info__136906a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__55a47493_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__136906a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x136906a, "visitExprConst", 840 };
+TypeInfo * __type_info__e44e1dcd_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__55a47493_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e44e1dcd_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe44e1dcd, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__17bf2274_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__55a47493_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__17bf2274_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x17bf2274, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__c89fb3c8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__55a47493_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c89fb3c8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc89fb3c8, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__e75da665_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__55a47493_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e75da665_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe75da665, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__17789cd8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__55a47493_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17789cd8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x17789cd8, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__d0edde97_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__55a47493_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d0edde97_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xd0edde97, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__e01a8b96_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__55a47493_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e01a8b96_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe01a8b96, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__7050e891_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__55a47493_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7050e891_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7050e891, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__ebe05fd5_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__55a47493_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebe05fd5_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xebe05fd5, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__f447abf0_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__55a47493_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f447abf0_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xf447abf0, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__e7e29820_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__55a47493_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7e29820_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe7e29820, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__884f50b1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__55a47493_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__884f50b1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x884f50b1, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__da8e5bea_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__55a47493_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__da8e5bea_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xda8e5bea, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__3c1f53f3_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__55a47493_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3c1f53f3_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x3c1f53f3, "visitExprConstInt", 896 };
+TypeInfo * __type_info__e61a9508_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__55a47493_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e61a9508_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe61a9508, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__6650d8d3_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__55a47493_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6650d8d3_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6650d8d3, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__e71a969b_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__55a47493_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e71a969b_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xe71a969b, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__6550d740_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__55a47493_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6550d740_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6550d740, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__ec1a9e7a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__55a47493_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ec1a9e7a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xec1a9e7a, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__6c50e245_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__55a47493_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c50e245_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x6c50e245, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__1f670b1f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__55a47493_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f670b1f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x1f670b1f, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__3012d86a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__55a47493_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3012d86a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x3012d86a, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__8647be56_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__55a47493_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8647be56_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8647be56, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__fb9939a9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__55a47493_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fb9939a9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfb9939a9, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__86457fbf_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__55a47493_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__86457fbf_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x86457fbf, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__f787ea3c_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__55a47493_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f787ea3c_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xf787ea3c, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__943bf7fd_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__55a47493_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__943bf7fd_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x943bf7fd, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__ef7d3016_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__55a47493_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ef7d3016_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xef7d3016, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__29671add_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__55a47493_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__29671add_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x29671add, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__2612c8ac_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__55a47493_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2612c8ac_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2612c8ac, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__2867194a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__55a47493_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2867194a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2867194a, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__2712ca3f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__55a47493_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2712ca3f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2712ca3f, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__2367116b_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__55a47493_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2367116b_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2367116b, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__2412c586_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__55a47493_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2412c586_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2412c586, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__4830da26_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__55a47493_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4830da26_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4830da26, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__137fa837_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__55a47493_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__137fa837_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x137fa837, "visitExprConstRange", 984 };
+TypeInfo * __type_info__8734b689_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__55a47493_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8734b689_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8734b689, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__4523a9da_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__55a47493_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4523a9da_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x4523a9da, "visitExprConstURange", 992 };
+TypeInfo * __type_info__9d621ee9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__55a47493_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d621ee9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9d621ee9, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__85eb4be6_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__55a47493_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85eb4be6_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x85eb4be6, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__5e4631a1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__55a47493_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e4631a1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x5e4631a1, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__2f4c15d8_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__55a47493_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2f4c15d8_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2f4c15d8, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__fb800a69_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__55a47493_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb800a69_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfb800a69, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__5ec67f5e_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__55a47493_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5ec67f5e_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x5ec67f5e, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__fa8008d6_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__55a47493_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fa8008d6_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfa8008d6, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__5fc680f1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__55a47493_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fc680f1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x5fc680f1, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__fd800d8f_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__55a47493_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fd800d8f_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xfd800d8f, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__60c68284_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__55a47493_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__60c68284_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x60c68284, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__aaec7954_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__55a47493_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aaec7954_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xaaec7954, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__409e1923_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__55a47493_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__409e1923_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x409e1923, "visitExprConstString", 1040 };
+TypeInfo * __type_info__a0ed1634_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__55a47493_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ed1634_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa0ed1634, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__575beb97_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__55a47493_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__575beb97_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x575beb97, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__a8494a7a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__55a47493_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a8494a7a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xa8494a7a, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__7a69d2c9_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__55a47493_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a69d2c9_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x7a69d2c9, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__2dbd7de1_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__55a47493_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2dbd7de1_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x2dbd7de1, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__9a902e68_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__55a47493_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9a902e68_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x9a902e68, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__bc8f6ccd_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__55a47493_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bc8f6ccd_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xbc8f6ccd, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__ce877190_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__55a47493_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ce877190_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xce877190, "visitExprReader", 1072 };
+TypeInfo * __type_info__af8479d4_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__55a47493_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af8479d4_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xaf8479d4, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__c7c8482d_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__55a47493_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c7c8482d_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0xc7c8482d, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__8e6ce11a_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__55a47493_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8e6ce11a_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x8e6ce11a, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__69dafa2d_arg_types_var_1436841107[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__55a47493_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__69dafa2d_arg_types_var_1436841107, nullptr, 2, 0, nullptr, 28, 0x69dafa2d, "visitExprCallMacro", 1088 };
+VarInfo __struct_info__55a47493_field_272 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcc33673d, "astChanged", 1092 };
+VarInfo * __struct_info__55a47493_fields[273] =  { &__struct_info__55a47493_field_0, &__struct_info__55a47493_field_1, &__struct_info__55a47493_field_2, &__struct_info__55a47493_field_3, &__struct_info__55a47493_field_4, &__struct_info__55a47493_field_5, &__struct_info__55a47493_field_6, &__struct_info__55a47493_field_7, &__struct_info__55a47493_field_8, &__struct_info__55a47493_field_9, &__struct_info__55a47493_field_10, &__struct_info__55a47493_field_11, &__struct_info__55a47493_field_12, &__struct_info__55a47493_field_13, &__struct_info__55a47493_field_14, &__struct_info__55a47493_field_15, &__struct_info__55a47493_field_16, &__struct_info__55a47493_field_17, &__struct_info__55a47493_field_18, &__struct_info__55a47493_field_19, &__struct_info__55a47493_field_20, &__struct_info__55a47493_field_21, &__struct_info__55a47493_field_22, &__struct_info__55a47493_field_23, &__struct_info__55a47493_field_24, &__struct_info__55a47493_field_25, &__struct_info__55a47493_field_26, &__struct_info__55a47493_field_27, &__struct_info__55a47493_field_28, &__struct_info__55a47493_field_29, &__struct_info__55a47493_field_30, &__struct_info__55a47493_field_31, &__struct_info__55a47493_field_32, &__struct_info__55a47493_field_33, &__struct_info__55a47493_field_34, &__struct_info__55a47493_field_35, &__struct_info__55a47493_field_36, &__struct_info__55a47493_field_37, &__struct_info__55a47493_field_38, &__struct_info__55a47493_field_39, &__struct_info__55a47493_field_40, &__struct_info__55a47493_field_41, &__struct_info__55a47493_field_42, &__struct_info__55a47493_field_43, &__struct_info__55a47493_field_44, &__struct_info__55a47493_field_45, &__struct_info__55a47493_field_46, &__struct_info__55a47493_field_47, &__struct_info__55a47493_field_48, &__struct_info__55a47493_field_49, &__struct_info__55a47493_field_50, &__struct_info__55a47493_field_51, &__struct_info__55a47493_field_52, &__struct_info__55a47493_field_53, &__struct_info__55a47493_field_54, &__struct_info__55a47493_field_55, &__struct_info__55a47493_field_56, &__struct_info__55a47493_field_57, &__struct_info__55a47493_field_58, &__struct_info__55a47493_field_59, &__struct_info__55a47493_field_60, &__struct_info__55a47493_field_61, &__struct_info__55a47493_field_62, &__struct_info__55a47493_field_63, &__struct_info__55a47493_field_64, &__struct_info__55a47493_field_65, &__struct_info__55a47493_field_66, &__struct_info__55a47493_field_67, &__struct_info__55a47493_field_68, &__struct_info__55a47493_field_69, &__struct_info__55a47493_field_70, &__struct_info__55a47493_field_71, &__struct_info__55a47493_field_72, &__struct_info__55a47493_field_73, &__struct_info__55a47493_field_74, &__struct_info__55a47493_field_75, &__struct_info__55a47493_field_76, &__struct_info__55a47493_field_77, &__struct_info__55a47493_field_78, &__struct_info__55a47493_field_79, &__struct_info__55a47493_field_80, &__struct_info__55a47493_field_81, &__struct_info__55a47493_field_82, &__struct_info__55a47493_field_83, &__struct_info__55a47493_field_84, &__struct_info__55a47493_field_85, &__struct_info__55a47493_field_86, &__struct_info__55a47493_field_87, &__struct_info__55a47493_field_88, &__struct_info__55a47493_field_89, &__struct_info__55a47493_field_90, &__struct_info__55a47493_field_91, &__struct_info__55a47493_field_92, &__struct_info__55a47493_field_93, &__struct_info__55a47493_field_94, &__struct_info__55a47493_field_95, &__struct_info__55a47493_field_96, &__struct_info__55a47493_field_97, &__struct_info__55a47493_field_98, &__struct_info__55a47493_field_99, &__struct_info__55a47493_field_100, &__struct_info__55a47493_field_101, &__struct_info__55a47493_field_102, &__struct_info__55a47493_field_103, &__struct_info__55a47493_field_104, &__struct_info__55a47493_field_105, &__struct_info__55a47493_field_106, &__struct_info__55a47493_field_107, &__struct_info__55a47493_field_108, &__struct_info__55a47493_field_109, &__struct_info__55a47493_field_110, &__struct_info__55a47493_field_111, &__struct_info__55a47493_field_112, &__struct_info__55a47493_field_113, &__struct_info__55a47493_field_114, &__struct_info__55a47493_field_115, &__struct_info__55a47493_field_116, &__struct_info__55a47493_field_117, &__struct_info__55a47493_field_118, &__struct_info__55a47493_field_119, &__struct_info__55a47493_field_120, &__struct_info__55a47493_field_121, &__struct_info__55a47493_field_122, &__struct_info__55a47493_field_123, &__struct_info__55a47493_field_124, &__struct_info__55a47493_field_125, &__struct_info__55a47493_field_126, &__struct_info__55a47493_field_127, &__struct_info__55a47493_field_128, &__struct_info__55a47493_field_129, &__struct_info__55a47493_field_130, &__struct_info__55a47493_field_131, &__struct_info__55a47493_field_132, &__struct_info__55a47493_field_133, &__struct_info__55a47493_field_134, &__struct_info__55a47493_field_135, &__struct_info__55a47493_field_136, &__struct_info__55a47493_field_137, &__struct_info__55a47493_field_138, &__struct_info__55a47493_field_139, &__struct_info__55a47493_field_140, &__struct_info__55a47493_field_141, &__struct_info__55a47493_field_142, &__struct_info__55a47493_field_143, &__struct_info__55a47493_field_144, &__struct_info__55a47493_field_145, &__struct_info__55a47493_field_146, &__struct_info__55a47493_field_147, &__struct_info__55a47493_field_148, &__struct_info__55a47493_field_149, &__struct_info__55a47493_field_150, &__struct_info__55a47493_field_151, &__struct_info__55a47493_field_152, &__struct_info__55a47493_field_153, &__struct_info__55a47493_field_154, &__struct_info__55a47493_field_155, &__struct_info__55a47493_field_156, &__struct_info__55a47493_field_157, &__struct_info__55a47493_field_158, &__struct_info__55a47493_field_159, &__struct_info__55a47493_field_160, &__struct_info__55a47493_field_161, &__struct_info__55a47493_field_162, &__struct_info__55a47493_field_163, &__struct_info__55a47493_field_164, &__struct_info__55a47493_field_165, &__struct_info__55a47493_field_166, &__struct_info__55a47493_field_167, &__struct_info__55a47493_field_168, &__struct_info__55a47493_field_169, &__struct_info__55a47493_field_170, &__struct_info__55a47493_field_171, &__struct_info__55a47493_field_172, &__struct_info__55a47493_field_173, &__struct_info__55a47493_field_174, &__struct_info__55a47493_field_175, &__struct_info__55a47493_field_176, &__struct_info__55a47493_field_177, &__struct_info__55a47493_field_178, &__struct_info__55a47493_field_179, &__struct_info__55a47493_field_180, &__struct_info__55a47493_field_181, &__struct_info__55a47493_field_182, &__struct_info__55a47493_field_183, &__struct_info__55a47493_field_184, &__struct_info__55a47493_field_185, &__struct_info__55a47493_field_186, &__struct_info__55a47493_field_187, &__struct_info__55a47493_field_188, &__struct_info__55a47493_field_189, &__struct_info__55a47493_field_190, &__struct_info__55a47493_field_191, &__struct_info__55a47493_field_192, &__struct_info__55a47493_field_193, &__struct_info__55a47493_field_194, &__struct_info__55a47493_field_195, &__struct_info__55a47493_field_196, &__struct_info__55a47493_field_197, &__struct_info__55a47493_field_198, &__struct_info__55a47493_field_199, &__struct_info__55a47493_field_200, &__struct_info__55a47493_field_201, &__struct_info__55a47493_field_202, &__struct_info__55a47493_field_203, &__struct_info__55a47493_field_204, &__struct_info__55a47493_field_205, &__struct_info__55a47493_field_206, &__struct_info__55a47493_field_207, &__struct_info__55a47493_field_208, &__struct_info__55a47493_field_209, &__struct_info__55a47493_field_210, &__struct_info__55a47493_field_211, &__struct_info__55a47493_field_212, &__struct_info__55a47493_field_213, &__struct_info__55a47493_field_214, &__struct_info__55a47493_field_215, &__struct_info__55a47493_field_216, &__struct_info__55a47493_field_217, &__struct_info__55a47493_field_218, &__struct_info__55a47493_field_219, &__struct_info__55a47493_field_220, &__struct_info__55a47493_field_221, &__struct_info__55a47493_field_222, &__struct_info__55a47493_field_223, &__struct_info__55a47493_field_224, &__struct_info__55a47493_field_225, &__struct_info__55a47493_field_226, &__struct_info__55a47493_field_227, &__struct_info__55a47493_field_228, &__struct_info__55a47493_field_229, &__struct_info__55a47493_field_230, &__struct_info__55a47493_field_231, &__struct_info__55a47493_field_232, &__struct_info__55a47493_field_233, &__struct_info__55a47493_field_234, &__struct_info__55a47493_field_235, &__struct_info__55a47493_field_236, &__struct_info__55a47493_field_237, &__struct_info__55a47493_field_238, &__struct_info__55a47493_field_239, &__struct_info__55a47493_field_240, &__struct_info__55a47493_field_241, &__struct_info__55a47493_field_242, &__struct_info__55a47493_field_243, &__struct_info__55a47493_field_244, &__struct_info__55a47493_field_245, &__struct_info__55a47493_field_246, &__struct_info__55a47493_field_247, &__struct_info__55a47493_field_248, &__struct_info__55a47493_field_249, &__struct_info__55a47493_field_250, &__struct_info__55a47493_field_251, &__struct_info__55a47493_field_252, &__struct_info__55a47493_field_253, &__struct_info__55a47493_field_254, &__struct_info__55a47493_field_255, &__struct_info__55a47493_field_256, &__struct_info__55a47493_field_257, &__struct_info__55a47493_field_258, &__struct_info__55a47493_field_259, &__struct_info__55a47493_field_260, &__struct_info__55a47493_field_261, &__struct_info__55a47493_field_262, &__struct_info__55a47493_field_263, &__struct_info__55a47493_field_264, &__struct_info__55a47493_field_265, &__struct_info__55a47493_field_266, &__struct_info__55a47493_field_267, &__struct_info__55a47493_field_268, &__struct_info__55a47493_field_269, &__struct_info__55a47493_field_270, &__struct_info__55a47493_field_271, &__struct_info__55a47493_field_272 };
+StructInfo __struct_info__55a47493 = {"SoaVisitor", __struct_info__55a47493_fields, 273, 1096, -1, nullptr, 0x55a47493 };
+VarInfo __struct_info__77bf9876_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x915cd895, "__rtti", 0 };
+TypeInfo * __type_info__ae8a6712_arg_types_var_2009045110[1] = { &__type_info__8891fc55 };
+VarInfo __struct_info__77bf9876_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae8a6712_arg_types_var_2009045110, nullptr, 1, 0, nullptr, 28, 0xae8a6712, "__finalize", 8 };
+TypeInfo * __type_info__be271e3a_arg_types_var_2009045110[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__77bf9876_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__be271e3a_arg_types_var_2009045110, nullptr, 5, 0, nullptr, 28, 0xbe271e3a, "apply", 12 };
+TypeInfo * __type_info__2a02779d_arg_types_var_2009045110[5] = { &__type_info__8891fc55, &__type_info__2d8fb614, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__77bf9876_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__2a02779d_arg_types_var_2009045110, nullptr, 5, 0, nullptr, 28, 0x2a02779d, "finish", 16 };
+VarInfo * __struct_info__77bf9876_fields[4] =  { &__struct_info__77bf9876_field_0, &__struct_info__77bf9876_field_1, &__struct_info__77bf9876_field_2, &__struct_info__77bf9876_field_3 };
+StructInfo __struct_info__77bf9876 = {"SoaStructMacro", __struct_info__77bf9876_fields, 4, 24, -1, nullptr, 0x77bf9876 };
+VarInfo __struct_info__5ed6db18_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f90ec93, "__rtti", 0 };
+TypeInfo * __type_info__fb05f748_arg_types_var_1591139096[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__5ed6db18_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb05f748_arg_types_var_1591139096, nullptr, 1, 0, nullptr, 28, 0xfb05f748, "__finalize", 8 };
+TypeInfo * __type_info__1e070140_arg_types_var_1591139096[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__5ed6db18_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1e070140_arg_types_var_1591139096, nullptr, 3, 0, nullptr, 28, 0x1e070140, "apply", 12 };
+VarInfo * __struct_info__5ed6db18_fields[3] =  { &__struct_info__5ed6db18_field_0, &__struct_info__5ed6db18_field_1, &__struct_info__5ed6db18_field_2 };
+StructInfo __struct_info__5ed6db18 = {"AstPassMacro", __struct_info__5ed6db18_fields, 3, 16, -1, nullptr, 0x5ed6db18 };
+TypeInfo __type_info__10db1c1d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x10db1c1d };
+TypeInfo __type_info__da50b805 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__515c0a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xda50b805 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__f42f651e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStringBuilder"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf42f651e };
+TypeInfo __type_info__dc52e0d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a8d37f6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xdc52e0d5 };
+TypeInfo __type_info__c0e5e0ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstURange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc0e5e0ad };
+TypeInfo __type_info__8bc5634d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__91c4dfb3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8bc5634d };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__bab365e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a40a0d70, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xbab365e };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__3737d9d1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeGenerator"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3737d9d1 };
+TypeInfo __type_info__cd849a9b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xcd849a9b };
+TypeInfo __type_info__aaadd575 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeLineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaaadd575 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__c2b9b42c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc2b9b42c };
+TypeInfo __type_info__6f381053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprVar"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6f381053 };
+TypeInfo __type_info__261bce6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x261bce6f };
+TypeInfo __type_info__dd644f60 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReturn"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdd644f60 };
+TypeInfo __type_info__e749bd33 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5527f9ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe749bd33 };
+TypeInfo __type_info__73c8114e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dd644f60, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x73c8114e };
+TypeInfo __type_info__7da04467 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4aee91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7da04467 };
+TypeInfo __type_info__b1ceb1d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Value"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb1ceb1d4 };
+TypeInfo __type_info__653ef983 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8da119, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x653ef983 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__1cb4fa6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e97755bb, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1cb4fa6d };
+TypeInfo __type_info__515c0a3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMove"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x515c0a3 };
+TypeInfo __type_info__ccb7c90a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccb7c90a };
+TypeInfo __type_info__b3bcfd53 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb3bcfd53 };
+TypeInfo __type_info__46fed0f3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b867c43d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x46fed0f3 };
+TypeInfo __type_info__523f6667 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x523f6667 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__6d1d425d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b2cb4a2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6d1d425d };
+TypeInfo __type_info__ebcc21eb = { Type::tStructure, &__struct_info__d8299e85, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xebcc21eb };
+TypeInfo __type_info__5ef84086 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStaticAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ef84086 };
+TypeInfo __type_info__7a1c4eb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc0d99dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7a1c4eb7 };
+TypeInfo __type_info__2b3e54e5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBool"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2b3e54e5 };
+TypeInfo __type_info__4de83811 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstPtr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4de83811 };
+TypeInfo __type_info__94ae69a3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aaadd575, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x94ae69a3 };
+TypeInfo __type_info__87a6e894 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ebfa292, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87a6e894 };
+TypeInfo __type_info__a703f317 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0xa703f317 };
+TypeInfo __type_info__a6a527e0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNew"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa6a527e0 };
+TypeInfo __type_info__f494d7e5 = { Type::tStructure, &__struct_info__77bf9876, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xf494d7e5 };
+TypeInfo __type_info__83498580 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstDouble"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83498580 };
+TypeInfo __type_info__a960d6ab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa960d6ab };
+TypeInfo __type_info__b108e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb108e3 };
+TypeInfo __type_info__d7eb08f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9920ba3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7eb08f1 };
+TypeInfo __type_info__f486e881 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a70d70f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf486e881 };
+TypeInfo __type_info__fdd27932 = { Type::tStructure, &__struct_info__5ed6db18, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xfdd27932 };
+TypeInfo __type_info__1683ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1683ec13 };
+TypeInfo __type_info__1d5a02b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6f381053, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1d5a02b1 };
+TypeInfo __type_info__8f8da119 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprArrayComprehension"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8da119 };
+TypeInfo __type_info__5bc565f1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5bc565f1 };
+TypeInfo __type_info__819d499d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5dc56917, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x819d499d };
+TypeInfo __type_info__81be117c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x81be117c };
+TypeInfo __type_info__b5d7ce5d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ec0323f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb5d7ce5d };
+TypeInfo __type_info__32f7a66b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cae7a171, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32f7a66b };
+TypeInfo __type_info__cae7a171 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDebug"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcae7a171 };
+TypeInfo __type_info__453f3d02 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd57da00, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x453f3d02 };
+TypeInfo __type_info__30023ebb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f6a7cad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x30023ebb };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4edf488d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x4edf488d };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8fce7587 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a1ba446d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fce7587 };
+TypeInfo __type_info__a01f8605 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__721467d3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa01f8605 };
+TypeInfo __type_info__15780d4b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3737d9d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15780d4b };
+TypeInfo __type_info__7ec0323f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLet"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ec0323f };
+TypeInfo __type_info__ae076c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9a5b5986, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xae076c };
+TypeInfo __type_info__ff9fd5d3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xff9fd5d3 };
+TypeInfo __type_info__3c4f7906 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c4f7906 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__c4ccbb7e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83498580, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc4ccbb7e };
+TypeInfo __type_info__8e3dc326 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a65edd74, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8e3dc326 };
+TypeInfo __type_info__d73ee2dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Variable"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd73ee2dd };
+TypeInfo __type_info__72ae9081 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccc9122b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72ae9081 };
+TypeInfo __type_info__c831b26a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTryCatch"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc831b26a };
+TypeInfo __type_info__72374920 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__26379cda, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72374920 };
+TypeInfo __type_info__d25748d6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4fa9a2d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd25748d6 };
+TypeInfo __type_info__3a70d70f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprContinue"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a70d70f };
+TypeInfo __type_info__7c510f91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDelete"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7c510f91 };
+TypeInfo __type_info__b66d9ef1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8121e453, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb66d9ef1 };
+TypeInfo __type_info__91c4dfb3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprClone"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x91c4dfb3 };
+TypeInfo __type_info__15e14f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1d3d6764, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15e14f92 };
+TypeInfo __type_info__ebc70931 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeArray"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xebc70931 };
+TypeInfo __type_info__3c8fd4b4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8728109a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c8fd4b4 };
+TypeInfo __type_info__b87fa7e0 = { Type::tStructure, &__struct_info__55a47493, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb87fa7e0 };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__8891fc55 = { Type::tStructure, &__struct_info__713aafe3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x8891fc55 };
+TypeInfo __type_info__7ebfa292 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWith"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ebfa292 };
+TypeInfo __type_info__9773df12 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9773df12 };
+TypeInfo __type_info__317f8d25 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::FieldDeclaration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x317f8d25 };
+TypeInfo __type_info__3c6fa07f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5bc565f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c6fa07f };
+TypeInfo __type_info__9920ba3b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9920ba3b };
+TypeInfo __type_info__8f234b97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6cb0399, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f234b97 };
+TypeInfo __type_info__87882376 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4f3571c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87882376 };
+TypeInfo __type_info__5f6a7cad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBreak"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f6a7cad };
+TypeInfo __type_info__10b7decc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c831b26a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10b7decc };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8494e015 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLooksLikeCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8494e015 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b867c43d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCast"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb867c43d };
+TypeInfo __type_info__9e20c21a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9e20c21a };
+TypeInfo __type_info__b9491240 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf57dd26, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9491240 };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__963c776b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0e5e0ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x963c776b };
+TypeInfo __type_info__b58fe8a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a527e0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb58fe8a6 };
+TypeInfo __type_info__5527f9ed = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFor"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5527f9ed };
+TypeInfo __type_info__fba33907 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8494e015, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfba33907 };
+TypeInfo __type_info__51c55633 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x51c55633 };
+TypeInfo __type_info__84917dd0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d00bb3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x84917dd0 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__68f47b8a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__251bccdc, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x68f47b8a };
+TypeInfo __type_info__34157e23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__309172d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x34157e23 };
+TypeInfo __type_info__37ca469d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27a9a437, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x37ca469d };
+TypeInfo __type_info__14c14bf4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c627fc0a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x14c14bf4 };
+TypeInfo __type_info__4fa9a2d8 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSwizzle"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4fa9a2d8 };
+TypeInfo __type_info__d4f3571c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLabel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4f3571c };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__10edfe53 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8b0275, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10edfe53 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__2481035b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f20c3ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2481035b };
+TypeInfo __type_info__a1ba446d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprGoto"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa1ba446d };
+TypeInfo __type_info__9fee7340 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f1bdc9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9fee7340 };
+TypeInfo __type_info__ada7aa90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstString"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xada7aa90 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__664a2fe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374bcd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x664a2fe7 };
+TypeInfo __type_info__655bd8a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f66d4d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x655bd8a4 };
+TypeInfo __type_info__2f1bdc9a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2f1bdc9a };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__5dc56917 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5dc56917 };
+TypeInfo __type_info__d16acbbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b3e54e5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd16acbbb };
+TypeInfo __type_info__d4aee91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFind"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4aee91 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__d057deb9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd057deb9 };
+TypeInfo __type_info__6dd946fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x6dd946fa };
+TypeInfo __type_info__32b24044 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32b24044 };
+TypeInfo __type_info__531e5432 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7df5ef2c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x531e5432 };
+TypeInfo __type_info__e0a995b4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Enumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe0a995b4 };
+TypeInfo __type_info__368fac4c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__231bc9b6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x368fac4c };
+TypeInfo __type_info__df40cfd6 = { Type::tStructure, &__struct_info__476d1163, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xdf40cfd6 };
+TypeInfo __type_info__76b8ad03 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprYield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76b8ad03 };
+TypeInfo __type_info__48d9d78 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c4f7906, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x48d9d78 };
+TypeInfo __type_info__6535171f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIfThenElse"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6535171f };
+TypeInfo __type_info__9ee277f5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAddr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9ee277f5 };
+TypeInfo __type_info__e7b89eff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__10db1c1d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe7b89eff };
+TypeInfo __type_info__8f8b0275 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8b0275 };
+TypeInfo __type_info__764dc75a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b1ceb1d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x764dc75a };
+TypeInfo __type_info__e2deda56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ada7aa90, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe2deda56 };
+TypeInfo __type_info__5a28d785 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprKeyExists"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5a28d785 };
+TypeInfo __type_info__9445fbcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7c510f91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9445fbcf };
+TypeInfo __type_info__7df5ef2c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7df5ef2c };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__6c2a86f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bcfd53, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6c2a86f9 };
+TypeInfo __type_info__e97755bb = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWhile"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe97755bb };
+TypeInfo __type_info__295e937b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4de83811, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x295e937b };
+TypeInfo __type_info__1d3d6764 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBitfield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1d3d6764 };
+TypeInfo __type_info__251bccdc = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x251bccdc };
+TypeInfo __type_info__bd757ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeTuple"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbd757ca };
+TypeInfo __type_info__5ac5645e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ac5645e };
+TypeInfo __type_info__e4d4c1e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccb7c90a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe4d4c1e4 };
+TypeInfo __type_info__d514cba4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprErase"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd514cba4 };
+TypeInfo __type_info__60d19370 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e20c21a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x60d19370 };
+TypeInfo __type_info__c5ddc6fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d514cba4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc5ddc6fa };
+TypeInfo __type_info__9f20c3ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9f20c3ad };
+TypeInfo __type_info__1b3c6d8d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1b3c6d8d };
+TypeInfo __type_info__6529db2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1b3c6d8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6529db2b };
+TypeInfo __type_info__a8d37f6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNullCoalescing"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa8d37f6f };
+TypeInfo __type_info__d7ddca10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ef84086, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7ddca10 };
+TypeInfo __type_info__130d26f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__51c55633, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x130d26f9 };
+TypeInfo __type_info__721467d3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x721467d3 };
+TypeInfo __type_info__8728109a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIs"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8728109a };
+TypeInfo __type_info__1bb5fdf7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ebc70931, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1bb5fdf7 };
+TypeInfo __type_info__a65edd74 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstEnumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa65edd74 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__5ca338ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6535171f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x5ca338ad };
+TypeInfo __type_info__d180e781 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b8ad03, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd180e781 };
+TypeInfo __type_info__74b0f2db = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Ptr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74b0f2db };
+TypeInfo __type_info__cf57dd26 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcf57dd26 };
+TypeInfo __type_info__535415eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9338185, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x535415eb };
+TypeInfo __type_info__ccc9122b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccc9122b };
+TypeInfo __type_info__b2cb4a2b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCopy"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb2cb4a2b };
+TypeInfo __type_info__a5b6b194 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ac5645e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa5b6b194 };
+TypeInfo __type_info__ccee123b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a28d785, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xccee123b };
+TypeInfo __type_info__374b4b09 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::MakeFieldDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374b4b09 };
+TypeInfo __type_info__9338185 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMemZero"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9338185 };
+TypeInfo __type_info__cf52b1be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c2b9b42c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf52b1be };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__9a5b5986 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprInvoke"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9a5b5986 };
+TypeInfo __type_info__7856e79d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::TypeDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7856e79d };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__5f1adc0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeContext"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f1adc0e };
+TypeInfo __type_info__cd57da00 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp1"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcd57da00 };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__a8981616 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa8981616 };
+TypeInfo __type_info__88de8728 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9773df12, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x88de8728 };
+TypeInfo __type_info__1b9f61f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd757ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1b9f61f8 };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__231bc9b6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x231bc9b6 };
+TypeInfo __type_info__8121e453 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNamedCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8121e453 };
+TypeInfo __type_info__d3ebcc43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xd3ebcc43 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__d8ac9e75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__261bce6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd8ac9e75 };
+TypeInfo __type_info__fc0d99dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConst"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xfc0d99dd };
+TypeInfo __type_info__c1e3d526 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__858d2368, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc1e3d526 };
+TypeInfo __type_info__c627fc0a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstRange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc627fc0a };
+TypeInfo __type_info__a40a0d70 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAscend"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa40a0d70 };
+TypeInfo __type_info__858d2368 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprUnsafe"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x858d2368 };
+TypeInfo __type_info__26379cda = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprQuote"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x26379cda };
+TypeInfo __type_info__c6cb0399 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc6cb0399 };
+TypeInfo __type_info__f66d4d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf66d4d6 };
+TypeInfo __type_info__fe4bfa47 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9ee277f5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfe4bfa47 };
+TypeInfo __type_info__cb3ec93c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f1adc0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcb3ec93c };
+TypeInfo __type_info__27a9a437 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprPtr2Ref"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x27a9a437 };
+TypeInfo __type_info__374bcd9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374bcd9 };
+TypeInfo __type_info__39dd41c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__74b0f2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x39dd41c1 };
+TypeInfo __type_info__d00bb3d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd00bb3d6 };
+TypeInfo __type_info__f1eeff10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f42f651e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf1eeff10 };
+TypeInfo __type_info__b081465d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb081465d };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__cf76cec3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b081465d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf76cec3 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+TypeInfo __type_info__ed20bab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d057deb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xed20bab };
+TypeInfo __type_info__309172d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeStruct"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x309172d };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__3ffbf730, &__type_info__a703f317, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__a703f317, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[1] = { &__type_info__a703f317 };
+TypeInfo * __tinfo_3[3] = { &__type_info__3ffbf730, &__type_info__a703f317, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[1] = { &__type_info__e8c29053 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+namespace ast {
+
+struct AstPassMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(AstPassMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+// unused structure AstReaderMacro
+namespace ast {
+
+struct AstStructureAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstStructureAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstStructureAnnotation,finish)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==1096,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+}
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace soa {
+
+struct SoaStructMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstStructureAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(SoaStructMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,apply)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaStructMacro,finish)==16,"structure field offset mismatch with DAS");
+}
+namespace soa {
+
+struct SoaVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	bool astChanged;
+};
+static_assert(sizeof(SoaVisitor)==1096,"structure size mismatch with DAS");
+static_assert(offsetof(SoaVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaVisitor,astChanged)==1092,"structure field offset mismatch with DAS");
+}
+namespace soa {
+
+struct SoaInferMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(SoaInferMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(SoaInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SoaInferMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+
+inline soa::SoaInferMacro SoaInferMacro_35c1dde242e012a0 ( Context * __context__ );
+inline void _FuncSoaInferMacro_0x27___finalize_356f00648867f280 ( Context * __context__, soa::SoaInferMacro & __self_rename_at_148 );
+inline bool _FuncSoaInferMacro_0x60_apply_fe28b76dff189fc2 ( Context * __context__, soa::SoaInferMacro & __self_rename_at_149, smart_ptr_raw<Program> const  __prog_rename_at_149, Module * const  __mod_rename_at_149 );
+inline soa::SoaStructMacro SoaStructMacro_cdd96997fc68f85f ( Context * __context__ );
+inline void _FuncSoaStructMacro_0x27___finalize_d7b9768200d50338 ( Context * __context__, soa::SoaStructMacro & __self_rename_at_100 );
+inline bool _FuncSoaStructMacro_0x60_apply_a57df6f979dad361 ( Context * __context__, soa::SoaStructMacro & __self_rename_at_101, smart_ptr_raw<Structure> __st_rename_at_101, ModuleGroup & __group_rename_at_101, AnnotationArgumentList const  & __args_rename_at_101, das::string & __errors_rename_at_101 );
+inline soa::SoaVisitor SoaVisitor_f5c0fb07db36960a ( Context * __context__ );
+inline void _FuncSoaVisitor_0x27___finalize_93cf734c8407af24 ( Context * __context__, soa::SoaVisitor & __self_rename_at_134 );
+inline smart_ptr_raw<Expression> _FuncSoaVisitor_0x60_visitExprField_a5ca19d69a90188e ( Context * __context__, soa::SoaVisitor & __self_rename_at_136, smart_ptr_raw<ExprField> const  __expr_rename_at_136 );
+inline void __setup_macros_5c1e27e99759101c ( Context * __context__ );
+inline void _Funcast_0x60_add_new_infer_macro_fd29f24b0a980c18 ( Context * __context__, char * const  __name_rename_at_535, soa::SoaInferMacro * const  __someClassPtr_rename_at_535 );
+inline void _Funcast_0x60_add_new_structure_annotation_6c64ba547823edbc ( Context * __context__, char * const  __name_rename_at_511, soa::SoaStructMacro * const  __someClassPtr_rename_at_511 );
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_3fe2c27deebf198e ( Context * __context__, char * const  __name_rename_at_489, soa::SoaInferMacro * const  __someClassPtr_rename_at_489 );
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_8f9a077790c2831b ( Context * __context__, char * const  __name_rename_at_455, soa::SoaStructMacro * const  __someClassPtr_rename_at_455 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_4d935fa73e425b1f ( Context * __context__, soa::SoaVisitor const  & __someClass_rename_at_463 );
+inline smart_ptr_raw<ExprField> _Funcbuiltin_0x60_clone_to_move_eee86bd9efee895c ( Context * __context__, smart_ptr_raw<ExprField> const  __clone_src_rename_at_131 );
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_436 );
+inline void clone_2094b4cbe51f23fc ( Context * __context__, smart_ptr_raw<ExprField> & __dest_rename_at_133, smart_ptr_raw<ExprField> const  __src_rename_at_133 );
+inline void clone_71630f94910d7ae0 ( Context * __context__, smart_ptr_raw<Function> & __dest_rename_at_79, void * const  __src_rename_at_79 );
+inline void clone_cde054d1a2364b31 ( Context * __context__, smart_ptr_raw<Structure> & __dest_rename_at_121, void * const  __src_rename_at_121 );
+inline void clone_acf198b9505dc74 ( Context * __context__, smart_ptr_raw<TypeDecl> & __dest_rename_at_116, void * const  __src_rename_at_116 );
+inline void finalize_158afa29135805bc ( Context * __context__, soa::SoaVisitor * & ____this_rename_at_156 );
+inline void finalize_b8975d047d050b3d ( Context * __context__, soa::SoaInferMacro & ____this_rename_at_148 );
+inline void finalize_219b89fabaf27b02 ( Context * __context__, soa::SoaStructMacro & ____this_rename_at_100 );
+inline void finalize_2957132ed31e5a05 ( Context * __context__, soa::SoaVisitor & ____this_rename_at_134 );
+inline void generate_column_function_f46c6a302e3624a ( Context * __context__, smart_ptr_raw<Structure> __st_rename_at_60, Structure * const  __soaType_rename_at_60, char * const  __fnname_rename_at_60, char * const  __argName_rename_at_60, smart_ptr_raw<TypeDecl> __argT_rename_at_60, bool __fieldwise_rename_at_60, LineInfo const  & __at_rename_at_60 );
+inline void generate_length_d5c5f9c499acc93f ( Context * __context__, smart_ptr_raw<Structure> __st_rename_at_86, Structure * const  __soaType_rename_at_86, LineInfo const  & __at_rename_at_86 );
+inline bool is_soa_type_b1470b4e8180af69 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_33 );
+inline smart_ptr_raw<TypeDecl> make_int_type_2d01f63fd95167c3 ( Context * __context__, LineInfo const  & __at_rename_at_48 );
+inline smart_ptr_raw<TypeDecl> make_struct_type_11e1d9a357644e14 ( Context * __context__, Structure * const  __st_rename_at_41, bool __isConst_rename_at_41, LineInfo const  & __at_rename_at_41 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_5b91a69ce4bea454 ( Context * __context__, soa::SoaInferMacro const  & __cl_rename_at_88 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_6a2663b9b0ebdbb ( Context * __context__, soa::SoaStructMacro const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_5c1e27e99759101c(__context__);
+}
+
+inline soa::SoaInferMacro SoaInferMacro_35c1dde242e012a0 ( Context * __context__ )
+{
+	return das_auto_cast<soa::SoaInferMacro>::cast((([&]() -> soa::SoaInferMacro {
+		soa::SoaInferMacro __mks_148;
+		das_copy((__mks_148.__rtti),(((void *)(&__type_info__df40cfd6))));
+		das_copy((__mks_148.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstPassMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaInferMacro'__finalize SoaInferMacro*/ 1903241135u)))));
+		das_copy((__mks_148.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaInferMacro`apply SoaInferMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const*/ 600025334u)))));
+		return __mks_148;
+	})()));
+}
+
+inline void _FuncSoaInferMacro_0x27___finalize_356f00648867f280 ( Context * __context__, soa::SoaInferMacro &  __self_rename_at_148 )
+{
+	finalize_b8975d047d050b3d(__context__,das_arg<soa::SoaInferMacro>::pass(__self_rename_at_148));
+}
+
+inline bool _FuncSoaInferMacro_0x60_apply_fe28b76dff189fc2 ( Context * __context__, soa::SoaInferMacro &  __self_rename_at_149, smart_ptr_raw<Program> const  __prog_rename_at_149, Module * const  __mod_rename_at_149 )
+{
+	soa::SoaVisitor * __astVisitor_rename_at_150 = das_new<soa::SoaVisitor>::make_and_init(__context__,[&]() { return SoaVisitor_f5c0fb07db36960a(__context__); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_151; das_zero(__astVisitorAdapter_rename_at_151); das_move(__astVisitorAdapter_rename_at_151, _Funcast_0x60_make_visitor_4d935fa73e425b1f(__context__,das_arg<soa::SoaVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_150))));
+	astVisit(__prog_rename_at_149,__astVisitorAdapter_rename_at_151);
+	bool __result_rename_at_153 = ((bool)__astVisitor_rename_at_150->astChanged);
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_151);
+	finalize_158afa29135805bc(__context__,__astVisitor_rename_at_150);
+	return das_auto_cast<bool>::cast(__result_rename_at_153);
+}
+
+inline soa::SoaStructMacro SoaStructMacro_cdd96997fc68f85f ( Context * __context__ )
+{
+	return das_auto_cast<soa::SoaStructMacro>::cast((([&]() -> soa::SoaStructMacro {
+		soa::SoaStructMacro __mks_100;
+		das_zero(__mks_100);
+		das_copy((__mks_100.__rtti),(((void *)(&__type_info__f494d7e5))));
+		das_copy((__mks_100.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstStructureAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaStructMacro'__finalize SoaStructMacro*/ 2862454687u)))));
+		das_copy((__mks_100.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstStructureAnnotation,smart_ptr_raw<Structure>,ModuleGroup,AnnotationArgumentList const ,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaStructMacro`apply SoaStructMacro #smart_ptr##handle#Structure #handle#ModuleGroup #handle#AnnotationArgumentList#const #handle#das_string*/ 2554737600u)))));
+		return __mks_100;
+	})()));
+}
+
+inline void _FuncSoaStructMacro_0x27___finalize_d7b9768200d50338 ( Context * __context__, soa::SoaStructMacro &  __self_rename_at_100 )
+{
+	finalize_219b89fabaf27b02(__context__,das_arg<soa::SoaStructMacro>::pass(__self_rename_at_100));
+}
+
+inline bool _FuncSoaStructMacro_0x60_apply_a57df6f979dad361 ( Context * __context__, soa::SoaStructMacro &  __self_rename_at_101, smart_ptr_raw<Structure> __st_rename_at_101, ModuleGroup &  __group_rename_at_101, AnnotationArgumentList const  &  __args_rename_at_101, das::string &  __errors_rename_at_101 ) { das_stack_prologue __prologue(__context__,352,"SoaStructMacro`apply " DAS_FILE_LINE);
+{
+	if ( __st_rename_at_101->fields /*fields*/.size() /*length*/ == 0 )
+	{
+		set_das_string(das_arg<das::string>::pass(__errors_rename_at_101),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "soa structure ")), cast<das::string &>::from(__st_rename_at_101->name /*name*/), cast<char * const >::from(((char *) " has no fields")))));
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		if ( das_get_bitfield(__st_rename_at_101->flags /*flags*/,1u << 0) )
+		{
+			set_das_string(das_arg<das::string>::pass(__errors_rename_at_101),((char *) "soa can't be applied to a class"));
+			return das_auto_cast<bool>::cast(false);
+		} else {
+			LineInfo __at_rename_at_108_ConstRef = ((LineInfo)__st_rename_at_101->at /*at*/);
+	LineInfo const  & __at_rename_at_108 = __at_rename_at_108_ConstRef; ;
+			smart_ptr_raw<Structure> __stype_rename_at_109; das_zero(__stype_rename_at_109); das_move(__stype_rename_at_109, das_ascend_handle<true,smart_ptr_raw<Structure>>::make(__context__,nullptr,(([&](Structure & __mks_109) {
+				das_copy((__mks_109.at /*at*/),(__at_rename_at_108));
+				{
+					set_das_string(das_arg<das::string>::pass(__mks_109.name /*name*/),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<das::string &>::from(__st_rename_at_101->name /*name*/), cast<char * const >::from(((char *) "_SOA")))));
+				}			}))));
+			__stype_rename_at_109->flags /*flags*/ |= 0x10u;
+			{
+				bool __need_loop_111 = true;
+				// fld : ast::FieldDeclaration&
+				das_iterator<das::vector<Structure::FieldDeclaration>> __fld_iterator(__st_rename_at_101->fields /*fields*/);
+				Structure::FieldDeclaration * __fld_rename_at_111;
+				__need_loop_111 = __fld_iterator.first(__context__,(__fld_rename_at_111)) && __need_loop_111;
+				for ( ; __need_loop_111 ; __need_loop_111 = __fld_iterator.next(__context__,(__fld_rename_at_111)) )
+				{
+					smart_ptr_raw<TypeDecl> __ftype_rename_at_112; das_zero(__ftype_rename_at_112); das_move(__ftype_rename_at_112, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_112) {
+						das_copy((__mks_112.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tArray));
+						das_copy((__mks_112.at /*at*/),((*__fld_rename_at_111).at /*at*/));
+					}))));
+					smart_ptr<TypeDecl> __fldT_rename_at_113; das_zero(__fldT_rename_at_113); das_move(__fldT_rename_at_113, clone_type((*__fld_rename_at_111).type /*_type*/));
+					das_move(__ftype_rename_at_112->firstType /*firstType*/,__fldT_rename_at_113);
+					addStructureField(__stype_rename_at_109,das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<das::string &>::from((*__fld_rename_at_111).name /*name*/))),__ftype_rename_at_112,das_arg<LineInfo>::pass((*__fld_rename_at_111).at /*at*/));
+					clone_acf198b9505dc74(__context__,__ftype_rename_at_112,nullptr);
+				}
+				__fld_iterator.close(__context__,(__fld_rename_at_111));
+			};
+			Structure * __soaType_rename_at_117 = ((Structure *)_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__stype_rename_at_109));
+			if ( !addModuleStructure(compileModule(__context__),__stype_rename_at_109,__context__) )
+			{
+				set_das_string(das_arg<das::string>::pass(__errors_rename_at_101),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "can't add structure ")), cast<das::string &>::from(__st_rename_at_101->name /*name*/), cast<char * const >::from(((char *) "_SOA, it already exists")))));
+				return das_auto_cast<bool>::cast(false);
+			} else {
+				clone_cde054d1a2364b31(__context__,__stype_rename_at_109,nullptr);
+				generate_length_d5c5f9c499acc93f(__context__,__st_rename_at_101,__soaType_rename_at_117,__at_rename_at_108);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "push"),((char *) "__value"),make_struct_type_11e1d9a357644e14(__context__,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_101),true,__at_rename_at_108),true,__at_rename_at_108);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "emplace"),((char *) "__value"),make_struct_type_11e1d9a357644e14(__context__,_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9(__context__,__st_rename_at_101),false,__at_rename_at_108),true,__at_rename_at_108);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "erase"),((char *) "__index"),make_int_type_2d01f63fd95167c3(__context__,__at_rename_at_108),false,__at_rename_at_108);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "resize"),((char *) "__newSize"),make_int_type_2d01f63fd95167c3(__context__,__at_rename_at_108),false,__at_rename_at_108);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "reserve"),((char *) "__newSize"),make_int_type_2d01f63fd95167c3(__context__,__at_rename_at_108),false,__at_rename_at_108);
+				smart_ptr_raw<TypeDecl> __noArgT_rename_at_128; das_zero(__noArgT_rename_at_128);
+				generate_column_function_f46c6a302e3624a(__context__,__st_rename_at_101,__soaType_rename_at_117,((char *) "clear"),((char *) ""),__noArgT_rename_at_128,false,__at_rename_at_108);
+				return das_auto_cast<bool>::cast(true);
+			};
+		};
+	};
+}}
+
+inline soa::SoaVisitor SoaVisitor_f5c0fb07db36960a ( Context * __context__ )
+{
+	return das_auto_cast<soa::SoaVisitor>::cast((([&]() -> soa::SoaVisitor {
+		soa::SoaVisitor __mks_134;
+		das_zero(__mks_134);
+		das_copy((__mks_134.__rtti),(((void *)(&__type_info__b87fa7e0))));
+		das_copy((__mks_134.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaVisitor'__finalize SoaVisitor*/ 2820724019u)))));
+		das_copy((__mks_134.visitExprField),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@soa::SoaVisitor`visitExprField SoaVisitor #smart_ptr##handle#ExprField#const*/ 175772641u)))));
+		das_copy((__mks_134.astChanged),(false));
+		return __mks_134;
+	})()));
+}
+
+inline void _FuncSoaVisitor_0x27___finalize_93cf734c8407af24 ( Context * __context__, soa::SoaVisitor &  __self_rename_at_134 )
+{
+	finalize_2957132ed31e5a05(__context__,das_arg<soa::SoaVisitor>::pass(__self_rename_at_134));
+}
+
+inline smart_ptr_raw<Expression> _FuncSoaVisitor_0x60_visitExprField_a5ca19d69a90188e ( Context * __context__, soa::SoaVisitor &  __self_rename_at_136, smart_ptr_raw<ExprField> const  __expr_rename_at_136 ) { das_stack_prologue __prologue(__context__,176,"SoaVisitor`visitExprField " DAS_FILE_LINE);
+{
+	if ( SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_136->value /*value*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprAt")),*__context__) )
+	{
+		ExprAt * __eat_rename_at_139 = ((ExprAt *)das_cast<ExprAt *>::cast(__expr_rename_at_136->value /*value*/));
+		if ( is_soa_type_b1470b4e8180af69(__context__,__eat_rename_at_139->subexpr /*subexpr*/->type /*_type*/) )
+		{
+			das_copy(__self_rename_at_136.astChanged,true);
+			smart_ptr_raw<ExprField> __col_rename_at_142; das_zero(__col_rename_at_142); das_move(__col_rename_at_142, das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_142) {
+				das_copy((__mks_142.at /*at*/),(__expr_rename_at_136->at /*at*/));
+				das_move((__mks_142.value /*value*/),(clone_expression(__eat_rename_at_139->subexpr /*subexpr*/)));
+				{
+					das_clone(__mks_142.name /*name*/,__expr_rename_at_136->name /*name*/);
+				}			}))));
+			return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprAt>>::make(__context__,nullptr,(([&](ExprAt & __mks_143) {
+				das_copy((__mks_143.at /*at*/),(__eat_rename_at_139->at /*at*/));
+				das_move((__mks_143.subexpr /*subexpr*/),(__col_rename_at_142));
+				das_move((__mks_143.index /*index*/),(clone_expression(__eat_rename_at_139->index /*index*/)));
+			}))));
+		};
+	};
+	smart_ptr_raw<Expression> __res_rename_at_144; das_zero(__res_rename_at_144); das_move(__res_rename_at_144, _Funcbuiltin_0x60_clone_to_move_eee86bd9efee895c(__context__,__expr_rename_at_136));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_144);
+}}
+
+inline void __setup_macros_5c1e27e99759101c ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "soa"),__context__) )
+	{
+		_Funcast_0x60_add_new_structure_annotation_6c64ba547823edbc(__context__,((char *) "soa"),das_new<soa::SoaStructMacro>::make_and_init(__context__,[&]() { return SoaStructMacro_cdd96997fc68f85f(__context__); }));
+		_Funcast_0x60_add_new_infer_macro_fd29f24b0a980c18(__context__,((char *) "soa_rewrite"),das_new<soa::SoaInferMacro>::make_and_init(__context__,[&]() { return SoaInferMacro_35c1dde242e012a0(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_infer_macro_fd29f24b0a980c18 ( Context * __context__, char * const  __name_rename_at_535, soa::SoaInferMacro * const  __someClassPtr_rename_at_535 )
+{
+	smart_ptr_raw<PassMacro> __ann_rename_at_536; das_zero(__ann_rename_at_536); das_move(__ann_rename_at_536, _Funcast_0x60_make_pass_macro_3fe2c27deebf198e(__context__,__name_rename_at_535,__someClassPtr_rename_at_535));
+	addModuleInferDirtyMacro(thisModule(__context__,nullptr),__ann_rename_at_536,__context__);
+	das_delete_handle<smart_ptr_raw<PassMacro>>::clear(__context__,__ann_rename_at_536);
+}
+
+inline void _Funcast_0x60_add_new_structure_annotation_6c64ba547823edbc ( Context * __context__, char * const  __name_rename_at_511, soa::SoaStructMacro * const  __someClassPtr_rename_at_511 )
+{
+	smart_ptr_raw<StructureAnnotation> __ann_rename_at_512; das_zero(__ann_rename_at_512); das_move(__ann_rename_at_512, _Funcast_0x60_make_structure_annotation_8f9a077790c2831b(__context__,__name_rename_at_511,__someClassPtr_rename_at_511));
+	addModuleStructureAnnotation(thisModule(__context__,nullptr),__ann_rename_at_512,__context__);
+	das_delete_handle<smart_ptr_raw<StructureAnnotation>>::clear(__context__,__ann_rename_at_512);
+}
+
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_3fe2c27deebf198e ( Context * __context__, char * const  __name_rename_at_489, soa::SoaInferMacro * const  __someClassPtr_rename_at_489 )
+{
+	StructInfo const  * __classInfo_rename_at_491 = ((StructInfo const  *)_Funcrtti_0x60_class_info_5b91a69ce4bea454(__context__,das_deref(__context__,__someClassPtr_rename_at_489)));
+	return das_auto_cast<smart_ptr_raw<PassMacro>>::cast(makePassMacro(__name_rename_at_489,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_489),__classInfo_rename_at_491,__context__));
+}
+
+inline smart_ptr_raw<StructureAnnotation> _Funcast_0x60_make_structure_annotation_8f9a077790c2831b ( Context * __context__, char * const  __name_rename_at_455, soa::SoaStructMacro * const  __someClassPtr_rename_at_455 )
+{
+	StructInfo const  * __classInfo_rename_at_457 = ((StructInfo const  *)_Funcrtti_0x60_class_info_6a2663b9b0ebdbb(__context__,das_deref(__context__,__someClassPtr_rename_at_455)));
+	return das_auto_cast<smart_ptr_raw<StructureAnnotation>>::cast(makeStructureAnnotation(__name_rename_at_455,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_455),__classInfo_rename_at_457,__context__));
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_4d935fa73e425b1f ( Context * __context__, soa::SoaVisitor const  &  __someClass_rename_at_463 )
+{
+	soa::SoaVisitor const  * __classPtr_rename_at_466 = ((soa::SoaVisitor const  *)das_ref(__context__,__someClass_rename_at_463));
+	StructInfo const  * __classInfo_rename_at_467 = ((StructInfo const  *)das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__someClass_rename_at_463.__rtti)->structType /*structType*/));
+	return das_auto_cast<smart_ptr_raw<VisitorAdapter>>::cast(makeVisitor(das_auto_cast<void * const >::cast(__classPtr_rename_at_466),__classInfo_rename_at_467,__context__));
+}
+
+inline smart_ptr_raw<ExprField> _Funcbuiltin_0x60_clone_to_move_eee86bd9efee895c ( Context * __context__, smart_ptr_raw<ExprField> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprField> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_2094b4cbe51f23fc(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprField>>::cast(__clone_dest_rename_at_132);
+}
+
+inline Structure * _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9 ( Context * __context__, smart_ptr_raw<Structure> const  __src_rename_at_436 )
+{
+	return das_auto_cast<Structure *>::cast(das_cast<Structure *>::cast(__src_rename_at_436));
+}
+
+inline void clone_2094b4cbe51f23fc ( Context * __context__, smart_ptr_raw<ExprField> & __dest_rename_at_133, smart_ptr_raw<ExprField> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_71630f94910d7ae0 ( Context * __context__, smart_ptr_raw<Function> & __dest_rename_at_79, void * const  __src_rename_at_79 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_79),__src_rename_at_79);
+}
+
+inline void clone_cde054d1a2364b31 ( Context * __context__, smart_ptr_raw<Structure> & __dest_rename_at_121, void * const  __src_rename_at_121 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_121),__src_rename_at_121);
+}
+
+inline void clone_acf198b9505dc74 ( Context * __context__, smart_ptr_raw<TypeDecl> & __dest_rename_at_116, void * const  __src_rename_at_116 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_116),__src_rename_at_116);
+}
+
+inline void finalize_158afa29135805bc ( Context * __context__, soa::SoaVisitor * & ____this_rename_at_156 )
+{
+	if ( ____this_rename_at_156 != nullptr )
+	{
+		das_invoke_function<void>::invoke<ast::AstVisitor &>(__context__,____this_rename_at_156->__finalize,das_arg<ast::AstVisitor>::pass(das_cast<ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_156))));
+		das_delete<soa::SoaVisitor *>::clear(__context__,____this_rename_at_156);
+		das_copy(____this_rename_at_156,nullptr);
+	};
+}
+
+inline void finalize_b8975d047d050b3d ( Context * __context__, soa::SoaInferMacro &  ____this_rename_at_148 )
+{
+	memset(&(____this_rename_at_148), 0, 16);
+}
+
+inline void finalize_219b89fabaf27b02 ( Context * __context__, soa::SoaStructMacro &  ____this_rename_at_100 )
+{
+	memset(&(____this_rename_at_100), 0, 24);
+}
+
+inline void finalize_2957132ed31e5a05 ( Context * __context__, soa::SoaVisitor &  ____this_rename_at_134 )
+{
+	memset(&(____this_rename_at_134), 0, 1096);
+}
+
+inline void generate_column_function_f46c6a302e3624a ( Context * __context__, smart_ptr_raw<Structure> __st_rename_at_60, Structure * const  __soaType_rename_at_60, char * const  __fnname_rename_at_60, char * const  __argName_rename_at_60, smart_ptr_raw<TypeDecl> __argT_rename_at_60, bool __fieldwise_rename_at_60, LineInfo const  &  __at_rename_at_60 ) { das_stack_prologue __prologue(__context__,944,"generate_column_function " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_61; das_zero(__fn_rename_at_61); das_move(__fn_rename_at_61, das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_61) {
+		das_copy((__mks_61.at /*at*/),(__at_rename_at_60));
+		das_copy((__mks_61.atDecl /*atDecl*/),(__at_rename_at_60));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_61.name /*name*/),__fnname_rename_at_60);
+		}	}))));
+	__fn_rename_at_61->flags /*flags*/ |= 0x200000u;
+	das_move(__fn_rename_at_61->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_63) {
+		das_copy((__mks_63.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tVoid));
+		das_copy((__mks_63.at /*at*/),(__at_rename_at_60));
+	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Variable>> &,smart_ptr_raw<Variable>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Variable #smart_ptr##handle#Variable*/ 1722377340u)),das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_61->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_64) {
+		das_copy((__mks_64.at /*at*/),(__at_rename_at_60));
+		das_move((__mks_64.type /*_type*/),(make_struct_type_11e1d9a357644e14(__context__,__soaType_rename_at_60,false,__at_rename_at_60)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_64.name /*name*/),((char *) "__src"));
+		}	}))));
+	if ( nequ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__argT_rename_at_60),nullptr) )
+	{
+		das_invoke_function<void>::invoke<das::vector<smart_ptr<Variable>> &,smart_ptr_raw<Variable>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Variable #smart_ptr##handle#Variable*/ 1722377340u)),das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_61->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_66) {
+			das_copy((__mks_66.at /*at*/),(__at_rename_at_60));
+			das_move((__mks_66.type /*_type*/),(__argT_rename_at_60));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_66.name /*name*/),__argName_rename_at_60);
+			}		}))));
+	};
+	smart_ptr_raw<ExprBlock> __blk_rename_at_67; das_zero(__blk_rename_at_67); das_move(__blk_rename_at_67, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_67) {
+		das_copy((__mks_67.at /*at*/),(__at_rename_at_60));
+	}))));
+	{
+		bool __need_loop_68 = true;
+		// fld : ast::FieldDeclaration&
+		das_iterator<das::vector<Structure::FieldDeclaration>> __fld_iterator(__st_rename_at_60->fields /*fields*/);
+		Structure::FieldDeclaration * __fld_rename_at_68;
+		__need_loop_68 = __fld_iterator.first(__context__,(__fld_rename_at_68)) && __need_loop_68;
+		for ( ; __need_loop_68 ; __need_loop_68 = __fld_iterator.next(__context__,(__fld_rename_at_68)) )
+		{
+			smart_ptr_raw<ExprCall> __cll_rename_at_69; das_zero(__cll_rename_at_69); das_move(__cll_rename_at_69, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_69) {
+				das_copy((__mks_69.at /*at*/),(__at_rename_at_60));
+				{
+					set_das_string(das_arg<das::string>::pass(__mks_69.name /*name*/),__fnname_rename_at_60);
+				}			}))));
+			das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprField>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_69->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_70) {
+				das_copy((__mks_70.at /*at*/),(__at_rename_at_60));
+				das_move((__mks_70.value /*value*/),(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_70) {
+					das_copy((__mks_70.at /*at*/),(__at_rename_at_60));
+					{
+						set_das_string(das_arg<das::string>::pass(__mks_70.name /*name*/),((char *) "__src"));
+					}				})))));
+				{
+					das_clone(__mks_70.name /*name*/,(*__fld_rename_at_68).name /*name*/);
+				}			})))));
+			if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__argName_rename_at_60),cast<char *>::from(((char *) "")),*__context__) )
+			{
+				if ( __fieldwise_rename_at_60 )
+				{
+					das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprField>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_69->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_73) {
+						das_copy((__mks_73.at /*at*/),(__at_rename_at_60));
+						das_move((__mks_73.value /*value*/),(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_73) {
+							das_copy((__mks_73.at /*at*/),(__at_rename_at_60));
+							{
+								set_das_string(das_arg<das::string>::pass(__mks_73.name /*name*/),__argName_rename_at_60);
+							}						})))));
+						{
+							das_clone(__mks_73.name /*name*/,(*__fld_rename_at_68).name /*name*/);
+						}					})))));
+				} else {
+					das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprVar>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_69->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_75) {
+						das_copy((__mks_75.at /*at*/),(__at_rename_at_60));
+						{
+							set_das_string(das_arg<das::string>::pass(__mks_75.name /*name*/),__argName_rename_at_60);
+						}					})))));
+				};
+			};
+			das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_67->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__cll_rename_at_69));
+		}
+		__fld_iterator.close(__context__,(__fld_rename_at_68));
+	};
+	das_move(__fn_rename_at_61->body /*body*/,__blk_rename_at_67);
+	addModuleFunction(compileModule(__context__),__fn_rename_at_61,__context__);
+	clone_71630f94910d7ae0(__context__,__fn_rename_at_61,nullptr);
+}}
+
+inline void generate_length_d5c5f9c499acc93f ( Context * __context__, smart_ptr_raw<Structure> __st_rename_at_86, Structure * const  __soaType_rename_at_86, LineInfo const  &  __at_rename_at_86 ) { das_stack_prologue __prologue(__context__,528,"generate_length " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Function> __fn_rename_at_87; das_zero(__fn_rename_at_87); das_move(__fn_rename_at_87, das_ascend_handle<true,smart_ptr_raw<Function>>::make(__context__,nullptr,(([&](Function & __mks_87) {
+		das_copy((__mks_87.at /*at*/),(__at_rename_at_86));
+		das_copy((__mks_87.atDecl /*atDecl*/),(__at_rename_at_86));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_87.name /*name*/),((char *) "length"));
+		}	}))));
+	__fn_rename_at_87->flags /*flags*/ |= 0x200000u;
+	das_move(__fn_rename_at_87->result /*result*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_89) {
+		das_copy((__mks_89.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+		das_copy((__mks_89.at /*at*/),(__at_rename_at_86));
+	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Variable>> &,smart_ptr_raw<Variable>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Variable #smart_ptr##handle#Variable*/ 1722377340u)),das_arg<das::vector<smart_ptr<Variable>>>::pass(__fn_rename_at_87->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_90) {
+		das_copy((__mks_90.at /*at*/),(__at_rename_at_86));
+		das_move((__mks_90.type /*_type*/),(make_struct_type_11e1d9a357644e14(__context__,__soaType_rename_at_86,true,__at_rename_at_86)));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_90.name /*name*/),((char *) "__src"));
+		}	}))));
+	smart_ptr_raw<ExprCall> __cll_rename_at_91; das_zero(__cll_rename_at_91); das_move(__cll_rename_at_91, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_91) {
+		das_copy((__mks_91.at /*at*/),(__at_rename_at_86));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_91.name /*name*/),((char *) "length"));
+		}	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprField>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_91->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprField>>::make(__context__,nullptr,(([&](ExprField & __mks_92) {
+		das_copy((__mks_92.at /*at*/),(__at_rename_at_86));
+		das_move((__mks_92.value /*value*/),(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_92) {
+			das_copy((__mks_92.at /*at*/),(__at_rename_at_86));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_92.name /*name*/),((char *) "__src"));
+			}		})))));
+		{
+			das_clone(__mks_92.name /*name*/,das_index<das::vector<Structure::FieldDeclaration>>::at(__st_rename_at_86->fields /*fields*/,0,__context__).name /*name*/);
+		}	})))));
+	smart_ptr_raw<ExprBlock> __blk_rename_at_93; das_zero(__blk_rename_at_93); das_move(__blk_rename_at_93, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_93) {
+		das_copy((__mks_93.at /*at*/),(__at_rename_at_86));
+	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprReturn>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_93->list /*list*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprReturn>>::make(__context__,nullptr,(([&](ExprReturn & __mks_94) {
+		das_copy((__mks_94.at /*at*/),(__at_rename_at_86));
+		das_move((__mks_94.subexpr /*subexpr*/),(__cll_rename_at_91));
+	})))));
+	das_move(__fn_rename_at_87->body /*body*/,__blk_rename_at_93);
+	addModuleFunction(compileModule(__context__),__fn_rename_at_87,__context__);
+	clone_71630f94910d7ae0(__context__,__fn_rename_at_87,nullptr);
+}}
+
+inline bool is_soa_type_b1470b4e8180af69 ( Context * __context__, smart_ptr_raw<TypeDecl> const  __t_rename_at_33 )
+{
+	return das_auto_cast<bool>::cast(((((equ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__t_rename_at_33),nullptr)) || (__t_rename_at_33->baseType /*baseType*/ != DAS_COMMENT(bound_enum) das::Type::tStructure)) || (__t_rename_at_33->dim /*dim*/.size() /*length*/ != 0)) || (__t_rename_at_33->structType /*structType*/ == nullptr)) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast((!(das_get_bitfield(__t_rename_at_33->structType /*structType*/->flags /*flags*/,1u << 4)) ? das_auto_cast<bool>::cast(false) : das_auto_cast<bool>::cast(builtin_string_endswith(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<das::string const  &>::from(__t_rename_at_33->structType /*structType*/->name /*name*/))),((char *) "_SOA"),__context__)))));
+}
+
+inline smart_ptr_raw<TypeDecl> make_int_type_2d01f63fd95167c3 ( Context * __context__, LineInfo const  &  __at_rename_at_48 )
+{
+	smart_ptr_raw<TypeDecl> __t_rename_at_49; das_zero(__t_rename_at_49); das_move(__t_rename_at_49, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_49) {
+		das_copy((__mks_49.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tInt));
+		das_copy((__mks_49.at /*at*/),(__at_rename_at_48));
+	}))));
+	__t_rename_at_49->flags /*flags*/ |= 0x2u;
+	return das_auto_cast<smart_ptr_raw<TypeDecl>>::cast(__t_rename_at_49);
+}
+
+inline smart_ptr_raw<TypeDecl> make_struct_type_11e1d9a357644e14 ( Context * __context__, Structure * const  __st_rename_at_41, bool __isConst_rename_at_41, LineInfo const  &  __at_rename_at_41 )
+{
+	smart_ptr_raw<TypeDecl> __t_rename_at_42; das_zero(__t_rename_at_42); das_move(__t_rename_at_42, das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_42) {
+		das_copy((__mks_42.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tStructure));
+		das_copy((__mks_42.structType /*structType*/),(__st_rename_at_41));
+		das_copy((__mks_42.at /*at*/),(__at_rename_at_41));
+	}))));
+	if ( __isConst_rename_at_41 )
+	{
+		__t_rename_at_42->flags /*flags*/ |= 0x2u;
+	};
+	return das_auto_cast<smart_ptr_raw<TypeDecl>>::cast(__t_rename_at_42);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_5b91a69ce4bea454 ( Context * __context__, soa::SoaInferMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_6a2663b9b0ebdbb ( Context * __context__, soa::SoaStructMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// SoaInferMacro_35c1dde242e012a0
+		aotLib[0x55a6fed5b455be56] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<soa::SoaInferMacro (*) ( Context * __context__ ),&SoaInferMacro_35c1dde242e012a0>>();
+	};
+		// _FuncSoaInferMacro_0x27___finalize_356f00648867f280
+		aotLib[0xcc31ce887783a22f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaInferMacro &  ),&_FuncSoaInferMacro_0x27___finalize_356f00648867f280>>();
+	};
+		// _FuncSoaInferMacro_0x60_apply_fe28b76dff189fc2
+		aotLib[0x7c9bab91bcdca0cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, soa::SoaInferMacro & , smart_ptr_raw<Program> const  , Module * const   ),&_FuncSoaInferMacro_0x60_apply_fe28b76dff189fc2>>();
+	};
+		// SoaStructMacro_cdd96997fc68f85f
+		aotLib[0x8159458d63d96d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<soa::SoaStructMacro (*) ( Context * __context__ ),&SoaStructMacro_cdd96997fc68f85f>>();
+	};
+		// _FuncSoaStructMacro_0x27___finalize_d7b9768200d50338
+		aotLib[0xd796964e4b8f302f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaStructMacro &  ),&_FuncSoaStructMacro_0x27___finalize_d7b9768200d50338>>();
+	};
+		// _FuncSoaStructMacro_0x60_apply_a57df6f979dad361
+		aotLib[0x6af8b802442b1ae9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, soa::SoaStructMacro & , smart_ptr_raw<Structure> , ModuleGroup & , AnnotationArgumentList const  & , das::string &  ),&_FuncSoaStructMacro_0x60_apply_a57df6f979dad361>>();
+	};
+		// SoaVisitor_f5c0fb07db36960a
+		aotLib[0x6b4d78d693712127] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<soa::SoaVisitor (*) ( Context * __context__ ),&SoaVisitor_f5c0fb07db36960a>>();
+	};
+		// _FuncSoaVisitor_0x27___finalize_93cf734c8407af24
+		aotLib[0x7755655160743b1a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaVisitor &  ),&_FuncSoaVisitor_0x27___finalize_93cf734c8407af24>>();
+	};
+		// _FuncSoaVisitor_0x60_visitExprField_a5ca19d69a90188e
+		aotLib[0x6ce961e86985ebf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, soa::SoaVisitor & , smart_ptr_raw<ExprField> const   ),&_FuncSoaVisitor_0x60_visitExprField_a5ca19d69a90188e>>();
+	};
+		// __setup_macros_5c1e27e99759101c
+		aotLib[0x281ee0034175037a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_5c1e27e99759101c>>();
+	};
+		// _Funcast_0x60_add_new_infer_macro_fd29f24b0a980c18
+		aotLib[0x6898780617e33841] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , soa::SoaInferMacro * const   ),&_Funcast_0x60_add_new_infer_macro_fd29f24b0a980c18>>();
+	};
+		// _Funcast_0x60_add_new_structure_annotation_6c64ba547823edbc
+		aotLib[0x8e8ea718b8ad9ffa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , soa::SoaStructMacro * const   ),&_Funcast_0x60_add_new_structure_annotation_6c64ba547823edbc>>();
+	};
+		// _Funcast_0x60_make_pass_macro_3fe2c27deebf198e
+		aotLib[0xd69651f4ff6cf40d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<PassMacro> (*) ( Context * __context__, char * const  , soa::SoaInferMacro * const   ),&_Funcast_0x60_make_pass_macro_3fe2c27deebf198e>>();
+	};
+		// _Funcast_0x60_make_structure_annotation_8f9a077790c2831b
+		aotLib[0x3c53e5a02fa5e34f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<StructureAnnotation> (*) ( Context * __context__, char * const  , soa::SoaStructMacro * const   ),&_Funcast_0x60_make_structure_annotation_8f9a077790c2831b>>();
+	};
+		// _Funcast_0x60_make_visitor_4d935fa73e425b1f
+		aotLib[0xeb0cc356d63ab835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, soa::SoaVisitor const  &  ),&_Funcast_0x60_make_visitor_4d935fa73e425b1f>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_eee86bd9efee895c
+		aotLib[0x397c0dd116420d4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprField> (*) ( Context * __context__, smart_ptr_raw<ExprField> const   ),&_Funcbuiltin_0x60_clone_to_move_eee86bd9efee895c>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9
+		aotLib[0x9295bc7cb9b31c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Structure * (*) ( Context * __context__, smart_ptr_raw<Structure> const   ),&_Funcbuiltin_0x60_get_ptr_b56848c1596cf4f9>>();
+	};
+		// clone_2094b4cbe51f23fc
+		aotLib[0xd2daed9c16a4856d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprField> & , smart_ptr_raw<ExprField> const   ),&clone_2094b4cbe51f23fc>>();
+	};
+		// clone_71630f94910d7ae0
+		aotLib[0x5167a7889e524969] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Function> & , void * const   ),&clone_71630f94910d7ae0>>();
+	};
+		// clone_cde054d1a2364b31
+		aotLib[0x9bd87330d2bef945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Structure> & , void * const   ),&clone_cde054d1a2364b31>>();
+	};
+		// clone_acf198b9505dc74
+		aotLib[0xcf98fbf5cbb19dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<TypeDecl> & , void * const   ),&clone_acf198b9505dc74>>();
+	};
+		// finalize_158afa29135805bc
+		aotLib[0xde83b2b2dd53f7e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaVisitor * &  ),&finalize_158afa29135805bc>>();
+	};
+		// finalize_b8975d047d050b3d
+		aotLib[0xad79004278f7b9b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaInferMacro &  ),&finalize_b8975d047d050b3d>>();
+	};
+		// finalize_219b89fabaf27b02
+		aotLib[0xda691f2ddda748f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaStructMacro &  ),&finalize_219b89fabaf27b02>>();
+	};
+		// finalize_2957132ed31e5a05
+		aotLib[0xcce9f068e10fd749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, soa::SoaVisitor &  ),&finalize_2957132ed31e5a05>>();
+	};
+		// generate_column_function_f46c6a302e3624a
+		aotLib[0xc5a0d11e157c968e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Structure> , Structure * const  , char * const  , char * const  , smart_ptr_raw<TypeDecl> , bool , LineInfo const  &  ),&generate_column_function_f46c6a302e3624a>>();
+	};
+		// generate_length_d5c5f9c499acc93f
+		aotLib[0xabf5889c5aa5241a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Structure> , Structure * const  , LineInfo const  &  ),&generate_length_d5c5f9c499acc93f>>();
+	};
+		// is_soa_type_b1470b4e8180af69
+		aotLib[0xea11979748f9cff5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<TypeDecl> const   ),&is_soa_type_b1470b4e8180af69>>();
+	};
+		// make_int_type_2d01f63fd95167c3
+		aotLib[0x78e34ab5af818615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, LineInfo const  &  ),&make_int_type_2d01f63fd95167c3>>();
+	};
+		// make_struct_type_11e1d9a357644e14
+		aotLib[0x62b8946b5de5469] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TypeDecl> (*) ( Context * __context__, Structure * const  , bool , LineInfo const  &  ),&make_struct_type_11e1d9a357644e14>>();
+	};
+		// _Funcrtti_0x60_class_info_5b91a69ce4bea454
+		aotLib[0x71f49bc3d129c585] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, soa::SoaInferMacro const  &  ),&_Funcrtti_0x60_class_info_5b91a69ce4bea454>>();
+	};
+		// _Funcrtti_0x60_class_info_6a2663b9b0ebdbb
+		aotLib[0x6d991fa516452995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, soa::SoaStructMacro const  &  ),&_Funcrtti_0x60_class_info_6a2663b9b0ebdbb>>();
+	};
+		// [[ init script ]]
+		aotLib[0x54c0fc211583e487] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
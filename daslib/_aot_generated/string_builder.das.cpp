@@ -0,0 +1,7209 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require string_builder
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__594390b9;
+extern StructInfo __struct_info__45b20104;
+extern StructInfo __struct_info__d8299e85;
+extern StructInfo __struct_info__b118e316;
+extern StructInfo __struct_info__5ed6db18;
+extern StructInfo __struct_info__19c48622;
+extern TypeInfo __type_info__10db1c1d;
+extern TypeInfo __type_info__da50b805;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__f42f651e;
+extern TypeInfo __type_info__dc52e0d5;
+extern TypeInfo __type_info__c0e5e0ad;
+extern TypeInfo __type_info__8bc5634d;
+extern TypeInfo __type_info__bab365e;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__3737d9d1;
+extern TypeInfo __type_info__cd849a9b;
+extern TypeInfo __type_info__aaadd575;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__aea00813;
+extern TypeInfo __type_info__c2b9b42c;
+extern TypeInfo __type_info__6f381053;
+extern TypeInfo __type_info__261bce6f;
+extern TypeInfo __type_info__dd644f60;
+extern TypeInfo __type_info__e749bd33;
+extern TypeInfo __type_info__73c8114e;
+extern TypeInfo __type_info__7da04467;
+extern TypeInfo __type_info__b1ceb1d4;
+extern TypeInfo __type_info__653ef983;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__1cb4fa6d;
+extern TypeInfo __type_info__515c0a3;
+extern TypeInfo __type_info__ccb7c90a;
+extern TypeInfo __type_info__b3bcfd53;
+extern TypeInfo __type_info__46fed0f3;
+extern TypeInfo __type_info__523f6667;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6d1d425d;
+extern TypeInfo __type_info__ebcc21eb;
+extern TypeInfo __type_info__5ef84086;
+extern TypeInfo __type_info__7a1c4eb7;
+extern TypeInfo __type_info__2b3e54e5;
+extern TypeInfo __type_info__4de83811;
+extern TypeInfo __type_info__94ae69a3;
+extern TypeInfo __type_info__87a6e894;
+extern TypeInfo __type_info__a6a527e0;
+extern TypeInfo __type_info__83498580;
+extern TypeInfo __type_info__a960d6ab;
+extern TypeInfo __type_info__b108e3;
+extern TypeInfo __type_info__d7eb08f1;
+extern TypeInfo __type_info__f486e881;
+extern TypeInfo __type_info__1683ec13;
+extern TypeInfo __type_info__1d5a02b1;
+extern TypeInfo __type_info__fdd27932;
+extern TypeInfo __type_info__8f8da119;
+extern TypeInfo __type_info__5bc565f1;
+extern TypeInfo __type_info__819d499d;
+extern TypeInfo __type_info__81be117c;
+extern TypeInfo __type_info__b5d7ce5d;
+extern TypeInfo __type_info__32f7a66b;
+extern TypeInfo __type_info__cae7a171;
+extern TypeInfo __type_info__453f3d02;
+extern TypeInfo __type_info__30023ebb;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4edf488d;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8fce7587;
+extern TypeInfo __type_info__a01f8605;
+extern TypeInfo __type_info__15780d4b;
+extern TypeInfo __type_info__7ec0323f;
+extern TypeInfo __type_info__ae076c;
+extern TypeInfo __type_info__ff9fd5d3;
+extern TypeInfo __type_info__3c4f7906;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__c4ccbb7e;
+extern TypeInfo __type_info__d7e06fbf;
+extern TypeInfo __type_info__8e3dc326;
+extern TypeInfo __type_info__d73ee2dd;
+extern TypeInfo __type_info__72ae9081;
+extern TypeInfo __type_info__c831b26a;
+extern TypeInfo __type_info__72374920;
+extern TypeInfo __type_info__d25748d6;
+extern TypeInfo __type_info__3a70d70f;
+extern TypeInfo __type_info__7c510f91;
+extern TypeInfo __type_info__b66d9ef1;
+extern TypeInfo __type_info__91c4dfb3;
+extern TypeInfo __type_info__15e14f92;
+extern TypeInfo __type_info__ebc70931;
+extern TypeInfo __type_info__3c8fd4b4;
+extern TypeInfo __type_info__17259f57;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__7ebfa292;
+extern TypeInfo __type_info__9773df12;
+extern TypeInfo __type_info__317f8d25;
+extern TypeInfo __type_info__3c6fa07f;
+extern TypeInfo __type_info__9920ba3b;
+extern TypeInfo __type_info__8f234b97;
+extern TypeInfo __type_info__87882376;
+extern TypeInfo __type_info__5f6a7cad;
+extern TypeInfo __type_info__10b7decc;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8494e015;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b867c43d;
+extern TypeInfo __type_info__9e20c21a;
+extern TypeInfo __type_info__b9491240;
+extern TypeInfo __type_info__963c776b;
+extern TypeInfo __type_info__b58fe8a6;
+extern TypeInfo __type_info__5527f9ed;
+extern TypeInfo __type_info__fba33907;
+extern TypeInfo __type_info__51c55633;
+extern TypeInfo __type_info__84917dd0;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__68f47b8a;
+extern TypeInfo __type_info__34157e23;
+extern TypeInfo __type_info__37ca469d;
+extern TypeInfo __type_info__14c14bf4;
+extern TypeInfo __type_info__4fa9a2d8;
+extern TypeInfo __type_info__d4f3571c;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__10edfe53;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__2481035b;
+extern TypeInfo __type_info__a1ba446d;
+extern TypeInfo __type_info__9fee7340;
+extern TypeInfo __type_info__ada7aa90;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__664a2fe7;
+extern TypeInfo __type_info__655bd8a4;
+extern TypeInfo __type_info__2f1bdc9a;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__5dc56917;
+extern TypeInfo __type_info__d16acbbb;
+extern TypeInfo __type_info__d4aee91;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__d057deb9;
+extern TypeInfo __type_info__6dd946fa;
+extern TypeInfo __type_info__32b24044;
+extern TypeInfo __type_info__531e5432;
+extern TypeInfo __type_info__e0a995b4;
+extern TypeInfo __type_info__368fac4c;
+extern TypeInfo __type_info__76b8ad03;
+extern TypeInfo __type_info__48d9d78;
+extern TypeInfo __type_info__6535171f;
+extern TypeInfo __type_info__9ee277f5;
+extern TypeInfo __type_info__e7b89eff;
+extern TypeInfo __type_info__8f8b0275;
+extern TypeInfo __type_info__764dc75a;
+extern TypeInfo __type_info__e2deda56;
+extern TypeInfo __type_info__5a28d785;
+extern TypeInfo __type_info__9445fbcf;
+extern TypeInfo __type_info__7df5ef2c;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__6c2a86f9;
+extern TypeInfo __type_info__e97755bb;
+extern TypeInfo __type_info__295e937b;
+extern TypeInfo __type_info__1d3d6764;
+extern TypeInfo __type_info__251bccdc;
+extern TypeInfo __type_info__bd757ca;
+extern TypeInfo __type_info__5ac5645e;
+extern TypeInfo __type_info__e4d4c1e4;
+extern TypeInfo __type_info__d514cba4;
+extern TypeInfo __type_info__60d19370;
+extern TypeInfo __type_info__c5ddc6fa;
+extern TypeInfo __type_info__9f20c3ad;
+extern TypeInfo __type_info__1b3c6d8d;
+extern TypeInfo __type_info__6529db2b;
+extern TypeInfo __type_info__a8d37f6f;
+extern TypeInfo __type_info__d7ddca10;
+extern TypeInfo __type_info__130d26f9;
+extern TypeInfo __type_info__721467d3;
+extern TypeInfo __type_info__8728109a;
+extern TypeInfo __type_info__1bb5fdf7;
+extern TypeInfo __type_info__a65edd74;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__5ca338ad;
+extern TypeInfo __type_info__d180e781;
+extern TypeInfo __type_info__74b0f2db;
+extern TypeInfo __type_info__cf57dd26;
+extern TypeInfo __type_info__535415eb;
+extern TypeInfo __type_info__ccc9122b;
+extern TypeInfo __type_info__b2cb4a2b;
+extern TypeInfo __type_info__a5b6b194;
+extern TypeInfo __type_info__ccee123b;
+extern TypeInfo __type_info__374b4b09;
+extern TypeInfo __type_info__9338185;
+extern TypeInfo __type_info__cf52b1be;
+extern TypeInfo __type_info__b049b391;
+extern TypeInfo __type_info__9a5b5986;
+extern TypeInfo __type_info__7856e79d;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__5f1adc0e;
+extern TypeInfo __type_info__ab082dc2;
+extern TypeInfo __type_info__cd57da00;
+extern TypeInfo __type_info__a8981616;
+extern TypeInfo __type_info__88de8728;
+extern TypeInfo __type_info__1b9f61f8;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__231bc9b6;
+extern TypeInfo __type_info__8121e453;
+extern TypeInfo __type_info__d3ebcc43;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__d8ac9e75;
+extern TypeInfo __type_info__fc0d99dd;
+extern TypeInfo __type_info__386c90cf;
+extern TypeInfo __type_info__c1e3d526;
+extern TypeInfo __type_info__c627fc0a;
+extern TypeInfo __type_info__a40a0d70;
+extern TypeInfo __type_info__858d2368;
+extern TypeInfo __type_info__26379cda;
+extern TypeInfo __type_info__c6cb0399;
+extern TypeInfo __type_info__f66d4d6;
+extern TypeInfo __type_info__fe4bfa47;
+extern TypeInfo __type_info__cb3ec93c;
+extern TypeInfo __type_info__27a9a437;
+extern TypeInfo __type_info__374bcd9;
+extern TypeInfo __type_info__39dd41c1;
+extern TypeInfo __type_info__d00bb3d6;
+extern TypeInfo __type_info__f1eeff10;
+extern TypeInfo __type_info__b081465d;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__be386f7a;
+extern TypeInfo __type_info__cf76cec3;
+extern TypeInfo __type_info__ed20bab;
+extern TypeInfo __type_info__309172d;
+extern VarInfo __var_info__7d53688f;
+extern VarInfo __var_info__ca41af16;
+extern VarInfo __var_info__3ff83933;
+extern VarInfo __var_info__b60ead63;
+extern VarInfo __var_info__f6869070;
+extern VarInfo __var_info__3c44a7ec;
+extern VarInfo __var_info__fcf0c0f2;
+extern VarInfo __var_info__6c1ea24c;
+extern VarInfo __var_info__ece4bcc3;
+extern VarInfo __var_info__21dc0f2b;
+extern VarInfo __var_info__79ad2960;
+extern VarInfo __var_info__8b6a9f2b;
+extern VarInfo __var_info__17b491;
+extern VarInfo __var_info__aefafc88;
+extern VarInfo __var_info__3b80c6b2;
+extern VarInfo __var_info__14bcb702;
+extern VarInfo __var_info__e0733905;
+extern VarInfo __var_info__b4805a01;
+extern VarInfo __var_info__1df012f;
+extern VarInfo __var_info__1353a6cd;
+extern VarInfo __var_info__6e97f0ea;
+extern VarInfo __var_info__b7b932b1;
+extern VarInfo __var_info__11aeae1c;
+extern VarInfo __var_info__a1981da5;
+extern VarInfo __var_info__f5374011;
+extern VarInfo __var_info__89ccc515;
+extern VarInfo __var_info__6f4d2d82;
+extern VarInfo __var_info__a89b370;
+extern VarInfo __var_info__8965dfd1;
+extern VarInfo __var_info__918cc1f7;
+extern VarInfo __var_info__7a97244e;
+extern VarInfo __var_info__44fe3ae;
+extern VarInfo __var_info__319b0b61;
+extern VarInfo __var_info__45850bb3;
+extern VarInfo __var_info__5a5cc58f;
+extern VarInfo __var_info__cd180571;
+extern VarInfo __var_info__442b5d7f;
+extern VarInfo __var_info__edc30d75;
+extern VarInfo __var_info__e1fb3a1d;
+extern VarInfo __var_info__f42804c5;
+extern VarInfo __var_info__80597070;
+extern VarInfo __var_info__d4f9c662;
+extern VarInfo __var_info__47a90452;
+extern VarInfo __var_info__49834f0e;
+extern VarInfo __var_info__fde3ac29;
+extern VarInfo __var_info__7607b7d3;
+extern VarInfo __var_info__d1eafff7;
+extern VarInfo __var_info__301336b9;
+extern VarInfo __var_info__d6c089cc;
+extern VarInfo __var_info__d561f037;
+extern VarInfo __var_info__95f18079;
+extern VarInfo __var_info__a92f607e;
+extern VarInfo __var_info__5ca65c07;
+extern VarInfo __var_info__c84acfc5;
+extern VarInfo __var_info__7c486554;
+extern VarInfo __var_info__4983afb6;
+extern VarInfo __var_info__9bf4c06a;
+extern VarInfo __var_info__2b9935eb;
+extern VarInfo __var_info__ae4d5acf;
+extern VarInfo __var_info__eb1915c9;
+extern VarInfo __var_info__91766fe;
+extern VarInfo __var_info__90eb7c;
+extern VarInfo __var_info__13086ac7;
+extern VarInfo __var_info__128e68c7;
+extern VarInfo __var_info__27cafe1b;
+extern VarInfo __var_info__35e4f53d;
+extern VarInfo __var_info__7c5a64dd;
+extern VarInfo __var_info__54e22933;
+extern VarInfo __var_info__c07311a1;
+extern VarInfo __var_info__98dc5351;
+extern VarInfo __var_info__98e24617;
+extern VarInfo __var_info__ffec8725;
+extern VarInfo __var_info__de11b7cd;
+extern VarInfo __var_info__f3715aaa;
+extern VarInfo __var_info__db853894;
+extern VarInfo __var_info__78c64552;
+extern VarInfo __var_info__e9263119;
+extern VarInfo __var_info__5e4adcab;
+extern VarInfo __var_info__59143e06;
+extern VarInfo __var_info__24d03a3;
+extern VarInfo __var_info__7373982c;
+extern VarInfo __var_info__82d1f898;
+extern VarInfo __var_info__b3b86d9e;
+extern VarInfo __var_info__cc239bd;
+extern VarInfo __var_info__b4140fe2;
+extern VarInfo __var_info__d4d095f;
+extern VarInfo __var_info__810ecf0;
+extern VarInfo __var_info__ff3dc583;
+extern VarInfo __var_info__b0dfc9de;
+extern VarInfo __var_info__e1903c80;
+extern VarInfo __var_info__f7387f87;
+extern VarInfo __var_info__7bb02c08;
+extern VarInfo __var_info__ad5a0405;
+extern VarInfo __var_info__51b2f326;
+extern VarInfo __var_info__2cc1e62d;
+extern VarInfo __var_info__f902c2de;
+extern VarInfo __var_info__80104522;
+extern VarInfo __var_info__6758a118;
+extern VarInfo __var_info__a606bd0b;
+extern VarInfo __var_info__215e3c49;
+extern VarInfo __var_info__52c4fb65;
+extern VarInfo __var_info__8656f77a;
+extern VarInfo __var_info__4711a622;
+extern VarInfo __var_info__cd0ec02e;
+extern VarInfo __var_info__5396d89e;
+extern VarInfo __var_info__5fb47dee;
+extern VarInfo __var_info__cd194731;
+extern VarInfo __var_info__cc9b509e;
+extern VarInfo __var_info__aa48356;
+extern VarInfo __var_info__3b14171a;
+extern VarInfo __var_info__e7736a49;
+extern VarInfo __var_info__a433cf50;
+extern VarInfo __var_info__1c5dc61c;
+extern VarInfo __var_info__445500f4;
+extern VarInfo __var_info__8a242f22;
+extern VarInfo __var_info__3c5f73b6;
+extern VarInfo __var_info__e89ddc79;
+extern VarInfo __var_info__b8fe42a;
+extern VarInfo __var_info__fdb098f9;
+extern VarInfo __var_info__a6606d6c;
+extern VarInfo __var_info__880d1d21;
+extern VarInfo __var_info__33f0ad8;
+extern VarInfo __var_info__359e840f;
+extern VarInfo __var_info__f715873b;
+extern VarInfo __var_info__e905eefd;
+extern VarInfo __var_info__32ba3714;
+extern VarInfo __var_info__818110d9;
+extern VarInfo __var_info__bfecfd12;
+extern VarInfo __var_info__107b07f6;
+extern VarInfo __var_info__80719338;
+extern VarInfo __var_info__d1222c0d;
+extern VarInfo __var_info__95dd4ed6;
+extern VarInfo __var_info__6d3d92b1;
+extern VarInfo __var_info__988afcfd;
+extern VarInfo __var_info__8c8f07fa;
+extern VarInfo __var_info__887d85f9;
+extern VarInfo __var_info__c8e93312;
+extern VarInfo __var_info__30ebe102;
+extern VarInfo __var_info__dc873d46;
+extern VarInfo __var_info__1f5ab77e;
+extern VarInfo __var_info__120f37d8;
+extern VarInfo __var_info__2197791a;
+extern VarInfo __var_info__559acaa7;
+extern VarInfo __var_info__47814037;
+extern VarInfo __var_info__c18e7e30;
+extern VarInfo __var_info__d11ed6d8;
+extern VarInfo __var_info__f408343d;
+extern VarInfo __var_info__30d5c055;
+extern VarInfo __var_info__89db21bc;
+extern VarInfo __var_info__588f95b5;
+extern VarInfo __var_info__d811ae5b;
+extern VarInfo __var_info__80289013;
+extern VarInfo __var_info__6eaa7d50;
+extern VarInfo __var_info__e67368b6;
+extern VarInfo __var_info__774617;
+extern VarInfo __var_info__9af1bd25;
+extern VarInfo __var_info__4b34a199;
+extern VarInfo __var_info__628ea540;
+extern VarInfo __var_info__13866865;
+extern VarInfo __var_info__284e759;
+extern VarInfo __var_info__9cd677e8;
+extern VarInfo __var_info__2ff2ace2;
+extern VarInfo __var_info__cb496173;
+extern VarInfo __var_info__2663c954;
+extern VarInfo __var_info__397c5a45;
+extern VarInfo __var_info__68c9f07c;
+extern VarInfo __var_info__c0f2e66;
+extern VarInfo __var_info__2cbdc12a;
+extern VarInfo __var_info__ecce0297;
+extern VarInfo __var_info__6c131e9f;
+extern VarInfo __var_info__5fa7d37b;
+extern VarInfo __var_info__968ac7df;
+extern VarInfo __var_info__a80b1462;
+extern VarInfo __var_info__78176028;
+extern VarInfo __var_info__3faadbe1;
+extern VarInfo __var_info__4f96c95a;
+extern VarInfo __var_info__eb48dd2d;
+extern VarInfo __var_info__c8e5f55;
+extern VarInfo __var_info__c77345a9;
+extern VarInfo __var_info__82468004;
+extern VarInfo __var_info__94ab01e9;
+extern VarInfo __var_info__f560290e;
+extern VarInfo __var_info__9d59dc9b;
+extern VarInfo __var_info__7c1369a9;
+extern VarInfo __var_info__df58a108;
+extern VarInfo __var_info__529f4a82;
+extern VarInfo __var_info__62501a89;
+extern VarInfo __var_info__6a618f66;
+extern VarInfo __var_info__31003f6c;
+extern VarInfo __var_info__44c09d0f;
+extern VarInfo __var_info__e07b8340;
+extern VarInfo __var_info__4ea380c9;
+extern VarInfo __var_info__5b5aed7e;
+extern VarInfo __var_info__5c6a7b2a;
+extern VarInfo __var_info__17fa3290;
+extern VarInfo __var_info__3ffecf28;
+extern VarInfo __var_info__35318804;
+extern VarInfo __var_info__6d26ed46;
+extern VarInfo __var_info__c30b8832;
+extern VarInfo __var_info__f9cf2773;
+extern VarInfo __var_info__7dbd0fd0;
+extern VarInfo __var_info__e60e4b76;
+extern VarInfo __var_info__ecaa314f;
+extern VarInfo __var_info__473ba58e;
+extern VarInfo __var_info__94a09ba8;
+extern VarInfo __var_info__22d64822;
+extern VarInfo __var_info__3f5db93a;
+extern VarInfo __var_info__7ea03b0a;
+extern VarInfo __var_info__c3059e01;
+extern VarInfo __var_info__2424f242;
+extern VarInfo __var_info__f8db2b5e;
+extern VarInfo __var_info__345035e;
+extern VarInfo __var_info__f121043c;
+extern VarInfo __var_info__9c54bd69;
+extern VarInfo __var_info__67d4de9e;
+extern VarInfo __var_info__56bc3b31;
+extern VarInfo __var_info__baf2663b;
+extern VarInfo __var_info__ef43c654;
+extern VarInfo __var_info__4e456461;
+extern VarInfo __var_info__e85d642a;
+extern VarInfo __var_info__69d06946;
+extern VarInfo __var_info__dafec4e2;
+extern VarInfo __var_info__da6e0eb8;
+extern VarInfo __var_info__d98b46cf;
+extern VarInfo __var_info__f30832aa;
+extern VarInfo __var_info__683b401b;
+extern VarInfo __var_info__2be9792d;
+extern VarInfo __var_info__1d0d5850;
+extern VarInfo __var_info__80825ff1;
+extern VarInfo __var_info__a433d831;
+extern VarInfo __var_info__f22f1843;
+extern VarInfo __var_info__cafe3512;
+extern VarInfo __var_info__11e32aaa;
+extern VarInfo __var_info__975f8446;
+extern VarInfo __var_info__5018605f;
+extern VarInfo __var_info__54ca8c71;
+extern VarInfo __var_info__f7388431;
+extern VarInfo __var_info__733e4d9a;
+extern VarInfo __var_info__fcdb84a;
+extern VarInfo __var_info__ad56015e;
+extern VarInfo __var_info__c5812bce;
+extern VarInfo __var_info__56922daf;
+extern VarInfo __var_info__e305e58b;
+extern VarInfo __var_info__cb3eecea;
+extern VarInfo __var_info__874370a6;
+extern VarInfo __var_info__d0b36421;
+extern VarInfo __var_info__344d19dc;
+extern VarInfo __var_info__5bede5bc;
+extern VarInfo __var_info__665bd462;
+extern VarInfo __var_info__7699a61a;
+extern VarInfo __var_info__4c957b89;
+extern VarInfo __var_info__f70a7ab7;
+extern VarInfo __var_info__9fd1ce62;
+extern VarInfo __var_info__bded52c;
+extern VarInfo __var_info__1fb7790a;
+extern VarInfo __var_info__63537942;
+extern VarInfo __var_info__8ab1a3fb;
+extern VarInfo __var_info__5318a856;
+extern VarInfo __var_info__ce0cc705;
+extern VarInfo __var_info__26ba0d6;
+extern VarInfo __var_info__faaa0586;
+extern VarInfo __var_info__a3be05a6;
+extern VarInfo __var_info__cb50360b;
+extern VarInfo __var_info__3d839277;
+extern VarInfo __var_info__c35127d9;
+extern VarInfo __var_info__cff43f48;
+extern VarInfo __var_info__eb50d8bd;
+extern VarInfo __var_info__ba8cda98;
+extern VarInfo __var_info__c1788e8c;
+extern VarInfo __var_info__f41ae641;
+extern VarInfo __var_info__53fa89d9;
+extern VarInfo __var_info__17c70a5f;
+extern VarInfo __var_info__cd5e810f;
+extern VarInfo __var_info__d32e8004;
+extern VarInfo __var_info__5660644b;
+extern VarInfo __var_info__66942b3b;
+extern VarInfo __var_info__e4dec3a3;
+extern VarInfo __var_info__999f9e51;
+extern VarInfo __var_info__27fe98e;
+extern VarInfo __var_info__13fc640c;
+extern VarInfo __var_info__bc842643;
+extern VarInfo __var_info__16bed64b;
+extern VarInfo __var_info__6ac59837;
+extern VarInfo __var_info__1410ffd4;
+extern VarInfo __var_info__d1aa62f5;
+extern VarInfo __var_info__3d13091d;
+extern VarInfo __var_info__ae82ddb2;
+extern VarInfo __var_info__fb38e121;
+extern VarInfo __var_info__c9d33bac;
+extern VarInfo __var_info__43f7c55f;
+extern VarInfo __var_info__4f23aa19;
+extern VarInfo __var_info__2df2d13e;
+extern VarInfo __var_info__84dba48a;
+extern VarInfo __var_info__f696d6dc;
+extern VarInfo __var_info__b52e95d4;
+extern VarInfo __var_info__955e0b53;
+extern VarInfo __var_info__491e734a;
+extern VarInfo __var_info__f23520d;
+extern VarInfo __var_info__59632596;
+extern VarInfo __var_info__52c5da8;
+extern VarInfo __var_info__420fff5d;
+extern VarInfo __var_info__f210b1d7;
+extern VarInfo __var_info__5e90f2e0;
+extern VarInfo __var_info__d5e17945;
+extern VarInfo __var_info__63349b0a;
+extern VarInfo __var_info__7d03a26f;
+extern VarInfo __var_info__9749ae66;
+extern VarInfo __var_info__d7afd92f;
+extern VarInfo __var_info__f25a787;
+extern VarInfo __var_info__cade5a24;
+extern VarInfo __var_info__3924c25d;
+extern VarInfo __var_info__54a06069;
+extern VarInfo __var_info__2be6f93b;
+extern VarInfo __var_info__ecab833d;
+extern VarInfo __var_info__abf58f1a;
+extern VarInfo __var_info__1f24ea63;
+extern VarInfo __var_info__6c2ff37;
+extern VarInfo __var_info__ad676ca7;
+extern VarInfo __var_info__47c70cb4;
+extern VarInfo __var_info__25c3c845;
+extern VarInfo __var_info__4048a67e;
+extern VarInfo __var_info__352d5474;
+extern VarInfo __var_info__488a4c9d;
+extern VarInfo __var_info__88bd350e;
+extern VarInfo __var_info__36741281;
+extern VarInfo __var_info__d4afd476;
+extern VarInfo __var_info__cf49df21;
+extern VarInfo __var_info__70c1cc07;
+extern VarInfo __var_info__7cfe7756;
+extern VarInfo __var_info__b1553d6f;
+extern VarInfo __var_info__5d3a9968;
+extern VarInfo __var_info__f1082f84;
+extern VarInfo __var_info__ea247f1e;
+extern VarInfo __var_info__89b1ed2f;
+extern VarInfo __var_info__ed636a01;
+extern VarInfo __var_info__29351962;
+extern VarInfo __var_info__cdf358aa;
+extern VarInfo __var_info__478163da;
+extern VarInfo __var_info__b1dfcb71;
+extern VarInfo __var_info__134ae51;
+extern VarInfo __var_info__46d67602;
+extern VarInfo __var_info__85e724d2;
+extern VarInfo __var_info__5a923ad6;
+extern VarInfo __var_info__ad464f32;
+extern VarInfo __var_info__edfe648e;
+extern VarInfo __var_info__5b14412c;
+extern VarInfo __var_info__7acb55e1;
+extern VarInfo __var_info__a7659bf6;
+extern VarInfo __var_info__f8f69b4e;
+extern VarInfo __var_info__6bac7c4b;
+extern VarInfo __var_info__20ad8d95;
+extern VarInfo __var_info__fdb1042d;
+extern VarInfo __var_info__989f9cbe;
+extern VarInfo __var_info__91161aa8;
+extern VarInfo __var_info__7cd019a4;
+extern VarInfo __var_info__60029dc6;
+extern VarInfo __var_info__c9d28329;
+extern VarInfo __var_info__b69afd24;
+extern VarInfo __var_info__cd11184c;
+extern VarInfo __var_info__7c4b9d45;
+extern VarInfo __var_info__754e508d;
+extern VarInfo __var_info__36ccf8a9;
+extern VarInfo __var_info__27e91762;
+extern VarInfo __var_info__ed575131;
+extern VarInfo __var_info__481176c0;
+extern VarInfo __var_info__fb2bf28e;
+extern VarInfo __var_info__928e0068;
+extern VarInfo __var_info__c4a28f5d;
+extern VarInfo __var_info__2965e55d;
+extern VarInfo __var_info__6673f9e8;
+extern VarInfo __var_info__8f450a98;
+extern VarInfo __var_info__f54e1b09;
+extern VarInfo __var_info__a6016d01;
+extern VarInfo __var_info__d15980dd;
+extern VarInfo __var_info__a80e5f39;
+extern VarInfo __var_info__8ccb024c;
+extern VarInfo __var_info__b4639ab5;
+extern VarInfo __var_info__de4214b5;
+extern VarInfo __var_info__b30e1f1a;
+extern VarInfo __var_info__ce1948c4;
+extern VarInfo __var_info__6fb374ef;
+extern VarInfo __var_info__88b468bd;
+extern VarInfo __var_info__1734e1a3;
+extern VarInfo __var_info__d676fdc3;
+extern VarInfo __var_info__ded8f181;
+extern VarInfo __var_info__81b94a38;
+extern VarInfo __var_info__b7b543cd;
+extern VarInfo __var_info__ac1f0992;
+extern VarInfo __var_info__f502f93d;
+extern VarInfo __var_info__e43fb95e;
+extern VarInfo __var_info__6a3abace;
+extern VarInfo __var_info__100c0cd1;
+extern VarInfo __var_info__a01c9735;
+extern VarInfo __var_info__89088bbd;
+extern VarInfo __var_info__3f7204b7;
+extern VarInfo __var_info__fdf0c285;
+extern VarInfo __var_info__cbd679f5;
+extern VarInfo __var_info__4bbc29e0;
+extern VarInfo __var_info__d67bb8c9;
+extern VarInfo __var_info__2f87634a;
+extern VarInfo __var_info__3089b32b;
+extern VarInfo __var_info__db9cadee;
+extern VarInfo __var_info__a47ec616;
+extern VarInfo __var_info__880f2249;
+extern VarInfo __var_info__ff331fae;
+extern VarInfo __var_info__d534974e;
+extern VarInfo __var_info__784be548;
+extern VarInfo __var_info__7cdfb396;
+extern VarInfo __var_info__1c56de;
+extern VarInfo __var_info__831b2e2;
+extern VarInfo __var_info__125e1d18;
+extern VarInfo __var_info__9f981a7f;
+extern VarInfo __var_info__d6bd6ae8;
+extern VarInfo __var_info__38843a3b;
+extern VarInfo __var_info__f3ae166d;
+extern VarInfo __var_info__67cfaaa3;
+extern VarInfo __var_info__37d4a2f;
+extern VarInfo __var_info__151562de;
+extern VarInfo __var_info__b29b802f;
+extern VarInfo __var_info__66b00e6;
+extern VarInfo __var_info__e548d3bb;
+extern VarInfo __var_info__4ccbcfa9;
+extern VarInfo __var_info__b771215c;
+extern VarInfo __var_info__37233ab;
+extern VarInfo __var_info__2da1af8c;
+extern VarInfo __var_info__ea6f8438;
+extern VarInfo __var_info__b8245979;
+extern VarInfo __var_info__14a4fd9a;
+extern VarInfo __var_info__9b9fa177;
+extern VarInfo __var_info__c8cb4bb6;
+extern VarInfo __var_info__a1fce89a;
+extern VarInfo __var_info__a10f6f08;
+extern VarInfo __var_info__2524f3d5;
+extern VarInfo __var_info__98ded09c;
+extern VarInfo __var_info__fcba257e;
+extern VarInfo __var_info__378d4331;
+extern VarInfo __var_info__f7f0b913;
+extern VarInfo __var_info__c27b4929;
+extern VarInfo __var_info__c0abce96;
+extern VarInfo __var_info__f148368d;
+extern VarInfo __var_info__e91ad4f0;
+extern VarInfo __var_info__1cd5d134;
+extern VarInfo __var_info__59a80c5a;
+extern VarInfo __var_info__e0f318c;
+extern VarInfo __var_info__ea1ad683;
+extern VarInfo __var_info__8644430a;
+extern VarInfo __var_info__534df069;
+extern VarInfo __var_info__6db16262;
+extern VarInfo __var_info__8d22e4d2;
+extern VarInfo __var_info__4ad1a9fc;
+extern VarInfo __var_info__36f7da2b;
+extern VarInfo __var_info__f2348094;
+extern VarInfo __var_info__7b1613b9;
+extern VarInfo __var_info__344e37a8;
+extern VarInfo __var_info__41877d4c;
+extern VarInfo __var_info__90c0d54d;
+extern VarInfo __var_info__118e6734;
+extern VarInfo __var_info__6c08a2e5;
+extern VarInfo __var_info__33e4414a;
+extern VarInfo __var_info__9ee37111;
+extern VarInfo __var_info__62a97b6f;
+extern VarInfo __var_info__827a7b9f;
+extern VarInfo __var_info__af868847;
+extern VarInfo __var_info__37938abe;
+extern VarInfo __var_info__cba8b9e;
+extern VarInfo __var_info__6f4bc015;
+extern VarInfo __var_info__53229621;
+extern VarInfo __var_info__21588a7a;
+extern VarInfo __var_info__8e0c0304;
+extern VarInfo __var_info__a1fae513;
+extern VarInfo __var_info__f3331ad9;
+extern VarInfo __var_info__dc52480;
+extern VarInfo __var_info__aa30df58;
+extern VarInfo __var_info__340ba2ca;
+extern VarInfo __var_info__b35acbb;
+extern VarInfo __var_info__984deb65;
+extern VarInfo __var_info__e115d87d;
+extern VarInfo __var_info__ea48db9a;
+extern VarInfo __var_info__62c1b97e;
+extern VarInfo __var_info__ae0da28b;
+extern VarInfo __var_info__ae25b4da;
+extern VarInfo __var_info__cc0f5e2c;
+extern VarInfo __var_info__28a7a1a3;
+extern VarInfo __var_info__64f4b569;
+extern VarInfo __var_info__363fb586;
+extern VarInfo __var_info__fb5f5afd;
+extern VarInfo __var_info__f6c265d2;
+extern VarInfo __var_info__e7bacd18;
+extern VarInfo __var_info__6aa1322d;
+extern VarInfo __var_info__c6bf2bd2;
+extern VarInfo __var_info__2d3a4cbf;
+extern VarInfo __var_info__5f8e977b;
+extern VarInfo __var_info__e849de0d;
+extern VarInfo __var_info__4e1425f1;
+extern VarInfo __var_info__dfbb50cb;
+extern VarInfo __var_info__42411f94;
+extern VarInfo __var_info__ad395960;
+extern VarInfo __var_info__58bae795;
+extern VarInfo __var_info__3f48a4eb;
+extern VarInfo __var_info__d6afd79c;
+extern VarInfo __var_info__fbd35c53;
+extern VarInfo __var_info__be2a6fa8;
+extern VarInfo __var_info__a9b0cc55;
+extern VarInfo __var_info__bfa3a981;
+extern VarInfo __var_info__daebe88a;
+extern VarInfo __var_info__c6d19a6b;
+extern VarInfo __var_info__e148cd6f;
+extern VarInfo __var_info__a246be3c;
+extern VarInfo __var_info__6d5c4cbf;
+extern VarInfo __var_info__e95012d3;
+extern VarInfo __var_info__6fc12b47;
+extern VarInfo __var_info__83d1fa2b;
+extern VarInfo __var_info__b3dfce97;
+extern VarInfo __var_info__d1207c3b;
+extern VarInfo __var_info__7a87bd0e;
+extern VarInfo __var_info__919eabb1;
+extern VarInfo __var_info__2ff7cf26;
+extern VarInfo __var_info__dbe74630;
+extern VarInfo __var_info__12214d06;
+extern VarInfo __var_info__59f74814;
+extern VarInfo __var_info__a55b060a;
+extern VarInfo __var_info__511d52e;
+extern VarInfo __var_info__5c110b60;
+extern VarInfo __var_info__ee882f82;
+extern VarInfo __var_info__a00a9b92;
+extern VarInfo __var_info__97b1c4ed;
+extern VarInfo __var_info__31d5ab9b;
+extern VarInfo __var_info__95639bfb;
+extern VarInfo __var_info__415773f6;
+extern VarInfo __var_info__c8c09fee;
+extern VarInfo __var_info__acfaa7e4;
+extern VarInfo __var_info__3e740279;
+extern VarInfo __var_info__59ff465e;
+extern VarInfo __var_info__5c1442bf;
+extern VarInfo __var_info__b48a0505;
+extern VarInfo __var_info__5f2f34e1;
+extern VarInfo __var_info__f76d7213;
+extern VarInfo __var_info__c3c96e7c;
+extern VarInfo __var_info__266e7e8f;
+extern VarInfo __var_info__8a06d317;
+extern VarInfo __var_info__effcbfe8;
+extern VarInfo __var_info__d4bc3e4c;
+extern VarInfo __var_info__fcf035c5;
+extern VarInfo __var_info__537f91c8;
+extern VarInfo __var_info__357d2592;
+extern VarInfo __var_info__b39af6;
+extern VarInfo __var_info__9327c223;
+extern VarInfo __var_info__f0608851;
+extern VarInfo __var_info__196b9af8;
+extern VarInfo __var_info__ac98be01;
+extern VarInfo __var_info__c53bf02b;
+extern VarInfo __var_info__17e9d7b2;
+extern VarInfo __var_info__2ba37dc3;
+extern VarInfo __var_info__992fa949;
+extern VarInfo __var_info__87023e3a;
+extern VarInfo __var_info__a5d0442b;
+extern VarInfo __var_info__2da65b4b;
+extern VarInfo __var_info__f7e372f;
+extern VarInfo __var_info__cd285638;
+extern VarInfo __var_info__d54c6248;
+extern VarInfo __var_info__bd3bde81;
+extern VarInfo __var_info__fe3dc3f0;
+extern VarInfo __var_info__a84b333;
+extern VarInfo __var_info__b1386da7;
+extern VarInfo __var_info__69460f32;
+extern VarInfo __var_info__cdf950db;
+extern VarInfo __var_info__e123467b;
+extern VarInfo __var_info__c3f301a6;
+extern VarInfo __var_info__c7c974c8;
+extern VarInfo __var_info__85d8eec0;
+extern VarInfo __var_info__91455af5;
+extern VarInfo __var_info__2be9d377;
+extern VarInfo __var_info__61d16424;
+extern VarInfo __var_info__2767a976;
+extern VarInfo __var_info__9397bac9;
+extern VarInfo __var_info__5afbb756;
+extern VarInfo __var_info__92752840;
+extern VarInfo __var_info__6f9810e8;
+extern VarInfo __var_info__b8d8ebaa;
+extern VarInfo __var_info__d3814682;
+extern VarInfo __var_info__612e5862;
+extern VarInfo __var_info__54d32efd;
+extern VarInfo __var_info__171280cf;
+extern VarInfo __var_info__f891e8e9;
+extern VarInfo __var_info__7eb030c1;
+extern VarInfo __var_info__e4eb34d9;
+extern VarInfo __var_info__362d7569;
+extern VarInfo __var_info__fd11ce9d;
+extern VarInfo __var_info__2fa44db;
+extern VarInfo __var_info__2ed8fa20;
+extern VarInfo __var_info__d9bf5106;
+extern VarInfo __var_info__b632464e;
+extern VarInfo __var_info__85473ce6;
+extern VarInfo __var_info__90bd1c1d;
+extern VarInfo __var_info__2a9a9280;
+extern VarInfo __var_info__a75b6f97;
+extern VarInfo __var_info__96a68918;
+extern VarInfo __var_info__3bbb200d;
+extern VarInfo __var_info__a4e37f6e;
+extern VarInfo __var_info__119de894;
+extern VarInfo __var_info__9e9818ec;
+extern VarInfo __var_info__b8539700;
+extern VarInfo __var_info__2d1630f2;
+extern VarInfo __var_info__e6a0bda4;
+extern VarInfo __var_info__3bb172fc;
+extern VarInfo __var_info__4b06762c;
+extern VarInfo __var_info__1859d5ca;
+extern VarInfo __var_info__7df46418;
+extern VarInfo __var_info__f7fa341d;
+extern VarInfo __var_info__4de3ac7f;
+extern VarInfo __var_info__c14c6b92;
+extern VarInfo __var_info__9f8aff38;
+extern VarInfo __var_info__71b02ac9;
+extern VarInfo __var_info__fb05f748;
+extern VarInfo __var_info__5c3a9027;
+extern VarInfo __var_info__57bc3cc4;
+extern VarInfo __var_info__366f67df;
+extern VarInfo __var_info__faf7ed85;
+extern VarInfo __var_info__16e3dfd5;
+extern VarInfo __var_info__7ec98560;
+extern VarInfo __var_info__c053d161;
+extern VarInfo __var_info__f834845d;
+extern VarInfo __var_info__ecac6fe6;
+extern VarInfo __var_info__36e5062c;
+extern VarInfo __var_info__c2eeb99c;
+extern VarInfo __var_info__b8ba8abc;
+extern VarInfo __var_info__f10f7f5;
+extern VarInfo __var_info__c01a4f8d;
+extern VarInfo __var_info__8504165b;
+extern VarInfo __var_info__b873b4e2;
+extern VarInfo __var_info__dcf3a848;
+extern VarInfo __var_info__64bce7f2;
+extern VarInfo __var_info__791761bb;
+extern VarInfo __var_info__cb6ac1d9;
+extern VarInfo __var_info__35f68313;
+extern VarInfo __var_info__6b26ea35;
+extern VarInfo __var_info__eab5aac4;
+extern VarInfo __var_info__d60d3d7;
+extern VarInfo __var_info__ac29e6b9;
+extern VarInfo __var_info__56569ad4;
+extern VarInfo __var_info__246cf71c;
+extern VarInfo __var_info__89e422d2;
+extern VarInfo __var_info__c074a17b;
+extern VarInfo __var_info__663ab482;
+extern VarInfo __var_info__69ed062d;
+extern VarInfo __var_info__21b9526c;
+extern VarInfo __var_info__60ccfb46;
+extern VarInfo __var_info__c728270d;
+extern VarInfo __var_info__fb452def;
+extern VarInfo __var_info__8b5bc18e;
+extern VarInfo __var_info__cfe854bb;
+extern VarInfo __var_info__706849b7;
+extern VarInfo __var_info__9f580f7e;
+extern VarInfo __var_info__7238d29c;
+extern VarInfo __var_info__1bbde4e9;
+extern VarInfo __var_info__9b78bd2b;
+extern VarInfo __var_info__822a0a6f;
+extern VarInfo __var_info__15086ded;
+extern VarInfo __var_info__6d3abf87;
+extern VarInfo __var_info__c3f422a4;
+extern VarInfo __var_info__49b23bf2;
+extern VarInfo __var_info__166afcb5;
+extern VarInfo __var_info__bb6a8eb5;
+extern VarInfo __var_info__f1675330;
+extern VarInfo __var_info__bd0887ee;
+extern VarInfo __var_info__4aed1461;
+extern VarInfo __var_info__63a3eac;
+extern VarInfo __var_info__61e3bc2;
+extern VarInfo __var_info__2b24fd47;
+extern VarInfo __var_info__3bbe5820;
+extern VarInfo __var_info__1d2bbb7f;
+extern VarInfo __var_info__b7494507;
+extern VarInfo __var_info__9bd0e54c;
+extern VarInfo __var_info__6108ac9e;
+extern VarInfo __var_info__314bdb52;
+extern VarInfo __var_info__ad3ee71d;
+extern VarInfo __var_info__7db02f2e;
+extern VarInfo __var_info__f75ab503;
+extern VarInfo __var_info__c2ec29d8;
+extern VarInfo __var_info__194a43f6;
+extern VarInfo __var_info__3dd5135c;
+extern VarInfo __var_info__f926b09;
+extern VarInfo __var_info__957cb118;
+extern VarInfo __var_info__e8005be5;
+extern VarInfo __var_info__f2f1d3aa;
+extern VarInfo __var_info__79e882c;
+extern VarInfo __var_info__dc9132bc;
+extern VarInfo __var_info__32f7d3df;
+extern VarInfo __var_info__3e48a358;
+extern VarInfo __var_info__1ec27b07;
+extern VarInfo __var_info__da16dcf7;
+extern VarInfo __var_info__2f284709;
+extern VarInfo __var_info__e7f8a0e2;
+extern VarInfo __var_info__2ed13d0e;
+extern VarInfo __var_info__5532d30;
+extern VarInfo __var_info__dcad1b61;
+extern VarInfo __var_info__bf4114ba;
+extern VarInfo __var_info__9edcbce;
+extern VarInfo __var_info__7e17699a;
+extern VarInfo __var_info__be7f9f82;
+extern VarInfo __var_info__981ee92a;
+extern VarInfo __var_info__85d1fd51;
+extern VarInfo __var_info__ef31a644;
+extern VarInfo __var_info__8f9f8e93;
+extern VarInfo __var_info__52ff6128;
+extern VarInfo __var_info__9c7750e0;
+extern VarInfo __var_info__2e85f57c;
+extern VarInfo __var_info__41b3286b;
+extern VarInfo __var_info__538c74c6;
+extern VarInfo __var_info__5116d7d9;
+extern VarInfo __var_info__1ab52e01;
+extern VarInfo __var_info__4d075e0d;
+extern VarInfo __var_info__3dd793a0;
+extern VarInfo __var_info__c32d1370;
+extern VarInfo __var_info__7e73a97d;
+extern VarInfo __var_info__a14c8807;
+extern VarInfo __var_info__bb163ec9;
+extern VarInfo __var_info__4a02be5b;
+extern VarInfo __var_info__7b19d1b;
+extern VarInfo __var_info__56bcea9b;
+extern VarInfo __var_info__42ce82dc;
+extern VarInfo __var_info__8556f5e7;
+extern VarInfo __var_info__d7a0c00a;
+extern VarInfo __var_info__82663159;
+extern VarInfo __var_info__26515827;
+extern VarInfo __var_info__6a3b4341;
+extern VarInfo __var_info__e30c055b;
+extern VarInfo __var_info__d62685b2;
+extern VarInfo __var_info__10bf88c5;
+extern VarInfo __var_info__66d66f87;
+extern VarInfo __var_info__6a71f159;
+extern VarInfo __var_info__6064e3fd;
+extern VarInfo __var_info__9342d24d;
+extern VarInfo __var_info__1c9914bb;
+extern VarInfo __var_info__f4999d8b;
+extern VarInfo __var_info__f6bc51c2;
+extern VarInfo __var_info__9b754637;
+extern VarInfo __var_info__6521e890;
+extern VarInfo __var_info__be237068;
+extern VarInfo __var_info__8cd25291;
+extern VarInfo __var_info__ba18bc77;
+extern VarInfo __var_info__828df567;
+extern VarInfo __var_info__92e3d111;
+extern VarInfo __var_info__697917f3;
+extern VarInfo __var_info__47ba4d73;
+extern VarInfo __var_info__9741fde0;
+extern VarInfo __var_info__4d12b99f;
+extern VarInfo __var_info__f22e60c;
+extern VarInfo __var_info__554a21ae;
+extern VarInfo __var_info__3675e444;
+extern VarInfo __var_info__d0f2ff9;
+extern VarInfo __var_info__954cb34;
+extern VarInfo __var_info__dff4c38b;
+extern VarInfo __var_info__496f7eb9;
+extern VarInfo __var_info__c881d8e4;
+extern VarInfo __var_info__e5f6be3c;
+extern VarInfo __var_info__f64b3851;
+extern VarInfo __var_info__b06f0a94;
+extern VarInfo __var_info__9cd84da2;
+extern VarInfo __var_info__d0bb76bd;
+extern VarInfo __var_info__c5982fb5;
+extern VarInfo __var_info__369dc340;
+extern VarInfo __var_info__e4c43172;
+extern VarInfo __var_info__afac4da3;
+extern VarInfo __var_info__94de33a;
+extern VarInfo __var_info__d6760da3;
+extern VarInfo __var_info__f5f883ac;
+extern VarInfo __var_info__e724dd47;
+extern VarInfo __var_info__dcd95cf7;
+extern VarInfo __var_info__1dd0d240;
+extern VarInfo __var_info__1fff0112;
+extern VarInfo __var_info__98b1d7d1;
+extern VarInfo __var_info__7447bb4f;
+extern VarInfo __var_info__915be3cd;
+extern VarInfo __var_info__876c3688;
+extern VarInfo __var_info__d5abf604;
+extern VarInfo __var_info__66b5d28e;
+extern VarInfo __var_info__44366121;
+extern VarInfo __var_info__c5f99f7a;
+extern VarInfo __var_info__e353e434;
+extern VarInfo __var_info__a647e36;
+extern VarInfo __var_info__7143db7c;
+extern VarInfo __var_info__2e243fb9;
+extern VarInfo __var_info__6f60f1d5;
+extern VarInfo __var_info__74bffcda;
+extern VarInfo __var_info__a0ecfbb9;
+extern VarInfo __var_info__12086934;
+extern VarInfo __var_info__abdcc155;
+extern VarInfo __var_info__b362672c;
+extern VarInfo __var_info__a7fc259;
+extern VarInfo __var_info__1bf16836;
+extern VarInfo __var_info__d422eeb3;
+extern VarInfo __var_info__3c5f745b;
+extern VarInfo __var_info__fde13b6e;
+extern VarInfo __var_info__49a48eab;
+extern VarInfo __var_info__2fc4a32a;
+extern VarInfo __var_info__f2cb2b87;
+extern VarInfo __var_info__bac4281b;
+extern VarInfo __var_info__5a748d0a;
+extern VarInfo __var_info__c1650214;
+extern VarInfo __var_info__8b73a850;
+extern VarInfo __var_info__5011b17e;
+extern VarInfo __var_info__fac4ee59;
+extern VarInfo __var_info__db077e9e;
+extern VarInfo __var_info__3e63ea5b;
+extern VarInfo __var_info__7d377b00;
+extern VarInfo __var_info__30f7d0b9;
+extern VarInfo __var_info__8a8dab8a;
+extern VarInfo __var_info__583ea0d;
+extern VarInfo __var_info__592dbea7;
+extern VarInfo __var_info__56377acc;
+extern VarInfo __var_info__490512e0;
+extern VarInfo __var_info__95b7ed30;
+extern VarInfo __var_info__4520562a;
+extern VarInfo __var_info__afd807ea;
+extern VarInfo __var_info__757540b8;
+extern VarInfo __var_info__ae0ae045;
+extern VarInfo __var_info__a6a4187e;
+extern VarInfo __var_info__2b21027f;
+extern VarInfo __var_info__75c92fd3;
+extern VarInfo __var_info__407719d5;
+extern VarInfo __var_info__9371b2b4;
+extern VarInfo __var_info__5abeb395;
+extern VarInfo __var_info__e3083f3d;
+extern VarInfo __var_info__7332b1be;
+extern VarInfo __var_info__9356e5ba;
+extern VarInfo __var_info__90a51465;
+extern VarInfo __var_info__ebca0bcd;
+extern VarInfo __var_info__83dd3ae;
+extern VarInfo __var_info__4816b343;
+extern VarInfo __var_info__ae4c30a6;
+extern VarInfo __var_info__2f133526;
+extern VarInfo __var_info__f25fabc1;
+extern VarInfo __var_info__3d5bbe8c;
+extern VarInfo __var_info__78bcb4df;
+extern VarInfo __var_info__eb74ac2b;
+extern VarInfo __var_info__a6dae66e;
+extern VarInfo __var_info__e1345261;
+extern VarInfo __var_info__4cc49cff;
+extern VarInfo __var_info__9e00bbc5;
+extern VarInfo __var_info__8f4c9038;
+extern VarInfo __var_info__4c6187aa;
+extern VarInfo __var_info__6c97d67;
+extern VarInfo __var_info__81c8526c;
+extern VarInfo __var_info__d5146090;
+extern VarInfo __var_info__43dcd62;
+extern VarInfo __var_info__4887db98;
+extern VarInfo __var_info__21f91cf0;
+extern VarInfo __var_info__d711acc8;
+extern VarInfo __var_info__c6c29fac;
+extern VarInfo __var_info__dd62e3b6;
+extern VarInfo __var_info__19e1a2ca;
+extern VarInfo __var_info__c93f0085;
+extern VarInfo __var_info__87645f9a;
+extern VarInfo __var_info__101f72bc;
+extern VarInfo __var_info__2703f731;
+extern VarInfo __var_info__df05df3f;
+extern VarInfo __var_info__3aa0838;
+extern VarInfo __var_info__5aa7631;
+extern VarInfo __var_info__d3542662;
+extern VarInfo __var_info__dad314cd;
+extern VarInfo __var_info__7e123485;
+extern VarInfo __var_info__2c383e55;
+extern VarInfo __var_info__1e070140;
+extern VarInfo __var_info__41c7e4f7;
+extern VarInfo __var_info__d75efa1d;
+extern VarInfo __var_info__b267dd2b;
+extern VarInfo __var_info__c5b916e5;
+extern VarInfo __var_info__ae8d05f1;
+extern VarInfo __var_info__b08b6929;
+extern VarInfo __var_info__5acd7362;
+extern VarInfo __var_info__aec929b4;
+extern VarInfo __var_info__b9ac2ff0;
+extern VarInfo __var_info__467d279d;
+extern VarInfo __var_info__7acd6d0b;
+extern VarInfo __var_info__ba5333e6;
+extern VarInfo __var_info__6dbb285b;
+extern VarInfo __var_info__49495ba0;
+extern VarInfo __var_info__293f40b;
+extern VarInfo __var_info__7252da3e;
+extern VarInfo __var_info__83e25011;
+extern VarInfo __var_info__5a4a6640;
+extern VarInfo __var_info__5f62826b;
+extern VarInfo __var_info__ae3b95fa;
+extern VarInfo __var_info__db39b90e;
+extern VarInfo __var_info__f7624135;
+extern VarInfo __var_info__cc02d1d4;
+extern VarInfo __var_info__9d99d2e1;
+extern VarInfo __var_info__2f90ec93;
+extern VarInfo __var_info__83d50dee;
+extern VarInfo __var_info__d79e7204;
+extern VarInfo __var_info__c7b6a3cd;
+extern VarInfo __var_info__a74c85b9;
+extern VarInfo __var_info__717f8e67;
+extern VarInfo __var_info__2af4d3dc;
+extern VarInfo __var_info__2cad98de;
+extern VarInfo __var_info__60de006d;
+extern VarInfo __var_info__bffe1ace;
+extern VarInfo __var_info__e73dd0fd;
+extern VarInfo __var_info__23fa073a;
+extern VarInfo __var_info__a343220e;
+extern VarInfo __var_info__ad16bb9d;
+extern VarInfo __var_info__ed7373bb;
+extern VarInfo __var_info__21bad1fa;
+extern VarInfo __var_info__108e65a1;
+extern VarInfo __var_info__4c7eed65;
+extern VarInfo __var_info__759112d0;
+extern VarInfo __var_info__bd700854;
+extern VarInfo __var_info__b8a59cb3;
+extern VarInfo __var_info__a2272abd;
+extern VarInfo __var_info__f9821332;
+extern VarInfo __var_info__9fd388b9;
+extern VarInfo __var_info__68647de0;
+extern VarInfo __var_info__b7d4d4bf;
+extern VarInfo __var_info__89631998;
+extern VarInfo __var_info__a216b644;
+extern VarInfo __var_info__5fa0ff2d;
+extern VarInfo __var_info__9d88500f;
+extern VarInfo __var_info__a5136dc8;
+extern VarInfo __var_info__239c0205;
+extern VarInfo __var_info__cec97fcd;
+extern VarInfo __var_info__371e2058;
+extern VarInfo __var_info__1e740be8;
+extern VarInfo __var_info__a42b136c;
+extern VarInfo __var_info__5e07a948;
+extern VarInfo __var_info__45086c55;
+extern VarInfo __var_info__4b4fe7d6;
+extern VarInfo __var_info__25c0eaac;
+extern VarInfo __var_info__f01adff5;
+extern VarInfo __var_info__26bad7f3;
+extern VarInfo __var_info__7bafcd47;
+extern VarInfo __var_info__e51104e3;
+extern VarInfo __var_info__5691e167;
+extern VarInfo __var_info__e6aa9afc;
+extern VarInfo __var_info__d5616905;
+extern VarInfo __var_info__8d501176;
+extern VarInfo __var_info__652abe3c;
+extern VarInfo __var_info__888bf034;
+extern VarInfo __var_info__538906fd;
+extern VarInfo __var_info__f705308b;
+extern VarInfo __var_info__1ad4800e;
+extern VarInfo __var_info__b69c599d;
+extern VarInfo __var_info__70515235;
+extern VarInfo __var_info__5566fe3b;
+extern VarInfo __var_info__4312d953;
+extern VarInfo __var_info__37967b12;
+extern VarInfo __var_info__2d969b58;
+extern VarInfo __var_info__736f3564;
+extern VarInfo __var_info__8456f454;
+extern VarInfo __var_info__e87a3b5f;
+extern VarInfo __var_info__61c4f875;
+extern VarInfo __var_info__fed1c550;
+extern VarInfo __var_info__7b4fbbc;
+extern VarInfo __var_info__7705b54f;
+extern VarInfo __var_info__673b3e88;
+extern VarInfo __var_info__800b5a7c;
+extern VarInfo __var_info__ebd6bd76;
+extern VarInfo __var_info__4ab62df6;
+extern VarInfo __var_info__2af42b71;
+extern VarInfo __var_info__872e6207;
+extern VarInfo __var_info__f3b14a02;
+extern VarInfo __var_info__9794b2fb;
+extern VarInfo __var_info__7dd300da;
+extern VarInfo __var_info__c1d2210;
+extern VarInfo __var_info__1a4b915e;
+extern VarInfo __var_info__d6146223;
+extern VarInfo __var_info__e9736d6f;
+extern VarInfo __var_info__96573bfd;
+extern VarInfo __var_info__fcda34de;
+extern VarInfo __var_info__319243ae;
+extern VarInfo __var_info__169d2283;
+extern VarInfo __var_info__6d930425;
+extern VarInfo __var_info__3b423a60;
+extern VarInfo __var_info__2756ee6;
+extern VarInfo __var_info__1cd1bb6;
+extern VarInfo __var_info__b0e1eb49;
+extern VarInfo __var_info__6c3abdf4;
+extern VarInfo __var_info__cf194a57;
+extern VarInfo __var_info__546203a;
+extern VarInfo __var_info__cdc97e3a;
+extern VarInfo __var_info__cdefaef2;
+extern VarInfo __var_info__be9adf0e;
+extern VarInfo __var_info__3113384c;
+extern VarInfo __var_info__cbb05f82;
+extern VarInfo __var_info__3fb625ee;
+extern VarInfo __var_info__3869c9d;
+extern VarInfo __var_info__ab5a44b1;
+extern VarInfo __var_info__1f3e480a;
+extern VarInfo __var_info__fd4fd2d3;
+extern VarInfo __var_info__6d992e73;
+extern VarInfo __var_info__3b927f2b;
+extern VarInfo __var_info__3762d4b;
+extern VarInfo __var_info__ea224087;
+extern VarInfo __var_info__327e2124;
+extern VarInfo __var_info__cc318f39;
+extern VarInfo __var_info__93e9ebcc;
+extern VarInfo __var_info__85bc87fc;
+extern VarInfo __var_info__b9e254cf;
+extern VarInfo __var_info__739506d2;
+extern VarInfo __var_info__93167902;
+extern VarInfo __var_info__cc11d80a;
+extern VarInfo __var_info__6813c3d5;
+extern VarInfo __var_info__35133e98;
+extern VarInfo __var_info__a093c594;
+extern VarInfo __var_info__36bf6516;
+extern VarInfo __var_info__526141d;
+extern VarInfo __var_info__24fb5919;
+extern VarInfo __var_info__634aedad;
+extern VarInfo __var_info__3021cb;
+extern VarInfo __var_info__c67d1ab5;
+extern VarInfo __var_info__ede60617;
+extern VarInfo __var_info__4d82b2d1;
+extern VarInfo __var_info__f89ec7b0;
+extern VarInfo __var_info__77052b94;
+extern VarInfo __var_info__d678b8f7;
+extern VarInfo __var_info__d27dcbbb;
+extern VarInfo __var_info__cc2c110c;
+extern VarInfo __var_info__5e329601;
+extern VarInfo __var_info__a81c30c7;
+extern VarInfo __var_info__815926d4;
+extern VarInfo __var_info__a4cb5e97;
+extern VarInfo __var_info__d26e1de6;
+extern VarInfo __var_info__ffd9fe3a;
+extern VarInfo __var_info__fb824c9d;
+extern VarInfo __var_info__7db2ce6f;
+extern VarInfo __var_info__92aa7458;
+extern VarInfo __var_info__d5066998;
+extern VarInfo __var_info__4b0eeab3;
+extern VarInfo __var_info__55bc399e;
+extern VarInfo __var_info__7706a2c5;
+extern VarInfo __var_info__af00471;
+extern VarInfo __var_info__ddf3644f;
+extern VarInfo __var_info__a682f19d;
+extern VarInfo __var_info__e805ed6a;
+extern VarInfo __var_info__e9e73a57;
+extern VarInfo __var_info__7776bab9;
+extern VarInfo __var_info__573ce464;
+extern VarInfo __var_info__ee0efbc3;
+extern VarInfo __var_info__cea9756b;
+extern VarInfo __var_info__42ca4b75;
+extern VarInfo __var_info__b56e35e;
+extern VarInfo __var_info__eecab256;
+extern VarInfo __var_info__ea5d24a1;
+extern VarInfo __var_info__d57edbad;
+extern VarInfo __var_info__45aaaeef;
+extern VarInfo __var_info__7b25207e;
+extern VarInfo __var_info__eaaaeb7d;
+extern VarInfo __var_info__3778a5ab;
+extern VarInfo __var_info__24fd55a9;
+extern VarInfo __var_info__4bc8c441;
+extern VarInfo __var_info__ff7833b0;
+extern VarInfo __var_info__3cb36c5c;
+extern VarInfo __var_info__2e991523;
+extern VarInfo __var_info__fd67edf0;
+extern VarInfo __var_info__8227ac2e;
+extern VarInfo __var_info__4ec985c5;
+extern VarInfo __var_info__57306c1e;
+extern VarInfo __var_info__9387af87;
+extern VarInfo __var_info__e6f3da09;
+extern VarInfo __var_info__decfd9a5;
+extern VarInfo __var_info__94bb64af;
+extern VarInfo __var_info__6c164ebf;
+extern VarInfo __var_info__c985a48c;
+extern VarInfo __var_info__1c524c4f;
+extern VarInfo __var_info__cfdad306;
+extern VarInfo __var_info__558aa41c;
+extern VarInfo __var_info__7cea0e86;
+extern VarInfo __var_info__eee3bc09;
+extern VarInfo __var_info__f1edd27b;
+extern VarInfo __var_info__a70808f7;
+extern VarInfo __var_info__31ca940d;
+extern VarInfo __var_info__29eae2f9;
+extern VarInfo __var_info__1f7641d0;
+extern VarInfo __var_info__1cc53c49;
+extern VarInfo __var_info__c5b24592;
+extern VarInfo __var_info__71f36749;
+extern VarInfo __var_info__d9ad8517;
+extern VarInfo __var_info__db146a02;
+extern VarInfo __var_info__736b0ec;
+extern VarInfo __var_info__fad05c90;
+extern VarInfo __var_info__c08345ba;
+extern VarInfo __var_info__796330a9;
+extern VarInfo __var_info__94ce6e6f;
+extern VarInfo __var_info__383793f8;
+extern VarInfo __var_info__2ccba128;
+extern VarInfo __var_info__68018619;
+extern VarInfo __var_info__e10f662;
+extern VarInfo __var_info__f1ef1f14;
+extern VarInfo __var_info__47406a85;
+extern VarInfo __var_info__73fc5e3b;
+extern VarInfo __var_info__ad984ec8;
+extern VarInfo __var_info__1dafc99d;
+extern VarInfo __var_info__4a66add7;
+extern VarInfo __var_info__c2023960;
+extern VarInfo __var_info__fdcc980e;
+extern VarInfo __var_info__7d73a7ea;
+extern VarInfo __var_info__ff29c4d6;
+extern VarInfo __var_info__d76915b6;
+extern VarInfo __var_info__aff78d24;
+extern VarInfo __var_info__62720897;
+extern VarInfo __var_info__917b7ee0;
+extern VarInfo __var_info__77739e78;
+extern VarInfo __var_info__12c1f55a;
+extern VarInfo __var_info__cfd5f3e1;
+extern VarInfo __var_info__8e76b93f;
+extern VarInfo __var_info__a9fc8627;
+extern FuncInfo __func_info__7b90a06c;
+
+VarInfo __struct_info__594390b9_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x558aa41c, "__rtti", 0 };
+TypeInfo * __type_info__d678b8f7_arg_types_var_1497600185[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__594390b9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d678b8f7_arg_types_var_1497600185, nullptr, 1, 0, nullptr, 28, 0xd678b8f7, "__finalize", 8 };
+TypeInfo * __type_info__42ca4b75_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__594390b9_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__42ca4b75_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x42ca4b75, "preVisitProgram", 12 };
+TypeInfo * __type_info__3b80c6b2_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__594390b9_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b80c6b2_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3b80c6b2, "visitProgram", 16 };
+TypeInfo * __type_info__984deb65_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__594390b9_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__984deb65_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x984deb65, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__918cc1f7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__594390b9_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__918cc1f7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x918cc1f7, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9bf4c06a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__594390b9_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9bf4c06a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9bf4c06a, "visitTypeDecl", 28 };
+TypeInfo * __type_info__a2272abd_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__594390b9_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a2272abd_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xa2272abd, "preVisitAlias", 32 };
+TypeInfo * __type_info__b56e35e_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__594390b9_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__b56e35e_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xb56e35e, "visitAlias", 36 };
+TypeInfo * __type_info__a47ec616_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__594390b9_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a47ec616_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa47ec616, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__f70a7ab7_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f70a7ab7_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0xf70a7ab7, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__85e724d2_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85e724d2_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x85e724d2, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__f23520d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__594390b9_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__f23520d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf23520d, "visitEnumeration", 52 };
+TypeInfo * __type_info__4887db98_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__594390b9_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4887db98_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4887db98, "preVisitStructure", 56 };
+TypeInfo * __type_info__aec929b4_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aec929b4_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xaec929b4, "preVisitStructureField", 60 };
+TypeInfo * __type_info__faf7ed85_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__faf7ed85_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xfaf7ed85, "visitStructureField", 64 };
+TypeInfo * __type_info__38843a3b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__594390b9_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__38843a3b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x38843a3b, "visitStructure", 68 };
+TypeInfo * __type_info__ece4bcc3_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__594390b9_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ece4bcc3_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xece4bcc3, "preVisitFunction", 72 };
+TypeInfo * __type_info__6a618f66_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__594390b9_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__6a618f66_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6a618f66, "visitFunction", 76 };
+TypeInfo * __type_info__9c7750e0_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9c7750e0_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x9c7750e0, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__cfd5f3e1_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__cfd5f3e1_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xcfd5f3e1, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__27e91762_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__27e91762_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x27e91762, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__2b21027f_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2b21027f_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x2b21027f, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__49a48eab_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__594390b9_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49a48eab_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x49a48eab, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__21bad1fa_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__594390b9_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21bad1fa_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x21bad1fa, "visitFunctionBody", 100 };
+TypeInfo * __type_info__588f95b5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__588f95b5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x588f95b5, "preVisitExpression", 104 };
+TypeInfo * __type_info__9741fde0_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9741fde0_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9741fde0, "visitExpression", 108 };
+TypeInfo * __type_info__5116d7d9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__594390b9_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5116d7d9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5116d7d9, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__2d1630f2_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__594390b9_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2d1630f2_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2d1630f2, "visitExprBlock", 116 };
+TypeInfo * __type_info__4c6187aa_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c6187aa_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x4c6187aa, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__c728270d_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__c728270d_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xc728270d, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5a4a6640_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5a4a6640_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x5a4a6640, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__5e4adcab_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e4adcab_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x5e4adcab, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__56922daf_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56922daf_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x56922daf, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__2a9a9280_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2a9a9280_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x2a9a9280, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__16bed64b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__594390b9_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__16bed64b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x16bed64b, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__fde13b6e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__594390b9_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde13b6e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xfde13b6e, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__1dafc99d_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1dafc99d_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x1dafc99d, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__3c44a7ec_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3c44a7ec_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x3c44a7ec, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__fdb1042d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__594390b9_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdb1042d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xfdb1042d, "preVisitExprLet", 160 };
+TypeInfo * __type_info__5c6a7b2a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__594390b9_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5c6a7b2a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5c6a7b2a, "visitExprLet", 164 };
+TypeInfo * __type_info__634aedad_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__634aedad_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x634aedad, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__5fb47dee_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fb47dee_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x5fb47dee, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__293f40b_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__293f40b_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x293f40b, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__ef43c654_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ef43c654_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xef43c654, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__7c5a64dd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__594390b9_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c5a64dd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x7c5a64dd, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__d3542662_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__594390b9_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d3542662_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xd3542662, "visitGlobalLet", 188 };
+TypeInfo * __type_info__467d279d_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__467d279d_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x467d279d, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__d9bf5106_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d9bf5106_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xd9bf5106, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__3e63ea5b_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e63ea5b_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x3e63ea5b, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__800b5a7c_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__800b5a7c_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x800b5a7c, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__3675e444_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__594390b9_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3675e444_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3675e444, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__5a5cc58f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__594390b9_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5a5cc58f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5a5cc58f, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__c1788e8c_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c1788e8c_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xc1788e8c, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__b7b932b1_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b7b932b1_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xb7b932b1, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__c3f301a6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__594390b9_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3f301a6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc3f301a6, "preVisitExprNew", 224 };
+TypeInfo * __type_info__36741281_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__594390b9_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36741281_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x36741281, "visitExprNew", 228 };
+TypeInfo * __type_info__44366121_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44366121_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x44366121, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__739506d2_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__739506d2_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x739506d2, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__4bc8c441_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__594390b9_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4bc8c441_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4bc8c441, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__478163da_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__594390b9_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__478163da_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x478163da, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__c14c6b92_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c14c6b92_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xc14c6b92, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__bb6a8eb5_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__bb6a8eb5_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xbb6a8eb5, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__dff4c38b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__594390b9_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dff4c38b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xdff4c38b, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__b362672c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__594390b9_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b362672c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb362672c, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__5e07a948_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e07a948_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x5e07a948, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__5660644b_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5660644b_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x5660644b, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__ad984ec8_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__594390b9_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad984ec8_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xad984ec8, "preVisitExprCall", 272 };
+TypeInfo * __type_info__f3331ad9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__594390b9_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3331ad9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf3331ad9, "visitExprCall", 276 };
+TypeInfo * __type_info__9b754637_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b754637_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x9b754637, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__11e32aaa_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__11e32aaa_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x11e32aaa, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__54d32efd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__594390b9_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54d32efd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x54d32efd, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__96a68918_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__594390b9_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__96a68918_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x96a68918, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__4b4fe7d6_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b4fe7d6_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x4b4fe7d6, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__90c0d54d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__594390b9_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__90c0d54d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x90c0d54d, "preVisitExprAt", 300 };
+TypeInfo * __type_info__e7bacd18_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__594390b9_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e7bacd18_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe7bacd18, "visitExprAt", 304 };
+TypeInfo * __type_info__54e22933_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54e22933_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x54e22933, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__81b94a38_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__594390b9_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81b94a38_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x81b94a38, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__60de006d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__594390b9_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__60de006d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x60de006d, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__119de894_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__119de894_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x119de894, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__79ad2960_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__594390b9_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__79ad2960_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x79ad2960, "preVisitExprIs", 324 };
+TypeInfo * __type_info__decfd9a5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__594390b9_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__decfd9a5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xdecfd9a5, "visitExprIs", 328 };
+TypeInfo * __type_info__be2a6fa8_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__594390b9_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__be2a6fa8_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xbe2a6fa8, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__8556f5e7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__594390b9_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8556f5e7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8556f5e7, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__82d1f898_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__594390b9_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__82d1f898_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x82d1f898, "visitExprOp2", 340 };
+TypeInfo * __type_info__f75ab503_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f75ab503_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xf75ab503, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__8456f454_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__594390b9_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8456f454_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8456f454, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__83d1fa2b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__594390b9_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__83d1fa2b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x83d1fa2b, "visitExprOp3", 352 };
+TypeInfo * __type_info__91455af5_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__91455af5_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x91455af5, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__2ed13d0e_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2ed13d0e_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x2ed13d0e, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__9af1bd25_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__594390b9_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9af1bd25_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9af1bd25, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__445500f4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__594390b9_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__445500f4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x445500f4, "visitExprCopy", 368 };
+TypeInfo * __type_info__6d930425_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d930425_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x6d930425, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__58bae795_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__594390b9_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__58bae795_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x58bae795, "preVisitExprMove", 376 };
+TypeInfo * __type_info__573ce464_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__594390b9_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__573ce464_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x573ce464, "visitExprMove", 380 };
+TypeInfo * __type_info__de4214b5_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de4214b5_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xde4214b5, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__ae0ae045_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__594390b9_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae0ae045_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xae0ae045, "preVisitExprClone", 388 };
+TypeInfo * __type_info__357d2592_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__594390b9_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__357d2592_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x357d2592, "visitExprClone", 392 };
+TypeInfo * __type_info__ce0cc705_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ce0cc705_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xce0cc705, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__ad395960_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__594390b9_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad395960_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xad395960, "preVisitExprWith", 400 };
+TypeInfo * __type_info__cb6ac1d9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__594390b9_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb6ac1d9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcb6ac1d9, "visitExprWith", 404 };
+TypeInfo * __type_info__41877d4c_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41877d4c_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x41877d4c, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__96573bfd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__594390b9_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__96573bfd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x96573bfd, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__a6a4187e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__594390b9_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a6a4187e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa6a4187e, "visitExprWhile", 416 };
+TypeInfo * __type_info__f148368d_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f148368d_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xf148368d, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__6f9810e8_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__594390b9_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f9810e8_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6f9810e8, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__f64b3851_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__594390b9_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f64b3851_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf64b3851, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__44c09d0f_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44c09d0f_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x44c09d0f, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__f42804c5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__594390b9_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f42804c5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf42804c5, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__7143db7c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__594390b9_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7143db7c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x7143db7c, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__2ba37dc3_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2ba37dc3_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0x2ba37dc3, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__ded8f181_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ded8f181_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xded8f181, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__3f7204b7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__594390b9_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f7204b7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3f7204b7, "preVisitExprFor", 452 };
+TypeInfo * __type_info__b8539700_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__594390b9_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8539700_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb8539700, "visitExprFor", 456 };
+TypeInfo * __type_info__a606bd0b_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a606bd0b_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0xa606bd0b, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__3dd793a0_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3dd793a0_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x3dd793a0, "visitExprForVariable", 464 };
+TypeInfo * __type_info__61e3bc2_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__61e3bc2_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x61e3bc2, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__52c4fb65_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c4fb65_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x52c4fb65, "visitExprForSource", 472 };
+TypeInfo * __type_info__796330a9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__594390b9_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__796330a9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x796330a9, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__ddf3644f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__594390b9_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ddf3644f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xddf3644f, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__45850bb3_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__594390b9_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__45850bb3_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x45850bb3, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__95b7ed30_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__594390b9_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__95b7ed30_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x95b7ed30, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__2be9792d_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2be9792d_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x2be9792d, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__3bb172fc_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__3bb172fc_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x3bb172fc, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__ba18bc77_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__594390b9_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ba18bc77_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xba18bc77, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__2df2d13e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__594390b9_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2df2d13e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2df2d13e, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__3d13091d_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3d13091d_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x3d13091d, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__30ebe102_arg_types_var_1497600185[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__30ebe102_arg_types_var_1497600185, nullptr, 4, 0, nullptr, 28, 0x30ebe102, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__f926b09_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f926b09_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0xf926b09, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__8a8dab8a_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__8a8dab8a_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x8a8dab8a, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__f9cf2773_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__594390b9_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f9cf2773_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf9cf2773, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__101f72bc_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__594390b9_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__101f72bc_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x101f72bc, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__62501a89_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__62501a89_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x62501a89, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__196b9af8_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__196b9af8_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x196b9af8, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__47c70cb4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__594390b9_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47c70cb4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x47c70cb4, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__a70808f7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__594390b9_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a70808f7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa70808f7, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__1f7641d0_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f7641d0_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0x1f7641d0, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__fd11ce9d_arg_types_var_1497600185[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__594390b9_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fd11ce9d_arg_types_var_1497600185, nullptr, 5, 0, nullptr, 28, 0xfd11ce9d, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__a4cb5e97_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__594390b9_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a4cb5e97_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa4cb5e97, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__b3b86d9e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__594390b9_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b3b86d9e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb3b86d9e, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__fed1c550_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fed1c550_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xfed1c550, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__cba8b9e_arg_types_var_1497600185[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__594390b9_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cba8b9e_arg_types_var_1497600185, nullptr, 3, 0, nullptr, 28, 0xcba8b9e, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__7b4fbbc_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__594390b9_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b4fbbc_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x7b4fbbc, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__6aa1322d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__594390b9_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6aa1322d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6aa1322d, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__ecab833d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__594390b9_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecab833d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xecab833d, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__194a43f6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__594390b9_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__194a43f6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x194a43f6, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__26ba0d6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__594390b9_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__26ba0d6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x26ba0d6, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__1353a6cd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__594390b9_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1353a6cd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x1353a6cd, "visitExprLabel", 592 };
+TypeInfo * __type_info__c53bf02b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__594390b9_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c53bf02b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc53bf02b, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__c8cb4bb6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__594390b9_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c8cb4bb6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc8cb4bb6, "visitExprGoto", 600 };
+TypeInfo * __type_info__84dba48a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__594390b9_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__84dba48a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x84dba48a, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__378d4331_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__594390b9_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__378d4331_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x378d4331, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__d67bb8c9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__594390b9_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d67bb8c9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xd67bb8c9, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__733e4d9a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__594390b9_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__733e4d9a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x733e4d9a, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__a5d0442b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__594390b9_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a5d0442b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa5d0442b, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__f3b14a02_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__594390b9_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3b14a02_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf3b14a02, "visitExprAddr", 624 };
+TypeInfo * __type_info__2fc4a32a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__594390b9_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2fc4a32a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2fc4a32a, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__3778a5ab_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__594390b9_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3778a5ab_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3778a5ab, "visitExprAssert", 632 };
+TypeInfo * __type_info__9371b2b4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__594390b9_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9371b2b4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9371b2b4, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__a682f19d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__594390b9_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a682f19d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa682f19d, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__4ad1a9fc_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__594390b9_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ad1a9fc_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4ad1a9fc, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__5ca65c07_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__594390b9_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5ca65c07_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5ca65c07, "visitExprQuote", 648 };
+TypeInfo * __type_info__17c70a5f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__594390b9_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17c70a5f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x17c70a5f, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__dcf3a848_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__594390b9_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dcf3a848_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xdcf3a848, "visitExprDebug", 656 };
+TypeInfo * __type_info__5d3a9968_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__594390b9_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5d3a9968_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5d3a9968, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__420fff5d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__594390b9_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__420fff5d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x420fff5d, "visitExprInvoke", 664 };
+TypeInfo * __type_info__4520562a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__594390b9_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4520562a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4520562a, "preVisitExprErase", 668 };
+TypeInfo * __type_info__c5b916e5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__594390b9_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5b916e5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc5b916e5, "visitExprErase", 672 };
+TypeInfo * __type_info__d6760da3_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__594390b9_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6760da3_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xd6760da3, "preVisitExprFind", 676 };
+TypeInfo * __type_info__1859d5ca_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__594390b9_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1859d5ca_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x1859d5ca, "visitExprFind", 680 };
+TypeInfo * __type_info__3d839277_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__594390b9_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3d839277_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3d839277, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__4b06762c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__594390b9_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4b06762c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4b06762c, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__b39af6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__594390b9_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b39af6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb39af6, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__b1386da7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__594390b9_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b1386da7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb1386da7, "visitExprAscend", 696 };
+TypeInfo * __type_info__a75b6f97_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__594390b9_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a75b6f97_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa75b6f97, "preVisitExprCast", 700 };
+TypeInfo * __type_info__91766fe_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__594390b9_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__91766fe_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x91766fe, "visitExprCast", 704 };
+TypeInfo * __type_info__6d992e73_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__594390b9_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d992e73_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6d992e73, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__2197791a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__594390b9_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2197791a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2197791a, "visitExprDelete", 712 };
+TypeInfo * __type_info__f54e1b09_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__594390b9_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f54e1b09_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf54e1b09, "preVisitExprVar", 716 };
+TypeInfo * __type_info__fb2bf28e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__594390b9_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fb2bf28e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xfb2bf28e, "visitExprVar", 720 };
+TypeInfo * __type_info__8e0c0304_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__594390b9_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8e0c0304_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8e0c0304, "preVisitExprField", 724 };
+TypeInfo * __type_info__2be9d377_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__594390b9_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2be9d377_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2be9d377, "visitExprField", 728 };
+TypeInfo * __type_info__ede60617_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__594390b9_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ede60617_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xede60617, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__c3f422a4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__594390b9_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3f422a4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc3f422a4, "visitExprSafeField", 736 };
+TypeInfo * __type_info__874370a6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__594390b9_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__874370a6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x874370a6, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__ed575131_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__594390b9_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ed575131_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xed575131, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__8cd25291_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__594390b9_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8cd25291_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8cd25291, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__69d06946_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__594390b9_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__69d06946_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x69d06946, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__b0e1eb49_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__594390b9_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b0e1eb49_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb0e1eb49, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__c5812bce_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__594390b9_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5812bce_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc5812bce, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__511d52e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__594390b9_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__511d52e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x511d52e, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__4ccbcfa9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__594390b9_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4ccbcfa9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x4ccbcfa9, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__8656f77a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__594390b9_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8656f77a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8656f77a, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__85d1fd51_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__594390b9_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85d1fd51_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x85d1fd51, "visitExprOp1", 776 };
+TypeInfo * __type_info__5011b17e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__594390b9_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5011b17e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5011b17e, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__94ce6e6f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__594390b9_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__94ce6e6f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x94ce6e6f, "visitExprReturn", 784 };
+TypeInfo * __type_info__54a06069_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__594390b9_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54a06069_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x54a06069, "preVisitExprYield", 788 };
+TypeInfo * __type_info__57306c1e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__594390b9_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57306c1e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x57306c1e, "visitExprYield", 792 };
+TypeInfo * __type_info__559acaa7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__594390b9_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__559acaa7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x559acaa7, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__928e0068_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__594390b9_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__928e0068_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x928e0068, "visitExprBreak", 800 };
+TypeInfo * __type_info__a7fc259_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__594390b9_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a7fc259_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa7fc259, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__352d5474_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__594390b9_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__352d5474_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x352d5474, "visitExprContinue", 808 };
+TypeInfo * __type_info__f210b1d7_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__594390b9_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f210b1d7_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf210b1d7, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__ff7833b0_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__594390b9_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ff7833b0_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xff7833b0, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__6fb374ef_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__594390b9_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fb374ef_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6fb374ef, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__f22e60c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__594390b9_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f22e60c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf22e60c, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__f2cb2b87_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__594390b9_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2cb2b87_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf2cb2b87, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__a6606d6c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__594390b9_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a6606d6c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xa6606d6c, "visitExprMemZero", 832 };
+TypeInfo * __type_info__8b6a9f2b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__594390b9_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b6a9f2b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8b6a9f2b, "preVisitExprConst", 836 };
+TypeInfo * __type_info__cade5a24_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__594390b9_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cade5a24_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcade5a24, "visitExprConst", 840 };
+TypeInfo * __type_info__1ec27b07_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__594390b9_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1ec27b07_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x1ec27b07, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__9f580f7e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__594390b9_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f580f7e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9f580f7e, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__2cad98de_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__594390b9_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2cad98de_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2cad98de, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__2da65b4b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__594390b9_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2da65b4b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x2da65b4b, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__37967b12_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__594390b9_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37967b12_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x37967b12, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__9ee37111_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__594390b9_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9ee37111_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9ee37111, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__1410ffd4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__594390b9_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1410ffd4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x1410ffd4, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__df05df3f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__594390b9_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__df05df3f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xdf05df3f, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__8ab1a3fb_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__594390b9_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8ab1a3fb_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8ab1a3fb, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__8d501176_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__594390b9_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8d501176_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8d501176, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__faaa0586_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__594390b9_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__faaa0586_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xfaaa0586, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__d4d095f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__594390b9_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4d095f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xd4d095f, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__736f3564_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__594390b9_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__736f3564_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x736f3564, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__ad3ee71d_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__594390b9_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad3ee71d_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xad3ee71d, "visitExprConstInt", 896 };
+TypeInfo * __type_info__e10f662_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__594390b9_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e10f662_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe10f662, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__e905eefd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__594390b9_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e905eefd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe905eefd, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__f10f7f5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__594390b9_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f10f7f5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf10f7f5, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__e805ed6a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__594390b9_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e805ed6a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe805ed6a, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__810ecf0_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__594390b9_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__810ecf0_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x810ecf0, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__e305e58b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__594390b9_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e305e58b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe305e58b, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__f41ae641_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__594390b9_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f41ae641_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf41ae641, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__c3c96e7c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__594390b9_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3c96e7c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc3c96e7c, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__3b423a60_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__594390b9_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b423a60_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3b423a60, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__f22f1843_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__594390b9_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f22f1843_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf22f1843, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__cf49df21_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__594390b9_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cf49df21_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcf49df21, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__8227ac2e_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__594390b9_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8227ac2e_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x8227ac2e, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__b60ead63_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__594390b9_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b60ead63_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb60ead63, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__bded52c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__594390b9_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bded52c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xbded52c, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__ea1ad683_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__594390b9_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea1ad683_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xea1ad683, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__cdc97e3a_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__594390b9_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cdc97e3a_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcdc97e3a, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__e91ad4f0_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__594390b9_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e91ad4f0_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe91ad4f0, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__cec97fcd_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__594390b9_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cec97fcd_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcec97fcd, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__f01adff5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__594390b9_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f01adff5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xf01adff5, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__c7c974c8_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__594390b9_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c7c974c8_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc7c974c8, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__e07b8340_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__594390b9_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e07b8340_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe07b8340, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__c77345a9_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__594390b9_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c77345a9_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xc77345a9, "visitExprConstRange", 984 };
+TypeInfo * __type_info__828df567_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__594390b9_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__828df567_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x828df567, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__d5066998_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__594390b9_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5066998_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xd5066998, "visitExprConstURange", 992 };
+TypeInfo * __type_info__266e7e8f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__594390b9_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__266e7e8f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x266e7e8f, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__e6aa9afc_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__594390b9_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6aa9afc_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xe6aa9afc, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__6c131e9f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__594390b9_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c131e9f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x6c131e9f, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__59632596_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__594390b9_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__59632596_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x59632596, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__cf194a57_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__594390b9_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cf194a57_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcf194a57, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__5b14412c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__594390b9_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b14412c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5b14412c, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__ce1948c4_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__594390b9_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ce1948c4_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xce1948c4, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__5c1442bf_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__594390b9_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5c1442bf_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5c1442bf, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__cd194731_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__594390b9_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd194731_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcd194731, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__59143e06_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__594390b9_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__59143e06_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x59143e06, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__bffe1ace_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__594390b9_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bffe1ace_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xbffe1ace, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__9e00bbc5_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__594390b9_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e00bbc5_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9e00bbc5, "visitExprConstString", 1040 };
+TypeInfo * __type_info__5a923ad6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__594390b9_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5a923ad6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5a923ad6, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__b8245979_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__594390b9_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8245979_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xb8245979, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__cd285638_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__594390b9_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd285638_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xcd285638, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__26515827_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__594390b9_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__26515827_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x26515827, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__ae4d5acf_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__594390b9_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae4d5acf_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xae4d5acf, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__9749ae66_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__594390b9_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9749ae66_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x9749ae66, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__41b3286b_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__594390b9_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41b3286b_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x41b3286b, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__363fb586_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__594390b9_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__363fb586_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x363fb586, "visitExprReader", 1072 };
+TypeInfo * __type_info__dd62e3b6_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__594390b9_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dd62e3b6_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0xdd62e3b6, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__5691e167_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__594390b9_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5691e167_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x5691e167, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__3d5bbe8c_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__594390b9_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3d5bbe8c_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x3d5bbe8c, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__62a97b6f_arg_types_var_1497600185[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__594390b9_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__62a97b6f_arg_types_var_1497600185, nullptr, 2, 0, nullptr, 28, 0x62a97b6f, "visitExprCallMacro", 1088 };
+VarInfo __struct_info__594390b9_field_272 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x26bad7f3, "variable", 1096 };
+VarInfo __struct_info__594390b9_field_273 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4cc49cff, "uses", 1104 };
+VarInfo __struct_info__594390b9_field_274 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2da1af8c, "appends", 1108 };
+VarInfo __struct_info__594390b9_field_275 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x90bd1c1d, "inBlock", 1112 };
+VarInfo __struct_info__594390b9_field_276 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd0bb76bd, "usesInBlock", 1116 };
+VarInfo __struct_info__594390b9_field_277 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x80104522, "hasJumps", 1120 };
+VarInfo * __struct_info__594390b9_fields[278] =  { &__struct_info__594390b9_field_0, &__struct_info__594390b9_field_1, &__struct_info__594390b9_field_2, &__struct_info__594390b9_field_3, &__struct_info__594390b9_field_4, &__struct_info__594390b9_field_5, &__struct_info__594390b9_field_6, &__struct_info__594390b9_field_7, &__struct_info__594390b9_field_8, &__struct_info__594390b9_field_9, &__struct_info__594390b9_field_10, &__struct_info__594390b9_field_11, &__struct_info__594390b9_field_12, &__struct_info__594390b9_field_13, &__struct_info__594390b9_field_14, &__struct_info__594390b9_field_15, &__struct_info__594390b9_field_16, &__struct_info__594390b9_field_17, &__struct_info__594390b9_field_18, &__struct_info__594390b9_field_19, &__struct_info__594390b9_field_20, &__struct_info__594390b9_field_21, &__struct_info__594390b9_field_22, &__struct_info__594390b9_field_23, &__struct_info__594390b9_field_24, &__struct_info__594390b9_field_25, &__struct_info__594390b9_field_26, &__struct_info__594390b9_field_27, &__struct_info__594390b9_field_28, &__struct_info__594390b9_field_29, &__struct_info__594390b9_field_30, &__struct_info__594390b9_field_31, &__struct_info__594390b9_field_32, &__struct_info__594390b9_field_33, &__struct_info__594390b9_field_34, &__struct_info__594390b9_field_35, &__struct_info__594390b9_field_36, &__struct_info__594390b9_field_37, &__struct_info__594390b9_field_38, &__struct_info__594390b9_field_39, &__struct_info__594390b9_field_40, &__struct_info__594390b9_field_41, &__struct_info__594390b9_field_42, &__struct_info__594390b9_field_43, &__struct_info__594390b9_field_44, &__struct_info__594390b9_field_45, &__struct_info__594390b9_field_46, &__struct_info__594390b9_field_47, &__struct_info__594390b9_field_48, &__struct_info__594390b9_field_49, &__struct_info__594390b9_field_50, &__struct_info__594390b9_field_51, &__struct_info__594390b9_field_52, &__struct_info__594390b9_field_53, &__struct_info__594390b9_field_54, &__struct_info__594390b9_field_55, &__struct_info__594390b9_field_56, &__struct_info__594390b9_field_57, &__struct_info__594390b9_field_58, &__struct_info__594390b9_field_59, &__struct_info__594390b9_field_60, &__struct_info__594390b9_field_61, &__struct_info__594390b9_field_62, &__struct_info__594390b9_field_63, &__struct_info__594390b9_field_64, &__struct_info__594390b9_field_65, &__struct_info__594390b9_field_66, &__struct_info__594390b9_field_67, &__struct_info__594390b9_field_68, &__struct_info__594390b9_field_69, &__struct_info__594390b9_field_70, &__struct_info__594390b9_field_71, &__struct_info__594390b9_field_72, &__struct_info__594390b9_field_73, &__struct_info__594390b9_field_74, &__struct_info__594390b9_field_75, &__struct_info__594390b9_field_76, &__struct_info__594390b9_field_77, &__struct_info__594390b9_field_78, &__struct_info__594390b9_field_79, &__struct_info__594390b9_field_80, &__struct_info__594390b9_field_81, &__struct_info__594390b9_field_82, &__struct_info__594390b9_field_83, &__struct_info__594390b9_field_84, &__struct_info__594390b9_field_85, &__struct_info__594390b9_field_86, &__struct_info__594390b9_field_87, &__struct_info__594390b9_field_88, &__struct_info__594390b9_field_89, &__struct_info__594390b9_field_90, &__struct_info__594390b9_field_91, &__struct_info__594390b9_field_92, &__struct_info__594390b9_field_93, &__struct_info__594390b9_field_94, &__struct_info__594390b9_field_95, &__struct_info__594390b9_field_96, &__struct_info__594390b9_field_97, &__struct_info__594390b9_field_98, &__struct_info__594390b9_field_99, &__struct_info__594390b9_field_100, &__struct_info__594390b9_field_101, &__struct_info__594390b9_field_102, &__struct_info__594390b9_field_103, &__struct_info__594390b9_field_104, &__struct_info__594390b9_field_105, &__struct_info__594390b9_field_106, &__struct_info__594390b9_field_107, &__struct_info__594390b9_field_108, &__struct_info__594390b9_field_109, &__struct_info__594390b9_field_110, &__struct_info__594390b9_field_111, &__struct_info__594390b9_field_112, &__struct_info__594390b9_field_113, &__struct_info__594390b9_field_114, &__struct_info__594390b9_field_115, &__struct_info__594390b9_field_116, &__struct_info__594390b9_field_117, &__struct_info__594390b9_field_118, &__struct_info__594390b9_field_119, &__struct_info__594390b9_field_120, &__struct_info__594390b9_field_121, &__struct_info__594390b9_field_122, &__struct_info__594390b9_field_123, &__struct_info__594390b9_field_124, &__struct_info__594390b9_field_125, &__struct_info__594390b9_field_126, &__struct_info__594390b9_field_127, &__struct_info__594390b9_field_128, &__struct_info__594390b9_field_129, &__struct_info__594390b9_field_130, &__struct_info__594390b9_field_131, &__struct_info__594390b9_field_132, &__struct_info__594390b9_field_133, &__struct_info__594390b9_field_134, &__struct_info__594390b9_field_135, &__struct_info__594390b9_field_136, &__struct_info__594390b9_field_137, &__struct_info__594390b9_field_138, &__struct_info__594390b9_field_139, &__struct_info__594390b9_field_140, &__struct_info__594390b9_field_141, &__struct_info__594390b9_field_142, &__struct_info__594390b9_field_143, &__struct_info__594390b9_field_144, &__struct_info__594390b9_field_145, &__struct_info__594390b9_field_146, &__struct_info__594390b9_field_147, &__struct_info__594390b9_field_148, &__struct_info__594390b9_field_149, &__struct_info__594390b9_field_150, &__struct_info__594390b9_field_151, &__struct_info__594390b9_field_152, &__struct_info__594390b9_field_153, &__struct_info__594390b9_field_154, &__struct_info__594390b9_field_155, &__struct_info__594390b9_field_156, &__struct_info__594390b9_field_157, &__struct_info__594390b9_field_158, &__struct_info__594390b9_field_159, &__struct_info__594390b9_field_160, &__struct_info__594390b9_field_161, &__struct_info__594390b9_field_162, &__struct_info__594390b9_field_163, &__struct_info__594390b9_field_164, &__struct_info__594390b9_field_165, &__struct_info__594390b9_field_166, &__struct_info__594390b9_field_167, &__struct_info__594390b9_field_168, &__struct_info__594390b9_field_169, &__struct_info__594390b9_field_170, &__struct_info__594390b9_field_171, &__struct_info__594390b9_field_172, &__struct_info__594390b9_field_173, &__struct_info__594390b9_field_174, &__struct_info__594390b9_field_175, &__struct_info__594390b9_field_176, &__struct_info__594390b9_field_177, &__struct_info__594390b9_field_178, &__struct_info__594390b9_field_179, &__struct_info__594390b9_field_180, &__struct_info__594390b9_field_181, &__struct_info__594390b9_field_182, &__struct_info__594390b9_field_183, &__struct_info__594390b9_field_184, &__struct_info__594390b9_field_185, &__struct_info__594390b9_field_186, &__struct_info__594390b9_field_187, &__struct_info__594390b9_field_188, &__struct_info__594390b9_field_189, &__struct_info__594390b9_field_190, &__struct_info__594390b9_field_191, &__struct_info__594390b9_field_192, &__struct_info__594390b9_field_193, &__struct_info__594390b9_field_194, &__struct_info__594390b9_field_195, &__struct_info__594390b9_field_196, &__struct_info__594390b9_field_197, &__struct_info__594390b9_field_198, &__struct_info__594390b9_field_199, &__struct_info__594390b9_field_200, &__struct_info__594390b9_field_201, &__struct_info__594390b9_field_202, &__struct_info__594390b9_field_203, &__struct_info__594390b9_field_204, &__struct_info__594390b9_field_205, &__struct_info__594390b9_field_206, &__struct_info__594390b9_field_207, &__struct_info__594390b9_field_208, &__struct_info__594390b9_field_209, &__struct_info__594390b9_field_210, &__struct_info__594390b9_field_211, &__struct_info__594390b9_field_212, &__struct_info__594390b9_field_213, &__struct_info__594390b9_field_214, &__struct_info__594390b9_field_215, &__struct_info__594390b9_field_216, &__struct_info__594390b9_field_217, &__struct_info__594390b9_field_218, &__struct_info__594390b9_field_219, &__struct_info__594390b9_field_220, &__struct_info__594390b9_field_221, &__struct_info__594390b9_field_222, &__struct_info__594390b9_field_223, &__struct_info__594390b9_field_224, &__struct_info__594390b9_field_225, &__struct_info__594390b9_field_226, &__struct_info__594390b9_field_227, &__struct_info__594390b9_field_228, &__struct_info__594390b9_field_229, &__struct_info__594390b9_field_230, &__struct_info__594390b9_field_231, &__struct_info__594390b9_field_232, &__struct_info__594390b9_field_233, &__struct_info__594390b9_field_234, &__struct_info__594390b9_field_235, &__struct_info__594390b9_field_236, &__struct_info__594390b9_field_237, &__struct_info__594390b9_field_238, &__struct_info__594390b9_field_239, &__struct_info__594390b9_field_240, &__struct_info__594390b9_field_241, &__struct_info__594390b9_field_242, &__struct_info__594390b9_field_243, &__struct_info__594390b9_field_244, &__struct_info__594390b9_field_245, &__struct_info__594390b9_field_246, &__struct_info__594390b9_field_247, &__struct_info__594390b9_field_248, &__struct_info__594390b9_field_249, &__struct_info__594390b9_field_250, &__struct_info__594390b9_field_251, &__struct_info__594390b9_field_252, &__struct_info__594390b9_field_253, &__struct_info__594390b9_field_254, &__struct_info__594390b9_field_255, &__struct_info__594390b9_field_256, &__struct_info__594390b9_field_257, &__struct_info__594390b9_field_258, &__struct_info__594390b9_field_259, &__struct_info__594390b9_field_260, &__struct_info__594390b9_field_261, &__struct_info__594390b9_field_262, &__struct_info__594390b9_field_263, &__struct_info__594390b9_field_264, &__struct_info__594390b9_field_265, &__struct_info__594390b9_field_266, &__struct_info__594390b9_field_267, &__struct_info__594390b9_field_268, &__struct_info__594390b9_field_269, &__struct_info__594390b9_field_270, &__struct_info__594390b9_field_271, &__struct_info__594390b9_field_272, &__struct_info__594390b9_field_273, &__struct_info__594390b9_field_274, &__struct_info__594390b9_field_275, &__struct_info__594390b9_field_276, &__struct_info__594390b9_field_277 };
+StructInfo __struct_info__594390b9 = {"StringUsesVisitor", __struct_info__594390b9_fields, 278, 1128, -1, nullptr, 0x594390b9 };
+VarInfo __struct_info__45b20104_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd9ad8517, "__rtti", 0 };
+TypeInfo * __type_info__2e85f57c_arg_types_var_1169293572[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__45b20104_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2e85f57c_arg_types_var_1169293572, nullptr, 1, 0, nullptr, 28, 0x2e85f57c, "__finalize", 8 };
+TypeInfo * __type_info__eab5aac4_arg_types_var_1169293572[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__45b20104_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__eab5aac4_arg_types_var_1169293572, nullptr, 3, 0, nullptr, 28, 0xeab5aac4, "apply", 12 };
+VarInfo * __struct_info__45b20104_fields[3] =  { &__struct_info__45b20104_field_0, &__struct_info__45b20104_field_1, &__struct_info__45b20104_field_2 };
+StructInfo __struct_info__45b20104 = {"StringBuilderInferMacro", __struct_info__45b20104_fields, 3, 16, -1, nullptr, 0x45b20104 };
+VarInfo __struct_info__d8299e85_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0d240, "__rtti", 0 };
+TypeInfo * __type_info__1c9914bb_arg_types_var_3626606213[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__d8299e85_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c9914bb_arg_types_var_3626606213, nullptr, 1, 0, nullptr, 28, 0x1c9914bb, "__finalize", 8 };
+TypeInfo * __type_info__e1345261_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1345261_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe1345261, "preVisitProgram", 12 };
+TypeInfo * __type_info__f902c2de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f902c2de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf902c2de, "visitProgram", 16 };
+TypeInfo * __type_info__6d3d92b1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d3d92b1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d3d92b1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__7acd6d0b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7acd6d0b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7acd6d0b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9edcbce_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9edcbce_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9edcbce, "visitTypeDecl", 28 };
+TypeInfo * __type_info__4c957b89_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c957b89_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x4c957b89, "preVisitAlias", 32 };
+TypeInfo * __type_info__2cbdc12a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2cbdc12a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x2cbdc12a, "visitAlias", 36 };
+TypeInfo * __type_info__7ea03b0a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ea03b0a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7ea03b0a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__7607b7d3_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7607b7d3_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x7607b7d3, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__a92f607e_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a92f607e_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa92f607e, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__134ae51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__134ae51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x134ae51, "visitEnumeration", 52 };
+TypeInfo * __type_info__327e2124_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__327e2124_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x327e2124, "preVisitStructure", 56 };
+TypeInfo * __type_info__c2ec29d8_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2ec29d8_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc2ec29d8, "preVisitStructureField", 60 };
+TypeInfo * __type_info__e4eb34d9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4eb34d9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xe4eb34d9, "visitStructureField", 64 };
+TypeInfo * __type_info__6c97d67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__6c97d67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c97d67, "visitStructure", 68 };
+TypeInfo * __type_info__7447bb4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7447bb4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7447bb4f, "preVisitFunction", 72 };
+TypeInfo * __type_info__c6bf2bd2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__c6bf2bd2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc6bf2bd2, "visitFunction", 76 };
+TypeInfo * __type_info__63a3eac_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63a3eac_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x63a3eac, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__5fa0ff2d_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fa0ff2d_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5fa0ff2d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__ad56015e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad56015e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad56015e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f4999d8b_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4999d8b_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf4999d8b, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__f25a787_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25a787_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25a787, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__d76915b6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d76915b6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd76915b6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af00471_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af00471_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaf00471, "preVisitExpression", 104 };
+TypeInfo * __type_info__a246be3c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a246be3c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa246be3c, "visitExpression", 108 };
+TypeInfo * __type_info__2c383e55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c383e55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2c383e55, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__7a87bd0e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a87bd0e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7a87bd0e, "visitExprBlock", 116 };
+TypeInfo * __type_info__dc873d46_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc873d46_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdc873d46, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__f891e8e9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f891e8e9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf891e8e9, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5bede5bc_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5bede5bc_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5bede5bc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__4a66add7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4a66add7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4a66add7, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__b35acbb_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35acbb_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb35acbb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__d6c089cc_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6c089cc_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xd6c089cc, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__6fc12b47_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fc12b47_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6fc12b47, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__8644430a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8644430a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8644430a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__fde3ac29_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde3ac29_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xfde3ac29, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__89631998_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89631998_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x89631998, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__bd3bde81_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd3bde81_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbd3bde81, "preVisitExprLet", 160 };
+TypeInfo * __type_info__1c56de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c56de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c56de, "visitExprLet", 164 };
+TypeInfo * __type_info__4ea380c9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ea380c9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4ea380c9, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__d7a0c00a_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d7a0c00a_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xd7a0c00a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__dcd95cf7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcd95cf7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdcd95cf7, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__5e90f2e0_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e90f2e0_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5e90f2e0, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__284e759_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__284e759_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x284e759, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__554a21ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__554a21ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x554a21ae, "visitGlobalLet", 188 };
+TypeInfo * __type_info__a6016d01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6016d01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa6016d01, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__3b14171a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3b14171a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3b14171a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__78bcb4df_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bcb4df_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x78bcb4df, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__6521e890_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6521e890_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x6521e890, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__aefafc88_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aefafc88_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaefafc88, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__75c92fd3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__75c92fd3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x75c92fd3, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__6eaa7d50_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eaa7d50_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6eaa7d50, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ad5a0405_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad5a0405_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad5a0405, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__9356e5ba_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9356e5ba_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9356e5ba, "preVisitExprNew", 224 };
+TypeInfo * __type_info__c84acfc5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c84acfc5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc84acfc5, "visitExprNew", 228 };
+TypeInfo * __type_info__a9b0cc55_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b0cc55_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa9b0cc55, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__7cfe7756_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7cfe7756_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x7cfe7756, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__915be3cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__915be3cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x915be3cd, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__85473ce6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85473ce6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x85473ce6, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__345035e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__345035e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x345035e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__c053d161_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c053d161_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc053d161, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__359e840f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__359e840f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x359e840f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__c32d1370_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c32d1370_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc32d1370, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__31003f6c_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31003f6c_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x31003f6c, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__442b5d7f_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__442b5d7f_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x442b5d7f, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__11aeae1c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11aeae1c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x11aeae1c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__2965e55d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2965e55d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2965e55d, "visitExprCall", 276 };
+TypeInfo * __type_info__cdf950db_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf950db_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xcdf950db, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__a343220e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a343220e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa343220e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__ac29e6b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac29e6b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac29e6b9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__2663c954_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2663c954_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2663c954, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__f3715aaa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3715aaa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf3715aaa, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__bb163ec9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bb163ec9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbb163ec9, "preVisitExprAt", 300 };
+TypeInfo * __type_info__888bf034_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__888bf034_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x888bf034, "visitExprAt", 304 };
+TypeInfo * __type_info__43f7c55f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f7c55f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x43f7c55f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__aff78d24_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aff78d24_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaff78d24, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__880f2249_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__880f2249_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x880f2249, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__e1903c80_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1903c80_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xe1903c80, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__cc02d1d4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc02d1d4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcc02d1d4, "preVisitExprIs", 324 };
+TypeInfo * __type_info__7776bab9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7776bab9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7776bab9, "visitExprIs", 328 };
+TypeInfo * __type_info__3cb36c5c_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3cb36c5c_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3cb36c5c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__3f48a4eb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f48a4eb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f48a4eb, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9e9818ec_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e9818ec_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9e9818ec, "visitExprOp2", 340 };
+TypeInfo * __type_info__b7d4d4bf_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7d4d4bf_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb7d4d4bf, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__3e48a358_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e48a358_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3e48a358, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9f981a7f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f981a7f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9f981a7f, "visitExprOp3", 352 };
+TypeInfo * __type_info__eee3bc09_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eee3bc09_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xeee3bc09, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__f2f1d3aa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2f1d3aa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf2f1d3aa, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__c3059e01_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3059e01_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc3059e01, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__3bbe5820_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3bbe5820_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3bbe5820, "visitExprCopy", 368 };
+TypeInfo * __type_info__a0ecfbb9_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ecfbb9_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa0ecfbb9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__215e3c49_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__215e3c49_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x215e3c49, "preVisitExprMove", 376 };
+TypeInfo * __type_info__8f4c9038_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f4c9038_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f4c9038, "visitExprMove", 380 };
+TypeInfo * __type_info__98dc5351_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98dc5351_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x98dc5351, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__17b491_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17b491_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x17b491, "preVisitExprClone", 388 };
+TypeInfo * __type_info__1ad4800e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ad4800e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1ad4800e, "visitExprClone", 392 };
+TypeInfo * __type_info__b08b6929_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b08b6929_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb08b6929, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__f2348094_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2348094_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf2348094, "preVisitExprWith", 400 };
+TypeInfo * __type_info__f3ae166d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3ae166d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf3ae166d, "visitExprWith", 404 };
+TypeInfo * __type_info__f1675330_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1675330_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf1675330, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__92e3d111_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92e3d111_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x92e3d111, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__cafe3512_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cafe3512_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcafe3512, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed636a01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed636a01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xed636a01, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__25c0eaac_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c0eaac_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x25c0eaac, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__90a51465_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90a51465_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x90a51465, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__169d2283_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__169d2283_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x169d2283, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__8965dfd1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8965dfd1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8965dfd1, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__757540b8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__757540b8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x757540b8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__7705b54f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7705b54f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x7705b54f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__97b1c4ed_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97b1c4ed_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x97b1c4ed, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e95012d3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e95012d3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe95012d3, "preVisitExprFor", 452 };
+TypeInfo * __type_info__344d19dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__344d19dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x344d19dc, "visitExprFor", 456 };
+TypeInfo * __type_info__6c164ebf_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c164ebf_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6c164ebf, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__56569ad4_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__56569ad4_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x56569ad4, "visitExprForVariable", 464 };
+TypeInfo * __type_info__12214d06_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12214d06_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x12214d06, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__64f4b569_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64f4b569_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x64f4b569, "visitExprForSource", 472 };
+TypeInfo * __type_info__10bf88c5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10bf88c5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x10bf88c5, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__6dbb285b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6dbb285b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6dbb285b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__717f8e67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__717f8e67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x717f8e67, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__e6a0bda4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6a0bda4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe6a0bda4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__c35127d9_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c35127d9_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc35127d9, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__aa30df58_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__aa30df58_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xaa30df58, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__67cfaaa3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67cfaaa3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x67cfaaa3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__23fa073a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23fa073a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x23fa073a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__a74c85b9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a74c85b9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa74c85b9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__88bd350e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88bd350e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x88bd350e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__35e4f53d_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35e4f53d_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x35e4f53d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__83d50dee_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__83d50dee_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x83d50dee, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__6d5c4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d5c4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d5c4cbf, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__52c5da8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c5da8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52c5da8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__e8005be5_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8005be5_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xe8005be5, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__a216b644_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a216b644_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa216b644, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8b73a850_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b73a850_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8b73a850, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__955e0b53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__955e0b53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x955e0b53, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cc0f5e2c_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc0f5e2c_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xcc0f5e2c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__c9d28329_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9d28329_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc9d28329, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__e4dec3a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4dec3a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe4dec3a3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__12c1f55a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12c1f55a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x12c1f55a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__b69afd24_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69afd24_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb69afd24, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__491e734a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__491e734a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x491e734a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__d6bd6ae8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6bd6ae8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6bd6ae8, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__1bbde4e9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1bbde4e9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1bbde4e9, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__f25fabc1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25fabc1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25fabc1, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__546203a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__546203a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x546203a, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e85d642a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e85d642a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe85d642a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__919eabb1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__919eabb1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x919eabb1, "visitExprLabel", 592 };
+TypeInfo * __type_info__94bb64af_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94bb64af_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x94bb64af, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__fcdb84a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcdb84a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfcdb84a, "visitExprGoto", 600 };
+TypeInfo * __type_info__ebd6bd76_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebd6bd76_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xebd6bd76, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__754e508d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__754e508d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x754e508d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__e3083f3d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3083f3d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe3083f3d, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__fdcc980e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdcc980e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfdcc980e, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__822a0a6f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__822a0a6f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x822a0a6f, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__36bf6516_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36bf6516_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x36bf6516, "visitExprAddr", 624 };
+TypeInfo * __type_info__b632464e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b632464e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb632464e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__171280cf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__171280cf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x171280cf, "visitExprAssert", 632 };
+TypeInfo * __type_info__9cd677e8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd677e8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd677e8, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__3faadbe1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3faadbe1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3faadbe1, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__7df46418_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7df46418_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7df46418, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__24d03a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__24d03a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x24d03a3, "visitExprQuote", 648 };
+TypeInfo * __type_info__3021cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3021cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3021cb, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__db853894_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db853894_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb853894, "visitExprDebug", 656 };
+TypeInfo * __type_info__a42b136c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a42b136c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa42b136c, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__ae8d05f1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae8d05f1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xae8d05f1, "visitExprInvoke", 664 };
+TypeInfo * __type_info__5afbb756_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5afbb756_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5afbb756, "preVisitExprErase", 668 };
+TypeInfo * __type_info__a433d831_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433d831_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa433d831, "visitExprErase", 672 };
+TypeInfo * __type_info__89b1ed2f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89b1ed2f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89b1ed2f, "preVisitExprFind", 676 };
+TypeInfo * __type_info__ba5333e6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5333e6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba5333e6, "visitExprFind", 680 };
+TypeInfo * __type_info__9d59dc9b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d59dc9b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9d59dc9b, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__5532d30_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5532d30_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5532d30, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__ac1f0992_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac1f0992_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac1f0992, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__d676fdc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d676fdc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd676fdc3, "visitExprAscend", 696 };
+TypeInfo * __type_info__fbd35c53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbd35c53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfbd35c53, "preVisitExprCast", 700 };
+TypeInfo * __type_info__3f5db93a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3f5db93a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f5db93a, "visitExprCast", 704 };
+TypeInfo * __type_info__e9e73a57_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9e73a57_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe9e73a57, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__5b5aed7e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b5aed7e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5b5aed7e, "visitExprDelete", 712 };
+TypeInfo * __type_info__31ca940d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31ca940d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x31ca940d, "preVisitExprVar", 716 };
+TypeInfo * __type_info__64bce7f2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64bce7f2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x64bce7f2, "visitExprVar", 720 };
+TypeInfo * __type_info__490512e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__490512e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x490512e0, "preVisitExprField", 724 };
+TypeInfo * __type_info__cb496173_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb496173_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb496173, "visitExprField", 728 };
+TypeInfo * __type_info__afac4da3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afac4da3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafac4da3, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__c2023960_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c2023960_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc2023960, "visitExprSafeField", 736 };
+TypeInfo * __type_info__2f87634a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f87634a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f87634a, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__cbd679f5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbd679f5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcbd679f5, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__c93f0085_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93f0085_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc93f0085, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__c5f99f7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5f99f7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc5f99f7a, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__d15980dd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d15980dd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd15980dd, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__1fff0112_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1fff0112_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1fff0112, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__6f4d2d82_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4d2d82_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6f4d2d82, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__c4a28f5d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c4a28f5d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc4a28f5d, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__4048a67e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4048a67e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4048a67e, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__a1981da5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1981da5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa1981da5, "visitExprOp1", 776 };
+TypeInfo * __type_info__9cd84da2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd84da2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd84da2, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__e51104e3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e51104e3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe51104e3, "visitExprReturn", 784 };
+TypeInfo * __type_info__88b468bd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88b468bd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x88b468bd, "preVisitExprYield", 788 };
+TypeInfo * __type_info__b873b4e2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b873b4e2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb873b4e2, "visitExprYield", 792 };
+TypeInfo * __type_info__bac4281b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bac4281b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbac4281b, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__b8ba8abc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8ba8abc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb8ba8abc, "visitExprBreak", 800 };
+TypeInfo * __type_info__988afcfd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__988afcfd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x988afcfd, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__d11ed6d8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d11ed6d8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd11ed6d8, "visitExprContinue", 808 };
+TypeInfo * __type_info__80289013_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80289013_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80289013, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__c985a48c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c985a48c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc985a48c, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__37233ab_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37233ab_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x37233ab, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__6758a118_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6758a118_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6758a118, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__cea9756b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cea9756b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcea9756b, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__21f91cf0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21f91cf0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21f91cf0, "visitExprMemZero", 832 };
+TypeInfo * __type_info__827a7b9f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__827a7b9f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x827a7b9f, "preVisitExprConst", 836 };
+TypeInfo * __type_info__80719338_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80719338_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80719338, "visitExprConst", 840 };
+TypeInfo * __type_info__f1edd27b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1edd27b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf1edd27b, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__d4f9c662_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4f9c662_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd4f9c662, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__59a80c5a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59a80c5a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x59a80c5a, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__d561f037_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d561f037_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd561f037, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__319243ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319243ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x319243ae, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__f502f93d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f502f93d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf502f93d, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__35133e98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35133e98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35133e98, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__8f9f8e93_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f9f8e93_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f9f8e93, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__2d3a4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d3a4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2d3a4cbf, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__cb3eecea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb3eecea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb3eecea, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__ad464f32_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad464f32_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xad464f32, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__cb50360b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb50360b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb50360b, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__dbe74630_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbe74630_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdbe74630, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__a80e5f39_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80e5f39_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa80e5f39, "visitExprConstInt", 896 };
+TypeInfo * __type_info__2f133526_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f133526_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f133526, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__999f9e51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__999f9e51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x999f9e51, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__301336b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__301336b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x301336b9, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__989f9cbe_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__989f9cbe_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x989f9cbe, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__3113384c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3113384c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3113384c, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__9b9fa177_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b9fa177_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b9fa177, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__c8e5f55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e5f55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc8e5f55, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__4bbc29e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bbc29e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4bbc29e0, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__35318804_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35318804_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35318804, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__a14c8807_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a14c8807_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa14c8807, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__3924c25d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3924c25d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3924c25d, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__21588a7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21588a7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21588a7a, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__1c524c4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c524c4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c524c4f, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__ba8cda98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba8cda98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba8cda98, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__128e68c7_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__128e68c7_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x128e68c7, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__55bc399e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55bc399e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x55bc399e, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__118e6734_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__118e6734_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x118e6734, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__56bc3b31_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__56bc3b31_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x56bc3b31, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__108e65a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__108e65a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x108e65a1, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__57bc3cc4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57bc3cc4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x57bc3cc4, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__7c486554_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c486554_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7c486554, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__d1222c0d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1222c0d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd1222c0d, "visitExprConstRange", 984 };
+TypeInfo * __type_info__21dc0f2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21dc0f2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21dc0f2b, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__9bd0e54c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bd0e54c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9bd0e54c, "visitExprConstURange", 992 };
+TypeInfo * __type_info__cfe854bb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe854bb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcfe854bb, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__52ff6128_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52ff6128_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52ff6128, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__9b78bd2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b78bd2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b78bd2b, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__14bcb702_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14bcb702_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x14bcb702, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__d811ae5b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d811ae5b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd811ae5b, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__d5146090_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5146090_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd5146090, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__d711acc8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d711acc8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd711acc8, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__d6146223_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6146223_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6146223, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__de11b7cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de11b7cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xde11b7cd, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__db146a02_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db146a02_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb146a02, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__6e97f0ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e97f0ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6e97f0ea, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__ea5d24a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5d24a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xea5d24a1, "visitExprConstString", 1040 };
+TypeInfo * __type_info__89e422d2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89e422d2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89e422d2, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__6c08a2e5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c08a2e5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c08a2e5, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__2af4d3dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2af4d3dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2af4d3dc, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__5fa7d37b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fa7d37b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5fa7d37b, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__ee0efbc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0efbc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xee0efbc3, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__afd807ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afd807ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafd807ea, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__f7387f87_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7387f87_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf7387f87, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__d62685b2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d62685b2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd62685b2, "visitExprReader", 1072 };
+TypeInfo * __type_info__ffd9fe3a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ffd9fe3a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xffd9fe3a, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__dfbb50cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbb50cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdfbb50cb, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__a10f6f08_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a10f6f08_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa10f6f08, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__9794b2fb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9794b2fb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9794b2fb, "visitExprCallMacro", 1088 };
+VarInfo * __struct_info__d8299e85_fields[272] =  { &__struct_info__d8299e85_field_0, &__struct_info__d8299e85_field_1, &__struct_info__d8299e85_field_2, &__struct_info__d8299e85_field_3, &__struct_info__d8299e85_field_4, &__struct_info__d8299e85_field_5, &__struct_info__d8299e85_field_6, &__struct_info__d8299e85_field_7, &__struct_info__d8299e85_field_8, &__struct_info__d8299e85_field_9, &__struct_info__d8299e85_field_10, &__struct_info__d8299e85_field_11, &__struct_info__d8299e85_field_12, &__struct_info__d8299e85_field_13, &__struct_info__d8299e85_field_14, &__struct_info__d8299e85_field_15, &__struct_info__d8299e85_field_16, &__struct_info__d8299e85_field_17, &__struct_info__d8299e85_field_18, &__struct_info__d8299e85_field_19, &__struct_info__d8299e85_field_20, &__struct_info__d8299e85_field_21, &__struct_info__d8299e85_field_22, &__struct_info__d8299e85_field_23, &__struct_info__d8299e85_field_24, &__struct_info__d8299e85_field_25, &__struct_info__d8299e85_field_26, &__struct_info__d8299e85_field_27, &__struct_info__d8299e85_field_28, &__struct_info__d8299e85_field_29, &__struct_info__d8299e85_field_30, &__struct_info__d8299e85_field_31, &__struct_info__d8299e85_field_32, &__struct_info__d8299e85_field_33, &__struct_info__d8299e85_field_34, &__struct_info__d8299e85_field_35, &__struct_info__d8299e85_field_36, &__struct_info__d8299e85_field_37, &__struct_info__d8299e85_field_38, &__struct_info__d8299e85_field_39, &__struct_info__d8299e85_field_40, &__struct_info__d8299e85_field_41, &__struct_info__d8299e85_field_42, &__struct_info__d8299e85_field_43, &__struct_info__d8299e85_field_44, &__struct_info__d8299e85_field_45, &__struct_info__d8299e85_field_46, &__struct_info__d8299e85_field_47, &__struct_info__d8299e85_field_48, &__struct_info__d8299e85_field_49, &__struct_info__d8299e85_field_50, &__struct_info__d8299e85_field_51, &__struct_info__d8299e85_field_52, &__struct_info__d8299e85_field_53, &__struct_info__d8299e85_field_54, &__struct_info__d8299e85_field_55, &__struct_info__d8299e85_field_56, &__struct_info__d8299e85_field_57, &__struct_info__d8299e85_field_58, &__struct_info__d8299e85_field_59, &__struct_info__d8299e85_field_60, &__struct_info__d8299e85_field_61, &__struct_info__d8299e85_field_62, &__struct_info__d8299e85_field_63, &__struct_info__d8299e85_field_64, &__struct_info__d8299e85_field_65, &__struct_info__d8299e85_field_66, &__struct_info__d8299e85_field_67, &__struct_info__d8299e85_field_68, &__struct_info__d8299e85_field_69, &__struct_info__d8299e85_field_70, &__struct_info__d8299e85_field_71, &__struct_info__d8299e85_field_72, &__struct_info__d8299e85_field_73, &__struct_info__d8299e85_field_74, &__struct_info__d8299e85_field_75, &__struct_info__d8299e85_field_76, &__struct_info__d8299e85_field_77, &__struct_info__d8299e85_field_78, &__struct_info__d8299e85_field_79, &__struct_info__d8299e85_field_80, &__struct_info__d8299e85_field_81, &__struct_info__d8299e85_field_82, &__struct_info__d8299e85_field_83, &__struct_info__d8299e85_field_84, &__struct_info__d8299e85_field_85, &__struct_info__d8299e85_field_86, &__struct_info__d8299e85_field_87, &__struct_info__d8299e85_field_88, &__struct_info__d8299e85_field_89, &__struct_info__d8299e85_field_90, &__struct_info__d8299e85_field_91, &__struct_info__d8299e85_field_92, &__struct_info__d8299e85_field_93, &__struct_info__d8299e85_field_94, &__struct_info__d8299e85_field_95, &__struct_info__d8299e85_field_96, &__struct_info__d8299e85_field_97, &__struct_info__d8299e85_field_98, &__struct_info__d8299e85_field_99, &__struct_info__d8299e85_field_100, &__struct_info__d8299e85_field_101, &__struct_info__d8299e85_field_102, &__struct_info__d8299e85_field_103, &__struct_info__d8299e85_field_104, &__struct_info__d8299e85_field_105, &__struct_info__d8299e85_field_106, &__struct_info__d8299e85_field_107, &__struct_info__d8299e85_field_108, &__struct_info__d8299e85_field_109, &__struct_info__d8299e85_field_110, &__struct_info__d8299e85_field_111, &__struct_info__d8299e85_field_112, &__struct_info__d8299e85_field_113, &__struct_info__d8299e85_field_114, &__struct_info__d8299e85_field_115, &__struct_info__d8299e85_field_116, &__struct_info__d8299e85_field_117, &__struct_info__d8299e85_field_118, &__struct_info__d8299e85_field_119, &__struct_info__d8299e85_field_120, &__struct_info__d8299e85_field_121, &__struct_info__d8299e85_field_122, &__struct_info__d8299e85_field_123, &__struct_info__d8299e85_field_124, &__struct_info__d8299e85_field_125, &__struct_info__d8299e85_field_126, &__struct_info__d8299e85_field_127, &__struct_info__d8299e85_field_128, &__struct_info__d8299e85_field_129, &__struct_info__d8299e85_field_130, &__struct_info__d8299e85_field_131, &__struct_info__d8299e85_field_132, &__struct_info__d8299e85_field_133, &__struct_info__d8299e85_field_134, &__struct_info__d8299e85_field_135, &__struct_info__d8299e85_field_136, &__struct_info__d8299e85_field_137, &__struct_info__d8299e85_field_138, &__struct_info__d8299e85_field_139, &__struct_info__d8299e85_field_140, &__struct_info__d8299e85_field_141, &__struct_info__d8299e85_field_142, &__struct_info__d8299e85_field_143, &__struct_info__d8299e85_field_144, &__struct_info__d8299e85_field_145, &__struct_info__d8299e85_field_146, &__struct_info__d8299e85_field_147, &__struct_info__d8299e85_field_148, &__struct_info__d8299e85_field_149, &__struct_info__d8299e85_field_150, &__struct_info__d8299e85_field_151, &__struct_info__d8299e85_field_152, &__struct_info__d8299e85_field_153, &__struct_info__d8299e85_field_154, &__struct_info__d8299e85_field_155, &__struct_info__d8299e85_field_156, &__struct_info__d8299e85_field_157, &__struct_info__d8299e85_field_158, &__struct_info__d8299e85_field_159, &__struct_info__d8299e85_field_160, &__struct_info__d8299e85_field_161, &__struct_info__d8299e85_field_162, &__struct_info__d8299e85_field_163, &__struct_info__d8299e85_field_164, &__struct_info__d8299e85_field_165, &__struct_info__d8299e85_field_166, &__struct_info__d8299e85_field_167, &__struct_info__d8299e85_field_168, &__struct_info__d8299e85_field_169, &__struct_info__d8299e85_field_170, &__struct_info__d8299e85_field_171, &__struct_info__d8299e85_field_172, &__struct_info__d8299e85_field_173, &__struct_info__d8299e85_field_174, &__struct_info__d8299e85_field_175, &__struct_info__d8299e85_field_176, &__struct_info__d8299e85_field_177, &__struct_info__d8299e85_field_178, &__struct_info__d8299e85_field_179, &__struct_info__d8299e85_field_180, &__struct_info__d8299e85_field_181, &__struct_info__d8299e85_field_182, &__struct_info__d8299e85_field_183, &__struct_info__d8299e85_field_184, &__struct_info__d8299e85_field_185, &__struct_info__d8299e85_field_186, &__struct_info__d8299e85_field_187, &__struct_info__d8299e85_field_188, &__struct_info__d8299e85_field_189, &__struct_info__d8299e85_field_190, &__struct_info__d8299e85_field_191, &__struct_info__d8299e85_field_192, &__struct_info__d8299e85_field_193, &__struct_info__d8299e85_field_194, &__struct_info__d8299e85_field_195, &__struct_info__d8299e85_field_196, &__struct_info__d8299e85_field_197, &__struct_info__d8299e85_field_198, &__struct_info__d8299e85_field_199, &__struct_info__d8299e85_field_200, &__struct_info__d8299e85_field_201, &__struct_info__d8299e85_field_202, &__struct_info__d8299e85_field_203, &__struct_info__d8299e85_field_204, &__struct_info__d8299e85_field_205, &__struct_info__d8299e85_field_206, &__struct_info__d8299e85_field_207, &__struct_info__d8299e85_field_208, &__struct_info__d8299e85_field_209, &__struct_info__d8299e85_field_210, &__struct_info__d8299e85_field_211, &__struct_info__d8299e85_field_212, &__struct_info__d8299e85_field_213, &__struct_info__d8299e85_field_214, &__struct_info__d8299e85_field_215, &__struct_info__d8299e85_field_216, &__struct_info__d8299e85_field_217, &__struct_info__d8299e85_field_218, &__struct_info__d8299e85_field_219, &__struct_info__d8299e85_field_220, &__struct_info__d8299e85_field_221, &__struct_info__d8299e85_field_222, &__struct_info__d8299e85_field_223, &__struct_info__d8299e85_field_224, &__struct_info__d8299e85_field_225, &__struct_info__d8299e85_field_226, &__struct_info__d8299e85_field_227, &__struct_info__d8299e85_field_228, &__struct_info__d8299e85_field_229, &__struct_info__d8299e85_field_230, &__struct_info__d8299e85_field_231, &__struct_info__d8299e85_field_232, &__struct_info__d8299e85_field_233, &__struct_info__d8299e85_field_234, &__struct_info__d8299e85_field_235, &__struct_info__d8299e85_field_236, &__struct_info__d8299e85_field_237, &__struct_info__d8299e85_field_238, &__struct_info__d8299e85_field_239, &__struct_info__d8299e85_field_240, &__struct_info__d8299e85_field_241, &__struct_info__d8299e85_field_242, &__struct_info__d8299e85_field_243, &__struct_info__d8299e85_field_244, &__struct_info__d8299e85_field_245, &__struct_info__d8299e85_field_246, &__struct_info__d8299e85_field_247, &__struct_info__d8299e85_field_248, &__struct_info__d8299e85_field_249, &__struct_info__d8299e85_field_250, &__struct_info__d8299e85_field_251, &__struct_info__d8299e85_field_252, &__struct_info__d8299e85_field_253, &__struct_info__d8299e85_field_254, &__struct_info__d8299e85_field_255, &__struct_info__d8299e85_field_256, &__struct_info__d8299e85_field_257, &__struct_info__d8299e85_field_258, &__struct_info__d8299e85_field_259, &__struct_info__d8299e85_field_260, &__struct_info__d8299e85_field_261, &__struct_info__d8299e85_field_262, &__struct_info__d8299e85_field_263, &__struct_info__d8299e85_field_264, &__struct_info__d8299e85_field_265, &__struct_info__d8299e85_field_266, &__struct_info__d8299e85_field_267, &__struct_info__d8299e85_field_268, &__struct_info__d8299e85_field_269, &__struct_info__d8299e85_field_270, &__struct_info__d8299e85_field_271 };
+StructInfo __struct_info__d8299e85 = {"AstVisitor", __struct_info__d8299e85_fields, 272, 1096, -1, nullptr, 0xd8299e85 };
+VarInfo __struct_info__b118e316_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc5982fb5, "__rtti", 0 };
+TypeInfo * __type_info__c30b8832_arg_types_var_2971198230[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__b118e316_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c30b8832_arg_types_var_2971198230, nullptr, 1, 0, nullptr, 28, 0xc30b8832, "__finalize", 8 };
+TypeInfo * __type_info__60029dc6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__b118e316_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__60029dc6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x60029dc6, "preVisitProgram", 12 };
+TypeInfo * __type_info__b29b802f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__b118e316_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b29b802f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb29b802f, "visitProgram", 16 };
+TypeInfo * __type_info__14a4fd9a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__b118e316_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__14a4fd9a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x14a4fd9a, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__6d26ed46_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__b118e316_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d26ed46_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x6d26ed46, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__83e25011_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__b118e316_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__83e25011_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x83e25011, "visitTypeDecl", 28 };
+TypeInfo * __type_info__78c64552_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__b118e316_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78c64552_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x78c64552, "preVisitAlias", 32 };
+TypeInfo * __type_info__3762d4b_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__b118e316_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__3762d4b_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x3762d4b, "visitAlias", 36 };
+TypeInfo * __type_info__9c54bd69_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__b118e316_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9c54bd69_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x9c54bd69, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__4983afb6_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4983afb6_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x4983afb6, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__e89ddc79_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e89ddc79_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0xe89ddc79, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__344e37a8_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__b118e316_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__344e37a8_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x344e37a8, "visitEnumeration", 52 };
+TypeInfo * __type_info__f7e372f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__b118e316_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7e372f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf7e372f, "preVisitStructure", 56 };
+TypeInfo * __type_info__f0608851_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f0608851_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xf0608851, "preVisitStructureField", 60 };
+TypeInfo * __type_info__473ba58e_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__473ba58e_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x473ba58e, "visitStructureField", 64 };
+TypeInfo * __type_info__b30e1f1a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__b118e316_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__b30e1f1a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb30e1f1a, "visitStructure", 68 };
+TypeInfo * __type_info__5a748d0a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__b118e316_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5a748d0a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x5a748d0a, "preVisitFunction", 72 };
+TypeInfo * __type_info__eaaaeb7d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__b118e316_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__eaaaeb7d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xeaaaeb7d, "visitFunction", 76 };
+TypeInfo * __type_info__25c3c845_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c3c845_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x25c3c845, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__c8c09fee_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__c8c09fee_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xc8c09fee, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__f76d7213_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f76d7213_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xf76d7213, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__bd700854_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bd700854_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xbd700854, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__bd0887ee_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__b118e316_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd0887ee_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xbd0887ee, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__4d075e0d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__b118e316_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4d075e0d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4d075e0d, "visitFunctionBody", 100 };
+TypeInfo * __type_info__1cd5d134_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1cd5d134_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1cd5d134, "preVisitExpression", 104 };
+TypeInfo * __type_info__b1553d6f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b1553d6f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb1553d6f, "visitExpression", 108 };
+TypeInfo * __type_info__ff29c4d6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__b118e316_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ff29c4d6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xff29c4d6, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__b9e254cf_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__b118e316_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b9e254cf_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb9e254cf, "visitExprBlock", 116 };
+TypeInfo * __type_info__54ca8c71_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54ca8c71_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x54ca8c71, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__79e882c_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__79e882c_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x79e882c, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__7d03a26f_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7d03a26f_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x7d03a26f, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__151562de_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__151562de_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x151562de, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__59f74814_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59f74814_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x59f74814, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__2703f731_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2703f731_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x2703f731, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__f6c265d2_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__b118e316_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f6c265d2_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf6c265d2, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__166afcb5_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__b118e316_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__166afcb5_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x166afcb5, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__49495ba0_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49495ba0_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x49495ba0, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__2fa44db_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2fa44db_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x2fa44db, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__538c74c6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__b118e316_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__538c74c6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x538c74c6, "preVisitExprLet", 160 };
+TypeInfo * __type_info__a84b333_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__b118e316_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a84b333_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xa84b333, "visitExprLet", 164 };
+TypeInfo * __type_info__bfecfd12_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bfecfd12_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xbfecfd12, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__366f67df_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__366f67df_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x366f67df, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__957cb118_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__957cb118_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x957cb118, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__29eae2f9_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__29eae2f9_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x29eae2f9, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__7cdfb396_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__b118e316_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7cdfb396_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7cdfb396, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__e30c055b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__b118e316_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e30c055b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe30c055b, "visitGlobalLet", 188 };
+TypeInfo * __type_info__831b2e2_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__831b2e2_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x831b2e2, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__a9fc8627_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__a9fc8627_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xa9fc8627, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__cff43f48_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cff43f48_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xcff43f48, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__100c0cd1_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__100c0cd1_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x100c0cd1, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__5f62826b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__b118e316_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5f62826b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x5f62826b, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__cbb05f82_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__b118e316_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbb05f82_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xcbb05f82, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__b69c599d_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69c599d_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xb69c599d, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__4f96c95a_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4f96c95a_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x4f96c95a, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__3bbb200d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__b118e316_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3bbb200d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x3bbb200d, "preVisitExprNew", 224 };
+TypeInfo * __type_info__42411f94_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__b118e316_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__42411f94_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x42411f94, "visitExprNew", 228 };
+TypeInfo * __type_info__cc9b509e_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc9b509e_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xcc9b509e, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__d422eeb3_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d422eeb3_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xd422eeb3, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__1a4b915e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__b118e316_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1a4b915e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1a4b915e, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__e87a3b5f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__b118e316_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e87a3b5f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe87a3b5f, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__4b34a199_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b34a199_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x4b34a199, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__246cf71c_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__246cf71c_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x246cf71c, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__ea6f8438_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__b118e316_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea6f8438_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xea6f8438, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__992fa949_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__b118e316_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__992fa949_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x992fa949, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__b7494507_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7494507_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xb7494507, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__ae3b95fa_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae3b95fa_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xae3b95fa, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__4c7eed65_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__b118e316_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c7eed65_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4c7eed65, "preVisitExprCall", 272 };
+TypeInfo * __type_info__ff331fae_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__b118e316_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ff331fae_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xff331fae, "visitExprCall", 276 };
+TypeInfo * __type_info__3c5f73b6_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3c5f73b6_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x3c5f73b6, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__71f36749_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__71f36749_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x71f36749, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__f5f883ac_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__b118e316_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f5f883ac_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf5f883ac, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__d1207c3b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__b118e316_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1207c3b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd1207c3b, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__4aed1461_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4aed1461_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x4aed1461, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__f696d6dc_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__b118e316_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f696d6dc_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf696d6dc, "preVisitExprAt", 300 };
+TypeInfo * __type_info__4d12b99f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__b118e316_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4d12b99f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4d12b99f, "visitExprAt", 304 };
+TypeInfo * __type_info__33f0ad8_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__33f0ad8_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x33f0ad8, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__ab5a44b1_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__b118e316_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ab5a44b1_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xab5a44b1, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__17e9d7b2_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__b118e316_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__17e9d7b2_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x17e9d7b2, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__872e6207_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__872e6207_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x872e6207, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__5aa7631_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__b118e316_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5aa7631_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x5aa7631, "preVisitExprIs", 324 };
+TypeInfo * __type_info__59ff465e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__b118e316_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__59ff465e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x59ff465e, "visitExprIs", 328 };
+TypeInfo * __type_info__fdb098f9_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__b118e316_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fdb098f9_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xfdb098f9, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__12086934_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__b118e316_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12086934_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x12086934, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__f408343d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__b118e316_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f408343d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf408343d, "visitExprOp2", 340 };
+TypeInfo * __type_info__cd0ec02e_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd0ec02e_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xcd0ec02e, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__13086ac7_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__b118e316_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__13086ac7_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x13086ac7, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__f30832aa_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__b118e316_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f30832aa_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf30832aa, "visitExprOp3", 352 };
+TypeInfo * __type_info__d534974e_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d534974e_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xd534974e, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__28a7a1a3_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__28a7a1a3_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x28a7a1a3, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__2ccba128_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__b118e316_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2ccba128_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2ccba128, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__62720897_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__b118e316_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__62720897_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x62720897, "visitExprCopy", 368 };
+TypeInfo * __type_info__ae25b4da_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae25b4da_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xae25b4da, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__85d8eec0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__b118e316_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__85d8eec0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x85d8eec0, "preVisitExprMove", 376 };
+TypeInfo * __type_info__70c1cc07_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__b118e316_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__70c1cc07_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x70c1cc07, "visitExprMove", 380 };
+TypeInfo * __type_info__5acd7362_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5acd7362_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x5acd7362, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__4ab62df6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__b118e316_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ab62df6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4ab62df6, "preVisitExprClone", 388 };
+TypeInfo * __type_info__d98b46cf_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__b118e316_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d98b46cf_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd98b46cf, "visitExprClone", 392 };
+TypeInfo * __type_info__c2eeb99c_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2eeb99c_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xc2eeb99c, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__61c4f875_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__b118e316_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__61c4f875_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x61c4f875, "preVisitExprWith", 400 };
+TypeInfo * __type_info__eecab256_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__b118e316_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eecab256_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xeecab256, "visitExprWith", 404 };
+TypeInfo * __type_info__13866865_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__13866865_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x13866865, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__abf58f1a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__b118e316_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__abf58f1a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xabf58f1a, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__7d53688f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__b118e316_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7d53688f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7d53688f, "visitExprWhile", 416 };
+TypeInfo * __type_info__5396d89e_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5396d89e_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x5396d89e, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__d57edbad_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__b118e316_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d57edbad_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd57edbad, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__fcda34de_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__b118e316_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcda34de_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfcda34de, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__954cb34_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__954cb34_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x954cb34, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__628ea540_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__b118e316_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__628ea540_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x628ea540, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__f705308b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__b118e316_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f705308b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf705308b, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__94a09ba8_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94a09ba8_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x94a09ba8, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__66b00e6_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66b00e6_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x66b00e6, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__d79e7204_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__b118e316_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d79e7204_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd79e7204, "preVisitExprFor", 452 };
+TypeInfo * __type_info__95f18079_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__b118e316_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__95f18079_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x95f18079, "visitExprFor", 456 };
+TypeInfo * __type_info__90eb7c_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__90eb7c_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x90eb7c, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__9d99d2e1_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__9d99d2e1_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x9d99d2e1, "visitExprForVariable", 464 };
+TypeInfo * __type_info__5f2f34e1_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5f2f34e1_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x5f2f34e1, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__acfaa7e4_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__acfaa7e4_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0xacfaa7e4, "visitExprForSource", 472 };
+TypeInfo * __type_info__81c8526c_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__b118e316_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81c8526c_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x81c8526c, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__92752840_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__b118e316_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92752840_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x92752840, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__42ce82dc_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__b118e316_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__42ce82dc_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x42ce82dc, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__2af42b71_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__b118e316_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2af42b71_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2af42b71, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__369dc340_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__369dc340_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x369dc340, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__31d5ab9b_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__31d5ab9b_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x31d5ab9b, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__2ff2ace2_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__b118e316_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2ff2ace2_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2ff2ace2, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__6a71f159_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__b118e316_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6a71f159_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x6a71f159, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__95dd4ed6_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95dd4ed6_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x95dd4ed6, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__37d4a2f_arg_types_var_2971198230[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37d4a2f_arg_types_var_2971198230, nullptr, 4, 0, nullptr, 28, 0x37d4a2f, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__cfdad306_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfdad306_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0xcfdad306, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__3ff83933_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__3ff83933_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x3ff83933, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__f89ec7b0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__b118e316_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f89ec7b0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf89ec7b0, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__e1fb3a1d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__b118e316_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e1fb3a1d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe1fb3a1d, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__56377acc_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56377acc_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x56377acc, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__4816b343_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4816b343_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x4816b343, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__56bcea9b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__b118e316_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56bcea9b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x56bcea9b, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__e60e4b76_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__b118e316_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e60e4b76_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe60e4b76, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cd180571_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd180571_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0xcd180571, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__87023e3a_arg_types_var_2971198230[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__b118e316_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__87023e3a_arg_types_var_2971198230, nullptr, 5, 0, nullptr, 28, 0x87023e3a, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__8a242f22_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__b118e316_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8a242f22_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x8a242f22, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__d5e17945_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__b118e316_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5e17945_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd5e17945, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__592dbea7_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__592dbea7_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0x592dbea7, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__eb1915c9_arg_types_var_2971198230[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__b118e316_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eb1915c9_arg_types_var_2971198230, nullptr, 3, 0, nullptr, 28, 0xeb1915c9, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__4e1425f1_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__b118e316_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4e1425f1_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4e1425f1, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__c5b24592_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__b118e316_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5b24592_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc5b24592, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__c8e93312_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__b118e316_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e93312_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc8e93312, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__e123467b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__b118e316_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e123467b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe123467b, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__94ab01e9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__b118e316_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94ab01e9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x94ab01e9, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__80597070_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__b118e316_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80597070_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x80597070, "visitExprLabel", 592 };
+TypeInfo * __type_info__e4c43172_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__b118e316_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4c43172_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe4c43172, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__4e456461_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__b118e316_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4e456461_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4e456461, "visitExprGoto", 600 };
+TypeInfo * __type_info__20ad8d95_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__b118e316_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__20ad8d95_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x20ad8d95, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__7d377b00_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__b118e316_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7d377b00_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7d377b00, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__7cea0e86_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__b118e316_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7cea0e86_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7cea0e86, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__45aaaeef_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__b118e316_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__45aaaeef_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x45aaaeef, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__67d4de9e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__b118e316_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67d4de9e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x67d4de9e, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__3e740279_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__b118e316_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3e740279_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x3e740279, "visitExprAddr", 624 };
+TypeInfo * __type_info__da16dcf7_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__b118e316_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__da16dcf7_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xda16dcf7, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__fad05c90_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__b118e316_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fad05c90_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfad05c90, "visitExprAssert", 632 };
+TypeInfo * __type_info__818110d9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__b118e316_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__818110d9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x818110d9, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__87645f9a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__b118e316_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__87645f9a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x87645f9a, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__3b927f2b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__b118e316_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b927f2b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x3b927f2b, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__2756ee6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__b118e316_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2756ee6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2756ee6, "visitExprQuote", 648 };
+TypeInfo * __type_info__93e9ebcc_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__b118e316_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__93e9ebcc_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x93e9ebcc, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__6064e3fd_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__b118e316_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6064e3fd_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x6064e3fd, "visitExprDebug", 656 };
+TypeInfo * __type_info__24fb5919_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__b118e316_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__24fb5919_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x24fb5919, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__b8d8ebaa_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__b118e316_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8d8ebaa_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb8d8ebaa, "visitExprInvoke", 664 };
+TypeInfo * __type_info__1cc53c49_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__b118e316_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1cc53c49_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1cc53c49, "preVisitExprErase", 668 };
+TypeInfo * __type_info__5c110b60_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__b118e316_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5c110b60_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x5c110b60, "visitExprErase", 672 };
+TypeInfo * __type_info__db39b90e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__b118e316_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db39b90e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xdb39b90e, "preVisitExprFind", 676 };
+TypeInfo * __type_info__583ea0d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__b118e316_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__583ea0d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x583ea0d, "visitExprFind", 680 };
+TypeInfo * __type_info__3ffecf28_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__b118e316_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3ffecf28_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x3ffecf28, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__7c1369a9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__b118e316_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7c1369a9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7c1369a9, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__baf2663b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__b118e316_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__baf2663b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xbaf2663b, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__d4bc3e4c_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__b118e316_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4bc3e4c_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd4bc3e4c, "visitExprAscend", 696 };
+TypeInfo * __type_info__529f4a82_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__b118e316_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__529f4a82_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x529f4a82, "preVisitExprCast", 700 };
+TypeInfo * __type_info__e9263119_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__b118e316_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e9263119_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe9263119, "visitExprCast", 704 };
+TypeInfo * __type_info__107b07f6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__b118e316_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__107b07f6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x107b07f6, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__b4639ab5_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__b118e316_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b4639ab5_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb4639ab5, "visitExprDelete", 712 };
+TypeInfo * __type_info__a55b060a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__b118e316_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a55b060a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xa55b060a, "preVisitExprVar", 716 };
+TypeInfo * __type_info__7bafcd47_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__b118e316_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7bafcd47_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7bafcd47, "visitExprVar", 720 };
+TypeInfo * __type_info__ae0da28b_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__b118e316_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae0da28b_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xae0da28b, "preVisitExprField", 724 };
+TypeInfo * __type_info__1f5ab77e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__b118e316_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1f5ab77e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1f5ab77e, "visitExprField", 728 };
+TypeInfo * __type_info__9f8aff38_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__b118e316_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9f8aff38_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x9f8aff38, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__7b1613b9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__b118e316_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7b1613b9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7b1613b9, "visitExprSafeField", 736 };
+TypeInfo * __type_info__b7b543cd_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__b118e316_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7b543cd_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb7b543cd, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__36e5062c_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__b118e316_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36e5062c_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x36e5062c, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__665bd462_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__b118e316_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__665bd462_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x665bd462, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__968ac7df_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__b118e316_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__968ac7df_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x968ac7df, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__1fb7790a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__b118e316_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1fb7790a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1fb7790a, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__6ac59837_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__b118e316_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6ac59837_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x6ac59837, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__a01c9735_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__b118e316_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a01c9735_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xa01c9735, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__c881d8e4_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__b118e316_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c881d8e4_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc881d8e4, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__15086ded_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__b118e316_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__15086ded_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x15086ded, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__f1082f84_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__b118e316_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f1082f84_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf1082f84, "visitExprOp1", 776 };
+TypeInfo * __type_info__d27dcbbb_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__b118e316_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d27dcbbb_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd27dcbbb, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__61d16424_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__b118e316_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__61d16424_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x61d16424, "visitExprReturn", 784 };
+TypeInfo * __type_info__cdf358aa_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__b118e316_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf358aa_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xcdf358aa, "preVisitExprYield", 788 };
+TypeInfo * __type_info__d60d3d7_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__b118e316_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d60d3d7_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd60d3d7, "visitExprYield", 792 };
+TypeInfo * __type_info__d5abf604_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__b118e316_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d5abf604_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd5abf604, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__4d82b2d1_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__b118e316_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4d82b2d1_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4d82b2d1, "visitExprBreak", 800 };
+TypeInfo * __type_info__dc52480_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__b118e316_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc52480_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xdc52480, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__fd4fd2d3_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__b118e316_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fd4fd2d3_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfd4fd2d3, "visitExprContinue", 808 };
+TypeInfo * __type_info__77052b94_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__b118e316_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__77052b94_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x77052b94, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__f5374011_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__b118e316_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f5374011_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf5374011, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__7dbd0fd0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__b118e316_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7dbd0fd0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7dbd0fd0, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__f834845d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__b118e316_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f834845d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf834845d, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__876c3688_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__b118e316_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__876c3688_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x876c3688, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__2e243fb9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__b118e316_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2e243fb9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2e243fb9, "visitExprMemZero", 832 };
+TypeInfo * __type_info__759112d0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__b118e316_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__759112d0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x759112d0, "preVisitExprConst", 836 };
+TypeInfo * __type_info__dcad1b61_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__b118e316_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dcad1b61_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xdcad1b61, "visitExprConst", 840 };
+TypeInfo * __type_info__b8fe42a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__b118e316_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b8fe42a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb8fe42a, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__47406a85_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__b118e316_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__47406a85_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x47406a85, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__cd5e810f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__b118e316_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd5e810f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xcd5e810f, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__c1d2210_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__b118e316_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c1d2210_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc1d2210, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__b48a0505_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__b118e316_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b48a0505_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb48a0505, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__a433cf50_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__b118e316_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433cf50_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xa433cf50, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__ed7373bb_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__b118e316_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed7373bb_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xed7373bb, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__83dd3ae_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__b118e316_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__83dd3ae_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x83dd3ae, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__47a90452_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__b118e316_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47a90452_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x47a90452, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__9342d24d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__b118e316_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9342d24d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x9342d24d, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__47ba4d73_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__b118e316_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47ba4d73_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x47ba4d73, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__8f450a98_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__b118e316_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f450a98_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x8f450a98, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__ac98be01_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__b118e316_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac98be01_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xac98be01, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__6db16262_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__b118e316_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6db16262_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x6db16262, "visitExprConstInt", 896 };
+TypeInfo * __type_info__e7736a49_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__b118e316_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7736a49_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe7736a49, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__fe3dc3f0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__b118e316_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fe3dc3f0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfe3dc3f0, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__e67368b6_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__b118e316_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e67368b6_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe67368b6, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__ff3dc583_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__b118e316_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ff3dc583_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xff3dc583, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__e9736d6f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__b118e316_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9736d6f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe9736d6f, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__43dcd62_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__b118e316_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__43dcd62_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x43dcd62, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__120f37d8_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__b118e316_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__120f37d8_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x120f37d8, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__2b24fd47_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__b118e316_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2b24fd47_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2b24fd47, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__4de3ac7f_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__b118e316_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4de3ac7f_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4de3ac7f, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__ea247f1e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__b118e316_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea247f1e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xea247f1e, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__cdefaef2_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__b118e316_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdefaef2_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xcdefaef2, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__ea224087_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__b118e316_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea224087_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xea224087, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__b9ac2ff0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__b118e316_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b9ac2ff0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb9ac2ff0, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__fcf035c5_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__b118e316_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcf035c5_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfcf035c5, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__c0f2e66_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__b118e316_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c0f2e66_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc0f2e66, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__2524f3d5_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__b118e316_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2524f3d5_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2524f3d5, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__d0f2ff9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__b118e316_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d0f2ff9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd0f2ff9, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__2424f242_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__b118e316_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2424f242_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x2424f242, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__e0f318c_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__b118e316_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e0f318c_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xe0f318c, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__1f24ea63_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__b118e316_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1f24ea63_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1f24ea63, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__7e123485_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__b118e316_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e123485_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7e123485, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__edfe648e_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__b118e316_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__edfe648e_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xedfe648e, "visitExprConstRange", 984 };
+TypeInfo * __type_info__f1ef1f14_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__b118e316_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1ef1f14_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xf1ef1f14, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__c07311a1_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__b118e316_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c07311a1_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xc07311a1, "visitExprConstURange", 992 };
+TypeInfo * __type_info__fd67edf0_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__b118e316_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fd67edf0_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xfd67edf0, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__7acb55e1_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__b118e316_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7acb55e1_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7acb55e1, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__cc11d80a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__b118e316_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc11d80a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xcc11d80a, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__82663159_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__b118e316_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__82663159_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x82663159, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__78176028_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__b118e316_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78176028_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x78176028, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__b1dfcb71_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__b118e316_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b1dfcb71_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb1dfcb71, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__791761bb_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__b118e316_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__791761bb_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x791761bb, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__b0dfc9de_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__b118e316_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b0dfc9de_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb0dfc9de, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__7e17699a_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__b118e316_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e17699a_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7e17699a, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__b3dfce97_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__b118e316_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b3dfce97_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb3dfce97, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__4f23aa19_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__b118e316_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4f23aa19_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4f23aa19, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__89db21bc_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__b118e316_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89db21bc_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x89db21bc, "visitExprConstString", 1040 };
+TypeInfo * __type_info__d75efa1d_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__b118e316_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d75efa1d_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xd75efa1d, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__68c9f07c_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__b118e316_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__68c9f07c_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x68c9f07c, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__35f68313_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__b118e316_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35f68313_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x35f68313, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__b4140fe2_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__b118e316_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b4140fe2_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xb4140fe2, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__9fd1ce62_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__b118e316_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9fd1ce62_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x9fd1ce62, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__24fd55a9_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__b118e316_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__24fd55a9_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x24fd55a9, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__74bffcda_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__b118e316_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__74bffcda_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x74bffcda, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__7c4b9d45_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__b118e316_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7c4b9d45_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x7c4b9d45, "visitExprReader", 1072 };
+TypeInfo * __type_info__1734e1a3_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__b118e316_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1734e1a3_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x1734e1a3, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__85bc87fc_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__b118e316_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85bc87fc_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x85bc87fc, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__4312d953_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__b118e316_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4312d953_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0x4312d953, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__be7f9f82_arg_types_var_2971198230[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__b118e316_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__be7f9f82_arg_types_var_2971198230, nullptr, 2, 0, nullptr, 28, 0xbe7f9f82, "visitExprCallMacro", 1088 };
+VarInfo __struct_info__b118e316_field_272 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xaa48356, "variable", 1096 };
+VarInfo * __struct_info__b118e316_fields[273] =  { &__struct_info__b118e316_field_0, &__struct_info__b118e316_field_1, &__struct_info__b118e316_field_2, &__struct_info__b118e316_field_3, &__struct_info__b118e316_field_4, &__struct_info__b118e316_field_5, &__struct_info__b118e316_field_6, &__struct_info__b118e316_field_7, &__struct_info__b118e316_field_8, &__struct_info__b118e316_field_9, &__struct_info__b118e316_field_10, &__struct_info__b118e316_field_11, &__struct_info__b118e316_field_12, &__struct_info__b118e316_field_13, &__struct_info__b118e316_field_14, &__struct_info__b118e316_field_15, &__struct_info__b118e316_field_16, &__struct_info__b118e316_field_17, &__struct_info__b118e316_field_18, &__struct_info__b118e316_field_19, &__struct_info__b118e316_field_20, &__struct_info__b118e316_field_21, &__struct_info__b118e316_field_22, &__struct_info__b118e316_field_23, &__struct_info__b118e316_field_24, &__struct_info__b118e316_field_25, &__struct_info__b118e316_field_26, &__struct_info__b118e316_field_27, &__struct_info__b118e316_field_28, &__struct_info__b118e316_field_29, &__struct_info__b118e316_field_30, &__struct_info__b118e316_field_31, &__struct_info__b118e316_field_32, &__struct_info__b118e316_field_33, &__struct_info__b118e316_field_34, &__struct_info__b118e316_field_35, &__struct_info__b118e316_field_36, &__struct_info__b118e316_field_37, &__struct_info__b118e316_field_38, &__struct_info__b118e316_field_39, &__struct_info__b118e316_field_40, &__struct_info__b118e316_field_41, &__struct_info__b118e316_field_42, &__struct_info__b118e316_field_43, &__struct_info__b118e316_field_44, &__struct_info__b118e316_field_45, &__struct_info__b118e316_field_46, &__struct_info__b118e316_field_47, &__struct_info__b118e316_field_48, &__struct_info__b118e316_field_49, &__struct_info__b118e316_field_50, &__struct_info__b118e316_field_51, &__struct_info__b118e316_field_52, &__struct_info__b118e316_field_53, &__struct_info__b118e316_field_54, &__struct_info__b118e316_field_55, &__struct_info__b118e316_field_56, &__struct_info__b118e316_field_57, &__struct_info__b118e316_field_58, &__struct_info__b118e316_field_59, &__struct_info__b118e316_field_60, &__struct_info__b118e316_field_61, &__struct_info__b118e316_field_62, &__struct_info__b118e316_field_63, &__struct_info__b118e316_field_64, &__struct_info__b118e316_field_65, &__struct_info__b118e316_field_66, &__struct_info__b118e316_field_67, &__struct_info__b118e316_field_68, &__struct_info__b118e316_field_69, &__struct_info__b118e316_field_70, &__struct_info__b118e316_field_71, &__struct_info__b118e316_field_72, &__struct_info__b118e316_field_73, &__struct_info__b118e316_field_74, &__struct_info__b118e316_field_75, &__struct_info__b118e316_field_76, &__struct_info__b118e316_field_77, &__struct_info__b118e316_field_78, &__struct_info__b118e316_field_79, &__struct_info__b118e316_field_80, &__struct_info__b118e316_field_81, &__struct_info__b118e316_field_82, &__struct_info__b118e316_field_83, &__struct_info__b118e316_field_84, &__struct_info__b118e316_field_85, &__struct_info__b118e316_field_86, &__struct_info__b118e316_field_87, &__struct_info__b118e316_field_88, &__struct_info__b118e316_field_89, &__struct_info__b118e316_field_90, &__struct_info__b118e316_field_91, &__struct_info__b118e316_field_92, &__struct_info__b118e316_field_93, &__struct_info__b118e316_field_94, &__struct_info__b118e316_field_95, &__struct_info__b118e316_field_96, &__struct_info__b118e316_field_97, &__struct_info__b118e316_field_98, &__struct_info__b118e316_field_99, &__struct_info__b118e316_field_100, &__struct_info__b118e316_field_101, &__struct_info__b118e316_field_102, &__struct_info__b118e316_field_103, &__struct_info__b118e316_field_104, &__struct_info__b118e316_field_105, &__struct_info__b118e316_field_106, &__struct_info__b118e316_field_107, &__struct_info__b118e316_field_108, &__struct_info__b118e316_field_109, &__struct_info__b118e316_field_110, &__struct_info__b118e316_field_111, &__struct_info__b118e316_field_112, &__struct_info__b118e316_field_113, &__struct_info__b118e316_field_114, &__struct_info__b118e316_field_115, &__struct_info__b118e316_field_116, &__struct_info__b118e316_field_117, &__struct_info__b118e316_field_118, &__struct_info__b118e316_field_119, &__struct_info__b118e316_field_120, &__struct_info__b118e316_field_121, &__struct_info__b118e316_field_122, &__struct_info__b118e316_field_123, &__struct_info__b118e316_field_124, &__struct_info__b118e316_field_125, &__struct_info__b118e316_field_126, &__struct_info__b118e316_field_127, &__struct_info__b118e316_field_128, &__struct_info__b118e316_field_129, &__struct_info__b118e316_field_130, &__struct_info__b118e316_field_131, &__struct_info__b118e316_field_132, &__struct_info__b118e316_field_133, &__struct_info__b118e316_field_134, &__struct_info__b118e316_field_135, &__struct_info__b118e316_field_136, &__struct_info__b118e316_field_137, &__struct_info__b118e316_field_138, &__struct_info__b118e316_field_139, &__struct_info__b118e316_field_140, &__struct_info__b118e316_field_141, &__struct_info__b118e316_field_142, &__struct_info__b118e316_field_143, &__struct_info__b118e316_field_144, &__struct_info__b118e316_field_145, &__struct_info__b118e316_field_146, &__struct_info__b118e316_field_147, &__struct_info__b118e316_field_148, &__struct_info__b118e316_field_149, &__struct_info__b118e316_field_150, &__struct_info__b118e316_field_151, &__struct_info__b118e316_field_152, &__struct_info__b118e316_field_153, &__struct_info__b118e316_field_154, &__struct_info__b118e316_field_155, &__struct_info__b118e316_field_156, &__struct_info__b118e316_field_157, &__struct_info__b118e316_field_158, &__struct_info__b118e316_field_159, &__struct_info__b118e316_field_160, &__struct_info__b118e316_field_161, &__struct_info__b118e316_field_162, &__struct_info__b118e316_field_163, &__struct_info__b118e316_field_164, &__struct_info__b118e316_field_165, &__struct_info__b118e316_field_166, &__struct_info__b118e316_field_167, &__struct_info__b118e316_field_168, &__struct_info__b118e316_field_169, &__struct_info__b118e316_field_170, &__struct_info__b118e316_field_171, &__struct_info__b118e316_field_172, &__struct_info__b118e316_field_173, &__struct_info__b118e316_field_174, &__struct_info__b118e316_field_175, &__struct_info__b118e316_field_176, &__struct_info__b118e316_field_177, &__struct_info__b118e316_field_178, &__struct_info__b118e316_field_179, &__struct_info__b118e316_field_180, &__struct_info__b118e316_field_181, &__struct_info__b118e316_field_182, &__struct_info__b118e316_field_183, &__struct_info__b118e316_field_184, &__struct_info__b118e316_field_185, &__struct_info__b118e316_field_186, &__struct_info__b118e316_field_187, &__struct_info__b118e316_field_188, &__struct_info__b118e316_field_189, &__struct_info__b118e316_field_190, &__struct_info__b118e316_field_191, &__struct_info__b118e316_field_192, &__struct_info__b118e316_field_193, &__struct_info__b118e316_field_194, &__struct_info__b118e316_field_195, &__struct_info__b118e316_field_196, &__struct_info__b118e316_field_197, &__struct_info__b118e316_field_198, &__struct_info__b118e316_field_199, &__struct_info__b118e316_field_200, &__struct_info__b118e316_field_201, &__struct_info__b118e316_field_202, &__struct_info__b118e316_field_203, &__struct_info__b118e316_field_204, &__struct_info__b118e316_field_205, &__struct_info__b118e316_field_206, &__struct_info__b118e316_field_207, &__struct_info__b118e316_field_208, &__struct_info__b118e316_field_209, &__struct_info__b118e316_field_210, &__struct_info__b118e316_field_211, &__struct_info__b118e316_field_212, &__struct_info__b118e316_field_213, &__struct_info__b118e316_field_214, &__struct_info__b118e316_field_215, &__struct_info__b118e316_field_216, &__struct_info__b118e316_field_217, &__struct_info__b118e316_field_218, &__struct_info__b118e316_field_219, &__struct_info__b118e316_field_220, &__struct_info__b118e316_field_221, &__struct_info__b118e316_field_222, &__struct_info__b118e316_field_223, &__struct_info__b118e316_field_224, &__struct_info__b118e316_field_225, &__struct_info__b118e316_field_226, &__struct_info__b118e316_field_227, &__struct_info__b118e316_field_228, &__struct_info__b118e316_field_229, &__struct_info__b118e316_field_230, &__struct_info__b118e316_field_231, &__struct_info__b118e316_field_232, &__struct_info__b118e316_field_233, &__struct_info__b118e316_field_234, &__struct_info__b118e316_field_235, &__struct_info__b118e316_field_236, &__struct_info__b118e316_field_237, &__struct_info__b118e316_field_238, &__struct_info__b118e316_field_239, &__struct_info__b118e316_field_240, &__struct_info__b118e316_field_241, &__struct_info__b118e316_field_242, &__struct_info__b118e316_field_243, &__struct_info__b118e316_field_244, &__struct_info__b118e316_field_245, &__struct_info__b118e316_field_246, &__struct_info__b118e316_field_247, &__struct_info__b118e316_field_248, &__struct_info__b118e316_field_249, &__struct_info__b118e316_field_250, &__struct_info__b118e316_field_251, &__struct_info__b118e316_field_252, &__struct_info__b118e316_field_253, &__struct_info__b118e316_field_254, &__struct_info__b118e316_field_255, &__struct_info__b118e316_field_256, &__struct_info__b118e316_field_257, &__struct_info__b118e316_field_258, &__struct_info__b118e316_field_259, &__struct_info__b118e316_field_260, &__struct_info__b118e316_field_261, &__struct_info__b118e316_field_262, &__struct_info__b118e316_field_263, &__struct_info__b118e316_field_264, &__struct_info__b118e316_field_265, &__struct_info__b118e316_field_266, &__struct_info__b118e316_field_267, &__struct_info__b118e316_field_268, &__struct_info__b118e316_field_269, &__struct_info__b118e316_field_270, &__struct_info__b118e316_field_271, &__struct_info__b118e316_field_272 };
+StructInfo __struct_info__b118e316 = {"AppendToWriteVisitor", __struct_info__b118e316_fields, 273, 1104, -1, nullptr, 0xb118e316 };
+VarInfo __struct_info__5ed6db18_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f90ec93, "__rtti", 0 };
+TypeInfo * __type_info__fb05f748_arg_types_var_1591139096[1] = { &__type_info__fdd27932 };
+VarInfo __struct_info__5ed6db18_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb05f748_arg_types_var_1591139096, nullptr, 1, 0, nullptr, 28, 0xfb05f748, "__finalize", 8 };
+TypeInfo * __type_info__1e070140_arg_types_var_1591139096[3] = { &__type_info__fdd27932, &__type_info__8f3455dd, &__type_info__b049b391 };
+VarInfo __struct_info__5ed6db18_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1e070140_arg_types_var_1591139096, nullptr, 3, 0, nullptr, 28, 0x1e070140, "apply", 12 };
+VarInfo * __struct_info__5ed6db18_fields[3] =  { &__struct_info__5ed6db18_field_0, &__struct_info__5ed6db18_field_1, &__struct_info__5ed6db18_field_2 };
+StructInfo __struct_info__5ed6db18 = {"AstPassMacro", __struct_info__5ed6db18_fields, 3, 16, -1, nullptr, 0x5ed6db18 };
+VarInfo __struct_info__19c48622_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2f284709, "__rtti", 0 };
+TypeInfo * __type_info__ca41af16_arg_types_var_432309794[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__19c48622_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ca41af16_arg_types_var_432309794, nullptr, 1, 0, nullptr, 28, 0xca41af16, "__finalize", 8 };
+TypeInfo * __type_info__dafec4e2_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__19c48622_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dafec4e2_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdafec4e2, "preVisitProgram", 12 };
+TypeInfo * __type_info__c074a17b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__19c48622_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c074a17b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc074a17b, "visitProgram", 16 };
+TypeInfo * __type_info__51b2f326_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__19c48622_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51b2f326_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x51b2f326, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__bf4114ba_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__19c48622_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bf4114ba_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xbf4114ba, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__edc30d75_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__19c48622_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__edc30d75_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xedc30d75, "visitTypeDecl", 28 };
+TypeInfo * __type_info__7a97244e_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__19c48622_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7a97244e_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x7a97244e, "preVisitAlias", 32 };
+TypeInfo * __type_info__e724dd47_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__19c48622_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__e724dd47_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xe724dd47, "visitAlias", 36 };
+TypeInfo * __type_info__538906fd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__19c48622_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__538906fd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x538906fd, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__612e5862_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__612e5862_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x612e5862, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__4ec985c5_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4ec985c5_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x4ec985c5, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__6c1ea24c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__19c48622_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__6c1ea24c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6c1ea24c, "visitEnumeration", 52 };
+TypeInfo * __type_info__b267dd2b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__19c48622_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b267dd2b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb267dd2b, "preVisitStructure", 56 };
+TypeInfo * __type_info__6f4bc015_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4bc015_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x6f4bc015, "preVisitStructureField", 60 };
+TypeInfo * __type_info__ae82ddb2_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae82ddb2_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xae82ddb2, "visitStructureField", 64 };
+TypeInfo * __type_info__1bf16836_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__19c48622_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__1bf16836_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1bf16836, "visitStructure", 68 };
+TypeInfo * __type_info__5318a856_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__19c48622_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5318a856_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5318a856, "preVisitFunction", 72 };
+TypeInfo * __type_info__9fd388b9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__19c48622_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__9fd388b9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x9fd388b9, "visitFunction", 76 };
+TypeInfo * __type_info__80825ff1_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80825ff1_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x80825ff1, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__33e4414a_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__33e4414a_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x33e4414a, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__fb452def_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb452def_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xfb452def, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__2ed8fa20_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2ed8fa20_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x2ed8fa20, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__daebe88a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__19c48622_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__daebe88a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdaebe88a, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__362d7569_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__19c48622_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__362d7569_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x362d7569, "visitFunctionBody", 100 };
+TypeInfo * __type_info__f6869070_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f6869070_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf6869070, "preVisitExpression", 104 };
+TypeInfo * __type_info__5566fe3b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5566fe3b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5566fe3b, "visitExpression", 108 };
+TypeInfo * __type_info__22d64822_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__19c48622_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__22d64822_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x22d64822, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__27cafe1b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__19c48622_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__27cafe1b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x27cafe1b, "visitExprBlock", 116 };
+TypeInfo * __type_info__ad16bb9d_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad16bb9d_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xad16bb9d, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__da6e0eb8_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__da6e0eb8_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xda6e0eb8, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__4a02be5b_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4a02be5b_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x4a02be5b, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__340ba2ca_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__340ba2ca_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x340ba2ca, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__17fa3290_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17fa3290_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x17fa3290, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__ebca0bcd_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ebca0bcd_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xebca0bcd, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__37938abe_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__19c48622_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37938abe_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x37938abe, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__bfa3a981_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__19c48622_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bfa3a981_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xbfa3a981, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__3dd5135c_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3dd5135c_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x3dd5135c, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__6c2ff37_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c2ff37_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x6c2ff37, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__c08345ba_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__19c48622_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c08345ba_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc08345ba, "preVisitExprLet", 160 };
+TypeInfo * __type_info__ad676ca7_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__19c48622_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad676ca7_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xad676ca7, "visitExprLet", 164 };
+TypeInfo * __type_info__62c1b97e_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__62c1b97e_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x62c1b97e, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__95639bfb_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__95639bfb_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x95639bfb, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__ef31a644_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ef31a644_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xef31a644, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__7706a2c5_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7706a2c5_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x7706a2c5, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__a00a9b92_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__19c48622_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a00a9b92_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa00a9b92, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__66d66f87_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__19c48622_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66d66f87_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x66d66f87, "visitGlobalLet", 188 };
+TypeInfo * __type_info__2767a976_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2767a976_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x2767a976, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__7b19d1b_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__7b19d1b_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x7b19d1b, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__cc2c110c_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc2c110c_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xcc2c110c, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__ffec8725_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ffec8725_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xffec8725, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__5018605f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__19c48622_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5018605f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5018605f, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__a7659bf6_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__19c48622_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a7659bf6_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa7659bf6, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__1ab52e01_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1ab52e01_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x1ab52e01, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__f560290e_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f560290e_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xf560290e, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__98b1d7d1_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__19c48622_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98b1d7d1_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x98b1d7d1, "preVisitExprNew", 224 };
+TypeInfo * __type_info__d54c6248_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__19c48622_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d54c6248_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd54c6248, "visitExprNew", 228 };
+TypeInfo * __type_info__ee882f82_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee882f82_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xee882f82, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__706849b7_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__706849b7_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x706849b7, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__19e1a2ca_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__19c48622_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__19e1a2ca_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x19e1a2ca, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__c6d19a6b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__19c48622_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c6d19a6b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc6d19a6b, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__239c0205_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__239c0205_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x239c0205, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__6673f9e8_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__6673f9e8_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x6673f9e8, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__dc9132bc_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__19c48622_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc9132bc_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdc9132bc, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__fb5f5afd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__19c48622_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fb5f5afd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfb5f5afd, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__66942b3b_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66942b3b_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x66942b3b, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__a4e37f6e_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a4e37f6e_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xa4e37f6e, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__534df069_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__19c48622_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__534df069_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x534df069, "preVisitExprCall", 272 };
+TypeInfo * __type_info__f6bc51c2_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__19c48622_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f6bc51c2_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf6bc51c2, "visitExprCall", 276 };
+TypeInfo * __type_info__7dd300da_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7dd300da_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x7dd300da, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__e115d87d_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e115d87d_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xe115d87d, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__be237068_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__19c48622_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__be237068_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xbe237068, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__a81c30c7_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__19c48622_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a81c30c7_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa81c30c7, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__397c5a45_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__397c5a45_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x397c5a45, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__784be548_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__19c48622_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__784be548_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x784be548, "preVisitExprAt", 300 };
+TypeInfo * __type_info__3c5f745b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__19c48622_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3c5f745b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x3c5f745b, "visitExprAt", 304 };
+TypeInfo * __type_info__7cd019a4_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7cd019a4_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x7cd019a4, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__cc239bd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__19c48622_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc239bd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xcc239bd, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__f8db2b5e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__19c48622_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f8db2b5e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf8db2b5e, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__2e991523_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2e991523_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x2e991523, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__6f60f1d5_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__19c48622_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f60f1d5_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6f60f1d5, "preVisitExprIs", 324 };
+TypeInfo * __type_info__314bdb52_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__19c48622_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__314bdb52_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x314bdb52, "visitExprIs", 328 };
+TypeInfo * __type_info__f7fa341d_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__19c48622_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7fa341d_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xf7fa341d, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__673b3e88_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__19c48622_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__673b3e88_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x673b3e88, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__7eb030c1_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__19c48622_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7eb030c1_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7eb030c1, "visitExprOp2", 340 };
+TypeInfo * __type_info__8c8f07fa_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8c8f07fa_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x8c8f07fa, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__683b401b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__19c48622_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__683b401b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x683b401b, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__7db02f2e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__19c48622_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7db02f2e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7db02f2e, "visitExprOp3", 352 };
+TypeInfo * __type_info__4711a622_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4711a622_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x4711a622, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__9d88500f_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d88500f_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x9d88500f, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__82468004_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__19c48622_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__82468004_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x82468004, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__b8a59cb3_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__19c48622_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8a59cb3_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb8a59cb3, "visitExprCopy", 368 };
+TypeInfo * __type_info__6108ac9e_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6108ac9e_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x6108ac9e, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__b52e95d4_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__19c48622_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b52e95d4_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb52e95d4, "preVisitExprMove", 376 };
+TypeInfo * __type_info__3089b32b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__19c48622_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3089b32b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x3089b32b, "visitExprMove", 380 };
+TypeInfo * __type_info__8b5bc18e_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b5bc18e_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x8b5bc18e, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__63537942_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__19c48622_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63537942_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x63537942, "preVisitExprClone", 388 };
+TypeInfo * __type_info__8504165b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__19c48622_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8504165b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x8504165b, "visitExprClone", 392 };
+TypeInfo * __type_info__917b7ee0_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__917b7ee0_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x917b7ee0, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__c27b4929_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__19c48622_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c27b4929_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc27b4929, "preVisitExprWith", 400 };
+TypeInfo * __type_info__94de33a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__19c48622_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__94de33a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x94de33a, "visitExprWith", 404 };
+TypeInfo * __type_info__cc318f39_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc318f39_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xcc318f39, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__27fe98e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__19c48622_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__27fe98e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x27fe98e, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__bc842643_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__19c48622_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__bc842643_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xbc842643, "visitExprWhile", 416 };
+TypeInfo * __type_info__29351962_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__29351962_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x29351962, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__fb38e121_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__19c48622_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb38e121_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfb38e121, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__8d22e4d2_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__19c48622_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8d22e4d2_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x8d22e4d2, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__125e1d18_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__125e1d18_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x125e1d18, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__13fc640c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__19c48622_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__13fc640c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x13fc640c, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__9387af87_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__19c48622_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9387af87_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x9387af87, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__c1650214_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c1650214_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xc1650214, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__e7f8a0e2_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e7f8a0e2_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xe7f8a0e2, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__1d0d5850_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__19c48622_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1d0d5850_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1d0d5850, "preVisitExprFor", 452 };
+TypeInfo * __type_info__30d5c055_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__19c48622_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__30d5c055_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x30d5c055, "visitExprFor", 456 };
+TypeInfo * __type_info__a89b370_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a89b370_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xa89b370, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__d1aa62f5_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d1aa62f5_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0xd1aa62f5, "visitExprForVariable", 464 };
+TypeInfo * __type_info__89ccc515_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89ccc515_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x89ccc515, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__1e740be8_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1e740be8_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x1e740be8, "visitExprForSource", 472 };
+TypeInfo * __type_info__effcbfe8_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__19c48622_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__effcbfe8_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xeffcbfe8, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__98ded09c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__19c48622_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98ded09c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x98ded09c, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__481176c0_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__19c48622_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__481176c0_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x481176c0, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__abdcc155_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__19c48622_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__abdcc155_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xabdcc155, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__21b9526c_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21b9526c_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x21b9526c, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__d1eafff7_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__d1eafff7_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0xd1eafff7, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__44fe3ae_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__19c48622_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__44fe3ae_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x44fe3ae, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__70515235_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__19c48622_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__70515235_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x70515235, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__49b23bf2_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49b23bf2_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x49b23bf2, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__5f8e977b_arg_types_var_432309794[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5f8e977b_arg_types_var_432309794, nullptr, 4, 0, nullptr, 28, 0x5f8e977b, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__a1fce89a_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a1fce89a_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0xa1fce89a, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__8a06d317_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__8a06d317_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x8a06d317, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__cd11184c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__19c48622_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cd11184c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xcd11184c, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__fac4ee59_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__19c48622_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fac4ee59_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfac4ee59, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__a5136dc8_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a5136dc8_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0xa5136dc8, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__1df012f_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1df012f_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x1df012f, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__af868847_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__19c48622_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af868847_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xaf868847, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__69460f32_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__19c48622_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__69460f32_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x69460f32, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__2cc1e62d_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2cc1e62d_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0x2cc1e62d, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__a3be05a6_arg_types_var_432309794[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__19c48622_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a3be05a6_arg_types_var_432309794, nullptr, 5, 0, nullptr, 28, 0xa3be05a6, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__db9cadee_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__19c48622_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db9cadee_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdb9cadee, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__53229621_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__19c48622_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__53229621_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x53229621, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__2be6f93b_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2be6f93b_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0x2be6f93b, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__d5616905_arg_types_var_432309794[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d5616905_arg_types_var_432309794, nullptr, 3, 0, nullptr, 28, 0xd5616905, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__fb824c9d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__19c48622_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb824c9d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfb824c9d, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__7252da3e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__19c48622_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7252da3e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7252da3e, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__975f8446_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__19c48622_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__975f8446_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x975f8446, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__7db2ce6f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__19c48622_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7db2ce6f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7db2ce6f, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__eb50d8bd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__19c48622_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eb50d8bd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xeb50d8bd, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__815926d4_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__19c48622_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__815926d4_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x815926d4, "visitExprLabel", 592 };
+TypeInfo * __type_info__ae4c30a6_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__19c48622_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ae4c30a6_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xae4c30a6, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__45086c55_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__19c48622_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__45086c55_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x45086c55, "visitExprGoto", 600 };
+TypeInfo * __type_info__880d1d21_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__19c48622_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__880d1d21_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x880d1d21, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__e5f6be3c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__19c48622_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e5f6be3c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe5f6be3c, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__981ee92a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__19c48622_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__981ee92a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x981ee92a, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__697917f3_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__19c48622_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__697917f3_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x697917f3, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__f9821332_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__19c48622_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f9821332_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf9821332, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__e73dd0fd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__19c48622_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e73dd0fd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe73dd0fd, "visitExprAddr", 624 };
+TypeInfo * __type_info__f715873b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__19c48622_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f715873b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf715873b, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__32ba3714_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__19c48622_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__32ba3714_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x32ba3714, "visitExprAssert", 632 };
+TypeInfo * __type_info__c01a4f8d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__19c48622_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c01a4f8d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc01a4f8d, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__7332b1be_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__19c48622_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7332b1be_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7332b1be, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__ecce0297_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__19c48622_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecce0297_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xecce0297, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__a80b1462_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__19c48622_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80b1462_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa80b1462, "visitExprQuote", 648 };
+TypeInfo * __type_info__92aa7458_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__19c48622_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92aa7458_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x92aa7458, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__e6f3da09_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__19c48622_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6f3da09_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe6f3da09, "visitExprDebug", 656 };
+TypeInfo * __type_info__c7b6a3cd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__19c48622_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c7b6a3cd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc7b6a3cd, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__be9adf0e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__19c48622_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__be9adf0e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xbe9adf0e, "visitExprInvoke", 664 };
+TypeInfo * __type_info__5abeb395_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__19c48622_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5abeb395_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5abeb395, "preVisitExprErase", 668 };
+TypeInfo * __type_info__f121043c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__19c48622_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f121043c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf121043c, "visitExprErase", 672 };
+TypeInfo * __type_info__7699a61a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__19c48622_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7699a61a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7699a61a, "preVisitExprFind", 676 };
+TypeInfo * __type_info__68018619_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__19c48622_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__68018619_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x68018619, "visitExprFind", 680 };
+TypeInfo * __type_info__652abe3c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__19c48622_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__652abe3c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x652abe3c, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__3869c9d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__19c48622_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3869c9d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x3869c9d, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__98e24617_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__19c48622_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98e24617_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x98e24617, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__91161aa8_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__19c48622_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__91161aa8_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x91161aa8, "visitExprAscend", 696 };
+TypeInfo * __type_info__49834f0e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__19c48622_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49834f0e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x49834f0e, "preVisitExprCast", 700 };
+TypeInfo * __type_info__e0733905_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__19c48622_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e0733905_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe0733905, "visitExprCast", 704 };
+TypeInfo * __type_info__63349b0a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__19c48622_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63349b0a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x63349b0a, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__9397bac9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__19c48622_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9397bac9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x9397bac9, "visitExprDelete", 712 };
+TypeInfo * __type_info__fcba257e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__19c48622_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fcba257e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfcba257e, "preVisitExprVar", 716 };
+TypeInfo * __type_info__6bac7c4b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__19c48622_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6bac7c4b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6bac7c4b, "visitExprVar", 720 };
+TypeInfo * __type_info__5c3a9027_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__19c48622_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5c3a9027_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5c3a9027, "preVisitExprField", 724 };
+TypeInfo * __type_info__1f3e480a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__19c48622_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1f3e480a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1f3e480a, "visitExprField", 728 };
+TypeInfo * __type_info__e353e434_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__19c48622_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e353e434_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe353e434, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__407719d5_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__19c48622_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__407719d5_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x407719d5, "visitExprSafeField", 736 };
+TypeInfo * __type_info__d0b36421_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__19c48622_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d0b36421_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd0b36421, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__c18e7e30_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__19c48622_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c18e7e30_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc18e7e30, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__a647e36_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__19c48622_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a647e36_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa647e36, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__a1fae513_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__19c48622_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1fae513_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa1fae513, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__7b25207e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__19c48622_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7b25207e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7b25207e, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__eb74ac2b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__19c48622_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eb74ac2b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xeb74ac2b, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__496f7eb9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__19c48622_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__496f7eb9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x496f7eb9, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__371e2058_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__19c48622_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__371e2058_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x371e2058, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__6a3b4341_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__19c48622_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6a3b4341_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6a3b4341, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__7bb02c08_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__19c48622_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7bb02c08_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7bb02c08, "visitExprOp1", 776 };
+TypeInfo * __type_info__1d2bbb7f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__19c48622_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1d2bbb7f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1d2bbb7f, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__383793f8_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__19c48622_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__383793f8_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x383793f8, "visitExprReturn", 784 };
+TypeInfo * __type_info__a6dae66e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__19c48622_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6dae66e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa6dae66e, "preVisitExprYield", 788 };
+TypeInfo * __type_info__2b9935eb_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__19c48622_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2b9935eb_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x2b9935eb, "visitExprYield", 792 };
+TypeInfo * __type_info__3aa0838_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__19c48622_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3aa0838_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x3aa0838, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__6b26ea35_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__19c48622_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6b26ea35_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6b26ea35, "visitExprBreak", 800 };
+TypeInfo * __type_info__d32e8004_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__19c48622_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d32e8004_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd32e8004, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__774617_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__19c48622_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__774617_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x774617, "visitExprContinue", 808 };
+TypeInfo * __type_info__7ec98560_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__19c48622_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ec98560_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7ec98560, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__488a4c9d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__19c48622_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__488a4c9d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x488a4c9d, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__b771215c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__19c48622_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b771215c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb771215c, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__36ccf8a9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__19c48622_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36ccf8a9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x36ccf8a9, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__1c5dc61c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__19c48622_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c5dc61c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1c5dc61c, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__526141d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__19c48622_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__526141d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x526141d, "visitExprMemZero", 832 };
+TypeInfo * __type_info__a093c594_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__19c48622_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a093c594_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xa093c594, "preVisitExprConst", 836 };
+TypeInfo * __type_info__6813c3d5_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__19c48622_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6813c3d5_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6813c3d5, "visitExprConst", 840 };
+TypeInfo * __type_info__3fb625ee_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__19c48622_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3fb625ee_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x3fb625ee, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__887d85f9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__19c48622_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__887d85f9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x887d85f9, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__73fc5e3b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__19c48622_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__73fc5e3b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x73fc5e3b, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__8ccb024c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__19c48622_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8ccb024c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x8ccb024c, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__319b0b61_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__19c48622_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319b0b61_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x319b0b61, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__736b0ec_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__19c48622_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__736b0ec_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x736b0ec, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__e148cd6f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__19c48622_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e148cd6f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe148cd6f, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__663ab482_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__19c48622_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__663ab482_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x663ab482, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__ecac6fe6_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__19c48622_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecac6fe6_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xecac6fe6, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__b4805a01_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__19c48622_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b4805a01_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb4805a01, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__ecaa314f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__19c48622_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecaa314f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xecaa314f, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__b06f0a94_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__19c48622_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b06f0a94_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xb06f0a94, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__e849de0d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__19c48622_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e849de0d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe849de0d, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__66b5d28e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__19c48622_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__66b5d28e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x66b5d28e, "visitExprConstInt", 896 };
+TypeInfo * __type_info__eb48dd2d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__19c48622_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eb48dd2d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xeb48dd2d, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__6c3abdf4_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__19c48622_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c3abdf4_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6c3abdf4, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__ea48db9a_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__19c48622_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea48db9a_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xea48db9a, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__6d3abf87_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__19c48622_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6d3abf87_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6d3abf87, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__e548d3bb_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__19c48622_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e548d3bb_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe548d3bb, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__6a3abace_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__19c48622_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6a3abace_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x6a3abace, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__7373982c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__19c48622_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7373982c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7373982c, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__36f7da2b_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__19c48622_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36f7da2b_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x36f7da2b, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__4b0eeab3_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__19c48622_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b0eeab3_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x4b0eeab3, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__93167902_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__19c48622_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__93167902_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x93167902, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__db077e9e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__19c48622_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__db077e9e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdb077e9e, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__9327c223_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__19c48622_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9327c223_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x9327c223, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__7238d29c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__19c48622_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7238d29c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7238d29c, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__f7388431_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__19c48622_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f7388431_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf7388431, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__7d73a7ea_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__19c48622_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7d73a7ea_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7d73a7ea, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__30f7d0b9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__19c48622_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__30f7d0b9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x30f7d0b9, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__7e73a97d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__19c48622_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7e73a97d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x7e73a97d, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__2ff7cf26_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__19c48622_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2ff7cf26_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x2ff7cf26, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__77739e78_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__19c48622_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__77739e78_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x77739e78, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__32f7d3df_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__19c48622_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__32f7d3df_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x32f7d3df, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__53fa89d9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__19c48622_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__53fa89d9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x53fa89d9, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__d3814682_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__19c48622_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d3814682_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd3814682, "visitExprConstRange", 984 };
+TypeInfo * __type_info__537f91c8_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__19c48622_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__537f91c8_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x537f91c8, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__f7624135_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__19c48622_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f7624135_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf7624135, "visitExprConstURange", 992 };
+TypeInfo * __type_info__c6c29fac_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__19c48622_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c6c29fac_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc6c29fac, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__69ed062d_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__19c48622_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__69ed062d_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x69ed062d, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__60ccfb46_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__19c48622_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__60ccfb46_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x60ccfb46, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__c67d1ab5_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__19c48622_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c67d1ab5_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc67d1ab5, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__d6afd79c_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__19c48622_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6afd79c_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd6afd79c, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__fdf0c285_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__19c48622_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdf0c285_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfdf0c285, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__d7afd92f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__19c48622_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d7afd92f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd7afd92f, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__fcf0c0f2_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__19c48622_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcf0c0f2_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xfcf0c0f2, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__d4afd476_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__19c48622_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d4afd476_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd4afd476, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__f7f0b913_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__19c48622_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f7f0b913_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf7f0b913, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__16e3dfd5_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__19c48622_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__16e3dfd5_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x16e3dfd5, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__df58a108_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__19c48622_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__df58a108_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdf58a108, "visitExprConstString", 1040 };
+TypeInfo * __type_info__71b02ac9_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__19c48622_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__71b02ac9_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x71b02ac9, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__2d969b58_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__19c48622_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2d969b58_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x2d969b58, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__47814037_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__19c48622_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__47814037_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x47814037, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__d26e1de6_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__19c48622_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d26e1de6_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xd26e1de6, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__1cd1bb6_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__19c48622_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1cd1bb6_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x1cd1bb6, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__dad314cd_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__19c48622_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dad314cd_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xdad314cd, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__c0abce96_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__19c48622_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c0abce96_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xc0abce96, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__5e329601_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__19c48622_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e329601_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x5e329601, "visitExprReader", 1072 };
+TypeInfo * __type_info__41c7e4f7_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__19c48622_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__41c7e4f7_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x41c7e4f7, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__68647de0_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__19c48622_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__68647de0_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x68647de0, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__8e76b93f_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__19c48622_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8e76b93f_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0x8e76b93f, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__e43fb95e_arg_types_var_432309794[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__19c48622_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e43fb95e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xe43fb95e, "visitExprCallMacro", 1088 };
+VarInfo __struct_info__19c48622_field_272 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__aea00813, &__type_info__aea00813, nullptr, nullptr, 0, 0, nullptr, 2, 0x89088bbd, "loops", 1096 };
+VarInfo __struct_info__19c48622_field_273 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__aea00813, &__type_info__17c16538, nullptr, nullptr, 0, 0, nullptr, 2, 0x46d67602, "names", 1144 };
+VarInfo __struct_info__19c48622_field_274 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x415773f6, "astChanged", 1192 };
+TypeInfo * __type_info__f8f69b4e_arg_types_var_432309794[2] = { &__type_info__386c90cf, &__type_info__4edf488d };
+VarInfo __struct_info__19c48622_field_275 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f8f69b4e_arg_types_var_432309794, nullptr, 2, 0, nullptr, 28, 0xf8f69b4e, "rewrite", 1196 };
+VarInfo * __struct_info__19c48622_fields[276] =  { &__struct_info__19c48622_field_0, &__struct_info__19c48622_field_1, &__struct_info__19c48622_field_2, &__struct_info__19c48622_field_3, &__struct_info__19c48622_field_4, &__struct_info__19c48622_field_5, &__struct_info__19c48622_field_6, &__struct_info__19c48622_field_7, &__struct_info__19c48622_field_8, &__struct_info__19c48622_field_9, &__struct_info__19c48622_field_10, &__struct_info__19c48622_field_11, &__struct_info__19c48622_field_12, &__struct_info__19c48622_field_13, &__struct_info__19c48622_field_14, &__struct_info__19c48622_field_15, &__struct_info__19c48622_field_16, &__struct_info__19c48622_field_17, &__struct_info__19c48622_field_18, &__struct_info__19c48622_field_19, &__struct_info__19c48622_field_20, &__struct_info__19c48622_field_21, &__struct_info__19c48622_field_22, &__struct_info__19c48622_field_23, &__struct_info__19c48622_field_24, &__struct_info__19c48622_field_25, &__struct_info__19c48622_field_26, &__struct_info__19c48622_field_27, &__struct_info__19c48622_field_28, &__struct_info__19c48622_field_29, &__struct_info__19c48622_field_30, &__struct_info__19c48622_field_31, &__struct_info__19c48622_field_32, &__struct_info__19c48622_field_33, &__struct_info__19c48622_field_34, &__struct_info__19c48622_field_35, &__struct_info__19c48622_field_36, &__struct_info__19c48622_field_37, &__struct_info__19c48622_field_38, &__struct_info__19c48622_field_39, &__struct_info__19c48622_field_40, &__struct_info__19c48622_field_41, &__struct_info__19c48622_field_42, &__struct_info__19c48622_field_43, &__struct_info__19c48622_field_44, &__struct_info__19c48622_field_45, &__struct_info__19c48622_field_46, &__struct_info__19c48622_field_47, &__struct_info__19c48622_field_48, &__struct_info__19c48622_field_49, &__struct_info__19c48622_field_50, &__struct_info__19c48622_field_51, &__struct_info__19c48622_field_52, &__struct_info__19c48622_field_53, &__struct_info__19c48622_field_54, &__struct_info__19c48622_field_55, &__struct_info__19c48622_field_56, &__struct_info__19c48622_field_57, &__struct_info__19c48622_field_58, &__struct_info__19c48622_field_59, &__struct_info__19c48622_field_60, &__struct_info__19c48622_field_61, &__struct_info__19c48622_field_62, &__struct_info__19c48622_field_63, &__struct_info__19c48622_field_64, &__struct_info__19c48622_field_65, &__struct_info__19c48622_field_66, &__struct_info__19c48622_field_67, &__struct_info__19c48622_field_68, &__struct_info__19c48622_field_69, &__struct_info__19c48622_field_70, &__struct_info__19c48622_field_71, &__struct_info__19c48622_field_72, &__struct_info__19c48622_field_73, &__struct_info__19c48622_field_74, &__struct_info__19c48622_field_75, &__struct_info__19c48622_field_76, &__struct_info__19c48622_field_77, &__struct_info__19c48622_field_78, &__struct_info__19c48622_field_79, &__struct_info__19c48622_field_80, &__struct_info__19c48622_field_81, &__struct_info__19c48622_field_82, &__struct_info__19c48622_field_83, &__struct_info__19c48622_field_84, &__struct_info__19c48622_field_85, &__struct_info__19c48622_field_86, &__struct_info__19c48622_field_87, &__struct_info__19c48622_field_88, &__struct_info__19c48622_field_89, &__struct_info__19c48622_field_90, &__struct_info__19c48622_field_91, &__struct_info__19c48622_field_92, &__struct_info__19c48622_field_93, &__struct_info__19c48622_field_94, &__struct_info__19c48622_field_95, &__struct_info__19c48622_field_96, &__struct_info__19c48622_field_97, &__struct_info__19c48622_field_98, &__struct_info__19c48622_field_99, &__struct_info__19c48622_field_100, &__struct_info__19c48622_field_101, &__struct_info__19c48622_field_102, &__struct_info__19c48622_field_103, &__struct_info__19c48622_field_104, &__struct_info__19c48622_field_105, &__struct_info__19c48622_field_106, &__struct_info__19c48622_field_107, &__struct_info__19c48622_field_108, &__struct_info__19c48622_field_109, &__struct_info__19c48622_field_110, &__struct_info__19c48622_field_111, &__struct_info__19c48622_field_112, &__struct_info__19c48622_field_113, &__struct_info__19c48622_field_114, &__struct_info__19c48622_field_115, &__struct_info__19c48622_field_116, &__struct_info__19c48622_field_117, &__struct_info__19c48622_field_118, &__struct_info__19c48622_field_119, &__struct_info__19c48622_field_120, &__struct_info__19c48622_field_121, &__struct_info__19c48622_field_122, &__struct_info__19c48622_field_123, &__struct_info__19c48622_field_124, &__struct_info__19c48622_field_125, &__struct_info__19c48622_field_126, &__struct_info__19c48622_field_127, &__struct_info__19c48622_field_128, &__struct_info__19c48622_field_129, &__struct_info__19c48622_field_130, &__struct_info__19c48622_field_131, &__struct_info__19c48622_field_132, &__struct_info__19c48622_field_133, &__struct_info__19c48622_field_134, &__struct_info__19c48622_field_135, &__struct_info__19c48622_field_136, &__struct_info__19c48622_field_137, &__struct_info__19c48622_field_138, &__struct_info__19c48622_field_139, &__struct_info__19c48622_field_140, &__struct_info__19c48622_field_141, &__struct_info__19c48622_field_142, &__struct_info__19c48622_field_143, &__struct_info__19c48622_field_144, &__struct_info__19c48622_field_145, &__struct_info__19c48622_field_146, &__struct_info__19c48622_field_147, &__struct_info__19c48622_field_148, &__struct_info__19c48622_field_149, &__struct_info__19c48622_field_150, &__struct_info__19c48622_field_151, &__struct_info__19c48622_field_152, &__struct_info__19c48622_field_153, &__struct_info__19c48622_field_154, &__struct_info__19c48622_field_155, &__struct_info__19c48622_field_156, &__struct_info__19c48622_field_157, &__struct_info__19c48622_field_158, &__struct_info__19c48622_field_159, &__struct_info__19c48622_field_160, &__struct_info__19c48622_field_161, &__struct_info__19c48622_field_162, &__struct_info__19c48622_field_163, &__struct_info__19c48622_field_164, &__struct_info__19c48622_field_165, &__struct_info__19c48622_field_166, &__struct_info__19c48622_field_167, &__struct_info__19c48622_field_168, &__struct_info__19c48622_field_169, &__struct_info__19c48622_field_170, &__struct_info__19c48622_field_171, &__struct_info__19c48622_field_172, &__struct_info__19c48622_field_173, &__struct_info__19c48622_field_174, &__struct_info__19c48622_field_175, &__struct_info__19c48622_field_176, &__struct_info__19c48622_field_177, &__struct_info__19c48622_field_178, &__struct_info__19c48622_field_179, &__struct_info__19c48622_field_180, &__struct_info__19c48622_field_181, &__struct_info__19c48622_field_182, &__struct_info__19c48622_field_183, &__struct_info__19c48622_field_184, &__struct_info__19c48622_field_185, &__struct_info__19c48622_field_186, &__struct_info__19c48622_field_187, &__struct_info__19c48622_field_188, &__struct_info__19c48622_field_189, &__struct_info__19c48622_field_190, &__struct_info__19c48622_field_191, &__struct_info__19c48622_field_192, &__struct_info__19c48622_field_193, &__struct_info__19c48622_field_194, &__struct_info__19c48622_field_195, &__struct_info__19c48622_field_196, &__struct_info__19c48622_field_197, &__struct_info__19c48622_field_198, &__struct_info__19c48622_field_199, &__struct_info__19c48622_field_200, &__struct_info__19c48622_field_201, &__struct_info__19c48622_field_202, &__struct_info__19c48622_field_203, &__struct_info__19c48622_field_204, &__struct_info__19c48622_field_205, &__struct_info__19c48622_field_206, &__struct_info__19c48622_field_207, &__struct_info__19c48622_field_208, &__struct_info__19c48622_field_209, &__struct_info__19c48622_field_210, &__struct_info__19c48622_field_211, &__struct_info__19c48622_field_212, &__struct_info__19c48622_field_213, &__struct_info__19c48622_field_214, &__struct_info__19c48622_field_215, &__struct_info__19c48622_field_216, &__struct_info__19c48622_field_217, &__struct_info__19c48622_field_218, &__struct_info__19c48622_field_219, &__struct_info__19c48622_field_220, &__struct_info__19c48622_field_221, &__struct_info__19c48622_field_222, &__struct_info__19c48622_field_223, &__struct_info__19c48622_field_224, &__struct_info__19c48622_field_225, &__struct_info__19c48622_field_226, &__struct_info__19c48622_field_227, &__struct_info__19c48622_field_228, &__struct_info__19c48622_field_229, &__struct_info__19c48622_field_230, &__struct_info__19c48622_field_231, &__struct_info__19c48622_field_232, &__struct_info__19c48622_field_233, &__struct_info__19c48622_field_234, &__struct_info__19c48622_field_235, &__struct_info__19c48622_field_236, &__struct_info__19c48622_field_237, &__struct_info__19c48622_field_238, &__struct_info__19c48622_field_239, &__struct_info__19c48622_field_240, &__struct_info__19c48622_field_241, &__struct_info__19c48622_field_242, &__struct_info__19c48622_field_243, &__struct_info__19c48622_field_244, &__struct_info__19c48622_field_245, &__struct_info__19c48622_field_246, &__struct_info__19c48622_field_247, &__struct_info__19c48622_field_248, &__struct_info__19c48622_field_249, &__struct_info__19c48622_field_250, &__struct_info__19c48622_field_251, &__struct_info__19c48622_field_252, &__struct_info__19c48622_field_253, &__struct_info__19c48622_field_254, &__struct_info__19c48622_field_255, &__struct_info__19c48622_field_256, &__struct_info__19c48622_field_257, &__struct_info__19c48622_field_258, &__struct_info__19c48622_field_259, &__struct_info__19c48622_field_260, &__struct_info__19c48622_field_261, &__struct_info__19c48622_field_262, &__struct_info__19c48622_field_263, &__struct_info__19c48622_field_264, &__struct_info__19c48622_field_265, &__struct_info__19c48622_field_266, &__struct_info__19c48622_field_267, &__struct_info__19c48622_field_268, &__struct_info__19c48622_field_269, &__struct_info__19c48622_field_270, &__struct_info__19c48622_field_271, &__struct_info__19c48622_field_272, &__struct_info__19c48622_field_273, &__struct_info__19c48622_field_274, &__struct_info__19c48622_field_275 };
+StructInfo __struct_info__19c48622 = {"StringBuilderVisitor", __struct_info__19c48622_fields, 276, 1200, -1, nullptr, 0x19c48622 };
+VarInfo __func_info__7b90a06c_field_0 =  { Type::tStructure, &__struct_info__594390b9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 46, 0xc9d33bac, "vis", 0 };
+VarInfo * __func_info__7b90a06c_fields[1] =  { &__func_info__7b90a06c_field_0 };
+FuncInfo __func_info__7b90a06c = {"invoke block<(vis:string_builder::StringUsesVisitor const):void> const", "", __func_info__7b90a06c_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x7b90a06c, 0x0 };
+TypeInfo __type_info__10db1c1d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x10db1c1d };
+TypeInfo __type_info__da50b805 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__515c0a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xda50b805 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__f42f651e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStringBuilder"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf42f651e };
+TypeInfo __type_info__dc52e0d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a8d37f6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xdc52e0d5 };
+TypeInfo __type_info__c0e5e0ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstURange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc0e5e0ad };
+TypeInfo __type_info__8bc5634d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__91c4dfb3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8bc5634d };
+TypeInfo __type_info__bab365e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a40a0d70, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xbab365e };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__3737d9d1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeGenerator"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3737d9d1 };
+TypeInfo __type_info__cd849a9b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xcd849a9b };
+TypeInfo __type_info__aaadd575 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeLineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaaadd575 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__aea00813 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xaea00813 };
+TypeInfo __type_info__c2b9b42c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc2b9b42c };
+TypeInfo __type_info__6f381053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprVar"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6f381053 };
+TypeInfo __type_info__261bce6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x261bce6f };
+TypeInfo __type_info__dd644f60 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReturn"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdd644f60 };
+TypeInfo __type_info__e749bd33 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5527f9ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe749bd33 };
+TypeInfo __type_info__73c8114e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dd644f60, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x73c8114e };
+TypeInfo __type_info__7da04467 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4aee91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7da04467 };
+TypeInfo __type_info__b1ceb1d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Value"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb1ceb1d4 };
+TypeInfo __type_info__653ef983 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8da119, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x653ef983 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__1cb4fa6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e97755bb, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1cb4fa6d };
+TypeInfo __type_info__515c0a3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMove"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x515c0a3 };
+TypeInfo __type_info__ccb7c90a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccb7c90a };
+TypeInfo __type_info__b3bcfd53 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb3bcfd53 };
+TypeInfo __type_info__46fed0f3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b867c43d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x46fed0f3 };
+TypeInfo __type_info__523f6667 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x523f6667 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__6d1d425d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b2cb4a2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6d1d425d };
+TypeInfo __type_info__ebcc21eb = { Type::tStructure, &__struct_info__d8299e85, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xebcc21eb };
+TypeInfo __type_info__5ef84086 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStaticAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ef84086 };
+TypeInfo __type_info__7a1c4eb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc0d99dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7a1c4eb7 };
+TypeInfo __type_info__2b3e54e5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBool"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2b3e54e5 };
+TypeInfo __type_info__4de83811 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstPtr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4de83811 };
+TypeInfo __type_info__94ae69a3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aaadd575, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x94ae69a3 };
+TypeInfo __type_info__87a6e894 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ebfa292, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87a6e894 };
+TypeInfo __type_info__a6a527e0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNew"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa6a527e0 };
+TypeInfo __type_info__83498580 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstDouble"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83498580 };
+TypeInfo __type_info__a960d6ab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa960d6ab };
+TypeInfo __type_info__b108e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb108e3 };
+TypeInfo __type_info__d7eb08f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9920ba3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7eb08f1 };
+TypeInfo __type_info__f486e881 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a70d70f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf486e881 };
+TypeInfo __type_info__1683ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1683ec13 };
+TypeInfo __type_info__1d5a02b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6f381053, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1d5a02b1 };
+TypeInfo __type_info__fdd27932 = { Type::tStructure, &__struct_info__5ed6db18, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xfdd27932 };
+TypeInfo __type_info__8f8da119 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprArrayComprehension"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8da119 };
+TypeInfo __type_info__5bc565f1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5bc565f1 };
+TypeInfo __type_info__819d499d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5dc56917, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x819d499d };
+TypeInfo __type_info__81be117c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x81be117c };
+TypeInfo __type_info__b5d7ce5d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ec0323f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb5d7ce5d };
+TypeInfo __type_info__32f7a66b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cae7a171, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32f7a66b };
+TypeInfo __type_info__cae7a171 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDebug"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcae7a171 };
+TypeInfo __type_info__453f3d02 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd57da00, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x453f3d02 };
+TypeInfo __type_info__30023ebb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f6a7cad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x30023ebb };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4edf488d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x4edf488d };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8fce7587 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a1ba446d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fce7587 };
+TypeInfo __type_info__a01f8605 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__721467d3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa01f8605 };
+TypeInfo __type_info__15780d4b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3737d9d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15780d4b };
+TypeInfo __type_info__7ec0323f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLet"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ec0323f };
+TypeInfo __type_info__ae076c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9a5b5986, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xae076c };
+TypeInfo __type_info__ff9fd5d3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xff9fd5d3 };
+TypeInfo __type_info__3c4f7906 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c4f7906 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__c4ccbb7e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83498580, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc4ccbb7e };
+TypeInfo __type_info__d7e06fbf = { Type::tStructure, &__struct_info__b118e316, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xd7e06fbf };
+TypeInfo __type_info__8e3dc326 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a65edd74, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8e3dc326 };
+TypeInfo __type_info__d73ee2dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Variable"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd73ee2dd };
+TypeInfo __type_info__72ae9081 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccc9122b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72ae9081 };
+TypeInfo __type_info__c831b26a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTryCatch"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc831b26a };
+TypeInfo __type_info__72374920 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__26379cda, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72374920 };
+TypeInfo __type_info__d25748d6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4fa9a2d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd25748d6 };
+TypeInfo __type_info__3a70d70f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprContinue"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a70d70f };
+TypeInfo __type_info__7c510f91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDelete"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7c510f91 };
+TypeInfo __type_info__b66d9ef1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8121e453, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb66d9ef1 };
+TypeInfo __type_info__91c4dfb3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprClone"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x91c4dfb3 };
+TypeInfo __type_info__15e14f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1d3d6764, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15e14f92 };
+TypeInfo __type_info__ebc70931 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeArray"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xebc70931 };
+TypeInfo __type_info__3c8fd4b4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8728109a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c8fd4b4 };
+TypeInfo __type_info__17259f57 = { Type::tStructure, &__struct_info__45b20104, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x17259f57 };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__7ebfa292 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWith"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ebfa292 };
+TypeInfo __type_info__9773df12 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9773df12 };
+TypeInfo __type_info__317f8d25 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::FieldDeclaration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x317f8d25 };
+TypeInfo __type_info__3c6fa07f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5bc565f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c6fa07f };
+TypeInfo __type_info__9920ba3b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9920ba3b };
+TypeInfo __type_info__8f234b97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6cb0399, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f234b97 };
+TypeInfo __type_info__87882376 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4f3571c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87882376 };
+TypeInfo __type_info__5f6a7cad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBreak"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f6a7cad };
+TypeInfo __type_info__10b7decc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c831b26a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10b7decc };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8494e015 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLooksLikeCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8494e015 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b867c43d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCast"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb867c43d };
+TypeInfo __type_info__9e20c21a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9e20c21a };
+TypeInfo __type_info__b9491240 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf57dd26, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9491240 };
+TypeInfo __type_info__963c776b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0e5e0ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x963c776b };
+TypeInfo __type_info__b58fe8a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a527e0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb58fe8a6 };
+TypeInfo __type_info__5527f9ed = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFor"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5527f9ed };
+TypeInfo __type_info__fba33907 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8494e015, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfba33907 };
+TypeInfo __type_info__51c55633 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x51c55633 };
+TypeInfo __type_info__84917dd0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d00bb3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x84917dd0 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__68f47b8a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__251bccdc, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x68f47b8a };
+TypeInfo __type_info__34157e23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__309172d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x34157e23 };
+TypeInfo __type_info__37ca469d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27a9a437, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x37ca469d };
+TypeInfo __type_info__14c14bf4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c627fc0a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x14c14bf4 };
+TypeInfo __type_info__4fa9a2d8 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSwizzle"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4fa9a2d8 };
+TypeInfo __type_info__d4f3571c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLabel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4f3571c };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__10edfe53 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8b0275, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10edfe53 };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__2481035b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f20c3ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2481035b };
+TypeInfo __type_info__a1ba446d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprGoto"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa1ba446d };
+TypeInfo __type_info__9fee7340 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f1bdc9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9fee7340 };
+TypeInfo __type_info__ada7aa90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstString"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xada7aa90 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__664a2fe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374bcd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x664a2fe7 };
+TypeInfo __type_info__655bd8a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f66d4d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x655bd8a4 };
+TypeInfo __type_info__2f1bdc9a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2f1bdc9a };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__5dc56917 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5dc56917 };
+TypeInfo __type_info__d16acbbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b3e54e5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd16acbbb };
+TypeInfo __type_info__d4aee91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFind"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4aee91 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__d057deb9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd057deb9 };
+TypeInfo __type_info__6dd946fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x6dd946fa };
+TypeInfo __type_info__32b24044 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32b24044 };
+TypeInfo __type_info__531e5432 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7df5ef2c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x531e5432 };
+TypeInfo __type_info__e0a995b4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Enumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe0a995b4 };
+TypeInfo __type_info__368fac4c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__231bc9b6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x368fac4c };
+TypeInfo __type_info__76b8ad03 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprYield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76b8ad03 };
+TypeInfo __type_info__48d9d78 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c4f7906, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x48d9d78 };
+TypeInfo __type_info__6535171f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIfThenElse"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6535171f };
+TypeInfo __type_info__9ee277f5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAddr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9ee277f5 };
+TypeInfo __type_info__e7b89eff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__10db1c1d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe7b89eff };
+TypeInfo __type_info__8f8b0275 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8b0275 };
+TypeInfo __type_info__764dc75a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b1ceb1d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x764dc75a };
+TypeInfo __type_info__e2deda56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ada7aa90, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe2deda56 };
+TypeInfo __type_info__5a28d785 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprKeyExists"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5a28d785 };
+TypeInfo __type_info__9445fbcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7c510f91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9445fbcf };
+TypeInfo __type_info__7df5ef2c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7df5ef2c };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__6c2a86f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bcfd53, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6c2a86f9 };
+TypeInfo __type_info__e97755bb = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWhile"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe97755bb };
+TypeInfo __type_info__295e937b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4de83811, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x295e937b };
+TypeInfo __type_info__1d3d6764 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBitfield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1d3d6764 };
+TypeInfo __type_info__251bccdc = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x251bccdc };
+TypeInfo __type_info__bd757ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeTuple"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbd757ca };
+TypeInfo __type_info__5ac5645e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ac5645e };
+TypeInfo __type_info__e4d4c1e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccb7c90a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe4d4c1e4 };
+TypeInfo __type_info__d514cba4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprErase"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd514cba4 };
+TypeInfo __type_info__60d19370 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e20c21a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x60d19370 };
+TypeInfo __type_info__c5ddc6fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d514cba4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc5ddc6fa };
+TypeInfo __type_info__9f20c3ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9f20c3ad };
+TypeInfo __type_info__1b3c6d8d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1b3c6d8d };
+TypeInfo __type_info__6529db2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1b3c6d8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6529db2b };
+TypeInfo __type_info__a8d37f6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNullCoalescing"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa8d37f6f };
+TypeInfo __type_info__d7ddca10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ef84086, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7ddca10 };
+TypeInfo __type_info__130d26f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__51c55633, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x130d26f9 };
+TypeInfo __type_info__721467d3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x721467d3 };
+TypeInfo __type_info__8728109a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIs"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8728109a };
+TypeInfo __type_info__1bb5fdf7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ebc70931, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1bb5fdf7 };
+TypeInfo __type_info__a65edd74 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstEnumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa65edd74 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__5ca338ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6535171f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x5ca338ad };
+TypeInfo __type_info__d180e781 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b8ad03, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd180e781 };
+TypeInfo __type_info__74b0f2db = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Ptr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74b0f2db };
+TypeInfo __type_info__cf57dd26 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcf57dd26 };
+TypeInfo __type_info__535415eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9338185, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x535415eb };
+TypeInfo __type_info__ccc9122b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccc9122b };
+TypeInfo __type_info__b2cb4a2b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCopy"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb2cb4a2b };
+TypeInfo __type_info__a5b6b194 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ac5645e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa5b6b194 };
+TypeInfo __type_info__ccee123b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a28d785, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xccee123b };
+TypeInfo __type_info__374b4b09 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::MakeFieldDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374b4b09 };
+TypeInfo __type_info__9338185 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMemZero"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9338185 };
+TypeInfo __type_info__cf52b1be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c2b9b42c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf52b1be };
+TypeInfo __type_info__b049b391 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xb049b391 };
+TypeInfo __type_info__9a5b5986 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprInvoke"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9a5b5986 };
+TypeInfo __type_info__7856e79d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::TypeDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7856e79d };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__5f1adc0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeContext"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f1adc0e };
+TypeInfo __type_info__ab082dc2 = { Type::tStructure, &__struct_info__594390b9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xab082dc2 };
+TypeInfo __type_info__cd57da00 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp1"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcd57da00 };
+TypeInfo __type_info__a8981616 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa8981616 };
+TypeInfo __type_info__88de8728 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9773df12, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x88de8728 };
+TypeInfo __type_info__1b9f61f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd757ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1b9f61f8 };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__231bc9b6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x231bc9b6 };
+TypeInfo __type_info__8121e453 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNamedCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8121e453 };
+TypeInfo __type_info__d3ebcc43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xd3ebcc43 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__d8ac9e75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__261bce6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd8ac9e75 };
+TypeInfo __type_info__fc0d99dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConst"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xfc0d99dd };
+TypeInfo __type_info__386c90cf = { Type::tStructure, &__struct_info__19c48622, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x386c90cf };
+TypeInfo __type_info__c1e3d526 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__858d2368, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc1e3d526 };
+TypeInfo __type_info__c627fc0a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstRange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc627fc0a };
+TypeInfo __type_info__a40a0d70 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAscend"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa40a0d70 };
+TypeInfo __type_info__858d2368 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprUnsafe"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x858d2368 };
+TypeInfo __type_info__26379cda = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprQuote"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x26379cda };
+TypeInfo __type_info__c6cb0399 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc6cb0399 };
+TypeInfo __type_info__f66d4d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf66d4d6 };
+TypeInfo __type_info__fe4bfa47 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9ee277f5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfe4bfa47 };
+TypeInfo __type_info__cb3ec93c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f1adc0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcb3ec93c };
+TypeInfo __type_info__27a9a437 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprPtr2Ref"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x27a9a437 };
+TypeInfo __type_info__374bcd9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374bcd9 };
+TypeInfo __type_info__39dd41c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__74b0f2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x39dd41c1 };
+TypeInfo __type_info__d00bb3d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd00bb3d6 };
+TypeInfo __type_info__f1eeff10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f42f651e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf1eeff10 };
+TypeInfo __type_info__b081465d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb081465d };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+TypeInfo __type_info__cf76cec3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b081465d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf76cec3 };
+TypeInfo __type_info__ed20bab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d057deb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xed20bab };
+TypeInfo __type_info__309172d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeStruct"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x309172d };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_1[1] = { &__type_info__e8c29053 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+namespace ast {
+
+struct AstPassMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(AstPassMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstPassMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==1096,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+}
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace string_builder {
+
+struct StringUsesVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	uint64_t variable;
+	int32_t uses;
+	int32_t appends;
+	int32_t inBlock;
+	int32_t usesInBlock;
+	bool hasJumps;
+};
+static_assert(sizeof(StringUsesVisitor)==1128,"structure size mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,variable)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,uses)==1104,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,appends)==1108,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,inBlock)==1112,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,usesInBlock)==1116,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringUsesVisitor,hasJumps)==1120,"structure field offset mismatch with DAS");
+}
+namespace string_builder {
+
+struct AppendToWriteVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	uint64_t variable;
+};
+static_assert(sizeof(AppendToWriteVisitor)==1104,"structure size mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(AppendToWriteVisitor,variable)==1096,"structure field offset mismatch with DAS");
+}
+namespace string_builder {
+
+struct StringBuilderVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	TTable<uint64_t,uint64_t> loops;
+	TTable<uint64_t,char *> names;
+	bool astChanged;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,string_builder::StringBuilderVisitor,smart_ptr_raw<Expression> const )) rewrite;
+};
+static_assert(sizeof(StringBuilderVisitor)==1200,"structure size mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,loops)==1096,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,names)==1144,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,astChanged)==1192,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderVisitor,rewrite)==1196,"structure field offset mismatch with DAS");
+}
+namespace string_builder {
+
+struct StringBuilderInferMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstPassMacro)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const )) apply;
+};
+static_assert(sizeof(StringBuilderInferMacro)==16,"structure size mismatch with DAS");
+static_assert(offsetof(StringBuilderInferMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderInferMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(StringBuilderInferMacro,apply)==12,"structure field offset mismatch with DAS");
+}
+
+inline string_builder::AppendToWriteVisitor AppendToWriteVisitor_b4f0da15d0fa50a2 ( Context * __context__, uint64_t __v_rename_at_103 );
+inline void _FuncAppendToWriteVisitor_0x27___finalize_9afd1b2fb5c73cfe ( Context * __context__, string_builder::AppendToWriteVisitor & __self_rename_at_101 );
+inline void _FuncAppendToWriteVisitor_0x60_AppendToWriteVisitor_794949eadc7c1fa6 ( Context * __context__, string_builder::AppendToWriteVisitor & __self_rename_at_103, uint64_t __v_rename_at_103 );
+inline smart_ptr_raw<Expression> _FuncAppendToWriteVisitor_0x60_visitExprOp2_7dad2a5678061571 ( Context * __context__, string_builder::AppendToWriteVisitor & __self_rename_at_105, smart_ptr_raw<ExprOp2> const  __expr_rename_at_105 );
+inline string_builder::StringBuilderInferMacro StringBuilderInferMacro_7470df19290a5aee ( Context * __context__ );
+inline void _FuncStringBuilderInferMacro_0x27___finalize_b0c1f166a84b4180 ( Context * __context__, string_builder::StringBuilderInferMacro & __self_rename_at_195 );
+inline bool _FuncStringBuilderInferMacro_0x60_apply_75cfe75a61a9f971 ( Context * __context__, string_builder::StringBuilderInferMacro & __self_rename_at_196, smart_ptr_raw<Program> const  __prog_rename_at_196, Module * const  __mod_rename_at_196 );
+inline string_builder::StringBuilderVisitor StringBuilderVisitor_b552109856710f57 ( Context * __context__ );
+inline void _FuncStringBuilderVisitor_0x27___finalize_6644a959ac1ec9d4 ( Context * __context__, string_builder::StringBuilderVisitor & __self_rename_at_142 );
+inline void _FuncStringBuilderVisitor_0x60_preVisitExprBlock_96c81000459ef6d7 ( Context * __context__, string_builder::StringBuilderVisitor & __self_rename_at_146, smart_ptr_raw<ExprBlock> const  __blk_rename_at_146 );
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_rewrite_3cc5fc57b14306ba ( Context * __context__, string_builder::StringBuilderVisitor & __self_rename_at_178, smart_ptr_raw<Expression> const  __expr_rename_at_178 );
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_visitExprFor_ff1393d925de13fa ( Context * __context__, string_builder::StringBuilderVisitor & __self_rename_at_187, smart_ptr_raw<ExprFor> const  __expr_rename_at_187 );
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_visitExprWhile_1453a73c0f5e8c32 ( Context * __context__, string_builder::StringBuilderVisitor & __self_rename_at_190, smart_ptr_raw<ExprWhile> const  __expr_rename_at_190 );
+inline string_builder::StringUsesVisitor StringUsesVisitor_dbd560a23ffae601 ( Context * __context__, uint64_t __v_rename_at_52 );
+inline void _FuncStringUsesVisitor_0x27___finalize_52db14a3bc533058 ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_45 );
+inline void _FuncStringUsesVisitor_0x60_StringUsesVisitor_5f534b63ba7b4b43 ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_52, uint64_t __v_rename_at_52 );
+inline void _FuncStringUsesVisitor_0x60_preVisitExprMakeBlock_abcffafdf8c64d7d ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_54, smart_ptr_raw<ExprMakeBlock> const  __expr_rename_at_54 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprGoto_7a5a42d09800a14d ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_84, smart_ptr_raw<ExprGoto> const  __expr_rename_at_84 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprLabel_b2ff45b8debadf67 ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_80, smart_ptr_raw<ExprLabel> const  __expr_rename_at_80 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprMakeBlock_3a27eb3fbbb7cd57 ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_56, smart_ptr_raw<ExprMakeBlock> const  __expr_rename_at_56 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprOp2_eabb200dec8e5ec6 ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_67, smart_ptr_raw<ExprOp2> const  __expr_rename_at_67 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprReturn_12483364c5cba1cd ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_72, smart_ptr_raw<ExprReturn> const  __expr_rename_at_72 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprVar_c7e735a11b391dff ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_60, smart_ptr_raw<ExprVar> const  __expr_rename_at_60 );
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprYield_944209e8fc774fcd ( Context * __context__, string_builder::StringUsesVisitor & __self_rename_at_76, smart_ptr_raw<ExprYield> const  __expr_rename_at_76 );
+inline void __setup_macros_bd01add938277519 ( Context * __context__ );
+inline void _Funcast_0x60_add_new_infer_macro_2bee8646e2c834ce ( Context * __context__, char * const  __name_rename_at_535, string_builder::StringBuilderInferMacro * const  __someClassPtr_rename_at_535 );
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_a0a98944386de804 ( Context * __context__, char * const  __name_rename_at_489, string_builder::StringBuilderInferMacro * const  __someClassPtr_rename_at_489 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_74629f81ac3a7882 ( Context * __context__, string_builder::AppendToWriteVisitor const  & __someClass_rename_at_463 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_73bce4dd66cb181a ( Context * __context__, string_builder::StringBuilderVisitor const  & __someClass_rename_at_463 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_a32e1bc6c19e7365 ( Context * __context__, string_builder::StringUsesVisitor const  & __someClass_rename_at_463 );
+inline smart_ptr_raw<ExprFor> _Funcbuiltin_0x60_clone_to_move_5a75ab233571f42 ( Context * __context__, smart_ptr_raw<ExprFor> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprGoto> _Funcbuiltin_0x60_clone_to_move_a396e21d765055bc ( Context * __context__, smart_ptr_raw<ExprGoto> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprLabel> _Funcbuiltin_0x60_clone_to_move_7542b9f40dfea432 ( Context * __context__, smart_ptr_raw<ExprLabel> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_clone_to_move_f384ac1b7dbd750a ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprOp2> _Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e ( Context * __context__, smart_ptr_raw<ExprOp2> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprReturn> _Funcbuiltin_0x60_clone_to_move_8bbc8567a5eb65b8 ( Context * __context__, smart_ptr_raw<ExprReturn> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprVar> _Funcbuiltin_0x60_clone_to_move_cc5e805de8822086 ( Context * __context__, smart_ptr_raw<ExprVar> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprWhile> _Funcbuiltin_0x60_clone_to_move_91a637c713bfda76 ( Context * __context__, smart_ptr_raw<ExprWhile> const  __clone_src_rename_at_131 );
+inline smart_ptr_raw<ExprYield> _Funcbuiltin_0x60_clone_to_move_49806a8148c2fa3e ( Context * __context__, smart_ptr_raw<ExprYield> const  __clone_src_rename_at_131 );
+inline smart_ptr<Expression> _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c ( Context * __context__, smart_ptr<Expression> const  __clone_src_rename_at_131 );
+inline bool _Funcbuiltin_0x60_erase_579e8fa517c56af0 ( Context * __context__, TTable<uint64_t,uint64_t> & __Tab_rename_at_117, uint64_t __at_rename_at_117 );
+inline void _Funcbuiltin_0x60_finalize_f37d4ac5c207eb29 ( Context * __context__, TArray<uint64_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_636ee68bd69a663 ( Context * __context__, TTable<uint64_t,bool> & __a_rename_at_193 );
+inline void _Funcbuiltin_0x60_finalize_5a3ce0cbe6506aed ( Context * __context__, TTable<uint64_t,char *> & __a_rename_at_193 );
+inline void _Funcbuiltin_0x60_finalize_4ca2d3474401c9e8 ( Context * __context__, TTable<uint64_t,uint64_t> & __a_rename_at_193 );
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_436 );
+inline Variable * _Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1 ( Context * __context__, smart_ptr<Variable> const  __src_rename_at_436 );
+inline uint64_t _Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62 ( Context * __context__, void * const  __p_rename_at_14 );
+inline bool _Funcbuiltin_0x60_key_exists_4a91f3d528cd0b5c ( Context * __context__, TTable<uint64_t,uint64_t> const  & __Tab_rename_at_120, uint64_t __at_rename_at_120 );
+inline void _Funcbuiltin_0x60_push_79cbd1abccb478fa ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_37, uint64_t __value_rename_at_37 );
+inline void clone_191e06f3c4959062 ( Context * __context__, smart_ptr_raw<ExprFor> & __dest_rename_at_133, smart_ptr_raw<ExprFor> const  __src_rename_at_133 );
+inline void clone_e07fad9332806458 ( Context * __context__, smart_ptr_raw<ExprGoto> & __dest_rename_at_133, smart_ptr_raw<ExprGoto> const  __src_rename_at_133 );
+inline void clone_4e1b8fbdb6738bdc ( Context * __context__, smart_ptr_raw<ExprLabel> & __dest_rename_at_133, smart_ptr_raw<ExprLabel> const  __src_rename_at_133 );
+inline void clone_aec10616fd5b444a ( Context * __context__, smart_ptr_raw<ExprMakeBlock> & __dest_rename_at_133, smart_ptr_raw<ExprMakeBlock> const  __src_rename_at_133 );
+inline void clone_3e90c0416b52aea2 ( Context * __context__, smart_ptr_raw<ExprOp2> & __dest_rename_at_133, smart_ptr_raw<ExprOp2> const  __src_rename_at_133 );
+inline void clone_f0e657de8b674384 ( Context * __context__, smart_ptr_raw<ExprReturn> & __dest_rename_at_133, smart_ptr_raw<ExprReturn> const  __src_rename_at_133 );
+inline void clone_64235a2e81a29ca2 ( Context * __context__, smart_ptr_raw<ExprVar> & __dest_rename_at_133, smart_ptr_raw<ExprVar> const  __src_rename_at_133 );
+inline void clone_6049b13e6b5756ca ( Context * __context__, smart_ptr_raw<ExprWhile> & __dest_rename_at_133, smart_ptr_raw<ExprWhile> const  __src_rename_at_133 );
+inline void clone_59a23e5de9b83832 ( Context * __context__, smart_ptr_raw<ExprYield> & __dest_rename_at_133, smart_ptr_raw<ExprYield> const  __src_rename_at_133 );
+inline void clone_22814dfdde58cf4b ( Context * __context__, smart_ptr_raw<Expression> & __dest_rename_at_165, void * const  __src_rename_at_165 );
+inline void clone_5587e1b0c7901e78 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_133, smart_ptr<Expression> const  __src_rename_at_133 );
+inline void collect_uses_58c99723fdbaef97 ( Context * __context__, smart_ptr_raw<Expression> __expr_rename_at_90, uint64_t __v_rename_at_90, Block DAS_COMMENT((void,string_builder::StringUsesVisitor const )) const  & __blk_rename_at_90 );
+inline void finalize_c0e697c73a7686a3 ( Context * __context__, string_builder::AppendToWriteVisitor * & ____this_rename_at_126 );
+inline void finalize_2a14994fe3aa1a4f ( Context * __context__, string_builder::StringBuilderVisitor * & ____this_rename_at_203 );
+inline void finalize_9be5be037088d35e ( Context * __context__, string_builder::StringUsesVisitor * & ____this_rename_at_97 );
+inline void finalize_c8f05aa8f6e751ae ( Context * __context__, string_builder::AppendToWriteVisitor & ____this_rename_at_101 );
+inline void finalize_83a05150eb13834c ( Context * __context__, string_builder::StringBuilderInferMacro & ____this_rename_at_195 );
+inline void finalize_3bc91361025a1604 ( Context * __context__, string_builder::StringBuilderVisitor & ____this_rename_at_142 );
+inline void finalize_711c4303fdeefc8f ( Context * __context__, string_builder::StringUsesVisitor & ____this_rename_at_45 );
+inline bool is_append_to_581a0025fff850d ( Context * __context__, smart_ptr_raw<ExprOp2> const  __expr_rename_at_36, uint64_t __variable_rename_at_36 );
+inline bool is_string_local_e6009ba2eb47ce6b ( Context * __context__, smart_ptr_raw<Variable> const  __v_rename_at_31 );
+inline smart_ptr_raw<Expression> make_builder_loop_b6dbe89a94bed06e ( Context * __context__, smart_ptr_raw<Expression> const  __loop_rename_at_118, uint64_t __v_rename_at_118, char * const  __vname_rename_at_118 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_4825600d2240c795 ( Context * __context__, string_builder::StringBuilderInferMacro const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	__setup_macros_bd01add938277519(__context__);
+}
+
+inline string_builder::AppendToWriteVisitor AppendToWriteVisitor_b4f0da15d0fa50a2 ( Context * __context__, uint64_t __v_rename_at_103 )
+{
+	string_builder::AppendToWriteVisitor __self_rename_at_103; das_zero(__self_rename_at_103); das_move(__self_rename_at_103, (([&]() -> string_builder::AppendToWriteVisitor {
+		string_builder::AppendToWriteVisitor __mks_103;
+		das_zero(__mks_103);
+		das_copy((__mks_103.__rtti),(((void *)(&__type_info__d7e06fbf))));
+		das_copy((__mks_103.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::AppendToWriteVisitor'__finalize AppendToWriteVisitor*/ 3039799401u)))));
+		das_copy((__mks_103.visitExprOp2),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::AppendToWriteVisitor`visitExprOp2 AppendToWriteVisitor #smart_ptr##handle#ExprOp2#const*/ 1171520247u)))));
+		return __mks_103;
+	})()));
+	_FuncAppendToWriteVisitor_0x60_AppendToWriteVisitor_794949eadc7c1fa6(__context__,das_arg<string_builder::AppendToWriteVisitor>::pass(__self_rename_at_103),__v_rename_at_103);
+	return /* <- */ das_auto_cast<string_builder::AppendToWriteVisitor>::cast(__self_rename_at_103);
+}
+
+inline void _FuncAppendToWriteVisitor_0x27___finalize_9afd1b2fb5c73cfe ( Context * __context__, string_builder::AppendToWriteVisitor &  __self_rename_at_101 )
+{
+	finalize_c8f05aa8f6e751ae(__context__,das_arg<string_builder::AppendToWriteVisitor>::pass(__self_rename_at_101));
+}
+
+inline void _FuncAppendToWriteVisitor_0x60_AppendToWriteVisitor_794949eadc7c1fa6 ( Context * __context__, string_builder::AppendToWriteVisitor &  __self_rename_at_103, uint64_t __v_rename_at_103 )
+{
+	das_copy(__self_rename_at_103.variable,__v_rename_at_103);
+}
+
+inline smart_ptr_raw<Expression> _FuncAppendToWriteVisitor_0x60_visitExprOp2_7dad2a5678061571 ( Context * __context__, string_builder::AppendToWriteVisitor &  __self_rename_at_105, smart_ptr_raw<ExprOp2> const  __expr_rename_at_105 ) { das_stack_prologue __prologue(__context__,224,"AppendToWriteVisitor`visitExprOp2 " DAS_FILE_LINE);
+{
+	if ( is_append_to_581a0025fff850d(__context__,__expr_rename_at_105,__self_rename_at_105.variable) )
+	{
+		smart_ptr_raw<ExprCall> __cll_rename_at_107; das_zero(__cll_rename_at_107); das_move(__cll_rename_at_107, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_107) {
+			das_copy((__mks_107.at /*at*/),(__expr_rename_at_105->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_107.name /*name*/),((char *) "write"));
+			}		}))));
+		das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprVar>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_107->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_108) {
+			das_copy((__mks_108.at /*at*/),(__expr_rename_at_105->at /*at*/));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_108.name /*name*/),((char *) "string_builder_writer"));
+			}		})))));
+		das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr<Expression>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__cll_rename_at_107->arguments /*arguments*/),clone_expression(__expr_rename_at_105->right /*right*/));
+		return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__cll_rename_at_107);
+	} else {
+		smart_ptr_raw<Expression> __res_rename_at_111; das_zero(__res_rename_at_111); das_move(__res_rename_at_111, _Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e(__context__,__expr_rename_at_105));
+		return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_111);
+	};
+}}
+
+inline string_builder::StringBuilderInferMacro StringBuilderInferMacro_7470df19290a5aee ( Context * __context__ )
+{
+	return das_auto_cast<string_builder::StringBuilderInferMacro>::cast((([&]() -> string_builder::StringBuilderInferMacro {
+		string_builder::StringBuilderInferMacro __mks_195;
+		das_copy((__mks_195.__rtti),(((void *)(&__type_info__17259f57))));
+		das_copy((__mks_195.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstPassMacro))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderInferMacro'__finalize StringBuilderInferMacro*/ 2264934443u)))));
+		das_copy((__mks_195.apply),(das_cast<Func DAS_COMMENT((bool,ast::AstPassMacro,smart_ptr_raw<Program> const ,Module * const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderInferMacro`apply StringBuilderInferMacro #smart_ptr##handle#Program#const #ptr##handle#Module#const*/ 1942341396u)))));
+		return __mks_195;
+	})()));
+}
+
+inline void _FuncStringBuilderInferMacro_0x27___finalize_b0c1f166a84b4180 ( Context * __context__, string_builder::StringBuilderInferMacro &  __self_rename_at_195 )
+{
+	finalize_83a05150eb13834c(__context__,das_arg<string_builder::StringBuilderInferMacro>::pass(__self_rename_at_195));
+}
+
+inline bool _FuncStringBuilderInferMacro_0x60_apply_75cfe75a61a9f971 ( Context * __context__, string_builder::StringBuilderInferMacro &  __self_rename_at_196, smart_ptr_raw<Program> const  __prog_rename_at_196, Module * const  __mod_rename_at_196 )
+{
+	string_builder::StringBuilderVisitor * __astVisitor_rename_at_197 = das_new<string_builder::StringBuilderVisitor>::make_and_init(__context__,[&]() { return StringBuilderVisitor_b552109856710f57(__context__); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_198; das_zero(__astVisitorAdapter_rename_at_198); das_move(__astVisitorAdapter_rename_at_198, _Funcast_0x60_make_visitor_73bce4dd66cb181a(__context__,das_arg<string_builder::StringBuilderVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_197))));
+	astVisit(__prog_rename_at_196,__astVisitorAdapter_rename_at_198);
+	bool __result_rename_at_200 = ((bool)__astVisitor_rename_at_197->astChanged);
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_198);
+	finalize_2a14994fe3aa1a4f(__context__,__astVisitor_rename_at_197);
+	return das_auto_cast<bool>::cast(__result_rename_at_200);
+}
+
+inline string_builder::StringBuilderVisitor StringBuilderVisitor_b552109856710f57 ( Context * __context__ )
+{
+	return /* <- */ das_auto_cast<string_builder::StringBuilderVisitor>::cast((([&]() -> string_builder::StringBuilderVisitor {
+		string_builder::StringBuilderVisitor __mks_142;
+		das_zero(__mks_142);
+		das_copy((__mks_142.__rtti),(((void *)(&__type_info__386c90cf))));
+		das_copy((__mks_142.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderVisitor'__finalize StringBuilderVisitor*/ 2581517765u)))));
+		das_copy((__mks_142.preVisitExprBlock),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderVisitor`preVisitExprBlock StringBuilderVisitor #smart_ptr##handle#ExprBlock#const*/ 4122553174u)))));
+		das_copy((__mks_142.visitExprWhile),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderVisitor`visitExprWhile StringBuilderVisitor #smart_ptr##handle#ExprWhile#const*/ 1692020139u)))));
+		das_copy((__mks_142.visitExprFor),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderVisitor`visitExprFor StringBuilderVisitor #smart_ptr##handle#ExprFor#const*/ 369170451u)))));
+		das_copy((__mks_142.astChanged),(false));
+		das_copy((__mks_142.rewrite),(Func(__context__->fnIdxByMangledName(/*@string_builder::StringBuilderVisitor`rewrite StringBuilderVisitor #smart_ptr##handle#Expression#const*/ 3494666848u))));
+		return __mks_142;
+	})()));
+}
+
+inline void _FuncStringBuilderVisitor_0x27___finalize_6644a959ac1ec9d4 ( Context * __context__, string_builder::StringBuilderVisitor &  __self_rename_at_142 )
+{
+	finalize_3bc91361025a1604(__context__,das_arg<string_builder::StringBuilderVisitor>::pass(__self_rename_at_142));
+}
+
+inline void _FuncStringBuilderVisitor_0x60_preVisitExprBlock_96c81000459ef6d7 ( Context * __context__, string_builder::StringBuilderVisitor &  __self_rename_at_146, smart_ptr_raw<ExprBlock> const  __blk_rename_at_146 ) { das_stack_prologue __prologue(__context__,384,"StringBuilderVisitor`preVisitExprBlock " DAS_FILE_LINE);
+{
+	TArray<uint64_t> __candidates_rename_at_147; das_zero(__candidates_rename_at_147);
+	TTable<uint64_t,bool> __captured_rename_at_148; das_zero(__captured_rename_at_148);
+	{
+		bool __need_loop_149 = true;
+		// stmt : smart_ptr<ast::Expression> const&
+		das_iterator<das::vector<smart_ptr<Expression>> const > __stmt_iterator(__blk_rename_at_146->list /*list*/);
+		smart_ptr<Expression> const  * __stmt_rename_at_149;
+		__need_loop_149 = __stmt_iterator.first(__context__,(__stmt_rename_at_149)) && __need_loop_149;
+		for ( ; __need_loop_149 ; __need_loop_149 = __stmt_iterator.next(__context__,(__stmt_rename_at_149)) )
+		{
+			if ( SimPolicy<char *>::Equ(cast<char *>::from((*__stmt_rename_at_149)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprLet")),*__context__) )
+			{
+				ExprLet * __elet_rename_at_152 = ((ExprLet *)das_cast<ExprLet *>::cast((*__stmt_rename_at_149)));
+				{
+					bool __need_loop_153 = true;
+					// v : smart_ptr<ast::Variable> const&
+					das_iterator<das::vector<smart_ptr<Variable>> const > __v_iterator(__elet_rename_at_152->variables /*variables*/);
+					smart_ptr<Variable> const  * __v_rename_at_153;
+					__need_loop_153 = __v_iterator.first(__context__,(__v_rename_at_153)) && __need_loop_153;
+					for ( ; __need_loop_153 ; __need_loop_153 = __v_iterator.next(__context__,(__v_rename_at_153)) )
+					{
+						if ( is_string_local_e6009ba2eb47ce6b(__context__,(*__v_rename_at_153)) )
+						{
+							uint64_t __vid_rename_at_155 = ((uint64_t)_Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62(__context__,das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1(__context__,(*__v_rename_at_153)))));
+							_Funcbuiltin_0x60_push_79cbd1abccb478fa(__context__,das_arg<TArray<uint64_t>>::pass(__candidates_rename_at_147),__vid_rename_at_155);
+							das_copy(__self_rename_at_146.names(__vid_rename_at_155,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string const  &>::from((*__v_rename_at_153)->name /*name*/))));
+						};
+					}
+					__v_iterator.close(__context__,(__v_rename_at_153));
+				};
+			} else if ( (SimPolicy<char *>::Equ(cast<char *>::from((*__stmt_rename_at_149)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprFor")),*__context__)) || (SimPolicy<char *>::Equ(cast<char *>::from((*__stmt_rename_at_149)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprWhile")),*__context__)) )
+			{
+				{
+					bool __need_loop_159 = true;
+					// v : uint64&
+					das_iterator<TArray<uint64_t>> __v_iterator(__candidates_rename_at_147);
+					uint64_t * __v_rename_at_159;
+					__need_loop_159 = __v_iterator.first(__context__,(__v_rename_at_159)) && __need_loop_159;
+					for ( ; __need_loop_159 ; __need_loop_159 = __v_iterator.next(__context__,(__v_rename_at_159)) )
+					{
+						if ( !__builtin_table_key_exists(__context__,__captured_rename_at_148,(*__v_rename_at_159)) )
+						{
+							bool __ok_rename_at_161 = false;
+							smart_ptr_raw<Expression> __sstmt_rename_at_162; das_zero(__sstmt_rename_at_162); das_move(__sstmt_rename_at_162, _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c(__context__,(*__stmt_rename_at_149)));
+							collect_uses_58c99723fdbaef97(__context__,__sstmt_rename_at_162,(*__v_rename_at_159),das_make_block<void,string_builder::StringUsesVisitor const  &>(__context__,272,0,&__func_info__7b90a06c,[&](string_builder::StringUsesVisitor const  & __vis_rename_at_163)->void{
+								das_copy(__ok_rename_at_161,((__vis_rename_at_163.appends > 0) && (__vis_rename_at_163.uses == __vis_rename_at_163.appends)) && !(__vis_rename_at_163.hasJumps));
+							}));
+							clone_22814dfdde58cf4b(__context__,__sstmt_rename_at_162,nullptr);
+							if ( __ok_rename_at_161 )
+							{
+								das_copy(__self_rename_at_146.loops(_Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62(__context__,das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,(*__stmt_rename_at_149)))),__context__),(*__v_rename_at_159));
+								break;
+							};
+						};
+					}
+					__v_iterator.close(__context__,(__v_rename_at_159));
+				};
+			};
+			{
+				bool __need_loop_170 = true;
+				// v : uint64&
+				das_iterator<TArray<uint64_t>> __v_iterator(__candidates_rename_at_147);
+				uint64_t * __v_rename_at_170;
+				__need_loop_170 = __v_iterator.first(__context__,(__v_rename_at_170)) && __need_loop_170;
+				for ( ; __need_loop_170 ; __need_loop_170 = __v_iterator.next(__context__,(__v_rename_at_170)) )
+				{
+					smart_ptr_raw<Expression> __sstmt_rename_at_171; das_zero(__sstmt_rename_at_171); das_move(__sstmt_rename_at_171, _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c(__context__,(*__stmt_rename_at_149)));
+					collect_uses_58c99723fdbaef97(__context__,__sstmt_rename_at_171,(*__v_rename_at_170),das_make_block<void,string_builder::StringUsesVisitor const  &>(__context__,368,0,&__func_info__7b90a06c,[&](string_builder::StringUsesVisitor const  & __vis_rename_at_172)->void{
+						if ( __vis_rename_at_172.usesInBlock > 0 )
+						{
+							das_copy(__captured_rename_at_148((*__v_rename_at_170),__context__),true);
+						};
+					}));
+					clone_22814dfdde58cf4b(__context__,__sstmt_rename_at_171,nullptr);
+				}
+				__v_iterator.close(__context__,(__v_rename_at_170));
+			};
+		}
+		__stmt_iterator.close(__context__,(__stmt_rename_at_149));
+	};
+	_Funcbuiltin_0x60_finalize_f37d4ac5c207eb29(__context__,das_arg<TArray<uint64_t>>::pass(__candidates_rename_at_147));
+	_Funcbuiltin_0x60_finalize_636ee68bd69a663(__context__,das_arg<TTable<uint64_t,bool>>::pass(__captured_rename_at_148));
+}}
+
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_rewrite_3cc5fc57b14306ba ( Context * __context__, string_builder::StringBuilderVisitor &  __self_rename_at_178, smart_ptr_raw<Expression> const  __expr_rename_at_178 )
+{
+	uint64_t __pexpr_rename_at_179 = ((uint64_t)_Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62(__context__,das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_ptr_98dd15e167848d85(__context__,__expr_rename_at_178))));
+	if ( _Funcbuiltin_0x60_key_exists_4a91f3d528cd0b5c(__context__,das_arg<TTable<uint64_t,uint64_t>>::pass(__self_rename_at_178.loops),__pexpr_rename_at_179) )
+	{
+		uint64_t __v_rename_at_181 = ((uint64_t)__self_rename_at_178.loops(__pexpr_rename_at_179,__context__));
+		_Funcbuiltin_0x60_erase_579e8fa517c56af0(__context__,das_arg<TTable<uint64_t,uint64_t>>::pass(__self_rename_at_178.loops),__pexpr_rename_at_179);
+		das_copy(__self_rename_at_178.astChanged,true);
+		return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(make_builder_loop_b6dbe89a94bed06e(__context__,__expr_rename_at_178,__v_rename_at_181,__self_rename_at_178.names(__v_rename_at_181,__context__)));
+	} else {
+		smart_ptr_raw<Expression> __res_rename_at_185; das_zero(__res_rename_at_185); das_move(__res_rename_at_185, _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c(__context__,__expr_rename_at_178));
+		return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_185);
+	};
+}
+
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_visitExprFor_ff1393d925de13fa ( Context * __context__, string_builder::StringBuilderVisitor &  __self_rename_at_187, smart_ptr_raw<ExprFor> const  __expr_rename_at_187 )
+{
+	smart_ptr_raw<Expression> __loop_rename_at_188; das_zero(__loop_rename_at_188); das_move(__loop_rename_at_188, _Funcbuiltin_0x60_clone_to_move_5a75ab233571f42(__context__,__expr_rename_at_187));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(das_invoke_function<smart_ptr_raw<Expression>>::invoke<string_builder::StringBuilderVisitor &,smart_ptr_raw<Expression>>(__context__,__self_rename_at_187.rewrite,das_arg<string_builder::StringBuilderVisitor>::pass(__self_rename_at_187),__loop_rename_at_188));
+}
+
+inline smart_ptr_raw<Expression> _FuncStringBuilderVisitor_0x60_visitExprWhile_1453a73c0f5e8c32 ( Context * __context__, string_builder::StringBuilderVisitor &  __self_rename_at_190, smart_ptr_raw<ExprWhile> const  __expr_rename_at_190 )
+{
+	smart_ptr_raw<Expression> __loop_rename_at_191; das_zero(__loop_rename_at_191); das_move(__loop_rename_at_191, _Funcbuiltin_0x60_clone_to_move_91a637c713bfda76(__context__,__expr_rename_at_190));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(das_invoke_function<smart_ptr_raw<Expression>>::invoke<string_builder::StringBuilderVisitor &,smart_ptr_raw<Expression>>(__context__,__self_rename_at_190.rewrite,das_arg<string_builder::StringBuilderVisitor>::pass(__self_rename_at_190),__loop_rename_at_191));
+}
+
+inline string_builder::StringUsesVisitor StringUsesVisitor_dbd560a23ffae601 ( Context * __context__, uint64_t __v_rename_at_52 )
+{
+	string_builder::StringUsesVisitor __self_rename_at_52; das_zero(__self_rename_at_52); das_move(__self_rename_at_52, (([&]() -> string_builder::StringUsesVisitor {
+		string_builder::StringUsesVisitor __mks_52;
+		das_zero(__mks_52);
+		das_copy((__mks_52.__rtti),(((void *)(&__type_info__ab082dc2))));
+		das_copy((__mks_52.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor'__finalize StringUsesVisitor*/ 3542498077u)))));
+		das_copy((__mks_52.visitExprOp2),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprOp2 StringUsesVisitor #smart_ptr##handle#ExprOp2#const*/ 1355295359u)))));
+		das_copy((__mks_52.visitExprLabel),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprLabel StringUsesVisitor #smart_ptr##handle#ExprLabel#const*/ 875562853u)))));
+		das_copy((__mks_52.visitExprGoto),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprGoto StringUsesVisitor #smart_ptr##handle#ExprGoto#const*/ 19288009u)))));
+		das_copy((__mks_52.visitExprVar),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprVar StringUsesVisitor #smart_ptr##handle#ExprVar#const*/ 3002823227u)))));
+		das_copy((__mks_52.visitExprReturn),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprReturn StringUsesVisitor #smart_ptr##handle#ExprReturn#const*/ 3406123241u)))));
+		das_copy((__mks_52.visitExprYield),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprYield StringUsesVisitor #smart_ptr##handle#ExprYield#const*/ 706324371u)))));
+		das_copy((__mks_52.preVisitExprMakeBlock),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`preVisitExprMakeBlock StringUsesVisitor #smart_ptr##handle#ExprMakeBlock#const*/ 2218580354u)))));
+		das_copy((__mks_52.visitExprMakeBlock),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@string_builder::StringUsesVisitor`visitExprMakeBlock StringUsesVisitor #smart_ptr##handle#ExprMakeBlock#const*/ 2552740843u)))));
+		das_copy((__mks_52.uses),(0));
+		das_copy((__mks_52.appends),(0));
+		das_copy((__mks_52.inBlock),(0));
+		das_copy((__mks_52.usesInBlock),(0));
+		das_copy((__mks_52.hasJumps),(false));
+		return __mks_52;
+	})()));
+	_FuncStringUsesVisitor_0x60_StringUsesVisitor_5f534b63ba7b4b43(__context__,das_arg<string_builder::StringUsesVisitor>::pass(__self_rename_at_52),__v_rename_at_52);
+	return /* <- */ das_auto_cast<string_builder::StringUsesVisitor>::cast(__self_rename_at_52);
+}
+
+inline void _FuncStringUsesVisitor_0x27___finalize_52db14a3bc533058 ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_45 )
+{
+	finalize_711c4303fdeefc8f(__context__,das_arg<string_builder::StringUsesVisitor>::pass(__self_rename_at_45));
+}
+
+inline void _FuncStringUsesVisitor_0x60_StringUsesVisitor_5f534b63ba7b4b43 ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_52, uint64_t __v_rename_at_52 )
+{
+	das_copy(__self_rename_at_52.variable,__v_rename_at_52);
+}
+
+inline void _FuncStringUsesVisitor_0x60_preVisitExprMakeBlock_abcffafdf8c64d7d ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_54, smart_ptr_raw<ExprMakeBlock> const  __expr_rename_at_54 )
+{
+	__self_rename_at_54.inBlock++;
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprGoto_7a5a42d09800a14d ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_84, smart_ptr_raw<ExprGoto> const  __expr_rename_at_84 )
+{
+	das_copy(__self_rename_at_84.hasJumps,true);
+	smart_ptr_raw<Expression> __res_rename_at_86; das_zero(__res_rename_at_86); das_move(__res_rename_at_86, _Funcbuiltin_0x60_clone_to_move_a396e21d765055bc(__context__,__expr_rename_at_84));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_86);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprLabel_b2ff45b8debadf67 ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_80, smart_ptr_raw<ExprLabel> const  __expr_rename_at_80 )
+{
+	das_copy(__self_rename_at_80.hasJumps,true);
+	smart_ptr_raw<Expression> __res_rename_at_82; das_zero(__res_rename_at_82); das_move(__res_rename_at_82, _Funcbuiltin_0x60_clone_to_move_7542b9f40dfea432(__context__,__expr_rename_at_80));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_82);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprMakeBlock_3a27eb3fbbb7cd57 ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_56, smart_ptr_raw<ExprMakeBlock> const  __expr_rename_at_56 )
+{
+	__self_rename_at_56.inBlock--;
+	smart_ptr_raw<Expression> __res_rename_at_58; das_zero(__res_rename_at_58); das_move(__res_rename_at_58, _Funcbuiltin_0x60_clone_to_move_f384ac1b7dbd750a(__context__,__expr_rename_at_56));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_58);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprOp2_eabb200dec8e5ec6 ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_67, smart_ptr_raw<ExprOp2> const  __expr_rename_at_67 )
+{
+	if ( is_append_to_581a0025fff850d(__context__,__expr_rename_at_67,__self_rename_at_67.variable) )
+	{
+		__self_rename_at_67.appends++;
+	};
+	smart_ptr_raw<Expression> __res_rename_at_70; das_zero(__res_rename_at_70); das_move(__res_rename_at_70, _Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e(__context__,__expr_rename_at_67));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_70);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprReturn_12483364c5cba1cd ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_72, smart_ptr_raw<ExprReturn> const  __expr_rename_at_72 )
+{
+	das_copy(__self_rename_at_72.hasJumps,true);
+	smart_ptr_raw<Expression> __res_rename_at_74; das_zero(__res_rename_at_74); das_move(__res_rename_at_74, _Funcbuiltin_0x60_clone_to_move_8bbc8567a5eb65b8(__context__,__expr_rename_at_72));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_74);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprVar_c7e735a11b391dff ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_60, smart_ptr_raw<ExprVar> const  __expr_rename_at_60 )
+{
+	if ( _Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62(__context__,das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1(__context__,__expr_rename_at_60->variable /*variable*/))) == __self_rename_at_60.variable )
+	{
+		__self_rename_at_60.uses++;
+		if ( __self_rename_at_60.inBlock > 0 )
+		{
+			__self_rename_at_60.usesInBlock++;
+		};
+	};
+	smart_ptr_raw<Expression> __res_rename_at_65; das_zero(__res_rename_at_65); das_move(__res_rename_at_65, _Funcbuiltin_0x60_clone_to_move_cc5e805de8822086(__context__,__expr_rename_at_60));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_65);
+}
+
+inline smart_ptr_raw<Expression> _FuncStringUsesVisitor_0x60_visitExprYield_944209e8fc774fcd ( Context * __context__, string_builder::StringUsesVisitor &  __self_rename_at_76, smart_ptr_raw<ExprYield> const  __expr_rename_at_76 )
+{
+	das_copy(__self_rename_at_76.hasJumps,true);
+	smart_ptr_raw<Expression> __res_rename_at_78; das_zero(__res_rename_at_78); das_move(__res_rename_at_78, _Funcbuiltin_0x60_clone_to_move_49806a8148c2fa3e(__context__,__expr_rename_at_76));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_78);
+}
+
+inline void __setup_macros_bd01add938277519 ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "string_builder"),__context__) )
+	{
+		_Funcast_0x60_add_new_infer_macro_2bee8646e2c834ce(__context__,((char *) "string_builder_rewrite"),das_new<string_builder::StringBuilderInferMacro>::make_and_init(__context__,[&]() { return StringBuilderInferMacro_7470df19290a5aee(__context__); }));
+	};
+}
+
+inline void _Funcast_0x60_add_new_infer_macro_2bee8646e2c834ce ( Context * __context__, char * const  __name_rename_at_535, string_builder::StringBuilderInferMacro * const  __someClassPtr_rename_at_535 )
+{
+	smart_ptr_raw<PassMacro> __ann_rename_at_536; das_zero(__ann_rename_at_536); das_move(__ann_rename_at_536, _Funcast_0x60_make_pass_macro_a0a98944386de804(__context__,__name_rename_at_535,__someClassPtr_rename_at_535));
+	addModuleInferDirtyMacro(thisModule(__context__,nullptr),__ann_rename_at_536,__context__);
+	das_delete_handle<smart_ptr_raw<PassMacro>>::clear(__context__,__ann_rename_at_536);
+}
+
+inline smart_ptr_raw<PassMacro> _Funcast_0x60_make_pass_macro_a0a98944386de804 ( Context * __context__, char * const  __name_rename_at_489, string_builder::StringBuilderInferMacro * const  __someClassPtr_rename_at_489 )
+{
+	StructInfo const  * __classInfo_rename_at_491 = ((StructInfo const  *)_Funcrtti_0x60_class_info_4825600d2240c795(__context__,das_deref(__context__,__someClassPtr_rename_at_489)));
+	return das_auto_cast<smart_ptr_raw<PassMacro>>::cast(makePassMacro(__name_rename_at_489,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_489),__classInfo_rename_at_491,__context__));
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_74629f81ac3a7882 ( Context * __context__, string_builder::AppendToWriteVisitor const  &  __someClass_rename_at_463 )
+{
+	string_builder::AppendToWriteVisitor const  * __classPtr_rename_at_466 = ((string_builder::AppendToWriteVisitor const  *)das_ref(__context__,__someClass_rename_at_463));
+	StructInfo const  * __classInfo_rename_at_467 = ((StructInfo const  *)das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__someClass_rename_at_463.__rtti)->structType /*structType*/));
+	return das_auto_cast<smart_ptr_raw<VisitorAdapter>>::cast(makeVisitor(das_auto_cast<void * const >::cast(__classPtr_rename_at_466),__classInfo_rename_at_467,__context__));
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_73bce4dd66cb181a ( Context * __context__, string_builder::StringBuilderVisitor const  &  __someClass_rename_at_463 )
+{
+	string_builder::StringBuilderVisitor const  * __classPtr_rename_at_466 = ((string_builder::StringBuilderVisitor const  *)das_ref(__context__,__someClass_rename_at_463));
+	StructInfo const  * __classInfo_rename_at_467 = ((StructInfo const  *)das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__someClass_rename_at_463.__rtti)->structType /*structType*/));
+	return das_auto_cast<smart_ptr_raw<VisitorAdapter>>::cast(makeVisitor(das_auto_cast<void * const >::cast(__classPtr_rename_at_466),__classInfo_rename_at_467,__context__));
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_a32e1bc6c19e7365 ( Context * __context__, string_builder::StringUsesVisitor const  &  __someClass_rename_at_463 )
+{
+	string_builder::StringUsesVisitor const  * __classPtr_rename_at_466 = ((string_builder::StringUsesVisitor const  *)das_ref(__context__,__someClass_rename_at_463));
+	StructInfo const  * __classInfo_rename_at_467 = ((StructInfo const  *)das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__someClass_rename_at_463.__rtti)->structType /*structType*/));
+	return das_auto_cast<smart_ptr_raw<VisitorAdapter>>::cast(makeVisitor(das_auto_cast<void * const >::cast(__classPtr_rename_at_466),__classInfo_rename_at_467,__context__));
+}
+
+inline smart_ptr_raw<ExprFor> _Funcbuiltin_0x60_clone_to_move_5a75ab233571f42 ( Context * __context__, smart_ptr_raw<ExprFor> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprFor> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_191e06f3c4959062(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprFor>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprGoto> _Funcbuiltin_0x60_clone_to_move_a396e21d765055bc ( Context * __context__, smart_ptr_raw<ExprGoto> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprGoto> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_e07fad9332806458(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprGoto>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprLabel> _Funcbuiltin_0x60_clone_to_move_7542b9f40dfea432 ( Context * __context__, smart_ptr_raw<ExprLabel> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprLabel> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_4e1b8fbdb6738bdc(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprLabel>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprMakeBlock> _Funcbuiltin_0x60_clone_to_move_f384ac1b7dbd750a ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprMakeBlock> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_aec10616fd5b444a(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprMakeBlock>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprOp2> _Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e ( Context * __context__, smart_ptr_raw<ExprOp2> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprOp2> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_3e90c0416b52aea2(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprOp2>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprReturn> _Funcbuiltin_0x60_clone_to_move_8bbc8567a5eb65b8 ( Context * __context__, smart_ptr_raw<ExprReturn> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprReturn> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_f0e657de8b674384(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprReturn>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprVar> _Funcbuiltin_0x60_clone_to_move_cc5e805de8822086 ( Context * __context__, smart_ptr_raw<ExprVar> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprVar> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_64235a2e81a29ca2(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprVar>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprWhile> _Funcbuiltin_0x60_clone_to_move_91a637c713bfda76 ( Context * __context__, smart_ptr_raw<ExprWhile> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprWhile> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_6049b13e6b5756ca(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprWhile>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr_raw<ExprYield> _Funcbuiltin_0x60_clone_to_move_49806a8148c2fa3e ( Context * __context__, smart_ptr_raw<ExprYield> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprYield> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_59a23e5de9b83832(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprYield>>::cast(__clone_dest_rename_at_132);
+}
+
+inline smart_ptr<Expression> _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c ( Context * __context__, smart_ptr<Expression> const  __clone_src_rename_at_131 )
+{
+	smart_ptr<Expression> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_5587e1b0c7901e78(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr<Expression>>::cast(__clone_dest_rename_at_132);
+}
+
+inline bool _Funcbuiltin_0x60_erase_579e8fa517c56af0 ( Context * __context__, TTable<uint64_t,uint64_t> &  __Tab_rename_at_117, uint64_t __at_rename_at_117 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_117,__at_rename_at_117));
+}
+
+inline void _Funcbuiltin_0x60_finalize_f37d4ac5c207eb29 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<uint64_t>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_636ee68bd69a663 ( Context * __context__, TTable<uint64_t,bool> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<uint64_t,bool>>::pass(__a_rename_at_193),8,1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_5a3ce0cbe6506aed ( Context * __context__, TTable<uint64_t,char *> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<uint64_t,char *>>::pass(__a_rename_at_193),8,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4ca2d3474401c9e8 ( Context * __context__, TTable<uint64_t,uint64_t> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<uint64_t,uint64_t>>::pass(__a_rename_at_193),8,8,__context__);
+}
+
+inline Expression * _Funcbuiltin_0x60_get_ptr_98dd15e167848d85 ( Context * __context__, smart_ptr<Expression> const  __src_rename_at_436 )
+{
+	return das_auto_cast<Expression *>::cast(das_cast<Expression *>::cast(__src_rename_at_436));
+}
+
+inline Variable * _Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1 ( Context * __context__, smart_ptr<Variable> const  __src_rename_at_436 )
+{
+	return das_auto_cast<Variable *>::cast(das_cast<Variable *>::cast(__src_rename_at_436));
+}
+
+inline uint64_t _Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62 ( Context * __context__, void * const  __p_rename_at_14 )
+{
+	return das_auto_cast<uint64_t>::cast(das_cast<uint64_t>::cast(__p_rename_at_14));
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_4a91f3d528cd0b5c ( Context * __context__, TTable<uint64_t,uint64_t> const  &  __Tab_rename_at_120, uint64_t __at_rename_at_120 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_120,__at_rename_at_120));
+}
+
+inline void _Funcbuiltin_0x60_push_79cbd1abccb478fa ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_37, uint64_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void clone_191e06f3c4959062 ( Context * __context__, smart_ptr_raw<ExprFor> & __dest_rename_at_133, smart_ptr_raw<ExprFor> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_e07fad9332806458 ( Context * __context__, smart_ptr_raw<ExprGoto> & __dest_rename_at_133, smart_ptr_raw<ExprGoto> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_4e1b8fbdb6738bdc ( Context * __context__, smart_ptr_raw<ExprLabel> & __dest_rename_at_133, smart_ptr_raw<ExprLabel> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_aec10616fd5b444a ( Context * __context__, smart_ptr_raw<ExprMakeBlock> & __dest_rename_at_133, smart_ptr_raw<ExprMakeBlock> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_3e90c0416b52aea2 ( Context * __context__, smart_ptr_raw<ExprOp2> & __dest_rename_at_133, smart_ptr_raw<ExprOp2> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_f0e657de8b674384 ( Context * __context__, smart_ptr_raw<ExprReturn> & __dest_rename_at_133, smart_ptr_raw<ExprReturn> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_64235a2e81a29ca2 ( Context * __context__, smart_ptr_raw<ExprVar> & __dest_rename_at_133, smart_ptr_raw<ExprVar> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_6049b13e6b5756ca ( Context * __context__, smart_ptr_raw<ExprWhile> & __dest_rename_at_133, smart_ptr_raw<ExprWhile> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_59a23e5de9b83832 ( Context * __context__, smart_ptr_raw<ExprYield> & __dest_rename_at_133, smart_ptr_raw<ExprYield> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_22814dfdde58cf4b ( Context * __context__, smart_ptr_raw<Expression> & __dest_rename_at_165, void * const  __src_rename_at_165 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_165),__src_rename_at_165);
+}
+
+inline void clone_5587e1b0c7901e78 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_133, smart_ptr<Expression> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void collect_uses_58c99723fdbaef97 ( Context * __context__, smart_ptr_raw<Expression> __expr_rename_at_90, uint64_t __v_rename_at_90, Block DAS_COMMENT((void,string_builder::StringUsesVisitor const )) const  &  __blk_rename_at_90 )
+{
+	string_builder::StringUsesVisitor * __astVisitor_rename_at_91 = das_new<string_builder::StringUsesVisitor>::make_and_init(__context__,[&]() { return StringUsesVisitor_dbd560a23ffae601(__context__,__v_rename_at_90); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_92; das_zero(__astVisitorAdapter_rename_at_92); das_move(__astVisitorAdapter_rename_at_92, _Funcast_0x60_make_visitor_a32e1bc6c19e7365(__context__,das_arg<string_builder::StringUsesVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_91))));
+	astVisitExpression(__expr_rename_at_90,__astVisitorAdapter_rename_at_92);
+	das_invoke<void>::invoke<string_builder::StringUsesVisitor &>(__context__,__blk_rename_at_90,das_arg<string_builder::StringUsesVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_91)));
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_92);
+	finalize_9be5be037088d35e(__context__,__astVisitor_rename_at_91);
+}
+
+inline void finalize_c0e697c73a7686a3 ( Context * __context__, string_builder::AppendToWriteVisitor * & ____this_rename_at_126 )
+{
+	if ( ____this_rename_at_126 != nullptr )
+	{
+		das_invoke_function<void>::invoke<ast::AstVisitor &>(__context__,____this_rename_at_126->__finalize,das_arg<ast::AstVisitor>::pass(das_cast<ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_126))));
+		das_delete<string_builder::AppendToWriteVisitor *>::clear(__context__,____this_rename_at_126);
+		das_copy(____this_rename_at_126,nullptr);
+	};
+}
+
+inline void finalize_2a14994fe3aa1a4f ( Context * __context__, string_builder::StringBuilderVisitor * & ____this_rename_at_203 )
+{
+	if ( ____this_rename_at_203 != nullptr )
+	{
+		das_invoke_function<void>::invoke<ast::AstVisitor &>(__context__,____this_rename_at_203->__finalize,das_arg<ast::AstVisitor>::pass(das_cast<ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_203))));
+		das_delete<string_builder::StringBuilderVisitor *>::clear(__context__,____this_rename_at_203);
+		das_copy(____this_rename_at_203,nullptr);
+	};
+}
+
+inline void finalize_9be5be037088d35e ( Context * __context__, string_builder::StringUsesVisitor * & ____this_rename_at_97 )
+{
+	if ( ____this_rename_at_97 != nullptr )
+	{
+		das_invoke_function<void>::invoke<ast::AstVisitor &>(__context__,____this_rename_at_97->__finalize,das_arg<ast::AstVisitor>::pass(das_cast<ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_97))));
+		das_delete<string_builder::StringUsesVisitor *>::clear(__context__,____this_rename_at_97);
+		das_copy(____this_rename_at_97,nullptr);
+	};
+}
+
+inline void finalize_c8f05aa8f6e751ae ( Context * __context__, string_builder::AppendToWriteVisitor &  ____this_rename_at_101 )
+{
+	memset(&(____this_rename_at_101), 0, 1104);
+}
+
+inline void finalize_83a05150eb13834c ( Context * __context__, string_builder::StringBuilderInferMacro &  ____this_rename_at_195 )
+{
+	memset(&(____this_rename_at_195), 0, 16);
+}
+
+inline void finalize_3bc91361025a1604 ( Context * __context__, string_builder::StringBuilderVisitor &  ____this_rename_at_142 )
+{
+	_Funcbuiltin_0x60_finalize_4ca2d3474401c9e8(__context__,das_arg<TTable<uint64_t,uint64_t>>::pass(____this_rename_at_142.loops));
+	_Funcbuiltin_0x60_finalize_5a3ce0cbe6506aed(__context__,das_arg<TTable<uint64_t,char *>>::pass(____this_rename_at_142.names));
+	memset(&(____this_rename_at_142), 0, 1200);
+}
+
+inline void finalize_711c4303fdeefc8f ( Context * __context__, string_builder::StringUsesVisitor &  ____this_rename_at_45 )
+{
+	memset(&(____this_rename_at_45), 0, 1128);
+}
+
+inline bool is_append_to_581a0025fff850d ( Context * __context__, smart_ptr_raw<ExprOp2> const  __expr_rename_at_36, uint64_t __variable_rename_at_36 )
+{
+	if ( (SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string const  &>::from(__expr_rename_at_36->op /*op*/)))),cast<char *>::from(((char *) "+=")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_36->left /*left*/->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprVar")),*__context__)) )
+	{
+		ExprVar * __evar_rename_at_39 = ((ExprVar *)das_cast<ExprVar *>::cast(__expr_rename_at_36->left /*left*/));
+		return das_auto_cast<bool>::cast(_Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62(__context__,das_auto_cast<void * const >::cast(_Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1(__context__,__evar_rename_at_39->variable /*variable*/))) == __variable_rename_at_36);
+	} else {
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool is_string_local_e6009ba2eb47ce6b ( Context * __context__, smart_ptr_raw<Variable> const  __v_rename_at_31 )
+{
+	return das_auto_cast<bool>::cast(((((nequ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__v_rename_at_31),nullptr)) && (nequ_sptr_ptr(das_auto_cast<smart_ptr_raw<void> const  &>::cast(__v_rename_at_31->type /*_type*/),nullptr))) && (__v_rename_at_31->type /*_type*/->baseType /*baseType*/ == DAS_COMMENT(bound_enum) das::Type::tString)) && !(das_get_bitfield(__v_rename_at_31->type /*_type*/->flags /*flags*/,1u << 0))) && (__v_rename_at_31->type /*_type*/->dim /*dim*/.size() /*length*/ == 0));
+}
+
+inline smart_ptr_raw<Expression> make_builder_loop_b6dbe89a94bed06e ( Context * __context__, smart_ptr_raw<Expression> const  __loop_rename_at_118, uint64_t __v_rename_at_118, char * const  __vname_rename_at_118 ) { das_stack_prologue __prologue(__context__,848,"make_builder_loop " DAS_FILE_LINE);
+{
+	LineInfo __at_rename_at_119_ConstRef = ((LineInfo)__loop_rename_at_118->at /*at*/);
+	LineInfo const  & __at_rename_at_119 = __at_rename_at_119_ConstRef; ;
+	smart_ptr<Expression> __nloop_rename_at_120; das_zero(__nloop_rename_at_120); das_move(__nloop_rename_at_120, clone_expression(__loop_rename_at_118));
+	string_builder::AppendToWriteVisitor * __astVisitor_rename_at_121 = das_new<string_builder::AppendToWriteVisitor>::make_and_init(__context__,[&]() { return AppendToWriteVisitor_b4f0da15d0fa50a2(__context__,__v_rename_at_118); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_122; das_zero(__astVisitorAdapter_rename_at_122); das_move(__astVisitorAdapter_rename_at_122, _Funcast_0x60_make_visitor_74629f81ac3a7882(__context__,das_arg<string_builder::AppendToWriteVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_121))));
+	astVisitExpression(__nloop_rename_at_120,__astVisitorAdapter_rename_at_122);
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_122);
+	finalize_c0e697c73a7686a3(__context__,__astVisitor_rename_at_121);
+	smart_ptr_raw<ExprBlock> __blk_rename_at_127; das_zero(__blk_rename_at_127); das_move(__blk_rename_at_127, das_ascend_handle<true,smart_ptr_raw<ExprBlock>>::make(__context__,nullptr,(([&](ExprBlock & __mks_127) {
+		das_copy((__mks_127.at /*at*/),(__at_rename_at_119));
+	}))));
+	__blk_rename_at_127->blockFlags /*blockFlags*/ |= 0x1u;
+	das_move(__blk_rename_at_127->returnType /*returnType*/,das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_129) {
+		das_copy((__mks_129.at /*at*/),(__at_rename_at_119));
+		das_copy((__mks_129.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::tVoid));
+	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Variable>> &,smart_ptr_raw<Variable>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Variable #smart_ptr##handle#Variable*/ 1722377340u)),das_arg<das::vector<smart_ptr<Variable>>>::pass(__blk_rename_at_127->arguments /*arguments*/),das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_130) {
+		das_copy((__mks_130.at /*at*/),(__at_rename_at_119));
+		das_move((__mks_130.type /*_type*/),(das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_131) {
+			das_copy((__mks_131.at /*at*/),(__at_rename_at_119));
+			das_copy((__mks_131.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::alias));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_131.alias /*alias*/),((char *) "StringBuilderWriter"));
+			}		})))));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_130.name /*name*/),((char *) "string_builder_writer"));
+		}	}))));
+	smart_ptr_raw<ExprCall> __wr_rename_at_132; das_zero(__wr_rename_at_132); das_move(__wr_rename_at_132, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_132) {
+		das_copy((__mks_132.at /*at*/),(__at_rename_at_119));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_132.name /*name*/),((char *) "write"));
+		}	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprVar>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__wr_rename_at_132->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_133) {
+		das_copy((__mks_133.at /*at*/),(__at_rename_at_119));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_133.name /*name*/),((char *) "string_builder_writer"));
+		}	})))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprVar>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__wr_rename_at_132->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_134) {
+		das_copy((__mks_134.at /*at*/),(__at_rename_at_119));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_134.name /*name*/),__vname_rename_at_118);
+		}	})))));
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_127->list /*list*/),das_reinterpret<smart_ptr<Expression>>::pass(__wr_rename_at_132));
+	das_vector_emplace(das_arg<das::vector<smart_ptr<Expression>>>::pass(__blk_rename_at_127->list /*list*/),__nloop_rename_at_120);
+	smart_ptr_raw<ExprCall> __bs_rename_at_137; das_zero(__bs_rename_at_137); das_move(__bs_rename_at_137, das_ascend_handle<true,smart_ptr_raw<ExprCall>>::make(__context__,nullptr,(([&](ExprCall & __mks_137) {
+		das_copy((__mks_137.at /*at*/),(__at_rename_at_119));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_137.name /*name*/),((char *) "build_string"));
+		}	}))));
+	das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprMakeBlock>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__bs_rename_at_137->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprMakeBlock>>::make(__context__,nullptr,(([&](ExprMakeBlock & __mks_138) {
+		das_copy((__mks_138.at /*at*/),(__at_rename_at_119));
+		das_move((__mks_138.block /*_block*/),(__blk_rename_at_127));
+	})))));
+	return /* <- */ das_auto_cast<smart_ptr_raw<Expression>>::cast(das_ascend_handle<true,smart_ptr_raw<ExprCopy>>::make(__context__,nullptr,(([&](ExprCopy & __mks_139) {
+		das_copy((__mks_139.at /*at*/),(__at_rename_at_119));
+		das_move((__mks_139.left /*left*/),(das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_139) {
+			das_copy((__mks_139.at /*at*/),(__at_rename_at_119));
+			{
+				set_das_string(das_arg<das::string>::pass(__mks_139.name /*name*/),__vname_rename_at_118);
+			}		})))));
+		das_move((__mks_139.right /*right*/),(__bs_rename_at_137));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_139.op /*op*/),((char *) "="));
+		}	}))));
+}}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_4825600d2240c795 ( Context * __context__, string_builder::StringBuilderInferMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// AppendToWriteVisitor_b4f0da15d0fa50a2
+		aotLib[0x5b6786c273458c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<string_builder::AppendToWriteVisitor (*) ( Context * __context__, uint64_t  ),&AppendToWriteVisitor_b4f0da15d0fa50a2>>();
+	};
+		// _FuncAppendToWriteVisitor_0x27___finalize_9afd1b2fb5c73cfe
+		aotLib[0x1cc807b15e39637b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::AppendToWriteVisitor &  ),&_FuncAppendToWriteVisitor_0x27___finalize_9afd1b2fb5c73cfe>>();
+	};
+		// _FuncAppendToWriteVisitor_0x60_AppendToWriteVisitor_794949eadc7c1fa6
+		aotLib[0xdb593273972c9a65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::AppendToWriteVisitor & , uint64_t  ),&_FuncAppendToWriteVisitor_0x60_AppendToWriteVisitor_794949eadc7c1fa6>>();
+	};
+		// _FuncAppendToWriteVisitor_0x60_visitExprOp2_7dad2a5678061571
+		aotLib[0x289a0d0bb1bcf535] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::AppendToWriteVisitor & , smart_ptr_raw<ExprOp2> const   ),&_FuncAppendToWriteVisitor_0x60_visitExprOp2_7dad2a5678061571>>();
+	};
+		// StringBuilderInferMacro_7470df19290a5aee
+		aotLib[0xc41f9f0fc25a3755] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<string_builder::StringBuilderInferMacro (*) ( Context * __context__ ),&StringBuilderInferMacro_7470df19290a5aee>>();
+	};
+		// _FuncStringBuilderInferMacro_0x27___finalize_b0c1f166a84b4180
+		aotLib[0x4ef82edd8ed2ac00] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderInferMacro &  ),&_FuncStringBuilderInferMacro_0x27___finalize_b0c1f166a84b4180>>();
+	};
+		// _FuncStringBuilderInferMacro_0x60_apply_75cfe75a61a9f971
+		aotLib[0x488097148d09f44f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, string_builder::StringBuilderInferMacro & , smart_ptr_raw<Program> const  , Module * const   ),&_FuncStringBuilderInferMacro_0x60_apply_75cfe75a61a9f971>>();
+	};
+		// StringBuilderVisitor_b552109856710f57
+		aotLib[0xec8f13b9008a0020] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<string_builder::StringBuilderVisitor (*) ( Context * __context__ ),&StringBuilderVisitor_b552109856710f57>>();
+	};
+		// _FuncStringBuilderVisitor_0x27___finalize_6644a959ac1ec9d4
+		aotLib[0x9fab834199027df5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderVisitor &  ),&_FuncStringBuilderVisitor_0x27___finalize_6644a959ac1ec9d4>>();
+	};
+		// _FuncStringBuilderVisitor_0x60_preVisitExprBlock_96c81000459ef6d7
+		aotLib[0xaf96fc4b57828d92] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderVisitor & , smart_ptr_raw<ExprBlock> const   ),&_FuncStringBuilderVisitor_0x60_preVisitExprBlock_96c81000459ef6d7>>();
+	};
+		// _FuncStringBuilderVisitor_0x60_rewrite_3cc5fc57b14306ba
+		aotLib[0x31fe83e52bfc69b6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringBuilderVisitor & , smart_ptr_raw<Expression> const   ),&_FuncStringBuilderVisitor_0x60_rewrite_3cc5fc57b14306ba>>();
+	};
+		// _FuncStringBuilderVisitor_0x60_visitExprFor_ff1393d925de13fa
+		aotLib[0x38d2c8599e7af523] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringBuilderVisitor & , smart_ptr_raw<ExprFor> const   ),&_FuncStringBuilderVisitor_0x60_visitExprFor_ff1393d925de13fa>>();
+	};
+		// _FuncStringBuilderVisitor_0x60_visitExprWhile_1453a73c0f5e8c32
+		aotLib[0x92e12bd7c27d842a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringBuilderVisitor & , smart_ptr_raw<ExprWhile> const   ),&_FuncStringBuilderVisitor_0x60_visitExprWhile_1453a73c0f5e8c32>>();
+	};
+		// StringUsesVisitor_dbd560a23ffae601
+		aotLib[0xf2dad83432b37e14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<string_builder::StringUsesVisitor (*) ( Context * __context__, uint64_t  ),&StringUsesVisitor_dbd560a23ffae601>>();
+	};
+		// _FuncStringUsesVisitor_0x27___finalize_52db14a3bc533058
+		aotLib[0x929e010550be9f42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringUsesVisitor &  ),&_FuncStringUsesVisitor_0x27___finalize_52db14a3bc533058>>();
+	};
+		// _FuncStringUsesVisitor_0x60_StringUsesVisitor_5f534b63ba7b4b43
+		aotLib[0x3cc59535919c53a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringUsesVisitor & , uint64_t  ),&_FuncStringUsesVisitor_0x60_StringUsesVisitor_5f534b63ba7b4b43>>();
+	};
+		// _FuncStringUsesVisitor_0x60_preVisitExprMakeBlock_abcffafdf8c64d7d
+		aotLib[0x3ba0768a751e8975] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprMakeBlock> const   ),&_FuncStringUsesVisitor_0x60_preVisitExprMakeBlock_abcffafdf8c64d7d>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprGoto_7a5a42d09800a14d
+		aotLib[0x64b468608241a9d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprGoto> const   ),&_FuncStringUsesVisitor_0x60_visitExprGoto_7a5a42d09800a14d>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprLabel_b2ff45b8debadf67
+		aotLib[0xa0007f49aed08961] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprLabel> const   ),&_FuncStringUsesVisitor_0x60_visitExprLabel_b2ff45b8debadf67>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprMakeBlock_3a27eb3fbbb7cd57
+		aotLib[0xd4640c974f22d741] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprMakeBlock> const   ),&_FuncStringUsesVisitor_0x60_visitExprMakeBlock_3a27eb3fbbb7cd57>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprOp2_eabb200dec8e5ec6
+		aotLib[0x3aa070f97be4057e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprOp2> const   ),&_FuncStringUsesVisitor_0x60_visitExprOp2_eabb200dec8e5ec6>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprReturn_12483364c5cba1cd
+		aotLib[0xb297a4ba4d36b291] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprReturn> const   ),&_FuncStringUsesVisitor_0x60_visitExprReturn_12483364c5cba1cd>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprVar_c7e735a11b391dff
+		aotLib[0xe7b0d6859d31555b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprVar> const   ),&_FuncStringUsesVisitor_0x60_visitExprVar_c7e735a11b391dff>>();
+	};
+		// _FuncStringUsesVisitor_0x60_visitExprYield_944209e8fc774fcd
+		aotLib[0x6b8af296a8c27b28] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, string_builder::StringUsesVisitor & , smart_ptr_raw<ExprYield> const   ),&_FuncStringUsesVisitor_0x60_visitExprYield_944209e8fc774fcd>>();
+	};
+		// __setup_macros_bd01add938277519
+		aotLib[0x88e81f81e4cabf2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_bd01add938277519>>();
+	};
+		// _Funcast_0x60_add_new_infer_macro_2bee8646e2c834ce
+		aotLib[0x22568fee981a3b2c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , string_builder::StringBuilderInferMacro * const   ),&_Funcast_0x60_add_new_infer_macro_2bee8646e2c834ce>>();
+	};
+		// _Funcast_0x60_make_pass_macro_a0a98944386de804
+		aotLib[0xa58909faffb7d0af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<PassMacro> (*) ( Context * __context__, char * const  , string_builder::StringBuilderInferMacro * const   ),&_Funcast_0x60_make_pass_macro_a0a98944386de804>>();
+	};
+		// _Funcast_0x60_make_visitor_74629f81ac3a7882
+		aotLib[0x816b2bfb063c52d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, string_builder::AppendToWriteVisitor const  &  ),&_Funcast_0x60_make_visitor_74629f81ac3a7882>>();
+	};
+		// _Funcast_0x60_make_visitor_73bce4dd66cb181a
+		aotLib[0x3935239ed6aff7c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, string_builder::StringBuilderVisitor const  &  ),&_Funcast_0x60_make_visitor_73bce4dd66cb181a>>();
+	};
+		// _Funcast_0x60_make_visitor_a32e1bc6c19e7365
+		aotLib[0xa29580dc30c68689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, string_builder::StringUsesVisitor const  &  ),&_Funcast_0x60_make_visitor_a32e1bc6c19e7365>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_5a75ab233571f42
+		aotLib[0xb89bbfb6b0a1482] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprFor> (*) ( Context * __context__, smart_ptr_raw<ExprFor> const   ),&_Funcbuiltin_0x60_clone_to_move_5a75ab233571f42>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_a396e21d765055bc
+		aotLib[0xeac031f9375c609c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprGoto> (*) ( Context * __context__, smart_ptr_raw<ExprGoto> const   ),&_Funcbuiltin_0x60_clone_to_move_a396e21d765055bc>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_7542b9f40dfea432
+		aotLib[0xaad9cda423cfda58] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprLabel> (*) ( Context * __context__, smart_ptr_raw<ExprLabel> const   ),&_Funcbuiltin_0x60_clone_to_move_7542b9f40dfea432>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_f384ac1b7dbd750a
+		aotLib[0xe30b495e07e8792c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprMakeBlock> (*) ( Context * __context__, smart_ptr_raw<ExprMakeBlock> const   ),&_Funcbuiltin_0x60_clone_to_move_f384ac1b7dbd750a>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e
+		aotLib[0x9e50aec3523c6699] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprOp2> (*) ( Context * __context__, smart_ptr_raw<ExprOp2> const   ),&_Funcbuiltin_0x60_clone_to_move_a9e1711570b8dc0e>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_8bbc8567a5eb65b8
+		aotLib[0x681272a8d037b007] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprReturn> (*) ( Context * __context__, smart_ptr_raw<ExprReturn> const   ),&_Funcbuiltin_0x60_clone_to_move_8bbc8567a5eb65b8>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_cc5e805de8822086
+		aotLib[0xbd08c3c203abee81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprVar> (*) ( Context * __context__, smart_ptr_raw<ExprVar> const   ),&_Funcbuiltin_0x60_clone_to_move_cc5e805de8822086>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_91a637c713bfda76
+		aotLib[0xf9c5dacbde43b7fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprWhile> (*) ( Context * __context__, smart_ptr_raw<ExprWhile> const   ),&_Funcbuiltin_0x60_clone_to_move_91a637c713bfda76>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_49806a8148c2fa3e
+		aotLib[0xf61e81aa3b6327ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprYield> (*) ( Context * __context__, smart_ptr_raw<ExprYield> const   ),&_Funcbuiltin_0x60_clone_to_move_49806a8148c2fa3e>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c
+		aotLib[0x614b38bbd52c5e4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr<Expression> (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_clone_to_move_f7553ee0c01b147c>>();
+	};
+		// _Funcbuiltin_0x60_erase_579e8fa517c56af0
+		aotLib[0x62a7f2e2dd42e831] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<uint64_t,uint64_t> & , uint64_t  ),&_Funcbuiltin_0x60_erase_579e8fa517c56af0>>();
+	};
+		// _Funcbuiltin_0x60_finalize_f37d4ac5c207eb29
+		aotLib[0xbef336888b3cbcf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Funcbuiltin_0x60_finalize_f37d4ac5c207eb29>>();
+	};
+		// _Funcbuiltin_0x60_finalize_636ee68bd69a663
+		aotLib[0x56055c948a3a1eed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<uint64_t,bool> &  ),&_Funcbuiltin_0x60_finalize_636ee68bd69a663>>();
+	};
+		// _Funcbuiltin_0x60_finalize_5a3ce0cbe6506aed
+		aotLib[0xe8cd92fdde7eb635] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<uint64_t,char *> &  ),&_Funcbuiltin_0x60_finalize_5a3ce0cbe6506aed>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4ca2d3474401c9e8
+		aotLib[0x7145109713a320dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<uint64_t,uint64_t> &  ),&_Funcbuiltin_0x60_finalize_4ca2d3474401c9e8>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_98dd15e167848d85
+		aotLib[0xfbfa2e866537498d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Expression * (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_get_ptr_98dd15e167848d85>>();
+	};
+		// _Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1
+		aotLib[0xf014701a794d5d19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Variable * (*) ( Context * __context__, smart_ptr<Variable> const   ),&_Funcbuiltin_0x60_get_ptr_5f8e5a842c912ac1>>();
+	};
+		// _Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62
+		aotLib[0x61da940efac82141] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, void * const   ),&_Funcbuiltin_0x60_intptr_c74fd8f57ac7ca62>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_4a91f3d528cd0b5c
+		aotLib[0xcfa0502192535d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<uint64_t,uint64_t> const  & , uint64_t  ),&_Funcbuiltin_0x60_key_exists_4a91f3d528cd0b5c>>();
+	};
+		// _Funcbuiltin_0x60_push_79cbd1abccb478fa
+		aotLib[0xab9e13f3832b1dcd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , uint64_t  ),&_Funcbuiltin_0x60_push_79cbd1abccb478fa>>();
+	};
+		// clone_191e06f3c4959062
+		aotLib[0xade8f5abb72b13c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprFor> & , smart_ptr_raw<ExprFor> const   ),&clone_191e06f3c4959062>>();
+	};
+		// clone_e07fad9332806458
+		aotLib[0x682b8c46b397f655] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprGoto> & , smart_ptr_raw<ExprGoto> const   ),&clone_e07fad9332806458>>();
+	};
+		// clone_4e1b8fbdb6738bdc
+		aotLib[0x9eee9a632b9c4fdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprLabel> & , smart_ptr_raw<ExprLabel> const   ),&clone_4e1b8fbdb6738bdc>>();
+	};
+		// clone_aec10616fd5b444a
+		aotLib[0x54f74d3023c71f29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprMakeBlock> & , smart_ptr_raw<ExprMakeBlock> const   ),&clone_aec10616fd5b444a>>();
+	};
+		// clone_3e90c0416b52aea2
+		aotLib[0x4894a63e19b57a6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprOp2> & , smart_ptr_raw<ExprOp2> const   ),&clone_3e90c0416b52aea2>>();
+	};
+		// clone_f0e657de8b674384
+		aotLib[0xd99a5400a7a39db1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprReturn> & , smart_ptr_raw<ExprReturn> const   ),&clone_f0e657de8b674384>>();
+	};
+		// clone_64235a2e81a29ca2
+		aotLib[0x1075d7757b5fd695] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprVar> & , smart_ptr_raw<ExprVar> const   ),&clone_64235a2e81a29ca2>>();
+	};
+		// clone_6049b13e6b5756ca
+		aotLib[0x124caef0303397fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprWhile> & , smart_ptr_raw<ExprWhile> const   ),&clone_6049b13e6b5756ca>>();
+	};
+		// clone_59a23e5de9b83832
+		aotLib[0x9bd534bef6c6801] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprYield> & , smart_ptr_raw<ExprYield> const   ),&clone_59a23e5de9b83832>>();
+	};
+		// clone_22814dfdde58cf4b
+		aotLib[0xb71ad6e30136b459] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Expression> & , void * const   ),&clone_22814dfdde58cf4b>>();
+	};
+		// clone_5587e1b0c7901e78
+		aotLib[0x2d52cadfc11a069d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr<Expression> const   ),&clone_5587e1b0c7901e78>>();
+	};
+		// collect_uses_58c99723fdbaef97
+		aotLib[0xb1f8062c6eb4a02d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Expression> , uint64_t , Block DAS_COMMENT((void,string_builder::StringUsesVisitor const )) const  &  ),&collect_uses_58c99723fdbaef97>>();
+	};
+		// finalize_c0e697c73a7686a3
+		aotLib[0x19d0b8b3ab491bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::AppendToWriteVisitor * &  ),&finalize_c0e697c73a7686a3>>();
+	};
+		// finalize_2a14994fe3aa1a4f
+		aotLib[0x81f2148d1b5d38e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderVisitor * &  ),&finalize_2a14994fe3aa1a4f>>();
+	};
+		// finalize_9be5be037088d35e
+		aotLib[0x5ba8bf37b3cbba45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringUsesVisitor * &  ),&finalize_9be5be037088d35e>>();
+	};
+		// finalize_c8f05aa8f6e751ae
+		aotLib[0xa14814f3b078e9b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::AppendToWriteVisitor &  ),&finalize_c8f05aa8f6e751ae>>();
+	};
+		// finalize_83a05150eb13834c
+		aotLib[0x3a132245aa470149] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderInferMacro &  ),&finalize_83a05150eb13834c>>();
+	};
+		// finalize_3bc91361025a1604
+		aotLib[0x37a313f8b8dc42eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringBuilderVisitor &  ),&finalize_3bc91361025a1604>>();
+	};
+		// finalize_711c4303fdeefc8f
+		aotLib[0xd9608ac6ed311749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, string_builder::StringUsesVisitor &  ),&finalize_711c4303fdeefc8f>>();
+	};
+		// is_append_to_581a0025fff850d
+		aotLib[0x197a2857ffc43fe0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<ExprOp2> const  , uint64_t  ),&is_append_to_581a0025fff850d>>();
+	};
+		// is_string_local_e6009ba2eb47ce6b
+		aotLib[0xc49789d4426891dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, smart_ptr_raw<Variable> const   ),&is_string_local_e6009ba2eb47ce6b>>();
+	};
+		// make_builder_loop_b6dbe89a94bed06e
+		aotLib[0x2bd6a006adb29912] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<Expression> const  , uint64_t , char * const   ),&make_builder_loop_b6dbe89a94bed06e>>();
+	};
+		// _Funcrtti_0x60_class_info_4825600d2240c795
+		aotLib[0xc596d8e61e71e8e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, string_builder::StringBuilderInferMacro const  &  ),&_Funcrtti_0x60_class_info_4825600d2240c795>>();
+	};
+		// [[ init script ]]
+		aotLib[0x412c44508362d8df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
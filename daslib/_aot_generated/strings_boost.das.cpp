@@ -0,0 +1,155 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings_boost
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__22794d9a;
+extern FuncInfo __func_info__a38a0bc5;
+
+VarInfo __func_info__a38a0bc5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x22794d9a, "arr", 0 };
+VarInfo * __func_info__a38a0bc5_fields[1] =  { &__func_info__a38a0bc5_field_0 };
+FuncInfo __func_info__a38a0bc5 = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__a38a0bc5_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xa38a0bc5, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Funcbuiltin_0x60_clone_4e9e0c87b310fb5e ( Context * __context__, TArray<char *> & __a_rename_at_148, TArray<char *> const  & __b_rename_at_148 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> split_7db96d34e4c268b6 ( Context * __context__, char * const  __text_rename_at_37, char * const  __delim_rename_at_37 );
+inline TArray<char *> split_by_chars_5aa15b2b53af0ac3 ( Context * __context__, char * const  __text_rename_at_46, char * const  __delim_rename_at_46 );
+inline char * wide_cef1f7f4db0489e7 ( Context * __context__, char * const  __text_rename_at_8, int32_t __width_rename_at_8 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_4e9e0c87b310fb5e ( Context * __context__, TArray<char *> &  __a_rename_at_148, TArray<char *> const  &  __b_rename_at_148 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_148),builtin_array_size(__b_rename_at_148));
+	{
+		bool __need_loop_150 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_148);
+		char * * __aV_rename_at_150;
+		__need_loop_150 = __aV_iterator.first(__context__,(__aV_rename_at_150)) && __need_loop_150;
+		// bV : string const&#
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_148);
+		char * const  * __bV_rename_at_150;
+		__need_loop_150 = __bV_iterator.first(__context__,(__bV_rename_at_150)) && __need_loop_150;
+		for ( ; __need_loop_150 ; __need_loop_150 = __aV_iterator.next(__context__,(__aV_rename_at_150)) && __bV_iterator.next(__context__,(__bV_rename_at_150)) )
+		{
+			das_copy((*__aV_rename_at_150),((char *)(builtin_string_clone((*__bV_rename_at_150),__context__))));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_150));
+		__bV_iterator.close(__context__,(__bV_rename_at_150));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> split_7db96d34e4c268b6 ( Context * __context__, char * const  __text_rename_at_37, char * const  __delim_rename_at_37 ) { das_stack_prologue __prologue(__context__,96,"split " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_38; das_zero(__res_rename_at_38);
+	builtin_string_split(__text_rename_at_37,__delim_rename_at_37,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__a38a0bc5,[&](TArray<char *> const  & __arr_rename_at_39)->void{
+		_Funcbuiltin_0x60_clone_4e9e0c87b310fb5e(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_38),__arr_rename_at_39);
+	}),__context__);
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__res_rename_at_38);
+}}
+
+inline TArray<char *> split_by_chars_5aa15b2b53af0ac3 ( Context * __context__, char * const  __text_rename_at_46, char * const  __delim_rename_at_46 ) { das_stack_prologue __prologue(__context__,96,"split_by_chars " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_47; das_zero(__res_rename_at_47);
+	builtin_string_split_by_char(__text_rename_at_46,__delim_rename_at_46,das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__a38a0bc5,[&](TArray<char *> const  & __arr_rename_at_48)->void{
+		_Funcbuiltin_0x60_clone_4e9e0c87b310fb5e(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_47),__arr_rename_at_48);
+	}),__context__);
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__res_rename_at_47);
+}}
+
+inline char * wide_cef1f7f4db0489e7 ( Context * __context__, char * const  __text_rename_at_8, int32_t __width_rename_at_8 )
+{
+	int32_t __extra_rename_at_9 = ((int32_t)(__width_rename_at_8 - builtin_string_length(__text_rename_at_8,__context__)));
+	return das_auto_cast<char *>::cast((__extra_rename_at_9 > 0) ? das_auto_cast<char *>::cast((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__text_rename_at_8),cast<char *>::from(((char *)(string_repeat(((char *) " "),__extra_rename_at_9,__context__)))),*__context__)))) : das_auto_cast<char *>::cast(__text_rename_at_8));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_4e9e0c87b310fb5e
+		aotLib[0x3365755e65eb8297] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_4e9e0c87b310fb5e>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// split_7db96d34e4c268b6
+		aotLib[0x88fc31876c50de1e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_7db96d34e4c268b6>>();
+	};
+		// split_by_chars_5aa15b2b53af0ac3
+		aotLib[0xc7ad91000d018166] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_5aa15b2b53af0ac3>>();
+	};
+		// wide_cef1f7f4db0489e7
+		aotLib[0x90ddac1f078d3b91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , int32_t  ),&wide_cef1f7f4db0489e7>>();
+	};
+		// [[ init script ]]
+		aotLib[0x4f21575a2df54600] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,3668 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require template_boost
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__f7c48841;
+extern StructInfo __struct_info__d8299e85;
+extern StructInfo __struct_info__b2703645;
+extern TypeInfo __type_info__10db1c1d;
+extern TypeInfo __type_info__da50b805;
+extern TypeInfo __type_info__f42f651e;
+extern TypeInfo __type_info__dc52e0d5;
+extern TypeInfo __type_info__c0e5e0ad;
+extern TypeInfo __type_info__8bc5634d;
+extern TypeInfo __type_info__bab365e;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__3737d9d1;
+extern TypeInfo __type_info__cd849a9b;
+extern TypeInfo __type_info__aaadd575;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__c2b9b42c;
+extern TypeInfo __type_info__6f381053;
+extern TypeInfo __type_info__261bce6f;
+extern TypeInfo __type_info__dd644f60;
+extern TypeInfo __type_info__e749bd33;
+extern TypeInfo __type_info__73c8114e;
+extern TypeInfo __type_info__7da04467;
+extern TypeInfo __type_info__b1ceb1d4;
+extern TypeInfo __type_info__653ef983;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__1cb4fa6d;
+extern TypeInfo __type_info__515c0a3;
+extern TypeInfo __type_info__ccb7c90a;
+extern TypeInfo __type_info__b3bcfd53;
+extern TypeInfo __type_info__46fed0f3;
+extern TypeInfo __type_info__523f6667;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__6d1d425d;
+extern TypeInfo __type_info__ebcc21eb;
+extern TypeInfo __type_info__5ef84086;
+extern TypeInfo __type_info__7a1c4eb7;
+extern TypeInfo __type_info__2b3e54e5;
+extern TypeInfo __type_info__4de83811;
+extern TypeInfo __type_info__94ae69a3;
+extern TypeInfo __type_info__87a6e894;
+extern TypeInfo __type_info__a6a527e0;
+extern TypeInfo __type_info__83498580;
+extern TypeInfo __type_info__a960d6ab;
+extern TypeInfo __type_info__b108e3;
+extern TypeInfo __type_info__d7eb08f1;
+extern TypeInfo __type_info__f486e881;
+extern TypeInfo __type_info__1683ec13;
+extern TypeInfo __type_info__1d5a02b1;
+extern TypeInfo __type_info__8f8da119;
+extern TypeInfo __type_info__5bc565f1;
+extern TypeInfo __type_info__819d499d;
+extern TypeInfo __type_info__81be117c;
+extern TypeInfo __type_info__b5d7ce5d;
+extern TypeInfo __type_info__32f7a66b;
+extern TypeInfo __type_info__cae7a171;
+extern TypeInfo __type_info__453f3d02;
+extern TypeInfo __type_info__30023ebb;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__4edf488d;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8fce7587;
+extern TypeInfo __type_info__a01f8605;
+extern TypeInfo __type_info__15780d4b;
+extern TypeInfo __type_info__7ec0323f;
+extern TypeInfo __type_info__ae076c;
+extern TypeInfo __type_info__ff9fd5d3;
+extern TypeInfo __type_info__3c4f7906;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__c4ccbb7e;
+extern TypeInfo __type_info__8e3dc326;
+extern TypeInfo __type_info__d73ee2dd;
+extern TypeInfo __type_info__72ae9081;
+extern TypeInfo __type_info__c831b26a;
+extern TypeInfo __type_info__72374920;
+extern TypeInfo __type_info__d25748d6;
+extern TypeInfo __type_info__3a70d70f;
+extern TypeInfo __type_info__7c510f91;
+extern TypeInfo __type_info__b66d9ef1;
+extern TypeInfo __type_info__91c4dfb3;
+extern TypeInfo __type_info__15e14f92;
+extern TypeInfo __type_info__ebc70931;
+extern TypeInfo __type_info__3c8fd4b4;
+extern TypeInfo __type_info__4e52e6ae;
+extern TypeInfo __type_info__7ebfa292;
+extern TypeInfo __type_info__9773df12;
+extern TypeInfo __type_info__317f8d25;
+extern TypeInfo __type_info__3c6fa07f;
+extern TypeInfo __type_info__9920ba3b;
+extern TypeInfo __type_info__8f234b97;
+extern TypeInfo __type_info__87882376;
+extern TypeInfo __type_info__5f6a7cad;
+extern TypeInfo __type_info__10b7decc;
+extern TypeInfo __type_info__c9679a50;
+extern TypeInfo __type_info__8494e015;
+extern TypeInfo __type_info__8f3455dd;
+extern TypeInfo __type_info__b867c43d;
+extern TypeInfo __type_info__9e20c21a;
+extern TypeInfo __type_info__b9491240;
+extern TypeInfo __type_info__963c776b;
+extern TypeInfo __type_info__b58fe8a6;
+extern TypeInfo __type_info__5527f9ed;
+extern TypeInfo __type_info__fba33907;
+extern TypeInfo __type_info__51c55633;
+extern TypeInfo __type_info__84917dd0;
+extern TypeInfo __type_info__b9a2b501;
+extern TypeInfo __type_info__68f47b8a;
+extern TypeInfo __type_info__34157e23;
+extern TypeInfo __type_info__65966b2b;
+extern TypeInfo __type_info__37ca469d;
+extern TypeInfo __type_info__14c14bf4;
+extern TypeInfo __type_info__4fa9a2d8;
+extern TypeInfo __type_info__d4f3571c;
+extern TypeInfo __type_info__2d8fb614;
+extern TypeInfo __type_info__10edfe53;
+extern TypeInfo __type_info__b38eb5b3;
+extern TypeInfo __type_info__2481035b;
+extern TypeInfo __type_info__a1ba446d;
+extern TypeInfo __type_info__9fee7340;
+extern TypeInfo __type_info__ada7aa90;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__664a2fe7;
+extern TypeInfo __type_info__655bd8a4;
+extern TypeInfo __type_info__2f1bdc9a;
+extern TypeInfo __type_info__8fd2ec2e;
+extern TypeInfo __type_info__5dc56917;
+extern TypeInfo __type_info__d16acbbb;
+extern TypeInfo __type_info__d4aee91;
+extern TypeInfo __type_info__2ba0095f;
+extern TypeInfo __type_info__d057deb9;
+extern TypeInfo __type_info__6dd946fa;
+extern TypeInfo __type_info__32b24044;
+extern TypeInfo __type_info__531e5432;
+extern TypeInfo __type_info__e0a995b4;
+extern TypeInfo __type_info__368fac4c;
+extern TypeInfo __type_info__76b8ad03;
+extern TypeInfo __type_info__48d9d78;
+extern TypeInfo __type_info__6535171f;
+extern TypeInfo __type_info__9ee277f5;
+extern TypeInfo __type_info__e7b89eff;
+extern TypeInfo __type_info__8f8b0275;
+extern TypeInfo __type_info__764dc75a;
+extern TypeInfo __type_info__e2deda56;
+extern TypeInfo __type_info__5a28d785;
+extern TypeInfo __type_info__9445fbcf;
+extern TypeInfo __type_info__7df5ef2c;
+extern TypeInfo __type_info__bf2d884b;
+extern TypeInfo __type_info__6c2a86f9;
+extern TypeInfo __type_info__391e819b;
+extern TypeInfo __type_info__e97755bb;
+extern TypeInfo __type_info__295e937b;
+extern TypeInfo __type_info__1d3d6764;
+extern TypeInfo __type_info__251bccdc;
+extern TypeInfo __type_info__bd757ca;
+extern TypeInfo __type_info__5ac5645e;
+extern TypeInfo __type_info__e4d4c1e4;
+extern TypeInfo __type_info__d514cba4;
+extern TypeInfo __type_info__60d19370;
+extern TypeInfo __type_info__c5ddc6fa;
+extern TypeInfo __type_info__9f20c3ad;
+extern TypeInfo __type_info__1b3c6d8d;
+extern TypeInfo __type_info__6529db2b;
+extern TypeInfo __type_info__a8d37f6f;
+extern TypeInfo __type_info__d7ddca10;
+extern TypeInfo __type_info__130d26f9;
+extern TypeInfo __type_info__721467d3;
+extern TypeInfo __type_info__8728109a;
+extern TypeInfo __type_info__1bb5fdf7;
+extern TypeInfo __type_info__a65edd74;
+extern TypeInfo __type_info__76972586;
+extern TypeInfo __type_info__5ca338ad;
+extern TypeInfo __type_info__d180e781;
+extern TypeInfo __type_info__74b0f2db;
+extern TypeInfo __type_info__cf57dd26;
+extern TypeInfo __type_info__535415eb;
+extern TypeInfo __type_info__ccc9122b;
+extern TypeInfo __type_info__b2cb4a2b;
+extern TypeInfo __type_info__a5b6b194;
+extern TypeInfo __type_info__ccee123b;
+extern TypeInfo __type_info__374b4b09;
+extern TypeInfo __type_info__9338185;
+extern TypeInfo __type_info__cf52b1be;
+extern TypeInfo __type_info__9a5b5986;
+extern TypeInfo __type_info__7856e79d;
+extern TypeInfo __type_info__75b7ce79;
+extern TypeInfo __type_info__5f1adc0e;
+extern TypeInfo __type_info__cd57da00;
+extern TypeInfo __type_info__a8981616;
+extern TypeInfo __type_info__88de8728;
+extern TypeInfo __type_info__1b9f61f8;
+extern TypeInfo __type_info__79323f61;
+extern TypeInfo __type_info__231bc9b6;
+extern TypeInfo __type_info__8121e453;
+extern TypeInfo __type_info__d3ebcc43;
+extern TypeInfo __type_info__f2cdf1a0;
+extern TypeInfo __type_info__d8ac9e75;
+extern TypeInfo __type_info__fc0d99dd;
+extern TypeInfo __type_info__c1e3d526;
+extern TypeInfo __type_info__c627fc0a;
+extern TypeInfo __type_info__a40a0d70;
+extern TypeInfo __type_info__858d2368;
+extern TypeInfo __type_info__26379cda;
+extern TypeInfo __type_info__c6cb0399;
+extern TypeInfo __type_info__f66d4d6;
+extern TypeInfo __type_info__fe4bfa47;
+extern TypeInfo __type_info__cb3ec93c;
+extern TypeInfo __type_info__27a9a437;
+extern TypeInfo __type_info__374bcd9;
+extern TypeInfo __type_info__39dd41c1;
+extern TypeInfo __type_info__d00bb3d6;
+extern TypeInfo __type_info__f1eeff10;
+extern TypeInfo __type_info__b081465d;
+extern TypeInfo __type_info__8c0d0a29;
+extern TypeInfo __type_info__be386f7a;
+extern TypeInfo __type_info__cf76cec3;
+extern TypeInfo __type_info__ed20bab;
+extern TypeInfo __type_info__309172d;
+extern VarInfo __var_info__defbc900;
+extern VarInfo __var_info__4c5eafab;
+extern VarInfo __var_info__c83e663a;
+extern VarInfo __var_info__21dc0f2b;
+extern VarInfo __var_info__38385043;
+extern VarInfo __var_info__81eb992b;
+extern VarInfo __var_info__17b491;
+extern VarInfo __var_info__aefafc88;
+extern VarInfo __var_info__14bcb702;
+extern VarInfo __var_info__d0c715a1;
+extern VarInfo __var_info__3afd413;
+extern VarInfo __var_info__44d30d89;
+extern VarInfo __var_info__6e97f0ea;
+extern VarInfo __var_info__5195b539;
+extern VarInfo __var_info__33b78b35;
+extern VarInfo __var_info__11aeae1c;
+extern VarInfo __var_info__a1981da5;
+extern VarInfo __var_info__6f4d2d82;
+extern VarInfo __var_info__8965dfd1;
+extern VarInfo __var_info__4f41a6a;
+extern VarInfo __var_info__442b5d7f;
+extern VarInfo __var_info__565abdaf;
+extern VarInfo __var_info__c0dd11fe;
+extern VarInfo __var_info__d4f9c662;
+extern VarInfo __var_info__fde3ac29;
+extern VarInfo __var_info__7607b7d3;
+extern VarInfo __var_info__466e4cc6;
+extern VarInfo __var_info__28430603;
+extern VarInfo __var_info__301336b9;
+extern VarInfo __var_info__d6c089cc;
+extern VarInfo __var_info__d561f037;
+extern VarInfo __var_info__a92f607e;
+extern VarInfo __var_info__5cb08ff;
+extern VarInfo __var_info__43aa71c5;
+extern VarInfo __var_info__3ea32d3f;
+extern VarInfo __var_info__c84acfc5;
+extern VarInfo __var_info__259f69d7;
+extern VarInfo __var_info__e1411cbc;
+extern VarInfo __var_info__7c486554;
+extern VarInfo __var_info__bc135f39;
+extern VarInfo __var_info__fd6fb885;
+extern VarInfo __var_info__128e68c7;
+extern VarInfo __var_info__35e4f53d;
+extern VarInfo __var_info__98dc5351;
+extern VarInfo __var_info__de11b7cd;
+extern VarInfo __var_info__3137cfac;
+extern VarInfo __var_info__f3715aaa;
+extern VarInfo __var_info__db853894;
+extern VarInfo __var_info__789e94bd;
+extern VarInfo __var_info__24d03a3;
+extern VarInfo __var_info__51909aff;
+extern VarInfo __var_info__15a70afa;
+extern VarInfo __var_info__e1903c80;
+extern VarInfo __var_info__d45deb11;
+extern VarInfo __var_info__d268fc9d;
+extern VarInfo __var_info__f7387f87;
+extern VarInfo __var_info__d0aaba21;
+extern VarInfo __var_info__ad5a0405;
+extern VarInfo __var_info__f902c2de;
+extern VarInfo __var_info__6758a118;
+extern VarInfo __var_info__215e3c49;
+extern VarInfo __var_info__9c6f2679;
+extern VarInfo __var_info__e419970d;
+extern VarInfo __var_info__3b14171a;
+extern VarInfo __var_info__359e840f;
+extern VarInfo __var_info__70ceceae;
+extern VarInfo __var_info__87a35502;
+extern VarInfo __var_info__80719338;
+extern VarInfo __var_info__d1222c0d;
+extern VarInfo __var_info__1e61ea45;
+extern VarInfo __var_info__641a19bc;
+extern VarInfo __var_info__6d3d92b1;
+extern VarInfo __var_info__988afcfd;
+extern VarInfo __var_info__335fefcf;
+extern VarInfo __var_info__b53e0386;
+extern VarInfo __var_info__24c5bcc6;
+extern VarInfo __var_info__dc873d46;
+extern VarInfo __var_info__88ef7dca;
+extern VarInfo __var_info__cfa03d0a;
+extern VarInfo __var_info__d11ed6d8;
+extern VarInfo __var_info__3c57dab6;
+extern VarInfo __var_info__d811ae5b;
+extern VarInfo __var_info__80289013;
+extern VarInfo __var_info__6eaa7d50;
+extern VarInfo __var_info__12ddd6b7;
+extern VarInfo __var_info__8dd58436;
+extern VarInfo __var_info__284e759;
+extern VarInfo __var_info__9cd677e8;
+extern VarInfo __var_info__cb496173;
+extern VarInfo __var_info__2663c954;
+extern VarInfo __var_info__2cbdc12a;
+extern VarInfo __var_info__5fa7d37b;
+extern VarInfo __var_info__afedb257;
+extern VarInfo __var_info__3faadbe1;
+extern VarInfo __var_info__be3e567c;
+extern VarInfo __var_info__e8944de;
+extern VarInfo __var_info__c59e8d7f;
+extern VarInfo __var_info__8d6b384e;
+extern VarInfo __var_info__c8e5f55;
+extern VarInfo __var_info__1281d352;
+extern VarInfo __var_info__5fa306c7;
+extern VarInfo __var_info__9d59dc9b;
+extern VarInfo __var_info__5fae876d;
+extern VarInfo __var_info__31003f6c;
+extern VarInfo __var_info__4ea380c9;
+extern VarInfo __var_info__e1325d76;
+extern VarInfo __var_info__5b5aed7e;
+extern VarInfo __var_info__35318804;
+extern VarInfo __var_info__aa734da0;
+extern VarInfo __var_info__3e52831d;
+extern VarInfo __var_info__89ced8e1;
+extern VarInfo __var_info__9fd03390;
+extern VarInfo __var_info__7ea03b0a;
+extern VarInfo __var_info__3f5db93a;
+extern VarInfo __var_info__25cbf39c;
+extern VarInfo __var_info__afc9d92d;
+extern VarInfo __var_info__c3059e01;
+extern VarInfo __var_info__345035e;
+extern VarInfo __var_info__136984c9;
+extern VarInfo __var_info__2205519;
+extern VarInfo __var_info__afad3116;
+extern VarInfo __var_info__71503435;
+extern VarInfo __var_info__56bc3b31;
+extern VarInfo __var_info__e85d642a;
+extern VarInfo __var_info__15763a84;
+extern VarInfo __var_info__1b0fa198;
+extern VarInfo __var_info__526a5d2e;
+extern VarInfo __var_info__a433d831;
+extern VarInfo __var_info__24056922;
+extern VarInfo __var_info__cafe3512;
+extern VarInfo __var_info__aa05dad3;
+extern VarInfo __var_info__fcdb84a;
+extern VarInfo __var_info__ad56015e;
+extern VarInfo __var_info__cb3eecea;
+extern VarInfo __var_info__a7dab1e2;
+extern VarInfo __var_info__a9e49593;
+extern VarInfo __var_info__5bede5bc;
+extern VarInfo __var_info__344d19dc;
+extern VarInfo __var_info__353b6e30;
+extern VarInfo __var_info__4c957b89;
+extern VarInfo __var_info__5ee87e14;
+extern VarInfo __var_info__5adfba85;
+extern VarInfo __var_info__8ae88b0c;
+extern VarInfo __var_info__43ff25b;
+extern VarInfo __var_info__1510d975;
+extern VarInfo __var_info__cb50360b;
+extern VarInfo __var_info__c35127d9;
+extern VarInfo __var_info__ba8cda98;
+extern VarInfo __var_info__e4dec3a3;
+extern VarInfo __var_info__999f9e51;
+extern VarInfo __var_info__195519af;
+extern VarInfo __var_info__a0c3d72;
+extern VarInfo __var_info__5ddf8014;
+extern VarInfo __var_info__43f7c55f;
+extern VarInfo __var_info__85e9e725;
+extern VarInfo __var_info__1749eeb0;
+extern VarInfo __var_info__955e0b53;
+extern VarInfo __var_info__1e2edab7;
+extern VarInfo __var_info__491e734a;
+extern VarInfo __var_info__7750928a;
+extern VarInfo __var_info__52c5da8;
+extern VarInfo __var_info__5e90f2e0;
+extern VarInfo __var_info__77243cb4;
+extern VarInfo __var_info__e0a56b3;
+extern VarInfo __var_info__f25a787;
+extern VarInfo __var_info__3924c25d;
+extern VarInfo __var_info__d25b587a;
+extern VarInfo __var_info__4048a67e;
+extern VarInfo __var_info__39fe8578;
+extern VarInfo __var_info__88bd350e;
+extern VarInfo __var_info__afb61852;
+extern VarInfo __var_info__7cfe7756;
+extern VarInfo __var_info__b4a7f855;
+extern VarInfo __var_info__91824df1;
+extern VarInfo __var_info__20a181d6;
+extern VarInfo __var_info__2f8f3c6e;
+extern VarInfo __var_info__89b1ed2f;
+extern VarInfo __var_info__ed636a01;
+extern VarInfo __var_info__134ae51;
+extern VarInfo __var_info__ad464f32;
+extern VarInfo __var_info__6f00103f;
+extern VarInfo __var_info__f0f23ee;
+extern VarInfo __var_info__32c5dc83;
+extern VarInfo __var_info__adc7f415;
+extern VarInfo __var_info__989f9cbe;
+extern VarInfo __var_info__c9d28329;
+extern VarInfo __var_info__b69afd24;
+extern VarInfo __var_info__54f04d6d;
+extern VarInfo __var_info__754e508d;
+extern VarInfo __var_info__1b61456e;
+extern VarInfo __var_info__c4a28f5d;
+extern VarInfo __var_info__2965e55d;
+extern VarInfo __var_info__a6016d01;
+extern VarInfo __var_info__d15980dd;
+extern VarInfo __var_info__c68aac09;
+extern VarInfo __var_info__a80e5f39;
+extern VarInfo __var_info__f87a4673;
+extern VarInfo __var_info__88b468bd;
+extern VarInfo __var_info__d676fdc3;
+extern VarInfo __var_info__ac1f0992;
+extern VarInfo __var_info__f502f93d;
+extern VarInfo __var_info__a84c4eb2;
+extern VarInfo __var_info__a2c8d600;
+extern VarInfo __var_info__cbd679f5;
+extern VarInfo __var_info__4bbc29e0;
+extern VarInfo __var_info__2f87634a;
+extern VarInfo __var_info__880f2249;
+extern VarInfo __var_info__2b2ad1be;
+extern VarInfo __var_info__8c9733b3;
+extern VarInfo __var_info__c1b7832e;
+extern VarInfo __var_info__5ad4b8bb;
+extern VarInfo __var_info__a8b662ad;
+extern VarInfo __var_info__1c56de;
+extern VarInfo __var_info__9f981a7f;
+extern VarInfo __var_info__d6bd6ae8;
+extern VarInfo __var_info__fe79df50;
+extern VarInfo __var_info__f3ae166d;
+extern VarInfo __var_info__67cfaaa3;
+extern VarInfo __var_info__5c6bc94e;
+extern VarInfo __var_info__4ad2c59b;
+extern VarInfo __var_info__328f4127;
+extern VarInfo __var_info__6e003b99;
+extern VarInfo __var_info__306dbb9;
+extern VarInfo __var_info__5913c5ff;
+extern VarInfo __var_info__b64bc67d;
+extern VarInfo __var_info__37233ab;
+extern VarInfo __var_info__a0320b17;
+extern VarInfo __var_info__70645b84;
+extern VarInfo __var_info__9b9fa177;
+extern VarInfo __var_info__a10f6f08;
+extern VarInfo __var_info__59a80c5a;
+extern VarInfo __var_info__8644430a;
+extern VarInfo __var_info__ce48994c;
+extern VarInfo __var_info__e4ad6bbc;
+extern VarInfo __var_info__f2348094;
+extern VarInfo __var_info__7fdcf902;
+extern VarInfo __var_info__ebb2425b;
+extern VarInfo __var_info__289e9e81;
+extern VarInfo __var_info__118e6734;
+extern VarInfo __var_info__c3267848;
+extern VarInfo __var_info__4a0bfd29;
+extern VarInfo __var_info__a4d9d088;
+extern VarInfo __var_info__6c08a2e5;
+extern VarInfo __var_info__827a7b9f;
+extern VarInfo __var_info__1e474d2c;
+extern VarInfo __var_info__95c61ddd;
+extern VarInfo __var_info__21588a7a;
+extern VarInfo __var_info__d1d7579a;
+extern VarInfo __var_info__3b2e5b3;
+extern VarInfo __var_info__aa30df58;
+extern VarInfo __var_info__b35acbb;
+extern VarInfo __var_info__79672322;
+extern VarInfo __var_info__681796de;
+extern VarInfo __var_info__eddf0d34;
+extern VarInfo __var_info__139dd2ff;
+extern VarInfo __var_info__b0c3f05;
+extern VarInfo __var_info__fdf2fbb1;
+extern VarInfo __var_info__878c9d78;
+extern VarInfo __var_info__e0b0280f;
+extern VarInfo __var_info__d831ca52;
+extern VarInfo __var_info__ed01610c;
+extern VarInfo __var_info__cc0f5e2c;
+extern VarInfo __var_info__31bb098e;
+extern VarInfo __var_info__9920ff5c;
+extern VarInfo __var_info__64f4b569;
+extern VarInfo __var_info__a2d03849;
+extern VarInfo __var_info__5dfec455;
+extern VarInfo __var_info__c6bf2bd2;
+extern VarInfo __var_info__2d3a4cbf;
+extern VarInfo __var_info__dfbb50cb;
+extern VarInfo __var_info__1ea21679;
+extern VarInfo __var_info__3f48a4eb;
+extern VarInfo __var_info__fbd35c53;
+extern VarInfo __var_info__5876c12f;
+extern VarInfo __var_info__a9b0cc55;
+extern VarInfo __var_info__a246be3c;
+extern VarInfo __var_info__cd707403;
+extern VarInfo __var_info__6d5c4cbf;
+extern VarInfo __var_info__f5f3aa58;
+extern VarInfo __var_info__e95012d3;
+extern VarInfo __var_info__6fc12b47;
+extern VarInfo __var_info__7a87bd0e;
+extern VarInfo __var_info__919eabb1;
+extern VarInfo __var_info__743fd8f1;
+extern VarInfo __var_info__12214d06;
+extern VarInfo __var_info__dbe74630;
+extern VarInfo __var_info__daf9c095;
+extern VarInfo __var_info__c67d2be7;
+extern VarInfo __var_info__97b1c4ed;
+extern VarInfo __var_info__fa784e29;
+extern VarInfo __var_info__1e551916;
+extern VarInfo __var_info__53ae532f;
+extern VarInfo __var_info__6ec9205;
+extern VarInfo __var_info__b74c3b5f;
+extern VarInfo __var_info__6c9e81d9;
+extern VarInfo __var_info__bd3bde81;
+extern VarInfo __var_info__110c4877;
+extern VarInfo __var_info__914d2e65;
+extern VarInfo __var_info__cdf950db;
+extern VarInfo __var_info__5e9f4399;
+extern VarInfo __var_info__82cbd0b6;
+extern VarInfo __var_info__9bfd602;
+extern VarInfo __var_info__ae38f915;
+extern VarInfo __var_info__c3f032ca;
+extern VarInfo __var_info__5afbb756;
+extern VarInfo __var_info__1e246f58;
+extern VarInfo __var_info__fd9427e4;
+extern VarInfo __var_info__703ee92c;
+extern VarInfo __var_info__171280cf;
+extern VarInfo __var_info__f891e8e9;
+extern VarInfo __var_info__e4eb34d9;
+extern VarInfo __var_info__1f25853f;
+extern VarInfo __var_info__719e89b8;
+extern VarInfo __var_info__b632464e;
+extern VarInfo __var_info__85473ce6;
+extern VarInfo __var_info__f530eb6;
+extern VarInfo __var_info__a283d6f3;
+extern VarInfo __var_info__384250c1;
+extern VarInfo __var_info__9e9818ec;
+extern VarInfo __var_info__e66ecfd4;
+extern VarInfo __var_info__e6a0bda4;
+extern VarInfo __var_info__681fd331;
+extern VarInfo __var_info__454c29fd;
+extern VarInfo __var_info__7df46418;
+extern VarInfo __var_info__57bc3cc4;
+extern VarInfo __var_info__50c3593;
+extern VarInfo __var_info__c053d161;
+extern VarInfo __var_info__ed271809;
+extern VarInfo __var_info__b8ba8abc;
+extern VarInfo __var_info__fea50286;
+extern VarInfo __var_info__c23281bc;
+extern VarInfo __var_info__b873b4e2;
+extern VarInfo __var_info__64bce7f2;
+extern VarInfo __var_info__ac29e6b9;
+extern VarInfo __var_info__56569ad4;
+extern VarInfo __var_info__e8792aee;
+extern VarInfo __var_info__89e422d2;
+extern VarInfo __var_info__d231c0e0;
+extern VarInfo __var_info__cfe854bb;
+extern VarInfo __var_info__1bbde4e9;
+extern VarInfo __var_info__7404e45b;
+extern VarInfo __var_info__9b78bd2b;
+extern VarInfo __var_info__822a0a6f;
+extern VarInfo __var_info__95468c11;
+extern VarInfo __var_info__51121ef;
+extern VarInfo __var_info__7dd077b7;
+extern VarInfo __var_info__90b2c99b;
+extern VarInfo __var_info__f1675330;
+extern VarInfo __var_info__e746bea8;
+extern VarInfo __var_info__71cce875;
+extern VarInfo __var_info__63a3eac;
+extern VarInfo __var_info__3bbe5820;
+extern VarInfo __var_info__9bd0e54c;
+extern VarInfo __var_info__729e8b4b;
+extern VarInfo __var_info__c2ec29d8;
+extern VarInfo __var_info__b96429ed;
+extern VarInfo __var_info__e8005be5;
+extern VarInfo __var_info__f2f1d3aa;
+extern VarInfo __var_info__3e48a358;
+extern VarInfo __var_info__c3464558;
+extern VarInfo __var_info__5532d30;
+extern VarInfo __var_info__f40c6c0d;
+extern VarInfo __var_info__9edcbce;
+extern VarInfo __var_info__8f9f8e93;
+extern VarInfo __var_info__52ff6128;
+extern VarInfo __var_info__c32d1370;
+extern VarInfo __var_info__bb163ec9;
+extern VarInfo __var_info__a14c8807;
+extern VarInfo __var_info__54137cf8;
+extern VarInfo __var_info__de31d3c4;
+extern VarInfo __var_info__d7a0c00a;
+extern VarInfo __var_info__d62685b2;
+extern VarInfo __var_info__10bf88c5;
+extern VarInfo __var_info__c5282f96;
+extern VarInfo __var_info__7f27ca02;
+extern VarInfo __var_info__c23e5cc8;
+extern VarInfo __var_info__1c9914bb;
+extern VarInfo __var_info__f4999d8b;
+extern VarInfo __var_info__6521e890;
+extern VarInfo __var_info__e658a037;
+extern VarInfo __var_info__e54d2a64;
+extern VarInfo __var_info__13d0c96d;
+extern VarInfo __var_info__270ef73f;
+extern VarInfo __var_info__661a1ce2;
+extern VarInfo __var_info__acc6c28c;
+extern VarInfo __var_info__92e3d111;
+extern VarInfo __var_info__318f3f94;
+extern VarInfo __var_info__4ae230f3;
+extern VarInfo __var_info__554a21ae;
+extern VarInfo __var_info__cfe120c6;
+extern VarInfo __var_info__63db4794;
+extern VarInfo __var_info__61337c35;
+extern VarInfo __var_info__a0d03523;
+extern VarInfo __var_info__21e1bb65;
+extern VarInfo __var_info__9cd84da2;
+extern VarInfo __var_info__d931cbe5;
+extern VarInfo __var_info__ba5a2df0;
+extern VarInfo __var_info__afac4da3;
+extern VarInfo __var_info__1dd0d240;
+extern VarInfo __var_info__dcd95cf7;
+extern VarInfo __var_info__1fff0112;
+extern VarInfo __var_info__7447bb4f;
+extern VarInfo __var_info__915be3cd;
+extern VarInfo __var_info__5e5c32d3;
+extern VarInfo __var_info__c5f99f7a;
+extern VarInfo __var_info__6a6ed0d6;
+extern VarInfo __var_info__f6d12b0;
+extern VarInfo __var_info__a0ecfbb9;
+extern VarInfo __var_info__43629ba6;
+extern VarInfo __var_info__2631ba0e;
+extern VarInfo __var_info__bac4281b;
+extern VarInfo __var_info__aac7e0af;
+extern VarInfo __var_info__25640847;
+extern VarInfo __var_info__a02c830;
+extern VarInfo __var_info__8b73a850;
+extern VarInfo __var_info__9ba617a4;
+extern VarInfo __var_info__490512e0;
+extern VarInfo __var_info__afd807ea;
+extern VarInfo __var_info__757540b8;
+extern VarInfo __var_info__75c92fd3;
+extern VarInfo __var_info__e3083f3d;
+extern VarInfo __var_info__249de8b;
+extern VarInfo __var_info__9356e5ba;
+extern VarInfo __var_info__90a51465;
+extern VarInfo __var_info__fab34e78;
+extern VarInfo __var_info__2f133526;
+extern VarInfo __var_info__c5b7315a;
+extern VarInfo __var_info__f25fabc1;
+extern VarInfo __var_info__78bcb4df;
+extern VarInfo __var_info__14ed24ca;
+extern VarInfo __var_info__e1345261;
+extern VarInfo __var_info__8f4c9038;
+extern VarInfo __var_info__6c97d67;
+extern VarInfo __var_info__25400e0e;
+extern VarInfo __var_info__d5146090;
+extern VarInfo __var_info__8812876d;
+extern VarInfo __var_info__21f91cf0;
+extern VarInfo __var_info__d711acc8;
+extern VarInfo __var_info__cc7ec7e3;
+extern VarInfo __var_info__51fe2fda;
+extern VarInfo __var_info__c830e42e;
+extern VarInfo __var_info__c93f0085;
+extern VarInfo __var_info__2c383e55;
+extern VarInfo __var_info__ae8d05f1;
+extern VarInfo __var_info__b08b6929;
+extern VarInfo __var_info__36caa52;
+extern VarInfo __var_info__89d92e8f;
+extern VarInfo __var_info__7acd6d0b;
+extern VarInfo __var_info__ba5333e6;
+extern VarInfo __var_info__6dbb285b;
+extern VarInfo __var_info__10a7223;
+extern VarInfo __var_info__cc02d1d4;
+extern VarInfo __var_info__83d50dee;
+extern VarInfo __var_info__95367d40;
+extern VarInfo __var_info__8e2824c5;
+extern VarInfo __var_info__a74c85b9;
+extern VarInfo __var_info__717f8e67;
+extern VarInfo __var_info__2af4d3dc;
+extern VarInfo __var_info__23fa073a;
+extern VarInfo __var_info__a343220e;
+extern VarInfo __var_info__108e65a1;
+extern VarInfo __var_info__4c0c004f;
+extern VarInfo __var_info__a53d05f7;
+extern VarInfo __var_info__b7d4d4bf;
+extern VarInfo __var_info__89631998;
+extern VarInfo __var_info__a216b644;
+extern VarInfo __var_info__5fa0ff2d;
+extern VarInfo __var_info__f97b9aaf;
+extern VarInfo __var_info__a42b136c;
+extern VarInfo __var_info__f21f8d57;
+extern VarInfo __var_info__25c0eaac;
+extern VarInfo __var_info__e51104e3;
+extern VarInfo __var_info__888bf034;
+extern VarInfo __var_info__6b78c570;
+extern VarInfo __var_info__1ad4800e;
+extern VarInfo __var_info__49ff5941;
+extern VarInfo __var_info__93aec5b5;
+extern VarInfo __var_info__7705b54f;
+extern VarInfo __var_info__ebd6bd76;
+extern VarInfo __var_info__9794b2fb;
+extern VarInfo __var_info__c93e67cd;
+extern VarInfo __var_info__d6146223;
+extern VarInfo __var_info__7a6d5817;
+extern VarInfo __var_info__319243ae;
+extern VarInfo __var_info__169d2283;
+extern VarInfo __var_info__ccba528d;
+extern VarInfo __var_info__56106614;
+extern VarInfo __var_info__4b0bfebc;
+extern VarInfo __var_info__546203a;
+extern VarInfo __var_info__af8049d5;
+extern VarInfo __var_info__3113384c;
+extern VarInfo __var_info__449b0350;
+extern VarInfo __var_info__5b860ccd;
+extern VarInfo __var_info__b4eea441;
+extern VarInfo __var_info__501c6fb6;
+extern VarInfo __var_info__327e2124;
+extern VarInfo __var_info__6274536f;
+extern VarInfo __var_info__35133e98;
+extern VarInfo __var_info__b6eb0c4b;
+extern VarInfo __var_info__36bf6516;
+extern VarInfo __var_info__3021cb;
+extern VarInfo __var_info__ffd9fe3a;
+extern VarInfo __var_info__b03dd324;
+extern VarInfo __var_info__651a1b4f;
+extern VarInfo __var_info__55bc399e;
+extern VarInfo __var_info__e7855a6d;
+extern VarInfo __var_info__af00471;
+extern VarInfo __var_info__e9d75fa2;
+extern VarInfo __var_info__5e621dd0;
+extern VarInfo __var_info__7776bab9;
+extern VarInfo __var_info__e9e73a57;
+extern VarInfo __var_info__ee0efbc3;
+extern VarInfo __var_info__cea9756b;
+extern VarInfo __var_info__9119fe9a;
+extern VarInfo __var_info__ea5d24a1;
+extern VarInfo __var_info__3cb36c5c;
+extern VarInfo __var_info__ecd62ce5;
+extern VarInfo __var_info__d32d8eb8;
+extern VarInfo __var_info__48435b14;
+extern VarInfo __var_info__f021c7e4;
+extern VarInfo __var_info__94bb64af;
+extern VarInfo __var_info__6c164ebf;
+extern VarInfo __var_info__c985a48c;
+extern VarInfo __var_info__1c524c4f;
+extern VarInfo __var_info__eee3bc09;
+extern VarInfo __var_info__f1edd27b;
+extern VarInfo __var_info__ee817484;
+extern VarInfo __var_info__66508312;
+extern VarInfo __var_info__7374dd3c;
+extern VarInfo __var_info__31ca940d;
+extern VarInfo __var_info__95924bd0;
+extern VarInfo __var_info__ea97d138;
+extern VarInfo __var_info__d01907f8;
+extern VarInfo __var_info__c3b6596e;
+extern VarInfo __var_info__24dea7de;
+extern VarInfo __var_info__e1e0cf54;
+extern VarInfo __var_info__db146a02;
+extern VarInfo __var_info__995eb31;
+extern VarInfo __var_info__4a66add7;
+extern VarInfo __var_info__c2023960;
+extern VarInfo __var_info__fdcc980e;
+extern VarInfo __var_info__e058a616;
+extern VarInfo __var_info__d76915b6;
+extern VarInfo __var_info__aff78d24;
+extern VarInfo __var_info__3562056e;
+extern VarInfo __var_info__12c1f55a;
+
+VarInfo __struct_info__f7c48841_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xee817484, "__rtti", 0 };
+TypeInfo * __type_info__6f00103f_arg_types_var_4156852289[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__f7c48841_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f00103f_arg_types_var_4156852289, nullptr, 1, 0, nullptr, 28, 0x6f00103f, "__finalize", 8 };
+TypeInfo * __type_info__3e52831d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__f7c48841_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e52831d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x3e52831d, "preVisitProgram", 12 };
+TypeInfo * __type_info__7750928a_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__f7c48841_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7750928a_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7750928a, "visitProgram", 16 };
+TypeInfo * __type_info__b96429ed_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__f7c48841_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b96429ed_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb96429ed, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__51121ef_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__f7c48841_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51121ef_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x51121ef, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__afb61852_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__f7c48841_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__afb61852_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xafb61852, "visitTypeDecl", 28 };
+TypeInfo * __type_info__5adfba85_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__f7c48841_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5adfba85_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x5adfba85, "preVisitAlias", 32 };
+TypeInfo * __type_info__6a6ed0d6_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__f7c48841_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__6a6ed0d6_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x6a6ed0d6, "visitAlias", 36 };
+TypeInfo * __type_info__8d6b384e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__f7c48841_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d6b384e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x8d6b384e, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__89d92e8f_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89d92e8f_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0x89d92e8f, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__d1d7579a_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1d7579a_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xd1d7579a, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__5dfec455_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__f7c48841_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__5dfec455_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5dfec455, "visitEnumeration", 52 };
+TypeInfo * __type_info__a2c8d600_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__f7c48841_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a2c8d600_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa2c8d600, "preVisitStructure", 56 };
+TypeInfo * __type_info__3137cfac_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3137cfac_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x3137cfac, "preVisitStructureField", 60 };
+TypeInfo * __type_info__8812876d_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8812876d_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x8812876d, "visitStructureField", 64 };
+TypeInfo * __type_info__4ae230f3_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__f7c48841_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__4ae230f3_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x4ae230f3, "visitStructure", 68 };
+TypeInfo * __type_info__7404e45b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__f7c48841_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7404e45b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7404e45b, "preVisitFunction", 72 };
+TypeInfo * __type_info__1b61456e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__f7c48841_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__1b61456e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1b61456e, "visitFunction", 76 };
+TypeInfo * __type_info__54137cf8_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54137cf8_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x54137cf8, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__ed271809_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__ed271809_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xed271809, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__cfa03d0a_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfa03d0a_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xcfa03d0a, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__e658a037_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e658a037_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xe658a037, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__28430603_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__f7c48841_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__28430603_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x28430603, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__7fdcf902_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__f7c48841_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7fdcf902_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7fdcf902, "visitFunctionBody", 100 };
+TypeInfo * __type_info__e419970d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e419970d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe419970d, "preVisitExpression", 104 };
+TypeInfo * __type_info__c3267848_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3267848_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc3267848, "visitExpression", 108 };
+TypeInfo * __type_info__d0c715a1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__f7c48841_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d0c715a1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd0c715a1, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__c3f032ca_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__f7c48841_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3f032ca_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc3f032ca, "visitExprBlock", 116 };
+TypeInfo * __type_info__a84c4eb2_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a84c4eb2_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xa84c4eb2, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__6ec9205_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__6ec9205_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x6ec9205, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__fab34e78_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fab34e78_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xfab34e78, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__aa05dad3_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__aa05dad3_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xaa05dad3, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__a0320b17_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0320b17_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xa0320b17, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__f5f3aa58_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f5f3aa58_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xf5f3aa58, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__f87a4673_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__f7c48841_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f87a4673_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf87a4673, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__b53e0386_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__f7c48841_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b53e0386_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb53e0386, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__ecd62ce5_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ecd62ce5_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xecd62ce5, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__e54d2a64_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e54d2a64_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xe54d2a64, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__daf9c095_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__f7c48841_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__daf9c095_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xdaf9c095, "preVisitExprLet", 160 };
+TypeInfo * __type_info__79672322_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__f7c48841_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__79672322_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x79672322, "visitExprLet", 164 };
+TypeInfo * __type_info__71503435_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__71503435_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x71503435, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__24c5bcc6_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__24c5bcc6_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x24c5bcc6, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__10a7223_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10a7223_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x10a7223, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__7374dd3c_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7374dd3c_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x7374dd3c, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__43aa71c5_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__f7c48841_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43aa71c5_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x43aa71c5, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__51fe2fda_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__f7c48841_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51fe2fda_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x51fe2fda, "visitGlobalLet", 188 };
+TypeInfo * __type_info__85e9e725_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__85e9e725_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x85e9e725, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__681796de_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__681796de_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x681796de, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__8c9733b3_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8c9733b3_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x8c9733b3, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__fd9427e4_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fd9427e4_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xfd9427e4, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__9920ff5c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__f7c48841_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9920ff5c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x9920ff5c, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__f21f8d57_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__f7c48841_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f21f8d57_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf21f8d57, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__f021c7e4_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f021c7e4_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xf021c7e4, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__1ea21679_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ea21679_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x1ea21679, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__c3b6596e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__f7c48841_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3b6596e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc3b6596e, "preVisitExprNew", 224 };
+TypeInfo * __type_info__5195b539_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__f7c48841_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5195b539_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5195b539, "visitExprNew", 228 };
+TypeInfo * __type_info__c68aac09_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c68aac09_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xc68aac09, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__88ef7dca_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__88ef7dca_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x88ef7dca, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__6e003b99_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__f7c48841_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e003b99_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x6e003b99, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__24056922_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__f7c48841_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__24056922_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x24056922, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__4f41a6a_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4f41a6a_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x4f41a6a, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__d268fc9d_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__d268fc9d_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xd268fc9d, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__e0a56b3_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__f7c48841_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e0a56b3_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe0a56b3, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__70645b84_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__f7c48841_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__70645b84_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x70645b84, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__a02c830_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a02c830_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xa02c830, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__cd707403_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cd707403_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xcd707403, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__353b6e30_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__f7c48841_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__353b6e30_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x353b6e30, "preVisitExprCall", 272 };
+TypeInfo * __type_info__995eb31_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__f7c48841_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__995eb31_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x995eb31, "visitExprCall", 276 };
+TypeInfo * __type_info__3ea32d3f_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3ea32d3f_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x3ea32d3f, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__e9d75fa2_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e9d75fa2_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xe9d75fa2, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__71cce875_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__f7c48841_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__71cce875_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x71cce875, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__aa734da0_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__f7c48841_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__aa734da0_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xaa734da0, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__5c6bc94e_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5c6bc94e_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x5c6bc94e, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__1510d975_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__f7c48841_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1510d975_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1510d975, "preVisitExprAt", 300 };
+TypeInfo * __type_info__449b0350_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__f7c48841_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__449b0350_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x449b0350, "visitExprAt", 304 };
+TypeInfo * __type_info__5ad4b8bb_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5ad4b8bb_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x5ad4b8bb, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__95367d40_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__f7c48841_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95367d40_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x95367d40, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__8e2824c5_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__f7c48841_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8e2824c5_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x8e2824c5, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__25cbf39c_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25cbf39c_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x25cbf39c, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__1e246f58_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__f7c48841_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1e246f58_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1e246f58, "preVisitExprIs", 324 };
+TypeInfo * __type_info__5b860ccd_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__f7c48841_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b860ccd_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5b860ccd, "visitExprIs", 328 };
+TypeInfo * __type_info__1749eeb0_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__f7c48841_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1749eeb0_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x1749eeb0, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__651a1b4f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__f7c48841_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__651a1b4f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x651a1b4f, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9fd03390_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__f7c48841_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9fd03390_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x9fd03390, "visitExprOp2", 340 };
+TypeInfo * __type_info__90b2c99b_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__90b2c99b_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x90b2c99b, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__641a19bc_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__f7c48841_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__641a19bc_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x641a19bc, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__a0d03523_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__f7c48841_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a0d03523_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa0d03523, "visitExprOp3", 352 };
+TypeInfo * __type_info__f40c6c0d_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f40c6c0d_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xf40c6c0d, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__cfe120c6_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe120c6_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xcfe120c6, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__54f04d6d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__f7c48841_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__54f04d6d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x54f04d6d, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__8ae88b0c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__f7c48841_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8ae88b0c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x8ae88b0c, "visitExprCopy", 368 };
+TypeInfo * __type_info__454c29fd_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__454c29fd_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x454c29fd, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__b64bc67d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__f7c48841_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b64bc67d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb64bc67d, "preVisitExprMove", 376 };
+TypeInfo * __type_info__e1411cbc_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__f7c48841_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e1411cbc_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe1411cbc, "visitExprMove", 380 };
+TypeInfo * __type_info__afc9d92d_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afc9d92d_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xafc9d92d, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__ccba528d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__f7c48841_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ccba528d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xccba528d, "preVisitExprClone", 388 };
+TypeInfo * __type_info__14ed24ca_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__f7c48841_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14ed24ca_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x14ed24ca, "visitExprClone", 392 };
+TypeInfo * __type_info__95c61ddd_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95c61ddd_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x95c61ddd, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__a4d9d088_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__f7c48841_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a4d9d088_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa4d9d088, "preVisitExprWith", 400 };
+TypeInfo * __type_info__91824df1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__f7c48841_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__91824df1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x91824df1, "visitExprWith", 404 };
+TypeInfo * __type_info__56106614_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56106614_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x56106614, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__fd6fb885_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__f7c48841_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fd6fb885_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xfd6fb885, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__e058a616_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__f7c48841_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e058a616_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe058a616, "visitExprWhile", 416 };
+TypeInfo * __type_info__b4a7f855_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b4a7f855_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xb4a7f855, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__95924bd0_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__f7c48841_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95924bd0_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x95924bd0, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__44d30d89_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__f7c48841_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__44d30d89_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x44d30d89, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__1e2edab7_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1e2edab7_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x1e2edab7, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__a8b662ad_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__f7c48841_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a8b662ad_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa8b662ad, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__e66ecfd4_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__f7c48841_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e66ecfd4_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe66ecfd4, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__4ad2c59b_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ad2c59b_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x4ad2c59b, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__bc135f39_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bc135f39_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0xbc135f39, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__51909aff_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__f7c48841_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__51909aff_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x51909aff, "preVisitExprFor", 452 };
+TypeInfo * __type_info__c3464558_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__f7c48841_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c3464558_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc3464558, "visitExprFor", 456 };
+TypeInfo * __type_info__5e5c32d3_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e5c32d3_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x5e5c32d3, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__878c9d78_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__878c9d78_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x878c9d78, "visitExprForVariable", 464 };
+TypeInfo * __type_info__d25b587a_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d25b587a_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0xd25b587a, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__13d0c96d_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__13d0c96d_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x13d0c96d, "visitExprForSource", 472 };
+TypeInfo * __type_info__743fd8f1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__f7c48841_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__743fd8f1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x743fd8f1, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__afedb257_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__f7c48841_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afedb257_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xafedb257, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__81eb992b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__f7c48841_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81eb992b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x81eb992b, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__d32d8eb8_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__f7c48841_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d32d8eb8_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd32d8eb8, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__adc7f415_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__adc7f415_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xadc7f415, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__5ee87e14_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__5ee87e14_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0x5ee87e14, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__270ef73f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__f7c48841_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__270ef73f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x270ef73f, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__afad3116_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__f7c48841_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afad3116_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xafad3116, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__21e1bb65_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21e1bb65_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x21e1bb65, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__9119fe9a_arg_types_var_4156852289[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9119fe9a_arg_types_var_4156852289, nullptr, 4, 0, nullptr, 28, 0x9119fe9a, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__b4eea441_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b4eea441_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xb4eea441, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__1281d352_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__1281d352_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0x1281d352, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__43ff25b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__f7c48841_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43ff25b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x43ff25b, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__5ddf8014_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__f7c48841_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5ddf8014_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5ddf8014, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__681fd331_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__681fd331_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0x681fd331, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__ba5a2df0_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5a2df0_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xba5a2df0, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__c23281bc_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__f7c48841_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c23281bc_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc23281bc, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__565abdaf_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__f7c48841_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__565abdaf_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x565abdaf, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__d01907f8_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d01907f8_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xd01907f8, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__af8049d5_arg_types_var_4156852289[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__f7c48841_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__af8049d5_arg_types_var_4156852289, nullptr, 5, 0, nullptr, 28, 0xaf8049d5, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__139dd2ff_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__f7c48841_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__139dd2ff_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x139dd2ff, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__1e551916_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__f7c48841_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1e551916_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1e551916, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__39fe8578_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__39fe8578_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x39fe8578, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__466e4cc6_arg_types_var_4156852289[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__f7c48841_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__466e4cc6_arg_types_var_4156852289, nullptr, 3, 0, nullptr, 28, 0x466e4cc6, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__b03dd324_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__f7c48841_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b03dd324_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb03dd324, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__914d2e65_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__f7c48841_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__914d2e65_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x914d2e65, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__93aec5b5_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__f7c48841_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__93aec5b5_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x93aec5b5, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__e8944de_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__f7c48841_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e8944de_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe8944de, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e8792aee_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__f7c48841_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8792aee_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe8792aee, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__33b78b35_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__f7c48841_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__33b78b35_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x33b78b35, "visitExprLabel", 592 };
+TypeInfo * __type_info__3b2e5b3_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__f7c48841_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b2e5b3_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x3b2e5b3, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__f0f23ee_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__f7c48841_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f0f23ee_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf0f23ee, "visitExprGoto", 600 };
+TypeInfo * __type_info__66508312_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__f7c48841_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__66508312_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x66508312, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__fa784e29_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__f7c48841_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fa784e29_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xfa784e29, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__49ff5941_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__f7c48841_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__49ff5941_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x49ff5941, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__a7dab1e2_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__f7c48841_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a7dab1e2_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa7dab1e2, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__3afd413_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__f7c48841_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3afd413_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x3afd413, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__c5b7315a_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__f7c48841_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5b7315a_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc5b7315a, "visitExprAddr", 624 };
+TypeInfo * __type_info__36caa52_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__f7c48841_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__36caa52_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x36caa52, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__32c5dc83_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__f7c48841_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__32c5dc83_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x32c5dc83, "visitExprAssert", 632 };
+TypeInfo * __type_info__703ee92c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__f7c48841_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__703ee92c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x703ee92c, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__1e61ea45_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__f7c48841_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1e61ea45_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1e61ea45, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__9ba617a4_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__f7c48841_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9ba617a4_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x9ba617a4, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__5cb08ff_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__f7c48841_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5cb08ff_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5cb08ff, "visitExprQuote", 648 };
+TypeInfo * __type_info__12ddd6b7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__f7c48841_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12ddd6b7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x12ddd6b7, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__fe79df50_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__f7c48841_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fe79df50_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xfe79df50, "visitExprDebug", 656 };
+TypeInfo * __type_info__f6d12b0_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__f7c48841_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f6d12b0_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf6d12b0, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__ae38f915_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__f7c48841_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae38f915_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xae38f915, "visitExprInvoke", 664 };
+TypeInfo * __type_info__87a35502_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__f7c48841_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__87a35502_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x87a35502, "preVisitExprErase", 668 };
+TypeInfo * __type_info__5fae876d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__f7c48841_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fae876d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5fae876d, "visitExprErase", 672 };
+TypeInfo * __type_info__249de8b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__f7c48841_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__249de8b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x249de8b, "preVisitExprFind", 676 };
+TypeInfo * __type_info__9bfd602_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__f7c48841_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bfd602_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x9bfd602, "visitExprFind", 680 };
+TypeInfo * __type_info__6274536f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__f7c48841_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6274536f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x6274536f, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__eddf0d34_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__f7c48841_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__eddf0d34_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xeddf0d34, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__526a5d2e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__f7c48841_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__526a5d2e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x526a5d2e, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__5876c12f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__f7c48841_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5876c12f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5876c12f, "visitExprAscend", 696 };
+TypeInfo * __type_info__1f25853f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__f7c48841_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1f25853f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1f25853f, "preVisitExprCast", 700 };
+TypeInfo * __type_info__f530eb6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__f7c48841_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f530eb6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf530eb6, "visitExprCast", 704 };
+TypeInfo * __type_info__b6eb0c4b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__f7c48841_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b6eb0c4b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb6eb0c4b, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__7f27ca02_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__f7c48841_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7f27ca02_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7f27ca02, "visitExprDelete", 712 };
+TypeInfo * __type_info__89ced8e1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__f7c48841_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89ced8e1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x89ced8e1, "preVisitExprVar", 716 };
+TypeInfo * __type_info__82cbd0b6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__f7c48841_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__82cbd0b6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x82cbd0b6, "visitExprVar", 720 };
+TypeInfo * __type_info__e4ad6bbc_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__f7c48841_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4ad6bbc_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe4ad6bbc, "preVisitExprField", 724 };
+TypeInfo * __type_info__b74c3b5f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__f7c48841_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b74c3b5f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb74c3b5f, "visitExprField", 728 };
+TypeInfo * __type_info__e0b0280f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__f7c48841_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e0b0280f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe0b0280f, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__acc6c28c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__f7c48841_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__acc6c28c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xacc6c28c, "visitExprSafeField", 736 };
+TypeInfo * __type_info__24dea7de_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__f7c48841_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__24dea7de_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x24dea7de, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__306dbb9_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__f7c48841_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__306dbb9_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x306dbb9, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__2205519_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__f7c48841_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2205519_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x2205519, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__c0dd11fe_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__f7c48841_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c0dd11fe_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc0dd11fe, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__d0aaba21_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__f7c48841_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d0aaba21_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd0aaba21, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__501c6fb6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__f7c48841_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__501c6fb6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x501c6fb6, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__43629ba6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__f7c48841_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43629ba6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x43629ba6, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__fdf2fbb1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__f7c48841_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdf2fbb1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xfdf2fbb1, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__661a1ce2_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__f7c48841_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__661a1ce2_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x661a1ce2, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__a2d03849_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__f7c48841_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a2d03849_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa2d03849, "visitExprOp1", 776 };
+TypeInfo * __type_info__e1325d76_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__f7c48841_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1325d76_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe1325d76, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__259f69d7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__f7c48841_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__259f69d7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x259f69d7, "visitExprReturn", 784 };
+TypeInfo * __type_info__95468c11_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__f7c48841_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95468c11_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x95468c11, "preVisitExprYield", 788 };
+TypeInfo * __type_info__8dd58436_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__f7c48841_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8dd58436_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x8dd58436, "visitExprYield", 792 };
+TypeInfo * __type_info__53ae532f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__f7c48841_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__53ae532f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x53ae532f, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__defbc900_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__f7c48841_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__defbc900_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xdefbc900, "visitExprBreak", 800 };
+TypeInfo * __type_info__289e9e81_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__f7c48841_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__289e9e81_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x289e9e81, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__ce48994c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__f7c48841_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ce48994c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xce48994c, "visitExprContinue", 808 };
+TypeInfo * __type_info__c59e8d7f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__f7c48841_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c59e8d7f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc59e8d7f, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__e746bea8_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__f7c48841_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e746bea8_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe746bea8, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__5fa306c7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__f7c48841_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5fa306c7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5fa306c7, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__e1e0cf54_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__f7c48841_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e1e0cf54_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe1e0cf54, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__5913c5ff_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__f7c48841_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5913c5ff_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5913c5ff, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__77243cb4_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__f7c48841_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__77243cb4_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x77243cb4, "visitExprMemZero", 832 };
+TypeInfo * __type_info__cc7ec7e3_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__f7c48841_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc7ec7e3_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xcc7ec7e3, "preVisitExprConst", 836 };
+TypeInfo * __type_info__ed01610c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__f7c48841_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ed01610c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xed01610c, "visitExprConst", 840 };
+TypeInfo * __type_info__f97b9aaf_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__f7c48841_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f97b9aaf_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xf97b9aaf, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__20a181d6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__f7c48841_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__20a181d6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x20a181d6, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__c5282f96_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__f7c48841_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c5282f96_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc5282f96, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__a9e49593_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__f7c48841_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a9e49593_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa9e49593, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__15a70afa_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__f7c48841_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__15a70afa_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x15a70afa, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__136984c9_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__f7c48841_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__136984c9_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x136984c9, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__be3e567c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__f7c48841_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__be3e567c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xbe3e567c, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__110c4877_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__f7c48841_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__110c4877_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x110c4877, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__38385043_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__f7c48841_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38385043_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x38385043, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__25400e0e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__f7c48841_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__25400e0e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x25400e0e, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__c830e42e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__f7c48841_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c830e42e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc830e42e, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__a53d05f7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__f7c48841_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a53d05f7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa53d05f7, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__1e474d2c_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__f7c48841_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1e474d2c_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1e474d2c, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__61337c35_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__f7c48841_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__61337c35_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x61337c35, "visitExprConstInt", 896 };
+TypeInfo * __type_info__c83e663a_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__f7c48841_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c83e663a_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc83e663a, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__b0c3f05_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__f7c48841_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b0c3f05_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xb0c3f05, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__c93e67cd_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__f7c48841_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93e67cd_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc93e67cd, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__a0c3d72_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__f7c48841_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a0c3d72_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa0c3d72, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__c23e5cc8_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__f7c48841_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c23e5cc8_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc23e5cc8, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__50c3593_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__f7c48841_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__50c3593_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x50c3593, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__6c9e81d9_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__f7c48841_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c9e81d9_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x6c9e81d9, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__de31d3c4_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__f7c48841_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__de31d3c4_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xde31d3c4, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__ea97d138_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__f7c48841_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea97d138_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xea97d138, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__4c5eafab_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__f7c48841_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4c5eafab_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x4c5eafab, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__5e9f4399_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__f7c48841_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e9f4399_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5e9f4399, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__3c57dab6_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__f7c48841_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3c57dab6_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x3c57dab6, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__ebb2425b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__f7c48841_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebb2425b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xebb2425b, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__63db4794_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__f7c48841_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__63db4794_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x63db4794, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__729e8b4b_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__f7c48841_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__729e8b4b_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x729e8b4b, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__d831ca52_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__f7c48841_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d831ca52_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd831ca52, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__719e89b8_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__f7c48841_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__719e89b8_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x719e89b8, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__d931cbe5_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__f7c48841_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d931cbe5_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd931cbe5, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__789e94bd_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__f7c48841_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__789e94bd_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x789e94bd, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__d231c0e0_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__f7c48841_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d231c0e0_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd231c0e0, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__1b0fa198_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__f7c48841_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1b0fa198_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x1b0fa198, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__d45deb11_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__f7c48841_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d45deb11_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xd45deb11, "visitExprConstRange", 984 };
+TypeInfo * __type_info__aac7e0af_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__f7c48841_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aac7e0af_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xaac7e0af, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__6b78c570_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__f7c48841_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6b78c570_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x6b78c570, "visitExprConstURange", 992 };
+TypeInfo * __type_info__7dd077b7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__f7c48841_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7dd077b7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7dd077b7, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__48435b14_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__f7c48841_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__48435b14_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x48435b14, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__c67d2be7_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__f7c48841_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c67d2be7_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc67d2be7, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__70ceceae_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__f7c48841_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__70ceceae_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x70ceceae, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__4c0c004f_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__f7c48841_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c0c004f_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x4c0c004f, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__318f3f94_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__f7c48841_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__318f3f94_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x318f3f94, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__4b0bfebc_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__f7c48841_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b0bfebc_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x4b0bfebc, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__328f4127_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__f7c48841_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__328f4127_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x328f4127, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__4a0bfd29_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__f7c48841_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4a0bfd29_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x4a0bfd29, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__2f8f3c6e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__f7c48841_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2f8f3c6e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x2f8f3c6e, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__fea50286_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__f7c48841_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fea50286_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xfea50286, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__e7855a6d_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__f7c48841_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e7855a6d_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xe7855a6d, "visitExprConstString", 1040 };
+TypeInfo * __type_info__3562056e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__f7c48841_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3562056e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x3562056e, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__384250c1_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__f7c48841_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__384250c1_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x384250c1, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__5e621dd0_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__f7c48841_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5e621dd0_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x5e621dd0, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__195519af_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__f7c48841_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__195519af_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x195519af, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__25640847_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__f7c48841_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25640847_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x25640847, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__c1b7832e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__f7c48841_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c1b7832e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xc1b7832e, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__a283d6f3_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__f7c48841_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a283d6f3_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0xa283d6f3, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__2b2ad1be_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__f7c48841_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2b2ad1be_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x2b2ad1be, "visitExprReader", 1072 };
+TypeInfo * __type_info__31bb098e_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__f7c48841_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31bb098e_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x31bb098e, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__335fefcf_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__f7c48841_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__335fefcf_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x335fefcf, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__15763a84_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__f7c48841_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__15763a84_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x15763a84, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__7a6d5817_arg_types_var_4156852289[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__f7c48841_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a6d5817_arg_types_var_4156852289, nullptr, 2, 0, nullptr, 28, 0x7a6d5817, "visitExprCallMacro", 1088 };
+VarInfo __struct_info__f7c48841_field_272 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__65966b2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2631ba0e, "rules", 1096 };
+VarInfo * __struct_info__f7c48841_fields[273] =  { &__struct_info__f7c48841_field_0, &__struct_info__f7c48841_field_1, &__struct_info__f7c48841_field_2, &__struct_info__f7c48841_field_3, &__struct_info__f7c48841_field_4, &__struct_info__f7c48841_field_5, &__struct_info__f7c48841_field_6, &__struct_info__f7c48841_field_7, &__struct_info__f7c48841_field_8, &__struct_info__f7c48841_field_9, &__struct_info__f7c48841_field_10, &__struct_info__f7c48841_field_11, &__struct_info__f7c48841_field_12, &__struct_info__f7c48841_field_13, &__struct_info__f7c48841_field_14, &__struct_info__f7c48841_field_15, &__struct_info__f7c48841_field_16, &__struct_info__f7c48841_field_17, &__struct_info__f7c48841_field_18, &__struct_info__f7c48841_field_19, &__struct_info__f7c48841_field_20, &__struct_info__f7c48841_field_21, &__struct_info__f7c48841_field_22, &__struct_info__f7c48841_field_23, &__struct_info__f7c48841_field_24, &__struct_info__f7c48841_field_25, &__struct_info__f7c48841_field_26, &__struct_info__f7c48841_field_27, &__struct_info__f7c48841_field_28, &__struct_info__f7c48841_field_29, &__struct_info__f7c48841_field_30, &__struct_info__f7c48841_field_31, &__struct_info__f7c48841_field_32, &__struct_info__f7c48841_field_33, &__struct_info__f7c48841_field_34, &__struct_info__f7c48841_field_35, &__struct_info__f7c48841_field_36, &__struct_info__f7c48841_field_37, &__struct_info__f7c48841_field_38, &__struct_info__f7c48841_field_39, &__struct_info__f7c48841_field_40, &__struct_info__f7c48841_field_41, &__struct_info__f7c48841_field_42, &__struct_info__f7c48841_field_43, &__struct_info__f7c48841_field_44, &__struct_info__f7c48841_field_45, &__struct_info__f7c48841_field_46, &__struct_info__f7c48841_field_47, &__struct_info__f7c48841_field_48, &__struct_info__f7c48841_field_49, &__struct_info__f7c48841_field_50, &__struct_info__f7c48841_field_51, &__struct_info__f7c48841_field_52, &__struct_info__f7c48841_field_53, &__struct_info__f7c48841_field_54, &__struct_info__f7c48841_field_55, &__struct_info__f7c48841_field_56, &__struct_info__f7c48841_field_57, &__struct_info__f7c48841_field_58, &__struct_info__f7c48841_field_59, &__struct_info__f7c48841_field_60, &__struct_info__f7c48841_field_61, &__struct_info__f7c48841_field_62, &__struct_info__f7c48841_field_63, &__struct_info__f7c48841_field_64, &__struct_info__f7c48841_field_65, &__struct_info__f7c48841_field_66, &__struct_info__f7c48841_field_67, &__struct_info__f7c48841_field_68, &__struct_info__f7c48841_field_69, &__struct_info__f7c48841_field_70, &__struct_info__f7c48841_field_71, &__struct_info__f7c48841_field_72, &__struct_info__f7c48841_field_73, &__struct_info__f7c48841_field_74, &__struct_info__f7c48841_field_75, &__struct_info__f7c48841_field_76, &__struct_info__f7c48841_field_77, &__struct_info__f7c48841_field_78, &__struct_info__f7c48841_field_79, &__struct_info__f7c48841_field_80, &__struct_info__f7c48841_field_81, &__struct_info__f7c48841_field_82, &__struct_info__f7c48841_field_83, &__struct_info__f7c48841_field_84, &__struct_info__f7c48841_field_85, &__struct_info__f7c48841_field_86, &__struct_info__f7c48841_field_87, &__struct_info__f7c48841_field_88, &__struct_info__f7c48841_field_89, &__struct_info__f7c48841_field_90, &__struct_info__f7c48841_field_91, &__struct_info__f7c48841_field_92, &__struct_info__f7c48841_field_93, &__struct_info__f7c48841_field_94, &__struct_info__f7c48841_field_95, &__struct_info__f7c48841_field_96, &__struct_info__f7c48841_field_97, &__struct_info__f7c48841_field_98, &__struct_info__f7c48841_field_99, &__struct_info__f7c48841_field_100, &__struct_info__f7c48841_field_101, &__struct_info__f7c48841_field_102, &__struct_info__f7c48841_field_103, &__struct_info__f7c48841_field_104, &__struct_info__f7c48841_field_105, &__struct_info__f7c48841_field_106, &__struct_info__f7c48841_field_107, &__struct_info__f7c48841_field_108, &__struct_info__f7c48841_field_109, &__struct_info__f7c48841_field_110, &__struct_info__f7c48841_field_111, &__struct_info__f7c48841_field_112, &__struct_info__f7c48841_field_113, &__struct_info__f7c48841_field_114, &__struct_info__f7c48841_field_115, &__struct_info__f7c48841_field_116, &__struct_info__f7c48841_field_117, &__struct_info__f7c48841_field_118, &__struct_info__f7c48841_field_119, &__struct_info__f7c48841_field_120, &__struct_info__f7c48841_field_121, &__struct_info__f7c48841_field_122, &__struct_info__f7c48841_field_123, &__struct_info__f7c48841_field_124, &__struct_info__f7c48841_field_125, &__struct_info__f7c48841_field_126, &__struct_info__f7c48841_field_127, &__struct_info__f7c48841_field_128, &__struct_info__f7c48841_field_129, &__struct_info__f7c48841_field_130, &__struct_info__f7c48841_field_131, &__struct_info__f7c48841_field_132, &__struct_info__f7c48841_field_133, &__struct_info__f7c48841_field_134, &__struct_info__f7c48841_field_135, &__struct_info__f7c48841_field_136, &__struct_info__f7c48841_field_137, &__struct_info__f7c48841_field_138, &__struct_info__f7c48841_field_139, &__struct_info__f7c48841_field_140, &__struct_info__f7c48841_field_141, &__struct_info__f7c48841_field_142, &__struct_info__f7c48841_field_143, &__struct_info__f7c48841_field_144, &__struct_info__f7c48841_field_145, &__struct_info__f7c48841_field_146, &__struct_info__f7c48841_field_147, &__struct_info__f7c48841_field_148, &__struct_info__f7c48841_field_149, &__struct_info__f7c48841_field_150, &__struct_info__f7c48841_field_151, &__struct_info__f7c48841_field_152, &__struct_info__f7c48841_field_153, &__struct_info__f7c48841_field_154, &__struct_info__f7c48841_field_155, &__struct_info__f7c48841_field_156, &__struct_info__f7c48841_field_157, &__struct_info__f7c48841_field_158, &__struct_info__f7c48841_field_159, &__struct_info__f7c48841_field_160, &__struct_info__f7c48841_field_161, &__struct_info__f7c48841_field_162, &__struct_info__f7c48841_field_163, &__struct_info__f7c48841_field_164, &__struct_info__f7c48841_field_165, &__struct_info__f7c48841_field_166, &__struct_info__f7c48841_field_167, &__struct_info__f7c48841_field_168, &__struct_info__f7c48841_field_169, &__struct_info__f7c48841_field_170, &__struct_info__f7c48841_field_171, &__struct_info__f7c48841_field_172, &__struct_info__f7c48841_field_173, &__struct_info__f7c48841_field_174, &__struct_info__f7c48841_field_175, &__struct_info__f7c48841_field_176, &__struct_info__f7c48841_field_177, &__struct_info__f7c48841_field_178, &__struct_info__f7c48841_field_179, &__struct_info__f7c48841_field_180, &__struct_info__f7c48841_field_181, &__struct_info__f7c48841_field_182, &__struct_info__f7c48841_field_183, &__struct_info__f7c48841_field_184, &__struct_info__f7c48841_field_185, &__struct_info__f7c48841_field_186, &__struct_info__f7c48841_field_187, &__struct_info__f7c48841_field_188, &__struct_info__f7c48841_field_189, &__struct_info__f7c48841_field_190, &__struct_info__f7c48841_field_191, &__struct_info__f7c48841_field_192, &__struct_info__f7c48841_field_193, &__struct_info__f7c48841_field_194, &__struct_info__f7c48841_field_195, &__struct_info__f7c48841_field_196, &__struct_info__f7c48841_field_197, &__struct_info__f7c48841_field_198, &__struct_info__f7c48841_field_199, &__struct_info__f7c48841_field_200, &__struct_info__f7c48841_field_201, &__struct_info__f7c48841_field_202, &__struct_info__f7c48841_field_203, &__struct_info__f7c48841_field_204, &__struct_info__f7c48841_field_205, &__struct_info__f7c48841_field_206, &__struct_info__f7c48841_field_207, &__struct_info__f7c48841_field_208, &__struct_info__f7c48841_field_209, &__struct_info__f7c48841_field_210, &__struct_info__f7c48841_field_211, &__struct_info__f7c48841_field_212, &__struct_info__f7c48841_field_213, &__struct_info__f7c48841_field_214, &__struct_info__f7c48841_field_215, &__struct_info__f7c48841_field_216, &__struct_info__f7c48841_field_217, &__struct_info__f7c48841_field_218, &__struct_info__f7c48841_field_219, &__struct_info__f7c48841_field_220, &__struct_info__f7c48841_field_221, &__struct_info__f7c48841_field_222, &__struct_info__f7c48841_field_223, &__struct_info__f7c48841_field_224, &__struct_info__f7c48841_field_225, &__struct_info__f7c48841_field_226, &__struct_info__f7c48841_field_227, &__struct_info__f7c48841_field_228, &__struct_info__f7c48841_field_229, &__struct_info__f7c48841_field_230, &__struct_info__f7c48841_field_231, &__struct_info__f7c48841_field_232, &__struct_info__f7c48841_field_233, &__struct_info__f7c48841_field_234, &__struct_info__f7c48841_field_235, &__struct_info__f7c48841_field_236, &__struct_info__f7c48841_field_237, &__struct_info__f7c48841_field_238, &__struct_info__f7c48841_field_239, &__struct_info__f7c48841_field_240, &__struct_info__f7c48841_field_241, &__struct_info__f7c48841_field_242, &__struct_info__f7c48841_field_243, &__struct_info__f7c48841_field_244, &__struct_info__f7c48841_field_245, &__struct_info__f7c48841_field_246, &__struct_info__f7c48841_field_247, &__struct_info__f7c48841_field_248, &__struct_info__f7c48841_field_249, &__struct_info__f7c48841_field_250, &__struct_info__f7c48841_field_251, &__struct_info__f7c48841_field_252, &__struct_info__f7c48841_field_253, &__struct_info__f7c48841_field_254, &__struct_info__f7c48841_field_255, &__struct_info__f7c48841_field_256, &__struct_info__f7c48841_field_257, &__struct_info__f7c48841_field_258, &__struct_info__f7c48841_field_259, &__struct_info__f7c48841_field_260, &__struct_info__f7c48841_field_261, &__struct_info__f7c48841_field_262, &__struct_info__f7c48841_field_263, &__struct_info__f7c48841_field_264, &__struct_info__f7c48841_field_265, &__struct_info__f7c48841_field_266, &__struct_info__f7c48841_field_267, &__struct_info__f7c48841_field_268, &__struct_info__f7c48841_field_269, &__struct_info__f7c48841_field_270, &__struct_info__f7c48841_field_271, &__struct_info__f7c48841_field_272 };
+StructInfo __struct_info__f7c48841 = {"TemplateVisitor", __struct_info__f7c48841_fields, 273, 1104, -1, nullptr, 0xf7c48841 };
+VarInfo __struct_info__d8299e85_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0d240, "__rtti", 0 };
+TypeInfo * __type_info__1c9914bb_arg_types_var_3626606213[1] = { &__type_info__ebcc21eb };
+VarInfo __struct_info__d8299e85_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c9914bb_arg_types_var_3626606213, nullptr, 1, 0, nullptr, 28, 0x1c9914bb, "__finalize", 8 };
+TypeInfo * __type_info__e1345261_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1345261_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe1345261, "preVisitProgram", 12 };
+TypeInfo * __type_info__f902c2de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f902c2de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf902c2de, "visitProgram", 16 };
+TypeInfo * __type_info__6d3d92b1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d3d92b1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d3d92b1, "preVisitProgramBody", 20 };
+TypeInfo * __type_info__7acd6d0b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7acd6d0b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7acd6d0b, "preVisitTypeDecl", 24 };
+TypeInfo * __type_info__9edcbce_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_6 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__9edcbce_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9edcbce, "visitTypeDecl", 28 };
+TypeInfo * __type_info__4c957b89_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_7 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c957b89_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x4c957b89, "preVisitAlias", 32 };
+TypeInfo * __type_info__2cbdc12a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a960d6ab, &__type_info__7ec7955d };
+VarInfo __struct_info__d8299e85_field_8 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__cd849a9b, nullptr, (TypeInfo **)__type_info__2cbdc12a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x2cbdc12a, "visitAlias", 36 };
+TypeInfo * __type_info__7ea03b0a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_9 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ea03b0a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7ea03b0a, "preVisitEnumeration", 40 };
+TypeInfo * __type_info__7607b7d3_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_10 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7607b7d3_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x7607b7d3, "preVisitEnumerationValue", 44 };
+TypeInfo * __type_info__a92f607e_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__a8981616, &__type_info__7ec7955d, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_11 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a92f607e_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa92f607e, "visitEnumerationValue", 48 };
+TypeInfo * __type_info__134ae51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a8981616 };
+VarInfo __struct_info__d8299e85_field_12 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__6dd946fa, nullptr, (TypeInfo **)__type_info__134ae51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x134ae51, "visitEnumeration", 52 };
+TypeInfo * __type_info__327e2124_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_13 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__327e2124_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x327e2124, "preVisitStructure", 56 };
+TypeInfo * __type_info__c2ec29d8_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_14 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c2ec29d8_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc2ec29d8, "preVisitStructureField", 60 };
+TypeInfo * __type_info__e4eb34d9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__32b24044, &__type_info__317f8d25, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_15 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4eb34d9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xe4eb34d9, "visitStructureField", 64 };
+TypeInfo * __type_info__6c97d67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32b24044 };
+VarInfo __struct_info__d8299e85_field_16 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__2d8fb614, nullptr, (TypeInfo **)__type_info__6c97d67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c97d67, "visitStructure", 68 };
+TypeInfo * __type_info__7447bb4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_17 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7447bb4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7447bb4f, "preVisitFunction", 72 };
+TypeInfo * __type_info__c6bf2bd2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_18 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dcfff1ff, nullptr, (TypeInfo **)__type_info__c6bf2bd2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc6bf2bd2, "visitFunction", 76 };
+TypeInfo * __type_info__63a3eac_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_19 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__63a3eac_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x63a3eac, "preVisitFunctionArgument", 80 };
+TypeInfo * __type_info__5fa0ff2d_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_20 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__5fa0ff2d_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5fa0ff2d, "visitFunctionArgument", 84 };
+TypeInfo * __type_info__ad56015e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_21 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad56015e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad56015e, "preVisitFunctionArgumentInit", 88 };
+TypeInfo * __type_info__f4999d8b_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__523f6667, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_22 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f4999d8b_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf4999d8b, "visitFunctionArgumentInit", 92 };
+TypeInfo * __type_info__f25a787_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_23 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25a787_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25a787, "preVisitFunctionBody", 96 };
+TypeInfo * __type_info__d76915b6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__523f6667 };
+VarInfo __struct_info__d8299e85_field_24 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d76915b6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd76915b6, "visitFunctionBody", 100 };
+TypeInfo * __type_info__af00471_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_25 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__af00471_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaf00471, "preVisitExpression", 104 };
+TypeInfo * __type_info__a246be3c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_26 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a246be3c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa246be3c, "visitExpression", 108 };
+TypeInfo * __type_info__2c383e55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_27 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2c383e55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2c383e55, "preVisitExprBlock", 112 };
+TypeInfo * __type_info__7a87bd0e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_28 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7a87bd0e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7a87bd0e, "visitExprBlock", 116 };
+TypeInfo * __type_info__dc873d46_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_29 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc873d46_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdc873d46, "preVisitExprBlockArgument", 120 };
+TypeInfo * __type_info__f891e8e9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_30 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__f891e8e9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xf891e8e9, "visitExprBlockArgument", 124 };
+TypeInfo * __type_info__5bede5bc_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_31 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5bede5bc_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5bede5bc, "preVisitExprBlockArgumentInit", 128 };
+TypeInfo * __type_info__4a66add7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_32 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4a66add7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4a66add7, "visitExprBlockArgumentInit", 132 };
+TypeInfo * __type_info__b35acbb_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_33 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b35acbb_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb35acbb, "preVisitExprBlockExpression", 136 };
+TypeInfo * __type_info__d6c089cc_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_34 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6c089cc_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xd6c089cc, "visitExprBlockExpression", 140 };
+TypeInfo * __type_info__6fc12b47_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_35 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6fc12b47_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6fc12b47, "preVisitExprBlockFinal", 144 };
+TypeInfo * __type_info__8644430a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9 };
+VarInfo __struct_info__d8299e85_field_36 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8644430a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8644430a, "visitExprBlockFinal", 148 };
+TypeInfo * __type_info__fde3ac29_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_37 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fde3ac29_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xfde3ac29, "preVisitExprBlockFinalExpression", 152 };
+TypeInfo * __type_info__89631998_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6c2a86f9, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_38 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__89631998_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x89631998, "visitExprBlockFinalExpression", 156 };
+TypeInfo * __type_info__bd3bde81_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_39 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bd3bde81_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbd3bde81, "preVisitExprLet", 160 };
+TypeInfo * __type_info__1c56de_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d };
+VarInfo __struct_info__d8299e85_field_40 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c56de_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c56de, "visitExprLet", 164 };
+TypeInfo * __type_info__4ea380c9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_41 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4ea380c9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x4ea380c9, "preVisitExprLetVariable", 168 };
+TypeInfo * __type_info__d7a0c00a_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_42 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__d7a0c00a_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xd7a0c00a, "visitExprLetVariable", 172 };
+TypeInfo * __type_info__dcd95cf7_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_43 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dcd95cf7_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xdcd95cf7, "preVisitExprLetVariableInit", 176 };
+TypeInfo * __type_info__5e90f2e0_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b5d7ce5d, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_44 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5e90f2e0_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x5e90f2e0, "visitExprLetVariableInit", 180 };
+TypeInfo * __type_info__284e759_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_45 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__284e759_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x284e759, "preVisitGlobalLet", 184 };
+TypeInfo * __type_info__554a21ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f3455dd };
+VarInfo __struct_info__d8299e85_field_46 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__554a21ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x554a21ae, "visitGlobalLet", 188 };
+TypeInfo * __type_info__a6016d01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_47 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a6016d01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa6016d01, "preVisitGlobalLetVariable", 192 };
+TypeInfo * __type_info__3b14171a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_48 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__3b14171a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3b14171a, "visitGlobalLetVariable", 196 };
+TypeInfo * __type_info__78bcb4df_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_49 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bcb4df_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x78bcb4df, "preVisitGlobalLetVariableInit", 200 };
+TypeInfo * __type_info__6521e890_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b108e3, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_50 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6521e890_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x6521e890, "visitGlobalLetVariableInit", 204 };
+TypeInfo * __type_info__aefafc88_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_51 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aefafc88_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaefafc88, "preVisitExprStringBuilder", 208 };
+TypeInfo * __type_info__75c92fd3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f1eeff10 };
+VarInfo __struct_info__d8299e85_field_52 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__75c92fd3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x75c92fd3, "visitExprStringBuilder", 212 };
+TypeInfo * __type_info__6eaa7d50_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_53 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6eaa7d50_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6eaa7d50, "preVisitExprStringBuilderElement", 216 };
+TypeInfo * __type_info__ad5a0405_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__f1eeff10, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_54 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ad5a0405_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xad5a0405, "visitExprStringBuilderElement", 220 };
+TypeInfo * __type_info__9356e5ba_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_55 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9356e5ba_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9356e5ba, "preVisitExprNew", 224 };
+TypeInfo * __type_info__c84acfc5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6 };
+VarInfo __struct_info__d8299e85_field_56 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c84acfc5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc84acfc5, "visitExprNew", 228 };
+TypeInfo * __type_info__a9b0cc55_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_57 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a9b0cc55_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa9b0cc55, "preVisitExprNewArgument", 232 };
+TypeInfo * __type_info__7cfe7756_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b58fe8a6, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_58 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7cfe7756_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x7cfe7756, "visitExprNewArgument", 236 };
+TypeInfo * __type_info__915be3cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_59 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__915be3cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x915be3cd, "preVisitExprNamedCall", 240 };
+TypeInfo * __type_info__85473ce6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1 };
+VarInfo __struct_info__d8299e85_field_60 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__85473ce6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x85473ce6, "visitExprNamedCall", 244 };
+TypeInfo * __type_info__345035e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_61 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__345035e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x345035e, "preVisitExprNamedCallArgument", 248 };
+TypeInfo * __type_info__c053d161_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__b66d9ef1, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_62 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__c053d161_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xc053d161, "visitExprNamedCallArgument", 252 };
+TypeInfo * __type_info__359e840f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_63 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__359e840f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x359e840f, "preVisitExprLooksLikeCall", 256 };
+TypeInfo * __type_info__c32d1370_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fba33907 };
+VarInfo __struct_info__d8299e85_field_64 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c32d1370_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc32d1370, "visitExprLooksLikeCall", 260 };
+TypeInfo * __type_info__31003f6c_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_65 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31003f6c_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x31003f6c, "preVisitExprLooksLikeCallArgument", 264 };
+TypeInfo * __type_info__442b5d7f_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__fba33907, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_66 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__442b5d7f_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x442b5d7f, "visitExprLooksLikeCallArgument", 268 };
+TypeInfo * __type_info__11aeae1c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_67 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__11aeae1c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x11aeae1c, "preVisitExprCall", 272 };
+TypeInfo * __type_info__2965e55d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__81be117c };
+VarInfo __struct_info__d8299e85_field_68 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2965e55d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2965e55d, "visitExprCall", 276 };
+TypeInfo * __type_info__cdf950db_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_69 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cdf950db_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xcdf950db, "preVisitExprCallArgument", 280 };
+TypeInfo * __type_info__a343220e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__81be117c, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_70 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a343220e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa343220e, "visitExprCallArgument", 284 };
+TypeInfo * __type_info__ac29e6b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_71 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac29e6b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac29e6b9, "preVisitExprNullCoalescing", 288 };
+TypeInfo * __type_info__2663c954_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5 };
+VarInfo __struct_info__d8299e85_field_72 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__2663c954_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2663c954, "visitExprNullCoalescing", 292 };
+TypeInfo * __type_info__f3715aaa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__dc52e0d5, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_73 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f3715aaa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf3715aaa, "preVisitExprNullCoalescingDefault", 296 };
+TypeInfo * __type_info__bb163ec9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_74 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bb163ec9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbb163ec9, "preVisitExprAt", 300 };
+TypeInfo * __type_info__888bf034_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a01f8605 };
+VarInfo __struct_info__d8299e85_field_75 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__888bf034_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x888bf034, "visitExprAt", 304 };
+TypeInfo * __type_info__43f7c55f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_76 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f7c55f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x43f7c55f, "preVisitExprAtIndex", 308 };
+TypeInfo * __type_info__aff78d24_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_77 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aff78d24_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xaff78d24, "preVisitExprSafeAt", 312 };
+TypeInfo * __type_info__880f2249_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__655bd8a4 };
+VarInfo __struct_info__d8299e85_field_78 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__880f2249_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x880f2249, "visitExprSafeAt", 316 };
+TypeInfo * __type_info__e1903c80_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_79 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1903c80_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xe1903c80, "preVisitExprSafeAtIndex", 320 };
+TypeInfo * __type_info__cc02d1d4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_80 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc02d1d4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcc02d1d4, "preVisitExprIs", 324 };
+TypeInfo * __type_info__7776bab9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c8fd4b4 };
+VarInfo __struct_info__d8299e85_field_81 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__7776bab9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7776bab9, "visitExprIs", 328 };
+TypeInfo * __type_info__3cb36c5c_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__a01f8605, &__type_info__a960d6ab };
+VarInfo __struct_info__d8299e85_field_82 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3cb36c5c_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x3cb36c5c, "preVisitExprIsType", 332 };
+TypeInfo * __type_info__3f48a4eb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_83 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3f48a4eb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f48a4eb, "preVisitExprOp2", 336 };
+TypeInfo * __type_info__9e9818ec_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ed20bab };
+VarInfo __struct_info__d8299e85_field_84 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9e9818ec_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9e9818ec, "visitExprOp2", 340 };
+TypeInfo * __type_info__b7d4d4bf_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__ed20bab, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_85 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b7d4d4bf_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb7d4d4bf, "preVisitExprOp2Right", 344 };
+TypeInfo * __type_info__3e48a358_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_86 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3e48a358_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3e48a358, "preVisitExprOp3", 348 };
+TypeInfo * __type_info__9f981a7f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9491240 };
+VarInfo __struct_info__d8299e85_field_87 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9f981a7f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9f981a7f, "visitExprOp3", 352 };
+TypeInfo * __type_info__eee3bc09_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_88 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__eee3bc09_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xeee3bc09, "preVisitExprOp3Left", 356 };
+TypeInfo * __type_info__f2f1d3aa_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__b9491240, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_89 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2f1d3aa_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf2f1d3aa, "preVisitExprOp3Right", 360 };
+TypeInfo * __type_info__c3059e01_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_90 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c3059e01_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc3059e01, "preVisitExprCopy", 364 };
+TypeInfo * __type_info__3bbe5820_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6d1d425d };
+VarInfo __struct_info__d8299e85_field_91 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3bbe5820_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3bbe5820, "visitExprCopy", 368 };
+TypeInfo * __type_info__a0ecfbb9_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__6d1d425d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_92 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a0ecfbb9_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xa0ecfbb9, "preVisitExprCopyRight", 372 };
+TypeInfo * __type_info__215e3c49_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_93 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__215e3c49_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x215e3c49, "preVisitExprMove", 376 };
+TypeInfo * __type_info__8f4c9038_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__da50b805 };
+VarInfo __struct_info__d8299e85_field_94 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f4c9038_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f4c9038, "visitExprMove", 380 };
+TypeInfo * __type_info__98dc5351_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__da50b805, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_95 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__98dc5351_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x98dc5351, "preVisitExprMoveRight", 384 };
+TypeInfo * __type_info__17b491_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_96 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__17b491_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x17b491, "preVisitExprClone", 388 };
+TypeInfo * __type_info__1ad4800e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8bc5634d };
+VarInfo __struct_info__d8299e85_field_97 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1ad4800e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1ad4800e, "visitExprClone", 392 };
+TypeInfo * __type_info__b08b6929_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__8bc5634d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_98 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b08b6929_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb08b6929, "preVisitExprCloneRight", 396 };
+TypeInfo * __type_info__f2348094_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_99 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f2348094_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf2348094, "preVisitExprWith", 400 };
+TypeInfo * __type_info__f3ae166d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87a6e894 };
+VarInfo __struct_info__d8299e85_field_100 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f3ae166d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf3ae166d, "visitExprWith", 404 };
+TypeInfo * __type_info__f1675330_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__87a6e894, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_101 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1675330_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xf1675330, "preVisitExprWithBody", 408 };
+TypeInfo * __type_info__92e3d111_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_102 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__92e3d111_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x92e3d111, "preVisitExprWhile", 412 };
+TypeInfo * __type_info__cafe3512_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d };
+VarInfo __struct_info__d8299e85_field_103 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cafe3512_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcafe3512, "visitExprWhile", 416 };
+TypeInfo * __type_info__ed636a01_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__1cb4fa6d, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_104 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ed636a01_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xed636a01, "preVisitExprWhileBody", 420 };
+TypeInfo * __type_info__25c0eaac_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_105 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__25c0eaac_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x25c0eaac, "preVisitExprTryCatch", 424 };
+TypeInfo * __type_info__90a51465_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10b7decc };
+VarInfo __struct_info__d8299e85_field_106 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__90a51465_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x90a51465, "visitExprTryCatch", 428 };
+TypeInfo * __type_info__169d2283_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__10b7decc, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_107 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__169d2283_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x169d2283, "preVisitExprTryCatchCatch", 432 };
+TypeInfo * __type_info__8965dfd1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_108 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8965dfd1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8965dfd1, "preVisitExprIfThenElse", 436 };
+TypeInfo * __type_info__757540b8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__5ca338ad };
+VarInfo __struct_info__d8299e85_field_109 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__757540b8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x757540b8, "visitExprIfThenElse", 440 };
+TypeInfo * __type_info__7705b54f_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_110 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7705b54f_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x7705b54f, "preVisitExprIfThenElseIfBlock", 444 };
+TypeInfo * __type_info__97b1c4ed_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__5ca338ad, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_111 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__97b1c4ed_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x97b1c4ed, "preVisitExprIfThenElseElseBlock", 448 };
+TypeInfo * __type_info__e95012d3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_112 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e95012d3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe95012d3, "preVisitExprFor", 452 };
+TypeInfo * __type_info__344d19dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_113 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__344d19dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x344d19dc, "visitExprFor", 456 };
+TypeInfo * __type_info__6c164ebf_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_114 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c164ebf_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x6c164ebf, "preVisitExprForVariable", 460 };
+TypeInfo * __type_info__56569ad4_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__b108e3, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_115 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ff9fd5d3, nullptr, (TypeInfo **)__type_info__56569ad4_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x56569ad4, "visitExprForVariable", 464 };
+TypeInfo * __type_info__12214d06_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_116 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__12214d06_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x12214d06, "preVisitExprForSource", 468 };
+TypeInfo * __type_info__64f4b569_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__e749bd33, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_117 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64f4b569_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x64f4b569, "visitExprForSource", 472 };
+TypeInfo * __type_info__10bf88c5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_118 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10bf88c5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x10bf88c5, "preVisitExprForStack", 476 };
+TypeInfo * __type_info__6dbb285b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e749bd33 };
+VarInfo __struct_info__d8299e85_field_119 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6dbb285b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6dbb285b, "preVisitExprForBody", 480 };
+TypeInfo * __type_info__717f8e67_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_120 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__717f8e67_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x717f8e67, "preVisitExprMakeVariant", 484 };
+TypeInfo * __type_info__e6a0bda4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e7b89eff };
+VarInfo __struct_info__d8299e85_field_121 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e6a0bda4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe6a0bda4, "visitExprMakeVariant", 488 };
+TypeInfo * __type_info__c35127d9_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_122 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c35127d9_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc35127d9, "preVisitExprMakeVariantField", 492 };
+TypeInfo * __type_info__aa30df58_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__e7b89eff, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_123 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__aa30df58_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xaa30df58, "visitExprMakeVariantField", 496 };
+TypeInfo * __type_info__67cfaaa3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_124 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__67cfaaa3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x67cfaaa3, "preVisitExprMakeStruct", 500 };
+TypeInfo * __type_info__23fa073a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__34157e23 };
+VarInfo __struct_info__d8299e85_field_125 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__23fa073a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x23fa073a, "visitExprMakeStruct", 504 };
+TypeInfo * __type_info__a74c85b9_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_126 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a74c85b9_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0xa74c85b9, "preVisitExprMakeStructIndex", 508 };
+TypeInfo * __type_info__88bd350e_arg_types_var_3626606213[4] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_127 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88bd350e_arg_types_var_3626606213, nullptr, 4, 0, nullptr, 28, 0x88bd350e, "visitExprMakeStructIndex", 512 };
+TypeInfo * __type_info__35e4f53d_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_128 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35e4f53d_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x35e4f53d, "preVisitExprMakeStructField", 516 };
+TypeInfo * __type_info__83d50dee_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__34157e23, &__type_info__359c1b32, &__type_info__1683ec13, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_129 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__d3ebcc43, nullptr, (TypeInfo **)__type_info__83d50dee_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0x83d50dee, "visitExprMakeStructField", 520 };
+TypeInfo * __type_info__6d5c4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_130 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6d5c4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6d5c4cbf, "preVisitExprMakeArray", 524 };
+TypeInfo * __type_info__52c5da8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7 };
+VarInfo __struct_info__d8299e85_field_131 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52c5da8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52c5da8, "visitExprMakeArray", 528 };
+TypeInfo * __type_info__e8005be5_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_132 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8005be5_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xe8005be5, "preVisitExprMakeArrayIndex", 532 };
+TypeInfo * __type_info__a216b644_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1bb5fdf7, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_133 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a216b644_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xa216b644, "visitExprMakeArrayIndex", 536 };
+TypeInfo * __type_info__8b73a850_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_134 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8b73a850_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8b73a850, "preVisitExprMakeTuple", 540 };
+TypeInfo * __type_info__955e0b53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8 };
+VarInfo __struct_info__d8299e85_field_135 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__955e0b53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x955e0b53, "visitExprMakeTuple", 544 };
+TypeInfo * __type_info__cc0f5e2c_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_136 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc0f5e2c_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xcc0f5e2c, "preVisitExprMakeTupleIndex", 548 };
+TypeInfo * __type_info__c9d28329_arg_types_var_3626606213[5] = { &__type_info__ebcc21eb, &__type_info__1b9f61f8, &__type_info__359c1b32, &__type_info__4edf488d, &__type_info__13667ab1 };
+VarInfo __struct_info__d8299e85_field_137 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c9d28329_arg_types_var_3626606213, nullptr, 5, 0, nullptr, 28, 0xc9d28329, "visitExprMakeTupleIndex", 552 };
+TypeInfo * __type_info__e4dec3a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_138 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e4dec3a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe4dec3a3, "preVisitExprArrayComprehension", 556 };
+TypeInfo * __type_info__12c1f55a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__653ef983 };
+VarInfo __struct_info__d8299e85_field_139 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__12c1f55a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x12c1f55a, "visitExprArrayComprehension", 560 };
+TypeInfo * __type_info__b69afd24_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_140 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b69afd24_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0xb69afd24, "preVisitExprArrayComprehensionSubexpr", 564 };
+TypeInfo * __type_info__491e734a_arg_types_var_3626606213[3] = { &__type_info__ebcc21eb, &__type_info__653ef983, &__type_info__4edf488d };
+VarInfo __struct_info__d8299e85_field_141 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__491e734a_arg_types_var_3626606213, nullptr, 3, 0, nullptr, 28, 0x491e734a, "preVisitExprArrayComprehensionWhere", 568 };
+TypeInfo * __type_info__d6bd6ae8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_142 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6bd6ae8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6bd6ae8, "preVisitExprTypeInfo", 572 };
+TypeInfo * __type_info__1bbde4e9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__84917dd0 };
+VarInfo __struct_info__d8299e85_field_143 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1bbde4e9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1bbde4e9, "visitExprTypeInfo", 576 };
+TypeInfo * __type_info__f25fabc1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_144 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f25fabc1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf25fabc1, "preVisitExprPtr2Ref", 580 };
+TypeInfo * __type_info__546203a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__37ca469d };
+VarInfo __struct_info__d8299e85_field_145 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__546203a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x546203a, "visitExprPtr2Ref", 584 };
+TypeInfo * __type_info__e85d642a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_146 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e85d642a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe85d642a, "preVisitExprLabel", 588 };
+TypeInfo * __type_info__919eabb1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__87882376 };
+VarInfo __struct_info__d8299e85_field_147 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__919eabb1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x919eabb1, "visitExprLabel", 592 };
+TypeInfo * __type_info__94bb64af_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_148 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__94bb64af_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x94bb64af, "preVisitExprGoto", 596 };
+TypeInfo * __type_info__fcdb84a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fce7587 };
+VarInfo __struct_info__d8299e85_field_149 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fcdb84a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfcdb84a, "visitExprGoto", 600 };
+TypeInfo * __type_info__ebd6bd76_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_150 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ebd6bd76_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xebd6bd76, "preVisitExprRef2Value", 604 };
+TypeInfo * __type_info__754e508d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__764dc75a };
+VarInfo __struct_info__d8299e85_field_151 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__754e508d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x754e508d, "visitExprRef2Value", 608 };
+TypeInfo * __type_info__e3083f3d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_152 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e3083f3d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe3083f3d, "preVisitExprRef2Ptr", 612 };
+TypeInfo * __type_info__fdcc980e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__39dd41c1 };
+VarInfo __struct_info__d8299e85_field_153 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__fdcc980e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfdcc980e, "visitExprRef2Ptr", 616 };
+TypeInfo * __type_info__822a0a6f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_154 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__822a0a6f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x822a0a6f, "preVisitExprAddr", 620 };
+TypeInfo * __type_info__36bf6516_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__fe4bfa47 };
+VarInfo __struct_info__d8299e85_field_155 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__36bf6516_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x36bf6516, "visitExprAddr", 624 };
+TypeInfo * __type_info__b632464e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_156 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b632464e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb632464e, "preVisitExprAssert", 628 };
+TypeInfo * __type_info__171280cf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__531e5432 };
+VarInfo __struct_info__d8299e85_field_157 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__171280cf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x171280cf, "visitExprAssert", 632 };
+TypeInfo * __type_info__9cd677e8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_158 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd677e8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd677e8, "preVisitExprStaticAssert", 636 };
+TypeInfo * __type_info__3faadbe1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7ddca10 };
+VarInfo __struct_info__d8299e85_field_159 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3faadbe1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3faadbe1, "visitExprStaticAssert", 640 };
+TypeInfo * __type_info__7df46418_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_160 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7df46418_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7df46418, "preVisitExprQuote", 644 };
+TypeInfo * __type_info__24d03a3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72374920 };
+VarInfo __struct_info__d8299e85_field_161 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__24d03a3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x24d03a3, "visitExprQuote", 648 };
+TypeInfo * __type_info__3021cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_162 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3021cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3021cb, "preVisitExprDebug", 652 };
+TypeInfo * __type_info__db853894_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__32f7a66b };
+VarInfo __struct_info__d8299e85_field_163 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db853894_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb853894, "visitExprDebug", 656 };
+TypeInfo * __type_info__a42b136c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_164 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a42b136c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa42b136c, "preVisitExprInvoke", 660 };
+TypeInfo * __type_info__ae8d05f1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ae076c };
+VarInfo __struct_info__d8299e85_field_165 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ae8d05f1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xae8d05f1, "visitExprInvoke", 664 };
+TypeInfo * __type_info__5afbb756_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_166 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5afbb756_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5afbb756, "preVisitExprErase", 668 };
+TypeInfo * __type_info__a433d831_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c5ddc6fa };
+VarInfo __struct_info__d8299e85_field_167 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a433d831_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa433d831, "visitExprErase", 672 };
+TypeInfo * __type_info__89b1ed2f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_168 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89b1ed2f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89b1ed2f, "preVisitExprFind", 676 };
+TypeInfo * __type_info__ba5333e6_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7da04467 };
+VarInfo __struct_info__d8299e85_field_169 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba5333e6_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba5333e6, "visitExprFind", 680 };
+TypeInfo * __type_info__9d59dc9b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_170 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9d59dc9b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9d59dc9b, "preVisitExprKeyExists", 684 };
+TypeInfo * __type_info__5532d30_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__ccee123b };
+VarInfo __struct_info__d8299e85_field_171 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5532d30_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5532d30, "visitExprKeyExists", 688 };
+TypeInfo * __type_info__ac1f0992_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_172 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac1f0992_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xac1f0992, "preVisitExprAscend", 692 };
+TypeInfo * __type_info__d676fdc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__bab365e };
+VarInfo __struct_info__d8299e85_field_173 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d676fdc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd676fdc3, "visitExprAscend", 696 };
+TypeInfo * __type_info__fbd35c53_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_174 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fbd35c53_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xfbd35c53, "preVisitExprCast", 700 };
+TypeInfo * __type_info__3f5db93a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__46fed0f3 };
+VarInfo __struct_info__d8299e85_field_175 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__3f5db93a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3f5db93a, "visitExprCast", 704 };
+TypeInfo * __type_info__e9e73a57_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_176 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e9e73a57_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe9e73a57, "preVisitExprDelete", 708 };
+TypeInfo * __type_info__5b5aed7e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9445fbcf };
+VarInfo __struct_info__d8299e85_field_177 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5b5aed7e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5b5aed7e, "visitExprDelete", 712 };
+TypeInfo * __type_info__31ca940d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_178 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__31ca940d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x31ca940d, "preVisitExprVar", 716 };
+TypeInfo * __type_info__64bce7f2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__1d5a02b1 };
+VarInfo __struct_info__d8299e85_field_179 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__64bce7f2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x64bce7f2, "visitExprVar", 720 };
+TypeInfo * __type_info__490512e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_180 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__490512e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x490512e0, "preVisitExprField", 724 };
+TypeInfo * __type_info__cb496173_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__88de8728 };
+VarInfo __struct_info__d8299e85_field_181 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb496173_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb496173, "visitExprField", 728 };
+TypeInfo * __type_info__afac4da3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_182 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__afac4da3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafac4da3, "preVisitExprSafeField", 732 };
+TypeInfo * __type_info__c2023960_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf76cec3 };
+VarInfo __struct_info__d8299e85_field_183 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c2023960_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc2023960, "visitExprSafeField", 736 };
+TypeInfo * __type_info__2f87634a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_184 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f87634a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f87634a, "preVisitExprSwizzle", 740 };
+TypeInfo * __type_info__cbd679f5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d25748d6 };
+VarInfo __struct_info__d8299e85_field_185 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cbd679f5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcbd679f5, "visitExprSwizzle", 744 };
+TypeInfo * __type_info__c93f0085_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_186 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c93f0085_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc93f0085, "preVisitExprIsVariant", 748 };
+TypeInfo * __type_info__c5f99f7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8c0d0a29 };
+VarInfo __struct_info__d8299e85_field_187 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c5f99f7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc5f99f7a, "visitExprIsVariant", 752 };
+TypeInfo * __type_info__d15980dd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_188 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d15980dd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd15980dd, "preVisitExprAsVariant", 756 };
+TypeInfo * __type_info__1fff0112_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__b9a2b501 };
+VarInfo __struct_info__d8299e85_field_189 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1fff0112_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1fff0112, "visitExprAsVariant", 760 };
+TypeInfo * __type_info__6f4d2d82_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_190 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6f4d2d82_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6f4d2d82, "preVisitExprSafeAsVariant", 764 };
+TypeInfo * __type_info__c4a28f5d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8fd2ec2e };
+VarInfo __struct_info__d8299e85_field_191 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c4a28f5d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc4a28f5d, "visitExprSafeAsVariant", 768 };
+TypeInfo * __type_info__4048a67e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_192 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4048a67e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4048a67e, "preVisitExprOp1", 772 };
+TypeInfo * __type_info__a1981da5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__453f3d02 };
+VarInfo __struct_info__d8299e85_field_193 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a1981da5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa1981da5, "visitExprOp1", 776 };
+TypeInfo * __type_info__9cd84da2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_194 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9cd84da2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9cd84da2, "preVisitExprReturn", 780 };
+TypeInfo * __type_info__e51104e3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__73c8114e };
+VarInfo __struct_info__d8299e85_field_195 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__e51104e3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xe51104e3, "visitExprReturn", 784 };
+TypeInfo * __type_info__88b468bd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_196 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__88b468bd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x88b468bd, "preVisitExprYield", 788 };
+TypeInfo * __type_info__b873b4e2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d180e781 };
+VarInfo __struct_info__d8299e85_field_197 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b873b4e2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb873b4e2, "visitExprYield", 792 };
+TypeInfo * __type_info__bac4281b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_198 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__bac4281b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xbac4281b, "preVisitExprBreak", 796 };
+TypeInfo * __type_info__b8ba8abc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__30023ebb };
+VarInfo __struct_info__d8299e85_field_199 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__b8ba8abc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xb8ba8abc, "visitExprBreak", 800 };
+TypeInfo * __type_info__988afcfd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_200 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__988afcfd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x988afcfd, "preVisitExprContinue", 804 };
+TypeInfo * __type_info__d11ed6d8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__f486e881 };
+VarInfo __struct_info__d8299e85_field_201 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d11ed6d8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd11ed6d8, "visitExprContinue", 808 };
+TypeInfo * __type_info__80289013_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_202 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80289013_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80289013, "preVisitExprMakeBlock", 812 };
+TypeInfo * __type_info__c985a48c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__10edfe53 };
+VarInfo __struct_info__d8299e85_field_203 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__c985a48c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc985a48c, "visitExprMakeBlock", 816 };
+TypeInfo * __type_info__37233ab_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_204 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__37233ab_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x37233ab, "preVisitExprMakeGenerator", 820 };
+TypeInfo * __type_info__6758a118_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15780d4b };
+VarInfo __struct_info__d8299e85_field_205 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6758a118_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6758a118, "visitExprMakeGenerator", 824 };
+TypeInfo * __type_info__cea9756b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_206 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cea9756b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcea9756b, "preVisitExprMemZero", 828 };
+TypeInfo * __type_info__21f91cf0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__535415eb };
+VarInfo __struct_info__d8299e85_field_207 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21f91cf0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21f91cf0, "visitExprMemZero", 832 };
+TypeInfo * __type_info__827a7b9f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_208 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__827a7b9f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x827a7b9f, "preVisitExprConst", 836 };
+TypeInfo * __type_info__80719338_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__7a1c4eb7 };
+VarInfo __struct_info__d8299e85_field_209 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__80719338_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x80719338, "visitExprConst", 840 };
+TypeInfo * __type_info__f1edd27b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_210 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f1edd27b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf1edd27b, "preVisitExprConstPtr", 844 };
+TypeInfo * __type_info__d4f9c662_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__295e937b };
+VarInfo __struct_info__d8299e85_field_211 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d4f9c662_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd4f9c662, "visitExprConstPtr", 848 };
+TypeInfo * __type_info__59a80c5a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_212 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__59a80c5a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x59a80c5a, "preVisitExprConstEnumeration", 852 };
+TypeInfo * __type_info__d561f037_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8e3dc326 };
+VarInfo __struct_info__d8299e85_field_213 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d561f037_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd561f037, "visitExprConstEnumeration", 856 };
+TypeInfo * __type_info__319243ae_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_214 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__319243ae_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x319243ae, "preVisitExprConstBitfield", 860 };
+TypeInfo * __type_info__f502f93d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__15e14f92 };
+VarInfo __struct_info__d8299e85_field_215 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__f502f93d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf502f93d, "visitExprConstBitfield", 864 };
+TypeInfo * __type_info__35133e98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_216 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35133e98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35133e98, "preVisitExprConstInt8", 868 };
+TypeInfo * __type_info__8f9f8e93_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__9fee7340 };
+VarInfo __struct_info__d8299e85_field_217 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__8f9f8e93_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x8f9f8e93, "visitExprConstInt8", 872 };
+TypeInfo * __type_info__2d3a4cbf_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_218 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2d3a4cbf_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2d3a4cbf, "preVisitExprConstInt16", 876 };
+TypeInfo * __type_info__cb3eecea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__8f234b97 };
+VarInfo __struct_info__d8299e85_field_219 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb3eecea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb3eecea, "visitExprConstInt16", 880 };
+TypeInfo * __type_info__ad464f32_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_220 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ad464f32_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xad464f32, "preVisitExprConstInt64", 884 };
+TypeInfo * __type_info__cb50360b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cf52b1be };
+VarInfo __struct_info__d8299e85_field_221 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__cb50360b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcb50360b, "visitExprConstInt64", 888 };
+TypeInfo * __type_info__dbe74630_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_222 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dbe74630_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdbe74630, "preVisitExprConstInt", 892 };
+TypeInfo * __type_info__a80e5f39_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__48d9d78 };
+VarInfo __struct_info__d8299e85_field_223 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a80e5f39_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa80e5f39, "visitExprConstInt", 896 };
+TypeInfo * __type_info__2f133526_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_224 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2f133526_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2f133526, "preVisitExprConstInt2", 900 };
+TypeInfo * __type_info__999f9e51_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__68f47b8a };
+VarInfo __struct_info__d8299e85_field_225 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__999f9e51_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x999f9e51, "visitExprConstInt2", 904 };
+TypeInfo * __type_info__301336b9_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_226 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__301336b9_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x301336b9, "preVisitExprConstInt3", 908 };
+TypeInfo * __type_info__989f9cbe_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d8ac9e75 };
+VarInfo __struct_info__d8299e85_field_227 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__989f9cbe_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x989f9cbe, "visitExprConstInt3", 912 };
+TypeInfo * __type_info__3113384c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_228 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3113384c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3113384c, "preVisitExprConstInt4", 916 };
+TypeInfo * __type_info__9b9fa177_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__368fac4c };
+VarInfo __struct_info__d8299e85_field_229 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9b9fa177_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b9fa177, "visitExprConstInt4", 920 };
+TypeInfo * __type_info__c8e5f55_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_230 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c8e5f55_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xc8e5f55, "preVisitExprConstUInt8", 924 };
+TypeInfo * __type_info__4bbc29e0_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__130d26f9 };
+VarInfo __struct_info__d8299e85_field_231 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__4bbc29e0_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x4bbc29e0, "visitExprConstUInt8", 928 };
+TypeInfo * __type_info__35318804_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_232 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__35318804_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x35318804, "preVisitExprConstUInt16", 932 };
+TypeInfo * __type_info__a14c8807_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e4d4c1e4 };
+VarInfo __struct_info__d8299e85_field_233 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__a14c8807_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa14c8807, "visitExprConstUInt16", 936 };
+TypeInfo * __type_info__3924c25d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_234 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3924c25d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x3924c25d, "preVisitExprConstUInt64", 940 };
+TypeInfo * __type_info__21588a7a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__72ae9081 };
+VarInfo __struct_info__d8299e85_field_235 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__21588a7a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21588a7a, "visitExprConstUInt64", 944 };
+TypeInfo * __type_info__1c524c4f_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_236 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__1c524c4f_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x1c524c4f, "preVisitExprConstUInt", 948 };
+TypeInfo * __type_info__ba8cda98_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__664a2fe7 };
+VarInfo __struct_info__d8299e85_field_237 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ba8cda98_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xba8cda98, "visitExprConstUInt", 952 };
+TypeInfo * __type_info__128e68c7_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_238 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__128e68c7_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x128e68c7, "preVisitExprConstUInt2", 956 };
+TypeInfo * __type_info__55bc399e_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__3c6fa07f };
+VarInfo __struct_info__d8299e85_field_239 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__55bc399e_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x55bc399e, "visitExprConstUInt2", 960 };
+TypeInfo * __type_info__118e6734_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_240 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__118e6734_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x118e6734, "preVisitExprConstUInt3", 964 };
+TypeInfo * __type_info__56bc3b31_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__a5b6b194 };
+VarInfo __struct_info__d8299e85_field_241 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__56bc3b31_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x56bc3b31, "visitExprConstUInt3", 968 };
+TypeInfo * __type_info__108e65a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_242 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__108e65a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x108e65a1, "preVisitExprConstUInt4", 972 };
+TypeInfo * __type_info__57bc3cc4_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__819d499d };
+VarInfo __struct_info__d8299e85_field_243 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__57bc3cc4_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x57bc3cc4, "visitExprConstUInt4", 976 };
+TypeInfo * __type_info__7c486554_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_244 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7c486554_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x7c486554, "preVisitExprConstRange", 980 };
+TypeInfo * __type_info__d1222c0d_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__14c14bf4 };
+VarInfo __struct_info__d8299e85_field_245 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d1222c0d_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd1222c0d, "visitExprConstRange", 984 };
+TypeInfo * __type_info__21dc0f2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_246 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__21dc0f2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x21dc0f2b, "preVisitExprConstURange", 988 };
+TypeInfo * __type_info__9bd0e54c_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__963c776b };
+VarInfo __struct_info__d8299e85_field_247 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9bd0e54c_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9bd0e54c, "visitExprConstURange", 992 };
+TypeInfo * __type_info__cfe854bb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_248 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfe854bb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xcfe854bb, "preVisitExprConstBool", 996 };
+TypeInfo * __type_info__52ff6128_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d16acbbb };
+VarInfo __struct_info__d8299e85_field_249 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__52ff6128_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x52ff6128, "visitExprConstBool", 1000 };
+TypeInfo * __type_info__9b78bd2b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_250 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9b78bd2b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9b78bd2b, "preVisitExprConstFloat", 1004 };
+TypeInfo * __type_info__14bcb702_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__6529db2b };
+VarInfo __struct_info__d8299e85_field_251 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__14bcb702_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x14bcb702, "visitExprConstFloat", 1008 };
+TypeInfo * __type_info__d811ae5b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_252 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d811ae5b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd811ae5b, "preVisitExprConstFloat2", 1012 };
+TypeInfo * __type_info__d5146090_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2481035b };
+VarInfo __struct_info__d8299e85_field_253 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d5146090_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd5146090, "visitExprConstFloat2", 1016 };
+TypeInfo * __type_info__d711acc8_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_254 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d711acc8_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd711acc8, "preVisitExprConstFloat3", 1020 };
+TypeInfo * __type_info__d6146223_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__60d19370 };
+VarInfo __struct_info__d8299e85_field_255 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d6146223_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd6146223, "visitExprConstFloat3", 1024 };
+TypeInfo * __type_info__de11b7cd_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_256 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__de11b7cd_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xde11b7cd, "preVisitExprConstFloat4", 1028 };
+TypeInfo * __type_info__db146a02_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__d7eb08f1 };
+VarInfo __struct_info__d8299e85_field_257 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__db146a02_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdb146a02, "visitExprConstFloat4", 1032 };
+TypeInfo * __type_info__6e97f0ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_258 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6e97f0ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6e97f0ea, "preVisitExprConstString", 1036 };
+TypeInfo * __type_info__ea5d24a1_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__e2deda56 };
+VarInfo __struct_info__d8299e85_field_259 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__ea5d24a1_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xea5d24a1, "visitExprConstString", 1040 };
+TypeInfo * __type_info__89e422d2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_260 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__89e422d2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x89e422d2, "preVisitExprConstDouble", 1044 };
+TypeInfo * __type_info__6c08a2e5_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c4ccbb7e };
+VarInfo __struct_info__d8299e85_field_261 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__6c08a2e5_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x6c08a2e5, "visitExprConstDouble", 1048 };
+TypeInfo * __type_info__2af4d3dc_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_262 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2af4d3dc_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x2af4d3dc, "preVisitExprFakeContext", 1052 };
+TypeInfo * __type_info__5fa7d37b_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__cb3ec93c };
+VarInfo __struct_info__d8299e85_field_263 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__5fa7d37b_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x5fa7d37b, "visitExprFakeContext", 1056 };
+TypeInfo * __type_info__ee0efbc3_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_264 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ee0efbc3_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xee0efbc3, "preVisitExprFakeLineInfo", 1060 };
+TypeInfo * __type_info__afd807ea_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__94ae69a3 };
+VarInfo __struct_info__d8299e85_field_265 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__afd807ea_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xafd807ea, "visitExprFakeLineInfo", 1064 };
+TypeInfo * __type_info__f7387f87_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_266 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7387f87_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xf7387f87, "preVisitExprReader", 1068 };
+TypeInfo * __type_info__d62685b2_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__2ba0095f };
+VarInfo __struct_info__d8299e85_field_267 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__d62685b2_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xd62685b2, "visitExprReader", 1072 };
+TypeInfo * __type_info__ffd9fe3a_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_268 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ffd9fe3a_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xffd9fe3a, "preVisitExprUnsafe", 1076 };
+TypeInfo * __type_info__dfbb50cb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c1e3d526 };
+VarInfo __struct_info__d8299e85_field_269 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__dfbb50cb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xdfbb50cb, "visitExprUnsafe", 1080 };
+TypeInfo * __type_info__a10f6f08_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_270 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a10f6f08_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0xa10f6f08, "preVisitExprCallMacro", 1084 };
+TypeInfo * __type_info__9794b2fb_arg_types_var_3626606213[2] = { &__type_info__ebcc21eb, &__type_info__c9679a50 };
+VarInfo __struct_info__d8299e85_field_271 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__9794b2fb_arg_types_var_3626606213, nullptr, 2, 0, nullptr, 28, 0x9794b2fb, "visitExprCallMacro", 1088 };
+VarInfo * __struct_info__d8299e85_fields[272] =  { &__struct_info__d8299e85_field_0, &__struct_info__d8299e85_field_1, &__struct_info__d8299e85_field_2, &__struct_info__d8299e85_field_3, &__struct_info__d8299e85_field_4, &__struct_info__d8299e85_field_5, &__struct_info__d8299e85_field_6, &__struct_info__d8299e85_field_7, &__struct_info__d8299e85_field_8, &__struct_info__d8299e85_field_9, &__struct_info__d8299e85_field_10, &__struct_info__d8299e85_field_11, &__struct_info__d8299e85_field_12, &__struct_info__d8299e85_field_13, &__struct_info__d8299e85_field_14, &__struct_info__d8299e85_field_15, &__struct_info__d8299e85_field_16, &__struct_info__d8299e85_field_17, &__struct_info__d8299e85_field_18, &__struct_info__d8299e85_field_19, &__struct_info__d8299e85_field_20, &__struct_info__d8299e85_field_21, &__struct_info__d8299e85_field_22, &__struct_info__d8299e85_field_23, &__struct_info__d8299e85_field_24, &__struct_info__d8299e85_field_25, &__struct_info__d8299e85_field_26, &__struct_info__d8299e85_field_27, &__struct_info__d8299e85_field_28, &__struct_info__d8299e85_field_29, &__struct_info__d8299e85_field_30, &__struct_info__d8299e85_field_31, &__struct_info__d8299e85_field_32, &__struct_info__d8299e85_field_33, &__struct_info__d8299e85_field_34, &__struct_info__d8299e85_field_35, &__struct_info__d8299e85_field_36, &__struct_info__d8299e85_field_37, &__struct_info__d8299e85_field_38, &__struct_info__d8299e85_field_39, &__struct_info__d8299e85_field_40, &__struct_info__d8299e85_field_41, &__struct_info__d8299e85_field_42, &__struct_info__d8299e85_field_43, &__struct_info__d8299e85_field_44, &__struct_info__d8299e85_field_45, &__struct_info__d8299e85_field_46, &__struct_info__d8299e85_field_47, &__struct_info__d8299e85_field_48, &__struct_info__d8299e85_field_49, &__struct_info__d8299e85_field_50, &__struct_info__d8299e85_field_51, &__struct_info__d8299e85_field_52, &__struct_info__d8299e85_field_53, &__struct_info__d8299e85_field_54, &__struct_info__d8299e85_field_55, &__struct_info__d8299e85_field_56, &__struct_info__d8299e85_field_57, &__struct_info__d8299e85_field_58, &__struct_info__d8299e85_field_59, &__struct_info__d8299e85_field_60, &__struct_info__d8299e85_field_61, &__struct_info__d8299e85_field_62, &__struct_info__d8299e85_field_63, &__struct_info__d8299e85_field_64, &__struct_info__d8299e85_field_65, &__struct_info__d8299e85_field_66, &__struct_info__d8299e85_field_67, &__struct_info__d8299e85_field_68, &__struct_info__d8299e85_field_69, &__struct_info__d8299e85_field_70, &__struct_info__d8299e85_field_71, &__struct_info__d8299e85_field_72, &__struct_info__d8299e85_field_73, &__struct_info__d8299e85_field_74, &__struct_info__d8299e85_field_75, &__struct_info__d8299e85_field_76, &__struct_info__d8299e85_field_77, &__struct_info__d8299e85_field_78, &__struct_info__d8299e85_field_79, &__struct_info__d8299e85_field_80, &__struct_info__d8299e85_field_81, &__struct_info__d8299e85_field_82, &__struct_info__d8299e85_field_83, &__struct_info__d8299e85_field_84, &__struct_info__d8299e85_field_85, &__struct_info__d8299e85_field_86, &__struct_info__d8299e85_field_87, &__struct_info__d8299e85_field_88, &__struct_info__d8299e85_field_89, &__struct_info__d8299e85_field_90, &__struct_info__d8299e85_field_91, &__struct_info__d8299e85_field_92, &__struct_info__d8299e85_field_93, &__struct_info__d8299e85_field_94, &__struct_info__d8299e85_field_95, &__struct_info__d8299e85_field_96, &__struct_info__d8299e85_field_97, &__struct_info__d8299e85_field_98, &__struct_info__d8299e85_field_99, &__struct_info__d8299e85_field_100, &__struct_info__d8299e85_field_101, &__struct_info__d8299e85_field_102, &__struct_info__d8299e85_field_103, &__struct_info__d8299e85_field_104, &__struct_info__d8299e85_field_105, &__struct_info__d8299e85_field_106, &__struct_info__d8299e85_field_107, &__struct_info__d8299e85_field_108, &__struct_info__d8299e85_field_109, &__struct_info__d8299e85_field_110, &__struct_info__d8299e85_field_111, &__struct_info__d8299e85_field_112, &__struct_info__d8299e85_field_113, &__struct_info__d8299e85_field_114, &__struct_info__d8299e85_field_115, &__struct_info__d8299e85_field_116, &__struct_info__d8299e85_field_117, &__struct_info__d8299e85_field_118, &__struct_info__d8299e85_field_119, &__struct_info__d8299e85_field_120, &__struct_info__d8299e85_field_121, &__struct_info__d8299e85_field_122, &__struct_info__d8299e85_field_123, &__struct_info__d8299e85_field_124, &__struct_info__d8299e85_field_125, &__struct_info__d8299e85_field_126, &__struct_info__d8299e85_field_127, &__struct_info__d8299e85_field_128, &__struct_info__d8299e85_field_129, &__struct_info__d8299e85_field_130, &__struct_info__d8299e85_field_131, &__struct_info__d8299e85_field_132, &__struct_info__d8299e85_field_133, &__struct_info__d8299e85_field_134, &__struct_info__d8299e85_field_135, &__struct_info__d8299e85_field_136, &__struct_info__d8299e85_field_137, &__struct_info__d8299e85_field_138, &__struct_info__d8299e85_field_139, &__struct_info__d8299e85_field_140, &__struct_info__d8299e85_field_141, &__struct_info__d8299e85_field_142, &__struct_info__d8299e85_field_143, &__struct_info__d8299e85_field_144, &__struct_info__d8299e85_field_145, &__struct_info__d8299e85_field_146, &__struct_info__d8299e85_field_147, &__struct_info__d8299e85_field_148, &__struct_info__d8299e85_field_149, &__struct_info__d8299e85_field_150, &__struct_info__d8299e85_field_151, &__struct_info__d8299e85_field_152, &__struct_info__d8299e85_field_153, &__struct_info__d8299e85_field_154, &__struct_info__d8299e85_field_155, &__struct_info__d8299e85_field_156, &__struct_info__d8299e85_field_157, &__struct_info__d8299e85_field_158, &__struct_info__d8299e85_field_159, &__struct_info__d8299e85_field_160, &__struct_info__d8299e85_field_161, &__struct_info__d8299e85_field_162, &__struct_info__d8299e85_field_163, &__struct_info__d8299e85_field_164, &__struct_info__d8299e85_field_165, &__struct_info__d8299e85_field_166, &__struct_info__d8299e85_field_167, &__struct_info__d8299e85_field_168, &__struct_info__d8299e85_field_169, &__struct_info__d8299e85_field_170, &__struct_info__d8299e85_field_171, &__struct_info__d8299e85_field_172, &__struct_info__d8299e85_field_173, &__struct_info__d8299e85_field_174, &__struct_info__d8299e85_field_175, &__struct_info__d8299e85_field_176, &__struct_info__d8299e85_field_177, &__struct_info__d8299e85_field_178, &__struct_info__d8299e85_field_179, &__struct_info__d8299e85_field_180, &__struct_info__d8299e85_field_181, &__struct_info__d8299e85_field_182, &__struct_info__d8299e85_field_183, &__struct_info__d8299e85_field_184, &__struct_info__d8299e85_field_185, &__struct_info__d8299e85_field_186, &__struct_info__d8299e85_field_187, &__struct_info__d8299e85_field_188, &__struct_info__d8299e85_field_189, &__struct_info__d8299e85_field_190, &__struct_info__d8299e85_field_191, &__struct_info__d8299e85_field_192, &__struct_info__d8299e85_field_193, &__struct_info__d8299e85_field_194, &__struct_info__d8299e85_field_195, &__struct_info__d8299e85_field_196, &__struct_info__d8299e85_field_197, &__struct_info__d8299e85_field_198, &__struct_info__d8299e85_field_199, &__struct_info__d8299e85_field_200, &__struct_info__d8299e85_field_201, &__struct_info__d8299e85_field_202, &__struct_info__d8299e85_field_203, &__struct_info__d8299e85_field_204, &__struct_info__d8299e85_field_205, &__struct_info__d8299e85_field_206, &__struct_info__d8299e85_field_207, &__struct_info__d8299e85_field_208, &__struct_info__d8299e85_field_209, &__struct_info__d8299e85_field_210, &__struct_info__d8299e85_field_211, &__struct_info__d8299e85_field_212, &__struct_info__d8299e85_field_213, &__struct_info__d8299e85_field_214, &__struct_info__d8299e85_field_215, &__struct_info__d8299e85_field_216, &__struct_info__d8299e85_field_217, &__struct_info__d8299e85_field_218, &__struct_info__d8299e85_field_219, &__struct_info__d8299e85_field_220, &__struct_info__d8299e85_field_221, &__struct_info__d8299e85_field_222, &__struct_info__d8299e85_field_223, &__struct_info__d8299e85_field_224, &__struct_info__d8299e85_field_225, &__struct_info__d8299e85_field_226, &__struct_info__d8299e85_field_227, &__struct_info__d8299e85_field_228, &__struct_info__d8299e85_field_229, &__struct_info__d8299e85_field_230, &__struct_info__d8299e85_field_231, &__struct_info__d8299e85_field_232, &__struct_info__d8299e85_field_233, &__struct_info__d8299e85_field_234, &__struct_info__d8299e85_field_235, &__struct_info__d8299e85_field_236, &__struct_info__d8299e85_field_237, &__struct_info__d8299e85_field_238, &__struct_info__d8299e85_field_239, &__struct_info__d8299e85_field_240, &__struct_info__d8299e85_field_241, &__struct_info__d8299e85_field_242, &__struct_info__d8299e85_field_243, &__struct_info__d8299e85_field_244, &__struct_info__d8299e85_field_245, &__struct_info__d8299e85_field_246, &__struct_info__d8299e85_field_247, &__struct_info__d8299e85_field_248, &__struct_info__d8299e85_field_249, &__struct_info__d8299e85_field_250, &__struct_info__d8299e85_field_251, &__struct_info__d8299e85_field_252, &__struct_info__d8299e85_field_253, &__struct_info__d8299e85_field_254, &__struct_info__d8299e85_field_255, &__struct_info__d8299e85_field_256, &__struct_info__d8299e85_field_257, &__struct_info__d8299e85_field_258, &__struct_info__d8299e85_field_259, &__struct_info__d8299e85_field_260, &__struct_info__d8299e85_field_261, &__struct_info__d8299e85_field_262, &__struct_info__d8299e85_field_263, &__struct_info__d8299e85_field_264, &__struct_info__d8299e85_field_265, &__struct_info__d8299e85_field_266, &__struct_info__d8299e85_field_267, &__struct_info__d8299e85_field_268, &__struct_info__d8299e85_field_269, &__struct_info__d8299e85_field_270, &__struct_info__d8299e85_field_271 };
+StructInfo __struct_info__d8299e85 = {"AstVisitor", __struct_info__d8299e85_fields, 272, 1096, -1, nullptr, 0xd8299e85 };
+VarInfo __struct_info__b2703645_field_0 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__17c16538, &__type_info__9cc6eb81, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c6f2679, "var2expr", 0 };
+VarInfo * __struct_info__b2703645_fields[1] =  { &__struct_info__b2703645_field_0 };
+StructInfo __struct_info__b2703645 = {"Template", __struct_info__b2703645_fields, 1, 48, -1, nullptr, 0xb2703645 };
+TypeInfo __type_info__10db1c1d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x10db1c1d };
+TypeInfo __type_info__da50b805 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__515c0a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xda50b805 };
+TypeInfo __type_info__f42f651e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStringBuilder"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf42f651e };
+TypeInfo __type_info__dc52e0d5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a8d37f6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xdc52e0d5 };
+TypeInfo __type_info__c0e5e0ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstURange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc0e5e0ad };
+TypeInfo __type_info__8bc5634d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__91c4dfb3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8bc5634d };
+TypeInfo __type_info__bab365e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a40a0d70, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xbab365e };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__3737d9d1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeGenerator"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3737d9d1 };
+TypeInfo __type_info__cd849a9b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xcd849a9b };
+TypeInfo __type_info__aaadd575 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeLineInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xaaadd575 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__c2b9b42c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc2b9b42c };
+TypeInfo __type_info__6f381053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprVar"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6f381053 };
+TypeInfo __type_info__261bce6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x261bce6f };
+TypeInfo __type_info__dd644f60 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReturn"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xdd644f60 };
+TypeInfo __type_info__e749bd33 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5527f9ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe749bd33 };
+TypeInfo __type_info__73c8114e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dd644f60, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x73c8114e };
+TypeInfo __type_info__7da04467 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4aee91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7da04467 };
+TypeInfo __type_info__b1ceb1d4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Value"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb1ceb1d4 };
+TypeInfo __type_info__653ef983 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8da119, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x653ef983 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__1cb4fa6d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e97755bb, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1cb4fa6d };
+TypeInfo __type_info__515c0a3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMove"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x515c0a3 };
+TypeInfo __type_info__ccb7c90a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccb7c90a };
+TypeInfo __type_info__b3bcfd53 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb3bcfd53 };
+TypeInfo __type_info__46fed0f3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b867c43d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x46fed0f3 };
+TypeInfo __type_info__523f6667 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x523f6667 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__6d1d425d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b2cb4a2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6d1d425d };
+TypeInfo __type_info__ebcc21eb = { Type::tStructure, &__struct_info__d8299e85, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xebcc21eb };
+TypeInfo __type_info__5ef84086 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprStaticAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ef84086 };
+TypeInfo __type_info__7a1c4eb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc0d99dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x7a1c4eb7 };
+TypeInfo __type_info__2b3e54e5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBool"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2b3e54e5 };
+TypeInfo __type_info__4de83811 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstPtr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4de83811 };
+TypeInfo __type_info__94ae69a3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aaadd575, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x94ae69a3 };
+TypeInfo __type_info__87a6e894 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ebfa292, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87a6e894 };
+TypeInfo __type_info__a6a527e0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNew"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa6a527e0 };
+TypeInfo __type_info__83498580 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstDouble"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83498580 };
+TypeInfo __type_info__a960d6ab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7856e79d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa960d6ab };
+TypeInfo __type_info__b108e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb108e3 };
+TypeInfo __type_info__d7eb08f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9920ba3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7eb08f1 };
+TypeInfo __type_info__f486e881 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a70d70f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf486e881 };
+TypeInfo __type_info__1683ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1683ec13 };
+TypeInfo __type_info__1d5a02b1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6f381053, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1d5a02b1 };
+TypeInfo __type_info__8f8da119 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprArrayComprehension"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8da119 };
+TypeInfo __type_info__5bc565f1 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5bc565f1 };
+TypeInfo __type_info__819d499d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5dc56917, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x819d499d };
+TypeInfo __type_info__81be117c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be386f7a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x81be117c };
+TypeInfo __type_info__b5d7ce5d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7ec0323f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb5d7ce5d };
+TypeInfo __type_info__32f7a66b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cae7a171, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32f7a66b };
+TypeInfo __type_info__cae7a171 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDebug"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcae7a171 };
+TypeInfo __type_info__453f3d02 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd57da00, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x453f3d02 };
+TypeInfo __type_info__30023ebb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f6a7cad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x30023ebb };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__4edf488d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x4edf488d };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8fce7587 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a1ba446d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fce7587 };
+TypeInfo __type_info__a01f8605 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__721467d3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa01f8605 };
+TypeInfo __type_info__15780d4b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3737d9d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15780d4b };
+TypeInfo __type_info__7ec0323f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLet"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ec0323f };
+TypeInfo __type_info__ae076c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9a5b5986, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xae076c };
+TypeInfo __type_info__ff9fd5d3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d73ee2dd, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xff9fd5d3 };
+TypeInfo __type_info__3c4f7906 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3c4f7906 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__c4ccbb7e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83498580, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc4ccbb7e };
+TypeInfo __type_info__8e3dc326 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a65edd74, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8e3dc326 };
+TypeInfo __type_info__d73ee2dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Variable"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd73ee2dd };
+TypeInfo __type_info__72ae9081 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccc9122b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72ae9081 };
+TypeInfo __type_info__c831b26a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTryCatch"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc831b26a };
+TypeInfo __type_info__72374920 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__26379cda, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x72374920 };
+TypeInfo __type_info__d25748d6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4fa9a2d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd25748d6 };
+TypeInfo __type_info__3a70d70f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprContinue"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x3a70d70f };
+TypeInfo __type_info__7c510f91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprDelete"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7c510f91 };
+TypeInfo __type_info__b66d9ef1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8121e453, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb66d9ef1 };
+TypeInfo __type_info__91c4dfb3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprClone"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x91c4dfb3 };
+TypeInfo __type_info__15e14f92 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1d3d6764, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x15e14f92 };
+TypeInfo __type_info__ebc70931 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeArray"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xebc70931 };
+TypeInfo __type_info__3c8fd4b4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8728109a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c8fd4b4 };
+TypeInfo __type_info__4e52e6ae = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Structure"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4e52e6ae };
+TypeInfo __type_info__7ebfa292 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWith"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7ebfa292 };
+TypeInfo __type_info__9773df12 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9773df12 };
+TypeInfo __type_info__317f8d25 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::FieldDeclaration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x317f8d25 };
+TypeInfo __type_info__3c6fa07f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5bc565f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x3c6fa07f };
+TypeInfo __type_info__9920ba3b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9920ba3b };
+TypeInfo __type_info__8f234b97 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6cb0399, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f234b97 };
+TypeInfo __type_info__87882376 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d4f3571c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x87882376 };
+TypeInfo __type_info__5f6a7cad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprBreak"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f6a7cad };
+TypeInfo __type_info__10b7decc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c831b26a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10b7decc };
+TypeInfo __type_info__c9679a50 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76972586, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc9679a50 };
+TypeInfo __type_info__8494e015 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLooksLikeCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8494e015 };
+TypeInfo __type_info__8f3455dd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8f3455dd };
+TypeInfo __type_info__b867c43d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCast"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb867c43d };
+TypeInfo __type_info__9e20c21a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9e20c21a };
+TypeInfo __type_info__b9491240 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf57dd26, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9491240 };
+TypeInfo __type_info__963c776b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0e5e0ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x963c776b };
+TypeInfo __type_info__b58fe8a6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a6a527e0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb58fe8a6 };
+TypeInfo __type_info__5527f9ed = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFor"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5527f9ed };
+TypeInfo __type_info__fba33907 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8494e015, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfba33907 };
+TypeInfo __type_info__51c55633 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x51c55633 };
+TypeInfo __type_info__84917dd0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d00bb3d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x84917dd0 };
+TypeInfo __type_info__b9a2b501 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b38eb5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xb9a2b501 };
+TypeInfo __type_info__68f47b8a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__251bccdc, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x68f47b8a };
+TypeInfo __type_info__34157e23 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__309172d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x34157e23 };
+TypeInfo __type_info__65966b2b = { Type::tStructure, &__struct_info__b2703645, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x65966b2b };
+TypeInfo __type_info__37ca469d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27a9a437, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x37ca469d };
+TypeInfo __type_info__14c14bf4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c627fc0a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x14c14bf4 };
+TypeInfo __type_info__4fa9a2d8 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSwizzle"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x4fa9a2d8 };
+TypeInfo __type_info__d4f3571c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprLabel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4f3571c };
+TypeInfo __type_info__2d8fb614 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x2d8fb614 };
+TypeInfo __type_info__10edfe53 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8f8b0275, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x10edfe53 };
+TypeInfo __type_info__b38eb5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb38eb5b3 };
+TypeInfo __type_info__2481035b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f20c3ad, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2481035b };
+TypeInfo __type_info__a1ba446d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprGoto"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa1ba446d };
+TypeInfo __type_info__9fee7340 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f1bdc9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9fee7340 };
+TypeInfo __type_info__ada7aa90 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstString"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xada7aa90 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__664a2fe7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374bcd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x664a2fe7 };
+TypeInfo __type_info__655bd8a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f66d4d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x655bd8a4 };
+TypeInfo __type_info__2f1bdc9a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt8"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2f1bdc9a };
+TypeInfo __type_info__8fd2ec2e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2cdf1a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8fd2ec2e };
+TypeInfo __type_info__5dc56917 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5dc56917 };
+TypeInfo __type_info__d16acbbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2b3e54e5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd16acbbb };
+TypeInfo __type_info__d4aee91 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFind"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd4aee91 };
+TypeInfo __type_info__2ba0095f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__75b7ce79, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x2ba0095f };
+TypeInfo __type_info__d057deb9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd057deb9 };
+TypeInfo __type_info__6dd946fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x6dd946fa };
+TypeInfo __type_info__32b24044 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4e52e6ae, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x32b24044 };
+TypeInfo __type_info__531e5432 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7df5ef2c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x531e5432 };
+TypeInfo __type_info__e0a995b4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Enumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe0a995b4 };
+TypeInfo __type_info__368fac4c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__231bc9b6, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x368fac4c };
+TypeInfo __type_info__76b8ad03 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprYield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76b8ad03 };
+TypeInfo __type_info__48d9d78 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c4f7906, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x48d9d78 };
+TypeInfo __type_info__6535171f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIfThenElse"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6535171f };
+TypeInfo __type_info__9ee277f5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAddr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9ee277f5 };
+TypeInfo __type_info__e7b89eff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__10db1c1d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe7b89eff };
+TypeInfo __type_info__8f8b0275 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeBlock"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8f8b0275 };
+TypeInfo __type_info__764dc75a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b1ceb1d4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x764dc75a };
+TypeInfo __type_info__e2deda56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ada7aa90, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe2deda56 };
+TypeInfo __type_info__5a28d785 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprKeyExists"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5a28d785 };
+TypeInfo __type_info__9445fbcf = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7c510f91, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x9445fbcf };
+TypeInfo __type_info__7df5ef2c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAssert"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7df5ef2c };
+TypeInfo __type_info__bf2d884b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbf2d884b };
+TypeInfo __type_info__6c2a86f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b3bcfd53, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6c2a86f9 };
+TypeInfo __type_info__391e819b = { Type::tStructure, &__struct_info__f7c48841, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x391e819b };
+TypeInfo __type_info__e97755bb = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprWhile"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xe97755bb };
+TypeInfo __type_info__295e937b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4de83811, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x295e937b };
+TypeInfo __type_info__1d3d6764 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstBitfield"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1d3d6764 };
+TypeInfo __type_info__251bccdc = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x251bccdc };
+TypeInfo __type_info__bd757ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeTuple"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbd757ca };
+TypeInfo __type_info__5ac5645e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5ac5645e };
+TypeInfo __type_info__e4d4c1e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ccb7c90a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xe4d4c1e4 };
+TypeInfo __type_info__d514cba4 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprErase"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd514cba4 };
+TypeInfo __type_info__60d19370 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9e20c21a, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x60d19370 };
+TypeInfo __type_info__c5ddc6fa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d514cba4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc5ddc6fa };
+TypeInfo __type_info__9f20c3ad = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat2"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9f20c3ad };
+TypeInfo __type_info__1b3c6d8d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstFloat"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x1b3c6d8d };
+TypeInfo __type_info__6529db2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1b3c6d8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x6529db2b };
+TypeInfo __type_info__a8d37f6f = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNullCoalescing"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa8d37f6f };
+TypeInfo __type_info__d7ddca10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ef84086, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd7ddca10 };
+TypeInfo __type_info__130d26f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__51c55633, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x130d26f9 };
+TypeInfo __type_info__721467d3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x721467d3 };
+TypeInfo __type_info__8728109a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprIs"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8728109a };
+TypeInfo __type_info__1bb5fdf7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ebc70931, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1bb5fdf7 };
+TypeInfo __type_info__a65edd74 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstEnumeration"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa65edd74 };
+TypeInfo __type_info__76972586 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallMacro"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x76972586 };
+TypeInfo __type_info__5ca338ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6535171f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x5ca338ad };
+TypeInfo __type_info__d180e781 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b8ad03, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd180e781 };
+TypeInfo __type_info__74b0f2db = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprRef2Ptr"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74b0f2db };
+TypeInfo __type_info__cf57dd26 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp3"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcf57dd26 };
+TypeInfo __type_info__535415eb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9338185, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x535415eb };
+TypeInfo __type_info__ccc9122b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt64"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xccc9122b };
+TypeInfo __type_info__b2cb4a2b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCopy"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb2cb4a2b };
+TypeInfo __type_info__a5b6b194 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5ac5645e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa5b6b194 };
+TypeInfo __type_info__ccee123b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a28d785, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xccee123b };
+TypeInfo __type_info__374b4b09 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::MakeFieldDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374b4b09 };
+TypeInfo __type_info__9338185 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMemZero"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9338185 };
+TypeInfo __type_info__cf52b1be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c2b9b42c, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf52b1be };
+TypeInfo __type_info__9a5b5986 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprInvoke"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9a5b5986 };
+TypeInfo __type_info__7856e79d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::TypeDecl"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7856e79d };
+TypeInfo __type_info__75b7ce79 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprReader"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x75b7ce79 };
+TypeInfo __type_info__5f1adc0e = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprFakeContext"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x5f1adc0e };
+TypeInfo __type_info__cd57da00 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprOp1"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xcd57da00 };
+TypeInfo __type_info__a8981616 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e0a995b4, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xa8981616 };
+TypeInfo __type_info__88de8728 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9773df12, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x88de8728 };
+TypeInfo __type_info__1b9f61f8 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd757ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x1b9f61f8 };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+TypeInfo __type_info__231bc9b6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt4"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x231bc9b6 };
+TypeInfo __type_info__8121e453 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprNamedCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8121e453 };
+TypeInfo __type_info__d3ebcc43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__374b4b09, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xd3ebcc43 };
+TypeInfo __type_info__f2cdf1a0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAsVariant"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf2cdf1a0 };
+TypeInfo __type_info__d8ac9e75 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__261bce6f, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xd8ac9e75 };
+TypeInfo __type_info__fc0d99dd = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConst"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xfc0d99dd };
+TypeInfo __type_info__c1e3d526 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__858d2368, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xc1e3d526 };
+TypeInfo __type_info__c627fc0a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstRange"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc627fc0a };
+TypeInfo __type_info__a40a0d70 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprAscend"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xa40a0d70 };
+TypeInfo __type_info__858d2368 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprUnsafe"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x858d2368 };
+TypeInfo __type_info__26379cda = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprQuote"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x26379cda };
+TypeInfo __type_info__c6cb0399 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstInt16"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc6cb0399 };
+TypeInfo __type_info__f66d4d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeAt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf66d4d6 };
+TypeInfo __type_info__fe4bfa47 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9ee277f5, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xfe4bfa47 };
+TypeInfo __type_info__cb3ec93c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5f1adc0e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcb3ec93c };
+TypeInfo __type_info__27a9a437 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprPtr2Ref"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x27a9a437 };
+TypeInfo __type_info__374bcd9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprConstUInt"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x374bcd9 };
+TypeInfo __type_info__39dd41c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__74b0f2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x39dd41c1 };
+TypeInfo __type_info__d00bb3d6 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprTypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd00bb3d6 };
+TypeInfo __type_info__f1eeff10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f42f651e, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xf1eeff10 };
+TypeInfo __type_info__b081465d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprSafeField"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xb081465d };
+TypeInfo __type_info__8c0d0a29 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bf2d884b, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0x8c0d0a29 };
+TypeInfo __type_info__be386f7a = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCall"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbe386f7a };
+TypeInfo __type_info__cf76cec3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b081465d, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xcf76cec3 };
+TypeInfo __type_info__ed20bab = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d057deb9, nullptr, nullptr, nullptr, 0, 0, nullptr, 1056, 0xed20bab };
+TypeInfo __type_info__309172d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprMakeStruct"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x309172d };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+namespace ast {
+
+struct AstVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+};
+static_assert(sizeof(AstVisitor)==1096,"structure size mismatch with DAS");
+static_assert(offsetof(AstVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+}
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace template_boost {
+
+struct Template {
+	TTable<char *,smart_ptr_raw<Expression>> var2expr;
+};
+static_assert(sizeof(Template)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Template,var2expr)==0,"structure field offset mismatch with DAS");
+}
+namespace template_boost {
+
+struct TemplateVisitor {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstVisitor)) __finalize;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitProgram;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitProgramBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) preVisitTypeDecl;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const )) visitTypeDecl;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) preVisitAlias;
+	Func DAS_COMMENT((smart_ptr_raw<TypeDecl>,ast::AstVisitor,smart_ptr_raw<TypeDecl> const ,das::string const )) visitAlias;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) preVisitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) preVisitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Enumeration> const ,das::string const ,smart_ptr_raw<Expression> const ,bool)) visitEnumerationValue;
+	Func DAS_COMMENT((smart_ptr_raw<Enumeration>,ast::AstVisitor,smart_ptr_raw<Enumeration> const )) visitEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const )) preVisitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) preVisitStructureField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Structure> const ,Structure::FieldDeclaration const ,bool)) visitStructureField;
+	Func DAS_COMMENT((smart_ptr_raw<Structure>,ast::AstVisitor,smart_ptr_raw<Structure> const )) visitStructure;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunction;
+	Func DAS_COMMENT((smart_ptr_raw<Function>,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunction;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) preVisitFunctionArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,bool)) visitFunctionArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitFunctionArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Function> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitFunctionArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) preVisitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Function> const )) visitFunctionBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Expression> const )) preVisitExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Expression> const )) visitExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprBlockArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,bool)) visitExprBlockArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockArgumentInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprBlockArgumentInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) preVisitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const )) visitExprBlockFinal;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) preVisitExprBlockFinalExpression;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBlock> const ,smart_ptr_raw<Expression> const )) visitExprBlockFinalExpression;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) preVisitExprLet;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const )) visitExprLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,bool)) visitExprLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitExprLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLet> const ,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitExprLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) preVisitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Program> const )) visitGlobalLet;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) preVisitGlobalLetVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<Variable> const ,bool)) visitGlobalLetVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) preVisitGlobalLetVariableInit;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<Variable> const ,smart_ptr_raw<Expression> const )) visitGlobalLetVariableInit;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) preVisitExprStringBuilder;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const )) visitExprStringBuilder;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprStringBuilderElement;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStringBuilder> const ,smart_ptr_raw<Expression> const ,bool)) visitExprStringBuilderElement;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) preVisitExprNew;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const )) visitExprNew;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprNewArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNew> const ,smart_ptr_raw<Expression> const ,bool)) visitExprNewArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) preVisitExprNamedCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const )) visitExprNamedCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprNamedCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprNamedCall> const ,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprNamedCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) preVisitExprLooksLikeCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const )) visitExprLooksLikeCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLooksLikeCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprLooksLikeCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) preVisitExprCall;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const )) visitExprCall;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprCallArgument;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCall> const ,smart_ptr_raw<Expression> const ,bool)) visitExprCallArgument;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) preVisitExprNullCoalescing;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const )) visitExprNullCoalescing;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprNullCoalescing> const ,smart_ptr_raw<Expression> const )) preVisitExprNullCoalescingDefault;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) preVisitExprAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAt> const )) visitExprAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) preVisitExprSafeAt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAt> const )) visitExprSafeAt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<Expression> const )) preVisitExprSafeAtIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) preVisitExprIs;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIs> const )) visitExprIs;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAt> const ,smart_ptr_raw<TypeDecl> const )) preVisitExprIsType;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) preVisitExprOp2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp2> const )) visitExprOp2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp2> const ,smart_ptr_raw<Expression> const )) preVisitExprOp2Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) preVisitExprOp3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp3> const )) visitExprOp3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Left;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp3> const ,smart_ptr_raw<Expression> const )) preVisitExprOp3Right;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) preVisitExprCopy;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCopy> const )) visitExprCopy;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCopy> const ,smart_ptr_raw<Expression> const )) preVisitExprCopyRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) preVisitExprMove;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMove> const )) visitExprMove;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMove> const ,smart_ptr_raw<Expression> const )) preVisitExprMoveRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) preVisitExprClone;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprClone> const )) visitExprClone;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprClone> const ,smart_ptr_raw<Expression> const )) preVisitExprCloneRight;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) preVisitExprWith;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWith> const )) visitExprWith;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWith> const ,smart_ptr_raw<Expression> const )) preVisitExprWithBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) preVisitExprWhile;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprWhile> const )) visitExprWhile;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprWhile> const ,smart_ptr_raw<Expression> const )) preVisitExprWhileBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) preVisitExprTryCatch;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const )) visitExprTryCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTryCatch> const ,smart_ptr_raw<Expression> const )) preVisitExprTryCatchCatch;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) preVisitExprIfThenElse;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const )) visitExprIfThenElse;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseIfBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIfThenElse> const ,smart_ptr_raw<Expression> const )) preVisitExprIfThenElseElseBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprFor;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) visitExprFor;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) preVisitExprForVariable;
+	Func DAS_COMMENT((smart_ptr_raw<Variable>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Variable> const ,bool)) visitExprForVariable;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) preVisitExprForSource;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFor> const ,smart_ptr_raw<Expression> const ,bool)) visitExprForSource;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForStack;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFor> const )) preVisitExprForBody;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) preVisitExprMakeVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const )) visitExprMakeVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeVariantField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeVariant> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeVariantField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) preVisitExprMakeStruct;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const )) visitExprMakeStruct;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) preVisitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,bool)) visitExprMakeStructIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) preVisitExprMakeStructField;
+	Func DAS_COMMENT((smart_ptr_raw<MakeFieldDecl>,ast::AstVisitor,smart_ptr_raw<ExprMakeStruct> const ,int32_t,smart_ptr_raw<MakeFieldDecl> const ,bool)) visitExprMakeStructField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) preVisitExprMakeArray;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const )) visitExprMakeArray;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeArrayIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeArray> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeArrayIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) preVisitExprMakeTuple;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const )) visitExprMakeTuple;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) preVisitExprMakeTupleIndex;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeTuple> const ,int32_t,smart_ptr_raw<Expression> const ,bool)) visitExprMakeTupleIndex;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) preVisitExprArrayComprehension;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const )) visitExprArrayComprehension;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionSubexpr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprArrayComprehension> const ,smart_ptr_raw<Expression> const )) preVisitExprArrayComprehensionWhere;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) preVisitExprTypeInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprTypeInfo> const )) visitExprTypeInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) preVisitExprPtr2Ref;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprPtr2Ref> const )) visitExprPtr2Ref;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) preVisitExprLabel;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprLabel> const )) visitExprLabel;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) preVisitExprGoto;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprGoto> const )) visitExprGoto;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) preVisitExprRef2Value;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Value> const )) visitExprRef2Value;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) preVisitExprRef2Ptr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprRef2Ptr> const )) visitExprRef2Ptr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) preVisitExprAddr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAddr> const )) visitExprAddr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) preVisitExprAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAssert> const )) visitExprAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) preVisitExprStaticAssert;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprStaticAssert> const )) visitExprStaticAssert;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) preVisitExprQuote;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprQuote> const )) visitExprQuote;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) preVisitExprDebug;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDebug> const )) visitExprDebug;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) preVisitExprInvoke;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprInvoke> const )) visitExprInvoke;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) preVisitExprErase;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprErase> const )) visitExprErase;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) preVisitExprFind;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFind> const )) visitExprFind;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) preVisitExprKeyExists;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprKeyExists> const )) visitExprKeyExists;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) preVisitExprAscend;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAscend> const )) visitExprAscend;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) preVisitExprCast;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCast> const )) visitExprCast;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) preVisitExprDelete;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprDelete> const )) visitExprDelete;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) preVisitExprVar;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const )) visitExprVar;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprField> const )) preVisitExprField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprField> const )) visitExprField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) preVisitExprSafeField;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeField> const )) visitExprSafeField;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) preVisitExprSwizzle;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSwizzle> const )) visitExprSwizzle;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) preVisitExprIsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprIsVariant> const )) visitExprIsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) preVisitExprAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprAsVariant> const )) visitExprAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) preVisitExprSafeAsVariant;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprSafeAsVariant> const )) visitExprSafeAsVariant;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) preVisitExprOp1;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprOp1> const )) visitExprOp1;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) preVisitExprReturn;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReturn> const )) visitExprReturn;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) preVisitExprYield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprYield> const )) visitExprYield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) preVisitExprBreak;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprBreak> const )) visitExprBreak;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) preVisitExprContinue;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprContinue> const )) visitExprContinue;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) preVisitExprMakeBlock;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeBlock> const )) visitExprMakeBlock;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) preVisitExprMakeGenerator;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMakeGenerator> const )) visitExprMakeGenerator;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) preVisitExprMemZero;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprMemZero> const )) visitExprMemZero;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) preVisitExprConst;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConst> const )) visitExprConst;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) preVisitExprConstPtr;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstPtr> const )) visitExprConstPtr;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) preVisitExprConstEnumeration;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstEnumeration> const )) visitExprConstEnumeration;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) preVisitExprConstBitfield;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBitfield> const )) visitExprConstBitfield;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) preVisitExprConstInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt8> const )) visitExprConstInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) preVisitExprConstInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt16> const )) visitExprConstInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) preVisitExprConstInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt64> const )) visitExprConstInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) preVisitExprConstInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt> const )) visitExprConstInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) preVisitExprConstInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt2> const )) visitExprConstInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) preVisitExprConstInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt3> const )) visitExprConstInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) preVisitExprConstInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstInt4> const )) visitExprConstInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) preVisitExprConstUInt8;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt8> const )) visitExprConstUInt8;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) preVisitExprConstUInt16;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt16> const )) visitExprConstUInt16;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) preVisitExprConstUInt64;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt64> const )) visitExprConstUInt64;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) preVisitExprConstUInt;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt> const )) visitExprConstUInt;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) preVisitExprConstUInt2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt2> const )) visitExprConstUInt2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) preVisitExprConstUInt3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt3> const )) visitExprConstUInt3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) preVisitExprConstUInt4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstUInt4> const )) visitExprConstUInt4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) preVisitExprConstRange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstRange> const )) visitExprConstRange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) preVisitExprConstURange;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstURange> const )) visitExprConstURange;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) preVisitExprConstBool;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstBool> const )) visitExprConstBool;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) preVisitExprConstFloat;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat> const )) visitExprConstFloat;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) preVisitExprConstFloat2;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat2> const )) visitExprConstFloat2;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) preVisitExprConstFloat3;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat3> const )) visitExprConstFloat3;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) preVisitExprConstFloat4;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstFloat4> const )) visitExprConstFloat4;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) preVisitExprConstString;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstString> const )) visitExprConstString;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) preVisitExprConstDouble;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprConstDouble> const )) visitExprConstDouble;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) preVisitExprFakeContext;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeContext> const )) visitExprFakeContext;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) preVisitExprFakeLineInfo;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprFakeLineInfo> const )) visitExprFakeLineInfo;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) preVisitExprReader;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprReader> const )) visitExprReader;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) preVisitExprUnsafe;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprUnsafe> const )) visitExprUnsafe;
+	Func DAS_COMMENT((void,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) preVisitExprCallMacro;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprCallMacro> const )) visitExprCallMacro;
+	template_boost::Template * rules;
+};
+static_assert(sizeof(TemplateVisitor)==1104,"structure size mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitProgram)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitProgram)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitProgramBody)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitTypeDecl)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitTypeDecl)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitAlias)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitAlias)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitEnumeration)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitEnumerationValue)==44,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitEnumerationValue)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitEnumeration)==52,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitStructure)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitStructureField)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitStructureField)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitStructure)==68,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunction)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunction)==76,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionArgument)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionArgument)==84,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionArgumentInit)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionArgumentInit)==92,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitFunctionBody)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitFunctionBody)==100,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExpression)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExpression)==108,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlock)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlock)==116,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockArgument)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockArgument)==124,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockArgumentInit)==128,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockArgumentInit)==132,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockExpression)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockExpression)==140,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockFinal)==144,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockFinal)==148,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBlockFinalExpression)==152,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBlockFinalExpression)==156,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLet)==160,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLet)==164,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLetVariable)==168,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLetVariable)==172,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLetVariableInit)==176,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLetVariableInit)==180,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLet)==184,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLet)==188,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLetVariable)==192,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLetVariable)==196,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitGlobalLetVariableInit)==200,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitGlobalLetVariableInit)==204,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStringBuilder)==208,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStringBuilder)==212,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStringBuilderElement)==216,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStringBuilderElement)==220,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNew)==224,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNew)==228,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNewArgument)==232,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNewArgument)==236,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNamedCall)==240,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNamedCall)==244,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNamedCallArgument)==248,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNamedCallArgument)==252,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLooksLikeCall)==256,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLooksLikeCall)==260,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLooksLikeCallArgument)==264,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLooksLikeCallArgument)==268,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCall)==272,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCall)==276,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCallArgument)==280,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCallArgument)==284,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNullCoalescing)==288,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprNullCoalescing)==292,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprNullCoalescingDefault)==296,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAt)==300,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAt)==304,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAtIndex)==308,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAt)==312,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeAt)==316,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAtIndex)==320,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIs)==324,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIs)==328,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIsType)==332,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp2)==336,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp2)==340,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp2Right)==344,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3)==348,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp3)==352,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3Left)==356,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp3Right)==360,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCopy)==364,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCopy)==368,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCopyRight)==372,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMove)==376,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMove)==380,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMoveRight)==384,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprClone)==388,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprClone)==392,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCloneRight)==396,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWith)==400,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprWith)==404,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWithBody)==408,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWhile)==412,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprWhile)==416,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprWhileBody)==420,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTryCatch)==424,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTryCatch)==428,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTryCatchCatch)==432,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElse)==436,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIfThenElse)==440,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElseIfBlock)==444,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIfThenElseElseBlock)==448,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFor)==452,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFor)==456,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForVariable)==460,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprForVariable)==464,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForSource)==468,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprForSource)==472,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForStack)==476,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprForBody)==480,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeVariant)==484,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeVariant)==488,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeVariantField)==492,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeVariantField)==496,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStruct)==500,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStruct)==504,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStructIndex)==508,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStructIndex)==512,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeStructField)==516,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeStructField)==520,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeArray)==524,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeArray)==528,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeArrayIndex)==532,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeArrayIndex)==536,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeTuple)==540,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeTuple)==544,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeTupleIndex)==548,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeTupleIndex)==552,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehension)==556,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprArrayComprehension)==560,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehensionSubexpr)==564,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprArrayComprehensionWhere)==568,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprTypeInfo)==572,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprTypeInfo)==576,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprPtr2Ref)==580,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprPtr2Ref)==584,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprLabel)==588,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprLabel)==592,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprGoto)==596,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprGoto)==600,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprRef2Value)==604,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprRef2Value)==608,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprRef2Ptr)==612,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprRef2Ptr)==616,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAddr)==620,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAddr)==624,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAssert)==628,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAssert)==632,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprStaticAssert)==636,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprStaticAssert)==640,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprQuote)==644,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprQuote)==648,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprDebug)==652,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprDebug)==656,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprInvoke)==660,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprInvoke)==664,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprErase)==668,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprErase)==672,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFind)==676,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFind)==680,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprKeyExists)==684,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprKeyExists)==688,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAscend)==692,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAscend)==696,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCast)==700,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCast)==704,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprDelete)==708,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprDelete)==712,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprVar)==716,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprVar)==720,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprField)==724,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprField)==728,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeField)==732,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeField)==736,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSwizzle)==740,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSwizzle)==744,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprIsVariant)==748,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprIsVariant)==752,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprAsVariant)==756,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprAsVariant)==760,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprSafeAsVariant)==764,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprSafeAsVariant)==768,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprOp1)==772,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprOp1)==776,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprReturn)==780,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprReturn)==784,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprYield)==788,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprYield)==792,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprBreak)==796,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprBreak)==800,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprContinue)==804,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprContinue)==808,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeBlock)==812,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeBlock)==816,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMakeGenerator)==820,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMakeGenerator)==824,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprMemZero)==828,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprMemZero)==832,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConst)==836,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConst)==840,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstPtr)==844,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstPtr)==848,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstEnumeration)==852,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstEnumeration)==856,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstBitfield)==860,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstBitfield)==864,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt8)==868,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt8)==872,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt16)==876,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt16)==880,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt64)==884,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt64)==888,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt)==892,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt)==896,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt2)==900,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt2)==904,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt3)==908,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt3)==912,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstInt4)==916,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstInt4)==920,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt8)==924,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt8)==928,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt16)==932,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt16)==936,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt64)==940,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt64)==944,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt)==948,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt)==952,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt2)==956,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt2)==960,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt3)==964,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt3)==968,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstUInt4)==972,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstUInt4)==976,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstRange)==980,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstRange)==984,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstURange)==988,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstURange)==992,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstBool)==996,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstBool)==1000,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat)==1004,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat)==1008,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat2)==1012,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat2)==1016,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat3)==1020,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat3)==1024,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstFloat4)==1028,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstFloat4)==1032,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstString)==1036,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstString)==1040,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprConstDouble)==1044,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprConstDouble)==1048,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFakeContext)==1052,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFakeContext)==1056,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprFakeLineInfo)==1060,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprFakeLineInfo)==1064,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprReader)==1068,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprReader)==1072,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprUnsafe)==1076,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprUnsafe)==1080,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,preVisitExprCallMacro)==1084,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,visitExprCallMacro)==1088,"structure field offset mismatch with DAS");
+static_assert(offsetof(TemplateVisitor,rules)==1096,"structure field offset mismatch with DAS");
+}
+
+inline template_boost::TemplateVisitor TemplateVisitor_1d1fef74a7d45885 ( Context * __context__ );
+inline template_boost::TemplateVisitor TemplateVisitor_d27540fb2b2a7514 ( Context * __context__, template_boost::Template * const  __r_rename_at_20 );
+inline void _FuncTemplateVisitor_0x27___finalize_ced51cb73a64f548 ( Context * __context__, template_boost::TemplateVisitor & __self_rename_at_18 );
+inline void _FuncTemplateVisitor_0x60_TemplateVisitor_af7d2b3f12360f38 ( Context * __context__, template_boost::TemplateVisitor & __self_rename_at_20, template_boost::Template * const  __r_rename_at_20 );
+inline smart_ptr_raw<Expression> _FuncTemplateVisitor_0x60_visitExprVar_a0cebc6d23e2365a ( Context * __context__, template_boost::TemplateVisitor & __self_rename_at_22, smart_ptr_raw<ExprVar> const  __expr_rename_at_22 );
+inline void add_global_let_847eb40debbf6e67 ( Context * __context__, Module * const  __mod_rename_at_64, char * const  __vname_rename_at_64, LineInfo const  & __vat_rename_at_64, smart_ptr_raw<Expression> __value_rename_at_64 );
+inline void add_global_var_9b7fc96193024d25 ( Context * __context__, Module * const  __mod_rename_at_61, char * const  __vname_rename_at_61, LineInfo const  & __vat_rename_at_61, smart_ptr_raw<Expression> __value_rename_at_61 );
+inline void add_global_var_any_8228646b54a5be47 ( Context * __context__, Module * const  __mod_rename_at_48, char * const  __vname_rename_at_48, LineInfo const  & __vat_rename_at_48, Bitfield __vflag_rename_at_48, smart_ptr_raw<Expression> __value_rename_at_48 );
+inline void apply_template_9895a1e22ae53dcf ( Context * __context__, template_boost::Template & __rules_rename_at_28, LineInfo const  & __at_rename_at_28, smart_ptr_raw<Expression> __expr_rename_at_28 );
+inline smart_ptr_raw<Expression> _Funcast_0x60_ExpressionPtr_e1088b54d5fb2754 ( Context * __context__, smart_ptr_raw<ExprVar> const  __expr_rename_at_39 );
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_b407d4f5ccd3dd25 ( Context * __context__, template_boost::TemplateVisitor const  & __someClass_rename_at_463 );
+inline smart_ptr<Expression> _Funcbuiltin_0x60_clone_to_move_999c54242e80d01d ( Context * __context__, smart_ptr<Expression> const  __clone_src_rename_at_131 );
+inline void _Funcbuiltin_0x60_finalize_41ed4af8b23eff9 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> & __a_rename_at_193 );
+inline bool _Funcbuiltin_0x60_key_exists_4f6d739aa79d7024 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> const  & __Tab_rename_at_120, char * const  __at_rename_at_120 );
+inline Sequence DAS_COMMENT((smart_ptr_raw<Expression> &)) _Funcbuiltin_0x60_values_d0687d23d602ec29 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> & __a_rename_at_173 );
+inline void clone_5587e1b0c7901e78 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_133, smart_ptr<Expression> const  __src_rename_at_133 );
+inline void clone_14432ab28f95d994 ( Context * __context__, smart_ptr_raw<Variable> & __dest_rename_at_59, void * const  __src_rename_at_59 );
+inline void finalize_2c937931ae829422 ( Context * __context__, template_boost::Template * & ____this_rename_at_19 );
+inline void finalize_f974ea6838672e3e ( Context * __context__, template_boost::TemplateVisitor * & ____this_rename_at_38 );
+inline void finalize_31bf7d379f8a2e73 ( Context * __context__, template_boost::Template & ____this_rename_at_9 );
+inline void finalize_ac96a0550b621b23 ( Context * __context__, template_boost::TemplateVisitor & ____this_rename_at_18 );
+inline void renameVariable_86cce993c3fa474f ( Context * __context__, template_boost::Template & __self_rename_at_15, char * const  __name_rename_at_15, char * const  __newName_rename_at_15 );
+inline void replaceVariable_77e4464b5879c283 ( Context * __context__, template_boost::Template & __self_rename_at_12, char * const  __name_rename_at_12, smart_ptr_raw<Expression> __expr_rename_at_12 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_835d8f183dc109ba ( Context * __context__, template_boost::TemplateVisitor const  & __cl_rename_at_88 );
+inline smart_ptr_raw<ExprBlock> unquote_block_f79808eb0ce16b23 ( Context * __context__, smart_ptr_raw<Expression> const  __expr_rename_at_40 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline template_boost::TemplateVisitor TemplateVisitor_1d1fef74a7d45885 ( Context * __context__ )
+{
+	return das_auto_cast<template_boost::TemplateVisitor>::cast((([&]() -> template_boost::TemplateVisitor {
+		template_boost::TemplateVisitor __mks_18;
+		das_zero(__mks_18);
+		das_copy((__mks_18.__rtti),(((void *)(&__type_info__391e819b))));
+		das_copy((__mks_18.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@template_boost::TemplateVisitor'__finalize TemplateVisitor*/ 995303208u)))));
+		das_copy((__mks_18.visitExprVar),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@template_boost::TemplateVisitor`visitExprVar TemplateVisitor #smart_ptr##handle#ExprVar#const*/ 96569944u)))));
+		return __mks_18;
+	})()));
+}
+
+inline template_boost::TemplateVisitor TemplateVisitor_d27540fb2b2a7514 ( Context * __context__, template_boost::Template * const  __r_rename_at_20 )
+{
+	template_boost::TemplateVisitor __self_rename_at_20; das_zero(__self_rename_at_20); das_move(__self_rename_at_20, (([&]() -> template_boost::TemplateVisitor {
+		template_boost::TemplateVisitor __mks_20;
+		das_zero(__mks_20);
+		das_copy((__mks_20.__rtti),(((void *)(&__type_info__391e819b))));
+		das_copy((__mks_20.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstVisitor))>::cast(Func(__context__->fnIdxByMangledName(/*@template_boost::TemplateVisitor'__finalize TemplateVisitor*/ 995303208u)))));
+		das_copy((__mks_20.visitExprVar),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstVisitor,smart_ptr_raw<ExprVar> const ))>::cast(Func(__context__->fnIdxByMangledName(/*@template_boost::TemplateVisitor`visitExprVar TemplateVisitor #smart_ptr##handle#ExprVar#const*/ 96569944u)))));
+		return __mks_20;
+	})()));
+	_FuncTemplateVisitor_0x60_TemplateVisitor_af7d2b3f12360f38(__context__,das_arg<template_boost::TemplateVisitor>::pass(__self_rename_at_20),__r_rename_at_20);
+	return /* <- */ das_auto_cast<template_boost::TemplateVisitor>::cast(__self_rename_at_20);
+}
+
+inline void _FuncTemplateVisitor_0x27___finalize_ced51cb73a64f548 ( Context * __context__, template_boost::TemplateVisitor &  __self_rename_at_18 )
+{
+	finalize_ac96a0550b621b23(__context__,das_arg<template_boost::TemplateVisitor>::pass(__self_rename_at_18));
+}
+
+inline void _FuncTemplateVisitor_0x60_TemplateVisitor_af7d2b3f12360f38 ( Context * __context__, template_boost::TemplateVisitor &  __self_rename_at_20, template_boost::Template * const  __r_rename_at_20 )
+{
+	das_copy(__self_rename_at_20.rules,__r_rename_at_20);
+}
+
+inline smart_ptr_raw<Expression> _FuncTemplateVisitor_0x60_visitExprVar_a0cebc6d23e2365a ( Context * __context__, template_boost::TemplateVisitor &  __self_rename_at_22, smart_ptr_raw<ExprVar> const  __expr_rename_at_22 )
+{
+	char * __vn_rename_at_23 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<das::string const  &>::from(__expr_rename_at_22->name /*name*/)))));
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(_Funcbuiltin_0x60_key_exists_4f6d739aa79d7024(__context__,das_arg<TTable<char *,smart_ptr_raw<Expression>>>::pass(__self_rename_at_22.rules->var2expr),__vn_rename_at_23) ? das_auto_cast<smart_ptr<Expression>>::cast(clone_expression(__self_rename_at_22.rules->var2expr(__vn_rename_at_23,__context__))) : das_auto_cast<smart_ptr<Expression>>::cast(__expr_rename_at_22));
+}
+
+inline void add_global_let_847eb40debbf6e67 ( Context * __context__, Module * const  __mod_rename_at_64, char * const  __vname_rename_at_64, LineInfo const  &  __vat_rename_at_64, smart_ptr_raw<Expression> __value_rename_at_64 )
+{
+	add_global_var_any_8228646b54a5be47(__context__,__mod_rename_at_64,__vname_rename_at_64,__vat_rename_at_64,0x2u,__value_rename_at_64);
+}
+
+inline void add_global_var_9b7fc96193024d25 ( Context * __context__, Module * const  __mod_rename_at_61, char * const  __vname_rename_at_61, LineInfo const  &  __vat_rename_at_61, smart_ptr_raw<Expression> __value_rename_at_61 )
+{
+	add_global_var_any_8228646b54a5be47(__context__,__mod_rename_at_61,__vname_rename_at_61,__vat_rename_at_61,0x20u,__value_rename_at_61);
+}
+
+inline void add_global_var_any_8228646b54a5be47 ( Context * __context__, Module * const  __mod_rename_at_48, char * const  __vname_rename_at_48, LineInfo const  &  __vat_rename_at_48, Bitfield __vflag_rename_at_48, smart_ptr_raw<Expression> __value_rename_at_48 ) { das_stack_prologue __prologue(__context__,144,"add_global_var_any " DAS_FILE_LINE);
+{
+	smart_ptr_raw<Variable> __vvar_rename_at_49; das_zero(__vvar_rename_at_49); das_move(__vvar_rename_at_49, das_ascend_handle<true,smart_ptr_raw<Variable>>::make(__context__,nullptr,(([&](Variable & __mks_49) {
+		das_copy((__mks_49.at /*at*/),(__vat_rename_at_48));
+		das_move((__mks_49.type /*_type*/),(das_ascend_handle<true,smart_ptr_raw<TypeDecl>>::make(__context__,nullptr,(([&](TypeDecl & __mks_51) {
+			das_copy((__mks_51.at /*at*/),(__vat_rename_at_48));
+			das_copy((__mks_51.baseType /*baseType*/),(DAS_COMMENT(bound_enum) das::Type::autoinfer));
+			das_copy((__mks_51.flags /*flags*/),(__vflag_rename_at_48));
+		})))));
+		das_move((__mks_49.init /*init*/),(__value_rename_at_48));
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_49.name /*name*/),__vname_rename_at_48);
+		}	}))));
+	if ( !addModuleVariable(__mod_rename_at_48,__vvar_rename_at_49,__context__) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "can't add global variable ")), cast<char * const >::from(__vname_rename_at_48))),__context__);
+	};
+	clone_14432ab28f95d994(__context__,__vvar_rename_at_49,nullptr);
+}}
+
+inline void apply_template_9895a1e22ae53dcf ( Context * __context__, template_boost::Template &  __rules_rename_at_28, LineInfo const  &  __at_rename_at_28, smart_ptr_raw<Expression> __expr_rename_at_28 )
+{
+	template_boost::Template * __prules_rename_at_29 = 0;
+	das_copy(__prules_rename_at_29,das_ref(__context__,__rules_rename_at_28));
+	template_boost::TemplateVisitor * __astVisitor_rename_at_32 = das_new<template_boost::TemplateVisitor>::make_and_init(__context__,[&]() { return TemplateVisitor_d27540fb2b2a7514(__context__,__prules_rename_at_29); });
+	smart_ptr_raw<VisitorAdapter> __astVisitorAdapter_rename_at_33; das_zero(__astVisitorAdapter_rename_at_33); das_move(__astVisitorAdapter_rename_at_33, _Funcast_0x60_make_visitor_b407d4f5ccd3dd25(__context__,das_arg<template_boost::TemplateVisitor>::pass(das_deref(__context__,__astVisitor_rename_at_32))));
+	astVisitExpression(__expr_rename_at_28,__astVisitorAdapter_rename_at_33);
+	forceAtRaw(__expr_rename_at_28,__at_rename_at_28);
+	das_delete_handle<smart_ptr_raw<VisitorAdapter>>::clear(__context__,__astVisitorAdapter_rename_at_33);
+	finalize_f974ea6838672e3e(__context__,__astVisitor_rename_at_32);
+}
+
+inline smart_ptr_raw<Expression> _Funcast_0x60_ExpressionPtr_e1088b54d5fb2754 ( Context * __context__, smart_ptr_raw<ExprVar> const  __expr_rename_at_39 )
+{
+	return das_auto_cast<smart_ptr_raw<Expression>>::cast(das_cast<smart_ptr_raw<Expression>>::cast(__expr_rename_at_39));
+}
+
+inline smart_ptr_raw<VisitorAdapter> _Funcast_0x60_make_visitor_b407d4f5ccd3dd25 ( Context * __context__, template_boost::TemplateVisitor const  &  __someClass_rename_at_463 )
+{
+	template_boost::TemplateVisitor const  * __classPtr_rename_at_466 = ((template_boost::TemplateVisitor const  *)das_ref(__context__,__someClass_rename_at_463));
+	StructInfo const  * __classInfo_rename_at_467 = ((StructInfo const  *)das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__someClass_rename_at_463.__rtti)->structType /*structType*/));
+	return das_auto_cast<smart_ptr_raw<VisitorAdapter>>::cast(makeVisitor(das_auto_cast<void * const >::cast(__classPtr_rename_at_466),__classInfo_rename_at_467,__context__));
+}
+
+inline smart_ptr<Expression> _Funcbuiltin_0x60_clone_to_move_999c54242e80d01d ( Context * __context__, smart_ptr<Expression> const  __clone_src_rename_at_131 )
+{
+	smart_ptr<Expression> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_5587e1b0c7901e78(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr<Expression>>::cast(__clone_dest_rename_at_132);
+}
+
+inline void _Funcbuiltin_0x60_finalize_41ed4af8b23eff9 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> &  __a_rename_at_193 )
+{
+	Sequence DAS_COMMENT((smart_ptr_raw<Expression> *)) _temp_make_local_195_32;
+	{
+		bool __need_loop_195 = true;
+		// aV : smart_ptr<ast::Expression>&
+		das_iterator<Sequence DAS_COMMENT((smart_ptr_raw<Expression>))> __aV_iterator((_temp_make_local_195_32 = (_Funcbuiltin_0x60_values_d0687d23d602ec29(__context__,das_arg<TTable<char *,smart_ptr_raw<Expression>>>::pass(__a_rename_at_193)))));
+		smart_ptr_raw<Expression> * __aV_rename_at_195;
+		__need_loop_195 = __aV_iterator.first(__context__,(__aV_rename_at_195)) && __need_loop_195;
+		for ( ; __need_loop_195 ; __need_loop_195 = __aV_iterator.next(__context__,(__aV_rename_at_195)) )
+		{
+			das_delete_handle<smart_ptr_raw<Expression>>::clear(__context__,(*__aV_rename_at_195));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_195));
+	};
+	builtin_table_free(das_arg<TTable<char *,smart_ptr_raw<Expression>>>::pass(__a_rename_at_193),8,8,__context__);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_4f6d739aa79d7024 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> const  &  __Tab_rename_at_120, char * const  __at_rename_at_120 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_120,__at_rename_at_120));
+}
+
+inline Sequence DAS_COMMENT((smart_ptr_raw<Expression> &)) _Funcbuiltin_0x60_values_d0687d23d602ec29 ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> &  __a_rename_at_173 )
+{
+	Sequence DAS_COMMENT((smart_ptr_raw<Expression> *)) __it_rename_at_174; das_zero(__it_rename_at_174);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((smart_ptr_raw<Expression>))>::pass(__it_rename_at_174),das_arg<TTable<char *,smart_ptr_raw<Expression>>>::pass(__a_rename_at_173),8,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((smart_ptr_raw<Expression> &))>::cast(__it_rename_at_174);
+}
+
+inline void clone_5587e1b0c7901e78 ( Context * __context__, smart_ptr<Expression> & __dest_rename_at_133, smart_ptr<Expression> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void clone_14432ab28f95d994 ( Context * __context__, smart_ptr_raw<Variable> & __dest_rename_at_59, void * const  __src_rename_at_59 )
+{
+	builtin_smart_ptr_clone_ptr(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_59),__src_rename_at_59);
+}
+
+inline void finalize_2c937931ae829422 ( Context * __context__, template_boost::Template * & ____this_rename_at_19 )
+{
+	if ( ____this_rename_at_19 != nullptr )
+	{
+		finalize_31bf7d379f8a2e73(__context__,das_arg<template_boost::Template>::pass(das_deref(__context__,____this_rename_at_19)));
+		das_delete<template_boost::Template *>::clear(__context__,____this_rename_at_19);
+		das_copy(____this_rename_at_19,nullptr);
+	};
+}
+
+inline void finalize_f974ea6838672e3e ( Context * __context__, template_boost::TemplateVisitor * & ____this_rename_at_38 )
+{
+	if ( ____this_rename_at_38 != nullptr )
+	{
+		das_invoke_function<void>::invoke<ast::AstVisitor &>(__context__,____this_rename_at_38->__finalize,das_arg<ast::AstVisitor>::pass(das_cast<ast::AstVisitor>::cast(das_deref(__context__,____this_rename_at_38))));
+		das_delete<template_boost::TemplateVisitor *>::clear(__context__,____this_rename_at_38);
+		das_copy(____this_rename_at_38,nullptr);
+	};
+}
+
+inline void finalize_31bf7d379f8a2e73 ( Context * __context__, template_boost::Template &  ____this_rename_at_9 )
+{
+	_Funcbuiltin_0x60_finalize_41ed4af8b23eff9(__context__,das_arg<TTable<char *,smart_ptr_raw<Expression>>>::pass(____this_rename_at_9.var2expr));
+	memset(&(____this_rename_at_9), 0, 48);
+}
+
+inline void finalize_ac96a0550b621b23 ( Context * __context__, template_boost::TemplateVisitor &  ____this_rename_at_18 )
+{
+	finalize_2c937931ae829422(__context__,____this_rename_at_18.rules);
+	memset(&(____this_rename_at_18), 0, 1104);
+}
+
+inline void renameVariable_86cce993c3fa474f ( Context * __context__, template_boost::Template &  __self_rename_at_15, char * const  __name_rename_at_15, char * const  __newName_rename_at_15 ) { das_stack_prologue __prologue(__context__,112,"renameVariable " DAS_FILE_LINE);
+{
+	replaceVariable_77e4464b5879c283(__context__,das_arg<template_boost::Template>::pass(__self_rename_at_15),__name_rename_at_15,_Funcast_0x60_ExpressionPtr_e1088b54d5fb2754(__context__,das_ascend_handle<true,smart_ptr_raw<ExprVar>>::make(__context__,nullptr,(([&](ExprVar & __mks_16) {
+		{
+			set_das_string(das_arg<das::string>::pass(__mks_16.name /*name*/),__newName_rename_at_15);
+		}	})))));
+}}
+
+inline void replaceVariable_77e4464b5879c283 ( Context * __context__, template_boost::Template &  __self_rename_at_12, char * const  __name_rename_at_12, smart_ptr_raw<Expression> __expr_rename_at_12 )
+{
+	das_move(__self_rename_at_12.var2expr(__name_rename_at_12,__context__),__expr_rename_at_12);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_835d8f183dc109ba ( Context * __context__, template_boost::TemplateVisitor const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+
+inline smart_ptr_raw<ExprBlock> unquote_block_f79808eb0ce16b23 ( Context * __context__, smart_ptr_raw<Expression> const  __expr_rename_at_40 )
+{
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__expr_rename_at_40->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprMakeBlock")),*__context__)));
+	smart_ptr_raw<ExprMakeBlock> __mkb_rename_at_43; das_zero(__mkb_rename_at_43); das_move(__mkb_rename_at_43, das_cast<smart_ptr_raw<ExprMakeBlock>>::cast(__expr_rename_at_40));
+	smart_ptr<Expression> __blk_rename_at_44; das_zero(__blk_rename_at_44); das_move(__blk_rename_at_44, _Funcbuiltin_0x60_clone_to_move_999c54242e80d01d(__context__,__mkb_rename_at_43->block /*_block*/));
+	return das_auto_cast<smart_ptr_raw<ExprBlock>>::cast(das_cast<smart_ptr_raw<ExprBlock>>::cast(__blk_rename_at_44));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// TemplateVisitor_1d1fef74a7d45885
+		aotLib[0x3ea3fdbf43aea562] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<template_boost::TemplateVisitor (*) ( Context * __context__ ),&TemplateVisitor_1d1fef74a7d45885>>();
+	};
+		// TemplateVisitor_d27540fb2b2a7514
+		aotLib[0x83bd931ad5ef80a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<template_boost::TemplateVisitor (*) ( Context * __context__, template_boost::Template * const   ),&TemplateVisitor_d27540fb2b2a7514>>();
+	};
+		// _FuncTemplateVisitor_0x27___finalize_ced51cb73a64f548
+		aotLib[0x850a737c78c38d10] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::TemplateVisitor &  ),&_FuncTemplateVisitor_0x27___finalize_ced51cb73a64f548>>();
+	};
+		// _FuncTemplateVisitor_0x60_TemplateVisitor_af7d2b3f12360f38
+		aotLib[0x22a8b2c2f11f624d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::TemplateVisitor & , template_boost::Template * const   ),&_FuncTemplateVisitor_0x60_TemplateVisitor_af7d2b3f12360f38>>();
+	};
+		// _FuncTemplateVisitor_0x60_visitExprVar_a0cebc6d23e2365a
+		aotLib[0x540629e33cdd8e52] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, template_boost::TemplateVisitor & , smart_ptr_raw<ExprVar> const   ),&_FuncTemplateVisitor_0x60_visitExprVar_a0cebc6d23e2365a>>();
+	};
+		// add_global_let_847eb40debbf6e67
+		aotLib[0x864439b28139549c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const  , char * const  , LineInfo const  & , smart_ptr_raw<Expression>  ),&add_global_let_847eb40debbf6e67>>();
+	};
+		// add_global_var_9b7fc96193024d25
+		aotLib[0x907f5275bc342dfc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const  , char * const  , LineInfo const  & , smart_ptr_raw<Expression>  ),&add_global_var_9b7fc96193024d25>>();
+	};
+		// add_global_var_any_8228646b54a5be47
+		aotLib[0x5aef567c8c142b91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const  , char * const  , LineInfo const  & , Bitfield , smart_ptr_raw<Expression>  ),&add_global_var_any_8228646b54a5be47>>();
+	};
+		// apply_template_9895a1e22ae53dcf
+		aotLib[0x2334aa182084b8d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::Template & , LineInfo const  & , smart_ptr_raw<Expression>  ),&apply_template_9895a1e22ae53dcf>>();
+	};
+		// _Funcast_0x60_ExpressionPtr_e1088b54d5fb2754
+		aotLib[0x206b8ff9dbd193bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, smart_ptr_raw<ExprVar> const   ),&_Funcast_0x60_ExpressionPtr_e1088b54d5fb2754>>();
+	};
+		// _Funcast_0x60_make_visitor_b407d4f5ccd3dd25
+		aotLib[0xcf67fb29e2e2db75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<VisitorAdapter> (*) ( Context * __context__, template_boost::TemplateVisitor const  &  ),&_Funcast_0x60_make_visitor_b407d4f5ccd3dd25>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_999c54242e80d01d
+		aotLib[0x972fdab600b96299] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr<Expression> (*) ( Context * __context__, smart_ptr<Expression> const   ),&_Funcbuiltin_0x60_clone_to_move_999c54242e80d01d>>();
+	};
+		// _Funcbuiltin_0x60_finalize_41ed4af8b23eff9
+		aotLib[0x6916ad88a1ca17bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> &  ),&_Funcbuiltin_0x60_finalize_41ed4af8b23eff9>>();
+	};
+		// _Funcbuiltin_0x60_key_exists_4f6d739aa79d7024
+		aotLib[0x8e61afae72a1ee59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> const  & , char * const   ),&_Funcbuiltin_0x60_key_exists_4f6d739aa79d7024>>();
+	};
+		// _Funcbuiltin_0x60_values_d0687d23d602ec29
+		aotLib[0x721506bde3211fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((smart_ptr_raw<Expression> &)) (*) ( Context * __context__, TTable<char *,smart_ptr_raw<Expression>> &  ),&_Funcbuiltin_0x60_values_d0687d23d602ec29>>();
+	};
+		// clone_5587e1b0c7901e78
+		aotLib[0x2d52cadfc11a069d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr<Expression> & , smart_ptr<Expression> const   ),&clone_5587e1b0c7901e78>>();
+	};
+		// clone_14432ab28f95d994
+		aotLib[0x30cd0560b18d8b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<Variable> & , void * const   ),&clone_14432ab28f95d994>>();
+	};
+		// finalize_2c937931ae829422
+		aotLib[0x49e96df84c51e34d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::Template * &  ),&finalize_2c937931ae829422>>();
+	};
+		// finalize_f974ea6838672e3e
+		aotLib[0x3527d70e7ce97719] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::TemplateVisitor * &  ),&finalize_f974ea6838672e3e>>();
+	};
+		// finalize_31bf7d379f8a2e73
+		aotLib[0xe63f2281ad232697] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::Template &  ),&finalize_31bf7d379f8a2e73>>();
+	};
+		// finalize_ac96a0550b621b23
+		aotLib[0xdaeee2753cdaeb62] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::TemplateVisitor &  ),&finalize_ac96a0550b621b23>>();
+	};
+		// renameVariable_86cce993c3fa474f
+		aotLib[0x2731df6ec9ef1da] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::Template & , char * const  , char * const   ),&renameVariable_86cce993c3fa474f>>();
+	};
+		// replaceVariable_77e4464b5879c283
+		aotLib[0xf426629480543505] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, template_boost::Template & , char * const  , smart_ptr_raw<Expression>  ),&replaceVariable_77e4464b5879c283>>();
+	};
+		// _Funcrtti_0x60_class_info_835d8f183dc109ba
+		aotLib[0x165de242ba4e2c25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, template_boost::TemplateVisitor const  &  ),&_Funcrtti_0x60_class_info_835d8f183dc109ba>>();
+	};
+		// unquote_block_f79808eb0ce16b23
+		aotLib[0xb4201bec4d49e781] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprBlock> (*) ( Context * __context__, smart_ptr_raw<Expression> const   ),&unquote_block_f79808eb0ce16b23>>();
+	};
+		// [[ init script ]]
+		aotLib[0x129f131b628475f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,653 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require tpt
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require PathTracerHelper
+#include "path_tracer_helper.h"
+ // require random
+#include "daScript/simulate/aot_builtin_random.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace tpt {
+
+enum class Type : int32_t {
+	Lambert = int32_t(0),
+	Metal = int32_t(1),
+	Dielectric = int32_t(2),
+};
+}
+}
+template <> struct cast< tpt::Type > : cast_enum < tpt::Type > {};
+namespace {
+namespace tpt {
+
+struct Sphere {
+	float3 center;
+	float radius;
+	float radius2;
+	float iRadius;
+	float pad1;
+	float pad2;
+};
+static_assert(sizeof(Sphere)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Sphere,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,radius)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,radius2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,iRadius)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,pad1)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,pad2)==28,"structure field offset mismatch with DAS");
+}
+namespace tpt {
+
+struct Ray {
+	float3 orig;
+	float pad1;
+	float3 dir;
+	float pad2;
+};
+static_assert(sizeof(Ray)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Ray,orig)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,pad1)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,dir)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,pad2)==28,"structure field offset mismatch with DAS");
+}
+namespace tpt {
+
+struct Hit {
+	float3 pos;
+	float pad;
+	float3 normal;
+	float t;
+};
+static_assert(sizeof(Hit)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Hit,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,pad)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,normal)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,t)==28,"structure field offset mismatch with DAS");
+}
+namespace tpt {
+
+struct Camera {
+	float3 origin;
+	float3 lowerLeftCorner;
+	float3 horizontal;
+	float3 vertical;
+	float3 u;
+	float3 v;
+	float3 w;
+	float lensRadius;
+};
+static_assert(sizeof(Camera)==88,"structure size mismatch with DAS");
+static_assert(offsetof(Camera,origin)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,lowerLeftCorner)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,horizontal)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,vertical)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,u)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,v)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,w)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,lensRadius)==84,"structure field offset mismatch with DAS");
+}
+namespace tpt {
+
+struct Material {
+	DAS_COMMENT(enum) tpt::Type mtype;
+	float3 albedo;
+	float3 emissive;
+	float roughness;
+	float ri;
+};
+static_assert(sizeof(Material)==36,"structure size mismatch with DAS");
+static_assert(offsetof(Material,mtype)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,albedo)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,emissive)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,roughness)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,ri)==32,"structure field offset mismatch with DAS");
+}
+
+inline tpt::Camera Camera_1c96edf0c60a714e ( Context * __context__, float3 __lookFrom_rename_at_58, float3 __lookAt_rename_at_58, float3 __vup_rename_at_58, float __vfov_rename_at_58, float __aspect_rename_at_58, float __aperture_rename_at_58, float __focusDist_rename_at_58 );
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void draw_7db8214042db57fd ( Context * __context__, int32_t __frameCount_rename_at_240, int32_t __screenWidth_rename_at_240, int32_t __screenHeight_rename_at_240, int32_t __ymin_rename_at_240, int32_t __ymax_rename_at_240, TArray<float3> & __backbuffer_rename_at_240, int32_t & __outRayCount_rename_at_240 );
+inline tpt::Ray getRay_68bef54fd0785344 ( Context * __context__, tpt::Camera const  & __that_rename_at_73, float __s_rename_at_73, float __t_rename_at_73 );
+inline int32_t hitSpheres_3bb6896717289b63 ( Context * __context__, tpt::Ray const  & __r_rename_at_120, float __tMin_rename_at_120, float __tMax_rename_at_120, tpt::Hit & __outHit_rename_at_120 );
+inline bool hitWorld_d95c069c72243920 ( Context * __context__, tpt::Ray const  & __r_rename_at_144, float __tMin_rename_at_144, float __tMax_rename_at_144, tpt::Hit & __outHit_rename_at_144, int32_t & __outID_rename_at_144 );
+inline int32_t job_ec133864ccb70ac5 ( Context * __context__, TArray<float3> & __backbuffer_rename_at_256, int32_t __frameCount_rename_at_256, int32_t __width_rename_at_256, int32_t __height_rename_at_256, int32_t __ymin_rename_at_256, int32_t __ymax_rename_at_256 );
+inline float3 pointAt_347d17d6cf06e664 ( Context * __context__, tpt::Ray const  & __ray_rename_at_41, float __t_rename_at_41 );
+inline void prepare_2f5bebefc4cabf6b ( Context * __context__ );
+inline bool scatter_334a5501fde24d03 ( Context * __context__, tpt::Material const  & __mat_rename_at_148, tpt::Ray const  & __r_in_rename_at_148, tpt::Hit const  & __rec_rename_at_148, float3 & __attenuation_rename_at_148, tpt::Ray & __scattered_rename_at_148, float3 & __outLightE_rename_at_148, int32_t & __inoutRayCount_rename_at_148 );
+inline float schlick_72e850179a55e12c ( Context * __context__, float __cosine_rename_at_24, float __ri_rename_at_24 );
+inline bool test_954c01124c52703b ( Context * __context__ );
+inline float3 trace_fba546e7a90c9bd3 ( Context * __context__, tpt::Ray const  & __r_rename_at_202, int32_t __depth_rename_at_202, int32_t & __inoutRayCount_rename_at_202, bool __doMaterialE_rename_at_202 );
+inline int32_t trace_a9e3bf8b9004c9cc ( Context * __context__, int32_t __screenWidth_rename_at_223, int32_t __screenHeight_rename_at_223, int32_t __frameCount_rename_at_223, int32_t __ymin_rename_at_223, int32_t __ymax_rename_at_223, TArray<float3> & __backbuffer_rename_at_223, tpt::Camera const  & __cam_rename_at_223 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<int4,0xef6a018b>(__context__);/*RAND_SEED*/
+	das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) = (([&]() -> TDim<tpt::Sphere,9> {
+		TDim<tpt::Sphere,9> __mks_95;
+		das_zero(__mks_95);
+		das_copy((__mks_95(0,__context__).center),(v_make_vec4f(0.f,-100.5f,-1.f,0.f)));
+		das_copy((__mks_95(0,__context__).radius),(100.f));
+		das_copy((__mks_95(1,__context__).center),(v_make_vec4f(2.f,0.f,-1.f,0.f)));
+		das_copy((__mks_95(1,__context__).radius),(0.5f));
+		das_copy((__mks_95(2,__context__).center),(v_make_vec4f(0.f,0.f,-1.f,0.f)));
+		das_copy((__mks_95(2,__context__).radius),(0.5f));
+		das_copy((__mks_95(3,__context__).center),(v_make_vec4f(-2.f,0.f,-1.f,0.f)));
+		das_copy((__mks_95(3,__context__).radius),(0.5f));
+		das_copy((__mks_95(4,__context__).center),(v_make_vec4f(2.f,0.f,1.f,0.f)));
+		das_copy((__mks_95(4,__context__).radius),(0.5f));
+		das_copy((__mks_95(5,__context__).center),(v_make_vec4f(0.f,0.f,1.f,0.f)));
+		das_copy((__mks_95(5,__context__).radius),(0.5f));
+		das_copy((__mks_95(6,__context__).center),(v_make_vec4f(-2.f,0.f,1.f,0.f)));
+		das_copy((__mks_95(6,__context__).radius),(0.5f));
+		das_copy((__mks_95(7,__context__).center),(v_make_vec4f(0.5f,1.f,0.5f,0.f)));
+		das_copy((__mks_95(7,__context__).radius),(0.5f));
+		das_copy((__mks_95(8,__context__).center),(v_make_vec4f(-1.5f,1.5f,0.f,0.f)));
+		das_copy((__mks_95(8,__context__).radius),(0.300000012f));
+		return __mks_95;
+	})());/*s_Spheres*/
+	das_global<TDim<tpt::Material,9>,0x6a1d2790>(__context__) = (([&]() -> TDim<tpt::Material,9> {
+		TDim<tpt::Material,9> __mks_108;
+		das_copy((__mks_108(0,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Lambert));
+		das_copy((__mks_108(0,__context__).albedo),(v_splats(0.800000012f)));
+		das_copy((__mks_108(0,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(0,__context__).roughness),(0.f));
+		das_copy((__mks_108(0,__context__).ri),(0.f));
+		das_copy((__mks_108(1,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Lambert));
+		das_copy((__mks_108(1,__context__).albedo),(v_make_vec4f(0.800000012f,0.400000006f,0.400000006f,0.f)));
+		das_copy((__mks_108(1,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(1,__context__).roughness),(0.f));
+		das_copy((__mks_108(1,__context__).ri),(0.f));
+		das_copy((__mks_108(2,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Lambert));
+		das_copy((__mks_108(2,__context__).albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_108(2,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(2,__context__).roughness),(0.f));
+		das_copy((__mks_108(2,__context__).ri),(0.f));
+		das_copy((__mks_108(3,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Metal));
+		das_copy((__mks_108(3,__context__).albedo),(v_make_vec4f(0.400000006f,0.400000006f,0.800000012f,0.f)));
+		das_copy((__mks_108(3,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(3,__context__).roughness),(0.f));
+		das_copy((__mks_108(3,__context__).ri),(0.f));
+		das_copy((__mks_108(4,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Metal));
+		das_copy((__mks_108(4,__context__).albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_108(4,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(4,__context__).roughness),(0.f));
+		das_copy((__mks_108(4,__context__).ri),(0.f));
+		das_copy((__mks_108(5,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Metal));
+		das_copy((__mks_108(5,__context__).albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_108(5,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(5,__context__).roughness),(0.200000003f));
+		das_copy((__mks_108(5,__context__).ri),(0.f));
+		das_copy((__mks_108(6,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Metal));
+		das_copy((__mks_108(6,__context__).albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_108(6,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(6,__context__).roughness),(0.600000024f));
+		das_copy((__mks_108(6,__context__).ri),(0.f));
+		das_copy((__mks_108(7,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Dielectric));
+		das_copy((__mks_108(7,__context__).albedo),(v_splats(0.400000006f)));
+		das_copy((__mks_108(7,__context__).emissive),(v_zero()));
+		das_copy((__mks_108(7,__context__).roughness),(0.f));
+		das_copy((__mks_108(7,__context__).ri),(1.5f));
+		das_copy((__mks_108(8,__context__).mtype),(DAS_COMMENT(enum) tpt::Type::Lambert));
+		das_copy((__mks_108(8,__context__).albedo),(v_make_vec4f(0.800000012f,0.600000024f,0.200000003f,0.f)));
+		das_copy((__mks_108(8,__context__).emissive),(v_make_vec4f(30.f,25.f,15.f,0.f)));
+		das_copy((__mks_108(8,__context__).roughness),(0.f));
+		das_copy((__mks_108(8,__context__).ri),(0.f));
+		return __mks_108;
+	})());/*s_SphereMats*/
+}
+
+inline tpt::Camera Camera_1c96edf0c60a714e ( Context * __context__, float3 __lookFrom_rename_at_58, float3 __lookAt_rename_at_58, float3 __vup_rename_at_58, float __vfov_rename_at_58, float __aspect_rename_at_58, float __aperture_rename_at_58, float __focusDist_rename_at_58 )
+{
+	tpt::Camera __that_rename_at_59; das_zero(__that_rename_at_59);
+	das_copy(__that_rename_at_59.lensRadius,SimPolicy<float>::Div(__aperture_rename_at_58,2.f,*__context__));
+	float __theta_rename_at_61 = ((float)(SimPolicy<float>::Div((__vfov_rename_at_58 * 3.14159274f),180.f,*__context__)));
+	float __halfHeight_rename_at_62 = ((float)SimPolicy<float>::Tan(SimPolicy<float>::Div(__theta_rename_at_61,2.f,*__context__),*__context__));
+	float __halfWidth_rename_at_63 = ((float)(__aspect_rename_at_58 * __halfHeight_rename_at_62));
+	das_copy(__that_rename_at_59.origin,__lookFrom_rename_at_58);
+	das_copy(__that_rename_at_59.w,safe_normalize3(SimPolicy<float3>::Sub(__lookFrom_rename_at_58,__lookAt_rename_at_58,*__context__)));
+	das_copy(__that_rename_at_59.u,safe_normalize3(cross3(__vup_rename_at_58,__that_rename_at_59.w)));
+	das_copy(__that_rename_at_59.v,cross3(__that_rename_at_59.w,__that_rename_at_59.u));
+	das_copy(__that_rename_at_59.lowerLeftCorner,SimPolicy<float3>::Sub((SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(__that_rename_at_59.origin,(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfWidth_rename_at_63 * __focusDist_rename_at_58)),__that_rename_at_59.u,*__context__)),*__context__)),(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfHeight_rename_at_62 * __focusDist_rename_at_58)),__that_rename_at_59.v,*__context__)),*__context__)),(SimPolicy<float3>::MulScalVec(cast<float>::from(__focusDist_rename_at_58),__that_rename_at_59.w,*__context__)),*__context__));
+	das_copy(__that_rename_at_59.horizontal,SimPolicy<float3>::MulScalVec(cast<float>::from(((2.f * __halfWidth_rename_at_63) * __focusDist_rename_at_58)),__that_rename_at_59.u,*__context__));
+	das_copy(__that_rename_at_59.vertical,SimPolicy<float3>::MulScalVec(cast<float>::from(((2.f * __halfHeight_rename_at_62) * __focusDist_rename_at_58)),__that_rename_at_59.v,*__context__));
+	return das_auto_cast<tpt::Camera>::cast(__that_rename_at_59);
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void draw_7db8214042db57fd ( Context * __context__, int32_t __frameCount_rename_at_240, int32_t __screenWidth_rename_at_240, int32_t __screenHeight_rename_at_240, int32_t __ymin_rename_at_240, int32_t __ymax_rename_at_240, TArray<float3> &  __backbuffer_rename_at_240, int32_t & __outRayCount_rename_at_240 )
+{
+	int32_t __rayCount_rename_at_241 = 0;
+	tpt::Camera __cam_rename_at_246_ConstRef = ((tpt::Camera)Camera_1c96edf0c60a714e(__context__,v_make_vec4f(0.f,2.f,3.f,0.f),v_zero(),v_make_vec4f(0.f,1.f,0.f,0.f),60.f,SimPolicy<float>::Div(float(__screenWidth_rename_at_240),float(__screenHeight_rename_at_240),*__context__),0.100000001f,3.f));
+	tpt::Camera const  & __cam_rename_at_246 = __cam_rename_at_246_ConstRef; ;
+	__rayCount_rename_at_241 += trace_a9e3bf8b9004c9cc(__context__,__screenWidth_rename_at_240,__screenHeight_rename_at_240,__frameCount_rename_at_240,__ymin_rename_at_240,__ymax_rename_at_240,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_240),__cam_rename_at_246);
+	das_copy(__outRayCount_rename_at_240,__rayCount_rename_at_241);
+}
+
+inline tpt::Ray getRay_68bef54fd0785344 ( Context * __context__, tpt::Camera const  &  __that_rename_at_73, float __s_rename_at_73, float __t_rename_at_73 )
+{
+	float3 __rd_rename_at_74 = ((float3)(SimPolicy<float3>::MulScalVec(cast<float>::from(__that_rename_at_73.lensRadius),randomInUnitDisk(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/),*__context__)));
+	float3 __offset_rename_at_75 = ((float3)SimPolicy<float3>::MadS(__that_rename_at_73.u,cast<float>::from(v_extract_x(__rd_rename_at_74) /*x*/),SimPolicy<float3>::MulVecScal(__that_rename_at_73.v,cast<float>::from(v_extract_y(__rd_rename_at_74) /*y*/),*__context__),*__context__));
+	return das_auto_cast<tpt::Ray>::cast((([&]() -> tpt::Ray {
+		tpt::Ray __mks_76;
+		das_zero(__mks_76);
+		das_copy((__mks_76.orig),((SimPolicy<float3>::Add(__that_rename_at_73.origin,__offset_rename_at_75,*__context__))));
+		das_copy((__mks_76.dir),(safe_normalize3(SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(SimPolicy<float3>::MadS(__that_rename_at_73.vertical,cast<float>::from(__t_rename_at_73),SimPolicy<float3>::MadS(__that_rename_at_73.horizontal,cast<float>::from(__s_rename_at_73),__that_rename_at_73.lowerLeftCorner,*__context__),*__context__),__that_rename_at_73.origin,*__context__)),__offset_rename_at_75,*__context__))));
+		return __mks_76;
+	})()));
+}
+
+inline int32_t hitSpheres_3bb6896717289b63 ( Context * __context__, tpt::Ray const  &  __r_rename_at_120, float __tMin_rename_at_120, float __tMax_rename_at_120, tpt::Hit &  __outHit_rename_at_120 )
+{
+	float __hitT_rename_at_121 = __tMax_rename_at_120;
+	int32_t __id_rename_at_122 = -1;
+	int32_t __i_rename_at_123 = 0;
+	{
+		bool __need_loop_124 = true;
+		// sph : tpt::Sphere&
+		das_iterator<TDim<tpt::Sphere,9>> __sph_iterator(das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) /*s_Spheres*/);
+		tpt::Sphere * __sph_rename_at_124;
+		__need_loop_124 = __sph_iterator.first(__context__,(__sph_rename_at_124)) && __need_loop_124;
+		for ( ; __need_loop_124 ; __need_loop_124 = __sph_iterator.next(__context__,(__sph_rename_at_124)) )
+		{
+			float3 __co_rename_at_125 = ((float3)(SimPolicy<float3>::Sub((*__sph_rename_at_124).center,__r_rename_at_120.orig,*__context__)));
+			float __nb_rename_at_126 = ((float)dot3(__co_rename_at_125,__r_rename_at_120.dir));
+			float __discr_rename_at_127 = ((float)SimPolicy<float>::Mad(__nb_rename_at_126,__nb_rename_at_126,(*__sph_rename_at_124).radius2 - lengthSq3(__co_rename_at_125),*__context__));
+			if ( __discr_rename_at_127 > 0.f )
+			{
+				float __discrSq_rename_at_129 = ((float)SimPolicy<float>::Sqrt(__discr_rename_at_127,*__context__));
+				float __t_rename_at_130 = (__nb_rename_at_126 - __discrSq_rename_at_129);
+				if ( __t_rename_at_130 <= __tMin_rename_at_120 )
+				{
+					das_copy(__t_rename_at_130,__nb_rename_at_126 + __discrSq_rename_at_129);
+				};
+				if ( (__t_rename_at_130 > __tMin_rename_at_120) && (__t_rename_at_130 < __hitT_rename_at_121) )
+				{
+					das_copy(__id_rename_at_122,__i_rename_at_123);
+					das_copy(__hitT_rename_at_121,__t_rename_at_130);
+				};
+			};
+			++__i_rename_at_123;
+		}
+		__sph_iterator.close(__context__,(__sph_rename_at_124));
+	};
+	if ( __id_rename_at_122 != -1 )
+	{
+		float3 __atPos_rename_at_138 = ((float3)pointAt_347d17d6cf06e664(__context__,__r_rename_at_120,__hitT_rename_at_121));
+		das_copy(__outHit_rename_at_120,(([&]() -> tpt::Hit {
+			tpt::Hit __mks_139;
+			das_zero(__mks_139);
+			das_copy((__mks_139.pos),(__atPos_rename_at_138));
+			das_copy((__mks_139.normal),((SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Sub(__atPos_rename_at_138,das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) /*s_Spheres*/(__id_rename_at_122,__context__).center,*__context__)),cast<float>::from(das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) /*s_Spheres*/(__id_rename_at_122,__context__).iRadius),*__context__))));
+			das_copy((__mks_139.t),(__hitT_rename_at_121));
+			return __mks_139;
+		})()));
+	};
+	return das_auto_cast<int32_t>::cast(__id_rename_at_122);
+}
+
+inline bool hitWorld_d95c069c72243920 ( Context * __context__, tpt::Ray const  &  __r_rename_at_144, float __tMin_rename_at_144, float __tMax_rename_at_144, tpt::Hit &  __outHit_rename_at_144, int32_t & __outID_rename_at_144 )
+{
+	das_copy(__outID_rename_at_144,hitSpheres_3bb6896717289b63(__context__,__r_rename_at_144,__tMin_rename_at_144,__tMax_rename_at_144,das_arg<tpt::Hit>::pass(__outHit_rename_at_144)));
+	return das_auto_cast<bool>::cast(__outID_rename_at_144 != -1);
+}
+
+inline int32_t job_ec133864ccb70ac5 ( Context * __context__, TArray<float3> &  __backbuffer_rename_at_256, int32_t __frameCount_rename_at_256, int32_t __width_rename_at_256, int32_t __height_rename_at_256, int32_t __ymin_rename_at_256, int32_t __ymax_rename_at_256 )
+{
+	prepare_2f5bebefc4cabf6b(__context__);
+	int32_t __totalRayCount_rename_at_258 = 0;
+	draw_7db8214042db57fd(__context__,__frameCount_rename_at_256,__width_rename_at_256,__height_rename_at_256,__ymin_rename_at_256,__ymax_rename_at_256,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_256),__totalRayCount_rename_at_258);
+	return das_auto_cast<int32_t>::cast(__totalRayCount_rename_at_258);
+}
+
+inline float3 pointAt_347d17d6cf06e664 ( Context * __context__, tpt::Ray const  &  __ray_rename_at_41, float __t_rename_at_41 )
+{
+	return das_auto_cast<float3>::cast(SimPolicy<float3>::Add(__ray_rename_at_41.orig,(SimPolicy<float3>::MulVecScal(__ray_rename_at_41.dir,cast<float>::from(__t_rename_at_41),*__context__)),*__context__));
+}
+
+inline void prepare_2f5bebefc4cabf6b ( Context * __context__ )
+{
+	{
+		bool __need_loop_251 = true;
+		// sph : tpt::Sphere&
+		das_iterator<TDim<tpt::Sphere,9>> __sph_iterator(das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) /*s_Spheres*/);
+		tpt::Sphere * __sph_rename_at_251;
+		__need_loop_251 = __sph_iterator.first(__context__,(__sph_rename_at_251)) && __need_loop_251;
+		for ( ; __need_loop_251 ; __need_loop_251 = __sph_iterator.next(__context__,(__sph_rename_at_251)) )
+		{
+			das_copy((*__sph_rename_at_251).radius2,(*__sph_rename_at_251).radius * (*__sph_rename_at_251).radius);
+			das_copy((*__sph_rename_at_251).iRadius,SimPolicy<float>::Div(1.f,(*__sph_rename_at_251).radius,*__context__));
+		}
+		__sph_iterator.close(__context__,(__sph_rename_at_251));
+	};
+}
+
+inline bool scatter_334a5501fde24d03 ( Context * __context__, tpt::Material const  &  __mat_rename_at_148, tpt::Ray const  &  __r_in_rename_at_148, tpt::Hit const  &  __rec_rename_at_148, float3 & __attenuation_rename_at_148, tpt::Ray &  __scattered_rename_at_148, float3 & __outLightE_rename_at_148, int32_t & __inoutRayCount_rename_at_148 )
+{
+	das_copy(__outLightE_rename_at_148,v_zero());
+	if ( __mat_rename_at_148.mtype == DAS_COMMENT(enum) tpt::Type::Lambert )
+	{
+		float3 __target_rename_at_151 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add(__rec_rename_at_148.pos,__rec_rename_at_148.normal,*__context__)),randomUnitVector(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/),*__context__)));
+		das_copy(__scattered_rename_at_148,(([&]() -> tpt::Ray {
+			tpt::Ray __mks_152;
+			das_zero(__mks_152);
+			das_copy((__mks_152.orig),(__rec_rename_at_148.pos));
+			das_copy((__mks_152.dir),(safe_normalize3(SimPolicy<float3>::Sub(__target_rename_at_151,__rec_rename_at_148.pos,*__context__))));
+			return __mks_152;
+		})()));
+		das_copy(__attenuation_rename_at_148,__mat_rename_at_148.albedo);
+		tpt::Sphere * __s_rename_at_154 = ((tpt::Sphere *)&(das_global<TDim<tpt::Sphere,9>,0x6da89b1e>(__context__) /*s_Spheres*/(8,__context__)));
+		float3 __sw_rename_at_155 = ((float3)safe_normalize3(SimPolicy<float3>::Sub((*__s_rename_at_154).center,__rec_rename_at_148.pos,*__context__)));
+		float3 __su_rename_at_156 = ((float3)safe_normalize3(cross3((SimPolicy<float>::Abs(v_extract_x(__sw_rename_at_155) /*x*/,*__context__) > 0.00999999978f) ? (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(0.f,1.f,0.f,0.f)) : (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(1.f,0.f,0.f,0.f)),__sw_rename_at_155)));
+		float3 __sv_rename_at_157 = ((float3)cross3(__sw_rename_at_155,__su_rename_at_156));
+		float __cosAMax_rename_at_158 = ((float)SimPolicy<float>::Sqrt(SimPolicy<float>::Sat(1.f - (((*__s_rename_at_154).radius * (*__s_rename_at_154).radius) * invdistanceSq3(__rec_rename_at_148.pos,(*__s_rename_at_154).center)),*__context__),*__context__));
+		float4 __eps_rename_at_159 = ((float4)randomFloat4(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/));
+		float __cosA_rename_at_160 = ((float)(SimPolicy<float>::Mad(v_extract_x(__eps_rename_at_159) /*x*/,__cosAMax_rename_at_158,1.f,*__context__) - v_extract_x(__eps_rename_at_159) /*x*/));
+		float __sinA_rename_at_161 = ((float)SimPolicy<float>::Sqrt(1.f - (__cosA_rename_at_160 * __cosA_rename_at_160),*__context__));
+		float __sinPhi_rename_at_162 = 0; float __cosPhi_rename_at_162 = 0;
+		sincosF(6.28318548f * v_extract_y(__eps_rename_at_159) /*y*/,__sinPhi_rename_at_162,__cosPhi_rename_at_162);
+		float3 __l_rename_at_164 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add((SimPolicy<float3>::MulVecScal(__su_rename_at_156,cast<float>::from((__cosPhi_rename_at_162 * __sinA_rename_at_161)),*__context__)),(SimPolicy<float3>::MulVecScal(__sv_rename_at_157,cast<float>::from((__sinPhi_rename_at_162 * __sinA_rename_at_161)),*__context__)),*__context__)),(SimPolicy<float3>::MulVecScal(__sw_rename_at_155,cast<float>::from(__cosA_rename_at_160),*__context__)),*__context__)));
+		tpt::Hit __lightHit_rename_at_165; das_zero(__lightHit_rename_at_165);
+		int32_t __hitID_rename_at_166 = 0;
+		++__inoutRayCount_rename_at_148;
+		tpt::Ray __ray_rename_at_168_ConstRef = ((tpt::Ray)(([&]() -> tpt::Ray {
+			tpt::Ray __mks_168;
+			das_zero(__mks_168);
+			das_copy((__mks_168.orig),(__rec_rename_at_148.pos));
+			das_copy((__mks_168.dir),(__l_rename_at_164));
+			return __mks_168;
+		})()));
+	tpt::Ray const  & __ray_rename_at_168 = __ray_rename_at_168_ConstRef; ;
+		if ( hitWorld_d95c069c72243920(__context__,__ray_rename_at_168,0.00100000005f,10000000.f,das_arg<tpt::Hit>::pass(__lightHit_rename_at_165),__hitID_rename_at_166) && (__hitID_rename_at_166 == 8) )
+		{
+			float3 __nl_rename_at_170 = ((float3)((dot3(__rec_rename_at_148.normal,__r_in_rename_at_148.dir) < 0.f) ? (vec4f)das_auto_cast<float3>::cast(__rec_rename_at_148.normal) : (vec4f)das_auto_cast<float3>::cast(SimPolicy<float3>::Unm(__rec_rename_at_148.normal,*__context__))));
+			SimPolicy<float3>::SetAdd((char *)&(__outLightE_rename_at_148),(SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Mul(__mat_rename_at_148.albedo,das_global<TDim<tpt::Material,9>,0x6a1d2790>(__context__) /*s_SphereMats*/(8,__context__).emissive,*__context__)),cast<float>::from((SimPolicy<float>::Sat(dot3(__l_rename_at_164,__nl_rename_at_170),*__context__) * SimPolicy<float>::Mad(-2.f,__cosAMax_rename_at_158,2.f,*__context__))),*__context__)),*__context__);
+		};
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __mat_rename_at_148.mtype == DAS_COMMENT(enum) tpt::Type::Metal )
+	{
+		float3 __refl_rename_at_174 = ((float3)reflect(__r_in_rename_at_148.dir,__rec_rename_at_148.normal));
+		das_copy(__scattered_rename_at_148,(([&]() -> tpt::Ray {
+			tpt::Ray __mks_175;
+			das_zero(__mks_175);
+			das_copy((__mks_175.orig),(__rec_rename_at_148.pos));
+			das_copy((__mks_175.dir),(safe_normalize3(SimPolicy<float3>::MadS(randomInUnitSphere(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/),cast<float>::from(__mat_rename_at_148.roughness),__refl_rename_at_174,*__context__))));
+			return __mks_175;
+		})()));
+		das_copy(__attenuation_rename_at_148,__mat_rename_at_148.albedo);
+		return das_auto_cast<bool>::cast(dot3(__scattered_rename_at_148.dir,__rec_rename_at_148.normal) > 0.f);
+	} else if ( __mat_rename_at_148.mtype == DAS_COMMENT(enum) tpt::Type::Dielectric )
+	{
+		das_copy(__attenuation_rename_at_148,v_splats(1.f));
+		float3 __refr_rename_at_180 = v_zero();
+		float __reflProb_rename_at_181 = 0;
+		if ( dot3(__r_in_rename_at_148.dir,__rec_rename_at_148.normal) > 0.f )
+		{
+			if ( refract(__r_in_rename_at_148.dir,SimPolicy<float3>::Unm(__rec_rename_at_148.normal,*__context__),__mat_rename_at_148.ri,__refr_rename_at_180) )
+			{
+				das_copy(__reflProb_rename_at_181,schlick_72e850179a55e12c(__context__,__mat_rename_at_148.ri * dot3(__r_in_rename_at_148.dir,__rec_rename_at_148.normal),__mat_rename_at_148.ri));
+			} else {
+				das_copy(__reflProb_rename_at_181,1.f);
+			};
+		} else {
+			if ( refract(__r_in_rename_at_148.dir,__rec_rename_at_148.normal,SimPolicy<float>::Div(1.f,__mat_rename_at_148.ri,*__context__),__refr_rename_at_180) )
+			{
+				das_copy(__reflProb_rename_at_181,schlick_72e850179a55e12c(__context__,-dot3(__r_in_rename_at_148.dir,__rec_rename_at_148.normal),__mat_rename_at_148.ri));
+			} else {
+				das_copy(__reflProb_rename_at_181,1.f);
+			};
+		};
+		if ( randomFloat(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/) < __reflProb_rename_at_181 )
+		{
+			das_copy(__scattered_rename_at_148,(([&]() -> tpt::Ray {
+				tpt::Ray __mks_193;
+				das_zero(__mks_193);
+				das_copy((__mks_193.orig),(__rec_rename_at_148.pos));
+				das_copy((__mks_193.dir),(safe_normalize3(reflect(__r_in_rename_at_148.dir,__rec_rename_at_148.normal))));
+				return __mks_193;
+			})()));
+		} else {
+			das_copy(__scattered_rename_at_148,(([&]() -> tpt::Ray {
+				tpt::Ray __mks_195;
+				das_zero(__mks_195);
+				das_copy((__mks_195.orig),(__rec_rename_at_148.pos));
+				das_copy((__mks_195.dir),(safe_normalize3(__refr_rename_at_180)));
+				return __mks_195;
+			})()));
+		};
+	} else {
+		das_copy(__attenuation_rename_at_148,v_make_vec4f(1.f,0.f,1.f,0.f));
+		das_copy(__scattered_rename_at_148,(([&]() -> tpt::Ray {
+			tpt::Ray __mks_198;
+			das_zero(__mks_198);
+			das_copy((__mks_198.orig),(v_zero()));
+			das_copy((__mks_198.dir),(v_zero()));
+			return __mks_198;
+		})()));
+		return das_auto_cast<bool>::cast(false);
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline float schlick_72e850179a55e12c ( Context * __context__, float __cosine_rename_at_24, float __ri_rename_at_24 )
+{
+	float __r0_rename_at_25 = (SimPolicy<float>::Div((1.f - __ri_rename_at_24),(1.f + __ri_rename_at_24),*__context__));
+	return das_auto_cast<float>::cast(SimPolicy<float>::Lerp(__r0_rename_at_25 * __r0_rename_at_25,1.f,SimPolicy<float>::Pow(1.f - __cosine_rename_at_24,5.f,*__context__),*__context__));
+}
+
+inline bool test_954c01124c52703b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"test " DAS_FILE_LINE);
+{
+	prepare_2f5bebefc4cabf6b(__context__);
+	TArray<float3> __backbuffer_rename_at_269; das_zero(__backbuffer_rename_at_269);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_269),76800);
+	builtin_print(((char *) "\ntracing...\n"),__context__);
+	int32_t __i_rename_at_272 = 0;
+	builtin_profile(16,((char *) "ray-trace frame"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		int32_t __rayCount_rename_at_274 = 0;
+		draw_7db8214042db57fd(__context__,__i_rename_at_272,320,240,0,240,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_269),__rayCount_rename_at_274);
+		__i_rename_at_272++;
+	}),__context__);
+	saveTga(((char *) "path_tracer.tga"),das_arg<TArray<float3>>::pass(__backbuffer_rename_at_269),320,240,__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline float3 trace_fba546e7a90c9bd3 ( Context * __context__, tpt::Ray const  &  __r_rename_at_202, int32_t __depth_rename_at_202, int32_t & __inoutRayCount_rename_at_202, bool __doMaterialE_rename_at_202 )
+{
+	tpt::Hit __rec_rename_at_203; das_zero(__rec_rename_at_203);
+	int32_t __id_rename_at_204 = 0;
+	++__inoutRayCount_rename_at_202;
+	if ( hitWorld_d95c069c72243920(__context__,__r_rename_at_202,0.00100000005f,10000000.f,das_arg<tpt::Hit>::pass(__rec_rename_at_203),__id_rename_at_204) )
+	{
+		tpt::Ray __scattered_rename_at_207; das_zero(__scattered_rename_at_207);
+		float3 __attenuation_rename_at_208 = v_zero();
+		float3 __lightE_rename_at_209 = v_zero();
+		tpt::Material * __mat_rename_at_210 = ((tpt::Material *)&(das_global<TDim<tpt::Material,9>,0x6a1d2790>(__context__) /*s_SphereMats*/(__id_rename_at_204,__context__)));
+		float3 __matE_rename_at_211 = (*__mat_rename_at_210).emissive;
+		if ( (__depth_rename_at_202 < 10) && scatter_334a5501fde24d03(__context__,(*__mat_rename_at_210),__r_rename_at_202,das_arg<tpt::Hit>::pass(__rec_rename_at_203),__attenuation_rename_at_208,das_arg<tpt::Ray>::pass(__scattered_rename_at_207),__lightE_rename_at_209,__inoutRayCount_rename_at_202) )
+		{
+			if ( !__doMaterialE_rename_at_202 )
+			{
+				das_copy(__matE_rename_at_211,v_zero());
+			};
+			das_copy(__doMaterialE_rename_at_202,(*__mat_rename_at_210).mtype != DAS_COMMENT(enum) tpt::Type::Lambert);
+			return das_auto_cast<float3>::cast(SimPolicy<float3>::Mad(__attenuation_rename_at_208,trace_fba546e7a90c9bd3(__context__,das_arg<tpt::Ray>::pass(__scattered_rename_at_207),__depth_rename_at_202 + 1,__inoutRayCount_rename_at_202,__doMaterialE_rename_at_202),SimPolicy<float3>::Add(__matE_rename_at_211,__lightE_rename_at_209,*__context__),*__context__));
+		} else {
+			return das_auto_cast<float3>::cast(__matE_rename_at_211);
+		};
+	} else {
+		float3 __t_rename_at_220 = ((float3)SimPolicy<float3>::MadS(__r_rename_at_202.dir,cast<float>::from(0.5f),v_splats(1.f),*__context__));
+		return das_auto_cast<float3>::cast(SimPolicy<float3>::Lerp(v_splats(0.300000012f),v_make_vec4f(0.150000006f,0.210000008f,0.300000012f,0.f),__t_rename_at_220,*__context__));
+	};
+}
+
+inline int32_t trace_a9e3bf8b9004c9cc ( Context * __context__, int32_t __screenWidth_rename_at_223, int32_t __screenHeight_rename_at_223, int32_t __frameCount_rename_at_223, int32_t __ymin_rename_at_223, int32_t __ymax_rename_at_223, TArray<float3> &  __backbuffer_rename_at_223, tpt::Camera const  &  __cam_rename_at_223 )
+{
+	float2 __invWH_rename_at_224 = ((float2)(SimPolicy<float2>::DivScalVec(cast<float>::from(1.f),float2(__screenWidth_rename_at_223,__screenHeight_rename_at_223),*__context__)));
+	float3 __lerpFac_rename_at_225 = ((float3)v_splats(SimPolicy<float>::Div(float(__frameCount_rename_at_223),float(__frameCount_rename_at_223 + 1),*__context__)));
+	int32_t __rayCount_rename_at_226 = 0;
+	int32_t __backbufferIdx_rename_at_227 = (__ymin_rename_at_223 * __screenWidth_rename_at_223);
+	{
+		bool __need_loop_228 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(__ymin_rename_at_223,__ymax_rename_at_223));
+		int32_t __y_rename_at_228;
+		__need_loop_228 = __y_iterator.first(__context__,(__y_rename_at_228)) && __need_loop_228;
+		for ( ; __need_loop_228 ; __need_loop_228 = __y_iterator.next(__context__,(__y_rename_at_228)) )
+		{
+			das_copy(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/,randomSeed((__y_rename_at_228 * 117) + (__frameCount_rename_at_223 * 13)));
+			{
+				bool __need_loop_230 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(mk_range(__screenWidth_rename_at_223));
+				int32_t __x_rename_at_230;
+				__need_loop_230 = __x_iterator.first(__context__,(__x_rename_at_230)) && __need_loop_230;
+				for ( ; __need_loop_230 ; __need_loop_230 = __x_iterator.next(__context__,(__x_rename_at_230)) )
+				{
+					float3 __col_rename_at_231 = v_zero();
+					{
+						bool __need_loop_232 = true;
+						// s : int const
+						das_iterator<range> __s_iterator(range(0,4));
+						int32_t __s_rename_at_232;
+						__need_loop_232 = __s_iterator.first(__context__,(__s_rename_at_232)) && __need_loop_232;
+						for ( ; __need_loop_232 ; __need_loop_232 = __s_iterator.next(__context__,(__s_rename_at_232)) )
+						{
+							tpt::Ray _temp_make_local_234_176;
+							float2 __uv_rename_at_233 = ((float2)(SimPolicy<float2>::Mul((SimPolicy<float2>::Add(float2(__x_rename_at_230,__y_rename_at_228),das_swizzle_seq<float2,float4,0>::swizzle(randomFloat4(das_global<int4,0xef6a018b>(__context__) /*RAND_SEED*/)) /*xy*/,*__context__)),__invWH_rename_at_224,*__context__)));
+							SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_231),trace_fba546e7a90c9bd3(__context__,das_arg<tpt::Ray>::pass((_temp_make_local_234_176 = (getRay_68bef54fd0785344(__context__,__cam_rename_at_223,v_extract_x(__uv_rename_at_233) /*x*/,v_extract_y(__uv_rename_at_233) /*y*/)))),0,__rayCount_rename_at_226,true),*__context__);
+						}
+						__s_iterator.close(__context__,(__s_rename_at_232));
+					};
+					SimPolicy<float3>::SetMulScal((char *)&(__col_rename_at_231),cast<float>::from(0.25f),*__context__);
+					das_copy(__backbuffer_rename_at_223(__backbufferIdx_rename_at_227,__context__),SimPolicy<float3>::Lerp(__col_rename_at_231,__backbuffer_rename_at_223(__backbufferIdx_rename_at_227,__context__),__lerpFac_rename_at_225,*__context__));
+					__backbufferIdx_rename_at_227++;
+				}
+				__x_iterator.close(__context__,(__x_rename_at_230));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_228));
+	};
+	return das_auto_cast<int32_t>::cast(__rayCount_rename_at_226);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Camera_1c96edf0c60a714e
+		aotLib[0xec9005dc128c7ac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<tpt::Camera (*) ( Context * __context__, float3 , float3 , float3 , float , float , float , float  ),&Camera_1c96edf0c60a714e>>();
+	};
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// draw_7db8214042db57fd
+		aotLib[0x11c664cfef79e265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t , int32_t , TArray<float3> & , int32_t &  ),&draw_7db8214042db57fd>>();
+	};
+		// getRay_68bef54fd0785344
+		aotLib[0xbb9e18da7e8bdc01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<tpt::Ray (*) ( Context * __context__, tpt::Camera const  & , float , float  ),&getRay_68bef54fd0785344>>();
+	};
+		// hitSpheres_3bb6896717289b63
+		aotLib[0xa7b98e9c85e1e0e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, tpt::Ray const  & , float , float , tpt::Hit &  ),&hitSpheres_3bb6896717289b63>>();
+	};
+		// hitWorld_d95c069c72243920
+		aotLib[0x28de93a638c32dda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, tpt::Ray const  & , float , float , tpt::Hit & , int32_t &  ),&hitWorld_d95c069c72243920>>();
+	};
+		// job_ec133864ccb70ac5
+		aotLib[0x682810508c768368] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float3> & , int32_t , int32_t , int32_t , int32_t , int32_t  ),&job_ec133864ccb70ac5>>();
+	};
+		// pointAt_347d17d6cf06e664
+		aotLib[0xf3dc652d70158d21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, tpt::Ray const  & , float  ),&pointAt_347d17d6cf06e664>>();
+	};
+		// prepare_2f5bebefc4cabf6b
+		aotLib[0x6f0e1ab1a08f3805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&prepare_2f5bebefc4cabf6b>>();
+	};
+		// scatter_334a5501fde24d03
+		aotLib[0xf1ca15ef24bbd2b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, tpt::Material const  & , tpt::Ray const  & , tpt::Hit const  & , float3 & , tpt::Ray & , float3 & , int32_t &  ),&scatter_334a5501fde24d03>>();
+	};
+		// schlick_72e850179a55e12c
+		aotLib[0xed06f593e43a7dd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float , float  ),&schlick_72e850179a55e12c>>();
+	};
+		// test_954c01124c52703b
+		aotLib[0x8d2788e9c800c7ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_954c01124c52703b>>();
+	};
+		// trace_fba546e7a90c9bd3
+		aotLib[0xa2879dd4c2c4daa3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, tpt::Ray const  & , int32_t , int32_t & , bool  ),&trace_fba546e7a90c9bd3>>();
+	};
+		// trace_a9e3bf8b9004c9cc
+		aotLib[0x82776869fbcb3f50] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t , int32_t , TArray<float3> & , tpt::Camera const  &  ),&trace_a9e3bf8b9004c9cc>>();
+	};
+		// [[ init script ]]
+		aotLib[0xb1fdd26ead7fddae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -163,6 +163,7 @@ int main() {
     NEED_MODULE(Module_Math);
     NEED_MODULE(Module_Strings);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Bulk);
     NEED_MODULE(Module_PathTracerHelper);
     unit_test(TEST_PATH "examples/pathTracer/toy_path_tracer.das");
     Module::Shutdown();
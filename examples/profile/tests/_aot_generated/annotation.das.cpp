@@ -0,0 +1,354 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_defT_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i],0.5f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r_dt_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i],1.f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_some_name_null8 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block("no_name");
+	}
+	return g_total;
+}
+
+
+inline void queryOne_1a47ce82467b33 ( Context * __context__, float __dt_rename_at_24 );
+inline void queryThree_61cb189e48de4ec1 ( Context * __context__ );
+inline void queryTwo_9191d1c26b5cba6d ( Context * __context__, float __dt_rename_at_28 );
+inline bool test_d216ee1d6c14cd4a ( Context * __context__ );
+inline void update_ad3cf103ae6a977c ( Context * __context__ );
+inline void update2_3c2705fd09e02cd2 ( Context * __context__ );
+inline void update3_3da2aa07fa4c6d49 ( Context * __context__ );
+inline void update4_92eef4291ac6de84 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void queryOne_1a47ce82467b33 ( Context * __context__, float __dt_rename_at_24 )
+{
+	__query_es_pos1212_r_vel1212(__context__->adBySid(3123007069u),[&](float3 & __pos_rename_at_25, float3 __vel_rename_at_25)->void{
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_25),(SimPolicy<float3>::MulVecScal(__vel_rename_at_25,cast<float>::from(__dt_rename_at_24),*__context__)),*__context__);
+	},__context__);
+}
+
+inline void queryThree_61cb189e48de4ec1 ( Context * __context__ )
+{
+	int32_t __count_rename_at_33 = 0;
+	das_try_recover(__context__, [&]()
+	{
+		__query_es_pos1212_r(__context__->adBySid(2684223077u),[&](float3 const  & __pos_rename_at_35)->void{
+			float3 __position_rename_at_36 = ((float3)__pos_rename_at_35);
+			__query_es_pos1212_r(__context__->adBySid(2684223077u),[&](float3 const  & __pos_rename_at_37)->void{
+				if ( SimPolicy<float3>::Equ(__position_rename_at_36,__pos_rename_at_37,*__context__) )
+				{
+					__count_rename_at_33++;
+					if ( __count_rename_at_33 == 100 )
+					{
+						builtin_throw(((char *) "enough"),__context__);
+					};
+				};
+			},__context__);
+		},__context__);
+	}, [&]()
+	{
+		DAS_ASSERT((__count_rename_at_33 == 100));
+	});
+}
+
+inline void queryTwo_9191d1c26b5cba6d ( Context * __context__, float __dt_rename_at_28 )
+{
+	__query_es_pos1212_r_vel1212_defT_null4(__context__->adBySid(4170535576u),[&](float3 & __pos_rename_at_29, float3 __vel_rename_at_29, float const  __defT_rename_at_29)->void{
+
+#if 0
+0.5f
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_29),(SimPolicy<float3>::MulVecScal(__vel_rename_at_29,cast<float>::from((__defT_rename_at_29 + __dt_rename_at_28)),*__context__)),*__context__);
+	},__context__);
+}
+
+inline bool test_d216ee1d6c14cd4a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,464,"test " DAS_FILE_LINE);
+{
+	initEsComponents();
+	testEsUpdate(((char *) "ks"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	testEsUpdate(((char *) "ks2"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	testEsUpdate(((char *) "ks3"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	queryOne_1a47ce82467b33(__context__,1.f);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	queryTwo_9191d1c26b5cba6d(__context__,0.5f);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	builtin_profile(20,((char *) "es-update"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_64 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_64;
+			__need_loop_64 = __i_iterator.first(__context__,(__i_rename_at_64)) && __need_loop_64;
+			for ( ; __need_loop_64 ; __need_loop_64 = __i_iterator.next(__context__,(__i_rename_at_64)) )
+			{
+				testEsUpdate(((char *) "ks"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_64));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "es-update-ref"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_67 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_67;
+			__need_loop_67 = __i_iterator.first(__context__,(__i_rename_at_67)) && __need_loop_67;
+			for ( ; __need_loop_67 ; __need_loop_67 = __i_iterator.next(__context__,(__i_rename_at_67)) )
+			{
+				testEsUpdate(((char *) "ks2"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_67));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "es-update-ref-const"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_70 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_70;
+			__need_loop_70 = __i_iterator.first(__context__,(__i_rename_at_70)) && __need_loop_70;
+			for ( ; __need_loop_70 ; __need_loop_70 = __i_iterator.next(__context__,(__i_rename_at_70)) )
+			{
+				testEsUpdate(((char *) "ks3"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_70));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "es-update-def-string"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_73 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_73;
+			__need_loop_73 = __i_iterator.first(__context__,(__i_rename_at_73)) && __need_loop_73;
+			for ( ; __need_loop_73 ; __need_loop_73 = __i_iterator.next(__context__,(__i_rename_at_73)) )
+			{
+				testEsUpdate(((char *) "ks4"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_73));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "query-1"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_76 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_76;
+			__need_loop_76 = __i_iterator.first(__context__,(__i_rename_at_76)) && __need_loop_76;
+			for ( ; __need_loop_76 ; __need_loop_76 = __i_iterator.next(__context__,(__i_rename_at_76)) )
+			{
+				queryOne_1a47ce82467b33(__context__,1.f);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_76));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "query-2"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_79 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_79;
+			__need_loop_79 = __i_iterator.first(__context__,(__i_rename_at_79)) && __need_loop_79;
+			for ( ; __need_loop_79 ; __need_loop_79 = __i_iterator.next(__context__,(__i_rename_at_79)) )
+			{
+				queryTwo_9191d1c26b5cba6d(__context__,0.5f);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_79));
+		};
+	}),__context__);
+	builtin_profile(20,((char *) "query-3"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		queryThree_61cb189e48de4ec1(__context__);
+	}),__context__);
+	releaseEsComponents();
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void update_ad3cf103ae6a977c ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212_r(__context__->adBySid(3419051738u),[&](float3 & __pos_rename_at_8, float3 const  & __vel_rename_at_8)->void{
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_8),__vel_rename_at_8,*__context__);
+	},__context__);
+}
+
+inline void update2_3c2705fd09e02cd2 ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212(__context__->adBySid(1308767514u),[&](float3 & __pos_rename_at_13, float3 __vel_rename_at_13)->void{
+
+#if 0
+v_make_vec4f(1.f,2.f,3.f,0.f)
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_13),__vel_rename_at_13,*__context__);
+	},__context__);
+}
+
+inline void update3_3da2aa07fa4c6d49 ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212_r_dt_null4(__context__->adBySid(742888649u),[&](float3 & __pos_rename_at_17, float3 const  & __vel_rename_at_17, float const  __dt_rename_at_17)->void{
+
+#if 0
+1.f
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_17),(SimPolicy<float3>::MulVecScal(__vel_rename_at_17,cast<float>::from(__dt_rename_at_17),*__context__)),*__context__);
+	},__context__);
+}
+
+inline void update4_92eef4291ac6de84 ( Context * __context__ )
+{
+	__query_es_some_name_null8(__context__->adBySid(112459704u),[&](char * const  __some_name_rename_at_21)->void{
+
+#if 0
+((char *) "no_name")
+#endif
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__some_name_rename_at_21),cast<char *>::from(((char *) "no_name")),*__context__)));
+	},__context__);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// queryOne_1a47ce82467b33
+		aotLib[0x48031a7745bc0349] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&queryOne_1a47ce82467b33>>();
+	};
+		// queryThree_61cb189e48de4ec1
+		aotLib[0x83680f417d6b1851] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&queryThree_61cb189e48de4ec1>>();
+	};
+		// queryTwo_9191d1c26b5cba6d
+		aotLib[0xea33473ade8c4039] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&queryTwo_9191d1c26b5cba6d>>();
+	};
+		// test_d216ee1d6c14cd4a
+		aotLib[0x79826d99bba8ba08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d216ee1d6c14cd4a>>();
+	};
+		// update_ad3cf103ae6a977c
+		aotLib[0x50b3c7ff9dc1dac1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update_ad3cf103ae6a977c>>();
+	};
+		// update2_3c2705fd09e02cd2
+		aotLib[0xf00e1693be41db65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update2_3c2705fd09e02cd2>>();
+	};
+		// update3_3da2aa07fa4c6d49
+		aotLib[0xd993218d72d3a725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update3_3da2aa07fa4c6d49>>();
+	};
+		// update4_92eef4291ac6de84
+		aotLib[0x1c6beaa1be80099] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update4_92eef4291ac6de84>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,527 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__dd4e46ea;
+extern FuncInfo __func_info__fb0181fb;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __func_info__fb0181fb_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"testProfile::dasvector`int"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xdd4e46ea, "arr", 0 };
+VarInfo * __func_info__fb0181fb_fields[1] =  { &__func_info__fb0181fb_field_0 };
+FuncInfo __func_info__fb0181fb = {"invoke block<(arr:testProfile::dasvector`int const):void> const", "", __func_info__fb0181fb_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xfb0181fb, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[3] = { &__type_info__3ffbf730, &__type_info__a6c45d85, &__type_info__3ffbf730 };
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+
+inline void init_87d705abe13f2cb7 ( Context * __context__, ObjectArray & __objects_rename_at_58 );
+inline void init_8432b326523e6e30 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_64 );
+inline void initObj_dd871dc91d02a463 ( Context * __context__, int32_t __i_rename_at_50, Object & __a_rename_at_50 );
+inline void initObj_500fb8362218e568 ( Context * __context__, int32_t __i_rename_at_54, NObject & __a_rename_at_54 );
+inline void ks_update_f1bcaae34484c57b ( Context * __context__, float3 & __pos_rename_at_31, float3 __vel_rename_at_31 );
+inline bool perks_disabler_unset_es_9afe6f7427db3ce2 ( Context * __context__, ObjectArray & __game_effect_dot_allowedMods_rename_at_6, ObjectArray & __allowedMods_rename_at_6 );
+inline bool test_1bd5906976579de9 ( Context * __context__, ObjectArray & __objects_rename_at_97 );
+inline void testInterop_89f99ec31017686d ( Context * __context__, ObjectArray & __objects_rename_at_46 );
+inline void testSim_6617102fa7272292 ( Context * __context__, ObjectArray & __objects_rename_at_38 );
+inline void testSim_b73be1f07af0f9f8 ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_22 );
+inline void testSimI_f6f7f9c2fa576a4d ( Context * __context__, ObjectArray & __objects_rename_at_42 );
+inline void testSimI_75cfd527a3a2b06f ( Context * __context__, TDim<NObject,10000> & __objects_rename_at_26 );
+inline void update_1ff292127d40dde2 ( Context * __context__, Object & __a_rename_at_35 );
+inline void update_a7d15784abd4b219 ( Context * __context__, NObject & __a_rename_at_19 );
+inline void verifyManagedInt_2a04e1d35735d815 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TDim<NObject,10000>,0x7be53982>(__context__);/*nobjects*/
+}
+
+inline void init_87d705abe13f2cb7 ( Context * __context__, ObjectArray &  __objects_rename_at_58 )
+{
+	int32_t __index_rename_at_59 = 0;
+	{
+		bool __need_loop_60 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_58);
+		Object * __obj_rename_at_60;
+		__need_loop_60 = __obj_iterator.first(__context__,(__obj_rename_at_60)) && __need_loop_60;
+		for ( ; __need_loop_60 ; __need_loop_60 = __obj_iterator.next(__context__,(__obj_rename_at_60)) )
+		{
+			initObj_dd871dc91d02a463(__context__,__index_rename_at_59++,das_arg<Object>::pass((*__obj_rename_at_60)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_60));
+	};
+	DAS_ASSERT((__index_rename_at_59 == __objects_rename_at_58.size() /*length*/));
+}
+
+inline void init_8432b326523e6e30 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_64 )
+{
+	int32_t __index_rename_at_65 = 0;
+	{
+		bool __need_loop_66 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_64);
+		NObject * __obj_rename_at_66;
+		__need_loop_66 = __obj_iterator.first(__context__,(__obj_rename_at_66)) && __need_loop_66;
+		for ( ; __need_loop_66 ; __need_loop_66 = __obj_iterator.next(__context__,(__obj_rename_at_66)) )
+		{
+			initObj_500fb8362218e568(__context__,__index_rename_at_65++,das_arg<NObject>::pass((*__obj_rename_at_66)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_66));
+	};
+	DAS_ASSERT((__index_rename_at_65 == 10000));
+}
+
+inline void initObj_dd871dc91d02a463 ( Context * __context__, int32_t __i_rename_at_50, Object &  __a_rename_at_50 )
+{
+	das_copy(__a_rename_at_50.pos /*position*/,float3(__i_rename_at_50++,__i_rename_at_50 + 1,__i_rename_at_50 + 2));
+	das_copy(__a_rename_at_50.vel /*velocity*/,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void initObj_500fb8362218e568 ( Context * __context__, int32_t __i_rename_at_54, NObject &  __a_rename_at_54 )
+{
+	das_copy(__a_rename_at_54.position,float3(__i_rename_at_54++,__i_rename_at_54 + 1,__i_rename_at_54 + 2));
+	das_copy(__a_rename_at_54.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void ks_update_f1bcaae34484c57b ( Context * __context__, float3 & __pos_rename_at_31, float3 __vel_rename_at_31 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_31),__vel_rename_at_31,*__context__);
+}
+
+inline bool perks_disabler_unset_es_9afe6f7427db3ce2 ( Context * __context__, ObjectArray &  __game_effect_dot_allowedMods_rename_at_6, ObjectArray &  __allowedMods_rename_at_6 )
+{
+	{
+		bool __need_loop_7 = true;
+		// perk : testProfile::Object&
+		das_iterator<ObjectArray> __perk_iterator(__game_effect_dot_allowedMods_rename_at_6);
+		Object * __perk_rename_at_7;
+		__need_loop_7 = __perk_iterator.first(__context__,(__perk_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __perk_iterator.next(__context__,(__perk_rename_at_7)) )
+		{
+			{
+				bool __need_loop_8 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(mk_range(__allowedMods_rename_at_6.size() /*length*/));
+				int32_t __i_rename_at_8;
+				__need_loop_8 = __i_iterator.first(__context__,(__i_rename_at_8)) && __need_loop_8;
+				for ( ; __need_loop_8 ; __need_loop_8 = __i_iterator.next(__context__,(__i_rename_at_8)) )
+				{
+					if ( SimPolicy<Object>::Equ(cast<Object*>::from(&(das_index<ObjectArray>::at(__allowedMods_rename_at_6,__i_rename_at_8,__context__))),cast<Object *>::from(&((*__perk_rename_at_7))),*__context__) )
+					{
+						return das_auto_cast<bool>::cast(true);
+					};
+				}
+				__i_iterator.close(__context__,(__i_rename_at_8));
+			};
+		}
+		__perk_iterator.close(__context__,(__perk_rename_at_7));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline bool test_1bd5906976579de9 ( Context * __context__, ObjectArray &  __objects_rename_at_97 ) { das_stack_prologue __prologue(__context__,672,"test " DAS_FILE_LINE);
+{
+	verifyManagedInt_2a04e1d35735d815(__context__);
+	perks_disabler_unset_es_9afe6f7427db3ce2(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97),das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_8432b326523e6e30(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+	testSim_b73be1f07af0f9f8(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+	init_8432b326523e6e30(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+	testSimI_75cfd527a3a2b06f(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testSim_6617102fa7272292(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testSimI_f6f7f9c2fa576a4d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	testInterop_89f99ec31017686d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	update10000(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+	init_87d705abe13f2cb7(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+	update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+	float __simTN_rename_at_127 = ((float)builtin_profile(20,((char *) "native basic version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_128 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_128;
+			__need_loop_128 = __i_iterator.first(__context__,(__i_rename_at_128)) && __need_loop_128;
+			for ( ; __need_loop_128 ; __need_loop_128 = __i_iterator.next(__context__,(__i_rename_at_128)) )
+			{
+				testSim_b73be1f07af0f9f8(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_128));
+		};
+	}),__context__));
+	float __simTN_I_rename_at_130 = ((float)builtin_profile(20,((char *) "native basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_131 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_131;
+			__need_loop_131 = __i_iterator.first(__context__,(__i_rename_at_131)) && __need_loop_131;
+			for ( ; __need_loop_131 ; __need_loop_131 = __i_iterator.next(__context__,(__i_rename_at_131)) )
+			{
+				testSimI_75cfd527a3a2b06f(__context__,das_arg<TDim<NObject,10000>>::pass(das_global<TDim<NObject,10000>,0x7be53982>(__context__) /*nobjects*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_131));
+		};
+	}),__context__));
+	float __simT_rename_at_133 = ((float)builtin_profile(20,((char *) "basic version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_134 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_134;
+			__need_loop_134 = __i_iterator.first(__context__,(__i_rename_at_134)) && __need_loop_134;
+			for ( ; __need_loop_134 ; __need_loop_134 = __i_iterator.next(__context__,(__i_rename_at_134)) )
+			{
+				testSim_6617102fa7272292(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_134));
+		};
+	}),__context__));
+	float __simT_I_rename_at_136 = ((float)builtin_profile(20,((char *) "basic version, inline"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_137 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_137;
+			__need_loop_137 = __i_iterator.first(__context__,(__i_rename_at_137)) && __need_loop_137;
+			for ( ; __need_loop_137 ; __need_loop_137 = __i_iterator.next(__context__,(__i_rename_at_137)) )
+			{
+				testSimI_f6f7f9c2fa576a4d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_137));
+		};
+	}),__context__));
+	float __cT_rename_at_139 = ((float)builtin_profile(20,((char *) "c++ version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_140 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_140;
+			__need_loop_140 = __i_iterator.first(__context__,(__i_rename_at_140)) && __need_loop_140;
+			for ( ; __need_loop_140 ; __need_loop_140 = __i_iterator.next(__context__,(__i_rename_at_140)) )
+			{
+				updateTest(das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_140));
+		};
+	}),__context__));
+	float __intT_rename_at_142 = ((float)builtin_profile(20,((char *) "interop version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_143 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_143;
+			__need_loop_143 = __i_iterator.first(__context__,(__i_rename_at_143)) && __need_loop_143;
+			for ( ; __need_loop_143 ; __need_loop_143 = __i_iterator.next(__context__,(__i_rename_at_143)) )
+			{
+				testInterop_89f99ec31017686d(__context__,das_arg<ObjectArray>::pass(__objects_rename_at_97));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_143));
+		};
+	}),__context__));
+	float __manyT_rename_at_145 = ((float)builtin_profile(20,((char *) "interop 10000 version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_146 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_146;
+			__need_loop_146 = __i_iterator.first(__context__,(__i_rename_at_146)) && __need_loop_146;
+			for ( ; __need_loop_146 ; __need_loop_146 = __i_iterator.next(__context__,(__i_rename_at_146)) )
+			{
+				update10000(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_146));
+		};
+	}),__context__));
+	float __manyKsT_rename_at_148 = ((float)builtin_profile(20,((char *) "interop 10000-ks version"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		{
+			bool __need_loop_149 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,1000));
+			int32_t __i_rename_at_149;
+			__need_loop_149 = __i_iterator.first(__context__,(__i_rename_at_149)) && __need_loop_149;
+			for ( ; __need_loop_149 ; __need_loop_149 = __i_iterator.next(__context__,(__i_rename_at_149)) )
+			{
+				update10000ks(das_arg<ObjectArray>::pass(__objects_rename_at_97),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_149));
+		};
+	}),__context__));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "ratio nsim/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_rename_at_127,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "ratio sim/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_rename_at_133,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_2, cast<char * const >::from(((char *) "ratio nsim,inline/c++ ")), cast<float>::from((SimPolicy<float>::Div(__simTN_I_rename_at_130,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "ratio sim,inline/c++: ")), cast<float>::from((SimPolicy<float>::Div(__simT_I_rename_at_136,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "ratio interop/c++: ")), cast<float>::from((SimPolicy<float>::Div(__intT_rename_at_142,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_5, cast<char * const >::from(((char *) "ratio interop-10000/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyT_rename_at_145,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_6, cast<char * const >::from(((char *) "ratio interop-10000-ks/c++: ")), cast<float>::from((SimPolicy<float>::Div(__manyKsT_rename_at_148,__cT_rename_at_139,*__context__))), cast<char * const >::from(((char *) "\n")))),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void testInterop_89f99ec31017686d ( Context * __context__, ObjectArray &  __objects_rename_at_46 )
+{
+	{
+		bool __need_loop_47 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_46);
+		Object * __obj_rename_at_47;
+		__need_loop_47 = __obj_iterator.first(__context__,(__obj_rename_at_47)) && __need_loop_47;
+		for ( ; __need_loop_47 ; __need_loop_47 = __obj_iterator.next(__context__,(__obj_rename_at_47)) )
+		{
+			updateObject(das_arg<Object>::pass((*__obj_rename_at_47)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_47));
+	};
+}
+
+inline void testSim_6617102fa7272292 ( Context * __context__, ObjectArray &  __objects_rename_at_38 )
+{
+	{
+		bool __need_loop_39 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_38);
+		Object * __obj_rename_at_39;
+		__need_loop_39 = __obj_iterator.first(__context__,(__obj_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __obj_iterator.next(__context__,(__obj_rename_at_39)) )
+		{
+			update_1ff292127d40dde2(__context__,das_arg<Object>::pass((*__obj_rename_at_39)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_39));
+	};
+}
+
+inline void testSim_b73be1f07af0f9f8 ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_22 )
+{
+	{
+		bool __need_loop_23 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_22);
+		NObject * __obj_rename_at_23;
+		__need_loop_23 = __obj_iterator.first(__context__,(__obj_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __obj_iterator.next(__context__,(__obj_rename_at_23)) )
+		{
+			update_a7d15784abd4b219(__context__,das_arg<NObject>::pass((*__obj_rename_at_23)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_23));
+	};
+}
+
+inline void testSimI_f6f7f9c2fa576a4d ( Context * __context__, ObjectArray &  __objects_rename_at_42 )
+{
+	{
+		bool __need_loop_43 = true;
+		// obj : testProfile::Object&
+		das_iterator<ObjectArray> __obj_iterator(__objects_rename_at_42);
+		Object * __obj_rename_at_43;
+		__need_loop_43 = __obj_iterator.first(__context__,(__obj_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __obj_iterator.next(__context__,(__obj_rename_at_43)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_43).pos /*position*/),(*__obj_rename_at_43).vel /*velocity*/,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_43));
+	};
+}
+
+inline void testSimI_75cfd527a3a2b06f ( Context * __context__, TDim<NObject,10000> &  __objects_rename_at_26 )
+{
+	{
+		bool __need_loop_27 = true;
+		// obj : NObject& -const
+		das_iterator<TDim<NObject,10000>> __obj_iterator(__objects_rename_at_26);
+		NObject * __obj_rename_at_27;
+		__need_loop_27 = __obj_iterator.first(__context__,(__obj_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __obj_iterator.next(__context__,(__obj_rename_at_27)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_27).position),(*__obj_rename_at_27).velocity,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_27));
+	};
+}
+
+inline void update_1ff292127d40dde2 ( Context * __context__, Object &  __a_rename_at_35 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_35.pos /*position*/),__a_rename_at_35.vel /*velocity*/,*__context__);
+}
+
+inline void update_a7d15784abd4b219 ( Context * __context__, NObject &  __a_rename_at_19 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_19.position),__a_rename_at_19.velocity,*__context__);
+}
+
+inline void verifyManagedInt_2a04e1d35735d815 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,144,"verifyManagedInt " DAS_FILE_LINE);
+{
+	testManagedInt(das_make_block<void,das::vector<int32_t> const  &>(__context__,80,0,&__func_info__fb0181fb,[&](das::vector<int32_t> const  & __arr_rename_at_89)->void{
+		DAS_ASSERT((__arr_rename_at_89.size() /*length*/ == 10));
+		{
+			bool __need_loop_91 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_91;
+			__need_loop_91 = __x_iterator.first(__context__,(__x_rename_at_91)) && __need_loop_91;
+			for ( ; __need_loop_91 ; __need_loop_91 = __x_iterator.next(__context__,(__x_rename_at_91)) )
+			{
+				DAS_ASSERT((das_index<das::vector<int32_t> const >::at(__arr_rename_at_89,__x_rename_at_91,__context__) == __x_rename_at_91));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_91));
+		};
+		{
+			bool __need_loop_93 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_93;
+			__need_loop_93 = __x_iterator.first(__context__,(__x_rename_at_93)) && __need_loop_93;
+			// y : int const&
+			das_iterator<das::vector<int32_t> const > __y_iterator(__arr_rename_at_89);
+			int32_t const  * __y_rename_at_93;
+			__need_loop_93 = __y_iterator.first(__context__,(__y_rename_at_93)) && __need_loop_93;
+			for ( ; __need_loop_93 ; __need_loop_93 = __x_iterator.next(__context__,(__x_rename_at_93)) && __y_iterator.next(__context__,(__y_rename_at_93)) )
+			{
+				DAS_ASSERT((__x_rename_at_93 == (*__y_rename_at_93)));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_93));
+			__y_iterator.close(__context__,(__y_rename_at_93));
+		};
+	}),__context__);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// init_87d705abe13f2cb7
+		aotLib[0x4232ff3d105f4339] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&init_87d705abe13f2cb7>>();
+	};
+		// init_8432b326523e6e30
+		aotLib[0xc26630d5e6a396a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&init_8432b326523e6e30>>();
+	};
+		// initObj_dd871dc91d02a463
+		aotLib[0xafb94748fcd2e9f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Object &  ),&initObj_dd871dc91d02a463>>();
+	};
+		// initObj_500fb8362218e568
+		aotLib[0x698e46e69509caa5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , NObject &  ),&initObj_500fb8362218e568>>();
+	};
+		// ks_update_f1bcaae34484c57b
+		aotLib[0x7c78b008a5fc473d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3 & , float3  ),&ks_update_f1bcaae34484c57b>>();
+	};
+		// perks_disabler_unset_es_9afe6f7427db3ce2
+		aotLib[0xd87488b5588db229] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray & , ObjectArray &  ),&perks_disabler_unset_es_9afe6f7427db3ce2>>();
+	};
+		// test_1bd5906976579de9
+		aotLib[0xc63d97fdab41de98] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, ObjectArray &  ),&test_1bd5906976579de9>>();
+	};
+		// testInterop_89f99ec31017686d
+		aotLib[0x7f19fc90b432cf1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testInterop_89f99ec31017686d>>();
+	};
+		// testSim_6617102fa7272292
+		aotLib[0x8cff5d5623948178] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSim_6617102fa7272292>>();
+	};
+		// testSim_b73be1f07af0f9f8
+		aotLib[0x280ee9dfd65e258e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&testSim_b73be1f07af0f9f8>>();
+	};
+		// testSimI_f6f7f9c2fa576a4d
+		aotLib[0xfc8439b8db3a0de1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, ObjectArray &  ),&testSimI_f6f7f9c2fa576a4d>>();
+	};
+		// testSimI_75cfd527a3a2b06f
+		aotLib[0x1149500d8bba1e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<NObject,10000> &  ),&testSimI_75cfd527a3a2b06f>>();
+	};
+		// update_1ff292127d40dde2
+		aotLib[0xbca2ad10c79579] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Object &  ),&update_1ff292127d40dde2>>();
+	};
+		// update_a7d15784abd4b219
+		aotLib[0xa102429ac3b890dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, NObject &  ),&update_a7d15784abd4b219>>();
+	};
+		// verifyManagedInt_2a04e1d35735d815
+		aotLib[0x4ab11ab88e4093b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&verifyManagedInt_2a04e1d35735d815>>();
+	};
+		// [[ init script ]]
+		aotLib[0xf9437bccfc5176e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,296 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require bulk
+#include "daScript/simulate/aot_builtin_bulk.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Funcbuiltin_0x60_clone_44653d05f39d9f48 ( Context * __context__, TArray<float> & __a_rename_at_143, TArray<float> const  & __b_rename_at_143 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void script_axpy_6506c48344239e11 ( Context * __context__, TArray<float> & __y_rename_at_18, float __a_rename_at_18, TArray<float> const  & __x_rename_at_18 );
+inline void script_clamp_aada527b8cab15bd ( Context * __context__, TArray<float> & __y_rename_at_22, float __lo_rename_at_22, float __hi_rename_at_22 );
+inline int32_t script_count_less_9052904aa2c98cb9 ( Context * __context__, TArray<float> const  & __y_rename_at_26, float __v_rename_at_26 );
+inline void script_fill_50a57ef8b8e2ca22 ( Context * __context__, TArray<float> & __a_rename_at_8, float __v_rename_at_8 );
+inline float script_sum_59de02e1202996fe ( Context * __context__, TArray<float> const  & __a_rename_at_12 );
+inline bool test_56dced0094aae774 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_44653d05f39d9f48 ( Context * __context__, TArray<float> &  __a_rename_at_143, TArray<float> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : float aka TT&
+		das_iterator<TArray<float>> __aV_iterator(__a_rename_at_143);
+		float * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : float const&
+		das_iterator<TArray<float> const > __bV_iterator(__b_rename_at_143);
+		float const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void script_axpy_6506c48344239e11 ( Context * __context__, TArray<float> &  __y_rename_at_18, float __a_rename_at_18, TArray<float> const  &  __x_rename_at_18 )
+{
+	{
+		bool __need_loop_19 = true;
+		// yy : float&
+		das_iterator<TArray<float>> __yy_iterator(__y_rename_at_18);
+		float * __yy_rename_at_19;
+		__need_loop_19 = __yy_iterator.first(__context__,(__yy_rename_at_19)) && __need_loop_19;
+		// xx : float const&
+		das_iterator<TArray<float> const > __xx_iterator(__x_rename_at_18);
+		float const  * __xx_rename_at_19;
+		__need_loop_19 = __xx_iterator.first(__context__,(__xx_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __yy_iterator.next(__context__,(__yy_rename_at_19)) && __xx_iterator.next(__context__,(__xx_rename_at_19)) )
+		{
+			(*__yy_rename_at_19) += (__a_rename_at_18 * (*__xx_rename_at_19));
+		}
+		__yy_iterator.close(__context__,(__yy_rename_at_19));
+		__xx_iterator.close(__context__,(__xx_rename_at_19));
+	};
+}
+
+inline void script_clamp_aada527b8cab15bd ( Context * __context__, TArray<float> &  __y_rename_at_22, float __lo_rename_at_22, float __hi_rename_at_22 )
+{
+	{
+		bool __need_loop_23 = true;
+		// x : float&
+		das_iterator<TArray<float>> __x_iterator(__y_rename_at_22);
+		float * __x_rename_at_23;
+		__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+		{
+			das_copy((*__x_rename_at_23),SimPolicy<float>::Min(SimPolicy<float>::Max((*__x_rename_at_23),__lo_rename_at_22,*__context__),__hi_rename_at_22,*__context__));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_23));
+	};
+}
+
+inline int32_t script_count_less_9052904aa2c98cb9 ( Context * __context__, TArray<float> const  &  __y_rename_at_26, float __v_rename_at_26 )
+{
+	int32_t __c_rename_at_27 = 0;
+	{
+		bool __need_loop_28 = true;
+		// x : float const&
+		das_iterator<TArray<float> const > __x_iterator(__y_rename_at_26);
+		float const  * __x_rename_at_28;
+		__need_loop_28 = __x_iterator.first(__context__,(__x_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __x_iterator.next(__context__,(__x_rename_at_28)) )
+		{
+			if ( (*__x_rename_at_28) < __v_rename_at_26 )
+			{
+				__c_rename_at_27++;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_28));
+	};
+	return das_auto_cast<int32_t>::cast(__c_rename_at_27);
+}
+
+inline void script_fill_50a57ef8b8e2ca22 ( Context * __context__, TArray<float> &  __a_rename_at_8, float __v_rename_at_8 )
+{
+	{
+		bool __need_loop_9 = true;
+		// x : float&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_8);
+		float * __x_rename_at_9;
+		__need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9)) )
+		{
+			das_copy((*__x_rename_at_9),__v_rename_at_8);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_9));
+	};
+}
+
+inline float script_sum_59de02e1202996fe ( Context * __context__, TArray<float> const  &  __a_rename_at_12 )
+{
+	float __s_rename_at_13 = 0.f;
+	{
+		bool __need_loop_14 = true;
+		// x : float const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_12);
+		float const  * __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) )
+		{
+			__s_rename_at_13 += (*__x_rename_at_14);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+	};
+	return das_auto_cast<float>::cast(__s_rename_at_13);
+}
+
+inline bool test_56dced0094aae774 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,736,"test " DAS_FILE_LINE);
+{
+	TArray<float> __x_rename_at_35; das_zero(__x_rename_at_35);
+	TArray<float> __y_rename_at_36; das_zero(__y_rename_at_36);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__x_rename_at_35),100000);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__y_rename_at_36),100000);
+	{
+		bool __need_loop_39 = true;
+		// t : float&
+		das_iterator<TArray<float>> __t_iterator(__x_rename_at_35);
+		float * __t_rename_at_39;
+		__need_loop_39 = __t_iterator.first(__context__,(__t_rename_at_39)) && __need_loop_39;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100000));
+		int32_t __i_rename_at_39;
+		__need_loop_39 = __i_iterator.first(__context__,(__i_rename_at_39)) && __need_loop_39;
+		for ( ; __need_loop_39 ; __need_loop_39 = __t_iterator.next(__context__,(__t_rename_at_39)) && __i_iterator.next(__context__,(__i_rename_at_39)) )
+		{
+			das_copy((*__t_rename_at_39),float(__i_rename_at_39));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_39));
+		__i_iterator.close(__context__,(__i_rename_at_39));
+	};
+	float __s_rename_at_42 = 0.f;
+	int32_t __c_rename_at_43 = 0;
+	builtin_profile(20,((char *) "bulk fill, script loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		script_fill_50a57ef8b8e2ca22(__context__,das_arg<TArray<float>>::pass(__y_rename_at_36),1.f);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk fill, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		bulkFillFloat(das_arg<TArray<float>>::pass(__y_rename_at_36),1.f);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk copy, clone"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		_Funcbuiltin_0x60_clone_44653d05f39d9f48(__context__,das_arg<TArray<float>>::pass(__y_rename_at_36),das_arg<TArray<float>>::pass(__x_rename_at_35));
+	}),__context__);
+	builtin_profile(20,((char *) "bulk copy, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		bulkCopyFloat(das_arg<TArray<float>>::pass(__y_rename_at_36),das_arg<TArray<float>>::pass(__x_rename_at_35),__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk sum, script loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__s_rename_at_42 += script_sum_59de02e1202996fe(__context__,das_arg<TArray<float>>::pass(__x_rename_at_35));
+	}),__context__);
+	builtin_profile(20,((char *) "bulk sum, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__s_rename_at_42 += bulkSumFloat(das_arg<TArray<float>>::pass(__x_rename_at_35));
+	}),__context__);
+	builtin_profile(20,((char *) "bulk axpy, script loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		script_axpy_6506c48344239e11(__context__,das_arg<TArray<float>>::pass(__y_rename_at_36),0.5f,das_arg<TArray<float>>::pass(__x_rename_at_35));
+	}),__context__);
+	builtin_profile(20,((char *) "bulk axpy, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		bulkAxpyFloat(das_arg<TArray<float>>::pass(__y_rename_at_36),0.5f,das_arg<TArray<float>>::pass(__x_rename_at_35),__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk clamp, script loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		script_clamp_aada527b8cab15bd(__context__,das_arg<TArray<float>>::pass(__y_rename_at_36),0.f,1000.f);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk clamp, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		bulkClampFloat(das_arg<TArray<float>>::pass(__y_rename_at_36),0.f,1000.f);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk count_less, script loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__c_rename_at_43 += script_count_less_9052904aa2c98cb9(__context__,das_arg<TArray<float>>::pass(__x_rename_at_35),5000.f);
+	}),__context__);
+	builtin_profile(20,((char *) "bulk count_less, native"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__c_rename_at_43 += bulkCountLessFloat(das_arg<TArray<float>>::pass(__x_rename_at_35),5000.f);
+	}),__context__);
+	return das_auto_cast<bool>::cast((__s_rename_at_42 > 0.f) && (__c_rename_at_43 > 0));
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_44653d05f39d9f48
+		aotLib[0x8c5c4e72f0192dac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , TArray<float> const  &  ),&_Funcbuiltin_0x60_clone_44653d05f39d9f48>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// script_axpy_6506c48344239e11
+		aotLib[0x5612b88fabe01d49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , TArray<float> const  &  ),&script_axpy_6506c48344239e11>>();
+	};
+		// script_clamp_aada527b8cab15bd
+		aotLib[0x5298602422611a25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float , float  ),&script_clamp_aada527b8cab15bd>>();
+	};
+		// script_count_less_9052904aa2c98cb9
+		aotLib[0x7dcac5cb213f5f4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<float> const  & , float  ),&script_count_less_9052904aa2c98cb9>>();
+	};
+		// script_fill_50a57ef8b8e2ca22
+		aotLib[0xe0dfa8417ae26a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&script_fill_50a57ef8b8e2ca22>>();
+	};
+		// script_sum_59de02e1202996fe
+		aotLib[0xc3af5261e88ea7fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  &  ),&script_sum_59de02e1202996fe>>();
+	};
+		// test_56dced0094aae774
+		aotLib[0xe5dc1fc7587ace5c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_56dced0094aae774>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
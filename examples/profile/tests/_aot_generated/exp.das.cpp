@@ -0,0 +1,167 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline float _Func_0x60_expLoop_ac6bfcac5395af ( Context * __context__, int32_t __n_rename_at_7 );
+inline float _Func_0x60_expLoopU_1b99ab603d5689b2 ( Context * __context__, int32_t __n_rename_at_14 );
+inline float _Func_0x60_expLoopUV_edaace1a82e0f30 ( Context * __context__, int32_t __n_rename_at_22 );
+inline bool test_63c24446d01126ae ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float _Func_0x60_expLoop_ac6bfcac5395af ( Context * __context__, int32_t __n_rename_at_7 )
+{
+	float __sum_rename_at_8 = 0.f;
+	{
+		bool __need_loop_9 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_7));
+		int32_t __i_rename_at_9;
+		__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+		{
+			__sum_rename_at_8 += SimPolicy<float>::Exp(SimPolicy<float>::RcpEst(float(__i_rename_at_9 + 1),*__context__),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_9));
+	};
+	return das_auto_cast<float>::cast(__sum_rename_at_8);
+}
+
+inline float _Func_0x60_expLoopU_1b99ab603d5689b2 ( Context * __context__, int32_t __n_rename_at_14 )
+{
+	float __sum_rename_at_15 = 0.f;
+	{
+		bool __need_loop_16 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Div(__n_rename_at_14,4,*__context__)));
+		int32_t __i_rename_at_16;
+		__need_loop_16 = __i_iterator.first(__context__,(__i_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __i_iterator.next(__context__,(__i_rename_at_16)) )
+		{
+			float __k_rename_at_17 = ((float)float(__i_rename_at_16 * 4));
+			__sum_rename_at_15 += (((SimPolicy<float>::Exp(SimPolicy<float>::RcpEst(1.f + __k_rename_at_17,*__context__),*__context__) + SimPolicy<float>::Exp(SimPolicy<float>::RcpEst(2.f + __k_rename_at_17,*__context__),*__context__)) + SimPolicy<float>::Exp(SimPolicy<float>::RcpEst(3.f + __k_rename_at_17,*__context__),*__context__)) + SimPolicy<float>::Exp(SimPolicy<float>::RcpEst(4.f + __k_rename_at_17,*__context__),*__context__));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_16));
+	};
+	return das_auto_cast<float>::cast(__sum_rename_at_15);
+}
+
+inline float _Func_0x60_expLoopUV_edaace1a82e0f30 ( Context * __context__, int32_t __n_rename_at_22 )
+{
+	float4 __sumV_rename_at_23 = v_zero();
+	{
+		bool __need_loop_24 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(SimPolicy<int32_t>::Div(__n_rename_at_22,4,*__context__)));
+		int32_t __i_rename_at_24;
+		__need_loop_24 = __i_iterator.first(__context__,(__i_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __i_iterator.next(__context__,(__i_rename_at_24)) )
+		{
+			SimPolicy<float4>::SetAdd((char *)&(__sumV_rename_at_23),SimPolicy<float4>::Exp(SimPolicy<float4>::RcpEst(SimPolicy<float4>::Add(v_splats(__i_rename_at_24 * 16),v_make_vec4f(1.f,2.f,3.f,4.f),*__context__),*__context__),*__context__),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_24));
+	};
+	return das_auto_cast<float>::cast(((v_extract_x(__sumV_rename_at_23) /*x*/ + v_extract_y(__sumV_rename_at_23) /*y*/) + v_extract_z(__sumV_rename_at_23) /*z*/) + v_extract_w(__sumV_rename_at_23) /*w*/);
+}
+
+inline bool test_63c24446d01126ae ( Context * __context__ ) { das_stack_prologue __prologue(__context__,288,"test " DAS_FILE_LINE);
+{
+	float __f1_rename_at_36 = 0.f;
+	builtin_profile(20,((char *) "exp loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f1_rename_at_36,_Func_0x60_expLoop_ac6bfcac5395af(__context__,1000000));
+	}),__context__);
+	float __f2_rename_at_40 = 0.f;
+	builtin_profile(20,((char *) "exp loop, unrolled"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f2_rename_at_40,_Func_0x60_expLoopU_1b99ab603d5689b2(__context__,1000000));
+	}),__context__);
+	float __f3_rename_at_44 = 0.f;
+	builtin_profile(20,((char *) "exp loop, unrolled and vectorized"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f3_rename_at_44,_Func_0x60_expLoopUV_edaace1a82e0f30(__context__,1000000));
+	}),__context__);
+	float __f4_rename_at_48 = 0.f;
+	builtin_profile(20,((char *) "c++ exp loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f4_rename_at_48,testExpLoop(1000000));
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_expLoop_ac6bfcac5395af
+		aotLib[0xb0d48019ce18449d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int32_t  ),&_Func_0x60_expLoop_ac6bfcac5395af>>();
+	};
+		// _Func_0x60_expLoopU_1b99ab603d5689b2
+		aotLib[0xabdec4ea9087a925] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int32_t  ),&_Func_0x60_expLoopU_1b99ab603d5689b2>>();
+	};
+		// _Func_0x60_expLoopUV_edaace1a82e0f30
+		aotLib[0x40f36777c8e44b59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int32_t  ),&_Func_0x60_expLoopUV_edaace1a82e0f30>>();
+	};
+		// test_63c24446d01126ae
+		aotLib[0xf844d9ff910d350] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_63c24446d01126ae>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,135 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline int32_t _Func_0x60_fibI_f2ea8fca404aef2c ( Context * __context__, int32_t __n_rename_at_12 );
+inline int32_t _Func_0x60_fibR_27fece49b72cf04d ( Context * __context__, int32_t __n_rename_at_6 );
+inline bool test_9efcfc85d5c2cd67 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_fibI_f2ea8fca404aef2c ( Context * __context__, int32_t __n_rename_at_12 )
+{
+	int32_t __last_rename_at_13 = 0;
+	int32_t __cur_rename_at_14 = 1;
+	{
+		bool __need_loop_15 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_12 - 1));
+		int32_t __i_rename_at_15;
+		__need_loop_15 = __i_iterator.first(__context__,(__i_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __i_iterator.next(__context__,(__i_rename_at_15)) )
+		{
+			int32_t __tmp_rename_at_16 = ((int32_t)__cur_rename_at_14);
+			__cur_rename_at_14 += __last_rename_at_13;
+			das_copy(__last_rename_at_13,__tmp_rename_at_16);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_15));
+	};
+	return das_auto_cast<int32_t>::cast(__cur_rename_at_14);
+}
+
+inline int32_t _Func_0x60_fibR_27fece49b72cf04d ( Context * __context__, int32_t __n_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_6 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_6) : das_auto_cast<int32_t>::cast((_Func_0x60_fibR_27fece49b72cf04d(__context__,__n_rename_at_6 - 1) + _Func_0x60_fibR_27fece49b72cf04d(__context__,__n_rename_at_6 - 2))));
+}
+
+inline bool test_9efcfc85d5c2cd67 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,288,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_23 = 0;
+	builtin_profile(20,((char *) "fibbonacci loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f1_rename_at_23,_Func_0x60_fibI_f2ea8fca404aef2c(__context__,6511134));
+	}),__context__);
+	DAS_ASSERT((__f1_rename_at_23 == 1781508648));
+	int32_t __f3_rename_at_27 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f3_rename_at_27,_Func_0x60_fibR_27fece49b72cf04d(__context__,31));
+	}),__context__);
+	DAS_ASSERT((__f3_rename_at_27 == 1346269));
+	int32_t __f4_rename_at_31 = 0;
+	builtin_profile(20,((char *) "fibbonacci loop c++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f4_rename_at_31,testFibI(6511134));
+	}),__context__);
+	DAS_ASSERT((__f4_rename_at_31 == 1781508648));
+	int32_t __f5_rename_at_35 = 0;
+	builtin_profile(20,((char *) "fibbonacci recursive c++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f5_rename_at_35,testFibR(31));
+	}),__context__);
+	DAS_ASSERT((__f5_rename_at_35 == 1346269));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_fibI_f2ea8fca404aef2c
+		aotLib[0x72a351bfd9f66715] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibI_f2ea8fca404aef2c>>();
+	};
+		// _Func_0x60_fibR_27fece49b72cf04d
+		aotLib[0x8023dd75306500cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_fibR_27fece49b72cf04d>>();
+	};
+		// test_9efcfc85d5c2cd67
+		aotLib[0xa85ab012dcbd3705] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9efcfc85d5c2cd67>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
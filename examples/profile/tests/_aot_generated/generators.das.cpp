@@ -0,0 +1,840 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require functional
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__9e8775b1;
+extern StructInfo __struct_info__1f033dbb;
+extern StructInfo __struct_info__2073cac9;
+extern StructInfo __struct_info__ce73aa07;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__2dd8fa39;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__100f1dc6;
+extern TypeInfo __type_info__e6eb2af7;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__b1b9f91f;
+extern TypeInfo __type_info__d0a33ab;
+extern TypeInfo __type_info__5c60d9e3;
+extern TypeInfo __type_info__8e6b03e1;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__90568f79;
+extern TypeInfo __type_info__aee6cd01;
+extern VarInfo __var_info__a32c1b80;
+extern VarInfo __var_info__3458f7c0;
+extern VarInfo __var_info__67149d06;
+extern VarInfo __var_info__4b8e72ad;
+extern VarInfo __var_info__58895192;
+extern VarInfo __var_info__b1067dba;
+extern VarInfo __var_info__90fc67cb;
+extern VarInfo __var_info__7ff078fc;
+extern VarInfo __var_info__2b5f5247;
+extern VarInfo __var_info__e677b52f;
+extern VarInfo __var_info__6c23d5d1;
+extern VarInfo __var_info__281aa286;
+extern VarInfo __var_info__70634ad4;
+extern VarInfo __var_info__59ac1702;
+extern VarInfo __var_info__4cd4ae7e;
+extern VarInfo __var_info__ac37da3d;
+extern VarInfo __var_info__bbb543c2;
+extern VarInfo __var_info__b200de7c;
+extern VarInfo __var_info__b6db1b23;
+extern VarInfo __var_info__261c84c2;
+extern VarInfo __var_info__33a5bde8;
+extern VarInfo __var_info__b20706b0;
+extern VarInfo __var_info__ce6336d2;
+extern VarInfo __var_info__301da724;
+extern FuncInfo __func_info__9c1ebcad;
+extern FuncInfo __func_info__2c47cca3;
+extern FuncInfo __func_info__7525326e;
+
+TypeInfo * __type_info__b1067dba_arg_types_var_2659677617[2] = { &__type_info__8e6b03e1, &__type_info__e6eb6b88 };
+VarInfo __struct_info__9e8775b1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__b1067dba_arg_types_var_2659677617, nullptr, 2, 0, nullptr, 28, 0xb1067dba, "__lambda", 0 };
+TypeInfo * __type_info__e677b52f_arg_types_var_2659677617[1] = { &__type_info__2dd8fa39 };
+VarInfo __struct_info__9e8775b1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e677b52f_arg_types_var_2659677617, nullptr, 1, 0, nullptr, 28, 0xe677b52f, "__finalize", 4 };
+VarInfo __struct_info__9e8775b1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4cd4ae7e, "__yield", 8 };
+TypeInfo * __type_info__281aa286_arg_types_var_2659677617[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__9e8775b1_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__281aa286_arg_types_var_2659677617, nullptr, 1, 0, nullptr, 0, 0x281aa286, "blk", 16 };
+VarInfo __struct_info__9e8775b1_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x90fc67cb, "src", 24 };
+VarInfo __struct_info__9e8775b1_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbbb543c2, "_loop_at_10", 32 };
+VarInfo __struct_info__9e8775b1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x67149d06, "_source_0_at_10", 40 };
+VarInfo __struct_info__9e8775b1_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb20706b0, "w", 48 };
+VarInfo __struct_info__9e8775b1_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x59ac1702, "_pvar_0_at_10", 56 };
+VarInfo * __struct_info__9e8775b1_fields[9] =  { &__struct_info__9e8775b1_field_0, &__struct_info__9e8775b1_field_1, &__struct_info__9e8775b1_field_2, &__struct_info__9e8775b1_field_3, &__struct_info__9e8775b1_field_4, &__struct_info__9e8775b1_field_5, &__struct_info__9e8775b1_field_6, &__struct_info__9e8775b1_field_7, &__struct_info__9e8775b1_field_8 };
+StructInfo __struct_info__9e8775b1 = {"_lambda_thismodule_10_12_2", __struct_info__9e8775b1_fields, 9, 64, -1, nullptr, 0x9e8775b1 };
+TypeInfo * __type_info__33a5bde8_arg_types_var_520306107[2] = { &__type_info__d0a33ab, &__type_info__100f1dc6 };
+VarInfo __struct_info__1f033dbb_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__33a5bde8_arg_types_var_520306107, nullptr, 2, 0, nullptr, 28, 0x33a5bde8, "__lambda", 0 };
+TypeInfo * __type_info__ac37da3d_arg_types_var_520306107[1] = { &__type_info__5c60d9e3 };
+VarInfo __struct_info__1f033dbb_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ac37da3d_arg_types_var_520306107, nullptr, 1, 0, nullptr, 28, 0xac37da3d, "__finalize", 4 };
+VarInfo __struct_info__1f033dbb_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb200de7c, "__yield", 8 };
+TypeInfo * __type_info__7ff078fc_arg_types_var_520306107[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__1f033dbb_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, (TypeInfo **)__type_info__7ff078fc_arg_types_var_520306107, nullptr, 1, 0, nullptr, 0, 0x7ff078fc, "blk", 16 };
+VarInfo __struct_info__1f033dbb_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4b8e72ad, "src", 24 };
+VarInfo __struct_info__1f033dbb_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3458f7c0, "_loop_at_32", 32 };
+VarInfo __struct_info__1f033dbb_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa32c1b80, "_source_0_at_32", 40 };
+VarInfo __struct_info__1f033dbb_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x58895192, "w", 48 };
+VarInfo __struct_info__1f033dbb_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70634ad4, "_pvar_0_at_32", 56 };
+VarInfo * __struct_info__1f033dbb_fields[9] =  { &__struct_info__1f033dbb_field_0, &__struct_info__1f033dbb_field_1, &__struct_info__1f033dbb_field_2, &__struct_info__1f033dbb_field_3, &__struct_info__1f033dbb_field_4, &__struct_info__1f033dbb_field_5, &__struct_info__1f033dbb_field_6, &__struct_info__1f033dbb_field_7, &__struct_info__1f033dbb_field_8 };
+StructInfo __struct_info__1f033dbb = {"_lambda_thismodule_32_12_4", __struct_info__1f033dbb_fields, 9, 64, -1, nullptr, 0x1f033dbb };
+TypeInfo * __type_info__261c84c2_arg_types_var_544459465[2] = { &__type_info__90568f79, &__type_info__359c1b32 };
+VarInfo __struct_info__2073cac9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, (TypeInfo **)__type_info__261c84c2_arg_types_var_544459465, nullptr, 2, 0, nullptr, 28, 0x261c84c2, "__lambda", 0 };
+TypeInfo * __type_info__2b5f5247_arg_types_var_544459465[1] = { &__type_info__aee6cd01 };
+VarInfo __struct_info__2073cac9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2b5f5247_arg_types_var_544459465, nullptr, 1, 0, nullptr, 28, 0x2b5f5247, "__finalize", 4 };
+VarInfo * __struct_info__2073cac9_fields[2] =  { &__struct_info__2073cac9_field_0, &__struct_info__2073cac9_field_1 };
+StructInfo __struct_info__2073cac9 = {"_lambda_thismodule_29_22_3", __struct_info__2073cac9_fields, 2, 8, -1, nullptr, 0x2073cac9 };
+TypeInfo * __type_info__301da724_arg_types_var_3463686663[2] = { &__type_info__e6eb2af7, &__type_info__359c1b32 };
+VarInfo __struct_info__ce73aa07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__301da724_arg_types_var_3463686663, nullptr, 2, 0, nullptr, 28, 0x301da724, "__lambda", 0 };
+TypeInfo * __type_info__6c23d5d1_arg_types_var_3463686663[1] = { &__type_info__b1b9f91f };
+VarInfo __struct_info__ce73aa07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c23d5d1_arg_types_var_3463686663, nullptr, 1, 0, nullptr, 28, 0x6c23d5d1, "__finalize", 4 };
+VarInfo __struct_info__ce73aa07_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb6db1b23, "mod", 8 };
+VarInfo * __struct_info__ce73aa07_fields[3] =  { &__struct_info__ce73aa07_field_0, &__struct_info__ce73aa07_field_1, &__struct_info__ce73aa07_field_2 };
+StructInfo __struct_info__ce73aa07 = {"_lambda_thismodule_28_25_1", __struct_info__ce73aa07_fields, 3, 12, -1, nullptr, 0xce73aa07 };
+VarInfo __func_info__9c1ebcad_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xce6336d2, "x", 0 };
+VarInfo * __func_info__9c1ebcad_fields[1] =  { &__func_info__9c1ebcad_field_0 };
+FuncInfo __func_info__9c1ebcad = {"invoke block<(x:int const):bool> const", "", __func_info__9c1ebcad_fields, 1, 32, &__type_info__c894953d, nullptr,0,0x9c1ebcad, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+VarInfo __func_info__7525326e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xce6336d2, "x", 0 };
+VarInfo * __func_info__7525326e_fields[1] =  { &__func_info__7525326e_field_0 };
+FuncInfo __func_info__7525326e = {"invoke block<(x:int const):string> const", "", __func_info__7525326e_fields, 1, 32, &__type_info__17c16538, nullptr,0,0x7525326e, 0x0 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__2dd8fa39 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e6b03e1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2dd8fa39 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__100f1dc6 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 261, 0x100f1dc6 };
+TypeInfo __type_info__e6eb2af7 = { Type::tStructure, &__struct_info__ce73aa07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xe6eb2af7 };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xe6eb6b88 };
+TypeInfo __type_info__b1b9f91f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e6eb2af7, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb1b9f91f };
+TypeInfo __type_info__d0a33ab = { Type::tStructure, &__struct_info__1f033dbb, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd0a33ab };
+TypeInfo __type_info__5c60d9e3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d0a33ab, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x5c60d9e3 };
+TypeInfo __type_info__8e6b03e1 = { Type::tStructure, &__struct_info__9e8775b1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8e6b03e1 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__90568f79 = { Type::tStructure, &__struct_info__2073cac9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x90568f79 };
+TypeInfo __type_info__aee6cd01 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90568f79, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaee6cd01 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+namespace  {
+
+struct _lambda_thismodule_28_25_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_28_25_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_28_25_1 *)) __finalize;
+	int32_t mod;
+};
+static_assert(sizeof(_lambda_thismodule_28_25_1)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_28_25_1,mod)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_2 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_2)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_loop_at_10)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_source_0_at_10)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_2,_pvar_0_at_10)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_29_22_3 {
+	Func DAS_COMMENT((char *,_lambda_thismodule_29_22_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_29_22_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_29_22_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_29_22_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_4,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_4 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((char *,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_4)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_loop_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_source_0_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_4,_pvar_0_at_32)==56,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_10_12_2_0x60_finazlier_3b31d472bdaca78 ( Context * __context__, _lambda_thismodule_10_12_2 * ____this_rename_at_10 );
+inline bool _Func_lambda_thismodule_10_12_2_0x60_function_885e6f3a1a8af903 ( Context * __context__, _lambda_thismodule_10_12_2 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa ( Context * __context__, _lambda_thismodule_28_25_1 * ____this_rename_at_28 );
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_445e008ef7889a7b ( Context * __context__, _lambda_thismodule_28_25_1 & ____this_rename_at_28, int32_t __x_rename_at_28 );
+inline void _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2 ( Context * __context__, _lambda_thismodule_29_22_3 * ____this_rename_at_29 );
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6 ( Context * __context__, _lambda_thismodule_29_22_3 & ____this_rename_at_29, int32_t __x_rename_at_29 );
+inline void _Func_lambda_thismodule_32_12_4_0x60_finazlier_9c07fc7f62d8b294 ( Context * __context__, _lambda_thismodule_32_12_4 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_4_0x60_function_5b7b54bae475f16d ( Context * __context__, _lambda_thismodule_32_12_4 & ____this_rename_at_32, char * & ___yield_32_rename_at_32 );
+inline TArray<int32_t> _Func_0x60_filter_a_9146f36f36397e64 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  & __blk_rename_at_18 );
+inline TArray<char *> _Func_0x60_map_a_513b284512f69cd9 ( Context * __context__, TArray<int32_t> const  & __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  & __blk_rename_at_11 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_31d2cd3491af42fa ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_e6d64169939e4a2e ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> & __Arr_rename_at_37, char * const  __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline TArray<int32_t> each_a_d0379357401f0b2c ( Context * __context__, range __r_rename_at_4 );
+inline void finalize_8920091bb385c707 ( Context * __context__, _lambda_thismodule_10_12_2 & ____this_rename_at_10 );
+inline void finalize_f94c41bed51a4305 ( Context * __context__, _lambda_thismodule_28_25_1 & ____this_rename_at_28 );
+inline void finalize_e1706409876a0e93 ( Context * __context__, _lambda_thismodule_29_22_3 & ____this_rename_at_29 );
+inline void finalize_bf877e12d998a1d ( Context * __context__, _lambda_thismodule_32_12_4 & ____this_rename_at_32 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_a12e33e435769dec ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_3af12f0f23e589e2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_bea2b62af595a1c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_29 );
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_aac3ad3dbf2f9b8c ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_d5d83d190f2a2cc9 ( Context * __context__ );
+inline char * const  testArr_9e171106ca9860be ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 );
+inline char * const  testGen_186e9b944859a528 ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 );
+inline char * const  testLoop_dbfd6ebf234eb558 ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_10_12_2_0x60_finazlier_3b31d472bdaca78 ( Context * __context__, _lambda_thismodule_10_12_2 * ____this_rename_at_10 )
+{
+	finalize_8920091bb385c707(__context__,das_arg<_lambda_thismodule_10_12_2>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_2 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline bool _Func_lambda_thismodule_10_12_2_0x60_function_885e6f3a1a8af903 ( Context * __context__, _lambda_thismodule_10_12_2 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa ( Context * __context__, _lambda_thismodule_28_25_1 * ____this_rename_at_28 )
+{
+	finalize_f94c41bed51a4305(__context__,das_arg<_lambda_thismodule_28_25_1>::pass(das_deref(__context__,____this_rename_at_28)));
+	das_delete_lambda_struct<_lambda_thismodule_28_25_1 *>::clear(__context__,____this_rename_at_28);
+}
+
+inline bool _Func_lambda_thismodule_28_25_1_0x60_function_445e008ef7889a7b ( Context * __context__, _lambda_thismodule_28_25_1 &  ____this_rename_at_28, int32_t __x_rename_at_28 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_28,____this_rename_at_28.mod,*__context__)) == 0);
+}
+
+inline void _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2 ( Context * __context__, _lambda_thismodule_29_22_3 * ____this_rename_at_29 )
+{
+	finalize_e1706409876a0e93(__context__,das_arg<_lambda_thismodule_29_22_3>::pass(das_deref(__context__,____this_rename_at_29)));
+	das_delete_lambda_struct<_lambda_thismodule_29_22_3 *>::clear(__context__,____this_rename_at_29);
+}
+
+inline char * _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6 ( Context * __context__, _lambda_thismodule_29_22_3 &  ____this_rename_at_29, int32_t __x_rename_at_29 )
+{
+	return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(__x_rename_at_29))));
+}
+
+inline void _Func_lambda_thismodule_32_12_4_0x60_finazlier_9c07fc7f62d8b294 ( Context * __context__, _lambda_thismodule_32_12_4 * ____this_rename_at_32 )
+{
+	finalize_bf877e12d998a1d(__context__,das_arg<_lambda_thismodule_32_12_4>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_4 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_4_0x60_function_5b7b54bae475f16d ( Context * __context__, _lambda_thismodule_32_12_4 &  ____this_rename_at_32, char * & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<char *>::invoke<int32_t>(__context__,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline TArray<int32_t> _Func_0x60_filter_a_9146f36f36397e64 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_18, Block DAS_COMMENT((bool,int32_t)) const  &  __blk_rename_at_18 )
+{
+	TArray<int32_t> __a_rename_at_19; das_zero(__a_rename_at_19);
+	{
+		bool __need_loop_20 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_18);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) )
+		{
+			if ( das_invoke<bool>::invoke<int32_t>(__context__,__blk_rename_at_18,(*__x_rename_at_20)) )
+			{
+				_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_19),(*__x_rename_at_20));
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__a_rename_at_19);
+}
+
+inline TArray<char *> _Func_0x60_map_a_513b284512f69cd9 ( Context * __context__, TArray<int32_t> const  &  __src_rename_at_11, Block DAS_COMMENT((char *,int32_t)) const  &  __blk_rename_at_11 )
+{
+	TArray<char *> __a_rename_at_12; das_zero(__a_rename_at_12);
+	_Funcbuiltin_0x60_reserve_cecea833d1e66117(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),builtin_array_size(__src_rename_at_11));
+	{
+		bool __need_loop_14 = true;
+		// x : int aka TT const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__src_rename_at_11);
+		int32_t const  * __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) )
+		{
+			_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_12),das_invoke<char *>::invoke<int32_t>(__context__,__blk_rename_at_11,(*__x_rename_at_14)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+	};
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__a_rename_at_12);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_31d2cd3491af42fa ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_e6d64169939e4a2e ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> &  __Arr_rename_at_37, char * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_cecea833d1e66117 ( Context * __context__, TArray<char *> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<char *>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,8,__context__);
+}
+
+inline TArray<int32_t> each_a_d0379357401f0b2c ( Context * __context__, range __r_rename_at_4 )
+{
+	TArray<int32_t> __a_rename_at_5; das_zero(__a_rename_at_5);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),v_extract_yi(v_cast_vec4i(__r_rename_at_4)) /*y*/ - v_extract_xi(v_cast_vec4i(__r_rename_at_4)) /*x*/);
+	{
+		bool __need_loop_7 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(__r_rename_at_4);
+		int32_t __x_rename_at_7;
+		__need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_5),__x_rename_at_7);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_7));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__a_rename_at_5);
+}
+
+inline void finalize_8920091bb385c707 ( Context * __context__, _lambda_thismodule_10_12_2 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 64);
+}
+
+inline void finalize_f94c41bed51a4305 ( Context * __context__, _lambda_thismodule_28_25_1 &  ____this_rename_at_28 )
+{
+	memset(&(____this_rename_at_28), 0, 12);
+}
+
+inline void finalize_e1706409876a0e93 ( Context * __context__, _lambda_thismodule_29_22_3 &  ____this_rename_at_29 )
+{
+	memset(&(____this_rename_at_29), 0, 8);
+}
+
+inline void finalize_bf877e12d998a1d ( Context * __context__, _lambda_thismodule_32_12_4 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 64);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_a12e33e435769dec(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_a12e33e435769dec ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_31d2cd3491af42fa(__context__,das_ascend<bool,_lambda_thismodule_10_12_2>::make(__context__,&__type_info__8e6b03e1,(([&]() -> _lambda_thismodule_10_12_2 {
+		_lambda_thismodule_10_12_2 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_2`function _lambda_thismodule_10_12_2 int#ref*/ 1855876774u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_2`finazlier #ptr#_lambda_thismodule_10_12_2#explicit*/ 3820245990u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_3af12f0f23e589e2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((char *,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcfunctional_0x60_map_any_bea2b62af595a1c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcfunctional_0x60_map_any_bea2b62af595a1c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((char *,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_e6d64169939e4a2e(__context__,das_ascend<bool,_lambda_thismodule_32_12_4>::make(__context__,&__type_info__d0a33ab,(([&]() -> _lambda_thismodule_32_12_4 {
+		_lambda_thismodule_32_12_4 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_4`function _lambda_thismodule_32_12_4 string#ref*/ 2754967360u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_4`finazlier #ptr#_lambda_thismodule_32_12_4#explicit*/ 1889562186u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_16);
+			char * const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_aac3ad3dbf2f9b8c ( Context * __context__, Sequence DAS_COMMENT((char *)) const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const
+			das_iterator<Sequence DAS_COMMENT((char *)) const > __elem_iterator(__it_rename_at_16);
+			char * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline bool test_d5d83d190f2a2cc9 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	char * __s1_rename_at_57 = 0; char * __s2_rename_at_57 = 0; char * __s3_rename_at_57 = 0;
+	builtin_profile(40,((char *) "testLoop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s1_rename_at_57,testLoop_dbfd6ebf234eb558(__context__,1000000,99961));
+	}),__context__);
+	builtin_profile(40,((char *) "testGen"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s2_rename_at_57,testGen_186e9b944859a528(__context__,1000000,99961));
+	}),__context__);
+	builtin_profile(40,((char *) "testArr"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__s3_rename_at_57,testArr_9e171106ca9860be(__context__,1000000,99961));
+	}),__context__);
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s2_rename_at_57),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__s1_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__s2_rename_at_57),cast<char *>::from(__s3_rename_at_57),*__context__))));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline char * const  testArr_9e171106ca9860be ( Context * __context__, int32_t __total_rename_at_33, int32_t __mod_rename_at_33 ) { das_stack_prologue __prologue(__context__,256,"testArr " DAS_FILE_LINE);
+{
+	TArray<int32_t> __a1_rename_at_34; memset(&__a1_rename_at_34,0,sizeof(__a1_rename_at_34));
+	TArray<int32_t> __a2_rename_at_35; memset(&__a2_rename_at_35,0,sizeof(__a2_rename_at_35));
+	TArray<char *> __a3_rename_at_36; memset(&__a3_rename_at_36,0,sizeof(__a3_rename_at_36));
+/* finally */ auto __finally_34= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36));
+/* end finally */ });
+	__a1_rename_at_34; das_zero(__a1_rename_at_34); das_move(__a1_rename_at_34, each_a_d0379357401f0b2c(__context__,mk_range(__total_rename_at_33)));
+	__a2_rename_at_35; das_zero(__a2_rename_at_35); das_move(__a2_rename_at_35, _Func_0x60_filter_a_9146f36f36397e64(__context__,das_arg<TArray<int32_t>>::pass(__a1_rename_at_34),das_make_block<bool,int32_t>(__context__,144,0,&__func_info__9c1ebcad,[&](int32_t const  __x_rename_at_35)->bool{
+		return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_35,__mod_rename_at_33,*__context__)) == 0);
+	})));
+	__a3_rename_at_36; das_zero(__a3_rename_at_36); das_move(__a3_rename_at_36, _Func_0x60_map_a_513b284512f69cd9(__context__,das_arg<TArray<int32_t>>::pass(__a2_rename_at_35),das_make_block<char *,int32_t>(__context__,240,0,&__func_info__7525326e,[&](int32_t const  __x_rename_at_36)->char *{
+		return das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<int32_t>::from(__x_rename_at_36))));
+	})));
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(__a3_rename_at_36),((char *) ",")));
+}}
+
+inline char * const  testGen_186e9b944859a528 ( Context * __context__, int32_t __total_rename_at_25, int32_t __mod_rename_at_25 )
+{
+	Sequence DAS_COMMENT((char *)) _temp_make_local_29_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_28_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_27_64;
+	return das_auto_cast<char * const >::cast(_Funcstrings_boost_0x60_join_aac3ad3dbf2f9b8c(__context__,das_arg<Sequence DAS_COMMENT((char *))>::pass((_temp_make_local_29_32 = (_Funcfunctional_0x60_map_3af12f0f23e589e2(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_28_48 = (_Funcfunctional_0x60_filter_8cf8f8edf9d0fb39(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_64 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(__total_rename_at_25))))),das_ascend<bool,_lambda_thismodule_28_25_1>::make(__context__,&__type_info__e6eb2af7,(([&]() -> _lambda_thismodule_28_25_1 {
+		_lambda_thismodule_28_25_1 __mks_28;
+		das_copy((__mks_28.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_25_1`function _lambda_thismodule_28_25_1 int#const*/ 21626728u))));
+		das_copy((__mks_28.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_28_25_1`finazlier #ptr#_lambda_thismodule_28_25_1#explicit*/ 2219428182u))));
+		das_copy((__mks_28.mod),(__mod_rename_at_25));
+		return __mks_28;
+	})())))))),das_ascend<char *,_lambda_thismodule_29_22_3>::make(__context__,&__type_info__90568f79,(([&]() -> _lambda_thismodule_29_22_3 {
+		_lambda_thismodule_29_22_3 __mks_29;
+		das_copy((__mks_29.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_29_22_3`function _lambda_thismodule_29_22_3 int#const*/ 525847120u))));
+		das_copy((__mks_29.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_29_22_3`finazlier #ptr#_lambda_thismodule_29_22_3#explicit*/ 2472563846u))));
+		return __mks_29;
+	})())))))),((char *) ",")));
+}
+
+inline char * const  testLoop_dbfd6ebf234eb558 ( Context * __context__, int32_t __total_rename_at_43, int32_t __mod_rename_at_43 )
+{
+	char * __st_rename_at_44 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_44)->void{
+		bool __skip_first_rename_at_45 = true;
+		{
+			bool __need_loop_46 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(mk_range(__total_rename_at_43));
+			int32_t __t_rename_at_46;
+			__need_loop_46 = __t_iterator.first(__context__,(__t_rename_at_46)) && __need_loop_46;
+			for ( ; __need_loop_46 ; __need_loop_46 = __t_iterator.next(__context__,(__t_rename_at_46)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__t_rename_at_46,__mod_rename_at_43,*__context__)) == 0 )
+				{
+					if ( __skip_first_rename_at_45 )
+					{
+						das_copy(__skip_first_rename_at_45,false);
+					} else {
+						das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char * const >::from(((char *) ","))));
+					};
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_44),cast<char *>::from(((char *)(das_lexical_cast(__t_rename_at_46,__context__))))));
+				};
+			}
+			__t_iterator.close(__context__,(__t_rename_at_46));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_44);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_10_12_2_0x60_finazlier_3b31d472bdaca78
+		aotLib[0x57f2e31d9bd228ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_2 *  ),&_Func_lambda_thismodule_10_12_2_0x60_finazlier_3b31d472bdaca78>>();
+	};
+		// _Func_lambda_thismodule_10_12_2_0x60_function_885e6f3a1a8af903
+		aotLib[0x276d1d88f0a8cfb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_2 & , int32_t &  ),&_Func_lambda_thismodule_10_12_2_0x60_function_885e6f3a1a8af903>>();
+	};
+		// _Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa
+		aotLib[0xd9923cd2f532dd66] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_28_25_1 *  ),&_Func_lambda_thismodule_28_25_1_0x60_finazlier_7af8d6a610c46dfa>>();
+	};
+		// _Func_lambda_thismodule_28_25_1_0x60_function_445e008ef7889a7b
+		aotLib[0xa10d3ac0fd11d74d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_28_25_1 & , int32_t  ),&_Func_lambda_thismodule_28_25_1_0x60_function_445e008ef7889a7b>>();
+	};
+		// _Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2
+		aotLib[0x6331fba0aacaa799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_29_22_3 *  ),&_Func_lambda_thismodule_29_22_3_0x60_finazlier_f65f2b86545deee2>>();
+	};
+		// _Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6
+		aotLib[0xd6dadcd24c146941] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, _lambda_thismodule_29_22_3 & , int32_t  ),&_Func_lambda_thismodule_29_22_3_0x60_function_aa342d51f0f4fdc6>>();
+	};
+		// _Func_lambda_thismodule_32_12_4_0x60_finazlier_9c07fc7f62d8b294
+		aotLib[0x6a10d8ec4b6ebb55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_4 *  ),&_Func_lambda_thismodule_32_12_4_0x60_finazlier_9c07fc7f62d8b294>>();
+	};
+		// _Func_lambda_thismodule_32_12_4_0x60_function_5b7b54bae475f16d
+		aotLib[0x778947372b45b379] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_4 & , char * &  ),&_Func_lambda_thismodule_32_12_4_0x60_function_5b7b54bae475f16d>>();
+	};
+		// _Func_0x60_filter_a_9146f36f36397e64
+		aotLib[0xdff412fa5a6ad606] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((bool,int32_t)) const  &  ),&_Func_0x60_filter_a_9146f36f36397e64>>();
+	};
+		// _Func_0x60_map_a_513b284512f69cd9
+		aotLib[0x626ae4711dbcaabc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((char *,int32_t)) const  &  ),&_Func_0x60_map_a_513b284512f69cd9>>();
+	};
+		// _Funcbuiltin_0x60_each_31d2cd3491af42fa
+		aotLib[0x8353e962f318f4a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_31d2cd3491af42fa>>();
+	};
+		// _Funcbuiltin_0x60_each_e6d64169939e4a2e
+		aotLib[0x6cb69be5a9c6c4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_e6d64169939e4a2e>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_push_5caef1f118709d18
+		aotLib[0x80f7de2e45124cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_5caef1f118709d18>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_reserve_cecea833d1e66117
+		aotLib[0x58482c2f23d3c0ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_reserve_cecea833d1e66117>>();
+	};
+		// each_a_d0379357401f0b2c
+		aotLib[0xac0177ebac920023] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, range  ),&each_a_d0379357401f0b2c>>();
+	};
+		// finalize_8920091bb385c707
+		aotLib[0x541d9cdc5884c2bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_2 &  ),&finalize_8920091bb385c707>>();
+	};
+		// finalize_f94c41bed51a4305
+		aotLib[0x69916fbd96421fb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_28_25_1 &  ),&finalize_f94c41bed51a4305>>();
+	};
+		// finalize_e1706409876a0e93
+		aotLib[0x4ade1653eda56265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_29_22_3 &  ),&finalize_e1706409876a0e93>>();
+	};
+		// finalize_bf877e12d998a1d
+		aotLib[0x51b1c513b90fdcc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_4 &  ),&finalize_bf877e12d998a1d>>();
+	};
+		// _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39
+		aotLib[0x55b0de8dcfd47ebe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_8cf8f8edf9d0fb39>>();
+	};
+		// _Funcfunctional_0x60_filter_any_a12e33e435769dec
+		aotLib[0x1650692690c1c318] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_a12e33e435769dec>>();
+	};
+		// _Funcfunctional_0x60_map_3af12f0f23e589e2
+		aotLib[0x1ec9415dde285e05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t)) const   ),&_Funcfunctional_0x60_map_3af12f0f23e589e2>>();
+	};
+		// _Funcfunctional_0x60_map_any_bea2b62af595a1c
+		aotLib[0xd9d7c5b2b2e46ae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((char *,int32_t))  ),&_Funcfunctional_0x60_map_any_bea2b62af595a1c>>();
+	};
+		// _Funcstrings_boost_0x60_join_48fb6c570d4c5eba
+		aotLib[0xea1df6d3de6cdb39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_48fb6c570d4c5eba>>();
+	};
+		// _Funcstrings_boost_0x60_join_aac3ad3dbf2f9b8c
+		aotLib[0x2ecb73f0c1f1ad05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((char *)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_aac3ad3dbf2f9b8c>>();
+	};
+		// test_d5d83d190f2a2cc9
+		aotLib[0x377dd31ef1cd0b74] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d5d83d190f2a2cc9>>();
+	};
+		// testArr_9e171106ca9860be
+		aotLib[0x6019cf9a0ae69eb2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testArr_9e171106ca9860be>>();
+	};
+		// testGen_186e9b944859a528
+		aotLib[0x3e6f9f2fd5b96367] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testGen_186e9b944859a528>>();
+	};
+		// testLoop_dbfd6ebf234eb558
+		aotLib[0xeb7de6d4e47c25b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, int32_t , int32_t  ),&testLoop_dbfd6ebf234eb558>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,107 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool test_c55679ba2c754884 ( Context * __context__ );
+inline int32_t testAdds_ff70a6dc017ff8f7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_c55679ba2c754884 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+	int32_t __count_rename_at_14 = 0;
+	builtin_profile(20,((char *) "native loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__count_rename_at_14,testAdds_ff70a6dc017ff8f7(__context__));
+	}),__context__);
+	DAS_ASSERT((10000000 == __count_rename_at_14));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline int32_t testAdds_ff70a6dc017ff8f7 ( Context * __context__ )
+{
+	int32_t __count_rename_at_7 = 0;
+	{
+		bool __need_loop_8 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10000000));
+		int32_t __i_rename_at_8;
+		__need_loop_8 = __i_iterator.first(__context__,(__i_rename_at_8)) && __need_loop_8;
+		for ( ; __need_loop_8 ; __need_loop_8 = __i_iterator.next(__context__,(__i_rename_at_8)) )
+		{
+			das_copy(__count_rename_at_7,AddOne(__count_rename_at_7));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_8));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_7);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_c55679ba2c754884
+		aotLib[0x8f9a62f9af6c6279] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c55679ba2c754884>>();
+	};
+		// testAdds_ff70a6dc017ff8f7
+		aotLib[0x1e3474eb80c6d015] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&testAdds_ff70a6dc017ff8f7>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,277 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct body {
+	float3 x;
+	float pad;
+	float3 v;
+	float mass;
+};
+static_assert(sizeof(body)==32,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,pad)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,v)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==28,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_nbodies_ea97bdcd47f712d9 ( Context * __context__, int32_t __n_rename_at_83 );
+inline void _Func_0x60_scale_bodies_dc552624246ccfe1 ( Context * __context__, float __scale_rename_at_78, TDim<body,5> & __bodies_rename_at_78 );
+inline void advance_2896ba9ef5867fe2 ( Context * __context__, TDim<body,5> & __bodies_rename_at_48 );
+inline float energy_7dd3e36ad0f74167 ( Context * __context__, TDim<body,5> & __bodies_rename_at_61 );
+inline void offset_momentum_89618acdf21023d9 ( Context * __context__, TDim<body,5> & __bodies_rename_at_42 );
+inline bool test_9843bf2215641b67 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<float,0x71a02929>(__context__) = 39.4784203f;/*SOLAR_MASS*/
+	das_global<TDim<body,5>,0x80127f61>(__context__) = (([&]() -> TDim<body,5> {
+		TDim<body,5> __mks_19;
+		das_zero(__mks_19);
+		das_copy((__mks_19(0,__context__).x),(v_zero()));
+		das_copy((__mks_19(0,__context__).v),(v_zero()));
+		das_copy((__mks_19(0,__context__).mass),(das_global<float,0x71a02929>(__context__) /*SOLAR_MASS*/));
+		das_copy((__mks_19(1,__context__).x),(v_make_vec4f(4.84143162f,-1.16032004f,-0.103622042f,0.f)));
+		das_copy((__mks_19(1,__context__).v),(v_make_vec4f(0.606326401f,2.81198692f,-0.0252183601f,0.f)));
+		das_copy((__mks_19(1,__context__).mass),(0.0376936793f));
+		das_copy((__mks_19(2,__context__).x),(v_make_vec4f(8.34336662f,4.12479877f,-0.403523415f,0.f)));
+		das_copy((__mks_19(2,__context__).v),(v_make_vec4f(-1.01077425f,1.82566226f,0.0084157614f,0.f)));
+		das_copy((__mks_19(2,__context__).mass),(0.0112863267f));
+		das_copy((__mks_19(3,__context__).x),(v_make_vec4f(12.8943691f,-15.1111517f,-0.22330758f,0.f)));
+		das_copy((__mks_19(3,__context__).v),(v_make_vec4f(1.08279097f,0.868712962f,-0.0108326375f,0.f)));
+		das_copy((__mks_19(3,__context__).mass),(0.00172372418f));
+		das_copy((__mks_19(4,__context__).x),(v_make_vec4f(15.3796968f,-25.9193153f,0.179258779f,0.f)));
+		das_copy((__mks_19(4,__context__).v),(v_make_vec4f(0.979090691f,0.594698966f,-0.0347559527f,0.f)));
+		das_copy((__mks_19(4,__context__).mass),(0.00203368696f));
+		return __mks_19;
+	})());/*g_bodies*/
+}
+
+inline void _Func_0x60_nbodies_ea97bdcd47f712d9 ( Context * __context__, int32_t __n_rename_at_83 )
+{
+	_Func_0x60_scale_bodies_dc552624246ccfe1(__context__,0.00999999978f,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+	{
+		bool __need_loop_85 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_83));
+		int32_t __i_rename_at_85;
+		__need_loop_85 = __i_iterator.first(__context__,(__i_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __i_iterator.next(__context__,(__i_rename_at_85)) )
+		{
+			advance_2896ba9ef5867fe2(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_85));
+	};
+	_Func_0x60_scale_bodies_dc552624246ccfe1(__context__,100.f,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+}
+
+inline void _Func_0x60_scale_bodies_dc552624246ccfe1 ( Context * __context__, float __scale_rename_at_78, TDim<body,5> &  __bodies_rename_at_78 )
+{
+	{
+		bool __need_loop_79 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_78);
+		body * __b_rename_at_79;
+		__need_loop_79 = __b_iterator.first(__context__,(__b_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __b_iterator.next(__context__,(__b_rename_at_79)) )
+		{
+			(*__b_rename_at_79).mass *= (__scale_rename_at_78 * __scale_rename_at_78);
+			SimPolicy<float3>::SetMulScal((char *)&((*__b_rename_at_79).v),cast<float>::from(__scale_rename_at_78),*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_79));
+	};
+}
+
+inline void advance_2896ba9ef5867fe2 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_48 )
+{
+	int32_t __i_rename_at_49 = 0;
+	{
+		bool __need_loop_50 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_48);
+		body * __b_rename_at_50;
+		__need_loop_50 = __b_iterator.first(__context__,(__b_rename_at_50)) && __need_loop_50;
+		for ( ; __need_loop_50 ; __need_loop_50 = __b_iterator.next(__context__,(__b_rename_at_50)) )
+		{
+			++__i_rename_at_49;
+			{
+				bool __need_loop_52 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_49,5));
+				int32_t __j_rename_at_52;
+				__need_loop_52 = __j_iterator.first(__context__,(__j_rename_at_52)) && __need_loop_52;
+				for ( ; __need_loop_52 ; __need_loop_52 = __j_iterator.next(__context__,(__j_rename_at_52)) )
+				{
+					body * __b2_rename_at_53 = &(__bodies_rename_at_48(__j_rename_at_52,__context__));
+					float3 __dx_rename_at_54 = ((float3)(SimPolicy<float3>::Sub((*__b_rename_at_50).x,(*__b2_rename_at_53).x,*__context__)));
+					float __inv_distance_rename_at_55 = ((float)invlength3(__dx_rename_at_54));
+					float __mag_rename_at_56 = ((float)((__inv_distance_rename_at_55 * __inv_distance_rename_at_55) * __inv_distance_rename_at_55));
+					SimPolicy<float3>::SetSub((char *)&((*__b_rename_at_50).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b2_rename_at_53).mass * __mag_rename_at_56)),*__context__)),*__context__);
+					SimPolicy<float3>::SetAdd((char *)&((*__b2_rename_at_53).v),(SimPolicy<float3>::MulVecScal(__dx_rename_at_54,cast<float>::from(((*__b_rename_at_50).mass * __mag_rename_at_56)),*__context__)),*__context__);
+				}
+				__j_iterator.close(__context__,(__j_rename_at_52));
+			};
+			SimPolicy<float3>::SetAdd((char *)&((*__b_rename_at_50).x),(*__b_rename_at_50).v,*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_50));
+	};
+}
+
+inline float energy_7dd3e36ad0f74167 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_61 )
+{
+	float __e_rename_at_62 = 0.f;
+	int32_t __i_rename_at_63 = 0;
+	{
+		bool __need_loop_64 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_61);
+		body * __b_rename_at_64;
+		__need_loop_64 = __b_iterator.first(__context__,(__b_rename_at_64)) && __need_loop_64;
+		for ( ; __need_loop_64 ; __need_loop_64 = __b_iterator.next(__context__,(__b_rename_at_64)) )
+		{
+			__e_rename_at_62 += ((0.5f * (*__b_rename_at_64).mass) * lengthSq3((*__b_rename_at_64).v));
+			++__i_rename_at_63;
+			{
+				bool __need_loop_67 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_63,5));
+				int32_t __j_rename_at_67;
+				__need_loop_67 = __j_iterator.first(__context__,(__j_rename_at_67)) && __need_loop_67;
+				for ( ; __need_loop_67 ; __need_loop_67 = __j_iterator.next(__context__,(__j_rename_at_67)) )
+				{
+					body __b2_rename_at_68_ConstRef = ((body)__bodies_rename_at_61(__j_rename_at_67,__context__));
+	body const  & __b2_rename_at_68 = __b2_rename_at_68_ConstRef; ;
+					__e_rename_at_62 -= (SimPolicy<float>::Div(((*__b_rename_at_64).mass * __b2_rename_at_68.mass),distance3((*__b_rename_at_64).x,__b2_rename_at_68.x),*__context__));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_67));
+			};
+		}
+		__b_iterator.close(__context__,(__b_rename_at_64));
+	};
+	return das_auto_cast<float>::cast(__e_rename_at_62);
+}
+
+inline void offset_momentum_89618acdf21023d9 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_42 )
+{
+	float3 __px_rename_at_43 = v_zero();
+	{
+		bool __need_loop_44 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_42);
+		body * __b_rename_at_44;
+		__need_loop_44 = __b_iterator.first(__context__,(__b_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __b_iterator.next(__context__,(__b_rename_at_44)) )
+		{
+			SimPolicy<float3>::SetSub((char *)&(__px_rename_at_43),(SimPolicy<float3>::MulVecScal((*__b_rename_at_44).v,cast<float>::from((*__b_rename_at_44).mass),*__context__)),*__context__);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_44));
+	};
+	das_copy(__bodies_rename_at_42(0,__context__).v,SimPolicy<float3>::DivVecScal(__px_rename_at_43,cast<float>::from(39.4784203f),*__context__));
+}
+
+inline bool test_9843bf2215641b67 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	offset_momentum_89618acdf21023d9(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+	energy_7dd3e36ad0f74167(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+	builtin_profile(10,((char *) "n-bodies"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		_Func_0x60_nbodies_ea97bdcd47f712d9(__context__,500000);
+	}),__context__);
+	energy_7dd3e36ad0f74167(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0x80127f61>(__context__) /*g_bodies*/));
+	testNBodiesInit();
+	builtin_profile(10,((char *) "n-bodies, C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testNBodiesS(500000);
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_nbodies_ea97bdcd47f712d9
+		aotLib[0x18afd915f57636b2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_nbodies_ea97bdcd47f712d9>>();
+	};
+		// _Func_0x60_scale_bodies_dc552624246ccfe1
+		aotLib[0x78718ae55677d0dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float , TDim<body,5> &  ),&_Func_0x60_scale_bodies_dc552624246ccfe1>>();
+	};
+		// advance_2896ba9ef5867fe2
+		aotLib[0xbab58b9e6567ee25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<body,5> &  ),&advance_2896ba9ef5867fe2>>();
+	};
+		// energy_7dd3e36ad0f74167
+		aotLib[0xd644ee7c725390c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TDim<body,5> &  ),&energy_7dd3e36ad0f74167>>();
+	};
+		// offset_momentum_89618acdf21023d9
+		aotLib[0x252e382e404985a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<body,5> &  ),&offset_momentum_89618acdf21023d9>>();
+	};
+		// test_9843bf2215641b67
+		aotLib[0x878f6a64b1dad50b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9843bf2215641b67>>();
+	};
+		// [[ init script ]]
+		aotLib[0x41ff52603c879bc7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
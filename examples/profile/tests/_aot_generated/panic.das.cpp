@@ -0,0 +1,128 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool test_ffe3ca1e29814ebd ( Context * __context__ );
+inline void tryCatch_5d8fac42dfc94f4b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_ffe3ca1e29814ebd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	builtin_profile(20,((char *) "try-recover"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		tryCatch_5d8fac42dfc94f4b(__context__);
+	}),__context__);
+	builtin_profile(20,((char *) "try-recover c++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testTryCatch(__context__);
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void tryCatch_5d8fac42dfc94f4b ( Context * __context__ )
+{
+	TDim<int32_t,1000> __arr_rename_at_5_ConstRef; das_zero(__arr_rename_at_5_ConstRef);
+	TDim<int32_t,1000> const  & __arr_rename_at_5 = __arr_rename_at_5_ConstRef; ;
+	int32_t __cnt_rename_at_6 = 0;
+	{
+		bool __need_loop_7 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,100));
+		int32_t __j_rename_at_7;
+		__need_loop_7 = __j_iterator.first(__context__,(__j_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __j_iterator.next(__context__,(__j_rename_at_7)) )
+		{
+			int32_t __fail_rename_at_8 = 0;
+			{
+				bool __need_loop_9 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,2000));
+				int32_t __i_rename_at_9;
+				__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+				for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+				{
+					das_try_recover(__context__, [&]()
+					{
+						__cnt_rename_at_6 += __arr_rename_at_5(__i_rename_at_9,__context__);
+					}, [&]()
+					{
+						__fail_rename_at_8++;
+					});
+				}
+				__i_iterator.close(__context__,(__i_rename_at_9));
+			};
+			DAS_ASSERT((__fail_rename_at_8 == 1000));
+		}
+		__j_iterator.close(__context__,(__j_rename_at_7));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_ffe3ca1e29814ebd
+		aotLib[0xdb4a7ae8c9e9c2e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ffe3ca1e29814ebd>>();
+	};
+		// tryCatch_5d8fac42dfc94f4b
+		aotLib[0x83053f6353332105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&tryCatch_5d8fac42dfc94f4b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,450 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__c22aaef9;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c8271e89;
+extern VarInfo __var_info__1ba5095c;
+extern VarInfo __var_info__93a8b837;
+extern VarInfo __var_info__61367e18;
+extern VarInfo __var_info__5423e76e;
+extern VarInfo __var_info__22c629bc;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __struct_info__c22aaef9_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1ba5095c, "__rtti", 0 };
+TypeInfo * __type_info__93a8b837_arg_types_var_3257577209[1] = { &__type_info__c8271e89 };
+VarInfo __struct_info__c22aaef9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__93a8b837_arg_types_var_3257577209, nullptr, 1, 0, nullptr, 28, 0x93a8b837, "__finalize", 8 };
+VarInfo __struct_info__c22aaef9_field_2 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x22c629bc, "position", 12 };
+VarInfo __struct_info__c22aaef9_field_3 =  { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x61367e18, "velocity", 24 };
+TypeInfo * __type_info__5423e76e_arg_types_var_3257577209[1] = { &__type_info__c8271e89 };
+VarInfo __struct_info__c22aaef9_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5423e76e_arg_types_var_3257577209, nullptr, 1, 0, nullptr, 28, 0x5423e76e, "update", 36 };
+VarInfo * __struct_info__c22aaef9_fields[5] =  { &__struct_info__c22aaef9_field_0, &__struct_info__c22aaef9_field_1, &__struct_info__c22aaef9_field_2, &__struct_info__c22aaef9_field_3, &__struct_info__c22aaef9_field_4 };
+StructInfo __struct_info__c22aaef9 = {"CObject", __struct_info__c22aaef9_fields, 5, 40, -1, nullptr, 0xc22aaef9 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c8271e89 = { Type::tStructure, &__struct_info__c22aaef9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc8271e89 };
+
+namespace  {
+
+struct CObject {
+	void * __rtti;
+	Func DAS_COMMENT((void,CObject)) __finalize;
+	float3 position;
+	float3 velocity;
+	Func DAS_COMMENT((void,CObject)) update;
+};
+static_assert(sizeof(CObject)==40,"structure size mismatch with DAS");
+static_assert(offsetof(CObject,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,position)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,velocity)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(CObject,update)==36,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct NObject {
+	float3 position;
+	float3 velocity;
+};
+static_assert(sizeof(NObject)==24,"structure size mismatch with DAS");
+static_assert(offsetof(NObject,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(NObject,velocity)==12,"structure field offset mismatch with DAS");
+}
+
+inline CObject CObject_87123050199feed ( Context * __context__, int32_t __i_rename_at_10 );
+inline void _FuncCObject_0x27___finalize_8382388a1fd23bf0 ( Context * __context__, CObject & __self_rename_at_7 );
+inline void _FuncCObject_0x60_CObject_8cdb08a9a857d345 ( Context * __context__, CObject & __self_rename_at_10, int32_t __i_rename_at_10 );
+inline void _FuncCObject_0x60_update_7fe6c0b8f4a260ba ( Context * __context__, CObject & __self_rename_at_13 );
+inline void _Funcbuiltin_0x60_resize_a846d6ac5833aec2 ( Context * __context__, TArray<CObject> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<NObject> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_4d77d82602476a33 ( Context * __context__, CObject & ____this_rename_at_7 );
+inline void init_8bbd89bb768b7702 ( Context * __context__, TArray<CObject> & __objects_rename_at_32 );
+inline void init_82941d53aead50d4 ( Context * __context__, TArray<NObject> & __objects_rename_at_62 );
+inline bool test_f69b8220cae881c6 ( Context * __context__ );
+inline void testMethod_a600be71db1e7e81 ( Context * __context__, TArray<CObject> & __objects_rename_at_24 );
+inline void testMethod2_40619d6ac764bb10 ( Context * __context__, TArray<CObject> & __objects_rename_at_28, int32_t __count_rename_at_28 );
+inline void testSim_adfd4989f8d7ec33 ( Context * __context__, TArray<NObject> & __objects_rename_at_46 );
+inline void testSim2_bbeab7eeeb71c6c6 ( Context * __context__, TArray<NObject> & __objects_rename_at_50, int32_t __count_rename_at_50 );
+inline void testSim2I_c896f816c21c590e ( Context * __context__, TArray<NObject> & __objects_rename_at_58, int32_t __count_rename_at_58 );
+inline void testSimI_64222acb141d178e ( Context * __context__, TArray<NObject> & __objects_rename_at_54 );
+inline void testVirtual_83a7fa591eaf16a ( Context * __context__, TArray<CObject> & __objects_rename_at_16 );
+inline void testVirtual2_255c4936774b33e6 ( Context * __context__, TArray<CObject> & __objects_rename_at_20, int32_t __count_rename_at_20 );
+inline void update_a7d15784abd4b219 ( Context * __context__, NObject & __a_rename_at_43 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline CObject CObject_87123050199feed ( Context * __context__, int32_t __i_rename_at_10 )
+{
+	CObject __self_rename_at_10; das_zero(__self_rename_at_10); das_move(__self_rename_at_10, (([&]() -> CObject {
+		CObject __mks_10;
+		das_zero(__mks_10);
+		das_copy((__mks_10.__rtti),(((void *)(&__type_info__c8271e89))));
+		das_copy((__mks_10.__finalize),(Func(__context__->fnIdxByMangledName(/*CObject'__finalize CObject*/ 3571535988u))));
+		das_copy((__mks_10.update),(Func(__context__->fnIdxByMangledName(/*CObject`update CObject*/ 3664857060u))));
+		return __mks_10;
+	})()));
+	_FuncCObject_0x60_CObject_8cdb08a9a857d345(__context__,das_arg<CObject>::pass(__self_rename_at_10),__i_rename_at_10);
+	return /* <- */ das_auto_cast<CObject>::cast(__self_rename_at_10);
+}
+
+inline void _FuncCObject_0x27___finalize_8382388a1fd23bf0 ( Context * __context__, CObject &  __self_rename_at_7 )
+{
+	finalize_4d77d82602476a33(__context__,das_arg<CObject>::pass(__self_rename_at_7));
+}
+
+inline void _FuncCObject_0x60_CObject_8cdb08a9a857d345 ( Context * __context__, CObject &  __self_rename_at_10, int32_t __i_rename_at_10 )
+{
+	das_copy(__self_rename_at_10.position,float3(__i_rename_at_10,__i_rename_at_10 + 1,__i_rename_at_10 + 2));
+	das_copy(__self_rename_at_10.velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+}
+
+inline void _FuncCObject_0x60_update_7fe6c0b8f4a260ba ( Context * __context__, CObject &  __self_rename_at_13 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__self_rename_at_13.position),__self_rename_at_13.velocity,*__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_a846d6ac5833aec2 ( Context * __context__, TArray<CObject> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<CObject>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,40,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_895b2ff719a60fbf ( Context * __context__, TArray<NObject> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<NObject>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,24,__context__);
+}
+
+inline void finalize_4d77d82602476a33 ( Context * __context__, CObject &  ____this_rename_at_7 )
+{
+	memset(&(____this_rename_at_7), 0, 40);
+}
+
+inline void init_8bbd89bb768b7702 ( Context * __context__, TArray<CObject> &  __objects_rename_at_32 )
+{
+	_Funcbuiltin_0x60_resize_a846d6ac5833aec2(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_32),50000);
+	int32_t __i_rename_at_34 = 0;
+	{
+		bool __need_loop_35 = true;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_32);
+		CObject * __obj_rename_at_35;
+		__need_loop_35 = __obj_iterator.first(__context__,(__obj_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = __obj_iterator.next(__context__,(__obj_rename_at_35)) )
+		{
+			das_copy((*__obj_rename_at_35),CObject_87123050199feed(__context__,__i_rename_at_34++));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_35));
+	};
+}
+
+inline void init_82941d53aead50d4 ( Context * __context__, TArray<NObject> &  __objects_rename_at_62 )
+{
+	_Funcbuiltin_0x60_resize_895b2ff719a60fbf(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_62),50000);
+	int32_t __i_rename_at_64 = 0;
+	{
+		bool __need_loop_65 = true;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_62);
+		NObject * __obj_rename_at_65;
+		__need_loop_65 = __obj_iterator.first(__context__,(__obj_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __obj_iterator.next(__context__,(__obj_rename_at_65)) )
+		{
+			das_copy((*__obj_rename_at_65).position,float3(__i_rename_at_64++,__i_rename_at_64 + 1,__i_rename_at_64 + 2));
+			das_copy((*__obj_rename_at_65).velocity,v_make_vec4f(1.f,2.f,3.f,0.f));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_65));
+	};
+	DAS_ASSERT((__i_rename_at_64 == builtin_array_size(das_arg<TArray<NObject>>::pass(__objects_rename_at_62))));
+}
+
+inline bool test_f69b8220cae881c6 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,384,"test " DAS_FILE_LINE);
+{
+	TArray<NObject> __objects_rename_at_72; das_zero(__objects_rename_at_72);
+	init_82941d53aead50d4(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72));
+	builtin_profile(20,((char *) "particles kinematics"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSim2_bbeab7eeeb71c6c6(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, inlined"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSim2I_c896f816c21c590e(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_72),100);
+	}),__context__);
+	TArray<CObject> __classes_rename_at_80; das_zero(__classes_rename_at_80);
+	init_8bbd89bb768b7702(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80));
+	builtin_profile(20,((char *) "particles kinematics OOP, virtual"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testVirtual2_255c4936774b33e6(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics OOP, method"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testMethod2_40619d6ac764bb10(__context__,das_arg<TArray<CObject>>::pass(__classes_rename_at_80),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testParticles(100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, inlined C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testParticlesI(100);
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void testMethod_a600be71db1e7e81 ( Context * __context__, TArray<CObject> &  __objects_rename_at_24 )
+{
+	{
+		bool __need_loop_25 = true;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_24);
+		CObject * __obj_rename_at_25;
+		__need_loop_25 = __obj_iterator.first(__context__,(__obj_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __obj_iterator.next(__context__,(__obj_rename_at_25)) )
+		{
+			_FuncCObject_0x60_update_7fe6c0b8f4a260ba(__context__,das_arg<CObject>::pass((*__obj_rename_at_25)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_25));
+	};
+}
+
+inline void testMethod2_40619d6ac764bb10 ( Context * __context__, TArray<CObject> &  __objects_rename_at_28, int32_t __count_rename_at_28 )
+{
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_28));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			testMethod_a600be71db1e7e81(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_28));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+}
+
+inline void testSim_adfd4989f8d7ec33 ( Context * __context__, TArray<NObject> &  __objects_rename_at_46 )
+{
+	{
+		bool __need_loop_47 = true;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_46);
+		NObject * __obj_rename_at_47;
+		__need_loop_47 = __obj_iterator.first(__context__,(__obj_rename_at_47)) && __need_loop_47;
+		for ( ; __need_loop_47 ; __need_loop_47 = __obj_iterator.next(__context__,(__obj_rename_at_47)) )
+		{
+			update_a7d15784abd4b219(__context__,das_arg<NObject>::pass((*__obj_rename_at_47)));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_47));
+	};
+}
+
+inline void testSim2_bbeab7eeeb71c6c6 ( Context * __context__, TArray<NObject> &  __objects_rename_at_50, int32_t __count_rename_at_50 )
+{
+	{
+		bool __need_loop_51 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_50));
+		int32_t __i_rename_at_51;
+		__need_loop_51 = __i_iterator.first(__context__,(__i_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __i_iterator.next(__context__,(__i_rename_at_51)) )
+		{
+			testSim_adfd4989f8d7ec33(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_50));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_51));
+	};
+}
+
+inline void testSim2I_c896f816c21c590e ( Context * __context__, TArray<NObject> &  __objects_rename_at_58, int32_t __count_rename_at_58 )
+{
+	{
+		bool __need_loop_59 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_58));
+		int32_t __i_rename_at_59;
+		__need_loop_59 = __i_iterator.first(__context__,(__i_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __i_iterator.next(__context__,(__i_rename_at_59)) )
+		{
+			testSimI_64222acb141d178e(__context__,das_arg<TArray<NObject>>::pass(__objects_rename_at_58));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_59));
+	};
+}
+
+inline void testSimI_64222acb141d178e ( Context * __context__, TArray<NObject> &  __objects_rename_at_54 )
+{
+	{
+		bool __need_loop_55 = true;
+		// obj : NObject&
+		das_iterator<TArray<NObject>> __obj_iterator(__objects_rename_at_54);
+		NObject * __obj_rename_at_55;
+		__need_loop_55 = __obj_iterator.first(__context__,(__obj_rename_at_55)) && __need_loop_55;
+		for ( ; __need_loop_55 ; __need_loop_55 = __obj_iterator.next(__context__,(__obj_rename_at_55)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_55).position),(*__obj_rename_at_55).velocity,*__context__);
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_55));
+	};
+}
+
+inline void testVirtual_83a7fa591eaf16a ( Context * __context__, TArray<CObject> &  __objects_rename_at_16 )
+{
+	{
+		bool __need_loop_17 = true;
+		// obj : CObject&
+		das_iterator<TArray<CObject>> __obj_iterator(__objects_rename_at_16);
+		CObject * __obj_rename_at_17;
+		__need_loop_17 = __obj_iterator.first(__context__,(__obj_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __obj_iterator.next(__context__,(__obj_rename_at_17)) )
+		{
+			das_invoke_function<void>::invoke<CObject &>(__context__,(*__obj_rename_at_17).update,das_arg<CObject>::pass(das_cast<CObject>::cast((*__obj_rename_at_17))));
+		}
+		__obj_iterator.close(__context__,(__obj_rename_at_17));
+	};
+}
+
+inline void testVirtual2_255c4936774b33e6 ( Context * __context__, TArray<CObject> &  __objects_rename_at_20, int32_t __count_rename_at_20 )
+{
+	{
+		bool __need_loop_21 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_20));
+		int32_t __i_rename_at_21;
+		__need_loop_21 = __i_iterator.first(__context__,(__i_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __i_iterator.next(__context__,(__i_rename_at_21)) )
+		{
+			testVirtual_83a7fa591eaf16a(__context__,das_arg<TArray<CObject>>::pass(__objects_rename_at_20));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_21));
+	};
+}
+
+inline void update_a7d15784abd4b219 ( Context * __context__, NObject &  __a_rename_at_43 )
+{
+	SimPolicy<float3>::SetAdd((char *)&(__a_rename_at_43.position),__a_rename_at_43.velocity,*__context__);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// CObject_87123050199feed
+		aotLib[0x9f146283bdeb469e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<CObject (*) ( Context * __context__, int32_t  ),&CObject_87123050199feed>>();
+	};
+		// _FuncCObject_0x27___finalize_8382388a1fd23bf0
+		aotLib[0x5702050181b5d27f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&_FuncCObject_0x27___finalize_8382388a1fd23bf0>>();
+	};
+		// _FuncCObject_0x60_CObject_8cdb08a9a857d345
+		aotLib[0x12a6c73431118bc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject & , int32_t  ),&_FuncCObject_0x60_CObject_8cdb08a9a857d345>>();
+	};
+		// _FuncCObject_0x60_update_7fe6c0b8f4a260ba
+		aotLib[0x3f4cf8434c4f9481] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&_FuncCObject_0x60_update_7fe6c0b8f4a260ba>>();
+	};
+		// _Funcbuiltin_0x60_resize_a846d6ac5833aec2
+		aotLib[0x1a43b7d314fe872d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_a846d6ac5833aec2>>();
+	};
+		// _Funcbuiltin_0x60_resize_895b2ff719a60fbf
+		aotLib[0xb7586077ac9dfa8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&_Funcbuiltin_0x60_resize_895b2ff719a60fbf>>();
+	};
+		// finalize_4d77d82602476a33
+		aotLib[0x21e65091a2d669e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, CObject &  ),&finalize_4d77d82602476a33>>();
+	};
+		// init_8bbd89bb768b7702
+		aotLib[0x3c0bce9d4b31e21d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&init_8bbd89bb768b7702>>();
+	};
+		// init_82941d53aead50d4
+		aotLib[0xdd0dea13851c8918] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&init_82941d53aead50d4>>();
+	};
+		// test_f69b8220cae881c6
+		aotLib[0x7919e6ea728d4836] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f69b8220cae881c6>>();
+	};
+		// testMethod_a600be71db1e7e81
+		aotLib[0x764589e2e85afb42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&testMethod_a600be71db1e7e81>>();
+	};
+		// testMethod2_40619d6ac764bb10
+		aotLib[0xfaf07ff6f2acb97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&testMethod2_40619d6ac764bb10>>();
+	};
+		// testSim_adfd4989f8d7ec33
+		aotLib[0xb981466e7d8bbc96] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&testSim_adfd4989f8d7ec33>>();
+	};
+		// testSim2_bbeab7eeeb71c6c6
+		aotLib[0xe64b12bd2f418212] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&testSim2_bbeab7eeeb71c6c6>>();
+	};
+		// testSim2I_c896f816c21c590e
+		aotLib[0x514adce8ec083284] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> & , int32_t  ),&testSim2I_c896f816c21c590e>>();
+	};
+		// testSimI_64222acb141d178e
+		aotLib[0xce7cf54a9bc0ee39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<NObject> &  ),&testSimI_64222acb141d178e>>();
+	};
+		// testVirtual_83a7fa591eaf16a
+		aotLib[0x6a89607997b48d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> &  ),&testVirtual_83a7fa591eaf16a>>();
+	};
+		// testVirtual2_255c4936774b33e6
+		aotLib[0x99f79445fb37f7af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<CObject> & , int32_t  ),&testVirtual2_255c4936774b33e6>>();
+	};
+		// update_a7d15784abd4b219
+		aotLib[0xa102429ac3b890dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, NObject &  ),&update_a7d15784abd4b219>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
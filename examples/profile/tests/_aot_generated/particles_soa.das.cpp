@@ -0,0 +1,350 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaInferMacro
+// unused structure SoaStructMacro
+// unused structure SoaVisitor
+namespace  {
+
+struct Particle {
+	float3 position;
+	float3 velocity;
+	float4 color;
+	float age;
+	int32_t id;
+};
+static_assert(sizeof(Particle)==48,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,velocity)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,color)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,age)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,id)==44,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Particle_SOA {
+	TArray<float3> position;
+	TArray<float3> velocity;
+	TArray<float4> color;
+	TArray<float> age;
+	TArray<int32_t> id;
+};
+static_assert(sizeof(Particle_SOA)==120,"structure size mismatch with DAS");
+static_assert(offsetof(Particle_SOA,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,velocity)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,color)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,age)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,id)==96,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_push_57b81864a0e95053 ( Context * __context__, TArray<Particle> & __Arr_rename_at_37, Particle const  & __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> & __Arr_rename_at_37, float __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_c00b5fece3d4ea28 ( Context * __context__, TArray<float3> & __Arr_rename_at_37, float3 __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_64d5afeab07ab24a ( Context * __context__, TArray<float4> & __Arr_rename_at_37, float4 __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void push_eba70ecce5ad8cc9 ( Context * __context__, Particle_SOA & ____src_rename_at_5, Particle const  & ____value_rename_at_5 );
+inline bool test_2012b60e95f241f0 ( Context * __context__ );
+inline void testAos_9f0c9ef653a0645c ( Context * __context__, TArray<Particle> & __objects_rename_at_12, int32_t __count_rename_at_12 );
+inline void testSoa_8c581d2b133b0bd5 ( Context * __context__, Particle_SOA & __objects_rename_at_17, int32_t __count_rename_at_17 );
+inline void testSoaColumns_7ad38cf0d8414258 ( Context * __context__, Particle_SOA & __objects_rename_at_22, int32_t __count_rename_at_22 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_57b81864a0e95053 ( Context * __context__, TArray<Particle> &  __Arr_rename_at_37, Particle const  &  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<Particle>>::pass(__Arr_rename_at_37),48,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> &  __Arr_rename_at_37, float __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_c00b5fece3d4ea28 ( Context * __context__, TArray<float3> &  __Arr_rename_at_37, float3 __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_37),12,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_64d5afeab07ab24a ( Context * __context__, TArray<float4> &  __Arr_rename_at_37, float4 __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float4>>::pass(__Arr_rename_at_37),16,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void push_eba70ecce5ad8cc9 ( Context * __context__, Particle_SOA &  ____src_rename_at_5, Particle const  &  ____value_rename_at_5 )
+{
+	_Funcbuiltin_0x60_push_c00b5fece3d4ea28(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_5.position),____value_rename_at_5.position);
+	_Funcbuiltin_0x60_push_c00b5fece3d4ea28(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_5.velocity),____value_rename_at_5.velocity);
+	_Funcbuiltin_0x60_push_64d5afeab07ab24a(__context__,das_arg<TArray<float4>>::pass(____src_rename_at_5.color),____value_rename_at_5.color);
+	_Funcbuiltin_0x60_push_ce4ed03e40d5734(__context__,das_arg<TArray<float>>::pass(____src_rename_at_5.age),____value_rename_at_5.age);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_5.id),____value_rename_at_5.id);
+}
+
+inline bool test_2012b60e95f241f0 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,400,"test " DAS_FILE_LINE);
+{
+	TArray<Particle> __aos_rename_at_29; das_zero(__aos_rename_at_29);
+	Particle_SOA __soa_rename_at_30; das_zero(__soa_rename_at_30);
+	{
+		bool __need_loop_31 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,50000));
+		int32_t __t_rename_at_31;
+		__need_loop_31 = __t_iterator.first(__context__,(__t_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __t_iterator.next(__context__,(__t_rename_at_31)) )
+		{
+			Particle __p_rename_at_32_ConstRef = ((Particle)(([&]() -> Particle {
+				Particle __mks_32;
+				das_zero(__mks_32);
+				das_copy((__mks_32.position),(float3(__t_rename_at_31,__t_rename_at_31 + 1,__t_rename_at_31 + 2)));
+				das_copy((__mks_32.velocity),(v_make_vec4f(1.f,2.f,3.f,0.f)));
+				das_copy((__mks_32.id),(__t_rename_at_31));
+				return __mks_32;
+			})()));
+	Particle const  & __p_rename_at_32 = __p_rename_at_32_ConstRef; ;
+			_Funcbuiltin_0x60_push_57b81864a0e95053(__context__,das_arg<TArray<Particle>>::pass(__aos_rename_at_29),__p_rename_at_32);
+			push_eba70ecce5ad8cc9(__context__,das_arg<Particle_SOA>::pass(__soa_rename_at_30),__p_rename_at_32);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_31));
+	};
+	builtin_profile(20,((char *) "particles kinematics, array of structures"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testAos_9f0c9ef653a0645c(__context__,das_arg<TArray<Particle>>::pass(__aos_rename_at_29),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, soa index"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSoa_8c581d2b133b0bd5(__context__,das_arg<Particle_SOA>::pass(__soa_rename_at_30),100);
+	}),__context__);
+	builtin_profile(20,((char *) "particles kinematics, soa columns"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testSoaColumns_7ad38cf0d8414258(__context__,das_arg<Particle_SOA>::pass(__soa_rename_at_30),100);
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void testAos_9f0c9ef653a0645c ( Context * __context__, TArray<Particle> &  __objects_rename_at_12, int32_t __count_rename_at_12 )
+{
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_12));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			{
+				bool __need_loop_14 = true;
+				// obj : Particle&
+				das_iterator<TArray<Particle>> __obj_iterator(__objects_rename_at_12);
+				Particle * __obj_rename_at_14;
+				__need_loop_14 = __obj_iterator.first(__context__,(__obj_rename_at_14)) && __need_loop_14;
+				for ( ; __need_loop_14 ; __need_loop_14 = __obj_iterator.next(__context__,(__obj_rename_at_14)) )
+				{
+					SimPolicy<float3>::SetAdd((char *)&((*__obj_rename_at_14).position),(*__obj_rename_at_14).velocity,*__context__);
+				}
+				__obj_iterator.close(__context__,(__obj_rename_at_14));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+}
+
+inline void testSoa_8c581d2b133b0bd5 ( Context * __context__, Particle_SOA &  __objects_rename_at_17, int32_t __count_rename_at_17 )
+{
+	{
+		bool __need_loop_18 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_17));
+		int32_t __i_rename_at_18;
+		__need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __i_iterator.next(__context__,(__i_rename_at_18)) )
+		{
+			{
+				bool __need_loop_19 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(mk_range(builtin_array_size(__objects_rename_at_17.position)));
+				int32_t __j_rename_at_19;
+				__need_loop_19 = __j_iterator.first(__context__,(__j_rename_at_19)) && __need_loop_19;
+				for ( ; __need_loop_19 ; __need_loop_19 = __j_iterator.next(__context__,(__j_rename_at_19)) )
+				{
+					SimPolicy<float3>::SetAdd((char *)&(__objects_rename_at_17.position(__j_rename_at_19,__context__)),__objects_rename_at_17.velocity(__j_rename_at_19,__context__),*__context__);
+				}
+				__j_iterator.close(__context__,(__j_rename_at_19));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_18));
+	};
+}
+
+inline void testSoaColumns_7ad38cf0d8414258 ( Context * __context__, Particle_SOA &  __objects_rename_at_22, int32_t __count_rename_at_22 )
+{
+	{
+		bool __need_loop_23 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_22));
+		int32_t __i_rename_at_23;
+		__need_loop_23 = __i_iterator.first(__context__,(__i_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __i_iterator.next(__context__,(__i_rename_at_23)) )
+		{
+			{
+				bool __need_loop_24 = true;
+				// pos : float3&
+				das_iterator<TArray<float3>> __pos_iterator(__objects_rename_at_22.position);
+				float3 * __pos_rename_at_24;
+				__need_loop_24 = __pos_iterator.first(__context__,(__pos_rename_at_24)) && __need_loop_24;
+				// vel : float3&
+				das_iterator<TArray<float3>> __vel_iterator(__objects_rename_at_22.velocity);
+				float3 * __vel_rename_at_24;
+				__need_loop_24 = __vel_iterator.first(__context__,(__vel_rename_at_24)) && __need_loop_24;
+				for ( ; __need_loop_24 ; __need_loop_24 = __pos_iterator.next(__context__,(__pos_rename_at_24)) && __vel_iterator.next(__context__,(__vel_rename_at_24)) )
+				{
+					SimPolicy<float3>::SetAdd((char *)&((*__pos_rename_at_24)),(*__vel_rename_at_24),*__context__);
+				}
+				__pos_iterator.close(__context__,(__pos_rename_at_24));
+				__vel_iterator.close(__context__,(__vel_rename_at_24));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_23));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_push_57b81864a0e95053
+		aotLib[0x59c908b7b1f627a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Particle> & , Particle const  &  ),&_Funcbuiltin_0x60_push_57b81864a0e95053>>();
+	};
+		// _Funcbuiltin_0x60_push_ce4ed03e40d5734
+		aotLib[0xede21779ebee9565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_ce4ed03e40d5734>>();
+	};
+		// _Funcbuiltin_0x60_push_c00b5fece3d4ea28
+		aotLib[0x92760aba6b084fd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_push_c00b5fece3d4ea28>>();
+	};
+		// _Funcbuiltin_0x60_push_64d5afeab07ab24a
+		aotLib[0x1c5fc4a66e34c455] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , float4  ),&_Funcbuiltin_0x60_push_64d5afeab07ab24a>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// push_eba70ecce5ad8cc9
+		aotLib[0xf9308fa9f1ef4983] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , Particle const  &  ),&push_eba70ecce5ad8cc9>>();
+	};
+		// test_2012b60e95f241f0
+		aotLib[0x1514a47a518106a7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2012b60e95f241f0>>();
+	};
+		// testAos_9f0c9ef653a0645c
+		aotLib[0xe198350c617b110d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Particle> & , int32_t  ),&testAos_9f0c9ef653a0645c>>();
+	};
+		// testSoa_8c581d2b133b0bd5
+		aotLib[0xc1197278be4d6e69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , int32_t  ),&testSoa_8c581d2b133b0bd5>>();
+	};
+		// testSoaColumns_7ad38cf0d8414258
+		aotLib[0x34435aad890531ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , int32_t  ),&testSoaColumns_7ad38cf0d8414258>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
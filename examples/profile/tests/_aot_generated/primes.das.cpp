@@ -0,0 +1,184 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool _Func_0x60_isprime_e813ea2bbf9ad889 ( Context * __context__, int32_t __n_rename_at_5 );
+inline int32_t _Func_0x60_primes_d5dc6f0d128e4a4f ( Context * __context__, int32_t __n_rename_at_12 );
+inline int32_t _Func_0x60_primesI_660fc81fd94d036 ( Context * __context__, int32_t __n_rename_at_20 );
+inline bool test_8c20e5a52d21de77 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Func_0x60_isprime_e813ea2bbf9ad889 ( Context * __context__, int32_t __n_rename_at_5 )
+{
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_5));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__n_rename_at_5,__i_rename_at_6,*__context__)) == 0 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t _Func_0x60_primes_d5dc6f0d128e4a4f ( Context * __context__, int32_t __n_rename_at_12 )
+{
+	int32_t __count_rename_at_13 = 0;
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_12 + 1));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			if ( _Func_0x60_isprime_e813ea2bbf9ad889(__context__,__i_rename_at_14) )
+			{
+				++__count_rename_at_13;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_13);
+}
+
+inline int32_t _Func_0x60_primesI_660fc81fd94d036 ( Context * __context__, int32_t __n_rename_at_20 )
+{
+	int32_t __count_rename_at_21 = 0;
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(2,__n_rename_at_20 + 1));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			__count_rename_at_21++;
+			{
+				bool __need_loop_24 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(2,__i_rename_at_22));
+				int32_t __j_rename_at_24;
+				__need_loop_24 = __j_iterator.first(__context__,(__j_rename_at_24)) && __need_loop_24;
+				for ( ; __need_loop_24 ; __need_loop_24 = __j_iterator.next(__context__,(__j_rename_at_24)) )
+				{
+					if ( (SimPolicy<int32_t>::Mod(__i_rename_at_22,__j_rename_at_24,*__context__)) == 0 )
+					{
+						__count_rename_at_21--;
+						break;
+					};
+				}
+				__j_iterator.close(__context__,(__j_rename_at_24));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	return das_auto_cast<int32_t>::cast(__count_rename_at_21);
+}
+
+inline bool test_8c20e5a52d21de77 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	int32_t __f1_rename_at_32 = 0;
+	builtin_profile(20,((char *) "primes loop"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f1_rename_at_32,_Func_0x60_primes_d5dc6f0d128e4a4f(__context__,14000));
+	}),__context__);
+	DAS_ASSERT((__f1_rename_at_32 == 1652));
+	int32_t __f2_rename_at_36 = 0;
+	builtin_profile(20,((char *) "primes loop, inline"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f2_rename_at_36,_Func_0x60_primesI_660fc81fd94d036(__context__,14000));
+	}),__context__);
+	DAS_ASSERT((__f2_rename_at_36 == 1652));
+	int32_t __f3_rename_at_40 = 0;
+	builtin_profile(20,((char *) "primes loop C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		das_copy(__f3_rename_at_40,testPrimes(14000));
+	}),__context__);
+	DAS_ASSERT((__f3_rename_at_40 == 1652));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_isprime_e813ea2bbf9ad889
+		aotLib[0x5732c445e29e1575] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&_Func_0x60_isprime_e813ea2bbf9ad889>>();
+	};
+		// _Func_0x60_primes_d5dc6f0d128e4a4f
+		aotLib[0x3e5a76a777383c15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_primes_d5dc6f0d128e4a4f>>();
+	};
+		// _Func_0x60_primesI_660fc81fd94d036
+		aotLib[0x17214325d63bdd11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_primesI_660fc81fd94d036>>();
+	};
+		// test_8c20e5a52d21de77
+		aotLib[0xb5b484138e3b2b8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_8c20e5a52d21de77>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,218 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require string_builder
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure AppendToWriteVisitor
+// unused structure StringBuilderInferMacro
+// unused structure StringBuilderVisitor
+// unused structure StringUsesVisitor
+
+inline int32_t append_build_string_25855ff8ce76f443 ( Context * __context__, int32_t __n_rename_at_21 );
+inline int32_t append_global_4b814f80b9478d3a ( Context * __context__, int32_t __n_rename_at_8 );
+inline int32_t append_local_99e9f685564e6e05 ( Context * __context__, int32_t __n_rename_at_15 );
+inline bool test_7438eb15a371364d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<char *,0x240359d5>(__context__);/*g_text*/
+}
+
+inline int32_t append_build_string_25855ff8ce76f443 ( Context * __context__, int32_t __n_rename_at_21 )
+{
+	char * __s_rename_at_22 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_22)->void{
+		{
+			bool __need_loop_23 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_21));
+			int32_t __i_rename_at_23;
+			__need_loop_23 = __i_iterator.first(__context__,(__i_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __i_iterator.next(__context__,(__i_rename_at_23)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_22),cast<char * const >::from(((char *) "x"))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<int32_t>::cast(builtin_string_length(__s_rename_at_22,__context__));
+}
+
+inline int32_t append_global_4b814f80b9478d3a ( Context * __context__, int32_t __n_rename_at_8 )
+{
+	das_copy(das_global<char *,0x240359d5>(__context__) /*g_text*/,((char *) ""));
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_8));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(das_global<char *,0x240359d5>(__context__) /*g_text*/),cast<char *>::from(((char *) "x")),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+	return das_auto_cast<int32_t>::cast(builtin_string_length(das_global<char *,0x240359d5>(__context__) /*g_text*/,__context__));
+}
+
+inline int32_t append_local_99e9f685564e6e05 ( Context * __context__, int32_t __n_rename_at_15 )
+{
+	char * __s_rename_at_16 = (char *)(((char *) ""));
+	das_copy(__s_rename_at_16,((char *)(builtin_build_string_T([&](StringBuilderWriter & __string_builder_writer_rename_at_17)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_17),cast<char *>::from(__s_rename_at_16)));
+		{
+			bool __need_loop_17 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_15));
+			int32_t __i_rename_at_17;
+			__need_loop_17 = __i_iterator.first(__context__,(__i_rename_at_17)) && __need_loop_17;
+			for ( ; __need_loop_17 ; __need_loop_17 = __i_iterator.next(__context__,(__i_rename_at_17)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_17),cast<char * const >::from(((char *) "x"))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_17));
+		};
+	},__context__))));
+	return das_auto_cast<int32_t>::cast(builtin_string_length(__s_rename_at_16,__context__));
+}
+
+inline bool test_7438eb15a371364d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_29 = 0;
+	builtin_profile(20,((char *) "string append, 10k += to a global"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_29 += append_global_4b814f80b9478d3a(__context__,10000);
+	}),__context__);
+	builtin_profile(20,((char *) "string append, 100k += to a local"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_29 += append_local_99e9f685564e6e05(__context__,100000);
+	}),__context__);
+	builtin_profile(20,((char *) "string append, 100k build_string"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_29 += append_build_string_25855ff8ce76f443(__context__,100000);
+	}),__context__);
+	return das_auto_cast<bool>::cast(__total_rename_at_29 > 0);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// append_build_string_25855ff8ce76f443
+		aotLib[0xf6a4f6485c45952d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&append_build_string_25855ff8ce76f443>>();
+	};
+		// append_global_4b814f80b9478d3a
+		aotLib[0x54eefaf53a0ddda5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&append_global_4b814f80b9478d3a>>();
+	};
+		// append_local_99e9f685564e6e05
+		aotLib[0x43469c7c3b49e3d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&append_local_99e9f685564e6e05>>();
+	};
+		// test_7438eb15a371364d
+		aotLib[0xcf5afe28fcfb2a8f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7438eb15a371364d>>();
+	};
+		// [[ init script ]]
+		aotLib[0xd035d134b01ec500] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,271 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__773f98e8;
+extern VarInfo __var_info__a750bdde;
+extern FuncInfo __func_info__6acf994b;
+extern FuncInfo __func_info__24e491aa;
+extern FuncInfo __func_info__2c47cca3;
+
+VarInfo __func_info__6acf994b_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x773f98e8, "words", 0 };
+VarInfo * __func_info__6acf994b_fields[1] =  { &__func_info__6acf994b_field_0 };
+FuncInfo __func_info__6acf994b = {"invoke block<(words:array<string> const#):void> const", "", __func_info__6acf994b_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x6acf994b, 0x0 };
+VarInfo __func_info__24e491aa_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa750bdde, "tok", 0 };
+VarInfo * __func_info__24e491aa_fields[1] =  { &__func_info__24e491aa_field_0 };
+FuncInfo __func_info__24e491aa = {"invoke block<(tok:strings::string_view):void> const", "", __func_info__24e491aa_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x24e491aa, 0x0 };
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_1[2] = { &__type_info__359c1b32, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[1] = { &__type_info__95e97e5e };
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_193 );
+inline int32_t count_split_e31631b6e431fc41 ( Context * __context__, char * const  __line_rename_at_25, TTable<char *,int32_t> const  & __tab_rename_at_25 );
+inline int32_t count_tokenize_37b7a3c42fde8a29 ( Context * __context__, char * const  __line_rename_at_34, TTable<char *,int32_t> const  & __tab_rename_at_34 );
+inline char * make_line_1ff4a856df5afbee ( Context * __context__, int32_t __n_rename_at_5 );
+inline bool _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_54, das::StringView const  __at_rename_at_54 );
+inline void _Funcstrings_boost_0x60_split_6c34e4d2da6c6fce ( Context * __context__, char * const  __text_rename_at_34, char * const  __delim_rename_at_34, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_34 );
+inline int32_t sum_split_e87385d3cedf56ba ( Context * __context__, char * const  __line_rename_at_11 );
+inline int32_t sum_tokenize_1db2a142f29911eb ( Context * __context__, char * const  __line_rename_at_19 );
+inline bool test_9c5e7747c60b698c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_193),8,4,__context__);
+}
+
+inline int32_t count_split_e31631b6e431fc41 ( Context * __context__, char * const  __line_rename_at_25, TTable<char *,int32_t> const  &  __tab_rename_at_25 ) { das_stack_prologue __prologue(__context__,144,"count_split " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_26 = 0;
+	_Funcstrings_boost_0x60_split_6c34e4d2da6c6fce(__context__,__line_rename_at_25,((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,96,0,&__func_info__6acf994b,[&](TArray<char *> const  & __words_rename_at_27)->void{
+		{
+			bool __need_loop_28 = true;
+			// w : string const&#
+			das_iterator<TArray<char *> const > __w_iterator(__words_rename_at_27);
+			char * const  * __w_rename_at_28;
+			__need_loop_28 = __w_iterator.first(__context__,(__w_rename_at_28)) && __need_loop_28;
+			for ( ; __need_loop_28 ; __need_loop_28 = __w_iterator.next(__context__,(__w_rename_at_28)) )
+			{
+				char * __key_rename_at_29 = ((char *)(char *)((*__w_rename_at_28)));
+				if ( __builtin_table_key_exists(__context__,__tab_rename_at_25,__key_rename_at_29) )
+				{
+					__total_rename_at_26++;
+				};
+			}
+			__w_iterator.close(__context__,(__w_rename_at_28));
+		};
+	}));
+	return das_auto_cast<int32_t>::cast(__total_rename_at_26);
+}}
+
+inline int32_t count_tokenize_37b7a3c42fde8a29 ( Context * __context__, char * const  __line_rename_at_34, TTable<char *,int32_t> const  &  __tab_rename_at_34 ) { das_stack_prologue __prologue(__context__,112,"count_tokenize " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_35 = 0;
+	builtin_string_view_tokenize(builtin_string_view(__line_rename_at_34,__context__),((char *) ","),das_make_block<void,das::StringView>(__context__,96,0,&__func_info__24e491aa,[&](das::StringView __tok_rename_at_36)->void{
+		if ( _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089(__context__,__tab_rename_at_34,__tok_rename_at_36) )
+		{
+			__total_rename_at_35++;
+		};
+	}),__context__);
+	return das_auto_cast<int32_t>::cast(__total_rename_at_35);
+}}
+
+inline char * make_line_1ff4a856df5afbee ( Context * __context__, int32_t __n_rename_at_5 )
+{
+	return das_auto_cast<char *>::cast(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_6)->void{
+		{
+			bool __need_loop_7 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_5));
+			int32_t __i_rename_at_7;
+			__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+			for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_6),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(__i_rename_at_7), cast<char * const >::from(((char *) ",")))))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_7));
+		};
+	},__context__))));
+}
+
+inline bool _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_54, das::StringView const  __at_rename_at_54 )
+{
+	return das_auto_cast<bool>::cast(builtin_table_find_string_view(__Tab_rename_at_54,__at_rename_at_54,4,__context__) != nullptr);
+}
+
+inline void _Funcstrings_boost_0x60_split_6c34e4d2da6c6fce ( Context * __context__, char * const  __text_rename_at_34, char * const  __delim_rename_at_34, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_34 )
+{
+	builtin_string_split(__text_rename_at_34,__delim_rename_at_34,__blk_rename_at_34,__context__);
+}
+
+inline int32_t sum_split_e87385d3cedf56ba ( Context * __context__, char * const  __line_rename_at_11 ) { das_stack_prologue __prologue(__context__,128,"sum_split " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_12 = 0;
+	_Funcstrings_boost_0x60_split_6c34e4d2da6c6fce(__context__,__line_rename_at_11,((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,96,0,&__func_info__6acf994b,[&](TArray<char *> const  & __words_rename_at_13)->void{
+		{
+			bool __need_loop_14 = true;
+			// w : string const&#
+			das_iterator<TArray<char *> const > __w_iterator(__words_rename_at_13);
+			char * const  * __w_rename_at_14;
+			__need_loop_14 = __w_iterator.first(__context__,(__w_rename_at_14)) && __need_loop_14;
+			for ( ; __need_loop_14 ; __need_loop_14 = __w_iterator.next(__context__,(__w_rename_at_14)) )
+			{
+				__total_rename_at_12 += fast_to_int((*__w_rename_at_14));
+			}
+			__w_iterator.close(__context__,(__w_rename_at_14));
+		};
+	}));
+	return das_auto_cast<int32_t>::cast(__total_rename_at_12);
+}}
+
+inline int32_t sum_tokenize_1db2a142f29911eb ( Context * __context__, char * const  __line_rename_at_19 ) { das_stack_prologue __prologue(__context__,112,"sum_tokenize " DAS_FILE_LINE);
+{
+	int32_t __total_rename_at_20 = 0;
+	builtin_string_view_tokenize(builtin_string_view(__line_rename_at_19,__context__),((char *) ","),das_make_block<void,das::StringView>(__context__,96,0,&__func_info__24e491aa,[&](das::StringView __tok_rename_at_21)->void{
+		__total_rename_at_20 += builtin_string_view_to_int(__tok_rename_at_21);
+	}),__context__);
+	return das_auto_cast<int32_t>::cast(__total_rename_at_20);
+}}
+
+inline bool test_9c5e7747c60b698c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+	char * __line_rename_at_43 = ((char *)(char *)(make_line_1ff4a856df5afbee(__context__,100000)));
+	TTable<char *,int32_t> __tab_rename_at_44; das_zero(__tab_rename_at_44);
+	{
+		bool __need_loop_45 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,1000));
+		int32_t __i_rename_at_45;
+		__need_loop_45 = __i_iterator.first(__context__,(__i_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __i_iterator.next(__context__,(__i_rename_at_45)) )
+		{
+			das_copy(__tab_rename_at_44(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from((__i_rename_at_45 * 7)))),__context__),__i_rename_at_45);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_45));
+	};
+	int32_t __total_rename_at_47 = 0;
+	builtin_profile(20,((char *) "string_view, 100k to_int with split"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_47 += sum_split_e87385d3cedf56ba(__context__,__line_rename_at_43);
+	}),__context__);
+	builtin_profile(20,((char *) "string_view, 100k to_int with tokenize"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_47 += sum_tokenize_1db2a142f29911eb(__context__,__line_rename_at_43);
+	}),__context__);
+	builtin_profile(20,((char *) "string_view, 100k table lookups with split"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_47 += count_split_e31631b6e431fc41(__context__,__line_rename_at_43,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_44));
+	}),__context__);
+	builtin_profile(20,((char *) "string_view, 100k table lookups with tokenize"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		__total_rename_at_47 += count_tokenize_37b7a3c42fde8a29(__context__,__line_rename_at_43,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_44));
+	}),__context__);
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_44));
+	return das_auto_cast<bool>::cast(__total_rename_at_47 > 0);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// count_split_e31631b6e431fc41
+		aotLib[0x6eca8b5a122105f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , TTable<char *,int32_t> const  &  ),&count_split_e31631b6e431fc41>>();
+	};
+		// count_tokenize_37b7a3c42fde8a29
+		aotLib[0xcf21104b8ab2f63e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , TTable<char *,int32_t> const  &  ),&count_tokenize_37b7a3c42fde8a29>>();
+	};
+		// make_line_1ff4a856df5afbee
+		aotLib[0x33d9c88eda785651] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&make_line_1ff4a856df5afbee>>();
+	};
+		// _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089
+		aotLib[0x4f594e75ff2a361d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , das::StringView const   ),&_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089>>();
+	};
+		// _Funcstrings_boost_0x60_split_6c34e4d2da6c6fce
+		aotLib[0xc515c99335c3113d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<char *> const )) const  &  ),&_Funcstrings_boost_0x60_split_6c34e4d2da6c6fce>>();
+	};
+		// sum_split_e87385d3cedf56ba
+		aotLib[0x6104a399632c9e36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const   ),&sum_split_e87385d3cedf56ba>>();
+	};
+		// sum_tokenize_1db2a142f29911eb
+		aotLib[0x48c6a05cbc6c68d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const   ),&sum_tokenize_1db2a142f29911eb>>();
+	};
+		// test_9c5e7747c60b698c
+		aotLib[0x84a7c99aa2de4a24] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9c5e7747c60b698c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,456 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require random
+#include "daScript/simulate/aot_builtin_random.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+namespace  {
+
+struct Node {
+	int32_t x;
+	int32_t y;
+	Node * left;
+	Node * right;
+};
+static_assert(sizeof(Node)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Node,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,left)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,right)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Pair {
+	Node * first;
+	Node * second;
+};
+static_assert(sizeof(Pair)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Pair,first)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Pair,second)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SplitResult {
+	Node * lower;
+	Node * equal;
+	Node * greater;
+};
+static_assert(sizeof(SplitResult)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SplitResult,lower)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,equal)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,greater)==16,"structure field offset mismatch with DAS");
+}
+
+inline void erase_raw_ad0d91b05f3ae0d8 ( Context * __context__, Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 );
+inline void erase_rawNaive_69c3fa73ac041bdc ( Context * __context__, Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 );
+inline void finalize_d0dad65cf2ec5c3c ( Context * __context__, Node * & ____this_rename_at_73 );
+inline void finalize_b383e97479656dd4 ( Context * __context__, Node & ____this_rename_at_14 );
+inline bool hasValue_2bf191351155b714 ( Context * __context__, Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 );
+inline bool hasValueNaive_1855a7b63002706e ( Context * __context__, Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 );
+inline void insert_222f4fdacfb42c63 ( Context * __context__, Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 );
+inline void insertNaive_e3cc284e3b58bd6f ( Context * __context__, Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 );
+inline int32_t main_2f430a6fbd72f1f ( Context * __context__ );
+inline int32_t mainNaive_8fc1ff3d885c564f ( Context * __context__ );
+inline Node * merge_a159540bda29c32f ( Context * __context__, Node * __lower_rename_at_22, Node * __greater_rename_at_22 );
+inline Node * merge_a5c701119dbde379 ( Context * __context__, Node * __lower_rename_at_34, Node * __equal_rename_at_34, Node * __greater_rename_at_34 );
+inline void split_d0050edcddb6b863 ( Context * __context__, Node * __orig_rename_at_49, Node * & __lower_rename_at_49, Node * & __equal_rename_at_49, Node * & __greater_rename_at_49, int32_t __value_rename_at_49 );
+inline void split_3bbabfa49acc1a15 ( Context * __context__, Node * __orig_rename_at_38, Node * & __lower_rename_at_38, Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 );
+inline Pair splitBinary_968ddf867904b714 ( Context * __context__, Node * __orig_rename_at_96, int32_t __value_rename_at_96 );
+inline SplitResult splitNaive_7512b5b92390a354 ( Context * __context__, Node * __orig_rename_at_113, int32_t __value_rename_at_113 );
+inline bool test_25fb23a56bdad6be ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int4,0xb1c392db>(__context__) = int4(1,1,1,1);/*seed*/
+}
+
+inline void erase_raw_ad0d91b05f3ae0d8 ( Context * __context__, Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 )
+{
+	Node * __lower_rename_at_69 = 0; Node * __equal_rename_at_69 = 0; Node * __greater_rename_at_69 = 0;
+	split_d0050edcddb6b863(__context__,__mRoot_rename_at_68,__lower_rename_at_69,__equal_rename_at_69,__greater_rename_at_69,__x_rename_at_68);
+	das_copy(__mRoot_rename_at_68,merge_a159540bda29c32f(__context__,__lower_rename_at_69,__greater_rename_at_69));
+	finalize_d0dad65cf2ec5c3c(__context__,__equal_rename_at_69);
+}
+
+inline void erase_rawNaive_69c3fa73ac041bdc ( Context * __context__, Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 )
+{
+	SplitResult __splited_rename_at_131 = splitNaive_7512b5b92390a354(__context__,__mRoot_rename_at_130,__x_rename_at_130);
+	das_copy(__mRoot_rename_at_130,merge_a159540bda29c32f(__context__,__splited_rename_at_131.lower,__splited_rename_at_131.greater));
+	finalize_d0dad65cf2ec5c3c(__context__,__splited_rename_at_131.equal);
+}
+
+inline void finalize_d0dad65cf2ec5c3c ( Context * __context__, Node * & ____this_rename_at_73 )
+{
+	if ( ____this_rename_at_73 != nullptr )
+	{
+		finalize_b383e97479656dd4(__context__,das_arg<Node>::pass(das_deref(__context__,____this_rename_at_73)));
+		das_delete<Node *>::clear(__context__,____this_rename_at_73);
+		das_copy(____this_rename_at_73,nullptr);
+	};
+}
+
+inline void finalize_b383e97479656dd4 ( Context * __context__, Node &  ____this_rename_at_14 )
+{
+	finalize_d0dad65cf2ec5c3c(__context__,____this_rename_at_14.left);
+	finalize_d0dad65cf2ec5c3c(__context__,____this_rename_at_14.right);
+	memset(&(____this_rename_at_14), 0, 24);
+}
+
+inline bool hasValue_2bf191351155b714 ( Context * __context__, Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 )
+{
+	Node * __lower_rename_at_55 = 0; Node * __equal_rename_at_55 = 0; Node * __greater_rename_at_55 = 0;
+	split_d0050edcddb6b863(__context__,__mRoot_rename_at_54,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55,__x_rename_at_54);
+	bool __res_rename_at_57 = ((bool)(__equal_rename_at_55 != nullptr));
+	das_copy(__mRoot_rename_at_54,merge_a5c701119dbde379(__context__,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55));
+	return das_auto_cast<bool>::cast(__res_rename_at_57);
+}
+
+inline bool hasValueNaive_1855a7b63002706e ( Context * __context__, Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 )
+{
+	SplitResult __splited_rename_at_119 = splitNaive_7512b5b92390a354(__context__,__mRoot_rename_at_118,__x_rename_at_118);
+	bool __res_rename_at_120 = ((bool)(__splited_rename_at_119.equal != nullptr));
+	das_copy(__mRoot_rename_at_118,merge_a5c701119dbde379(__context__,__splited_rename_at_119.lower,__splited_rename_at_119.equal,__splited_rename_at_119.greater));
+	return das_auto_cast<bool>::cast(__res_rename_at_120);
+}
+
+inline void insert_222f4fdacfb42c63 ( Context * __context__, Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 )
+{
+	Node * __lower_rename_at_62 = 0; Node * __equal_rename_at_62 = 0; Node * __greater_rename_at_62 = 0;
+	split_d0050edcddb6b863(__context__,__mRoot_rename_at_61,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62,__x_rename_at_61);
+	if ( __equal_rename_at_62 == nullptr )
+	{
+		das_copy(__equal_rename_at_62,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+			Node __mks_65;
+			das_zero(__mks_65);
+			das_copy((__mks_65.x),(__x_rename_at_61));
+			das_copy((__mks_65.y),(randomInt(das_global<int4,0xb1c392db>(__context__) /*seed*/)));
+			return __mks_65;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_61,merge_a5c701119dbde379(__context__,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62));
+}
+
+inline void insertNaive_e3cc284e3b58bd6f ( Context * __context__, Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 )
+{
+	SplitResult __splited_rename_at_125 = splitNaive_7512b5b92390a354(__context__,__mRoot_rename_at_124,__x_rename_at_124);
+	if ( __splited_rename_at_125.equal == nullptr )
+	{
+		das_copy(__splited_rename_at_125.equal,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+			Node __mks_127;
+			das_zero(__mks_127);
+			das_copy((__mks_127.x),(__x_rename_at_124));
+			das_copy((__mks_127.y),(randomInt(das_global<int4,0xb1c392db>(__context__) /*seed*/)));
+			return __mks_127;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_124,merge_a5c701119dbde379(__context__,__splited_rename_at_125.lower,__splited_rename_at_125.equal,__splited_rename_at_125.greater));
+}
+
+inline int32_t main_2f430a6fbd72f1f ( Context * __context__ )
+{
+	Node * __tree_rename_at_76 = 0;
+	int32_t __cur_rename_at_77 = 5;
+	int32_t __res_rename_at_78 = 0;
+	{
+		bool __need_loop_79 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_79;
+		__need_loop_79 = __i_iterator.first(__context__,(__i_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __i_iterator.next(__context__,(__i_rename_at_79)) )
+		{
+			int32_t __a_rename_at_80 = ((int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_79,3,*__context__)));
+			das_copy(__cur_rename_at_77,SimPolicy<int32_t>::Mod(((__cur_rename_at_77 * 57) + 43),10007,*__context__));
+			if ( __a_rename_at_80 == 0 )
+			{
+				insert_222f4fdacfb42c63(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 1 )
+			{
+				erase_raw_ad0d91b05f3ae0d8(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 2 )
+			{
+				__res_rename_at_78 += (hasValue_2bf191351155b714(__context__,__tree_rename_at_76,__cur_rename_at_77) ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_79));
+	};
+	finalize_d0dad65cf2ec5c3c(__context__,__tree_rename_at_76);
+	return das_auto_cast<int32_t>::cast(__res_rename_at_78);
+}
+
+inline int32_t mainNaive_8fc1ff3d885c564f ( Context * __context__ )
+{
+	Node * __tree_rename_at_137 = 0;
+	int32_t __cur_rename_at_138 = 5;
+	int32_t __res_rename_at_139 = 0;
+	{
+		bool __need_loop_140 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_140;
+		__need_loop_140 = __i_iterator.first(__context__,(__i_rename_at_140)) && __need_loop_140;
+		for ( ; __need_loop_140 ; __need_loop_140 = __i_iterator.next(__context__,(__i_rename_at_140)) )
+		{
+			int32_t __a_rename_at_141 = ((int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_140,3,*__context__)));
+			das_copy(__cur_rename_at_138,SimPolicy<int32_t>::Mod(((__cur_rename_at_138 * 57) + 43),10007,*__context__));
+			if ( __a_rename_at_141 == 0 )
+			{
+				insertNaive_e3cc284e3b58bd6f(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 1 )
+			{
+				erase_rawNaive_69c3fa73ac041bdc(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 2 )
+			{
+				__res_rename_at_139 += (hasValueNaive_1855a7b63002706e(__context__,__tree_rename_at_137,__cur_rename_at_138) ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_140));
+	};
+	finalize_d0dad65cf2ec5c3c(__context__,__tree_rename_at_137);
+	return das_auto_cast<int32_t>::cast(__res_rename_at_139);
+}
+
+inline Node * merge_a159540bda29c32f ( Context * __context__, Node * __lower_rename_at_22, Node * __greater_rename_at_22 )
+{
+	if ( __lower_rename_at_22 == nullptr )
+	{
+		return das_auto_cast<Node *>::cast(__greater_rename_at_22);
+	} else {
+		if ( __greater_rename_at_22 == nullptr )
+		{
+			return das_auto_cast<Node *>::cast(__lower_rename_at_22);
+		} else {
+			if ( __lower_rename_at_22->y < __greater_rename_at_22->y )
+			{
+				das_copy(__lower_rename_at_22->right,merge_a159540bda29c32f(__context__,__lower_rename_at_22->right,__greater_rename_at_22));
+				return das_auto_cast<Node *>::cast(__lower_rename_at_22);
+			} else {
+				das_copy(__greater_rename_at_22->left,merge_a159540bda29c32f(__context__,__lower_rename_at_22,__greater_rename_at_22->left));
+				return das_auto_cast<Node *>::cast(__greater_rename_at_22);
+			};
+		};
+	};
+}
+
+inline Node * merge_a5c701119dbde379 ( Context * __context__, Node * __lower_rename_at_34, Node * __equal_rename_at_34, Node * __greater_rename_at_34 )
+{
+	return das_auto_cast<Node *>::cast(merge_a159540bda29c32f(__context__,merge_a159540bda29c32f(__context__,__lower_rename_at_34,__equal_rename_at_34),__greater_rename_at_34));
+}
+
+inline void split_d0050edcddb6b863 ( Context * __context__, Node * __orig_rename_at_49, Node * & __lower_rename_at_49, Node * & __equal_rename_at_49, Node * & __greater_rename_at_49, int32_t __value_rename_at_49 )
+{
+	Node * __equalOrGreater_rename_at_50 = 0;
+	split_3bbabfa49acc1a15(__context__,__orig_rename_at_49,__lower_rename_at_49,__equalOrGreater_rename_at_50,__value_rename_at_49);
+	split_3bbabfa49acc1a15(__context__,__equalOrGreater_rename_at_50,__equal_rename_at_49,__greater_rename_at_49,__value_rename_at_49 + 1);
+}
+
+inline void split_3bbabfa49acc1a15 ( Context * __context__, Node * __orig_rename_at_38, Node * & __lower_rename_at_38, Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 )
+{
+	if ( __orig_rename_at_38 == nullptr )
+	{
+		das_copy(__lower_rename_at_38,nullptr);
+		das_copy(__greaterOrEqual_rename_at_38,nullptr);
+	} else if ( __orig_rename_at_38->x < __value_rename_at_38 )
+	{
+		das_copy(__lower_rename_at_38,__orig_rename_at_38);
+		split_3bbabfa49acc1a15(__context__,__lower_rename_at_38->right,__lower_rename_at_38->right,__greaterOrEqual_rename_at_38,__value_rename_at_38);
+	} else {
+		das_copy(__greaterOrEqual_rename_at_38,__orig_rename_at_38);
+		split_3bbabfa49acc1a15(__context__,__greaterOrEqual_rename_at_38->left,__lower_rename_at_38,__greaterOrEqual_rename_at_38->left,__value_rename_at_38);
+	};
+}
+
+inline Pair splitBinary_968ddf867904b714 ( Context * __context__, Node * __orig_rename_at_96, int32_t __value_rename_at_96 )
+{
+	if ( __orig_rename_at_96 == nullptr )
+	{
+		return das_auto_cast<Pair>::cast((([&]() -> Pair {
+			Pair __mks_98;
+			das_copy((__mks_98.first),(nullptr));
+			das_copy((__mks_98.second),(nullptr));
+			return __mks_98;
+		})()));
+	} else {
+		if ( __orig_rename_at_96->x < __value_rename_at_96 )
+		{
+			Pair __splitPair_rename_at_101_ConstRef = ((Pair)splitBinary_968ddf867904b714(__context__,__orig_rename_at_96->right,__value_rename_at_96));
+	Pair const  & __splitPair_rename_at_101 = __splitPair_rename_at_101_ConstRef; ;
+			das_copy(__orig_rename_at_96->right,__splitPair_rename_at_101.first);
+			return das_auto_cast<Pair>::cast((([&]() -> Pair {
+				Pair __mks_103;
+				das_copy((__mks_103.first),(__orig_rename_at_96));
+				das_copy((__mks_103.second),(__splitPair_rename_at_101.second));
+				return __mks_103;
+			})()));
+		} else {
+			Pair __splitPair_rename_at_105_ConstRef = ((Pair)splitBinary_968ddf867904b714(__context__,__orig_rename_at_96->left,__value_rename_at_96));
+	Pair const  & __splitPair_rename_at_105 = __splitPair_rename_at_105_ConstRef; ;
+			das_copy(__orig_rename_at_96->left,__splitPair_rename_at_105.second);
+			return das_auto_cast<Pair>::cast((([&]() -> Pair {
+				Pair __mks_107;
+				das_copy((__mks_107.first),(__splitPair_rename_at_105.first));
+				das_copy((__mks_107.second),(__orig_rename_at_96));
+				return __mks_107;
+			})()));
+		};
+	};
+}
+
+inline SplitResult splitNaive_7512b5b92390a354 ( Context * __context__, Node * __orig_rename_at_113, int32_t __value_rename_at_113 )
+{
+	Pair __lower_eg_rename_at_114 = splitBinary_968ddf867904b714(__context__,__orig_rename_at_113,__value_rename_at_113);
+	Pair __equal_greater_rename_at_115 = splitBinary_968ddf867904b714(__context__,__lower_eg_rename_at_114.second,__value_rename_at_113 + 1);
+	return das_auto_cast<SplitResult>::cast((([&]() -> SplitResult {
+		SplitResult __mks_116;
+		das_copy((__mks_116.lower),(__lower_eg_rename_at_114.first));
+		das_copy((__mks_116.equal),(__equal_greater_rename_at_115.first));
+		das_copy((__mks_116.greater),(__equal_greater_rename_at_115.second));
+		return __mks_116;
+	})()));
+}
+
+inline bool test_25fb23a56bdad6be ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	builtin_profile(10,((char *) "tree"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		main_2f430a6fbd72f1f(__context__);
+	}),__context__);
+	builtin_profile(10,((char *) "tree-naive"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		mainNaive_8fc1ff3d885c564f(__context__);
+	}),__context__);
+	builtin_profile(10,((char *) "tree C++"),das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+		testTree();
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// erase_raw_ad0d91b05f3ae0d8
+		aotLib[0x2cdf756317461b29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&erase_raw_ad0d91b05f3ae0d8>>();
+	};
+		// erase_rawNaive_69c3fa73ac041bdc
+		aotLib[0x39742e1825ddb31a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&erase_rawNaive_69c3fa73ac041bdc>>();
+	};
+		// finalize_d0dad65cf2ec5c3c
+		aotLib[0xece4e41152a84ff9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * &  ),&finalize_d0dad65cf2ec5c3c>>();
+	};
+		// finalize_b383e97479656dd4
+		aotLib[0xa3ee580a83833fbb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node &  ),&finalize_b383e97479656dd4>>();
+	};
+		// hasValue_2bf191351155b714
+		aotLib[0x50cf0396516f336b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Node * & , int32_t  ),&hasValue_2bf191351155b714>>();
+	};
+		// hasValueNaive_1855a7b63002706e
+		aotLib[0x72e51aa12c4bc078] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Node * & , int32_t  ),&hasValueNaive_1855a7b63002706e>>();
+	};
+		// insert_222f4fdacfb42c63
+		aotLib[0x9b179d3550f8f0c3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&insert_222f4fdacfb42c63>>();
+	};
+		// insertNaive_e3cc284e3b58bd6f
+		aotLib[0x926245498e2cce20] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&insertNaive_e3cc284e3b58bd6f>>();
+	};
+		// main_2f430a6fbd72f1f
+		aotLib[0x8063015ce7a2ecce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&main_2f430a6fbd72f1f>>();
+	};
+		// mainNaive_8fc1ff3d885c564f
+		aotLib[0x24a7ea442504e7fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&mainNaive_8fc1ff3d885c564f>>();
+	};
+		// merge_a159540bda29c32f
+		aotLib[0x940cd65ed47856ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Node * (*) ( Context * __context__, Node * , Node *  ),&merge_a159540bda29c32f>>();
+	};
+		// merge_a5c701119dbde379
+		aotLib[0x3c88d30b6e647189] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Node * (*) ( Context * __context__, Node * , Node * , Node *  ),&merge_a5c701119dbde379>>();
+	};
+		// split_d0050edcddb6b863
+		aotLib[0xac93aa14c21e9c82] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * , Node * & , Node * & , Node * & , int32_t  ),&split_d0050edcddb6b863>>();
+	};
+		// split_3bbabfa49acc1a15
+		aotLib[0x47669a210c07a4f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * , Node * & , Node * & , int32_t  ),&split_3bbabfa49acc1a15>>();
+	};
+		// splitBinary_968ddf867904b714
+		aotLib[0xc939261e7350fad9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Pair (*) ( Context * __context__, Node * , int32_t  ),&splitBinary_968ddf867904b714>>();
+	};
+		// splitNaive_7512b5b92390a354
+		aotLib[0x328c8c0cf8116ae7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<SplitResult (*) ( Context * __context__, Node * , int32_t  ),&splitNaive_7512b5b92390a354>>();
+	};
+		// test_25fb23a56bdad6be
+		aotLib[0x13303cde303b0db2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_25fb23a56bdad6be>>();
+	};
+		// [[ init script ]]
+		aotLib[0x92fe9eb7151c4e83] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -335,6 +335,7 @@ int main( int argc, char * argv[] ) {
     NEED_MODULE(Module_Debugger);
     NEED_MODULE(Module_FIO);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Bulk);
     NEED_MODULE(Module_Network);
     NEED_MODULE(Module_UriParser);
 #if 0 // Debug this one test
@@ -0,0 +1,364 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _hint_macros
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__48703320;
+extern StructInfo __struct_info__6a4ffaaa;
+extern TypeInfo __type_info__a6e25c66;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__9cc6eb81;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__dcfff1ff;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__8ce26751;
+extern TypeInfo __type_info__d713bce3;
+extern TypeInfo __type_info__a07921bf;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__a80e24ba;
+extern TypeInfo __type_info__72f75c6a;
+extern TypeInfo __type_info__bbd314ac;
+extern TypeInfo __type_info__c1bd2f4c;
+extern TypeInfo __type_info__79323f61;
+extern VarInfo __var_info__53346e76;
+extern VarInfo __var_info__29362869;
+extern VarInfo __var_info__ba3575b1;
+extern VarInfo __var_info__bd9d5026;
+extern VarInfo __var_info__3989b8f3;
+extern VarInfo __var_info__1c223b0;
+extern VarInfo __var_info__4c663710;
+extern VarInfo __var_info__6197a9c8;
+extern VarInfo __var_info__733a1a9e;
+extern VarInfo __var_info__70fbc23b;
+
+VarInfo __struct_info__48703320_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70fbc23b, "__rtti", 0 };
+TypeInfo * __type_info__4c663710_arg_types_var_1215312672[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__48703320_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4c663710_arg_types_var_1215312672, nullptr, 1, 0, nullptr, 28, 0x4c663710, "__finalize", 8 };
+TypeInfo * __type_info__1c223b0_arg_types_var_1215312672[3] = { &__type_info__a80e24ba, &__type_info__72f75c6a, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__1c223b0_arg_types_var_1215312672, nullptr, 3, 0, nullptr, 28, 0x1c223b0, "transform", 12 };
+TypeInfo * __type_info__6197a9c8_arg_types_var_1215312672[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6197a9c8_arg_types_var_1215312672, nullptr, 5, 0, nullptr, 28, 0x6197a9c8, "apply", 16 };
+TypeInfo * __type_info__3989b8f3_arg_types_var_1215312672[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__48703320_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__3989b8f3_arg_types_var_1215312672, nullptr, 6, 0, nullptr, 28, 0x3989b8f3, "finish", 20 };
+VarInfo * __struct_info__48703320_fields[5] =  { &__struct_info__48703320_field_0, &__struct_info__48703320_field_1, &__struct_info__48703320_field_2, &__struct_info__48703320_field_3, &__struct_info__48703320_field_4 };
+StructInfo __struct_info__48703320 = {"AstFunctionAnnotation", __struct_info__48703320_fields, 5, 24, -1, nullptr, 0x48703320 };
+VarInfo __struct_info__6a4ffaaa_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xba3575b1, "__rtti", 0 };
+TypeInfo * __type_info__733a1a9e_arg_types_var_1783626410[1] = { &__type_info__a80e24ba };
+VarInfo __struct_info__6a4ffaaa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__733a1a9e_arg_types_var_1783626410, nullptr, 1, 0, nullptr, 28, 0x733a1a9e, "__finalize", 8 };
+TypeInfo * __type_info__53346e76_arg_types_var_1783626410[3] = { &__type_info__a80e24ba, &__type_info__72f75c6a, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__9cc6eb81, nullptr, (TypeInfo **)__type_info__53346e76_arg_types_var_1783626410, nullptr, 3, 0, nullptr, 28, 0x53346e76, "transform", 12 };
+TypeInfo * __type_info__bd9d5026_arg_types_var_1783626410[5] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__bd9d5026_arg_types_var_1783626410, nullptr, 5, 0, nullptr, 28, 0xbd9d5026, "apply", 16 };
+TypeInfo * __type_info__29362869_arg_types_var_1783626410[6] = { &__type_info__a80e24ba, &__type_info__dcfff1ff, &__type_info__c1bd2f4c, &__type_info__a07921bf, &__type_info__a07921bf, &__type_info__8ce26751 };
+VarInfo __struct_info__6a4ffaaa_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__29362869_arg_types_var_1783626410, nullptr, 6, 0, nullptr, 28, 0x29362869, "finish", 20 };
+VarInfo * __struct_info__6a4ffaaa_fields[5] =  { &__struct_info__6a4ffaaa_field_0, &__struct_info__6a4ffaaa_field_1, &__struct_info__6a4ffaaa_field_2, &__struct_info__6a4ffaaa_field_3, &__struct_info__6a4ffaaa_field_4 };
+StructInfo __struct_info__6a4ffaaa = {"GetHintFnMacro", __struct_info__6a4ffaaa_fields, 5, 24, -1, nullptr, 0x6a4ffaaa };
+TypeInfo __type_info__a6e25c66 = { Type::tStructure, &__struct_info__6a4ffaaa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa6e25c66 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__9cc6eb81 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d713bce3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x9cc6eb81 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__dcfff1ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__79323f61, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0xdcfff1ff };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__8ce26751 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ce26751 };
+TypeInfo __type_info__d713bce3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Expression"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd713bce3 };
+TypeInfo __type_info__a07921bf = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArgumentList"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xa07921bf };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__a80e24ba = { Type::tStructure, &__struct_info__48703320, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xa80e24ba };
+TypeInfo __type_info__72f75c6a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bbd314ac, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x72f75c6a };
+TypeInfo __type_info__bbd314ac = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ExprCallFunc"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xbbd314ac };
+TypeInfo __type_info__c1bd2f4c = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::ModuleGroup"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc1bd2f4c };
+TypeInfo __type_info__79323f61 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"ast::Function"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x79323f61 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_1[1] = { &__type_info__e8c29053 };
+TypeInfo * __tinfo_2[1] = { &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+namespace ast {
+
+struct AstFunctionAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(AstFunctionAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstFunctionAnnotation,finish)==20,"structure field offset mismatch with DAS");
+}
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+namespace _hint_macros {
+
+struct HintLookup {
+	TTable<uint32_t,char *> tab;
+};
+static_assert(sizeof(HintLookup)==48,"structure size mismatch with DAS");
+static_assert(offsetof(HintLookup,tab)==0,"structure field offset mismatch with DAS");
+}
+namespace _hint_macros {
+
+struct GetHintFnMacro {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstFunctionAnnotation)) __finalize;
+	Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string)) transform;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+	Func DAS_COMMENT((bool,ast::AstFunctionAnnotation,smart_ptr_raw<Function>,ModuleGroup,AnnotationArgumentList const ,AnnotationArgumentList const ,das::string)) finish;
+};
+static_assert(sizeof(GetHintFnMacro)==24,"structure size mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,transform)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,apply)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(GetHintFnMacro,finish)==20,"structure field offset mismatch with DAS");
+}
+
+inline _hint_macros::GetHintFnMacro GetHintFnMacro_41c6e33cf850c45f ( Context * __context__ );
+inline void _FuncGetHintFnMacro_0x27___finalize_31bd43d07207c2e4 ( Context * __context__, _hint_macros::GetHintFnMacro & __self_rename_at_22 );
+inline smart_ptr_raw<Expression> _FuncGetHintFnMacro_0x60_transform_8931044325cb3fec ( Context * __context__, _hint_macros::GetHintFnMacro & __self_rename_at_23, smart_ptr_raw<ExprCallFunc> __call_rename_at_23, das::string & __errors_rename_at_23 );
+inline void __setup_macros_a7ea4aabc7cb61ae ( Context * __context__ );
+inline void _Funcast_boost_0x60_setup_tag_annotation_a1905bff8bb87e8a ( Context * __context__, char * const  __name_rename_at_144, char * const  __tag_rename_at_144, _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_144 );
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_d4e650ceee135ac ( Context * __context__, char * const  __name_rename_at_447, _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_447 );
+inline smart_ptr_raw<ExprCallFunc> _Funcbuiltin_0x60_clone_to_move_23d790f447148357 ( Context * __context__, smart_ptr_raw<ExprCallFunc> const  __clone_src_rename_at_131 );
+inline void clone_d6dbc3764a059afc ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_133, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_133 );
+inline void finalize_27f6a869f8a66dea ( Context * __context__, _hint_macros::GetHintFnMacro & ____this_rename_at_22 );
+inline char * const  get_hint_8a7de2748af3266f ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 );
+inline char * const  get_hint_bde494beb2a46145 ( Context * __context__, _hint_macros::HintLookup const  & __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint32_t __hint_rename_at_13 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_2c6b429a2b04b09b ( Context * __context__, _hint_macros::GetHintFnMacro const  & __cl_rename_at_88 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x61cbe642>(__context__) = 0;/*g_non_hints*/
+	__setup_macros_a7ea4aabc7cb61ae(__context__);
+}
+
+inline _hint_macros::GetHintFnMacro GetHintFnMacro_41c6e33cf850c45f ( Context * __context__ )
+{
+	return das_auto_cast<_hint_macros::GetHintFnMacro>::cast((([&]() -> _hint_macros::GetHintFnMacro {
+		_hint_macros::GetHintFnMacro __mks_22;
+		das_zero(__mks_22);
+		das_copy((__mks_22.__rtti),(((void *)(&__type_info__a6e25c66))));
+		das_copy((__mks_22.__finalize),(das_cast<Func DAS_COMMENT((void,ast::AstFunctionAnnotation))>::cast(Func(__context__->fnIdxByMangledName(/*@_hint_macros::GetHintFnMacro'__finalize GetHintFnMacro*/ 3904178732u)))));
+		das_copy((__mks_22.transform),(das_cast<Func DAS_COMMENT((smart_ptr_raw<Expression>,ast::AstFunctionAnnotation,smart_ptr_raw<ExprCallFunc>,das::string))>::cast(Func(__context__->fnIdxByMangledName(/*@_hint_macros::GetHintFnMacro`transform GetHintFnMacro #smart_ptr##handle#ExprCallFunc #handle#das_string*/ 3001735766u)))));
+		return __mks_22;
+	})()));
+}
+
+inline void _FuncGetHintFnMacro_0x27___finalize_31bd43d07207c2e4 ( Context * __context__, _hint_macros::GetHintFnMacro &  __self_rename_at_22 )
+{
+	finalize_27f6a869f8a66dea(__context__,das_arg<_hint_macros::GetHintFnMacro>::pass(__self_rename_at_22));
+}
+
+inline smart_ptr_raw<Expression> _FuncGetHintFnMacro_0x60_transform_8931044325cb3fec ( Context * __context__, _hint_macros::GetHintFnMacro &  __self_rename_at_23, smart_ptr_raw<ExprCallFunc> __call_rename_at_23, das::string &  __errors_rename_at_23 )
+{
+	if ( SimPolicy<char *>::Equ(cast<char *>::from(das_index<das::vector<smart_ptr<Expression>>>::at(__call_rename_at_23->arguments /*arguments*/,1,__context__)->__rtti /*__rtti*/),cast<char *>::from(((char *) "ExprConstString")),*__context__) )
+	{
+		ExprConstString * __arg2_rename_at_26 = ((ExprConstString *)das_cast<ExprConstString *>::cast(das_index<das::vector<smart_ptr<Expression>>>::at(__call_rename_at_23->arguments /*arguments*/,1,__context__)));
+		uint32_t __hint_rename_at_27 = ((uint32_t)das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<das::string const  &>::from(__arg2_rename_at_26->text /*value*/)))))));
+		das_invoke_function<void>::invoke<das::vector<smart_ptr<Expression>> &,smart_ptr_raw<ExprConstUInt>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::emplace_new #handle#dasvector`smart_ptr`Expression #smart_ptr##handle#Expression*/ 3624395696u)),das_arg<das::vector<smart_ptr<Expression>>>::pass(__call_rename_at_23->arguments /*arguments*/),das_reinterpret<smart_ptr_raw<Expression>>::pass(das_ascend_handle<true,smart_ptr_raw<ExprConstUInt>>::make(__context__,nullptr,(([&](ExprConstUInt & __mks_28) {
+			das_copy((__mks_28.at /*at*/),(__arg2_rename_at_26->at /*at*/));
+			das_copy((__mks_28.cvalue<uint32_t>() /*value*/),(__hint_rename_at_27));
+		})))));
+		smart_ptr_raw<ExprCallFunc> __res_rename_at_29; das_zero(__res_rename_at_29); das_move(__res_rename_at_29, _Funcbuiltin_0x60_clone_to_move_23d790f447148357(__context__,__call_rename_at_23));
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(__res_rename_at_29);
+	} else {
+		return das_auto_cast<smart_ptr_raw<Expression>>::cast(nullptr);
+	};
+}
+
+inline void __setup_macros_a7ea4aabc7cb61ae ( Context * __context__ )
+{
+	if ( is_compiling_macros_in_module(((char *) "_hint_macros"),__context__) )
+	{
+		_Funcast_boost_0x60_setup_tag_annotation_a1905bff8bb87e8a(__context__,((char *) "GetHintFnMacro"),((char *) "get_hint_tag"),das_new<_hint_macros::GetHintFnMacro>::make_and_init(__context__,[&]() { return GetHintFnMacro_41c6e33cf850c45f(__context__); }));
+	};
+}
+
+inline void _Funcast_boost_0x60_setup_tag_annotation_a1905bff8bb87e8a ( Context * __context__, char * const  __name_rename_at_144, char * const  __tag_rename_at_144, _hint_macros::GetHintFnMacro * const  __classPtr_rename_at_144 )
+{
+	smart_ptr_raw<FunctionAnnotation> __ann_rename_at_145; das_zero(__ann_rename_at_145); das_move(__ann_rename_at_145, _Funcast_0x60_make_function_annotation_d4e650ceee135ac(__context__,__name_rename_at_144,__classPtr_rename_at_144));
+	das_invoke_function<void>::invoke<char * const ,smart_ptr_raw<FunctionAnnotation>>(__context__,Func(__context__->fnIdxByMangledName(/*@ast_boost::apply_tag_annotation string#const #smart_ptr##handle#FunctionAnnotation#const*/ 2944298228u)),__tag_rename_at_144,__ann_rename_at_145);
+	addModuleFunctionAnnotation(thisModule(__context__,nullptr),__ann_rename_at_145,__context__);
+	das_delete_handle<smart_ptr_raw<FunctionAnnotation>>::clear(__context__,__ann_rename_at_145);
+}
+
+inline smart_ptr_raw<FunctionAnnotation> _Funcast_0x60_make_function_annotation_d4e650ceee135ac ( Context * __context__, char * const  __name_rename_at_447, _hint_macros::GetHintFnMacro * const  __someClassPtr_rename_at_447 )
+{
+	StructInfo const  * __classInfo_rename_at_449 = ((StructInfo const  *)_Funcrtti_0x60_class_info_2c6b429a2b04b09b(__context__,das_deref(__context__,__someClassPtr_rename_at_447)));
+	return das_auto_cast<smart_ptr_raw<FunctionAnnotation>>::cast(makeFunctionAnnotation(__name_rename_at_447,das_auto_cast<void * const >::cast(__someClassPtr_rename_at_447),__classInfo_rename_at_449,__context__));
+}
+
+inline smart_ptr_raw<ExprCallFunc> _Funcbuiltin_0x60_clone_to_move_23d790f447148357 ( Context * __context__, smart_ptr_raw<ExprCallFunc> const  __clone_src_rename_at_131 )
+{
+	smart_ptr_raw<ExprCallFunc> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_d6dbc3764a059afc(__context__,__clone_dest_rename_at_132,__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<smart_ptr_raw<ExprCallFunc>>::cast(__clone_dest_rename_at_132);
+}
+
+inline void clone_d6dbc3764a059afc ( Context * __context__, smart_ptr_raw<ExprCallFunc> & __dest_rename_at_133, smart_ptr_raw<ExprCallFunc> const  __src_rename_at_133 )
+{
+	builtin_smart_ptr_clone(das_auto_cast<smart_ptr_raw<void> &>::cast(__dest_rename_at_133),das_auto_cast<smart_ptr_raw<void> const >::cast(__src_rename_at_133));
+}
+
+inline void finalize_27f6a869f8a66dea ( Context * __context__, _hint_macros::GetHintFnMacro &  ____this_rename_at_22 )
+{
+	memset(&(____this_rename_at_22), 0, 24);
+}
+
+inline char * const  get_hint_8a7de2748af3266f ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_17, char * const  __id_rename_at_17, char * const  __defv_rename_at_17 )
+{
+	das_global<int32_t,0x61cbe642>(__context__) /*g_non_hints*/++;
+	return das_auto_cast<char * const >::cast(get_hint_bde494beb2a46145(__context__,__lookup_rename_at_17,__id_rename_at_17,__defv_rename_at_17,das_call_interop<uint32_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<char * const >::from(__id_rename_at_17)))));
+}
+
+inline char * const  get_hint_bde494beb2a46145 ( Context * __context__, _hint_macros::HintLookup const  &  __lookup_rename_at_13, char * const  __id_rename_at_13, char * const  __defv_rename_at_13, uint32_t __hint_rename_at_13 )
+{
+	return das_auto_cast<char * const >::cast(das_null_coalescing<char * const >::get(TTable<uint32_t,char *>::safe_index(&(__lookup_rename_at_13.tab),__hint_rename_at_13,__context__),__defv_rename_at_13));
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_2c6b429a2b04b09b ( Context * __context__, _hint_macros::GetHintFnMacro const  &  __cl_rename_at_88 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__cl_rename_at_88.__rtti)->structType /*structType*/));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// GetHintFnMacro_41c6e33cf850c45f
+		aotLib[0x77355fe24e0e4161] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<_hint_macros::GetHintFnMacro (*) ( Context * __context__ ),&GetHintFnMacro_41c6e33cf850c45f>>();
+	};
+		// _FuncGetHintFnMacro_0x27___finalize_31bd43d07207c2e4
+		aotLib[0x9e65f7ed025e1f1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _hint_macros::GetHintFnMacro &  ),&_FuncGetHintFnMacro_0x27___finalize_31bd43d07207c2e4>>();
+	};
+		// _FuncGetHintFnMacro_0x60_transform_8931044325cb3fec
+		aotLib[0x8ab941a8be2f6dac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<Expression> (*) ( Context * __context__, _hint_macros::GetHintFnMacro & , smart_ptr_raw<ExprCallFunc> , das::string &  ),&_FuncGetHintFnMacro_0x60_transform_8931044325cb3fec>>();
+	};
+		// __setup_macros_a7ea4aabc7cb61ae
+		aotLib[0x580f2bc31ae664da] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&__setup_macros_a7ea4aabc7cb61ae>>();
+	};
+		// _Funcast_boost_0x60_setup_tag_annotation_a1905bff8bb87e8a
+		aotLib[0x2ca73cb403e1abbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , _hint_macros::GetHintFnMacro * const   ),&_Funcast_boost_0x60_setup_tag_annotation_a1905bff8bb87e8a>>();
+	};
+		// _Funcast_0x60_make_function_annotation_d4e650ceee135ac
+		aotLib[0xc653d57ec50882d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<FunctionAnnotation> (*) ( Context * __context__, char * const  , _hint_macros::GetHintFnMacro * const   ),&_Funcast_0x60_make_function_annotation_d4e650ceee135ac>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_23d790f447148357
+		aotLib[0xcd0a2623babfa84a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<ExprCallFunc> (*) ( Context * __context__, smart_ptr_raw<ExprCallFunc> const   ),&_Funcbuiltin_0x60_clone_to_move_23d790f447148357>>();
+	};
+		// clone_d6dbc3764a059afc
+		aotLib[0xeef0c8e9bfe78dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, smart_ptr_raw<ExprCallFunc> & , smart_ptr_raw<ExprCallFunc> const   ),&clone_d6dbc3764a059afc>>();
+	};
+		// finalize_27f6a869f8a66dea
+		aotLib[0xbcb228898de20d59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _hint_macros::GetHintFnMacro &  ),&finalize_27f6a869f8a66dea>>();
+	};
+		// get_hint_8a7de2748af3266f
+		aotLib[0x6200884f7765fcac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, _hint_macros::HintLookup const  & , char * const  , char * const   ),&get_hint_8a7de2748af3266f>>();
+	};
+		// get_hint_bde494beb2a46145
+		aotLib[0x9c602dff05056121] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, _hint_macros::HintLookup const  & , char * const  , char * const  , uint32_t  ),&get_hint_bde494beb2a46145>>();
+	};
+		// _Funcrtti_0x60_class_info_2c6b429a2b04b09b
+		aotLib[0x41455b1d77bb0879] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, _hint_macros::GetHintFnMacro const  &  ),&_Funcrtti_0x60_class_info_2c6b429a2b04b09b>>();
+	};
+		// [[ init script ]]
+		aotLib[0x9a553cf61b393ba9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
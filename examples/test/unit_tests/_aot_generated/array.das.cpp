@@ -0,0 +1,509 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__22794d9a;
+extern FuncInfo __func_info__a38a0bc5;
+
+VarInfo __func_info__a38a0bc5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0x22794d9a, "arr", 0 };
+VarInfo * __func_info__a38a0bc5_fields[1] =  { &__func_info__a38a0bc5_field_0 };
+FuncInfo __func_info__a38a0bc5 = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__a38a0bc5_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xa38a0bc5, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_65e01d8d08e664d4 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_31, int32_t __value_rename_at_31, int32_t __at_rename_at_31 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_1772ad774a2515b3 ( Context * __context__, TArray<Foo const > & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a ( Context * __context__, TDim<char *,1> & __a_rename_at_298 );
+inline void make_test_array_968b6bfc223422f4 ( Context * __context__, TArray<int32_t> & __a_rename_at_9, int32_t __extra_rename_at_9 );
+inline void pass_array_846a2b20502e2959 ( Context * __context__, TArray<int32_t> & __arr_rename_at_23 );
+inline bool test_74ac4ddcdb6d2cf9 ( Context * __context__ );
+inline bool testAccept_fc1e239d328b66b7 ( Context * __context__, TArray<Foo const > const  & __t_rename_at_147, TDim<Foo,10> const  & __e_rename_at_147 );
+inline void testConstInArray_c8392f871c3919df ( Context * __context__ );
+inline void testIntArray_1e3597b66d40ac79 ( Context * __context__ );
+inline void testInterop_2636ea5033512e29 ( Context * __context__ );
+inline void verifyIntArray_34b7b3222332c33b ( Context * __context__, TArray<int32_t> const  & __a_rename_at_27, int32_t __s_rename_at_27, int32_t __c_rename_at_27, int32_t __tail_rename_at_27 );
+inline void verify_test_array_c6c5244b7f00254 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_16, int32_t __extra_rename_at_16 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __at_rename_at_67 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_65e01d8d08e664d4 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_31, int32_t __value_rename_at_31, int32_t __at_rename_at_31 )
+{
+	das_copy(__Arr_rename_at_31(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_31),__at_rename_at_31,4,__context__),__context__),__value_rename_at_31);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1772ad774a2515b3 ( Context * __context__, TArray<Foo const > &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<Foo const >>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a ( Context * __context__, TDim<char *,1> &  __a_rename_at_298 )
+{
+	TArray<char *> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_299),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__arr_rename_at_299);
+}
+
+inline void make_test_array_968b6bfc223422f4 ( Context * __context__, TArray<int32_t> &  __a_rename_at_9, int32_t __extra_rename_at_9 )
+{
+	int32_t __i_rename_at_10 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),10);
+	{
+		bool __need_loop_12 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_9);
+		int32_t * __x_rename_at_12;
+		__need_loop_12 = __x_iterator.first(__context__,(__x_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __x_iterator.next(__context__,(__x_rename_at_12)) )
+		{
+			das_copy((*__x_rename_at_12),__i_rename_at_10++ + __extra_rename_at_9);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_12));
+	};
+}
+
+inline void pass_array_846a2b20502e2959 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_23 )
+{
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_23),4);
+}
+
+inline bool test_74ac4ddcdb6d2cf9 ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_94; das_zero(__a_rename_at_94);
+	make_test_array_968b6bfc223422f4(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	make_test_array_968b6bfc223422f4(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),13);
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),13);
+	make_test_array_968b6bfc223422f4(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	TArray<int32_t> __b_rename_at_102; das_zero(__b_rename_at_102); das_move(__b_rename_at_102, __a_rename_at_94);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_94)) == 0));
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_102),0);
+	das_move(__a_rename_at_94,__b_rename_at_102);
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_94),0);
+	TArray<int32_t> __a_rename_at_108; das_zero(__a_rename_at_108); TArray<int32_t> __b_rename_at_108; das_zero(__b_rename_at_108);
+	int32_t __i_rename_at_109 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_108),10);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_108),10);
+	{
+		bool __need_loop_112 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __l_rename_at_112;
+		__need_loop_112 = __l_iterator.first(__context__,(__l_rename_at_112)) && __need_loop_112;
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __r_rename_at_112;
+		__need_loop_112 = __r_iterator.first(__context__,(__r_rename_at_112)) && __need_loop_112;
+		for ( ; __need_loop_112 ; __need_loop_112 = __l_iterator.next(__context__,(__l_rename_at_112)) && __r_iterator.next(__context__,(__r_rename_at_112)) )
+		{
+			das_copy((*__l_rename_at_112),__i_rename_at_109);
+			das_copy((*__r_rename_at_112),(__i_rename_at_109 * 2) - 5);
+			__i_rename_at_109++;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_112));
+		__r_iterator.close(__context__,(__r_rename_at_112));
+	};
+	verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_108),0);
+	das_copy(__i_rename_at_109,0);
+	{
+		bool __need_loop_118 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __l_rename_at_118;
+		__need_loop_118 = __l_iterator.first(__context__,(__l_rename_at_118)) && __need_loop_118;
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __r_rename_at_118;
+		__need_loop_118 = __r_iterator.first(__context__,(__r_rename_at_118)) && __need_loop_118;
+		for ( ; __need_loop_118 ; __need_loop_118 = __l_iterator.next(__context__,(__l_rename_at_118)) && __r_iterator.next(__context__,(__r_rename_at_118)) )
+		{
+			DAS_ASSERT(((*__l_rename_at_118) == __i_rename_at_109));
+			DAS_ASSERT(((*__r_rename_at_118) == ((__i_rename_at_109 * 2) - 5)));
+			__i_rename_at_109++;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_118));
+		__r_iterator.close(__context__,(__r_rename_at_118));
+	};
+	das_copy(__i_rename_at_109,0);
+	{
+		bool __need_loop_123 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_108);
+		int32_t * __l_rename_at_123;
+		__need_loop_123 = __l_iterator.first(__context__,(__l_rename_at_123)) && __need_loop_123;
+		// r : int&
+		das_iterator<TArray<int32_t>> __r_iterator(__b_rename_at_108);
+		int32_t * __r_rename_at_123;
+		__need_loop_123 = __r_iterator.first(__context__,(__r_rename_at_123)) && __need_loop_123;
+		for ( ; __need_loop_123 ; __need_loop_123 = __l_iterator.next(__context__,(__l_rename_at_123)) && __r_iterator.next(__context__,(__r_rename_at_123)) )
+		{
+			if ( (*__l_rename_at_123) > (*__r_rename_at_123) )
+			{
+				DAS_ASSERT(((*__l_rename_at_123) > (*__r_rename_at_123)));
+				__i_rename_at_109++;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_123));
+		__r_iterator.close(__context__,(__r_rename_at_123));
+	};
+	DAS_ASSERT((__i_rename_at_109 == 5));
+	TDim<TArray<int32_t>,10> __a_rename_at_129; das_zero(__a_rename_at_129);
+	int32_t __i_rename_at_130 = 0;
+	{
+		bool __need_loop_131 = true;
+		// b : array<int>& -const
+		das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_129);
+		TArray<int32_t> * __b_rename_at_131;
+		__need_loop_131 = __b_iterator.first(__context__,(__b_rename_at_131)) && __need_loop_131;
+		for ( ; __need_loop_131 ; __need_loop_131 = __b_iterator.next(__context__,(__b_rename_at_131)) )
+		{
+			make_test_array_968b6bfc223422f4(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_131)),__i_rename_at_130++);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_131));
+	};
+	das_copy(__i_rename_at_130,0);
+	{
+		bool __need_loop_134 = true;
+		// b : array<int>& -const
+		das_iterator<TDim<TArray<int32_t>,10>> __b_iterator(__a_rename_at_129);
+		TArray<int32_t> * __b_rename_at_134;
+		__need_loop_134 = __b_iterator.first(__context__,(__b_rename_at_134)) && __need_loop_134;
+		for ( ; __need_loop_134 ; __need_loop_134 = __b_iterator.next(__context__,(__b_rename_at_134)) )
+		{
+			verify_test_array_c6c5244b7f00254(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_134)),__i_rename_at_130++);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_134));
+	};
+	testIntArray_1e3597b66d40ac79(__context__);
+	testConstInArray_c8392f871c3919df(__context__);
+	testInterop_2636ea5033512e29(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool testAccept_fc1e239d328b66b7 ( Context * __context__, TArray<Foo const > const  &  __t_rename_at_147, TDim<Foo,10> const  &  __e_rename_at_147 )
+{
+	{
+		bool __need_loop_148 = true;
+		// i : Foo const&
+		das_iterator<TArray<Foo const > const > __i_iterator(__t_rename_at_147);
+		Foo const  * __i_rename_at_148;
+		__need_loop_148 = __i_iterator.first(__context__,(__i_rename_at_148)) && __need_loop_148;
+		for ( ; __need_loop_148 ; __need_loop_148 = __i_iterator.next(__context__,(__i_rename_at_148)) )
+		{
+			if ( (*__i_rename_at_148).bar == 13 )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_148));
+	};
+	{
+		bool __need_loop_151 = true;
+		// j : Foo const&
+		das_iterator<TDim<Foo,10> const > __j_iterator(__e_rename_at_147);
+		Foo const  * __j_rename_at_151;
+		__need_loop_151 = __j_iterator.first(__context__,(__j_rename_at_151)) && __need_loop_151;
+		for ( ; __need_loop_151 ; __need_loop_151 = __j_iterator.next(__context__,(__j_rename_at_151)) )
+		{
+			if ( (*__j_rename_at_151).bar == 13 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__j_iterator.close(__context__,(__j_rename_at_151));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void testConstInArray_c8392f871c3919df ( Context * __context__ )
+{
+	TArray<Foo const > __a_rename_at_158; das_zero(__a_rename_at_158);
+	_Funcbuiltin_0x60_resize_1772ad774a2515b3(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_158),20);
+	TDim<Foo,10> __b_rename_at_160_ConstRef; das_zero(__b_rename_at_160_ConstRef);
+	TDim<Foo,10> const  & __b_rename_at_160 = __b_rename_at_160_ConstRef; ;
+	testAccept_fc1e239d328b66b7(__context__,das_arg<TArray<Foo const >>::pass(__a_rename_at_158),__b_rename_at_160);
+}
+
+inline void testIntArray_1e3597b66d40ac79 ( Context * __context__ )
+{
+	TArray<int32_t> __arr_rename_at_35; das_zero(__arr_rename_at_35); TArray<int32_t> __arr2_rename_at_35; das_zero(__arr2_rename_at_35);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 0),(((char *) "array starts at 0 length")));
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 3),(((char *) "array length is 3")));
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 16),(((char *) "its 2x, but no less than 16")));
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,3,0);
+	pass_array_846a2b20502e2959(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 4),(((char *) "array length is 4")));
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),6);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 6),(((char *) "array length is now 6")));
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,2);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),17);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,13);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 32),(((char *) "now bigger")));
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),33);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,13);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 33),(((char *) "now even bigger")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 33),(((char *) "did not grow smaller")));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 4),(((char *) "resized properly")));
+	das_move(__arr2_rename_at_35,__arr_rename_at_35);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_35)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35)) == 4));
+	int32_t __index_rename_at_62 = 0;
+	while ( __index_rename_at_62 < 4 )
+	{
+		__arr2_rename_at_35(__index_rename_at_62++,__context__)++;
+	};
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_35),2,4,0);
+	das_move(__arr_rename_at_35,__arr2_rename_at_35);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,4,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,0);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	DAS_ASSERTF((__arr_rename_at_35(3,__context__) == 0),(((char *) "new element after resize is 0")));
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,1);
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,0);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,4,1);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),4);
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),5,4);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,5,0);
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),7,2);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),1,5,0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),3);
+	verifyIntArray_34b7b3222332c33b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_35),2,3,0);
+}
+
+inline void testInterop_2636ea5033512e29 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"testInterop " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_86_48;
+	TDim<char *,1> _temp_make_local_86_80;
+	bool __res_rename_at_86 = ((bool)tempArrayExample(das_arg<TArray<char *>>::pass((_temp_make_local_86_48 = (_Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_86_80(0,__context__) = ((char *) "one");
+		return _temp_make_local_86_80;
+	})())))))),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__a38a0bc5,[&](TArray<char *> const  & __arr_rename_at_86)->void{
+		DAS_ASSERT((builtin_array_size(__arr_rename_at_86) == 1));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__arr_rename_at_86(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	}),__context__));
+	DAS_ASSERT((__res_rename_at_86));
+}}
+
+inline void verifyIntArray_34b7b3222332c33b ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_27, int32_t __s_rename_at_27, int32_t __c_rename_at_27, int32_t __tail_rename_at_27 )
+{
+	{
+		bool __need_loop_28 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(mk_range(__c_rename_at_27));
+		int32_t __t_rename_at_28;
+		__need_loop_28 = __t_iterator.first(__context__,(__t_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __t_iterator.next(__context__,(__t_rename_at_28)) )
+		{
+			DAS_VERIFY((__a_rename_at_27(__t_rename_at_28,__context__) == __s_rename_at_27++));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_28));
+	};
+	{
+		bool __need_loop_30 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(__c_rename_at_27,__c_rename_at_27 + __tail_rename_at_27));
+		int32_t __t_rename_at_30;
+		__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+		{
+			DAS_ASSERT((__a_rename_at_27(__t_rename_at_30,__context__) == 0));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_30));
+	};
+}
+
+inline void verify_test_array_c6c5244b7f00254 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_16, int32_t __extra_rename_at_16 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_16) == 10));
+	int32_t __i_rename_at_18 = 0;
+	{
+		bool __need_loop_19 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_16);
+		int32_t const  * __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			DAS_VERIFY(((*__x_rename_at_19) == (__extra_rename_at_16 + __i_rename_at_18++)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+		aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_push_65e01d8d08e664d4
+		aotLib[0x3a1fab0671d9843d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_65e01d8d08e664d4>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_1772ad774a2515b3
+		aotLib[0x7fe60ae1c08abe25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo const > & , int32_t  ),&_Funcbuiltin_0x60_resize_1772ad774a2515b3>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a
+		aotLib[0xcbefa7b6d4cca85f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a>>();
+	};
+		// make_test_array_968b6bfc223422f4
+		aotLib[0x9f864836a16c942d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&make_test_array_968b6bfc223422f4>>();
+	};
+		// pass_array_846a2b20502e2959
+		aotLib[0x1b466f5a0f9ca41a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&pass_array_846a2b20502e2959>>();
+	};
+		// test_74ac4ddcdb6d2cf9
+		aotLib[0x13b5dd49a3738d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_74ac4ddcdb6d2cf9>>();
+	};
+		// testAccept_fc1e239d328b66b7
+		aotLib[0xc8248f53a344b0e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<Foo const > const  & , TDim<Foo,10> const  &  ),&testAccept_fc1e239d328b66b7>>();
+	};
+		// testConstInArray_c8392f871c3919df
+		aotLib[0x75bed7c320bb382f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testConstInArray_c8392f871c3919df>>();
+	};
+		// testIntArray_1e3597b66d40ac79
+		aotLib[0x6f8dd92bef013f26] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testIntArray_1e3597b66d40ac79>>();
+	};
+		// testInterop_2636ea5033512e29
+		aotLib[0x12716b2fe9ee0474] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&testInterop_2636ea5033512e29>>();
+	};
+		// verifyIntArray_34b7b3222332c33b
+		aotLib[0xd60a5c4464d942d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , int32_t , int32_t , int32_t  ),&verifyIntArray_34b7b3222332c33b>>();
+	};
+		// verify_test_array_c6c5244b7f00254
+		aotLib[0xada81d3e8a5b0bdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&verify_test_array_c6c5244b7f00254>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,161 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+ // require ast_boost
+ // require _array_reader
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure ArrayReader
+
+inline bool test_e7bac5e548739041 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_e7bac5e548739041 ( Context * __context__ )
+{
+	TDim<int32_t,12> __x_rename_at_7 = (([&]() -> TDim<int32_t,12> {
+		TDim<int32_t,12> __mka_7;
+		__mka_7(0,__context__) = 92;
+		__mka_7(1,__context__) = 123;
+		__mka_7(2,__context__) = 92;
+		__mka_7(3,__context__) = 125;
+		__mka_7(4,__context__) = 92;
+		__mka_7(5,__context__) = 119;
+		__mka_7(6,__context__) = 92;
+		__mka_7(7,__context__) = 120;
+		__mka_7(8,__context__) = 92;
+		__mka_7(9,__context__) = 121;
+		__mka_7(10,__context__) = 92;
+		__mka_7(11,__context__) = 110;
+		return __mka_7;
+	})());
+	TDim<int32_t,12> __y_rename_at_9 = (([&]() -> TDim<int32_t,12> {
+		TDim<int32_t,12> __mka_9;
+		__mka_9(0,__context__) = 92;
+		__mka_9(1,__context__) = 123;
+		__mka_9(2,__context__) = 92;
+		__mka_9(3,__context__) = 125;
+		__mka_9(4,__context__) = 92;
+		__mka_9(5,__context__) = 119;
+		__mka_9(6,__context__) = 92;
+		__mka_9(7,__context__) = 120;
+		__mka_9(8,__context__) = 92;
+		__mka_9(9,__context__) = 121;
+		__mka_9(10,__context__) = 92;
+		__mka_9(11,__context__) = 110;
+		return __mka_9;
+	})());
+	{
+		bool __need_loop_10 = true;
+		// t1 : int&
+		das_iterator<TDim<int32_t,12>> __t1_iterator(__x_rename_at_7);
+		int32_t * __t1_rename_at_10;
+		__need_loop_10 = __t1_iterator.first(__context__,(__t1_rename_at_10)) && __need_loop_10;
+		// t2 : int&
+		das_iterator<TDim<int32_t,12>> __t2_iterator(__y_rename_at_9);
+		int32_t * __t2_rename_at_10;
+		__need_loop_10 = __t2_iterator.first(__context__,(__t2_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __t1_iterator.next(__context__,(__t1_rename_at_10)) && __t2_iterator.next(__context__,(__t2_rename_at_10)) )
+		{
+			DAS_ASSERT(((*__t1_rename_at_10) == (*__t2_rename_at_10)));
+		}
+		__t1_iterator.close(__context__,(__t1_rename_at_10));
+		__t2_iterator.close(__context__,(__t2_rename_at_10));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_e7bac5e548739041
+		aotLib[0xc747b74dbbc74de9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e7bac5e548739041>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
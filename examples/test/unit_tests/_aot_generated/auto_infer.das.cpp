@@ -0,0 +1,230 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__95e97e5e;
+extern VarInfo __var_info__78b2a43f;
+extern VarInfo __var_info__f94d94f2;
+extern VarInfo __var_info__e54c43ca;
+extern VarInfo __var_info__79fb6ee9;
+extern VarInfo __var_info__62508675;
+extern FuncInfo __func_info__8825e427;
+extern FuncInfo __func_info__19567b30;
+extern FuncInfo __func_info__b3ac5a85;
+
+VarInfo __func_info__8825e427_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x62508675, "XX", 0 };
+VarInfo __func_info__8825e427_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x79fb6ee9, "YY", 0 };
+VarInfo * __func_info__8825e427_fields[2] =  { &__func_info__8825e427_field_0, &__func_info__8825e427_field_1 };
+FuncInfo __func_info__8825e427 = {"invoke block<(XX:int const explicit;YY:float const):bool const> const", "", __func_info__8825e427_fields, 2, 32, &__type_info__13667ab1, nullptr,0,0x8825e427, 0x0 };
+VarInfo __func_info__19567b30_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xf94d94f2, "arg", 0 };
+VarInfo * __func_info__19567b30_fields[1] =  { &__func_info__19567b30_field_0 };
+FuncInfo __func_info__19567b30 = {"invoke block<(arg:int const):int> const", "", __func_info__19567b30_fields, 1, 32, &__type_info__95e97e5e, nullptr,0,0x19567b30, 0x0 };
+VarInfo __func_info__b3ac5a85_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xe54c43ca, "ia", 0 };
+VarInfo __func_info__b3ac5a85_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x78b2a43f, "fb", 0 };
+VarInfo * __func_info__b3ac5a85_fields[2] =  { &__func_info__b3ac5a85_field_0, &__func_info__b3ac5a85_field_1 };
+FuncInfo __func_info__b3ac5a85 = {"invoke block<(ia:int const;fb:float const):string const> const", "", __func_info__b3ac5a85_fields, 2, 32, &__type_info__3ffbf730, nullptr,0,0xb3ac5a85, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_qq_f5c92f11393e1959 ( Context * __context__, int32_t __a_rename_at_51, Block DAS_COMMENT((bool,int32_t,float)) const  & __b_rename_at_51, float __c_rename_at_51 );
+inline int32_t _Func_0x60_take_arr_cfccdbdebf24f38 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_29 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a ( Context * __context__, TDim<char *,1> & __a_rename_at_298 );
+inline int32_t foo_5c792fbfce7236c4 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  & __b_rename_at_20 );
+inline char * foobar_c13a61f2b83e9320 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  & __b_rename_at_23 );
+inline bool test_e050b2b4030bc89a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<char *,1> _temp_make_local_18_32;
+	das_global<char *,0x38cc6a8a>(__context__) = ((char *) "test");/*some_a*/
+	das_global<TArray<char *>,0xdcbc922>(__context__) = _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a(__context__,das_arg<TDim<char *,1>>::pass((([&]() -> TDim<char *,1>& {
+		_temp_make_local_18_32(0,__context__) = das_global<char *,0x38cc6a8a>(__context__) /*some_a*/;
+		return _temp_make_local_18_32;
+	})())));/*some_b*/
+}
+
+inline void _Func_0x60_qq_f5c92f11393e1959 ( Context * __context__, int32_t __a_rename_at_51, Block DAS_COMMENT((bool,int32_t,float)) const  &  __b_rename_at_51, float __c_rename_at_51 )
+{
+}
+
+inline int32_t _Func_0x60_take_arr_cfccdbdebf24f38 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_29 )
+{
+	int32_t __summ_rename_at_30 = 0;
+	{
+		bool __need_loop_31 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__a_rename_at_29);
+		int32_t const  * __x_rename_at_31;
+		__need_loop_31 = __x_iterator.first(__context__,(__x_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __x_iterator.next(__context__,(__x_rename_at_31)) )
+		{
+			__summ_rename_at_30 += (*__x_rename_at_31);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_31));
+	};
+	return das_auto_cast<int32_t>::cast(__summ_rename_at_30);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a ( Context * __context__, TDim<char *,1> &  __a_rename_at_298 )
+{
+	TArray<char *> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_299),1);
+	das_copy(das_cast<TDim<char *,1>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__arr_rename_at_299);
+}
+
+inline int32_t foo_5c792fbfce7236c4 ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  &  __b_rename_at_20 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,__b_rename_at_20,3));
+}
+
+inline char * foobar_c13a61f2b83e9320 ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  &  __b_rename_at_23 )
+{
+	return das_auto_cast<char *>::cast(cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(das_invoke<char *>::invoke<int32_t,float>(__context__,__b_rename_at_23,1,2.f)),cast<char *>::from(((char *) "bar")),*__context__)));
+}
+
+inline bool test_e050b2b4030bc89a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,464,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,4> _temp_make_local_63_32;
+	DAS_ASSERT((builtin_array_size(das_global<TArray<char *>,0xdcbc922>(__context__) /*some_b*/) == 1));
+	DAS_VERIFY((_Func_0x60_take_arr_cfccdbdebf24f38(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_63_32(0,__context__) = 1;
+		_temp_make_local_63_32(1,__context__) = 2;
+		_temp_make_local_63_32(2,__context__) = 3;
+		_temp_make_local_63_32(3,__context__) = 4;
+		return _temp_make_local_63_32;
+	})()))) == 10));
+	Foo * __pFoo_rename_at_67 = das_new<Foo>::make(__context__);
+	Foo * __pFooI_rename_at_68 = __pFoo_rename_at_67;
+	das_copy(__pFooI_rename_at_68->bar,1);
+	das_copy(__pFoo_rename_at_67,__pFooI_rename_at_68);
+	DAS_ASSERT((__pFoo_rename_at_67->bar == 1));
+	int32_t __f1_rename_at_81 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,144,0,&__func_info__19567b30,[&](int32_t const  __arg_rename_at_81)->int32_t{
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_81 + 1);
+	})));
+	DAS_ASSERT((__f1_rename_at_81 == 4));
+	int32_t __f2_rename_at_85 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,224,0,&__func_info__19567b30,[&](int32_t const  __arg_rename_at_85)->int32_t{
+
+#if 0
+5
+#endif
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_85 + 2);
+	})));
+	DAS_ASSERT((__f2_rename_at_85 == 5));
+	int32_t __f3_rename_at_89 = ((int32_t)foo_5c792fbfce7236c4(__context__,das_make_block<int32_t,int32_t>(__context__,304,0,&__func_info__19567b30,[&](int32_t const  __arg_rename_at_89)->int32_t{
+		return das_auto_cast<int32_t>::cast(__arg_rename_at_89 + 3);
+	})));
+	DAS_ASSERT((__f3_rename_at_89 == 6));
+	char * __blah_rename_at_93 = ((char *)(char *)(foobar_c13a61f2b83e9320(__context__,das_make_block<char * const ,int32_t,float>(__context__,384,0,&__func_info__b3ac5a85,[&](int32_t const  __ia_rename_at_93, float const  __fb_rename_at_93)->char * const {
+		DAS_ASSERT((__ia_rename_at_93 == 1));
+		DAS_ASSERT((__fb_rename_at_93 == 2.f));
+		return das_auto_cast<char * const >::cast(((char *) "foo"));
+	}))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__blah_rename_at_93),cast<char *>::from(((char *) "foobar")),*__context__)));
+	_Func_0x60_qq_f5c92f11393e1959(__context__,1,das_make_block<bool,int32_t,float>(__context__,448,0,&__func_info__8825e427,[&](int32_t const  __XX_rename_at_113, float const  __YY_rename_at_113)->bool{
+		return das_auto_cast<bool>::cast(true);
+	}),2.f);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_qq_f5c92f11393e1959
+		aotLib[0xc7f9d7c9cbefb8f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((bool,int32_t,float)) const  & , float  ),&_Func_0x60_qq_f5c92f11393e1959>>();
+	};
+		// _Func_0x60_take_arr_cfccdbdebf24f38
+		aotLib[0xfbd2905ccd7e5d25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Func_0x60_take_arr_cfccdbdebf24f38>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a
+		aotLib[0xcbefa7b6d4cca85f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,1> &  ),&_Funcbuiltin_0x60_to_array_move_2e8c0bdee213b31a>>();
+	};
+		// foo_5c792fbfce7236c4
+		aotLib[0x50e2917e52fdf1a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&foo_5c792fbfce7236c4>>();
+	};
+		// foobar_c13a61f2b83e9320
+		aotLib[0xd1e3f366fad1b649] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, Block DAS_COMMENT((char *,int32_t,float)) const  &  ),&foobar_c13a61f2b83e9320>>();
+	};
+		// test_e050b2b4030bc89a
+		aotLib[0x733a9627455e570b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e050b2b4030bc89a>>();
+	};
+		// [[ init script ]]
+		aotLib[0xdb04c3974f110376] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
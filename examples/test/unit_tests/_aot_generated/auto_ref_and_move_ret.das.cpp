@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline TArray<int32_t> foo_c8b5aba60afede2a ( Context * __context__, TArray<int32_t> & __bar_rename_at_4 );
+inline bool test_ec9bdf0be1557aed ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline TArray<int32_t> foo_c8b5aba60afede2a ( Context * __context__, TArray<int32_t> &  __bar_rename_at_4 )
+{
+	TArray<int32_t> * __b_rename_at_5 = &(__bar_rename_at_4);
+	{
+		bool __need_loop_6 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_6;
+		__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass((*__b_rename_at_5)),__x_rename_at_6);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_6));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast((*__b_rename_at_5));
+}
+
+inline bool test_ec9bdf0be1557aed ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_12; das_zero(__a_rename_at_12);
+	{
+		bool __need_loop_13 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_13;
+		__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12),10 - __x_rename_at_13);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_13));
+	};
+	TArray<int32_t> __t_rename_at_15; das_zero(__t_rename_at_15); das_move(__t_rename_at_15, foo_c8b5aba60afede2a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12)));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_12)) == 0));
+	{
+		bool __need_loop_17 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(-10,10));
+		int32_t __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator(__t_rename_at_15);
+		int32_t * __y_rename_at_17;
+		__need_loop_17 = __y_iterator.first(__context__,(__y_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) && __y_iterator.next(__context__,(__y_rename_at_17)) )
+		{
+			DAS_ASSERT((((__x_rename_at_17 < 0) ? das_auto_cast<int32_t>::cast(-__x_rename_at_17) : das_auto_cast<int32_t>::cast(__x_rename_at_17)) == (*__y_rename_at_17)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+		__y_iterator.close(__context__,(__y_rename_at_17));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// foo_c8b5aba60afede2a
+		aotLib[0xaa04be92a22af876] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> &  ),&foo_c8b5aba60afede2a>>();
+	};
+		// test_ec9bdf0be1557aed
+		aotLib[0xb0eea45888ff2f04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ec9bdf0be1557aed>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,257 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__613628aa;
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__758b1d3f;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__a6c45d85;
+extern VarInfo __var_info__f19db34d;
+extern VarInfo __var_info__64a354d7;
+extern VarInfo __var_info__b3d425c2;
+extern VarInfo __var_info__ff30b424;
+extern VarInfo __var_info__7af97d9c;
+extern VarInfo __var_info__3009abdf;
+extern VarInfo __var_info__620803fe;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+
+VarInfo __struct_info__613628aa_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x620803fe, "t", 0 };
+VarInfo __struct_info__613628aa_field_1 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__a6c45d85, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf19db34d, "ta", 8 };
+VarInfo * __struct_info__613628aa_fields[2] =  { &__struct_info__613628aa_field_0, &__struct_info__613628aa_field_1 };
+StructInfo __struct_info__613628aa = {"Bar", __struct_info__613628aa_fields, 2, 32, 0, nullptr, 0x613628aa };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb3d425c2, "data_bool", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3009abdf, "data_int", 4 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xff30b424, "data_float", 8 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tStructure, &__struct_info__613628aa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x64a354d7, "data_bar", 16 };
+uint32_t __type_info__7af97d9c_dim_var_2975371271[1] = { 3 };
+VarInfo __struct_info__b1589007_field_4 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__7af97d9c_dim_var_2975371271, 30, 0x7af97d9c, "data_uint_3", 48 };
+VarInfo * __struct_info__b1589007_fields[5] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3, &__struct_info__b1589007_field_4 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 5, 64, 1, nullptr, 0xb1589007 };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__758b1d3f = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x758b1d3f };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x199df2db };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xc7e1677 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__c7e1677, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__758b1d3f, &__type_info__d445a339 };
+namespace  {
+
+struct Bar {
+	char * t;
+	TArray<float> ta;
+};
+static_assert(sizeof(Bar)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,ta)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	bool data_bool;
+	int32_t data_int;
+	float data_float;
+	Bar data_bar;
+	TDim<uint32_t,3> data_uint_3;
+};
+static_assert(sizeof(Foo)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,data_bool)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_int)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_float)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_bar)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,data_uint_3)==48,"structure field offset mismatch with DAS");
+}
+
+inline Bar Bar_dda7d058b8e590e9 ( Context * __context__ );
+inline Foo Foo_2836593366c7ce8b ( Context * __context__ );
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo & __obj_rename_at_127, TArray<uint8_t> const  & __data_rename_at_127 );
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  & __obj_rename_at_123, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_123 );
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> & __Arr_rename_at_37, float __value_rename_at_37 );
+inline TArray<float> make_10_66d8f173ae0527a1 ( Context * __context__ );
+inline bool test_c1a078e7fa9789ce ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Bar Bar_dda7d058b8e590e9 ( Context * __context__ )
+{
+	return /* <- */ das_auto_cast<Bar>::cast((([&]() -> Bar {
+		Bar __mks_9;
+		das_copy((__mks_9.t),(((char *) "blah")));
+		das_move((__mks_9.ta),(make_10_66d8f173ae0527a1(__context__)));
+		return __mks_9;
+	})()));
+}
+
+inline Foo Foo_2836593366c7ce8b ( Context * __context__ )
+{
+	return /* <- */ das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_13;
+		das_copy((__mks_13.data_bool),(true));
+		das_copy((__mks_13.data_int),(1));
+		das_copy((__mks_13.data_float),(3.1400001f));
+		das_move((__mks_13.data_bar),(Bar_dda7d058b8e590e9(__context__)));
+		das_copy((__mks_13.data_uint_3),((([&]() -> TDim<uint32_t,3> {
+			TDim<uint32_t,3> __mka_18;
+			__mka_18(0,__context__) = 0x1u;
+			__mka_18(1,__context__) = 0x2u;
+			__mka_18(2,__context__) = 0x3u;
+			return __mka_18;
+		})())));
+		return __mks_13;
+	})()));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo &  __obj_rename_at_127, TArray<uint8_t> const  &  __data_rename_at_127 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo &>::from(__obj_rename_at_127),cast<TArray<uint8_t> const  &>::from(__data_rename_at_127)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  &  __obj_rename_at_123, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_123 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<Foo const  &>::from(__obj_rename_at_123),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_123)));
+}
+
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> &  __Arr_rename_at_37, float __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline TArray<float> make_10_66d8f173ae0527a1 ( Context * __context__ )
+{
+	TArray<float> __a_rename_at_4; das_zero(__a_rename_at_4);
+	{
+		bool __need_loop_5 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_5;
+		__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+		{
+			_Funcbuiltin_0x60_push_ce4ed03e40d5734(__context__,das_arg<TArray<float>>::pass(__a_rename_at_4),float(__i_rename_at_5));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_5));
+	};
+	return /* <- */ das_auto_cast<TArray<float>>::cast(__a_rename_at_4);
+}
+
+inline bool test_c1a078e7fa9789ce ( Context * __context__ ) { das_stack_prologue __prologue(__context__,240,"test " DAS_FILE_LINE);
+{
+	Foo __f0_rename_at_22_ConstRef; das_zero(__f0_rename_at_22_ConstRef); das_move(__f0_rename_at_22_ConstRef, ((Foo)Foo_2836593366c7ce8b(__context__)));
+	Foo const  & __f0_rename_at_22 = __f0_rename_at_22_ConstRef; ;
+	Foo __f1_rename_at_23; das_zero(__f1_rename_at_23);
+	_Funcbuiltin_0x60_binary_save_df945637b1078ab2(__context__,__f0_rename_at_22,das_make_block<void,TArray<uint8_t> const  &>(__context__,208,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_24)->void{
+		_Funcbuiltin_0x60_binary_load_43040880b26c4465(__context__,das_arg<Foo>::pass(__f1_rename_at_23),__data_rename_at_24);
+		DAS_ASSERT((__f1_rename_at_23.data_bool == true));
+		DAS_ASSERT((__f1_rename_at_23.data_int == 1));
+		DAS_ASSERT((__f1_rename_at_23.data_float == 3.1400001f));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f1_rename_at_23.data_bar.t),cast<char *>::from(((char *) "blah")),*__context__)));
+		DAS_ASSERT((((__f1_rename_at_23.data_uint_3(0,__context__) == 0x1u) && (__f1_rename_at_23.data_uint_3(1,__context__) == 0x2u)) && (__f1_rename_at_23.data_uint_3(2,__context__) == 0x3u)));
+		{
+			bool __need_loop_31 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,10));
+			int32_t __i_rename_at_31;
+			__need_loop_31 = __i_iterator.first(__context__,(__i_rename_at_31)) && __need_loop_31;
+			for ( ; __need_loop_31 ; __need_loop_31 = __i_iterator.next(__context__,(__i_rename_at_31)) )
+			{
+				DAS_ASSERT((__f1_rename_at_23.data_bar.ta(__i_rename_at_31,__context__) == float(__i_rename_at_31)));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_31));
+		};
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_dda7d058b8e590e9
+		aotLib[0x129e883bc95172d0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Bar (*) ( Context * __context__ ),&Bar_dda7d058b8e590e9>>();
+	};
+		// Foo_2836593366c7ce8b
+		aotLib[0x956a92d88d490308] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_2836593366c7ce8b>>();
+	};
+		// _Funcbuiltin_0x60_binary_load_43040880b26c4465
+		aotLib[0x6bdd023c49b23d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_43040880b26c4465>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_df945637b1078ab2
+		aotLib[0xd0fc38c10c0acad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_df945637b1078ab2>>();
+	};
+		// _Funcbuiltin_0x60_push_ce4ed03e40d5734
+		aotLib[0xede21779ebee9565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_ce4ed03e40d5734>>();
+	};
+		// make_10_66d8f173ae0527a1
+		aotLib[0x5978c04fa89645] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__ ),&make_10_66d8f173ae0527a1>>();
+	};
+		// test_c1a078e7fa9789ce
+		aotLib[0x2ef55f8836b95344] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c1a078e7fa9789ce>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,355 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Particle {
+	float3 pos;
+	float3 vel;
+};
+static_assert(sizeof(Particle)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,vel)==12,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_d6baa2692888251 ( Context * __context__, TArray<Particle> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_1bf9fda995f6b88b ( Context * __context__, TArray<Particle> & __Arr_rename_at_37, Particle const  & __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_849490234bd0a021 ( Context * __context__, Particle & ____this_rename_at_1 );
+inline int32_t pairs_63550aa6dbb965f0 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_25 );
+inline void scale_8ab8a7b121124ee0 ( Context * __context__, TArray<int32_t> & __a_rename_at_17, int32_t __s_rename_at_17 );
+inline int32_t shrink_and_read_1e087954c8c15656 ( Context * __context__, TArray<int32_t> & __a_rename_at_32 );
+inline int32_t sum_26332f204177739c ( Context * __context__, TArray<int32_t> const  & __a_rename_at_5 );
+inline int32_t sum_tail_d3958489c9876070 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_11 );
+inline bool test_c6fc1edaba618d7e ( Context * __context__ );
+inline void update_176907a922a85491 ( Context * __context__, TArray<Particle> & __p_rename_at_21, float __dt_rename_at_21 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_d6baa2692888251 ( Context * __context__, TArray<Particle> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : Particle aka TT&
+		das_iterator<TArray<Particle>> __aV_iterator(__a_rename_at_186);
+		Particle * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_849490234bd0a021(__context__,das_arg<Particle>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<Particle>>::pass(__a_rename_at_186),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_1bf9fda995f6b88b ( Context * __context__, TArray<Particle> &  __Arr_rename_at_37, Particle const  &  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<Particle>>::pass(__Arr_rename_at_37),24,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void finalize_849490234bd0a021 ( Context * __context__, Particle &  ____this_rename_at_1 )
+{
+	memset(&(____this_rename_at_1), 0, 24);
+}
+
+inline int32_t pairs_63550aa6dbb965f0 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_25 )
+{
+	int32_t __total_rename_at_26 = 0;
+	{
+		bool __need_loop_27 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_25)));
+		int32_t __i_rename_at_27;
+		__need_loop_27 = __i_iterator.first(__context__,(__i_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __i_iterator.next(__context__,(__i_rename_at_27)) )
+		{
+			{
+				bool __need_loop_28 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(mk_range(builtin_array_size(__a_rename_at_25)));
+				int32_t __j_rename_at_28;
+				__need_loop_28 = __j_iterator.first(__context__,(__j_rename_at_28)) && __need_loop_28;
+				for ( ; __need_loop_28 ; __need_loop_28 = __j_iterator.next(__context__,(__j_rename_at_28)) )
+				{
+					__total_rename_at_26 += (__a_rename_at_25[__i_rename_at_27] * __a_rename_at_25[__j_rename_at_28]);
+				}
+				__j_iterator.close(__context__,(__j_rename_at_28));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_27));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_26);
+}
+
+inline void scale_8ab8a7b121124ee0 ( Context * __context__, TArray<int32_t> &  __a_rename_at_17, int32_t __s_rename_at_17 )
+{
+	{
+		bool __need_loop_18 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_17))));
+		int32_t __i_rename_at_18;
+		__need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __i_iterator.next(__context__,(__i_rename_at_18)) )
+		{
+			__a_rename_at_17[__i_rename_at_18] *= __s_rename_at_17;
+		}
+		__i_iterator.close(__context__,(__i_rename_at_18));
+	};
+}
+
+inline int32_t shrink_and_read_1e087954c8c15656 ( Context * __context__, TArray<int32_t> &  __a_rename_at_32 )
+{
+	int32_t __total_rename_at_33 = 0;
+	{
+		bool __need_loop_34 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_32))));
+		int32_t __i_rename_at_34;
+		__need_loop_34 = __i_iterator.first(__context__,(__i_rename_at_34)) && __need_loop_34;
+		for ( ; __need_loop_34 ; __need_loop_34 = __i_iterator.next(__context__,(__i_rename_at_34)) )
+		{
+			if ( __i_rename_at_34 == 2 )
+			{
+				_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_32),1);
+			};
+			__total_rename_at_33 += __a_rename_at_32(__i_rename_at_34,__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_34));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_33);
+}
+
+inline int32_t sum_26332f204177739c ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_5 )
+{
+	int32_t __total_rename_at_6 = 0;
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__a_rename_at_5)));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			__total_rename_at_6 += __a_rename_at_5[__i_rename_at_7];
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_6);
+}
+
+inline int32_t sum_tail_d3958489c9876070 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_11 )
+{
+	int32_t __total_rename_at_12 = 0;
+	{
+		bool __need_loop_13 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,builtin_array_size(__a_rename_at_11)));
+		int32_t __i_rename_at_13;
+		__need_loop_13 = __i_iterator.first(__context__,(__i_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __i_iterator.next(__context__,(__i_rename_at_13)) )
+		{
+			__total_rename_at_12 += __a_rename_at_11[__i_rename_at_13];
+		}
+		__i_iterator.close(__context__,(__i_rename_at_13));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_12);
+}
+
+inline bool test_c6fc1edaba618d7e ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_42; das_zero(__a_rename_at_42);
+	{
+		bool __need_loop_43 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,10));
+		int32_t __i_rename_at_43;
+		__need_loop_43 = __i_iterator.first(__context__,(__i_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __i_iterator.next(__context__,(__i_rename_at_43)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42),__i_rename_at_43);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_43));
+	};
+	DAS_ASSERT((sum_26332f204177739c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42)) == 45));
+	DAS_ASSERT((sum_tail_d3958489c9876070(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42)) == 45));
+	scale_8ab8a7b121124ee0(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42),2);
+	DAS_ASSERT((sum_26332f204177739c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42)) == 90));
+	DAS_ASSERT((pairs_63550aa6dbb965f0(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42)) == 8100));
+	TArray<Particle> __p_rename_at_50; das_zero(__p_rename_at_50);
+	{
+		bool __need_loop_51 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,4));
+		int32_t __i_rename_at_51;
+		__need_loop_51 = __i_iterator.first(__context__,(__i_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __i_iterator.next(__context__,(__i_rename_at_51)) )
+		{
+			Particle _temp_make_local_52_128;
+			_Funcbuiltin_0x60_push_1bf9fda995f6b88b(__context__,das_arg<TArray<Particle>>::pass(__p_rename_at_50),das_arg<Particle>::pass((([&]() -> Particle& {
+				das_copy((_temp_make_local_52_128.pos),(v_splats(float(__i_rename_at_51))));
+				das_copy((_temp_make_local_52_128.vel),(v_splats(1.f)));
+				return _temp_make_local_52_128;
+			})())));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_51));
+	};
+	update_176907a922a85491(__context__,das_arg<TArray<Particle>>::pass(__p_rename_at_50),0.5f);
+	DAS_ASSERT((SimPolicy<float3>::Equ(__p_rename_at_50(3,__context__).pos,v_splats(3.5f),*__context__)));
+	bool __failed_rename_at_56 = false;
+	das_try_recover(__context__, [&]()
+	{
+		shrink_and_read_1e087954c8c15656(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_56,true);
+	});
+	DAS_ASSERT((__failed_rename_at_56));
+	TArray<int32_t> __empty_rename_at_62; das_zero(__empty_rename_at_62);
+	DAS_ASSERT((sum_26332f204177739c(__context__,das_arg<TArray<int32_t>>::pass(__empty_rename_at_62)) == 0));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_42));
+	_Funcbuiltin_0x60_finalize_d6baa2692888251(__context__,das_arg<TArray<Particle>>::pass(__p_rename_at_50));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void update_176907a922a85491 ( Context * __context__, TArray<Particle> &  __p_rename_at_21, float __dt_rename_at_21 )
+{
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(das_arg<TArray<Particle>>::pass(__p_rename_at_21))));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&(__p_rename_at_21[__i_rename_at_22].pos),(SimPolicy<float3>::MulVecScal(__p_rename_at_21[__i_rename_at_22].vel,cast<float>::from(__dt_rename_at_21),*__context__)),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_d6baa2692888251
+		aotLib[0x970027545c82ba4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Particle> &  ),&_Funcbuiltin_0x60_finalize_d6baa2692888251>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_1bf9fda995f6b88b
+		aotLib[0xadf63f6dcd4a04c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Particle> & , Particle const  &  ),&_Funcbuiltin_0x60_push_1bf9fda995f6b88b>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// finalize_849490234bd0a021
+		aotLib[0x2d7cc9ca1e7313a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle &  ),&finalize_849490234bd0a021>>();
+	};
+		// pairs_63550aa6dbb965f0
+		aotLib[0x24154fd9cdb521f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&pairs_63550aa6dbb965f0>>();
+	};
+		// scale_8ab8a7b121124ee0
+		aotLib[0x89a1bc52b77a7c59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&scale_8ab8a7b121124ee0>>();
+	};
+		// shrink_and_read_1e087954c8c15656
+		aotLib[0xfb84f6d1f28e4cbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> &  ),&shrink_and_read_1e087954c8c15656>>();
+	};
+		// sum_26332f204177739c
+		aotLib[0x90bb442af6c1e375] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&sum_26332f204177739c>>();
+	};
+		// sum_tail_d3958489c9876070
+		aotLib[0xf78d28a918547c81] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  &  ),&sum_tail_d3958489c9876070>>();
+	};
+		// test_c6fc1edaba618d7e
+		aotLib[0xc6717411f3e1c5ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c6fc1edaba618d7e>>();
+	};
+		// update_176907a922a85491
+		aotLib[0x7719141405414c39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Particle> & , float  ),&update_176907a922a85491>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,322 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require bulk
+#include "daScript/simulate/aot_builtin_bulk.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<float> make_floats_f07ac186636e4d31 ( Context * __context__, int32_t __n_rename_at_4 );
+inline TArray<int32_t> make_ints_fe84f687817e8fc2 ( Context * __context__, int32_t __n_rename_at_11 );
+inline bool test_39c411b8cff3b898 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_4da34799ba0520c5 ( Context * __context__, TArray<float> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<float>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<float4>>::pass(__a_rename_at_186),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_761fb73a377a5e66 ( Context * __context__, TArray<float4> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float4>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<float> make_floats_f07ac186636e4d31 ( Context * __context__, int32_t __n_rename_at_4 )
+{
+	TArray<float> __a_rename_at_5; das_zero(__a_rename_at_5);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__a_rename_at_5),__n_rename_at_4);
+	{
+		bool __need_loop_7 = true;
+		// x : float&
+		das_iterator<TArray<float>> __x_iterator(__a_rename_at_5);
+		float * __x_rename_at_7;
+		__need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7)) && __need_loop_7;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7)) && __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			das_copy((*__x_rename_at_7),float(__i_rename_at_7));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_7));
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+	return /* <- */ das_auto_cast<TArray<float>>::cast(__a_rename_at_5);
+}
+
+inline TArray<int32_t> make_ints_fe84f687817e8fc2 ( Context * __context__, int32_t __n_rename_at_11 )
+{
+	TArray<int32_t> __a_rename_at_12; das_zero(__a_rename_at_12);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_12),__n_rename_at_11);
+	{
+		bool __need_loop_14 = true;
+		// x : int&
+		das_iterator<TArray<int32_t>> __x_iterator(__a_rename_at_12);
+		int32_t * __x_rename_at_14;
+		__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_11));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) && __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			das_copy((*__x_rename_at_14),__i_rename_at_14 - (SimPolicy<int32_t>::Div(__n_rename_at_11,2,*__context__)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_14));
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__a_rename_at_12);
+}
+
+inline bool test_39c411b8cff3b898 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_21_32;
+	{
+		bool __need_loop_21 = true;
+		// n : int&
+		das_iterator<TDim<int32_t,4>> __n_iterator((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_21_32(0,__context__) = 1;
+			_temp_make_local_21_32(1,__context__) = 4;
+			_temp_make_local_21_32(2,__context__) = 7;
+			_temp_make_local_21_32(3,__context__) = 33;
+			return _temp_make_local_21_32;
+		})()));
+		int32_t * __n_rename_at_21;
+		__need_loop_21 = __n_iterator.first(__context__,(__n_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __n_iterator.next(__context__,(__n_rename_at_21)) )
+		{
+			TArray<float> _temp_make_local_36_160;
+			TArray<float> __f_rename_at_22; das_zero(__f_rename_at_22); das_move(__f_rename_at_22, make_floats_f07ac186636e4d31(__context__,(*__n_rename_at_21)));
+			TArray<int32_t> __i_rename_at_23; das_zero(__i_rename_at_23); das_move(__i_rename_at_23, make_ints_fe84f687817e8fc2(__context__,(*__n_rename_at_21)));
+			DAS_ASSERT((bulkSumFloat(das_arg<TArray<float>>::pass(__f_rename_at_22)) == float(SimPolicy<int32_t>::Div(((*__n_rename_at_21) * ((*__n_rename_at_21) - 1)),2,*__context__))));
+			DAS_ASSERT(((bulkMinFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),__context__) == 0.f) && (bulkMaxFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),__context__) == float((*__n_rename_at_21) - 1))));
+			DAS_ASSERT(((bulkMinInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),__context__) == -((SimPolicy<int32_t>::Div((*__n_rename_at_21),2,*__context__)))) && (bulkMaxInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),__context__) == (((*__n_rename_at_21) - 1) - (SimPolicy<int32_t>::Div((*__n_rename_at_21),2,*__context__))))));
+			DAS_ASSERT((bulkDotFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),das_arg<TArray<float>>::pass(__f_rename_at_22),__context__) == float(SimPolicy<int32_t>::Div(((((*__n_rename_at_21) - 1) * (*__n_rename_at_21)) * ((2 * (*__n_rename_at_21)) - 1)),6,*__context__))));
+			DAS_ASSERT((bulkCountLessFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),2.f) == SimPolicy<int32_t>::Min((*__n_rename_at_21),2,*__context__)));
+			DAS_ASSERT((bulkCountGreaterInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),0) == (((*__n_rename_at_21) - 1) - (SimPolicy<int32_t>::Div((*__n_rename_at_21),2,*__context__)))));
+			DAS_ASSERT((bulkCountEqualInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),0) == 1));
+			int32_t __isum_rename_at_31 = 0;
+			{
+				bool __need_loop_32 = true;
+				// x : int&
+				das_iterator<TArray<int32_t>> __x_iterator(__i_rename_at_23);
+				int32_t * __x_rename_at_32;
+				__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+				for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) )
+				{
+					__isum_rename_at_31 += (*__x_rename_at_32);
+				}
+				__x_iterator.close(__context__,(__x_rename_at_32));
+			};
+			DAS_ASSERT((bulkSumInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23)) == __isum_rename_at_31));
+			bulkScaleFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),2.f);
+			bulkAxpyFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),-1.f,das_arg<TArray<float>>::pass((_temp_make_local_36_160 = (make_floats_f07ac186636e4d31(__context__,(*__n_rename_at_21))))),__context__);
+			{
+				bool __need_loop_37 = true;
+				// x : float&
+				das_iterator<TArray<float>> __x_iterator(__f_rename_at_22);
+				float * __x_rename_at_37;
+				__need_loop_37 = __x_iterator.first(__context__,(__x_rename_at_37)) && __need_loop_37;
+				// t : int const
+				das_iterator<range> __t_iterator(mk_range((*__n_rename_at_21)));
+				int32_t __t_rename_at_37;
+				__need_loop_37 = __t_iterator.first(__context__,(__t_rename_at_37)) && __need_loop_37;
+				for ( ; __need_loop_37 ; __need_loop_37 = __x_iterator.next(__context__,(__x_rename_at_37)) && __t_iterator.next(__context__,(__t_rename_at_37)) )
+				{
+					DAS_ASSERT(((*__x_rename_at_37) == float(__t_rename_at_37)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_37));
+				__t_iterator.close(__context__,(__t_rename_at_37));
+			};
+			bulkClampFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),1.f,2.f);
+			DAS_ASSERT(((bulkMinFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),__context__) == 1.f) && (bulkMaxFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),__context__) == (((*__n_rename_at_21) >= 3) ? das_auto_cast<float>::cast(2.f) : das_auto_cast<float>::cast(1.f)))));
+			bulkClampInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),-1,1);
+			DAS_ASSERT(((bulkCountLessInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),-1) == 0) && (bulkCountGreaterInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),1) == 0)));
+			TArray<float> __g_rename_at_43; das_zero(__g_rename_at_43);
+			bulkCopyFloat(das_arg<TArray<float>>::pass(__g_rename_at_43),das_arg<TArray<float>>::pass(__f_rename_at_22),__context__);
+			DAS_ASSERT(((builtin_array_size(das_arg<TArray<float>>::pass(__g_rename_at_43)) == (*__n_rename_at_21)) && (bulkSumFloat(das_arg<TArray<float>>::pass(__g_rename_at_43)) == bulkSumFloat(das_arg<TArray<float>>::pass(__f_rename_at_22)))));
+			_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__g_rename_at_43));
+			bulkFillFloat(das_arg<TArray<float>>::pass(__f_rename_at_22),3.f);
+			bulkFillInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23),5);
+			DAS_ASSERT(((bulkSumFloat(das_arg<TArray<float>>::pass(__f_rename_at_22)) == float(3 * (*__n_rename_at_21))) && (bulkSumInt(das_arg<TArray<int32_t>>::pass(__i_rename_at_23)) == (5 * (*__n_rename_at_21)))));
+			_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__f_rename_at_22));
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__i_rename_at_23));
+		}
+		__n_iterator.close(__context__,(__n_rename_at_21));
+	};
+	TArray<float4> __v_rename_at_53; das_zero(__v_rename_at_53);
+	_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__v_rename_at_53),3);
+	bulkFillFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),v_make_vec4f(1.f,2.f,3.f,4.f));
+	DAS_ASSERT((SimPolicy<float4>::Equ(bulkSumFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53)),v_make_vec4f(3.f,6.f,9.f,12.f),*__context__)));
+	TArray<float4> __w_rename_at_57; das_zero(__w_rename_at_57);
+	_Funcbuiltin_0x60_resize_761fb73a377a5e66(__context__,das_arg<TArray<float4>>::pass(__w_rename_at_57),3);
+	{
+		bool __need_loop_59 = true;
+		// x : float4&
+		das_iterator<TArray<float4>> __x_iterator(__w_rename_at_57);
+		float4 * __x_rename_at_59;
+		__need_loop_59 = __x_iterator.first(__context__,(__x_rename_at_59)) && __need_loop_59;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_59;
+		__need_loop_59 = __t_iterator.first(__context__,(__t_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __x_iterator.next(__context__,(__x_rename_at_59)) && __t_iterator.next(__context__,(__t_rename_at_59)) )
+		{
+			das_copy((*__x_rename_at_59),v_splats(float(__t_rename_at_59)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_59));
+		__t_iterator.close(__context__,(__t_rename_at_59));
+	};
+	bulkAxpyFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),2.f,das_arg<TArray<float4>>::pass(__w_rename_at_57),__context__);
+	DAS_ASSERT((SimPolicy<float4>::Equ(__v_rename_at_53(2,__context__),v_make_vec4f(5.f,6.f,7.f,8.f),*__context__)));
+	DAS_ASSERT(((SimPolicy<float4>::Equ(bulkMinFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),__context__),v_make_vec4f(1.f,2.f,3.f,4.f),*__context__)) && (SimPolicy<float4>::Equ(bulkMaxFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),__context__),v_make_vec4f(5.f,6.f,7.f,8.f),*__context__))));
+	bulkScaleFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),0.5f);
+	bulkClampFloat4(das_arg<TArray<float4>>::pass(__v_rename_at_53),v_splats(1.f),v_splats(3.f));
+	DAS_ASSERT(((SimPolicy<float4>::Equ(__v_rename_at_53(0,__context__),v_make_vec4f(1.f,1.f,1.5f,2.f),*__context__)) && (SimPolicy<float4>::Equ(__v_rename_at_53(2,__context__),v_make_vec4f(2.5f,3.f,3.f,3.f),*__context__))));
+	_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(__v_rename_at_53));
+	_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(__w_rename_at_57));
+	TArray<float> __a_rename_at_70; das_zero(__a_rename_at_70);
+	TArray<float> __b_rename_at_71; das_zero(__b_rename_at_71);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__a_rename_at_70),3);
+	bool __failed_rename_at_73 = false;
+	das_try_recover(__context__, [&]()
+	{
+		bulkAxpyFloat(das_arg<TArray<float>>::pass(__a_rename_at_70),1.f,das_arg<TArray<float>>::pass(__b_rename_at_71),__context__);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_73,true);
+	});
+	DAS_ASSERT((__failed_rename_at_73));
+	das_copy(__failed_rename_at_73,false);
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(__failed_rename_at_73,bulkMinFloat(das_arg<TArray<float>>::pass(__b_rename_at_71),__context__) > 0.f);
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_73,true);
+	});
+	DAS_ASSERT((__failed_rename_at_73));
+	_Funcbuiltin_0x60_finalize_4da34799ba0520c5(__context__,das_arg<TArray<float>>::pass(__a_rename_at_70));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_4da34799ba0520c5
+		aotLib[0xbd5f701fe616ff75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_finalize_4da34799ba0520c5>>();
+	};
+		// _Funcbuiltin_0x60_finalize_cd1514d2d7718b99
+		aotLib[0xcaeab429993cce4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60_finalize_cd1514d2d7718b99>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// _Funcbuiltin_0x60_resize_761fb73a377a5e66
+		aotLib[0xc267e309ce3735b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , int32_t  ),&_Funcbuiltin_0x60_resize_761fb73a377a5e66>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// make_floats_f07ac186636e4d31
+		aotLib[0x44d4988c30f62cb4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, int32_t  ),&make_floats_f07ac186636e4d31>>();
+	};
+		// make_ints_fe84f687817e8fc2
+		aotLib[0xfecd6237b86ae36d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, int32_t  ),&make_ints_fe84f687817e8fc2>>();
+	};
+		// test_39c411b8cff3b898
+		aotLib[0xe0490eb41f42e6df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_39c411b8cff3b898>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,110 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline uint32_t GetGoo_bac7d35460df3974 ( Context * __context__, char * const  __arg_rename_at_9 );
+inline uint32_t GetGoo2_6b257c120a5b623c ( Context * __context__, char * const  __arg_rename_at_13 );
+inline bool test_19958d51c82796b3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TestObjectFoo,0x30c0dc12>(__context__);/*foo*/
+}
+
+inline uint32_t GetGoo_bac7d35460df3974 ( Context * __context__, char * const  __arg_rename_at_9 )
+{
+	return das_auto_cast<uint32_t>::cast(CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x30c0dc12>(__context__) /*foo*/),__arg_rename_at_9,__context__));
+}
+
+inline uint32_t GetGoo2_6b257c120a5b623c ( Context * __context__, char * const  __arg_rename_at_13 )
+{
+	return das_auto_cast<uint32_t>::cast(CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x30c0dc12>(__context__) /*foo*/),__arg_rename_at_13,__context__));
+}
+
+inline bool test_19958d51c82796b3 ( Context * __context__ )
+{
+	uint32_t __a_rename_at_18 = ((uint32_t)CheckEidHint(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x30c0dc12>(__context__) /*foo*/),((char *) "goo"),0x3d1b8dacu,__context__));
+	uint32_t __b_rename_at_19 = ((uint32_t)GetGoo_bac7d35460df3974(__context__,((char *) "goo")));
+	DAS_ASSERT((__a_rename_at_18 == __b_rename_at_19));
+	uint32_t __a2_rename_at_21 = ((uint32_t)CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x30c0dc12>(__context__) /*foo*/),((char *) "goo"),__context__));
+	uint32_t __b2_rename_at_22 = ((uint32_t)GetGoo2_6b257c120a5b623c(__context__,((char *) "goo")));
+	DAS_ASSERT((__a2_rename_at_21 == __b2_rename_at_22));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// GetGoo_bac7d35460df3974
+		aotLib[0x1939089bf8fa63ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, char * const   ),&GetGoo_bac7d35460df3974>>();
+	};
+		// GetGoo2_6b257c120a5b623c
+		aotLib[0x90752f879349e9d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, char * const   ),&GetGoo2_6b257c120a5b623c>>();
+	};
+		// test_19958d51c82796b3
+		aotLib[0xd6dc229f34364e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_19958d51c82796b3>>();
+	};
+		// [[ init script ]]
+		aotLib[0x1875847cf872da5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
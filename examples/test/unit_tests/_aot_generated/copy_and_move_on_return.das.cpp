@@ -0,0 +1,282 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__c7e1677;
+extern VarInfo __var_info__e7273bba;
+extern FuncInfo __func_info__96c0e1d1;
+extern FuncInfo __func_info__a486018f;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe7273bba, "bar", 0 };
+VarInfo * __struct_info__b1589007_fields[1] =  { &__struct_info__b1589007_field_0 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 1, 4, -1, nullptr, 0xb1589007 };
+FuncInfo __func_info__96c0e1d1 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__c7e1677, nullptr,0,0x96c0e1d1, 0x0 };
+FuncInfo __func_info__a486018f = {"invoke block<array<int>> const", "", nullptr, 0, 32, &__type_info__260b3481, nullptr,0,0xa486018f, 0x0 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xc7e1677 };
+
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline TArray<int32_t> _Func_0x60_joinSequences_86681ec5a4d65514 ( Context * __context__, TArray<int32_t> const  & __l_rename_at_22, TArray<int32_t> const  & __r_rename_at_22 );
+inline TArray<int32_t> _Func_0x60_makeSequence_375eb005a17de004 ( Context * __context__, int32_t __base_rename_at_15, int32_t __max_rename_at_15 );
+inline TArray<int32_t> _Func_0x60_makeSequenceB_1cc4dd5f892999c9 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_31 );
+inline int32_t addBar_6f74918216b0613 ( Context * __context__, Foo const  & __a_rename_at_12, Foo const  & __b_rename_at_12 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline Foo newFoo_5cef7b4dce48b6b0 ( Context * __context__ );
+inline Foo newFooB_367316257dba54e5 ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __b_rename_at_9 );
+inline bool test_cd3129e0f081eb1c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> _Func_0x60_joinSequences_86681ec5a4d65514 ( Context * __context__, TArray<int32_t> const  &  __l_rename_at_22, TArray<int32_t> const  &  __r_rename_at_22 )
+{
+	TArray<int32_t> __a_rename_at_23; das_zero(__a_rename_at_23);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),builtin_array_size(__l_rename_at_22) + builtin_array_size(__r_rename_at_22));
+	{
+		bool __need_loop_25 = true;
+		// t : int aka numT const&
+		das_iterator<TArray<int32_t> const > __t_iterator(__l_rename_at_22);
+		int32_t const  * __t_rename_at_25;
+		__need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),(*__t_rename_at_25));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_25));
+	};
+	{
+		bool __need_loop_27 = true;
+		// t : int const&
+		das_iterator<TArray<int32_t> const > __t_iterator(__r_rename_at_22);
+		int32_t const  * __t_rename_at_27;
+		__need_loop_27 = __t_iterator.first(__context__,(__t_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __t_iterator.next(__context__,(__t_rename_at_27)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),(*__t_rename_at_27));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_27));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__a_rename_at_23);
+}
+
+inline TArray<int32_t> _Func_0x60_makeSequence_375eb005a17de004 ( Context * __context__, int32_t __base_rename_at_15, int32_t __max_rename_at_15 )
+{
+	TArray<int32_t> __a_rename_at_16; das_zero(__a_rename_at_16);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),(__max_rename_at_15 + 1) - __base_rename_at_15);
+	{
+		bool __need_loop_18 = true;
+		// t : int&
+		das_iterator<TArray<int32_t>> __t_iterator(__a_rename_at_16);
+		int32_t * __t_rename_at_18;
+		__need_loop_18 = __t_iterator.first(__context__,(__t_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __t_iterator.next(__context__,(__t_rename_at_18)) )
+		{
+			das_copy((*__t_rename_at_18),__base_rename_at_15++);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_18));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__a_rename_at_16);
+}
+
+inline TArray<int32_t> _Func_0x60_makeSequenceB_1cc4dd5f892999c9 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_31 )
+{
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,__b_rename_at_31));
+}
+
+inline int32_t addBar_6f74918216b0613 ( Context * __context__, Foo const  &  __a_rename_at_12, Foo const  &  __b_rename_at_12 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_12.bar + __b_rename_at_12.bar);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline Foo newFoo_5cef7b4dce48b6b0 ( Context * __context__ )
+{
+	Foo __t_rename_at_5; das_zero(__t_rename_at_5);
+	das_copy(__t_rename_at_5.bar,1);
+	return das_auto_cast<Foo>::cast(__t_rename_at_5);
+}
+
+inline Foo newFooB_367316257dba54e5 ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __b_rename_at_9 )
+{
+	return das_auto_cast<Foo>::cast(das_invoke<Foo>::invoke_cmres(__context__,__b_rename_at_9));
+}
+
+inline bool test_cd3129e0f081eb1c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,640,"test " DAS_FILE_LINE);
+{
+	Foo _temp_make_local_37_48;
+	Foo _temp_make_local_37_64;
+	Foo _temp_make_local_39_96;
+	Foo _temp_make_local_40_192;
+	TArray<int32_t> _temp_make_local_43_320;
+	TArray<int32_t> _temp_make_local_43_352;
+	TArray<int32_t> _temp_make_local_48_432;
+	TArray<int32_t> _temp_make_local_49_528;
+	int32_t __t_rename_at_37 = ((int32_t)((_temp_make_local_37_48 = (newFoo_5cef7b4dce48b6b0(__context__))).bar + (_temp_make_local_37_64 = (newFoo_5cef7b4dce48b6b0(__context__))).bar));
+	DAS_ASSERT((__t_rename_at_37 == 2));
+	int32_t __tt_rename_at_39 = ((int32_t)addBar_6f74918216b0613(__context__,das_arg<Foo>::pass((_temp_make_local_39_96 = (newFooB_367316257dba54e5(__context__,das_make_block_cmres<Foo>(__context__,160,0,&__func_info__96c0e1d1,[&]()->Foo{
+		Foo __T_rename_at_39; das_zero(__T_rename_at_39);
+		das_copy(__T_rename_at_39.bar,1);
+		return das_auto_cast<Foo>::cast(__T_rename_at_39);
+	}))))),das_arg<Foo>::pass((_temp_make_local_40_192 = (newFooB_367316257dba54e5(__context__,das_make_block_cmres<Foo>(__context__,256,0,&__func_info__96c0e1d1,[&]()->Foo{
+		Foo __T_rename_at_40; das_zero(__T_rename_at_40);
+		das_copy(__T_rename_at_40.bar,1);
+		return das_auto_cast<Foo>::cast(__T_rename_at_40);
+	})))))));
+	DAS_ASSERT((__tt_rename_at_39 == 2));
+	TArray<int32_t> __z_rename_at_43_ConstRef; das_zero(__z_rename_at_43_ConstRef); das_move(__z_rename_at_43_ConstRef, ((TArray<int32_t>)_Func_0x60_joinSequences_86681ec5a4d65514(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_43_320 = (_Func_0x60_makeSequence_375eb005a17de004(__context__,0,4)))),das_arg<TArray<int32_t>>::pass((_temp_make_local_43_352 = (_Func_0x60_makeSequence_375eb005a17de004(__context__,5,9)))))));
+	TArray<int32_t> const  & __z_rename_at_43 = __z_rename_at_43_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__z_rename_at_43) == 10));
+	{
+		bool __need_loop_45 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,9));
+		int32_t __t_rename_at_45;
+		__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+		{
+			DAS_ASSERT((__z_rename_at_43(__t_rename_at_45,__context__) == __t_rename_at_45));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_45));
+	};
+	TArray<int32_t> __zz_rename_at_48_ConstRef; das_zero(__zz_rename_at_48_ConstRef); das_move(__zz_rename_at_48_ConstRef, ((TArray<int32_t>)_Func_0x60_joinSequences_86681ec5a4d65514(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_48_432 = (_Func_0x60_makeSequenceB_1cc4dd5f892999c9(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,512,0,&__func_info__a486018f,[&]()->TArray<int32_t>{
+		return /* <- */ das_auto_cast<TArray<int32_t>>::cast(_Func_0x60_makeSequence_375eb005a17de004(__context__,0,4));
+	}))))),das_arg<TArray<int32_t>>::pass((_temp_make_local_49_528 = (_Func_0x60_makeSequenceB_1cc4dd5f892999c9(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,608,0,&__func_info__a486018f,[&]()->TArray<int32_t>{
+		return /* <- */ das_auto_cast<TArray<int32_t>>::cast(_Func_0x60_makeSequence_375eb005a17de004(__context__,5,9));
+	}))))))));
+	TArray<int32_t> const  & __zz_rename_at_48 = __zz_rename_at_48_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__zz_rename_at_48) == 10));
+	{
+		bool __need_loop_51 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,9));
+		int32_t __t_rename_at_51;
+		__need_loop_51 = __t_iterator.first(__context__,(__t_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __t_iterator.next(__context__,(__t_rename_at_51)) )
+		{
+			DAS_ASSERT((__zz_rename_at_48(__t_rename_at_51,__context__) == __t_rename_at_51));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_51));
+	};
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_joinSequences_86681ec5a4d65514
+		aotLib[0x324eb366f640c7db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Func_0x60_joinSequences_86681ec5a4d65514>>();
+	};
+		// _Func_0x60_makeSequence_375eb005a17de004
+		aotLib[0x1d63ff986cf9f47d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, int32_t , int32_t  ),&_Func_0x60_makeSequence_375eb005a17de004>>();
+	};
+		// _Func_0x60_makeSequenceB_1cc4dd5f892999c9
+		aotLib[0x82909e93d8edad25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_makeSequenceB_1cc4dd5f892999c9>>();
+	};
+		// addBar_6f74918216b0613
+		aotLib[0x51c1d44c90144b7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Foo const  & , Foo const  &  ),&addBar_6f74918216b0613>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// newFoo_5cef7b4dce48b6b0
+		aotLib[0xac9695c9300c0459] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&newFoo_5cef7b4dce48b6b0>>();
+	};
+		// newFooB_367316257dba54e5
+		aotLib[0x40b501c16c9ccf19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  ),&newFooB_367316257dba54e5>>();
+	};
+		// test_cd3129e0f081eb1c
+		aotLib[0x5bd9bed878e41829] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cd3129e0f081eb1c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
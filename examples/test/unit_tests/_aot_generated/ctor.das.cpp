@@ -0,0 +1,130 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t i;
+	float f;
+	char * s;
+	int64_t n;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,i)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,f)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,n)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	int32_t i;
+};
+static_assert(sizeof(Bar)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,i)==0,"structure field offset mismatch with DAS");
+}
+
+inline Bar Bar_a678339102b71e6f ( Context * __context__ );
+inline Foo Foo_a9db4504270dd6ca ( Context * __context__ );
+inline bool test_f8778a885e6871a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Bar Bar_a678339102b71e6f ( Context * __context__ )
+{
+	Bar __b_rename_at_13; das_zero(__b_rename_at_13);
+	das_copy(__b_rename_at_13.i,13);
+	return das_auto_cast<Bar>::cast(__b_rename_at_13);
+}
+
+inline Foo Foo_a9db4504270dd6ca ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_3;
+		das_zero(__mks_3);
+		das_copy((__mks_3.i),(5));
+		das_copy((__mks_3.f),(6.f));
+		das_copy((__mks_3.s),(((char *) "hello")));
+		return __mks_3;
+	})()));
+}
+
+inline bool test_f8778a885e6871a ( Context * __context__ )
+{
+	Foo __t_rename_at_19_ConstRef = ((Foo)Foo_a9db4504270dd6ca(__context__));
+	Foo const  & __t_rename_at_19 = __t_rename_at_19_ConstRef; ;
+	DAS_ASSERT((__t_rename_at_19.i == 5));
+	Bar __b_rename_at_21_ConstRef = ((Bar)Bar_a678339102b71e6f(__context__));
+	Bar const  & __b_rename_at_21 = __b_rename_at_21_ConstRef; ;
+	DAS_ASSERT((__b_rename_at_21.i == 13));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_a678339102b71e6f
+		aotLib[0x9bac91d24f45fe19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Bar (*) ( Context * __context__ ),&Bar_a678339102b71e6f>>();
+	};
+		// Foo_a9db4504270dd6ca
+		aotLib[0xf2031b8b37491175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_a9db4504270dd6ca>>();
+	};
+		// test_f8778a885e6871a
+		aotLib[0xe5a419b9672c653c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f8778a885e6871a>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
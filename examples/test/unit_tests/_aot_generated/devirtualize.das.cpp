@@ -0,0 +1,159 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Point {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Point)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline int32_t add_17f8810c9c570b5a ( Context * __context__, int32_t __a_rename_at_1, int32_t __b_rename_at_1 );
+inline int32_t apply_cf5e415ece8385e8 ( Context * __context__, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __f_rename_at_14, int32_t __a_rename_at_14, int32_t __b_rename_at_14 );
+inline void change_op_3010816f02abb87c ( Context * __context__ );
+inline Point make_point_254ff2c84d7a2adf ( Context * __context__, int32_t __x_rename_at_11 );
+inline int32_t mul_683c8674cb3a259 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4 );
+inline bool test_227e9cfcd446ed64 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<Func DAS_COMMENT((int32_t,int32_t,int32_t)),0x730efa17>(__context__) = Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u));/*g_mut*/
+	das_global<int32_t,0x29bbebe0>(__context__) = 4;/*four*/
+}
+
+inline int32_t add_17f8810c9c570b5a ( Context * __context__, int32_t __a_rename_at_1, int32_t __b_rename_at_1 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_1 + __b_rename_at_1);
+}
+
+inline int32_t apply_cf5e415ece8385e8 ( Context * __context__, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __f_rename_at_14, int32_t __a_rename_at_14, int32_t __b_rename_at_14 )
+{
+	return das_auto_cast<int32_t>::cast(das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,__f_rename_at_14,__a_rename_at_14,__b_rename_at_14));
+}
+
+inline void change_op_3010816f02abb87c ( Context * __context__ )
+{
+	das_copy(das_global<Func DAS_COMMENT((int32_t,int32_t,int32_t)),0x730efa17>(__context__) /*g_mut*/,Func(__context__->fnIdxByMangledName(/*mul int#const int#const*/ 968102129u)));
+}
+
+inline Point make_point_254ff2c84d7a2adf ( Context * __context__, int32_t __x_rename_at_11 )
+{
+	return das_auto_cast<Point>::cast((([&]() -> Point {
+		Point __mks_12;
+		das_copy((__mks_12.x),(__x_rename_at_11));
+		das_copy((__mks_12.y),((__x_rename_at_11 * 2)));
+		return __mks_12;
+	})()));
+}
+
+inline int32_t mul_683c8674cb3a259 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_4 * __b_rename_at_4);
+}
+
+inline bool test_227e9cfcd446ed64 ( Context * __context__ )
+{
+	DAS_VERIFY(((das_global<int32_t,0x29bbebe0>(__context__) /*four*/ + 2) == 6));
+	DAS_VERIFY(((das_global<int32_t,0x29bbebe0>(__context__) /*four*/ * 2) == 8));
+	DAS_VERIFY(((das_global<int32_t,0x29bbebe0>(__context__) /*four*/ * 3) == 12));
+	DAS_VERIFY(((das_global<int32_t,0x29bbebe0>(__context__) /*four*/ + 1) == 5));
+	Point __p_rename_at_38_ConstRef = ((Point)make_point_254ff2c84d7a2adf(__context__,das_global<int32_t,0x29bbebe0>(__context__) /*four*/));
+	Point const  & __p_rename_at_38 = __p_rename_at_38_ConstRef; ;
+	DAS_ASSERT(((__p_rename_at_38.x == 4) && (__p_rename_at_38.y == 8)));
+	DAS_VERIFY(((apply_cf5e415ece8385e8(__context__,Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u)),das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 5) && (apply_cf5e415ece8385e8(__context__,Func(__context__->fnIdxByMangledName(/*mul int#const int#const*/ 968102129u)),das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 4)));
+	Func DAS_COMMENT((int32_t,int32_t,int32_t)) __f_rename_at_43 = Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u));
+	DAS_VERIFY((das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,__f_rename_at_43,das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 5));
+	das_copy(__f_rename_at_43,Func(__context__->fnIdxByMangledName(/*mul int#const int#const*/ 968102129u)));
+	DAS_VERIFY((das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,__f_rename_at_43,das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 4));
+	DAS_VERIFY((das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,das_global<Func DAS_COMMENT((int32_t,int32_t,int32_t)),0x730efa17>(__context__) /*g_mut*/,das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 5));
+	change_op_3010816f02abb87c(__context__);
+	DAS_VERIFY((das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,das_global<Func DAS_COMMENT((int32_t,int32_t,int32_t)),0x730efa17>(__context__) /*g_mut*/,das_global<int32_t,0x29bbebe0>(__context__) /*four*/,1) == 4));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// add_17f8810c9c570b5a
+		aotLib[0x8866650275d5ac31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_17f8810c9c570b5a>>();
+	};
+		// apply_cf5e415ece8385e8
+		aotLib[0x786be572f1cef75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  , int32_t , int32_t  ),&apply_cf5e415ece8385e8>>();
+	};
+		// change_op_3010816f02abb87c
+		aotLib[0xcf886f10f1460f29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&change_op_3010816f02abb87c>>();
+	};
+		// make_point_254ff2c84d7a2adf
+		aotLib[0x88129a95ead56bfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Point (*) ( Context * __context__, int32_t  ),&make_point_254ff2c84d7a2adf>>();
+	};
+		// mul_683c8674cb3a259
+		aotLib[0xe708617ace66023d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&mul_683c8674cb3a259>>();
+	};
+		// test_227e9cfcd446ed64
+		aotLib[0x20b8cef613a1ee76] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_227e9cfcd446ed64>>();
+	};
+		// [[ init script ]]
+		aotLib[0x3012e61c3590fcb7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,313 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline double _Func_0x60_div_by_zero_bb53a0fa4f561b58 ( Context * __context__, double __num_rename_at_2 );
+inline float _Func_0x60_div_by_zero_99e11a92b4c5b3b ( Context * __context__, float __num_rename_at_2 );
+inline int32_t _Func_0x60_div_by_zero_4ea83ce9684e07ec ( Context * __context__, int32_t __num_rename_at_2 );
+inline int64_t _Func_0x60_div_by_zero_d10ac43d1ebe2806 ( Context * __context__, int64_t __num_rename_at_2 );
+inline uint32_t _Func_0x60_div_by_zero_39e4c320defe46ab ( Context * __context__, uint32_t __num_rename_at_2 );
+inline uint64_t _Func_0x60_div_by_zero_7b57f9ee767b4975 ( Context * __context__, uint64_t __num_rename_at_2 );
+inline double _Func_0x60_mod_by_zero_dbf4b7bc35e1275 ( Context * __context__, double __num_rename_at_12 );
+inline float _Func_0x60_mod_by_zero_235c7bfa3715a1b0 ( Context * __context__, float __num_rename_at_12 );
+inline int32_t _Func_0x60_mod_by_zero_2c02a51dc7c68017 ( Context * __context__, int32_t __num_rename_at_12 );
+inline int64_t _Func_0x60_mod_by_zero_312ba5c1732b8fd9 ( Context * __context__, int64_t __num_rename_at_12 );
+inline uint32_t _Func_0x60_mod_by_zero_fc92939910a6e832 ( Context * __context__, uint32_t __num_rename_at_12 );
+inline uint64_t _Func_0x60_mod_by_zero_600d60c6bc339498 ( Context * __context__, uint64_t __num_rename_at_12 );
+inline bool test_38a81f4b64aa20d6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline double _Func_0x60_div_by_zero_bb53a0fa4f561b58 ( Context * __context__, double __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<double>::cast(SimPolicy<double>::Div(__num_rename_at_2,0.,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<double>::cast(__num_rename_at_2);
+}
+
+inline float _Func_0x60_div_by_zero_99e11a92b4c5b3b ( Context * __context__, float __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<float>::cast(SimPolicy<float>::Div(__num_rename_at_2,0.f,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<float>::cast(__num_rename_at_2);
+}
+
+inline int32_t _Func_0x60_div_by_zero_4ea83ce9684e07ec ( Context * __context__, int32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Div(__num_rename_at_2,0,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<int32_t>::cast(__num_rename_at_2);
+}
+
+inline int64_t _Func_0x60_div_by_zero_d10ac43d1ebe2806 ( Context * __context__, int64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Div(__num_rename_at_2,0ll,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<int64_t>::cast(__num_rename_at_2);
+}
+
+inline uint32_t _Func_0x60_div_by_zero_39e4c320defe46ab ( Context * __context__, uint32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Div(__num_rename_at_2,0x0u,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<uint32_t>::cast(__num_rename_at_2);
+}
+
+inline uint64_t _Func_0x60_div_by_zero_7b57f9ee767b4975 ( Context * __context__, uint64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Div(__num_rename_at_2,0x0ull,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<uint64_t>::cast(__num_rename_at_2);
+}
+
+inline double _Func_0x60_mod_by_zero_dbf4b7bc35e1275 ( Context * __context__, double __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<double>::cast(SimPolicy<double>::Mod(__num_rename_at_12,0.,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<double>::cast(__num_rename_at_12);
+}
+
+inline float _Func_0x60_mod_by_zero_235c7bfa3715a1b0 ( Context * __context__, float __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<float>::cast(SimPolicy<float>::Mod(__num_rename_at_12,0.f,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<float>::cast(__num_rename_at_12);
+}
+
+inline int32_t _Func_0x60_mod_by_zero_2c02a51dc7c68017 ( Context * __context__, int32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Mod(__num_rename_at_12,0,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<int32_t>::cast(__num_rename_at_12);
+}
+
+inline int64_t _Func_0x60_mod_by_zero_312ba5c1732b8fd9 ( Context * __context__, int64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Mod(__num_rename_at_12,0ll,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<int64_t>::cast(__num_rename_at_12);
+}
+
+inline uint32_t _Func_0x60_mod_by_zero_fc92939910a6e832 ( Context * __context__, uint32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Mod(__num_rename_at_12,0x0u,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<uint32_t>::cast(__num_rename_at_12);
+}
+
+inline uint64_t _Func_0x60_mod_by_zero_600d60c6bc339498 ( Context * __context__, uint64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Mod(__num_rename_at_12,0x0ull,*__context__));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<uint64_t>::cast(__num_rename_at_12);
+}
+
+inline bool test_38a81f4b64aa20d6 ( Context * __context__ )
+{
+	DAS_VERIFY((_Func_0x60_div_by_zero_4ea83ce9684e07ec(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_2c02a51dc7c68017(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_div_by_zero_39e4c320defe46ab(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_fc92939910a6e832(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_div_by_zero_d10ac43d1ebe2806(__context__,1ll) == 1ll));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_312ba5c1732b8fd9(__context__,1ll) == 1ll));
+	DAS_VERIFY((_Func_0x60_div_by_zero_7b57f9ee767b4975(__context__,0x1ull) == 0x1ull));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_600d60c6bc339498(__context__,0x1ull) == 0x1ull));
+	DAS_VERIFY((_Func_0x60_div_by_zero_99e11a92b4c5b3b(__context__,1.f) == 1.f));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_235c7bfa3715a1b0(__context__,1.f) == 1.f));
+	DAS_VERIFY((_Func_0x60_div_by_zero_bb53a0fa4f561b58(__context__,1.) == 1.));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_dbf4b7bc35e1275(__context__,1.) == 1.));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_div_by_zero_bb53a0fa4f561b58
+		aotLib[0xb2d1fc8b715a9b71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, double  ),&_Func_0x60_div_by_zero_bb53a0fa4f561b58>>();
+	};
+		// _Func_0x60_div_by_zero_99e11a92b4c5b3b
+		aotLib[0xb9b84484cc7c325d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&_Func_0x60_div_by_zero_99e11a92b4c5b3b>>();
+	};
+		// _Func_0x60_div_by_zero_4ea83ce9684e07ec
+		aotLib[0x3031a4a2b23fd275] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_div_by_zero_4ea83ce9684e07ec>>();
+	};
+		// _Func_0x60_div_by_zero_d10ac43d1ebe2806
+		aotLib[0x94e8d974b4ca7a11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_div_by_zero_d10ac43d1ebe2806>>();
+	};
+		// _Func_0x60_div_by_zero_39e4c320defe46ab
+		aotLib[0x6853b584e3f8fbc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_div_by_zero_39e4c320defe46ab>>();
+	};
+		// _Func_0x60_div_by_zero_7b57f9ee767b4975
+		aotLib[0xea37a5c174c5d1cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_div_by_zero_7b57f9ee767b4975>>();
+	};
+		// _Func_0x60_mod_by_zero_dbf4b7bc35e1275
+		aotLib[0xb9bd39366cab8dc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, double  ),&_Func_0x60_mod_by_zero_dbf4b7bc35e1275>>();
+	};
+		// _Func_0x60_mod_by_zero_235c7bfa3715a1b0
+		aotLib[0xafc10acd35f47cd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&_Func_0x60_mod_by_zero_235c7bfa3715a1b0>>();
+	};
+		// _Func_0x60_mod_by_zero_2c02a51dc7c68017
+		aotLib[0xf009fce3ebc06415] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_mod_by_zero_2c02a51dc7c68017>>();
+	};
+		// _Func_0x60_mod_by_zero_312ba5c1732b8fd9
+		aotLib[0x5fcc2ad75773f5cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_mod_by_zero_312ba5c1732b8fd9>>();
+	};
+		// _Func_0x60_mod_by_zero_fc92939910a6e832
+		aotLib[0x5228da814d1ef7f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_mod_by_zero_fc92939910a6e832>>();
+	};
+		// _Func_0x60_mod_by_zero_600d60c6bc339498
+		aotLib[0xa71afd5c90cdb25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_mod_by_zero_600d60c6bc339498>>();
+	};
+		// test_38a81f4b64aa20d6
+		aotLib[0x5aa96c33e4ec240b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_38a81f4b64aa20d6>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
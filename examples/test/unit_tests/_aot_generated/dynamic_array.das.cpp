@@ -0,0 +1,215 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Func_0x60_pass_array_ecda56528e7f82bf ( Context * __context__, TArray<int32_t> & __arr_rename_at_3 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_65e01d8d08e664d4 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_31, int32_t __value_rename_at_31, int32_t __at_rename_at_31 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline bool test_f081d7acf5e76577 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_pass_array_ecda56528e7f82bf ( Context * __context__, TArray<int32_t> &  __arr_rename_at_3 )
+{
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_3),4);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __at_rename_at_67 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_65e01d8d08e664d4 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_31, int32_t __value_rename_at_31, int32_t __at_rename_at_31 )
+{
+	das_copy(__Arr_rename_at_31(builtin_array_push(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_31),__at_rename_at_31,4,__context__),__context__),__value_rename_at_31);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline bool test_f081d7acf5e76577 ( Context * __context__ )
+{
+	TArray<int32_t> __arr_rename_at_9; das_zero(__arr_rename_at_9); TArray<int32_t> __arr2_rename_at_9; das_zero(__arr2_rename_at_9);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 0),(((char *) "array starts at 0 length")));
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),1);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),2);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 3),(((char *) "array length is 3")));
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 16),(((char *) "its 2x, but no less than 16")));
+	_Func_0x60_pass_array_ecda56528e7f82bf(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4),(((char *) "array length is 4")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),6);
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 6),(((char *) "array length is now 6")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),17);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 32),(((char *) "now bigger")));
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),33);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 33),(((char *) "now even bigger")));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	DAS_ASSERTF((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 33),(((char *) "did not grow smaller")));
+	DAS_ASSERTF((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4),(((char *) "resized properly")));
+	das_move(__arr2_rename_at_9,__arr_rename_at_9);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9)) == 4));
+	int32_t __index_rename_at_31 = 0;
+	while ( __index_rename_at_31 < 4 )
+	{
+		__arr2_rename_at_9(__index_rename_at_31++,__context__)++;
+	};
+	das_move(__arr_rename_at_9,__arr2_rename_at_9);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr2_rename_at_9)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_9)) == 4));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	DAS_ASSERT((__arr_rename_at_9(2,__context__) == 4));
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	DAS_ASSERTF((__arr_rename_at_9(3,__context__) == 0),(((char *) "new element after resize is 0")));
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),1,0);
+	{
+		bool __need_loop_42 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(1,5));
+		int32_t __t_rename_at_42;
+		__need_loop_42 = __t_iterator.first(__context__,(__t_rename_at_42)) && __need_loop_42;
+		for ( ; __need_loop_42 ; __need_loop_42 = __t_iterator.next(__context__,(__t_rename_at_42)) )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_42 - 1),__context__) == __t_rename_at_42));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_42));
+	};
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),4);
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),5,4);
+	_Funcbuiltin_0x60_push_65e01d8d08e664d4(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),7,2);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),2);
+	{
+		bool __need_loop_48 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(1,5));
+		int32_t __t_rename_at_48;
+		__need_loop_48 = __t_iterator.first(__context__,(__t_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __t_iterator.next(__context__,(__t_rename_at_48)) )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_48 - 1),__context__) == __t_rename_at_48));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_48));
+	};
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),0);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_9),3);
+	{
+		bool __need_loop_52 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(2,4));
+		int32_t __t_rename_at_52;
+		__need_loop_52 = __t_iterator.first(__context__,(__t_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __t_iterator.next(__context__,(__t_rename_at_52)) )
+		{
+			DAS_ASSERT((__arr_rename_at_9((__t_rename_at_52 - 2),__context__) == __t_rename_at_52));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_52));
+	};
+	TArray<int32_t> __a_rename_at_55; das_zero(__a_rename_at_55);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_55),1);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_55),2);
+	TArray<int32_t> __b_rename_at_58_ConstRef; das_zero(__b_rename_at_58_ConstRef); das_move(__b_rename_at_58_ConstRef, ((TArray<int32_t>)__a_rename_at_55));
+	TArray<int32_t> const  & __b_rename_at_58 = __b_rename_at_58_ConstRef; ;
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_55)) == 0) && (builtin_array_size(__b_rename_at_58) == 2)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_pass_array_ecda56528e7f82bf
+		aotLib[0xb30810b517fc2b6e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_pass_array_ecda56528e7f82bf>>();
+	};
+		// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+		aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_push_65e01d8d08e664d4
+		aotLib[0x3a1fab0671d9843d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t , int32_t  ),&_Funcbuiltin_0x60_push_65e01d8d08e664d4>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// test_f081d7acf5e76577
+		aotLib[0xb37b6392886c654a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f081d7acf5e76577>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,130 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c894953d;
+extern VarInfo __var_info__b7c3bfde;
+extern VarInfo __var_info__11b6575e;
+extern FuncInfo __func_info__5f0b39a3;
+extern FuncInfo __func_info__6e739376;
+
+VarInfo __func_info__5f0b39a3_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 38, 0x11b6575e, "foo", 0 };
+VarInfo * __func_info__5f0b39a3_fields[1] =  { &__func_info__5f0b39a3_field_0 };
+FuncInfo __func_info__5f0b39a3 = {"invoke block<(foo:UnitTest::TestObjectFoo const):bool> const", "", __func_info__5f0b39a3_fields, 1, 32, &__type_info__c894953d, nullptr,0,0x5f0b39a3, 0x0 };
+VarInfo __func_info__6e739376_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"UnitTest::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xb7c3bfde, "arr", 0 };
+VarInfo * __func_info__6e739376_fields[1] =  { &__func_info__6e739376_field_0 };
+FuncInfo __func_info__6e739376 = {"invoke block<(arr:UnitTest::dasvector`TestObjectFoo const):void> const", "", __func_info__6e739376_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x6e739376, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline int32_t _Funcbuiltin_0x60_find_index_if_c4b74471f249e4ab ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo const  &)) const  & __arr_rename_at_420, Block DAS_COMMENT((bool,TestObjectFoo const )) const  & __blk_rename_at_420 );
+inline bool test_3aa9962d1b36e4f5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Funcbuiltin_0x60_find_index_if_c4b74471f249e4ab ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo const  &)) const  &  __arr_rename_at_420, Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  __blk_rename_at_420 )
+{
+	{
+		bool __need_loop_421 = true;
+		// o : UnitTest::TestObjectFoo aka TT const&
+		das_iterator<Sequence DAS_COMMENT((TestObjectFoo const )) const > __o_iterator(__arr_rename_at_420);
+		TestObjectFoo const  * __o_rename_at_421;
+		__need_loop_421 = __o_iterator.first(__context__,(__o_rename_at_421)) && __need_loop_421;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2147483647));
+		int32_t __i_rename_at_421;
+		__need_loop_421 = __i_iterator.first(__context__,(__i_rename_at_421)) && __need_loop_421;
+		for ( ; __need_loop_421 ; __need_loop_421 = __o_iterator.next(__context__,(__o_rename_at_421)) && __i_iterator.next(__context__,(__i_rename_at_421)) )
+		{
+			if ( das_invoke<bool>::invoke<TestObjectFoo const  &>(__context__,__blk_rename_at_420,(*__o_rename_at_421)) )
+			{
+				return das_auto_cast<int32_t>::cast(__i_rename_at_421);
+			};
+		}
+		__o_iterator.close(__context__,(__o_rename_at_421));
+		__i_iterator.close(__context__,(__i_rename_at_421));
+	};
+	return das_auto_cast<int32_t>::cast(-1);
+}
+
+inline bool test_3aa9962d1b36e4f5 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,192,"test " DAS_FILE_LINE);
+{
+	testFooArray(das_make_block<void,das::vector<TestObjectFoo> const  &>(__context__,80,0,&__func_info__6e739376,[&](das::vector<TestObjectFoo> const  & __arr_rename_at_5)->void{
+		Sequence DAS_COMMENT((TestObjectFoo *)) _temp_make_local_6_112;
+		int32_t __index_rename_at_6 = ((int32_t)_Funcbuiltin_0x60_find_index_if_c4b74471f249e4ab(__context__,das_arg<Sequence DAS_COMMENT((TestObjectFoo const ))>::pass((_temp_make_local_6_112 = (das_vector_each_const(__arr_rename_at_5,__context__)))),das_make_block<bool,TestObjectFoo const  &>(__context__,176,0,&__func_info__5f0b39a3,[&](TestObjectFoo const  & __foo_rename_at_6)->bool{
+			return das_auto_cast<bool>::cast(__foo_rename_at_6.fooData /*fooData*/ == 5);
+		})));
+		DAS_ASSERT((__index_rename_at_6 == 5));
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_find_index_if_c4b74471f249e4ab
+		aotLib[0x72fe67a25e9f06e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((TestObjectFoo const  &)) const  & , Block DAS_COMMENT((bool,TestObjectFoo const )) const  &  ),&_Funcbuiltin_0x60_find_index_if_c4b74471f249e4ab>>();
+	};
+		// test_3aa9962d1b36e4f5
+		aotLib[0xa0206737ab0abeff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3aa9962d1b36e4f5>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
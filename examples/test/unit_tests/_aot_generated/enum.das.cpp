@@ -0,0 +1,340 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__b0ba5a22;
+extern TypeInfo __type_info__9956a896;
+extern TypeInfo __type_info__e249d345;
+extern TypeInfo __type_info__daa6f364;
+extern TypeInfo __type_info__49c948f;
+extern TypeInfo __type_info__a095e438;
+extern EnumInfo __enum_info__35428e09;
+extern EnumInfo __enum_info__a779826d;
+extern EnumInfo __enum_info__3f0be581;
+
+EnumValueInfo __enum_info__35428e09_value_0 = { "boo", 1 };
+EnumValueInfo __enum_info__35428e09_value_1 = { "hoo", 2 };
+EnumValueInfo __enum_info__35428e09_value_2 = { "boo_hoo", 3 };
+EnumValueInfo * __enum_info__35428e09_values [] = { &__enum_info__35428e09_value_0, &__enum_info__35428e09_value_1, &__enum_info__35428e09_value_2 };
+EnumInfo __enum_info__35428e09 = { "BooHoo8", __enum_info__35428e09_values, 3, 0x35428e09 };
+EnumValueInfo __enum_info__a779826d_value_0 = { "boo", 0 };
+EnumValueInfo __enum_info__a779826d_value_1 = { "hoo", 1 };
+EnumValueInfo __enum_info__a779826d_value_2 = { "boo_hoo", 5 };
+EnumValueInfo * __enum_info__a779826d_values [] = { &__enum_info__a779826d_value_0, &__enum_info__a779826d_value_1, &__enum_info__a779826d_value_2 };
+EnumInfo __enum_info__a779826d = { "BooHoo", __enum_info__a779826d_values, 3, 0xa779826d };
+EnumValueInfo __enum_info__3f0be581_value_0 = { "boo", 4 };
+EnumValueInfo __enum_info__3f0be581_value_1 = { "hoo", 5 };
+EnumValueInfo __enum_info__3f0be581_value_2 = { "boo_hoo", 6 };
+EnumValueInfo * __enum_info__3f0be581_values [] = { &__enum_info__3f0be581_value_0, &__enum_info__3f0be581_value_1, &__enum_info__3f0be581_value_2 };
+EnumInfo __enum_info__3f0be581 = { "BooHoo16", __enum_info__3f0be581_values, 3, 0x3f0be581 };
+TypeInfo __type_info__b0ba5a22 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__a095e438, nullptr, nullptr, nullptr, 0, 0, nullptr, 282, 0xb0ba5a22 };
+TypeInfo __type_info__9956a896 = { Type::tEnumeration8, nullptr, &__enum_info__35428e09, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9956a896 };
+TypeInfo __type_info__e249d345 = { Type::tEnumeration16, nullptr, &__enum_info__3f0be581, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe249d345 };
+TypeInfo __type_info__daa6f364 = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__9956a896, nullptr, nullptr, nullptr, 0, 0, nullptr, 282, 0xdaa6f364 };
+TypeInfo __type_info__49c948f = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__e249d345, nullptr, nullptr, nullptr, 0, 0, nullptr, 282, 0x49c948f };
+TypeInfo __type_info__a095e438 = { Type::tEnumeration, nullptr, &__enum_info__a779826d, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa095e438 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__b0ba5a22 };
+TypeInfo * __tinfo_1[1] = { &__type_info__49c948f };
+TypeInfo * __tinfo_2[1] = { &__type_info__daa6f364 };
+#if 0 // external enum
+namespace UnitTest {
+
+enum class GooEnum : int32_t {
+	regular = int32_t(0ll),
+	hazardous = int32_t(1ll),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum : int32_t {
+	zero = int32_t(0ll),
+	one = int32_t(1ll),
+	two = int32_t(2ll),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace UnitTest {
+
+enum class SomeEnum98 : uint32_t {
+	SomeEnum98_zero = uint32_t(0ll),
+	SomeEnum98_one = uint32_t(1ll),
+	SomeEnum98_two = uint32_t(2ll),
+};
+}
+#endif // external enum
+// unused enumeration SomeEnum_16
+namespace  {
+
+enum class BooHoo : int32_t {
+	boo = int32_t(0),
+	hoo = int32_t(1),
+	boo_hoo = int32_t(5),
+};
+}
+}
+template <> struct cast< BooHoo > : cast_enum < BooHoo > {};
+namespace {
+namespace  {
+
+enum class BooHoo16 : int16_t {
+	boo = int16_t(4),
+	hoo = int16_t(5),
+	boo_hoo = int16_t(6),
+};
+}
+}
+template <> struct cast< BooHoo16 > : cast_enum < BooHoo16 > {};
+namespace {
+namespace  {
+
+enum class BooHoo8 : int8_t {
+	boo = int8_t(1),
+	hoo = int8_t(2),
+	boo_hoo = int8_t(3),
+};
+}
+}
+template <> struct cast< BooHoo8 > : cast_enum < BooHoo8 > {};
+namespace {
+namespace  {
+
+enum class Numbers : int16_t {
+	zero = int16_t(0),
+	one = int16_t(1),
+	two = int16_t(2),
+	ten = int16_t(10),
+	sixteen = int16_t(16),
+	neg_ten = int16_t(-10),
+	neg_one = int16_t(-1),
+	neg_one_i = int16_t(-1),
+};
+}
+}
+template <> struct cast< Numbers > : cast_enum < Numbers > {};
+namespace {
+namespace  {
+
+enum class QQ : int32_t {
+	size_of_Foo_Padded = int32_t(16),
+};
+}
+}
+template <> struct cast< QQ > : cast_enum < QQ > {};
+namespace {
+namespace  {
+
+enum class Zen : int32_t {
+	zero = int32_t(0),
+	not_zero = int32_t(1),
+};
+}
+}
+template <> struct cast< Zen > : cast_enum < Zen > {};
+namespace {
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _Funcbuiltin_0x60_each_enum_1d3e2304f903559c ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_275 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _Funcbuiltin_0x60_each_enum_1e50e5b6a040cf9a ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_275 );
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _Funcbuiltin_0x60_each_enum_9671ce9ca824271c ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_275 );
+inline bool test_a19cf0e6b6b1a86b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _Funcbuiltin_0x60_each_enum_1d3e2304f903559c ( Context * __context__, DAS_COMMENT(enum) BooHoo __tt_rename_at_275 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) __iter_rename_at_277; das_zero(__iter_rename_at_277);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) &>::from(__iter_rename_at_277)));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))>::cast(__iter_rename_at_277);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _Funcbuiltin_0x60_each_enum_1e50e5b6a040cf9a ( Context * __context__, DAS_COMMENT(enum) BooHoo16 __tt_rename_at_275 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) __iter_rename_at_277; das_zero(__iter_rename_at_277);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) &>::from(__iter_rename_at_277)));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))>::cast(__iter_rename_at_277);
+}
+
+inline Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _Funcbuiltin_0x60_each_enum_9671ce9ca824271c ( Context * __context__, DAS_COMMENT(enum) BooHoo8 __tt_rename_at_275 )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) __iter_rename_at_277; das_zero(__iter_rename_at_277);
+	das_call_interop<void>::call(&builtin_make_enum_iterator,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) &>::from(__iter_rename_at_277)));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))>::cast(__iter_rename_at_277);
+}
+
+inline bool test_a19cf0e6b6b1a86b ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) _temp_make_local_80_112;
+	TDim<int32_t,3> _temp_make_local_80_128;
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) _temp_make_local_82_176;
+	TDim<int32_t,3> _temp_make_local_82_192;
+	Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) _temp_make_local_84_240;
+	TDim<int32_t,3> _temp_make_local_84_256;
+	DAS_COMMENT(enum) Numbers __q_rename_at_55 = DAS_COMMENT(enum) Numbers::one;
+	DAS_ASSERT((int(__q_rename_at_55) == 1));
+	DAS_ASSERT((__q_rename_at_55 == DAS_COMMENT(enum) Numbers::one));
+	DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero != __q_rename_at_55));
+	das_copy(__q_rename_at_55,DAS_COMMENT(enum) Numbers::zero);
+	DAS_ASSERT((DAS_COMMENT(enum) Numbers::zero == __q_rename_at_55));
+	DAS_VERIFY((efn_takeOne_giveTwo(DAS_COMMENT(bound_enum) SomeEnum::one) == DAS_COMMENT(bound_enum) SomeEnum::two));
+	DAS_VERIFY((efn_takeOne_giveTwo_98(DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_one) == DAS_COMMENT(bound_enum) SomeEnum98::SomeEnum98_two));
+	DAS_COMMENT(bound_enum) Goo::GooEnum __goo_rename_at_71; das_zero(__goo_rename_at_71);
+	das_copy(__goo_rename_at_71,DAS_COMMENT(bound_enum) Goo::GooEnum::regular);
+	DAS_VERIFY((efn_flip(__goo_rename_at_71) == DAS_COMMENT(bound_enum) Goo::GooEnum::hazardous));
+	TestObjectFoo __foo16_rename_at_74; das_zero(__foo16_rename_at_74);
+	DAS_ASSERT((__foo16_rename_at_74.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_zero));
+	das_copy(__foo16_rename_at_74.e16 /*e16*/,DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one);
+	DAS_ASSERT((__foo16_rename_at_74.e16 /*e16*/ == DAS_COMMENT(bound_enum) SomeEnum_16::SomeEnum_16_one));
+	DAS_ASSERT((int(__foo16_rename_at_74.e16 /*e16*/) == 1));
+	{
+		bool __need_loop_80 = true;
+		// e : BooHoo
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo))> __e_iterator((_temp_make_local_80_112 = (_Funcbuiltin_0x60_each_enum_1d3e2304f903559c(__context__,DAS_COMMENT(enum) BooHoo::boo))));
+		DAS_COMMENT(enum) BooHoo __e_rename_at_80;
+		__need_loop_80 = __e_iterator.first(__context__,(__e_rename_at_80)) && __need_loop_80;
+		// t : int&
+		das_iterator<TDim<int32_t,3>> __t_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_80_128(0,__context__) = 0;
+			_temp_make_local_80_128(1,__context__) = 1;
+			_temp_make_local_80_128(2,__context__) = 5;
+			return _temp_make_local_80_128;
+		})()));
+		int32_t * __t_rename_at_80;
+		__need_loop_80 = __t_iterator.first(__context__,(__t_rename_at_80)) && __need_loop_80;
+		for ( ; __need_loop_80 ; __need_loop_80 = __e_iterator.next(__context__,(__e_rename_at_80)) && __t_iterator.next(__context__,(__t_rename_at_80)) )
+		{
+			DAS_ASSERT((int(__e_rename_at_80) == (*__t_rename_at_80)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_80));
+		__t_iterator.close(__context__,(__t_rename_at_80));
+	};
+	{
+		bool __need_loop_82 = true;
+		// e : BooHoo8
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8))> __e_iterator((_temp_make_local_82_176 = (_Funcbuiltin_0x60_each_enum_9671ce9ca824271c(__context__,DAS_COMMENT(enum) BooHoo8::boo))));
+		DAS_COMMENT(enum) BooHoo8 __e_rename_at_82;
+		__need_loop_82 = __e_iterator.first(__context__,(__e_rename_at_82)) && __need_loop_82;
+		// t : int&
+		das_iterator<TDim<int32_t,3>> __t_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_82_192(0,__context__) = 1;
+			_temp_make_local_82_192(1,__context__) = 2;
+			_temp_make_local_82_192(2,__context__) = 3;
+			return _temp_make_local_82_192;
+		})()));
+		int32_t * __t_rename_at_82;
+		__need_loop_82 = __t_iterator.first(__context__,(__t_rename_at_82)) && __need_loop_82;
+		for ( ; __need_loop_82 ; __need_loop_82 = __e_iterator.next(__context__,(__e_rename_at_82)) && __t_iterator.next(__context__,(__t_rename_at_82)) )
+		{
+			DAS_ASSERT((int(__e_rename_at_82) == (*__t_rename_at_82)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_82));
+		__t_iterator.close(__context__,(__t_rename_at_82));
+	};
+	{
+		bool __need_loop_84 = true;
+		// e : BooHoo16
+		das_iterator<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16))> __e_iterator((_temp_make_local_84_240 = (_Funcbuiltin_0x60_each_enum_1e50e5b6a040cf9a(__context__,DAS_COMMENT(enum) BooHoo16::boo))));
+		DAS_COMMENT(enum) BooHoo16 __e_rename_at_84;
+		__need_loop_84 = __e_iterator.first(__context__,(__e_rename_at_84)) && __need_loop_84;
+		// t : int&
+		das_iterator<TDim<int32_t,3>> __t_iterator((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_84_256(0,__context__) = 4;
+			_temp_make_local_84_256(1,__context__) = 5;
+			_temp_make_local_84_256(2,__context__) = 6;
+			return _temp_make_local_84_256;
+		})()));
+		int32_t * __t_rename_at_84;
+		__need_loop_84 = __t_iterator.first(__context__,(__t_rename_at_84)) && __need_loop_84;
+		for ( ; __need_loop_84 ; __need_loop_84 = __e_iterator.next(__context__,(__e_rename_at_84)) && __t_iterator.next(__context__,(__t_rename_at_84)) )
+		{
+			DAS_ASSERT((int(__e_rename_at_84) == (*__t_rename_at_84)));
+		}
+		__e_iterator.close(__context__,(__e_rename_at_84));
+		__t_iterator.close(__context__,(__t_rename_at_84));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_each_enum_1d3e2304f903559c
+		aotLib[0x5a52ccbe1e8e8e89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo  ),&_Funcbuiltin_0x60_each_enum_1d3e2304f903559c>>();
+	};
+		// _Funcbuiltin_0x60_each_enum_1e50e5b6a040cf9a
+		aotLib[0x912bd62dab1d02d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo16)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo16  ),&_Funcbuiltin_0x60_each_enum_1e50e5b6a040cf9a>>();
+	};
+		// _Funcbuiltin_0x60_each_enum_9671ce9ca824271c
+		aotLib[0x9c81a45256f7aa0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((DAS_COMMENT(enum) BooHoo8)) (*) ( Context * __context__, DAS_COMMENT(enum) BooHoo8  ),&_Funcbuiltin_0x60_each_enum_9671ce9ca824271c>>();
+	};
+		// test_a19cf0e6b6b1a86b
+		aotLib[0xf2b537fd068349fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_a19cf0e6b6b1a86b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
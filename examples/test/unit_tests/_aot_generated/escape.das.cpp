@@ -0,0 +1,238 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Bar {
+	int32_t a;
+	float b;
+	char * c;
+};
+static_assert(sizeof(Bar)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Bar,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Bar,c)==8,"structure field offset mismatch with DAS");
+}
+
+inline Bar Bar_1dfc977d2a34fc73 ( Context * __context__ );
+inline int32_t deref_foo_36ee0b853b1d467b ( Context * __context__, int32_t __x_rename_at_45 );
+inline void finalize_96a13ac3ee8bdf2a ( Context * __context__, Foo * & ____this_rename_at_22 );
+inline void finalize_28d612ce489d8dc9 ( Context * __context__, Foo & ____this_rename_at_1 );
+inline int32_t local_bar_e519d1873ad44b63 ( Context * __context__, int32_t __x_rename_at_26 );
+inline int32_t local_foo_18fa39c9806041c ( Context * __context__, int32_t __x_rename_at_15 );
+inline int32_t loop_foo_c65602b7ae4d3225 ( Context * __context__, int32_t __n_rename_at_34 );
+inline Foo * make_foo_51f071a7e855fd59 ( Context * __context__ );
+inline bool test_d88fee46809b798 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x29bbebe0>(__context__) = 4;/*four*/
+}
+
+inline Bar Bar_1dfc977d2a34fc73 ( Context * __context__ )
+{
+	return das_auto_cast<Bar>::cast((([&]() -> Bar {
+		Bar __mks_5;
+		das_copy((__mks_5.a),(13));
+		das_copy((__mks_5.b),(2.f));
+		das_copy((__mks_5.c),(((char *) "bar")));
+		return __mks_5;
+	})()));
+}
+
+inline int32_t deref_foo_36ee0b853b1d467b ( Context * __context__, int32_t __x_rename_at_45 )
+{
+	Foo _temp_new_46_48;
+	Foo * __p_rename_at_46 = das_new_on_stack<Foo>::make(_temp_new_46_48);
+	Foo __f_rename_at_47 = das_deref(__context__,__p_rename_at_46);
+	das_copy(__f_rename_at_47.a,__x_rename_at_45);
+	das_copy(__p_rename_at_46->a,6);
+	return das_auto_cast<int32_t>::cast(__f_rename_at_47.a + __p_rename_at_46->a);
+}
+
+inline void finalize_96a13ac3ee8bdf2a ( Context * __context__, Foo * & ____this_rename_at_22 )
+{
+	if ( ____this_rename_at_22 != nullptr )
+	{
+		finalize_28d612ce489d8dc9(__context__,das_arg<Foo>::pass(das_deref(__context__,____this_rename_at_22)));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_22);
+		das_copy(____this_rename_at_22,nullptr);
+	};
+}
+
+inline void finalize_28d612ce489d8dc9 ( Context * __context__, Foo &  ____this_rename_at_1 )
+{
+	memset(&(____this_rename_at_1), 0, 8);
+}
+
+inline int32_t local_bar_e519d1873ad44b63 ( Context * __context__, int32_t __x_rename_at_26 )
+{
+	Bar _temp_new_27_48;
+	Bar * __p_rename_at_27 = das_new_on_stack<Bar>::make_and_init(_temp_new_27_48,[&]() { return Bar_1dfc977d2a34fc73(__context__); });
+	__p_rename_at_27->a += __x_rename_at_26;
+	int32_t __res_rename_at_29 = ((int32_t)((__p_rename_at_27->a + int32_t(__p_rename_at_27->b)) + ((SimPolicy<char *>::Equ(cast<char *>::from(__p_rename_at_27->c),cast<char *>::from(((char *) "bar")),*__context__)) ? das_auto_cast<int32_t>::cast(3) : das_auto_cast<int32_t>::cast(0))));
+	das_copy(__p_rename_at_27,nullptr);
+	return das_auto_cast<int32_t>::cast(__res_rename_at_29);
+}
+
+inline int32_t local_foo_18fa39c9806041c ( Context * __context__, int32_t __x_rename_at_15 )
+{
+	Foo _temp_new_16_48;
+	Foo * __p_rename_at_16 = das_new_on_stack<Foo>::make(_temp_new_16_48);
+	DAS_ASSERT((__p_rename_at_16 != nullptr));
+	das_copy(__p_rename_at_16->a,__x_rename_at_15);
+	das_copy(__p_rename_at_16->b,float(__x_rename_at_15) * 0.5f);
+	int32_t __res_rename_at_20 = ((int32_t)(__p_rename_at_16->a + int32_t(__p_rename_at_16->b)));
+	das_copy(__p_rename_at_16,nullptr);
+	DAS_ASSERT((__p_rename_at_16 == nullptr));
+	return das_auto_cast<int32_t>::cast(__res_rename_at_20);
+}
+
+inline int32_t loop_foo_c65602b7ae4d3225 ( Context * __context__, int32_t __n_rename_at_34 )
+{
+	int32_t __total_rename_at_35 = 0;
+	{
+		bool __need_loop_36 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_34));
+		int32_t __i_rename_at_36;
+		__need_loop_36 = __i_iterator.first(__context__,(__i_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __i_iterator.next(__context__,(__i_rename_at_36)) )
+		{
+			Foo _temp_new_37_80;
+			Foo * __p_rename_at_37 = das_new_on_stack<Foo>::make(_temp_new_37_80);
+			DAS_ASSERT((__p_rename_at_37->a == 0));
+			__p_rename_at_37->a += __i_rename_at_36;
+			__total_rename_at_35 += das_null_coalescing<int32_t>::get(das_safe_navigation<Foo,int32_t,&Foo::a>::get(__p_rename_at_37),0);
+			das_copy(__p_rename_at_37,nullptr);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_36));
+	};
+	return das_auto_cast<int32_t>::cast(__total_rename_at_35);
+}
+
+inline Foo * make_foo_51f071a7e855fd59 ( Context * __context__ )
+{
+	Foo * __p_rename_at_11 = das_new<Foo>::make(__context__);
+	das_copy(__p_rename_at_11->a,1);
+	return das_auto_cast<Foo *>::cast(__p_rename_at_11);
+}
+
+inline bool test_d88fee46809b798 ( Context * __context__ )
+{
+	DAS_ASSERT((local_foo_18fa39c9806041c(__context__,das_global<int32_t,0x29bbebe0>(__context__) /*four*/) == 6));
+	DAS_ASSERT((local_bar_e519d1873ad44b63(__context__,das_global<int32_t,0x29bbebe0>(__context__) /*four*/) == 22));
+	DAS_ASSERT((loop_foo_c65602b7ae4d3225(__context__,das_global<int32_t,0x29bbebe0>(__context__) /*four*/ + 6) == 45));
+	DAS_ASSERT((deref_foo_36ee0b853b1d467b(__context__,das_global<int32_t,0x29bbebe0>(__context__) /*four*/ + 1) == 11));
+	Foo * __p_rename_at_63 = make_foo_51f071a7e855fd59(__context__);
+	Foo * __q_rename_at_64 = make_foo_51f071a7e855fd59(__context__);
+	DAS_ASSERT((((__p_rename_at_63 != __q_rename_at_64) && (__p_rename_at_63->a == 1)) && (__q_rename_at_64->a == 1)));
+	finalize_96a13ac3ee8bdf2a(__context__,__p_rename_at_63);
+	finalize_96a13ac3ee8bdf2a(__context__,__q_rename_at_64);
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_1dfc977d2a34fc73
+		aotLib[0xd9363c33be2f0da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Bar (*) ( Context * __context__ ),&Bar_1dfc977d2a34fc73>>();
+	};
+		// deref_foo_36ee0b853b1d467b
+		aotLib[0x8c55a16d1960d93d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&deref_foo_36ee0b853b1d467b>>();
+	};
+		// finalize_96a13ac3ee8bdf2a
+		aotLib[0x82fec97966fd0d68] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_96a13ac3ee8bdf2a>>();
+	};
+		// finalize_28d612ce489d8dc9
+		aotLib[0x388aed6673d06b5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_28d612ce489d8dc9>>();
+	};
+		// local_bar_e519d1873ad44b63
+		aotLib[0xaf830668e50006cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&local_bar_e519d1873ad44b63>>();
+	};
+		// local_foo_18fa39c9806041c
+		aotLib[0x289e9ffe36fc8341] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&local_foo_18fa39c9806041c>>();
+	};
+		// loop_foo_c65602b7ae4d3225
+		aotLib[0xa75ef297054bd60d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&loop_foo_c65602b7ae4d3225>>();
+	};
+		// make_foo_51f071a7e855fd59
+		aotLib[0xbd8ee31011ec8de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Foo * (*) ( Context * __context__ ),&make_foo_51f071a7e855fd59>>();
+	};
+		// test_d88fee46809b798
+		aotLib[0x25fbf95bcf23d853] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d88fee46809b798>>();
+	};
+		// [[ init script ]]
+		aotLib[0x11b5654bf94866ec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,137 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require haha
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace haha {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_finalize_17dcb092398d1c9a ( Context * __context__, TArray<haha::Foo> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_583ef00f5c74fc15 ( Context * __context__, TArray<haha::Foo> & __Arr_rename_at_37, haha::Foo const  & __value_rename_at_37 );
+inline void finalize_baeb7bb28a121ba ( Context * __context__, haha::Foo & __f_rename_at_9 );
+inline bool test_aece74a52fcd5093 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0xb57f106c>(__context__) = false;/*all_good*/
+}
+
+inline void _Funcbuiltin_0x60_finalize_17dcb092398d1c9a ( Context * __context__, TArray<haha::Foo> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : haha::Foo aka TT&
+		das_iterator<TArray<haha::Foo>> __aV_iterator(__a_rename_at_186);
+		haha::Foo * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_baeb7bb28a121ba(__context__,das_arg<haha::Foo>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<haha::Foo>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_583ef00f5c74fc15 ( Context * __context__, TArray<haha::Foo> &  __Arr_rename_at_37, haha::Foo const  &  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<haha::Foo>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void finalize_baeb7bb28a121ba ( Context * __context__, haha::Foo &  __f_rename_at_9 )
+{
+	das_copy(das_global<bool,0xb57f106c>(__context__) /*all_good*/,true);
+}
+
+inline bool test_aece74a52fcd5093 ( Context * __context__ )
+{
+	haha::Foo _temp_make_local_15_64;
+	TArray<haha::Foo> __arr_rename_at_14; das_zero(__arr_rename_at_14);
+	_Funcbuiltin_0x60_push_583ef00f5c74fc15(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_14),das_arg<haha::Foo>::pass((([&]() -> haha::Foo& {
+		das_copy((_temp_make_local_15_64.a),(1));
+		return _temp_make_local_15_64;
+	})())));
+	_Funcbuiltin_0x60_finalize_17dcb092398d1c9a(__context__,das_arg<TArray<haha::Foo>>::pass(__arr_rename_at_14));
+	DAS_ASSERT((das_global<bool,0xb57f106c>(__context__) /*all_good*/));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_17dcb092398d1c9a
+		aotLib[0x4178245b0f1665dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<haha::Foo> &  ),&_Funcbuiltin_0x60_finalize_17dcb092398d1c9a>>();
+	};
+		// _Funcbuiltin_0x60_push_583ef00f5c74fc15
+		aotLib[0x8de56989d33322c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<haha::Foo> & , haha::Foo const  &  ),&_Funcbuiltin_0x60_push_583ef00f5c74fc15>>();
+	};
+		// finalize_baeb7bb28a121ba
+		aotLib[0x4ea323546597d2c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, haha::Foo &  ),&finalize_baeb7bb28a121ba>>();
+	};
+		// test_aece74a52fcd5093
+		aotLib[0xf07590b158b1540f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_aece74a52fcd5093>>();
+	};
+		// [[ init script ]]
+		aotLib[0xdc6f34111d74eb84] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
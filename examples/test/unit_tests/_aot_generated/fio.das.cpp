@@ -0,0 +1,279 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require fio
+#include "daScript/simulate/aot_builtin_fio.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__a97e44ad;
+extern TypeInfo __type_info__94181030;
+extern TypeInfo __type_info__d445a339;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__758b1d3f;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__25d6059b;
+extern TypeInfo __type_info__199df2db;
+extern TypeInfo __type_info__eaf45c8b;
+extern TypeInfo __type_info__192e4e03;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__14836e3f;
+extern VarInfo __var_info__d8dd0985;
+extern VarInfo __var_info__eb5ad38a;
+extern VarInfo __var_info__403b251;
+extern VarInfo __var_info__d5dd04cc;
+extern VarInfo __var_info__9d95170e;
+extern VarInfo __var_info__35e912f2;
+extern FuncInfo __func_info__63f35a93;
+extern FuncInfo __func_info__bd8ac72f;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd5dd04cc, "a", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd8dd0985, "b", 4 };
+VarInfo * __struct_info__b1589007_fields[2] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 2, 8, 0, nullptr, 0xb1589007 };
+VarInfo __struct_info__a97e44ad_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9d95170e, "magic", 0 };
+VarInfo __struct_info__a97e44ad_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeb5ad38a, "size", 4 };
+VarInfo * __struct_info__a97e44ad_fields[2] =  { &__struct_info__a97e44ad_field_0, &__struct_info__a97e44ad_field_1 };
+StructInfo __struct_info__a97e44ad = {"df_header", __struct_info__a97e44ad_fields, 2, 8, -1, nullptr, 0xa97e44ad };
+VarInfo __func_info__63f35a93_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x35e912f2, "data", 0 };
+VarInfo * __func_info__63f35a93_fields[1] =  { &__func_info__63f35a93_field_0 };
+FuncInfo __func_info__63f35a93 = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__63f35a93_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x63f35a93, 0x0 };
+VarInfo __func_info__bd8ac72f_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__eaf45c8b, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x403b251, "f", 0 };
+VarInfo * __func_info__bd8ac72f_fields[1] =  { &__func_info__bd8ac72f_field_0 };
+FuncInfo __func_info__bd8ac72f = {"invoke block<(f:fio::FILE const? const):void> const", "", __func_info__bd8ac72f_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xbd8ac72f, 0x0 };
+TypeInfo __type_info__94181030 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__199df2db, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x94181030 };
+TypeInfo * __type_info__d445a339_arg_types[1] = { &__type_info__94181030 };
+TypeInfo __type_info__d445a339 = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d445a339_arg_types, nullptr, 1, 0, nullptr, 34, 0xd445a339 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__758b1d3f = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x758b1d3f };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__25d6059b = { Type::tStructure, &__struct_info__a97e44ad, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 0x25d6059b };
+TypeInfo __type_info__199df2db = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x199df2db };
+TypeInfo __type_info__eaf45c8b = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"fio::FILE"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xeaf45c8b };
+TypeInfo __type_info__192e4e03 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__eaf45c8b, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x192e4e03 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xc7e1677 };
+TypeInfo __type_info__14836e3f = { Type::tStructure, &__struct_info__a97e44ad, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 318, 0x14836e3f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__c7e1677, &__type_info__94181030 };
+TypeInfo * __tinfo_1[2] = { &__type_info__758b1d3f, &__type_info__d445a339 };
+TypeInfo * __tinfo_2[3] = { &__type_info__192e4e03, &__type_info__25d6059b, &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[3] = { &__type_info__192e4e03, &__type_info__95e97e5e, &__type_info__d445a339 };
+TypeInfo * __tinfo_4[3] = { &__type_info__192e4e03, &__type_info__14836e3f, &__type_info__359c1b32 };
+TypeInfo * __tinfo_5[3] = { &__type_info__192e4e03, &__type_info__94181030, &__type_info__359c1b32 };
+namespace fio {
+
+struct df_header {
+	uint32_t magic;
+	int32_t size;
+};
+static_assert(sizeof(df_header)==8,"structure size mismatch with DAS");
+static_assert(offsetof(df_header,magic)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(df_header,size)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo {
+	int32_t a;
+	float b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_a2bdceb66c902b97 ( Context * __context__ );
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo & __obj_rename_at_127, TArray<uint8_t> const  & __data_rename_at_127 );
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  & __obj_rename_at_123, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_123 );
+inline bool _Funcfio_0x60_fload_3695488be521b8da ( Context * __context__, FILE const  * const  __f_rename_at_40, Foo & __buf_rename_at_40 );
+inline void _Funcfio_0x60_fopen_b9d6dc0a3a9331ce ( Context * __context__, char * const  __name_rename_at_9, char * const  __mode_rename_at_9, Block DAS_COMMENT((void,FILE const  * const )) const  & __blk_rename_at_9 );
+inline int32_t _Funcfio_0x60_fsave_d461082ad2422bda ( Context * __context__, FILE const  * const  __f_rename_at_54, Foo const  & __buf_rename_at_54 );
+inline bool test_2331a46f752d9451 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo Foo_a2bdceb66c902b97 ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_3;
+		das_copy((__mks_3.a),(1));
+		das_copy((__mks_3.b),(2.f));
+		return __mks_3;
+	})()));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_43040880b26c4465 ( Context * __context__, Foo &  __obj_rename_at_127, TArray<uint8_t> const  &  __data_rename_at_127 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Foo &>::from(__obj_rename_at_127),cast<TArray<uint8_t> const  &>::from(__data_rename_at_127)));
+}
+
+inline void _Funcbuiltin_0x60_binary_save_df945637b1078ab2 ( Context * __context__, Foo const  &  __obj_rename_at_123, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_123 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<Foo const  &>::from(__obj_rename_at_123),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_123)));
+}
+
+inline bool _Funcfio_0x60_fload_3695488be521b8da ( Context * __context__, FILE const  * const  __f_rename_at_40, Foo &  __buf_rename_at_40 ) { das_stack_prologue __prologue(__context__,144,"fio`fload " DAS_FILE_LINE);
+{
+	fio::df_header __dfh_rename_at_41; das_zero(__dfh_rename_at_41);
+	int32_t __r1_rename_at_42 = ((int32_t)das_call_interop<int32_t>::call(&builtin_read,__context__,SimNode_AotInterop<3>(__tinfo_2,cast<FILE const  * const >::from(__f_rename_at_40),cast<fio::df_header &>::from(__dfh_rename_at_41),cast<int32_t>::from(8))));
+	if ( __r1_rename_at_42 < 0 )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else {
+		if ( __dfh_rename_at_41.magic != 0x12345678u )
+		{
+			return das_auto_cast<bool>::cast(false);
+		} else {
+			bool __loaded_rename_at_47 = false;
+			das_call_interop<void>::call(&builtin_load,__context__,SimNode_AotInterop<3>(__tinfo_3,cast<FILE const  * const >::from(__f_rename_at_40),cast<int32_t>::from(__dfh_rename_at_41.size),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(das_make_block<void,TArray<uint8_t> const  &>(__context__,128,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_48)->void{
+				if ( builtin_array_size(__data_rename_at_48) != 0 )
+				{
+					_Funcbuiltin_0x60_binary_load_43040880b26c4465(__context__,das_arg<Foo>::pass(__buf_rename_at_40),__data_rename_at_48);
+					das_copy(__loaded_rename_at_47,true);
+				};
+			}))));
+			return das_auto_cast<bool>::cast(__loaded_rename_at_47);
+		};
+	};
+}}
+
+inline void _Funcfio_0x60_fopen_b9d6dc0a3a9331ce ( Context * __context__, char * const  __name_rename_at_9, char * const  __mode_rename_at_9, Block DAS_COMMENT((void,FILE const  * const )) const  &  __blk_rename_at_9 )
+{
+	FILE const  * __f_rename_at_10 = ((FILE const  *)builtin_fopen(__name_rename_at_9,__mode_rename_at_9));
+	das_invoke<void>::invoke<FILE const  * const >(__context__,__blk_rename_at_9,__f_rename_at_10);
+	if ( __f_rename_at_10 != nullptr )
+	{
+		builtin_fclose(__f_rename_at_10,__context__);
+	};
+}
+
+inline int32_t _Funcfio_0x60_fsave_d461082ad2422bda ( Context * __context__, FILE const  * const  __f_rename_at_54, Foo const  &  __buf_rename_at_54 ) { das_stack_prologue __prologue(__context__,160,"fio`fsave " DAS_FILE_LINE);
+{
+	int32_t __r1_rename_at_55 = 0; int32_t __r2_rename_at_55 = 0;
+	_Funcbuiltin_0x60_binary_save_df945637b1078ab2(__context__,__buf_rename_at_54,das_make_block<void,TArray<uint8_t> const  &>(__context__,112,0,&__func_info__63f35a93,[&](TArray<uint8_t> const  & __data_rename_at_56)->void{
+		int32_t __len_rename_at_57 = ((int32_t)builtin_array_size(__data_rename_at_56));
+		fio::df_header __dfh_rename_at_58_ConstRef = ((fio::df_header)(([&]() -> fio::df_header {
+			fio::df_header __mks_58;
+			das_copy((__mks_58.magic),(das_global<uint32_t,0x1911ef29>(__context__) /*df_magic*/));
+			das_copy((__mks_58.size),(__len_rename_at_57));
+			return __mks_58;
+		})()));
+	fio::df_header const  & __dfh_rename_at_58 = __dfh_rename_at_58_ConstRef; ;
+		das_copy(__r1_rename_at_55,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_4,cast<FILE const  * const >::from(__f_rename_at_54),cast<fio::df_header const  &>::from(__dfh_rename_at_58),cast<int32_t>::from(8))));
+		das_copy(__r2_rename_at_55,das_call_interop<int32_t>::call(&builtin_write,__context__,SimNode_AotInterop<3>(__tinfo_5,cast<FILE const  * const >::from(__f_rename_at_54),cast<TArray<uint8_t> const  &>::from(__data_rename_at_56),cast<int32_t>::from(__len_rename_at_57))));
+	}));
+	return das_auto_cast<int32_t>::cast((__r1_rename_at_55 < 0) ? das_auto_cast<int32_t>::cast(__r1_rename_at_55) : das_auto_cast<int32_t>::cast(((__r2_rename_at_55 < 0) ? das_auto_cast<int32_t>::cast(__r2_rename_at_55) : das_auto_cast<int32_t>::cast((__r1_rename_at_55 + __r2_rename_at_55)))));
+}}
+
+inline bool test_2331a46f752d9451 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	bool __saved_rename_at_9 = false;
+	bool __loaded_rename_at_10 = false;
+	Foo __foo0_rename_at_11_ConstRef = ((Foo)Foo_a2bdceb66c902b97(__context__));
+	Foo const  & __foo0_rename_at_11 = __foo0_rename_at_11_ConstRef; ;
+	_Funcfio_0x60_fopen_b9d6dc0a3a9331ce(__context__,((char *) "test.bin"),((char *) "wb"),das_make_block<void,FILE const  * const >(__context__,128,0,&__func_info__bd8ac72f,[&](FILE const  * const  __f_rename_at_12)->void{
+		if ( __f_rename_at_12 != nullptr )
+		{
+			_Funcfio_0x60_fsave_d461082ad2422bda(__context__,__f_rename_at_12,__foo0_rename_at_11);
+			das_copy(__saved_rename_at_9,true);
+		};
+	}));
+	Foo __foo1_rename_at_16; das_zero(__foo1_rename_at_16);
+	_Funcfio_0x60_fopen_b9d6dc0a3a9331ce(__context__,((char *) "test.bin"),((char *) "rb"),das_make_block<void,FILE const  * const >(__context__,208,0,&__func_info__bd8ac72f,[&](FILE const  * const  __f_rename_at_17)->void{
+		if ( __f_rename_at_17 != nullptr )
+		{
+			_Funcfio_0x60_fload_3695488be521b8da(__context__,__f_rename_at_17,das_arg<Foo>::pass(__foo1_rename_at_16));
+			das_copy(__loaded_rename_at_10,true);
+		};
+	}));
+	DAS_ASSERT((__saved_rename_at_9));
+	DAS_ASSERT((__loaded_rename_at_10));
+	DAS_ASSERT(((__foo0_rename_at_11.a == __foo1_rename_at_16.a) && (__foo0_rename_at_11.b == __foo1_rename_at_16.b)));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_a2bdceb66c902b97
+		aotLib[0x7ffda08dcc8916c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_a2bdceb66c902b97>>();
+	};
+		// _Funcbuiltin_0x60_binary_load_43040880b26c4465
+		aotLib[0x6bdd023c49b23d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_43040880b26c4465>>();
+	};
+		// _Funcbuiltin_0x60_binary_save_df945637b1078ab2
+		aotLib[0xd0fc38c10c0acad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_df945637b1078ab2>>();
+	};
+		// _Funcfio_0x60_fload_3695488be521b8da
+		aotLib[0x16ec69d49ba2b20b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, FILE const  * const  , Foo &  ),&_Funcfio_0x60_fload_3695488be521b8da>>();
+	};
+		// _Funcfio_0x60_fopen_b9d6dc0a3a9331ce
+		aotLib[0x586e1fde796a4279] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,FILE const  * const )) const  &  ),&_Funcfio_0x60_fopen_b9d6dc0a3a9331ce>>();
+	};
+		// _Funcfio_0x60_fsave_d461082ad2422bda
+		aotLib[0xca3ea6229a0006d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, FILE const  * const  , Foo const  &  ),&_Funcfio_0x60_fsave_d461082ad2422bda>>();
+	};
+		// test_2331a46f752d9451
+		aotLib[0x68d809ea58d256b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2331a46f752d9451>>();
+	};
+		// [[ init script ]]
+		aotLib[0xfa9aa7b64818773] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,349 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline bool test_bde728de39838b85 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline bool test_bde728de39838b85 ( Context * __context__ )
+{
+	TDim<int32_t,10> __a_rename_at_5; das_zero(__a_rename_at_5);
+	int32_t __i_rename_at_6 = 0;
+	{
+		bool __need_loop_7 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_5);
+		int32_t * __l_rename_at_7;
+		__need_loop_7 = __l_iterator.first(__context__,(__l_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __l_iterator.next(__context__,(__l_rename_at_7)) )
+		{
+			das_copy((*__l_rename_at_7),__i_rename_at_6);
+			__i_rename_at_6++;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_7));
+	};
+	DAS_ASSERT((__i_rename_at_6 == 10));
+	das_copy(__i_rename_at_6,0);
+	{
+		bool __need_loop_12 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_5);
+		int32_t * __l_rename_at_12;
+		__need_loop_12 = __l_iterator.first(__context__,(__l_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __l_iterator.next(__context__,(__l_rename_at_12)) )
+		{
+			DAS_ASSERT(((*__l_rename_at_12) == __i_rename_at_6));
+			__i_rename_at_6++;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_12));
+	};
+	TArray<int32_t> __a_rename_at_17; das_zero(__a_rename_at_17);
+	int32_t __i_rename_at_18 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_17),13);
+	{
+		bool __need_loop_20 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_17);
+		int32_t * __l_rename_at_20;
+		__need_loop_20 = __l_iterator.first(__context__,(__l_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __l_iterator.next(__context__,(__l_rename_at_20)) )
+		{
+			das_copy((*__l_rename_at_20),__i_rename_at_18++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_20));
+	};
+	DAS_ASSERT((__i_rename_at_18 == 13));
+	das_copy(__i_rename_at_18,0);
+	{
+		bool __need_loop_24 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_17);
+		int32_t * __l_rename_at_24;
+		__need_loop_24 = __l_iterator.first(__context__,(__l_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __l_iterator.next(__context__,(__l_rename_at_24)) )
+		{
+			DAS_ASSERT(((*__l_rename_at_24) == __i_rename_at_18));
+			__i_rename_at_18++;
+		}
+		__l_iterator.close(__context__,(__l_rename_at_24));
+	};
+	TDim<int32_t,10> __a_rename_at_29; das_zero(__a_rename_at_29); TDim<int32_t,10> __b_rename_at_29; das_zero(__b_rename_at_29);
+	int32_t __i_rename_at_30 = 0;
+	{
+		bool __need_loop_31 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_29);
+		int32_t * __l_rename_at_31;
+		__need_loop_31 = __l_iterator.first(__context__,(__l_rename_at_31)) && __need_loop_31;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_29);
+		int32_t * __r_rename_at_31;
+		__need_loop_31 = __r_iterator.first(__context__,(__r_rename_at_31)) && __need_loop_31;
+		for ( ; __need_loop_31 ; __need_loop_31 = __l_iterator.next(__context__,(__l_rename_at_31)) && __r_iterator.next(__context__,(__r_rename_at_31)) )
+		{
+			das_copy((*__r_rename_at_31),(__i_rename_at_30 * 2) - 5);
+			das_copy((*__l_rename_at_31),__i_rename_at_30++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_31));
+		__r_iterator.close(__context__,(__r_rename_at_31));
+	};
+	DAS_ASSERT((__i_rename_at_30 == 10));
+	das_copy(__i_rename_at_30,0);
+	{
+		bool __need_loop_36 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_29);
+		int32_t * __l_rename_at_36;
+		__need_loop_36 = __l_iterator.first(__context__,(__l_rename_at_36)) && __need_loop_36;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_29);
+		int32_t * __r_rename_at_36;
+		__need_loop_36 = __r_iterator.first(__context__,(__r_rename_at_36)) && __need_loop_36;
+		for ( ; __need_loop_36 ; __need_loop_36 = __l_iterator.next(__context__,(__l_rename_at_36)) && __r_iterator.next(__context__,(__r_rename_at_36)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_36) == ((__i_rename_at_30 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_36) == __i_rename_at_30++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_36));
+		__r_iterator.close(__context__,(__r_rename_at_36));
+	};
+	das_copy(__i_rename_at_30,0);
+	{
+		bool __need_loop_40 = true;
+		// l : int& -const
+		das_iterator<TDim<int32_t,10>> __l_iterator(__a_rename_at_29);
+		int32_t * __l_rename_at_40;
+		__need_loop_40 = __l_iterator.first(__context__,(__l_rename_at_40)) && __need_loop_40;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_29);
+		int32_t * __r_rename_at_40;
+		__need_loop_40 = __r_iterator.first(__context__,(__r_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = __l_iterator.next(__context__,(__l_rename_at_40)) && __r_iterator.next(__context__,(__r_rename_at_40)) )
+		{
+			if ( (*__l_rename_at_40) > (*__r_rename_at_40) )
+			{
+				DAS_ASSERT(((*__l_rename_at_40) > (*__r_rename_at_40)));
+				__i_rename_at_30++;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_40));
+		__r_iterator.close(__context__,(__r_rename_at_40));
+	};
+	DAS_ASSERT((__i_rename_at_30 == 5));
+	TArray<int32_t> __a_rename_at_47; das_zero(__a_rename_at_47);
+	TDim<int32_t,10> __b_rename_at_48; das_zero(__b_rename_at_48);
+	int32_t __i_rename_at_49 = 0;
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_47),4);
+	{
+		bool __need_loop_51 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_47);
+		int32_t * __l_rename_at_51;
+		__need_loop_51 = __l_iterator.first(__context__,(__l_rename_at_51)) && __need_loop_51;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_48);
+		int32_t * __r_rename_at_51;
+		__need_loop_51 = __r_iterator.first(__context__,(__r_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __l_iterator.next(__context__,(__l_rename_at_51)) && __r_iterator.next(__context__,(__r_rename_at_51)) )
+		{
+			DAS_ASSERT((__i_rename_at_49 < 4));
+			das_copy((*__r_rename_at_51),(__i_rename_at_49 * 2) - 5);
+			das_copy((*__l_rename_at_51),__i_rename_at_49++);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_51));
+		__r_iterator.close(__context__,(__r_rename_at_51));
+	};
+	DAS_ASSERT((__i_rename_at_49 == 4));
+	das_copy(__i_rename_at_49,0);
+	{
+		bool __need_loop_57 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_47);
+		int32_t * __l_rename_at_57;
+		__need_loop_57 = __l_iterator.first(__context__,(__l_rename_at_57)) && __need_loop_57;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_48);
+		int32_t * __r_rename_at_57;
+		__need_loop_57 = __r_iterator.first(__context__,(__r_rename_at_57)) && __need_loop_57;
+		for ( ; __need_loop_57 ; __need_loop_57 = __l_iterator.next(__context__,(__l_rename_at_57)) && __r_iterator.next(__context__,(__r_rename_at_57)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_57) == ((__i_rename_at_49 * 2) - 5)));
+			DAS_VERIFY(((*__l_rename_at_57) == __i_rename_at_49++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_57));
+		__r_iterator.close(__context__,(__r_rename_at_57));
+	};
+	DAS_ASSERT((__i_rename_at_49 == 4));
+	das_copy(__i_rename_at_49,0);
+	{
+		bool __need_loop_62 = true;
+		// l : int&
+		das_iterator<TArray<int32_t>> __l_iterator(__a_rename_at_47);
+		int32_t * __l_rename_at_62;
+		__need_loop_62 = __l_iterator.first(__context__,(__l_rename_at_62)) && __need_loop_62;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_48);
+		int32_t * __r_rename_at_62;
+		__need_loop_62 = __r_iterator.first(__context__,(__r_rename_at_62)) && __need_loop_62;
+		for ( ; __need_loop_62 ; __need_loop_62 = __l_iterator.next(__context__,(__l_rename_at_62)) && __r_iterator.next(__context__,(__r_rename_at_62)) )
+		{
+			if ( (*__l_rename_at_62) > (*__r_rename_at_62) )
+			{
+				DAS_ASSERT(((*__l_rename_at_62) > (*__r_rename_at_62)));
+				__i_rename_at_49++;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_62));
+		__r_iterator.close(__context__,(__r_rename_at_62));
+	};
+	DAS_ASSERT((__i_rename_at_49 == 4));
+	int32_t __i_rename_at_69 = 0;
+	{
+		bool __need_loop_70 = true;
+		// a : int const
+		das_iterator<range> __a_iterator(range(0,10));
+		int32_t __a_rename_at_70;
+		__need_loop_70 = __a_iterator.first(__context__,(__a_rename_at_70)) && __need_loop_70;
+		for ( ; __need_loop_70 ; __need_loop_70 = __a_iterator.next(__context__,(__a_rename_at_70)) )
+		{
+			DAS_VERIFY((__a_rename_at_70 == __i_rename_at_69++));
+		}
+		__a_iterator.close(__context__,(__a_rename_at_70));
+	};
+	DAS_ASSERT((__i_rename_at_69 == 10));
+	TDim<int32_t,10> __b_rename_at_75; das_zero(__b_rename_at_75);
+	int32_t __i_rename_at_76 = 0;
+	{
+		bool __need_loop_77 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_77;
+		__need_loop_77 = __l_iterator.first(__context__,(__l_rename_at_77)) && __need_loop_77;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_75);
+		int32_t * __r_rename_at_77;
+		__need_loop_77 = __r_iterator.first(__context__,(__r_rename_at_77)) && __need_loop_77;
+		for ( ; __need_loop_77 ; __need_loop_77 = __l_iterator.next(__context__,(__l_rename_at_77)) && __r_iterator.next(__context__,(__r_rename_at_77)) )
+		{
+			das_copy((*__r_rename_at_77),(__i_rename_at_76++ * 2) - 5);
+		}
+		__l_iterator.close(__context__,(__l_rename_at_77));
+		__r_iterator.close(__context__,(__r_rename_at_77));
+	};
+	DAS_ASSERT((__i_rename_at_76 == 10));
+	das_copy(__i_rename_at_76,0);
+	{
+		bool __need_loop_81 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_81;
+		__need_loop_81 = __l_iterator.first(__context__,(__l_rename_at_81)) && __need_loop_81;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_75);
+		int32_t * __r_rename_at_81;
+		__need_loop_81 = __r_iterator.first(__context__,(__r_rename_at_81)) && __need_loop_81;
+		for ( ; __need_loop_81 ; __need_loop_81 = __l_iterator.next(__context__,(__l_rename_at_81)) && __r_iterator.next(__context__,(__r_rename_at_81)) )
+		{
+			DAS_ASSERT(((*__r_rename_at_81) == ((__i_rename_at_76 * 2) - 5)));
+			DAS_VERIFY((__l_rename_at_81 == __i_rename_at_76++));
+		}
+		__l_iterator.close(__context__,(__l_rename_at_81));
+		__r_iterator.close(__context__,(__r_rename_at_81));
+	};
+	das_copy(__i_rename_at_76,0);
+	{
+		bool __need_loop_85 = true;
+		// l : int const
+		das_iterator<range> __l_iterator(range(0,10));
+		int32_t __l_rename_at_85;
+		__need_loop_85 = __l_iterator.first(__context__,(__l_rename_at_85)) && __need_loop_85;
+		// r : int& -const
+		das_iterator<TDim<int32_t,10>> __r_iterator(__b_rename_at_75);
+		int32_t * __r_rename_at_85;
+		__need_loop_85 = __r_iterator.first(__context__,(__r_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __l_iterator.next(__context__,(__l_rename_at_85)) && __r_iterator.next(__context__,(__r_rename_at_85)) )
+		{
+			if ( __l_rename_at_85 > (*__r_rename_at_85) )
+			{
+				DAS_ASSERT((__l_rename_at_85 > (*__r_rename_at_85)));
+				__i_rename_at_76++;
+			};
+		}
+		__l_iterator.close(__context__,(__l_rename_at_85));
+		__r_iterator.close(__context__,(__r_rename_at_85));
+	};
+	DAS_ASSERT((__i_rename_at_76 == 5));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// test_bde728de39838b85
+		aotLib[0x6cdf289e90e6e2b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_bde728de39838b85>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,91 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline bool test_c217184e0e34edfe ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_c217184e0e34edfe ( Context * __context__ )
+{
+	TDim<int32_t,1> __a_rename_at_3_ConstRef = ((TDim<int32_t,1>)(([&]() -> TDim<int32_t,1> {
+		TDim<int32_t,1> __mka_3;
+		__mka_3(0,__context__) = 1234;
+		return __mka_3;
+	})()));
+	TDim<int32_t,1> const  & __a_rename_at_3 = __a_rename_at_3_ConstRef; ;
+	{
+		bool __need_loop_4 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,1> const > __x_iterator(__a_rename_at_3);
+		int32_t const  * __x_rename_at_4;
+		__need_loop_4 = __x_iterator.first(__context__,(__x_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __x_iterator.next(__context__,(__x_rename_at_4)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_4) == 1234));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_4));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_c217184e0e34edfe
+		aotLib[0x5648d5ef7e0bb5ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c217184e0e34edfe>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
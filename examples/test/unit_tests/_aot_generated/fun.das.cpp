@@ -0,0 +1,5389 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require functional
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__586f669b;
+extern StructInfo __struct_info__44989078;
+extern StructInfo __struct_info__2c66e33;
+extern StructInfo __struct_info__786994ee;
+extern StructInfo __struct_info__e2118965;
+extern StructInfo __struct_info__53c86212;
+extern StructInfo __struct_info__9feadc05;
+extern StructInfo __struct_info__b79e1c01;
+extern StructInfo __struct_info__f5ea5153;
+extern StructInfo __struct_info__3a289c3d;
+extern StructInfo __struct_info__5a6f69c1;
+extern StructInfo __struct_info__1e40e2c4;
+extern StructInfo __struct_info__4b8ba355;
+extern StructInfo __struct_info__3478951f;
+extern StructInfo __struct_info__531ce5d3;
+extern StructInfo __struct_info__d5e64c8c;
+extern StructInfo __struct_info__5d26adc4;
+extern StructInfo __struct_info__67c568ab;
+extern StructInfo __struct_info__3a106938;
+extern StructInfo __struct_info__278f712d;
+extern StructInfo __struct_info__70715ff8;
+extern StructInfo __struct_info__1f40e457;
+extern StructInfo __struct_info__5f28ef81;
+extern StructInfo __struct_info__98b62e70;
+extern StructInfo __struct_info__6228f43a;
+extern StructInfo __struct_info__f8630aea;
+extern StructInfo __struct_info__946bc39d;
+extern StructInfo __struct_info__5c28eac8;
+extern StructInfo __struct_info__1f74a4fc;
+extern StructInfo __struct_info__79b6706b;
+extern StructInfo __struct_info__a4bdadf1;
+extern StructInfo __struct_info__103dfa13;
+extern StructInfo __struct_info__f3df880;
+extern StructInfo __struct_info__5d28ec5b;
+extern StructInfo __struct_info__712a5427;
+extern StructInfo __struct_info__59b2c4c9;
+extern TypeInfo __type_info__d238d5a8;
+extern TypeInfo __type_info__6c914b27;
+extern TypeInfo __type_info__c78cf730;
+extern TypeInfo __type_info__d27d2f5d;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__83837c47;
+extern TypeInfo __type_info__564b8c0f;
+extern TypeInfo __type_info__3f85f1b3;
+extern TypeInfo __type_info__f96efa8d;
+extern TypeInfo __type_info__fdce115e;
+extern TypeInfo __type_info__45839f1;
+extern TypeInfo __type_info__fc05925b;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__ee787d42;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__575f76e9;
+extern TypeInfo __type_info__4ffe7951;
+extern TypeInfo __type_info__b57008b;
+extern TypeInfo __type_info__4485f992;
+extern TypeInfo __type_info__4dd0dc66;
+extern TypeInfo __type_info__146e3c83;
+extern TypeInfo __type_info__241e4ab1;
+extern TypeInfo __type_info__221e478b;
+extern TypeInfo __type_info__82837ab4;
+extern TypeInfo __type_info__3c15753;
+extern TypeInfo __type_info__df321397;
+extern TypeInfo __type_info__34919a98;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__636e62a1;
+extern TypeInfo __type_info__3e85f020;
+extern TypeInfo __type_info__211e45f8;
+extern TypeInfo __type_info__59047065;
+extern TypeInfo __type_info__37f8377d;
+extern TypeInfo __type_info__f1b9498d;
+extern TypeInfo __type_info__3770203;
+extern TypeInfo __type_info__271e4f6a;
+extern TypeInfo __type_info__8dc06b9a;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__1983f0e3;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__479b2884;
+extern TypeInfo __type_info__4185f4d9;
+extern TypeInfo __type_info__63564868;
+extern TypeInfo __type_info__e2f9d5e9;
+extern TypeInfo __type_info__413b3264;
+extern TypeInfo __type_info__76b9d575;
+extern TypeInfo __type_info__1e08514b;
+extern TypeInfo __type_info__68dcf3f9;
+extern TypeInfo __type_info__95bfb40f;
+extern TypeInfo __type_info__1dd0b915;
+extern TypeInfo __type_info__cf91711b;
+extern TypeInfo __type_info__f9c3b13b;
+extern TypeInfo __type_info__2770070;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__4f1f8183;
+extern TypeInfo __type_info__ac13bbb3;
+extern TypeInfo __type_info__94bfb27c;
+extern TypeInfo __type_info__8bc49635;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__35919c2b;
+extern TypeInfo __type_info__8ba02c02;
+extern TypeInfo __type_info__20085471;
+extern TypeInfo __type_info__f8d2f36a;
+extern TypeInfo __type_info__34f42543;
+extern TypeInfo __type_info__a969907c;
+extern TypeInfo __type_info__82115e6d;
+extern TypeInfo __type_info__3f83b31c;
+extern TypeInfo __type_info__2125f168;
+extern TypeInfo __type_info__58ba7e63;
+extern TypeInfo __type_info__e0f9d2c3;
+extern TypeInfo __type_info__430d762d;
+extern TypeInfo __type_info__e5bb2fbb;
+extern TypeInfo __type_info__34ea7395;
+extern TypeInfo __type_info__e09ef0a0;
+extern TypeInfo __type_info__cd314265;
+extern TypeInfo __type_info__ffd30770;
+extern TypeInfo __type_info__8eef2917;
+extern TypeInfo __type_info__8f9c436d;
+extern TypeInfo __type_info__575c1f43;
+extern TypeInfo __type_info__3a36734f;
+extern TypeInfo __type_info__3bc97285;
+extern TypeInfo __type_info__6df81eef;
+extern TypeInfo __type_info__9b0d4e04;
+extern TypeInfo __type_info__8667970d;
+extern TypeInfo __type_info__fc8e246c;
+extern TypeInfo __type_info__cb86e0e0;
+extern TypeInfo __type_info__cbd13238;
+extern TypeInfo __type_info__221c08f4;
+extern TypeInfo __type_info__70b9d639;
+extern VarInfo __var_info__b2b28d3e;
+extern VarInfo __var_info__7a666790;
+extern VarInfo __var_info__b17be4f1;
+extern VarInfo __var_info__f36fb09b;
+extern VarInfo __var_info__870881e2;
+extern VarInfo __var_info__d4d1b1d0;
+extern VarInfo __var_info__ee29c2be;
+extern VarInfo __var_info__ce3575b;
+extern VarInfo __var_info__909be9db;
+extern VarInfo __var_info__2efc05a;
+extern VarInfo __var_info__f81a6d46;
+extern VarInfo __var_info__d1ecbf8d;
+extern VarInfo __var_info__283356e3;
+extern VarInfo __var_info__820ab5a3;
+extern VarInfo __var_info__477ee3c6;
+extern VarInfo __var_info__2b172eee;
+extern VarInfo __var_info__9a12b2c5;
+extern VarInfo __var_info__23412d03;
+extern VarInfo __var_info__56a081c;
+extern VarInfo __var_info__670c3a57;
+extern VarInfo __var_info__78bbc473;
+extern VarInfo __var_info__81225e0b;
+extern VarInfo __var_info__80ccab9f;
+extern VarInfo __var_info__313e8ca2;
+extern VarInfo __var_info__872a3061;
+extern VarInfo __var_info__a0dfc4f5;
+extern VarInfo __var_info__52e3fd1a;
+extern VarInfo __var_info__9c883573;
+extern VarInfo __var_info__93467b1;
+extern VarInfo __var_info__9e419c8a;
+extern VarInfo __var_info__841c9440;
+extern VarInfo __var_info__48510269;
+extern VarInfo __var_info__de8e049b;
+extern VarInfo __var_info__e9c30675;
+extern VarInfo __var_info__da162f0f;
+extern VarInfo __var_info__97166bea;
+extern VarInfo __var_info__3a849630;
+extern VarInfo __var_info__4aaf02a8;
+extern VarInfo __var_info__9490c965;
+extern VarInfo __var_info__b8e9e50c;
+extern VarInfo __var_info__f986913c;
+extern VarInfo __var_info__47ac872b;
+extern VarInfo __var_info__edf445b9;
+extern VarInfo __var_info__7d229efa;
+extern VarInfo __var_info__20fc96db;
+extern VarInfo __var_info__b223d0f3;
+extern VarInfo __var_info__7fcd8795;
+extern VarInfo __var_info__e0180d89;
+extern VarInfo __var_info__f5b77948;
+extern VarInfo __var_info__c085413d;
+extern VarInfo __var_info__40782216;
+extern VarInfo __var_info__cc22053b;
+extern VarInfo __var_info__ec160f60;
+extern VarInfo __var_info__e610b9df;
+extern VarInfo __var_info__506da5c8;
+extern VarInfo __var_info__6b8ba911;
+extern VarInfo __var_info__a82dce9b;
+extern VarInfo __var_info__78c7d321;
+extern VarInfo __var_info__a47ba229;
+extern VarInfo __var_info__8d13f1a4;
+extern VarInfo __var_info__64201aed;
+extern VarInfo __var_info__2206d735;
+extern VarInfo __var_info__a0b73046;
+extern VarInfo __var_info__f965a2ea;
+extern VarInfo __var_info__2ea98970;
+extern VarInfo __var_info__e7146240;
+extern VarInfo __var_info__b2cc722e;
+extern VarInfo __var_info__d7e6b44;
+extern VarInfo __var_info__d5f6b217;
+extern VarInfo __var_info__c8b624bc;
+extern VarInfo __var_info__c5b0b706;
+extern VarInfo __var_info__c1e30fff;
+extern VarInfo __var_info__c70bffec;
+extern VarInfo __var_info__16c7d036;
+extern VarInfo __var_info__3545119b;
+extern VarInfo __var_info__39ba19c;
+extern VarInfo __var_info__1f81b92b;
+extern VarInfo __var_info__b40d649c;
+extern VarInfo __var_info__16020bf0;
+extern VarInfo __var_info__681ea3f3;
+extern VarInfo __var_info__d4da13e8;
+extern VarInfo __var_info__8ce84ca9;
+extern VarInfo __var_info__199fca8c;
+extern VarInfo __var_info__16ae97fa;
+extern VarInfo __var_info__561a7cf6;
+extern VarInfo __var_info__db9d94e7;
+extern VarInfo __var_info__c6919440;
+extern VarInfo __var_info__6db5678d;
+extern VarInfo __var_info__3f4de3f8;
+extern VarInfo __var_info__93fb4bcd;
+extern VarInfo __var_info__8bdce1a;
+extern VarInfo __var_info__393cbc39;
+extern VarInfo __var_info__ff42c70;
+extern VarInfo __var_info__e7d67c2f;
+extern VarInfo __var_info__932f3a6f;
+extern VarInfo __var_info__b13cf481;
+extern VarInfo __var_info__96bbc324;
+extern VarInfo __var_info__20429929;
+extern VarInfo __var_info__a78990b;
+extern VarInfo __var_info__8a22f142;
+extern VarInfo __var_info__6a2cd6e9;
+extern VarInfo __var_info__5c6dc5f6;
+extern VarInfo __var_info__68aabf55;
+extern VarInfo __var_info__cb124f1;
+extern VarInfo __var_info__3c948071;
+extern VarInfo __var_info__d619cc25;
+extern VarInfo __var_info__b5e2377f;
+extern VarInfo __var_info__750c96f4;
+extern VarInfo __var_info__5d23a4d7;
+extern VarInfo __var_info__8ff18fac;
+extern VarInfo __var_info__e79c2cdc;
+extern VarInfo __var_info__935e5615;
+extern VarInfo __var_info__8c15f483;
+extern VarInfo __var_info__cdceca1d;
+extern VarInfo __var_info__97820e51;
+extern VarInfo __var_info__cf38084d;
+extern VarInfo __var_info__2c8b21c1;
+extern VarInfo __var_info__d7ab6136;
+extern VarInfo __var_info__660a4fd7;
+extern VarInfo __var_info__5a826047;
+extern VarInfo __var_info__889a57d3;
+extern VarInfo __var_info__c3d9d992;
+extern VarInfo __var_info__ef9e6730;
+extern VarInfo __var_info__1ec20c96;
+extern VarInfo __var_info__8a25a2b8;
+extern VarInfo __var_info__73d33e26;
+extern VarInfo __var_info__1f2e4aca;
+extern VarInfo __var_info__9e37d77d;
+extern VarInfo __var_info__d8c2ebb2;
+extern VarInfo __var_info__57398f29;
+extern VarInfo __var_info__77d12f49;
+extern VarInfo __var_info__efe5261a;
+extern VarInfo __var_info__74e16e17;
+extern VarInfo __var_info__3d8ea661;
+extern VarInfo __var_info__4056a5c4;
+extern VarInfo __var_info__43f5bfed;
+extern VarInfo __var_info__d489fd7a;
+extern VarInfo __var_info__9f6a71de;
+extern VarInfo __var_info__ae5f6129;
+extern VarInfo __var_info__9ad8251d;
+extern VarInfo __var_info__36ff1db0;
+extern VarInfo __var_info__cf8558da;
+extern VarInfo __var_info__d42d6e5f;
+extern VarInfo __var_info__88e08a0d;
+extern VarInfo __var_info__a2a76a0;
+extern VarInfo __var_info__11f9b1cf;
+extern VarInfo __var_info__b2c3902d;
+extern VarInfo __var_info__4ae21488;
+extern VarInfo __var_info__e2a602c0;
+extern VarInfo __var_info__2fa1b31d;
+extern VarInfo __var_info__64507a9d;
+extern VarInfo __var_info__1b8cb484;
+extern VarInfo __var_info__aa89f40f;
+extern VarInfo __var_info__1c9fd32b;
+extern VarInfo __var_info__dee3bd19;
+extern VarInfo __var_info__2e81d0c8;
+extern VarInfo __var_info__cde46b92;
+extern VarInfo __var_info__aa0456c3;
+extern VarInfo __var_info__e168513e;
+extern VarInfo __var_info__6f6d5558;
+extern VarInfo __var_info__853d286a;
+extern VarInfo __var_info__fb2c2a7;
+extern VarInfo __var_info__41d45720;
+extern VarInfo __var_info__4d25ad31;
+extern VarInfo __var_info__7e91b651;
+extern VarInfo __var_info__eb06b486;
+extern VarInfo __var_info__10a9bc28;
+extern VarInfo __var_info__9b48842a;
+extern VarInfo __var_info__f12007a0;
+extern VarInfo __var_info__53cd0006;
+extern VarInfo __var_info__313cf6f5;
+extern VarInfo __var_info__84697305;
+extern VarInfo __var_info__fd0d70b7;
+extern VarInfo __var_info__f0ff6373;
+extern VarInfo __var_info__31033d6a;
+extern VarInfo __var_info__eeb90f30;
+extern VarInfo __var_info__f4fb1a1e;
+extern VarInfo __var_info__3daaf002;
+extern VarInfo __var_info__3d8b623c;
+extern VarInfo __var_info__92bb49a1;
+extern VarInfo __var_info__8ac7016e;
+extern VarInfo __var_info__29b17cf2;
+extern VarInfo __var_info__a7fe9772;
+extern VarInfo __var_info__e5ec475c;
+extern VarInfo __var_info__7059af28;
+extern VarInfo __var_info__e92787d;
+extern VarInfo __var_info__2564fdb8;
+extern VarInfo __var_info__7640a3b4;
+extern VarInfo __var_info__3efc909e;
+extern VarInfo __var_info__c9a4c1aa;
+extern VarInfo __var_info__65049801;
+extern VarInfo __var_info__43f92cbf;
+extern VarInfo __var_info__322c3fba;
+extern VarInfo __var_info__6b8731b;
+extern VarInfo __var_info__a9ad06f2;
+extern VarInfo __var_info__232fce6b;
+extern VarInfo __var_info__a1ff7784;
+extern VarInfo __var_info__a45b0bdd;
+extern VarInfo __var_info__cd922dc3;
+extern VarInfo __var_info__d4a6cec4;
+extern VarInfo __var_info__8b9380b0;
+extern VarInfo __var_info__48bf5547;
+extern VarInfo __var_info__ee16811a;
+extern VarInfo __var_info__a1646d32;
+extern VarInfo __var_info__fe439c05;
+extern VarInfo __var_info__4fee58d0;
+extern VarInfo __var_info__4bc4e1ff;
+extern VarInfo __var_info__ef2087d;
+extern VarInfo __var_info__ffd4617;
+extern VarInfo __var_info__ce1ea478;
+extern VarInfo __var_info__2d51936f;
+extern VarInfo __var_info__297ac64f;
+extern VarInfo __var_info__81bc7599;
+extern VarInfo __var_info__bb3dfb47;
+extern VarInfo __var_info__dd306cf6;
+extern VarInfo __var_info__12056145;
+extern VarInfo __var_info__5db1f88a;
+extern VarInfo __var_info__1aa244e7;
+extern VarInfo __var_info__331a6983;
+extern VarInfo __var_info__831bc516;
+extern VarInfo __var_info__92eac40f;
+extern VarInfo __var_info__2a1ceadc;
+extern VarInfo __var_info__dc031ee;
+extern VarInfo __var_info__9e06e4d5;
+extern VarInfo __var_info__19f851a4;
+extern VarInfo __var_info__5c2079ea;
+extern VarInfo __var_info__20d20f0b;
+extern VarInfo __var_info__3eae7296;
+extern VarInfo __var_info__fb770a54;
+extern VarInfo __var_info__bd28b49c;
+extern VarInfo __var_info__a91e8cec;
+extern VarInfo __var_info__a5cc5b9b;
+extern VarInfo __var_info__43f0af5d;
+extern VarInfo __var_info__37fe1151;
+extern VarInfo __var_info__a32bc052;
+extern VarInfo __var_info__f9f44132;
+extern VarInfo __var_info__30b1747f;
+extern VarInfo __var_info__56ba2d89;
+extern VarInfo __var_info__efb962c2;
+extern VarInfo __var_info__c4fc5b60;
+extern VarInfo __var_info__bb1b1947;
+extern VarInfo __var_info__e20fb039;
+extern VarInfo __var_info__6fc4b1c5;
+extern VarInfo __var_info__c191eb54;
+extern VarInfo __var_info__a403ff76;
+extern VarInfo __var_info__b6cb4b46;
+extern VarInfo __var_info__faf7654c;
+extern VarInfo __var_info__1d16df0b;
+extern VarInfo __var_info__a42d3be3;
+extern VarInfo __var_info__30a8ad13;
+extern VarInfo __var_info__cd947b07;
+extern VarInfo __var_info__435c1dcb;
+extern VarInfo __var_info__f6e8c74f;
+extern VarInfo __var_info__72e9e18a;
+extern VarInfo __var_info__25bc6923;
+extern VarInfo __var_info__257c5583;
+extern VarInfo __var_info__ce6336d2;
+extern VarInfo __var_info__6d03fb10;
+extern VarInfo __var_info__7adbb3e8;
+extern FuncInfo __func_info__2e807d1c;
+extern FuncInfo __func_info__56461723;
+
+TypeInfo * __type_info__506da5c8_arg_types_var_1483695771[2] = { &__type_info__1e08514b, &__type_info__8bc49635 };
+VarInfo __struct_info__586f669b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__506da5c8_arg_types_var_1483695771, nullptr, 2, 0, nullptr, 28, 0x506da5c8, "__lambda", 0 };
+TypeInfo * __type_info__9ad8251d_arg_types_var_1483695771[1] = { &__type_info__e0f9d2c3 };
+VarInfo __struct_info__586f669b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9ad8251d_arg_types_var_1483695771, nullptr, 1, 0, nullptr, 28, 0x9ad8251d, "__finalize", 4 };
+VarInfo __struct_info__586f669b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe79c2cdc, "__yield", 8 };
+VarInfo __struct_info__586f669b_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xd1ecbf8d, "src", 16 };
+VarInfo __struct_info__586f669b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcd922dc3, "start", 24 };
+VarInfo __struct_info__586f669b_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x97820e51, "stop", 28 };
+VarInfo __struct_info__586f669b_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xee16811a, "_loop_at_146", 32 };
+VarInfo __struct_info__586f669b_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x8bdce1a, "_source_0_at_146", 40 };
+VarInfo __struct_info__586f669b_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1f81b92b, "x", 48 };
+VarInfo __struct_info__586f669b_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x53cd0006, "_pvar_0_at_146", 56 };
+VarInfo __struct_info__586f669b_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2e81d0c8, "i", 64 };
+VarInfo __struct_info__586f669b_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2d51936f, "_pvar_1_at_146", 72 };
+VarInfo __struct_info__586f669b_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa42d3be3, "_source_1_at_146", 80 };
+VarInfo * __struct_info__586f669b_fields[13] =  { &__struct_info__586f669b_field_0, &__struct_info__586f669b_field_1, &__struct_info__586f669b_field_2, &__struct_info__586f669b_field_3, &__struct_info__586f669b_field_4, &__struct_info__586f669b_field_5, &__struct_info__586f669b_field_6, &__struct_info__586f669b_field_7, &__struct_info__586f669b_field_8, &__struct_info__586f669b_field_9, &__struct_info__586f669b_field_10, &__struct_info__586f669b_field_11, &__struct_info__586f669b_field_12 };
+StructInfo __struct_info__586f669b = {"_lambda_thismodule_146_12_31", __struct_info__586f669b_fields, 13, 88, -1, nullptr, 0x586f669b };
+TypeInfo * __type_info__8ce84ca9_arg_types_var_1150849144[2] = { &__type_info__d238d5a8, &__type_info__359c1b32 };
+VarInfo __struct_info__44989078_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__8ce84ca9_arg_types_var_1150849144, nullptr, 2, 0, nullptr, 28, 0x8ce84ca9, "__lambda", 0 };
+TypeInfo * __type_info__10a9bc28_arg_types_var_1150849144[1] = { &__type_info__cb86e0e0 };
+VarInfo __struct_info__44989078_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__10a9bc28_arg_types_var_1150849144, nullptr, 1, 0, nullptr, 28, 0x10a9bc28, "__finalize", 4 };
+VarInfo * __struct_info__44989078_fields[2] =  { &__struct_info__44989078_field_0, &__struct_info__44989078_field_1 };
+StructInfo __struct_info__44989078 = {"_lambda_thismodule_180_30_18", __struct_info__44989078_fields, 2, 8, -1, nullptr, 0x44989078 };
+TypeInfo * __type_info__7a666790_arg_types_var_46558771[2] = { &__type_info__1983f0e3, &__type_info__f1b9498d };
+VarInfo __struct_info__2c66e33_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7a666790_arg_types_var_46558771, nullptr, 2, 0, nullptr, 28, 0x7a666790, "__lambda", 0 };
+TypeInfo * __type_info__2206d735_arg_types_var_46558771[1] = { &__type_info__e5bb2fbb };
+VarInfo __struct_info__2c66e33_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2206d735_arg_types_var_46558771, nullptr, 1, 0, nullptr, 28, 0x2206d735, "__finalize", 4 };
+VarInfo * __struct_info__2c66e33_fields[2] =  { &__struct_info__2c66e33_field_0, &__struct_info__2c66e33_field_1 };
+StructInfo __struct_info__2c66e33 = {"_lambda_thismodule_91_25_27", __struct_info__2c66e33_fields, 2, 8, -1, nullptr, 0x2c66e33 };
+TypeInfo * __type_info__1d16df0b_arg_types_var_2020185326[2] = { &__type_info__fdce115e, &__type_info__e6eb6b88 };
+VarInfo __struct_info__786994ee_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__1d16df0b_arg_types_var_2020185326, nullptr, 2, 0, nullptr, 28, 0x1d16df0b, "__lambda", 0 };
+TypeInfo * __type_info__f965a2ea_arg_types_var_2020185326[1] = { &__type_info__4dd0dc66 };
+VarInfo __struct_info__786994ee_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f965a2ea_arg_types_var_2020185326, nullptr, 1, 0, nullptr, 28, 0xf965a2ea, "__finalize", 4 };
+VarInfo __struct_info__786994ee_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3daaf002, "start", 8 };
+VarInfo __struct_info__786994ee_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x6f6d5558, "step", 12 };
+VarInfo * __struct_info__786994ee_fields[4] =  { &__struct_info__786994ee_field_0, &__struct_info__786994ee_field_1, &__struct_info__786994ee_field_2, &__struct_info__786994ee_field_3 };
+StructInfo __struct_info__786994ee = {"_lambda_thismodule_155_8_2", __struct_info__786994ee_fields, 4, 16, -1, nullptr, 0x786994ee };
+TypeInfo * __type_info__3efc909e_arg_types_var_3792800101[2] = { &__type_info__34ea7395, &__type_info__260b3481 };
+VarInfo __struct_info__e2118965_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__3efc909e_arg_types_var_3792800101, nullptr, 2, 0, nullptr, 28, 0x3efc909e, "__lambda", 0 };
+TypeInfo * __type_info__a82dce9b_arg_types_var_3792800101[1] = { &__type_info__8f9c436d };
+VarInfo __struct_info__e2118965_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a82dce9b_arg_types_var_3792800101, nullptr, 1, 0, nullptr, 28, 0xa82dce9b, "__finalize", 4 };
+VarInfo __struct_info__e2118965_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x1f2e4aca, "__yield", 8 };
+VarInfo __struct_info__e2118965_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd7ab6136, "_loop_at_90", 12 };
+VarInfo __struct_info__e2118965_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x6b8ba911, "x", 16 };
+VarInfo __struct_info__e2118965_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf4fb1a1e, "_pvar_0_at_90", 24 };
+VarInfo __struct_info__e2118965_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x8a22f142, "_source_0_at_90", 32 };
+VarInfo * __struct_info__e2118965_fields[7] =  { &__struct_info__e2118965_field_0, &__struct_info__e2118965_field_1, &__struct_info__e2118965_field_2, &__struct_info__e2118965_field_3, &__struct_info__e2118965_field_4, &__struct_info__e2118965_field_5, &__struct_info__e2118965_field_6 };
+StructInfo __struct_info__e2118965 = {"_lambda_thismodule_90_14_11", __struct_info__e2118965_fields, 7, 40, -1, nullptr, 0xe2118965 };
+TypeInfo * __type_info__f6e8c74f_arg_types_var_1405641234[2] = { &__type_info__8ba02c02, &__type_info__e6eb6b88 };
+VarInfo __struct_info__53c86212_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__f6e8c74f_arg_types_var_1405641234, nullptr, 2, 0, nullptr, 28, 0xf6e8c74f, "__lambda", 0 };
+TypeInfo * __type_info__477ee3c6_arg_types_var_1405641234[1] = { &__type_info__f8d2f36a };
+VarInfo __struct_info__53c86212_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__477ee3c6_arg_types_var_1405641234, nullptr, 1, 0, nullptr, 28, 0x477ee3c6, "__finalize", 4 };
+VarInfo __struct_info__53c86212_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x43f0af5d, "__yield", 8 };
+VarInfo __struct_info__53c86212_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xe5ec475c, "src", 16 };
+VarInfo __struct_info__53c86212_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x7fcd8795, "arr", 24 };
+VarInfo __struct_info__53c86212_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd4d1b1d0, "___loop_at_119_rename_at_119", 48 };
+VarInfo __struct_info__53c86212_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x80ccab9f, "__x_rename_at_119", 56 };
+VarInfo __struct_info__53c86212_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa2a76a0, "___pvar_0_at_119_rename_at_119", 64 };
+VarInfo __struct_info__53c86212_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x65049801, "_loop_at_115", 72 };
+VarInfo __struct_info__53c86212_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x78c7d321, "_source_0_at_115", 80 };
+VarInfo __struct_info__53c86212_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x5db1f88a, "x", 88 };
+VarInfo __struct_info__53c86212_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xef2087d, "_pvar_0_at_115", 96 };
+VarInfo __struct_info__53c86212_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__e6eb6b88, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x56a081c, "___source_0_at_119_rename_at_119", 104 };
+VarInfo * __struct_info__53c86212_fields[13] =  { &__struct_info__53c86212_field_0, &__struct_info__53c86212_field_1, &__struct_info__53c86212_field_2, &__struct_info__53c86212_field_3, &__struct_info__53c86212_field_4, &__struct_info__53c86212_field_5, &__struct_info__53c86212_field_6, &__struct_info__53c86212_field_7, &__struct_info__53c86212_field_8, &__struct_info__53c86212_field_9, &__struct_info__53c86212_field_10, &__struct_info__53c86212_field_11, &__struct_info__53c86212_field_12 };
+StructInfo __struct_info__53c86212 = {"_lambda_thismodule_114_12_19", __struct_info__53c86212_fields, 13, 112, -1, nullptr, 0x53c86212 };
+TypeInfo * __type_info__e168513e_arg_types_var_2682969093[2] = { &__type_info__76b9d575, &__type_info__e6eb6b88 };
+VarInfo __struct_info__9feadc05_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__e168513e_arg_types_var_2682969093, nullptr, 2, 0, nullptr, 28, 0xe168513e, "__lambda", 0 };
+TypeInfo * __type_info__cc22053b_arg_types_var_2682969093[1] = { &__type_info__f96efa8d };
+VarInfo __struct_info__9feadc05_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc22053b_arg_types_var_2682969093, nullptr, 1, 0, nullptr, 28, 0xcc22053b, "__finalize", 4 };
+VarInfo __struct_info__9feadc05_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x97166bea, "__yield", 8 };
+VarInfo __struct_info__9feadc05_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd4da13e8, "_loop_at_227", 12 };
+VarInfo __struct_info__9feadc05_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4d25ad31, "x", 16 };
+VarInfo __struct_info__9feadc05_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x6d03fb10, "_pvar_0_at_227", 24 };
+VarInfo __struct_info__9feadc05_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xd4a6cec4, "_source_0_at_227", 32 };
+VarInfo * __struct_info__9feadc05_fields[7] =  { &__struct_info__9feadc05_field_0, &__struct_info__9feadc05_field_1, &__struct_info__9feadc05_field_2, &__struct_info__9feadc05_field_3, &__struct_info__9feadc05_field_4, &__struct_info__9feadc05_field_5, &__struct_info__9feadc05_field_6 };
+StructInfo __struct_info__9feadc05 = {"_lambda_thismodule_227_19_7", __struct_info__9feadc05_fields, 7, 40, -1, nullptr, 0x9feadc05 };
+TypeInfo * __type_info__5c2079ea_arg_types_var_3080592385[2] = { &__type_info__45839f1, &__type_info__359c1b32 };
+VarInfo __struct_info__b79e1c01_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__5c2079ea_arg_types_var_3080592385, nullptr, 2, 0, nullptr, 28, 0x5c2079ea, "__lambda", 0 };
+TypeInfo * __type_info__4bc4e1ff_arg_types_var_3080592385[1] = { &__type_info__575f76e9 };
+VarInfo __struct_info__b79e1c01_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4bc4e1ff_arg_types_var_3080592385, nullptr, 1, 0, nullptr, 28, 0x4bc4e1ff, "__finalize", 4 };
+VarInfo * __struct_info__b79e1c01_fields[2] =  { &__struct_info__b79e1c01_field_0, &__struct_info__b79e1c01_field_1 };
+StructInfo __struct_info__b79e1c01 = {"_lambda_thismodule_163_30_16", __struct_info__b79e1c01_fields, 2, 8, -1, nullptr, 0xb79e1c01 };
+TypeInfo * __type_info__36ff1db0_arg_types_var_4125774163[2] = { &__type_info__4f1f8183, &__type_info__359c1b32 };
+VarInfo __struct_info__f5ea5153_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__36ff1db0_arg_types_var_4125774163, nullptr, 2, 0, nullptr, 28, 0x36ff1db0, "__lambda", 0 };
+TypeInfo * __type_info__68aabf55_arg_types_var_4125774163[1] = { &__type_info__f9c3b13b };
+VarInfo __struct_info__f5ea5153_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__68aabf55_arg_types_var_4125774163, nullptr, 1, 0, nullptr, 28, 0x68aabf55, "__finalize", 4 };
+VarInfo * __struct_info__f5ea5153_fields[2] =  { &__struct_info__f5ea5153_field_0, &__struct_info__f5ea5153_field_1 };
+StructInfo __struct_info__f5ea5153 = {"_lambda_thismodule_85_28_1", __struct_info__f5ea5153_fields, 2, 8, -1, nullptr, 0xf5ea5153 };
+TypeInfo * __type_info__73d33e26_arg_types_var_975739965[2] = { &__type_info__82115e6d, &__type_info__260b3481 };
+VarInfo __struct_info__3a289c3d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__73d33e26_arg_types_var_975739965, nullptr, 2, 0, nullptr, 28, 0x73d33e26, "__lambda", 0 };
+TypeInfo * __type_info__30a8ad13_arg_types_var_975739965[1] = { &__type_info__cd314265 };
+VarInfo __struct_info__3a289c3d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__30a8ad13_arg_types_var_975739965, nullptr, 1, 0, nullptr, 28, 0x30a8ad13, "__finalize", 4 };
+VarInfo __struct_info__3a289c3d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcde46b92, "__yield", 8 };
+VarInfo __struct_info__3a289c3d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x257c5583, "_loop_at_240", 12 };
+VarInfo __struct_info__3a289c3d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x81bc7599, "x", 16 };
+VarInfo __struct_info__3a289c3d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x232fce6b, "_pvar_0_at_240", 24 };
+VarInfo __struct_info__3a289c3d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb5e2377f, "_source_0_at_240", 32 };
+VarInfo * __struct_info__3a289c3d_fields[7] =  { &__struct_info__3a289c3d_field_0, &__struct_info__3a289c3d_field_1, &__struct_info__3a289c3d_field_2, &__struct_info__3a289c3d_field_3, &__struct_info__3a289c3d_field_4, &__struct_info__3a289c3d_field_5, &__struct_info__3a289c3d_field_6 };
+StructInfo __struct_info__3a289c3d = {"_lambda_thismodule_240_10_12", __struct_info__3a289c3d_fields, 7, 40, -1, nullptr, 0x3a289c3d };
+TypeInfo * __type_info__c9a4c1aa_arg_types_var_1517251009[2] = { &__type_info__20085471, &__type_info__6df81eef };
+VarInfo __struct_info__5a6f69c1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c9a4c1aa_arg_types_var_1517251009, nullptr, 2, 0, nullptr, 28, 0xc9a4c1aa, "__lambda", 0 };
+TypeInfo * __type_info__43f92cbf_arg_types_var_1517251009[1] = { &__type_info__e2f9d5e9 };
+VarInfo __struct_info__5a6f69c1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43f92cbf_arg_types_var_1517251009, nullptr, 1, 0, nullptr, 28, 0x43f92cbf, "__finalize", 4 };
+VarInfo __struct_info__5a6f69c1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x8ac7016e, "__yield", 8 };
+VarInfo __struct_info__5a6f69c1_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xde8e049b, "src", 16 };
+VarInfo __struct_info__5a6f69c1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcdceca1d, "start", 24 };
+VarInfo __struct_info__5a6f69c1_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xaa89f40f, "stop", 28 };
+VarInfo __struct_info__5a6f69c1_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeeb90f30, "_loop_at_146", 32 };
+VarInfo __struct_info__5a6f69c1_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xbd28b49c, "_source_0_at_146", 40 };
+VarInfo __struct_info__5a6f69c1_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc085413d, "x", 48 };
+VarInfo __struct_info__5a6f69c1_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8b9380b0, "_pvar_0_at_146", 56 };
+VarInfo __struct_info__5a6f69c1_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcf8558da, "i", 64 };
+VarInfo __struct_info__5a6f69c1_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x37fe1151, "_pvar_1_at_146", 72 };
+VarInfo __struct_info__5a6f69c1_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x9e37d77d, "_source_1_at_146", 80 };
+VarInfo * __struct_info__5a6f69c1_fields[13] =  { &__struct_info__5a6f69c1_field_0, &__struct_info__5a6f69c1_field_1, &__struct_info__5a6f69c1_field_2, &__struct_info__5a6f69c1_field_3, &__struct_info__5a6f69c1_field_4, &__struct_info__5a6f69c1_field_5, &__struct_info__5a6f69c1_field_6, &__struct_info__5a6f69c1_field_7, &__struct_info__5a6f69c1_field_8, &__struct_info__5a6f69c1_field_9, &__struct_info__5a6f69c1_field_10, &__struct_info__5a6f69c1_field_11, &__struct_info__5a6f69c1_field_12 };
+StructInfo __struct_info__5a6f69c1 = {"_lambda_thismodule_146_12_33", __struct_info__5a6f69c1_fields, 13, 88, -1, nullptr, 0x5a6f69c1 };
+TypeInfo * __type_info__84697305_arg_types_var_507568836[2] = { &__type_info__82837ab4, &__type_info__6df81eef };
+VarInfo __struct_info__1e40e2c4_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__84697305_arg_types_var_507568836, nullptr, 2, 0, nullptr, 28, 0x84697305, "__lambda", 0 };
+TypeInfo * __type_info__f986913c_arg_types_var_507568836[1] = { &__type_info__94bfb27c };
+VarInfo __struct_info__1e40e2c4_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f986913c_arg_types_var_507568836, nullptr, 1, 0, nullptr, 28, 0xf986913c, "__finalize", 4 };
+VarInfo __struct_info__1e40e2c4_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb223d0f3, "__yield", 8 };
+VarInfo __struct_info__1e40e2c4_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x40782216, "src", 16 };
+VarInfo __struct_info__1e40e2c4_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x25bc6923, "arr", 24 };
+VarInfo __struct_info__1e40e2c4_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x29b17cf2, "___loop_at_131_rename_at_131", 48 };
+VarInfo __struct_info__1e40e2c4_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x660a4fd7, "__x_rename_at_131", 56 };
+VarInfo __struct_info__1e40e2c4_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1ec20c96, "___pvar_0_at_131_rename_at_131", 64 };
+VarInfo __struct_info__1e40e2c4_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x322c3fba, "_loop_at_127", 72 };
+VarInfo __struct_info__1e40e2c4_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc5b0b706, "_source_0_at_127", 80 };
+VarInfo __struct_info__1e40e2c4_field_10 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8a25a2b8, "x", 88 };
+VarInfo __struct_info__1e40e2c4_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa9ad06f2, "_pvar_0_at_127", 112 };
+VarInfo __struct_info__1e40e2c4_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa32bc052, "___source_0_at_131_rename_at_131", 120 };
+VarInfo * __struct_info__1e40e2c4_fields[13] =  { &__struct_info__1e40e2c4_field_0, &__struct_info__1e40e2c4_field_1, &__struct_info__1e40e2c4_field_2, &__struct_info__1e40e2c4_field_3, &__struct_info__1e40e2c4_field_4, &__struct_info__1e40e2c4_field_5, &__struct_info__1e40e2c4_field_6, &__struct_info__1e40e2c4_field_7, &__struct_info__1e40e2c4_field_8, &__struct_info__1e40e2c4_field_9, &__struct_info__1e40e2c4_field_10, &__struct_info__1e40e2c4_field_11, &__struct_info__1e40e2c4_field_12 };
+StructInfo __struct_info__1e40e2c4 = {"_lambda_thismodule_126_12_29", __struct_info__1e40e2c4_fields, 13, 128, -1, nullptr, 0x1e40e2c4 };
+TypeInfo * __type_info__2b172eee_arg_types_var_1267442517[3] = { &__type_info__3bc97285, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__4b8ba355_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, (TypeInfo **)__type_info__2b172eee_arg_types_var_1267442517, nullptr, 3, 0, nullptr, 28, 0x2b172eee, "__lambda", 0 };
+TypeInfo * __type_info__81225e0b_arg_types_var_1267442517[1] = { &__type_info__37f8377d };
+VarInfo __struct_info__4b8ba355_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__81225e0b_arg_types_var_1267442517, nullptr, 1, 0, nullptr, 28, 0x81225e0b, "__finalize", 4 };
+VarInfo * __struct_info__4b8ba355_fields[2] =  { &__struct_info__4b8ba355_field_0, &__struct_info__4b8ba355_field_1 };
+StructInfo __struct_info__4b8ba355 = {"_lambda_thismodule_115_27_15", __struct_info__4b8ba355_fields, 2, 8, -1, nullptr, 0x4b8ba355 };
+TypeInfo * __type_info__c70bffec_arg_types_var_880317727[2] = { &__type_info__3a36734f, &__type_info__e6eb6b88 };
+VarInfo __struct_info__3478951f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c70bffec_arg_types_var_880317727, nullptr, 2, 0, nullptr, 28, 0xc70bffec, "__lambda", 0 };
+TypeInfo * __type_info__56ba2d89_arg_types_var_880317727[1] = { &__type_info__8eef2917 };
+VarInfo __struct_info__3478951f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56ba2d89_arg_types_var_880317727, nullptr, 1, 0, nullptr, 28, 0x56ba2d89, "__finalize", 4 };
+VarInfo __struct_info__3478951f_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x7059af28, "__yield", 8 };
+VarInfo __struct_info__3478951f_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa91e8cec, "count", 12 };
+VarInfo __struct_info__3478951f_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf9f44132, "value", 16 };
+VarInfo __struct_info__3478951f_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x6fc4b1c5, "_loop_at_165", 20 };
+VarInfo __struct_info__3478951f_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe7d67c2f, "x", 24 };
+VarInfo __struct_info__3478951f_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xae5f6129, "_pvar_0_at_165", 32 };
+VarInfo __struct_info__3478951f_field_8 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x64507a9d, "_source_0_at_165", 40 };
+VarInfo * __struct_info__3478951f_fields[9] =  { &__struct_info__3478951f_field_0, &__struct_info__3478951f_field_1, &__struct_info__3478951f_field_2, &__struct_info__3478951f_field_3, &__struct_info__3478951f_field_4, &__struct_info__3478951f_field_5, &__struct_info__3478951f_field_6, &__struct_info__3478951f_field_7, &__struct_info__3478951f_field_8 };
+StructInfo __struct_info__3478951f = {"_lambda_thismodule_162_8_3", __struct_info__3478951f_fields, 9, 48, -1, nullptr, 0x3478951f };
+TypeInfo * __type_info__ef9e6730_arg_types_var_1394402771[2] = { &__type_info__34f42543, &__type_info__359c1b32 };
+VarInfo __struct_info__531ce5d3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__ef9e6730_arg_types_var_1394402771, nullptr, 2, 0, nullptr, 28, 0xef9e6730, "__lambda", 0 };
+TypeInfo * __type_info__9e06e4d5_arg_types_var_1394402771[1] = { &__type_info__b57008b };
+VarInfo __struct_info__531ce5d3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9e06e4d5_arg_types_var_1394402771, nullptr, 1, 0, nullptr, 28, 0x9e06e4d5, "__finalize", 4 };
+VarInfo * __struct_info__531ce5d3_fields[2] =  { &__struct_info__531ce5d3_field_0, &__struct_info__531ce5d3_field_1 };
+StructInfo __struct_info__531ce5d3 = {"_lambda_thismodule_71_25_14", __struct_info__531ce5d3_fields, 2, 8, -1, nullptr, 0x531ce5d3 };
+TypeInfo * __type_info__2fa1b31d_arg_types_var_3588639884[2] = { &__type_info__a969907c, &__type_info__359c1b32 };
+VarInfo __struct_info__d5e64c8c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, (TypeInfo **)__type_info__2fa1b31d_arg_types_var_3588639884, nullptr, 2, 0, nullptr, 28, 0x2fa1b31d, "__lambda", 0 };
+TypeInfo * __type_info__8d13f1a4_arg_types_var_3588639884[1] = { &__type_info__9b0d4e04 };
+VarInfo __struct_info__d5e64c8c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8d13f1a4_arg_types_var_3588639884, nullptr, 1, 0, nullptr, 28, 0x8d13f1a4, "__finalize", 4 };
+VarInfo * __struct_info__d5e64c8c_fields[2] =  { &__struct_info__d5e64c8c_field_0, &__struct_info__d5e64c8c_field_1 };
+StructInfo __struct_info__d5e64c8c = {"_lambda_thismodule_139_28_6", __struct_info__d5e64c8c_fields, 2, 8, -1, nullptr, 0xd5e64c8c };
+TypeInfo * __type_info__fe439c05_arg_types_var_1562815940[2] = { &__type_info__221c08f4, &__type_info__e6eb6b88 };
+VarInfo __struct_info__5d26adc4_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__fe439c05_arg_types_var_1562815940, nullptr, 2, 0, nullptr, 28, 0xfe439c05, "__lambda", 0 };
+TypeInfo * __type_info__3d8b623c_arg_types_var_1562815940[1] = { &__type_info__3f83b31c };
+VarInfo __struct_info__5d26adc4_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3d8b623c_arg_types_var_1562815940, nullptr, 1, 0, nullptr, 28, 0x3d8b623c, "__finalize", 4 };
+VarInfo __struct_info__5d26adc4_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x681ea3f3, "__yield", 8 };
+TypeInfo * __type_info__d42d6e5f_arg_types_var_1562815940[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__5d26adc4_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__d42d6e5f_arg_types_var_1562815940, nullptr, 1, 0, nullptr, 0, 0xd42d6e5f, "blk", 16 };
+VarInfo __struct_info__5d26adc4_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x831bc516, "src", 24 };
+VarInfo __struct_info__5d26adc4_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x1c9fd32b, "_loop_at_32", 32 };
+VarInfo __struct_info__5d26adc4_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x74e16e17, "_source_0_at_32", 40 };
+VarInfo __struct_info__5d26adc4_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xd619cc25, "w", 48 };
+VarInfo __struct_info__5d26adc4_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x889a57d3, "_pvar_0_at_32", 72 };
+VarInfo * __struct_info__5d26adc4_fields[9] =  { &__struct_info__5d26adc4_field_0, &__struct_info__5d26adc4_field_1, &__struct_info__5d26adc4_field_2, &__struct_info__5d26adc4_field_3, &__struct_info__5d26adc4_field_4, &__struct_info__5d26adc4_field_5, &__struct_info__5d26adc4_field_6, &__struct_info__5d26adc4_field_7, &__struct_info__5d26adc4_field_8 };
+StructInfo __struct_info__5d26adc4 = {"_lambda_thismodule_32_12_36", __struct_info__5d26adc4_fields, 9, 80, -1, nullptr, 0x5d26adc4 };
+TypeInfo * __type_info__3f4de3f8_arg_types_var_1740990635[2] = { &__type_info__fc05925b, &__type_info__413b3264 };
+VarInfo __struct_info__67c568ab_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__3f4de3f8_arg_types_var_1740990635, nullptr, 2, 0, nullptr, 28, 0x3f4de3f8, "__lambda", 0 };
+TypeInfo * __type_info__b2c3902d_arg_types_var_1740990635[1] = { &__type_info__146e3c83 };
+VarInfo __struct_info__67c568ab_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b2c3902d_arg_types_var_1740990635, nullptr, 1, 0, nullptr, 28, 0xb2c3902d, "__finalize", 4 };
+VarInfo __struct_info__67c568ab_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x199fca8c, "__yield", 8 };
+VarInfo __struct_info__67c568ab_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x561a7cf6, "_loop_at_106", 12 };
+VarInfo __struct_info__67c568ab_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x20fc96db, "x", 16 };
+VarInfo __struct_info__67c568ab_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9e419c8a, "_pvar_0_at_106", 24 };
+VarInfo __struct_info__67c568ab_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xdd306cf6, "_source_0_at_106", 32 };
+VarInfo * __struct_info__67c568ab_fields[7] =  { &__struct_info__67c568ab_field_0, &__struct_info__67c568ab_field_1, &__struct_info__67c568ab_field_2, &__struct_info__67c568ab_field_3, &__struct_info__67c568ab_field_4, &__struct_info__67c568ab_field_5, &__struct_info__67c568ab_field_6 };
+StructInfo __struct_info__67c568ab = {"_lambda_thismodule_106_15_5", __struct_info__67c568ab_fields, 7, 40, -1, nullptr, 0x67c568ab };
+TypeInfo * __type_info__48510269_arg_types_var_974154040[2] = { &__type_info__63564868, &__type_info__260b3481 };
+VarInfo __struct_info__3a106938_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__48510269_arg_types_var_974154040, nullptr, 2, 0, nullptr, 28, 0x48510269, "__lambda", 0 };
+TypeInfo * __type_info__7adbb3e8_arg_types_var_974154040[1] = { &__type_info__ffd30770 };
+VarInfo __struct_info__3a106938_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7adbb3e8_arg_types_var_974154040, nullptr, 1, 0, nullptr, 28, 0x7adbb3e8, "__finalize", 4 };
+VarInfo __struct_info__3a106938_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xda162f0f, "__yield", 8 };
+VarInfo __struct_info__3a106938_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe92787d, "_loop_at_56", 12 };
+VarInfo __struct_info__3a106938_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2a1ceadc, "x", 16 };
+VarInfo __struct_info__3a106938_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x93fb4bcd, "_pvar_0_at_56", 24 };
+VarInfo __struct_info__3a106938_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2c8b21c1, "_source_0_at_56", 32 };
+VarInfo * __struct_info__3a106938_fields[7] =  { &__struct_info__3a106938_field_0, &__struct_info__3a106938_field_1, &__struct_info__3a106938_field_2, &__struct_info__3a106938_field_3, &__struct_info__3a106938_field_4, &__struct_info__3a106938_field_5, &__struct_info__3a106938_field_6 };
+StructInfo __struct_info__3a106938 = {"_lambda_thismodule_56_21_10", __struct_info__3a106938_fields, 7, 40, -1, nullptr, 0x3a106938 };
+TypeInfo * __type_info__a403ff76_arg_types_var_663712045[2] = { &__type_info__d27d2f5d, &__type_info__3c15753 };
+VarInfo __struct_info__278f712d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a403ff76_arg_types_var_663712045, nullptr, 2, 0, nullptr, 28, 0xa403ff76, "__lambda", 0 };
+TypeInfo * __type_info__8c15f483_arg_types_var_663712045[1] = { &__type_info__59047065 };
+VarInfo __struct_info__278f712d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__8c15f483_arg_types_var_663712045, nullptr, 1, 0, nullptr, 28, 0x8c15f483, "__finalize", 4 };
+VarInfo __struct_info__278f712d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x313e8ca2, "__yield", 8 };
+VarInfo __struct_info__278f712d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x283356e3, "_loop_at_235", 12 };
+VarInfo __struct_info__278f712d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x20429929, "x", 16 };
+VarInfo __struct_info__278f712d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x20d20f0b, "_pvar_0_at_235", 24 };
+VarInfo __struct_info__278f712d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x92eac40f, "_source_0_at_235", 32 };
+VarInfo * __struct_info__278f712d_fields[7] =  { &__struct_info__278f712d_field_0, &__struct_info__278f712d_field_1, &__struct_info__278f712d_field_2, &__struct_info__278f712d_field_3, &__struct_info__278f712d_field_4, &__struct_info__278f712d_field_5, &__struct_info__278f712d_field_6 };
+StructInfo __struct_info__278f712d = {"_lambda_thismodule_235_18_9", __struct_info__278f712d_fields, 7, 40, -1, nullptr, 0x278f712d };
+TypeInfo * __type_info__57398f29_arg_types_var_1886478328[2] = { &__type_info__2125f168, &__type_info__6df81eef };
+VarInfo __struct_info__70715ff8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__57398f29_arg_types_var_1886478328, nullptr, 2, 0, nullptr, 28, 0x57398f29, "__lambda", 0 };
+TypeInfo * __type_info__4aaf02a8_arg_types_var_1886478328[1] = { &__type_info__c78cf730 };
+VarInfo __struct_info__70715ff8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4aaf02a8_arg_types_var_1886478328, nullptr, 1, 0, nullptr, 28, 0x4aaf02a8, "__finalize", 4 };
+VarInfo __struct_info__70715ff8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x11f9b1cf, "__yield", 8 };
+TypeInfo * __type_info__6b8731b_arg_types_var_1886478328[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__70715ff8_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__6b8731b_arg_types_var_1886478328, nullptr, 1, 0, nullptr, 0, 0x6b8731b, "blk", 16 };
+VarInfo __struct_info__70715ff8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x31033d6a, "src", 24 };
+VarInfo __struct_info__70715ff8_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x6a2cd6e9, "_loop_at_16", 32 };
+VarInfo __struct_info__70715ff8_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x313cf6f5, "_source_0_at_16", 40 };
+VarInfo __struct_info__70715ff8_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x92bb49a1, "w", 48 };
+VarInfo __struct_info__70715ff8_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xedf445b9, "_pvar_0_at_16", 72 };
+VarInfo * __struct_info__70715ff8_fields[9] =  { &__struct_info__70715ff8_field_0, &__struct_info__70715ff8_field_1, &__struct_info__70715ff8_field_2, &__struct_info__70715ff8_field_3, &__struct_info__70715ff8_field_4, &__struct_info__70715ff8_field_5, &__struct_info__70715ff8_field_6, &__struct_info__70715ff8_field_7, &__struct_info__70715ff8_field_8 };
+StructInfo __struct_info__70715ff8 = {"_lambda_thismodule_16_12_30", __struct_info__70715ff8_fields, 9, 80, -1, nullptr, 0x70715ff8 };
+TypeInfo * __type_info__c191eb54_arg_types_var_524346455[2] = { &__type_info__83837c47, &__type_info__8bc49635 };
+VarInfo __struct_info__1f40e457_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__c191eb54_arg_types_var_524346455, nullptr, 2, 0, nullptr, 28, 0xc191eb54, "__lambda", 0 };
+TypeInfo * __type_info__3d8ea661_arg_types_var_524346455[1] = { &__type_info__95bfb40f };
+VarInfo __struct_info__1f40e457_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3d8ea661_arg_types_var_524346455, nullptr, 1, 0, nullptr, 28, 0x3d8ea661, "__finalize", 4 };
+VarInfo __struct_info__1f40e457_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4fee58d0, "__yield", 8 };
+VarInfo __struct_info__1f40e457_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xe20fb039, "src", 16 };
+VarInfo __struct_info__1f40e457_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf5b77948, "arr", 24 };
+VarInfo __struct_info__1f40e457_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa78990b, "___loop_at_131_rename_at_131", 48 };
+VarInfo __struct_info__1f40e457_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2ea98970, "__x_rename_at_131", 56 };
+VarInfo __struct_info__1f40e457_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x331a6983, "___pvar_0_at_131_rename_at_131", 64 };
+VarInfo __struct_info__1f40e457_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x435c1dcb, "_loop_at_127", 72 };
+VarInfo __struct_info__1f40e457_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x9c883573, "_source_0_at_127", 80 };
+TypeInfo * __type_info__5d23a4d7_arg_types_var_524346455[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __struct_info__1f40e457_field_10 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__5d23a4d7_arg_types_var_524346455, nullptr, 2, 0, nullptr, 30, 0x5d23a4d7, "x", 88 };
+VarInfo __struct_info__1f40e457_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x48bf5547, "_pvar_0_at_127", 96 };
+VarInfo __struct_info__1f40e457_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__430d762d, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xe610b9df, "___source_0_at_131_rename_at_131", 104 };
+VarInfo * __struct_info__1f40e457_fields[13] =  { &__struct_info__1f40e457_field_0, &__struct_info__1f40e457_field_1, &__struct_info__1f40e457_field_2, &__struct_info__1f40e457_field_3, &__struct_info__1f40e457_field_4, &__struct_info__1f40e457_field_5, &__struct_info__1f40e457_field_6, &__struct_info__1f40e457_field_7, &__struct_info__1f40e457_field_8, &__struct_info__1f40e457_field_9, &__struct_info__1f40e457_field_10, &__struct_info__1f40e457_field_11, &__struct_info__1f40e457_field_12 };
+StructInfo __struct_info__1f40e457 = {"_lambda_thismodule_126_12_28", __struct_info__1f40e457_fields, 13, 112, -1, nullptr, 0x1f40e457 };
+TypeInfo * __type_info__853d286a_arg_types_var_1596518273[2] = { &__type_info__241e4ab1, &__type_info__3c15753 };
+VarInfo __struct_info__5f28ef81_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__853d286a_arg_types_var_1596518273, nullptr, 2, 0, nullptr, 28, 0x853d286a, "__lambda", 0 };
+TypeInfo * __type_info__30b1747f_arg_types_var_1596518273[1] = { &__type_info__4185f4d9 };
+VarInfo __struct_info__5f28ef81_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__30b1747f_arg_types_var_1596518273, nullptr, 1, 0, nullptr, 28, 0x30b1747f, "__finalize", 4 };
+VarInfo __struct_info__5f28ef81_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb2cc722e, "__yield", 8 };
+TypeInfo * __type_info__3eae7296_arg_types_var_1596518273[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__5f28ef81_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, (TypeInfo **)__type_info__3eae7296_arg_types_var_1596518273, nullptr, 1, 0, nullptr, 0, 0x3eae7296, "blk", 16 };
+VarInfo __struct_info__5f28ef81_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xce3575b, "src", 24 };
+VarInfo __struct_info__5f28ef81_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb6cb4b46, "_loop_at_32", 32 };
+VarInfo __struct_info__5f28ef81_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x9b48842a, "_source_0_at_32", 40 };
+VarInfo __struct_info__5f28ef81_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc4fc5b60, "w", 48 };
+VarInfo __struct_info__5f28ef81_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa0b73046, "_pvar_0_at_32", 56 };
+VarInfo * __struct_info__5f28ef81_fields[9] =  { &__struct_info__5f28ef81_field_0, &__struct_info__5f28ef81_field_1, &__struct_info__5f28ef81_field_2, &__struct_info__5f28ef81_field_3, &__struct_info__5f28ef81_field_4, &__struct_info__5f28ef81_field_5, &__struct_info__5f28ef81_field_6, &__struct_info__5f28ef81_field_7, &__struct_info__5f28ef81_field_8 };
+StructInfo __struct_info__5f28ef81 = {"_lambda_thismodule_32_12_26", __struct_info__5f28ef81_fields, 9, 64, -1, nullptr, 0x5f28ef81 };
+TypeInfo * __type_info__cb124f1_arg_types_var_2562076272[2] = { &__type_info__e09ef0a0, &__type_info__359c1b32 };
+VarInfo __struct_info__98b62e70_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__cb124f1_arg_types_var_2562076272, nullptr, 2, 0, nullptr, 28, 0xcb124f1, "__lambda", 0 };
+TypeInfo * __type_info__ec160f60_arg_types_var_2562076272[1] = { &__type_info__cbd13238 };
+VarInfo __struct_info__98b62e70_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ec160f60_arg_types_var_2562076272, nullptr, 1, 0, nullptr, 28, 0xec160f60, "__finalize", 4 };
+VarInfo * __struct_info__98b62e70_fields[2] =  { &__struct_info__98b62e70_field_0, &__struct_info__98b62e70_field_1 };
+StructInfo __struct_info__98b62e70 = {"_lambda_thismodule_172_30_17", __struct_info__98b62e70_fields, 2, 8, -1, nullptr, 0x98b62e70 };
+TypeInfo * __type_info__cd947b07_arg_types_var_1646851130[2] = { &__type_info__271e4f6a, &__type_info__e6eb6b88 };
+VarInfo __struct_info__6228f43a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__cd947b07_arg_types_var_1646851130, nullptr, 2, 0, nullptr, 28, 0xcd947b07, "__lambda", 0 };
+TypeInfo * __type_info__dc031ee_arg_types_var_1646851130[1] = { &__type_info__4485f992 };
+VarInfo __struct_info__6228f43a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__dc031ee_arg_types_var_1646851130, nullptr, 1, 0, nullptr, 28, 0xdc031ee, "__finalize", 4 };
+VarInfo __struct_info__6228f43a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa0dfc4f5, "__yield", 8 };
+TypeInfo * __type_info__77d12f49_arg_types_var_1646851130[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__6228f43a_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__77d12f49_arg_types_var_1646851130, nullptr, 1, 0, nullptr, 28, 0x77d12f49, "blk", 12 };
+VarInfo __struct_info__6228f43a_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa1ff7784, "src", 16 };
+VarInfo __struct_info__6228f43a_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb13cf481, "_loop_at_32", 24 };
+VarInfo __struct_info__6228f43a_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb17be4f1, "_source_0_at_32", 32 };
+VarInfo __struct_info__6228f43a_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf36fb09b, "w", 40 };
+VarInfo __struct_info__6228f43a_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x88e08a0d, "_pvar_0_at_32", 48 };
+VarInfo * __struct_info__6228f43a_fields[9] =  { &__struct_info__6228f43a_field_0, &__struct_info__6228f43a_field_1, &__struct_info__6228f43a_field_2, &__struct_info__6228f43a_field_3, &__struct_info__6228f43a_field_4, &__struct_info__6228f43a_field_5, &__struct_info__6228f43a_field_6, &__struct_info__6228f43a_field_7, &__struct_info__6228f43a_field_8 };
+StructInfo __struct_info__6228f43a = {"_lambda_thismodule_32_12_23", __struct_info__6228f43a_fields, 9, 56, -1, nullptr, 0x6228f43a };
+TypeInfo * __type_info__d5f6b217_arg_types_var_4167240426[2] = { &__type_info__8dc06b9a, &__type_info__f1b9498d };
+VarInfo __struct_info__f8630aea_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__d5f6b217_arg_types_var_4167240426, nullptr, 2, 0, nullptr, 28, 0xd5f6b217, "__lambda", 0 };
+TypeInfo * __type_info__9f6a71de_arg_types_var_4167240426[1] = { &__type_info__ee787d42 };
+VarInfo __struct_info__f8630aea_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__9f6a71de_arg_types_var_4167240426, nullptr, 1, 0, nullptr, 28, 0x9f6a71de, "__finalize", 4 };
+VarInfo * __struct_info__f8630aea_fields[2] =  { &__struct_info__f8630aea_field_0, &__struct_info__f8630aea_field_1 };
+StructInfo __struct_info__f8630aea = {"_lambda_thismodule_93_29_35", __struct_info__f8630aea_fields, 2, 8, -1, nullptr, 0xf8630aea };
+TypeInfo * __type_info__eb06b486_arg_types_var_2490090397[2] = { &__type_info__8667970d, &__type_info__260b3481 };
+VarInfo __struct_info__946bc39d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__eb06b486_arg_types_var_2490090397, nullptr, 2, 0, nullptr, 28, 0xeb06b486, "__lambda", 0 };
+TypeInfo * __type_info__78bbc473_arg_types_var_2490090397[1] = { &__type_info__1dd0b915 };
+VarInfo __struct_info__946bc39d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__78bbc473_arg_types_var_2490090397, nullptr, 1, 0, nullptr, 28, 0x78bbc473, "__finalize", 4 };
+VarInfo __struct_info__946bc39d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa7fe9772, "__yield", 8 };
+TypeInfo * __type_info__efe5261a_arg_types_var_2490090397[1] = { &__type_info__f1b9498d };
+VarInfo __struct_info__946bc39d_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, (TypeInfo **)__type_info__efe5261a_arg_types_var_2490090397, nullptr, 1, 0, nullptr, 0, 0xefe5261a, "blk", 16 };
+VarInfo __struct_info__946bc39d_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xbb3dfb47, "src", 24 };
+VarInfo __struct_info__946bc39d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x93467b1, "_loop_at_37", 32 };
+VarInfo __struct_info__946bc39d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6c914b27, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x9490c965, "_source_0_at_37", 40 };
+VarInfo __struct_info__946bc39d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x96bbc324, "w", 48 };
+VarInfo __struct_info__946bc39d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe0180d89, "_pvar_0_at_37", 56 };
+VarInfo * __struct_info__946bc39d_fields[9] =  { &__struct_info__946bc39d_field_0, &__struct_info__946bc39d_field_1, &__struct_info__946bc39d_field_2, &__struct_info__946bc39d_field_3, &__struct_info__946bc39d_field_4, &__struct_info__946bc39d_field_5, &__struct_info__946bc39d_field_6, &__struct_info__946bc39d_field_7, &__struct_info__946bc39d_field_8 };
+StructInfo __struct_info__946bc39d = {"_lambda_thismodule_37_12_34", __struct_info__946bc39d_fields, 9, 64, -1, nullptr, 0x946bc39d };
+TypeInfo * __type_info__dee3bd19_arg_types_var_1546185416[2] = { &__type_info__211e45f8, &__type_info__e6eb6b88 };
+VarInfo __struct_info__5c28eac8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__dee3bd19_arg_types_var_1546185416, nullptr, 2, 0, nullptr, 28, 0xdee3bd19, "__lambda", 0 };
+TypeInfo * __type_info__ce1ea478_arg_types_var_1546185416[1] = { &__type_info__3e85f020 };
+VarInfo __struct_info__5c28eac8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ce1ea478_arg_types_var_1546185416, nullptr, 1, 0, nullptr, 28, 0xce1ea478, "__finalize", 4 };
+VarInfo __struct_info__5c28eac8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc1e30fff, "__yield", 8 };
+TypeInfo * __type_info__47ac872b_arg_types_var_1546185416[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__5c28eac8_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__47ac872b_arg_types_var_1546185416, nullptr, 1, 0, nullptr, 0, 0x47ac872b, "blk", 16 };
+VarInfo __struct_info__5c28eac8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x16ae97fa, "src", 24 };
+VarInfo __struct_info__5c28eac8_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x1aa244e7, "_loop_at_32", 32 };
+VarInfo __struct_info__5c28eac8_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x909be9db, "_source_0_at_32", 40 };
+VarInfo __struct_info__5c28eac8_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x7e91b651, "w", 48 };
+VarInfo __struct_info__5c28eac8_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfd0d70b7, "_pvar_0_at_32", 56 };
+VarInfo * __struct_info__5c28eac8_fields[9] =  { &__struct_info__5c28eac8_field_0, &__struct_info__5c28eac8_field_1, &__struct_info__5c28eac8_field_2, &__struct_info__5c28eac8_field_3, &__struct_info__5c28eac8_field_4, &__struct_info__5c28eac8_field_5, &__struct_info__5c28eac8_field_6, &__struct_info__5c28eac8_field_7, &__struct_info__5c28eac8_field_8 };
+StructInfo __struct_info__5c28eac8 = {"_lambda_thismodule_32_12_25", __struct_info__5c28eac8_fields, 9, 64, -1, nullptr, 0x5c28eac8 };
+TypeInfo * __type_info__43f5bfed_arg_types_var_527738108[2] = { &__type_info__fc8e246c, &__type_info__f1b9498d };
+VarInfo __struct_info__1f74a4fc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, (TypeInfo **)__type_info__43f5bfed_arg_types_var_527738108, nullptr, 2, 0, nullptr, 28, 0x43f5bfed, "__lambda", 0 };
+TypeInfo * __type_info__fb770a54_arg_types_var_527738108[1] = { &__type_info__479b2884 };
+VarInfo __struct_info__1f74a4fc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__fb770a54_arg_types_var_527738108, nullptr, 1, 0, nullptr, 28, 0xfb770a54, "__finalize", 4 };
+VarInfo * __struct_info__1f74a4fc_fields[2] =  { &__struct_info__1f74a4fc_field_0, &__struct_info__1f74a4fc_field_1 };
+StructInfo __struct_info__1f74a4fc = {"_lambda_thismodule_92_36_32", __struct_info__1f74a4fc_fields, 2, 8, -1, nullptr, 0x1f74a4fc };
+TypeInfo * __type_info__2564fdb8_arg_types_var_2041999467[2] = { &__type_info__cf91711b, &__type_info__260b3481 };
+VarInfo __struct_info__79b6706b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2564fdb8_arg_types_var_2041999467, nullptr, 2, 0, nullptr, 28, 0x2564fdb8, "__lambda", 0 };
+TypeInfo * __type_info__64201aed_arg_types_var_2041999467[1] = { &__type_info__575c1f43 };
+VarInfo __struct_info__79b6706b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__64201aed_arg_types_var_2041999467, nullptr, 1, 0, nullptr, 28, 0x64201aed, "__finalize", 4 };
+VarInfo __struct_info__79b6706b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xfaf7654c, "__yield", 8 };
+VarInfo __struct_info__79b6706b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe2a602c0, "_loop_at_243", 12 };
+VarInfo __struct_info__79b6706b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3545119b, "x", 16 };
+VarInfo __struct_info__79b6706b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x19f851a4, "_pvar_0_at_243", 24 };
+VarInfo __struct_info__79b6706b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc6919440, "_source_0_at_243", 32 };
+VarInfo * __struct_info__79b6706b_fields[7] =  { &__struct_info__79b6706b_field_0, &__struct_info__79b6706b_field_1, &__struct_info__79b6706b_field_2, &__struct_info__79b6706b_field_3, &__struct_info__79b6706b_field_4, &__struct_info__79b6706b_field_5, &__struct_info__79b6706b_field_6 };
+StructInfo __struct_info__79b6706b = {"_lambda_thismodule_243_18_13", __struct_info__79b6706b_fields, 7, 40, -1, nullptr, 0x79b6706b };
+TypeInfo * __type_info__7d229efa_arg_types_var_2763894257[2] = { &__type_info__636e62a1, &__type_info__3c15753 };
+VarInfo __struct_info__a4bdadf1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__7d229efa_arg_types_var_2763894257, nullptr, 2, 0, nullptr, 28, 0x7d229efa, "__lambda", 0 };
+TypeInfo * __type_info__932f3a6f_arg_types_var_2763894257[1] = { &__type_info__70b9d639 };
+VarInfo __struct_info__a4bdadf1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__932f3a6f_arg_types_var_2763894257, nullptr, 1, 0, nullptr, 28, 0x932f3a6f, "__finalize", 4 };
+VarInfo __struct_info__a4bdadf1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xee29c2be, "__yield", 8 };
+VarInfo __struct_info__a4bdadf1_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x5c6dc5f6, "_loop_at_232", 12 };
+VarInfo __struct_info__a4bdadf1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x6db5678d, "x", 16 };
+VarInfo __struct_info__a4bdadf1_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x16c7d036, "_pvar_0_at_232", 24 };
+VarInfo __struct_info__a4bdadf1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x870881e2, "_source_0_at_232", 32 };
+VarInfo * __struct_info__a4bdadf1_fields[7] =  { &__struct_info__a4bdadf1_field_0, &__struct_info__a4bdadf1_field_1, &__struct_info__a4bdadf1_field_2, &__struct_info__a4bdadf1_field_3, &__struct_info__a4bdadf1_field_4, &__struct_info__a4bdadf1_field_5, &__struct_info__a4bdadf1_field_6 };
+StructInfo __struct_info__a4bdadf1 = {"_lambda_thismodule_232_10_8", __struct_info__a4bdadf1_fields, 7, 40, -1, nullptr, 0xa4bdadf1 };
+TypeInfo * __type_info__ff42c70_arg_types_var_272497171[2] = { &__type_info__3770203, &__type_info__e6eb6b88 };
+VarInfo __struct_info__103dfa13_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__ff42c70_arg_types_var_272497171, nullptr, 2, 0, nullptr, 28, 0xff42c70, "__lambda", 0 };
+TypeInfo * __type_info__935e5615_arg_types_var_272497171[1] = { &__type_info__35919c2b };
+VarInfo __struct_info__103dfa13_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__935e5615_arg_types_var_272497171, nullptr, 1, 0, nullptr, 28, 0x935e5615, "__finalize", 4 };
+VarInfo __struct_info__103dfa13_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd7e6b44, "__yield", 8 };
+TypeInfo * __type_info__7640a3b4_arg_types_var_272497171[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__103dfa13_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__7640a3b4_arg_types_var_272497171, nullptr, 1, 0, nullptr, 28, 0x7640a3b4, "blk", 12 };
+VarInfo __struct_info__103dfa13_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x12056145, "src", 16 };
+VarInfo __struct_info__103dfa13_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb8e9e50c, "_loop_at_10", 24 };
+VarInfo __struct_info__103dfa13_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc8b624bc, "_source_0_at_10", 32 };
+VarInfo __struct_info__103dfa13_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x72e9e18a, "w", 40 };
+VarInfo __struct_info__103dfa13_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x841c9440, "_pvar_0_at_10", 48 };
+VarInfo * __struct_info__103dfa13_fields[9] =  { &__struct_info__103dfa13_field_0, &__struct_info__103dfa13_field_1, &__struct_info__103dfa13_field_2, &__struct_info__103dfa13_field_3, &__struct_info__103dfa13_field_4, &__struct_info__103dfa13_field_5, &__struct_info__103dfa13_field_6, &__struct_info__103dfa13_field_7, &__struct_info__103dfa13_field_8 };
+StructInfo __struct_info__103dfa13 = {"_lambda_thismodule_10_12_20", __struct_info__103dfa13_fields, 9, 56, -1, nullptr, 0x103dfa13 };
+TypeInfo * __type_info__872a3061_arg_types_var_255719552[2] = { &__type_info__2770070, &__type_info__e6eb6b88 };
+VarInfo __struct_info__f3df880_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__872a3061_arg_types_var_255719552, nullptr, 2, 0, nullptr, 28, 0x872a3061, "__lambda", 0 };
+TypeInfo * __type_info__16020bf0_arg_types_var_255719552[1] = { &__type_info__34919a98 };
+VarInfo __struct_info__f3df880_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__16020bf0_arg_types_var_255719552, nullptr, 1, 0, nullptr, 28, 0x16020bf0, "__finalize", 4 };
+VarInfo __struct_info__f3df880_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xdb9d94e7, "__yield", 8 };
+TypeInfo * __type_info__aa0456c3_arg_types_var_255719552[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__f3df880_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__aa0456c3_arg_types_var_255719552, nullptr, 1, 0, nullptr, 0, 0xaa0456c3, "blk", 16 };
+VarInfo __struct_info__f3df880_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xc3d9d992, "src", 24 };
+VarInfo __struct_info__f3df880_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x670c3a57, "_loop_at_10", 32 };
+VarInfo __struct_info__f3df880_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa5cc5b9b, "_source_0_at_10", 40 };
+VarInfo __struct_info__f3df880_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa47ba229, "w", 48 };
+VarInfo __struct_info__f3df880_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfb2c2a7, "_pvar_0_at_10", 56 };
+VarInfo * __struct_info__f3df880_fields[9] =  { &__struct_info__f3df880_field_0, &__struct_info__f3df880_field_1, &__struct_info__f3df880_field_2, &__struct_info__f3df880_field_3, &__struct_info__f3df880_field_4, &__struct_info__f3df880_field_5, &__struct_info__f3df880_field_6, &__struct_info__f3df880_field_7, &__struct_info__f3df880_field_8 };
+StructInfo __struct_info__f3df880 = {"_lambda_thismodule_10_12_21", __struct_info__f3df880_fields, 9, 64, -1, nullptr, 0xf3df880 };
+TypeInfo * __type_info__4ae21488_arg_types_var_1562963035[2] = { &__type_info__221e478b, &__type_info__ac13bbb3 };
+VarInfo __struct_info__5d28ec5b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__4ae21488_arg_types_var_1562963035, nullptr, 2, 0, nullptr, 28, 0x4ae21488, "__lambda", 0 };
+TypeInfo * __type_info__a45b0bdd_arg_types_var_1562963035[1] = { &__type_info__3f85f1b3 };
+VarInfo __struct_info__5d28ec5b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a45b0bdd_arg_types_var_1562963035, nullptr, 1, 0, nullptr, 28, 0xa45b0bdd, "__finalize", 4 };
+VarInfo __struct_info__5d28ec5b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb40d649c, "__yield", 8 };
+TypeInfo * __type_info__39ba19c_arg_types_var_1562963035[1] = { &__type_info__359c1b32 };
+VarInfo __struct_info__5d28ec5b_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__c894953d, nullptr, (TypeInfo **)__type_info__39ba19c_arg_types_var_1562963035, nullptr, 1, 0, nullptr, 0, 0x39ba19c, "blk", 16 };
+VarInfo __struct_info__5d28ec5b_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xcf38084d, "src", 24 };
+VarInfo __struct_info__5d28ec5b_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf12007a0, "_loop_at_32", 32 };
+VarInfo __struct_info__5d28ec5b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x41d45720, "_source_0_at_32", 40 };
+VarInfo __struct_info__5d28ec5b_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa1646d32, "w", 48 };
+VarInfo __struct_info__5d28ec5b_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x750c96f4, "_pvar_0_at_32", 56 };
+VarInfo * __struct_info__5d28ec5b_fields[9] =  { &__struct_info__5d28ec5b_field_0, &__struct_info__5d28ec5b_field_1, &__struct_info__5d28ec5b_field_2, &__struct_info__5d28ec5b_field_3, &__struct_info__5d28ec5b_field_4, &__struct_info__5d28ec5b_field_5, &__struct_info__5d28ec5b_field_6, &__struct_info__5d28ec5b_field_7, &__struct_info__5d28ec5b_field_8 };
+StructInfo __struct_info__5d28ec5b = {"_lambda_thismodule_32_12_24", __struct_info__5d28ec5b_fields, 9, 64, -1, nullptr, 0x5d28ec5b };
+TypeInfo * __type_info__4056a5c4_arg_types_var_1898599463[2] = { &__type_info__df321397, &__type_info__413b3264 };
+VarInfo __struct_info__712a5427_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__4056a5c4_arg_types_var_1898599463, nullptr, 2, 0, nullptr, 28, 0x4056a5c4, "__lambda", 0 };
+TypeInfo * __type_info__3c948071_arg_types_var_1898599463[1] = { &__type_info__564b8c0f };
+VarInfo __struct_info__712a5427_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3c948071_arg_types_var_1898599463, nullptr, 1, 0, nullptr, 28, 0x3c948071, "__finalize", 4 };
+VarInfo __struct_info__712a5427_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe7146240, "__yield", 8 };
+VarInfo __struct_info__712a5427_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x8ff18fac, "_loop_at_50", 12 };
+VarInfo __struct_info__712a5427_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbb1b1947, "x", 16 };
+VarInfo __struct_info__712a5427_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3a849630, "_pvar_0_at_50", 24 };
+VarInfo __struct_info__712a5427_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x1b8cb484, "_source_0_at_50", 32 };
+VarInfo * __struct_info__712a5427_fields[7] =  { &__struct_info__712a5427_field_0, &__struct_info__712a5427_field_1, &__struct_info__712a5427_field_2, &__struct_info__712a5427_field_3, &__struct_info__712a5427_field_4, &__struct_info__712a5427_field_5, &__struct_info__712a5427_field_6 };
+StructInfo __struct_info__712a5427 = {"_lambda_thismodule_50_23_4", __struct_info__712a5427_fields, 7, 40, -1, nullptr, 0x712a5427 };
+TypeInfo * __type_info__efb962c2_arg_types_var_1504888009[2] = { &__type_info__68dcf3f9, &__type_info__e6eb6b88 };
+VarInfo __struct_info__59b2c4c9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__efb962c2_arg_types_var_1504888009, nullptr, 2, 0, nullptr, 28, 0xefb962c2, "__lambda", 0 };
+TypeInfo * __type_info__5a826047_arg_types_var_1504888009[1] = { &__type_info__4ffe7951 };
+VarInfo __struct_info__59b2c4c9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__5a826047_arg_types_var_1504888009, nullptr, 1, 0, nullptr, 28, 0x5a826047, "__finalize", 4 };
+VarInfo __struct_info__59b2c4c9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf81a6d46, "__yield", 8 };
+VarInfo __struct_info__59b2c4c9_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x820ab5a3, "src", 16 };
+VarInfo __struct_info__59b2c4c9_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9a12b2c5, "start", 24 };
+VarInfo __struct_info__59b2c4c9_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xffd4617, "stop", 28 };
+VarInfo __struct_info__59b2c4c9_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd489fd7a, "_loop_at_140", 32 };
+VarInfo __struct_info__59b2c4c9_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xb2b28d3e, "_source_0_at_140", 40 };
+VarInfo __struct_info__59b2c4c9_field_8 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe9c30675, "x", 48 };
+VarInfo __struct_info__59b2c4c9_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x52e3fd1a, "_pvar_0_at_140", 56 };
+VarInfo __struct_info__59b2c4c9_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd8c2ebb2, "i", 64 };
+VarInfo __struct_info__59b2c4c9_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x297ac64f, "_pvar_1_at_140", 72 };
+VarInfo __struct_info__59b2c4c9_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xf0ff6373, "_source_1_at_140", 80 };
+VarInfo * __struct_info__59b2c4c9_fields[13] =  { &__struct_info__59b2c4c9_field_0, &__struct_info__59b2c4c9_field_1, &__struct_info__59b2c4c9_field_2, &__struct_info__59b2c4c9_field_3, &__struct_info__59b2c4c9_field_4, &__struct_info__59b2c4c9_field_5, &__struct_info__59b2c4c9_field_6, &__struct_info__59b2c4c9_field_7, &__struct_info__59b2c4c9_field_8, &__struct_info__59b2c4c9_field_9, &__struct_info__59b2c4c9_field_10, &__struct_info__59b2c4c9_field_11, &__struct_info__59b2c4c9_field_12 };
+StructInfo __struct_info__59b2c4c9 = {"_lambda_thismodule_140_12_22", __struct_info__59b2c4c9_fields, 13, 88, -1, nullptr, 0x59b2c4c9 };
+VarInfo __func_info__2e807d1c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xce6336d2, "x", 0 };
+VarInfo __func_info__2e807d1c_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x393cbc39, "y", 0 };
+VarInfo * __func_info__2e807d1c_fields[2] =  { &__func_info__2e807d1c_field_0, &__func_info__2e807d1c_field_1 };
+FuncInfo __func_info__2e807d1c = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__2e807d1c_fields, 2, 32, &__type_info__359c1b32, nullptr,0,0x2e807d1c, 0x0 };
+TypeInfo * __type_info__23412d03_arg_types_var_1447434019[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __func_info__56461723_field_0 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__23412d03_arg_types_var_1447434019, nullptr, 2, 0, nullptr, 62, 0x23412d03, "x", 0 };
+TypeInfo * __type_info__2efc05a_arg_types_var_1447434019[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+VarInfo __func_info__56461723_field_1 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__2efc05a_arg_types_var_1447434019, nullptr, 2, 0, nullptr, 62, 0x2efc05a, "y", 0 };
+VarInfo * __func_info__56461723_fields[2] =  { &__func_info__56461723_field_0, &__func_info__56461723_field_1 };
+FuncInfo __func_info__56461723 = {"invoke block<(x:tuple<int;float> const;y:tuple<int;float> const):tuple<int;float> const> const", "", __func_info__56461723_fields, 2, 32, &__type_info__58ba7e63, nullptr,0,0x56461723, 0x0 };
+TypeInfo __type_info__d238d5a8 = { Type::tStructure, &__struct_info__44989078, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xd238d5a8 };
+TypeInfo __type_info__6c914b27 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 258, 0x6c914b27 };
+TypeInfo __type_info__c78cf730 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2125f168, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc78cf730 };
+TypeInfo __type_info__d27d2f5d = { Type::tStructure, &__struct_info__278f712d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xd27d2f5d };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__83837c47 = { Type::tStructure, &__struct_info__1f40e457, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x83837c47 };
+TypeInfo __type_info__564b8c0f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__df321397, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x564b8c0f };
+TypeInfo __type_info__3f85f1b3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__221e478b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3f85f1b3 };
+TypeInfo __type_info__f96efa8d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__76b9d575, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf96efa8d };
+TypeInfo __type_info__fdce115e = { Type::tStructure, &__struct_info__786994ee, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfdce115e };
+TypeInfo __type_info__45839f1 = { Type::tStructure, &__struct_info__b79e1c01, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x45839f1 };
+TypeInfo __type_info__fc05925b = { Type::tStructure, &__struct_info__67c568ab, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xfc05925b };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__ee787d42 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8dc06b9a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xee787d42 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__575f76e9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__45839f1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x575f76e9 };
+TypeInfo __type_info__4ffe7951 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__68dcf3f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4ffe7951 };
+TypeInfo __type_info__b57008b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__34f42543, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb57008b };
+TypeInfo __type_info__4485f992 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__271e4f6a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4485f992 };
+TypeInfo __type_info__4dd0dc66 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fdce115e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4dd0dc66 };
+TypeInfo __type_info__146e3c83 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc05925b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x146e3c83 };
+TypeInfo __type_info__241e4ab1 = { Type::tStructure, &__struct_info__5f28ef81, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x241e4ab1 };
+TypeInfo __type_info__221e478b = { Type::tStructure, &__struct_info__5d28ec5b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x221e478b };
+TypeInfo __type_info__82837ab4 = { Type::tStructure, &__struct_info__1e40e2c4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x82837ab4 };
+TypeInfo * __type_info__3c15753_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__3c15753 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__3c15753_arg_types, nullptr, 2, 0, nullptr, 30, 0x3c15753 };
+TypeInfo __type_info__df321397 = { Type::tStructure, &__struct_info__712a5427, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xdf321397 };
+TypeInfo __type_info__34919a98 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2770070, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x34919a98 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__636e62a1 = { Type::tStructure, &__struct_info__a4bdadf1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x636e62a1 };
+TypeInfo __type_info__3e85f020 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__211e45f8, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3e85f020 };
+TypeInfo __type_info__211e45f8 = { Type::tStructure, &__struct_info__5c28eac8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x211e45f8 };
+TypeInfo __type_info__59047065 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d27d2f5d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x59047065 };
+TypeInfo __type_info__37f8377d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3bc97285, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x37f8377d };
+TypeInfo __type_info__f1b9498d = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf1b9498d };
+TypeInfo __type_info__3770203 = { Type::tStructure, &__struct_info__103dfa13, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x3770203 };
+TypeInfo __type_info__271e4f6a = { Type::tStructure, &__struct_info__6228f43a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x271e4f6a };
+TypeInfo __type_info__8dc06b9a = { Type::tStructure, &__struct_info__f8630aea, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x8dc06b9a };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xe6eb6b88 };
+TypeInfo __type_info__1983f0e3 = { Type::tStructure, &__struct_info__2c66e33, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x1983f0e3 };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__479b2884 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fc8e246c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x479b2884 };
+TypeInfo __type_info__4185f4d9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__241e4ab1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4185f4d9 };
+TypeInfo __type_info__63564868 = { Type::tStructure, &__struct_info__3a106938, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x63564868 };
+TypeInfo __type_info__e2f9d5e9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__20085471, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe2f9d5e9 };
+TypeInfo __type_info__413b3264 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__359c1b32, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x413b3264 };
+TypeInfo __type_info__76b9d575 = { Type::tStructure, &__struct_info__9feadc05, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x76b9d575 };
+TypeInfo __type_info__1e08514b = { Type::tStructure, &__struct_info__586f669b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x1e08514b };
+TypeInfo __type_info__68dcf3f9 = { Type::tStructure, &__struct_info__59b2c4c9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x68dcf3f9 };
+TypeInfo __type_info__95bfb40f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__83837c47, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x95bfb40f };
+TypeInfo __type_info__1dd0b915 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8667970d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1dd0b915 };
+TypeInfo __type_info__cf91711b = { Type::tStructure, &__struct_info__79b6706b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xcf91711b };
+TypeInfo __type_info__f9c3b13b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4f1f8183, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf9c3b13b };
+TypeInfo __type_info__2770070 = { Type::tStructure, &__struct_info__f3df880, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2770070 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__4f1f8183 = { Type::tStructure, &__struct_info__f5ea5153, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x4f1f8183 };
+TypeInfo __type_info__ac13bbb3 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xac13bbb3 };
+TypeInfo __type_info__94bfb27c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__82837ab4, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x94bfb27c };
+TypeInfo __type_info__8bc49635 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c15753, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x8bc49635 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+TypeInfo __type_info__35919c2b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3770203, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x35919c2b };
+TypeInfo __type_info__8ba02c02 = { Type::tStructure, &__struct_info__53c86212, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8ba02c02 };
+TypeInfo __type_info__20085471 = { Type::tStructure, &__struct_info__5a6f69c1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x20085471 };
+TypeInfo __type_info__f8d2f36a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8ba02c02, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf8d2f36a };
+TypeInfo __type_info__34f42543 = { Type::tStructure, &__struct_info__531ce5d3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x34f42543 };
+TypeInfo __type_info__a969907c = { Type::tStructure, &__struct_info__d5e64c8c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xa969907c };
+TypeInfo __type_info__82115e6d = { Type::tStructure, &__struct_info__3a289c3d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x82115e6d };
+TypeInfo __type_info__3f83b31c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__221c08f4, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3f83b31c };
+TypeInfo __type_info__2125f168 = { Type::tStructure, &__struct_info__70715ff8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x2125f168 };
+TypeInfo * __type_info__58ba7e63_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__58ba7e63 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__58ba7e63_arg_types, nullptr, 2, 0, nullptr, 62, 0x58ba7e63 };
+TypeInfo __type_info__e0f9d2c3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1e08514b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe0f9d2c3 };
+TypeInfo * __type_info__430d762d_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+TypeInfo __type_info__430d762d = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__430d762d_arg_types, nullptr, 2, 0, nullptr, 286, 0x430d762d };
+TypeInfo __type_info__e5bb2fbb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1983f0e3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe5bb2fbb };
+TypeInfo __type_info__34ea7395 = { Type::tStructure, &__struct_info__e2118965, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x34ea7395 };
+TypeInfo __type_info__e09ef0a0 = { Type::tStructure, &__struct_info__98b62e70, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xe09ef0a0 };
+TypeInfo __type_info__cd314265 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__82115e6d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcd314265 };
+TypeInfo __type_info__ffd30770 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__63564868, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xffd30770 };
+TypeInfo __type_info__8eef2917 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3a36734f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8eef2917 };
+TypeInfo __type_info__8f9c436d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__34ea7395, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8f9c436d };
+TypeInfo __type_info__575c1f43 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cf91711b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x575c1f43 };
+TypeInfo __type_info__3a36734f = { Type::tStructure, &__struct_info__3478951f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x3a36734f };
+TypeInfo __type_info__3bc97285 = { Type::tStructure, &__struct_info__4b8ba355, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x3bc97285 };
+TypeInfo __type_info__6df81eef = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x6df81eef };
+TypeInfo __type_info__9b0d4e04 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a969907c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9b0d4e04 };
+TypeInfo __type_info__8667970d = { Type::tStructure, &__struct_info__946bc39d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x8667970d };
+TypeInfo __type_info__fc8e246c = { Type::tStructure, &__struct_info__1f74a4fc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfc8e246c };
+TypeInfo __type_info__cb86e0e0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d238d5a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcb86e0e0 };
+TypeInfo __type_info__cbd13238 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e09ef0a0, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcbd13238 };
+TypeInfo __type_info__221c08f4 = { Type::tStructure, &__struct_info__5d26adc4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x221c08f4 };
+TypeInfo __type_info__70b9d639 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__636e62a1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70b9d639 };
+
+namespace  {
+
+struct _lambda_thismodule_85_28_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_85_28_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_85_28_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_85_28_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_155_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_155_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_155_8_2 *)) __finalize;
+	int32_t start;
+	int32_t step;
+};
+static_assert(sizeof(_lambda_thismodule_155_8_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,start)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,step)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_162_8_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_162_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_162_8_3 *)) __finalize;
+	int32_t __yield;
+	int32_t count;
+	int32_t value;
+	bool _loop_at_165;
+	int32_t x;
+	void * _pvar_0_at_165;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_165;
+};
+static_assert(sizeof(_lambda_thismodule_162_8_3)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,count)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,value)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,_loop_at_165)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,_pvar_0_at_165)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_162_8_3,_source_0_at_165)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_23_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_50_23_4,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_50_23_4 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_50;
+	int32_t x;
+	void * _pvar_0_at_50;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_50;
+};
+static_assert(sizeof(_lambda_thismodule_50_23_4)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_loop_at_50)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_pvar_0_at_50)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_source_0_at_50)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_15_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_106_15_5,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_106_15_5 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_106;
+	int32_t x;
+	void * _pvar_0_at_106;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_106;
+};
+static_assert(sizeof(_lambda_thismodule_106_15_5)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_loop_at_106)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_pvar_0_at_106)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_source_0_at_106)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_28_6 {
+	Func DAS_COMMENT((TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_139_28_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_139_28_6)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_227_19_7 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_227_19_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_227_19_7 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_227;
+	int32_t x;
+	void * _pvar_0_at_227;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_227;
+};
+static_assert(sizeof(_lambda_thismodule_227_19_7)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_loop_at_227)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_pvar_0_at_227)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_source_0_at_227)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_232_10_8 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_232_10_8,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_232_10_8 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_232;
+	int32_t x;
+	void * _pvar_0_at_232;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_232;
+};
+static_assert(sizeof(_lambda_thismodule_232_10_8)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_loop_at_232)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_pvar_0_at_232)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_source_0_at_232)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_235_18_9 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_235_18_9,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_235_18_9 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_235;
+	int32_t x;
+	void * _pvar_0_at_235;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_235;
+};
+static_assert(sizeof(_lambda_thismodule_235_18_9)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_loop_at_235)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_pvar_0_at_235)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_source_0_at_235)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_21_10 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_56_21_10,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_56_21_10 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_56;
+	int32_t x;
+	void * _pvar_0_at_56;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_56_21_10)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_loop_at_56)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_pvar_0_at_56)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_source_0_at_56)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_90_14_11 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_90_14_11,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_90_14_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_90;
+	int32_t x;
+	void * _pvar_0_at_90;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_90;
+};
+static_assert(sizeof(_lambda_thismodule_90_14_11)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_loop_at_90)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_pvar_0_at_90)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_source_0_at_90)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_240_10_12 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_240_10_12,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_240_10_12 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_240;
+	int32_t x;
+	void * _pvar_0_at_240;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_240;
+};
+static_assert(sizeof(_lambda_thismodule_240_10_12)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_loop_at_240)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_pvar_0_at_240)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_source_0_at_240)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_243_18_13 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_243_18_13,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_243_18_13 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_243;
+	int32_t x;
+	void * _pvar_0_at_243;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_243;
+};
+static_assert(sizeof(_lambda_thismodule_243_18_13)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_loop_at_243)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,x)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_pvar_0_at_243)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_source_0_at_243)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_71_25_14 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_71_25_14,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_71_25_14 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_71_25_14)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_115_27_15 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_115_27_15,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_115_27_15 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_115_27_15)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_30_16 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_30_16,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_30_16 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_163_30_16)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_172_30_17 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_172_30_17,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_172_30_17 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_172_30_17)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_180_30_18 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_180_30_18,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_180_30_18 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_180_30_18)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_114_12_19 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_114_12_19,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_114_12_19 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	TArray<int32_t> arr;
+	bool ___loop_at_119_rename_at_119;
+	int32_t * __x_rename_at_119;
+	void * ___pvar_0_at_119_rename_at_119;
+	bool _loop_at_115;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_115;
+	int32_t x;
+	void * _pvar_0_at_115;
+	Sequence DAS_COMMENT((int32_t &)) ___source_0_at_119_rename_at_119;
+};
+static_assert(sizeof(_lambda_thismodule_114_12_19)==112,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,___loop_at_119_rename_at_119)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,__x_rename_at_119)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,___pvar_0_at_119_rename_at_119)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,_loop_at_115)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,_source_0_at_115)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,_pvar_0_at_115)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_114_12_19,___source_0_at_119_rename_at_119)==104,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_20 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_20,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_20 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_20)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,blk)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,_loop_at_10)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,_source_0_at_10)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,w)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_20,_pvar_0_at_10)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_21 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_21,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_21 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_21)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_loop_at_10)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_source_0_at_10)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_pvar_0_at_10)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_140_12_22 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_140_12_22,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_140_12_22 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_140;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_140;
+	int32_t x;
+	void * _pvar_0_at_140;
+	int32_t i;
+	void * _pvar_1_at_140;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_140;
+};
+static_assert(sizeof(_lambda_thismodule_140_12_22)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,_loop_at_140)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,_source_0_at_140)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,_pvar_0_at_140)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,_pvar_1_at_140)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_140_12_22,_source_1_at_140)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_23 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_23,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_23 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_23)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,blk)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_loop_at_32)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_source_0_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,w)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_pvar_0_at_32)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_24 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_24,bool &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_24 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_24)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_loop_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_source_0_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_pvar_0_at_32)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_25 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_25,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_25 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_25)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_loop_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_source_0_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_pvar_0_at_32)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_26 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_26,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_26 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_26)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,_loop_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,_source_0_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_26,_pvar_0_at_32)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_91_25_27 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_91_25_27,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_91_25_27 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_91_25_27)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_27,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_27,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_126_12_28 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_126_12_28,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_126_12_28 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) src;
+	TArray<TTuple<8,int32_t,float>> arr;
+	bool ___loop_at_131_rename_at_131;
+	TTuple<8,int32_t,float> * __x_rename_at_131;
+	void * ___pvar_0_at_131_rename_at_131;
+	bool _loop_at_127;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _source_0_at_127;
+	TTuple<8,int32_t,float> x;
+	void * _pvar_0_at_127;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) ___source_0_at_131_rename_at_131;
+};
+static_assert(sizeof(_lambda_thismodule_126_12_28)==112,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,___loop_at_131_rename_at_131)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,__x_rename_at_131)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,___pvar_0_at_131_rename_at_131)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,_loop_at_127)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,_source_0_at_127)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,_pvar_0_at_127)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_28,___source_0_at_131_rename_at_131)==104,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_126_12_29 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_126_12_29,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_126_12_29 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	TArray<TArray<int32_t>> arr;
+	bool ___loop_at_131_rename_at_131;
+	TArray<int32_t> * __x_rename_at_131;
+	void * ___pvar_0_at_131_rename_at_131;
+	bool _loop_at_127;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_127;
+	TArray<int32_t> x;
+	void * _pvar_0_at_127;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) ___source_0_at_131_rename_at_131;
+};
+static_assert(sizeof(_lambda_thismodule_126_12_29)==128,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,arr)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,___loop_at_131_rename_at_131)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,__x_rename_at_131)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,___pvar_0_at_131_rename_at_131)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,_loop_at_127)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,_source_0_at_127)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,x)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,_pvar_0_at_127)==112,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_126_12_29,___source_0_at_131_rename_at_131)==120,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_12_30 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_16_12_30,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_12_30 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_16;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_16;
+	TArray<int32_t> w;
+	void * _pvar_0_at_16;
+};
+static_assert(sizeof(_lambda_thismodule_16_12_30)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_loop_at_16)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_source_0_at_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_pvar_0_at_16)==72,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_146_12_31 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_146_12_31,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_146_12_31 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_146;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _source_0_at_146;
+	TTuple<8,int32_t,float> * x;
+	void * _pvar_0_at_146;
+	int32_t i;
+	void * _pvar_1_at_146;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_146;
+};
+static_assert(sizeof(_lambda_thismodule_146_12_31)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,_loop_at_146)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,_source_0_at_146)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,_pvar_0_at_146)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,_pvar_1_at_146)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_31,_source_1_at_146)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_92_36_32 {
+	Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_92_36_32,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_92_36_32 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_92_36_32)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_146_12_33 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_146_12_33,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_146_12_33 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_146;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_146;
+	TArray<int32_t> * x;
+	void * _pvar_0_at_146;
+	int32_t i;
+	void * _pvar_1_at_146;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_146;
+};
+static_assert(sizeof(_lambda_thismodule_146_12_33)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,src)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,start)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,stop)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,_loop_at_146)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,_source_0_at_146)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,x)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,_pvar_0_at_146)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,i)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,_pvar_1_at_146)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_146_12_33,_source_1_at_146)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_37_12_34 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_37_12_34,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_37_12_34 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	bool _loop_at_37;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_37;
+	TArray<int32_t> * w;
+	void * _pvar_0_at_37;
+};
+static_assert(sizeof(_lambda_thismodule_37_12_34)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_loop_at_37)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_source_0_at_37)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_pvar_0_at_37)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_29_35 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_93_29_35,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_93_29_35 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_93_29_35)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_36 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_36,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_36 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_32;
+	TArray<int32_t> w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_36)==80,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,blk)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_loop_at_32)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_source_0_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,w)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_pvar_0_at_32)==72,"structure field offset mismatch with DAS");
+}
+
+inline bool _FuncExclEqu_eccf4912248d674d ( Context * __context__, TArray<int32_t> const  & __a_rename_at_29, TArray<int32_t> const  & __b_rename_at_29 );
+inline bool _FuncExclEqu_d77cb657768af39a ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_26, TTuple<8,int32_t,float> const  & __b_rename_at_26 );
+inline void _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 );
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_c56c9bbd12a56479 ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 );
+inline void _Func_lambda_thismodule_10_12_20_0x60_finazlier_f5030c9c02d793ea ( Context * __context__, _lambda_thismodule_10_12_20 * ____this_rename_at_10 );
+inline bool _Func_lambda_thismodule_10_12_20_0x60_function_e979ac259afc8097 ( Context * __context__, _lambda_thismodule_10_12_20 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_10_12_21_0x60_finazlier_d1ba1d4d6687fdbc ( Context * __context__, _lambda_thismodule_10_12_21 * ____this_rename_at_10 );
+inline bool _Func_lambda_thismodule_10_12_21_0x60_function_7731a24418e632f6 ( Context * __context__, _lambda_thismodule_10_12_21 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_114_12_19_0x60_finazlier_ff5d55f45c8bb832 ( Context * __context__, _lambda_thismodule_114_12_19 * ____this_rename_at_114 );
+inline bool _Func_lambda_thismodule_114_12_19_0x60_function_b44f99bcf76b941f ( Context * __context__, _lambda_thismodule_114_12_19 & ____this_rename_at_114, int32_t & ___yield_114_rename_at_114 );
+inline void _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 );
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_99b02f7d7fb20f7f ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 );
+inline void _Func_lambda_thismodule_126_12_28_0x60_finazlier_b9868659d928ab4c ( Context * __context__, _lambda_thismodule_126_12_28 * ____this_rename_at_126 );
+inline bool _Func_lambda_thismodule_126_12_28_0x60_function_2c2028644a12e636 ( Context * __context__, _lambda_thismodule_126_12_28 & ____this_rename_at_126, TTuple<8,int32_t,float> * & ___ryield126_rename_at_126 );
+inline void _Func_lambda_thismodule_126_12_29_0x60_finazlier_2522eb75bb54e4e ( Context * __context__, _lambda_thismodule_126_12_29 * ____this_rename_at_126 );
+inline bool _Func_lambda_thismodule_126_12_29_0x60_function_4b65d37516a6fe15 ( Context * __context__, _lambda_thismodule_126_12_29 & ____this_rename_at_126, TArray<int32_t> * & ___ryield126_rename_at_126 );
+inline void _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 );
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_472f6a6c1f57defb ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139, int32_t __x_rename_at_139 );
+inline void _Func_lambda_thismodule_140_12_22_0x60_finazlier_2a40e0f101508cc0 ( Context * __context__, _lambda_thismodule_140_12_22 * ____this_rename_at_140 );
+inline bool _Func_lambda_thismodule_140_12_22_0x60_function_578433893de1dce7 ( Context * __context__, _lambda_thismodule_140_12_22 & ____this_rename_at_140, int32_t & ___yield_140_rename_at_140 );
+inline void _Func_lambda_thismodule_146_12_31_0x60_finazlier_83a1d68515955f38 ( Context * __context__, _lambda_thismodule_146_12_31 * ____this_rename_at_146 );
+inline bool _Func_lambda_thismodule_146_12_31_0x60_function_efe7dd7efd6841e1 ( Context * __context__, _lambda_thismodule_146_12_31 & ____this_rename_at_146, TTuple<8,int32_t,float> * & ___ryield146_rename_at_146 );
+inline void _Func_lambda_thismodule_146_12_33_0x60_finazlier_1709d87fc5263e38 ( Context * __context__, _lambda_thismodule_146_12_33 * ____this_rename_at_146 );
+inline bool _Func_lambda_thismodule_146_12_33_0x60_function_3ba16a2e96795c5 ( Context * __context__, _lambda_thismodule_146_12_33 & ____this_rename_at_146, TArray<int32_t> * & ___ryield146_rename_at_146 );
+inline void _Func_lambda_thismodule_155_8_2_0x60_finazlier_2411e579cf98c0f6 ( Context * __context__, _lambda_thismodule_155_8_2 * ____this_rename_at_155 );
+inline bool _Func_lambda_thismodule_155_8_2_0x60_function_e25f4c72c61fdd60 ( Context * __context__, _lambda_thismodule_155_8_2 & ____this_rename_at_155, int32_t & __result_rename_at_154 );
+inline void _Func_lambda_thismodule_162_8_3_0x60_finazlier_a08e1c5c057bfbc8 ( Context * __context__, _lambda_thismodule_162_8_3 * ____this_rename_at_162 );
+inline bool _Func_lambda_thismodule_162_8_3_0x60_function_ecb6711d5715d68f ( Context * __context__, _lambda_thismodule_162_8_3 & ____this_rename_at_162, int32_t & ___yield_162_rename_at_162 );
+inline void _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 );
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_9edd70fc8a73b5a9 ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163, int32_t __x_rename_at_163 );
+inline void _Func_lambda_thismodule_16_12_30_0x60_finazlier_4ccf1d1c8122f79c ( Context * __context__, _lambda_thismodule_16_12_30 * ____this_rename_at_16 );
+inline bool _Func_lambda_thismodule_16_12_30_0x60_function_2b1db36a13098158 ( Context * __context__, _lambda_thismodule_16_12_30 & ____this_rename_at_16, TArray<int32_t> * & ___ryield16_rename_at_16 );
+inline void _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 );
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_f241e50a975a124c ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172, int32_t __x_rename_at_172 );
+inline void _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 );
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_bcfd62167c2f57f6 ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180, int32_t __x_rename_at_180 );
+inline void _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 );
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_6246627beb3b33cd ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 );
+inline void _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386 ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 );
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_9c855c1b64afb721 ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232, TTuple<8,int32_t,float> & ___yield_232_rename_at_232 );
+inline void _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 );
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_2e95b976cf509779 ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235, TTuple<8,int32_t,float> & ___yield_235_rename_at_235 );
+inline void _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98 ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 );
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_44ae12e2b05cffe ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240, TArray<int32_t> & ___yield_240_rename_at_240 );
+inline void _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 );
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_738a21f9be0cc078 ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243, TArray<int32_t> & ___yield_243_rename_at_243 );
+inline void _Func_lambda_thismodule_32_12_23_0x60_finazlier_c8f8e435e390c224 ( Context * __context__, _lambda_thismodule_32_12_23 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_23_0x60_function_555bcb5cb06bd872 ( Context * __context__, _lambda_thismodule_32_12_23 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_24_0x60_finazlier_3d3d9073d2541f6 ( Context * __context__, _lambda_thismodule_32_12_24 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_24_0x60_function_2d0fca48b40f1488 ( Context * __context__, _lambda_thismodule_32_12_24 & ____this_rename_at_32, bool & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_25_0x60_finazlier_a33881cecf992244 ( Context * __context__, _lambda_thismodule_32_12_25 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_25_0x60_function_ff871c1b0b3296c0 ( Context * __context__, _lambda_thismodule_32_12_25 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_26_0x60_finazlier_6e94b4db6ebb5c5a ( Context * __context__, _lambda_thismodule_32_12_26 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_26_0x60_function_f04c3507d7907c3 ( Context * __context__, _lambda_thismodule_32_12_26 & ____this_rename_at_32, TTuple<8,int32_t,float> & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_36_0x60_finazlier_359503b0c44073d4 ( Context * __context__, _lambda_thismodule_32_12_36 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_36_0x60_function_c4cd68058006908f ( Context * __context__, _lambda_thismodule_32_12_36 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_37_12_34_0x60_finazlier_66300907ccc3e5a6 ( Context * __context__, _lambda_thismodule_37_12_34 * ____this_rename_at_37 );
+inline bool _Func_lambda_thismodule_37_12_34_0x60_function_9bb4f2f49fc0df43 ( Context * __context__, _lambda_thismodule_37_12_34 & ____this_rename_at_37, TArray<int32_t> & ___yield_37_rename_at_37 );
+inline void _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378 ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 );
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_23b6a451d4c31fe8 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 );
+inline void _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 );
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_98257abb2a360b0d ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56, TArray<int32_t> & ___yield_56_rename_at_56 );
+inline void _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0 ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 );
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_d3dd6e415d58c429 ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71, int32_t __x_rename_at_71 );
+inline void _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 );
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_cb7acd9379a60377 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85, int32_t __x_rename_at_85 );
+inline void _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 );
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_a695c89c641e9f31 ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90, TArray<int32_t> & ___yield_90_rename_at_90 );
+inline void _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454 ( Context * __context__, _lambda_thismodule_91_25_27 * ____this_rename_at_91 );
+inline bool _Func_lambda_thismodule_91_25_27_0x60_function_62a7a09ac176e772 ( Context * __context__, _lambda_thismodule_91_25_27 & ____this_rename_at_91, TArray<int32_t> const  & __x_rename_at_91 );
+inline void _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 );
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_b78fbe9676275623 ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92, TArray<int32_t> const  & __x_rename_at_92 );
+inline void _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 );
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_b0d1910de5a9c7a5 ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93, TArray<int32_t> const  & __x_rename_at_93 );
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  & __x_rename_at_23 );
+inline bool _Func_0x60_is_same_590802a3ad1ce37b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_37 );
+inline bool _Func_0x60_is_same_97c40271e1b9fd95 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __b_rename_at_37 );
+inline bool _Func_0x60_is_same_76c357069204466c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  & __b_rename_at_37 );
+inline void _Func_0x60_verify_14_c3c8eadf66ac49ff ( Context * __context__, TArray<TArray<int32_t>> const  & __t_rename_at_43 );
+inline void _Func_0x60_verify_14_7ef312f50721678e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __t_rename_at_43 );
+inline void _Func_0x60_verify_even_80adb3e94fb860c4 ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_19 );
+inline void _Func_0x60_verify_even_eefc0d72cf85e86 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __arr_rename_at_19 );
+inline void _Func_0x60_verify_even_7e1644f384b5d5ac ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __arr_rename_at_19 );
+inline int32_t add_17f8810c9c570b5a ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 );
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_298c4ba2da976305 ( Context * __context__, TArray<TArray<int32_t>> const  & __a_rename_at_258 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_2d3d435a4c8a02ad ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  & __a_rename_at_258 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_258 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_69d7e7bb51ea3de6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_ba1451246e410d44 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_514b08b1e7149328 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_d7a87ffd28768e01 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_39f24952079a2b12 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_269 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_269 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_576a75d40473b6b2 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_269 );
+inline void _Funcbuiltin_0x60_emplace_cbf332071aecae6a ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_49, TArray<int32_t> & __value_rename_at_49 );
+inline void _Funcbuiltin_0x60_finalize_242c8c79790d8651 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_e1c35de9ada57daf ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_clone_85431c6f80690d63 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_61, TArray<int32_t> const  & __value_rename_at_61 );
+inline void _Funcbuiltin_0x60_push_clone_a3d92d5b7b06b77c ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __Arr_rename_at_61, TTuple<8,int32_t,float> const  & __value_rename_at_61 );
+inline void _Funcbuiltin_0x60_push_clone_9da63e78acf395d5 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_61, int32_t __value_rename_at_61 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_285 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_5baa820607536fa4 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_298 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a ( Context * __context__, TDim<int32_t,3> & __a_rename_at_298 );
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_127 );
+inline void finalize_a9d0ed6e96725931 ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106 );
+inline void finalize_ffeba83554a107e5 ( Context * __context__, _lambda_thismodule_10_12_20 & ____this_rename_at_10 );
+inline void finalize_c07e639f98d956be ( Context * __context__, _lambda_thismodule_10_12_21 & ____this_rename_at_10 );
+inline void finalize_4501d8c7efc415b6 ( Context * __context__, _lambda_thismodule_114_12_19 & ____this_rename_at_114 );
+inline void finalize_4e0f4bc7b8ca2ddf ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115 );
+inline void finalize_2b52cc14974eb289 ( Context * __context__, _lambda_thismodule_126_12_28 & ____this_rename_at_126 );
+inline void finalize_a646fc072953826 ( Context * __context__, _lambda_thismodule_126_12_29 & ____this_rename_at_126 );
+inline void finalize_99b4eff0b688c844 ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139 );
+inline void finalize_e7f1877f7e5421e0 ( Context * __context__, _lambda_thismodule_140_12_22 & ____this_rename_at_140 );
+inline void finalize_1a0bb91605bff14a ( Context * __context__, _lambda_thismodule_146_12_31 & ____this_rename_at_146 );
+inline void finalize_147a429eb5e3cbec ( Context * __context__, _lambda_thismodule_146_12_33 & ____this_rename_at_146 );
+inline void finalize_5e67e3bae091c622 ( Context * __context__, _lambda_thismodule_155_8_2 & ____this_rename_at_155 );
+inline void finalize_e936e15940b27451 ( Context * __context__, _lambda_thismodule_162_8_3 & ____this_rename_at_162 );
+inline void finalize_790215f236547953 ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163 );
+inline void finalize_90ffa732bfe8521f ( Context * __context__, _lambda_thismodule_16_12_30 & ____this_rename_at_16 );
+inline void finalize_1bb28fe166db1ff8 ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172 );
+inline void finalize_6a14a117832a47b4 ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180 );
+inline void finalize_49ff1a0658524f07 ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227 );
+inline void finalize_da9a89580c66c5cf ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232 );
+inline void finalize_cb84739dfec92af7 ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235 );
+inline void finalize_3110b281c7deafcb ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240 );
+inline void finalize_3d9c85063ca4a8bd ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243 );
+inline void finalize_a599eea550527dd4 ( Context * __context__, _lambda_thismodule_32_12_23 & ____this_rename_at_32 );
+inline void finalize_a63a3f13530d06d5 ( Context * __context__, _lambda_thismodule_32_12_24 & ____this_rename_at_32 );
+inline void finalize_98cb053c4bf3181e ( Context * __context__, _lambda_thismodule_32_12_25 & ____this_rename_at_32 );
+inline void finalize_d87f2b2985e6b0e7 ( Context * __context__, _lambda_thismodule_32_12_26 & ____this_rename_at_32 );
+inline void finalize_b94e81e70e15931b ( Context * __context__, _lambda_thismodule_32_12_36 & ____this_rename_at_32 );
+inline void finalize_84d8c7cf0e6c730f ( Context * __context__, _lambda_thismodule_37_12_34 & ____this_rename_at_37 );
+inline void finalize_e4e346397db1da55 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50 );
+inline void finalize_7e62c95ba3669c0e ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56 );
+inline void finalize_8d49d3be2563d419 ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71 );
+inline void finalize_8f217ed02c7d43f1 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85 );
+inline void finalize_75919cb3423249cf ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90 );
+inline void finalize_cfd3426561e2e7e5 ( Context * __context__, _lambda_thismodule_91_25_27 & ____this_rename_at_91 );
+inline void finalize_6eaa1c4f569102fc ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92 );
+inline void finalize_cdc2fc53315b9882 ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93 );
+inline bool _Funcfunctional_0x60_all_af66043144506e5d ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_101 );
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_90 );
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  & __it_rename_at_90 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_d104f003ed40f81d ( Context * __context__, int32_t __start_rename_at_153, int32_t __step_rename_at_153 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_e65840607303287d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_111 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_9307cbe86dc18493 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __src_rename_at_111 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_5b23e7a7385574ed ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_111 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_2f1bfef5b9185064 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_21 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_4f1dc6df7c9a047b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_25, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_25 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_3cd29644344d3ab4 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_7 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_4f440bfcbccbc0d0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_5e72c2679447b323 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline bool _Funcfunctional_0x60_is_equal_9cf00a9700259a54 ( Context * __context__, int32_t __a_rename_at_169, int32_t __b_rename_at_169 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_fc7bf6c00c789478 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_c5d1237505bcea35 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_784f1c420c07c72d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_7c9f3865b7a3940a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_47, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_d53fb0c2d9dfb3e9 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_b229592d62268192 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_51, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_51 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_6b992b192f6d0379 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_69271239b8e77c4b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_4653403510c37584 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_94f2fe7992a68f2e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_29, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_e0d846ac25c8ccfe ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_29, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_441075f1d3af98ef ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_eb9f55c0847980e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_d8701f9e7666a39f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_3c50bea69955cdd6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 );
+inline bool _Funcfunctional_0x60_not_47ae1464a98e0c31 ( Context * __context__, bool __x_rename_at_175 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_26999405e8feb1ae ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_78, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __blk_rename_at_78 );
+inline int32_t _Funcfunctional_0x60_reduce_2fc220e9df504873 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_78, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_78 );
+inline int32_t _Funcfunctional_0x60_reduce_d0cd73f6a56dd127 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_74, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_74 );
+inline int32_t _Funcfunctional_0x60_reduce_3d9e9ac16cb763c3 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_70, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_70 );
+inline int32_t _Funcfunctional_0x60_reduce_3cdc98b626551694 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_78, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_78 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_f4b3c153b2fa4ed8 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_56, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __functor_rename_at_56 );
+inline int32_t _Funcfunctional_0x60_reduce_any_e5cc70a024b84107 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_56 );
+inline int32_t _Funcfunctional_0x60_reduce_any_8c7e16d91347e748 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 );
+inline int32_t _Funcfunctional_0x60_reduce_any_3e33db80687dd5b0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 );
+inline int32_t _Funcfunctional_0x60_reduce_any_ba55ccd7fef6c17c ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_56 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_d9d27c291dcbe8dc ( Context * __context__, int32_t __value_rename_at_160, int32_t __count_rename_at_160 );
+inline int32_t _Funcfunctional_0x60_sum_753716cc0b2bd341 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_83 );
+inline bool is_even_d55850ffa9bd4b94 ( Context * __context__, int32_t __x_rename_at_9 );
+inline bool test_2d6b405414824ffe ( Context * __context__ );
+inline int32_t twice_7c65caf37efc07cb ( Context * __context__, int32_t __x_rename_at_12 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncExclEqu_eccf4912248d674d ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_29, TArray<int32_t> const  &  __b_rename_at_29 )
+{
+	if ( builtin_array_size(__a_rename_at_29) != builtin_array_size(__b_rename_at_29) )
+	{
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		{
+			bool __need_loop_32 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_29);
+			int32_t const  * __x_rename_at_32;
+			__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+			// y : int const&
+			das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_29);
+			int32_t const  * __y_rename_at_32;
+			__need_loop_32 = __y_iterator.first(__context__,(__y_rename_at_32)) && __need_loop_32;
+			for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) && __y_iterator.next(__context__,(__y_rename_at_32)) )
+			{
+				if ( (*__x_rename_at_32) != (*__y_rename_at_32) )
+				{
+					return das_auto_cast<bool>::cast(true);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_32));
+			__y_iterator.close(__context__,(__y_rename_at_32));
+		};
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool _FuncExclEqu_d77cb657768af39a ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_26, TTuple<8,int32_t,float> const  &  __b_rename_at_26 )
+{
+	return das_auto_cast<bool>::cast((das_get_tuple_field<int32_t,0>::get(__a_rename_at_26) != das_get_tuple_field<int32_t,0>::get(__b_rename_at_26)) || (das_get_tuple_field<float,4>::get(__a_rename_at_26) != das_get_tuple_field<float,4>::get(__b_rename_at_26)));
+}
+
+inline void _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 )
+{
+	finalize_a9d0ed6e96725931(__context__,das_arg<_lambda_thismodule_106_15_5>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<_lambda_thismodule_106_15_5 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_c56c9bbd12a56479 ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_106_32;
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106._loop_at_106,true);
+	das_move(____this_rename_at_106._source_0_at_106,(_temp_make_local_106_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_106.x), 0, 4);
+	das_copy(____this_rename_at_106._pvar_0_at_106,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_106.x)));
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_106._loop_at_106 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield106_rename_at_106,das_ref(__context__,____this_rename_at_106.x));
+	das_copy(____this_rename_at_106.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_10_12_20_0x60_finazlier_f5030c9c02d793ea ( Context * __context__, _lambda_thismodule_10_12_20 * ____this_rename_at_10 )
+{
+	finalize_ffeba83554a107e5(__context__,das_arg<_lambda_thismodule_10_12_20>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_20 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline bool _Func_lambda_thismodule_10_12_20_0x60_function_e979ac259afc8097 ( Context * __context__, _lambda_thismodule_10_12_20 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_function<bool>::invoke<int32_t>(__context__,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_10_12_21_0x60_finazlier_d1ba1d4d6687fdbc ( Context * __context__, _lambda_thismodule_10_12_21 * ____this_rename_at_10 )
+{
+	finalize_c07e639f98d956be(__context__,das_arg<_lambda_thismodule_10_12_21>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_21 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline bool _Func_lambda_thismodule_10_12_21_0x60_function_7731a24418e632f6 ( Context * __context__, _lambda_thismodule_10_12_21 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_114_12_19_0x60_finazlier_ff5d55f45c8bb832 ( Context * __context__, _lambda_thismodule_114_12_19 * ____this_rename_at_114 )
+{
+	builtin_array_clear_lock(das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_114).arr),__context__);
+	finalize_4501d8c7efc415b6(__context__,das_arg<_lambda_thismodule_114_12_19>::pass(das_deref(__context__,____this_rename_at_114)));
+	das_delete_lambda_struct<_lambda_thismodule_114_12_19 *>::clear(__context__,____this_rename_at_114);
+}
+
+inline bool _Func_lambda_thismodule_114_12_19_0x60_function_b44f99bcf76b941f ( Context * __context__, _lambda_thismodule_114_12_19 &  ____this_rename_at_114, int32_t & ___yield_114_rename_at_114 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_119_32;
+	switch (____this_rename_at_114.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_114.arr), 0, 24);
+	das_copy(____this_rename_at_114._loop_at_115,true);
+	das_move(____this_rename_at_114._source_0_at_115,____this_rename_at_114.src);
+	memset(&(____this_rename_at_114.x), 0, 4);
+	das_copy(____this_rename_at_114._pvar_0_at_115,das_ref(__context__,____this_rename_at_114.x));
+	DAS_SETBOOLAND((____this_rename_at_114._loop_at_115),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_115),____this_rename_at_114._pvar_0_at_115,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_114._loop_at_115 )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_114_rename_at_114,____this_rename_at_114.x);
+	das_copy(____this_rename_at_114.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_114.arr),____this_rename_at_114.x);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_114._loop_at_115),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_115),____this_rename_at_114._pvar_0_at_115,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_115),____this_rename_at_114._pvar_0_at_115,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_114.___loop_at_119_rename_at_119,true);
+	das_move(____this_rename_at_114.___source_0_at_119_rename_at_119,(_temp_make_local_119_32 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_114.arr)))));
+	memset(&(____this_rename_at_114.__x_rename_at_119), 0, 8);
+	das_copy(____this_rename_at_114.___pvar_0_at_119_rename_at_119,das_ref(__context__,____this_rename_at_114.__x_rename_at_119));
+	DAS_SETBOOLAND((____this_rename_at_114.___loop_at_119_rename_at_119),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114.___source_0_at_119_rename_at_119),____this_rename_at_114.___pvar_0_at_119_rename_at_119,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_114.___loop_at_119_rename_at_119 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_114_rename_at_114,das_deref(__context__,____this_rename_at_114.__x_rename_at_119));
+	das_copy(____this_rename_at_114.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_114.___loop_at_119_rename_at_119),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114.___source_0_at_119_rename_at_119),____this_rename_at_114.___pvar_0_at_119_rename_at_119,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114.___source_0_at_119_rename_at_119),____this_rename_at_114.___pvar_0_at_119_rename_at_119,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 )
+{
+	finalize_4e0f4bc7b8ca2ddf(__context__,das_arg<_lambda_thismodule_115_27_15>::pass(das_deref(__context__,____this_rename_at_115)));
+	das_delete_lambda_struct<_lambda_thismodule_115_27_15 *>::clear(__context__,____this_rename_at_115);
+}
+
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_99b02f7d7fb20f7f ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_115 + __y_rename_at_115);
+}
+
+inline void _Func_lambda_thismodule_126_12_28_0x60_finazlier_b9868659d928ab4c ( Context * __context__, _lambda_thismodule_126_12_28 * ____this_rename_at_126 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(das_deref(__context__,____this_rename_at_126).arr),__context__);
+	finalize_2b52cc14974eb289(__context__,das_arg<_lambda_thismodule_126_12_28>::pass(das_deref(__context__,____this_rename_at_126)));
+	das_delete_lambda_struct<_lambda_thismodule_126_12_28 *>::clear(__context__,____this_rename_at_126);
+}
+
+inline bool _Func_lambda_thismodule_126_12_28_0x60_function_2c2028644a12e636 ( Context * __context__, _lambda_thismodule_126_12_28 &  ____this_rename_at_126, TTuple<8,int32_t,float> * & ___ryield126_rename_at_126 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_131_32;
+	switch (____this_rename_at_126.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_126.arr), 0, 24);
+	das_copy(____this_rename_at_126._loop_at_127,true);
+	das_move(____this_rename_at_126._source_0_at_127,____this_rename_at_126.src);
+	memset(&(____this_rename_at_126.x), 0, 8);
+	das_copy(____this_rename_at_126._pvar_0_at_127,das_ref(__context__,____this_rename_at_126.x));
+	DAS_SETBOOLAND((____this_rename_at_126._loop_at_127),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_126._loop_at_127 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield126_rename_at_126,das_ref(__context__,____this_rename_at_126.x));
+	das_copy(____this_rename_at_126.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_a3d92d5b7b06b77c(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_126.arr),das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_126.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_126._loop_at_127),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_126.___loop_at_131_rename_at_131,true);
+	das_move(____this_rename_at_126.___source_0_at_131_rename_at_131,(_temp_make_local_131_32 = (_Funcbuiltin_0x60_each_2d3d435a4c8a02ad(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_126.arr)))));
+	memset(&(____this_rename_at_126.__x_rename_at_131), 0, 8);
+	das_copy(____this_rename_at_126.___pvar_0_at_131_rename_at_131,das_ref(__context__,____this_rename_at_126.__x_rename_at_131));
+	DAS_SETBOOLAND((____this_rename_at_126.___loop_at_131_rename_at_131),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_126.___loop_at_131_rename_at_131 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield126_rename_at_126,das_ref(__context__,das_deref(__context__,____this_rename_at_126.__x_rename_at_131)));
+	das_copy(____this_rename_at_126.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_126.___loop_at_131_rename_at_131),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_126_12_29_0x60_finazlier_2522eb75bb54e4e ( Context * __context__, _lambda_thismodule_126_12_29 * ____this_rename_at_126 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TArray<int32_t>>>::pass(das_deref(__context__,____this_rename_at_126).arr),__context__);
+	finalize_a646fc072953826(__context__,das_arg<_lambda_thismodule_126_12_29>::pass(das_deref(__context__,____this_rename_at_126)));
+	das_delete_lambda_struct<_lambda_thismodule_126_12_29 *>::clear(__context__,____this_rename_at_126);
+}
+
+inline bool _Func_lambda_thismodule_126_12_29_0x60_function_4b65d37516a6fe15 ( Context * __context__, _lambda_thismodule_126_12_29 &  ____this_rename_at_126, TArray<int32_t> * & ___ryield126_rename_at_126 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_131_32;
+	switch (____this_rename_at_126.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_126.arr), 0, 24);
+	das_copy(____this_rename_at_126._loop_at_127,true);
+	das_move(____this_rename_at_126._source_0_at_127,____this_rename_at_126.src);
+	memset(&(____this_rename_at_126.x), 0, 24);
+	das_copy(____this_rename_at_126._pvar_0_at_127,das_ref(__context__,____this_rename_at_126.x));
+	DAS_SETBOOLAND((____this_rename_at_126._loop_at_127),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_126._loop_at_127 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield126_rename_at_126,das_ref(__context__,____this_rename_at_126.x));
+	das_copy(____this_rename_at_126.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_85431c6f80690d63(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_126.arr),das_arg<TArray<int32_t>>::pass(____this_rename_at_126.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_126._loop_at_127),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126._source_0_at_127),____this_rename_at_126._pvar_0_at_127,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_126.___loop_at_131_rename_at_131,true);
+	das_move(____this_rename_at_126.___source_0_at_131_rename_at_131,(_temp_make_local_131_32 = (_Funcbuiltin_0x60_each_298c4ba2da976305(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_126.arr)))));
+	memset(&(____this_rename_at_126.__x_rename_at_131), 0, 8);
+	das_copy(____this_rename_at_126.___pvar_0_at_131_rename_at_131,das_ref(__context__,____this_rename_at_126.__x_rename_at_131));
+	DAS_SETBOOLAND((____this_rename_at_126.___loop_at_131_rename_at_131),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_126.___loop_at_131_rename_at_131 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield126_rename_at_126,das_ref(__context__,das_deref(__context__,____this_rename_at_126.__x_rename_at_131)));
+	das_copy(____this_rename_at_126.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_126.___loop_at_131_rename_at_131),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),____this_rename_at_126.___pvar_0_at_131_rename_at_131,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 )
+{
+	finalize_99b4eff0b688c844(__context__,das_arg<_lambda_thismodule_139_28_6>::pass(das_deref(__context__,____this_rename_at_139)));
+	das_delete_lambda_struct<_lambda_thismodule_139_28_6 *>::clear(__context__,____this_rename_at_139);
+}
+
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_472f6a6c1f57defb ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139, int32_t __x_rename_at_139 )
+{
+	return das_auto_cast<TTuple<8,int32_t,float>>::cast((([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_139;
+		das_get_tuple_field<int32_t,0>::get(__mkt_139) = __x_rename_at_139;
+		das_get_tuple_field<float,4>::get(__mkt_139) = 1.5f;
+		return __mkt_139;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_140_12_22_0x60_finazlier_2a40e0f101508cc0 ( Context * __context__, _lambda_thismodule_140_12_22 * ____this_rename_at_140 )
+{
+	finalize_e7f1877f7e5421e0(__context__,das_arg<_lambda_thismodule_140_12_22>::pass(das_deref(__context__,____this_rename_at_140)));
+	das_delete_lambda_struct<_lambda_thismodule_140_12_22 *>::clear(__context__,____this_rename_at_140);
+}
+
+inline bool _Func_lambda_thismodule_140_12_22_0x60_function_578433893de1dce7 ( Context * __context__, _lambda_thismodule_140_12_22 &  ____this_rename_at_140, int32_t & ___yield_140_rename_at_140 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_140_32;
+	switch (____this_rename_at_140.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_140._loop_at_140,true);
+	das_move(____this_rename_at_140._source_0_at_140,____this_rename_at_140.src);
+	memset(&(____this_rename_at_140.x), 0, 4);
+	das_copy(____this_rename_at_140._pvar_0_at_140,das_ref(__context__,____this_rename_at_140.x));
+	DAS_SETBOOLAND((____this_rename_at_140._loop_at_140),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_0_at_140),____this_rename_at_140._pvar_0_at_140,__context__)));
+	das_move(____this_rename_at_140._source_1_at_140,(_temp_make_local_140_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(____this_rename_at_140.stop)))));
+	memset(&(____this_rename_at_140.i), 0, 4);
+	das_copy(____this_rename_at_140._pvar_1_at_140,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_140.i)));
+	DAS_SETBOOLAND((____this_rename_at_140._loop_at_140),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_1_at_140),____this_rename_at_140._pvar_1_at_140,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_140._loop_at_140 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_140.i >= ____this_rename_at_140.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_140_rename_at_140,____this_rename_at_140.x);
+	das_copy(____this_rename_at_140.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_140._loop_at_140),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_0_at_140),____this_rename_at_140._pvar_0_at_140,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_140._loop_at_140),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_1_at_140),____this_rename_at_140._pvar_1_at_140,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_0_at_140),____this_rename_at_140._pvar_0_at_140,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_1_at_140),____this_rename_at_140._pvar_1_at_140,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_146_12_31_0x60_finazlier_83a1d68515955f38 ( Context * __context__, _lambda_thismodule_146_12_31 * ____this_rename_at_146 )
+{
+	finalize_1a0bb91605bff14a(__context__,das_arg<_lambda_thismodule_146_12_31>::pass(das_deref(__context__,____this_rename_at_146)));
+	das_delete_lambda_struct<_lambda_thismodule_146_12_31 *>::clear(__context__,____this_rename_at_146);
+}
+
+inline bool _Func_lambda_thismodule_146_12_31_0x60_function_efe7dd7efd6841e1 ( Context * __context__, _lambda_thismodule_146_12_31 &  ____this_rename_at_146, TTuple<8,int32_t,float> * & ___ryield146_rename_at_146 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_146_32;
+	switch (____this_rename_at_146.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_146._loop_at_146,true);
+	das_move(____this_rename_at_146._source_0_at_146,____this_rename_at_146.src);
+	memset(&(____this_rename_at_146.x), 0, 8);
+	das_copy(____this_rename_at_146._pvar_0_at_146,das_ref(__context__,____this_rename_at_146.x));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__)));
+	das_move(____this_rename_at_146._source_1_at_146,(_temp_make_local_146_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(____this_rename_at_146.stop)))));
+	memset(&(____this_rename_at_146.i), 0, 4);
+	das_copy(____this_rename_at_146._pvar_1_at_146,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_146.i)));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_146._loop_at_146 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_146.i >= ____this_rename_at_146.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield146_rename_at_146,das_ref(__context__,das_deref(__context__,____this_rename_at_146.x)));
+	das_copy(____this_rename_at_146.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_146_12_33_0x60_finazlier_1709d87fc5263e38 ( Context * __context__, _lambda_thismodule_146_12_33 * ____this_rename_at_146 )
+{
+	finalize_147a429eb5e3cbec(__context__,das_arg<_lambda_thismodule_146_12_33>::pass(das_deref(__context__,____this_rename_at_146)));
+	das_delete_lambda_struct<_lambda_thismodule_146_12_33 *>::clear(__context__,____this_rename_at_146);
+}
+
+inline bool _Func_lambda_thismodule_146_12_33_0x60_function_3ba16a2e96795c5 ( Context * __context__, _lambda_thismodule_146_12_33 &  ____this_rename_at_146, TArray<int32_t> * & ___ryield146_rename_at_146 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_146_32;
+	switch (____this_rename_at_146.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_146._loop_at_146,true);
+	das_move(____this_rename_at_146._source_0_at_146,____this_rename_at_146.src);
+	memset(&(____this_rename_at_146.x), 0, 8);
+	das_copy(____this_rename_at_146._pvar_0_at_146,das_ref(__context__,____this_rename_at_146.x));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__)));
+	das_move(____this_rename_at_146._source_1_at_146,(_temp_make_local_146_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(____this_rename_at_146.stop)))));
+	memset(&(____this_rename_at_146.i), 0, 4);
+	das_copy(____this_rename_at_146._pvar_1_at_146,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_146.i)));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_146._loop_at_146 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_146.i >= ____this_rename_at_146.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield146_rename_at_146,das_ref(__context__,das_deref(__context__,____this_rename_at_146.x)));
+	das_copy(____this_rename_at_146.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_146._loop_at_146),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_146._source_0_at_146),____this_rename_at_146._pvar_0_at_146,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),____this_rename_at_146._pvar_1_at_146,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_155_8_2_0x60_finazlier_2411e579cf98c0f6 ( Context * __context__, _lambda_thismodule_155_8_2 * ____this_rename_at_155 )
+{
+	finalize_5e67e3bae091c622(__context__,das_arg<_lambda_thismodule_155_8_2>::pass(das_deref(__context__,____this_rename_at_155)));
+	das_delete_lambda_struct<_lambda_thismodule_155_8_2 *>::clear(__context__,____this_rename_at_155);
+}
+
+inline bool _Func_lambda_thismodule_155_8_2_0x60_function_e25f4c72c61fdd60 ( Context * __context__, _lambda_thismodule_155_8_2 &  ____this_rename_at_155, int32_t & __result_rename_at_154 )
+{
+	das_copy(__result_rename_at_154,____this_rename_at_155.start);
+	____this_rename_at_155.start += ____this_rename_at_155.step;
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void _Func_lambda_thismodule_162_8_3_0x60_finazlier_a08e1c5c057bfbc8 ( Context * __context__, _lambda_thismodule_162_8_3 * ____this_rename_at_162 )
+{
+	finalize_e936e15940b27451(__context__,das_arg<_lambda_thismodule_162_8_3>::pass(das_deref(__context__,____this_rename_at_162)));
+	das_delete_lambda_struct<_lambda_thismodule_162_8_3 *>::clear(__context__,____this_rename_at_162);
+}
+
+inline bool _Func_lambda_thismodule_162_8_3_0x60_function_ecb6711d5715d68f ( Context * __context__, _lambda_thismodule_162_8_3 &  ____this_rename_at_162, int32_t & ___yield_162_rename_at_162 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_165_32;
+	switch (____this_rename_at_162.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_162.count == 0) )
+	{
+		goto label_4;
+	};
+	label_1:;;
+	das_copy(___yield_162_rename_at_162,____this_rename_at_162.value);
+	das_copy(____this_rename_at_162.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	goto label_1;
+	label_2:;;
+	label_4:;;
+	das_copy(____this_rename_at_162._loop_at_165,true);
+	das_move(____this_rename_at_162._source_0_at_165,(_temp_make_local_165_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(____this_rename_at_162.count)))));
+	memset(&(____this_rename_at_162.x), 0, 4);
+	das_copy(____this_rename_at_162._pvar_0_at_165,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_162.x)));
+	DAS_SETBOOLAND((____this_rename_at_162._loop_at_165),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_162._source_0_at_165),____this_rename_at_162._pvar_0_at_165,__context__)));
+	label_6:;;
+	if ( !____this_rename_at_162._loop_at_165 )
+	{
+		goto label_8;
+	};
+	das_copy(___yield_162_rename_at_162,____this_rename_at_162.value);
+	das_copy(____this_rename_at_162.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	label_7:;;
+	DAS_SETBOOLAND((____this_rename_at_162._loop_at_165),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_162._source_0_at_165),____this_rename_at_162._pvar_0_at_165,__context__)));
+	goto label_6;
+	label_8:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_162._source_0_at_165),____this_rename_at_162._pvar_0_at_165,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 )
+{
+	finalize_790215f236547953(__context__,das_arg<_lambda_thismodule_163_30_16>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_30_16 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_9edd70fc8a73b5a9 ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163, int32_t __x_rename_at_163 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_163 > 30);
+}
+
+inline void _Func_lambda_thismodule_16_12_30_0x60_finazlier_4ccf1d1c8122f79c ( Context * __context__, _lambda_thismodule_16_12_30 * ____this_rename_at_16 )
+{
+	finalize_90ffa732bfe8521f(__context__,das_arg<_lambda_thismodule_16_12_30>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_12_30 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline bool _Func_lambda_thismodule_16_12_30_0x60_function_2b1db36a13098158 ( Context * __context__, _lambda_thismodule_16_12_30 &  ____this_rename_at_16, TArray<int32_t> * & ___ryield16_rename_at_16 )
+{
+	switch (____this_rename_at_16.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_16._loop_at_16,true);
+	das_move(____this_rename_at_16._source_0_at_16,____this_rename_at_16.src);
+	memset(&(____this_rename_at_16.w), 0, 24);
+	das_copy(____this_rename_at_16._pvar_0_at_16,das_ref(__context__,____this_rename_at_16.w));
+	DAS_SETBOOLAND((____this_rename_at_16._loop_at_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_16._loop_at_16 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<TArray<int32_t> &>(__context__,____this_rename_at_16.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_16.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield16_rename_at_16,das_ref(__context__,____this_rename_at_16.w));
+	das_copy(____this_rename_at_16.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_16._loop_at_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 )
+{
+	finalize_1bb28fe166db1ff8(__context__,das_arg<_lambda_thismodule_172_30_17>::pass(das_deref(__context__,____this_rename_at_172)));
+	das_delete_lambda_struct<_lambda_thismodule_172_30_17 *>::clear(__context__,____this_rename_at_172);
+}
+
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_f241e50a975a124c ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172, int32_t __x_rename_at_172 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_172 < 100);
+}
+
+inline void _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 )
+{
+	finalize_6a14a117832a47b4(__context__,das_arg<_lambda_thismodule_180_30_18>::pass(das_deref(__context__,____this_rename_at_180)));
+	das_delete_lambda_struct<_lambda_thismodule_180_30_18 *>::clear(__context__,____this_rename_at_180);
+}
+
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_bcfd62167c2f57f6 ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180, int32_t __x_rename_at_180 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_180 > 0);
+}
+
+inline void _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 )
+{
+	finalize_49ff1a0658524f07(__context__,das_arg<_lambda_thismodule_227_19_7>::pass(das_deref(__context__,____this_rename_at_227)));
+	das_delete_lambda_struct<_lambda_thismodule_227_19_7 *>::clear(__context__,____this_rename_at_227);
+}
+
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_6246627beb3b33cd ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_32;
+	switch (____this_rename_at_227.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_227._loop_at_227,true);
+	das_move(____this_rename_at_227._source_0_at_227,(_temp_make_local_227_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_227.x), 0, 4);
+	das_copy(____this_rename_at_227._pvar_0_at_227,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_227.x)));
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_227._loop_at_227 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_227_rename_at_227,(SimPolicy<int32_t>::Mod(____this_rename_at_227.x,3,*__context__)) + 1);
+	das_copy(____this_rename_at_227.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386 ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 )
+{
+	finalize_da9a89580c66c5cf(__context__,das_arg<_lambda_thismodule_232_10_8>::pass(das_deref(__context__,____this_rename_at_232)));
+	das_delete_lambda_struct<_lambda_thismodule_232_10_8 *>::clear(__context__,____this_rename_at_232);
+}
+
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_9c855c1b64afb721 ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232, TTuple<8,int32_t,float> &  ___yield_232_rename_at_232 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_232_32;
+	switch (____this_rename_at_232.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_232._loop_at_232,true);
+	das_move(____this_rename_at_232._source_0_at_232,(_temp_make_local_232_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_232.x), 0, 4);
+	das_copy(____this_rename_at_232._pvar_0_at_232,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_232.x)));
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_232._loop_at_232 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_232_rename_at_232,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_232;
+		das_get_tuple_field<int32_t,0>::get(__mkt_232) = ____this_rename_at_232.x;
+		das_get_tuple_field<float,4>::get(__mkt_232) = 2.5f;
+		return __mkt_232;
+	})()));
+	das_copy(____this_rename_at_232.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 )
+{
+	finalize_cb84739dfec92af7(__context__,das_arg<_lambda_thismodule_235_18_9>::pass(das_deref(__context__,____this_rename_at_235)));
+	das_delete_lambda_struct<_lambda_thismodule_235_18_9 *>::clear(__context__,____this_rename_at_235);
+}
+
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_2e95b976cf509779 ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235, TTuple<8,int32_t,float> &  ___yield_235_rename_at_235 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_235_32;
+	switch (____this_rename_at_235.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_235._loop_at_235,true);
+	das_move(____this_rename_at_235._source_0_at_235,(_temp_make_local_235_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_235.x), 0, 4);
+	das_copy(____this_rename_at_235._pvar_0_at_235,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_235.x)));
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_235._loop_at_235 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_235_rename_at_235,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_235;
+		das_get_tuple_field<int32_t,0>::get(__mkt_235) = ((SimPolicy<int32_t>::Mod(____this_rename_at_235.x,3,*__context__)) + 1);
+		das_get_tuple_field<float,4>::get(__mkt_235) = 2.5f;
+		return __mkt_235;
+	})()));
+	das_copy(____this_rename_at_235.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98 ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 )
+{
+	finalize_3110b281c7deafcb(__context__,das_arg<_lambda_thismodule_240_10_12>::pass(das_deref(__context__,____this_rename_at_240)));
+	das_delete_lambda_struct<_lambda_thismodule_240_10_12 *>::clear(__context__,____this_rename_at_240);
+}
+
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_44ae12e2b05cffe ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240, TArray<int32_t> &  ___yield_240_rename_at_240 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_240_32;
+	TArray<int32_t> _temp_make_local_240_48;
+	TDim<int32_t,2> _temp_make_local_240_80;
+	switch (____this_rename_at_240.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_240._loop_at_240,true);
+	das_move(____this_rename_at_240._source_0_at_240,(_temp_make_local_240_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_240.x), 0, 4);
+	das_copy(____this_rename_at_240._pvar_0_at_240,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_240.x)));
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_240._loop_at_240 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_240_rename_at_240,(_temp_make_local_240_48 = (_Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_240_80(0,__context__) = ____this_rename_at_240.x;
+		_temp_make_local_240_80(1,__context__) = 2;
+		return _temp_make_local_240_80;
+	})()))))));
+	das_copy(____this_rename_at_240.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 )
+{
+	finalize_3d9c85063ca4a8bd(__context__,das_arg<_lambda_thismodule_243_18_13>::pass(das_deref(__context__,____this_rename_at_243)));
+	das_delete_lambda_struct<_lambda_thismodule_243_18_13 *>::clear(__context__,____this_rename_at_243);
+}
+
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_738a21f9be0cc078 ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243, TArray<int32_t> &  ___yield_243_rename_at_243 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_243_32;
+	TArray<int32_t> _temp_make_local_243_48;
+	TDim<int32_t,2> _temp_make_local_243_80;
+	switch (____this_rename_at_243.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_243._loop_at_243,true);
+	das_move(____this_rename_at_243._source_0_at_243,(_temp_make_local_243_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_243.x), 0, 4);
+	das_copy(____this_rename_at_243._pvar_0_at_243,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_243.x)));
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_243._loop_at_243 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_243_rename_at_243,(_temp_make_local_243_48 = (_Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_243_80(0,__context__) = ((SimPolicy<int32_t>::Mod(____this_rename_at_243.x,3,*__context__)) + 1);
+		_temp_make_local_243_80(1,__context__) = 2;
+		return _temp_make_local_243_80;
+	})()))))));
+	das_copy(____this_rename_at_243.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_23_0x60_finazlier_c8f8e435e390c224 ( Context * __context__, _lambda_thismodule_32_12_23 * ____this_rename_at_32 )
+{
+	finalize_a599eea550527dd4(__context__,das_arg<_lambda_thismodule_32_12_23>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_23 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_23_0x60_function_555bcb5cb06bd872 ( Context * __context__, _lambda_thismodule_32_12_23 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_function<int32_t>::invoke<int32_t>(__context__,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_24_0x60_finazlier_3d3d9073d2541f6 ( Context * __context__, _lambda_thismodule_32_12_24 * ____this_rename_at_32 )
+{
+	finalize_a63a3f13530d06d5(__context__,das_arg<_lambda_thismodule_32_12_24>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_24 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_24_0x60_function_2d0fca48b40f1488 ( Context * __context__, _lambda_thismodule_32_12_24 &  ____this_rename_at_32, bool & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<bool>::invoke<int32_t>(__context__,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_25_0x60_finazlier_a33881cecf992244 ( Context * __context__, _lambda_thismodule_32_12_25 * ____this_rename_at_32 )
+{
+	finalize_98cb053c4bf3181e(__context__,das_arg<_lambda_thismodule_32_12_25>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_25 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_25_0x60_function_ff871c1b0b3296c0 ( Context * __context__, _lambda_thismodule_32_12_25 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_26_0x60_finazlier_6e94b4db6ebb5c5a ( Context * __context__, _lambda_thismodule_32_12_26 * ____this_rename_at_32 )
+{
+	finalize_d87f2b2985e6b0e7(__context__,das_arg<_lambda_thismodule_32_12_26>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_26 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_26_0x60_function_f04c3507d7907c3 ( Context * __context__, _lambda_thismodule_32_12_26 &  ____this_rename_at_32, TTuple<8,int32_t,float> &  ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<TTuple<8,int32_t,float>>::invoke_cmres<int32_t>(__context__,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_36_0x60_finazlier_359503b0c44073d4 ( Context * __context__, _lambda_thismodule_32_12_36 * ____this_rename_at_32 )
+{
+	finalize_b94e81e70e15931b(__context__,das_arg<_lambda_thismodule_32_12_36>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_36 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_36_0x60_function_c4cd68058006908f ( Context * __context__, _lambda_thismodule_32_12_36 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 24);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,____this_rename_at_32.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_32.w)));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_37_12_34_0x60_finazlier_66300907ccc3e5a6 ( Context * __context__, _lambda_thismodule_37_12_34 * ____this_rename_at_37 )
+{
+	finalize_84d8c7cf0e6c730f(__context__,das_arg<_lambda_thismodule_37_12_34>::pass(das_deref(__context__,____this_rename_at_37)));
+	das_delete_lambda_struct<_lambda_thismodule_37_12_34 *>::clear(__context__,____this_rename_at_37);
+}
+
+inline bool _Func_lambda_thismodule_37_12_34_0x60_function_9bb4f2f49fc0df43 ( Context * __context__, _lambda_thismodule_37_12_34 &  ____this_rename_at_37, TArray<int32_t> &  ___yield_37_rename_at_37 )
+{
+	switch (____this_rename_at_37.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_37._loop_at_37,true);
+	das_move(____this_rename_at_37._source_0_at_37,____this_rename_at_37.src);
+	memset(&(____this_rename_at_37.w), 0, 8);
+	das_copy(____this_rename_at_37._pvar_0_at_37,das_ref(__context__,____this_rename_at_37.w));
+	DAS_SETBOOLAND((____this_rename_at_37._loop_at_37),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_37._loop_at_37 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_37_rename_at_37,das_invoke_lambda<TArray<int32_t>>::invoke_cmres<TArray<int32_t> &>(__context__,____this_rename_at_37.blk,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_37.w))));
+	das_copy(____this_rename_at_37.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_37._loop_at_37),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378 ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 )
+{
+	finalize_e4e346397db1da55(__context__,das_arg<_lambda_thismodule_50_23_4>::pass(das_deref(__context__,____this_rename_at_50)));
+	das_delete_lambda_struct<_lambda_thismodule_50_23_4 *>::clear(__context__,____this_rename_at_50);
+}
+
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_23b6a451d4c31fe8 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_50_32;
+	switch (____this_rename_at_50.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_50._loop_at_50,true);
+	das_move(____this_rename_at_50._source_0_at_50,(_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_50.x), 0, 4);
+	das_copy(____this_rename_at_50._pvar_0_at_50,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50.x)));
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_50._loop_at_50 )
+	{
+		goto label_5;
+	};
+	if ( !((SimPolicy<int32_t>::Mod(____this_rename_at_50.x,2,*__context__)) == 0) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield50_rename_at_50,das_ref(__context__,____this_rename_at_50.x));
+	das_copy(____this_rename_at_50.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 )
+{
+	finalize_7e62c95ba3669c0e(__context__,das_arg<_lambda_thismodule_56_21_10>::pass(das_deref(__context__,____this_rename_at_56)));
+	das_delete_lambda_struct<_lambda_thismodule_56_21_10 *>::clear(__context__,____this_rename_at_56);
+}
+
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_98257abb2a360b0d ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56, TArray<int32_t> &  ___yield_56_rename_at_56 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	TArray<int32_t> _temp_make_local_56_48;
+	TDim<int32_t,2> _temp_make_local_56_80;
+	switch (____this_rename_at_56.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_56._loop_at_56,true);
+	das_move(____this_rename_at_56._source_0_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4)))));
+	memset(&(____this_rename_at_56.x), 0, 4);
+	das_copy(____this_rename_at_56._pvar_0_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_56.x)));
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_56._loop_at_56 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_56_rename_at_56,(_temp_make_local_56_48 = (_Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_56_80(0,__context__) = ____this_rename_at_56.x;
+		_temp_make_local_56_80(1,__context__) = 2;
+		return _temp_make_local_56_80;
+	})()))))));
+	das_copy(____this_rename_at_56.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0 ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 )
+{
+	finalize_8d49d3be2563d419(__context__,das_arg<_lambda_thismodule_71_25_14>::pass(das_deref(__context__,____this_rename_at_71)));
+	das_delete_lambda_struct<_lambda_thismodule_71_25_14 *>::clear(__context__,____this_rename_at_71);
+}
+
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_d3dd6e415d58c429 ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71, int32_t __x_rename_at_71 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_71,2,*__context__)) == 0);
+}
+
+inline void _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 )
+{
+	finalize_8f217ed02c7d43f1(__context__,das_arg<_lambda_thismodule_85_28_1>::pass(das_deref(__context__,____this_rename_at_85)));
+	das_delete_lambda_struct<_lambda_thismodule_85_28_1 *>::clear(__context__,____this_rename_at_85);
+}
+
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_cb7acd9379a60377 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85, int32_t __x_rename_at_85 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_85 + __x_rename_at_85);
+}
+
+inline void _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 )
+{
+	finalize_75919cb3423249cf(__context__,das_arg<_lambda_thismodule_90_14_11>::pass(das_deref(__context__,____this_rename_at_90)));
+	das_delete_lambda_struct<_lambda_thismodule_90_14_11 *>::clear(__context__,____this_rename_at_90);
+}
+
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_a695c89c641e9f31 ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90, TArray<int32_t> &  ___yield_90_rename_at_90 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_90_32;
+	TArray<int32_t> _temp_make_local_90_48;
+	TDim<int32_t,2> _temp_make_local_90_80;
+	switch (____this_rename_at_90.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_90._loop_at_90,true);
+	das_move(____this_rename_at_90._source_0_at_90,(_temp_make_local_90_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_90.x), 0, 4);
+	das_copy(____this_rename_at_90._pvar_0_at_90,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_90.x)));
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_90._loop_at_90 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_90_rename_at_90,(_temp_make_local_90_48 = (_Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_90_80(0,__context__) = ____this_rename_at_90.x;
+		_temp_make_local_90_80(1,__context__) = 2;
+		return _temp_make_local_90_80;
+	})()))))));
+	das_copy(____this_rename_at_90.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454 ( Context * __context__, _lambda_thismodule_91_25_27 * ____this_rename_at_91 )
+{
+	finalize_cfd3426561e2e7e5(__context__,das_arg<_lambda_thismodule_91_25_27>::pass(das_deref(__context__,____this_rename_at_91)));
+	das_delete_lambda_struct<_lambda_thismodule_91_25_27 *>::clear(__context__,____this_rename_at_91);
+}
+
+inline bool _Func_lambda_thismodule_91_25_27_0x60_function_62a7a09ac176e772 ( Context * __context__, _lambda_thismodule_91_25_27 &  ____this_rename_at_91, TArray<int32_t> const  &  __x_rename_at_91 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_91(0,__context__),2,*__context__)) == 0);
+}
+
+inline void _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 )
+{
+	finalize_6eaa1c4f569102fc(__context__,das_arg<_lambda_thismodule_92_36_32>::pass(das_deref(__context__,____this_rename_at_92)));
+	das_delete_lambda_struct<_lambda_thismodule_92_36_32 *>::clear(__context__,____this_rename_at_92);
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_b78fbe9676275623 ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92, TArray<int32_t> const  &  __x_rename_at_92 )
+{
+	TDim<int32_t,3> _temp_make_local_92_32;
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(_Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_92_32(0,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_32(1,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_32(2,__context__) = __x_rename_at_92(0,__context__);
+		return _temp_make_local_92_32;
+	})()))));
+}
+
+inline void _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 )
+{
+	finalize_cdc2fc53315b9882(__context__,das_arg<_lambda_thismodule_93_29_35>::pass(das_deref(__context__,____this_rename_at_93)));
+	das_delete_lambda_struct<_lambda_thismodule_93_29_35 *>::clear(__context__,____this_rename_at_93);
+}
+
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_b0d1910de5a9c7a5 ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93, TArray<int32_t> const  &  __x_rename_at_93 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_93(0,__context__));
+}
+
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  &  __x_rename_at_23 )
+{
+	return das_auto_cast<int32_t>::cast(das_get_tuple_field<int32_t,0>::get(__x_rename_at_23));
+}
+
+inline bool _Func_0x60_is_same_590802a3ad1ce37b ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : array<int> const&
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __x_iterator(__a_rename_at_37);
+		TArray<int32_t> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__b_rename_at_37);
+		TArray<int32_t> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_eccf4912248d674d(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_0x60_is_same_97c40271e1b9fd95 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : tuple<int;float> const&
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __x_iterator(__a_rename_at_37);
+		TTuple<8,int32_t,float> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : tuple<int;float> const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __y_iterator(__b_rename_at_37);
+		TTuple<8,int32_t,float> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_d77cb657768af39a(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_0x60_is_same_76c357069204466c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__a_rename_at_37);
+		int32_t __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __y_iterator(__b_rename_at_37);
+		int32_t __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( __x_rename_at_38 != __y_rename_at_38 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void _Func_0x60_verify_14_c3c8eadf66ac49ff ( Context * __context__, TArray<TArray<int32_t>> const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const&
+		das_iterator<TArray<TArray<int32_t>> const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  * __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT((((*__y_rename_at_44)(0,__context__) == __x_rename_at_44) && ((*__y_rename_at_44)(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline void _Func_0x60_verify_14_7ef312f50721678e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT(((__y_rename_at_44(0,__context__) == __x_rename_at_44) && (__y_rename_at_44(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline void _Func_0x60_verify_even_80adb3e94fb860c4 ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline void _Func_0x60_verify_even_eefc0d72cf85e86 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__arr_rename_at_19);
+		int32_t __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT((__x_rename_at_20 == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline void _Func_0x60_verify_even_7e1644f384b5d5ac ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline int32_t add_17f8810c9c570b5a ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_15 + __b_rename_at_15);
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_298c4ba2da976305 ( Context * __context__, TArray<TArray<int32_t>> const  &  __a_rename_at_258 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_259; das_zero(__it_rename_at_259);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_259),__a_rename_at_258,24,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_259);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_2d3d435a4c8a02ad ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  __a_rename_at_258 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_259; das_zero(__it_rename_at_259);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_259),__a_rename_at_258,8,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_259);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_258 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_259; das_zero(__it_rename_at_259);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_259),__a_rename_at_258,4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_259);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_69d7e7bb51ea3de6 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t>)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_ba1451246e410d44 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_514b08b1e7149328 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((bool)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((bool))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((bool))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_d7a87ffd28768e01 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_39f24952079a2b12 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_269 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_270; das_zero(__it_rename_at_270);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_270),__lam_rename_at_269,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_270);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_269 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_270; das_zero(__it_rename_at_270);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_270),__lam_rename_at_269,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_270);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_576a75d40473b6b2 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_269 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_270; das_zero(__it_rename_at_270);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_270),__lam_rename_at_269,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_270);
+}
+
+inline void _Funcbuiltin_0x60_emplace_cbf332071aecae6a ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_49, TArray<int32_t> &  __value_rename_at_49 )
+{
+	das_move(__Arr_rename_at_49(builtin_array_push_back(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_49),24,__context__),__context__),__value_rename_at_49);
+}
+
+inline void _Funcbuiltin_0x60_finalize_242c8c79790d8651 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_186);
+		TArray<int32_t> * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_186),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_e1c35de9ada57daf ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : tuple<int;float> aka TT&
+		das_iterator<TArray<TTuple<8,int32_t,float>>> __aV_iterator(__a_rename_at_186);
+		TTuple<8,int32_t,float> * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_85431c6f80690d63 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_61, TArray<int32_t> const  &  __value_rename_at_61 )
+{
+	_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_61(builtin_array_push_back_zero(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_61),24,__context__),__context__)),__value_rename_at_61);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_a3d92d5b7b06b77c ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __Arr_rename_at_61, TTuple<8,int32_t,float> const  &  __value_rename_at_61 )
+{
+	das_copy(__Arr_rename_at_61(builtin_array_push_back_zero(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__Arr_rename_at_61),8,__context__),__context__),__value_rename_at_61);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_9da63e78acf395d5 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_61, int32_t __value_rename_at_61 )
+{
+	das_copy(__Arr_rename_at_61(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_61),4,__context__),__context__),__value_rename_at_61);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_285 )
+{
+	TArray<int32_t> __arr_rename_at_286; das_zero(__arr_rename_at_286);
+	{
+		bool __need_loop_287 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_285);
+		int32_t __x_rename_at_287;
+		__need_loop_287 = __x_iterator.first(__context__,(__x_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __x_iterator.next(__context__,(__x_rename_at_287)) )
+		{
+			_Funcbuiltin_0x60_push_clone_9da63e78acf395d5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_286),__x_rename_at_287);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_287));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_286);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_5baa820607536fa4 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_298 )
+{
+	TArray<int32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_299),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_298 )
+{
+	TArray<int32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_299),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_299);
+}
+
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_127 )
+{
+	memset(&(____this_rename_at_127), 0, 8);
+}
+
+inline void finalize_a9d0ed6e96725931 ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),__context__);
+	memset(&(____this_rename_at_106), 0, 40);
+}
+
+inline void finalize_ffeba83554a107e5 ( Context * __context__, _lambda_thismodule_10_12_20 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 56);
+}
+
+inline void finalize_c07e639f98d956be ( Context * __context__, _lambda_thismodule_10_12_21 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 64);
+}
+
+inline void finalize_4501d8c7efc415b6 ( Context * __context__, _lambda_thismodule_114_12_19 &  ____this_rename_at_114 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_114.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114._source_0_at_115),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_114.___source_0_at_119_rename_at_119),__context__);
+	memset(&(____this_rename_at_114), 0, 112);
+}
+
+inline void finalize_4e0f4bc7b8ca2ddf ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115 )
+{
+	memset(&(____this_rename_at_115), 0, 8);
+}
+
+inline void finalize_2b52cc14974eb289 ( Context * __context__, _lambda_thismodule_126_12_28 &  ____this_rename_at_126 )
+{
+	_Funcbuiltin_0x60_finalize_e1c35de9ada57daf(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_126.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126._source_0_at_127),__context__);
+	finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_126.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),__context__);
+	memset(&(____this_rename_at_126), 0, 112);
+}
+
+inline void finalize_a646fc072953826 ( Context * __context__, _lambda_thismodule_126_12_29 &  ____this_rename_at_126 )
+{
+	_Funcbuiltin_0x60_finalize_242c8c79790d8651(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_126.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126._source_0_at_127),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_126.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_126.___source_0_at_131_rename_at_131),__context__);
+	memset(&(____this_rename_at_126), 0, 128);
+}
+
+inline void finalize_99b4eff0b688c844 ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139 )
+{
+	memset(&(____this_rename_at_139), 0, 8);
+}
+
+inline void finalize_e7f1877f7e5421e0 ( Context * __context__, _lambda_thismodule_140_12_22 &  ____this_rename_at_140 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_0_at_140),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_140._source_1_at_140),__context__);
+	memset(&(____this_rename_at_140), 0, 88);
+}
+
+inline void finalize_1a0bb91605bff14a ( Context * __context__, _lambda_thismodule_146_12_31 &  ____this_rename_at_146 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_146._source_0_at_146),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),__context__);
+	memset(&(____this_rename_at_146), 0, 88);
+}
+
+inline void finalize_147a429eb5e3cbec ( Context * __context__, _lambda_thismodule_146_12_33 &  ____this_rename_at_146 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_146._source_0_at_146),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_146._source_1_at_146),__context__);
+	memset(&(____this_rename_at_146), 0, 88);
+}
+
+inline void finalize_5e67e3bae091c622 ( Context * __context__, _lambda_thismodule_155_8_2 &  ____this_rename_at_155 )
+{
+	memset(&(____this_rename_at_155), 0, 16);
+}
+
+inline void finalize_e936e15940b27451 ( Context * __context__, _lambda_thismodule_162_8_3 &  ____this_rename_at_162 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_162._source_0_at_165),__context__);
+	memset(&(____this_rename_at_162), 0, 48);
+}
+
+inline void finalize_790215f236547953 ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163 )
+{
+	memset(&(____this_rename_at_163), 0, 8);
+}
+
+inline void finalize_90ffa732bfe8521f ( Context * __context__, _lambda_thismodule_16_12_30 &  ____this_rename_at_16 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_16.w));
+	memset(&(____this_rename_at_16), 0, 80);
+}
+
+inline void finalize_1bb28fe166db1ff8 ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172 )
+{
+	memset(&(____this_rename_at_172), 0, 8);
+}
+
+inline void finalize_6a14a117832a47b4 ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180 )
+{
+	memset(&(____this_rename_at_180), 0, 8);
+}
+
+inline void finalize_49ff1a0658524f07 ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),__context__);
+	memset(&(____this_rename_at_227), 0, 40);
+}
+
+inline void finalize_da9a89580c66c5cf ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),__context__);
+	memset(&(____this_rename_at_232), 0, 40);
+}
+
+inline void finalize_cb84739dfec92af7 ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),__context__);
+	memset(&(____this_rename_at_235), 0, 40);
+}
+
+inline void finalize_3110b281c7deafcb ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),__context__);
+	memset(&(____this_rename_at_240), 0, 40);
+}
+
+inline void finalize_3d9c85063ca4a8bd ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),__context__);
+	memset(&(____this_rename_at_243), 0, 40);
+}
+
+inline void finalize_a599eea550527dd4 ( Context * __context__, _lambda_thismodule_32_12_23 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 56);
+}
+
+inline void finalize_a63a3f13530d06d5 ( Context * __context__, _lambda_thismodule_32_12_24 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 64);
+}
+
+inline void finalize_98cb053c4bf3181e ( Context * __context__, _lambda_thismodule_32_12_25 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 64);
+}
+
+inline void finalize_d87f2b2985e6b0e7 ( Context * __context__, _lambda_thismodule_32_12_26 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 64);
+}
+
+inline void finalize_b94e81e70e15931b ( Context * __context__, _lambda_thismodule_32_12_36 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_32.w));
+	memset(&(____this_rename_at_32), 0, 80);
+}
+
+inline void finalize_84d8c7cf0e6c730f ( Context * __context__, _lambda_thismodule_37_12_34 &  ____this_rename_at_37 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),__context__);
+	memset(&(____this_rename_at_37), 0, 64);
+}
+
+inline void finalize_e4e346397db1da55 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),__context__);
+	memset(&(____this_rename_at_50), 0, 40);
+}
+
+inline void finalize_7e62c95ba3669c0e ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),__context__);
+	memset(&(____this_rename_at_56), 0, 40);
+}
+
+inline void finalize_8d49d3be2563d419 ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71 )
+{
+	memset(&(____this_rename_at_71), 0, 8);
+}
+
+inline void finalize_8f217ed02c7d43f1 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 8);
+}
+
+inline void finalize_75919cb3423249cf ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),__context__);
+	memset(&(____this_rename_at_90), 0, 40);
+}
+
+inline void finalize_cfd3426561e2e7e5 ( Context * __context__, _lambda_thismodule_91_25_27 &  ____this_rename_at_91 )
+{
+	memset(&(____this_rename_at_91), 0, 8);
+}
+
+inline void finalize_6eaa1c4f569102fc ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92 )
+{
+	memset(&(____this_rename_at_92), 0, 8);
+}
+
+inline void finalize_cdc2fc53315b9882 ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93 )
+{
+	memset(&(____this_rename_at_93), 0, 8);
+}
+
+inline bool _Funcfunctional_0x60_all_af66043144506e5d ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_101 )
+{
+	{
+		bool __need_loop_106 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_101);
+		bool __x_rename_at_106;
+		__need_loop_106 = __x_iterator.first(__context__,(__x_rename_at_106)) && __need_loop_106;
+		for ( ; __need_loop_106 ; __need_loop_106 = __x_iterator.next(__context__,(__x_rename_at_106)) )
+		{
+			if ( !__x_rename_at_106 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_106));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_90 )
+{
+	{
+		bool __need_loop_95 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_90);
+		bool __x_rename_at_95;
+		__need_loop_95 = __x_iterator.first(__context__,(__x_rename_at_95)) && __need_loop_95;
+		for ( ; __need_loop_95 ; __need_loop_95 = __x_iterator.next(__context__,(__x_rename_at_95)) )
+		{
+			if ( __x_rename_at_95 )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_95));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  &  __it_rename_at_90 )
+{
+	{
+		bool __need_loop_95 = true;
+		// x : bool const&
+		das_iterator<TDim<bool,2> const > __x_iterator(__it_rename_at_90);
+		bool const  * __x_rename_at_95;
+		__need_loop_95 = __x_iterator.first(__context__,(__x_rename_at_95)) && __need_loop_95;
+		for ( ; __need_loop_95 ; __need_loop_95 = __x_iterator.next(__context__,(__x_rename_at_95)) )
+		{
+			if ( (*__x_rename_at_95) )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_95));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_d104f003ed40f81d ( Context * __context__, int32_t __start_rename_at_153, int32_t __step_rename_at_153 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_155_8_2>::make(__context__,&__type_info__fdce115e,(([&]() -> _lambda_thismodule_155_8_2 {
+		_lambda_thismodule_155_8_2 __mks_155;
+		das_copy((__mks_155.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_155_8_2`function _lambda_thismodule_155_8_2 int#ref*/ 1741130642u))));
+		das_copy((__mks_155.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_155_8_2`finazlier #ptr#_lambda_thismodule_155_8_2#explicit*/ 4001266606u))));
+		das_copy((__mks_155.start),(__start_rename_at_153));
+		das_copy((__mks_155.step),(__step_rename_at_153));
+		return __mks_155;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_e65840607303287d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_111 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_39f24952079a2b12(__context__,das_ascend<bool,_lambda_thismodule_126_12_29>::make(__context__,&__type_info__82837ab4,(([&]() -> _lambda_thismodule_126_12_29 {
+		_lambda_thismodule_126_12_29 __mks_125;
+		das_zero(__mks_125);
+		das_copy((__mks_125.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_126_12_29`function _lambda_thismodule_126_12_29 #ptr##array#int#ref*/ 887154805u))));
+		das_copy((__mks_125.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_126_12_29`finazlier #ptr#_lambda_thismodule_126_12_29#explicit*/ 2996533614u))));
+		das_move((__mks_125.src),(__src_rename_at_111));
+		return __mks_125;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_9307cbe86dc18493 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __src_rename_at_111 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e(__context__,das_ascend<bool,_lambda_thismodule_126_12_28>::make(__context__,&__type_info__83837c47,(([&]() -> _lambda_thismodule_126_12_28 {
+		_lambda_thismodule_126_12_28 __mks_125;
+		das_zero(__mks_125);
+		das_copy((__mks_125.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_126_12_28`function _lambda_thismodule_126_12_28 #ptr##tuple#int#float#ref*/ 3911743107u))));
+		das_copy((__mks_125.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_126_12_28`finazlier #ptr#_lambda_thismodule_126_12_28#explicit*/ 3027506350u))));
+		das_move((__mks_125.src),(__src_rename_at_111));
+		return __mks_125;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_5b23e7a7385574ed ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_111 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_114_12_19>::make(__context__,&__type_info__8ba02c02,(([&]() -> _lambda_thismodule_114_12_19 {
+		_lambda_thismodule_114_12_19 __mks_113;
+		das_zero(__mks_113);
+		das_copy((__mks_113.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_114_12_19`function _lambda_thismodule_114_12_19 int#ref*/ 2350468530u))));
+		das_copy((__mks_113.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_114_12_19`finazlier #ptr#_lambda_thismodule_114_12_19#explicit*/ 1525407158u))));
+		das_move((__mks_113.src),(__src_rename_at_111));
+		return __mks_113;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_2f1bfef5b9185064 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcfunctional_0x60_filter_any_3cd29644344d3ab4(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_4f1dc6df7c9a047b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_25, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_25 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_4f440bfcbccbc0d0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_25),__blk_rename_at_25));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_5e72c2679447b323(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_3cd29644344d3ab4 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_39f24952079a2b12(__context__,das_ascend<bool,_lambda_thismodule_16_12_30>::make(__context__,&__type_info__2125f168,(([&]() -> _lambda_thismodule_16_12_30 {
+		_lambda_thismodule_16_12_30 __mks_15;
+		das_zero(__mks_15);
+		das_copy((__mks_15.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_12_30`function _lambda_thismodule_16_12_30 #ptr##array#int#ref*/ 1734875259u))));
+		das_copy((__mks_15.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_12_30`finazlier #ptr#_lambda_thismodule_16_12_30#explicit*/ 418982124u))));
+		das_move((__mks_15.blk),(__blk_rename_at_7));
+		das_move((__mks_15.src),(__src_rename_at_7));
+		return __mks_15;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_4f440bfcbccbc0d0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_10_12_20>::make(__context__,&__type_info__3770203,(([&]() -> _lambda_thismodule_10_12_20 {
+		_lambda_thismodule_10_12_20 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_20`function _lambda_thismodule_10_12_20 int#ref*/ 396385386u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_20`finazlier #ptr#_lambda_thismodule_10_12_20#explicit*/ 2649875866u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_5e72c2679447b323 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_10_12_21>::make(__context__,&__type_info__2770070,(([&]() -> _lambda_thismodule_10_12_21 {
+		_lambda_thismodule_10_12_21 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_21`function _lambda_thismodule_10_12_21 int#ref*/ 369970312u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_10_12_21`finazlier #ptr#_lambda_thismodule_10_12_21#explicit*/ 1110196808u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline bool _Funcfunctional_0x60_is_equal_9cf00a9700259a54 ( Context * __context__, int32_t __a_rename_at_169, int32_t __b_rename_at_169 )
+{
+	return das_auto_cast<bool>::cast(__a_rename_at_169 == __b_rename_at_169);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_fc7bf6c00c789478 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_39f24952079a2b12(__context__,das_ascend<bool,_lambda_thismodule_146_12_33>::make(__context__,&__type_info__20085471,(([&]() -> _lambda_thismodule_146_12_33 {
+		_lambda_thismodule_146_12_33 __mks_145;
+		das_zero(__mks_145);
+		das_copy((__mks_145.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_146_12_33`function _lambda_thismodule_146_12_33 #ptr##array#int#ref*/ 4097947609u))));
+		das_copy((__mks_145.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_146_12_33`finazlier #ptr#_lambda_thismodule_146_12_33#explicit*/ 2130849318u))));
+		das_move((__mks_145.src),(__src_rename_at_137));
+		das_copy((__mks_145.start),(__start_rename_at_137));
+		das_copy((__mks_145.stop),(__stop_rename_at_137));
+		return __mks_145;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_c5d1237505bcea35 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e(__context__,das_ascend<bool,_lambda_thismodule_146_12_31>::make(__context__,&__type_info__1e08514b,(([&]() -> _lambda_thismodule_146_12_31 {
+		_lambda_thismodule_146_12_31 __mks_145;
+		das_zero(__mks_145);
+		das_copy((__mks_145.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_146_12_31`function _lambda_thismodule_146_12_31 #ptr##tuple#int#float#ref*/ 3828264927u))));
+		das_copy((__mks_145.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_146_12_31`finazlier #ptr#_lambda_thismodule_146_12_31#explicit*/ 2251271730u))));
+		das_move((__mks_145.src),(__src_rename_at_137));
+		das_copy((__mks_145.start),(__start_rename_at_137));
+		das_copy((__mks_145.stop),(__stop_rename_at_137));
+		return __mks_145;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_784f1c420c07c72d ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_137, int32_t __start_rename_at_137, int32_t __stop_rename_at_137 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_140_12_22>::make(__context__,&__type_info__68dcf3f9,(([&]() -> _lambda_thismodule_140_12_22 {
+		_lambda_thismodule_140_12_22 __mks_139;
+		das_zero(__mks_139);
+		das_copy((__mks_139.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_140_12_22`function _lambda_thismodule_140_12_22 int#ref*/ 2971351758u))));
+		das_copy((__mks_139.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_140_12_22`finazlier #ptr#_lambda_thismodule_140_12_22#explicit*/ 2073673478u))));
+		das_move((__mks_139.src),(__src_rename_at_137));
+		das_copy((__mks_139.start),(__start_rename_at_137));
+		das_copy((__mks_139.stop),(__stop_rename_at_137));
+		return __mks_139;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_7c9f3865b7a3940a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_47, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_94f2fe7992a68f2e(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_d53fb0c2d9dfb3e9 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcfunctional_0x60_map_any_e0d846ac25c8ccfe(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_b229592d62268192 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_51, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_51 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_441075f1d3af98ef(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_51),__blk_rename_at_51));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_6b992b192f6d0379 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_Funcfunctional_0x60_map_any_eb9f55c0847980e0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_69271239b8e77c4b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((bool))>::cast(_Funcfunctional_0x60_map_any_d8701f9e7666a39f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_4653403510c37584 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_3c50bea69955cdd6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_94f2fe7992a68f2e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_29, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_32_12_36>::make(__context__,&__type_info__221c08f4,(([&]() -> _lambda_thismodule_32_12_36 {
+		_lambda_thismodule_32_12_36 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_36`function _lambda_thismodule_32_12_36 int#ref*/ 2053712224u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_36`finazlier #ptr#_lambda_thismodule_32_12_36#explicit*/ 4255784184u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_e0d846ac25c8ccfe ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_29, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,_lambda_thismodule_37_12_34>::make(__context__,&__type_info__8667970d,(([&]() -> _lambda_thismodule_37_12_34 {
+		_lambda_thismodule_37_12_34 __mks_36;
+		das_zero(__mks_36);
+		das_copy((__mks_36.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_37_12_34`function _lambda_thismodule_37_12_34 #array#int*/ 810178407u))));
+		das_copy((__mks_36.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_37_12_34`finazlier #ptr#_lambda_thismodule_37_12_34#explicit*/ 2159006486u))));
+		das_move((__mks_36.blk),(__blk_rename_at_29));
+		das_move((__mks_36.src),(__src_rename_at_29));
+		return __mks_36;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_441075f1d3af98ef ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_32_12_23>::make(__context__,&__type_info__271e4f6a,(([&]() -> _lambda_thismodule_32_12_23 {
+		_lambda_thismodule_32_12_23 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_23`function _lambda_thismodule_32_12_23 int#ref*/ 919910708u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_23`finazlier #ptr#_lambda_thismodule_32_12_23#explicit*/ 2518212476u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_eb9f55c0847980e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,_lambda_thismodule_32_12_26>::make(__context__,&__type_info__241e4ab1,(([&]() -> _lambda_thismodule_32_12_26 {
+		_lambda_thismodule_32_12_26 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_26`function _lambda_thismodule_32_12_26 #tuple#int#float*/ 3480392853u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_26`finazlier #ptr#_lambda_thismodule_32_12_26#explicit*/ 1410928214u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_d8701f9e7666a39f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((bool))>::cast(_Funcbuiltin_0x60_each_514b08b1e7149328(__context__,das_ascend<bool,_lambda_thismodule_32_12_24>::make(__context__,&__type_info__221e478b,(([&]() -> _lambda_thismodule_32_12_24 {
+		_lambda_thismodule_32_12_24 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_24`function _lambda_thismodule_32_12_24 bool#ref*/ 1051460537u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_24`finazlier #ptr#_lambda_thismodule_32_12_24#explicit*/ 988225178u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_3c50bea69955cdd6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_32_12_25>::make(__context__,&__type_info__211e45f8,(([&]() -> _lambda_thismodule_32_12_25 {
+		_lambda_thismodule_32_12_25 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_25`function _lambda_thismodule_32_12_25 int#ref*/ 1405255260u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_32_12_25`finazlier #ptr#_lambda_thismodule_32_12_25#explicit*/ 2654035980u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline bool _Funcfunctional_0x60_not_47ae1464a98e0c31 ( Context * __context__, bool __x_rename_at_175 )
+{
+	return das_auto_cast<bool>::cast(!__x_rename_at_175);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_26999405e8feb1ae ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_78, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __blk_rename_at_78 )
+{
+	return das_auto_cast<TTuple<8,int32_t,float>>::cast(_Funcfunctional_0x60_reduce_any_f4b3c153b2fa4ed8(__context__,__it_rename_at_78,__blk_rename_at_78));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_2fc220e9df504873 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_78, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_78 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_e5cc70a024b84107(__context__,__it_rename_at_78,__blk_rename_at_78));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_d0cd73f6a56dd127 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_74, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_74 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_8c7e16d91347e748(__context__,__it_rename_at_74,__blk_rename_at_74));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_3d9e9ac16cb763c3 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_70, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_70 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_3e33db80687dd5b0(__context__,__it_rename_at_70,__blk_rename_at_70));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_3cdc98b626551694 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_78, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_78 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_ba55ccd7fef6c17c(__context__,__it_rename_at_78,__blk_rename_at_78));
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_f4b3c153b2fa4ed8 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_56, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __functor_rename_at_56 )
+{
+	TTuple<8,int32_t,float> __left_rename_at_57; das_zero(__left_rename_at_57);
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : tuple<int;float> aka TT const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __right_iterator(__it_rename_at_56);
+		TTuple<8,int32_t,float> const  __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<TTuple<8,int32_t,float> const >::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> const  &>(__context__,__functor_rename_at_56,das_arg<TTuple<8,int32_t,float>>::pass(__left_rename_at_57),__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return das_auto_cast<TTuple<8,int32_t,float>>::cast(__left_rename_at_57);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_e5cc70a024b84107 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_8c7e16d91347e748 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_3e33db80687dd5b0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_ba55ccd7fef6c17c ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __right_iterator(__it_rename_at_56);
+		int32_t const  * __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,(*__right_rename_at_59));
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,__functor_rename_at_56,__left_rename_at_57,(*__right_rename_at_59)));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__);
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_d9d27c291dcbe8dc ( Context * __context__, int32_t __value_rename_at_160, int32_t __count_rename_at_160 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_162_8_3>::make(__context__,&__type_info__3a36734f,(([&]() -> _lambda_thismodule_162_8_3 {
+		_lambda_thismodule_162_8_3 __mks_161;
+		das_zero(__mks_161);
+		das_copy((__mks_161.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_162_8_3`function _lambda_thismodule_162_8_3 int#ref#explicit*/ 3882663371u))));
+		das_copy((__mks_161.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_162_8_3`finazlier #ptr#_lambda_thismodule_162_8_3#explicit*/ 2482295226u))));
+		das_copy((__mks_161.count),(__count_rename_at_160));
+		das_copy((__mks_161.value),(__value_rename_at_160));
+		return __mks_161;
+	})()))));
+}
+
+inline int32_t _Funcfunctional_0x60_sum_753716cc0b2bd341 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_83 )
+{
+	int32_t __temp_rename_at_84 = 0;
+	{
+		bool __need_loop_85 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_83);
+		int32_t __x_rename_at_85;
+		__need_loop_85 = __x_iterator.first(__context__,(__x_rename_at_85)) && __need_loop_85;
+		for ( ; __need_loop_85 ; __need_loop_85 = __x_iterator.next(__context__,(__x_rename_at_85)) )
+		{
+			__temp_rename_at_84 += __x_rename_at_85;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_85));
+	};
+	return das_auto_cast<int32_t>::cast(__temp_rename_at_84);
+}
+
+inline bool is_even_d55850ffa9bd4b94 ( Context * __context__, int32_t __x_rename_at_9 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_9,2,*__context__)) == 0);
+}
+
+inline bool test_2d6b405414824ffe ( Context * __context__ ) { das_stack_prologue __prologue(__context__,1728,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_50_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_56_208;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_64_432;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_63_448;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_71_464;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_480;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_78_512;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_77_528;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_85_544;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_84_560;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_93_592;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_92_608;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_91_624;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_90_640;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_99_720;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_106_800;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_114_896;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_122_928;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_130_944;
+	TTuple<8,int32_t,float> _temp_make_local_140_960;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_139_976;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_138_992;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_148_1104;
+	TDim<bool,2> _temp_make_local_155_1120;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_163_1136;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_162_1152;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_172_1184;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_171_1200;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_180_1232;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_179_1248;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_191_1280;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_190_1296;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_199_1312;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_198_1328;
+	TArray<int32_t> _temp_make_local_208_1344;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_207_1376;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_206_1392;
+	TArray<int32_t> _temp_make_local_216_1408;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_215_1440;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_226_1456;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_225_1472;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_224_1488;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_1504;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_234_1536;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_233_1552;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_232_1568;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_235_1600;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_242_1632;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_241_1648;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_240_1664;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_243_1696;
+	_Func_0x60_verify_even_7e1644f384b5d5ac(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_50_32 = (_Funcbuiltin_0x60_each_ref_576a75d40473b6b2(__context__,das_ascend<bool,_lambda_thismodule_50_23_4>::make(__context__,&__type_info__df321397,(([&]() -> _lambda_thismodule_50_23_4 {
+		_lambda_thismodule_50_23_4 __mks_50;
+		das_zero(__mks_50);
+		das_copy((__mks_50.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_50_23_4`function _lambda_thismodule_50_23_4 #ptr#int#const#ref*/ 750696070u))));
+		das_copy((__mks_50.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_50_23_4`finazlier #ptr#_lambda_thismodule_50_23_4#explicit*/ 236906326u))));
+		return __mks_50;
+	})())))))));
+	_Func_0x60_verify_even_80adb3e94fb860c4(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,100));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__x_rename_at_53,2,*__context__)) == 0 )
+				{
+					_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+		};
+		return /* <- */ das_auto_cast<TArray<int32_t>>::cast(____acomp_53_rename_at_53);
+	})));
+	_Func_0x60_verify_14_7ef312f50721678e(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_56_208 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,_lambda_thismodule_56_21_10>::make(__context__,&__type_info__63564868,(([&]() -> _lambda_thismodule_56_21_10 {
+		_lambda_thismodule_56_21_10 __mks_56;
+		das_zero(__mks_56);
+		das_copy((__mks_56.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_56_21_10`function _lambda_thismodule_56_21_10 #array#int*/ 4255920945u))));
+		das_copy((__mks_56.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_56_21_10`finazlier #ptr#_lambda_thismodule_56_21_10#explicit*/ 1030389160u))));
+		return __mks_56;
+	})())))))));
+	_Func_0x60_verify_14_c3c8eadf66ac49ff(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_invoke<TArray<TArray<int32_t>>>::invoke_cmres(__context__,[&]()->TArray<TArray<int32_t>>{
+		TArray<TArray<int32_t>> ____acomp_59_rename_at_59; das_zero(____acomp_59_rename_at_59);
+		{
+			bool __need_loop_59 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(1,4));
+			int32_t __x_rename_at_59;
+			__need_loop_59 = __x_iterator.first(__context__,(__x_rename_at_59)) && __need_loop_59;
+			for ( ; __need_loop_59 ; __need_loop_59 = __x_iterator.next(__context__,(__x_rename_at_59)) )
+			{
+				TArray<int32_t> _temp_make_local_59_384;
+				TDim<int32_t,2> _temp_make_local_59_416;
+				_Funcbuiltin_0x60_emplace_cbf332071aecae6a(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),das_arg<TArray<int32_t>>::pass((_temp_make_local_59_384 = (_Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+					_temp_make_local_59_416(0,__context__) = __x_rename_at_59;
+					_temp_make_local_59_416(1,__context__) = 2;
+					return _temp_make_local_59_416;
+				})())))))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_59));
+		};
+		return /* <- */ das_auto_cast<TArray<TArray<int32_t>>>::cast(____acomp_59_rename_at_59);
+	})));
+	_Func_0x60_verify_even_eefc0d72cf85e86(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_64_432 = (_Funcfunctional_0x60_filter_4f1dc6df7c9a047b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_63_448 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100))))),Func(__context__->fnIdxByMangledName(/*is_even int#const*/ 3379734375u)))))));
+	_Func_0x60_verify_even_eefc0d72cf85e86(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_71_464 = (_Funcfunctional_0x60_filter_8cf8f8edf9d0fb39(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_70_480 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100))))),das_ascend<bool,_lambda_thismodule_71_25_14>::make(__context__,&__type_info__34f42543,(([&]() -> _lambda_thismodule_71_25_14 {
+		_lambda_thismodule_71_25_14 __mks_71;
+		das_copy((__mks_71.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_71_25_14`function _lambda_thismodule_71_25_14 int#const*/ 4064535644u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_71_25_14`finazlier #ptr#_lambda_thismodule_71_25_14#explicit*/ 2742810434u))));
+		return __mks_71;
+	})())))))));
+	_Func_0x60_verify_even_eefc0d72cf85e86(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_78_512 = (_Funcfunctional_0x60_map_b229592d62268192(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_77_528 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,50))))),Func(__context__->fnIdxByMangledName(/*twice int#const*/ 3225769558u)))))));
+	_Func_0x60_verify_even_eefc0d72cf85e86(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_85_544 = (_Funcfunctional_0x60_map_4653403510c37584(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_84_560 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,50))))),das_ascend<int32_t,_lambda_thismodule_85_28_1>::make(__context__,&__type_info__4f1f8183,(([&]() -> _lambda_thismodule_85_28_1 {
+		_lambda_thismodule_85_28_1 __mks_85;
+		das_copy((__mks_85.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_85_28_1`function _lambda_thismodule_85_28_1 int#const*/ 3418484276u))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_85_28_1`finazlier #ptr#_lambda_thismodule_85_28_1#explicit*/ 2192713426u))));
+		return __mks_85;
+	})())))))));
+	_Func_0x60_verify_even_eefc0d72cf85e86(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_93_592 = (_Funcfunctional_0x60_map_7c9f3865b7a3940a(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_92_608 = (_Funcfunctional_0x60_map_d53fb0c2d9dfb3e9(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_91_624 = (_Funcfunctional_0x60_filter_2f1bfef5b9185064(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_90_640 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,_lambda_thismodule_90_14_11>::make(__context__,&__type_info__34ea7395,(([&]() -> _lambda_thismodule_90_14_11 {
+		_lambda_thismodule_90_14_11 __mks_90;
+		das_zero(__mks_90);
+		das_copy((__mks_90.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_90_14_11`function _lambda_thismodule_90_14_11 #array#int*/ 2190446071u))));
+		das_copy((__mks_90.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_90_14_11`finazlier #ptr#_lambda_thismodule_90_14_11#explicit*/ 1882412862u))));
+		return __mks_90;
+	})())))))),das_ascend<bool,_lambda_thismodule_91_25_27>::make(__context__,&__type_info__1983f0e3,(([&]() -> _lambda_thismodule_91_25_27 {
+		_lambda_thismodule_91_25_27 __mks_91;
+		das_copy((__mks_91.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_91_25_27`function _lambda_thismodule_91_25_27 #array#int#const*/ 4212962167u))));
+		das_copy((__mks_91.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_91_25_27`finazlier #ptr#_lambda_thismodule_91_25_27#explicit*/ 836161950u))));
+		return __mks_91;
+	})())))))),das_ascend<TArray<int32_t>,_lambda_thismodule_92_36_32>::make(__context__,&__type_info__fc8e246c,(([&]() -> _lambda_thismodule_92_36_32 {
+		_lambda_thismodule_92_36_32 __mks_92;
+		das_copy((__mks_92.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_92_36_32`function _lambda_thismodule_92_36_32 #array#int#const*/ 734032057u))));
+		das_copy((__mks_92.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_92_36_32`finazlier #ptr#_lambda_thismodule_92_36_32#explicit*/ 1584073180u))));
+		return __mks_92;
+	})())))))),das_ascend<int32_t,_lambda_thismodule_93_29_35>::make(__context__,&__type_info__8dc06b9a,(([&]() -> _lambda_thismodule_93_29_35 {
+		_lambda_thismodule_93_29_35 __mks_93;
+		das_copy((__mks_93.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_93_29_35`function _lambda_thismodule_93_29_35 #array#int#const*/ 3396376833u))));
+		das_copy((__mks_93.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_93_29_35`finazlier #ptr#_lambda_thismodule_93_29_35#explicit*/ 455764308u))));
+		return __mks_93;
+	})())))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_reduce_2fc220e9df504873(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_99_720 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_make_block<int32_t,int32_t,int32_t>(__context__,784,0,&__func_info__2e807d1c,[&](int32_t const  __x_rename_at_100, int32_t const  __y_rename_at_100)->int32_t{
+		return das_auto_cast<int32_t>::cast(__x_rename_at_100 + __y_rename_at_100);
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_reduce_3cdc98b626551694(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_106_800 = (_Funcbuiltin_0x60_each_ref_576a75d40473b6b2(__context__,das_ascend<bool,_lambda_thismodule_106_15_5>::make(__context__,&__type_info__fc05925b,(([&]() -> _lambda_thismodule_106_15_5 {
+		_lambda_thismodule_106_15_5 __mks_106;
+		das_zero(__mks_106);
+		das_copy((__mks_106.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_15_5`function _lambda_thismodule_106_15_5 #ptr#int#const#ref*/ 3363015182u))));
+		das_copy((__mks_106.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_15_5`finazlier #ptr#_lambda_thismodule_106_15_5#explicit*/ 536118726u))));
+		return __mks_106;
+	})())))))),das_make_block<int32_t,int32_t,int32_t>(__context__,880,0,&__func_info__2e807d1c,[&](int32_t const  __x_rename_at_107, int32_t const  __y_rename_at_107)->int32_t{
+		return das_auto_cast<int32_t>::cast(__x_rename_at_107 + __y_rename_at_107);
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_reduce_3d9e9ac16cb763c3(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_114_896 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<int32_t,_lambda_thismodule_115_27_15>::make(__context__,&__type_info__3bc97285,(([&]() -> _lambda_thismodule_115_27_15 {
+		_lambda_thismodule_115_27_15 __mks_115;
+		das_copy((__mks_115.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_115_27_15`function _lambda_thismodule_115_27_15 int#const int#const*/ 1418617037u))));
+		das_copy((__mks_115.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_115_27_15`finazlier #ptr#_lambda_thismodule_115_27_15#explicit*/ 455341414u))));
+		return __mks_115;
+	})()))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_reduce_d0cd73f6a56dd127(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_122_928 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_reduce_d0cd73f6a56dd127(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_130_944 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(45,46))))),Func(__context__->fnIdxByMangledName(/*add int#const int#const*/ 3151545828u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Func_0x60_first_7932efd700c6a809(__context__,das_arg<TTuple<8,int32_t,float>>::pass((_temp_make_local_140_960 = (_Funcfunctional_0x60_reduce_26999405e8feb1ae(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_139_976 = (_Funcfunctional_0x60_map_6b992b192f6d0379(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_138_992 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6>::make(__context__,&__type_info__a969907c,(([&]() -> _lambda_thismodule_139_28_6 {
+		_lambda_thismodule_139_28_6 __mks_139;
+		das_copy((__mks_139.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_28_6`function _lambda_thismodule_139_28_6 int#const*/ 2036236810u))));
+		das_copy((__mks_139.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_139_28_6`finazlier #ptr#_lambda_thismodule_139_28_6#explicit*/ 2627051912u))));
+		return __mks_139;
+	})())))))),das_make_block_cmres<TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const  &,TTuple<8,int32_t,float> const  &>(__context__,1072,0,&__func_info__56461723,[&](TTuple<8,int32_t,float> const  & __x_rename_at_140, TTuple<8,int32_t,float> const  & __y_rename_at_140)->TTuple<8,int32_t,float> const {
+		return das_auto_cast<TTuple<8,int32_t,float> const >::cast((([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_140;
+			das_get_tuple_field<int32_t,0>::get(__mkt_140) = (das_get_tuple_field<int32_t,0>::get(__x_rename_at_140) + das_get_tuple_field<int32_t,0>::get(__y_rename_at_140));
+			das_get_tuple_field<float,4>::get(__mkt_140) = 2.f;
+			return __mkt_140;
+		})()));
+	})))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_sum_753716cc0b2bd341(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_148_1104 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_any_a5606ed295f053c9(__context__,das_arg<TDim<bool,2>>::pass((([&]() -> TDim<bool,2>& {
+		_temp_make_local_155_1120(0,__context__) = true;
+		_temp_make_local_155_1120(1,__context__) = false;
+		return _temp_make_local_155_1120;
+	})())))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_47ae1464a98e0c31(__context__,_Funcfunctional_0x60_any_cf35c74e31a01f2b(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_163_1136 = (_Funcfunctional_0x60_map_69271239b8e77c4b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_162_1152 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_163_30_16>::make(__context__,&__type_info__45839f1,(([&]() -> _lambda_thismodule_163_30_16 {
+		_lambda_thismodule_163_30_16 __mks_163;
+		das_copy((__mks_163.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_163_30_16`function _lambda_thismodule_163_30_16 int#const*/ 2767717920u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_163_30_16`finazlier #ptr#_lambda_thismodule_163_30_16#explicit*/ 3072537446u))));
+		return __mks_163;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_all_af66043144506e5d(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_172_1184 = (_Funcfunctional_0x60_map_69271239b8e77c4b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_171_1200 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_172_30_17>::make(__context__,&__type_info__e09ef0a0,(([&]() -> _lambda_thismodule_172_30_17 {
+		_lambda_thismodule_172_30_17 __mks_172;
+		das_copy((__mks_172.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_172_30_17`function _lambda_thismodule_172_30_17 int#const*/ 1389251100u))));
+		das_copy((__mks_172.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_172_30_17`finazlier #ptr#_lambda_thismodule_172_30_17#explicit*/ 51605350u))));
+		return __mks_172;
+	})())))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_47ae1464a98e0c31(__context__,_Funcfunctional_0x60_all_af66043144506e5d(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_180_1232 = (_Funcfunctional_0x60_map_69271239b8e77c4b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_179_1248 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_180_30_18>::make(__context__,&__type_info__d238d5a8,(([&]() -> _lambda_thismodule_180_30_18 {
+		_lambda_thismodule_180_30_18 __mks_180;
+		das_copy((__mks_180.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_180_30_18`function _lambda_thismodule_180_30_18 int#const*/ 775482608u))));
+		das_copy((__mks_180.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_180_30_18`finazlier #ptr#_lambda_thismodule_180_30_18#explicit*/ 1043643394u))));
+		return __mks_180;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_sum_753716cc0b2bd341(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_191_1280 = (_Funcfunctional_0x60_islice_784f1c420c07c72d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_190_1296 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10))))),1,4))))),6)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,_Funcfunctional_0x60_sum_753716cc0b2bd341(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_199_1312 = (_Funcfunctional_0x60_islice_784f1c420c07c72d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_198_1328 = (_Funcfunctional_0x60_count_d104f003ed40f81d(__context__,0,10)))),0,10))))),450)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_208_1344 = (_Funcbuiltin_0x60_to_array_272b3119a8e7dcd7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_207_1376 = (_Funcfunctional_0x60_islice_784f1c420c07c72d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_206_1392 = (_Funcfunctional_0x60_repeat_d9d27c291dcbe8dc(__context__,10,0)))),0,5))))))))),5)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_9cf00a9700259a54(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_216_1408 = (_Funcbuiltin_0x60_to_array_272b3119a8e7dcd7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_215_1440 = (_Funcfunctional_0x60_repeat_d9d27c291dcbe8dc(__context__,10,6))))))))),6)));
+	DAS_VERIFY((_Func_0x60_is_same_76c357069204466c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_226_1456 = (_Funcfunctional_0x60_islice_784f1c420c07c72d(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_225_1472 = (_Funcfunctional_0x60_cycle_5b23e7a7385574ed(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_224_1488 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_227_1504 = (_Funcbuiltin_0x60_each_d7a87ffd28768e01(__context__,das_ascend<bool,_lambda_thismodule_227_19_7>::make(__context__,&__type_info__76b9d575,(([&]() -> _lambda_thismodule_227_19_7 {
+		_lambda_thismodule_227_19_7 __mks_227;
+		das_zero(__mks_227);
+		das_copy((__mks_227.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_227_19_7`function _lambda_thismodule_227_19_7 int#ref*/ 4238758950u))));
+		das_copy((__mks_227.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_227_19_7`finazlier #ptr#_lambda_thismodule_227_19_7#explicit*/ 3930856822u))));
+		return __mks_227;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_97c40271e1b9fd95(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_234_1536 = (_Funcfunctional_0x60_islice_c5d1237505bcea35(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_233_1552 = (_Funcfunctional_0x60_cycle_9307cbe86dc18493(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_232_1568 = (_Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,_lambda_thismodule_232_10_8>::make(__context__,&__type_info__636e62a1,(([&]() -> _lambda_thismodule_232_10_8 {
+		_lambda_thismodule_232_10_8 __mks_232;
+		das_zero(__mks_232);
+		das_copy((__mks_232.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_232_10_8`function _lambda_thismodule_232_10_8 #tuple#int#float*/ 4111723821u))));
+		das_copy((__mks_232.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_232_10_8`finazlier #ptr#_lambda_thismodule_232_10_8#explicit*/ 2522080934u))));
+		return __mks_232;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_235_1600 = (_Funcbuiltin_0x60_each_ba1451246e410d44(__context__,das_ascend<bool,_lambda_thismodule_235_18_9>::make(__context__,&__type_info__d27d2f5d,(([&]() -> _lambda_thismodule_235_18_9 {
+		_lambda_thismodule_235_18_9 __mks_235;
+		das_zero(__mks_235);
+		das_copy((__mks_235.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_235_18_9`function _lambda_thismodule_235_18_9 #tuple#int#float*/ 1552704661u))));
+		das_copy((__mks_235.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_235_18_9`finazlier #ptr#_lambda_thismodule_235_18_9#explicit*/ 1336584606u))));
+		return __mks_235;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_590802a3ad1ce37b(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_242_1632 = (_Funcfunctional_0x60_islice_fc7bf6c00c789478(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_241_1648 = (_Funcfunctional_0x60_cycle_e65840607303287d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_240_1664 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,_lambda_thismodule_240_10_12>::make(__context__,&__type_info__82115e6d,(([&]() -> _lambda_thismodule_240_10_12 {
+		_lambda_thismodule_240_10_12 __mks_240;
+		das_zero(__mks_240);
+		das_copy((__mks_240.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_240_10_12`function _lambda_thismodule_240_10_12 #array#int*/ 2903395623u))));
+		das_copy((__mks_240.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_240_10_12`finazlier #ptr#_lambda_thismodule_240_10_12#explicit*/ 596148886u))));
+		return __mks_240;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_243_1696 = (_Funcbuiltin_0x60_each_69d7e7bb51ea3de6(__context__,das_ascend<bool,_lambda_thismodule_243_18_13>::make(__context__,&__type_info__cf91711b,(([&]() -> _lambda_thismodule_243_18_13 {
+		_lambda_thismodule_243_18_13 __mks_243;
+		das_zero(__mks_243);
+		das_copy((__mks_243.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_243_18_13`function _lambda_thismodule_243_18_13 #array#int*/ 765802979u))));
+		das_copy((__mks_243.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_243_18_13`finazlier #ptr#_lambda_thismodule_243_18_13#explicit*/ 2716464154u))));
+		return __mks_243;
+	})())))))))));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline int32_t twice_7c65caf37efc07cb ( Context * __context__, int32_t __x_rename_at_12 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_12 + __x_rename_at_12);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncExclEqu_eccf4912248d674d
+		aotLib[0xb5deaae78c1b40b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_FuncExclEqu_eccf4912248d674d>>();
+	};
+		// _FuncExclEqu_d77cb657768af39a
+		aotLib[0xfdc2e077c71711a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  & , TTuple<8,int32_t,float> const  &  ),&_FuncExclEqu_d77cb657768af39a>>();
+	};
+		// _Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186
+		aotLib[0x2a9d5cc70f582199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 *  ),&_Func_lambda_thismodule_106_15_5_0x60_finazlier_8ac6e00dd2aa8186>>();
+	};
+		// _Func_lambda_thismodule_106_15_5_0x60_function_c56c9bbd12a56479
+		aotLib[0x6755dd0475a0bd4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_106_15_5 & , int32_t const  * &  ),&_Func_lambda_thismodule_106_15_5_0x60_function_c56c9bbd12a56479>>();
+	};
+		// _Func_lambda_thismodule_10_12_20_0x60_finazlier_f5030c9c02d793ea
+		aotLib[0xf66e5afbbb0e483f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_20 *  ),&_Func_lambda_thismodule_10_12_20_0x60_finazlier_f5030c9c02d793ea>>();
+	};
+		// _Func_lambda_thismodule_10_12_20_0x60_function_e979ac259afc8097
+		aotLib[0x875621e9b38313d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_20 & , int32_t &  ),&_Func_lambda_thismodule_10_12_20_0x60_function_e979ac259afc8097>>();
+	};
+		// _Func_lambda_thismodule_10_12_21_0x60_finazlier_d1ba1d4d6687fdbc
+		aotLib[0xe2ade42bc90dfa70] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_21 *  ),&_Func_lambda_thismodule_10_12_21_0x60_finazlier_d1ba1d4d6687fdbc>>();
+	};
+		// _Func_lambda_thismodule_10_12_21_0x60_function_7731a24418e632f6
+		aotLib[0x29eec6bb22b21265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_21 & , int32_t &  ),&_Func_lambda_thismodule_10_12_21_0x60_function_7731a24418e632f6>>();
+	};
+		// _Func_lambda_thismodule_114_12_19_0x60_finazlier_ff5d55f45c8bb832
+		aotLib[0x3acdeea0befc1dbf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_114_12_19 *  ),&_Func_lambda_thismodule_114_12_19_0x60_finazlier_ff5d55f45c8bb832>>();
+	};
+		// _Func_lambda_thismodule_114_12_19_0x60_function_b44f99bcf76b941f
+		aotLib[0x41f951e50fb6a062] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_114_12_19 & , int32_t &  ),&_Func_lambda_thismodule_114_12_19_0x60_function_b44f99bcf76b941f>>();
+	};
+		// _Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a
+		aotLib[0x4efca65d5f645d38] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 *  ),&_Func_lambda_thismodule_115_27_15_0x60_finazlier_71e19767abe73d8a>>();
+	};
+		// _Func_lambda_thismodule_115_27_15_0x60_function_99b02f7d7fb20f7f
+		aotLib[0x5074d0db2da741dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_115_27_15 & , int32_t , int32_t  ),&_Func_lambda_thismodule_115_27_15_0x60_function_99b02f7d7fb20f7f>>();
+	};
+		// _Func_lambda_thismodule_126_12_28_0x60_finazlier_b9868659d928ab4c
+		aotLib[0x29961243f012a0f8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_126_12_28 *  ),&_Func_lambda_thismodule_126_12_28_0x60_finazlier_b9868659d928ab4c>>();
+	};
+		// _Func_lambda_thismodule_126_12_28_0x60_function_2c2028644a12e636
+		aotLib[0x77024d27634ca243] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_126_12_28 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_126_12_28_0x60_function_2c2028644a12e636>>();
+	};
+		// _Func_lambda_thismodule_126_12_29_0x60_finazlier_2522eb75bb54e4e
+		aotLib[0xfa63edc1495e40ec] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_126_12_29 *  ),&_Func_lambda_thismodule_126_12_29_0x60_finazlier_2522eb75bb54e4e>>();
+	};
+		// _Func_lambda_thismodule_126_12_29_0x60_function_4b65d37516a6fe15
+		aotLib[0x6861734298e8a437] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_126_12_29 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_126_12_29_0x60_function_4b65d37516a6fe15>>();
+	};
+		// _Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e
+		aotLib[0xec2421ab448305a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 *  ),&_Func_lambda_thismodule_139_28_6_0x60_finazlier_c81b48322132787e>>();
+	};
+		// _Func_lambda_thismodule_139_28_6_0x60_function_472f6a6c1f57defb
+		aotLib[0x2348846d50452b7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, _lambda_thismodule_139_28_6 & , int32_t  ),&_Func_lambda_thismodule_139_28_6_0x60_function_472f6a6c1f57defb>>();
+	};
+		// _Func_lambda_thismodule_140_12_22_0x60_finazlier_2a40e0f101508cc0
+		aotLib[0x7d37b01959339e32] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_140_12_22 *  ),&_Func_lambda_thismodule_140_12_22_0x60_finazlier_2a40e0f101508cc0>>();
+	};
+		// _Func_lambda_thismodule_140_12_22_0x60_function_578433893de1dce7
+		aotLib[0x6622c92c0b5e834] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_140_12_22 & , int32_t &  ),&_Func_lambda_thismodule_140_12_22_0x60_function_578433893de1dce7>>();
+	};
+		// _Func_lambda_thismodule_146_12_31_0x60_finazlier_83a1d68515955f38
+		aotLib[0xe6ddf509d09beee0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_146_12_31 *  ),&_Func_lambda_thismodule_146_12_31_0x60_finazlier_83a1d68515955f38>>();
+	};
+		// _Func_lambda_thismodule_146_12_31_0x60_function_efe7dd7efd6841e1
+		aotLib[0xc29d7bf0387f9664] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_146_12_31 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_146_12_31_0x60_function_efe7dd7efd6841e1>>();
+	};
+		// _Func_lambda_thismodule_146_12_33_0x60_finazlier_1709d87fc5263e38
+		aotLib[0x5480e4cf90bc5d6a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_146_12_33 *  ),&_Func_lambda_thismodule_146_12_33_0x60_finazlier_1709d87fc5263e38>>();
+	};
+		// _Func_lambda_thismodule_146_12_33_0x60_function_3ba16a2e96795c5
+		aotLib[0x8c607797cf3c50f0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_146_12_33 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_146_12_33_0x60_function_3ba16a2e96795c5>>();
+	};
+		// _Func_lambda_thismodule_155_8_2_0x60_finazlier_2411e579cf98c0f6
+		aotLib[0x668fe0b3ee1ae99a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_2 *  ),&_Func_lambda_thismodule_155_8_2_0x60_finazlier_2411e579cf98c0f6>>();
+	};
+		// _Func_lambda_thismodule_155_8_2_0x60_function_e25f4c72c61fdd60
+		aotLib[0x60b88f2613c50aa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_155_8_2 & , int32_t &  ),&_Func_lambda_thismodule_155_8_2_0x60_function_e25f4c72c61fdd60>>();
+	};
+		// _Func_lambda_thismodule_162_8_3_0x60_finazlier_a08e1c5c057bfbc8
+		aotLib[0xf6d6c3c1db77be9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_162_8_3 *  ),&_Func_lambda_thismodule_162_8_3_0x60_finazlier_a08e1c5c057bfbc8>>();
+	};
+		// _Func_lambda_thismodule_162_8_3_0x60_function_ecb6711d5715d68f
+		aotLib[0x60fafe359b713974] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_162_8_3 & , int32_t &  ),&_Func_lambda_thismodule_162_8_3_0x60_function_ecb6711d5715d68f>>();
+	};
+		// _Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a
+		aotLib[0x991f2afd7f5e8dd7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 *  ),&_Func_lambda_thismodule_163_30_16_0x60_finazlier_fb8ad946134f187a>>();
+	};
+		// _Func_lambda_thismodule_163_30_16_0x60_function_9edd70fc8a73b5a9
+		aotLib[0x6cad72b7aa4468bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_30_16 & , int32_t  ),&_Func_lambda_thismodule_163_30_16_0x60_function_9edd70fc8a73b5a9>>();
+	};
+		// _Func_lambda_thismodule_16_12_30_0x60_finazlier_4ccf1d1c8122f79c
+		aotLib[0xa66a7d90523ca73e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_12_30 *  ),&_Func_lambda_thismodule_16_12_30_0x60_finazlier_4ccf1d1c8122f79c>>();
+	};
+		// _Func_lambda_thismodule_16_12_30_0x60_function_2b1db36a13098158
+		aotLib[0xcdead05908c74fa5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_16_12_30 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_16_12_30_0x60_function_2b1db36a13098158>>();
+	};
+		// _Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe
+		aotLib[0x9be2ba16af5bd272] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 *  ),&_Func_lambda_thismodule_172_30_17_0x60_finazlier_d62dda2187dc1cbe>>();
+	};
+		// _Func_lambda_thismodule_172_30_17_0x60_function_f241e50a975a124c
+		aotLib[0x4e7da89f6397521] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_172_30_17 & , int32_t  ),&_Func_lambda_thismodule_172_30_17_0x60_function_f241e50a975a124c>>();
+	};
+		// _Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa
+		aotLib[0xa93e6b0ef943193d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 *  ),&_Func_lambda_thismodule_180_30_18_0x60_finazlier_f3f210e81a2b3aaa>>();
+	};
+		// _Func_lambda_thismodule_180_30_18_0x60_function_bcfd62167c2f57f6
+		aotLib[0x42f7058c31686409] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_180_30_18 & , int32_t  ),&_Func_lambda_thismodule_180_30_18_0x60_function_bcfd62167c2f57f6>>();
+	};
+		// _Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca
+		aotLib[0x8f14596c7cc3ced] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 *  ),&_Func_lambda_thismodule_227_19_7_0x60_finazlier_77b5578290d2acca>>();
+	};
+		// _Func_lambda_thismodule_227_19_7_0x60_function_6246627beb3b33cd
+		aotLib[0xcebd8b1f139e0e84] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_227_19_7 & , int32_t &  ),&_Func_lambda_thismodule_227_19_7_0x60_function_6246627beb3b33cd>>();
+	};
+		// _Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386
+		aotLib[0x4b6ab460f99df9e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 *  ),&_Func_lambda_thismodule_232_10_8_0x60_finazlier_4bce5c5c58c08386>>();
+	};
+		// _Func_lambda_thismodule_232_10_8_0x60_function_9c855c1b64afb721
+		aotLib[0xf0b8721d4da48b1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_232_10_8 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_232_10_8_0x60_function_9c855c1b64afb721>>();
+	};
+		// _Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace
+		aotLib[0x4e1523e82e53942a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 *  ),&_Func_lambda_thismodule_235_18_9_0x60_finazlier_33e50c0cf9c9aace>>();
+	};
+		// _Func_lambda_thismodule_235_18_9_0x60_function_2e95b976cf509779
+		aotLib[0x53a35da8a7b46340] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_235_18_9 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_235_18_9_0x60_function_2e95b976cf509779>>();
+	};
+		// _Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98
+		aotLib[0x36438657728a2f44] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 *  ),&_Func_lambda_thismodule_240_10_12_0x60_finazlier_c6049d6e3206fd98>>();
+	};
+		// _Func_lambda_thismodule_240_10_12_0x60_function_44ae12e2b05cffe
+		aotLib[0x892b98a4e71213f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_240_10_12 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_240_10_12_0x60_function_44ae12e2b05cffe>>();
+	};
+		// _Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80
+		aotLib[0xb8d8db0eba72130e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 *  ),&_Func_lambda_thismodule_243_18_13_0x60_finazlier_6c8df04d1787ed80>>();
+	};
+		// _Func_lambda_thismodule_243_18_13_0x60_function_738a21f9be0cc078
+		aotLib[0x9b83f42b2c14bb9c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_243_18_13 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_243_18_13_0x60_function_738a21f9be0cc078>>();
+	};
+		// _Func_lambda_thismodule_32_12_23_0x60_finazlier_c8f8e435e390c224
+		aotLib[0x394ddb053d33fa65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_23 *  ),&_Func_lambda_thismodule_32_12_23_0x60_finazlier_c8f8e435e390c224>>();
+	};
+		// _Func_lambda_thismodule_32_12_23_0x60_function_555bcb5cb06bd872
+		aotLib[0x56d61e698b54dbbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_23 & , int32_t &  ),&_Func_lambda_thismodule_32_12_23_0x60_function_555bcb5cb06bd872>>();
+	};
+		// _Func_lambda_thismodule_32_12_24_0x60_finazlier_3d3d9073d2541f6
+		aotLib[0x9aec7da005387fc0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_24 *  ),&_Func_lambda_thismodule_32_12_24_0x60_finazlier_3d3d9073d2541f6>>();
+	};
+		// _Func_lambda_thismodule_32_12_24_0x60_function_2d0fca48b40f1488
+		aotLib[0xe901ce614aa75205] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_24 & , bool &  ),&_Func_lambda_thismodule_32_12_24_0x60_function_2d0fca48b40f1488>>();
+	};
+		// _Func_lambda_thismodule_32_12_25_0x60_finazlier_a33881cecf992244
+		aotLib[0x82b9b899eb46f699] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_25 *  ),&_Func_lambda_thismodule_32_12_25_0x60_finazlier_a33881cecf992244>>();
+	};
+		// _Func_lambda_thismodule_32_12_25_0x60_function_ff871c1b0b3296c0
+		aotLib[0x7c14e918ca53a255] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_25 & , int32_t &  ),&_Func_lambda_thismodule_32_12_25_0x60_function_ff871c1b0b3296c0>>();
+	};
+		// _Func_lambda_thismodule_32_12_26_0x60_finazlier_6e94b4db6ebb5c5a
+		aotLib[0xf327435fd65ab040] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_26 *  ),&_Func_lambda_thismodule_32_12_26_0x60_finazlier_6e94b4db6ebb5c5a>>();
+	};
+		// _Func_lambda_thismodule_32_12_26_0x60_function_f04c3507d7907c3
+		aotLib[0xd5d8bc655c46e2a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_26 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_32_12_26_0x60_function_f04c3507d7907c3>>();
+	};
+		// _Func_lambda_thismodule_32_12_36_0x60_finazlier_359503b0c44073d4
+		aotLib[0xb195b0f7a8edd512] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_36 *  ),&_Func_lambda_thismodule_32_12_36_0x60_finazlier_359503b0c44073d4>>();
+	};
+		// _Func_lambda_thismodule_32_12_36_0x60_function_c4cd68058006908f
+		aotLib[0x4e644323d754a2e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_36 & , int32_t &  ),&_Func_lambda_thismodule_32_12_36_0x60_function_c4cd68058006908f>>();
+	};
+		// _Func_lambda_thismodule_37_12_34_0x60_finazlier_66300907ccc3e5a6
+		aotLib[0x6ba93cc3de5414df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_37_12_34 *  ),&_Func_lambda_thismodule_37_12_34_0x60_finazlier_66300907ccc3e5a6>>();
+	};
+		// _Func_lambda_thismodule_37_12_34_0x60_function_9bb4f2f49fc0df43
+		aotLib[0x63f78e10aa70e8ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_37_12_34 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_37_12_34_0x60_function_9bb4f2f49fc0df43>>();
+	};
+		// _Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378
+		aotLib[0x71092c39a20a9b18] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 *  ),&_Func_lambda_thismodule_50_23_4_0x60_finazlier_94bec26830d25378>>();
+	};
+		// _Func_lambda_thismodule_50_23_4_0x60_function_23b6a451d4c31fe8
+		aotLib[0x6f3418a348536ba4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_50_23_4 & , int32_t const  * &  ),&_Func_lambda_thismodule_50_23_4_0x60_function_23b6a451d4c31fe8>>();
+	};
+		// _Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574
+		aotLib[0x7fec33ccce4063b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 *  ),&_Func_lambda_thismodule_56_21_10_0x60_finazlier_5af839a62194f574>>();
+	};
+		// _Func_lambda_thismodule_56_21_10_0x60_function_98257abb2a360b0d
+		aotLib[0x1814b19a640e08f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_56_21_10 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_56_21_10_0x60_function_98257abb2a360b0d>>();
+	};
+		// _Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0
+		aotLib[0x606ccdc810742fb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 *  ),&_Func_lambda_thismodule_71_25_14_0x60_finazlier_71ea3165571200f0>>();
+	};
+		// _Func_lambda_thismodule_71_25_14_0x60_function_d3dd6e415d58c429
+		aotLib[0xf422a3da9cb90905] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_71_25_14 & , int32_t  ),&_Func_lambda_thismodule_71_25_14_0x60_function_d3dd6e415d58c429>>();
+	};
+		// _Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e
+		aotLib[0xdf07f82e82467a46] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 *  ),&_Func_lambda_thismodule_85_28_1_0x60_finazlier_9127d836addd785e>>();
+	};
+		// _Func_lambda_thismodule_85_28_1_0x60_function_cb7acd9379a60377
+		aotLib[0xab4bcdaf6685f355] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_85_28_1 & , int32_t  ),&_Func_lambda_thismodule_85_28_1_0x60_function_cb7acd9379a60377>>();
+	};
+		// _Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752
+		aotLib[0x5f11ebaa6f21c154] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 *  ),&_Func_lambda_thismodule_90_14_11_0x60_finazlier_6211c33db3590752>>();
+	};
+		// _Func_lambda_thismodule_90_14_11_0x60_function_a695c89c641e9f31
+		aotLib[0x34bf9862a4330bf0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_90_14_11 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_90_14_11_0x60_function_a695c89c641e9f31>>();
+	};
+		// _Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454
+		aotLib[0x9d8b863838130fed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_27 *  ),&_Func_lambda_thismodule_91_25_27_0x60_finazlier_8b8a9141cef68454>>();
+	};
+		// _Func_lambda_thismodule_91_25_27_0x60_function_62a7a09ac176e772
+		aotLib[0x6efc52a0e2fdec55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_91_25_27 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_91_25_27_0x60_function_62a7a09ac176e772>>();
+	};
+		// _Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6
+		aotLib[0x9021dbafc4090d77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 *  ),&_Func_lambda_thismodule_92_36_32_0x60_finazlier_2bfc7672990c4ec6>>();
+	};
+		// _Func_lambda_thismodule_92_36_32_0x60_function_b78fbe9676275623
+		aotLib[0x5b76026800cb28c2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, _lambda_thismodule_92_36_32 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_92_36_32_0x60_function_b78fbe9676275623>>();
+	};
+		// _Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce
+		aotLib[0x1e84eb38eb93e2f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 *  ),&_Func_lambda_thismodule_93_29_35_0x60_finazlier_9f733d78516145ce>>();
+	};
+		// _Func_lambda_thismodule_93_29_35_0x60_function_b0d1910de5a9c7a5
+		aotLib[0x352f5aba1df3e1bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_93_29_35 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_93_29_35_0x60_function_b0d1910de5a9c7a5>>();
+	};
+		// _Func_0x60_first_7932efd700c6a809
+		aotLib[0xf10802b672f22f95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&_Func_0x60_first_7932efd700c6a809>>();
+	};
+		// _Func_0x60_is_same_590802a3ad1ce37b
+		aotLib[0x3773ddd3a900a096] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & , Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_is_same_590802a3ad1ce37b>>();
+	};
+		// _Func_0x60_is_same_97c40271e1b9fd95
+		aotLib[0x930c893f068c89e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & , Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  ),&_Func_0x60_is_same_97c40271e1b9fd95>>();
+	};
+		// _Func_0x60_is_same_76c357069204466c
+		aotLib[0xcfdb877f703858a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_is_same_76c357069204466c>>();
+	};
+		// _Func_0x60_verify_14_c3c8eadf66ac49ff
+		aotLib[0x2983a60b77a5d825] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Func_0x60_verify_14_c3c8eadf66ac49ff>>();
+	};
+		// _Func_0x60_verify_14_7ef312f50721678e
+		aotLib[0x1d914d76d42c3835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_verify_14_7ef312f50721678e>>();
+	};
+		// _Func_0x60_verify_even_80adb3e94fb860c4
+		aotLib[0x1ec91484de2e2e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_verify_even_80adb3e94fb860c4>>();
+	};
+		// _Func_0x60_verify_even_eefc0d72cf85e86
+		aotLib[0x38c5cdcd29d959f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_verify_even_eefc0d72cf85e86>>();
+	};
+		// _Func_0x60_verify_even_7e1644f384b5d5ac
+		aotLib[0x103d461b977761cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Func_0x60_verify_even_7e1644f384b5d5ac>>();
+	};
+		// add_17f8810c9c570b5a
+		aotLib[0x8866650275d5ac31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_17f8810c9c570b5a>>();
+	};
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_each_298c4ba2da976305
+		aotLib[0x40a426d4b892cbd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_each_298c4ba2da976305>>();
+	};
+		// _Funcbuiltin_0x60_each_2d3d435a4c8a02ad
+		aotLib[0xc0065f42bd150eed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  ),&_Funcbuiltin_0x60_each_2d3d435a4c8a02ad>>();
+	};
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_69d7e7bb51ea3de6
+		aotLib[0x8ac280d1c67150cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const   ),&_Funcbuiltin_0x60_each_69d7e7bb51ea3de6>>();
+	};
+		// _Funcbuiltin_0x60_each_ba1451246e410d44
+		aotLib[0x793867d4b0d3c9d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const   ),&_Funcbuiltin_0x60_each_ba1451246e410d44>>();
+	};
+		// _Funcbuiltin_0x60_each_514b08b1e7149328
+		aotLib[0xa0cf7d5d7c4b3039] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const   ),&_Funcbuiltin_0x60_each_514b08b1e7149328>>();
+	};
+		// _Funcbuiltin_0x60_each_d7a87ffd28768e01
+		aotLib[0xbfcb47e1b26386a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_d7a87ffd28768e01>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_39f24952079a2b12
+		aotLib[0x48c72ff7c6322a15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const   ),&_Funcbuiltin_0x60_each_ref_39f24952079a2b12>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e
+		aotLib[0x77807af765a10aa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const   ),&_Funcbuiltin_0x60_each_ref_a50b75d3f4a4dd2e>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_576a75d40473b6b2
+		aotLib[0x1fd2e14af9c8783d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_576a75d40473b6b2>>();
+	};
+		// _Funcbuiltin_0x60_emplace_cbf332071aecae6a
+		aotLib[0xe451fe75d1648b49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60_emplace_cbf332071aecae6a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_242c8c79790d8651
+		aotLib[0x2ba500bcbe92adca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_242c8c79790d8651>>();
+	};
+		// _Funcbuiltin_0x60_finalize_e1c35de9ada57daf
+		aotLib[0x68b86cd6a042ae73] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  ),&_Funcbuiltin_0x60_finalize_e1c35de9ada57daf>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_85431c6f80690d63
+		aotLib[0x3ce39571e44ba540] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_push_clone_85431c6f80690d63>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_a3d92d5b7b06b77c
+		aotLib[0xd2effaeac7e0341d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> & , TTuple<8,int32_t,float> const  &  ),&_Funcbuiltin_0x60_push_clone_a3d92d5b7b06b77c>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_9da63e78acf395d5
+		aotLib[0x1eccd0d48d65cf7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_clone_9da63e78acf395d5>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7
+		aotLib[0xd910ddfba5d591db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_272b3119a8e7dcd7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_5baa820607536fa4
+		aotLib[0xf9222b6e826376ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_5baa820607536fa4>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a
+		aotLib[0x1710ad6d3f7b6649] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a>>();
+	};
+		// finalize_554c45dda146b8a6
+		aotLib[0x44f1f99164dafc69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_554c45dda146b8a6>>();
+	};
+		// finalize_a9d0ed6e96725931
+		aotLib[0xc87723a104fd0265] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 &  ),&finalize_a9d0ed6e96725931>>();
+	};
+		// finalize_ffeba83554a107e5
+		aotLib[0x75b9e0129d1277d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_20 &  ),&finalize_ffeba83554a107e5>>();
+	};
+		// finalize_c07e639f98d956be
+		aotLib[0xd6408edef2793611] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_21 &  ),&finalize_c07e639f98d956be>>();
+	};
+		// finalize_4501d8c7efc415b6
+		aotLib[0xa3f2f7f1c3f8f2d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_114_12_19 &  ),&finalize_4501d8c7efc415b6>>();
+	};
+		// finalize_4e0f4bc7b8ca2ddf
+		aotLib[0x4ad738011f7b03a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 &  ),&finalize_4e0f4bc7b8ca2ddf>>();
+	};
+		// finalize_2b52cc14974eb289
+		aotLib[0x225cd2d7e4a27def] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_126_12_28 &  ),&finalize_2b52cc14974eb289>>();
+	};
+		// finalize_a646fc072953826
+		aotLib[0x11db98ceba94cc62] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_126_12_29 &  ),&finalize_a646fc072953826>>();
+	};
+		// finalize_99b4eff0b688c844
+		aotLib[0x960373f5273e2045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 &  ),&finalize_99b4eff0b688c844>>();
+	};
+		// finalize_e7f1877f7e5421e0
+		aotLib[0xa4ca4eb43a1cffd9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_140_12_22 &  ),&finalize_e7f1877f7e5421e0>>();
+	};
+		// finalize_1a0bb91605bff14a
+		aotLib[0x77b2110922971c8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_146_12_31 &  ),&finalize_1a0bb91605bff14a>>();
+	};
+		// finalize_147a429eb5e3cbec
+		aotLib[0x1a0f6d02d96e6a25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_146_12_33 &  ),&finalize_147a429eb5e3cbec>>();
+	};
+		// finalize_5e67e3bae091c622
+		aotLib[0xbdb4bf8851e279a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_2 &  ),&finalize_5e67e3bae091c622>>();
+	};
+		// finalize_e936e15940b27451
+		aotLib[0xe36916b11f9b89fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_162_8_3 &  ),&finalize_e936e15940b27451>>();
+	};
+		// finalize_790215f236547953
+		aotLib[0x6f294b22a3c3b501] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 &  ),&finalize_790215f236547953>>();
+	};
+		// finalize_90ffa732bfe8521f
+		aotLib[0x8f82d6f34975efb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_12_30 &  ),&finalize_90ffa732bfe8521f>>();
+	};
+		// finalize_1bb28fe166db1ff8
+		aotLib[0x78f97bc96f5231f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 &  ),&finalize_1bb28fe166db1ff8>>();
+	};
+		// finalize_6a14a117832a47b4
+		aotLib[0x2468d43939cebe9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 &  ),&finalize_6a14a117832a47b4>>();
+	};
+		// finalize_49ff1a0658524f07
+		aotLib[0x3a8d8b45eec60745] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 &  ),&finalize_49ff1a0658524f07>>();
+	};
+		// finalize_da9a89580c66c5cf
+		aotLib[0xfdcc65f7999d5561] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 &  ),&finalize_da9a89580c66c5cf>>();
+	};
+		// finalize_cb84739dfec92af7
+		aotLib[0xfd285f414754a405] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 &  ),&finalize_cb84739dfec92af7>>();
+	};
+		// finalize_3110b281c7deafcb
+		aotLib[0x556fc49fa817b1f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 &  ),&finalize_3110b281c7deafcb>>();
+	};
+		// finalize_3d9c85063ca4a8bd
+		aotLib[0x4458332befc28735] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 &  ),&finalize_3d9c85063ca4a8bd>>();
+	};
+		// finalize_a599eea550527dd4
+		aotLib[0x8f1f2dfa175fe95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_23 &  ),&finalize_a599eea550527dd4>>();
+	};
+		// finalize_a63a3f13530d06d5
+		aotLib[0xfb2bb2a689ca663d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_24 &  ),&finalize_a63a3f13530d06d5>>();
+	};
+		// finalize_98cb053c4bf3181e
+		aotLib[0x4844d2cd274f9da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_25 &  ),&finalize_98cb053c4bf3181e>>();
+	};
+		// finalize_d87f2b2985e6b0e7
+		aotLib[0x5ed35984d284b389] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_26 &  ),&finalize_d87f2b2985e6b0e7>>();
+	};
+		// finalize_b94e81e70e15931b
+		aotLib[0xb631eb5b19b49cfa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_36 &  ),&finalize_b94e81e70e15931b>>();
+	};
+		// finalize_84d8c7cf0e6c730f
+		aotLib[0xbc8704f4420d7ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_37_12_34 &  ),&finalize_84d8c7cf0e6c730f>>();
+	};
+		// finalize_e4e346397db1da55
+		aotLib[0xc41c8adc4530f019] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 &  ),&finalize_e4e346397db1da55>>();
+	};
+		// finalize_7e62c95ba3669c0e
+		aotLib[0xcabc77bc2d5c5615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 &  ),&finalize_7e62c95ba3669c0e>>();
+	};
+		// finalize_8d49d3be2563d419
+		aotLib[0xace8ffee4ca4c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 &  ),&finalize_8d49d3be2563d419>>();
+	};
+		// finalize_8f217ed02c7d43f1
+		aotLib[0x66afded8f98bba41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 &  ),&finalize_8f217ed02c7d43f1>>();
+	};
+		// finalize_75919cb3423249cf
+		aotLib[0x3cee402d76070179] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 &  ),&finalize_75919cb3423249cf>>();
+	};
+		// finalize_cfd3426561e2e7e5
+		aotLib[0x74f81d0e63b2f125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_27 &  ),&finalize_cfd3426561e2e7e5>>();
+	};
+		// finalize_6eaa1c4f569102fc
+		aotLib[0x5172d55540fbde85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 &  ),&finalize_6eaa1c4f569102fc>>();
+	};
+		// finalize_cdc2fc53315b9882
+		aotLib[0xede4cf03b9d9019d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 &  ),&finalize_cdc2fc53315b9882>>();
+	};
+		// _Funcfunctional_0x60_all_af66043144506e5d
+		aotLib[0x9a91130e914818a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_all_af66043144506e5d>>();
+	};
+		// _Funcfunctional_0x60_any_cf35c74e31a01f2b
+		aotLib[0xeaf0278bd17dcedd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_any_cf35c74e31a01f2b>>();
+	};
+		// _Funcfunctional_0x60_any_a5606ed295f053c9
+		aotLib[0xdae7885028c860f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<bool,2> const  &  ),&_Funcfunctional_0x60_any_a5606ed295f053c9>>();
+	};
+		// _Funcfunctional_0x60_count_d104f003ed40f81d
+		aotLib[0xd4ae968b4eb23fa7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_count_d104f003ed40f81d>>();
+	};
+		// _Funcfunctional_0x60_cycle_e65840607303287d
+		aotLib[0x2479b26b8e38388c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  ),&_Funcfunctional_0x60_cycle_e65840607303287d>>();
+	};
+		// _Funcfunctional_0x60_cycle_9307cbe86dc18493
+		aotLib[0x67b153a5e186c27] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  ),&_Funcfunctional_0x60_cycle_9307cbe86dc18493>>();
+	};
+		// _Funcfunctional_0x60_cycle_5b23e7a7385574ed
+		aotLib[0xdfec89da018bf6cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  ),&_Funcfunctional_0x60_cycle_5b23e7a7385574ed>>();
+	};
+		// _Funcfunctional_0x60_filter_2f1bfef5b9185064
+		aotLib[0x8526b50472acb999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_filter_2f1bfef5b9185064>>();
+	};
+		// _Funcfunctional_0x60_filter_4f1dc6df7c9a047b
+		aotLib[0x7edfb1352d65574c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_4f1dc6df7c9a047b>>();
+	};
+		// _Funcfunctional_0x60_filter_8cf8f8edf9d0fb39
+		aotLib[0xe0d4028abbe19379] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_8cf8f8edf9d0fb39>>();
+	};
+		// _Funcfunctional_0x60_filter_any_3cd29644344d3ab4
+		aotLib[0xaa70544e40715dae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_filter_any_3cd29644344d3ab4>>();
+	};
+		// _Funcfunctional_0x60_filter_any_4f440bfcbccbc0d0
+		aotLib[0xc9a1b9439ab6e9fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_4f440bfcbccbc0d0>>();
+	};
+		// _Funcfunctional_0x60_filter_any_5e72c2679447b323
+		aotLib[0xd46cef257ff89f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_5e72c2679447b323>>();
+	};
+		// _Funcfunctional_0x60_is_equal_9cf00a9700259a54
+		aotLib[0xb73297f4006549b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_is_equal_9cf00a9700259a54>>();
+	};
+		// _Funcfunctional_0x60_islice_fc7bf6c00c789478
+		aotLib[0xcf663ed46b8dbd92] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_fc7bf6c00c789478>>();
+	};
+		// _Funcfunctional_0x60_islice_c5d1237505bcea35
+		aotLib[0xdbb1326240ba0e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_c5d1237505bcea35>>();
+	};
+		// _Funcfunctional_0x60_islice_784f1c420c07c72d
+		aotLib[0x9efac1d6bb142af] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_784f1c420c07c72d>>();
+	};
+		// _Funcfunctional_0x60_map_7c9f3865b7a3940a
+		aotLib[0x5e49f7c0ad9cd68f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_7c9f3865b7a3940a>>();
+	};
+		// _Funcfunctional_0x60_map_d53fb0c2d9dfb3e9
+		aotLib[0x1827dde8f7b142b6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_d53fb0c2d9dfb3e9>>();
+	};
+		// _Funcfunctional_0x60_map_b229592d62268192
+		aotLib[0xa3494cc4534c7fd0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_b229592d62268192>>();
+	};
+		// _Funcfunctional_0x60_map_6b992b192f6d0379
+		aotLib[0x5ae19b603a071d8b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const   ),&_Funcfunctional_0x60_map_6b992b192f6d0379>>();
+	};
+		// _Funcfunctional_0x60_map_69271239b8e77c4b
+		aotLib[0xc548e871b726b748] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_map_69271239b8e77c4b>>();
+	};
+		// _Funcfunctional_0x60_map_4653403510c37584
+		aotLib[0x579b6f07cb189020] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_4653403510c37584>>();
+	};
+		// _Funcfunctional_0x60_map_any_94f2fe7992a68f2e
+		aotLib[0xd45e1bcde1d6c921] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_94f2fe7992a68f2e>>();
+	};
+		// _Funcfunctional_0x60_map_any_e0d846ac25c8ccfe
+		aotLib[0x5b965cb785880a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_e0d846ac25c8ccfe>>();
+	};
+		// _Funcfunctional_0x60_map_any_441075f1d3af98ef
+		aotLib[0xe99a391afe8ee39f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_441075f1d3af98ef>>();
+	};
+		// _Funcfunctional_0x60_map_any_eb9f55c0847980e0
+		aotLib[0x2fff0661fa9e240f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t))  ),&_Funcfunctional_0x60_map_any_eb9f55c0847980e0>>();
+	};
+		// _Funcfunctional_0x60_map_any_d8701f9e7666a39f
+		aotLib[0xb26843af216ef2f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_map_any_d8701f9e7666a39f>>();
+	};
+		// _Funcfunctional_0x60_map_any_3c50bea69955cdd6
+		aotLib[0x9229d14eba313ed3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_3c50bea69955cdd6>>();
+	};
+		// _Funcfunctional_0x60_not_47ae1464a98e0c31
+		aotLib[0xcb80c5317a0995a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, bool  ),&_Funcfunctional_0x60_not_47ae1464a98e0c31>>();
+	};
+		// _Funcfunctional_0x60_reduce_26999405e8feb1ae
+		aotLib[0x7882a62e0f593f4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_26999405e8feb1ae>>();
+	};
+		// _Funcfunctional_0x60_reduce_2fc220e9df504873
+		aotLib[0x3ce09ade4ba8759e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_2fc220e9df504873>>();
+	};
+		// _Funcfunctional_0x60_reduce_d0cd73f6a56dd127
+		aotLib[0xe1b9c1962a6b97d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_d0cd73f6a56dd127>>();
+	};
+		// _Funcfunctional_0x60_reduce_3d9e9ac16cb763c3
+		aotLib[0x5a74d24683c55223] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_3d9e9ac16cb763c3>>();
+	};
+		// _Funcfunctional_0x60_reduce_3cdc98b626551694
+		aotLib[0x22da42ba232577e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_3cdc98b626551694>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_f4b3c153b2fa4ed8
+		aotLib[0xf886d875682aabe1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_any_f4b3c153b2fa4ed8>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_e5cc70a024b84107
+		aotLib[0x534ce4c92148d3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_e5cc70a024b84107>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_8c7e16d91347e748
+		aotLib[0x96027be38a42a5ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_8c7e16d91347e748>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_3e33db80687dd5b0
+		aotLib[0x8a9ed800c70ad645] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_3e33db80687dd5b0>>();
+	};
+		// _Funcfunctional_0x60_reduce_any_ba55ccd7fef6c17c
+		aotLib[0xc2d4fbceaf3c0b9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_ba55ccd7fef6c17c>>();
+	};
+		// _Funcfunctional_0x60_repeat_d9d27c291dcbe8dc
+		aotLib[0x97697456a059acc2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_repeat_d9d27c291dcbe8dc>>();
+	};
+		// _Funcfunctional_0x60_sum_753716cc0b2bd341
+		aotLib[0x866ba6273f1ae85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcfunctional_0x60_sum_753716cc0b2bd341>>();
+	};
+		// is_even_d55850ffa9bd4b94
+		aotLib[0x26419c8d6499549] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_even_d55850ffa9bd4b94>>();
+	};
+		// test_2d6b405414824ffe
+		aotLib[0xa0b62a60f18cf024] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2d6b405414824ffe>>();
+	};
+		// twice_7c65caf37efc07cb
+		aotLib[0x1e44557bf5178af5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&twice_7c65caf37efc07cb>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1960 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__786994ee;
+extern StructInfo __struct_info__5055017d;
+extern StructInfo __struct_info__8117990c;
+extern StructInfo __struct_info__74c2a29;
+extern StructInfo __struct_info__8c9c601a;
+extern StructInfo __struct_info__5a287ef3;
+extern StructInfo __struct_info__1b051679;
+extern StructInfo __struct_info__c2ab21a9;
+extern StructInfo __struct_info__f7a95eb9;
+extern StructInfo __struct_info__134d067a;
+extern StructInfo __struct_info__4e6ef689;
+extern StructInfo __struct_info__ee062591;
+extern StructInfo __struct_info__34bfe339;
+extern StructInfo __struct_info__84d1499b;
+extern TypeInfo __type_info__cef2fb69;
+extern TypeInfo __type_info__c1605343;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__1eeb119;
+extern TypeInfo __type_info__fdce115e;
+extern TypeInfo __type_info__44013282;
+extern TypeInfo __type_info__f17f7ad1;
+extern TypeInfo __type_info__e44201f9;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__fb41f04a;
+extern TypeInfo __type_info__4dd0dc66;
+extern TypeInfo __type_info__7bb8ddeb;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__1cdd00c1;
+extern TypeInfo __type_info__d1f6dab9;
+extern TypeInfo __type_info__d409a801;
+extern TypeInfo __type_info__4d1901fc;
+extern TypeInfo __type_info__eb999892;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__fa45b829;
+extern TypeInfo __type_info__5521c569;
+extern TypeInfo __type_info__9c0e8071;
+extern TypeInfo __type_info__be5daea3;
+extern TypeInfo __type_info__70e06e4;
+extern TypeInfo __type_info__587979aa;
+extern TypeInfo __type_info__c27c2d6d;
+extern TypeInfo __type_info__76969f1;
+extern TypeInfo __type_info__9836da19;
+extern TypeInfo __type_info__cedb5f8b;
+extern TypeInfo __type_info__4b5af355;
+extern TypeInfo __type_info__493816c1;
+extern TypeInfo __type_info__82d724a1;
+extern VarInfo __var_info__64622753;
+extern VarInfo __var_info__cf4bc978;
+extern VarInfo __var_info__571cf8d2;
+extern VarInfo __var_info__412add1e;
+extern VarInfo __var_info__8572774b;
+extern VarInfo __var_info__6c459707;
+extern VarInfo __var_info__a0eb9f06;
+extern VarInfo __var_info__530ec616;
+extern VarInfo __var_info__e8d164f5;
+extern VarInfo __var_info__91746a5d;
+extern VarInfo __var_info__f6fa7721;
+extern VarInfo __var_info__1f943839;
+extern VarInfo __var_info__1b63c251;
+extern VarInfo __var_info__b43a5a12;
+extern VarInfo __var_info__a8f6aa62;
+extern VarInfo __var_info__2b2ec906;
+extern VarInfo __var_info__f965a2ea;
+extern VarInfo __var_info__7ca6cc27;
+extern VarInfo __var_info__255cee00;
+extern VarInfo __var_info__4b7a226;
+extern VarInfo __var_info__de178e82;
+extern VarInfo __var_info__ff38be1d;
+extern VarInfo __var_info__43000df5;
+extern VarInfo __var_info__3b4eea0;
+extern VarInfo __var_info__aa9d2ece;
+extern VarInfo __var_info__cfd3b52e;
+extern VarInfo __var_info__26db2e7;
+extern VarInfo __var_info__b1749cbd;
+extern VarInfo __var_info__cd37486e;
+extern VarInfo __var_info__109629d1;
+extern VarInfo __var_info__c85246b7;
+extern VarInfo __var_info__47f2622;
+extern VarInfo __var_info__278557dc;
+extern VarInfo __var_info__aebae29f;
+extern VarInfo __var_info__4f84649d;
+extern VarInfo __var_info__80be9b22;
+extern VarInfo __var_info__9d373fd4;
+extern VarInfo __var_info__220049d2;
+extern VarInfo __var_info__fbcb3d19;
+extern VarInfo __var_info__d160a1f4;
+extern VarInfo __var_info__90606c35;
+extern VarInfo __var_info__f2696991;
+extern VarInfo __var_info__bd409b56;
+extern VarInfo __var_info__d6a57877;
+extern VarInfo __var_info__f076881;
+extern VarInfo __var_info__576b519a;
+extern VarInfo __var_info__6020160f;
+extern VarInfo __var_info__cc05e405;
+extern VarInfo __var_info__a6efa894;
+extern VarInfo __var_info__819b5249;
+extern VarInfo __var_info__9796f747;
+extern VarInfo __var_info__9485e713;
+extern VarInfo __var_info__b90b0aa7;
+extern VarInfo __var_info__416ab052;
+extern VarInfo __var_info__a2a64f50;
+extern VarInfo __var_info__ca5bf24;
+extern VarInfo __var_info__ec7c56c8;
+extern VarInfo __var_info__a66e8482;
+extern VarInfo __var_info__a66f6455;
+extern VarInfo __var_info__7e9a8bd6;
+extern VarInfo __var_info__df222666;
+extern VarInfo __var_info__23bc408b;
+extern VarInfo __var_info__2bd12dd1;
+extern VarInfo __var_info__ab1076a6;
+extern VarInfo __var_info__25d98d4e;
+extern VarInfo __var_info__e31f980a;
+extern VarInfo __var_info__d11d08a4;
+extern VarInfo __var_info__eb646b39;
+extern VarInfo __var_info__3b2282f7;
+extern VarInfo __var_info__6255aba2;
+extern VarInfo __var_info__9bb4b75;
+extern VarInfo __var_info__944c8b9f;
+extern VarInfo __var_info__a390dea1;
+extern VarInfo __var_info__1d16df0b;
+extern VarInfo __var_info__50aa09de;
+extern VarInfo __var_info__9d97e2e1;
+
+TypeInfo * __type_info__1d16df0b_arg_types_var_2020185326[2] = { &__type_info__fdce115e, &__type_info__e6eb6b88 };
+VarInfo __struct_info__786994ee_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__1d16df0b_arg_types_var_2020185326, nullptr, 2, 0, nullptr, 28, 0x1d16df0b, "__lambda", 0 };
+TypeInfo * __type_info__f965a2ea_arg_types_var_2020185326[1] = { &__type_info__4dd0dc66 };
+VarInfo __struct_info__786994ee_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f965a2ea_arg_types_var_2020185326, nullptr, 1, 0, nullptr, 28, 0xf965a2ea, "__finalize", 4 };
+VarInfo __struct_info__786994ee_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9d97e2e1, "__yield", 8 };
+VarInfo __struct_info__786994ee_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeb646b39, "_loop_at_155", 12 };
+VarInfo __struct_info__786994ee_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe31f980a, "t", 16 };
+VarInfo __struct_info__786994ee_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9bb4b75, "_pvar_0_at_155", 24 };
+VarInfo __struct_info__786994ee_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x109629d1, "_source_0_at_155", 32 };
+VarInfo * __struct_info__786994ee_fields[7] =  { &__struct_info__786994ee_field_0, &__struct_info__786994ee_field_1, &__struct_info__786994ee_field_2, &__struct_info__786994ee_field_3, &__struct_info__786994ee_field_4, &__struct_info__786994ee_field_5, &__struct_info__786994ee_field_6 };
+StructInfo __struct_info__786994ee = {"_lambda_thismodule_155_8_2", __struct_info__786994ee_fields, 7, 40, -1, nullptr, 0x786994ee };
+TypeInfo * __type_info__df222666_arg_types_var_1347748221[2] = { &__type_info__c27c2d6d, &__type_info__e6eb6b88 };
+VarInfo __struct_info__5055017d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__df222666_arg_types_var_1347748221, nullptr, 2, 0, nullptr, 28, 0xdf222666, "__lambda", 0 };
+TypeInfo * __type_info__64622753_arg_types_var_1347748221[1] = { &__type_info__4b5af355 };
+VarInfo __struct_info__5055017d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__64622753_arg_types_var_1347748221, nullptr, 1, 0, nullptr, 28, 0x64622753, "__finalize", 4 };
+VarInfo __struct_info__5055017d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x571cf8d2, "__yield", 8 };
+VarInfo __struct_info__5055017d_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb1749cbd, "t", 12 };
+VarInfo __struct_info__5055017d_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x91746a5d, "T", 16 };
+VarInfo * __struct_info__5055017d_fields[5] =  { &__struct_info__5055017d_field_0, &__struct_info__5055017d_field_1, &__struct_info__5055017d_field_2, &__struct_info__5055017d_field_3, &__struct_info__5055017d_field_4 };
+StructInfo __struct_info__5055017d = {"_lambda_thismodule_46_8_8", __struct_info__5055017d_fields, 5, 24, -1, nullptr, 0x5055017d };
+TypeInfo * __type_info__4f84649d_arg_types_var_2165807372[2] = { &__type_info__4d1901fc, &__type_info__e6eb6b88 };
+VarInfo __struct_info__8117990c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__4f84649d_arg_types_var_2165807372, nullptr, 2, 0, nullptr, 28, 0x4f84649d, "__lambda", 0 };
+TypeInfo * __type_info__ca5bf24_arg_types_var_2165807372[1] = { &__type_info__70e06e4 };
+VarInfo __struct_info__8117990c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ca5bf24_arg_types_var_2165807372, nullptr, 1, 0, nullptr, 28, 0xca5bf24, "__finalize", 4 };
+VarInfo __struct_info__8117990c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x23bc408b, "__yield", 8 };
+VarInfo __struct_info__8117990c_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9d373fd4, "t", 12 };
+VarInfo * __struct_info__8117990c_fields[4] =  { &__struct_info__8117990c_field_0, &__struct_info__8117990c_field_1, &__struct_info__8117990c_field_2, &__struct_info__8117990c_field_3 };
+StructInfo __struct_info__8117990c = {"_lambda_thismodule_138_8_12", __struct_info__8117990c_fields, 4, 16, -1, nullptr, 0x8117990c };
+TypeInfo * __type_info__6255aba2_arg_types_var_122432041[2] = { &__type_info__9836da19, &__type_info__e6eb6b88 };
+VarInfo __struct_info__74c2a29_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__6255aba2_arg_types_var_122432041, nullptr, 2, 0, nullptr, 28, 0x6255aba2, "__lambda", 0 };
+TypeInfo * __type_info__7ca6cc27_arg_types_var_122432041[1] = { &__type_info__76969f1 };
+VarInfo __struct_info__74c2a29_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7ca6cc27_arg_types_var_122432041, nullptr, 1, 0, nullptr, 28, 0x7ca6cc27, "__finalize", 4 };
+VarInfo __struct_info__74c2a29_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xab1076a6, "__yield", 8 };
+VarInfo __struct_info__74c2a29_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa66e8482, "_loop_at_148", 12 };
+VarInfo __struct_info__74c2a29_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf6fa7721, "t", 16 };
+VarInfo __struct_info__74c2a29_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa8f6aa62, "_pvar_0_at_148", 24 };
+VarInfo __struct_info__74c2a29_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x2b2ec906, "_source_0_at_148", 32 };
+VarInfo * __struct_info__74c2a29_fields[7] =  { &__struct_info__74c2a29_field_0, &__struct_info__74c2a29_field_1, &__struct_info__74c2a29_field_2, &__struct_info__74c2a29_field_3, &__struct_info__74c2a29_field_4, &__struct_info__74c2a29_field_5, &__struct_info__74c2a29_field_6 };
+StructInfo __struct_info__74c2a29 = {"_lambda_thismodule_148_8_1", __struct_info__74c2a29_fields, 7, 40, -1, nullptr, 0x74c2a29 };
+TypeInfo * __type_info__26db2e7_arg_types_var_2359058458[2] = { &__type_info__fb41f04a, &__type_info__e6eb6b88 };
+VarInfo __struct_info__8c9c601a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__26db2e7_arg_types_var_2359058458, nullptr, 2, 0, nullptr, 28, 0x26db2e7, "__lambda", 0 };
+TypeInfo * __type_info__aa9d2ece_arg_types_var_2359058458[1] = { &__type_info__eb999892 };
+VarInfo __struct_info__8c9c601a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__aa9d2ece_arg_types_var_2359058458, nullptr, 1, 0, nullptr, 28, 0xaa9d2ece, "__finalize", 4 };
+VarInfo __struct_info__8c9c601a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa66f6455, "__yield", 8 };
+VarInfo * __struct_info__8c9c601a_fields[3] =  { &__struct_info__8c9c601a_field_0, &__struct_info__8c9c601a_field_1, &__struct_info__8c9c601a_field_2 };
+StructInfo __struct_info__8c9c601a = {"_lambda_thismodule_15_8_14", __struct_info__8c9c601a_fields, 3, 12, -1, nullptr, 0x8c9c601a };
+TypeInfo * __type_info__a2a64f50_arg_types_var_1512603379[2] = { &__type_info__be5daea3, &__type_info__e6eb6b88 };
+VarInfo __struct_info__5a287ef3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a2a64f50_arg_types_var_1512603379, nullptr, 2, 0, nullptr, 28, 0xa2a64f50, "__lambda", 0 };
+TypeInfo * __type_info__e8d164f5_arg_types_var_1512603379[1] = { &__type_info__7bb8ddeb };
+VarInfo __struct_info__5a287ef3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e8d164f5_arg_types_var_1512603379, nullptr, 1, 0, nullptr, 28, 0xe8d164f5, "__finalize", 4 };
+VarInfo __struct_info__5a287ef3_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd11d08a4, "__yield", 8 };
+VarInfo __struct_info__5a287ef3_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x412add1e, "_loop_at_173", 12 };
+VarInfo __struct_info__5a287ef3_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcf4bc978, "q", 16 };
+VarInfo __struct_info__5a287ef3_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x80be9b22, "_pvar_0_at_173", 24 };
+VarInfo __struct_info__5a287ef3_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x944c8b9f, "___loop_at_174_rename_at_174", 32 };
+VarInfo __struct_info__5a287ef3_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x9485e713, "__t_rename_at_174", 36 };
+VarInfo __struct_info__5a287ef3_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaebae29f, "___pvar_0_at_174_rename_at_174", 40 };
+VarInfo __struct_info__5a287ef3_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x25d98d4e, "_source_0_at_173", 48 };
+VarInfo __struct_info__5a287ef3_field_10 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x8572774b, "___source_0_at_174_rename_at_174", 56 };
+VarInfo * __struct_info__5a287ef3_fields[11] =  { &__struct_info__5a287ef3_field_0, &__struct_info__5a287ef3_field_1, &__struct_info__5a287ef3_field_2, &__struct_info__5a287ef3_field_3, &__struct_info__5a287ef3_field_4, &__struct_info__5a287ef3_field_5, &__struct_info__5a287ef3_field_6, &__struct_info__5a287ef3_field_7, &__struct_info__5a287ef3_field_8, &__struct_info__5a287ef3_field_9, &__struct_info__5a287ef3_field_10 };
+StructInfo __struct_info__5a287ef3 = {"_lambda_thismodule_173_8_5", __struct_info__5a287ef3_fields, 11, 64, -1, nullptr, 0x5a287ef3 };
+TypeInfo * __type_info__b43a5a12_arg_types_var_453318265[2] = { &__type_info__5521c569, &__type_info__e6eb6b88 };
+VarInfo __struct_info__1b051679_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__b43a5a12_arg_types_var_453318265, nullptr, 2, 0, nullptr, 28, 0xb43a5a12, "__lambda", 0 };
+TypeInfo * __type_info__c85246b7_arg_types_var_453318265[1] = { &__type_info__f17f7ad1 };
+VarInfo __struct_info__1b051679_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__c85246b7_arg_types_var_453318265, nullptr, 1, 0, nullptr, 28, 0xc85246b7, "__finalize", 4 };
+VarInfo __struct_info__1b051679_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x530ec616, "__yield", 8 };
+VarInfo __struct_info__1b051679_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf2696991, "t", 12 };
+VarInfo * __struct_info__1b051679_fields[4] =  { &__struct_info__1b051679_field_0, &__struct_info__1b051679_field_1, &__struct_info__1b051679_field_2, &__struct_info__1b051679_field_3 };
+StructInfo __struct_info__1b051679 = {"_lambda_thismodule_98_8_9", __struct_info__1b051679_fields, 4, 16, -1, nullptr, 0x1b051679 };
+TypeInfo * __type_info__47f2622_arg_types_var_3265995177[2] = { &__type_info__1eeb119, &__type_info__e6eb6b88 };
+VarInfo __struct_info__c2ab21a9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__47f2622_arg_types_var_3265995177, nullptr, 2, 0, nullptr, 28, 0x47f2622, "__lambda", 0 };
+TypeInfo * __type_info__b90b0aa7_arg_types_var_3265995177[1] = { &__type_info__9c0e8071 };
+VarInfo __struct_info__c2ab21a9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__b90b0aa7_arg_types_var_3265995177, nullptr, 1, 0, nullptr, 28, 0xb90b0aa7, "__finalize", 4 };
+VarInfo __struct_info__c2ab21a9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4b7a226, "__yield", 8 };
+VarInfo __struct_info__c2ab21a9_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa390dea1, "t", 12 };
+VarInfo * __struct_info__c2ab21a9_fields[4] =  { &__struct_info__c2ab21a9_field_0, &__struct_info__c2ab21a9_field_1, &__struct_info__c2ab21a9_field_2, &__struct_info__c2ab21a9_field_3 };
+StructInfo __struct_info__c2ab21a9 = {"_lambda_thismodule_116_8_11", __struct_info__c2ab21a9_fields, 4, 16, -1, nullptr, 0xc2ab21a9 };
+TypeInfo * __type_info__416ab052_arg_types_var_4155072185[2] = { &__type_info__cef2fb69, &__type_info__e6eb6b88 };
+VarInfo __struct_info__f7a95eb9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__416ab052_arg_types_var_4155072185, nullptr, 2, 0, nullptr, 28, 0x416ab052, "__lambda", 0 };
+TypeInfo * __type_info__3b2282f7_arg_types_var_4155072185[1] = { &__type_info__82d724a1 };
+VarInfo __struct_info__f7a95eb9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3b2282f7_arg_types_var_4155072185, nullptr, 1, 0, nullptr, 28, 0x3b2282f7, "__finalize", 4 };
+VarInfo __struct_info__f7a95eb9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbd409b56, "__yield", 8 };
+VarInfo __struct_info__f7a95eb9_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x1f943839, "_loop_at_181", 12 };
+VarInfo __struct_info__f7a95eb9_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2bd12dd1, "t", 16 };
+VarInfo __struct_info__f7a95eb9_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xfbcb3d19, "_pvar_0_at_181", 24 };
+VarInfo __struct_info__f7a95eb9_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x43000df5, "_source_0_at_181", 32 };
+VarInfo * __struct_info__f7a95eb9_fields[7] =  { &__struct_info__f7a95eb9_field_0, &__struct_info__f7a95eb9_field_1, &__struct_info__f7a95eb9_field_2, &__struct_info__f7a95eb9_field_3, &__struct_info__f7a95eb9_field_4, &__struct_info__f7a95eb9_field_5, &__struct_info__f7a95eb9_field_6 };
+StructInfo __struct_info__f7a95eb9 = {"_lambda_thismodule_181_8_4", __struct_info__f7a95eb9_fields, 7, 40, -1, nullptr, 0xf7a95eb9 };
+TypeInfo * __type_info__9796f747_arg_types_var_323815034[2] = { &__type_info__587979aa, &__type_info__e6eb6b88 };
+VarInfo __struct_info__134d067a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__9796f747_arg_types_var_323815034, nullptr, 2, 0, nullptr, 28, 0x9796f747, "__lambda", 0 };
+TypeInfo * __type_info__cfd3b52e_arg_types_var_323815034[1] = { &__type_info__44013282 };
+VarInfo __struct_info__134d067a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cfd3b52e_arg_types_var_323815034, nullptr, 1, 0, nullptr, 28, 0xcfd3b52e, "__finalize", 4 };
+VarInfo __struct_info__134d067a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x90606c35, "__yield", 8 };
+VarInfo __struct_info__134d067a_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcd37486e, "t", 12 };
+VarInfo * __struct_info__134d067a_fields[4] =  { &__struct_info__134d067a_field_0, &__struct_info__134d067a_field_1, &__struct_info__134d067a_field_2, &__struct_info__134d067a_field_3 };
+StructInfo __struct_info__134d067a = {"_lambda_thismodule_63_8_6", __struct_info__134d067a_fields, 4, 16, -1, nullptr, 0x134d067a };
+TypeInfo * __type_info__de178e82_arg_types_var_1315894921[2] = { &__type_info__d1f6dab9, &__type_info__e6eb6b88 };
+VarInfo __struct_info__4e6ef689_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__de178e82_arg_types_var_1315894921, nullptr, 2, 0, nullptr, 28, 0xde178e82, "__lambda", 0 };
+TypeInfo * __type_info__6c459707_arg_types_var_1315894921[1] = { &__type_info__1cdd00c1 };
+VarInfo __struct_info__4e6ef689_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6c459707_arg_types_var_1315894921, nullptr, 1, 0, nullptr, 28, 0x6c459707, "__finalize", 4 };
+VarInfo __struct_info__4e6ef689_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa0eb9f06, "__yield", 8 };
+VarInfo __struct_info__4e6ef689_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd160a1f4, "_loop_at_164", 12 };
+VarInfo __struct_info__4e6ef689_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf076881, "t", 16 };
+VarInfo __struct_info__4e6ef689_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa6efa894, "_pvar_0_at_164", 24 };
+VarInfo __struct_info__4e6ef689_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x3b4eea0, "_source_0_at_164", 32 };
+VarInfo * __struct_info__4e6ef689_fields[7] =  { &__struct_info__4e6ef689_field_0, &__struct_info__4e6ef689_field_1, &__struct_info__4e6ef689_field_2, &__struct_info__4e6ef689_field_3, &__struct_info__4e6ef689_field_4, &__struct_info__4e6ef689_field_5, &__struct_info__4e6ef689_field_6 };
+StructInfo __struct_info__4e6ef689 = {"_lambda_thismodule_164_8_3", __struct_info__4e6ef689_fields, 7, 40, -1, nullptr, 0x4e6ef689 };
+TypeInfo * __type_info__576b519a_arg_types_var_3993380241[2] = { &__type_info__493816c1, &__type_info__e6eb6b88 };
+VarInfo __struct_info__ee062591_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__576b519a_arg_types_var_3993380241, nullptr, 2, 0, nullptr, 28, 0x576b519a, "__lambda", 0 };
+TypeInfo * __type_info__6020160f_arg_types_var_3993380241[1] = { &__type_info__e44201f9 };
+VarInfo __struct_info__ee062591_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__6020160f_arg_types_var_3993380241, nullptr, 1, 0, nullptr, 28, 0x6020160f, "__finalize", 4 };
+VarInfo __struct_info__ee062591_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x50aa09de, "__yield", 8 };
+VarInfo __struct_info__ee062591_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x819b5249, "t", 12 };
+VarInfo * __struct_info__ee062591_fields[4] =  { &__struct_info__ee062591_field_0, &__struct_info__ee062591_field_1, &__struct_info__ee062591_field_2, &__struct_info__ee062591_field_3 };
+StructInfo __struct_info__ee062591 = {"_lambda_thismodule_106_8_10", __struct_info__ee062591_fields, 4, 16, -1, nullptr, 0xee062591 };
+TypeInfo * __type_info__220049d2_arg_types_var_884990777[2] = { &__type_info__fa45b829, &__type_info__e6eb6b88 };
+VarInfo __struct_info__34bfe339_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__220049d2_arg_types_var_884990777, nullptr, 2, 0, nullptr, 28, 0x220049d2, "__lambda", 0 };
+TypeInfo * __type_info__d6a57877_arg_types_var_884990777[1] = { &__type_info__d409a801 };
+VarInfo __struct_info__34bfe339_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d6a57877_arg_types_var_884990777, nullptr, 1, 0, nullptr, 28, 0xd6a57877, "__finalize", 4 };
+VarInfo __struct_info__34bfe339_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x7e9a8bd6, "__yield", 8 };
+VarInfo __struct_info__34bfe339_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x1b63c251, "t", 12 };
+VarInfo * __struct_info__34bfe339_fields[4] =  { &__struct_info__34bfe339_field_0, &__struct_info__34bfe339_field_1, &__struct_info__34bfe339_field_2, &__struct_info__34bfe339_field_3 };
+StructInfo __struct_info__34bfe339 = {"_lambda_thismodule_30_8_7", __struct_info__34bfe339_fields, 4, 16, -1, nullptr, 0x34bfe339 };
+TypeInfo * __type_info__ec7c56c8_arg_types_var_2228308379[2] = { &__type_info__cedb5f8b, &__type_info__e6eb6b88 };
+VarInfo __struct_info__84d1499b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__ec7c56c8_arg_types_var_2228308379, nullptr, 2, 0, nullptr, 28, 0xec7c56c8, "__lambda", 0 };
+TypeInfo * __type_info__ff38be1d_arg_types_var_2228308379[1] = { &__type_info__c1605343 };
+VarInfo __struct_info__84d1499b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ff38be1d_arg_types_var_2228308379, nullptr, 1, 0, nullptr, 28, 0xff38be1d, "__finalize", 4 };
+VarInfo __struct_info__84d1499b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x278557dc, "__yield", 8 };
+VarInfo __struct_info__84d1499b_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x255cee00, "q", 12 };
+VarInfo __struct_info__84d1499b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcc05e405, "__t_rename_at_129", 16 };
+VarInfo * __struct_info__84d1499b_fields[5] =  { &__struct_info__84d1499b_field_0, &__struct_info__84d1499b_field_1, &__struct_info__84d1499b_field_2, &__struct_info__84d1499b_field_3, &__struct_info__84d1499b_field_4 };
+StructInfo __struct_info__84d1499b = {"_lambda_thismodule_127_8_13", __struct_info__84d1499b_fields, 5, 20, -1, nullptr, 0x84d1499b };
+TypeInfo __type_info__cef2fb69 = { Type::tStructure, &__struct_info__f7a95eb9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xcef2fb69 };
+TypeInfo __type_info__c1605343 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cedb5f8b, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc1605343 };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__1eeb119 = { Type::tStructure, &__struct_info__c2ab21a9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x1eeb119 };
+TypeInfo __type_info__fdce115e = { Type::tStructure, &__struct_info__786994ee, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xfdce115e };
+TypeInfo __type_info__44013282 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__587979aa, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x44013282 };
+TypeInfo __type_info__f17f7ad1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5521c569, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xf17f7ad1 };
+TypeInfo __type_info__e44201f9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__493816c1, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe44201f9 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__fb41f04a = { Type::tStructure, &__struct_info__8c9c601a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfb41f04a };
+TypeInfo __type_info__4dd0dc66 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fdce115e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4dd0dc66 };
+TypeInfo __type_info__7bb8ddeb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be5daea3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7bb8ddeb };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__1cdd00c1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d1f6dab9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x1cdd00c1 };
+TypeInfo __type_info__d1f6dab9 = { Type::tStructure, &__struct_info__4e6ef689, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xd1f6dab9 };
+TypeInfo __type_info__d409a801 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fa45b829, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd409a801 };
+TypeInfo __type_info__4d1901fc = { Type::tStructure, &__struct_info__8117990c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x4d1901fc };
+TypeInfo __type_info__eb999892 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fb41f04a, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xeb999892 };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xe6eb6b88 };
+TypeInfo __type_info__fa45b829 = { Type::tStructure, &__struct_info__34bfe339, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xfa45b829 };
+TypeInfo __type_info__5521c569 = { Type::tStructure, &__struct_info__1b051679, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x5521c569 };
+TypeInfo __type_info__9c0e8071 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1eeb119, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x9c0e8071 };
+TypeInfo __type_info__be5daea3 = { Type::tStructure, &__struct_info__5a287ef3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xbe5daea3 };
+TypeInfo __type_info__70e06e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4d1901fc, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x70e06e4 };
+TypeInfo __type_info__587979aa = { Type::tStructure, &__struct_info__134d067a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x587979aa };
+TypeInfo __type_info__c27c2d6d = { Type::tStructure, &__struct_info__5055017d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc27c2d6d };
+TypeInfo __type_info__76969f1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9836da19, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x76969f1 };
+TypeInfo __type_info__9836da19 = { Type::tStructure, &__struct_info__74c2a29, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x9836da19 };
+TypeInfo __type_info__cedb5f8b = { Type::tStructure, &__struct_info__84d1499b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xcedb5f8b };
+TypeInfo __type_info__4b5af355 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c27c2d6d, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4b5af355 };
+TypeInfo __type_info__493816c1 = { Type::tStructure, &__struct_info__ee062591, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x493816c1 };
+TypeInfo __type_info__82d724a1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cef2fb69, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x82d724a1 };
+
+namespace  {
+
+struct _lambda_thismodule_148_8_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_148_8_1,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_148_8_1 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_148;
+	int32_t t;
+	void * _pvar_0_at_148;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_148;
+};
+static_assert(sizeof(_lambda_thismodule_148_8_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,_loop_at_148)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,t)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,_pvar_0_at_148)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_148_8_1,_source_0_at_148)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_155_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_155_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_155_8_2 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_155;
+	int32_t t;
+	void * _pvar_0_at_155;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_155;
+};
+static_assert(sizeof(_lambda_thismodule_155_8_2)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,_loop_at_155)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,t)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,_pvar_0_at_155)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_155_8_2,_source_0_at_155)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_164_8_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_164_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_164_8_3 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_164;
+	int32_t t;
+	void * _pvar_0_at_164;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_164;
+};
+static_assert(sizeof(_lambda_thismodule_164_8_3)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,_loop_at_164)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,t)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,_pvar_0_at_164)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_164_8_3,_source_0_at_164)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_181_8_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_181_8_4,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_181_8_4 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_181;
+	int32_t t;
+	void * _pvar_0_at_181;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_181;
+};
+static_assert(sizeof(_lambda_thismodule_181_8_4)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,_loop_at_181)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,t)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,_pvar_0_at_181)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_181_8_4,_source_0_at_181)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_173_8_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_173_8_5,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_173_8_5 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_173;
+	int32_t q;
+	void * _pvar_0_at_173;
+	bool ___loop_at_174_rename_at_174;
+	int32_t __t_rename_at_174;
+	void * ___pvar_0_at_174_rename_at_174;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_173;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_174_rename_at_174;
+};
+static_assert(sizeof(_lambda_thismodule_173_8_5)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,_loop_at_173)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,q)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,_pvar_0_at_173)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,___loop_at_174_rename_at_174)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,__t_rename_at_174)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,___pvar_0_at_174_rename_at_174)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,_source_0_at_173)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_173_8_5,___source_0_at_174_rename_at_174)==56,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_63_8_6 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_63_8_6,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_63_8_6 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_63_8_6)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_6,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_6,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_63_8_6,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_30_8_7 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_30_8_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_30_8_7 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_30_8_7)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_7,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_7,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_30_8_7,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_46_8_8 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_46_8_8,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_46_8_8 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+	int32_t * T;
+};
+static_assert(sizeof(_lambda_thismodule_46_8_8)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_8,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_8,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_8,t)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_46_8_8,T)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_98_8_9 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_98_8_9,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_98_8_9 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_98_8_9)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_9,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_9,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_8_9,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_8_10 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_106_8_10,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_106_8_10 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_106_8_10)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_10,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_10,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_8_10,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_116_8_11 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_116_8_11,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_116_8_11 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_116_8_11)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_11,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_11,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_116_8_11,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_138_8_12 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_138_8_12,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_138_8_12 *)) __finalize;
+	int32_t __yield;
+	int32_t t;
+};
+static_assert(sizeof(_lambda_thismodule_138_8_12)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_12,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_12,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_138_8_12,t)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_127_8_13 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_127_8_13,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_127_8_13 *)) __finalize;
+	int32_t __yield;
+	int32_t q;
+	int32_t __t_rename_at_129;
+};
+static_assert(sizeof(_lambda_thismodule_127_8_13)==20,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_13,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_13,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_13,q)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_127_8_13,__t_rename_at_129)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_15_8_14 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_15_8_14,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_15_8_14 *)) __finalize;
+	int32_t __yield;
+};
+static_assert(sizeof(_lambda_thismodule_15_8_14)==12,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_14,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_8_14,__yield)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_106_8_10_0x60_finazlier_1b102502a3710a4 ( Context * __context__, _lambda_thismodule_106_8_10 * ____this_rename_at_106 );
+inline bool _Func_lambda_thismodule_106_8_10_0x60_function_1487b97823fde8a8 ( Context * __context__, _lambda_thismodule_106_8_10 & ____this_rename_at_106, int32_t & ___yield_106_rename_at_106 );
+inline void _Func_lambda_thismodule_116_8_11_0x60_finazlier_98928fba9a9f3d04 ( Context * __context__, _lambda_thismodule_116_8_11 * ____this_rename_at_116 );
+inline bool _Func_lambda_thismodule_116_8_11_0x60_function_17b156a3ab548ab9 ( Context * __context__, _lambda_thismodule_116_8_11 & ____this_rename_at_116, int32_t & ___yield_116_rename_at_116 );
+inline void _Func_lambda_thismodule_127_8_13_0x60_finazlier_3b95041e9c41e9ec ( Context * __context__, _lambda_thismodule_127_8_13 * ____this_rename_at_127 );
+inline bool _Func_lambda_thismodule_127_8_13_0x60_function_daf4e69df279f426 ( Context * __context__, _lambda_thismodule_127_8_13 & ____this_rename_at_127, int32_t & ___yield_127_rename_at_127 );
+inline void _Func_lambda_thismodule_138_8_12_0x60_finazlier_2c60f9cbebe0552a ( Context * __context__, _lambda_thismodule_138_8_12 * ____this_rename_at_138 );
+inline bool _Func_lambda_thismodule_138_8_12_0x60_function_da14fc7502c17596 ( Context * __context__, _lambda_thismodule_138_8_12 & ____this_rename_at_138, int32_t & ___yield_138_rename_at_138 );
+inline void _Func_lambda_thismodule_148_8_1_0x60_finazlier_e9c9e1e6b3d5f9c ( Context * __context__, _lambda_thismodule_148_8_1 * ____this_rename_at_148 );
+inline bool _Func_lambda_thismodule_148_8_1_0x60_function_70c78158b2c86492 ( Context * __context__, _lambda_thismodule_148_8_1 & ____this_rename_at_148, int32_t & ___yield_148_rename_at_148 );
+inline void _Func_lambda_thismodule_155_8_2_0x60_finazlier_ed81a94b0f5f4e18 ( Context * __context__, _lambda_thismodule_155_8_2 * ____this_rename_at_155 );
+inline bool _Func_lambda_thismodule_155_8_2_0x60_function_4bdd488c3f7bc97a ( Context * __context__, _lambda_thismodule_155_8_2 & ____this_rename_at_155, int32_t & ___yield_155_rename_at_155 );
+inline void _Func_lambda_thismodule_15_8_14_0x60_finazlier_483639bcd99c7e62 ( Context * __context__, _lambda_thismodule_15_8_14 * ____this_rename_at_15 );
+inline bool _Func_lambda_thismodule_15_8_14_0x60_function_ec57bc7f3af41a03 ( Context * __context__, _lambda_thismodule_15_8_14 & ____this_rename_at_15, int32_t & ___yield_15_rename_at_15 );
+inline void _Func_lambda_thismodule_164_8_3_0x60_finazlier_a37bb968a45fca8 ( Context * __context__, _lambda_thismodule_164_8_3 * ____this_rename_at_164 );
+inline bool _Func_lambda_thismodule_164_8_3_0x60_function_b24bbb23db93e7a5 ( Context * __context__, _lambda_thismodule_164_8_3 & ____this_rename_at_164, int32_t & ___yield_164_rename_at_164 );
+inline void _Func_lambda_thismodule_173_8_5_0x60_finazlier_f796b52ec6e8181c ( Context * __context__, _lambda_thismodule_173_8_5 * ____this_rename_at_173 );
+inline bool _Func_lambda_thismodule_173_8_5_0x60_function_7d9bc23b2da5d0e7 ( Context * __context__, _lambda_thismodule_173_8_5 & ____this_rename_at_173, int32_t & ___yield_173_rename_at_173 );
+inline void _Func_lambda_thismodule_181_8_4_0x60_finazlier_4a62c55b27f78f1c ( Context * __context__, _lambda_thismodule_181_8_4 * ____this_rename_at_181 );
+inline bool _Func_lambda_thismodule_181_8_4_0x60_function_3e86052a8af0d024 ( Context * __context__, _lambda_thismodule_181_8_4 & ____this_rename_at_181, int32_t & ___yield_181_rename_at_181 );
+inline void _Func_lambda_thismodule_30_8_7_0x60_finazlier_e26baaf0e4c89e04 ( Context * __context__, _lambda_thismodule_30_8_7 * ____this_rename_at_30 );
+inline bool _Func_lambda_thismodule_30_8_7_0x60_function_b30dddd6c0d380cc ( Context * __context__, _lambda_thismodule_30_8_7 & ____this_rename_at_30, int32_t & ___yield_30_rename_at_30 );
+inline void _Func_lambda_thismodule_46_8_8_0x60_finazlier_f1822544b3f3c0e0 ( Context * __context__, _lambda_thismodule_46_8_8 * ____this_rename_at_46 );
+inline bool _Func_lambda_thismodule_46_8_8_0x60_function_c7ed3da4ca34a49 ( Context * __context__, _lambda_thismodule_46_8_8 & ____this_rename_at_46, int32_t & ___yield_46_rename_at_46 );
+inline void _Func_lambda_thismodule_63_8_6_0x60_finazlier_874739bb0d6d3ba6 ( Context * __context__, _lambda_thismodule_63_8_6 * ____this_rename_at_63 );
+inline bool _Func_lambda_thismodule_63_8_6_0x60_function_aae62568819a3a6f ( Context * __context__, _lambda_thismodule_63_8_6 & ____this_rename_at_63, int32_t & ___yield_63_rename_at_63 );
+inline void _Func_lambda_thismodule_98_8_9_0x60_finazlier_8a1f09d628d84ae8 ( Context * __context__, _lambda_thismodule_98_8_9 * ____this_rename_at_98 );
+inline bool _Func_lambda_thismodule_98_8_9_0x60_function_ffb1fbe56f52e9f9 ( Context * __context__, _lambda_thismodule_98_8_9 & ____this_rename_at_98, int32_t & ___yield_98_rename_at_98 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_19671b09ebf06428 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline void checkIt_aa895ecc1cc26f72 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_2 );
+inline void finalize_262b1adc8fe3c63b ( Context * __context__, _lambda_thismodule_106_8_10 & ____this_rename_at_106 );
+inline void finalize_3f3710010986d5a3 ( Context * __context__, _lambda_thismodule_116_8_11 & ____this_rename_at_116 );
+inline void finalize_57143ae5a434801 ( Context * __context__, _lambda_thismodule_127_8_13 & ____this_rename_at_127 );
+inline void finalize_d720871d3ab48da0 ( Context * __context__, _lambda_thismodule_138_8_12 & ____this_rename_at_138 );
+inline void finalize_428a298734af4c1f ( Context * __context__, _lambda_thismodule_148_8_1 & ____this_rename_at_148 );
+inline void finalize_9e2e82722b247484 ( Context * __context__, _lambda_thismodule_155_8_2 & ____this_rename_at_155 );
+inline void finalize_2f2ac82d11b21c56 ( Context * __context__, _lambda_thismodule_15_8_14 & ____this_rename_at_15 );
+inline void finalize_f4d5d4cf540ae7e7 ( Context * __context__, _lambda_thismodule_164_8_3 & ____this_rename_at_164 );
+inline void finalize_6594ef21d887c236 ( Context * __context__, _lambda_thismodule_173_8_5 & ____this_rename_at_173 );
+inline void finalize_e2231aa72c9d2567 ( Context * __context__, _lambda_thismodule_181_8_4 & ____this_rename_at_181 );
+inline void finalize_3a95fb8a730d49a7 ( Context * __context__, _lambda_thismodule_30_8_7 & ____this_rename_at_30 );
+inline void finalize_6f2e1a0bb3794fc7 ( Context * __context__, _lambda_thismodule_46_8_8 & ____this_rename_at_46 );
+inline void finalize_9976807588353dc2 ( Context * __context__, _lambda_thismodule_63_8_6 & ____this_rename_at_63 );
+inline void finalize_95af81c3803e7837 ( Context * __context__, _lambda_thismodule_98_8_9 & ____this_rename_at_98 );
+inline bool test_3923557ae2b0401c ( Context * __context__ );
+inline void test_for_5fa47c12ee509501 ( Context * __context__ );
+inline void test_for_break_c47ba61cd0f3df14 ( Context * __context__ );
+inline void test_for_continue_31f8be97f89a4166 ( Context * __context__ );
+inline void test_for_finally_d268ff4a49626be0 ( Context * __context__ );
+inline void test_for_nested_e2d86ee6ef93bb06 ( Context * __context__ );
+inline void test_if_f1f9aeadced7573c ( Context * __context__ );
+inline void test_local_3bc07eff39b41bb6 ( Context * __context__ );
+inline void test_local_ref_e4ce14e27150a614 ( Context * __context__ );
+inline void test_while_8aa4c7cc1b2ffefc ( Context * __context__ );
+inline void test_while_break_1f4fe9805f88f954 ( Context * __context__ );
+inline void test_while_continue_b06f72f8859fdcbb ( Context * __context__ );
+inline void test_while_finally_e36d0966754e5c89 ( Context * __context__ );
+inline void test_while_nested_9ade6efc13d876e3 ( Context * __context__ );
+inline void test_yield_39eb54b51aa69fb2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_106_8_10_0x60_finazlier_1b102502a3710a4 ( Context * __context__, _lambda_thismodule_106_8_10 * ____this_rename_at_106 )
+{
+	finalize_262b1adc8fe3c63b(__context__,das_arg<_lambda_thismodule_106_8_10>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<_lambda_thismodule_106_8_10 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline bool _Func_lambda_thismodule_106_8_10_0x60_function_1487b97823fde8a8 ( Context * __context__, _lambda_thismodule_106_8_10 &  ____this_rename_at_106, int32_t & ___yield_106_rename_at_106 )
+{
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_106.t < 100) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_106.t == 10 )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_106_rename_at_106,____this_rename_at_106.t++);
+	das_copy(____this_rename_at_106.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_116_8_11_0x60_finazlier_98928fba9a9f3d04 ( Context * __context__, _lambda_thismodule_116_8_11 * ____this_rename_at_116 )
+{
+	finalize_3f3710010986d5a3(__context__,das_arg<_lambda_thismodule_116_8_11>::pass(das_deref(__context__,____this_rename_at_116)));
+	das_delete_lambda_struct<_lambda_thismodule_116_8_11 *>::clear(__context__,____this_rename_at_116);
+}
+
+inline bool _Func_lambda_thismodule_116_8_11_0x60_function_17b156a3ab548ab9 ( Context * __context__, _lambda_thismodule_116_8_11 &  ____this_rename_at_116, int32_t & ___yield_116_rename_at_116 )
+{
+	switch (____this_rename_at_116.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_116.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_116.t < 100) )
+	{
+		goto label_3;
+	};
+	if ( ____this_rename_at_116.t >= 10 )
+	{
+		____this_rename_at_116.t++;
+		goto label_2;
+	};
+	das_copy(___yield_116_rename_at_116,____this_rename_at_116.t++);
+	das_copy(____this_rename_at_116.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_127_8_13_0x60_finazlier_3b95041e9c41e9ec ( Context * __context__, _lambda_thismodule_127_8_13 * ____this_rename_at_127 )
+{
+	finalize_57143ae5a434801(__context__,das_arg<_lambda_thismodule_127_8_13>::pass(das_deref(__context__,____this_rename_at_127)));
+	das_delete_lambda_struct<_lambda_thismodule_127_8_13 *>::clear(__context__,____this_rename_at_127);
+}
+
+inline bool _Func_lambda_thismodule_127_8_13_0x60_function_daf4e69df279f426 ( Context * __context__, _lambda_thismodule_127_8_13 &  ____this_rename_at_127, int32_t & ___yield_127_rename_at_127 )
+{
+	switch (____this_rename_at_127.__yield) {
+	case 0: goto label_0;
+	case 4: goto label_4;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_127.q,0);
+	label_4:;;
+	if ( !(____this_rename_at_127.q < 2) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_127.__t_rename_at_129,0);
+	label_2:;;
+	if ( !(____this_rename_at_127.__t_rename_at_129 < 5) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_127_rename_at_127,(____this_rename_at_127.q * 5) + (____this_rename_at_127.__t_rename_at_129++));
+	das_copy(____this_rename_at_127.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	____this_rename_at_127.q++;
+	goto label_4;
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_138_8_12_0x60_finazlier_2c60f9cbebe0552a ( Context * __context__, _lambda_thismodule_138_8_12 * ____this_rename_at_138 )
+{
+	finalize_d720871d3ab48da0(__context__,das_arg<_lambda_thismodule_138_8_12>::pass(das_deref(__context__,____this_rename_at_138)));
+	das_delete_lambda_struct<_lambda_thismodule_138_8_12 *>::clear(__context__,____this_rename_at_138);
+}
+
+inline bool _Func_lambda_thismodule_138_8_12_0x60_function_da14fc7502c17596 ( Context * __context__, _lambda_thismodule_138_8_12 &  ____this_rename_at_138, int32_t & ___yield_138_rename_at_138 )
+{
+	switch (____this_rename_at_138.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 4: goto label_4;
+	case 2: goto label_2;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_138.t,0);
+	label_3:;;
+	if ( !(____this_rename_at_138.t < 9) )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_138_rename_at_138,____this_rename_at_138.t++);
+	das_copy(____this_rename_at_138.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_3;
+	label_4:;;
+	das_copy(___yield_138_rename_at_138,9);
+	das_copy(____this_rename_at_138.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_148_8_1_0x60_finazlier_e9c9e1e6b3d5f9c ( Context * __context__, _lambda_thismodule_148_8_1 * ____this_rename_at_148 )
+{
+	finalize_428a298734af4c1f(__context__,das_arg<_lambda_thismodule_148_8_1>::pass(das_deref(__context__,____this_rename_at_148)));
+	das_delete_lambda_struct<_lambda_thismodule_148_8_1 *>::clear(__context__,____this_rename_at_148);
+}
+
+inline bool _Func_lambda_thismodule_148_8_1_0x60_function_70c78158b2c86492 ( Context * __context__, _lambda_thismodule_148_8_1 &  ____this_rename_at_148, int32_t & ___yield_148_rename_at_148 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_148_32;
+	switch (____this_rename_at_148.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_148._loop_at_148,true);
+	das_move(____this_rename_at_148._source_0_at_148,(_temp_make_local_148_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,10)))));
+	memset(&(____this_rename_at_148.t), 0, 4);
+	das_copy(____this_rename_at_148._pvar_0_at_148,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_148.t)));
+	DAS_SETBOOLAND((____this_rename_at_148._loop_at_148),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_148._loop_at_148 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_148_rename_at_148,____this_rename_at_148.t);
+	das_copy(____this_rename_at_148.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_148._loop_at_148),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),____this_rename_at_148._pvar_0_at_148,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_155_8_2_0x60_finazlier_ed81a94b0f5f4e18 ( Context * __context__, _lambda_thismodule_155_8_2 * ____this_rename_at_155 )
+{
+	finalize_9e2e82722b247484(__context__,das_arg<_lambda_thismodule_155_8_2>::pass(das_deref(__context__,____this_rename_at_155)));
+	das_delete_lambda_struct<_lambda_thismodule_155_8_2 *>::clear(__context__,____this_rename_at_155);
+}
+
+inline bool _Func_lambda_thismodule_155_8_2_0x60_function_4bdd488c3f7bc97a ( Context * __context__, _lambda_thismodule_155_8_2 &  ____this_rename_at_155, int32_t & ___yield_155_rename_at_155 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_155_32;
+	switch (____this_rename_at_155.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_155._loop_at_155,true);
+	das_move(____this_rename_at_155._source_0_at_155,(_temp_make_local_155_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_155.t), 0, 4);
+	das_copy(____this_rename_at_155._pvar_0_at_155,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_155.t)));
+	DAS_SETBOOLAND((____this_rename_at_155._loop_at_155),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_155._loop_at_155 )
+	{
+		goto label_4;
+	};
+	if ( ____this_rename_at_155.t == 10 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_155_rename_at_155,____this_rename_at_155.t);
+	das_copy(____this_rename_at_155.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_155._loop_at_155),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),____this_rename_at_155._pvar_0_at_155,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_15_8_14_0x60_finazlier_483639bcd99c7e62 ( Context * __context__, _lambda_thismodule_15_8_14 * ____this_rename_at_15 )
+{
+	finalize_2f2ac82d11b21c56(__context__,das_arg<_lambda_thismodule_15_8_14>::pass(das_deref(__context__,____this_rename_at_15)));
+	das_delete_lambda_struct<_lambda_thismodule_15_8_14 *>::clear(__context__,____this_rename_at_15);
+}
+
+inline bool _Func_lambda_thismodule_15_8_14_0x60_function_ec57bc7f3af41a03 ( Context * __context__, _lambda_thismodule_15_8_14 &  ____this_rename_at_15, int32_t & ___yield_15_rename_at_15 )
+{
+	switch (____this_rename_at_15.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(___yield_15_rename_at_15,0);
+	das_copy(____this_rename_at_15.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_15_rename_at_15,1);
+	das_copy(____this_rename_at_15.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_15_rename_at_15,2);
+	das_copy(____this_rename_at_15.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_15_rename_at_15,3);
+	das_copy(____this_rename_at_15.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_15_rename_at_15,4);
+	das_copy(____this_rename_at_15.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_15_rename_at_15,5);
+	das_copy(____this_rename_at_15.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_15_rename_at_15,6);
+	das_copy(____this_rename_at_15.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_15_rename_at_15,7);
+	das_copy(____this_rename_at_15.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_15_rename_at_15,8);
+	das_copy(____this_rename_at_15.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_15_rename_at_15,9);
+	das_copy(____this_rename_at_15.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_164_8_3_0x60_finazlier_a37bb968a45fca8 ( Context * __context__, _lambda_thismodule_164_8_3 * ____this_rename_at_164 )
+{
+	finalize_f4d5d4cf540ae7e7(__context__,das_arg<_lambda_thismodule_164_8_3>::pass(das_deref(__context__,____this_rename_at_164)));
+	das_delete_lambda_struct<_lambda_thismodule_164_8_3 *>::clear(__context__,____this_rename_at_164);
+}
+
+inline bool _Func_lambda_thismodule_164_8_3_0x60_function_b24bbb23db93e7a5 ( Context * __context__, _lambda_thismodule_164_8_3 &  ____this_rename_at_164, int32_t & ___yield_164_rename_at_164 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_164_32;
+	switch (____this_rename_at_164.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_164._loop_at_164,true);
+	das_move(____this_rename_at_164._source_0_at_164,(_temp_make_local_164_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,100)))));
+	memset(&(____this_rename_at_164.t), 0, 4);
+	das_copy(____this_rename_at_164._pvar_0_at_164,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_164.t)));
+	DAS_SETBOOLAND((____this_rename_at_164._loop_at_164),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_164._loop_at_164 )
+	{
+		goto label_4;
+	};
+	if ( ____this_rename_at_164.t >= 10 )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_164_rename_at_164,____this_rename_at_164.t);
+	das_copy(____this_rename_at_164.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_164._loop_at_164),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),____this_rename_at_164._pvar_0_at_164,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_173_8_5_0x60_finazlier_f796b52ec6e8181c ( Context * __context__, _lambda_thismodule_173_8_5 * ____this_rename_at_173 )
+{
+	finalize_6594ef21d887c236(__context__,das_arg<_lambda_thismodule_173_8_5>::pass(das_deref(__context__,____this_rename_at_173)));
+	das_delete_lambda_struct<_lambda_thismodule_173_8_5 *>::clear(__context__,____this_rename_at_173);
+}
+
+inline bool _Func_lambda_thismodule_173_8_5_0x60_function_7d9bc23b2da5d0e7 ( Context * __context__, _lambda_thismodule_173_8_5 &  ____this_rename_at_173, int32_t & ___yield_173_rename_at_173 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_173_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_174_48;
+	switch (____this_rename_at_173.__yield) {
+	case 0: goto label_0;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_173._loop_at_173,true);
+	das_move(____this_rename_at_173._source_0_at_173,(_temp_make_local_173_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,2)))));
+	memset(&(____this_rename_at_173.q), 0, 4);
+	das_copy(____this_rename_at_173._pvar_0_at_173,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_173.q)));
+	DAS_SETBOOLAND((____this_rename_at_173._loop_at_173),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__)));
+	label_5:;;
+	if ( !____this_rename_at_173._loop_at_173 )
+	{
+		goto label_7;
+	};
+	das_copy(____this_rename_at_173.___loop_at_174_rename_at_174,true);
+	das_move(____this_rename_at_173.___source_0_at_174_rename_at_174,(_temp_make_local_174_48 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)))));
+	memset(&(____this_rename_at_173.__t_rename_at_174), 0, 4);
+	das_copy(____this_rename_at_173.___pvar_0_at_174_rename_at_174,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_173.__t_rename_at_174)));
+	DAS_SETBOOLAND((____this_rename_at_173.___loop_at_174_rename_at_174),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_173.___loop_at_174_rename_at_174 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_173_rename_at_173,(____this_rename_at_173.q * 5) + ____this_rename_at_173.__t_rename_at_174);
+	das_copy(____this_rename_at_173.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_173.___loop_at_174_rename_at_174),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),____this_rename_at_173.___pvar_0_at_174_rename_at_174,__context__);
+	label_6:;;
+	DAS_SETBOOLAND((____this_rename_at_173._loop_at_173),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__)));
+	goto label_5;
+	label_7:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),____this_rename_at_173._pvar_0_at_173,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_181_8_4_0x60_finazlier_4a62c55b27f78f1c ( Context * __context__, _lambda_thismodule_181_8_4 * ____this_rename_at_181 )
+{
+	finalize_e2231aa72c9d2567(__context__,das_arg<_lambda_thismodule_181_8_4>::pass(das_deref(__context__,____this_rename_at_181)));
+	das_delete_lambda_struct<_lambda_thismodule_181_8_4 *>::clear(__context__,____this_rename_at_181);
+}
+
+inline bool _Func_lambda_thismodule_181_8_4_0x60_function_3e86052a8af0d024 ( Context * __context__, _lambda_thismodule_181_8_4 &  ____this_rename_at_181, int32_t & ___yield_181_rename_at_181 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_181_32;
+	switch (____this_rename_at_181.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_181._loop_at_181,true);
+	das_move(____this_rename_at_181._source_0_at_181,(_temp_make_local_181_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,9)))));
+	memset(&(____this_rename_at_181.t), 0, 4);
+	das_copy(____this_rename_at_181._pvar_0_at_181,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_181.t)));
+	DAS_SETBOOLAND((____this_rename_at_181._loop_at_181),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_181._loop_at_181 )
+	{
+		goto label_5;
+	};
+	das_copy(___yield_181_rename_at_181,____this_rename_at_181.t);
+	das_copy(____this_rename_at_181.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_181._loop_at_181),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__)));
+	goto label_3;
+	label_5:;;
+	das_copy(___yield_181_rename_at_181,9);
+	das_copy(____this_rename_at_181.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),____this_rename_at_181._pvar_0_at_181,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_30_8_7_0x60_finazlier_e26baaf0e4c89e04 ( Context * __context__, _lambda_thismodule_30_8_7 * ____this_rename_at_30 )
+{
+	finalize_3a95fb8a730d49a7(__context__,das_arg<_lambda_thismodule_30_8_7>::pass(das_deref(__context__,____this_rename_at_30)));
+	das_delete_lambda_struct<_lambda_thismodule_30_8_7 *>::clear(__context__,____this_rename_at_30);
+}
+
+inline bool _Func_lambda_thismodule_30_8_7_0x60_function_b30dddd6c0d380cc ( Context * __context__, _lambda_thismodule_30_8_7 &  ____this_rename_at_30, int32_t & ___yield_30_rename_at_30 )
+{
+	switch (____this_rename_at_30.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	case 6: goto label_6;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_30.t,0);
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_30_rename_at_30,____this_rename_at_30.t++);
+	das_copy(____this_rename_at_30.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_46_8_8_0x60_finazlier_f1822544b3f3c0e0 ( Context * __context__, _lambda_thismodule_46_8_8 * ____this_rename_at_46 )
+{
+	finalize_6f2e1a0bb3794fc7(__context__,das_arg<_lambda_thismodule_46_8_8>::pass(das_deref(__context__,____this_rename_at_46)));
+	das_delete_lambda_struct<_lambda_thismodule_46_8_8 *>::clear(__context__,____this_rename_at_46);
+}
+
+inline bool _Func_lambda_thismodule_46_8_8_0x60_function_c7ed3da4ca34a49 ( Context * __context__, _lambda_thismodule_46_8_8 &  ____this_rename_at_46, int32_t & ___yield_46_rename_at_46 )
+{
+	switch (____this_rename_at_46.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 6: goto label_6;
+	case 2: goto label_2;
+	case 7: goto label_7;
+	case 3: goto label_3;
+	case 8: goto label_8;
+	case 4: goto label_4;
+	case 9: goto label_9;
+	case 5: goto label_5;
+	case 10: goto label_10;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_46.t,0);
+	das_copy(____this_rename_at_46.T,das_ref(__context__,____this_rename_at_46.t));
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,6);
+	return das_auto_cast<bool>::cast(true);
+	label_6:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	das_copy(___yield_46_rename_at_46,____this_rename_at_46.t++);
+	das_copy(____this_rename_at_46.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	das_copy(___yield_46_rename_at_46,das_deref(__context__,____this_rename_at_46.T)++);
+	das_copy(____this_rename_at_46.__yield,10);
+	return das_auto_cast<bool>::cast(true);
+	label_10:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_63_8_6_0x60_finazlier_874739bb0d6d3ba6 ( Context * __context__, _lambda_thismodule_63_8_6 * ____this_rename_at_63 )
+{
+	finalize_9976807588353dc2(__context__,das_arg<_lambda_thismodule_63_8_6>::pass(das_deref(__context__,____this_rename_at_63)));
+	das_delete_lambda_struct<_lambda_thismodule_63_8_6 *>::clear(__context__,____this_rename_at_63);
+}
+
+inline bool _Func_lambda_thismodule_63_8_6_0x60_function_aae62568819a3a6f ( Context * __context__, _lambda_thismodule_63_8_6 &  ____this_rename_at_63, int32_t & ___yield_63_rename_at_63 )
+{
+	switch (____this_rename_at_63.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	case 10: goto label_10;
+	case 9: goto label_9;
+	case 11: goto label_11;
+	case 13: goto label_13;
+	case 12: goto label_12;
+	case 14: goto label_14;
+	case 15: goto label_15;
+	case 20: goto label_20;
+	case 16: goto label_16;
+	case 18: goto label_18;
+	case 17: goto label_17;
+	case 19: goto label_19;
+	case 21: goto label_21;
+	case 22: goto label_22;
+	case 23: goto label_23;
+	case 24: goto label_24;
+	case 25: goto label_25;
+	case 26: goto label_26;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_63.t,0);
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	if ( !(____this_rename_at_63.t == 1) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,2);
+	return das_auto_cast<bool>::cast(true);
+	label_2:;;
+	label_3:;;
+	if ( !(____this_rename_at_63.t == 2) )
+	{
+		goto label_6;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,4);
+	return das_auto_cast<bool>::cast(true);
+	label_4:;;
+	goto label_7;
+	label_6:;;
+	das_copy(___yield_63_rename_at_63,13);
+	das_copy(____this_rename_at_63.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	label_7:;;
+	if ( !(____this_rename_at_63.t == 3) )
+	{
+		goto label_13;
+	};
+	if ( !(____this_rename_at_63.t < 10) )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,8);
+	return das_auto_cast<bool>::cast(true);
+	label_8:;;
+	goto label_11;
+	label_10:;;
+	das_copy(___yield_63_rename_at_63,13);
+	das_copy(____this_rename_at_63.__yield,9);
+	return das_auto_cast<bool>::cast(true);
+	label_9:;;
+	label_11:;;
+	goto label_14;
+	label_13:;;
+	das_copy(___yield_63_rename_at_63,12);
+	das_copy(____this_rename_at_63.__yield,12);
+	return das_auto_cast<bool>::cast(true);
+	label_12:;;
+	label_14:;;
+	if ( !(____this_rename_at_63.t == 13) )
+	{
+		goto label_20;
+	};
+	das_copy(___yield_63_rename_at_63,0);
+	das_copy(____this_rename_at_63.__yield,15);
+	return das_auto_cast<bool>::cast(true);
+	label_15:;;
+	goto label_21;
+	label_20:;;
+	if ( !(____this_rename_at_63.t == 4) )
+	{
+		goto label_18;
+	};
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,16);
+	return das_auto_cast<bool>::cast(true);
+	label_16:;;
+	goto label_19;
+	label_18:;;
+	das_copy(___yield_63_rename_at_63,-1);
+	das_copy(____this_rename_at_63.__yield,17);
+	return das_auto_cast<bool>::cast(true);
+	label_17:;;
+	label_19:;;
+	label_21:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,22);
+	return das_auto_cast<bool>::cast(true);
+	label_22:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,23);
+	return das_auto_cast<bool>::cast(true);
+	label_23:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,24);
+	return das_auto_cast<bool>::cast(true);
+	label_24:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,25);
+	return das_auto_cast<bool>::cast(true);
+	label_25:;;
+	das_copy(___yield_63_rename_at_63,____this_rename_at_63.t++);
+	das_copy(____this_rename_at_63.__yield,26);
+	return das_auto_cast<bool>::cast(true);
+	label_26:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_98_8_9_0x60_finazlier_8a1f09d628d84ae8 ( Context * __context__, _lambda_thismodule_98_8_9 * ____this_rename_at_98 )
+{
+	finalize_95af81c3803e7837(__context__,das_arg<_lambda_thismodule_98_8_9>::pass(das_deref(__context__,____this_rename_at_98)));
+	das_delete_lambda_struct<_lambda_thismodule_98_8_9 *>::clear(__context__,____this_rename_at_98);
+}
+
+inline bool _Func_lambda_thismodule_98_8_9_0x60_function_ffb1fbe56f52e9f9 ( Context * __context__, _lambda_thismodule_98_8_9 &  ____this_rename_at_98, int32_t & ___yield_98_rename_at_98 )
+{
+	switch (____this_rename_at_98.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_98.t,0);
+	label_2:;;
+	if ( !(____this_rename_at_98.t < 10) )
+	{
+		goto label_3;
+	};
+	das_copy(___yield_98_rename_at_98,____this_rename_at_98.t++);
+	das_copy(____this_rename_at_98.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_19671b09ebf06428 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline void checkIt_aa895ecc1cc26f72 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __gen_rename_at_2 )
+{
+	int32_t __count_rename_at_4 = 0;
+	{
+		bool __need_loop_5 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__gen_rename_at_2);
+		int32_t __x_rename_at_5;
+		__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,100500));
+		int32_t __y_rename_at_5;
+		__need_loop_5 = __y_iterator.first(__context__,(__y_rename_at_5)) && __need_loop_5;
+		for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) && __y_iterator.next(__context__,(__y_rename_at_5)) )
+		{
+			if ( __y_rename_at_5 >= 10 )
+			{
+				DAS_ASSERTF((false),(((char *) "output too long")));
+			};
+			DAS_ASSERTF((__x_rename_at_5 == __y_rename_at_5),(((char *) "value mismatch")));
+			__count_rename_at_4++;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_5));
+		__y_iterator.close(__context__,(__y_rename_at_5));
+	};
+	DAS_ASSERTF((__count_rename_at_4 == 10),(((char *) "output too short")));
+}
+
+inline void finalize_262b1adc8fe3c63b ( Context * __context__, _lambda_thismodule_106_8_10 &  ____this_rename_at_106 )
+{
+	memset(&(____this_rename_at_106), 0, 16);
+}
+
+inline void finalize_3f3710010986d5a3 ( Context * __context__, _lambda_thismodule_116_8_11 &  ____this_rename_at_116 )
+{
+	memset(&(____this_rename_at_116), 0, 16);
+}
+
+inline void finalize_57143ae5a434801 ( Context * __context__, _lambda_thismodule_127_8_13 &  ____this_rename_at_127 )
+{
+	memset(&(____this_rename_at_127), 0, 20);
+}
+
+inline void finalize_d720871d3ab48da0 ( Context * __context__, _lambda_thismodule_138_8_12 &  ____this_rename_at_138 )
+{
+	memset(&(____this_rename_at_138), 0, 16);
+}
+
+inline void finalize_428a298734af4c1f ( Context * __context__, _lambda_thismodule_148_8_1 &  ____this_rename_at_148 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_148._source_0_at_148),__context__);
+	memset(&(____this_rename_at_148), 0, 40);
+}
+
+inline void finalize_9e2e82722b247484 ( Context * __context__, _lambda_thismodule_155_8_2 &  ____this_rename_at_155 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_155._source_0_at_155),__context__);
+	memset(&(____this_rename_at_155), 0, 40);
+}
+
+inline void finalize_2f2ac82d11b21c56 ( Context * __context__, _lambda_thismodule_15_8_14 &  ____this_rename_at_15 )
+{
+	memset(&(____this_rename_at_15), 0, 12);
+}
+
+inline void finalize_f4d5d4cf540ae7e7 ( Context * __context__, _lambda_thismodule_164_8_3 &  ____this_rename_at_164 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_164._source_0_at_164),__context__);
+	memset(&(____this_rename_at_164), 0, 40);
+}
+
+inline void finalize_6594ef21d887c236 ( Context * __context__, _lambda_thismodule_173_8_5 &  ____this_rename_at_173 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173._source_0_at_173),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_173.___source_0_at_174_rename_at_174),__context__);
+	memset(&(____this_rename_at_173), 0, 64);
+}
+
+inline void finalize_e2231aa72c9d2567 ( Context * __context__, _lambda_thismodule_181_8_4 &  ____this_rename_at_181 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_181._source_0_at_181),__context__);
+	memset(&(____this_rename_at_181), 0, 40);
+}
+
+inline void finalize_3a95fb8a730d49a7 ( Context * __context__, _lambda_thismodule_30_8_7 &  ____this_rename_at_30 )
+{
+	memset(&(____this_rename_at_30), 0, 16);
+}
+
+inline void finalize_6f2e1a0bb3794fc7 ( Context * __context__, _lambda_thismodule_46_8_8 &  ____this_rename_at_46 )
+{
+	memset(&(____this_rename_at_46), 0, 24);
+}
+
+inline void finalize_9976807588353dc2 ( Context * __context__, _lambda_thismodule_63_8_6 &  ____this_rename_at_63 )
+{
+	memset(&(____this_rename_at_63), 0, 16);
+}
+
+inline void finalize_95af81c3803e7837 ( Context * __context__, _lambda_thismodule_98_8_9 &  ____this_rename_at_98 )
+{
+	memset(&(____this_rename_at_98), 0, 16);
+}
+
+inline bool test_3923557ae2b0401c ( Context * __context__ )
+{
+	test_yield_39eb54b51aa69fb2(__context__);
+	test_local_3bc07eff39b41bb6(__context__);
+	test_local_ref_e4ce14e27150a614(__context__);
+	test_if_f1f9aeadced7573c(__context__);
+	test_while_8aa4c7cc1b2ffefc(__context__);
+	test_while_break_1f4fe9805f88f954(__context__);
+	test_while_continue_b06f72f8859fdcbb(__context__);
+	test_while_nested_9ade6efc13d876e3(__context__);
+	test_while_finally_e36d0966754e5c89(__context__);
+	test_for_5fa47c12ee509501(__context__);
+	test_for_break_c47ba61cd0f3df14(__context__);
+	test_for_continue_31f8be97f89a4166(__context__);
+	test_for_nested_e2d86ee6ef93bb06(__context__);
+	test_for_finally_d268ff4a49626be0(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_for_5fa47c12ee509501 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_147_ConstRef; das_zero(__gen_rename_at_147_ConstRef); das_move(__gen_rename_at_147_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_148_8_1>::make(__context__,&__type_info__9836da19,(([&]() -> _lambda_thismodule_148_8_1 {
+		_lambda_thismodule_148_8_1 __mks_147;
+		das_zero(__mks_147);
+		das_copy((__mks_147.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_148_8_1`function _lambda_thismodule_148_8_1 int#ref*/ 3210478974u))));
+		das_copy((__mks_147.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_148_8_1`finazlier #ptr#_lambda_thismodule_148_8_1#explicit*/ 4151800710u))));
+		return __mks_147;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_147 = __gen_rename_at_147_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_147);
+}
+
+inline void test_for_break_c47ba61cd0f3df14 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_154_ConstRef; das_zero(__gen_rename_at_154_ConstRef); das_move(__gen_rename_at_154_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_155_8_2>::make(__context__,&__type_info__fdce115e,(([&]() -> _lambda_thismodule_155_8_2 {
+		_lambda_thismodule_155_8_2 __mks_154;
+		das_zero(__mks_154);
+		das_copy((__mks_154.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_155_8_2`function _lambda_thismodule_155_8_2 int#ref*/ 1741130642u))));
+		das_copy((__mks_154.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_155_8_2`finazlier #ptr#_lambda_thismodule_155_8_2#explicit*/ 4001266606u))));
+		return __mks_154;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_154 = __gen_rename_at_154_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_154);
+}
+
+inline void test_for_continue_31f8be97f89a4166 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_163_ConstRef; das_zero(__gen_rename_at_163_ConstRef); das_move(__gen_rename_at_163_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_164_8_3>::make(__context__,&__type_info__d1f6dab9,(([&]() -> _lambda_thismodule_164_8_3 {
+		_lambda_thismodule_164_8_3 __mks_163;
+		das_zero(__mks_163);
+		das_copy((__mks_163.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_164_8_3`function _lambda_thismodule_164_8_3 int#ref*/ 1399970134u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_164_8_3`finazlier #ptr#_lambda_thismodule_164_8_3#explicit*/ 977486982u))));
+		return __mks_163;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_163 = __gen_rename_at_163_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_163);
+}
+
+inline void test_for_finally_d268ff4a49626be0 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_180_ConstRef; das_zero(__gen_rename_at_180_ConstRef); das_move(__gen_rename_at_180_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_181_8_4>::make(__context__,&__type_info__cef2fb69,(([&]() -> _lambda_thismodule_181_8_4 {
+		_lambda_thismodule_181_8_4 __mks_180;
+		das_zero(__mks_180);
+		das_copy((__mks_180.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_181_8_4`function _lambda_thismodule_181_8_4 int#ref*/ 1092495998u))));
+		das_copy((__mks_180.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_181_8_4`finazlier #ptr#_lambda_thismodule_181_8_4#explicit*/ 2681609382u))));
+		return __mks_180;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_180 = __gen_rename_at_180_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_180);
+}
+
+inline void test_for_nested_e2d86ee6ef93bb06 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_172_ConstRef; das_zero(__gen_rename_at_172_ConstRef); das_move(__gen_rename_at_172_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_173_8_5>::make(__context__,&__type_info__be5daea3,(([&]() -> _lambda_thismodule_173_8_5 {
+		_lambda_thismodule_173_8_5 __mks_172;
+		das_zero(__mks_172);
+		das_copy((__mks_172.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_173_8_5`function _lambda_thismodule_173_8_5 int#ref*/ 2114573582u))));
+		das_copy((__mks_172.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_173_8_5`finazlier #ptr#_lambda_thismodule_173_8_5#explicit*/ 561729750u))));
+		return __mks_172;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_172 = __gen_rename_at_172_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_172);
+}
+
+inline void test_if_f1f9aeadced7573c ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_62_ConstRef; das_zero(__gen_rename_at_62_ConstRef); das_move(__gen_rename_at_62_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_63_8_6>::make(__context__,&__type_info__587979aa,(([&]() -> _lambda_thismodule_63_8_6 {
+		_lambda_thismodule_63_8_6 __mks_62;
+		das_zero(__mks_62);
+		das_copy((__mks_62.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_63_8_6`function _lambda_thismodule_63_8_6 int#ref*/ 2445994712u))));
+		das_copy((__mks_62.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_63_8_6`finazlier #ptr#_lambda_thismodule_63_8_6#explicit*/ 3810998928u))));
+		return __mks_62;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_62 = __gen_rename_at_62_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_62);
+}
+
+inline void test_local_3bc07eff39b41bb6 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_29_ConstRef; das_zero(__gen_rename_at_29_ConstRef); das_move(__gen_rename_at_29_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_30_8_7>::make(__context__,&__type_info__fa45b829,(([&]() -> _lambda_thismodule_30_8_7 {
+		_lambda_thismodule_30_8_7 __mks_29;
+		das_zero(__mks_29);
+		das_copy((__mks_29.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_30_8_7`function _lambda_thismodule_30_8_7 int#ref*/ 352018342u))));
+		das_copy((__mks_29.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_30_8_7`finazlier #ptr#_lambda_thismodule_30_8_7#explicit*/ 3274280038u))));
+		return __mks_29;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_29 = __gen_rename_at_29_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_29);
+}
+
+inline void test_local_ref_e4ce14e27150a614 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_45_ConstRef; das_zero(__gen_rename_at_45_ConstRef); das_move(__gen_rename_at_45_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_46_8_8>::make(__context__,&__type_info__c27c2d6d,(([&]() -> _lambda_thismodule_46_8_8 {
+		_lambda_thismodule_46_8_8 __mks_45;
+		das_zero(__mks_45);
+		das_copy((__mks_45.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_46_8_8`function _lambda_thismodule_46_8_8 int#ref*/ 2288661750u))));
+		das_copy((__mks_45.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_46_8_8`finazlier #ptr#_lambda_thismodule_46_8_8#explicit*/ 2402887446u))));
+		return __mks_45;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_45 = __gen_rename_at_45_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_45);
+}
+
+inline void test_while_8aa4c7cc1b2ffefc ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_97_ConstRef; das_zero(__gen_rename_at_97_ConstRef); das_move(__gen_rename_at_97_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_98_8_9>::make(__context__,&__type_info__5521c569,(([&]() -> _lambda_thismodule_98_8_9 {
+		_lambda_thismodule_98_8_9 __mks_97;
+		das_zero(__mks_97);
+		das_copy((__mks_97.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_98_8_9`function _lambda_thismodule_98_8_9 int#ref*/ 321991886u))));
+		das_copy((__mks_97.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_98_8_9`finazlier #ptr#_lambda_thismodule_98_8_9#explicit*/ 3858385510u))));
+		return __mks_97;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_97 = __gen_rename_at_97_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_97);
+}
+
+inline void test_while_break_1f4fe9805f88f954 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_105_ConstRef; das_zero(__gen_rename_at_105_ConstRef); das_move(__gen_rename_at_105_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_106_8_10>::make(__context__,&__type_info__493816c1,(([&]() -> _lambda_thismodule_106_8_10 {
+		_lambda_thismodule_106_8_10 __mks_105;
+		das_zero(__mks_105);
+		das_copy((__mks_105.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_8_10`function _lambda_thismodule_106_8_10 int#ref*/ 2832109334u))));
+		das_copy((__mks_105.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_106_8_10`finazlier #ptr#_lambda_thismodule_106_8_10#explicit*/ 179671494u))));
+		return __mks_105;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_105 = __gen_rename_at_105_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_105);
+}
+
+inline void test_while_continue_b06f72f8859fdcbb ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_115_ConstRef; das_zero(__gen_rename_at_115_ConstRef); das_move(__gen_rename_at_115_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_116_8_11>::make(__context__,&__type_info__1eeb119,(([&]() -> _lambda_thismodule_116_8_11 {
+		_lambda_thismodule_116_8_11 __mks_115;
+		das_zero(__mks_115);
+		das_copy((__mks_115.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_116_8_11`function _lambda_thismodule_116_8_11 int#ref*/ 2911041014u))));
+		das_copy((__mks_115.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_116_8_11`finazlier #ptr#_lambda_thismodule_116_8_11#explicit*/ 4002708998u))));
+		return __mks_115;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_115 = __gen_rename_at_115_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_115);
+}
+
+inline void test_while_finally_e36d0966754e5c89 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_137_ConstRef; das_zero(__gen_rename_at_137_ConstRef); das_move(__gen_rename_at_137_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_138_8_12>::make(__context__,&__type_info__4d1901fc,(([&]() -> _lambda_thismodule_138_8_12 {
+		_lambda_thismodule_138_8_12 __mks_137;
+		das_zero(__mks_137);
+		das_copy((__mks_137.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_138_8_12`function _lambda_thismodule_138_8_12 int#ref*/ 1933561588u))));
+		das_copy((__mks_137.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_138_8_12`finazlier #ptr#_lambda_thismodule_138_8_12#explicit*/ 1423688028u))));
+		return __mks_137;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_137 = __gen_rename_at_137_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_137);
+}
+
+inline void test_while_nested_9ade6efc13d876e3 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_126_ConstRef; das_zero(__gen_rename_at_126_ConstRef); das_move(__gen_rename_at_126_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_127_8_13>::make(__context__,&__type_info__cedb5f8b,(([&]() -> _lambda_thismodule_127_8_13 {
+		_lambda_thismodule_127_8_13 __mks_126;
+		das_zero(__mks_126);
+		das_copy((__mks_126.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_127_8_13`function _lambda_thismodule_127_8_13 int#ref*/ 2382310918u))));
+		das_copy((__mks_126.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_127_8_13`finazlier #ptr#_lambda_thismodule_127_8_13#explicit*/ 3571474718u))));
+		return __mks_126;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_126 = __gen_rename_at_126_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_126);
+}
+
+inline void test_yield_39eb54b51aa69fb2 ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((int32_t)) __gen_rename_at_14_ConstRef; das_zero(__gen_rename_at_14_ConstRef); das_move(__gen_rename_at_14_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_19671b09ebf06428(__context__,das_ascend<bool,_lambda_thismodule_15_8_14>::make(__context__,&__type_info__fb41f04a,(([&]() -> _lambda_thismodule_15_8_14 {
+		_lambda_thismodule_15_8_14 __mks_14;
+		das_zero(__mks_14);
+		das_copy((__mks_14.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_15_8_14`function _lambda_thismodule_15_8_14 int#ref*/ 583927846u))));
+		das_copy((__mks_14.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_15_8_14`finazlier #ptr#_lambda_thismodule_15_8_14#explicit*/ 3220251450u))));
+		return __mks_14;
+	})())))));
+	Sequence DAS_COMMENT((int32_t)) const  & __gen_rename_at_14 = __gen_rename_at_14_ConstRef; ;
+	checkIt_aa895ecc1cc26f72(__context__,__gen_rename_at_14);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_106_8_10_0x60_finazlier_1b102502a3710a4
+		aotLib[0x7587a149c0f727f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_8_10 *  ),&_Func_lambda_thismodule_106_8_10_0x60_finazlier_1b102502a3710a4>>();
+	};
+		// _Func_lambda_thismodule_106_8_10_0x60_function_1487b97823fde8a8
+		aotLib[0x2956f29cba73e445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_106_8_10 & , int32_t &  ),&_Func_lambda_thismodule_106_8_10_0x60_function_1487b97823fde8a8>>();
+	};
+		// _Func_lambda_thismodule_116_8_11_0x60_finazlier_98928fba9a9f3d04
+		aotLib[0xbbe3c63a22607e5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_116_8_11 *  ),&_Func_lambda_thismodule_116_8_11_0x60_finazlier_98928fba9a9f3d04>>();
+	};
+		// _Func_lambda_thismodule_116_8_11_0x60_function_17b156a3ab548ab9
+		aotLib[0xe6f120f54bcb2b1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_116_8_11 & , int32_t &  ),&_Func_lambda_thismodule_116_8_11_0x60_function_17b156a3ab548ab9>>();
+	};
+		// _Func_lambda_thismodule_127_8_13_0x60_finazlier_3b95041e9c41e9ec
+		aotLib[0x35405c3a8b597720] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_127_8_13 *  ),&_Func_lambda_thismodule_127_8_13_0x60_finazlier_3b95041e9c41e9ec>>();
+	};
+		// _Func_lambda_thismodule_127_8_13_0x60_function_daf4e69df279f426
+		aotLib[0xe35f99680f9a5945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_127_8_13 & , int32_t &  ),&_Func_lambda_thismodule_127_8_13_0x60_function_daf4e69df279f426>>();
+	};
+		// _Func_lambda_thismodule_138_8_12_0x60_finazlier_2c60f9cbebe0552a
+		aotLib[0x94d76a8a22242c29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_138_8_12 *  ),&_Func_lambda_thismodule_138_8_12_0x60_finazlier_2c60f9cbebe0552a>>();
+	};
+		// _Func_lambda_thismodule_138_8_12_0x60_function_da14fc7502c17596
+		aotLib[0x713edd521a950811] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_138_8_12 & , int32_t &  ),&_Func_lambda_thismodule_138_8_12_0x60_function_da14fc7502c17596>>();
+	};
+		// _Func_lambda_thismodule_148_8_1_0x60_finazlier_e9c9e1e6b3d5f9c
+		aotLib[0xc1586ad15736cd6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_148_8_1 *  ),&_Func_lambda_thismodule_148_8_1_0x60_finazlier_e9c9e1e6b3d5f9c>>();
+	};
+		// _Func_lambda_thismodule_148_8_1_0x60_function_70c78158b2c86492
+		aotLib[0x7be30cc7492ae2bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_148_8_1 & , int32_t &  ),&_Func_lambda_thismodule_148_8_1_0x60_function_70c78158b2c86492>>();
+	};
+		// _Func_lambda_thismodule_155_8_2_0x60_finazlier_ed81a94b0f5f4e18
+		aotLib[0xbd7cdd05ef12a494] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_2 *  ),&_Func_lambda_thismodule_155_8_2_0x60_finazlier_ed81a94b0f5f4e18>>();
+	};
+		// _Func_lambda_thismodule_155_8_2_0x60_function_4bdd488c3f7bc97a
+		aotLib[0x4466f90ee100b9fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_155_8_2 & , int32_t &  ),&_Func_lambda_thismodule_155_8_2_0x60_function_4bdd488c3f7bc97a>>();
+	};
+		// _Func_lambda_thismodule_15_8_14_0x60_finazlier_483639bcd99c7e62
+		aotLib[0x47948471ce3f6808] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_8_14 *  ),&_Func_lambda_thismodule_15_8_14_0x60_finazlier_483639bcd99c7e62>>();
+	};
+		// _Func_lambda_thismodule_15_8_14_0x60_function_ec57bc7f3af41a03
+		aotLib[0xf60d0277173bce2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_15_8_14 & , int32_t &  ),&_Func_lambda_thismodule_15_8_14_0x60_function_ec57bc7f3af41a03>>();
+	};
+		// _Func_lambda_thismodule_164_8_3_0x60_finazlier_a37bb968a45fca8
+		aotLib[0x2feb5d2ad1e646d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_164_8_3 *  ),&_Func_lambda_thismodule_164_8_3_0x60_finazlier_a37bb968a45fca8>>();
+	};
+		// _Func_lambda_thismodule_164_8_3_0x60_function_b24bbb23db93e7a5
+		aotLib[0xe50f7e114a4f5228] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_164_8_3 & , int32_t &  ),&_Func_lambda_thismodule_164_8_3_0x60_function_b24bbb23db93e7a5>>();
+	};
+		// _Func_lambda_thismodule_173_8_5_0x60_finazlier_f796b52ec6e8181c
+		aotLib[0x24cd18f7ee4c67b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_5 *  ),&_Func_lambda_thismodule_173_8_5_0x60_finazlier_f796b52ec6e8181c>>();
+	};
+		// _Func_lambda_thismodule_173_8_5_0x60_function_7d9bc23b2da5d0e7
+		aotLib[0xd5060bba0d4290dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_173_8_5 & , int32_t &  ),&_Func_lambda_thismodule_173_8_5_0x60_function_7d9bc23b2da5d0e7>>();
+	};
+		// _Func_lambda_thismodule_181_8_4_0x60_finazlier_4a62c55b27f78f1c
+		aotLib[0xeeece74528d72b64] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_181_8_4 *  ),&_Func_lambda_thismodule_181_8_4_0x60_finazlier_4a62c55b27f78f1c>>();
+	};
+		// _Func_lambda_thismodule_181_8_4_0x60_function_3e86052a8af0d024
+		aotLib[0x80f45b6ba3f87e24] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_181_8_4 & , int32_t &  ),&_Func_lambda_thismodule_181_8_4_0x60_function_3e86052a8af0d024>>();
+	};
+		// _Func_lambda_thismodule_30_8_7_0x60_finazlier_e26baaf0e4c89e04
+		aotLib[0xdda7b37fe1cab81d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_30_8_7 *  ),&_Func_lambda_thismodule_30_8_7_0x60_finazlier_e26baaf0e4c89e04>>();
+	};
+		// _Func_lambda_thismodule_30_8_7_0x60_function_b30dddd6c0d380cc
+		aotLib[0x591df412b64d57fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_30_8_7 & , int32_t &  ),&_Func_lambda_thismodule_30_8_7_0x60_function_b30dddd6c0d380cc>>();
+	};
+		// _Func_lambda_thismodule_46_8_8_0x60_finazlier_f1822544b3f3c0e0
+		aotLib[0x41aac653440fb491] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_46_8_8 *  ),&_Func_lambda_thismodule_46_8_8_0x60_finazlier_f1822544b3f3c0e0>>();
+	};
+		// _Func_lambda_thismodule_46_8_8_0x60_function_c7ed3da4ca34a49
+		aotLib[0x396655beee530d29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_46_8_8 & , int32_t &  ),&_Func_lambda_thismodule_46_8_8_0x60_function_c7ed3da4ca34a49>>();
+	};
+		// _Func_lambda_thismodule_63_8_6_0x60_finazlier_874739bb0d6d3ba6
+		aotLib[0x3b2fb64114a55411] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_63_8_6 *  ),&_Func_lambda_thismodule_63_8_6_0x60_finazlier_874739bb0d6d3ba6>>();
+	};
+		// _Func_lambda_thismodule_63_8_6_0x60_function_aae62568819a3a6f
+		aotLib[0xfda65bbf3b857a1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_63_8_6 & , int32_t &  ),&_Func_lambda_thismodule_63_8_6_0x60_function_aae62568819a3a6f>>();
+	};
+		// _Func_lambda_thismodule_98_8_9_0x60_finazlier_8a1f09d628d84ae8
+		aotLib[0x49659a3cc3e32928] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_8_9 *  ),&_Func_lambda_thismodule_98_8_9_0x60_finazlier_8a1f09d628d84ae8>>();
+	};
+		// _Func_lambda_thismodule_98_8_9_0x60_function_ffb1fbe56f52e9f9
+		aotLib[0xee59689ba08cc919] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_98_8_9 & , int32_t &  ),&_Func_lambda_thismodule_98_8_9_0x60_function_ffb1fbe56f52e9f9>>();
+	};
+		// _Funcbuiltin_0x60_each_19671b09ebf06428
+		aotLib[0xadb254e941cca0a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_19671b09ebf06428>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// checkIt_aa895ecc1cc26f72
+		aotLib[0xfaef26ad71d8d025] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&checkIt_aa895ecc1cc26f72>>();
+	};
+		// finalize_262b1adc8fe3c63b
+		aotLib[0x4b689c3f34e5cc4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_8_10 &  ),&finalize_262b1adc8fe3c63b>>();
+	};
+		// finalize_3f3710010986d5a3
+		aotLib[0x744dc482cd83f4a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_116_8_11 &  ),&finalize_3f3710010986d5a3>>();
+	};
+		// finalize_57143ae5a434801
+		aotLib[0x44ea7fe20ad3a055] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_127_8_13 &  ),&finalize_57143ae5a434801>>();
+	};
+		// finalize_d720871d3ab48da0
+		aotLib[0x9bfbb6ec34aa0ba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_138_8_12 &  ),&finalize_d720871d3ab48da0>>();
+	};
+		// finalize_428a298734af4c1f
+		aotLib[0xeaca292bdd38f65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_148_8_1 &  ),&finalize_428a298734af4c1f>>();
+	};
+		// finalize_9e2e82722b247484
+		aotLib[0xe6d45307db8bc745] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_155_8_2 &  ),&finalize_9e2e82722b247484>>();
+	};
+		// finalize_2f2ac82d11b21c56
+		aotLib[0x9d9b60b31f28fb49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_8_14 &  ),&finalize_2f2ac82d11b21c56>>();
+	};
+		// finalize_f4d5d4cf540ae7e7
+		aotLib[0x5c912223c0e44ac9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_164_8_3 &  ),&finalize_f4d5d4cf540ae7e7>>();
+	};
+		// finalize_6594ef21d887c236
+		aotLib[0xaeee7e96cfbf4ad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_173_8_5 &  ),&finalize_6594ef21d887c236>>();
+	};
+		// finalize_e2231aa72c9d2567
+		aotLib[0x4862d14c0e50ad91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_181_8_4 &  ),&finalize_e2231aa72c9d2567>>();
+	};
+		// finalize_3a95fb8a730d49a7
+		aotLib[0xbe53692adae40805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_30_8_7 &  ),&finalize_3a95fb8a730d49a7>>();
+	};
+		// finalize_6f2e1a0bb3794fc7
+		aotLib[0xe19bdaf3dd913c5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_46_8_8 &  ),&finalize_6f2e1a0bb3794fc7>>();
+	};
+		// finalize_9976807588353dc2
+		aotLib[0x77e53acb33dfdd0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_63_8_6 &  ),&finalize_9976807588353dc2>>();
+	};
+		// finalize_95af81c3803e7837
+		aotLib[0x70bf2730007ded55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_8_9 &  ),&finalize_95af81c3803e7837>>();
+	};
+		// test_3923557ae2b0401c
+		aotLib[0xdab6263a5c141a6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3923557ae2b0401c>>();
+	};
+		// test_for_5fa47c12ee509501
+		aotLib[0xb64a344916dc595e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_5fa47c12ee509501>>();
+	};
+		// test_for_break_c47ba61cd0f3df14
+		aotLib[0x19f42d1fadea05d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_break_c47ba61cd0f3df14>>();
+	};
+		// test_for_continue_31f8be97f89a4166
+		aotLib[0x2acbf2f4359a60cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_continue_31f8be97f89a4166>>();
+	};
+		// test_for_finally_d268ff4a49626be0
+		aotLib[0x3c94194e689b1324] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_finally_d268ff4a49626be0>>();
+	};
+		// test_for_nested_e2d86ee6ef93bb06
+		aotLib[0x62b90d9477ca630d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_for_nested_e2d86ee6ef93bb06>>();
+	};
+		// test_if_f1f9aeadced7573c
+		aotLib[0xac9fd8df807a704] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_if_f1f9aeadced7573c>>();
+	};
+		// test_local_3bc07eff39b41bb6
+		aotLib[0x9fb01705037c547f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_local_3bc07eff39b41bb6>>();
+	};
+		// test_local_ref_e4ce14e27150a614
+		aotLib[0xd2f9328a7bb1256d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_local_ref_e4ce14e27150a614>>();
+	};
+		// test_while_8aa4c7cc1b2ffefc
+		aotLib[0x344db3348ef2ed3a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_8aa4c7cc1b2ffefc>>();
+	};
+		// test_while_break_1f4fe9805f88f954
+		aotLib[0xc71c8b00e610e169] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_break_1f4fe9805f88f954>>();
+	};
+		// test_while_continue_b06f72f8859fdcbb
+		aotLib[0x80654bb5ab106d2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_continue_b06f72f8859fdcbb>>();
+	};
+		// test_while_finally_e36d0966754e5c89
+		aotLib[0x60d5c236a80cd6c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_finally_e36d0966754e5c89>>();
+	};
+		// test_while_nested_9ade6efc13d876e3
+		aotLib[0xc3a6ba589445b21d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_while_nested_9ade6efc13d876e3>>();
+	};
+		// test_yield_39eb54b51aa69fb2
+		aotLib[0xb51f9a4cbd5cd278] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_yield_39eb54b51aa69fb2>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,111 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline float _Func_0x60_fold_c265d32cfa9c1533 ( Context * __context__, TArray<float> const  & __a_rename_at_3, float __from_rename_at_3 );
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> & __Arr_rename_at_37, float __value_rename_at_37 );
+inline bool test_cced82795fec0118 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float _Func_0x60_fold_c265d32cfa9c1533 ( Context * __context__, TArray<float> const  &  __a_rename_at_3, float __from_rename_at_3 )
+{
+	{
+		bool __need_loop_4 = true;
+		// x : float aka numt const&
+		das_iterator<TArray<float> const > __x_iterator(__a_rename_at_3);
+		float const  * __x_rename_at_4;
+		__need_loop_4 = __x_iterator.first(__context__,(__x_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __x_iterator.next(__context__,(__x_rename_at_4)) )
+		{
+			__from_rename_at_3 += (*__x_rename_at_4);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_4));
+	};
+	return das_auto_cast<float>::cast(__from_rename_at_3);
+}
+
+inline void _Funcbuiltin_0x60_push_ce4ed03e40d5734 ( Context * __context__, TArray<float> &  __Arr_rename_at_37, float __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline bool test_cced82795fec0118 ( Context * __context__ )
+{
+	TArray<float> __a_rename_at_10; das_zero(__a_rename_at_10);
+	_Funcbuiltin_0x60_push_ce4ed03e40d5734(__context__,das_arg<TArray<float>>::pass(__a_rename_at_10),1.f);
+	_Funcbuiltin_0x60_push_ce4ed03e40d5734(__context__,das_arg<TArray<float>>::pass(__a_rename_at_10),2.f);
+	_Funcbuiltin_0x60_push_ce4ed03e40d5734(__context__,das_arg<TArray<float>>::pass(__a_rename_at_10),3.f);
+	float __q_rename_at_14 = ((float)_Func_0x60_fold_c265d32cfa9c1533(__context__,das_arg<TArray<float>>::pass(__a_rename_at_10),13.f));
+	DAS_ASSERT((__q_rename_at_14 == 19.f));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_fold_c265d32cfa9c1533
+		aotLib[0x8cfd535ef1be4165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, TArray<float> const  & , float  ),&_Func_0x60_fold_c265d32cfa9c1533>>();
+	};
+		// _Funcbuiltin_0x60_push_ce4ed03e40d5734
+		aotLib[0xede21779ebee9565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , float  ),&_Funcbuiltin_0x60_push_ce4ed03e40d5734>>();
+	};
+		// test_cced82795fec0118
+		aotLib[0x654b68ff3b868dad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cced82795fec0118>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
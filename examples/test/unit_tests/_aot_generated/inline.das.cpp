@@ -0,0 +1,147 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Point {
+	float x;
+	float y;
+};
+static_assert(sizeof(Point)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Point,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Point,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline int32_t mad_6354d5cf90662b3f ( Context * __context__, int32_t __a_rename_at_8, int32_t __b_rename_at_8, int32_t __c_rename_at_8 );
+inline int32_t next_counter_cd9078b24463857d ( Context * __context__ );
+inline int32_t sqr_369528289746da03 ( Context * __context__, int32_t __a_rename_at_5 );
+inline bool test_b7d274ceafb58ad1 ( Context * __context__ );
+inline int32_t twice_b40304dd3c5b8004 ( Context * __context__, int32_t __a_rename_at_20 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x70f0489a>(__context__) = 0;/*counter*/
+}
+
+inline int32_t mad_6354d5cf90662b3f ( Context * __context__, int32_t __a_rename_at_8, int32_t __b_rename_at_8, int32_t __c_rename_at_8 )
+{
+	return das_auto_cast<int32_t>::cast((__a_rename_at_8 * __b_rename_at_8) + __c_rename_at_8);
+}
+
+inline int32_t next_counter_cd9078b24463857d ( Context * __context__ )
+{
+	das_global<int32_t,0x70f0489a>(__context__) /*counter*/++;
+	return das_auto_cast<int32_t>::cast(das_global<int32_t,0x70f0489a>(__context__) /*counter*/);
+}
+
+inline int32_t sqr_369528289746da03 ( Context * __context__, int32_t __a_rename_at_5 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_5 * __a_rename_at_5);
+}
+
+inline bool test_b7d274ceafb58ad1 ( Context * __context__ )
+{
+	Point __p_rename_at_43_ConstRef = ((Point)(([&]() -> Point {
+		Point __mks_43;
+		das_copy((__mks_43.x),(1.5f));
+		das_copy((__mks_43.y),(2.f));
+		return __mks_43;
+	})()));
+	Point const  & __p_rename_at_43 = __p_rename_at_43_ConstRef; ;
+	DAS_ASSERT((__p_rename_at_43.x == 1.5f));
+	das_copy(das_global<int32_t,0x70f0489a>(__context__) /*counter*/,0);
+	DAS_VERIFY((twice_b40304dd3c5b8004(__context__,next_counter_cd9078b24463857d(__context__)) == 2));
+	DAS_ASSERT((das_global<int32_t,0x70f0489a>(__context__) /*counter*/ == 1));
+	DAS_VERIFY((sqr_369528289746da03(__context__,next_counter_cd9078b24463857d(__context__)) == 4));
+	DAS_ASSERT((das_global<int32_t,0x70f0489a>(__context__) /*counter*/ == 2));
+	DAS_VERIFY((mad_6354d5cf90662b3f(__context__,next_counter_cd9078b24463857d(__context__),2,3) == 9));
+	DAS_ASSERT((das_global<int32_t,0x70f0489a>(__context__) /*counter*/ == 3));
+	int32_t __a_rename_at_61 = 2;
+	das_copy(__a_rename_at_61,(__a_rename_at_61 * __a_rename_at_61) + (__a_rename_at_61 * __a_rename_at_61));
+	DAS_ASSERT((__a_rename_at_61 == 8));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline int32_t twice_b40304dd3c5b8004 ( Context * __context__, int32_t __a_rename_at_20 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_20 + __a_rename_at_20);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// mad_6354d5cf90662b3f
+		aotLib[0xdab65df541887699] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t , int32_t  ),&mad_6354d5cf90662b3f>>();
+	};
+		// next_counter_cd9078b24463857d
+		aotLib[0xcbd9a8364be829dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&next_counter_cd9078b24463857d>>();
+	};
+		// sqr_369528289746da03
+		aotLib[0xbfb6de84d9fc02bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&sqr_369528289746da03>>();
+	};
+		// test_b7d274ceafb58ad1
+		aotLib[0xef05d41bf96049a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b7d274ceafb58ad1>>();
+	};
+		// twice_b40304dd3c5b8004
+		aotLib[0xeeb05da002c842f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&twice_b40304dd3c5b8004>>();
+	};
+		// [[ init script ]]
+		aotLib[0x45d8648a4111444] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,369 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Hit {
+	int32_t id;
+	TInlineArray<int32_t,4> neighbors;
+	float4 pos;
+};
+static_assert(sizeof(Hit)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Hit,id)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,neighbors)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,pos)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Wide {
+	TInlineArray<float4,2> points;
+	int32_t tail;
+};
+static_assert(sizeof(Wide)==64,"structure size mismatch with DAS");
+static_assert(offsetof(Wide,points)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Wide,tail)==56,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline void _Funcbuiltin_0x60_emplace_89ef79c8aa040c30 ( Context * __context__, TArray<Hit> & __Arr_rename_at_49, Hit & __value_rename_at_49 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_finalize_4d356872d6bbf7fb ( Context * __context__, TArray<Hit> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_64d5afeab07ab24a ( Context * __context__, TArray<float4> & __Arr_rename_at_37, float4 __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clone_76b95ab4eaea8e9b ( Context * __context__, Hit & __a_rename_at_1, Hit const  & __b_rename_at_1 );
+inline void fill_hit_ac55d6404986f500 ( Context * __context__, Hit & __hit_rename_at_11, int32_t __count_rename_at_11 );
+inline void finalize_aed35508630d717d ( Context * __context__, Hit & ____this_rename_at_1 );
+inline void finalize_d8a20fd297f75790 ( Context * __context__, Wide & ____this_rename_at_6 );
+inline bool test_f61c0c368fa36175 ( Context * __context__ );
+inline void verify_hit_37bafe54e4841154 ( Context * __context__, Hit const  & __hit_rename_at_16, int32_t __count_rename_at_16 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline void _Funcbuiltin_0x60_emplace_89ef79c8aa040c30 ( Context * __context__, TArray<Hit> &  __Arr_rename_at_49, Hit &  __value_rename_at_49 )
+{
+	das_move(__Arr_rename_at_49(builtin_array_push_back(das_arg<TArray<Hit>>::pass(__Arr_rename_at_49),64,__context__),__context__),__value_rename_at_49);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __at_rename_at_67 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4d356872d6bbf7fb ( Context * __context__, TArray<Hit> &  __a_rename_at_186 )
+{
+	{
+		bool __need_loop_188 = true;
+		// aV : Hit aka TT&
+		das_iterator<TArray<Hit>> __aV_iterator(__a_rename_at_186);
+		Hit * __aV_rename_at_188;
+		__need_loop_188 = __aV_iterator.first(__context__,(__aV_rename_at_188)) && __need_loop_188;
+		for ( ; __need_loop_188 ; __need_loop_188 = __aV_iterator.next(__context__,(__aV_rename_at_188)) )
+		{
+			finalize_aed35508630d717d(__context__,das_arg<Hit>::pass((*__aV_rename_at_188)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_188));
+	};
+	builtin_array_free(das_arg<TArray<Hit>>::pass(__a_rename_at_186),64,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_cd1514d2d7718b99 ( Context * __context__, TArray<float4> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<float4>>::pass(__a_rename_at_186),16,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_64d5afeab07ab24a ( Context * __context__, TArray<float4> &  __Arr_rename_at_37, float4 __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float4>>::pass(__Arr_rename_at_37),16,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void clone_76b95ab4eaea8e9b ( Context * __context__, Hit &  __a_rename_at_1, Hit const  &  __b_rename_at_1 )
+{
+	das_copy(__a_rename_at_1.id,__b_rename_at_1.id);
+	_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_1.neighbors.array()),__b_rename_at_1.neighbors.array());
+	das_copy(__a_rename_at_1.pos,__b_rename_at_1.pos);
+}
+
+inline void fill_hit_ac55d6404986f500 ( Context * __context__, Hit &  __hit_rename_at_11, int32_t __count_rename_at_11 )
+{
+	{
+		bool __need_loop_12 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(mk_range(__count_rename_at_11));
+		int32_t __t_rename_at_12;
+		__need_loop_12 = __t_iterator.first(__context__,(__t_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __t_iterator.next(__context__,(__t_rename_at_12)) )
+		{
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__hit_rename_at_11.neighbors.array()),__t_rename_at_12);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_12));
+	};
+}
+
+inline void finalize_aed35508630d717d ( Context * __context__, Hit &  ____this_rename_at_1 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_1.neighbors.array()));
+	memset(&(____this_rename_at_1), 0, 64);
+}
+
+inline void finalize_d8a20fd297f75790 ( Context * __context__, Wide &  ____this_rename_at_6 )
+{
+	_Funcbuiltin_0x60_finalize_cd1514d2d7718b99(__context__,das_arg<TArray<float4>>::pass(____this_rename_at_6.points.array()));
+	memset(&(____this_rename_at_6), 0, 64);
+}
+
+inline bool test_f61c0c368fa36175 ( Context * __context__ )
+{
+	Hit __a_rename_at_27; das_zero(__a_rename_at_27);
+	fill_hit_ac55d6404986f500(__context__,das_arg<Hit>::pass(__a_rename_at_27),3);
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_27.neighbors.array())) == 4));
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__a_rename_at_27),3);
+	Hit __b_rename_at_31; das_zero(__b_rename_at_31); das_move(__b_rename_at_31, __a_rename_at_27);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_27.neighbors.array())) == 0));
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__b_rename_at_31),3);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array()),3);
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array())) == 4));
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array()),4);
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array())) == 16));
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__b_rename_at_31),5);
+	Hit __c_rename_at_39; das_zero(__c_rename_at_39);
+	clone_76b95ab4eaea8e9b(__context__,das_arg<Hit>::pass(__c_rename_at_39),das_arg<Hit>::pass(__b_rename_at_31));
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__c_rename_at_39),5);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(__c_rename_at_39.neighbors.array()),4);
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__c_rename_at_39),4);
+	TArray<Hit> __hits_rename_at_45; das_zero(__hits_rename_at_45);
+	{
+		bool __need_loop_46 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,20));
+		int32_t __t_rename_at_46;
+		__need_loop_46 = __t_iterator.first(__context__,(__t_rename_at_46)) && __need_loop_46;
+		for ( ; __need_loop_46 ; __need_loop_46 = __t_iterator.next(__context__,(__t_rename_at_46)) )
+		{
+			Hit __h_rename_at_47; das_zero(__h_rename_at_47);
+			das_copy(__h_rename_at_47.id,__t_rename_at_46);
+			fill_hit_ac55d6404986f500(__context__,das_arg<Hit>::pass(__h_rename_at_47),SimPolicy<int32_t>::Mod(__t_rename_at_46,6,*__context__));
+			_Funcbuiltin_0x60_emplace_89ef79c8aa040c30(__context__,das_arg<TArray<Hit>>::pass(__hits_rename_at_45),das_arg<Hit>::pass(__h_rename_at_47));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_46));
+	};
+	{
+		bool __need_loop_51 = true;
+		// h : Hit&
+		das_iterator<TArray<Hit>> __h_iterator(__hits_rename_at_45);
+		Hit * __h_rename_at_51;
+		__need_loop_51 = __h_iterator.first(__context__,(__h_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __h_iterator.next(__context__,(__h_rename_at_51)) )
+		{
+			verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass((*__h_rename_at_51)),SimPolicy<int32_t>::Mod((*__h_rename_at_51).id,6,*__context__));
+		}
+		__h_iterator.close(__context__,(__h_rename_at_51));
+	};
+	Wide __w_rename_at_53; das_zero(__w_rename_at_53);
+	_Funcbuiltin_0x60_push_64d5afeab07ab24a(__context__,das_arg<TArray<float4>>::pass(__w_rename_at_53.points.array()),v_splats(1.f));
+	_Funcbuiltin_0x60_push_64d5afeab07ab24a(__context__,das_arg<TArray<float4>>::pass(__w_rename_at_53.points.array()),v_splats(2.f));
+	das_copy(__w_rename_at_53.tail,13);
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<float4>>::pass(__w_rename_at_53.points.array())) == 2));
+	DAS_ASSERT((((v_extract_x(__w_rename_at_53.points.array()(0,__context__)) /*x*/ == 1.f) && (v_extract_w(__w_rename_at_53.points.array()(1,__context__)) /*w*/ == 2.f)) && (__w_rename_at_53.tail == 13)));
+	Wide __ww_rename_at_59; das_zero(__ww_rename_at_59); das_move(__ww_rename_at_59, __w_rename_at_53);
+	DAS_ASSERT(((v_extract_y(__ww_rename_at_59.points.array()(1,__context__)) /*y*/ == 2.f) && (__ww_rename_at_59.tail == 13)));
+	_Funcbuiltin_0x60_finalize_4d356872d6bbf7fb(__context__,das_arg<TArray<Hit>>::pass(__hits_rename_at_45));
+	finalize_d8a20fd297f75790(__context__,das_arg<Wide>::pass(__ww_rename_at_59));
+	finalize_aed35508630d717d(__context__,das_arg<Hit>::pass(__c_rename_at_39));
+	finalize_aed35508630d717d(__context__,das_arg<Hit>::pass(__b_rename_at_31));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array())) == 0));
+	fill_hit_ac55d6404986f500(__context__,das_arg<Hit>::pass(__b_rename_at_31),2);
+	verify_hit_37bafe54e4841154(__context__,das_arg<Hit>::pass(__b_rename_at_31),2);
+	DAS_ASSERT((builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__b_rename_at_31.neighbors.array())) == 4));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void verify_hit_37bafe54e4841154 ( Context * __context__, Hit const  &  __hit_rename_at_16, int32_t __count_rename_at_16 )
+{
+	DAS_ASSERT((builtin_array_size(__hit_rename_at_16.neighbors.array()) == __count_rename_at_16));
+	{
+		bool __need_loop_18 = true;
+		// n : int const&
+		das_iterator<TArray<int32_t> const > __n_iterator(__hit_rename_at_16.neighbors.array());
+		int32_t const  * __n_rename_at_18;
+		__need_loop_18 = __n_iterator.first(__context__,(__n_rename_at_18)) && __need_loop_18;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__count_rename_at_16));
+		int32_t __i_rename_at_18;
+		__need_loop_18 = __i_iterator.first(__context__,(__i_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __n_iterator.next(__context__,(__n_rename_at_18)) && __i_iterator.next(__context__,(__i_rename_at_18)) )
+		{
+			DAS_ASSERT(((*__n_rename_at_18) == __i_rename_at_18));
+		}
+		__n_iterator.close(__context__,(__n_rename_at_18));
+		__i_iterator.close(__context__,(__i_rename_at_18));
+	};
+	{
+		bool __need_loop_20 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(mk_range(__count_rename_at_16));
+		int32_t __t_rename_at_20;
+		__need_loop_20 = __t_iterator.first(__context__,(__t_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __t_iterator.next(__context__,(__t_rename_at_20)) )
+		{
+			DAS_ASSERT((__hit_rename_at_16.neighbors.array()(__t_rename_at_20,__context__) == __t_rename_at_20));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_20));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_emplace_89ef79c8aa040c30
+		aotLib[0xc9121cf2268c5649] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Hit> & , Hit &  ),&_Funcbuiltin_0x60_emplace_89ef79c8aa040c30>>();
+	};
+		// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+		aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+		// _Funcbuiltin_0x60_finalize_4d356872d6bbf7fb
+		aotLib[0x2a5b21f5968c14be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Hit> &  ),&_Funcbuiltin_0x60_finalize_4d356872d6bbf7fb>>();
+	};
+		// _Funcbuiltin_0x60_finalize_cd1514d2d7718b99
+		aotLib[0xcaeab429993cce4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> &  ),&_Funcbuiltin_0x60_finalize_cd1514d2d7718b99>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_64d5afeab07ab24a
+		aotLib[0x1c5fc4a66e34c455] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float4> & , float4  ),&_Funcbuiltin_0x60_push_64d5afeab07ab24a>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// clone_76b95ab4eaea8e9b
+		aotLib[0x25fba9f065b896e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Hit & , Hit const  &  ),&clone_76b95ab4eaea8e9b>>();
+	};
+		// fill_hit_ac55d6404986f500
+		aotLib[0xcada14d2e92820d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Hit & , int32_t  ),&fill_hit_ac55d6404986f500>>();
+	};
+		// finalize_aed35508630d717d
+		aotLib[0x200c685914aeb92a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Hit &  ),&finalize_aed35508630d717d>>();
+	};
+		// finalize_d8a20fd297f75790
+		aotLib[0x7dbdda3048dceaa9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Wide &  ),&finalize_d8a20fd297f75790>>();
+	};
+		// test_f61c0c368fa36175
+		aotLib[0xdbff17a331e09643] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f61c0c368fa36175>>();
+	};
+		// verify_hit_37bafe54e4841154
+		aotLib[0xd096af903011eac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Hit const  & , int32_t  ),&verify_hit_37bafe54e4841154>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,106 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void buggy_73a4d43973899dce ( Context * __context__, bool __skip_rename_at_5 );
+inline bool test_2e4a495064acf3fe ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void buggy_73a4d43973899dce ( Context * __context__, bool __skip_rename_at_5 )
+{
+	Foo * __a_rename_at_6; memset(&__a_rename_at_6,0,sizeof(__a_rename_at_6));
+	Foo * __b_rename_at_9; memset(&__b_rename_at_9,0,sizeof(__b_rename_at_9));
+	Foo _temp_new_6_48;
+/* finally */ auto __finally_6= das_finally([&](){
+	das_copy(__a_rename_at_6,nullptr);
+	das_copy(__b_rename_at_9,nullptr);
+/* end finally */ });
+	__a_rename_at_6 = das_new_on_stack<Foo>::make(_temp_new_6_48);
+	if ( __skip_rename_at_5 )
+	{
+		return ;
+	} else {
+		Foo _temp_new_9_80;
+		__b_rename_at_9 = das_new_on_stack<Foo>::make(_temp_new_9_80);
+	};
+}
+
+inline bool test_2e4a495064acf3fe ( Context * __context__ )
+{
+	buggy_73a4d43973899dce(__context__,true);
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// buggy_73a4d43973899dce
+		aotLib[0xe5e99bd884b4821] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&buggy_73a4d43973899dce>>();
+	};
+		// test_2e4a495064acf3fe
+		aotLib[0x47c252e4d6bbce14] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_2e4a495064acf3fe>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,101 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[1] = { &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[1] = { &__type_info__3ffbf730 };
+
+inline bool test_f51ede93a6cb90e2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_f51ede93a6cb90e2 ( Context * __context__ )
+{
+	int32_t __i_rename_at_5 = 100500;
+	int64_t __li_rename_at_6 = 100500100500100500ll;
+	uint32_t __u_rename_at_7 = 0xeu;
+	uint64_t __ul_rename_at_8 = 0x1650c4f16331594ull;
+	uint32_t __uh_rename_at_9 = 0x1au;
+	uint32_t __uhu_rename_at_10 = 0x12345678u;
+	uint64_t __uhl_rename_at_11 = 0x123456789abcdefull;
+	uint64_t __uhlu_rename_at_12 = 0x123456789abcdefull;
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<char * const >::from(((char *) "int"))))),cast<char *>::from(((char *) "int")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<char * const >::from(((char *) "int64"))))),cast<char *>::from(((char *) "int64")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<char * const >::from(((char *) "uint"))))),cast<char *>::from(((char *) "uint")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_3, cast<char * const >::from(((char *) "uint64"))))),cast<char *>::from(((char *) "uint64")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_4, cast<char * const >::from(((char *) "uint"))))),cast<char *>::from(((char *) "uint")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<char * const >::from(((char *) "uint"))))),cast<char *>::from(((char *) "uint")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_6, cast<char * const >::from(((char *) "uint64"))))),cast<char *>::from(((char *) "uint64")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_7, cast<char * const >::from(((char *) "uint64"))))),cast<char *>::from(((char *) "uint64")),*__context__)));
+	int32_t __ch_rename_at_21 = ((int32_t)97);
+	DAS_ASSERT((__ch_rename_at_21 == 97));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_f51ede93a6cb90e2
+		aotLib[0x8a4eae3a24ffb22d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f51ede93a6cb90e2>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
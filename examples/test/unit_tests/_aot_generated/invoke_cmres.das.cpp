@@ -0,0 +1,673 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__7d52d31c;
+extern StructInfo __struct_info__55e20ba5;
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__8da2153f;
+extern StructInfo __struct_info__403441c3;
+extern TypeInfo __type_info__e9ef3b37;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__758b1d3f;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__d99ff914;
+extern TypeInfo __type_info__74e72cdd;
+extern TypeInfo __type_info__b25b6db3;
+extern TypeInfo __type_info__2011fb8c;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__b398f3db;
+extern TypeInfo __type_info__536d22af;
+extern TypeInfo __type_info__27b4d955;
+extern VarInfo __var_info__f7c882f4;
+extern VarInfo __var_info__d8dd0985;
+extern VarInfo __var_info__38b75adb;
+extern VarInfo __var_info__cb011ec0;
+extern VarInfo __var_info__d5dd04cc;
+extern VarInfo __var_info__cca12f29;
+extern VarInfo __var_info__702282de;
+extern VarInfo __var_info__56d8f0c5;
+extern VarInfo __var_info__7d57828d;
+extern VarInfo __var_info__904af58c;
+extern VarInfo __var_info__652d1be6;
+extern FuncInfo __func_info__4624f996;
+extern FuncInfo __func_info__96c0e1d1;
+extern FuncInfo __func_info__c0439b6f;
+extern FuncInfo __func_info__e796f308;
+
+TypeInfo * __type_info__7d57828d_arg_types_var_2102579996[2] = { &__type_info__2011fb8c, &__type_info__359c1b32 };
+VarInfo __struct_info__7d52d31c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, (TypeInfo **)__type_info__7d57828d_arg_types_var_2102579996, nullptr, 2, 0, nullptr, 28, 0x7d57828d, "__lambda", 0 };
+TypeInfo * __type_info__f7c882f4_arg_types_var_2102579996[1] = { &__type_info__d99ff914 };
+VarInfo __struct_info__7d52d31c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__f7c882f4_arg_types_var_2102579996, nullptr, 1, 0, nullptr, 28, 0xf7c882f4, "__finalize", 4 };
+VarInfo * __struct_info__7d52d31c_fields[2] =  { &__struct_info__7d52d31c_field_0, &__struct_info__7d52d31c_field_1 };
+StructInfo __struct_info__7d52d31c = {"_lambda_thismodule_82_8_3", __struct_info__7d52d31c_fields, 2, 8, -1, nullptr, 0x7d52d31c };
+TypeInfo * __type_info__702282de_arg_types_var_1440877477[1] = { &__type_info__27b4d955 };
+VarInfo __struct_info__55e20ba5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__758b1d3f, nullptr, (TypeInfo **)__type_info__702282de_arg_types_var_1440877477, nullptr, 1, 0, nullptr, 28, 0x702282de, "__lambda", 0 };
+TypeInfo * __type_info__38b75adb_arg_types_var_1440877477[1] = { &__type_info__74e72cdd };
+VarInfo __struct_info__55e20ba5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__38b75adb_arg_types_var_1440877477, nullptr, 1, 0, nullptr, 28, 0x38b75adb, "__finalize", 4 };
+VarInfo * __struct_info__55e20ba5_fields[2] =  { &__struct_info__55e20ba5_field_0, &__struct_info__55e20ba5_field_1 };
+StructInfo __struct_info__55e20ba5 = {"_lambda_thismodule_80_8_2", __struct_info__55e20ba5_fields, 2, 8, -1, nullptr, 0x55e20ba5 };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd5dd04cc, "a", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xd8dd0985, "b", 4 };
+VarInfo * __struct_info__b1589007_fields[2] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 2, 8, -1, nullptr, 0xb1589007 };
+TypeInfo * __type_info__904af58c_arg_types_var_2376209727[2] = { &__type_info__536d22af, &__type_info__359c1b32 };
+VarInfo __struct_info__8da2153f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__758b1d3f, nullptr, (TypeInfo **)__type_info__904af58c_arg_types_var_2376209727, nullptr, 2, 0, nullptr, 28, 0x904af58c, "__lambda", 0 };
+TypeInfo * __type_info__cca12f29_arg_types_var_2376209727[1] = { &__type_info__e9ef3b37 };
+VarInfo __struct_info__8da2153f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cca12f29_arg_types_var_2376209727, nullptr, 1, 0, nullptr, 28, 0xcca12f29, "__finalize", 4 };
+VarInfo * __struct_info__8da2153f_fields[2] =  { &__struct_info__8da2153f_field_0, &__struct_info__8da2153f_field_1 };
+StructInfo __struct_info__8da2153f = {"_lambda_thismodule_84_8_4", __struct_info__8da2153f_fields, 2, 8, -1, nullptr, 0x8da2153f };
+TypeInfo * __type_info__cb011ec0_arg_types_var_1077166531[1] = { &__type_info__b25b6db3 };
+VarInfo __struct_info__403441c3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, (TypeInfo **)__type_info__cb011ec0_arg_types_var_1077166531, nullptr, 1, 0, nullptr, 28, 0xcb011ec0, "__lambda", 0 };
+TypeInfo * __type_info__56d8f0c5_arg_types_var_1077166531[1] = { &__type_info__b398f3db };
+VarInfo __struct_info__403441c3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__56d8f0c5_arg_types_var_1077166531, nullptr, 1, 0, nullptr, 28, 0x56d8f0c5, "__finalize", 4 };
+VarInfo * __struct_info__403441c3_fields[2] =  { &__struct_info__403441c3_field_0, &__struct_info__403441c3_field_1 };
+StructInfo __struct_info__403441c3 = {"_lambda_thismodule_78_8_1", __struct_info__403441c3_fields, 2, 8, -1, nullptr, 0x403441c3 };
+VarInfo __func_info__4624f996_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x652d1be6, "t", 0 };
+VarInfo * __func_info__4624f996_fields[1] =  { &__func_info__4624f996_field_0 };
+FuncInfo __func_info__4624f996 = {"invoke block<(t:int const):Foo const> const", "", __func_info__4624f996_fields, 1, 32, &__type_info__758b1d3f, nullptr,0,0x4624f996, 0x0 };
+FuncInfo __func_info__96c0e1d1 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__c7e1677, nullptr,0,0x96c0e1d1, 0x0 };
+VarInfo __func_info__c0439b6f_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x652d1be6, "t", 0 };
+VarInfo * __func_info__c0439b6f_fields[1] =  { &__func_info__c0439b6f_field_0 };
+FuncInfo __func_info__c0439b6f = {"invoke block<(t:int const):Foo> const", "", __func_info__c0439b6f_fields, 1, 32, &__type_info__c7e1677, nullptr,0,0xc0439b6f, 0x0 };
+FuncInfo __func_info__e796f308 = {"invoke block<Foo const> const", "", nullptr, 0, 32, &__type_info__758b1d3f, nullptr,0,0xe796f308, 0x0 };
+TypeInfo __type_info__e9ef3b37 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__536d22af, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe9ef3b37 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__758b1d3f = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x758b1d3f };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__d99ff914 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2011fb8c, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd99ff914 };
+TypeInfo __type_info__74e72cdd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__27b4d955, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x74e72cdd };
+TypeInfo __type_info__b25b6db3 = { Type::tStructure, &__struct_info__403441c3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xb25b6db3 };
+TypeInfo __type_info__2011fb8c = { Type::tStructure, &__struct_info__7d52d31c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x2011fb8c };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xc7e1677 };
+TypeInfo __type_info__b398f3db = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b25b6db3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb398f3db };
+TypeInfo __type_info__536d22af = { Type::tStructure, &__struct_info__8da2153f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x536d22af };
+TypeInfo __type_info__27b4d955 = { Type::tStructure, &__struct_info__55e20ba5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x27b4d955 };
+
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_78_8_1 {
+	Func DAS_COMMENT((Foo,_lambda_thismodule_78_8_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_78_8_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_78_8_1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_80_8_2 {
+	Func DAS_COMMENT((Foo const ,_lambda_thismodule_80_8_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_80_8_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_80_8_2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_82_8_3 {
+	Func DAS_COMMENT((Foo,_lambda_thismodule_82_8_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_82_8_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_82_8_3)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__finalize)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_84_8_4 {
+	Func DAS_COMMENT((Foo const ,_lambda_thismodule_84_8_4,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_84_8_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_84_8_4)==8,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__finalize)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170 ( Context * __context__, _lambda_thismodule_78_8_1 * ____this_rename_at_78 );
+inline Foo _Func_lambda_thismodule_78_8_1_0x60_function_63d2f534d98d0a1e ( Context * __context__, _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680 ( Context * __context__, _lambda_thismodule_80_8_2 * ____this_rename_at_80 );
+inline Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_6293a0c534f5085d ( Context * __context__, _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a ( Context * __context__, _lambda_thismodule_82_8_3 * ____this_rename_at_82 );
+inline Foo _Func_lambda_thismodule_82_8_3_0x60_function_60c9a2ec41ab550a ( Context * __context__, _lambda_thismodule_82_8_3 & ____this_rename_at_82, int32_t __t_rename_at_81 );
+inline void _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478 ( Context * __context__, _lambda_thismodule_84_8_4 * ____this_rename_at_84 );
+inline Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_6e890b7a5d8a34f8 ( Context * __context__, _lambda_thismodule_84_8_4 & ____this_rename_at_84, int32_t __t_rename_at_83 );
+inline void _Func_0x60_checkInvoke_f8f87b20dcfbc88e ( Context * __context__, Block DAS_COMMENT((Foo const )) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_f1f52e79f6fda497 ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_fb3df37f95639867 ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_1cf882b4f615d12 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_7b64c7ddd359fdeb ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_e5ca76e7d7b4f06 ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_b57edb873cd588b2 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo const ,int32_t)) const  & __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_8cfe6035c138c997 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo,int32_t)) const  & __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_18a5ba1608800097 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_897c932a46b24fe ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_ba2db328cb670f67 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_62eeecb2502c8236 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 );
+inline void check_84e2c3621226334f ( Context * __context__, Foo const  & __t_rename_at_39 );
+inline void finalize_d13e444a2661b86d ( Context * __context__, _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void finalize_e16d52ca7b70d2df ( Context * __context__, _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void finalize_eefdf1ac29dc53d0 ( Context * __context__, _lambda_thismodule_82_8_3 & ____this_rename_at_82 );
+inline void finalize_88be309234f2ea95 ( Context * __context__, _lambda_thismodule_84_8_4 & ____this_rename_at_84 );
+inline Foo func_9c63b8525ac37208 ( Context * __context__ );
+inline Foo funcA_1c2a68f90a5c0d95 ( Context * __context__, int32_t __t_rename_at_16 );
+inline Foo const  funcAC_bf4f5c4253bbb504 ( Context * __context__, int32_t __t_rename_at_19 );
+inline Foo const  funcC_d7a836e6908bafb3 ( Context * __context__ );
+inline Foo hfunc_9c63b8525ac37208 ( Context * __context__ );
+inline Foo hfuncA_1c2a68f90a5c0d95 ( Context * __context__, int32_t __t_rename_at_31 );
+inline Foo const  hfuncAC_bf4f5c4253bbb504 ( Context * __context__, int32_t __t_rename_at_35 );
+inline Foo const  hfuncC_d7a836e6908bafb3 ( Context * __context__ );
+inline bool test_b5a3b75fc727a959 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170 ( Context * __context__, _lambda_thismodule_78_8_1 * ____this_rename_at_78 )
+{
+	finalize_d13e444a2661b86d(__context__,das_arg<_lambda_thismodule_78_8_1>::pass(das_deref(__context__,____this_rename_at_78)));
+	das_delete_lambda_struct<_lambda_thismodule_78_8_1 *>::clear(__context__,____this_rename_at_78);
+}
+
+inline Foo _Func_lambda_thismodule_78_8_1_0x60_function_63d2f534d98d0a1e ( Context * __context__, _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_78;
+		das_copy((__mks_78.a),(1));
+		das_copy((__mks_78.b),(2));
+		return __mks_78;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680 ( Context * __context__, _lambda_thismodule_80_8_2 * ____this_rename_at_80 )
+{
+	finalize_e16d52ca7b70d2df(__context__,das_arg<_lambda_thismodule_80_8_2>::pass(das_deref(__context__,____this_rename_at_80)));
+	das_delete_lambda_struct<_lambda_thismodule_80_8_2 *>::clear(__context__,____this_rename_at_80);
+}
+
+inline Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_6293a0c534f5085d ( Context * __context__, _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_80;
+		das_copy((__mks_80.a),(1));
+		das_copy((__mks_80.b),(2));
+		return __mks_80;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a ( Context * __context__, _lambda_thismodule_82_8_3 * ____this_rename_at_82 )
+{
+	finalize_eefdf1ac29dc53d0(__context__,das_arg<_lambda_thismodule_82_8_3>::pass(das_deref(__context__,____this_rename_at_82)));
+	das_delete_lambda_struct<_lambda_thismodule_82_8_3 *>::clear(__context__,____this_rename_at_82);
+}
+
+inline Foo _Func_lambda_thismodule_82_8_3_0x60_function_60c9a2ec41ab550a ( Context * __context__, _lambda_thismodule_82_8_3 &  ____this_rename_at_82, int32_t __t_rename_at_81 )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_82;
+		das_copy((__mks_82.a),(__t_rename_at_81));
+		das_copy((__mks_82.b),((__t_rename_at_81 + 1)));
+		return __mks_82;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478 ( Context * __context__, _lambda_thismodule_84_8_4 * ____this_rename_at_84 )
+{
+	finalize_88be309234f2ea95(__context__,das_arg<_lambda_thismodule_84_8_4>::pass(das_deref(__context__,____this_rename_at_84)));
+	das_delete_lambda_struct<_lambda_thismodule_84_8_4 *>::clear(__context__,____this_rename_at_84);
+}
+
+inline Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_6e890b7a5d8a34f8 ( Context * __context__, _lambda_thismodule_84_8_4 &  ____this_rename_at_84, int32_t __t_rename_at_83 )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_84;
+		das_copy((__mks_84.a),(__t_rename_at_83));
+		das_copy((__mks_84.b),((__t_rename_at_83 + 1)));
+		return __mks_84;
+	})()));
+}
+
+inline void _Func_0x60_checkInvoke_f8f87b20dcfbc88e ( Context * __context__, Block DAS_COMMENT((Foo const )) const  &  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_invoke<Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_f1f52e79f6fda497 ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_fb3df37f95639867 ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_invoke_function<Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_1cf882b4f615d12 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_7b64c7ddd359fdeb ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_invoke_lambda<Foo const >::invoke_cmres(__context__,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_e5ca76e7d7b4f06 ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_43 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres(__context__,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_b57edb873cd588b2 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo const ,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_invoke<Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_8cfe6035c138c997 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_18a5ba1608800097 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_invoke_function<Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_897c932a46b24fe ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_ba2db328cb670f67 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_invoke_lambda<Foo const >::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_62eeecb2502c8236 ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres<int32_t>(__context__,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void check_84e2c3621226334f ( Context * __context__, Foo const  &  __t_rename_at_39 )
+{
+	DAS_ASSERT(((__t_rename_at_39.a == 1) && (__t_rename_at_39.b == 2)));
+}
+
+inline void finalize_d13e444a2661b86d ( Context * __context__, _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	memset(&(____this_rename_at_78), 0, 8);
+}
+
+inline void finalize_e16d52ca7b70d2df ( Context * __context__, _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	memset(&(____this_rename_at_80), 0, 8);
+}
+
+inline void finalize_eefdf1ac29dc53d0 ( Context * __context__, _lambda_thismodule_82_8_3 &  ____this_rename_at_82 )
+{
+	memset(&(____this_rename_at_82), 0, 8);
+}
+
+inline void finalize_88be309234f2ea95 ( Context * __context__, _lambda_thismodule_84_8_4 &  ____this_rename_at_84 )
+{
+	memset(&(____this_rename_at_84), 0, 8);
+}
+
+inline Foo func_9c63b8525ac37208 ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_11;
+		das_copy((__mks_11.a),(1));
+		das_copy((__mks_11.b),(2));
+		return __mks_11;
+	})()));
+}
+
+inline Foo funcA_1c2a68f90a5c0d95 ( Context * __context__, int32_t __t_rename_at_16 )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_17;
+		das_copy((__mks_17.a),(__t_rename_at_16));
+		das_copy((__mks_17.b),((__t_rename_at_16 + 1)));
+		return __mks_17;
+	})()));
+}
+
+inline Foo const  funcAC_bf4f5c4253bbb504 ( Context * __context__, int32_t __t_rename_at_19 )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_20;
+		das_copy((__mks_20.a),(__t_rename_at_19));
+		das_copy((__mks_20.b),((__t_rename_at_19 + 1)));
+		return __mks_20;
+	})()));
+}
+
+inline Foo const  funcC_d7a836e6908bafb3 ( Context * __context__ )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_14;
+		das_copy((__mks_14.a),(1));
+		das_copy((__mks_14.b),(2));
+		return __mks_14;
+	})()));
+}
+
+inline Foo hfunc_9c63b8525ac37208 ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_24;
+		das_copy((__mks_24.a),(1));
+		das_copy((__mks_24.b),(2));
+		return __mks_24;
+	})()));
+}
+
+inline Foo hfuncA_1c2a68f90a5c0d95 ( Context * __context__, int32_t __t_rename_at_31 )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_32;
+		das_copy((__mks_32.a),(__t_rename_at_31));
+		das_copy((__mks_32.b),((__t_rename_at_31 + 1)));
+		return __mks_32;
+	})()));
+}
+
+inline Foo const  hfuncAC_bf4f5c4253bbb504 ( Context * __context__, int32_t __t_rename_at_35 )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_36;
+		das_copy((__mks_36.a),(__t_rename_at_35));
+		das_copy((__mks_36.b),((__t_rename_at_35 + 1)));
+		return __mks_36;
+	})()));
+}
+
+inline Foo const  hfuncC_d7a836e6908bafb3 ( Context * __context__ )
+{
+	return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_28;
+		das_copy((__mks_28.a),(1));
+		das_copy((__mks_28.b),(2));
+		return __mks_28;
+	})()));
+}
+
+inline bool test_b5a3b75fc727a959 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,544,"test " DAS_FILE_LINE);
+{
+	Foo _temp_make_local_53_32;
+	Foo _temp_make_local_54_48;
+	Foo _temp_make_local_55_64;
+	Foo _temp_make_local_56_80;
+	Foo _temp_make_local_58_96;
+	Foo _temp_make_local_59_112;
+	Foo _temp_make_local_60_128;
+	Foo _temp_make_local_61_144;
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass((_temp_make_local_53_32 = (func_9c63b8525ac37208(__context__)))));
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass((_temp_make_local_54_48 = (funcA_1c2a68f90a5c0d95(__context__,1)))));
+	check_84e2c3621226334f(__context__,(_temp_make_local_55_64 = (funcC_d7a836e6908bafb3(__context__))));
+	check_84e2c3621226334f(__context__,(_temp_make_local_56_80 = (funcAC_bf4f5c4253bbb504(__context__,1))));
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass((_temp_make_local_58_96 = (das_invoke_function<Foo>::invoke_cmres(__context__,Func(__context__->fnIdxByMangledName(/*hfunc*/ 4059086725u)))))));
+	check_84e2c3621226334f(__context__,das_arg<Foo>::pass((_temp_make_local_59_112 = (das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*hfuncA int#const*/ 1446350033u)),1)))));
+	check_84e2c3621226334f(__context__,(_temp_make_local_60_128 = (das_invoke_function<Foo const >::invoke_cmres(__context__,Func(__context__->fnIdxByMangledName(/*hfuncC*/ 2751325362u))))));
+	check_84e2c3621226334f(__context__,(_temp_make_local_61_144 = (das_invoke_function<Foo const >::invoke_cmres<int32_t>(__context__,Func(__context__->fnIdxByMangledName(/*hfuncAC int#const*/ 1568118112u)),1))));
+	_Func_0x60_checkInvoke_1cf882b4f615d12(__context__,Func(__context__->fnIdxByMangledName(/*func*/ 243156999u)));
+	_Func_0x60_checkInvoke_897c932a46b24fe(__context__,1,Func(__context__->fnIdxByMangledName(/*funcA int#const*/ 370502463u)));
+	_Func_0x60_checkInvoke_fb3df37f95639867(__context__,Func(__context__->fnIdxByMangledName(/*funcC*/ 348898060u)));
+	_Func_0x60_checkInvoke_18a5ba1608800097(__context__,1,Func(__context__->fnIdxByMangledName(/*funcAC int#const*/ 600890662u)));
+	_Func_0x60_checkInvoke_f1f52e79f6fda497(__context__,das_make_block_cmres<Foo>(__context__,208,0,&__func_info__96c0e1d1,[&]()->Foo{
+		return das_auto_cast<Foo>::cast((([&]() -> Foo {
+			Foo __mks_69;
+			das_copy((__mks_69.a),(1));
+			das_copy((__mks_69.b),(2));
+			return __mks_69;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_f8f87b20dcfbc88e(__context__,das_make_block_cmres<Foo const >(__context__,288,0,&__func_info__e796f308,[&]()->Foo const {
+		return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+			Foo __mks_71;
+			das_copy((__mks_71.a),(1));
+			das_copy((__mks_71.b),(2));
+			return __mks_71;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_8cfe6035c138c997(__context__,1,das_make_block_cmres<Foo,int32_t>(__context__,368,0,&__func_info__c0439b6f,[&](int32_t const  __t_rename_at_72)->Foo{
+		return das_auto_cast<Foo>::cast((([&]() -> Foo {
+			Foo __mks_73;
+			das_copy((__mks_73.a),(__t_rename_at_72));
+			das_copy((__mks_73.b),((__t_rename_at_72 + 1)));
+			return __mks_73;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_b57edb873cd588b2(__context__,1,das_make_block_cmres<Foo const ,int32_t>(__context__,448,0,&__func_info__4624f996,[&](int32_t const  __t_rename_at_74)->Foo const {
+		return das_auto_cast<Foo const >::cast((([&]() -> Foo {
+			Foo __mks_75;
+			das_copy((__mks_75.a),(__t_rename_at_74));
+			das_copy((__mks_75.b),((__t_rename_at_74 + 1)));
+			return __mks_75;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_e5ca76e7d7b4f06(__context__,das_ascend<Foo,_lambda_thismodule_78_8_1>::make(__context__,&__type_info__b25b6db3,(([&]() -> _lambda_thismodule_78_8_1 {
+		_lambda_thismodule_78_8_1 __mks_78;
+		das_copy((__mks_78.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_78_8_1`function _lambda_thismodule_78_8_1*/ 3859681597u))));
+		das_copy((__mks_78.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_78_8_1`finazlier #ptr#_lambda_thismodule_78_8_1#explicit*/ 2372967790u))));
+		return __mks_78;
+	})())));
+	_Func_0x60_checkInvoke_7b64c7ddd359fdeb(__context__,das_ascend<Foo,_lambda_thismodule_80_8_2>::make(__context__,&__type_info__27b4d955,(([&]() -> _lambda_thismodule_80_8_2 {
+		_lambda_thismodule_80_8_2 __mks_80;
+		das_copy((__mks_80.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_80_8_2`function _lambda_thismodule_80_8_2*/ 190843613u))));
+		das_copy((__mks_80.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_80_8_2`finazlier #ptr#_lambda_thismodule_80_8_2#explicit*/ 3486689494u))));
+		return __mks_80;
+	})())));
+	_Func_0x60_checkInvoke_62eeecb2502c8236(__context__,1,das_ascend<Foo,_lambda_thismodule_82_8_3>::make(__context__,&__type_info__2011fb8c,(([&]() -> _lambda_thismodule_82_8_3 {
+		_lambda_thismodule_82_8_3 __mks_82;
+		das_copy((__mks_82.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_82_8_3`function _lambda_thismodule_82_8_3 int#const*/ 676091382u))));
+		das_copy((__mks_82.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_82_8_3`finazlier #ptr#_lambda_thismodule_82_8_3#explicit*/ 1742828748u))));
+		return __mks_82;
+	})())));
+	_Func_0x60_checkInvoke_ba2db328cb670f67(__context__,1,das_ascend<Foo,_lambda_thismodule_84_8_4>::make(__context__,&__type_info__536d22af,(([&]() -> _lambda_thismodule_84_8_4 {
+		_lambda_thismodule_84_8_4 __mks_84;
+		das_copy((__mks_84.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_84_8_4`function _lambda_thismodule_84_8_4 int#const*/ 1026409628u))));
+		das_copy((__mks_84.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_84_8_4`finazlier #ptr#_lambda_thismodule_84_8_4#explicit*/ 1961785458u))));
+		return __mks_84;
+	})())));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170
+		aotLib[0xfb5d8384e8f5777c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_78_8_1 *  ),&_Func_lambda_thismodule_78_8_1_0x60_finazlier_3e4285f99025170>>();
+	};
+		// _Func_lambda_thismodule_78_8_1_0x60_function_63d2f534d98d0a1e
+		aotLib[0x9dab41bd39afcf29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, _lambda_thismodule_78_8_1 &  ),&_Func_lambda_thismodule_78_8_1_0x60_function_63d2f534d98d0a1e>>();
+	};
+		// _Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680
+		aotLib[0x8ebe12b593ea485b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_80_8_2 *  ),&_Func_lambda_thismodule_80_8_2_0x60_finazlier_b82c8f6a354ab680>>();
+	};
+		// _Func_lambda_thismodule_80_8_2_0x60_function_6293a0c534f5085d
+		aotLib[0x60a303fb34c7c5c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, _lambda_thismodule_80_8_2 &  ),&_Func_lambda_thismodule_80_8_2_0x60_function_6293a0c534f5085d>>();
+	};
+		// _Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a
+		aotLib[0x8309f9ad481b5783] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_82_8_3 *  ),&_Func_lambda_thismodule_82_8_3_0x60_finazlier_3b4986108558923a>>();
+	};
+		// _Func_lambda_thismodule_82_8_3_0x60_function_60c9a2ec41ab550a
+		aotLib[0xe1948dde1c0f3fed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, _lambda_thismodule_82_8_3 & , int32_t  ),&_Func_lambda_thismodule_82_8_3_0x60_function_60c9a2ec41ab550a>>();
+	};
+		// _Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478
+		aotLib[0x10a6d77ade65d524] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_84_8_4 *  ),&_Func_lambda_thismodule_84_8_4_0x60_finazlier_ce4888caccf0e478>>();
+	};
+		// _Func_lambda_thismodule_84_8_4_0x60_function_6e890b7a5d8a34f8
+		aotLib[0x2495e9d3546bc3c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, _lambda_thismodule_84_8_4 & , int32_t  ),&_Func_lambda_thismodule_84_8_4_0x60_function_6e890b7a5d8a34f8>>();
+	};
+		// _Func_0x60_checkInvoke_f8f87b20dcfbc88e
+		aotLib[0x536277a06de3cb96] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((Foo const )) const  &  ),&_Func_0x60_checkInvoke_f8f87b20dcfbc88e>>();
+	};
+		// _Func_0x60_checkInvoke_f1f52e79f6fda497
+		aotLib[0x2acd1a5e3de9ff7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  ),&_Func_0x60_checkInvoke_f1f52e79f6fda497>>();
+	};
+		// _Func_0x60_checkInvoke_fb3df37f95639867
+		aotLib[0xe581b8efce8713a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((Foo const )) const   ),&_Func_0x60_checkInvoke_fb3df37f95639867>>();
+	};
+		// _Func_0x60_checkInvoke_1cf882b4f615d12
+		aotLib[0x36a7b161e5ca7082] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((Foo)) const   ),&_Func_0x60_checkInvoke_1cf882b4f615d12>>();
+	};
+		// _Func_0x60_checkInvoke_7b64c7ddd359fdeb
+		aotLib[0xbc9d1ca9f0cbb5a2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const   ),&_Func_0x60_checkInvoke_7b64c7ddd359fdeb>>();
+	};
+		// _Func_0x60_checkInvoke_e5ca76e7d7b4f06
+		aotLib[0xe98cadb2bf94cb7a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((Foo)) const   ),&_Func_0x60_checkInvoke_e5ca76e7d7b4f06>>();
+	};
+		// _Func_0x60_checkInvoke_b57edb873cd588b2
+		aotLib[0x80c0b880aada7806] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((Foo const ,int32_t)) const  &  ),&_Func_0x60_checkInvoke_b57edb873cd588b2>>();
+	};
+		// _Func_0x60_checkInvoke_8cfe6035c138c997
+		aotLib[0x53f21860b5c69016] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((Foo,int32_t)) const  &  ),&_Func_0x60_checkInvoke_8cfe6035c138c997>>();
+	};
+		// _Func_0x60_checkInvoke_18a5ba1608800097
+		aotLib[0xab73f7aefe390b8e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_18a5ba1608800097>>();
+	};
+		// _Func_0x60_checkInvoke_897c932a46b24fe
+		aotLib[0xd6ae830ba2e48016] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_897c932a46b24fe>>();
+	};
+		// _Func_0x60_checkInvoke_ba2db328cb670f67
+		aotLib[0x3c2341c6f8b343a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_ba2db328cb670f67>>();
+	};
+		// _Func_0x60_checkInvoke_62eeecb2502c8236
+		aotLib[0xb2b966b399366606] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_62eeecb2502c8236>>();
+	};
+		// check_84e2c3621226334f
+		aotLib[0x738d63ffcf38fa31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  &  ),&check_84e2c3621226334f>>();
+	};
+		// finalize_d13e444a2661b86d
+		aotLib[0x32e866a2c42d4ec5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_78_8_1 &  ),&finalize_d13e444a2661b86d>>();
+	};
+		// finalize_e16d52ca7b70d2df
+		aotLib[0xee190cc3231a8385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_80_8_2 &  ),&finalize_e16d52ca7b70d2df>>();
+	};
+		// finalize_eefdf1ac29dc53d0
+		aotLib[0x6a28d4b4799fa8e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_82_8_3 &  ),&finalize_eefdf1ac29dc53d0>>();
+	};
+		// finalize_88be309234f2ea95
+		aotLib[0x9e42c0228be6a059] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_84_8_4 &  ),&finalize_88be309234f2ea95>>();
+	};
+		// func_9c63b8525ac37208
+		aotLib[0x2af2ab7396cfc19d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&func_9c63b8525ac37208>>();
+	};
+		// funcA_1c2a68f90a5c0d95
+		aotLib[0x824ed7f8f8eadc41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&funcA_1c2a68f90a5c0d95>>();
+	};
+		// funcAC_bf4f5c4253bbb504
+		aotLib[0xdfdbf46d3d074ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, int32_t  ),&funcAC_bf4f5c4253bbb504>>();
+	};
+		// funcC_d7a836e6908bafb3
+		aotLib[0xb37fb59454b69125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__ ),&funcC_d7a836e6908bafb3>>();
+	};
+		// hfunc_9c63b8525ac37208
+		aotLib[0x2af2ab7396cfc19d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&hfunc_9c63b8525ac37208>>();
+	};
+		// hfuncA_1c2a68f90a5c0d95
+		aotLib[0x824ed7f8f8eadc41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&hfuncA_1c2a68f90a5c0d95>>();
+	};
+		// hfuncAC_bf4f5c4253bbb504
+		aotLib[0xdfdbf46d3d074ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, int32_t  ),&hfuncAC_bf4f5c4253bbb504>>();
+	};
+		// hfuncC_d7a836e6908bafb3
+		aotLib[0xb37fb59454b69125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__ ),&hfuncC_d7a836e6908bafb3>>();
+	};
+		// test_b5a3b75fc727a959
+		aotLib[0xb4323f72a2e606b6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b5a3b75fc727a959>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,325 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_8[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline char * const  _Funcstrings_boost_0x60_join_5e38443dc898037c ( Context * __context__, TArray<int32_t> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_7afd6ea7354156fa ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_64441bc3d4eecc13 ( Context * __context__, TDim<int32_t,1> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_dc5a34f458d19452 ( Context * __context__, TDim<int32_t,4> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_625a962118e45ee6 ( Context * __context__, range __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline char * const  _Funcstrings_boost_0x60_join_fff0192b5f7af4f ( Context * __context__, char * const  __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_7a2720b67ade6582 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_5e38443dc898037c ( Context * __context__, TArray<int32_t> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TArray<int32_t> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_7afd6ea7354156fa ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<Sequence DAS_COMMENT((int32_t)) const > __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_2,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_64441bc3d4eecc13 ( Context * __context__, TDim<int32_t,1> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,1> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_dc5a34f458d19452 ( Context * __context__, TDim<int32_t,4> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const&
+			das_iterator<TDim<int32_t,4> const > __elem_iterator(__it_rename_at_16);
+			int32_t const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_625a962118e45ee6 ( Context * __context__, range __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<range> __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_8,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<int32_t>::from(__elem_rename_at_23)));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_fff0192b5f7af4f ( Context * __context__, char * const  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : int const
+			das_iterator<char * const > __elem_iterator(__it_rename_at_16);
+			int32_t __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				write_string_char(das_arg<StringBuilderWriter>::pass(__writer_rename_at_21),__elem_rename_at_23);
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline bool test_7a2720b67ade6582 ( Context * __context__ )
+{
+	TDim<int32_t,1> _temp_make_local_6_32;
+	TDim<int32_t,4> _temp_make_local_7_48;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_64441bc3d4eecc13(__context__,das_arg<TDim<int32_t,1>>::pass((([&]() -> TDim<int32_t,1>& {
+		_temp_make_local_6_32(0,__context__) = 1;
+		return _temp_make_local_6_32;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_dc5a34f458d19452(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_7_48(0,__context__) = 1;
+		_temp_make_local_7_48(1,__context__) = 2;
+		_temp_make_local_7_48(2,__context__) = 3;
+		_temp_make_local_7_48(3,__context__) = 4;
+		return _temp_make_local_7_48;
+	})())),((char *) ","))),cast<char *>::from(((char *) "1,2,3,4")),*__context__)));
+	TArray<int32_t> __a_rename_at_9; das_zero(__a_rename_at_9);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_5e38443dc898037c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) " "))),cast<char *>::from(((char *) "")),*__context__)));
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),1);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_5e38443dc898037c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1")),*__context__)));
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),2);
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_5e38443dc898037c(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_9),((char *) "."))),cast<char *>::from(((char *) "1.2")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_625a962118e45ee6(__context__,range(1,4),((char *) "-"))),cast<char *>::from(((char *) "1-2-3")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_fff0192b5f7af4f(__context__,((char *) "hello"),((char *) " "))),cast<char *>::from(((char *) "h e l l o")),*__context__)));
+	Sequence DAS_COMMENT((int32_t)) __rit_rename_at_20_ConstRef; das_zero(__rit_rename_at_20_ConstRef); das_move(__rit_rename_at_20_ConstRef, ((Sequence DAS_COMMENT((int32_t)))_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(1,4))));
+	Sequence DAS_COMMENT((int32_t)) const  & __rit_rename_at_20 = __rit_rename_at_20_ConstRef; ;
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Funcstrings_boost_0x60_join_7afd6ea7354156fa(__context__,__rit_rename_at_20,((char *) "*"))),cast<char *>::from(((char *) "1*2*3")),*__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcstrings_boost_0x60_join_5e38443dc898037c
+		aotLib[0x3b49b86973aba59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<int32_t> const  & , char * const   ),&_Funcstrings_boost_0x60_join_5e38443dc898037c>>();
+	};
+		// _Funcstrings_boost_0x60_join_7afd6ea7354156fa
+		aotLib[0x75ce06dc6ca91e65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , char * const   ),&_Funcstrings_boost_0x60_join_7afd6ea7354156fa>>();
+	};
+		// _Funcstrings_boost_0x60_join_64441bc3d4eecc13
+		aotLib[0xfee7d9a9e05f9599] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,1> const  & , char * const   ),&_Funcstrings_boost_0x60_join_64441bc3d4eecc13>>();
+	};
+		// _Funcstrings_boost_0x60_join_dc5a34f458d19452
+		aotLib[0x4b5a8aeab61f4945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TDim<int32_t,4> const  & , char * const   ),&_Funcstrings_boost_0x60_join_dc5a34f458d19452>>();
+	};
+		// _Funcstrings_boost_0x60_join_625a962118e45ee6
+		aotLib[0xc26e90b788f7bc29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, range , char * const   ),&_Funcstrings_boost_0x60_join_625a962118e45ee6>>();
+	};
+		// _Funcstrings_boost_0x60_join_fff0192b5f7af4f
+		aotLib[0xd0ea0a99185cb165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, char * const  , char * const   ),&_Funcstrings_boost_0x60_join_fff0192b5f7af4f>>();
+	};
+		// test_7a2720b67ade6582
+		aotLib[0x7a716ea877826a79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7a2720b67ade6582>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,305 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void N_goto_81ce74b2742a9b2a ( Context * __context__ );
+inline void basic_goto_5b8ea71484dffcc4 ( Context * __context__ );
+inline void finally_goto_dfab01d2ceaab89b ( Context * __context__, bool __yes_rename_at_74 );
+inline void for_goto_be828421a2a5e24e ( Context * __context__ );
+inline int32_t gotoN_c3b3f9e6ff45427c ( Context * __context__, int32_t __n_rename_at_85 );
+inline void nested_goto_960fb1102f79456c ( Context * __context__ );
+inline bool test_879dd40e0286fe7d ( Context * __context__ );
+inline void while_goto_7a1f26fd89da66 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void N_goto_81ce74b2742a9b2a ( Context * __context__ )
+{
+	DAS_VERIFY((gotoN_c3b3f9e6ff45427c(__context__,0) == 0));
+	DAS_VERIFY((gotoN_c3b3f9e6ff45427c(__context__,1) == 1));
+	DAS_VERIFY((gotoN_c3b3f9e6ff45427c(__context__,2) == 2));
+	DAS_VERIFY((gotoN_c3b3f9e6ff45427c(__context__,3) == -1));
+}
+
+inline void basic_goto_5b8ea71484dffcc4 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_4; das_zero(__arr_rename_at_4);
+	int32_t __i_rename_at_5 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_4(__i_rename_at_5,__context__),__i_rename_at_5);
+	__i_rename_at_5++;
+	if ( __i_rename_at_5 < 10 )
+	{
+		goto label_0;
+	};
+	{
+		bool __need_loop_13 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_13;
+		__need_loop_13 = __t_iterator.first(__context__,(__t_rename_at_13)) && __need_loop_13;
+		for ( ; __need_loop_13 ; __need_loop_13 = __t_iterator.next(__context__,(__t_rename_at_13)) )
+		{
+			DAS_ASSERT((__arr_rename_at_4(__t_rename_at_13,__context__) == __t_rename_at_13));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_13));
+	};
+}
+
+inline void finally_goto_dfab01d2ceaab89b ( Context * __context__, bool __yes_rename_at_74 )
+{
+	bool __fail_rename_at_75 = true;
+	if ( __yes_rename_at_74 )
+	{
+	/* finally */ auto __finally_77= das_finally([&](){
+		das_copy(__fail_rename_at_75,false);
+	/* end finally */ });
+		das_copy(__fail_rename_at_75,true);
+		goto label_0;
+	};
+	label_0:;;
+	DAS_ASSERT((!__fail_rename_at_75));
+}
+
+inline void for_goto_be828421a2a5e24e ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_36; das_zero(__arr_rename_at_36);
+	{
+		bool __need_loop_37 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,10));
+		int32_t __j_rename_at_37;
+		__need_loop_37 = __j_iterator.first(__context__,(__j_rename_at_37)) && __need_loop_37;
+		for ( ; __need_loop_37 ; __need_loop_37 = __j_iterator.next(__context__,(__j_rename_at_37)) )
+		{
+			int32_t __i_rename_at_38 = 0;
+			label_0:;;
+			das_copy(__arr_rename_at_36(__i_rename_at_38,__context__),__i_rename_at_38 + __j_rename_at_37);
+			__i_rename_at_38++;
+			if ( __i_rename_at_38 < 10 )
+			{
+				goto label_0;
+			};
+			{
+				bool __need_loop_45 = true;
+				// t : int const
+				das_iterator<range> __t_iterator(range(0,10));
+				int32_t __t_rename_at_45;
+				__need_loop_45 = __t_iterator.first(__context__,(__t_rename_at_45)) && __need_loop_45;
+				for ( ; __need_loop_45 ; __need_loop_45 = __t_iterator.next(__context__,(__t_rename_at_45)) )
+				{
+					DAS_ASSERT((__arr_rename_at_36(__t_rename_at_45,__context__) == (__t_rename_at_45 + __j_rename_at_37)));
+				}
+				__t_iterator.close(__context__,(__t_rename_at_45));
+			};
+		}
+		__j_iterator.close(__context__,(__j_rename_at_37));
+	};
+	{
+		bool __need_loop_48 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_48;
+		__need_loop_48 = __t_iterator.first(__context__,(__t_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __t_iterator.next(__context__,(__t_rename_at_48)) )
+		{
+			DAS_ASSERT((__arr_rename_at_36(__t_rename_at_48,__context__) == (__t_rename_at_48 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_48));
+	};
+}
+
+inline int32_t gotoN_c3b3f9e6ff45427c ( Context * __context__, int32_t __n_rename_at_85 )
+{
+	int32_t __res_rename_at_86 = -1;
+	switch (__n_rename_at_85) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(__res_rename_at_86,0);
+	goto label_3;
+	label_1:;;
+	das_copy(__res_rename_at_86,1);
+	goto label_3;
+	label_2:;;
+	das_copy(__res_rename_at_86,2);
+	goto label_3;
+	label_3:;;
+	return das_auto_cast<int32_t>::cast(__res_rename_at_86);
+}
+
+inline void nested_goto_960fb1102f79456c ( Context * __context__ )
+{
+	bool __fail_rename_at_19 = false;
+	TDim<int32_t,10> __arr_rename_at_20; das_zero(__arr_rename_at_20);
+	int32_t __i_rename_at_21 = 0;
+	label_0:;;
+	das_copy(__arr_rename_at_20(__i_rename_at_21,__context__),__i_rename_at_21);
+	__i_rename_at_21++;
+	if ( __i_rename_at_21 < 10 )
+	{
+		if ( __i_rename_at_21 < 10 )
+		{
+			goto label_0;
+		};
+		das_copy(__fail_rename_at_19,true);
+	};
+	{
+		bool __need_loop_30 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_30;
+		__need_loop_30 = __t_iterator.first(__context__,(__t_rename_at_30)) && __need_loop_30;
+		for ( ; __need_loop_30 ; __need_loop_30 = __t_iterator.next(__context__,(__t_rename_at_30)) )
+		{
+			DAS_ASSERT((__arr_rename_at_20(__t_rename_at_30,__context__) == __t_rename_at_30));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_30));
+	};
+}
+
+inline bool test_879dd40e0286fe7d ( Context * __context__ )
+{
+	basic_goto_5b8ea71484dffcc4(__context__);
+	nested_goto_960fb1102f79456c(__context__);
+	for_goto_be828421a2a5e24e(__context__);
+	while_goto_7a1f26fd89da66(__context__);
+	finally_goto_dfab01d2ceaab89b(__context__,true);
+	N_goto_81ce74b2742a9b2a(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void while_goto_7a1f26fd89da66 ( Context * __context__ )
+{
+	TDim<int32_t,10> __arr_rename_at_55; das_zero(__arr_rename_at_55);
+	int32_t __j_rename_at_56 = 0;
+	while ( __j_rename_at_56 < 10 )
+	{
+		int32_t __i_rename_at_58 = 0;
+		label_0:;;
+		das_copy(__arr_rename_at_55(__i_rename_at_58,__context__),__i_rename_at_58 + __j_rename_at_56);
+		__i_rename_at_58++;
+		if ( __i_rename_at_58 < 10 )
+		{
+			goto label_0;
+		};
+		{
+			bool __need_loop_65 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,10));
+			int32_t __t_rename_at_65;
+			__need_loop_65 = __t_iterator.first(__context__,(__t_rename_at_65)) && __need_loop_65;
+			for ( ; __need_loop_65 ; __need_loop_65 = __t_iterator.next(__context__,(__t_rename_at_65)) )
+			{
+				DAS_ASSERT((__arr_rename_at_55(__t_rename_at_65,__context__) == (__t_rename_at_65 + __j_rename_at_56)));
+			}
+			__t_iterator.close(__context__,(__t_rename_at_65));
+		};
+		__j_rename_at_56++;
+	};
+	{
+		bool __need_loop_69 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_69;
+		__need_loop_69 = __t_iterator.first(__context__,(__t_rename_at_69)) && __need_loop_69;
+		for ( ; __need_loop_69 ; __need_loop_69 = __t_iterator.next(__context__,(__t_rename_at_69)) )
+		{
+			DAS_ASSERT((__arr_rename_at_55(__t_rename_at_69,__context__) == (__t_rename_at_69 + 9)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_69));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// N_goto_81ce74b2742a9b2a
+		aotLib[0x8c01adf034be1b34] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&N_goto_81ce74b2742a9b2a>>();
+	};
+		// basic_goto_5b8ea71484dffcc4
+		aotLib[0x245eb84ee6d4ef5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&basic_goto_5b8ea71484dffcc4>>();
+	};
+		// finally_goto_dfab01d2ceaab89b
+		aotLib[0x2c9d816e24948c3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, bool  ),&finally_goto_dfab01d2ceaab89b>>();
+	};
+		// for_goto_be828421a2a5e24e
+		aotLib[0x952b89359acdb5d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&for_goto_be828421a2a5e24e>>();
+	};
+		// gotoN_c3b3f9e6ff45427c
+		aotLib[0x8f69ae41f537d3fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&gotoN_c3b3f9e6ff45427c>>();
+	};
+		// nested_goto_960fb1102f79456c
+		aotLib[0x82b6353cc2617ad1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&nested_goto_960fb1102f79456c>>();
+	};
+		// test_879dd40e0286fe7d
+		aotLib[0x22fba30982c4e5eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_879dd40e0286fe7d>>();
+	};
+		// while_goto_7a1f26fd89da66
+		aotLib[0x577e278f242c1285] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&while_goto_7a1f26fd89da66>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,386 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__3f00200e;
+extern StructInfo __struct_info__52c5e609;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__260b3481;
+extern TypeInfo __type_info__85c25ffe;
+extern TypeInfo __type_info__7db7c5c6;
+extern TypeInfo __type_info__c7e1677;
+extern TypeInfo __type_info__ba496f9;
+extern TypeInfo __type_info__3ac84c61;
+extern VarInfo __var_info__74c4ac69;
+extern VarInfo __var_info__ea8cde2b;
+extern VarInfo __var_info__677b177b;
+extern VarInfo __var_info__b1d8619d;
+extern VarInfo __var_info__80af3d87;
+extern VarInfo __var_info__319ce2c4;
+extern VarInfo __var_info__aed85ce4;
+extern VarInfo __var_info__73c4aad6;
+extern VarInfo __var_info__71c4a7b0;
+extern VarInfo __var_info__3275c20a;
+extern VarInfo __var_info__7f5e3102;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x677b177b, "dummy", 0 };
+VarInfo * __struct_info__b1589007_fields[1] =  { &__struct_info__b1589007_field_0 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 1, 4, -1, nullptr, 0xb1589007 };
+TypeInfo * __type_info__ea8cde2b_arg_types_var_1056972814[1] = { &__type_info__85c25ffe };
+VarInfo __struct_info__3f00200e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__ea8cde2b_arg_types_var_1056972814, nullptr, 1, 0, nullptr, 28, 0xea8cde2b, "__lambda", 0 };
+TypeInfo * __type_info__3275c20a_arg_types_var_1056972814[1] = { &__type_info__7db7c5c6 };
+VarInfo __struct_info__3f00200e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__3275c20a_arg_types_var_1056972814, nullptr, 1, 0, nullptr, 28, 0x3275c20a, "__finalize", 4 };
+VarInfo __struct_info__3f00200e_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__260b3481, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x71c4a7b0, "a1", 8 };
+VarInfo __struct_info__3f00200e_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x74c4ac69, "a2", 16 };
+VarInfo __struct_info__3f00200e_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x73c4aad6, "a3", 40 };
+VarInfo * __struct_info__3f00200e_fields[5] =  { &__struct_info__3f00200e_field_0, &__struct_info__3f00200e_field_1, &__struct_info__3f00200e_field_2, &__struct_info__3f00200e_field_3, &__struct_info__3f00200e_field_4 };
+StructInfo __struct_info__3f00200e = {"_lambda_thismodule_33_3_2", __struct_info__3f00200e_fields, 5, 64, -1, nullptr, 0x3f00200e };
+TypeInfo * __type_info__7f5e3102_arg_types_var_1388701193[1] = { &__type_info__ba496f9 };
+VarInfo __struct_info__52c5e609_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7f5e3102_arg_types_var_1388701193, nullptr, 1, 0, nullptr, 28, 0x7f5e3102, "__lambda", 0 };
+TypeInfo * __type_info__80af3d87_arg_types_var_1388701193[1] = { &__type_info__3ac84c61 };
+VarInfo __struct_info__52c5e609_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__80af3d87_arg_types_var_1388701193, nullptr, 1, 0, nullptr, 28, 0x80af3d87, "__finalize", 4 };
+VarInfo __struct_info__52c5e609_field_2 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0x319ce2c4, "C", 8 };
+VarInfo __struct_info__52c5e609_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xaed85ce4, "pA", 16 };
+VarInfo __struct_info__52c5e609_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c7e1677, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb1d8619d, "pB", 24 };
+VarInfo * __struct_info__52c5e609_fields[5] =  { &__struct_info__52c5e609_field_0, &__struct_info__52c5e609_field_1, &__struct_info__52c5e609_field_2, &__struct_info__52c5e609_field_3, &__struct_info__52c5e609_field_4 };
+StructInfo __struct_info__52c5e609 = {"_lambda_thismodule_16_2_1", __struct_info__52c5e609_fields, 5, 32, -1, nullptr, 0x52c5e609 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__260b3481 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x260b3481 };
+TypeInfo __type_info__85c25ffe = { Type::tStructure, &__struct_info__3f00200e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x85c25ffe };
+TypeInfo __type_info__7db7c5c6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__85c25ffe, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7db7c5c6 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 0xc7e1677 };
+TypeInfo __type_info__ba496f9 = { Type::tStructure, &__struct_info__52c5e609, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xba496f9 };
+TypeInfo __type_info__3ac84c61 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ba496f9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3ac84c61 };
+
+namespace  {
+
+struct Foo {
+	int32_t dummy;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,dummy)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_2_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_2_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_2_1 *)) __finalize;
+	Foo C;
+	Foo * pA;
+	Foo * pB;
+};
+static_assert(sizeof(_lambda_thismodule_16_2_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,C)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pA)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_2_1,pB)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_33_3_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_33_3_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_33_3_2 *)) __finalize;
+	TArray<int32_t> * a1;
+	TArray<int32_t> a2;
+	TArray<int32_t> a3;
+};
+static_assert(sizeof(_lambda_thismodule_33_3_2)==64,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a1)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_33_3_2,a3)==40,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de ( Context * __context__, _lambda_thismodule_16_2_1 * ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_f9011909c4760b7c ( Context * __context__, _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626 ( Context * __context__, _lambda_thismodule_33_3_2 * ____this_rename_at_33 );
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_2b4b69431dc34876 ( Context * __context__, _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_5baa820607536fa4 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_298 );
+inline void finalize_c20f17660d779b79 ( Context * __context__, Foo * & ____this_rename_at_12 );
+inline void finalize_8040b9a0007f25d3 ( Context * __context__, Foo const  & __f_rename_at_7 );
+inline void finalize_a64413730822e2bd ( Context * __context__, _lambda_thismodule_16_2_1 & ____this_rename_at_16 );
+inline void finalize_e180b7d5465da232 ( Context * __context__, _lambda_thismodule_33_3_2 & ____this_rename_at_33 );
+inline bool test_c535f963d2916328 ( Context * __context__ );
+inline bool test_delete_650e1803be373f43 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x6c1602f8>(__context__) = 0;/*g_counter*/
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de ( Context * __context__, _lambda_thismodule_16_2_1 * ____this_rename_at_16 )
+{
+	finalize_a64413730822e2bd(__context__,das_arg<_lambda_thismodule_16_2_1>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_2_1 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline void _Func_lambda_thismodule_16_2_1_0x60_function_f9011909c4760b7c ( Context * __context__, _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	DAS_ASSERT((____this_rename_at_16.pA->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.pB->dummy == 0));
+	DAS_ASSERT((____this_rename_at_16.C.dummy == 0));
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626 ( Context * __context__, _lambda_thismodule_33_3_2 * ____this_rename_at_33 )
+{
+	finalize_e180b7d5465da232(__context__,das_arg<_lambda_thismodule_33_3_2>::pass(das_deref(__context__,____this_rename_at_33)));
+	das_delete_lambda_struct<_lambda_thismodule_33_3_2 *>::clear(__context__,____this_rename_at_33);
+}
+
+inline void _Func_lambda_thismodule_33_3_2_0x60_function_2b4b69431dc34876 ( Context * __context__, _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_33.a1)),1);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a2),1);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_33.a3),1);
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_5baa820607536fa4 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_298 )
+{
+	TArray<int32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_299),2);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_299);
+}
+
+inline void finalize_c20f17660d779b79 ( Context * __context__, Foo * & ____this_rename_at_12 )
+{
+	if ( ____this_rename_at_12 != nullptr )
+	{
+		finalize_8040b9a0007f25d3(__context__,das_arg<Foo>::pass(das_deref(__context__,____this_rename_at_12)));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_12);
+		das_copy(____this_rename_at_12,nullptr);
+	};
+}
+
+inline void finalize_8040b9a0007f25d3 ( Context * __context__, Foo const  &  __f_rename_at_7 )
+{
+	das_global<int32_t,0x6c1602f8>(__context__) /*g_counter*/++;
+}
+
+inline void finalize_a64413730822e2bd ( Context * __context__, _lambda_thismodule_16_2_1 &  ____this_rename_at_16 )
+{
+	finalize_8040b9a0007f25d3(__context__,das_arg<Foo>::pass(____this_rename_at_16.C));
+	finalize_c20f17660d779b79(__context__,____this_rename_at_16.pA);
+	memset(&(____this_rename_at_16), 0, 32);
+}
+
+inline void finalize_e180b7d5465da232 ( Context * __context__, _lambda_thismodule_33_3_2 &  ____this_rename_at_33 )
+{
+	memset(&(____this_rename_at_33), 0, 64);
+}
+
+inline bool test_c535f963d2916328 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,272,"test " DAS_FILE_LINE);
+{
+	TDim<int32_t,2> _temp_make_local_28_64;
+	TDim<int32_t,2> _temp_make_local_29_112;
+	TDim<int32_t,2> _temp_make_local_30_160;
+	TArray<int32_t> __a1_rename_at_28; das_zero(__a1_rename_at_28); das_move(__a1_rename_at_28, _Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_28_64(0,__context__) = 1;
+		_temp_make_local_28_64(1,__context__) = 2;
+		return _temp_make_local_28_64;
+	})()))));
+	TArray<int32_t> __a2_rename_at_29; das_zero(__a2_rename_at_29); das_move(__a2_rename_at_29, _Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_29_112(0,__context__) = 1;
+		_temp_make_local_29_112(1,__context__) = 2;
+		return _temp_make_local_29_112;
+	})()))));
+	TArray<int32_t> __a3_rename_at_30; das_zero(__a3_rename_at_30); das_move(__a3_rename_at_30, _Funcbuiltin_0x60_to_array_move_5baa820607536fa4(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_30_160(0,__context__) = 1;
+		_temp_make_local_30_160(1,__context__) = 2;
+		return _temp_make_local_30_160;
+	})()))));
+	Lambda DAS_COMMENT((void)) __lam_rename_at_32; das_zero(__lam_rename_at_32); das_move(__lam_rename_at_32, das_ascend<void,_lambda_thismodule_33_3_2>::make(__context__,&__type_info__85c25ffe,(([&]() -> _lambda_thismodule_33_3_2 {
+		_lambda_thismodule_33_3_2 __mks_33;
+		das_zero(__mks_33);
+		das_copy((__mks_33.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_33_3_2`function _lambda_thismodule_33_3_2*/ 3389733095u))));
+		das_copy((__mks_33.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_33_3_2`finazlier #ptr#_lambda_thismodule_33_3_2#explicit*/ 3894301544u))));
+		das_copy((__mks_33.a1),(das_ref(__context__,__a1_rename_at_28)));
+		das_move((__mks_33.a2),(__a2_rename_at_29));
+		{
+			_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(__mks_33.a3),das_arg<TArray<int32_t>>::pass(__a3_rename_at_30));
+		}		return __mks_33;
+	})())));
+	das_invoke_lambda<void>::invoke(__context__,__lam_rename_at_32);
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a1_rename_at_28)) == 3));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a2_rename_at_29)) == 0));
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a3_rename_at_30)) == 2));
+	test_delete_650e1803be373f43(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_delete_650e1803be373f43 ( Context * __context__ )
+{
+	Foo * __pA_rename_at_12 = das_new<Foo>::make(__context__);
+	Foo * __pB_rename_at_13 = das_new<Foo>::make(__context__);
+	Foo __C_rename_at_14 = (([&]() -> Foo {
+		Foo __mks_14;
+		das_zero(__mks_14);
+		return __mks_14;
+	})());
+	Lambda DAS_COMMENT((void)) __lam_rename_at_15; das_zero(__lam_rename_at_15); das_move(__lam_rename_at_15, das_ascend<void,_lambda_thismodule_16_2_1>::make(__context__,&__type_info__ba496f9,(([&]() -> _lambda_thismodule_16_2_1 {
+		_lambda_thismodule_16_2_1 __mks_16;
+		das_copy((__mks_16.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_2_1`function _lambda_thismodule_16_2_1*/ 4251330029u))));
+		das_copy((__mks_16.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_16_2_1`finazlier #ptr#_lambda_thismodule_16_2_1#explicit*/ 1617685766u))));
+		das_copy((__mks_16.C),(__C_rename_at_14));
+		das_copy((__mks_16.pA),(__pA_rename_at_12));
+		das_move((__mks_16.pB),(__pB_rename_at_13));
+		return __mks_16;
+	})())));
+	DAS_ASSERT((__pB_rename_at_13 == nullptr));
+	das_invoke_lambda<void>::invoke(__context__,__lam_rename_at_15);
+	das_delete<Lambda DAS_COMMENT((void))>::clear(__context__,__lam_rename_at_15);
+	DAS_ASSERT((das_global<int32_t,0x6c1602f8>(__context__) /*g_counter*/ == 2));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de
+		aotLib[0x24228519273abfce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 *  ),&_Func_lambda_thismodule_16_2_1_0x60_finazlier_1afb07aa827403de>>();
+	};
+		// _Func_lambda_thismodule_16_2_1_0x60_function_f9011909c4760b7c
+		aotLib[0x4fed44d11e0bb6d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 &  ),&_Func_lambda_thismodule_16_2_1_0x60_function_f9011909c4760b7c>>();
+	};
+		// _Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626
+		aotLib[0xefac99460bab10cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 *  ),&_Func_lambda_thismodule_33_3_2_0x60_finazlier_ae97773dc216c626>>();
+	};
+		// _Func_lambda_thismodule_33_3_2_0x60_function_2b4b69431dc34876
+		aotLib[0xdce34302647d7f36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 &  ),&_Func_lambda_thismodule_33_3_2_0x60_function_2b4b69431dc34876>>();
+	};
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_5baa820607536fa4
+		aotLib[0xf9222b6e826376ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_5baa820607536fa4>>();
+	};
+		// finalize_c20f17660d779b79
+		aotLib[0xd8c2f7bd570eafd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_c20f17660d779b79>>();
+	};
+		// finalize_8040b9a0007f25d3
+		aotLib[0xbc32e16d0b07f0f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  &  ),&finalize_8040b9a0007f25d3>>();
+	};
+		// finalize_a64413730822e2bd
+		aotLib[0xe2d309643f32b1ff] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_2_1 &  ),&finalize_a64413730822e2bd>>();
+	};
+		// finalize_e180b7d5465da232
+		aotLib[0xd400736e8c10585d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_33_3_2 &  ),&finalize_e180b7d5465da232>>();
+	};
+		// test_c535f963d2916328
+		aotLib[0xe4e8c7c4f2964710] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c535f963d2916328>>();
+	};
+		// test_delete_650e1803be373f43
+		aotLib[0x35b0130a8d71a1ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_delete_650e1803be373f43>>();
+	};
+		// [[ init script ]]
+		aotLib[0x50871c8dbef5e5f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
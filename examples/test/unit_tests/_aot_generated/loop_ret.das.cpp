@@ -0,0 +1,135 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require random
+#include "daScript/simulate/aot_builtin_random.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_push_6b3f387e53a62ea5 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __Arr_rename_at_37, TTuple<16,int32_t,float3> const  & __value_rename_at_37 );
+inline void foo_c85ad8dd3271728a ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __attached_fires_rename_at_9 );
+inline bool test_7ce01defe429fb35 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<int4,0xb1c392db>(__context__);/*seed*/
+}
+
+inline void _Funcbuiltin_0x60_push_6b3f387e53a62ea5 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __Arr_rename_at_37, TTuple<16,int32_t,float3> const  &  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__Arr_rename_at_37),16,__context__),__context__),__value_rename_at_37);
+}
+
+inline void foo_c85ad8dd3271728a ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __attached_fires_rename_at_9 )
+{
+	TTuple<16,int32_t,float3> _temp_make_local_14_64;
+	int32_t __t_rename_at_10 = ((int32_t)(SimPolicy<int32_t>::Mod(randomInt(das_global<int4,0xb1c392db>(__context__) /*seed*/),100,*__context__)));
+	{
+		bool __need_loop_11 = true;
+		// x : tuple<int;float3> aka Foo&
+		das_iterator<TArray<TTuple<16,int32_t,float3>>> __x_iterator(__attached_fires_rename_at_9);
+		TTuple<16,int32_t,float3> * __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) )
+		{
+			if ( das_get_tuple_field<int32_t,0>::get((*__x_rename_at_11)) == __t_rename_at_10 )
+			{
+				return ;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+	};
+	_Funcbuiltin_0x60_push_6b3f387e53a62ea5(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__attached_fires_rename_at_9),das_arg<TTuple<16,int32_t,float3>>::pass((([&]() -> TTuple<16,int32_t,float3>& {
+		das_get_tuple_field<int32_t,0>::get(_temp_make_local_14_64) = __t_rename_at_10;
+		das_get_tuple_field<float3,4>::get(_temp_make_local_14_64) = v_zero();
+		return _temp_make_local_14_64;
+	})())));
+}
+
+inline bool test_7ce01defe429fb35 ( Context * __context__ )
+{
+	TArray<TTuple<16,int32_t,float3>> __a_rename_at_18; das_zero(__a_rename_at_18);
+	{
+		bool __need_loop_19 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000));
+		int32_t __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			foo_c85ad8dd3271728a(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_18));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_18)) == 100));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_push_6b3f387e53a62ea5
+		aotLib[0x5f22f7ab387a9cc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & , TTuple<16,int32_t,float3> const  &  ),&_Funcbuiltin_0x60_push_6b3f387e53a62ea5>>();
+	};
+		// foo_c85ad8dd3271728a
+		aotLib[0x557c13f9f01099b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  ),&foo_c85ad8dd3271728a>>();
+	};
+		// test_7ce01defe429fb35
+		aotLib[0x6be8437d257fa06d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7ce01defe429fb35>>();
+	};
+		// [[ init script ]]
+		aotLib[0xe2d11f2619671e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,163 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct OverFoo {
+	int32_t a;
+	TestObjectFoo foo;
+};
+static_assert(sizeof(OverFoo)==56,"structure size mismatch with DAS");
+static_assert(offsetof(OverFoo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(OverFoo,foo)==8,"structure field offset mismatch with DAS");
+}
+
+inline TestObjectFoo cmresTest_e99947f7c5eccde1 ( Context * __context__, int32_t __a_rename_at_3 );
+inline bool test_e4c6dc64d5a580a6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TestObjectFoo,0x7d974892>(__context__) = (([&]() -> TestObjectFoo {
+		TestObjectFoo __mks_11;
+		das_zero(__mks_11);
+		das_copy((__mks_11.fooData /*fooData*/),(6));
+		return __mks_11;
+	})());/*gstackref*/
+	das_global<TDim<TestObjectFoo,2>,0xfc44aa82>(__context__) = (([&]() -> TDim<TestObjectFoo,2> {
+		TDim<TestObjectFoo,2> __mks_12;
+		das_zero(__mks_12);
+		das_copy((__mks_12(0,__context__).fooData /*fooData*/),(1));
+		das_copy((__mks_12(1,__context__).fooData /*fooData*/),(2));
+		return __mks_12;
+	})());/*gstackrefa*/
+}
+
+inline TestObjectFoo cmresTest_e99947f7c5eccde1 ( Context * __context__, int32_t __a_rename_at_3 )
+{
+	return das_auto_cast<TestObjectFoo>::cast((([&]() -> TestObjectFoo {
+		TestObjectFoo __mks_4;
+		das_zero(__mks_4);
+		das_copy((__mks_4.fooData /*fooData*/),(__a_rename_at_3));
+		return __mks_4;
+	})()));
+}
+
+inline bool test_e4c6dc64d5a580a6 ( Context * __context__ )
+{
+	DAS_ASSERT((das_global<TestObjectFoo,0x7d974892>(__context__) /*gstackref*/.fooData /*fooData*/ == 6));
+	DAS_ASSERT(((das_global<TDim<TestObjectFoo,2>,0xfc44aa82>(__context__) /*gstackrefa*/(0,__context__).fooData /*fooData*/ == 1) && (das_global<TDim<TestObjectFoo,2>,0xfc44aa82>(__context__) /*gstackrefa*/(1,__context__).fooData /*fooData*/ == 2)));
+	TestObjectFoo __local_t_rename_at_20_ConstRef = ((TestObjectFoo)(([&]() -> TestObjectFoo {
+		TestObjectFoo __mks_20;
+		das_zero(__mks_20);
+		das_copy((__mks_20.fooData /*fooData*/),(5));
+		return __mks_20;
+	})()));
+	TestObjectFoo const  & __local_t_rename_at_20 = __local_t_rename_at_20_ConstRef; ;
+	DAS_ASSERT((__local_t_rename_at_20.fooData /*fooData*/ == 5));
+	TestObjectFoo __cmres_t_rename_at_23 = cmresTest_e99947f7c5eccde1(__context__,13);
+	DAS_ASSERT((__cmres_t_rename_at_23.fooData /*fooData*/ == 13));
+	TDim<OverFoo,2> __mixed_rename_at_26 = (([&]() -> TDim<OverFoo,2> {
+		TDim<OverFoo,2> __mks_26;
+		das_zero(__mks_26);
+		das_copy((__mks_26(0,__context__).a),(1));
+		das_copy((__mks_26(0,__context__).foo),((([&]() -> TestObjectFoo {
+			TestObjectFoo __mks_26;
+			das_zero(__mks_26);
+			das_copy((__mks_26.fooData /*fooData*/),(1));
+			return __mks_26;
+		})())));
+		das_copy((__mks_26(1,__context__).a),(2));
+		das_copy((__mks_26(1,__context__).foo),((([&]() -> TestObjectFoo {
+			TestObjectFoo __mks_26;
+			das_zero(__mks_26);
+			das_copy((__mks_26.fooData /*fooData*/),(2));
+			return __mks_26;
+		})())));
+		return __mks_26;
+	})());
+	DAS_ASSERT(((__mixed_rename_at_26(0,__context__).foo.fooData /*fooData*/ == 1) && (__mixed_rename_at_26(1,__context__).foo.fooData /*fooData*/ == 2)));
+	TestObjectFoo * __ascend_t_rename_at_29; das_zero(__ascend_t_rename_at_29); das_move(__ascend_t_rename_at_29, das_ascend_handle<false,TestObjectFoo *>::make(__context__,nullptr,(([&](TestObjectFoo & __mks_29) {
+		das_copy((__mks_29.fooData /*fooData*/),(1));
+	}))));
+	DAS_ASSERT((__ascend_t_rename_at_29->fooData /*fooData*/ == 1));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__ascend_t_rename_at_29);
+	smart_ptr_raw<TestObjectSmart> __ascend_smart_t_rename_at_34; das_zero(__ascend_smart_t_rename_at_34); das_move(__ascend_smart_t_rename_at_34, das_ascend_handle<true,smart_ptr_raw<TestObjectSmart>>::make(__context__,nullptr,(([&](TestObjectSmart & __mks_34) {
+		das_copy((__mks_34.fooData /*fooData*/),(1));
+	}))));
+	DAS_ASSERT((__ascend_smart_t_rename_at_34->fooData /*fooData*/ == 1));
+	das_delete_handle<smart_ptr_raw<TestObjectSmart>>::clear(__context__,__ascend_smart_t_rename_at_34);
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// cmresTest_e99947f7c5eccde1
+		aotLib[0x93a7696b6bd1a721] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TestObjectFoo (*) ( Context * __context__, int32_t  ),&cmresTest_e99947f7c5eccde1>>();
+	};
+		// test_e4c6dc64d5a580a6
+		aotLib[0xc34b0b67fdf21114] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e4c6dc64d5a580a6>>();
+	};
+		// [[ init script ]]
+		aotLib[0x9dfa5ac0c7841c97] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,146 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__223f839;
+
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__223f839 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x223f839 };
+
+TypeInfo * __tinfo_0[5] = { &__type_info__223f839, &__type_info__3ffbf730, &__type_info__223f839, &__type_info__3ffbf730, &__type_info__223f839 };
+
+inline int32_t rightPolicyCeili_e8875dc7b7ac0f0d ( Context * __context__, float __a_rename_at_6 );
+inline bool test_45d3c9aed3d8ee81 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t rightPolicyCeili_e8875dc7b7ac0f0d ( Context * __context__, float __a_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast(SimPolicy<float>::Ceili(__a_rename_at_6,*__context__));
+}
+
+inline bool test_45d3c9aed3d8ee81 ( Context * __context__ )
+{
+	DAS_ASSERT((true));
+	uint32_t __seed_rename_at_12 = 0x1u;
+	int32_t __position_rename_at_13 = ((int32_t)1);
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((uint_noise1D(__position_rename_at_13,__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((uint_noise2D_int2(int2(100,100),__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((uint_noise3D_int3(int3(100,100,100),__seed_rename_at_12) != __seed_rename_at_12));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_VERIFY((rightPolicyCeili_e8875dc7b7ac0f0d(__context__,1.20000005f) == 2));
+	char * __mme_rename_at_66 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_0, cast<float>::from(das_global<float,0x454932c2>(__context__) /*FLT_MIN*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0x71a0fdc8>(__context__) /*FLT_MAX*/), cast<char * const >::from(((char *) " ")), cast<float>::from(das_global<float,0x393350e8>(__context__) /*FLT_EPSILON*/)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__mme_rename_at_66),cast<char *>::from(((char *) "1.17549e-38 3.40282e+38 1.19209e-07")),*__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// rightPolicyCeili_e8875dc7b7ac0f0d
+		aotLib[0x3fc5c565b7a092c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, float  ),&rightPolicyCeili_e8875dc7b7ac0f0d>>();
+	};
+		// test_45d3c9aed3d8ee81
+		aotLib[0x6221e61732f9d78f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_45d3c9aed3d8ee81>>();
+	};
+		// [[ init script ]]
+		aotLib[0xf801199d579713dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
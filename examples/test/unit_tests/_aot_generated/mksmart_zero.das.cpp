@@ -0,0 +1,100 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_436 );
+inline smart_ptr_raw<TestObjectSmart> mks_eec47b0d57f74fe7 ( Context * __context__ );
+inline bool test_58076b9356ef28d7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TestObjectSmart * _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d ( Context * __context__, smart_ptr_raw<TestObjectSmart> const  __src_rename_at_436 )
+{
+	return das_auto_cast<TestObjectSmart *>::cast(das_cast<TestObjectSmart *>::cast(__src_rename_at_436));
+}
+
+inline smart_ptr_raw<TestObjectSmart> mks_eec47b0d57f74fe7 ( Context * __context__ )
+{
+	return das_auto_cast<smart_ptr_raw<TestObjectSmart>>::cast(nullptr);
+}
+
+inline bool test_58076b9356ef28d7 ( Context * __context__ )
+{
+	DAS_VERIFY((_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d(__context__,das_auto_cast<smart_ptr_raw<TestObjectSmart> const >::cast(nullptr)) == nullptr));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d
+		aotLib[0x76f9b1b1446f8ac5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TestObjectSmart * (*) ( Context * __context__, smart_ptr_raw<TestObjectSmart> const   ),&_Funcbuiltin_0x60_get_ptr_6ed337f1f513c68d>>();
+	};
+		// mks_eec47b0d57f74fe7
+		aotLib[0x1baf3bc0583ca929] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<smart_ptr_raw<TestObjectSmart> (*) ( Context * __context__ ),&mks_eec47b0d57f74fe7>>();
+	};
+		// test_58076b9356ef28d7
+		aotLib[0x84b7fe7594bb5bf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_58076b9356ef28d7>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
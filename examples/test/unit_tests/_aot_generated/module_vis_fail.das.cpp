@@ -0,0 +1,106 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require _module_a
+ // require _module_b
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline char * _Func_module_b_0x60_from_b_get_3_8c0ae12e0276a4fa ( Context * __context__ );
+inline char * _Func_module_b_0x60_from_b_get_4_edde2d49b90b3e ( Context * __context__ );
+inline bool test_6a12039518ab9576 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0xcb6ec82b>(__context__) = ((char *) "local");/*global_1*/
+	das_global<char *,0x5dfebe49>(__context__) = ((char *) "local");/*global_3*/
+}
+
+inline char * _Func_module_b_0x60_from_b_get_3_8c0ae12e0276a4fa ( Context * __context__ )
+{
+	return das_auto_cast<char *>::cast(das_global<char *,0xb5939514>(__context__) /*global_3*/);
+}
+
+inline char * _Func_module_b_0x60_from_b_get_4_edde2d49b90b3e ( Context * __context__ )
+{
+	return das_auto_cast<char *>::cast(das_global<char *,0x67498998>(__context__) /*global_4*/);
+}
+
+inline bool test_6a12039518ab9576 ( Context * __context__ )
+{
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xcb6ec82b>(__context__) /*::global_1*/),cast<char *>::from(((char *) "local")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x50f6ace1>(__context__) /*_module_b::global_1*/),cast<char *>::from(((char *) "from_b")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_3_8c0ae12e0276a4fa(__context__)),cast<char *>::from(((char *) "from_a")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_4_edde2d49b90b3e(__context__)),cast<char *>::from(((char *) "from_b")),*__context__)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0x5dfebe49>(__context__) /*global_3*/),cast<char *>::from(((char *) "local")),*__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_module_b_0x60_from_b_get_3_8c0ae12e0276a4fa
+		aotLib[0x787ac275ddcb732d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_3_8c0ae12e0276a4fa>>();
+	};
+		// _Func_module_b_0x60_from_b_get_4_edde2d49b90b3e
+		aotLib[0x9cee2f576cd13c7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_4_edde2d49b90b3e>>();
+	};
+		// test_6a12039518ab9576
+		aotLib[0xf177235ef0275603] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6a12039518ab9576>>();
+	};
+		// [[ init script ]]
+		aotLib[0x53fc486781dc1ab3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
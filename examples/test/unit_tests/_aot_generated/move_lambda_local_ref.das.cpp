@@ -0,0 +1,242 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__145f91aa;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__ca258bda;
+extern TypeInfo __type_info__eab9fe41;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__b9acd692;
+extern VarInfo __var_info__935c0f9e;
+extern VarInfo __var_info__6afb4ed7;
+extern VarInfo __var_info__874a9d4d;
+
+TypeInfo * __type_info__6afb4ed7_arg_types_var_341807530[1] = { &__type_info__ca258bda };
+VarInfo __struct_info__145f91aa_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__eab9fe41, nullptr, (TypeInfo **)__type_info__6afb4ed7_arg_types_var_341807530, nullptr, 1, 0, nullptr, 28, 0x6afb4ed7, "__lambda", 0 };
+TypeInfo * __type_info__935c0f9e_arg_types_var_341807530[1] = { &__type_info__b9acd692 };
+VarInfo __struct_info__145f91aa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__935c0f9e_arg_types_var_341807530, nullptr, 1, 0, nullptr, 28, 0x935c0f9e, "__finalize", 4 };
+VarInfo __struct_info__145f91aa_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x874a9d4d, "arr", 8 };
+VarInfo * __struct_info__145f91aa_fields[3] =  { &__struct_info__145f91aa_field_0, &__struct_info__145f91aa_field_1, &__struct_info__145f91aa_field_2 };
+StructInfo __struct_info__145f91aa = {"_lambda_thismodule_6_2_1", __struct_info__145f91aa_fields, 3, 32, -1, nullptr, 0x145f91aa };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__ca258bda = { Type::tStructure, &__struct_info__145f91aa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xca258bda };
+TypeInfo __type_info__eab9fe41 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 130, 0xeab9fe41 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__b9acd692 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ca258bda, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xb9acd692 };
+
+namespace  {
+
+struct Foo {
+	Lambda DAS_COMMENT((TArray<int32_t>)) bar;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_6_2_1 {
+	Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_6_2_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_6_2_1 *)) __finalize;
+	TArray<int32_t> arr;
+};
+static_assert(sizeof(_lambda_thismodule_6_2_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,arr)==8,"structure field offset mismatch with DAS");
+}
+
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_5fe3a7a96a5ae692 ( Context * __context__, TArray<int32_t> & __arr_rename_at_4 );
+inline void _Func_lambda_thismodule_6_2_1_0x60_finazlier_cedb06e8bd98fcb6 ( Context * __context__, _lambda_thismodule_6_2_1 * ____this_rename_at_6 );
+inline TArray<int32_t> _Func_lambda_thismodule_6_2_1_0x60_function_7fd814b019953b35 ( Context * __context__, _lambda_thismodule_6_2_1 & ____this_rename_at_6 );
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_8a19c5b455ae538d ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_131 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a ( Context * __context__, TDim<int32_t,3> & __a_rename_at_298 );
+inline void finalize_4fba5cc991280b12 ( Context * __context__, _lambda_thismodule_6_2_1 & ____this_rename_at_6 );
+inline bool test_dc7845ca670287f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TArray<int32_t> _temp_make_local_10_48;
+	TDim<int32_t,3> _temp_make_local_10_80;
+	das_global<Foo *,0xe31e9727>(__context__) = das_ascend<Foo,Foo>::make(__context__,nullptr,(([&]() -> Foo {
+		Foo __mks_9;
+		das_move((__mks_9.bar),(Bar_5fe3a7a96a5ae692(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_10_48 = (_Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_10_80(0,__context__) = 1;
+			_temp_make_local_10_80(1,__context__) = 2;
+			_temp_make_local_10_80(2,__context__) = 3;
+			return _temp_make_local_10_80;
+		})())))))))));
+		return __mks_9;
+	})()));/*foo*/
+}
+
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_5fe3a7a96a5ae692 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_4 )
+{
+	return das_auto_cast<Lambda DAS_COMMENT((TArray<int32_t>))>::cast(das_ascend<TArray<int32_t>,_lambda_thismodule_6_2_1>::make(__context__,&__type_info__ca258bda,(([&]() -> _lambda_thismodule_6_2_1 {
+		_lambda_thismodule_6_2_1 __mks_6;
+		das_copy((__mks_6.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_6_2_1`function _lambda_thismodule_6_2_1*/ 1971014141u))));
+		das_copy((__mks_6.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_6_2_1`finazlier #ptr#_lambda_thismodule_6_2_1#explicit*/ 480983466u))));
+		das_move((__mks_6.arr),(__arr_rename_at_4));
+		return __mks_6;
+	})())));
+}
+
+inline void _Func_lambda_thismodule_6_2_1_0x60_finazlier_cedb06e8bd98fcb6 ( Context * __context__, _lambda_thismodule_6_2_1 * ____this_rename_at_6 )
+{
+	finalize_4fba5cc991280b12(__context__,das_arg<_lambda_thismodule_6_2_1>::pass(das_deref(__context__,____this_rename_at_6)));
+	das_delete_lambda_struct<_lambda_thismodule_6_2_1 *>::clear(__context__,____this_rename_at_6);
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_6_2_1_0x60_function_7fd814b019953b35 ( Context * __context__, _lambda_thismodule_6_2_1 &  ____this_rename_at_6 )
+{
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(_Funcbuiltin_0x60_clone_to_move_8a19c5b455ae538d(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_6.arr)));
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_8a19c5b455ae538d ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_131 )
+{
+	TArray<int32_t> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_132),__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__clone_dest_rename_at_132);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_298 )
+{
+	TArray<int32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_299),3);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_299);
+}
+
+inline void finalize_4fba5cc991280b12 ( Context * __context__, _lambda_thismodule_6_2_1 &  ____this_rename_at_6 )
+{
+	memset(&(____this_rename_at_6), 0, 32);
+}
+
+inline bool test_dc7845ca670287f ( Context * __context__ )
+{
+	TArray<int32_t> __l_rename_at_15_ConstRef; das_zero(__l_rename_at_15_ConstRef); das_move(__l_rename_at_15_ConstRef, ((TArray<int32_t>)das_invoke_lambda<TArray<int32_t>>::invoke_cmres(__context__,das_global<Foo *,0xe31e9727>(__context__) /*foo*/->bar)));
+	TArray<int32_t> const  & __l_rename_at_15 = __l_rename_at_15_ConstRef; ;
+	DAS_ASSERT((((__l_rename_at_15(0,__context__) == 1) && (__l_rename_at_15(1,__context__) == 2)) && (__l_rename_at_15(2,__context__) == 3)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Bar_5fe3a7a96a5ae692
+		aotLib[0x80bc871187404146] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, TArray<int32_t> &  ),&Bar_5fe3a7a96a5ae692>>();
+	};
+		// _Func_lambda_thismodule_6_2_1_0x60_finazlier_cedb06e8bd98fcb6
+		aotLib[0x5963ecce8a5f8f67] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_2_1 *  ),&_Func_lambda_thismodule_6_2_1_0x60_finazlier_cedb06e8bd98fcb6>>();
+	};
+		// _Func_lambda_thismodule_6_2_1_0x60_function_7fd814b019953b35
+		aotLib[0x32a5ba7bb851819d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, _lambda_thismodule_6_2_1 &  ),&_Func_lambda_thismodule_6_2_1_0x60_function_7fd814b019953b35>>();
+	};
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_8a19c5b455ae538d
+		aotLib[0xee234a9c61bd9954] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_8a19c5b455ae538d>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a
+		aotLib[0x1710ad6d3f7b6649] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_126492df0d2b0a6a>>();
+	};
+		// finalize_4fba5cc991280b12
+		aotLib[0xe2ff3fa0a49f0a49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_2_1 &  ),&finalize_4fba5cc991280b12>>();
+	};
+		// test_dc7845ca670287f
+		aotLib[0xbd26e8b410bd01f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dc7845ca670287f>>();
+	};
+		// [[ init script ]]
+		aotLib[0x767ffa45808ee5d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,127 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__fa433f81;
+extern VarInfo __var_info__eedd2c27;
+extern VarInfo __var_info__e3dd1ad6;
+extern VarInfo __var_info__f0dd2f4d;
+extern VarInfo __var_info__eddd2a94;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeedd2c27, "x", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeddd2a94, "y", 4 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xf0dd2f4d, "z", 8 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe3dd1ad6, "w", 12 };
+VarInfo * __struct_info__b1589007_fields[4] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 4, 16, 0, nullptr, 0xb1589007 };
+TypeInfo __type_info__fa433f81 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 0xfa433f81 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__fa433f81 };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_913b32d756e634d9 ( Context * __context__ );
+inline bool test_1bfe56f961546d0c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo Foo_913b32d756e634d9 ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_6;
+		das_copy((__mks_6.x),(1));
+		das_copy((__mks_6.y),(2));
+		das_copy((__mks_6.z),(3));
+		das_copy((__mks_6.w),(4));
+		return __mks_6;
+	})()));
+}
+
+inline bool test_1bfe56f961546d0c ( Context * __context__ )
+{
+	Foo __f_rename_at_14; das_zero(__f_rename_at_14);
+	Foo * __q_rename_at_15 = ((Foo *)das_auto_cast<Foo * const >::cast(das_call_interop<void *>::call(&new_and_init,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Foo &>::from(__f_rename_at_14)))));
+	DAS_ASSERT(((((__q_rename_at_15->x == 1) && (__q_rename_at_15->y == 2)) && (__q_rename_at_15->z == 3)) && (__q_rename_at_15->w == 4)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_913b32d756e634d9
+		aotLib[0xf94781e3f9ac3f65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_913b32d756e634d9>>();
+	};
+		// test_1bfe56f961546d0c
+		aotLib[0x8e41b3bd967d3e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1bfe56f961546d0c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,455 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__3ffbf730;
+
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__95e97e5e };
+TypeInfo * __tinfo_1[2] = { &__type_info__95e97e5e, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[2] = { &__type_info__95e97e5e, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__95e97e5e, &__type_info__3ffbf730 };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct SomethingSmall {
+	int32_t a;
+	int32_t b;
+	int32_t c;
+};
+static_assert(sizeof(SomethingSmall)==12,"structure size mismatch with DAS");
+static_assert(offsetof(SomethingSmall,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,b)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(SomethingSmall,c)==8,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_da_inscope_544206816aee386b ( Context * __context__, int32_t __x_rename_at_70 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_193 );
+inline void _Funcbuiltin_0x60_finalize_dim_ac129617b30ff83c ( Context * __context__, TDim<TArray<int32_t>,5> & __a_rename_at_178 );
+inline void _Funcbuiltin_0x60_finalize_dim_2f372b61677ce064 ( Context * __context__, TDim<TestObjectFoo *,10> & __a_rename_at_178 );
+inline void _Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f ( Context * __context__, TDim<SomethingSmall *,10> & __a_rename_at_178 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void finalize_89a56f46a177047d ( Context * __context__, SomethingSmall * & ____this_rename_at_182 );
+inline void finalize_36072647358759e2 ( Context * __context__, SomethingSmall & ____this_rename_at_9 );
+inline bool test_3e3887bf9fa67f93 ( Context * __context__ );
+inline void test_delete_array_1c26c16dba06ce69 ( Context * __context__ );
+inline void test_delete_handle_f1b58fd823ec6c12 ( Context * __context__ );
+inline void test_delete_handle_array_80c1489fc98dc271 ( Context * __context__ );
+inline void test_delete_string_2e6c15be80f16e39 ( Context * __context__ );
+inline void test_delete_string_array_8a039d62a78818db ( Context * __context__ );
+inline void test_delete_struct_ae05232a66708431 ( Context * __context__ );
+inline void test_delete_struct_array_41989b6d0e9e3437 ( Context * __context__ );
+inline void test_delete_struct_array_in_scope_f1b7a770ffda82d4 ( Context * __context__ );
+inline void test_delete_table_9c6062658487bafd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_da_inscope_544206816aee386b ( Context * __context__, int32_t __x_rename_at_70 )
+{
+	SomethingSmall * __b_rename_at_71; memset(&__b_rename_at_71,0,sizeof(__b_rename_at_71));
+	TDim<SomethingSmall *,10> __a_rename_at_72; memset(&__a_rename_at_72,0,sizeof(__a_rename_at_72));
+	SomethingSmall _temp_new_71_48;
+/* finally */ auto __finally_71= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_72));
+	das_copy(__b_rename_at_71,nullptr);
+/* end finally */ });
+	__b_rename_at_71 = das_new_on_stack<SomethingSmall>::make(_temp_new_71_48);
+	__a_rename_at_72 = das_new_dim<SomethingSmall,10>::make(__context__);
+	das_copy(__b_rename_at_71->a,__x_rename_at_70);
+	{
+		bool __need_loop_74 = true;
+		// pA : SomethingSmall?&
+		das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_72);
+		SomethingSmall * * __pA_rename_at_74;
+		__need_loop_74 = __pA_iterator.first(__context__,(__pA_rename_at_74)) && __need_loop_74;
+		for ( ; __need_loop_74 ; __need_loop_74 = __pA_iterator.next(__context__,(__pA_rename_at_74)) )
+		{
+			das_copy((*__pA_rename_at_74)->a,__x_rename_at_70);
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_74));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_193),4,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_ac129617b30ff83c ( Context * __context__, TDim<TArray<int32_t>,5> &  __a_rename_at_178 )
+{
+	{
+		bool __need_loop_180 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TDim<TArray<int32_t>,5>> __aV_iterator(__a_rename_at_178);
+		TArray<int32_t> * __aV_rename_at_180;
+		__need_loop_180 = __aV_iterator.first(__context__,(__aV_rename_at_180)) && __need_loop_180;
+		for ( ; __need_loop_180 ; __need_loop_180 = __aV_iterator.next(__context__,(__aV_rename_at_180)) )
+		{
+			_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass((*__aV_rename_at_180)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_180));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_2f372b61677ce064 ( Context * __context__, TDim<TestObjectFoo *,10> &  __a_rename_at_178 )
+{
+	{
+		bool __need_loop_180 = true;
+		// aV : UnitTest::TestObjectFoo? aka TT&
+		das_iterator<TDim<TestObjectFoo *,10>> __aV_iterator(__a_rename_at_178);
+		TestObjectFoo * * __aV_rename_at_180;
+		__need_loop_180 = __aV_iterator.first(__context__,(__aV_rename_at_180)) && __need_loop_180;
+		for ( ; __need_loop_180 ; __need_loop_180 = __aV_iterator.next(__context__,(__aV_rename_at_180)) )
+		{
+			das_delete_handle<TestObjectFoo *>::clear(__context__,(*__aV_rename_at_180));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_180));
+	};
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f ( Context * __context__, TDim<SomethingSmall *,10> &  __a_rename_at_178 )
+{
+	{
+		bool __need_loop_180 = true;
+		// aV : SomethingSmall? aka TT&
+		das_iterator<TDim<SomethingSmall *,10>> __aV_iterator(__a_rename_at_178);
+		SomethingSmall * * __aV_rename_at_180;
+		__need_loop_180 = __aV_iterator.first(__context__,(__aV_rename_at_180)) && __need_loop_180;
+		for ( ; __need_loop_180 ; __need_loop_180 = __aV_iterator.next(__context__,(__aV_rename_at_180)) )
+		{
+			finalize_89a56f46a177047d(__context__,(*__aV_rename_at_180));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_180));
+	};
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void finalize_89a56f46a177047d ( Context * __context__, SomethingSmall * & ____this_rename_at_182 )
+{
+	if ( ____this_rename_at_182 != nullptr )
+	{
+		finalize_36072647358759e2(__context__,das_arg<SomethingSmall>::pass(das_deref(__context__,____this_rename_at_182)));
+		das_delete<SomethingSmall *>::clear(__context__,____this_rename_at_182);
+		das_copy(____this_rename_at_182,nullptr);
+	};
+}
+
+inline void finalize_36072647358759e2 ( Context * __context__, SomethingSmall &  ____this_rename_at_9 )
+{
+	memset(&(____this_rename_at_9), 0, 12);
+}
+
+inline bool test_3e3887bf9fa67f93 ( Context * __context__ )
+{
+	test_delete_struct_array_in_scope_f1b7a770ffda82d4(__context__);
+	test_delete_handle_f1b58fd823ec6c12(__context__);
+	test_delete_handle_array_80c1489fc98dc271(__context__);
+	test_delete_struct_ae05232a66708431(__context__);
+	test_delete_struct_array_41989b6d0e9e3437(__context__);
+	test_delete_array_1c26c16dba06ce69(__context__);
+	test_delete_table_9c6062658487bafd(__context__);
+	test_delete_string_2e6c15be80f16e39(__context__);
+	test_delete_string_array_8a039d62a78818db(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_delete_array_1c26c16dba06ce69 ( Context * __context__ )
+{
+	TDim<TArray<int32_t>,5> __a_rename_at_13; das_zero(__a_rename_at_13);
+	uint64_t __w0_rename_at_14 = ((uint64_t)heap_bytes_allocated(__context__));
+	{
+		bool __need_loop_15 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,5));
+		int32_t __t_rename_at_15;
+		__need_loop_15 = __t_iterator.first(__context__,(__t_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __t_iterator.next(__context__,(__t_rename_at_15)) )
+		{
+			_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_15,__context__)),10);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_15));
+	};
+	uint64_t __w1_rename_at_17 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_dim_ac129617b30ff83c(__context__,das_arg<TDim<TArray<int32_t>,5>>::pass(__a_rename_at_13));
+	uint64_t __w2_rename_at_19 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_17 > __w0_rename_at_14) && (__w0_rename_at_14 == __w2_rename_at_19)));
+	{
+		bool __need_loop_21 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,5));
+		int32_t __t_rename_at_21;
+		__need_loop_21 = __t_iterator.first(__context__,(__t_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __t_iterator.next(__context__,(__t_rename_at_21)) )
+		{
+			DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_21,__context__))) == 0) && (builtin_array_capacity(das_arg<TArray<int32_t>>::pass(__a_rename_at_13(__t_rename_at_21,__context__))) == 0)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_21));
+	};
+}
+
+inline void test_delete_handle_f1b58fd823ec6c12 ( Context * __context__ )
+{
+	TestObjectFoo * __a_rename_at_56 = 0;
+	das_copy(__a_rename_at_56,das_new_handle<TestObjectFoo,false>::make(__context__));
+	das_delete_handle<TestObjectFoo *>::clear(__context__,__a_rename_at_56);
+	DAS_ASSERT((__a_rename_at_56 == nullptr));
+}
+
+inline void test_delete_handle_array_80c1489fc98dc271 ( Context * __context__ )
+{
+	TDim<TestObjectFoo *,10> __a_rename_at_63 = das_new_dim_handle<TestObjectFoo,10,false>::make(__context__);
+	_Funcbuiltin_0x60_finalize_dim_2f372b61677ce064(__context__,das_arg<TDim<TestObjectFoo *,10>>::pass(__a_rename_at_63));
+	{
+		bool __need_loop_66 = true;
+		// pA : UnitTest::TestObjectFoo?&
+		das_iterator<TDim<TestObjectFoo *,10>> __pA_iterator(__a_rename_at_63);
+		TestObjectFoo * * __pA_rename_at_66;
+		__need_loop_66 = __pA_iterator.first(__context__,(__pA_rename_at_66)) && __need_loop_66;
+		for ( ; __need_loop_66 ; __need_loop_66 = __pA_iterator.next(__context__,(__pA_rename_at_66)) )
+		{
+			DAS_ASSERT(((*__pA_rename_at_66) == nullptr));
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_66));
+	};
+}
+
+inline void test_delete_string_2e6c15be80f16e39 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_88 = ((uint64_t)heap_bytes_allocated(__context__));
+	char * __a_rename_at_89 = (char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<int32_t>::from(das_deref(__context__,getPtr())))));
+	delete_string(__a_rename_at_89,__context__);
+	uint64_t __w1_rename_at_93 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_88 == __w1_rename_at_93));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_89),cast<char *>::from(((char *) "")),*__context__)));
+}
+
+inline void test_delete_string_array_8a039d62a78818db ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_99 = ((uint64_t)heap_bytes_allocated(__context__));
+	TDim<char *,3> __a_rename_at_100 = (([&]() -> TDim<char *,3> {
+		TDim<char *,3> __mka_100;
+		__mka_100(0,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_1"))));
+		__mka_100(1,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_2"))));
+		__mka_100(2,__context__) = das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<int32_t>::from(das_deref(__context__,getPtr())), cast<char * const >::from(((char *) "_3"))));
+		return __mka_100;
+	})());
+	{
+		bool __need_loop_101 = true;
+		// AA : string&
+		das_iterator<TDim<char *,3>> __AA_iterator(__a_rename_at_100);
+		char * * __AA_rename_at_101;
+		__need_loop_101 = __AA_iterator.first(__context__,(__AA_rename_at_101)) && __need_loop_101;
+		for ( ; __need_loop_101 ; __need_loop_101 = __AA_iterator.next(__context__,(__AA_rename_at_101)) )
+		{
+			delete_string((*__AA_rename_at_101),__context__);
+		}
+		__AA_iterator.close(__context__,(__AA_rename_at_101));
+	};
+	uint64_t __w1_rename_at_104 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_99 == __w1_rename_at_104));
+}
+
+inline void test_delete_struct_ae05232a66708431 ( Context * __context__ )
+{
+	SomethingSmall * __a_rename_at_36 = 0;
+	uint64_t __w0_rename_at_37 = ((uint64_t)heap_bytes_allocated(__context__));
+	das_copy(__a_rename_at_36,das_new<SomethingSmall>::make(__context__));
+	uint64_t __w1_rename_at_39 = ((uint64_t)heap_bytes_allocated(__context__));
+	finalize_89a56f46a177047d(__context__,__a_rename_at_36);
+	uint64_t __w2_rename_at_41 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_39 > __w0_rename_at_37) && (__w0_rename_at_37 == __w2_rename_at_41)));
+	DAS_ASSERT((__a_rename_at_36 == nullptr));
+}
+
+inline void test_delete_struct_array_41989b6d0e9e3437 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_46 = ((uint64_t)heap_bytes_allocated(__context__));
+	TDim<SomethingSmall *,10> __a_rename_at_47 = das_new_dim<SomethingSmall,10>::make(__context__);
+	uint64_t __w1_rename_at_48 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f(__context__,das_arg<TDim<SomethingSmall *,10>>::pass(__a_rename_at_47));
+	uint64_t __w2_rename_at_50 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_48 > __w0_rename_at_46) && (__w0_rename_at_46 == __w2_rename_at_50)));
+	{
+		bool __need_loop_52 = true;
+		// pA : SomethingSmall?&
+		das_iterator<TDim<SomethingSmall *,10>> __pA_iterator(__a_rename_at_47);
+		SomethingSmall * * __pA_rename_at_52;
+		__need_loop_52 = __pA_iterator.first(__context__,(__pA_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __pA_iterator.next(__context__,(__pA_rename_at_52)) )
+		{
+			DAS_ASSERT(((*__pA_rename_at_52) == nullptr));
+		}
+		__pA_iterator.close(__context__,(__pA_rename_at_52));
+	};
+}
+
+inline void test_delete_struct_array_in_scope_f1b7a770ffda82d4 ( Context * __context__ )
+{
+	uint64_t __w0_rename_at_81 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Func_0x60_da_inscope_544206816aee386b(__context__,2);
+	uint64_t __w1_rename_at_83 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT((__w0_rename_at_81 == __w1_rename_at_83));
+}
+
+inline void test_delete_table_9c6062658487bafd ( Context * __context__ )
+{
+	TTable<int32_t,int32_t> __a_rename_at_25; das_zero(__a_rename_at_25);
+	uint64_t __w0_rename_at_26 = ((uint64_t)heap_bytes_allocated(__context__));
+	das_copy(__a_rename_at_25(0,__context__),1);
+	das_copy(__a_rename_at_25(1,__context__),2);
+	uint64_t __w1_rename_at_29 = ((uint64_t)heap_bytes_allocated(__context__));
+	_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25));
+	uint64_t __w2_rename_at_31 = ((uint64_t)heap_bytes_allocated(__context__));
+	DAS_ASSERT(((__w1_rename_at_29 > __w0_rename_at_26) && (__w0_rename_at_26 == __w2_rename_at_31)));
+	DAS_ASSERT(((builtin_table_size(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25)) == 0) && (builtin_table_capacity(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_25)) == 0)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_da_inscope_544206816aee386b
+		aotLib[0xbaa5bbe1e844dc42] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_da_inscope_544206816aee386b>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dim_ac129617b30ff83c
+		aotLib[0x3511d1db0e903d36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<TArray<int32_t>,5> &  ),&_Funcbuiltin_0x60_finalize_dim_ac129617b30ff83c>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dim_2f372b61677ce064
+		aotLib[0x7ec5fd30a43483e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<TestObjectFoo *,10> &  ),&_Funcbuiltin_0x60_finalize_dim_2f372b61677ce064>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f
+		aotLib[0x55e97eab577ba538] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<SomethingSmall *,10> &  ),&_Funcbuiltin_0x60_finalize_dim_7cfbc363f3739e5f>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// finalize_89a56f46a177047d
+		aotLib[0x4672186d752cc068] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, SomethingSmall * &  ),&finalize_89a56f46a177047d>>();
+	};
+		// finalize_36072647358759e2
+		aotLib[0x1261e188359309fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, SomethingSmall &  ),&finalize_36072647358759e2>>();
+	};
+		// test_3e3887bf9fa67f93
+		aotLib[0x8a7b0e84ad489e30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3e3887bf9fa67f93>>();
+	};
+		// test_delete_array_1c26c16dba06ce69
+		aotLib[0xd8305461d6acf70b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_array_1c26c16dba06ce69>>();
+	};
+		// test_delete_handle_f1b58fd823ec6c12
+		aotLib[0x2dbb3fdf5fb6183d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_handle_f1b58fd823ec6c12>>();
+	};
+		// test_delete_handle_array_80c1489fc98dc271
+		aotLib[0x35fe535f5e0a8972] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_handle_array_80c1489fc98dc271>>();
+	};
+		// test_delete_string_2e6c15be80f16e39
+		aotLib[0xb1f577ffb7ca6c11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_string_2e6c15be80f16e39>>();
+	};
+		// test_delete_string_array_8a039d62a78818db
+		aotLib[0x6193977615bc32d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_string_array_8a039d62a78818db>>();
+	};
+		// test_delete_struct_ae05232a66708431
+		aotLib[0x3b26617b38be0b78] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_ae05232a66708431>>();
+	};
+		// test_delete_struct_array_41989b6d0e9e3437
+		aotLib[0xe72a286003ce1902] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_array_41989b6d0e9e3437>>();
+	};
+		// test_delete_struct_array_in_scope_f1b7a770ffda82d4
+		aotLib[0x7756b28cd118153c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_struct_array_in_scope_f1b7a770ffda82d4>>();
+	};
+		// test_delete_table_9c6062658487bafd
+		aotLib[0x42169f3d4daa6a27] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_delete_table_9c6062658487bafd>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
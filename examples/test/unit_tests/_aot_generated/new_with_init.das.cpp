@@ -0,0 +1,189 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Ball {
+	float3 center;
+	float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+
+inline Ball Ball_e76ef1e330fbd908 ( Context * __context__ );
+inline Ball Ball_b79c6970531e5762 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 );
+inline void _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d ( Context * __context__, TDim<Ball *,3> & __a_rename_at_178 );
+inline void finalize_8bb6856c5c39ef35 ( Context * __context__, Ball * & ____this_rename_at_182 );
+inline void finalize_9bf481eba8828170 ( Context * __context__, Ball & ____this_rename_at_3 );
+inline bool test_3b5e9c1206274639 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Ball Ball_e76ef1e330fbd908 ( Context * __context__ )
+{
+	return das_auto_cast<Ball>::cast((([&]() -> Ball {
+		Ball __mks_3;
+		das_copy((__mks_3.center),(v_make_vec4f(7.f,8.f,9.f,0.f)));
+		das_copy((__mks_3.radius),(1.23399997f));
+		return __mks_3;
+	})()));
+}
+
+inline Ball Ball_b79c6970531e5762 ( Context * __context__, float3 __center_rename_at_7, float __radius_rename_at_7 )
+{
+	Ball __b_rename_at_8; das_zero(__b_rename_at_8);
+	das_copy(__b_rename_at_8.center,__center_rename_at_7);
+	das_copy(__b_rename_at_8.radius,__radius_rename_at_7);
+	return das_auto_cast<Ball>::cast(__b_rename_at_8);
+}
+
+inline void _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d ( Context * __context__, TDim<Ball *,3> &  __a_rename_at_178 )
+{
+	{
+		bool __need_loop_180 = true;
+		// aV : Ball? aka TT&
+		das_iterator<TDim<Ball *,3>> __aV_iterator(__a_rename_at_178);
+		Ball * * __aV_rename_at_180;
+		__need_loop_180 = __aV_iterator.first(__context__,(__aV_rename_at_180)) && __need_loop_180;
+		for ( ; __need_loop_180 ; __need_loop_180 = __aV_iterator.next(__context__,(__aV_rename_at_180)) )
+		{
+			finalize_8bb6856c5c39ef35(__context__,(*__aV_rename_at_180));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_180));
+	};
+}
+
+inline void finalize_8bb6856c5c39ef35 ( Context * __context__, Ball * & ____this_rename_at_182 )
+{
+	if ( ____this_rename_at_182 != nullptr )
+	{
+		finalize_9bf481eba8828170(__context__,das_arg<Ball>::pass(das_deref(__context__,____this_rename_at_182)));
+		das_delete<Ball *>::clear(__context__,____this_rename_at_182);
+		das_copy(____this_rename_at_182,nullptr);
+	};
+}
+
+inline void finalize_9bf481eba8828170 ( Context * __context__, Ball &  ____this_rename_at_3 )
+{
+	memset(&(____this_rename_at_3), 0, 16);
+}
+
+inline bool test_3b5e9c1206274639 ( Context * __context__ )
+{
+	Ball * __b0_rename_at_15; memset(&__b0_rename_at_15,0,sizeof(__b0_rename_at_15));
+	Ball * __b1_rename_at_17; memset(&__b1_rename_at_17,0,sizeof(__b1_rename_at_17));
+	Ball * __b2_rename_at_19; memset(&__b2_rename_at_19,0,sizeof(__b2_rename_at_19));
+	TDim<Ball *,3> __b3_rename_at_21; memset(&__b3_rename_at_21,0,sizeof(__b3_rename_at_21));
+	Ball _temp_new_15_48;
+	Ball _temp_new_17_80;
+	Ball _temp_new_19_112;
+/* finally */ auto __finally_15= das_finally([&](){
+	das_copy(__b0_rename_at_15,nullptr);
+	das_copy(__b1_rename_at_17,nullptr);
+	das_copy(__b2_rename_at_19,nullptr);
+	_Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d(__context__,das_arg<TDim<Ball *,3>>::pass(__b3_rename_at_21));
+/* end finally */ });
+	__b0_rename_at_15 = das_new_on_stack<Ball>::make(_temp_new_15_48);
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b0_rename_at_15->center,v_zero(),*__context__)) && (__b0_rename_at_15->radius == 0.f)));
+	__b1_rename_at_17 = das_new_on_stack<Ball>::make_and_init(_temp_new_17_80,[&]() { return Ball_e76ef1e330fbd908(__context__); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b1_rename_at_17->center,v_make_vec4f(7.f,8.f,9.f,0.f),*__context__)) && (__b1_rename_at_17->radius == 1.23399997f)));
+	__b2_rename_at_19 = das_new_on_stack<Ball>::make_and_init(_temp_new_19_112,[&]() { return Ball_b79c6970531e5762(__context__,v_make_vec4f(1.f,2.f,3.f,0.f),4.f); });
+	DAS_ASSERT(((SimPolicy<float3>::Equ(__b2_rename_at_19->center,v_make_vec4f(1.f,2.f,3.f,0.f),*__context__)) && (__b2_rename_at_19->radius == 4.f)));
+	__b3_rename_at_21 = das_new_dim<Ball,3>::make_and_init(__context__,[&]() { return Ball_b79c6970531e5762(__context__,v_make_vec4f(3.f,2.f,1.f,0.f),0.5f); });
+	{
+		bool __need_loop_22 = true;
+		// b : Ball?&
+		das_iterator<TDim<Ball *,3>> __b_iterator(__b3_rename_at_21);
+		Ball * * __b_rename_at_22;
+		__need_loop_22 = __b_iterator.first(__context__,(__b_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __b_iterator.next(__context__,(__b_rename_at_22)) )
+		{
+			DAS_ASSERT(((SimPolicy<float3>::Equ((*__b_rename_at_22)->center,v_make_vec4f(3.f,2.f,1.f,0.f),*__context__)) && ((*__b_rename_at_22)->radius == 0.5f)));
+		}
+		__b_iterator.close(__context__,(__b_rename_at_22));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Ball_e76ef1e330fbd908
+		aotLib[0x89093153ddb7e321] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Ball (*) ( Context * __context__ ),&Ball_e76ef1e330fbd908>>();
+	};
+		// Ball_b79c6970531e5762
+		aotLib[0xd91a127af5695425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Ball (*) ( Context * __context__, float3 , float  ),&Ball_b79c6970531e5762>>();
+	};
+		// _Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d
+		aotLib[0x3e3382cf05ec8a04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Ball *,3> &  ),&_Funcbuiltin_0x60_finalize_dim_1b70c1d46f9a784d>>();
+	};
+		// finalize_8bb6856c5c39ef35
+		aotLib[0xe82548dfa347e551] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Ball * &  ),&finalize_8bb6856c5c39ef35>>();
+	};
+		// finalize_9bf481eba8828170
+		aotLib[0x7e8060f091117e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Ball &  ),&finalize_9bf481eba8828170>>();
+	};
+		// test_3b5e9c1206274639
+		aotLib[0xf498050b9eee2449] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3b5e9c1206274639>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
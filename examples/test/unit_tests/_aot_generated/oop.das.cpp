@@ -0,0 +1,552 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__86738248;
+extern StructInfo __struct_info__b1589007;
+extern StructInfo __struct_info__4520029c;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__9fa6254c;
+extern TypeInfo __type_info__b6dbe858;
+extern TypeInfo __type_info__c7e1677;
+extern VarInfo __var_info__eedd2c27;
+extern VarInfo __var_info__a3802949;
+extern VarInfo __var_info__43cdea36;
+extern VarInfo __var_info__82e7b5f2;
+extern VarInfo __var_info__cc67c2f8;
+extern VarInfo __var_info__3b4f7d4f;
+extern VarInfo __var_info__4b2267d1;
+extern VarInfo __var_info__2811f5c3;
+extern VarInfo __var_info__60a506fb;
+extern VarInfo __var_info__341c5ca3;
+extern VarInfo __var_info__7688e974;
+extern VarInfo __var_info__eddd2a94;
+extern VarInfo __var_info__80e7b2cc;
+extern VarInfo __var_info__81e7b45f;
+extern VarInfo __var_info__e2a04d94;
+extern VarInfo __var_info__d2aa970e;
+
+VarInfo __struct_info__86738248_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2811f5c3, "__rtti", 0 };
+TypeInfo * __type_info__cc67c2f8_arg_types_var_2255716936[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__86738248_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__cc67c2f8_arg_types_var_2255716936, nullptr, 1, 0, nullptr, 28, 0xcc67c2f8, "__finalize", 8 };
+VarInfo __struct_info__86738248_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x80e7b2cc, "x", 12 };
+VarInfo __struct_info__86738248_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x81e7b45f, "y", 16 };
+TypeInfo * __type_info__e2a04d94_arg_types_var_2255716936[3] = { &__type_info__c7e1677, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__86738248_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e2a04d94_arg_types_var_2255716936, nullptr, 3, 0, nullptr, 28, 0xe2a04d94, "set", 20 };
+TypeInfo * __type_info__43cdea36_arg_types_var_2255716936[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__86738248_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__43cdea36_arg_types_var_2255716936, nullptr, 1, 0, nullptr, 28, 0x43cdea36, "ups", 24 };
+VarInfo __struct_info__86738248_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x82e7b5f2, "z", 28 };
+VarInfo * __struct_info__86738248_fields[7] =  { &__struct_info__86738248_field_0, &__struct_info__86738248_field_1, &__struct_info__86738248_field_2, &__struct_info__86738248_field_3, &__struct_info__86738248_field_4, &__struct_info__86738248_field_5, &__struct_info__86738248_field_6 };
+StructInfo __struct_info__86738248 = {"Foo3D", __struct_info__86738248_fields, 7, 32, 4, nullptr, 0x86738248 };
+VarInfo __struct_info__b1589007_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2aa970e, "__rtti", 0 };
+TypeInfo * __type_info__4b2267d1_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b2267d1_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x4b2267d1, "__finalize", 8 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeedd2c27, "x", 12 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeddd2a94, "y", 16 };
+TypeInfo * __type_info__341c5ca3_arg_types_var_2975371271[3] = { &__type_info__c7e1677, &__type_info__359c1b32, &__type_info__359c1b32 };
+VarInfo __struct_info__b1589007_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__341c5ca3_arg_types_var_2975371271, nullptr, 3, 0, nullptr, 28, 0x341c5ca3, "set", 20 };
+TypeInfo * __type_info__a3802949_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_5 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a3802949_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0xa3802949, "ups", 24 };
+VarInfo * __struct_info__b1589007_fields[6] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3, &__struct_info__b1589007_field_4, &__struct_info__b1589007_field_5 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 6, 32, 0, nullptr, 0xb1589007 };
+VarInfo __struct_info__4520029c_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3b4f7d4f, "__rtti", 0 };
+TypeInfo * __type_info__7688e974_arg_types_var_1159725724[1] = { &__type_info__9fa6254c };
+VarInfo __struct_info__4520029c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__7688e974_arg_types_var_1159725724, nullptr, 1, 0, nullptr, 28, 0x7688e974, "__finalize", 8 };
+VarInfo __struct_info__4520029c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x60a506fb, "a", 12 };
+VarInfo * __struct_info__4520029c_fields[3] =  { &__struct_info__4520029c_field_0, &__struct_info__4520029c_field_1, &__struct_info__4520029c_field_2 };
+StructInfo __struct_info__4520029c = {"Goo", __struct_info__4520029c_fields, 3, 16, 14, nullptr, 0x4520029c };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__9fa6254c = { Type::tStructure, &__struct_info__4520029c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0x9fa6254c };
+TypeInfo __type_info__b6dbe858 = { Type::tStructure, &__struct_info__86738248, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xb6dbe858 };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc7e1677 };
+
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo)) ups;
+};
+static_assert(sizeof(Foo)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,x)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,ups)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo)) ups;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,ups)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==28,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Goo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Goo)) __finalize;
+	int32_t a;
+};
+static_assert(sizeof(Goo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Goo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Goo,a)==12,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_fd4fb3bbd43ab687 ( Context * __context__ );
+inline Foo Foo_f54a4bcafa3750f0 ( Context * __context__, int32_t __T_rename_at_11 );
+inline Foo Foo_1bb531dee8e74196 ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x27___finalize_c93f38c839a2583c ( Context * __context__, Foo & __self_rename_at_7 );
+inline Foo3D Foo3D_5597919fcc8fb277 ( Context * __context__ );
+inline void _FuncFoo3D_0x27___finalize_9f4407a4348bdb18 ( Context * __context__, Foo3D & __self_rename_at_24 );
+inline void _FuncFoo3D_0x60_Foo3D_ab5ca8f888740193 ( Context * __context__, Foo3D & __self_rename_at_26 );
+inline void _FuncFoo3D_0x60_set_12314647337c4351 ( Context * __context__, Foo3D & __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 );
+inline void _FuncFoo3D_0x60_ups_9103702b4abe2cf0 ( Context * __context__, Foo3D & __self_rename_at_35 );
+inline void _FuncFoo_0x60_Foo_4be422c05b13d87 ( Context * __context__, Foo & __self_rename_at_9 );
+inline void _FuncFoo_0x60_Foo_7712902e71e743f2 ( Context * __context__, Foo & __self_rename_at_11, int32_t __T_rename_at_11 );
+inline void _FuncFoo_0x60_Foo_c50f5ba6b4548486 ( Context * __context__, Foo & __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 );
+inline void _FuncFoo_0x60_set_8b8955cc4af67406 ( Context * __context__, Foo & __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 );
+inline void _FuncFoo_0x60_ups_dab804dfedaa8a2b ( Context * __context__, Foo & __self_rename_at_18 );
+inline Goo Goo_f2f21e8e93f819cf ( Context * __context__ );
+inline void _FuncGoo_0x27___finalize_cbc569da25067792 ( Context * __context__, Goo & __self_rename_at_85 );
+inline void finalize_f1cbc6f82bda2a58 ( Context * __context__, Foo * & ____this_rename_at_74 );
+inline void finalize_1afc4e3960c16232 ( Context * __context__, Foo & __self_rename_at_21 );
+inline void finalize_5d7cb322dc29b25 ( Context * __context__, Foo3D & __self_rename_at_39 );
+inline void finalize_60a6a4dd6ca8bfe4 ( Context * __context__, Goo & ____this_rename_at_85 );
+inline bool test_359b249487062ce3 ( Context * __context__ );
+inline void test_foo_6f0fd7a603af9abe ( Context * __context__ );
+inline void test_foo_ptr_c1b7cf065d986e10 ( Context * __context__ );
+inline void test_rtti_28a9d8636cc59621 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x3d51f8f>(__context__) = 0;/*delFoo*/
+	das_global<int32_t,0x617e5018>(__context__) = 0;/*delFoo3D*/
+}
+
+inline Foo Foo_fd4fb3bbd43ab687 ( Context * __context__ )
+{
+	Foo __self_rename_at_9; das_zero(__self_rename_at_9); das_move(__self_rename_at_9, (([&]() -> Foo {
+		Foo __mks_9;
+		das_copy((__mks_9.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_9.x),(0));
+		das_copy((__mks_9.y),(0));
+		das_copy((__mks_9.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_9.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_9;
+	})()));
+	_FuncFoo_0x60_Foo_4be422c05b13d87(__context__,das_arg<Foo>::pass(__self_rename_at_9));
+	return /* <- */ das_auto_cast<Foo>::cast(__self_rename_at_9);
+}
+
+inline Foo Foo_f54a4bcafa3750f0 ( Context * __context__, int32_t __T_rename_at_11 )
+{
+	Foo __self_rename_at_11; das_zero(__self_rename_at_11); das_move(__self_rename_at_11, (([&]() -> Foo {
+		Foo __mks_11;
+		das_copy((__mks_11.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_11.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_11.x),(0));
+		das_copy((__mks_11.y),(0));
+		das_copy((__mks_11.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_11.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_11;
+	})()));
+	_FuncFoo_0x60_Foo_7712902e71e743f2(__context__,das_arg<Foo>::pass(__self_rename_at_11),__T_rename_at_11);
+	return /* <- */ das_auto_cast<Foo>::cast(__self_rename_at_11);
+}
+
+inline Foo Foo_1bb531dee8e74196 ( Context * __context__, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	Foo __self_rename_at_13; das_zero(__self_rename_at_13); das_move(__self_rename_at_13, (([&]() -> Foo {
+		Foo __mks_13;
+		das_copy((__mks_13.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_13.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_13.x),(0));
+		das_copy((__mks_13.y),(0));
+		das_copy((__mks_13.set),(Func(__context__->fnIdxByMangledName(/*Foo`set Foo int#const int#const*/ 2842315987u))));
+		das_copy((__mks_13.ups),(Func(__context__->fnIdxByMangledName(/*Foo`ups Foo*/ 3528142325u))));
+		return __mks_13;
+	})()));
+	_FuncFoo_0x60_Foo_c50f5ba6b4548486(__context__,das_arg<Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+	return /* <- */ das_auto_cast<Foo>::cast(__self_rename_at_13);
+}
+
+inline void _FuncFoo_0x27___finalize_c93f38c839a2583c ( Context * __context__, Foo &  __self_rename_at_7 )
+{
+	finalize_1afc4e3960c16232(__context__,das_arg<Foo>::pass(__self_rename_at_7));
+}
+
+inline Foo3D Foo3D_5597919fcc8fb277 ( Context * __context__ )
+{
+	Foo3D __self_rename_at_26; das_zero(__self_rename_at_26); das_move(__self_rename_at_26, (([&]() -> Foo3D {
+		Foo3D __mks_26;
+		das_copy((__mks_26.__rtti),(((void *)(&__type_info__b6dbe858))));
+		das_copy((__mks_26.__finalize),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D'__finalize Foo3D*/ 4170405874u)))));
+		das_copy((__mks_26.x),(0));
+		das_copy((__mks_26.y),(0));
+		das_copy((__mks_26.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D`set Foo3D int#const int#const*/ 433034575u)))));
+		das_copy((__mks_26.ups),(das_cast<Func DAS_COMMENT((void,Foo))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D`ups Foo3D*/ 3952054257u)))));
+		das_copy((__mks_26.z),(13));
+		return __mks_26;
+	})()));
+	_FuncFoo3D_0x60_Foo3D_ab5ca8f888740193(__context__,das_arg<Foo3D>::pass(__self_rename_at_26));
+	return /* <- */ das_auto_cast<Foo3D>::cast(__self_rename_at_26);
+}
+
+inline void _FuncFoo3D_0x27___finalize_9f4407a4348bdb18 ( Context * __context__, Foo3D &  __self_rename_at_24 )
+{
+	finalize_5d7cb322dc29b25(__context__,das_arg<Foo3D>::pass(__self_rename_at_24));
+}
+
+inline void _FuncFoo3D_0x60_Foo3D_ab5ca8f888740193 ( Context * __context__, Foo3D &  __self_rename_at_26 )
+{
+	DAS_ASSERT(((__self_rename_at_26.x == 0) && (__self_rename_at_26.y == 0)));
+	DAS_ASSERT((__self_rename_at_26.z == 13));
+	_FuncFoo_0x60_Foo_4be422c05b13d87(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_26)));
+	DAS_ASSERT(((__self_rename_at_26.x == 1) && (__self_rename_at_26.y == 1)));
+	das_copy(__self_rename_at_26.z,3);
+}
+
+inline void _FuncFoo3D_0x60_set_12314647337c4351 ( Context * __context__, Foo3D &  __self_rename_at_32, int32_t __X_rename_at_32, int32_t __Y_rename_at_32 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_reinterpret<Foo>::pass(das_arg<Foo3D>::pass(__self_rename_at_32)),__X_rename_at_32,__Y_rename_at_32);
+	das_copy(__self_rename_at_32.z,0);
+}
+
+inline void _FuncFoo3D_0x60_ups_9103702b4abe2cf0 ( Context * __context__, Foo3D &  __self_rename_at_35 )
+{
+	das_copy(__self_rename_at_35.x,-2);
+	das_copy(__self_rename_at_35.y,-2);
+	das_copy(__self_rename_at_35.z,-2);
+}
+
+inline void _FuncFoo_0x60_Foo_4be422c05b13d87 ( Context * __context__, Foo &  __self_rename_at_9 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_arg<Foo>::pass(__self_rename_at_9),1,1);
+}
+
+inline void _FuncFoo_0x60_Foo_7712902e71e743f2 ( Context * __context__, Foo &  __self_rename_at_11, int32_t __T_rename_at_11 )
+{
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__self_rename_at_11.set,das_arg<Foo>::pass(__self_rename_at_11),__T_rename_at_11,__T_rename_at_11);
+}
+
+inline void _FuncFoo_0x60_Foo_c50f5ba6b4548486 ( Context * __context__, Foo &  __self_rename_at_13, int32_t __X_rename_at_13, int32_t __Y_rename_at_13 )
+{
+	_FuncFoo_0x60_set_8b8955cc4af67406(__context__,das_arg<Foo>::pass(__self_rename_at_13),__X_rename_at_13,__Y_rename_at_13);
+}
+
+inline void _FuncFoo_0x60_set_8b8955cc4af67406 ( Context * __context__, Foo &  __self_rename_at_15, int32_t __X_rename_at_15, int32_t __Y_rename_at_15 )
+{
+	das_copy(__self_rename_at_15.x,__X_rename_at_15);
+	das_copy(__self_rename_at_15.y,__Y_rename_at_15);
+}
+
+inline void _FuncFoo_0x60_ups_dab804dfedaa8a2b ( Context * __context__, Foo &  __self_rename_at_18 )
+{
+	das_copy(__self_rename_at_18.x,-1);
+	das_copy(__self_rename_at_18.y,-1);
+}
+
+inline Goo Goo_f2f21e8e93f819cf ( Context * __context__ )
+{
+	return das_auto_cast<Goo>::cast((([&]() -> Goo {
+		Goo __mks_85;
+		das_zero(__mks_85);
+		das_copy((__mks_85.__rtti),(((void *)(&__type_info__9fa6254c))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnIdxByMangledName(/*Goo'__finalize Goo*/ 254725206u))));
+		return __mks_85;
+	})()));
+}
+
+inline void _FuncGoo_0x27___finalize_cbc569da25067792 ( Context * __context__, Goo &  __self_rename_at_85 )
+{
+	finalize_60a6a4dd6ca8bfe4(__context__,das_arg<Goo>::pass(__self_rename_at_85));
+}
+
+inline void finalize_f1cbc6f82bda2a58 ( Context * __context__, Foo * & ____this_rename_at_74 )
+{
+	if ( ____this_rename_at_74 != nullptr )
+	{
+		das_invoke_function<void>::invoke<Foo &>(__context__,____this_rename_at_74->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_74))));
+		das_delete<Foo *>::clear(__context__,____this_rename_at_74);
+		das_copy(____this_rename_at_74,nullptr);
+	};
+}
+
+inline void finalize_1afc4e3960c16232 ( Context * __context__, Foo &  __self_rename_at_21 )
+{
+	das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/++;
+}
+
+inline void finalize_5d7cb322dc29b25 ( Context * __context__, Foo3D &  __self_rename_at_39 )
+{
+	finalize_1afc4e3960c16232(__context__,das_arg<Foo>::pass(das_cast<Foo>::cast(__self_rename_at_39)));
+	das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/++;
+}
+
+inline void finalize_60a6a4dd6ca8bfe4 ( Context * __context__, Goo &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 16);
+}
+
+inline bool test_359b249487062ce3 ( Context * __context__ )
+{
+	test_foo_6f0fd7a603af9abe(__context__);
+	test_foo_ptr_c1b7cf065d986e10(__context__);
+	test_rtti_28a9d8636cc59621(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_foo_6f0fd7a603af9abe ( Context * __context__ )
+{
+	Foo __f_rename_at_45 = Foo_fd4fb3bbd43ab687(__context__);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 1)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f_rename_at_45.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_45)),1,2);
+	DAS_ASSERT(((__f_rename_at_45.x == 1) && (__f_rename_at_45.y == 2)));
+	das_copy(__f_rename_at_45,Foo_1bb531dee8e74196(__context__,11,12));
+	DAS_ASSERT(((__f_rename_at_45.x == 11) && (__f_rename_at_45.y == 12)));
+	das_copy(__f_rename_at_45,Foo_f54a4bcafa3750f0(__context__,13));
+	DAS_ASSERT(((__f_rename_at_45.x == 13) && (__f_rename_at_45.y == 13)));
+	Foo3D __f3d_rename_at_53 = Foo3D_5597919fcc8fb277(__context__);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 1)) && (__f3d_rename_at_53.z == 3)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_53.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_53)),1,2);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 1) && (__f3d_rename_at_53.y == 2)) && (__f3d_rename_at_53.z == 0)));
+	das_copy(__f3d_rename_at_53.z,13);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_53.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_53)),3,4);
+	DAS_ASSERT((((__f3d_rename_at_53.x == 3) && (__f3d_rename_at_53.y == 4)) && (__f3d_rename_at_53.z == 0)));
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 0)));
+	finalize_1afc4e3960c16232(__context__,das_arg<Foo>::pass(__f_rename_at_45));
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 0)));
+	finalize_5d7cb322dc29b25(__context__,das_arg<Foo3D>::pass(__f3d_rename_at_53));
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_foo_ptr_c1b7cf065d986e10 ( Context * __context__ )
+{
+	Foo * __f_rename_at_69 = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_fd4fb3bbd43ab687(__context__); });
+	das_invoke_function<void>::invoke<Foo &>(__context__,__f_rename_at_69->ups,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -1) && (__f_rename_at_69->y == -1)));
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 0) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 0)));
+	finalize_f1cbc6f82bda2a58(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 1) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 0)));
+	das_copy(__f_rename_at_69,das_cast<Foo *>::cast(das_new<Foo3D>::make_and_init(__context__,[&]() { return Foo3D_5597919fcc8fb277(__context__); })));
+	das_invoke_function<void>::invoke<Foo &>(__context__,__f_rename_at_69->ups,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__f_rename_at_69))));
+	DAS_ASSERT(((__f_rename_at_69->x == -2) && (__f_rename_at_69->y == -2)));
+	finalize_f1cbc6f82bda2a58(__context__,__f_rename_at_69);
+	DAS_ASSERT(((das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/ == 2) && (das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/ == 1)));
+	das_copy(das_global<int32_t,0x3d51f8f>(__context__) /*delFoo*/,0);
+	das_copy(das_global<int32_t,0x617e5018>(__context__) /*delFoo3D*/,0);
+}
+
+inline void test_rtti_28a9d8636cc59621 ( Context * __context__ )
+{
+	Goo __g_rename_at_90 = Goo_f2f21e8e93f819cf(__context__);
+	Foo __f_rename_at_91 = Foo_fd4fb3bbd43ab687(__context__);
+	Foo __f2_rename_at_92 = Foo_fd4fb3bbd43ab687(__context__);
+	Foo3D __f3d_rename_at_93 = Foo3D_5597919fcc8fb277(__context__);
+	Foo3D __f3d2_rename_at_94 = Foo3D_5597919fcc8fb277(__context__);
+	DAS_ASSERT((__f_rename_at_91.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti != __g_rename_at_90.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti == __f2_rename_at_92.__rtti));
+	DAS_ASSERT((__f3d_rename_at_93.__rtti == __f3d2_rename_at_94.__rtti));
+	DAS_ASSERT((__f_rename_at_91.__rtti != __f3d_rename_at_93.__rtti));
+	DAS_ASSERT((das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/) != das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/)));
+	DAS_ASSERT((das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/) != das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/)));
+	DAS_ASSERT((das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/) == das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f2_rename_at_92.__rtti)->structType /*structType*/)));
+	DAS_ASSERT((das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/) == das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d2_rename_at_94.__rtti)->structType /*structType*/)));
+	DAS_ASSERT((das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/) != das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/)));
+	DAS_VERIFY((isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((!isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((!isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((!isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((!isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/))));
+	DAS_VERIFY((!isCompatibleCast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/),das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f_rename_at_91.__rtti)->structType /*structType*/)->name /*name*/),cast<char *>::from(((char *) "Foo")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__f3d_rename_at_93.__rtti)->structType /*structType*/)->name /*name*/),cast<char *>::from(((char *) "Foo3D")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo *>::cast(__g_rename_at_90.__rtti)->structType /*structType*/)->name /*name*/),cast<char *>::from(((char *) "Goo")),*__context__)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_fd4fb3bbd43ab687
+		aotLib[0x2810f05673f6e852] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_fd4fb3bbd43ab687>>();
+	};
+		// Foo_f54a4bcafa3750f0
+		aotLib[0x5fdfa83e141ac8ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&Foo_f54a4bcafa3750f0>>();
+	};
+		// Foo_1bb531dee8e74196
+		aotLib[0xcec7d831bf4f4dc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t , int32_t  ),&Foo_1bb531dee8e74196>>();
+	};
+		// _FuncFoo_0x27___finalize_c93f38c839a2583c
+		aotLib[0x9a9218b01d44a70d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x27___finalize_c93f38c839a2583c>>();
+	};
+		// Foo3D_5597919fcc8fb277
+		aotLib[0xd5ce06a04d00ca4b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo3D (*) ( Context * __context__ ),&Foo3D_5597919fcc8fb277>>();
+	};
+		// _FuncFoo3D_0x27___finalize_9f4407a4348bdb18
+		aotLib[0xaa384eae5e6e175f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x27___finalize_9f4407a4348bdb18>>();
+	};
+		// _FuncFoo3D_0x60_Foo3D_ab5ca8f888740193
+		aotLib[0x6eb533e23c669452] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x60_Foo3D_ab5ca8f888740193>>();
+	};
+		// _FuncFoo3D_0x60_set_12314647337c4351
+		aotLib[0x703838b382dca298] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D & , int32_t , int32_t  ),&_FuncFoo3D_0x60_set_12314647337c4351>>();
+	};
+		// _FuncFoo3D_0x60_ups_9103702b4abe2cf0
+		aotLib[0xf52f5fb249887de9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&_FuncFoo3D_0x60_ups_9103702b4abe2cf0>>();
+	};
+		// _FuncFoo_0x60_Foo_4be422c05b13d87
+		aotLib[0x34910bbfc74711c0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_Foo_4be422c05b13d87>>();
+	};
+		// _FuncFoo_0x60_Foo_7712902e71e743f2
+		aotLib[0x4e8b557f35ab0169] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t  ),&_FuncFoo_0x60_Foo_7712902e71e743f2>>();
+	};
+		// _FuncFoo_0x60_Foo_c50f5ba6b4548486
+		aotLib[0xcd4dac13e0a77844] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_Foo_c50f5ba6b4548486>>();
+	};
+		// _FuncFoo_0x60_set_8b8955cc4af67406
+		aotLib[0x59d63465931801f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&_FuncFoo_0x60_set_8b8955cc4af67406>>();
+	};
+		// _FuncFoo_0x60_ups_dab804dfedaa8a2b
+		aotLib[0xbe385d6791889c41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_ups_dab804dfedaa8a2b>>();
+	};
+		// Goo_f2f21e8e93f819cf
+		aotLib[0xaa394c3bea97ade0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Goo (*) ( Context * __context__ ),&Goo_f2f21e8e93f819cf>>();
+	};
+		// _FuncGoo_0x27___finalize_cbc569da25067792
+		aotLib[0xdc93967fb1930e5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Goo &  ),&_FuncGoo_0x27___finalize_cbc569da25067792>>();
+	};
+		// finalize_f1cbc6f82bda2a58
+		aotLib[0x65ea1afbb573fd59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_f1cbc6f82bda2a58>>();
+	};
+		// finalize_1afc4e3960c16232
+		aotLib[0x35b483c0eb49d8b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_1afc4e3960c16232>>();
+	};
+		// finalize_5d7cb322dc29b25
+		aotLib[0x7ec6fa4b71933765] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D &  ),&finalize_5d7cb322dc29b25>>();
+	};
+		// finalize_60a6a4dd6ca8bfe4
+		aotLib[0xfe39d35a69e5d159] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Goo &  ),&finalize_60a6a4dd6ca8bfe4>>();
+	};
+		// test_359b249487062ce3
+		aotLib[0x617d953e2c4d1f2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_359b249487062ce3>>();
+	};
+		// test_foo_6f0fd7a603af9abe
+		aotLib[0x45c9f2ab869ff7df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_6f0fd7a603af9abe>>();
+	};
+		// test_foo_ptr_c1b7cf065d986e10
+		aotLib[0x162c6319d7c8f5df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_foo_ptr_c1b7cf065d986e10>>();
+	};
+		// test_rtti_28a9d8636cc59621
+		aotLib[0xc596060497466464] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_rtti_28a9d8636cc59621>>();
+	};
+		// [[ init script ]]
+		aotLib[0x94dd798912468f55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,146 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct iVec2 {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(iVec2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(iVec2,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(iVec2,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline iVec2 _FuncAdd_75dc72805e3b0422 ( Context * __context__, iVec2 const  & __a_rename_at_12, iVec2 const  & __b_rename_at_12 );
+inline iVec2 _FuncSub_45a6fad14a94e54c ( Context * __context__, iVec2 const  & __a_rename_at_9 );
+inline bool _FuncEquEqu_e8d765f88ae041c7 ( Context * __context__, iVec2 const  & __a_rename_at_15, iVec2 const  & __b_rename_at_15 );
+inline iVec2 iVec2_1ca1b0c15758bb51 ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 );
+inline bool test_b4ab9d27fe86dbb5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline iVec2 _FuncAdd_75dc72805e3b0422 ( Context * __context__, iVec2 const  &  __a_rename_at_12, iVec2 const  &  __b_rename_at_12 )
+{
+	return das_auto_cast<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_13;
+		das_copy((__mks_13.x),((__a_rename_at_12.x + __b_rename_at_12.x)));
+		das_copy((__mks_13.y),((__a_rename_at_12.y + __b_rename_at_12.y)));
+		return __mks_13;
+	})()));
+}
+
+inline iVec2 _FuncSub_45a6fad14a94e54c ( Context * __context__, iVec2 const  &  __a_rename_at_9 )
+{
+	return das_auto_cast<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_10;
+		das_copy((__mks_10.x),(-(__a_rename_at_9.x)));
+		das_copy((__mks_10.y),(-(__a_rename_at_9.y)));
+		return __mks_10;
+	})()));
+}
+
+inline bool _FuncEquEqu_e8d765f88ae041c7 ( Context * __context__, iVec2 const  &  __a_rename_at_15, iVec2 const  &  __b_rename_at_15 )
+{
+	return das_auto_cast<bool>::cast((__a_rename_at_15.x == __b_rename_at_15.x) && (__a_rename_at_15.y == __b_rename_at_15.y));
+}
+
+inline iVec2 iVec2_1ca1b0c15758bb51 ( Context * __context__, int32_t __X_rename_at_6, int32_t __Y_rename_at_6 )
+{
+	return das_auto_cast<iVec2>::cast((([&]() -> iVec2 {
+		iVec2 __mks_7;
+		das_copy((__mks_7.x),(__X_rename_at_6));
+		das_copy((__mks_7.y),(__Y_rename_at_6));
+		return __mks_7;
+	})()));
+}
+
+inline bool test_b4ab9d27fe86dbb5 ( Context * __context__ )
+{
+	iVec2 _temp_make_local_22_80;
+	iVec2 _temp_make_local_23_112;
+	iVec2 __a_rename_at_20_ConstRef = ((iVec2)iVec2_1ca1b0c15758bb51(__context__,4,5));
+	iVec2 const  & __a_rename_at_20 = __a_rename_at_20_ConstRef; ;
+	iVec2 __b_rename_at_21_ConstRef = ((iVec2)iVec2_1ca1b0c15758bb51(__context__,6,7));
+	iVec2 const  & __b_rename_at_21 = __b_rename_at_21_ConstRef; ;
+	DAS_ASSERT((_FuncEquEqu_e8d765f88ae041c7(__context__,das_arg<iVec2>::pass(_FuncSub_45a6fad14a94e54c(__context__,__a_rename_at_20)),das_arg<iVec2>::pass((_temp_make_local_22_80 = (iVec2_1ca1b0c15758bb51(__context__,-4,-5)))))));
+	DAS_ASSERT((_FuncEquEqu_e8d765f88ae041c7(__context__,das_arg<iVec2>::pass((_FuncAdd_75dc72805e3b0422(__context__,__a_rename_at_20,__b_rename_at_21))),das_arg<iVec2>::pass((_temp_make_local_23_112 = (iVec2_1ca1b0c15758bb51(__context__,10,12)))))));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncAdd_75dc72805e3b0422
+		aotLib[0xd200f568f33c5129] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, iVec2 const  & , iVec2 const  &  ),&_FuncAdd_75dc72805e3b0422>>();
+	};
+		// _FuncSub_45a6fad14a94e54c
+		aotLib[0x56569679f1b94055] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, iVec2 const  &  ),&_FuncSub_45a6fad14a94e54c>>();
+	};
+		// _FuncEquEqu_e8d765f88ae041c7
+		aotLib[0x3b6c832154cae115] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, iVec2 const  & , iVec2 const  &  ),&_FuncEquEqu_e8d765f88ae041c7>>();
+	};
+		// iVec2_1ca1b0c15758bb51
+		aotLib[0x29a4cea661b1c805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<iVec2 (*) ( Context * __context__, int32_t , int32_t  ),&iVec2_1ca1b0c15758bb51>>();
+	};
+		// test_b4ab9d27fe86dbb5
+		aotLib[0xf91db78e4e28a7df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b4ab9d27fe86dbb5>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,184 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,set2)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Foo3D {
+	int32_t x;
+	int32_t y;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set;
+	Func DAS_COMMENT((void,Foo,int32_t,int32_t)) set2;
+	int32_t z;
+};
+static_assert(sizeof(Foo3D)==20,"structure size mismatch with DAS");
+static_assert(offsetof(Foo3D,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,set2)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo3D,z)==16,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_3eb06196be6a7b9 ( Context * __context__ );
+inline Foo3D Foo3D_824a3805740e2d9a ( Context * __context__ );
+inline void Foo3D_setXY_cbc16d91a4bb57da ( Context * __context__, Foo3D & __that_rename_at_15, int32_t __x_rename_at_15, int32_t __y_rename_at_15 );
+inline void Foo3D_setXY2_5170d60842282e6c ( Context * __context__, Foo & ___that_rename_at_20, int32_t __x_rename_at_20, int32_t __y_rename_at_20 );
+inline void Foo_setXY_2efe8cad9c89e8be ( Context * __context__, Foo & __that_rename_at_6, int32_t __x_rename_at_6, int32_t __y_rename_at_6 );
+inline bool test_730b06a13b218052 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo Foo_3eb06196be6a7b9 ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_1;
+		das_copy((__mks_1.x),(0));
+		das_copy((__mks_1.y),(0));
+		das_copy((__mks_1.set),(Func(__context__->fnIdxByMangledName(/*Foo_setXY Foo int#const int#const*/ 3925568059u))));
+		das_copy((__mks_1.set2),(Func(__context__->fnIdxByMangledName(/*Foo_setXY Foo int#const int#const*/ 3925568059u))));
+		return __mks_1;
+	})()));
+}
+
+inline Foo3D Foo3D_824a3805740e2d9a ( Context * __context__ )
+{
+	return das_auto_cast<Foo3D>::cast((([&]() -> Foo3D {
+		Foo3D __mks_10;
+		das_copy((__mks_10.x),(0));
+		das_copy((__mks_10.y),(0));
+		das_copy((__mks_10.set),(das_cast<Func DAS_COMMENT((void,Foo,int32_t,int32_t))>::cast(Func(__context__->fnIdxByMangledName(/*Foo3D_setXY Foo3D int#const int#const*/ 4075504719u)))));
+		das_copy((__mks_10.set2),(Func(__context__->fnIdxByMangledName(/*Foo3D_setXY2 Foo int#const int#const*/ 2708978450u))));
+		das_copy((__mks_10.z),(3));
+		return __mks_10;
+	})()));
+}
+
+inline void Foo3D_setXY_cbc16d91a4bb57da ( Context * __context__, Foo3D &  __that_rename_at_15, int32_t __x_rename_at_15, int32_t __y_rename_at_15 )
+{
+	das_copy(__that_rename_at_15.x,__x_rename_at_15);
+	das_copy(__that_rename_at_15.y,__y_rename_at_15);
+	das_copy(__that_rename_at_15.z,0);
+}
+
+inline void Foo3D_setXY2_5170d60842282e6c ( Context * __context__, Foo &  ___that_rename_at_20, int32_t __x_rename_at_20, int32_t __y_rename_at_20 )
+{
+	Foo3D * __that_rename_at_22 = &(das_upcast<Foo3D &>::cast(___that_rename_at_20));
+	das_copy((*__that_rename_at_22).x,__x_rename_at_20);
+	das_copy((*__that_rename_at_22).y,__y_rename_at_20);
+	das_copy((*__that_rename_at_22).z,0);
+}
+
+inline void Foo_setXY_2efe8cad9c89e8be ( Context * __context__, Foo &  __that_rename_at_6, int32_t __x_rename_at_6, int32_t __y_rename_at_6 )
+{
+	das_copy(__that_rename_at_6.x,__x_rename_at_6);
+	das_copy(__that_rename_at_6.y,__y_rename_at_6);
+}
+
+inline bool test_730b06a13b218052 ( Context * __context__ )
+{
+	Foo __f_rename_at_29 = Foo_3eb06196be6a7b9(__context__);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f_rename_at_29.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f_rename_at_29)),1,2);
+	DAS_ASSERT(((__f_rename_at_29.x == 1) && (__f_rename_at_29.y == 2)));
+	Foo3D __f3d_rename_at_32 = Foo3D_824a3805740e2d9a(__context__);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 0) && (__f3d_rename_at_32.y == 0)) && (__f3d_rename_at_32.z == 3)));
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_32.set,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_32)),1,2);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 1) && (__f3d_rename_at_32.y == 2)) && (__f3d_rename_at_32.z == 0)));
+	das_copy(__f3d_rename_at_32.z,13);
+	das_invoke_function<void>::invoke<Foo &,int32_t,int32_t>(__context__,__f3d_rename_at_32.set2,das_arg<Foo>::pass(das_cast<Foo>::cast(__f3d_rename_at_32)),3,4);
+	DAS_ASSERT((((__f3d_rename_at_32.x == 3) && (__f3d_rename_at_32.y == 4)) && (__f3d_rename_at_32.z == 0)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_3eb06196be6a7b9
+		aotLib[0x7da57ea1445cedab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_3eb06196be6a7b9>>();
+	};
+		// Foo3D_824a3805740e2d9a
+		aotLib[0xe238642e5dcb539e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo3D (*) ( Context * __context__ ),&Foo3D_824a3805740e2d9a>>();
+	};
+		// Foo3D_setXY_cbc16d91a4bb57da
+		aotLib[0xe2b106b0bb750b41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo3D & , int32_t , int32_t  ),&Foo3D_setXY_cbc16d91a4bb57da>>();
+	};
+		// Foo3D_setXY2_5170d60842282e6c
+		aotLib[0xb6dbc17e78896935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&Foo3D_setXY2_5170d60842282e6c>>();
+	};
+		// Foo_setXY_2efe8cad9c89e8be
+		aotLib[0x5c8b5f39369929fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t , int32_t  ),&Foo_setXY_2efe8cad9c89e8be>>();
+	};
+		// test_730b06a13b218052
+		aotLib[0x57aa0341ebba3658] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_730b06a13b218052>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,186 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__c7e1677;
+extern VarInfo __var_info__eb3ba694;
+extern VarInfo __var_info__4b2267d1;
+extern VarInfo __var_info__1d42b894;
+extern VarInfo __var_info__d2aa970e;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xd2aa970e, "__rtti", 0 };
+TypeInfo * __type_info__4b2267d1_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__4b2267d1_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x4b2267d1, "__finalize", 8 };
+VarInfo __struct_info__b1589007_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeb3ba694, "count", 12 };
+TypeInfo * __type_info__1d42b894_arg_types_var_2975371271[1] = { &__type_info__c7e1677 };
+VarInfo __struct_info__b1589007_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, (TypeInfo **)__type_info__1d42b894_arg_types_var_2975371271, nullptr, 1, 0, nullptr, 28, 0x1d42b894, "update", 16 };
+VarInfo * __struct_info__b1589007_fields[4] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1, &__struct_info__b1589007_field_2, &__struct_info__b1589007_field_3 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 4, 24, -1, nullptr, 0xb1589007 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__c7e1677 = { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 14, 0xc7e1677 };
+
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t count;
+	Func DAS_COMMENT((int32_t,Foo)) update;
+};
+static_assert(sizeof(Foo)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,count)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,update)==16,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_fd7bd6c443f8128a ( Context * __context__, int32_t __ic_rename_at_4 );
+inline void _FuncFoo_0x27___finalize_c93f38c839a2583c ( Context * __context__, Foo & __self_rename_at_2 );
+inline void _FuncFoo_0x60_Foo_6acfd015d371d6ae ( Context * __context__, Foo & __self_rename_at_4, int32_t __ic_rename_at_4 );
+inline int32_t _FuncFoo_0x60_update_3811993c030643d4 ( Context * __context__, Foo & __self_rename_at_6 );
+inline void finalize_efc42650906d0231 ( Context * __context__, Foo * & ____this_rename_at_15 );
+inline void finalize_8cd0234ad403daf9 ( Context * __context__, Foo & ____this_rename_at_2 );
+inline bool test_e96759b82713d489 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo Foo_fd7bd6c443f8128a ( Context * __context__, int32_t __ic_rename_at_4 )
+{
+	Foo __self_rename_at_4; das_zero(__self_rename_at_4); das_move(__self_rename_at_4, (([&]() -> Foo {
+		Foo __mks_4;
+		das_copy((__mks_4.__rtti),(((void *)(&__type_info__c7e1677))));
+		das_copy((__mks_4.__finalize),(Func(__context__->fnIdxByMangledName(/*Foo'__finalize Foo*/ 2693173404u))));
+		das_copy((__mks_4.count),(0));
+		das_copy((__mks_4.update),(Func(__context__->fnIdxByMangledName(/*Foo`update Foo*/ 4272897124u))));
+		return __mks_4;
+	})()));
+	_FuncFoo_0x60_Foo_6acfd015d371d6ae(__context__,das_arg<Foo>::pass(__self_rename_at_4),__ic_rename_at_4);
+	return /* <- */ das_auto_cast<Foo>::cast(__self_rename_at_4);
+}
+
+inline void _FuncFoo_0x27___finalize_c93f38c839a2583c ( Context * __context__, Foo &  __self_rename_at_2 )
+{
+	finalize_8cd0234ad403daf9(__context__,das_arg<Foo>::pass(__self_rename_at_2));
+}
+
+inline void _FuncFoo_0x60_Foo_6acfd015d371d6ae ( Context * __context__, Foo &  __self_rename_at_4, int32_t __ic_rename_at_4 )
+{
+	das_copy(__self_rename_at_4.count,__ic_rename_at_4);
+}
+
+inline int32_t _FuncFoo_0x60_update_3811993c030643d4 ( Context * __context__, Foo &  __self_rename_at_6 )
+{
+	return das_auto_cast<int32_t>::cast(__self_rename_at_6.count++);
+}
+
+inline void finalize_efc42650906d0231 ( Context * __context__, Foo * & ____this_rename_at_15 )
+{
+	if ( ____this_rename_at_15 != nullptr )
+	{
+		das_invoke_function<void>::invoke<Foo &>(__context__,____this_rename_at_15->__finalize,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,____this_rename_at_15))));
+		das_delete_persistent<Foo *>::clear(__context__,____this_rename_at_15);
+		das_copy(____this_rename_at_15,nullptr);
+	};
+}
+
+inline void finalize_8cd0234ad403daf9 ( Context * __context__, Foo &  ____this_rename_at_2 )
+{
+	memset(&(____this_rename_at_2), 0, 24);
+}
+
+inline bool test_e96759b82713d489 ( Context * __context__ )
+{
+	Foo * __pFoo_rename_at_11 = das_new_persistent<Foo>::make_and_init(__context__,[&]() { return Foo_fd7bd6c443f8128a(__context__,13); });
+	int32_t __up1_rename_at_12 = ((int32_t)das_invoke_function<int32_t>::invoke<Foo &>(__context__,__pFoo_rename_at_11->update,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_11)))));
+	int32_t __up2_rename_at_13 = ((int32_t)das_invoke_function<int32_t>::invoke<Foo &>(__context__,__pFoo_rename_at_11->update,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__pFoo_rename_at_11)))));
+	finalize_efc42650906d0231(__context__,__pFoo_rename_at_11);
+	DAS_ASSERT((__up1_rename_at_12 == 13));
+	DAS_ASSERT((__up2_rename_at_13 == 14));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_fd7bd6c443f8128a
+		aotLib[0xfa8c697ead2c3343] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&Foo_fd7bd6c443f8128a>>();
+	};
+		// _FuncFoo_0x27___finalize_c93f38c839a2583c
+		aotLib[0x6b521b44da45c11e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x27___finalize_c93f38c839a2583c>>();
+	};
+		// _FuncFoo_0x60_Foo_6acfd015d371d6ae
+		aotLib[0x9fe5d639da35f465] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , int32_t  ),&_FuncFoo_0x60_Foo_6acfd015d371d6ae>>();
+	};
+		// _FuncFoo_0x60_update_3811993c030643d4
+		aotLib[0x700a03976ed5d905] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_update_3811993c030643d4>>();
+	};
+		// finalize_efc42650906d0231
+		aotLib[0xf52a81c6e0b644d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo * &  ),&finalize_efc42650906d0231>>();
+	};
+		// finalize_8cd0234ad403daf9
+		aotLib[0x9f92853ded1d4035] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_8cd0234ad403daf9>>();
+	};
+		// test_e96759b82713d489
+		aotLib[0x45da9e6b70ff6021] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e96759b82713d489>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1791 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__2b09a353;
+extern StructInfo __struct_info__3009ab32;
+extern StructInfo __struct_info__3d7ecb6c;
+extern StructInfo __struct_info__15934ace;
+extern StructInfo __struct_info__407ed025;
+extern StructInfo __struct_info__1493493b;
+extern TypeInfo __type_info__9c561a5;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__7ec7955d;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__e03a3aba;
+extern TypeInfo __type_info__aea00813;
+extern TypeInfo __type_info__d40f0dc;
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__2c29f04d;
+extern TypeInfo __type_info__cd61852d;
+extern TypeInfo __type_info__575737dc;
+extern TypeInfo __type_info__c381edc3;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__e8c29053;
+extern TypeInfo __type_info__a0eb0f08;
+extern TypeInfo __type_info__6e8aa5b3;
+extern TypeInfo __type_info__100f1dc6;
+extern TypeInfo __type_info__e6eb6b88;
+extern TypeInfo __type_info__8e7f17a9;
+extern TypeInfo __type_info__56069e17;
+extern TypeInfo __type_info__e7206d7e;
+extern TypeInfo __type_info__e6206beb;
+extern TypeInfo __type_info__68f2d56;
+extern TypeInfo __type_info__cb9836a1;
+extern TypeInfo __type_info__c894953d;
+extern TypeInfo __type_info__ca618074;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__7324f8ca;
+extern TypeInfo __type_info__db3a32db;
+extern TypeInfo __type_info__5a573c95;
+extern TypeInfo __type_info__3d22364;
+extern TypeInfo __type_info__58f2bc3;
+extern TypeInfo __type_info__663fd2d4;
+extern TypeInfo __type_info__c881f5a2;
+extern VarInfo __var_info__2b7594bd;
+extern VarInfo __var_info__c1a95d01;
+extern VarInfo __var_info__e2514e05;
+extern VarInfo __var_info__a039d7eb;
+extern VarInfo __var_info__b6115ae0;
+extern VarInfo __var_info__8c4a890a;
+extern VarInfo __var_info__10d44c41;
+extern VarInfo __var_info__7154cc87;
+extern VarInfo __var_info__5178928f;
+extern VarInfo __var_info__ed623bed;
+extern VarInfo __var_info__feff3143;
+extern VarInfo __var_info__dddd3e62;
+extern VarInfo __var_info__a1e3f68;
+extern VarInfo __var_info__8db0dc5e;
+extern VarInfo __var_info__4f12e3ae;
+extern VarInfo __var_info__7dde88eb;
+extern VarInfo __var_info__cf42dc67;
+extern VarInfo __var_info__7044001a;
+extern VarInfo __var_info__3379f2c7;
+extern VarInfo __var_info__ab293dab;
+extern VarInfo __var_info__3620040a;
+extern VarInfo __var_info__3664fe46;
+extern VarInfo __var_info__ba2b3a7d;
+extern VarInfo __var_info__4deb618a;
+extern VarInfo __var_info__7f3b25cb;
+extern VarInfo __var_info__4b8c3384;
+extern VarInfo __var_info__42fe26e1;
+extern VarInfo __var_info__7f770846;
+extern VarInfo __var_info__6cb343b0;
+extern VarInfo __var_info__4c4c49b7;
+extern VarInfo __var_info__ea7e8fee;
+extern VarInfo __var_info__f78127fe;
+extern VarInfo __var_info__4e1f892f;
+extern VarInfo __var_info__d729e2fd;
+extern VarInfo __var_info__a3588266;
+extern VarInfo __var_info__2ec31aa9;
+extern VarInfo __var_info__7cbcba50;
+extern VarInfo __var_info__1cd55468;
+extern VarInfo __var_info__a616d5c4;
+extern VarInfo __var_info__2dfda414;
+extern VarInfo __var_info__bb4387fa;
+extern VarInfo __var_info__d894e611;
+extern VarInfo __var_info__c3768ca9;
+extern VarInfo __var_info__e1c1105b;
+extern VarInfo __var_info__95aa5555;
+extern VarInfo __var_info__a6a38812;
+extern VarInfo __var_info__2c34f57d;
+extern VarInfo __var_info__88524621;
+extern VarInfo __var_info__3e3efc61;
+extern VarInfo __var_info__9b2c9a1e;
+extern VarInfo __var_info__9c5928ef;
+extern VarInfo __var_info__d87aea04;
+extern VarInfo __var_info__7c12ce3b;
+extern VarInfo __var_info__ff74ae8a;
+extern VarInfo __var_info__86f5f4ca;
+extern VarInfo __var_info__bbcafdfc;
+extern VarInfo __var_info__802775aa;
+extern VarInfo __var_info__3d40db8b;
+extern VarInfo __var_info__2238d8de;
+extern VarInfo __var_info__90a99b2d;
+extern VarInfo __var_info__a7c10f09;
+extern VarInfo __var_info__2dab8af1;
+extern VarInfo __var_info__4dea9484;
+extern FuncInfo __func_info__c0b09ef;
+extern FuncInfo __func_info__ec2debe4;
+extern FuncInfo __func_info__4ebfc4bc;
+extern FuncInfo __func_info__ba3c6604;
+extern FuncInfo __func_info__e9f8e4e0;
+extern FuncInfo __func_info__557a05a5;
+extern FuncInfo __func_info__597a616f;
+extern FuncInfo __func_info__ebc32020;
+extern FuncInfo __func_info__ed253861;
+extern FuncInfo __func_info__963b81b;
+
+TypeInfo * __type_info__6cb343b0_arg_types_var_722051923[2] = { &__type_info__c381edc3, &__type_info__56069e17 };
+VarInfo __struct_info__2b09a353_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__6cb343b0_arg_types_var_722051923, nullptr, 2, 0, nullptr, 28, 0x6cb343b0, "__lambda", 0 };
+TypeInfo * __type_info__95aa5555_arg_types_var_722051923[1] = { &__type_info__db3a32db };
+VarInfo __struct_info__2b09a353_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__95aa5555_arg_types_var_722051923, nullptr, 1, 0, nullptr, 28, 0x95aa5555, "__finalize", 4 };
+VarInfo __struct_info__2b09a353_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4b8c3384, "__yield", 8 };
+VarInfo __struct_info__2b09a353_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4e1f892f, "pinfo", 16 };
+VarInfo __struct_info__2b09a353_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x90a99b2d, "___loop_at_56_rename_at_56", 24 };
+VarInfo __struct_info__2b09a353_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x802775aa, "__index_rename_at_56", 28 };
+VarInfo __struct_info__2b09a353_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xed623bed, "___pvar_0_at_56_rename_at_56", 32 };
+VarInfo __struct_info__2b09a353_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0xa7c10f09, "___source_0_at_56_rename_at_56", 40 };
+VarInfo * __struct_info__2b09a353_fields[8] =  { &__struct_info__2b09a353_field_0, &__struct_info__2b09a353_field_1, &__struct_info__2b09a353_field_2, &__struct_info__2b09a353_field_3, &__struct_info__2b09a353_field_4, &__struct_info__2b09a353_field_5, &__struct_info__2b09a353_field_6, &__struct_info__2b09a353_field_7 };
+StructInfo __struct_info__2b09a353 = {"_lambda_thismodule_55_12_3", __struct_info__2b09a353_fields, 8, 48, -1, nullptr, 0x2b09a353 };
+TypeInfo * __type_info__9c5928ef_arg_types_var_805940018[2] = { &__type_info__c881f5a2, &__type_info__56069e17 };
+VarInfo __struct_info__3009ab32_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__9c5928ef_arg_types_var_805940018, nullptr, 2, 0, nullptr, 28, 0x9c5928ef, "__lambda", 0 };
+TypeInfo * __type_info__a3588266_arg_types_var_805940018[1] = { &__type_info__e03a3aba };
+VarInfo __struct_info__3009ab32_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__a3588266_arg_types_var_805940018, nullptr, 1, 0, nullptr, 28, 0xa3588266, "__finalize", 4 };
+VarInfo __struct_info__3009ab32_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xba2b3a7d, "__yield", 8 };
+VarInfo __struct_info__3009ab32_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7324f8ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x8c4a890a, "pinfo", 16 };
+VarInfo __struct_info__3009ab32_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbb4387fa, "___loop_at_56_rename_at_56", 24 };
+VarInfo __struct_info__3009ab32_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc1a95d01, "__index_rename_at_56", 28 };
+VarInfo __struct_info__3009ab32_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x3620040a, "___pvar_0_at_56_rename_at_56", 32 };
+VarInfo __struct_info__3009ab32_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x7f770846, "___source_0_at_56_rename_at_56", 40 };
+VarInfo * __struct_info__3009ab32_fields[8] =  { &__struct_info__3009ab32_field_0, &__struct_info__3009ab32_field_1, &__struct_info__3009ab32_field_2, &__struct_info__3009ab32_field_3, &__struct_info__3009ab32_field_4, &__struct_info__3009ab32_field_5, &__struct_info__3009ab32_field_6, &__struct_info__3009ab32_field_7 };
+StructInfo __struct_info__3009ab32 = {"_lambda_thismodule_55_12_4", __struct_info__3009ab32_fields, 8, 48, -1, nullptr, 0x3009ab32 };
+TypeInfo * __type_info__2c34f57d_arg_types_var_1031719788[2] = { &__type_info__575737dc, &__type_info__e6eb6b88 };
+VarInfo __struct_info__3d7ecb6c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__2c34f57d_arg_types_var_1031719788, nullptr, 2, 0, nullptr, 28, 0x2c34f57d, "__lambda", 0 };
+TypeInfo * __type_info__d87aea04_arg_types_var_1031719788[1] = { &__type_info__ca618074 };
+VarInfo __struct_info__3d7ecb6c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__d87aea04_arg_types_var_1031719788, nullptr, 1, 0, nullptr, 28, 0xd87aea04, "__finalize", 4 };
+VarInfo __struct_info__3d7ecb6c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x7dde88eb, "__yield", 8 };
+VarInfo __struct_info__3d7ecb6c_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7324f8ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2dfda414, "pinfo", 16 };
+VarInfo __struct_info__3d7ecb6c_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3664fe46, "_loop_at_40", 24 };
+VarInfo __struct_info__3d7ecb6c_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa616d5c4, "index", 28 };
+VarInfo __struct_info__3d7ecb6c_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x4f12e3ae, "_pvar_0_at_40", 32 };
+VarInfo __struct_info__3d7ecb6c_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x7044001a, "_source_0_at_40", 40 };
+VarInfo * __struct_info__3d7ecb6c_fields[8] =  { &__struct_info__3d7ecb6c_field_0, &__struct_info__3d7ecb6c_field_1, &__struct_info__3d7ecb6c_field_2, &__struct_info__3d7ecb6c_field_3, &__struct_info__3d7ecb6c_field_4, &__struct_info__3d7ecb6c_field_5, &__struct_info__3d7ecb6c_field_6, &__struct_info__3d7ecb6c_field_7 };
+StructInfo __struct_info__3d7ecb6c = {"_lambda_thismodule_40_21_6", __struct_info__3d7ecb6c_fields, 8, 48, -1, nullptr, 0x3d7ecb6c };
+TypeInfo * __type_info__a039d7eb_arg_types_var_361974478[2] = { &__type_info__e7206d7e, &__type_info__100f1dc6 };
+VarInfo __struct_info__15934ace_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a039d7eb_arg_types_var_361974478, nullptr, 2, 0, nullptr, 28, 0xa039d7eb, "__lambda", 0 };
+TypeInfo * __type_info__86f5f4ca_arg_types_var_361974478[1] = { &__type_info__68f2d56 };
+VarInfo __struct_info__15934ace_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__86f5f4ca_arg_types_var_361974478, nullptr, 1, 0, nullptr, 28, 0x86f5f4ca, "__finalize", 4 };
+VarInfo __struct_info__15934ace_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x10d44c41, "__yield", 8 };
+VarInfo __struct_info__15934ace_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2238d8de, "pinfo", 16 };
+VarInfo __struct_info__15934ace_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb6115ae0, "___loop_at_75_rename_at_75", 24 };
+VarInfo __struct_info__15934ace_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xdddd3e62, "__index_rename_at_75", 28 };
+VarInfo __struct_info__15934ace_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa1e3f68, "___pvar_0_at_75_rename_at_75", 32 };
+VarInfo __struct_info__15934ace_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4dea9484, "___source_0_at_75_rename_at_75", 40 };
+VarInfo * __struct_info__15934ace_fields[8] =  { &__struct_info__15934ace_field_0, &__struct_info__15934ace_field_1, &__struct_info__15934ace_field_2, &__struct_info__15934ace_field_3, &__struct_info__15934ace_field_4, &__struct_info__15934ace_field_5, &__struct_info__15934ace_field_6, &__struct_info__15934ace_field_7 };
+StructInfo __struct_info__15934ace = {"_lambda_thismodule_74_12_1", __struct_info__15934ace_fields, 8, 48, -1, nullptr, 0x15934ace };
+TypeInfo * __type_info__8db0dc5e_arg_types_var_1082052645[2] = { &__type_info__5a573c95, &__type_info__e6eb6b88 };
+VarInfo __struct_info__407ed025_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__8db0dc5e_arg_types_var_1082052645, nullptr, 2, 0, nullptr, 28, 0x8db0dc5e, "__lambda", 0 };
+TypeInfo * __type_info__e1c1105b_arg_types_var_1082052645[1] = { &__type_info__cd61852d };
+VarInfo __struct_info__407ed025_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__e1c1105b_arg_types_var_1082052645, nullptr, 1, 0, nullptr, 28, 0xe1c1105b, "__finalize", 4 };
+VarInfo __struct_info__407ed025_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x4deb618a, "__yield", 8 };
+VarInfo __struct_info__407ed025_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x42fe26e1, "pinfo", 16 };
+VarInfo __struct_info__407ed025_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xfeff3143, "_loop_at_40", 24 };
+VarInfo __struct_info__407ed025_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2ec31aa9, "index", 28 };
+VarInfo __struct_info__407ed025_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7c12ce3b, "_pvar_0_at_40", 32 };
+VarInfo __struct_info__407ed025_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4c4c49b7, "_source_0_at_40", 40 };
+VarInfo * __struct_info__407ed025_fields[8] =  { &__struct_info__407ed025_field_0, &__struct_info__407ed025_field_1, &__struct_info__407ed025_field_2, &__struct_info__407ed025_field_3, &__struct_info__407ed025_field_4, &__struct_info__407ed025_field_5, &__struct_info__407ed025_field_6, &__struct_info__407ed025_field_7 };
+StructInfo __struct_info__407ed025 = {"_lambda_thismodule_40_21_5", __struct_info__407ed025_fields, 8, 48, -1, nullptr, 0x407ed025 };
+TypeInfo * __type_info__1cd55468_arg_types_var_345196859[2] = { &__type_info__e6206beb, &__type_info__100f1dc6 };
+VarInfo __struct_info__1493493b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__1cd55468_arg_types_var_345196859, nullptr, 2, 0, nullptr, 28, 0x1cd55468, "__lambda", 0 };
+TypeInfo * __type_info__2b7594bd_arg_types_var_345196859[1] = { &__type_info__58f2bc3 };
+VarInfo __struct_info__1493493b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__2b7594bd_arg_types_var_345196859, nullptr, 1, 0, nullptr, 28, 0x2b7594bd, "__finalize", 4 };
+VarInfo __struct_info__1493493b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbbcafdfc, "__yield", 8 };
+VarInfo __struct_info__1493493b_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7324f8ca, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7154cc87, "pinfo", 16 };
+VarInfo __struct_info__1493493b_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xab293dab, "___loop_at_75_rename_at_75", 24 };
+VarInfo __struct_info__1493493b_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc3768ca9, "__index_rename_at_75", 28 };
+VarInfo __struct_info__1493493b_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x7f3b25cb, "___pvar_0_at_75_rename_at_75", 32 };
+VarInfo __struct_info__1493493b_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x3379f2c7, "___source_0_at_75_rename_at_75", 40 };
+VarInfo * __struct_info__1493493b_fields[8] =  { &__struct_info__1493493b_field_0, &__struct_info__1493493b_field_1, &__struct_info__1493493b_field_2, &__struct_info__1493493b_field_3, &__struct_info__1493493b_field_4, &__struct_info__1493493b_field_5, &__struct_info__1493493b_field_6, &__struct_info__1493493b_field_7 };
+StructInfo __struct_info__1493493b = {"_lambda_thismodule_74_12_2", __struct_info__1493493b_fields, 8, 48, -1, nullptr, 0x1493493b };
+VarInfo __func_info__c0b09ef_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::EnumInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x88524621, "einfo", 0 };
+VarInfo * __func_info__c0b09ef_fields[1] =  { &__func_info__c0b09ef_field_0 };
+FuncInfo __func_info__c0b09ef = {"invoke block<(einfo:rtti::EnumInfo const):void> const", "", __func_info__c0b09ef_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xc0b09ef, 0x0 };
+VarInfo __func_info__ec2debe4_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::FuncInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xd894e611, "finfo", 0 };
+VarInfo * __func_info__ec2debe4_fields[1] =  { &__func_info__ec2debe4_field_0 };
+FuncInfo __func_info__ec2debe4 = {"invoke block<(finfo:rtti::FuncInfo const):void> const", "", __func_info__ec2debe4_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xec2debe4, 0x0 };
+VarInfo __func_info__4ebfc4bc_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9c561a5, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2dab8af1, "mod", 0 };
+VarInfo * __func_info__4ebfc4bc_fields[1] =  { &__func_info__4ebfc4bc_field_0 };
+FuncInfo __func_info__4ebfc4bc = {"invoke block<(mod:rtti::Module?):void> const", "", __func_info__4ebfc4bc_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x4ebfc4bc, 0x0 };
+VarInfo __func_info__ba3c6604_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xd729e2fd, "ann", 0 };
+VarInfo __func_info__ba3c6604_field_1 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::AnnotationArguments"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x9b2c9a1e, "annArgs", 0 };
+VarInfo * __func_info__ba3c6604_fields[2] =  { &__func_info__ba3c6604_field_0, &__func_info__ba3c6604_field_1 };
+FuncInfo __func_info__ba3c6604 = {"invoke block<(ann:rtti::Annotation const;annArgs:rtti::AnnotationArguments const):void> const", "", __func_info__ba3c6604_fields, 2, 32, &__type_info__48b5725f, nullptr,0,0xba3c6604, 0x0 };
+VarInfo __func_info__e9f8e4e0_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7cbcba50, "vinfo", 0 };
+VarInfo * __func_info__e9f8e4e0_fields[1] =  { &__func_info__e9f8e4e0_field_0 };
+FuncInfo __func_info__e9f8e4e0 = {"invoke block<(vinfo:rtti::VarInfo const):void> const", "", __func_info__e9f8e4e0_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xe9f8e4e0, 0x0 };
+VarInfo __func_info__557a05a5_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x3d40db8b, "name", 0 };
+VarInfo __func_info__557a05a5_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0xea7e8fee, "cppName", 0 };
+VarInfo __func_info__557a05a5_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x3e3efc61, "xtype", 0 };
+VarInfo __func_info__557a05a5_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6a38812, "offset", 0 };
+VarInfo * __func_info__557a05a5_fields[4] =  { &__func_info__557a05a5_field_0, &__func_info__557a05a5_field_1, &__func_info__557a05a5_field_2, &__func_info__557a05a5_field_3 };
+FuncInfo __func_info__557a05a5 = {"invoke block<(name:string;cppName:string;xtype:rtti::TypeInfo const;offset:uint):void> const", "", __func_info__557a05a5_fields, 4, 32, &__type_info__48b5725f, nullptr,0,0x557a05a5, 0x0 };
+VarInfo __func_info__597a616f_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Annotation"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xd729e2fd, "ann", 0 };
+VarInfo * __func_info__597a616f_fields[1] =  { &__func_info__597a616f_field_0 };
+FuncInfo __func_info__597a616f = {"invoke block<(ann:rtti::Annotation const):void> const", "", __func_info__597a616f_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x597a616f, 0x0 };
+VarInfo __func_info__ebc32020_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xf78127fe, "glob", 0 };
+VarInfo * __func_info__ebc32020_fields[1] =  { &__func_info__ebc32020_field_0 };
+FuncInfo __func_info__ebc32020 = {"invoke block<(glob:rtti::VarInfo const):void> const", "", __func_info__ebc32020_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xebc32020, 0x0 };
+VarInfo __func_info__ed253861_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::StructInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xcf42dc67, "sinfo", 0 };
+VarInfo * __func_info__ed253861_fields[1] =  { &__func_info__ed253861_field_0 };
+FuncInfo __func_info__ed253861 = {"invoke block<(sinfo:rtti::StructInfo const):void> const", "", __func_info__ed253861_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xed253861, 0x0 };
+VarInfo __func_info__963b81b_field_0 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xe2514e05, "ok", 0 };
+VarInfo __func_info__963b81b_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6e8aa5b3, nullptr, nullptr, nullptr, 0, 0, nullptr, 1024, 0x5178928f, "prog", 0 };
+VarInfo __func_info__963b81b_field_2 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xff74ae8a, "errors", 0 };
+VarInfo * __func_info__963b81b_fields[3] =  { &__func_info__963b81b_field_0, &__func_info__963b81b_field_1, &__func_info__963b81b_field_2 };
+FuncInfo __func_info__963b81b = {"invoke block<(ok:bool;prog:smart_ptr<rtti::Program>;errors:$::das_string const):void> const", "", __func_info__963b81b_fields, 3, 32, &__type_info__48b5725f, nullptr,0,0x963b81b, 0x0 };
+TypeInfo __type_info__9c561a5 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Module"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x9c561a5 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__7ec7955d = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7ec7955d };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__e03a3aba = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c881f5a2, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xe03a3aba };
+TypeInfo __type_info__aea00813 = { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xaea00813 };
+TypeInfo * __type_info__d40f0dc_arg_types[9] = { &__type_info__c894953d, &__type_info__95e97e5e, &__type_info__cb9836a1, &__type_info__3d22364, &__type_info__aea00813, &__type_info__a6c45d85, &__type_info__a0eb0f08, &__type_info__17c16538, &__type_info__2c29f04d };
+const char * __type_info__d40f0dc_arg_names[9] = { "tBool", "tInt", "tUInt", "tInt64", "tUInt64", "tFloat", "tDouble", "tString", "nothing" };
+TypeInfo __type_info__d40f0dc = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__d40f0dc_arg_types, (char **)__type_info__d40f0dc_arg_names, 9, 0, nullptr, 38, 0xd40f0dc };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__2c29f04d = { Type::anyArgument, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x2c29f04d };
+TypeInfo __type_info__cd61852d = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__5a573c95, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xcd61852d };
+TypeInfo __type_info__575737dc = { Type::tStructure, &__struct_info__3d7ecb6c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x575737dc };
+TypeInfo __type_info__c381edc3 = { Type::tStructure, &__struct_info__2b09a353, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xc381edc3 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__e8c29053 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"$::das_string"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 290, 0xe8c29053 };
+TypeInfo __type_info__a0eb0f08 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa0eb0f08 };
+TypeInfo __type_info__6e8aa5b3 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::Program"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0x6e8aa5b3 };
+TypeInfo __type_info__100f1dc6 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 261, 0x100f1dc6 };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xe6eb6b88 };
+TypeInfo __type_info__8e7f17a9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x8e7f17a9 };
+TypeInfo __type_info__56069e17 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x56069e17 };
+TypeInfo __type_info__e7206d7e = { Type::tStructure, &__struct_info__15934ace, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xe7206d7e };
+TypeInfo __type_info__e6206beb = { Type::tStructure, &__struct_info__1493493b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xe6206beb };
+TypeInfo __type_info__68f2d56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e7206d7e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x68f2d56 };
+TypeInfo __type_info__cb9836a1 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xcb9836a1 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+TypeInfo __type_info__ca618074 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__575737dc, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xca618074 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+TypeInfo __type_info__7324f8ca = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::VarInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x7324f8ca };
+TypeInfo __type_info__db3a32db = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c381edc3, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xdb3a32db };
+TypeInfo __type_info__5a573c95 = { Type::tStructure, &__struct_info__407ed025, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0x5a573c95 };
+TypeInfo __type_info__3d22364 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3d22364 };
+TypeInfo __type_info__58f2bc3 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e6206beb, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x58f2bc3 };
+TypeInfo __type_info__663fd2d4 = { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x663fd2d4 };
+TypeInfo __type_info__c881f5a2 = { Type::tStructure, &__struct_info__3009ab32, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xc881f5a2 };
+
+TypeInfo * __tinfo_0[7] = { &__type_info__3ffbf730, &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__359c1b32, &__type_info__3ffbf730, &__type_info__e8c29053, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[9] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__cb9836a1, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_2[4] = { &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__e8c29053, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_3[2] = { &__type_info__e8c29053, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_4[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[5] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__663fd2d4, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_7[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_8[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_9[2] = { &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_10[2] = { &__type_info__e8c29053, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_11[5] = { &__type_info__3ffbf730, &__type_info__e8c29053, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_12[3] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_13[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_14[3] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_15[5] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_16[3] = { &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_17[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_18[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_19[3] = { &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_20[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_21[3] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_22[5] = { &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_23[3] = { &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__17c16538 };
+TypeInfo * __tinfo_24[2] = { &__type_info__17c16538, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_25[1] = { &__type_info__17c16538 };
+TypeInfo * __tinfo_26[3] = { &__type_info__3ffbf730, &__type_info__95e97e5e, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_27[3] = { &__type_info__3ffbf730, &__type_info__d40f0dc, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_28[2] = { &__type_info__3ffbf730, &__type_info__d40f0dc };
+TypeInfo * __tinfo_29[6] = { &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__3ffbf730, &__type_info__17c16538, &__type_info__3ffbf730, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_30[3] = { &__type_info__3ffbf730, &__type_info__7ec7955d, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_31[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_32[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_33[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_34[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+#if 0 // external enum
+namespace rtti {
+
+enum class Type : int32_t {
+	none = int32_t(0ll),
+	autoinfer = int32_t(1ll),
+	alias = int32_t(2ll),
+	fakeContext = int32_t(3ll),
+	fakeLineInfo = int32_t(4ll),
+	anyArgument = int32_t(5ll),
+	tVoid = int32_t(6ll),
+	tBool = int32_t(7ll),
+	tInt64 = int32_t(12ll),
+	tUInt64 = int32_t(13ll),
+	tInt = int32_t(14ll),
+	tInt2 = int32_t(15ll),
+	tInt3 = int32_t(16ll),
+	tInt4 = int32_t(17ll),
+	tUInt = int32_t(18ll),
+	tUInt2 = int32_t(19ll),
+	tUInt3 = int32_t(20ll),
+	tUInt4 = int32_t(21ll),
+	tFloat = int32_t(22ll),
+	tFloat2 = int32_t(23ll),
+	tFloat3 = int32_t(24ll),
+	tFloat4 = int32_t(25ll),
+	tDouble = int32_t(26ll),
+	tRange = int32_t(27ll),
+	tURange = int32_t(28ll),
+	tString = int32_t(29ll),
+	tStructure = int32_t(30ll),
+	tHandle = int32_t(31ll),
+	tEnumeration = int32_t(32ll),
+	tPointer = int32_t(36ll),
+	tFunction = int32_t(37ll),
+	tLambda = int32_t(38ll),
+	tIterator = int32_t(39ll),
+	tArray = int32_t(40ll),
+	tTable = int32_t(41ll),
+	tBlock = int32_t(42ll),
+	tInt8 = int32_t(8ll),
+	tUInt8 = int32_t(9ll),
+	tInt16 = int32_t(10ll),
+	tUInt16 = int32_t(11ll),
+	tTuple = int32_t(43ll),
+	tEnumeration8 = int32_t(33ll),
+	tEnumeration16 = int32_t(34ll),
+	tVariant = int32_t(44ll),
+	tBitfield = int32_t(35ll),
+};
+}
+#endif // external enum
+namespace  {
+
+struct _lambda_thismodule_74_12_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_74_12_1,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_74_12_1 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_75_rename_at_75;
+	int32_t __index_rename_at_75;
+	void * ___pvar_0_at_75_rename_at_75;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_75_rename_at_75;
+};
+static_assert(sizeof(_lambda_thismodule_74_12_1)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___loop_at_75_rename_at_75)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__index_rename_at_75)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___pvar_0_at_75_rename_at_75)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___source_0_at_75_rename_at_75)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_74_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_74_12_2,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_74_12_2 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool ___loop_at_75_rename_at_75;
+	int32_t __index_rename_at_75;
+	void * ___pvar_0_at_75_rename_at_75;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_75_rename_at_75;
+};
+static_assert(sizeof(_lambda_thismodule_74_12_2)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,___loop_at_75_rename_at_75)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,__index_rename_at_75)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,___pvar_0_at_75_rename_at_75)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_2,___source_0_at_75_rename_at_75)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_55_12_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_55_12_3,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_55_12_3 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_56_rename_at_56;
+	int32_t __index_rename_at_56;
+	void * ___pvar_0_at_56_rename_at_56;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_56_rename_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_55_12_3)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,___loop_at_56_rename_at_56)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,__index_rename_at_56)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,___pvar_0_at_56_rename_at_56)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_3,___source_0_at_56_rename_at_56)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_55_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_55_12_4,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_55_12_4 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool ___loop_at_56_rename_at_56;
+	int32_t __index_rename_at_56;
+	void * ___pvar_0_at_56_rename_at_56;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_56_rename_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_55_12_4)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,___loop_at_56_rename_at_56)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,__index_rename_at_56)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,___pvar_0_at_56_rename_at_56)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_4,___source_0_at_56_rename_at_56)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_21_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_40_21_5,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_21_5 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool _loop_at_40;
+	int32_t index;
+	void * _pvar_0_at_40;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_40;
+};
+static_assert(sizeof(_lambda_thismodule_40_21_5)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_loop_at_40)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,index)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_pvar_0_at_40)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_5,_source_0_at_40)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_40_21_6 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_40_21_6,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_40_21_6 *)) __finalize;
+	int32_t __yield;
+	VarInfo const  * pinfo;
+	bool _loop_at_40;
+	int32_t index;
+	void * _pvar_0_at_40;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_40;
+};
+static_assert(sizeof(_lambda_thismodule_40_21_6)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_loop_at_40)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,index)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_pvar_0_at_40)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_40_21_6,_source_0_at_40)==40,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_40_21_5_0x60_finazlier_ec7f2013629b4a2c ( Context * __context__, _lambda_thismodule_40_21_5 * ____this_rename_at_40 );
+inline bool _Func_lambda_thismodule_40_21_5_0x60_function_b0228f9152abf913 ( Context * __context__, _lambda_thismodule_40_21_5 & ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 );
+inline void _Func_lambda_thismodule_40_21_6_0x60_finazlier_cf8b0d029d1af5a4 ( Context * __context__, _lambda_thismodule_40_21_6 * ____this_rename_at_40 );
+inline bool _Func_lambda_thismodule_40_21_6_0x60_function_b8c145552b11aa18 ( Context * __context__, _lambda_thismodule_40_21_6 & ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 );
+inline void _Func_lambda_thismodule_55_12_3_0x60_finazlier_9766ab41ef8ccc5c ( Context * __context__, _lambda_thismodule_55_12_3 * ____this_rename_at_55 );
+inline bool _Func_lambda_thismodule_55_12_3_0x60_function_6c8348c4e152d453 ( Context * __context__, _lambda_thismodule_55_12_3 & ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 );
+inline void _Func_lambda_thismodule_55_12_4_0x60_finazlier_1fc4ea681230208 ( Context * __context__, _lambda_thismodule_55_12_4 * ____this_rename_at_55 );
+inline bool _Func_lambda_thismodule_55_12_4_0x60_function_747b8060d71aa614 ( Context * __context__, _lambda_thismodule_55_12_4 & ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 );
+inline void _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c ( Context * __context__, _lambda_thismodule_74_12_1 * ____this_rename_at_74 );
+inline bool _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c ( Context * __context__, _lambda_thismodule_74_12_1 & ____this_rename_at_74, char * & ___yield_74_rename_at_74 );
+inline void _Func_lambda_thismodule_74_12_2_0x60_finazlier_aab6dfbb5d372ec0 ( Context * __context__, _lambda_thismodule_74_12_2 * ____this_rename_at_74 );
+inline bool _Func_lambda_thismodule_74_12_2_0x60_function_40b7da8d3ef62281 ( Context * __context__, _lambda_thismodule_74_12_2 & ____this_rename_at_74, char * & ___yield_74_rename_at_74 );
+inline void _Func_0x60_describeAnnotation_dc7909501fd7305 ( Context * __context__, Annotation const  & __ann_rename_at_124 );
+inline void _Func_0x60_describeEnumeration_525a761d4a1bf940 ( Context * __context__, EnumInfo const  & __einfo_rename_at_119 );
+inline void _Func_0x60_describeFunction_25eafb76e148367a ( Context * __context__, FuncInfo const  & __finfo_rename_at_90 );
+inline void _Func_0x60_describeModule_98b767f52c74e9d ( Context * __context__, Module * const  __mod_rename_at_138 );
+inline void _Func_0x60_describeStructure_3d47302c62ee2d58 ( Context * __context__, StructInfo const  & __sinfo_rename_at_110 );
+inline char * _Func_0x60_describeType_d6648b1475912757 ( Context * __context__, TypeInfo const  & __info_rename_at_41 );
+inline char * _Func_0x60_describeType_ed76972d72b6a5ab ( Context * __context__, VarInfo const  & __info_rename_at_41 );
+inline char * const  _Func_0x60_describeValue_d2d6042c1a290ea1 ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  & __value_rename_at_99 );
+inline void _Func_0x60_describeVariable_48283fbc1b51c97a ( Context * __context__, VarInfo const  & __glob_rename_at_107, char * const  __extra_rename_at_107 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_6d2711b060b71aa1 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_4748992c369f1a7c ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_269 );
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> & __Arr_rename_at_37, char * const  __value_rename_at_37 );
+inline void finalize_41f0bec1cd14be5f ( Context * __context__, _lambda_thismodule_40_21_5 & ____this_rename_at_40 );
+inline void finalize_9a9f01b879c5b9f6 ( Context * __context__, _lambda_thismodule_40_21_6 & ____this_rename_at_40 );
+inline void finalize_a5c05d4c8cadb389 ( Context * __context__, _lambda_thismodule_55_12_3 & ____this_rename_at_55 );
+inline void finalize_61c38349f85d7f0 ( Context * __context__, _lambda_thismodule_55_12_4 & ____this_rename_at_55 );
+inline void finalize_7e93fd9ea79f6880 ( Context * __context__, _lambda_thismodule_74_12_1 & ____this_rename_at_74 );
+inline void finalize_bd5fd3f70ffb2d0d ( Context * __context__, _lambda_thismodule_74_12_2 & ____this_rename_at_74 );
+inline bool main_fa999b8d2dc9e40 ( Context * __context__ );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_7639323bf0e4f38b ( Context * __context__, TypeInfo const  & __info_rename_at_81 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_d38fc7f4e2074135 ( Context * __context__, VarInfo const  & __info_rename_at_85 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_da36f3457c42fc56 ( Context * __context__, TypeInfo const  & __info_rename_at_70 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_8a0172397ee395dd ( Context * __context__, VarInfo const  & __info_rename_at_70 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_849db0d0a6905782 ( Context * __context__, TypeInfo const  & __info_rename_at_62 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_702f9b766fa955e8 ( Context * __context__, VarInfo const  & __info_rename_at_66 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_e2ec9a8f1f9d2401 ( Context * __context__, TypeInfo const  & __info_rename_at_51 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_546bdb6d20a295d8 ( Context * __context__, VarInfo const  & __info_rename_at_51 );
+inline void _Funcrtti_0x60_context_for_each_function_47f4c59689990846 ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  & __blk_rename_at_27 );
+inline void _Funcrtti_0x60_context_for_each_variable_f53c6c89f0e45ca7 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  & __blk_rename_at_32 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_be3d54e3fe706c9b ( Context * __context__, TypeInfo const  & __info_rename_at_43 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_1beed970fc78bc61 ( Context * __context__, VarInfo const  & __info_rename_at_47 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_39ccf77c474657a1 ( Context * __context__, TypeInfo const  & __info_rename_at_37 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_772788cb9d0fed6d ( Context * __context__, VarInfo const  & __info_rename_at_37 );
+inline void _Funcrtti_0x60_structure_for_each_annotation_b86774dc8ab73890 ( Context * __context__, StructInfo const  & __st_rename_at_9, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  & __subexpr_rename_at_9 );
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  & __it_rename_at_16, char * const  __separator_rename_at_16 );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0x8a980b68>(__context__) = ((char *) "\nrequire math\nrequire UnitTest\n\nlet\n    one_two = 12\n\nenum TestEnum\n    foo\n    bar\n\n[checkRange (foo=5)]\nstruct TestStruct\n    a : int = 5\n    b : string = \"something\"\n    c : float[3][4]\n    d : array<int>\n    e : table<float; string>\n    f : TestStruct?\n    g : tuple<int; float; string>\n    h : variant<i : int; f : float>\n    fn : function<(a:int;b:float):string>\n    lm : lambda<(a:int;b:float):string>\n\n[export]\ndef bar ( blk : block<(a:int):float> )\n    pass\n\n[export]\ndef main\n    print(\"hello world!\n\")\n    return true\n");/*sample*/
+}
+
+inline void _Func_lambda_thismodule_40_21_5_0x60_finazlier_ec7f2013629b4a2c ( Context * __context__, _lambda_thismodule_40_21_5 * ____this_rename_at_40 )
+{
+	finalize_41f0bec1cd14be5f(__context__,das_arg<_lambda_thismodule_40_21_5>::pass(das_deref(__context__,____this_rename_at_40)));
+	das_delete_lambda_struct<_lambda_thismodule_40_21_5 *>::clear(__context__,____this_rename_at_40);
+}
+
+inline bool _Func_lambda_thismodule_40_21_5_0x60_function_b0228f9152abf913 ( Context * __context__, _lambda_thismodule_40_21_5 &  ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_40_32;
+	switch (____this_rename_at_40.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_40._loop_at_40,true);
+	das_move(____this_rename_at_40._source_0_at_40,(_temp_make_local_40_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_40.pinfo->dimSize /*dimSize*/))))));
+	memset(&(____this_rename_at_40.index), 0, 4);
+	das_copy(____this_rename_at_40._pvar_0_at_40,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_40.index)));
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_40._loop_at_40 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_40_rename_at_40,rtti_getDimTypeInfo(das_deref(__context__,____this_rename_at_40.pinfo),____this_rename_at_40.index,__context__));
+	das_copy(____this_rename_at_40.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_40_21_6_0x60_finazlier_cf8b0d029d1af5a4 ( Context * __context__, _lambda_thismodule_40_21_6 * ____this_rename_at_40 )
+{
+	finalize_9a9f01b879c5b9f6(__context__,das_arg<_lambda_thismodule_40_21_6>::pass(das_deref(__context__,____this_rename_at_40)));
+	das_delete_lambda_struct<_lambda_thismodule_40_21_6 *>::clear(__context__,____this_rename_at_40);
+}
+
+inline bool _Func_lambda_thismodule_40_21_6_0x60_function_b8c145552b11aa18 ( Context * __context__, _lambda_thismodule_40_21_6 &  ____this_rename_at_40, int32_t & ___yield_40_rename_at_40 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_40_32;
+	switch (____this_rename_at_40.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_40._loop_at_40,true);
+	das_move(____this_rename_at_40._source_0_at_40,(_temp_make_local_40_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_40.pinfo->dimSize /*dimSize*/))))));
+	memset(&(____this_rename_at_40.index), 0, 4);
+	das_copy(____this_rename_at_40._pvar_0_at_40,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_40.index)));
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_40._loop_at_40 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_40_rename_at_40,rtti_getDimVarInfo(das_deref(__context__,____this_rename_at_40.pinfo),____this_rename_at_40.index,__context__));
+	das_copy(____this_rename_at_40.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_40._loop_at_40),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),____this_rename_at_40._pvar_0_at_40,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_55_12_3_0x60_finazlier_9766ab41ef8ccc5c ( Context * __context__, _lambda_thismodule_55_12_3 * ____this_rename_at_55 )
+{
+	finalize_a5c05d4c8cadb389(__context__,das_arg<_lambda_thismodule_55_12_3>::pass(das_deref(__context__,____this_rename_at_55)));
+	das_delete_lambda_struct<_lambda_thismodule_55_12_3 *>::clear(__context__,____this_rename_at_55);
+}
+
+inline bool _Func_lambda_thismodule_55_12_3_0x60_function_6c8348c4e152d453 ( Context * __context__, _lambda_thismodule_55_12_3 &  ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	switch (____this_rename_at_55.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_55.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_55.___loop_at_56_rename_at_56,true);
+	das_move(____this_rename_at_55.___source_0_at_56_rename_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_55.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_55.__index_rename_at_56), 0, 4);
+	das_copy(____this_rename_at_55.___pvar_0_at_56_rename_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_55.__index_rename_at_56)));
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_55.___loop_at_56_rename_at_56 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield55_rename_at_55,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_55.pinfo->argTypes /*argTypes*/,____this_rename_at_55.__index_rename_at_56,__context__))));
+	das_copy(____this_rename_at_55.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_55_12_4_0x60_finazlier_1fc4ea681230208 ( Context * __context__, _lambda_thismodule_55_12_4 * ____this_rename_at_55 )
+{
+	finalize_61c38349f85d7f0(__context__,das_arg<_lambda_thismodule_55_12_4>::pass(das_deref(__context__,____this_rename_at_55)));
+	das_delete_lambda_struct<_lambda_thismodule_55_12_4 *>::clear(__context__,____this_rename_at_55);
+}
+
+inline bool _Func_lambda_thismodule_55_12_4_0x60_function_747b8060d71aa614 ( Context * __context__, _lambda_thismodule_55_12_4 &  ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	switch (____this_rename_at_55.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_55.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_55.___loop_at_56_rename_at_56,true);
+	das_move(____this_rename_at_55.___source_0_at_56_rename_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_55.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_55.__index_rename_at_56), 0, 4);
+	das_copy(____this_rename_at_55.___pvar_0_at_56_rename_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_55.__index_rename_at_56)));
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_55.___loop_at_56_rename_at_56 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield55_rename_at_55,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_55.pinfo->argTypes /*argTypes*/,____this_rename_at_55.__index_rename_at_56,__context__))));
+	das_copy(____this_rename_at_55.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c ( Context * __context__, _lambda_thismodule_74_12_1 * ____this_rename_at_74 )
+{
+	finalize_7e93fd9ea79f6880(__context__,das_arg<_lambda_thismodule_74_12_1>::pass(das_deref(__context__,____this_rename_at_74)));
+	das_delete_lambda_struct<_lambda_thismodule_74_12_1 *>::clear(__context__,____this_rename_at_74);
+}
+
+inline bool _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c ( Context * __context__, _lambda_thismodule_74_12_1 &  ____this_rename_at_74, char * & ___yield_74_rename_at_74 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_75_32;
+	switch (____this_rename_at_74.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_74.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_74.___loop_at_75_rename_at_75,true);
+	das_move(____this_rename_at_74.___source_0_at_75_rename_at_75,(_temp_make_local_75_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_74.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_74.__index_rename_at_75), 0, 4);
+	das_copy(____this_rename_at_74.___pvar_0_at_75_rename_at_75,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_74.__index_rename_at_75)));
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_74.___loop_at_75_rename_at_75 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_74_rename_at_74,das_index<char * * const >::at(____this_rename_at_74.pinfo->argNames /*argNames*/,____this_rename_at_74.__index_rename_at_75,__context__));
+	das_copy(____this_rename_at_74.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_74_12_2_0x60_finazlier_aab6dfbb5d372ec0 ( Context * __context__, _lambda_thismodule_74_12_2 * ____this_rename_at_74 )
+{
+	finalize_bd5fd3f70ffb2d0d(__context__,das_arg<_lambda_thismodule_74_12_2>::pass(das_deref(__context__,____this_rename_at_74)));
+	das_delete_lambda_struct<_lambda_thismodule_74_12_2 *>::clear(__context__,____this_rename_at_74);
+}
+
+inline bool _Func_lambda_thismodule_74_12_2_0x60_function_40b7da8d3ef62281 ( Context * __context__, _lambda_thismodule_74_12_2 &  ____this_rename_at_74, char * & ___yield_74_rename_at_74 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_75_32;
+	switch (____this_rename_at_74.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_74.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_74.___loop_at_75_rename_at_75,true);
+	das_move(____this_rename_at_74.___source_0_at_75_rename_at_75,(_temp_make_local_75_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_74.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_74.__index_rename_at_75), 0, 4);
+	das_copy(____this_rename_at_74.___pvar_0_at_75_rename_at_75,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_74.__index_rename_at_75)));
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_74.___loop_at_75_rename_at_75 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_74_rename_at_74,das_index<char * * const >::at(____this_rename_at_74.pinfo->argNames /*argNames*/,____this_rename_at_74.__index_rename_at_75,__context__));
+	das_copy(____this_rename_at_74.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_0x60_describeAnnotation_dc7909501fd7305 ( Context * __context__, Annotation const  &  __ann_rename_at_124 ) { das_stack_prologue __prologue(__context__,128,"`describeAnnotation " DAS_FILE_LINE);
+{
+	if ( __ann_rename_at_124.rtti_isBasicStructureAnnotation() /*isBasicStructureAnnotation*/ )
+	{
+		BasicStructureAnnotation * __sann_rename_at_127 = ((BasicStructureAnnotation *)&(das_cast<BasicStructureAnnotation &>::cast(__ann_rename_at_124)));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<7>(__tinfo_0, cast<char * const >::from(((char *) "struct ")), cast<das::string const  &>::from((*__sann_rename_at_127).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<int32_t>::from((*__sann_rename_at_127).fieldCount() /*fieldCount*/), cast<char * const >::from(((char *) " ")), cast<das::string const  &>::from((*__sann_rename_at_127).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__);
+		rtti_builtin_basic_struct_for_each_field((*__sann_rename_at_127),das_make_block<void,char *,char *,TypeInfo const  &,uint32_t>(__context__,96,0,&__func_info__557a05a5,[&](char * __name_rename_at_129, char * __cppName_rename_at_129, TypeInfo const  & __xtype_rename_at_129, uint32_t __offset_rename_at_129)->void{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<9>(__tinfo_1, cast<char * const >::from(((char *) "\t")), cast<char *>::from(__name_rename_at_129), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,__xtype_rename_at_129)), cast<char * const >::from(((char *) " // ")), cast<char *>::from(__cppName_rename_at_129), cast<char * const >::from(((char *) " at ")), cast<uint32_t>::from(__offset_rename_at_129), cast<char * const >::from(((char *) "\n")))),__context__);
+		}),__context__);
+	} else if ( __ann_rename_at_124.rtti_isHandledTypeAnnotation() /*isTypeAnnotation*/ )
+	{
+		TypeAnnotation * __tann_rename_at_133 = ((TypeAnnotation *)&(das_cast<TypeAnnotation &>::cast(__ann_rename_at_124)));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<4>(__tinfo_2, cast<das::string const  &>::from((*__tann_rename_at_133).name /*name*/), cast<char * const >::from(((char *) " // ")), cast<das::string const  &>::from((*__tann_rename_at_133).cppName /*cppName*/), cast<char * const >::from(((char *) "\n")))),__context__);
+	} else {
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_3, cast<das::string const  &>::from(__ann_rename_at_124.name /*name*/), cast<char * const >::from(((char *) "\n")))),__context__);
+	};
+}}
+
+inline void _Func_0x60_describeEnumeration_525a761d4a1bf940 ( Context * __context__, EnumInfo const  &  __einfo_rename_at_119 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "enum ")), cast<char * const >::from(((char * const )(__einfo_rename_at_119.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	{
+		bool __need_loop_121 = true;
+		// eitem : rtti::EnumValueInfo const&
+		das_iterator<EnumInfo const > __eitem_iterator(__einfo_rename_at_119);
+		EnumValueInfo const  * __eitem_rename_at_121;
+		__need_loop_121 = __eitem_iterator.first(__context__,(__eitem_rename_at_121)) && __need_loop_121;
+		for ( ; __need_loop_121 ; __need_loop_121 = __eitem_iterator.next(__context__,(__eitem_rename_at_121)) )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_5, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(((char * const )((*__eitem_rename_at_121).name /*name*/))), cast<char * const >::from(((char *) " = ")), cast<int64_t>::from((*__eitem_rename_at_121).value /*value*/), cast<char * const >::from(((char *) "\n")))),__context__);
+		}
+		__eitem_iterator.close(__context__,(__eitem_rename_at_121));
+	};
+}
+
+inline void _Func_0x60_describeFunction_25eafb76e148367a ( Context * __context__, FuncInfo const  &  __finfo_rename_at_90 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_6, cast<char * const >::from(((char *) "def ")), cast<char * const >::from(((char * const )(__finfo_rename_at_90.name /*name*/))), cast<char * const >::from(((char *) " ")))),__context__);
+	if ( __finfo_rename_at_90.count /*count*/ != 0x0u )
+	{
+		char * __argT_rename_at_93 = ((char *)(char *)(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+			TArray<char *> ____acomp_93_rename_at_93; das_zero(____acomp_93_rename_at_93);
+			{
+				bool __need_loop_93 = true;
+				// arg : rtti::VarInfo const&
+				das_iterator<FuncInfo const > __arg_iterator(__finfo_rename_at_90);
+				VarInfo const  * __arg_rename_at_93;
+				__need_loop_93 = __arg_iterator.first(__context__,(__arg_rename_at_93)) && __need_loop_93;
+				for ( ; __need_loop_93 ; __need_loop_93 = __arg_iterator.next(__context__,(__arg_rename_at_93)) )
+				{
+					_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_93_rename_at_93),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_7, cast<char * const >::from(((char * const )((*__arg_rename_at_93).name /*name*/))), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_ed76972d72b6a5ab(__context__,(*__arg_rename_at_93))))));
+				}
+				__arg_iterator.close(__context__,(__arg_rename_at_93));
+			};
+			return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_93_rename_at_93);
+		})),((char *) "; "))));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_8, cast<char * const >::from(((char *) "( ")), cast<char * const >::from(__argT_rename_at_93), cast<char * const >::from(((char *) " ) ")))),__context__);
+	};
+	if ( __finfo_rename_at_90.result /*result*/ != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_9, cast<char * const >::from(((char *) ": ")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__finfo_rename_at_90.result /*result*/))))),__context__);
+	};
+	builtin_print(((char *) "\n"),__context__);
+}
+
+inline void _Func_0x60_describeModule_98b767f52c74e9d ( Context * __context__, Module * const  __mod_rename_at_138 ) { das_stack_prologue __prologue(__context__,416,"`describeModule " DAS_FILE_LINE);
+{
+	rtti_builtin_module_for_each_enumeration(__mod_rename_at_138,das_make_block<void,EnumInfo const  &>(__context__,80,0,&__func_info__c0b09ef,[&](EnumInfo const  & __einfo_rename_at_139)->void{
+		_Func_0x60_describeEnumeration_525a761d4a1bf940(__context__,__einfo_rename_at_139);
+	}),__context__);
+	rtti_builtin_module_for_each_structure(__mod_rename_at_138,das_make_block<void,StructInfo const  &>(__context__,144,0,&__func_info__ed253861,[&](StructInfo const  & __sinfo_rename_at_141)->void{
+		_Func_0x60_describeStructure_3d47302c62ee2d58(__context__,__sinfo_rename_at_141);
+	}),__context__);
+	rtti_builtin_module_for_each_annotation(__mod_rename_at_138,das_make_block<void,Annotation const  &>(__context__,208,0,&__func_info__597a616f,[&](Annotation const  & __ann_rename_at_143)->void{
+		_Func_0x60_describeAnnotation_dc7909501fd7305(__context__,__ann_rename_at_143);
+	}),__context__);
+	rtti_builtin_module_for_each_function(__mod_rename_at_138,das_make_block<void,FuncInfo const  &>(__context__,272,0,&__func_info__ec2debe4,[&](FuncInfo const  & __finfo_rename_at_145)->void{
+		_Func_0x60_describeFunction_25eafb76e148367a(__context__,__finfo_rename_at_145);
+	}),__context__);
+	rtti_builtin_module_for_each_generic(__mod_rename_at_138,das_make_block<void,FuncInfo const  &>(__context__,336,0,&__func_info__ec2debe4,[&](FuncInfo const  & __finfo_rename_at_147)->void{
+		_Func_0x60_describeFunction_25eafb76e148367a(__context__,__finfo_rename_at_147);
+	}),__context__);
+	rtti_builtin_module_for_each_global(__mod_rename_at_138,das_make_block<void,VarInfo const  &>(__context__,400,0,&__func_info__ebc32020,[&](VarInfo const  & __glob_rename_at_149)->void{
+		_Func_0x60_describeVariable_48283fbc1b51c97a(__context__,__glob_rename_at_149,((char *) ""));
+	}),__context__);
+}}
+
+inline void _Func_0x60_describeStructure_3d47302c62ee2d58 ( Context * __context__, StructInfo const  &  __sinfo_rename_at_110 ) { das_stack_prologue __prologue(__context__,496,"`describeStructure " DAS_FILE_LINE);
+{
+	_Funcrtti_0x60_structure_for_each_annotation_b86774dc8ab73890(__context__,__sinfo_rename_at_110,das_make_block<void,Annotation const  &,AnnotationArguments const  &>(__context__,80,0,&__func_info__ba3c6604,[&](Annotation const  & __ann_rename_at_112, AnnotationArguments const  & __annArgs_rename_at_112)->void{
+		char * __argT_rename_at_113 = ((char *)(char *)(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+			TArray<char *> ____acomp_113_rename_at_113; das_zero(____acomp_113_rename_at_113);
+			{
+				bool __need_loop_113 = true;
+				// arg : rtti::AnnotationArgument const&
+				das_iterator<AnnotationArguments const > __arg_iterator(__annArgs_rename_at_112);
+				AnnotationArgument const  * __arg_rename_at_113;
+				__need_loop_113 = __arg_iterator.first(__context__,(__arg_rename_at_113)) && __need_loop_113;
+				for ( ; __need_loop_113 ; __need_loop_113 = __arg_iterator.next(__context__,(__arg_rename_at_113)) )
+				{
+					TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_113_320;
+					_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_113_rename_at_113),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<das::string const  &>::from((*__arg_rename_at_113).name /*name*/), cast<char * const >::from(_Func_0x60_describeValue_d2d6042c1a290ea1(__context__,das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_113_320 = (das_alias<RttiValue>::from(rtti_builtin_argument_value((*__arg_rename_at_113),__context__))))))))));
+				}
+				__arg_iterator.close(__context__,(__arg_rename_at_113));
+			};
+			return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_113_rename_at_113);
+		})),((char *) ","))));
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_11, cast<char * const >::from(((char *) "[")), cast<das::string const  &>::from(__ann_rename_at_112.name /*name*/), cast<char * const >::from(((char *) "(")), cast<char * const >::from(__argT_rename_at_113), cast<char * const >::from(((char *) ")]\n")))),__context__);
+	}));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<char * const >::from(((char *) "struct ")), cast<char * const >::from(((char * const )(__sinfo_rename_at_110.name /*name*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	{
+		bool __need_loop_116 = true;
+		// sfield : rtti::VarInfo const&
+		das_iterator<StructInfo const > __sfield_iterator(__sinfo_rename_at_110);
+		VarInfo const  * __sfield_rename_at_116;
+		__need_loop_116 = __sfield_iterator.first(__context__,(__sfield_rename_at_116)) && __need_loop_116;
+		for ( ; __need_loop_116 ; __need_loop_116 = __sfield_iterator.next(__context__,(__sfield_rename_at_116)) )
+		{
+			_Func_0x60_describeVariable_48283fbc1b51c97a(__context__,(*__sfield_rename_at_116),((char *) "\t"));
+		}
+		__sfield_iterator.close(__context__,(__sfield_rename_at_116));
+	};
+}}
+
+inline char * _Func_0x60_describeType_d6648b1475912757 ( Context * __context__, TypeInfo const  &  __info_rename_at_41 )
+{
+	char * __res_rename_at_42 = 0;
+	if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		das_copy(__res_rename_at_42,((char *)(to_das_string(__info_rename_at_41.getAnnotation() /*annotation*/->name /*name*/,__context__))));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char *>::get(__info_rename_at_41.structType /*structType*/,([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16) )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char *>::get(__info_rename_at_41.enumType /*enumType*/,([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_13, cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_14, cast<char * const >::from(((char *) "array<")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+	{
+		if ( (__info_rename_at_41.firstType /*firstType*/ != nullptr) && (__info_rename_at_41.secondType /*secondType*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_15, cast<char * const >::from(((char *) "table<")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ";")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.secondType /*secondType*/))), cast<char * const >::from(((char *) ">")))));
+		} else {
+			das_copy(__res_rename_at_42,((char *) "table"));
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+	{
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_60_176;
+				TArray<char *> ____acomp_60_rename_at_60; das_zero(____acomp_60_rename_at_60);
+				{
+					bool __need_loop_60 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_60_176 = (_Funcrtti_0x60_arg_types_849db0d0a6905782(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_60;
+					__need_loop_60 = __argtype_iterator.first(__context__,(__argtype_rename_at_60)) && __need_loop_60;
+					for ( ; __need_loop_60 ; __need_loop_60 = __argtype_iterator.next(__context__,(__argtype_rename_at_60)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60),_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_60)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_60));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_60_rename_at_60);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ">")),*__context__)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "tuple")),*__context__);
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+	{
+		if ( (__info_rename_at_41.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_41.argNames /*argNames*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((char *)) _temp_make_local_65_416;
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_65_432;
+				TArray<char *> ____acomp_65_rename_at_65; das_zero(____acomp_65_rename_at_65);
+				{
+					bool __need_loop_65 = true;
+					// argname : string
+					das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_65_416 = (_Funcrtti_0x60_arg_names_7639323bf0e4f38b(__context__,__info_rename_at_41))));
+					char * __argname_rename_at_65;
+					__need_loop_65 = __argname_iterator.first(__context__,(__argname_rename_at_65)) && __need_loop_65;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_65_432 = (_Funcrtti_0x60_arg_types_849db0d0a6905782(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_65;
+					__need_loop_65 = __argtype_iterator.first(__context__,(__argtype_rename_at_65)) && __need_loop_65;
+					for ( ; __need_loop_65 ; __need_loop_65 = __argname_iterator.next(__context__,(__argname_rename_at_65)) && __argtype_iterator.next(__context__,(__argtype_rename_at_65)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_16, cast<char *>::from(__argname_rename_at_65), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_65))))));
+					}
+					__argname_iterator.close(__context__,(__argname_rename_at_65));
+					__argtype_iterator.close(__context__,(__argtype_rename_at_65));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_65_rename_at_65);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ">")),*__context__)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "variant")),*__context__);
+		};
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+	{
+		das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_17, cast<char *>::from(((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__)))), cast<char * const >::from(((char *) "<")))));
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_71_688;
+				TArray<char *> ____acomp_71_rename_at_71; das_zero(____acomp_71_rename_at_71);
+				{
+					bool __need_loop_71 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_71_688 = (_Funcrtti_0x60_arg_types_849db0d0a6905782(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_71;
+					__need_loop_71 = __argtype_iterator.first(__context__,(__argtype_rename_at_71)) && __need_loop_71;
+					for ( ; __need_loop_71 ; __need_loop_71 = __argtype_iterator.next(__context__,(__argtype_rename_at_71)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71),_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_71)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_71));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_71_rename_at_71);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ")")),*__context__)))),*__context__);
+		};
+		if ( __info_rename_at_41.firstType /*firstType*/ != nullptr )
+		{
+			if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+			{
+				SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ":")),*__context__);
+			};
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_18, cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/)))))),*__context__);
+		};
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ">")),*__context__);
+	} else {
+		das_copy(__res_rename_at_42,((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__))));
+	};
+	SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_79_928;
+		TArray<char *> ____acomp_79_rename_at_79; das_zero(____acomp_79_rename_at_79);
+		{
+			bool __need_loop_79 = true;
+			// d : int
+			das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_79_928 = (_Funcrtti_0x60_each_dim_be3d54e3fe706c9b(__context__,__info_rename_at_41))));
+			int32_t __d_rename_at_79;
+			__need_loop_79 = __d_iterator.first(__context__,(__d_rename_at_79)) && __need_loop_79;
+			for ( ; __need_loop_79 ; __need_loop_79 = __d_iterator.next(__context__,(__d_rename_at_79)) )
+			{
+				_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79),(__d_rename_at_79 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_19, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_79), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+			}
+			__d_iterator.close(__context__,(__d_rename_at_79));
+		};
+		return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_79_rename_at_79);
+	})),((char *) ""))),*__context__);
+	if ( __info_rename_at_41.isConst() /*isConst*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " const")),*__context__);
+	};
+	if ( __info_rename_at_41.isRef() /*isRef*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " &")),*__context__);
+	};
+	if ( __info_rename_at_41.isTemp() /*isTemp*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "#")),*__context__);
+	};
+	if ( __info_rename_at_41.isImplicit() /*isImplicit*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " implicit")),*__context__);
+	};
+	return das_auto_cast<char *>::cast(__res_rename_at_42);
+}
+
+inline char * _Func_0x60_describeType_ed76972d72b6a5ab ( Context * __context__, VarInfo const  &  __info_rename_at_41 )
+{
+	char * __res_rename_at_42 = 0;
+	if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tHandle )
+	{
+		das_copy(__res_rename_at_42,((char *)(to_das_string(__info_rename_at_41.getAnnotation() /*annotation*/->name /*name*/,__context__))));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tStructure )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<StructInfo,char *>::get(__info_rename_at_41.structType /*structType*/,([&](const StructInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "structure")));
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration8)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tEnumeration16) )
+	{
+		das_copy(__res_rename_at_42,das_null_coalescing<char * const >::get(das_safe_navigation_handle<EnumInfo,char *>::get(__info_rename_at_41.enumType /*enumType*/,([&](const EnumInfo * __any) -> auto & {return __any->name /*name*/;})),((char *) "enumeration")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tPointer )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_20, cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) "?"))))) : das_auto_cast<char * const >::cast(((char *) "void?")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tArray )
+	{
+		das_copy(__res_rename_at_42,(__info_rename_at_41.firstType /*firstType*/ != nullptr) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_21, cast<char * const >::from(((char *) "array<")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ">"))))) : das_auto_cast<char * const >::cast(((char *) "array")));
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTable )
+	{
+		if ( (__info_rename_at_41.firstType /*firstType*/ != nullptr) && (__info_rename_at_41.secondType /*secondType*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<5>(__tinfo_22, cast<char * const >::from(((char *) "table<")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/))), cast<char * const >::from(((char *) ";")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.secondType /*secondType*/))), cast<char * const >::from(((char *) ">")))));
+		} else {
+			das_copy(__res_rename_at_42,((char *) "table"));
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tTuple )
+	{
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "tuple<")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_60_176;
+				TArray<char *> ____acomp_60_rename_at_60; das_zero(____acomp_60_rename_at_60);
+				{
+					bool __need_loop_60 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_60_176 = (_Funcrtti_0x60_arg_types_702f9b766fa955e8(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_60;
+					__need_loop_60 = __argtype_iterator.first(__context__,(__argtype_rename_at_60)) && __need_loop_60;
+					for ( ; __need_loop_60 ; __need_loop_60 = __argtype_iterator.next(__context__,(__argtype_rename_at_60)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_60_rename_at_60),_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_60)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_60));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_60_rename_at_60);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ">")),*__context__)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "tuple")),*__context__);
+		};
+	} else if ( __info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tVariant )
+	{
+		if ( (__info_rename_at_41.argTypes /*argTypes*/ != nullptr) && (__info_rename_at_41.argNames /*argNames*/ != nullptr) )
+		{
+			das_copy(__res_rename_at_42,cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "variant<")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((char *)) _temp_make_local_65_416;
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_65_432;
+				TArray<char *> ____acomp_65_rename_at_65; das_zero(____acomp_65_rename_at_65);
+				{
+					bool __need_loop_65 = true;
+					// argname : string
+					das_iterator<Sequence DAS_COMMENT((char *))> __argname_iterator((_temp_make_local_65_416 = (_Funcrtti_0x60_arg_names_d38fc7f4e2074135(__context__,__info_rename_at_41))));
+					char * __argname_rename_at_65;
+					__need_loop_65 = __argname_iterator.first(__context__,(__argname_rename_at_65)) && __need_loop_65;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_65_432 = (_Funcrtti_0x60_arg_types_702f9b766fa955e8(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_65;
+					__need_loop_65 = __argtype_iterator.first(__context__,(__argtype_rename_at_65)) && __need_loop_65;
+					for ( ; __need_loop_65 ; __need_loop_65 = __argname_iterator.next(__context__,(__argname_rename_at_65)) && __argtype_iterator.next(__context__,(__argtype_rename_at_65)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_65_rename_at_65),das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_23, cast<char *>::from(__argname_rename_at_65), cast<char * const >::from(((char *) ":")), cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_65))))));
+					}
+					__argname_iterator.close(__context__,(__argname_rename_at_65));
+					__argtype_iterator.close(__context__,(__argtype_rename_at_65));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_65_rename_at_65);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ">")),*__context__)));
+		} else {
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "variant")),*__context__);
+		};
+	} else if ( ((__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tFunction) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tLambda)) || (__info_rename_at_41.type /*basicType*/ == DAS_COMMENT(bound_enum) das::Type::tBlock) )
+	{
+		das_copy(__res_rename_at_42,das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_24, cast<char *>::from(((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__)))), cast<char * const >::from(((char *) "<")))));
+		if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+		{
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(((char *) "(")),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+				Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_71_688;
+				TArray<char *> ____acomp_71_rename_at_71; das_zero(____acomp_71_rename_at_71);
+				{
+					bool __need_loop_71 = true;
+					// argtype : rtti::TypeInfo const&
+					das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __argtype_iterator((_temp_make_local_71_688 = (_Funcrtti_0x60_arg_types_702f9b766fa955e8(__context__,__info_rename_at_41))));
+					TypeInfo const  * __argtype_rename_at_71;
+					__need_loop_71 = __argtype_iterator.first(__context__,(__argtype_rename_at_71)) && __need_loop_71;
+					for ( ; __need_loop_71 ; __need_loop_71 = __argtype_iterator.next(__context__,(__argtype_rename_at_71)) )
+					{
+						_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_71_rename_at_71),_Func_0x60_describeType_d6648b1475912757(__context__,(*__argtype_rename_at_71)));
+					}
+					__argtype_iterator.close(__context__,(__argtype_rename_at_71));
+				};
+				return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_71_rename_at_71);
+			})),((char *) ";"))),*__context__)))),cast<char *>::from(((char *) ")")),*__context__)))),*__context__);
+		};
+		if ( __info_rename_at_41.firstType /*firstType*/ != nullptr )
+		{
+			if ( __info_rename_at_41.argTypes /*argTypes*/ != nullptr )
+			{
+				SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ":")),*__context__);
+			};
+			SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_25, cast<char *>::from(_Func_0x60_describeType_d6648b1475912757(__context__,das_deref(__context__,__info_rename_at_41.firstType /*firstType*/)))))),*__context__);
+		};
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) ">")),*__context__);
+	} else {
+		das_copy(__res_rename_at_42,((char *)(rtti_get_das_type_name(__info_rename_at_41.type /*basicType*/,__context__))));
+	};
+	SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(_Funcstrings_boost_0x60_join_48fb6c570d4c5eba(__context__,das_arg<TArray<char *>>::pass(das_invoke<TArray<char *>>::invoke_cmres(__context__,[&]()->TArray<char *>{
+		Sequence DAS_COMMENT((int32_t)) _temp_make_local_79_928;
+		TArray<char *> ____acomp_79_rename_at_79; das_zero(____acomp_79_rename_at_79);
+		{
+			bool __need_loop_79 = true;
+			// d : int
+			das_iterator<Sequence DAS_COMMENT((int32_t))> __d_iterator((_temp_make_local_79_928 = (_Funcrtti_0x60_each_dim_1beed970fc78bc61(__context__,__info_rename_at_41))));
+			int32_t __d_rename_at_79;
+			__need_loop_79 = __d_iterator.first(__context__,(__d_rename_at_79)) && __need_loop_79;
+			for ( ; __need_loop_79 ; __need_loop_79 = __d_iterator.next(__context__,(__d_rename_at_79)) )
+			{
+				_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(____acomp_79_rename_at_79),(__d_rename_at_79 != -1) ? das_auto_cast<char * const >::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_26, cast<char * const >::from(((char *) "[")), cast<int32_t>::from(__d_rename_at_79), cast<char * const >::from(((char *) "]"))))) : das_auto_cast<char * const >::cast(((char *) "[]")));
+			}
+			__d_iterator.close(__context__,(__d_rename_at_79));
+		};
+		return /* <- */ das_auto_cast<TArray<char *>>::cast(____acomp_79_rename_at_79);
+	})),((char *) ""))),*__context__);
+	if ( __info_rename_at_41.isConst() /*isConst*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " const")),*__context__);
+	};
+	if ( __info_rename_at_41.isRef() /*isRef*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " &")),*__context__);
+	};
+	if ( __info_rename_at_41.isTemp() /*isTemp*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) "#")),*__context__);
+	};
+	if ( __info_rename_at_41.isImplicit() /*isImplicit*/ )
+	{
+		SimPolicy<char *>::SetAdd((char *)&(__res_rename_at_42),cast<char *>::from(((char *) " implicit")),*__context__);
+	};
+	return das_auto_cast<char *>::cast(__res_rename_at_42);
+}
+
+inline char * const  _Func_0x60_describeValue_d2d6042c1a290ea1 ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  __value_rename_at_99 )
+{
+	if ( das_get_variant_field<vec4f,16,8>::is(__value_rename_at_99) )
+	{
+		return das_auto_cast<char * const >::cast(((char *) ""));
+	} else return das_auto_cast<char * const >::cast(das_get_variant_field<char *,16,7>::is(__value_rename_at_99) ? das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_27, cast<char * const >::from(((char *) "=\"")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_99), cast<char * const >::from(((char *) "\""))))) : das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_28, cast<char * const >::from(((char *) "=")), cast<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &>::from(__value_rename_at_99)))));
+}
+
+inline void _Func_0x60_describeVariable_48283fbc1b51c97a ( Context * __context__, VarInfo const  &  __glob_rename_at_107, char * const  __extra_rename_at_107 )
+{
+	TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> _temp_make_local_108_32;
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<6>(__tinfo_29, cast<char * const >::from(__extra_rename_at_107), cast<char * const >::from(((char * const )(__glob_rename_at_107.name /*name*/))), cast<char * const >::from(((char *) " : ")), cast<char *>::from(_Func_0x60_describeType_ed76972d72b6a5ab(__context__,__glob_rename_at_107)), cast<char * const >::from(_Func_0x60_describeValue_d2d6042c1a290ea1(__context__,das_arg<TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f>>::pass((_temp_make_local_108_32 = (das_alias<RttiValue>::from(rtti_builtin_variable_value(__glob_rename_at_107))))))), cast<char * const >::from(((char *) "\n")))),__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_6d2711b060b71aa1 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_4748992c369f1a7c ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_269 )
+{
+	Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_270; das_zero(__it_rename_at_270);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_270),__lam_rename_at_269,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(__it_rename_at_270);
+}
+
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> &  __Arr_rename_at_37, char * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void finalize_41f0bec1cd14be5f ( Context * __context__, _lambda_thismodule_40_21_5 &  ____this_rename_at_40 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),__context__);
+	memset(&(____this_rename_at_40), 0, 48);
+}
+
+inline void finalize_9a9f01b879c5b9f6 ( Context * __context__, _lambda_thismodule_40_21_6 &  ____this_rename_at_40 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_40._source_0_at_40),__context__);
+	memset(&(____this_rename_at_40), 0, 48);
+}
+
+inline void finalize_a5c05d4c8cadb389 ( Context * __context__, _lambda_thismodule_55_12_3 &  ____this_rename_at_55 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),__context__);
+	memset(&(____this_rename_at_55), 0, 48);
+}
+
+inline void finalize_61c38349f85d7f0 ( Context * __context__, _lambda_thismodule_55_12_4 &  ____this_rename_at_55 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),__context__);
+	memset(&(____this_rename_at_55), 0, 48);
+}
+
+inline void finalize_7e93fd9ea79f6880 ( Context * __context__, _lambda_thismodule_74_12_1 &  ____this_rename_at_74 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),__context__);
+	memset(&(____this_rename_at_74), 0, 48);
+}
+
+inline void finalize_bd5fd3f70ffb2d0d ( Context * __context__, _lambda_thismodule_74_12_2 &  ____this_rename_at_74 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),__context__);
+	memset(&(____this_rename_at_74), 0, 48);
+}
+
+inline bool main_fa999b8d2dc9e40 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,368,"main " DAS_FILE_LINE);
+{
+	rtti_builtin_program_for_each_registered_module(das_make_block<void,Module *>(__context__,80,0,&__func_info__4ebfc4bc,[&](Module * __mod_rename_at_155)->void{
+		_Func_0x60_describeModule_98b767f52c74e9d(__context__,__mod_rename_at_155);
+	}),__context__);
+	_Func_0x60_describeModule_98b767f52c74e9d(__context__,rtti_get_builtin_module(((char *) "$")));
+	rtti_builtin_compile(((char *) "sample"),das_global<char *,0x8a980b68>(__context__) /*sample*/,das_make_block<void,bool,smart_ptr<Program>,das::string const  &>(__context__,144,0,&__func_info__963b81b,[&](bool __ok_rename_at_159, smart_ptr<Program> __prog_rename_at_159, das::string const  & __errors_rename_at_159)->void{
+		if ( __ok_rename_at_159 )
+		{
+			builtin_print(((char *) "compiled\n"),__context__);
+			Module * __thisMod_rename_at_162 = ((Module *)rtti_get_this_module(__prog_rename_at_159));
+			rtti_builtin_program_for_each_module(__prog_rename_at_159,das_make_block<void,Module *>(__context__,224,0,&__func_info__4ebfc4bc,[&](Module * __mod_rename_at_163)->void{
+				if ( __mod_rename_at_163 == __thisMod_rename_at_162 )
+				{
+					_Func_0x60_describeModule_98b767f52c74e9d(__context__,__mod_rename_at_163);
+				};
+			}),__context__);
+		} else {
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_30, cast<char * const >::from(((char *) "failed to compile:\n")), cast<das::string const  &>::from(__errors_rename_at_159), cast<char * const >::from(((char *) "\n")))),__context__);
+			DAS_ASSERT((false));
+		};
+	}),__context__);
+	_Funcrtti_0x60_context_for_each_function_47f4c59689990846(__context__,das_make_block<void,FuncInfo const  &>(__context__,288,0,&__func_info__ec2debe4,[&](FuncInfo const  & __finfo_rename_at_170)->void{
+		_Func_0x60_describeFunction_25eafb76e148367a(__context__,__finfo_rename_at_170);
+	}));
+	_Funcrtti_0x60_context_for_each_variable_f53c6c89f0e45ca7(__context__,das_make_block<void,VarInfo const  &>(__context__,352,0,&__func_info__e9f8e4e0,[&](VarInfo const  & __vinfo_rename_at_172)->void{
+		_Func_0x60_describeVariable_48283fbc1b51c97a(__context__,__vinfo_rename_at_172,((char *) ""));
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_7639323bf0e4f38b ( Context * __context__, TypeInfo const  &  __info_rename_at_81 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_da36f3457c42fc56(__context__,__info_rename_at_81));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_d38fc7f4e2074135 ( Context * __context__, VarInfo const  &  __info_rename_at_85 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_8a0172397ee395dd(__context__,__info_rename_at_85));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_da36f3457c42fc56 ( Context * __context__, TypeInfo const  &  __info_rename_at_70 )
+{
+	TypeInfo const  * __pinfo_rename_at_72 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_70));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_4748992c369f1a7c(__context__,das_ascend<bool,_lambda_thismodule_74_12_1>::make(__context__,&__type_info__e7206d7e,(([&]() -> _lambda_thismodule_74_12_1 {
+		_lambda_thismodule_74_12_1 __mks_73;
+		das_zero(__mks_73);
+		das_copy((__mks_73.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_1`function _lambda_thismodule_74_12_1 string#ref*/ 1180853320u))));
+		das_copy((__mks_73.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_1`finazlier #ptr#_lambda_thismodule_74_12_1#explicit*/ 392220926u))));
+		das_copy((__mks_73.pinfo),(__pinfo_rename_at_72));
+		return __mks_73;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_8a0172397ee395dd ( Context * __context__, VarInfo const  &  __info_rename_at_70 )
+{
+	VarInfo const  * __pinfo_rename_at_72 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_70));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_4748992c369f1a7c(__context__,das_ascend<bool,_lambda_thismodule_74_12_2>::make(__context__,&__type_info__e6206beb,(([&]() -> _lambda_thismodule_74_12_2 {
+		_lambda_thismodule_74_12_2 __mks_73;
+		das_zero(__mks_73);
+		das_copy((__mks_73.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_2`function _lambda_thismodule_74_12_2 string#ref*/ 2988982304u))));
+		das_copy((__mks_73.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_2`finazlier #ptr#_lambda_thismodule_74_12_2#explicit*/ 1258684130u))));
+		das_copy((__mks_73.pinfo),(__pinfo_rename_at_72));
+		return __mks_73;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_849db0d0a6905782 ( Context * __context__, TypeInfo const  &  __info_rename_at_62 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_e2ec9a8f1f9d2401(__context__,__info_rename_at_62));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_702f9b766fa955e8 ( Context * __context__, VarInfo const  &  __info_rename_at_66 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_546bdb6d20a295d8(__context__,__info_rename_at_66));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_e2ec9a8f1f9d2401 ( Context * __context__, TypeInfo const  &  __info_rename_at_51 )
+{
+	TypeInfo const  * __pinfo_rename_at_53 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_51));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07(__context__,das_ascend<bool,_lambda_thismodule_55_12_3>::make(__context__,&__type_info__c381edc3,(([&]() -> _lambda_thismodule_55_12_3 {
+		_lambda_thismodule_55_12_3 __mks_54;
+		das_zero(__mks_54);
+		das_copy((__mks_54.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_3`function _lambda_thismodule_55_12_3 #ptr##handle#TypeInfo#const#ref*/ 1365284193u))));
+		das_copy((__mks_54.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_3`finazlier #ptr#_lambda_thismodule_55_12_3#explicit*/ 1898598470u))));
+		das_copy((__mks_54.pinfo),(__pinfo_rename_at_53));
+		return __mks_54;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_546bdb6d20a295d8 ( Context * __context__, VarInfo const  &  __info_rename_at_51 )
+{
+	VarInfo const  * __pinfo_rename_at_53 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_51));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07(__context__,das_ascend<bool,_lambda_thismodule_55_12_4>::make(__context__,&__type_info__c881f5a2,(([&]() -> _lambda_thismodule_55_12_4 {
+		_lambda_thismodule_55_12_4 __mks_54;
+		das_zero(__mks_54);
+		das_copy((__mks_54.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_4`function _lambda_thismodule_55_12_4 #ptr##handle#TypeInfo#const#ref*/ 2383273849u))));
+		das_copy((__mks_54.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_4`finazlier #ptr#_lambda_thismodule_55_12_4#explicit*/ 2578615802u))));
+		das_copy((__mks_54.pinfo),(__pinfo_rename_at_53));
+		return __mks_54;
+	})()))));
+}
+
+inline void _Funcrtti_0x60_context_for_each_function_47f4c59689990846 ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  &  __blk_rename_at_27 )
+{
+	{
+		bool __need_loop_28 = true;
+		// fni : int const
+		das_iterator<range> __fni_iterator(mk_range(rtti_contextTotalFunctions(__context__)));
+		int32_t __fni_rename_at_28;
+		__need_loop_28 = __fni_iterator.first(__context__,(__fni_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __fni_iterator.next(__context__,(__fni_rename_at_28)) )
+		{
+			das_invoke<void>::invoke<FuncInfo const  &>(__context__,__blk_rename_at_27,das_call_interop<FuncInfo const  &>::call(&rtti_contextFunctionInfo,__context__,SimNode_AotInterop<1>(__tinfo_31,cast<int32_t>::from(__fni_rename_at_28))));
+		}
+		__fni_iterator.close(__context__,(__fni_rename_at_28));
+	};
+}
+
+inline void _Funcrtti_0x60_context_for_each_variable_f53c6c89f0e45ca7 ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  &  __blk_rename_at_32 )
+{
+	{
+		bool __need_loop_33 = true;
+		// vi : int const
+		das_iterator<range> __vi_iterator(mk_range(rtti_contextTotalVariables(__context__)));
+		int32_t __vi_rename_at_33;
+		__need_loop_33 = __vi_iterator.first(__context__,(__vi_rename_at_33)) && __need_loop_33;
+		for ( ; __need_loop_33 ; __need_loop_33 = __vi_iterator.next(__context__,(__vi_rename_at_33)) )
+		{
+			das_invoke<void>::invoke<VarInfo const  &>(__context__,__blk_rename_at_32,das_call_interop<VarInfo const  &>::call(&rtti_contextVariableInfo,__context__,SimNode_AotInterop<1>(__tinfo_32,cast<int32_t>::from(__vi_rename_at_33))));
+		}
+		__vi_iterator.close(__context__,(__vi_rename_at_33));
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_be3d54e3fe706c9b ( Context * __context__, TypeInfo const  &  __info_rename_at_43 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcrtti_0x60_each_dim_any_39ccf77c474657a1(__context__,__info_rename_at_43));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_1beed970fc78bc61 ( Context * __context__, VarInfo const  &  __info_rename_at_47 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcrtti_0x60_each_dim_any_772788cb9d0fed6d(__context__,__info_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_39ccf77c474657a1 ( Context * __context__, TypeInfo const  &  __info_rename_at_37 )
+{
+	TypeInfo const  * __pinfo_rename_at_39 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_37));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_6d2711b060b71aa1(__context__,das_ascend<bool,_lambda_thismodule_40_21_5>::make(__context__,&__type_info__5a573c95,(([&]() -> _lambda_thismodule_40_21_5 {
+		_lambda_thismodule_40_21_5 __mks_40;
+		das_zero(__mks_40);
+		das_copy((__mks_40.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_40_21_5`function _lambda_thismodule_40_21_5 int#ref*/ 4232933030u))));
+		das_copy((__mks_40.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_40_21_5`finazlier #ptr#_lambda_thismodule_40_21_5#explicit*/ 3400794878u))));
+		das_copy((__mks_40.pinfo),(__pinfo_rename_at_39));
+		return __mks_40;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcrtti_0x60_each_dim_any_772788cb9d0fed6d ( Context * __context__, VarInfo const  &  __info_rename_at_37 )
+{
+	VarInfo const  * __pinfo_rename_at_39 = ((VarInfo const  *)das_ref(__context__,__info_rename_at_37));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_6d2711b060b71aa1(__context__,das_ascend<bool,_lambda_thismodule_40_21_6>::make(__context__,&__type_info__575737dc,(([&]() -> _lambda_thismodule_40_21_6 {
+		_lambda_thismodule_40_21_6 __mks_40;
+		das_zero(__mks_40);
+		das_copy((__mks_40.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_40_21_6`function _lambda_thismodule_40_21_6 int#ref*/ 4094402522u))));
+		das_copy((__mks_40.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_40_21_6`finazlier #ptr#_lambda_thismodule_40_21_6#explicit*/ 2438709054u))));
+		das_copy((__mks_40.pinfo),(__pinfo_rename_at_39));
+		return __mks_40;
+	})()))));
+}
+
+inline void _Funcrtti_0x60_structure_for_each_annotation_b86774dc8ab73890 ( Context * __context__, StructInfo const  &  __st_rename_at_9, Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  __subexpr_rename_at_9 )
+{
+	rtti_builtin_structure_for_each_annotation(__st_rename_at_9,__subexpr_rename_at_9,__context__);
+}
+
+inline char * const  _Funcstrings_boost_0x60_join_48fb6c570d4c5eba ( Context * __context__, TArray<char *> const  &  __it_rename_at_16, char * const  __separator_rename_at_16 )
+{
+	char * __st_rename_at_21 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_21)->void{
+		bool __skip_first_rename_at_22 = true;
+		{
+			bool __need_loop_23 = true;
+			// elem : string const&
+			das_iterator<TArray<char *> const > __elem_iterator(__it_rename_at_16);
+			char * const  * __elem_rename_at_23;
+			__need_loop_23 = __elem_iterator.first(__context__,(__elem_rename_at_23)) && __need_loop_23;
+			for ( ; __need_loop_23 ; __need_loop_23 = __elem_iterator.next(__context__,(__elem_rename_at_23)) )
+			{
+				if ( __skip_first_rename_at_22 )
+				{
+					das_copy(__skip_first_rename_at_22,false);
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_33,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from(__separator_rename_at_16)));
+				};
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_34,cast<StringBuilderWriter &>::from(__writer_rename_at_21),cast<char * const >::from((*__elem_rename_at_23))));
+			}
+			__elem_iterator.close(__context__,(__elem_rename_at_23));
+		};
+	},__context__)))));
+	return das_auto_cast<char * const >::cast(__st_rename_at_21);
+}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_40_21_5_0x60_finazlier_ec7f2013629b4a2c
+		aotLib[0x482e3ce1a545210b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_5 *  ),&_Func_lambda_thismodule_40_21_5_0x60_finazlier_ec7f2013629b4a2c>>();
+	};
+		// _Func_lambda_thismodule_40_21_5_0x60_function_b0228f9152abf913
+		aotLib[0x6d5a273101158e0c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_40_21_5 & , int32_t &  ),&_Func_lambda_thismodule_40_21_5_0x60_function_b0228f9152abf913>>();
+	};
+		// _Func_lambda_thismodule_40_21_6_0x60_finazlier_cf8b0d029d1af5a4
+		aotLib[0x1ef67c017a8eb250] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_6 *  ),&_Func_lambda_thismodule_40_21_6_0x60_finazlier_cf8b0d029d1af5a4>>();
+	};
+		// _Func_lambda_thismodule_40_21_6_0x60_function_b8c145552b11aa18
+		aotLib[0xfedb7c83e3ecdc4c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_40_21_6 & , int32_t &  ),&_Func_lambda_thismodule_40_21_6_0x60_function_b8c145552b11aa18>>();
+	};
+		// _Func_lambda_thismodule_55_12_3_0x60_finazlier_9766ab41ef8ccc5c
+		aotLib[0xead0863341beb82c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_3 *  ),&_Func_lambda_thismodule_55_12_3_0x60_finazlier_9766ab41ef8ccc5c>>();
+	};
+		// _Func_lambda_thismodule_55_12_3_0x60_function_6c8348c4e152d453
+		aotLib[0xe4b4bbbf926260c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_55_12_3 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_55_12_3_0x60_function_6c8348c4e152d453>>();
+	};
+		// _Func_lambda_thismodule_55_12_4_0x60_finazlier_1fc4ea681230208
+		aotLib[0x19300f32e32cfada] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_4 *  ),&_Func_lambda_thismodule_55_12_4_0x60_finazlier_1fc4ea681230208>>();
+	};
+		// _Func_lambda_thismodule_55_12_4_0x60_function_747b8060d71aa614
+		aotLib[0xe09057f3480beee8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_55_12_4 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_55_12_4_0x60_function_747b8060d71aa614>>();
+	};
+		// _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c
+		aotLib[0x7eb33a77334ae283] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_1 *  ),&_Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c>>();
+	};
+		// _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c
+		aotLib[0x394d135e2dbbaf5c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_74_12_1 & , char * &  ),&_Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c>>();
+	};
+		// _Func_lambda_thismodule_74_12_2_0x60_finazlier_aab6dfbb5d372ec0
+		aotLib[0x14eaff960f334543] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_2 *  ),&_Func_lambda_thismodule_74_12_2_0x60_finazlier_aab6dfbb5d372ec0>>();
+	};
+		// _Func_lambda_thismodule_74_12_2_0x60_function_40b7da8d3ef62281
+		aotLib[0x8c2bae7cd6aec620] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_74_12_2 & , char * &  ),&_Func_lambda_thismodule_74_12_2_0x60_function_40b7da8d3ef62281>>();
+	};
+		// _Func_0x60_describeAnnotation_dc7909501fd7305
+		aotLib[0xcd2e399ece42d6ea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Annotation const  &  ),&_Func_0x60_describeAnnotation_dc7909501fd7305>>();
+	};
+		// _Func_0x60_describeEnumeration_525a761d4a1bf940
+		aotLib[0xda763f85ac7372ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, EnumInfo const  &  ),&_Func_0x60_describeEnumeration_525a761d4a1bf940>>();
+	};
+		// _Func_0x60_describeFunction_25eafb76e148367a
+		aotLib[0xd17396a38600e257] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, FuncInfo const  &  ),&_Func_0x60_describeFunction_25eafb76e148367a>>();
+	};
+		// _Func_0x60_describeModule_98b767f52c74e9d
+		aotLib[0x3e49ed46e7808a51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Module * const   ),&_Func_0x60_describeModule_98b767f52c74e9d>>();
+	};
+		// _Func_0x60_describeStructure_3d47302c62ee2d58
+		aotLib[0x2158f037b39b7ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StructInfo const  &  ),&_Func_0x60_describeStructure_3d47302c62ee2d58>>();
+	};
+		// _Func_0x60_describeType_d6648b1475912757
+		aotLib[0x1a108d552ff8e4cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, TypeInfo const  &  ),&_Func_0x60_describeType_d6648b1475912757>>();
+	};
+		// _Func_0x60_describeType_ed76972d72b6a5ab
+		aotLib[0xc3d4bbfb7cf006be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, VarInfo const  &  ),&_Func_0x60_describeType_ed76972d72b6a5ab>>();
+	};
+		// _Func_0x60_describeValue_d2d6042c1a290ea1
+		aotLib[0x4b0138d5af4742d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TVariant<32,bool,int32_t,uint32_t,int64_t,uint64_t,float,double,char *,vec4f> const  &  ),&_Func_0x60_describeValue_d2d6042c1a290ea1>>();
+	};
+		// _Func_0x60_describeVariable_48283fbc1b51c97a
+		aotLib[0xd00f186e4d9616f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, VarInfo const  & , char * const   ),&_Func_0x60_describeVariable_48283fbc1b51c97a>>();
+	};
+		// _Funcbuiltin_0x60_each_6d2711b060b71aa1
+		aotLib[0x9c95c6df3a97a529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_6d2711b060b71aa1>>();
+	};
+		// _Funcbuiltin_0x60_each_4748992c369f1a7c
+		aotLib[0x42ed895b4b5ab79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_4748992c369f1a7c>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07
+		aotLib[0x5a5d3580e8e6af5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07>>();
+	};
+		// _Funcbuiltin_0x60_push_5caef1f118709d18
+		aotLib[0x80f7de2e45124cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_5caef1f118709d18>>();
+	};
+		// finalize_41f0bec1cd14be5f
+		aotLib[0xf7c1e77f9a6ed51d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_5 &  ),&finalize_41f0bec1cd14be5f>>();
+	};
+		// finalize_9a9f01b879c5b9f6
+		aotLib[0xc77f8bcb1dd6fa45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_40_21_6 &  ),&finalize_9a9f01b879c5b9f6>>();
+	};
+		// finalize_a5c05d4c8cadb389
+		aotLib[0xa789f9209f73ec75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_3 &  ),&finalize_a5c05d4c8cadb389>>();
+	};
+		// finalize_61c38349f85d7f0
+		aotLib[0xb123e3fc34ae92f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_4 &  ),&finalize_61c38349f85d7f0>>();
+	};
+		// finalize_7e93fd9ea79f6880
+		aotLib[0x8c92447f6509533d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_1 &  ),&finalize_7e93fd9ea79f6880>>();
+	};
+		// finalize_bd5fd3f70ffb2d0d
+		aotLib[0x9ab7b0d41d1c12f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_2 &  ),&finalize_bd5fd3f70ffb2d0d>>();
+	};
+		// main_fa999b8d2dc9e40
+		aotLib[0x3891cdd8158c1113] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&main_fa999b8d2dc9e40>>();
+	};
+		// _Funcrtti_0x60_arg_names_7639323bf0e4f38b
+		aotLib[0x28f3f1a056a9d59e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_7639323bf0e4f38b>>();
+	};
+		// _Funcrtti_0x60_arg_names_d38fc7f4e2074135
+		aotLib[0xcd231ad4fd96ac3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_names_d38fc7f4e2074135>>();
+	};
+		// _Funcrtti_0x60_arg_names_any_da36f3457c42fc56
+		aotLib[0x5a1edc95ab070666] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_any_da36f3457c42fc56>>();
+	};
+		// _Funcrtti_0x60_arg_names_any_8a0172397ee395dd
+		aotLib[0x60c87b49d86d46c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_names_any_8a0172397ee395dd>>();
+	};
+		// _Funcrtti_0x60_arg_types_849db0d0a6905782
+		aotLib[0x33b72090ab82f82e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_849db0d0a6905782>>();
+	};
+		// _Funcrtti_0x60_arg_types_702f9b766fa955e8
+		aotLib[0x40184ec5f02220d8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_types_702f9b766fa955e8>>();
+	};
+		// _Funcrtti_0x60_arg_types_any_e2ec9a8f1f9d2401
+		aotLib[0x81d951b701d807e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_any_e2ec9a8f1f9d2401>>();
+	};
+		// _Funcrtti_0x60_arg_types_any_546bdb6d20a295d8
+		aotLib[0xe41d31ffcf3db1d6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_arg_types_any_546bdb6d20a295d8>>();
+	};
+		// _Funcrtti_0x60_context_for_each_function_47f4c59689990846
+		aotLib[0xc4f4c887b0b8e365] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,FuncInfo const )) const  &  ),&_Funcrtti_0x60_context_for_each_function_47f4c59689990846>>();
+	};
+		// _Funcrtti_0x60_context_for_each_variable_f53c6c89f0e45ca7
+		aotLib[0xdae0ae040139d01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,VarInfo const )) const  &  ),&_Funcrtti_0x60_context_for_each_variable_f53c6c89f0e45ca7>>();
+	};
+		// _Funcrtti_0x60_each_dim_be3d54e3fe706c9b
+		aotLib[0x61134e9650035e2c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_each_dim_be3d54e3fe706c9b>>();
+	};
+		// _Funcrtti_0x60_each_dim_1beed970fc78bc61
+		aotLib[0x8ad5ebe8f5efee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_each_dim_1beed970fc78bc61>>();
+	};
+		// _Funcrtti_0x60_each_dim_any_39ccf77c474657a1
+		aotLib[0x768e985072d0bf91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_each_dim_any_39ccf77c474657a1>>();
+	};
+		// _Funcrtti_0x60_each_dim_any_772788cb9d0fed6d
+		aotLib[0x798f28afcb7ca1ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, VarInfo const  &  ),&_Funcrtti_0x60_each_dim_any_772788cb9d0fed6d>>();
+	};
+		// _Funcrtti_0x60_structure_for_each_annotation_b86774dc8ab73890
+		aotLib[0x592fce902bda9bdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, StructInfo const  & , Block DAS_COMMENT((void,Annotation const ,AnnotationArguments const )) const  &  ),&_Funcrtti_0x60_structure_for_each_annotation_b86774dc8ab73890>>();
+	};
+		// _Funcstrings_boost_0x60_join_48fb6c570d4c5eba
+		aotLib[0xea1df6d3de6cdb39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__, TArray<char *> const  & , char * const   ),&_Funcstrings_boost_0x60_join_48fb6c570d4c5eba>>();
+	};
+		// test_b0087d371648db3f
+		aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+		// [[ init script ]]
+		aotLib[0xabbd2dca5500a26c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,126 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__e6eb6b88;
+extern FuncInfo __func_info__7cb4105a;
+
+FuncInfo __func_info__7cb4105a = {"invoke block<int&> const", "", nullptr, 0, 32, &__type_info__e6eb6b88, nullptr,0,0x7cb4105a, 0x0 };
+TypeInfo __type_info__e6eb6b88 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 0xe6eb6b88 };
+
+
+inline int32_t & _Func_0x60_ret_safe_ref_a028cae6fce9d180 ( Context * __context__, int32_t & __a_rename_at_13 );
+inline void add2_ecad6a810a3f93cf ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  & __bl_rename_at_17 );
+inline int32_t & ret_ref_969db291dc506ab1 ( Context * __context__ );
+inline bool test_3e1e83161f60fce7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xdfef538>(__context__) = 2;/*g_t*/
+}
+
+inline int32_t & _Func_0x60_ret_safe_ref_a028cae6fce9d180 ( Context * __context__, int32_t & __a_rename_at_13 )
+{
+	return das_auto_cast<int32_t &>::cast(__a_rename_at_13);
+}
+
+inline void add2_ecad6a810a3f93cf ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  &  __bl_rename_at_17 )
+{
+	das_invoke<int32_t &>::invoke(__context__,__bl_rename_at_17) += 2;
+}
+
+inline int32_t & ret_ref_969db291dc506ab1 ( Context * __context__ )
+{
+	int32_t * __qq_rename_at_8 = &(das_global<int32_t,0xdfef538>(__context__) /*g_t*/);
+	return das_auto_cast<int32_t &>::cast((*__qq_rename_at_8));
+}
+
+inline bool test_3e1e83161f60fce7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	int32_t __x_rename_at_23 = ret_ref_969db291dc506ab1(__context__);
+	int32_t * __xx_rename_at_24 = &(_Func_0x60_ret_safe_ref_a028cae6fce9d180(__context__,__x_rename_at_23));
+	DAS_ASSERT(((*__xx_rename_at_24) == 2));
+	int32_t * __z_rename_at_26 = &(ret_ref_969db291dc506ab1(__context__));
+	DAS_ASSERT(((__x_rename_at_23 == 2) && ((*__z_rename_at_26) == 2)));
+	das_copy(ret_ref_969db291dc506ab1(__context__),3);
+	DAS_ASSERT(((__x_rename_at_23 == 2) && ((*__z_rename_at_26) == 3)));
+	das_copy((*__xx_rename_at_24),4);
+	DAS_ASSERT((((__x_rename_at_23 == 4) && ((*__z_rename_at_26) == 3)) && ((*__xx_rename_at_24) == 4)));
+	add2_ecad6a810a3f93cf(__context__,das_make_block<int32_t &>(__context__,0,0,&__func_info__7cb4105a,[&]()->int32_t &{
+		return das_auto_cast<int32_t &>::cast(__x_rename_at_23);
+	}));
+	DAS_ASSERT((__x_rename_at_23 == 6));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_ret_safe_ref_a028cae6fce9d180
+		aotLib[0x7a1627de2562091] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__, int32_t &  ),&_Func_0x60_ret_safe_ref_a028cae6fce9d180>>();
+	};
+		// add2_ecad6a810a3f93cf
+		aotLib[0xab4ed2f7ace27c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((int32_t &)) const  &  ),&add2_ecad6a810a3f93cf>>();
+	};
+		// ret_ref_969db291dc506ab1
+		aotLib[0x9ade55eb3086afa9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t & (*) ( Context * __context__ ),&ret_ref_969db291dc506ab1>>();
+	};
+		// test_3e1e83161f60fce7
+		aotLib[0xa39f6d925131c335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3e1e83161f60fce7>>();
+	};
+		// [[ init script ]]
+		aotLib[0xaa905eb0936d2ee1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,496 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__2a09a1c0;
+extern StructInfo __struct_info__15934ace;
+extern TypeInfo __type_info__13667ab1;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__100f1dc6;
+extern TypeInfo __type_info__223f839;
+extern TypeInfo __type_info__8e7f17a9;
+extern TypeInfo __type_info__e7206d7e;
+extern TypeInfo __type_info__56069e17;
+extern TypeInfo __type_info__68f2d56;
+extern TypeInfo __type_info__c281ec30;
+extern TypeInfo __type_info__a6c45d85;
+extern TypeInfo __type_info__da3a3148;
+extern TypeInfo __type_info__49b30fc9;
+extern VarInfo __var_info__a039d7eb;
+extern VarInfo __var_info__b6115ae0;
+extern VarInfo __var_info__edbb9830;
+extern VarInfo __var_info__10d44c41;
+extern VarInfo __var_info__dddd3e62;
+extern VarInfo __var_info__a1e3f68;
+extern VarInfo __var_info__c49960e0;
+extern VarInfo __var_info__fb06ea63;
+extern VarInfo __var_info__7ea6208;
+extern VarInfo __var_info__78bf1844;
+extern VarInfo __var_info__bd632b27;
+extern VarInfo __var_info__86f5f4ca;
+extern VarInfo __var_info__b13680a1;
+extern VarInfo __var_info__64463db0;
+extern VarInfo __var_info__2238d8de;
+extern VarInfo __var_info__4dea9484;
+
+TypeInfo * __type_info__b13680a1_arg_types_var_705274304[2] = { &__type_info__c281ec30, &__type_info__56069e17 };
+VarInfo __struct_info__2a09a1c0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__b13680a1_arg_types_var_705274304, nullptr, 2, 0, nullptr, 28, 0xb13680a1, "__lambda", 0 };
+TypeInfo * __type_info__edbb9830_arg_types_var_705274304[1] = { &__type_info__da3a3148 };
+VarInfo __struct_info__2a09a1c0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__edbb9830_arg_types_var_705274304, nullptr, 1, 0, nullptr, 28, 0xedbb9830, "__finalize", 4 };
+VarInfo __struct_info__2a09a1c0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xbd632b27, "__yield", 8 };
+VarInfo __struct_info__2a09a1c0_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xc49960e0, "pinfo", 16 };
+VarInfo __struct_info__2a09a1c0_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x7ea6208, "___loop_at_56_rename_at_56", 24 };
+VarInfo __struct_info__2a09a1c0_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xfb06ea63, "__index_rename_at_56", 28 };
+VarInfo __struct_info__2a09a1c0_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x78bf1844, "___pvar_0_at_56_rename_at_56", 32 };
+VarInfo __struct_info__2a09a1c0_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x64463db0, "___source_0_at_56_rename_at_56", 40 };
+VarInfo * __struct_info__2a09a1c0_fields[8] =  { &__struct_info__2a09a1c0_field_0, &__struct_info__2a09a1c0_field_1, &__struct_info__2a09a1c0_field_2, &__struct_info__2a09a1c0_field_3, &__struct_info__2a09a1c0_field_4, &__struct_info__2a09a1c0_field_5, &__struct_info__2a09a1c0_field_6, &__struct_info__2a09a1c0_field_7 };
+StructInfo __struct_info__2a09a1c0 = {"_lambda_thismodule_55_12_2", __struct_info__2a09a1c0_fields, 8, 48, -1, nullptr, 0x2a09a1c0 };
+TypeInfo * __type_info__a039d7eb_arg_types_var_361974478[2] = { &__type_info__e7206d7e, &__type_info__100f1dc6 };
+VarInfo __struct_info__15934ace_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__13667ab1, nullptr, (TypeInfo **)__type_info__a039d7eb_arg_types_var_361974478, nullptr, 2, 0, nullptr, 28, 0xa039d7eb, "__lambda", 0 };
+TypeInfo * __type_info__86f5f4ca_arg_types_var_361974478[1] = { &__type_info__68f2d56 };
+VarInfo __struct_info__15934ace_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, (TypeInfo **)__type_info__86f5f4ca_arg_types_var_361974478, nullptr, 1, 0, nullptr, 28, 0x86f5f4ca, "__finalize", 4 };
+VarInfo __struct_info__15934ace_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x10d44c41, "__yield", 8 };
+VarInfo __struct_info__15934ace_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x2238d8de, "pinfo", 16 };
+VarInfo __struct_info__15934ace_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xb6115ae0, "___loop_at_75_rename_at_75", 24 };
+VarInfo __struct_info__15934ace_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xdddd3e62, "__index_rename_at_75", 28 };
+VarInfo __struct_info__15934ace_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__48b5725f, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xa1e3f68, "___pvar_0_at_75_rename_at_75", 32 };
+VarInfo __struct_info__15934ace_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 26, 0x4dea9484, "___source_0_at_75_rename_at_75", 40 };
+VarInfo * __struct_info__15934ace_fields[8] =  { &__struct_info__15934ace_field_0, &__struct_info__15934ace_field_1, &__struct_info__15934ace_field_2, &__struct_info__15934ace_field_3, &__struct_info__15934ace_field_4, &__struct_info__15934ace_field_5, &__struct_info__15934ace_field_6, &__struct_info__15934ace_field_7 };
+StructInfo __struct_info__15934ace = {"_lambda_thismodule_74_12_1", __struct_info__15934ace_fields, 8, 48, -1, nullptr, 0x15934ace };
+TypeInfo __type_info__13667ab1 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x13667ab1 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__100f1dc6 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 261, 0x100f1dc6 };
+TypeInfo __type_info__223f839 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x223f839 };
+TypeInfo __type_info__8e7f17a9 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"rtti::TypeInfo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x8e7f17a9 };
+TypeInfo __type_info__e7206d7e = { Type::tStructure, &__struct_info__15934ace, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xe7206d7e };
+TypeInfo __type_info__56069e17 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8e7f17a9, nullptr, nullptr, nullptr, 0, 0, nullptr, 269, 0x56069e17 };
+TypeInfo __type_info__68f2d56 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e7206d7e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x68f2d56 };
+TypeInfo __type_info__c281ec30 = { Type::tStructure, &__struct_info__2a09a1c0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 10, 0xc281ec30 };
+TypeInfo __type_info__a6c45d85 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa6c45d85 };
+TypeInfo __type_info__da3a3148 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c281ec30, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0xda3a3148 };
+TypeInfo * __type_info__49b30fc9_arg_types[2] = { &__type_info__95e97e5e, &__type_info__a6c45d85 };
+const char * __type_info__49b30fc9_arg_names[2] = { "i", "f" };
+TypeInfo __type_info__49b30fc9 = { Type::tVariant, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__49b30fc9_arg_types, (char **)__type_info__49b30fc9_arg_names, 2, 0, nullptr, 62, 0x49b30fc9 };
+
+// unused enumeration CompilationError
+#if 0 // external enum
+namespace rtti {
+
+enum class ConstMatters : int32_t {
+	no = int32_t(0ll),
+	yes = int32_t(1ll),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class RefMatters : int32_t {
+	no = int32_t(0ll),
+	yes = int32_t(1ll),
+};
+}
+#endif // external enum
+#if 0 // external enum
+namespace rtti {
+
+enum class TemporaryMatters : int32_t {
+	no = int32_t(0ll),
+	yes = int32_t(1ll),
+};
+}
+#endif // external enum
+// unused enumeration Type
+namespace  {
+
+struct _lambda_thismodule_74_12_1 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_74_12_1,char * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_74_12_1 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_75_rename_at_75;
+	int32_t __index_rename_at_75;
+	void * ___pvar_0_at_75_rename_at_75;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_75_rename_at_75;
+};
+static_assert(sizeof(_lambda_thismodule_74_12_1)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___loop_at_75_rename_at_75)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,__index_rename_at_75)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___pvar_0_at_75_rename_at_75)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_74_12_1,___source_0_at_75_rename_at_75)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_55_12_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_55_12_2,TypeInfo const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_55_12_2 *)) __finalize;
+	int32_t __yield;
+	TypeInfo const  * pinfo;
+	bool ___loop_at_56_rename_at_56;
+	int32_t __index_rename_at_56;
+	void * ___pvar_0_at_56_rename_at_56;
+	Sequence DAS_COMMENT((int32_t)) ___source_0_at_56_rename_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_55_12_2)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,__finalize)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,__yield)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,pinfo)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,___loop_at_56_rename_at_56)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,__index_rename_at_56)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,___pvar_0_at_56_rename_at_56)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_55_12_2,___source_0_at_56_rename_at_56)==40,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_lambda_thismodule_55_12_2_0x60_finazlier_605e5b2f43e915bc ( Context * __context__, _lambda_thismodule_55_12_2 * ____this_rename_at_55 );
+inline bool _Func_lambda_thismodule_55_12_2_0x60_function_69a4f7563977da4e ( Context * __context__, _lambda_thismodule_55_12_2 & ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 );
+inline void _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c ( Context * __context__, _lambda_thismodule_74_12_1 * ____this_rename_at_74 );
+inline bool _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c ( Context * __context__, _lambda_thismodule_74_12_1 & ____this_rename_at_74, char * & ___yield_74_rename_at_74 );
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_4748992c369f1a7c ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_269 );
+inline void finalize_27b5143577ca2d72 ( Context * __context__, _lambda_thismodule_55_12_2 & ____this_rename_at_55 );
+inline void finalize_7e93fd9ea79f6880 ( Context * __context__, _lambda_thismodule_74_12_1 & ____this_rename_at_74 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_7639323bf0e4f38b ( Context * __context__, TypeInfo const  & __info_rename_at_81 );
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_da36f3457c42fc56 ( Context * __context__, TypeInfo const  & __info_rename_at_70 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_849db0d0a6905782 ( Context * __context__, TypeInfo const  & __info_rename_at_62 );
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_88dcc6712d2a7bd6 ( Context * __context__, TypeInfo const  & __info_rename_at_51 );
+inline bool _Funcrtti_0x60_is_same_type_4f465f822ee29d6a ( Context * __context__, TypeInfo const  & __a_rename_at_13, TypeInfo const  & __b_rename_at_13, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_14, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_15, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_16, bool __topLevel_rename_at_17 );
+inline bool test_d89a930b6049f51d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_lambda_thismodule_55_12_2_0x60_finazlier_605e5b2f43e915bc ( Context * __context__, _lambda_thismodule_55_12_2 * ____this_rename_at_55 )
+{
+	finalize_27b5143577ca2d72(__context__,das_arg<_lambda_thismodule_55_12_2>::pass(das_deref(__context__,____this_rename_at_55)));
+	das_delete_lambda_struct<_lambda_thismodule_55_12_2 *>::clear(__context__,____this_rename_at_55);
+}
+
+inline bool _Func_lambda_thismodule_55_12_2_0x60_function_69a4f7563977da4e ( Context * __context__, _lambda_thismodule_55_12_2 &  ____this_rename_at_55, TypeInfo const  * & ___ryield55_rename_at_55 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_32;
+	switch (____this_rename_at_55.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_55.pinfo->argTypes /*argTypes*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_55.___loop_at_56_rename_at_56,true);
+	das_move(____this_rename_at_55.___source_0_at_56_rename_at_56,(_temp_make_local_56_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_55.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_55.__index_rename_at_56), 0, 4);
+	das_copy(____this_rename_at_55.___pvar_0_at_56_rename_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_55.__index_rename_at_56)));
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_55.___loop_at_56_rename_at_56 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield55_rename_at_55,das_ref(__context__,das_deref(__context__,das_index<TypeInfo * * const >::at(____this_rename_at_55.pinfo->argTypes /*argTypes*/,____this_rename_at_55.__index_rename_at_56,__context__))));
+	das_copy(____this_rename_at_55.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_55.___loop_at_56_rename_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),____this_rename_at_55.___pvar_0_at_56_rename_at_56,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c ( Context * __context__, _lambda_thismodule_74_12_1 * ____this_rename_at_74 )
+{
+	finalize_7e93fd9ea79f6880(__context__,das_arg<_lambda_thismodule_74_12_1>::pass(das_deref(__context__,____this_rename_at_74)));
+	das_delete_lambda_struct<_lambda_thismodule_74_12_1 *>::clear(__context__,____this_rename_at_74);
+}
+
+inline bool _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c ( Context * __context__, _lambda_thismodule_74_12_1 &  ____this_rename_at_74, char * & ___yield_74_rename_at_74 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_75_32;
+	switch (____this_rename_at_74.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_74.pinfo->argNames /*argNames*/ != nullptr) )
+	{
+		goto label_5;
+	};
+	das_copy(____this_rename_at_74.___loop_at_75_rename_at_75,true);
+	das_move(____this_rename_at_74.___source_0_at_75_rename_at_75,(_temp_make_local_75_32 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,mk_range(int32_t(____this_rename_at_74.pinfo->argCount /*argCount*/))))));
+	memset(&(____this_rename_at_74.__index_rename_at_75), 0, 4);
+	das_copy(____this_rename_at_74.___pvar_0_at_75_rename_at_75,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_74.__index_rename_at_75)));
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_74.___loop_at_75_rename_at_75 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_74_rename_at_74,das_index<char * * const >::at(____this_rename_at_74.pinfo->argNames /*argNames*/,____this_rename_at_74.__index_rename_at_75,__context__));
+	das_copy(____this_rename_at_74.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_74.___loop_at_75_rename_at_75),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),____this_rename_at_74.___pvar_0_at_75_rename_at_75,__context__);
+	label_5:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcbuiltin_0x60_each_4748992c369f1a7c ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const  __lam_rename_at_263 )
+{
+	Sequence DAS_COMMENT((char *)) __it_rename_at_265; das_zero(__it_rename_at_265);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((char *))>::pass(__it_rename_at_265),__lam_rename_at_263,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(__it_rename_at_265);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07 ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const  __lam_rename_at_269 )
+{
+	Sequence DAS_COMMENT((TypeInfo *)) __it_rename_at_270; das_zero(__it_rename_at_270);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TypeInfo const ))>::pass(__it_rename_at_270),__lam_rename_at_269,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(__it_rename_at_270);
+}
+
+inline void finalize_27b5143577ca2d72 ( Context * __context__, _lambda_thismodule_55_12_2 &  ____this_rename_at_55 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_55.___source_0_at_56_rename_at_56),__context__);
+	memset(&(____this_rename_at_55), 0, 48);
+}
+
+inline void finalize_7e93fd9ea79f6880 ( Context * __context__, _lambda_thismodule_74_12_1 &  ____this_rename_at_74 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_74.___source_0_at_75_rename_at_75),__context__);
+	memset(&(____this_rename_at_74), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_7639323bf0e4f38b ( Context * __context__, TypeInfo const  &  __info_rename_at_81 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcrtti_0x60_arg_names_any_da36f3457c42fc56(__context__,__info_rename_at_81));
+}
+
+inline Sequence DAS_COMMENT((char *)) _Funcrtti_0x60_arg_names_any_da36f3457c42fc56 ( Context * __context__, TypeInfo const  &  __info_rename_at_70 )
+{
+	TypeInfo const  * __pinfo_rename_at_72 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_70));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char *))>::cast(_Funcbuiltin_0x60_each_4748992c369f1a7c(__context__,das_ascend<bool,_lambda_thismodule_74_12_1>::make(__context__,&__type_info__e7206d7e,(([&]() -> _lambda_thismodule_74_12_1 {
+		_lambda_thismodule_74_12_1 __mks_73;
+		das_zero(__mks_73);
+		das_copy((__mks_73.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_1`function _lambda_thismodule_74_12_1 string#ref*/ 1180853320u))));
+		das_copy((__mks_73.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_74_12_1`finazlier #ptr#_lambda_thismodule_74_12_1#explicit*/ 392220926u))));
+		das_copy((__mks_73.pinfo),(__pinfo_rename_at_72));
+		return __mks_73;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_849db0d0a6905782 ( Context * __context__, TypeInfo const  &  __info_rename_at_62 )
+{
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcrtti_0x60_arg_types_any_88dcc6712d2a7bd6(__context__,__info_rename_at_62));
+}
+
+inline Sequence DAS_COMMENT((TypeInfo const  &)) _Funcrtti_0x60_arg_types_any_88dcc6712d2a7bd6 ( Context * __context__, TypeInfo const  &  __info_rename_at_51 )
+{
+	TypeInfo const  * __pinfo_rename_at_53 = ((TypeInfo const  *)das_ref(__context__,__info_rename_at_51));
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((TypeInfo const  &))>::cast(_Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07(__context__,das_ascend<bool,_lambda_thismodule_55_12_2>::make(__context__,&__type_info__c281ec30,(([&]() -> _lambda_thismodule_55_12_2 {
+		_lambda_thismodule_55_12_2 __mks_54;
+		das_zero(__mks_54);
+		das_copy((__mks_54.__lambda),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_2`function _lambda_thismodule_55_12_2 #ptr##handle#TypeInfo#const#ref*/ 3673097905u))));
+		das_copy((__mks_54.__finalize),(Func(__context__->fnIdxByMangledName(/*_lambda_thismodule_55_12_2`finazlier #ptr#_lambda_thismodule_55_12_2#explicit*/ 2291115514u))));
+		das_copy((__mks_54.pinfo),(__pinfo_rename_at_53));
+		return __mks_54;
+	})()))));
+}
+
+inline bool _Funcrtti_0x60_is_same_type_4f465f822ee29d6a ( Context * __context__, TypeInfo const  &  __a_rename_at_13, TypeInfo const  &  __b_rename_at_13, DAS_COMMENT(bound_enum) das::RefMatters __refMatters_rename_at_14, DAS_COMMENT(bound_enum) das::ConstMatters __constMatters_rename_at_15, DAS_COMMENT(bound_enum) das::TemporaryMatters __temporaryMatters_rename_at_16, bool __topLevel_rename_at_17 )
+{
+	return das_auto_cast<bool>::cast(isSameType(das_cast<TypeInfo const  *>::cast(__a_rename_at_13),das_cast<TypeInfo const  *>::cast(__b_rename_at_13),__refMatters_rename_at_14,__constMatters_rename_at_15,__temporaryMatters_rename_at_16,__topLevel_rename_at_17));
+}
+
+inline bool test_d89a930b6049f51d ( Context * __context__ )
+{
+	Sequence DAS_COMMENT((char *)) _temp_make_local_11_64;
+	Sequence DAS_COMMENT((TypeInfo *)) _temp_make_local_11_80;
+	DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__359c1b32),(__type_info__359c1b32),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+	DAS_VERIFY((!_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__223f839),(__type_info__359c1b32),DAS_COMMENT(bound_enum) das::RefMatters::yes,DAS_COMMENT(bound_enum) das::ConstMatters::yes,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+	TVariant<8,int32_t,float> __v_rename_at_8_ConstRef; das_zero(__v_rename_at_8_ConstRef);
+	TVariant<8,int32_t,float> const  & __v_rename_at_8 = __v_rename_at_8_ConstRef; ;
+	TypeInfo * __vinfo_rename_at_9 = ((TypeInfo *)&((__type_info__49b30fc9)));
+	DAS_ASSERT(((*__vinfo_rename_at_9).argCount /*argCount*/ == 0x2u));
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		// n : string
+		das_iterator<Sequence DAS_COMMENT((char *))> __n_iterator((_temp_make_local_11_64 = (_Funcrtti_0x60_arg_names_7639323bf0e4f38b(__context__,(*__vinfo_rename_at_9)))));
+		char * __n_rename_at_11;
+		__need_loop_11 = __n_iterator.first(__context__,(__n_rename_at_11)) && __need_loop_11;
+		// t : rtti::TypeInfo const&
+		das_iterator<Sequence DAS_COMMENT((TypeInfo const ))> __t_iterator((_temp_make_local_11_80 = (_Funcrtti_0x60_arg_types_849db0d0a6905782(__context__,(*__vinfo_rename_at_9)))));
+		TypeInfo const  * __t_rename_at_11;
+		__need_loop_11 = __t_iterator.first(__context__,(__t_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) && __n_iterator.next(__context__,(__n_rename_at_11)) && __t_iterator.next(__context__,(__t_rename_at_11)) )
+		{
+			if ( __i_rename_at_11 == 0 )
+			{
+				DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_11),cast<char *>::from(((char *) "i")),*__context__)));
+				DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__359c1b32),(*__t_rename_at_11),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+			} else if ( __i_rename_at_11 == 1 )
+			{
+				DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n_rename_at_11),cast<char *>::from(((char *) "f")),*__context__)));
+				DAS_VERIFY((_Funcrtti_0x60_is_same_type_4f465f822ee29d6a(__context__,(__type_info__223f839),(*__t_rename_at_11),DAS_COMMENT(bound_enum) das::RefMatters::no,DAS_COMMENT(bound_enum) das::ConstMatters::no,DAS_COMMENT(bound_enum) das::TemporaryMatters::yes,true)));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+		__n_iterator.close(__context__,(__n_rename_at_11));
+		__t_iterator.close(__context__,(__t_rename_at_11));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_lambda_thismodule_55_12_2_0x60_finazlier_605e5b2f43e915bc
+		aotLib[0x42993cb150b1a286] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_2 *  ),&_Func_lambda_thismodule_55_12_2_0x60_finazlier_605e5b2f43e915bc>>();
+	};
+		// _Func_lambda_thismodule_55_12_2_0x60_function_69a4f7563977da4e
+		aotLib[0xcffbb3e53ae2fd74] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_55_12_2 & , TypeInfo const  * &  ),&_Func_lambda_thismodule_55_12_2_0x60_function_69a4f7563977da4e>>();
+	};
+		// _Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c
+		aotLib[0x7eb33a77334ae283] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_1 *  ),&_Func_lambda_thismodule_74_12_1_0x60_finazlier_abdece1192d36b3c>>();
+	};
+		// _Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c
+		aotLib[0x394d135e2dbbaf5c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_74_12_1 & , char * &  ),&_Func_lambda_thismodule_74_12_1_0x60_function_6355b473ddc73a0c>>();
+	};
+		// _Funcbuiltin_0x60_each_4748992c369f1a7c
+		aotLib[0x42ed895b4b5ab79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,char * &)) const   ),&_Funcbuiltin_0x60_each_4748992c369f1a7c>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07
+		aotLib[0x5a5d3580e8e6af5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TypeInfo const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_f4abf9ffb8fb2f07>>();
+	};
+		// finalize_27b5143577ca2d72
+		aotLib[0xa394fe915e419845] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_55_12_2 &  ),&finalize_27b5143577ca2d72>>();
+	};
+		// finalize_7e93fd9ea79f6880
+		aotLib[0x8c92447f6509533d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_74_12_1 &  ),&finalize_7e93fd9ea79f6880>>();
+	};
+		// _Funcrtti_0x60_arg_names_7639323bf0e4f38b
+		aotLib[0x28f3f1a056a9d59e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_7639323bf0e4f38b>>();
+	};
+		// _Funcrtti_0x60_arg_names_any_da36f3457c42fc56
+		aotLib[0x5a1edc95ab070666] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char *)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_names_any_da36f3457c42fc56>>();
+	};
+		// _Funcrtti_0x60_arg_types_849db0d0a6905782
+		aotLib[0xa6def222bffa6f07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_849db0d0a6905782>>();
+	};
+		// _Funcrtti_0x60_arg_types_any_88dcc6712d2a7bd6
+		aotLib[0xf6e62f97c59a1efe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TypeInfo const  &)) (*) ( Context * __context__, TypeInfo const  &  ),&_Funcrtti_0x60_arg_types_any_88dcc6712d2a7bd6>>();
+	};
+		// _Funcrtti_0x60_is_same_type_4f465f822ee29d6a
+		aotLib[0x825666ceb8d48d7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TypeInfo const  & , TypeInfo const  & , DAS_COMMENT(bound_enum) das::RefMatters , DAS_COMMENT(bound_enum) das::ConstMatters , DAS_COMMENT(bound_enum) das::TemporaryMatters , bool  ),&_Funcrtti_0x60_is_same_type_4f465f822ee29d6a>>();
+	};
+		// test_d89a930b6049f51d
+		aotLib[0x51caec855501b954] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_d89a930b6049f51d>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,90 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline bool _Func_0x60_panic_time_dc1886ec5435f3f9 ( Context * __context__, char * const  __msg_rename_at_1 );
+inline bool test_afbe6cf8fb292f9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Func_0x60_panic_time_dc1886ec5435f3f9 ( Context * __context__, char * const  __msg_rename_at_1 )
+{
+	builtin_throw(__msg_rename_at_1,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline bool test_afbe6cf8fb292f9 ( Context * __context__ )
+{
+	bool __libertad_rename_at_7 = true;
+	das_copy(__libertad_rename_at_7,__libertad_rename_at_7 || _Func_0x60_panic_time_dc1886ec5435f3f9(__context__,((char *) "do not panic")));
+	DAS_SETBOOLOR((__libertad_rename_at_7),(_Func_0x60_panic_time_dc1886ec5435f3f9(__context__,((char *) "now panic"))));
+	das_copy(__libertad_rename_at_7,false);
+	das_copy(__libertad_rename_at_7,__libertad_rename_at_7 && _Func_0x60_panic_time_dc1886ec5435f3f9(__context__,((char *) "do not panic")));
+	DAS_SETBOOLAND((__libertad_rename_at_7),(_Func_0x60_panic_time_dc1886ec5435f3f9(__context__,((char *) "now panic"))));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_panic_time_dc1886ec5435f3f9
+		aotLib[0x93a898485694989d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&_Func_0x60_panic_time_dc1886ec5435f3f9>>();
+	};
+		// test_afbe6cf8fb292f9
+		aotLib[0x345b468eedfdd4c6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_afbe6cf8fb292f9>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
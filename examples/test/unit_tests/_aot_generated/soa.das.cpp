@@ -0,0 +1,433 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require soa
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure SoaInferMacro
+// unused structure SoaStructMacro
+// unused structure SoaVisitor
+namespace  {
+
+struct Particle {
+	float3 pos;
+	float3 vel;
+	int32_t id;
+};
+static_assert(sizeof(Particle)==28,"structure size mismatch with DAS");
+static_assert(offsetof(Particle,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,vel)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle,id)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Particle_SOA {
+	TArray<float3> pos;
+	TArray<float3> vel;
+	TArray<int32_t> id;
+};
+static_assert(sizeof(Particle_SOA)==72,"structure size mismatch with DAS");
+static_assert(offsetof(Particle_SOA,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,vel)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Particle_SOA,id)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_emplace_5c2136ad23cbc7db ( Context * __context__, TArray<float3> & __Arr_rename_at_49, float3 __value_rename_at_49 );
+inline void _Funcbuiltin_0x60_emplace_b35899e298d4eaaf ( Context * __context__, TArray<int32_t> & __Arr_rename_at_49, int32_t __value_rename_at_49 );
+inline void _Funcbuiltin_0x60_erase_55046d2d98452dc7 ( Context * __context__, TArray<float3> & __Arr_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_67, int32_t __at_rename_at_67 );
+inline void _Funcbuiltin_0x60_finalize_98531a3eac92cc54 ( Context * __context__, TArray<float3> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_c00b5fece3d4ea28 ( Context * __context__, TArray<float3> & __Arr_rename_at_37, float3 __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_25, int32_t __newSize_rename_at_25 );
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clear_50eee2d370cd0474 ( Context * __context__, Particle_SOA & ____src_rename_at_4 );
+inline void emplace_1f9695c0dde301e6 ( Context * __context__, Particle_SOA & ____src_rename_at_4, Particle & ____value_rename_at_4 );
+inline void erase_e39fa408d56b2224 ( Context * __context__, Particle_SOA & ____src_rename_at_4, int32_t ____index_rename_at_4 );
+inline void finalize_f45d68332e5565e7 ( Context * __context__, Particle_SOA & ____this_rename_at_4 );
+inline void push_7a752b0c596e33 ( Context * __context__, Particle_SOA & ____src_rename_at_4, Particle const  & ____value_rename_at_4 );
+inline void reserve_514aa92800c027b4 ( Context * __context__, Particle_SOA & ____src_rename_at_4, int32_t ____newSize_rename_at_4 );
+inline void resize_3c4fd34123349e ( Context * __context__, Particle_SOA & ____src_rename_at_4, int32_t ____newSize_rename_at_4 );
+inline bool test_3ab324d804b9888a ( Context * __context__ );
+inline void update_92f77f400eed7d11 ( Context * __context__, Particle_SOA & __p_rename_at_9, float __dt_rename_at_9 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_emplace_5c2136ad23cbc7db ( Context * __context__, TArray<float3> &  __Arr_rename_at_49, float3 __value_rename_at_49 )
+{
+	das_move(__Arr_rename_at_49(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_49),12,__context__),__context__),__value_rename_at_49);
+}
+
+inline void _Funcbuiltin_0x60_emplace_b35899e298d4eaaf ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_49, int32_t __value_rename_at_49 )
+{
+	das_move(__Arr_rename_at_49(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_49),4,__context__),__context__),__value_rename_at_49);
+}
+
+inline void _Funcbuiltin_0x60_erase_55046d2d98452dc7 ( Context * __context__, TArray<float3> &  __Arr_rename_at_67, int32_t __at_rename_at_67 )
+{
+	builtin_array_erase(das_arg<TArray<float3>>::pass(__Arr_rename_at_67),__at_rename_at_67,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_erase_a0d3d30dc9807389 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_67, int32_t __at_rename_at_67 )
+{
+	builtin_array_erase(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_67),__at_rename_at_67,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_98531a3eac92cc54 ( Context * __context__, TArray<float3> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<float3>>::pass(__a_rename_at_186),12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_c00b5fece3d4ea28 ( Context * __context__, TArray<float3> &  __Arr_rename_at_37, float3 __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_37),12,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_reserve_5e4ae50957d101f9 ( Context * __context__, TArray<float3> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<float3>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_25, int32_t __newSize_rename_at_25 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_25),__newSize_rename_at_25,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d3b08ad0141c2c31 ( Context * __context__, TArray<float3> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float3>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,12,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void clear_50eee2d370cd0474 ( Context * __context__, Particle_SOA &  ____src_rename_at_4 )
+{
+	builtin_array_clear(das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),__context__);
+	builtin_array_clear(das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),__context__);
+	builtin_array_clear(das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),__context__);
+}
+
+inline void emplace_1f9695c0dde301e6 ( Context * __context__, Particle_SOA &  ____src_rename_at_4, Particle &  ____value_rename_at_4 )
+{
+	_Funcbuiltin_0x60_emplace_5c2136ad23cbc7db(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),____value_rename_at_4.pos);
+	_Funcbuiltin_0x60_emplace_5c2136ad23cbc7db(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),____value_rename_at_4.vel);
+	_Funcbuiltin_0x60_emplace_b35899e298d4eaaf(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),____value_rename_at_4.id);
+}
+
+inline void erase_e39fa408d56b2224 ( Context * __context__, Particle_SOA &  ____src_rename_at_4, int32_t ____index_rename_at_4 )
+{
+	_Funcbuiltin_0x60_erase_55046d2d98452dc7(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),____index_rename_at_4);
+	_Funcbuiltin_0x60_erase_55046d2d98452dc7(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),____index_rename_at_4);
+	_Funcbuiltin_0x60_erase_a0d3d30dc9807389(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),____index_rename_at_4);
+}
+
+inline void finalize_f45d68332e5565e7 ( Context * __context__, Particle_SOA &  ____this_rename_at_4 )
+{
+	_Funcbuiltin_0x60_finalize_98531a3eac92cc54(__context__,das_arg<TArray<float3>>::pass(____this_rename_at_4.pos));
+	_Funcbuiltin_0x60_finalize_98531a3eac92cc54(__context__,das_arg<TArray<float3>>::pass(____this_rename_at_4.vel));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_4.id));
+	memset(&(____this_rename_at_4), 0, 72);
+}
+
+inline void push_7a752b0c596e33 ( Context * __context__, Particle_SOA &  ____src_rename_at_4, Particle const  &  ____value_rename_at_4 )
+{
+	_Funcbuiltin_0x60_push_c00b5fece3d4ea28(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),____value_rename_at_4.pos);
+	_Funcbuiltin_0x60_push_c00b5fece3d4ea28(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),____value_rename_at_4.vel);
+	_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),____value_rename_at_4.id);
+}
+
+inline void reserve_514aa92800c027b4 ( Context * __context__, Particle_SOA &  ____src_rename_at_4, int32_t ____newSize_rename_at_4 )
+{
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),____newSize_rename_at_4);
+	_Funcbuiltin_0x60_reserve_5e4ae50957d101f9(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),____newSize_rename_at_4);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),____newSize_rename_at_4);
+}
+
+inline void resize_3c4fd34123349e ( Context * __context__, Particle_SOA &  ____src_rename_at_4, int32_t ____newSize_rename_at_4 )
+{
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.pos),____newSize_rename_at_4);
+	_Funcbuiltin_0x60_resize_d3b08ad0141c2c31(__context__,das_arg<TArray<float3>>::pass(____src_rename_at_4.vel),____newSize_rename_at_4);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(____src_rename_at_4.id),____newSize_rename_at_4);
+}
+
+inline bool test_3ab324d804b9888a ( Context * __context__ )
+{
+	Particle_SOA __p_rename_at_15; das_zero(__p_rename_at_15);
+	reserve_514aa92800c027b4(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),10);
+	{
+		bool __need_loop_17 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_17;
+		__need_loop_17 = __t_iterator.first(__context__,(__t_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __t_iterator.next(__context__,(__t_rename_at_17)) )
+		{
+			Particle _temp_make_local_18_128;
+			push_7a752b0c596e33(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),das_arg<Particle>::pass((([&]() -> Particle& {
+				das_copy((_temp_make_local_18_128.pos),(v_splats(__t_rename_at_17)));
+				das_copy((_temp_make_local_18_128.vel),(v_make_vec4f(1.f,2.f,3.f,0.f)));
+				das_copy((_temp_make_local_18_128.id),(__t_rename_at_17));
+				return _temp_make_local_18_128;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_17));
+	};
+	DAS_ASSERT((builtin_array_size(__p_rename_at_15.pos) == 10));
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<float3>>::pass(__p_rename_at_15.pos)) == 10) && (builtin_array_size(das_arg<TArray<float3>>::pass(__p_rename_at_15.vel)) == 10)) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(__p_rename_at_15.id)) == 10)));
+	update_92f77f400eed7d11(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),1.f);
+	{
+		bool __need_loop_22 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_22;
+		__need_loop_22 = __t_iterator.first(__context__,(__t_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __t_iterator.next(__context__,(__t_rename_at_22)) )
+		{
+			DAS_ASSERT((__p_rename_at_15.id(__t_rename_at_22,__context__) == __t_rename_at_22));
+			DAS_ASSERT((SimPolicy<float3>::Equ(__p_rename_at_15.pos(__t_rename_at_22,__context__),(SimPolicy<float3>::Add(v_splats(__t_rename_at_22),v_make_vec4f(1.f,2.f,3.f,0.f),*__context__)),*__context__)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_22));
+	};
+	{
+		bool __need_loop_26 = true;
+		// pos : float3&
+		das_iterator<TArray<float3>> __pos_iterator(__p_rename_at_15.pos);
+		float3 * __pos_rename_at_26;
+		__need_loop_26 = __pos_iterator.first(__context__,(__pos_rename_at_26)) && __need_loop_26;
+		// id : int&
+		das_iterator<TArray<int32_t>> __id_iterator(__p_rename_at_15.id);
+		int32_t * __id_rename_at_26;
+		__need_loop_26 = __id_iterator.first(__context__,(__id_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __pos_iterator.next(__context__,(__pos_rename_at_26)) && __id_iterator.next(__context__,(__id_rename_at_26)) )
+		{
+			DAS_ASSERT((v_extract_x((*__pos_rename_at_26)) /*x*/ == float((*__id_rename_at_26) + 1)));
+		}
+		__pos_iterator.close(__context__,(__pos_rename_at_26));
+		__id_iterator.close(__context__,(__id_rename_at_26));
+	};
+	erase_e39fa408d56b2224(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),0);
+	DAS_ASSERT(((builtin_array_size(__p_rename_at_15.pos) == 9) && (__p_rename_at_15.id(0,__context__) == 1)));
+	Particle __q_rename_at_30 = (([&]() -> Particle {
+		Particle __mks_30;
+		das_zero(__mks_30);
+		das_copy((__mks_30.pos),(v_splats(-1.f)));
+		das_copy((__mks_30.id),(100));
+		return __mks_30;
+	})());
+	emplace_1f9695c0dde301e6(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),das_arg<Particle>::pass(__q_rename_at_30));
+	DAS_ASSERT(((__p_rename_at_15.id(9,__context__) == 100) && (v_extract_y(__p_rename_at_15.pos(9,__context__)) /*y*/ == -1.f)));
+	resize_3c4fd34123349e(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15),20);
+	DAS_ASSERT(((builtin_array_size(__p_rename_at_15.pos) == 20) && (builtin_array_size(das_arg<TArray<float3>>::pass(__p_rename_at_15.vel)) == 20)));
+	clear_50eee2d370cd0474(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15));
+	DAS_ASSERT((builtin_array_size(__p_rename_at_15.pos) == 0));
+	finalize_f45d68332e5565e7(__context__,das_arg<Particle_SOA>::pass(__p_rename_at_15));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void update_92f77f400eed7d11 ( Context * __context__, Particle_SOA &  __p_rename_at_9, float __dt_rename_at_9 )
+{
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__p_rename_at_9.pos)));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			SimPolicy<float3>::SetAdd((char *)&(__p_rename_at_9.pos(__i_rename_at_10,__context__)),(SimPolicy<float3>::MulVecScal(__p_rename_at_9.vel(__i_rename_at_10,__context__),cast<float>::from(__dt_rename_at_9),*__context__)),*__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_emplace_5c2136ad23cbc7db
+		aotLib[0xbfe184148b922aad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_emplace_5c2136ad23cbc7db>>();
+	};
+		// _Funcbuiltin_0x60_emplace_b35899e298d4eaaf
+		aotLib[0xab0fea578fdf6695] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_emplace_b35899e298d4eaaf>>();
+	};
+		// _Funcbuiltin_0x60_erase_55046d2d98452dc7
+		aotLib[0x266839218f8c4cd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_erase_55046d2d98452dc7>>();
+	};
+		// _Funcbuiltin_0x60_erase_a0d3d30dc9807389
+		aotLib[0xc4522b3c0e92475] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_a0d3d30dc9807389>>();
+	};
+		// _Funcbuiltin_0x60_finalize_98531a3eac92cc54
+		aotLib[0x4bfc8cef68576f79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> &  ),&_Funcbuiltin_0x60_finalize_98531a3eac92cc54>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_c00b5fece3d4ea28
+		aotLib[0x92760aba6b084fd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_push_c00b5fece3d4ea28>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_reserve_5e4ae50957d101f9
+		aotLib[0xdc4ac0a7c38b2c45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_reserve_5e4ae50957d101f9>>();
+	};
+		// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+		aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+		// _Funcbuiltin_0x60_resize_d3b08ad0141c2c31
+		aotLib[0x6cbb6db64f4979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , int32_t  ),&_Funcbuiltin_0x60_resize_d3b08ad0141c2c31>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// clear_50eee2d370cd0474
+		aotLib[0x5155a76ddc06d485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA &  ),&clear_50eee2d370cd0474>>();
+	};
+		// emplace_1f9695c0dde301e6
+		aotLib[0x65a97b30319c910a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , Particle &  ),&emplace_1f9695c0dde301e6>>();
+	};
+		// erase_e39fa408d56b2224
+		aotLib[0x40773432e1376c79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , int32_t  ),&erase_e39fa408d56b2224>>();
+	};
+		// finalize_f45d68332e5565e7
+		aotLib[0x24990af013e223cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA &  ),&finalize_f45d68332e5565e7>>();
+	};
+		// push_7a752b0c596e33
+		aotLib[0x168a0f8e86a25407] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , Particle const  &  ),&push_7a752b0c596e33>>();
+	};
+		// reserve_514aa92800c027b4
+		aotLib[0xa2428e7bd77c1398] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , int32_t  ),&reserve_514aa92800c027b4>>();
+	};
+		// resize_3c4fd34123349e
+		aotLib[0xb5dd7f1701ae11cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , int32_t  ),&resize_3c4fd34123349e>>();
+	};
+		// test_3ab324d804b9888a
+		aotLib[0xca5399fc0bdc7d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3ab324d804b9888a>>();
+	};
+		// update_92f77f400eed7d11
+		aotLib[0x3f1711e6bc111ba1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Particle_SOA & , float  ),&update_92f77f400eed7d11>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
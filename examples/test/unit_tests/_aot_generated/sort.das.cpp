@@ -0,0 +1,1581 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern StructInfo __struct_info__b1589007;
+extern TypeInfo __type_info__c894953d;
+extern VarInfo __var_info__de163b27;
+extern VarInfo __var_info__5ed2e652;
+extern VarInfo __var_info__eedd2c27;
+extern VarInfo __var_info__9a0fd5bc;
+extern VarInfo __var_info__e7e9c971;
+extern VarInfo __var_info__2e604ad1;
+extern VarInfo __var_info__b8a999d5;
+extern VarInfo __var_info__cf0d811d;
+extern VarInfo __var_info__f7f1ba84;
+extern VarInfo __var_info__e0e7699c;
+extern VarInfo __var_info__89a10290;
+extern VarInfo __var_info__b879968e;
+extern VarInfo __var_info__6109dfcb;
+extern VarInfo __var_info__640a81ee;
+extern VarInfo __var_info__903f1508;
+extern VarInfo __var_info__45bc46a5;
+extern VarInfo __var_info__644a27a8;
+extern VarInfo __var_info__3254669;
+extern VarInfo __var_info__d35b9577;
+extern VarInfo __var_info__8547d822;
+extern VarInfo __var_info__81bdf0e;
+extern VarInfo __var_info__112ffd27;
+extern VarInfo __var_info__b52a3c86;
+extern VarInfo __var_info__c817f159;
+extern VarInfo __var_info__e5ff793b;
+extern VarInfo __var_info__b245319f;
+extern VarInfo __var_info__f248abbc;
+extern VarInfo __var_info__14e83451;
+extern VarInfo __var_info__50b9dd40;
+extern VarInfo __var_info__eb0b1fe6;
+extern VarInfo __var_info__4b263253;
+extern VarInfo __var_info__3447a682;
+extern VarInfo __var_info__e1594cdb;
+extern VarInfo __var_info__31c7d607;
+extern VarInfo __var_info__eddd2a94;
+extern VarInfo __var_info__e665120f;
+extern VarInfo __var_info__b2e84084;
+extern VarInfo __var_info__bcd36cd1;
+extern VarInfo __var_info__dcb6c22e;
+extern VarInfo __var_info__34f53d6a;
+extern FuncInfo __func_info__b10fd4e2;
+extern FuncInfo __func_info__c3a35c52;
+extern FuncInfo __func_info__27ac9802;
+extern FuncInfo __func_info__f0811382;
+extern FuncInfo __func_info__508d84b6;
+extern FuncInfo __func_info__420e48e4;
+extern FuncInfo __func_info__2de8a522;
+extern FuncInfo __func_info__5396827e;
+extern FuncInfo __func_info__e3b4ac8c;
+extern FuncInfo __func_info__35457e1c;
+extern FuncInfo __func_info__25b18b38;
+extern FuncInfo __func_info__c68b4bc8;
+extern FuncInfo __func_info__c973faee;
+extern FuncInfo __func_info__194109f8;
+extern FuncInfo __func_info__63627cbe;
+extern FuncInfo __func_info__b98c23a2;
+extern FuncInfo __func_info__7e21c71e;
+extern FuncInfo __func_info__bcd8c1a6;
+extern FuncInfo __func_info__a475d94a;
+
+VarInfo __struct_info__b1589007_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeedd2c27, "x", 0 };
+VarInfo __struct_info__b1589007_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xeddd2a94, "y", 4 };
+VarInfo * __struct_info__b1589007_fields[2] =  { &__struct_info__b1589007_field_0, &__struct_info__b1589007_field_1 };
+StructInfo __struct_info__b1589007 = {"Foo", __struct_info__b1589007_fields, 2, 8, -1, nullptr, 0xb1589007 };
+VarInfo __func_info__b10fd4e2_field_0 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x45bc46a5, "a", 0 };
+VarInfo __func_info__b10fd4e2_field_1 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x81bdf0e, "b", 0 };
+VarInfo * __func_info__b10fd4e2_fields[2] =  { &__func_info__b10fd4e2_field_0, &__func_info__b10fd4e2_field_1 };
+FuncInfo __func_info__b10fd4e2 = {"invoke block<(a:double const;b:double const):bool> const", "", __func_info__b10fd4e2_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xb10fd4e2, 0x0 };
+VarInfo __func_info__c3a35c52_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xe5ff793b, "a", 0 };
+VarInfo __func_info__c3a35c52_field_1 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xb879968e, "b", 0 };
+VarInfo * __func_info__c3a35c52_fields[2] =  { &__func_info__c3a35c52_field_0, &__func_info__c3a35c52_field_1 };
+FuncInfo __func_info__c3a35c52 = {"invoke block<(a:uint64 const explicit;b:uint64 const explicit):bool> const", "", __func_info__c3a35c52_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc3a35c52, 0x0 };
+VarInfo __func_info__27ac9802_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xc817f159, "a", 0 };
+VarInfo __func_info__27ac9802_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xeb0b1fe6, "b", 0 };
+VarInfo * __func_info__27ac9802_fields[2] =  { &__func_info__27ac9802_field_0, &__func_info__27ac9802_field_1 };
+FuncInfo __func_info__27ac9802 = {"invoke block<(a:string const;b:string const):bool> const", "", __func_info__27ac9802_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x27ac9802, 0x0 };
+VarInfo __func_info__f0811382_field_0 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x3447a682, "a", 0 };
+VarInfo __func_info__f0811382_field_1 =  { Type::tUInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x14e83451, "b", 0 };
+VarInfo * __func_info__f0811382_fields[2] =  { &__func_info__f0811382_field_0, &__func_info__f0811382_field_1 };
+FuncInfo __func_info__f0811382 = {"invoke block<(a:uint64 const;b:uint64 const):bool> const", "", __func_info__f0811382_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xf0811382, 0x0 };
+VarInfo __func_info__508d84b6_field_0 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x8547d822, "a", 0 };
+VarInfo __func_info__508d84b6_field_1 =  { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x112ffd27, "b", 0 };
+VarInfo * __func_info__508d84b6_fields[2] =  { &__func_info__508d84b6_field_0, &__func_info__508d84b6_field_1 };
+FuncInfo __func_info__508d84b6 = {"invoke block<(a:double const explicit;b:double const explicit):bool> const", "", __func_info__508d84b6_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x508d84b6, 0x0 };
+VarInfo __func_info__420e48e4_field_0 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x50b9dd40, "a", 0 };
+VarInfo __func_info__420e48e4_field_1 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x31c7d607, "b", 0 };
+VarInfo * __func_info__420e48e4_fields[2] =  { &__func_info__420e48e4_field_0, &__func_info__420e48e4_field_1 };
+FuncInfo __func_info__420e48e4 = {"invoke block<(a:int64 const explicit;b:int64 const explicit):bool> const", "", __func_info__420e48e4_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x420e48e4, 0x0 };
+VarInfo __func_info__2de8a522_field_0 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xb52a3c86, "a", 0 };
+VarInfo __func_info__2de8a522_field_1 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0xe665120f, "b", 0 };
+VarInfo * __func_info__2de8a522_fields[2] =  { &__func_info__2de8a522_field_0, &__func_info__2de8a522_field_1 };
+FuncInfo __func_info__2de8a522 = {"invoke block<(a:string const explicit;b:string const explicit):bool> const", "", __func_info__2de8a522_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x2de8a522, 0x0 };
+VarInfo __func_info__5396827e_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xbcd36cd1, "a", 0 };
+VarInfo __func_info__5396827e_field_1 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x89a10290, "b", 0 };
+VarInfo * __func_info__5396827e_fields[2] =  { &__func_info__5396827e_field_0, &__func_info__5396827e_field_1 };
+FuncInfo __func_info__5396827e = {"invoke block<(a:uint const explicit;b:uint const explicit):bool> const", "", __func_info__5396827e_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x5396827e, 0x0 };
+VarInfo __func_info__e3b4ac8c_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x903f1508, "x", 0 };
+VarInfo __func_info__e3b4ac8c_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x3254669, "y", 0 };
+VarInfo * __func_info__e3b4ac8c_fields[2] =  { &__func_info__e3b4ac8c_field_0, &__func_info__e3b4ac8c_field_1 };
+FuncInfo __func_info__e3b4ac8c = {"invoke block<(x:Foo const explicit;y:Foo const explicit):bool> const", "", __func_info__e3b4ac8c_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xe3b4ac8c, 0x0 };
+VarInfo __func_info__35457e1c_field_0 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x4b263253, "a", 0 };
+VarInfo __func_info__35457e1c_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xb2e84084, "b", 0 };
+VarInfo * __func_info__35457e1c_fields[2] =  { &__func_info__35457e1c_field_0, &__func_info__35457e1c_field_1 };
+FuncInfo __func_info__35457e1c = {"invoke block<(a:float const explicit;b:float const explicit):bool> const", "", __func_info__35457e1c_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x35457e1c, 0x0 };
+VarInfo __func_info__25b18b38_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x2e604ad1, "a", 0 };
+VarInfo __func_info__25b18b38_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x5ed2e652, "b", 0 };
+VarInfo * __func_info__25b18b38_fields[2] =  { &__func_info__25b18b38_field_0, &__func_info__25b18b38_field_1 };
+FuncInfo __func_info__25b18b38 = {"invoke block<(a:Foo const explicit;b:Foo const explicit):bool> const", "", __func_info__25b18b38_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x25b18b38, 0x0 };
+VarInfo __func_info__c68b4bc8_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0xb245319f, "x", 0 };
+VarInfo __func_info__c68b4bc8_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0xf7f1ba84, "y", 0 };
+VarInfo * __func_info__c68b4bc8_fields[2] =  { &__func_info__c68b4bc8_field_0, &__func_info__c68b4bc8_field_1 };
+FuncInfo __func_info__c68b4bc8 = {"invoke block<(x:Foo const;y:Foo const):bool> const", "", __func_info__c68b4bc8_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc68b4bc8, 0x0 };
+VarInfo __func_info__c973faee_field_0 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0x9a0fd5bc, "a", 0 };
+VarInfo __func_info__c973faee_field_1 =  { Type::tStructure, &__struct_info__b1589007, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 0xb8a999d5, "b", 0 };
+VarInfo * __func_info__c973faee_fields[2] =  { &__func_info__c973faee_field_0, &__func_info__c973faee_field_1 };
+FuncInfo __func_info__c973faee = {"invoke block<(a:Foo const;b:Foo const):bool> const", "", __func_info__c973faee_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xc973faee, 0x0 };
+VarInfo __func_info__194109f8_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xdcb6c22e, "a", 0 };
+VarInfo __func_info__194109f8_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xcf0d811d, "b", 0 };
+VarInfo * __func_info__194109f8_fields[2] =  { &__func_info__194109f8_field_0, &__func_info__194109f8_field_1 };
+FuncInfo __func_info__194109f8 = {"invoke block<(a:int const explicit;b:int const explicit):bool> const", "", __func_info__194109f8_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x194109f8, 0x0 };
+VarInfo __func_info__63627cbe_field_0 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x34f53d6a, "a", 0 };
+VarInfo __func_info__63627cbe_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xe1594cdb, "b", 0 };
+VarInfo * __func_info__63627cbe_fields[2] =  { &__func_info__63627cbe_field_0, &__func_info__63627cbe_field_1 };
+FuncInfo __func_info__63627cbe = {"invoke block<(a:float const;b:float const):bool> const", "", __func_info__63627cbe_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x63627cbe, 0x0 };
+VarInfo __func_info__b98c23a2_field_0 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xde163b27, "a", 0 };
+VarInfo __func_info__b98c23a2_field_1 =  { Type::tInt64, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x640a81ee, "b", 0 };
+VarInfo * __func_info__b98c23a2_fields[2] =  { &__func_info__b98c23a2_field_0, &__func_info__b98c23a2_field_1 };
+FuncInfo __func_info__b98c23a2 = {"invoke block<(a:int64 const;b:int64 const):bool> const", "", __func_info__b98c23a2_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xb98c23a2, 0x0 };
+VarInfo __func_info__7e21c71e_field_0 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xf248abbc, "a", 0 };
+VarInfo __func_info__7e21c71e_field_1 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xd35b9577, "b", 0 };
+VarInfo * __func_info__7e21c71e_fields[2] =  { &__func_info__7e21c71e_field_0, &__func_info__7e21c71e_field_1 };
+FuncInfo __func_info__7e21c71e = {"invoke block<(a:uint const;b:uint const):bool> const", "", __func_info__7e21c71e_fields, 2, 32, &__type_info__c894953d, nullptr,0,0x7e21c71e, 0x0 };
+VarInfo __func_info__bcd8c1a6_field_0 =  { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xe0e7699c, "a", 0 };
+VarInfo __func_info__bcd8c1a6_field_1 =  { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x6109dfcb, "b", 0 };
+VarInfo * __func_info__bcd8c1a6_fields[2] =  { &__func_info__bcd8c1a6_field_0, &__func_info__bcd8c1a6_field_1 };
+FuncInfo __func_info__bcd8c1a6 = {"invoke block<(a:float2 const;b:float2 const):bool> const", "", __func_info__bcd8c1a6_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xbcd8c1a6, 0x0 };
+VarInfo __func_info__a475d94a_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0xe7e9c971, "a", 0 };
+VarInfo __func_info__a475d94a_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x644a27a8, "b", 0 };
+VarInfo * __func_info__a475d94a_fields[2] =  { &__func_info__a475d94a_field_0, &__func_info__a475d94a_field_1 };
+FuncInfo __func_info__a475d94a = {"invoke block<(a:int const;b:int const):bool> const", "", __func_info__a475d94a_fields, 2, 32, &__type_info__c894953d, nullptr,0,0xa475d94a, 0x0 };
+TypeInfo __type_info__c894953d = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xc894953d };
+
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline bool _FuncLess_16d6cf5d18c4f82b ( Context * __context__, Foo const  & __a_rename_at_20, Foo const  & __b_rename_at_20 );
+inline void _Func_0x60_test_sort_8a8c4cf8b0e05f25 ( Context * __context__, TArray<Foo> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_4a267f043cc8b957 ( Context * __context__, TArray<double> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_ae9b1b697eaf8557 ( Context * __context__, TArray<float> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_29f6f552e8dabf51 ( Context * __context__, TArray<int32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_a9d60a5ada03bfbd ( Context * __context__, TArray<int64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_48c47abc9852b52b ( Context * __context__, TArray<char *> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_619fece73ecf6f99 ( Context * __context__, TArray<uint32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_cb92d3c66f120cd5 ( Context * __context__, TArray<uint64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_301d22ae7518135f ( Context * __context__, TDim<Foo,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_5f0e5bfe3e83ca35 ( Context * __context__, TDim<double,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_a09fa417438d570b ( Context * __context__, TDim<float,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_650ff23b098597bf ( Context * __context__, TDim<int32_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_e9e39adb72774cdb ( Context * __context__, TDim<int64_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_ad69b993a774bc11 ( Context * __context__, TDim<char *,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_4f265f69137d147d ( Context * __context__, TDim<uint32_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_1f55fd1580dfeb25 ( Context * __context__, TDim<uint64_t,4> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_comp_4c5aed674f642884 ( Context * __context__, TArray<float2> & __arr_rename_at_10 );
+inline void _Funcbuiltin_0x60_push_6859a1f0b2c36ea2 ( Context * __context__, TArray<float2> & __Arr_rename_at_37, float2 __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<Foo> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void _Funcbuiltin_0x60_sort_c4b0767663b3e4de ( Context * __context__, TArray<Foo> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_290c0806f82000bf ( Context * __context__, TArray<Foo> & __a_rename_at_374, Block DAS_COMMENT((bool,Foo const ,Foo const )) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_700eff4f9f85e7d6 ( Context * __context__, TArray<double> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_d56f761a552d314b ( Context * __context__, TArray<double> & __a_rename_at_374, Block DAS_COMMENT((bool,double,double)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_6ba9372d98336165 ( Context * __context__, TArray<float> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_5c4521e57f1a163e ( Context * __context__, TArray<float> & __a_rename_at_374, Block DAS_COMMENT((bool,float,float)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_d0918d66900a0f52 ( Context * __context__, TArray<float2> & __a_rename_at_374, Block DAS_COMMENT((bool,float2,float2)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_2be166d9ccaf429e ( Context * __context__, TArray<int32_t> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_28f249b006574ea3 ( Context * __context__, TArray<int32_t> & __a_rename_at_374, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_f63659560a0045d0 ( Context * __context__, TArray<int64_t> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_5da2fe17355a4761 ( Context * __context__, TArray<int64_t> & __a_rename_at_374, Block DAS_COMMENT((bool,int64_t,int64_t)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_2000ddafd8d4ca ( Context * __context__, TArray<char *> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_55cecc2d7a82fd7 ( Context * __context__, TArray<char *> & __a_rename_at_374, Block DAS_COMMENT((bool,char * const ,char * const )) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_2a3080a794ae5e5f ( Context * __context__, TArray<uint32_t> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_fde58b4dd06b24f2 ( Context * __context__, TArray<uint32_t> & __a_rename_at_374, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_689bfb0464294569 ( Context * __context__, TArray<uint64_t> & __a_rename_at_344 );
+inline void _Funcbuiltin_0x60_sort_99c76b076505040 ( Context * __context__, TArray<uint64_t> & __a_rename_at_374, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  & __cmp_rename_at_374 );
+inline void _Funcbuiltin_0x60_sort_ee1cbd424bbcef98 ( Context * __context__, TDim<Foo,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_d4104aa8126e0cbb ( Context * __context__, TDim<Foo,4> & __a_rename_at_360, Block DAS_COMMENT((bool,Foo const ,Foo const )) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_4c2da5f6adcd396 ( Context * __context__, TDim<double,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_2c407051e634f1f9 ( Context * __context__, TDim<double,4> & __a_rename_at_360, Block DAS_COMMENT((bool,double,double)) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_dce586ecd3989349 ( Context * __context__, TDim<float,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_e7be6ee946e6ef22 ( Context * __context__, TDim<float,4> & __a_rename_at_360, Block DAS_COMMENT((bool,float,float)) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_872e98e3e55640f7 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_360, Block DAS_COMMENT((bool,int32_t,int32_t)) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_b189ed1e8e0386b6 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_a980c8ede31c7665 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_360, Block DAS_COMMENT((bool,int64_t,int64_t)) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60 ( Context * __context__, TDim<char *,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_991506d6b028c811 ( Context * __context__, TDim<char *,4> & __a_rename_at_360, Block DAS_COMMENT((bool,char * const ,char * const )) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_ebb06941cd0c9e4 ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_360, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  & __cmp_rename_at_360 );
+inline void _Funcbuiltin_0x60_sort_a4b3120f7dbe1103 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_330 );
+inline void _Funcbuiltin_0x60_sort_68d792918abece7a ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_360, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  & __cmp_rename_at_360 );
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_2d7b85a90707e413 ( Context * __context__, TDim<Foo,4> & __a_rename_at_298 );
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_998f6a1e52b8761e ( Context * __context__, TDim<double,4> & __a_rename_at_298 );
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_f893b6b47afcb31d ( Context * __context__, TDim<float,4> & __a_rename_at_298 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_e2e89c0d39ad89c ( Context * __context__, TDim<int32_t,4> & __a_rename_at_298 );
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_7ba8a33ed716f3be ( Context * __context__, TDim<int64_t,4> & __a_rename_at_298 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_c6b12599d166e1ee ( Context * __context__, TDim<char *,4> & __a_rename_at_298 );
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_d9ee2d3cd0e33a1f ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_298 );
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_272facebd5256f9d ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_298 );
+inline bool test_1c1d3a79c697b992 ( Context * __context__ );
+inline void test_vector_sort_ee2101db739d8a4f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _FuncLess_16d6cf5d18c4f82b ( Context * __context__, Foo const  &  __a_rename_at_20, Foo const  &  __b_rename_at_20 )
+{
+	return das_auto_cast<bool>::cast((__a_rename_at_20.x + __a_rename_at_20.y) < (__b_rename_at_20.x + __b_rename_at_20.y));
+}
+
+inline void _Func_0x60_test_sort_8a8c4cf8b0e05f25 ( Context * __context__, TArray<Foo> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_c4b0767663b3e4de(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<Foo>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_16d6cf5d18c4f82b(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_290c0806f82000bf(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1),das_make_block<bool,Foo const  &,Foo const  &>(__context__,112,0,&__func_info__c973faee,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_16d6cf5d18c4f82b(__context__,__a_rename_at_6,__b_rename_at_6)));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_16d6cf5d18c4f82b(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_4a267f043cc8b957 ( Context * __context__, TArray<double> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_700eff4f9f85e7d6(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_d56f761a552d314b(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1),das_make_block<bool,double,double>(__context__,112,0,&__func_info__b10fd4e2,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_ae9b1b697eaf8557 ( Context * __context__, TArray<float> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_6ba9372d98336165(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_5c4521e57f1a163e(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1),das_make_block<bool,float,float>(__context__,112,0,&__func_info__63627cbe,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_29f6f552e8dabf51 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_2be166d9ccaf429e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_28f249b006574ea3(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1),das_make_block<bool,int32_t,int32_t>(__context__,112,0,&__func_info__a475d94a,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_a9d60a5ada03bfbd ( Context * __context__, TArray<int64_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_f63659560a0045d0(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_5da2fe17355a4761(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1),das_make_block<bool,int64_t,int64_t>(__context__,112,0,&__func_info__b98c23a2,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_48c47abc9852b52b ( Context * __context__, TArray<char *> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_2000ddafd8d4ca(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_55cecc2d7a82fd7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1),das_make_block<bool,char * const ,char * const >(__context__,112,0,&__func_info__27ac9802,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__)));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_619fece73ecf6f99 ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_2a3080a794ae5e5f(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_fde58b4dd06b24f2(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1),das_make_block<bool,uint32_t,uint32_t>(__context__,112,0,&__func_info__7e21c71e,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_cb92d3c66f120cd5 ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,144,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_689bfb0464294569(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_99c76b076505040(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1),das_make_block<bool,uint64_t,uint64_t>(__context__,112,0,&__func_info__f0811382,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_301d22ae7518135f ( Context * __context__, TDim<Foo,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_ee1cbd424bbcef98(__context__,das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_16d6cf5d18c4f82b(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_d4104aa8126e0cbb(__context__,das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1),das_make_block<bool,Foo const  &,Foo const  &>(__context__,96,0,&__func_info__25b18b38,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_16d6cf5d18c4f82b(__context__,__a_rename_at_6,__b_rename_at_6)));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_16d6cf5d18c4f82b(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_5f0e5bfe3e83ca35 ( Context * __context__, TDim<double,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_4c2da5f6adcd396(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_2c407051e634f1f9(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1),das_make_block<bool,double,double>(__context__,96,0,&__func_info__508d84b6,[&](double const  __a_rename_at_6, double const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_a09fa417438d570b ( Context * __context__, TDim<float,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_dce586ecd3989349(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_e7be6ee946e6ef22(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1),das_make_block<bool,float,float>(__context__,96,0,&__func_info__35457e1c,[&](float const  __a_rename_at_6, float const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_650ff23b098597bf ( Context * __context__, TDim<int32_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_1c259c4c5d3f70a4(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_872e98e3e55640f7(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,int32_t,int32_t>(__context__,96,0,&__func_info__194109f8,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_e9e39adb72774cdb ( Context * __context__, TDim<int64_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_b189ed1e8e0386b6(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_a980c8ede31c7665(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,int64_t,int64_t>(__context__,96,0,&__func_info__420e48e4,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_ad69b993a774bc11 ( Context * __context__, TDim<char *,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_991506d6b028c811(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1),das_make_block<bool,char * const ,char * const >(__context__,96,0,&__func_info__2de8a522,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__)));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_4f265f69137d147d ( Context * __context__, TDim<uint32_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a5cabb2f0c020b8d(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_ebb06941cd0c9e4(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,uint32_t,uint32_t>(__context__,96,0,&__func_info__5396827e,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_1f55fd1580dfeb25 ( Context * __context__, TDim<uint64_t,4> &  __arr_rename_at_1 ) { das_stack_prologue __prologue(__context__,128,"`test_sort " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_sort_a4b3120f7dbe1103(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_68d792918abece7a(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1),das_make_block<bool,uint64_t,uint64_t>(__context__,96,0,&__func_info__c3a35c52,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6)->bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	}));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}}
+
+inline void _Func_0x60_test_sort_comp_4c5aed674f642884 ( Context * __context__, TArray<float2> &  __arr_rename_at_10 ) { das_stack_prologue __prologue(__context__,128,"`test_sort_comp " DAS_FILE_LINE);
+{
+	int32_t __len_rename_at_11 = ((int32_t)builtin_array_size(das_arg<TArray<float2>>::pass(__arr_rename_at_10)));
+	_Funcbuiltin_0x60_sort_d0918d66900a0f52(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_10),das_make_block<bool,float2,float2>(__context__,96,0,&__func_info__bcd8c1a6,[&](float2 __a_rename_at_12, float2 __b_rename_at_12)->bool{
+		return das_auto_cast<bool>::cast(v_extract_x(__a_rename_at_12) /*x*/ < v_extract_x(__b_rename_at_12) /*x*/);
+	}));
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_11));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_ASSERT((v_extract_x(__arr_rename_at_10((__i_rename_at_14 - 1),__context__)) /*x*/ < v_extract_x(__arr_rename_at_10(__i_rename_at_14,__context__)) /*x*/));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}}
+
+inline void _Funcbuiltin_0x60_push_6859a1f0b2c36ea2 ( Context * __context__, TArray<float2> &  __Arr_rename_at_37, float2 __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<float2>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_df901583a0cdec70 ( Context * __context__, TArray<Foo> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<Foo>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_6640dbff129f8443 ( Context * __context__, TArray<double> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<double>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_d240579333227022 ( Context * __context__, TArray<float> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<float>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_20419c2df14c9d85 ( Context * __context__, TArray<int64_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int64_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_29914d27690eb1e4 ( Context * __context__, TArray<uint32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_48979e8311fe5126 ( Context * __context__, TArray<uint64_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_c4b0767663b3e4de ( Context * __context__, TArray<Foo> &  __a_rename_at_344 ) { das_stack_prologue __prologue(__context__,96,"builtin`sort " DAS_FILE_LINE);
+{
+	builtin_array_lock(das_arg<TArray<Foo>>::pass(__a_rename_at_344),__context__);
+	builtin_sort_any_cblock(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_344(0,__context__))),8,builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_344)),das_make_block<bool,Foo const  &,Foo const  &>(__context__,80,0,&__func_info__c68b4bc8,[&](Foo const  & __x_rename_at_356, Foo const  & __y_rename_at_356)->bool{
+		return das_auto_cast<bool>::cast(_FuncLess_16d6cf5d18c4f82b(__context__,__x_rename_at_356,__y_rename_at_356));
+	}),__context__);
+	builtin_array_unlock(das_arg<TArray<Foo>>::pass(__a_rename_at_344),__context__);
+}}
+
+inline void _Funcbuiltin_0x60_sort_290c0806f82000bf ( Context * __context__, TArray<Foo> &  __a_rename_at_374, Block DAS_COMMENT((bool,Foo const ,Foo const )) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<Foo>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_any_cblock(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_374(0,__context__))),8,builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<Foo>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_700eff4f9f85e7d6 ( Context * __context__, TArray<double> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_d56f761a552d314b ( Context * __context__, TArray<double> &  __a_rename_at_374, Block DAS_COMMENT((bool,double,double)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<double>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_6ba9372d98336165 ( Context * __context__, TArray<float> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_5c4521e57f1a163e ( Context * __context__, TArray<float> &  __a_rename_at_374, Block DAS_COMMENT((bool,float,float)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<float>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_d0918d66900a0f52 ( Context * __context__, TArray<float2> &  __a_rename_at_374, Block DAS_COMMENT((bool,float2,float2)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<float2>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<float2>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<float2>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<float2>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_2be166d9ccaf429e ( Context * __context__, TArray<int32_t> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_28f249b006574ea3 ( Context * __context__, TArray<int32_t> &  __a_rename_at_374, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_f63659560a0045d0 ( Context * __context__, TArray<int64_t> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_5da2fe17355a4761 ( Context * __context__, TArray<int64_t> &  __a_rename_at_374, Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<int64_t>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_2000ddafd8d4ca ( Context * __context__, TArray<char *> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_344),__context__);
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_344(0,__context__))),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_55cecc2d7a82fd7 ( Context * __context__, TArray<char *> &  __a_rename_at_374, Block DAS_COMMENT((bool,char * const ,char * const )) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<char *>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_2a3080a794ae5e5f ( Context * __context__, TArray<uint32_t> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_fde58b4dd06b24f2 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_374, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<uint32_t>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_689bfb0464294569 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_344 )
+{
+	builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_344),__context__);
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_344(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_344)));
+	builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_344),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_99c76b076505040 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_374, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  __cmp_rename_at_374 )
+{
+	builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_374),__context__);
+	builtin_sort_cblock<uint64_t>(das_ref(__context__,__a_rename_at_374(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_374)),__cmp_rename_at_374,__context__);
+	builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_374),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_ee1cbd424bbcef98 ( Context * __context__, TDim<Foo,4> &  __a_rename_at_330 ) { das_stack_prologue __prologue(__context__,96,"builtin`sort " DAS_FILE_LINE);
+{
+	builtin_sort_any_cblock(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_330(0,__context__))),8,4,das_make_block<bool,Foo const  &,Foo const  &>(__context__,80,0,&__func_info__e3b4ac8c,[&](Foo const  & __x_rename_at_341, Foo const  & __y_rename_at_341)->bool{
+		return das_auto_cast<bool>::cast(_FuncLess_16d6cf5d18c4f82b(__context__,__x_rename_at_341,__y_rename_at_341));
+	}),__context__);
+}}
+
+inline void _Funcbuiltin_0x60_sort_d4104aa8126e0cbb ( Context * __context__, TDim<Foo,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,Foo const ,Foo const )) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_any_cblock(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_360(0,__context__))),8,4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_4c2da5f6adcd396 ( Context * __context__, TDim<double,4> &  __a_rename_at_330 )
+{
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_2c407051e634f1f9 ( Context * __context__, TDim<double,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,double,double)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<double>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_dce586ecd3989349 ( Context * __context__, TDim<float,4> &  __a_rename_at_330 )
+{
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_e7be6ee946e6ef22 ( Context * __context__, TDim<float,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,float,float)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<float>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_330 )
+{
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_872e98e3e55640f7 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<int32_t>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_b189ed1e8e0386b6 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_330 )
+{
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_a980c8ede31c7665 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<int64_t>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60 ( Context * __context__, TDim<char *,4> &  __a_rename_at_330 )
+{
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_330(0,__context__))),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_991506d6b028c811 ( Context * __context__, TDim<char *,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,char * const ,char * const )) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<char *>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_330 )
+{
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_ebb06941cd0c9e4 ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<uint32_t>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a4b3120f7dbe1103 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_330 )
+{
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_330(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_68d792918abece7a ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_360, Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  __cmp_rename_at_360 )
+{
+	builtin_sort_cblock<uint64_t>(das_ref(__context__,__a_rename_at_360(0,__context__)),4,__cmp_rename_at_360,__context__);
+}
+
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_2d7b85a90707e413 ( Context * __context__, TDim<Foo,4> &  __a_rename_at_298 )
+{
+	TArray<Foo> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_df901583a0cdec70(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<Foo,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<Foo>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_998f6a1e52b8761e ( Context * __context__, TDim<double,4> &  __a_rename_at_298 )
+{
+	TArray<double> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_6640dbff129f8443(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<double,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<double>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_f893b6b47afcb31d ( Context * __context__, TDim<float,4> &  __a_rename_at_298 )
+{
+	TArray<float> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_d240579333227022(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<float,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<float>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_e2e89c0d39ad89c ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_298 )
+{
+	TArray<int32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_7ba8a33ed716f3be ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_298 )
+{
+	TArray<int64_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_20419c2df14c9d85(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<int64_t,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<int64_t>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_c6b12599d166e1ee ( Context * __context__, TDim<char *,4> &  __a_rename_at_298 )
+{
+	TArray<char *> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<char *>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_d9ee2d3cd0e33a1f ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_298 )
+{
+	TArray<uint32_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_29914d27690eb1e4(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<uint32_t,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<uint32_t>>::cast(__arr_rename_at_299);
+}
+
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_272facebd5256f9d ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_298 )
+{
+	TArray<uint64_t> __arr_rename_at_299; das_zero(__arr_rename_at_299);
+	_Funcbuiltin_0x60_resize_48979e8311fe5126(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_299),4);
+	das_copy(das_cast<TDim<uint64_t,4>>::cast(das_ref(__context__,__arr_rename_at_299(0,__context__))),__a_rename_at_298);
+	return /* <- */ das_auto_cast<TArray<uint64_t>>::cast(__arr_rename_at_299);
+}
+
+inline bool test_1c1d3a79c697b992 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_33_32;
+	TArray<int32_t> _temp_make_local_34_48;
+	TDim<int32_t,4> _temp_make_local_34_80;
+	TDim<uint32_t,4> _temp_make_local_35_96;
+	TArray<uint32_t> _temp_make_local_36_112;
+	TDim<uint32_t,4> _temp_make_local_36_144;
+	TDim<int64_t,4> _temp_make_local_37_160;
+	TArray<int64_t> _temp_make_local_38_192;
+	TDim<int64_t,4> _temp_make_local_38_224;
+	TDim<uint64_t,4> _temp_make_local_39_256;
+	TArray<uint64_t> _temp_make_local_40_288;
+	TDim<uint64_t,4> _temp_make_local_40_320;
+	TDim<float,4> _temp_make_local_41_352;
+	TArray<float> _temp_make_local_42_368;
+	TDim<float,4> _temp_make_local_42_400;
+	TDim<double,4> _temp_make_local_43_416;
+	TArray<double> _temp_make_local_44_448;
+	TDim<double,4> _temp_make_local_44_480;
+	TDim<char *,4> _temp_make_local_46_512;
+	TArray<char *> _temp_make_local_47_544;
+	TDim<char *,4> _temp_make_local_47_576;
+	TDim<Foo,4> _temp_make_local_49_608;
+	TArray<Foo> _temp_make_local_50_640;
+	TDim<Foo,4> _temp_make_local_50_672;
+	_Func_0x60_test_sort_650ff23b098597bf(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_33_32(0,__context__) = 3;
+		_temp_make_local_33_32(1,__context__) = 2;
+		_temp_make_local_33_32(2,__context__) = 4;
+		_temp_make_local_33_32(3,__context__) = 1;
+		return _temp_make_local_33_32;
+	})())));
+	_Func_0x60_test_sort_29f6f552e8dabf51(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_34_48 = (_Funcbuiltin_0x60_to_array_move_e2e89c0d39ad89c(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_34_80(0,__context__) = 3;
+		_temp_make_local_34_80(1,__context__) = 2;
+		_temp_make_local_34_80(2,__context__) = 4;
+		_temp_make_local_34_80(3,__context__) = 1;
+		return _temp_make_local_34_80;
+	})())))))));
+	_Func_0x60_test_sort_4f265f69137d147d(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_35_96(0,__context__) = 0x3u;
+		_temp_make_local_35_96(1,__context__) = 0x2u;
+		_temp_make_local_35_96(2,__context__) = 0x4u;
+		_temp_make_local_35_96(3,__context__) = 0x1u;
+		return _temp_make_local_35_96;
+	})())));
+	_Func_0x60_test_sort_619fece73ecf6f99(__context__,das_arg<TArray<uint32_t>>::pass((_temp_make_local_36_112 = (_Funcbuiltin_0x60_to_array_move_d9ee2d3cd0e33a1f(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_36_144(0,__context__) = 0x3u;
+		_temp_make_local_36_144(1,__context__) = 0x2u;
+		_temp_make_local_36_144(2,__context__) = 0x4u;
+		_temp_make_local_36_144(3,__context__) = 0x1u;
+		return _temp_make_local_36_144;
+	})())))))));
+	_Func_0x60_test_sort_e9e39adb72774cdb(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_37_160(0,__context__) = 3ll;
+		_temp_make_local_37_160(1,__context__) = 2ll;
+		_temp_make_local_37_160(2,__context__) = 4ll;
+		_temp_make_local_37_160(3,__context__) = 1ll;
+		return _temp_make_local_37_160;
+	})())));
+	_Func_0x60_test_sort_a9d60a5ada03bfbd(__context__,das_arg<TArray<int64_t>>::pass((_temp_make_local_38_192 = (_Funcbuiltin_0x60_to_array_move_7ba8a33ed716f3be(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_38_224(0,__context__) = 3ll;
+		_temp_make_local_38_224(1,__context__) = 2ll;
+		_temp_make_local_38_224(2,__context__) = 4ll;
+		_temp_make_local_38_224(3,__context__) = 1ll;
+		return _temp_make_local_38_224;
+	})())))))));
+	_Func_0x60_test_sort_1f55fd1580dfeb25(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_39_256(0,__context__) = 0x3ull;
+		_temp_make_local_39_256(1,__context__) = 0x2ull;
+		_temp_make_local_39_256(2,__context__) = 0x4ull;
+		_temp_make_local_39_256(3,__context__) = 0x1ull;
+		return _temp_make_local_39_256;
+	})())));
+	_Func_0x60_test_sort_cb92d3c66f120cd5(__context__,das_arg<TArray<uint64_t>>::pass((_temp_make_local_40_288 = (_Funcbuiltin_0x60_to_array_move_272facebd5256f9d(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_40_320(0,__context__) = 0x3ull;
+		_temp_make_local_40_320(1,__context__) = 0x2ull;
+		_temp_make_local_40_320(2,__context__) = 0x4ull;
+		_temp_make_local_40_320(3,__context__) = 0x1ull;
+		return _temp_make_local_40_320;
+	})())))))));
+	_Func_0x60_test_sort_a09fa417438d570b(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_41_352(0,__context__) = 3.f;
+		_temp_make_local_41_352(1,__context__) = 2.f;
+		_temp_make_local_41_352(2,__context__) = 4.f;
+		_temp_make_local_41_352(3,__context__) = 1.f;
+		return _temp_make_local_41_352;
+	})())));
+	_Func_0x60_test_sort_ae9b1b697eaf8557(__context__,das_arg<TArray<float>>::pass((_temp_make_local_42_368 = (_Funcbuiltin_0x60_to_array_move_f893b6b47afcb31d(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_42_400(0,__context__) = 3.f;
+		_temp_make_local_42_400(1,__context__) = 2.f;
+		_temp_make_local_42_400(2,__context__) = 4.f;
+		_temp_make_local_42_400(3,__context__) = 1.f;
+		return _temp_make_local_42_400;
+	})())))))));
+	_Func_0x60_test_sort_5f0e5bfe3e83ca35(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_43_416(0,__context__) = 3.;
+		_temp_make_local_43_416(1,__context__) = 2.;
+		_temp_make_local_43_416(2,__context__) = 4.;
+		_temp_make_local_43_416(3,__context__) = 1.;
+		return _temp_make_local_43_416;
+	})())));
+	_Func_0x60_test_sort_4a267f043cc8b957(__context__,das_arg<TArray<double>>::pass((_temp_make_local_44_448 = (_Funcbuiltin_0x60_to_array_move_998f6a1e52b8761e(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_44_480(0,__context__) = 3.;
+		_temp_make_local_44_480(1,__context__) = 2.;
+		_temp_make_local_44_480(2,__context__) = 4.;
+		_temp_make_local_44_480(3,__context__) = 1.;
+		return _temp_make_local_44_480;
+	})())))))));
+	_Func_0x60_test_sort_ad69b993a774bc11(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_46_512(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_46_512(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_46_512(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_46_512(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_46_512;
+	})())));
+	_Func_0x60_test_sort_48c47abc9852b52b(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_544 = (_Funcbuiltin_0x60_to_array_move_c6b12599d166e1ee(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_47_576(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_47_576(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_47_576(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_47_576(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_47_576;
+	})())))))));
+	_Func_0x60_test_sort_301d22ae7518135f(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_49_608(0,__context__).x),(1));
+		das_copy((_temp_make_local_49_608(0,__context__).y),(2));
+		das_copy((_temp_make_local_49_608(1,__context__).x),(1));
+		das_copy((_temp_make_local_49_608(1,__context__).y),(1));
+		das_copy((_temp_make_local_49_608(2,__context__).x),(2));
+		das_copy((_temp_make_local_49_608(2,__context__).y),(2));
+		das_copy((_temp_make_local_49_608(3,__context__).x),(0));
+		das_copy((_temp_make_local_49_608(3,__context__).y),(1));
+		return _temp_make_local_49_608;
+	})())));
+	_Func_0x60_test_sort_8a8c4cf8b0e05f25(__context__,das_arg<TArray<Foo>>::pass((_temp_make_local_50_640 = (_Funcbuiltin_0x60_to_array_move_2d7b85a90707e413(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_50_672(0,__context__).x),(1));
+		das_copy((_temp_make_local_50_672(0,__context__).y),(2));
+		das_copy((_temp_make_local_50_672(1,__context__).x),(1));
+		das_copy((_temp_make_local_50_672(1,__context__).y),(1));
+		das_copy((_temp_make_local_50_672(2,__context__).x),(2));
+		das_copy((_temp_make_local_50_672(2,__context__).y),(2));
+		das_copy((_temp_make_local_50_672(3,__context__).x),(0));
+		das_copy((_temp_make_local_50_672(3,__context__).y),(1));
+		return _temp_make_local_50_672;
+	})())))))));
+	test_vector_sort_ee2101db739d8a4f(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_vector_sort_ee2101db739d8a4f ( Context * __context__ )
+{
+	TArray<float2> __arr_rename_at_24; das_zero(__arr_rename_at_24);
+	_Funcbuiltin_0x60_push_6859a1f0b2c36ea2(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(4.f,0.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6859a1f0b2c36ea2(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(3.f,1.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6859a1f0b2c36ea2(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(5.f,2.f,0.f,0.f));
+	_Func_0x60_test_sort_comp_4c5aed674f642884(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _FuncLess_16d6cf5d18c4f82b
+		aotLib[0x5835c638629a7c2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Foo const  & , Foo const  &  ),&_FuncLess_16d6cf5d18c4f82b>>();
+	};
+		// _Func_0x60_test_sort_8a8c4cf8b0e05f25
+		aotLib[0x30d0e92ce007ea88] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Func_0x60_test_sort_8a8c4cf8b0e05f25>>();
+	};
+		// _Func_0x60_test_sort_4a267f043cc8b957
+		aotLib[0xd1b311621ebfc504] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Func_0x60_test_sort_4a267f043cc8b957>>();
+	};
+		// _Func_0x60_test_sort_ae9b1b697eaf8557
+		aotLib[0xb5a9ff7ed3919454] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_test_sort_ae9b1b697eaf8557>>();
+	};
+		// _Func_0x60_test_sort_29f6f552e8dabf51
+		aotLib[0x184fdbda0da51afc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_test_sort_29f6f552e8dabf51>>();
+	};
+		// _Func_0x60_test_sort_a9d60a5ada03bfbd
+		aotLib[0xb500ffd8519e810c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Func_0x60_test_sort_a9d60a5ada03bfbd>>();
+	};
+		// _Func_0x60_test_sort_48c47abc9852b52b
+		aotLib[0xb9e877ef240501e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Func_0x60_test_sort_48c47abc9852b52b>>();
+	};
+		// _Func_0x60_test_sort_619fece73ecf6f99
+		aotLib[0x599bb4c66a1bebf8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Func_0x60_test_sort_619fece73ecf6f99>>();
+	};
+		// _Func_0x60_test_sort_cb92d3c66f120cd5
+		aotLib[0x70dd95b8f1388967] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Func_0x60_test_sort_cb92d3c66f120cd5>>();
+	};
+		// _Func_0x60_test_sort_301d22ae7518135f
+		aotLib[0x1c267f195ece5fb8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Func_0x60_test_sort_301d22ae7518135f>>();
+	};
+		// _Func_0x60_test_sort_5f0e5bfe3e83ca35
+		aotLib[0xd0b37521db0be6be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Func_0x60_test_sort_5f0e5bfe3e83ca35>>();
+	};
+		// _Func_0x60_test_sort_a09fa417438d570b
+		aotLib[0x78ddccf636521884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Func_0x60_test_sort_a09fa417438d570b>>();
+	};
+		// _Func_0x60_test_sort_650ff23b098597bf
+		aotLib[0x7a3d69693837fbce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Func_0x60_test_sort_650ff23b098597bf>>();
+	};
+		// _Func_0x60_test_sort_e9e39adb72774cdb
+		aotLib[0x7813b7b0870df8e7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Func_0x60_test_sort_e9e39adb72774cdb>>();
+	};
+		// _Func_0x60_test_sort_ad69b993a774bc11
+		aotLib[0xc7e1dd33767e0f09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Func_0x60_test_sort_ad69b993a774bc11>>();
+	};
+		// _Func_0x60_test_sort_4f265f69137d147d
+		aotLib[0xc4e108030319cc60] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Func_0x60_test_sort_4f265f69137d147d>>();
+	};
+		// _Func_0x60_test_sort_1f55fd1580dfeb25
+		aotLib[0xfe1e26892d25d78a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Func_0x60_test_sort_1f55fd1580dfeb25>>();
+	};
+		// _Func_0x60_test_sort_comp_4c5aed674f642884
+		aotLib[0x119aec1a77519c24] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> &  ),&_Func_0x60_test_sort_comp_4c5aed674f642884>>();
+	};
+		// _Funcbuiltin_0x60_push_6859a1f0b2c36ea2
+		aotLib[0x53070a1d67a0b40d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , float2  ),&_Funcbuiltin_0x60_push_6859a1f0b2c36ea2>>();
+	};
+		// _Funcbuiltin_0x60_resize_df901583a0cdec70
+		aotLib[0xd1cfb1c711f572e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> & , int32_t  ),&_Funcbuiltin_0x60_resize_df901583a0cdec70>>();
+	};
+		// _Funcbuiltin_0x60_resize_6640dbff129f8443
+		aotLib[0x5f5728a8af39c939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , int32_t  ),&_Funcbuiltin_0x60_resize_6640dbff129f8443>>();
+	};
+		// _Funcbuiltin_0x60_resize_d240579333227022
+		aotLib[0x40d6b5552dd22f51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , int32_t  ),&_Funcbuiltin_0x60_resize_d240579333227022>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_resize_20419c2df14c9d85
+		aotLib[0xd8c6bad9bc39fd9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_20419c2df14c9d85>>();
+	};
+		// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+		aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+		// _Funcbuiltin_0x60_resize_29914d27690eb1e4
+		aotLib[0xa8bc2d4cd78e1eb5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_29914d27690eb1e4>>();
+	};
+		// _Funcbuiltin_0x60_resize_48979e8311fe5126
+		aotLib[0x9c33afc0a77b395] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_48979e8311fe5126>>();
+	};
+		// _Funcbuiltin_0x60_sort_c4b0767663b3e4de
+		aotLib[0x99345151da85551a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Funcbuiltin_0x60_sort_c4b0767663b3e4de>>();
+	};
+		// _Funcbuiltin_0x60_sort_290c0806f82000bf
+		aotLib[0x126b89dc6a01a669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> & , Block DAS_COMMENT((bool,Foo const ,Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_290c0806f82000bf>>();
+	};
+		// _Funcbuiltin_0x60_sort_700eff4f9f85e7d6
+		aotLib[0xd620f317c9343421] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Funcbuiltin_0x60_sort_700eff4f9f85e7d6>>();
+	};
+		// _Funcbuiltin_0x60_sort_d56f761a552d314b
+		aotLib[0xc3cb5212f90cc289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> & , Block DAS_COMMENT((bool,double,double)) const  &  ),&_Funcbuiltin_0x60_sort_d56f761a552d314b>>();
+	};
+		// _Funcbuiltin_0x60_sort_6ba9372d98336165
+		aotLib[0xa9f1c8e7fed118e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_6ba9372d98336165>>();
+	};
+		// _Funcbuiltin_0x60_sort_5c4521e57f1a163e
+		aotLib[0xb5f79937624ef06d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> & , Block DAS_COMMENT((bool,float,float)) const  &  ),&_Funcbuiltin_0x60_sort_5c4521e57f1a163e>>();
+	};
+		// _Funcbuiltin_0x60_sort_d0918d66900a0f52
+		aotLib[0x3843370f9e3f2b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , Block DAS_COMMENT((bool,float2,float2)) const  &  ),&_Funcbuiltin_0x60_sort_d0918d66900a0f52>>();
+	};
+		// _Funcbuiltin_0x60_sort_2be166d9ccaf429e
+		aotLib[0x824598e6b8d4c9e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_2be166d9ccaf429e>>();
+	};
+		// _Funcbuiltin_0x60_sort_28f249b006574ea3
+		aotLib[0x167ad255bf22d3d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_sort_28f249b006574ea3>>();
+	};
+		// _Funcbuiltin_0x60_sort_f63659560a0045d0
+		aotLib[0x994d48942254bd3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Funcbuiltin_0x60_sort_f63659560a0045d0>>();
+	};
+		// _Funcbuiltin_0x60_sort_5da2fe17355a4761
+		aotLib[0xbdd95a1bd4e67e29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> & , Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  ),&_Funcbuiltin_0x60_sort_5da2fe17355a4761>>();
+	};
+		// _Funcbuiltin_0x60_sort_2000ddafd8d4ca
+		aotLib[0x8f3d3f703a5e7d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_sort_2000ddafd8d4ca>>();
+	};
+		// _Funcbuiltin_0x60_sort_55cecc2d7a82fd7
+		aotLib[0xd60fbbba28327779] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , Block DAS_COMMENT((bool,char * const ,char * const )) const  &  ),&_Funcbuiltin_0x60_sort_55cecc2d7a82fd7>>();
+	};
+		// _Funcbuiltin_0x60_sort_2a3080a794ae5e5f
+		aotLib[0xfd30ce801f2346ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60_sort_2a3080a794ae5e5f>>();
+	};
+		// _Funcbuiltin_0x60_sort_fde58b4dd06b24f2
+		aotLib[0x346d49a20a95e6a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> & , Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  ),&_Funcbuiltin_0x60_sort_fde58b4dd06b24f2>>();
+	};
+		// _Funcbuiltin_0x60_sort_689bfb0464294569
+		aotLib[0x730d6e100ebbd2c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Funcbuiltin_0x60_sort_689bfb0464294569>>();
+	};
+		// _Funcbuiltin_0x60_sort_99c76b076505040
+		aotLib[0x25aa13a9b893d45d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> & , Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  ),&_Funcbuiltin_0x60_sort_99c76b076505040>>();
+	};
+		// _Funcbuiltin_0x60_sort_ee1cbd424bbcef98
+		aotLib[0x9b5ee0150f99394a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_sort_ee1cbd424bbcef98>>();
+	};
+		// _Funcbuiltin_0x60_sort_d4104aa8126e0cbb
+		aotLib[0xafa40a3699b7438d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> & , Block DAS_COMMENT((bool,Foo const ,Foo const )) const  &  ),&_Funcbuiltin_0x60_sort_d4104aa8126e0cbb>>();
+	};
+		// _Funcbuiltin_0x60_sort_4c2da5f6adcd396
+		aotLib[0x449e9217d2003b19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_sort_4c2da5f6adcd396>>();
+	};
+		// _Funcbuiltin_0x60_sort_2c407051e634f1f9
+		aotLib[0xd3ea7100ff9e540d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> & , Block DAS_COMMENT((bool,double,double)) const  &  ),&_Funcbuiltin_0x60_sort_2c407051e634f1f9>>();
+	};
+		// _Funcbuiltin_0x60_sort_dce586ecd3989349
+		aotLib[0x3819943fb55588ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_sort_dce586ecd3989349>>();
+	};
+		// _Funcbuiltin_0x60_sort_e7be6ee946e6ef22
+		aotLib[0x6549bf139953dd25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> & , Block DAS_COMMENT((bool,float,float)) const  &  ),&_Funcbuiltin_0x60_sort_e7be6ee946e6ef22>>();
+	};
+		// _Funcbuiltin_0x60_sort_1c259c4c5d3f70a4
+		aotLib[0xc032c9e931ae4169] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_sort_1c259c4c5d3f70a4>>();
+	};
+		// _Funcbuiltin_0x60_sort_872e98e3e55640f7
+		aotLib[0x521d438434830945] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> & , Block DAS_COMMENT((bool,int32_t,int32_t)) const  &  ),&_Funcbuiltin_0x60_sort_872e98e3e55640f7>>();
+	};
+		// _Funcbuiltin_0x60_sort_b189ed1e8e0386b6
+		aotLib[0xe37778553ae69e1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_sort_b189ed1e8e0386b6>>();
+	};
+		// _Funcbuiltin_0x60_sort_a980c8ede31c7665
+		aotLib[0x75bf37580a7669bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> & , Block DAS_COMMENT((bool,int64_t,int64_t)) const  &  ),&_Funcbuiltin_0x60_sort_a980c8ede31c7665>>();
+	};
+		// _Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60
+		aotLib[0x4b7c46dcbbd6c189] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_sort_6ca8bf1bba8ebf60>>();
+	};
+		// _Funcbuiltin_0x60_sort_991506d6b028c811
+		aotLib[0xe42426ade99d42e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> & , Block DAS_COMMENT((bool,char * const ,char * const )) const  &  ),&_Funcbuiltin_0x60_sort_991506d6b028c811>>();
+	};
+		// _Funcbuiltin_0x60_sort_a5cabb2f0c020b8d
+		aotLib[0xdff65e21b09371f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_sort_a5cabb2f0c020b8d>>();
+	};
+		// _Funcbuiltin_0x60_sort_ebb06941cd0c9e4
+		aotLib[0x8eff2d02dd8ea3d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> & , Block DAS_COMMENT((bool,uint32_t,uint32_t)) const  &  ),&_Funcbuiltin_0x60_sort_ebb06941cd0c9e4>>();
+	};
+		// _Funcbuiltin_0x60_sort_a4b3120f7dbe1103
+		aotLib[0x66dd08442a97bda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_sort_a4b3120f7dbe1103>>();
+	};
+		// _Funcbuiltin_0x60_sort_68d792918abece7a
+		aotLib[0xe844973a1844cc25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> & , Block DAS_COMMENT((bool,uint64_t,uint64_t)) const  &  ),&_Funcbuiltin_0x60_sort_68d792918abece7a>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_2d7b85a90707e413
+		aotLib[0x8deacde5f8b938d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<Foo> (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_to_array_move_2d7b85a90707e413>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_998f6a1e52b8761e
+		aotLib[0xe0d30e43ae383f83] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<double> (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_to_array_move_998f6a1e52b8761e>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_f893b6b47afcb31d
+		aotLib[0x7fda7d5b0d06b0f0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_to_array_move_f893b6b47afcb31d>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_e2e89c0d39ad89c
+		aotLib[0x5df051d8464e4d05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_e2e89c0d39ad89c>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_7ba8a33ed716f3be
+		aotLib[0x66eb4cb59676aca0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int64_t> (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_7ba8a33ed716f3be>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_c6b12599d166e1ee
+		aotLib[0xfc9c57c7ca11c5df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_c6b12599d166e1ee>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_d9ee2d3cd0e33a1f
+		aotLib[0x9d6bc05f5ea63c7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_d9ee2d3cd0e33a1f>>();
+	};
+		// _Funcbuiltin_0x60_to_array_move_272facebd5256f9d
+		aotLib[0x92bdd51437ff3717] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint64_t> (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_272facebd5256f9d>>();
+	};
+		// test_1c1d3a79c697b992
+		aotLib[0x5fa87848837e8b55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1c1d3a79c697b992>>();
+	};
+		// test_vector_sort_ee2101db739d8a4f
+		aotLib[0xf9b207652c0cacb8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_vector_sort_ee2101db739d8a4f>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,262 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__f8263cbe;
+extern FuncInfo __func_info__f9941fe5;
+
+VarInfo __func_info__f9941fe5_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__17c16538, nullptr, nullptr, nullptr, 0, 0, nullptr, 98, 0xf8263cbe, "a", 0 };
+VarInfo * __func_info__f9941fe5_fields[1] =  { &__func_info__f9941fe5_field_0 };
+FuncInfo __func_info__f9941fe5 = {"invoke block<(a:array<string> const#):void> const", "", __func_info__f9941fe5_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0xf9941fe5, 0x0 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Func_0x60_expect0_428af892eaf03276 ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect0_133e77ef5435d80b ( Context * __context__, TArray<char *> const  & __a_rename_at_4 );
+inline void _Func_0x60_expect1_33cd44437a591e58 ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect1_ea64eb2932de03d3 ( Context * __context__, TArray<char *> const  & __a_rename_at_9 );
+inline void _Func_0x60_expect2_680f6ed7d822c3af ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect2_16925944388eb05a ( Context * __context__, TArray<char *> const  & __a_rename_at_14 );
+inline void _Func_0x60_expect3_32920abcffc84399 ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3_675e2b047dbb30fe ( Context * __context__, TArray<char *> const  & __a_rename_at_20 );
+inline void _Func_0x60_expect3o_40590ae7c486ef1b ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline void _Func_0x60_expect3o_5fef53897b0f2f7c ( Context * __context__, TArray<char *> const  & __a_rename_at_27 );
+inline void _Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5 ( Context * __context__, char * const  __text_rename_at_43, char * const  __delim_rename_at_43, Block DAS_COMMENT((void,TArray<char *> const )) const  & __blk_rename_at_43 );
+inline bool test_f0a862a4372e89cb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_expect0_428af892eaf03276 ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(((char *) "")),*__context__)));
+}
+
+inline void _Func_0x60_expect0_133e77ef5435d80b ( Context * __context__, TArray<char *> const  &  __a_rename_at_4 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_4) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_4(0,__context__)),cast<char *>::from(((char *) "")),*__context__)));
+}
+
+inline void _Func_0x60_expect1_33cd44437a591e58 ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+}
+
+inline void _Func_0x60_expect1_ea64eb2932de03d3 ( Context * __context__, TArray<char *> const  &  __a_rename_at_9 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_9) == 1));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_9(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+}
+
+inline void _Func_0x60_expect2_680f6ed7d822c3af ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+}
+
+inline void _Func_0x60_expect2_16925944388eb05a ( Context * __context__, TArray<char *> const  &  __a_rename_at_14 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_14) == 2));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_14(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+}
+
+inline void _Func_0x60_expect3_32920abcffc84399 ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__)));
+}
+
+inline void _Func_0x60_expect3_675e2b047dbb30fe ( Context * __context__, TArray<char *> const  &  __a_rename_at_20 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_20) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(0,__context__)),cast<char *>::from(((char *) "one")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(1,__context__)),cast<char *>::from(((char *) "two")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_20(2,__context__)),cast<char *>::from(((char *) "three")),*__context__)));
+}
+
+inline void _Func_0x60_expect3o_40590ae7c486ef1b ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__)));
+}
+
+inline void _Func_0x60_expect3o_5fef53897b0f2f7c ( Context * __context__, TArray<char *> const  &  __a_rename_at_27 )
+{
+	DAS_ASSERT((builtin_array_size(__a_rename_at_27) == 3));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(0,__context__)),cast<char *>::from(((char *) "o")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(1,__context__)),cast<char *>::from(((char *) "n")),*__context__)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_27(2,__context__)),cast<char *>::from(((char *) "e")),*__context__)));
+}
+
+inline void _Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5 ( Context * __context__, char * const  __text_rename_at_43, char * const  __delim_rename_at_43, Block DAS_COMMENT((void,TArray<char *> const )) const  &  __blk_rename_at_43 )
+{
+	builtin_string_split_by_char(__text_rename_at_43,__delim_rename_at_43,__blk_rename_at_43,__context__);
+}
+
+inline bool test_f0a862a4372e89cb ( Context * __context__ ) { das_stack_prologue __prologue(__context__,704,"test " DAS_FILE_LINE);
+{
+	TArray<char *> _temp_make_local_45_352;
+	TArray<char *> _temp_make_local_46_384;
+	TArray<char *> _temp_make_local_47_416;
+	TArray<char *> _temp_make_local_48_448;
+	TArray<char *> _temp_make_local_49_480;
+	_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5(__context__,((char *) ""),((char *) ""),das_make_block<void,TArray<char *> const  &>(__context__,80,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_35)->void{
+		_Func_0x60_expect0_133e77ef5435d80b(__context__,__a_rename_at_35);
+	}));
+	_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5(__context__,((char *) "one"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,144,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_37)->void{
+		_Func_0x60_expect1_ea64eb2932de03d3(__context__,__a_rename_at_37);
+	}));
+	_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5(__context__,((char *) "one,two"),((char *) ","),das_make_block<void,TArray<char *> const  &>(__context__,208,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_39)->void{
+		_Func_0x60_expect2_16925944388eb05a(__context__,__a_rename_at_39);
+	}));
+	_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5(__context__,((char *) "one,two.three"),((char *) ",."),das_make_block<void,TArray<char *> const  &>(__context__,272,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_41)->void{
+		_Func_0x60_expect3_675e2b047dbb30fe(__context__,__a_rename_at_41);
+	}));
+	_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5(__context__,((char *) "one"),((char *) ""),das_make_block<void,TArray<char *> const  &>(__context__,336,0,&__func_info__f9941fe5,[&](TArray<char *> const  & __a_rename_at_43)->void{
+		_Func_0x60_expect3o_5fef53897b0f2f7c(__context__,__a_rename_at_43);
+	}));
+	_Func_0x60_expect0_428af892eaf03276(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_45_352 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) ""),((char *) ""))))));
+	_Func_0x60_expect1_33cd44437a591e58(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_46_384 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "one"),((char *) ","))))));
+	_Func_0x60_expect2_680f6ed7d822c3af(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_416 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "one,two"),((char *) ","))))));
+	_Func_0x60_expect3_32920abcffc84399(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_48_448 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "one,two.three"),((char *) ",."))))));
+	_Func_0x60_expect3o_40590ae7c486ef1b(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_49_480 = (das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "one"),((char *) ""))))));
+	TArray<char *> __es_rename_at_51_ConstRef; das_zero(__es_rename_at_51_ConstRef); das_move(__es_rename_at_51_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) ""),((char *) "/"))));
+	TArray<char *> const  & __es_rename_at_51 = __es_rename_at_51_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__es_rename_at_51) == 1));
+	TArray<char *> __ese_rename_at_53_ConstRef; das_zero(__ese_rename_at_53_ConstRef); das_move(__ese_rename_at_53_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) ""),((char *) "/"))));
+	TArray<char *> const  & __ese_rename_at_53 = __ese_rename_at_53_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__ese_rename_at_53) == 1));
+	TArray<char *> __e0_rename_at_56_ConstRef; das_zero(__e0_rename_at_56_ConstRef); das_move(__e0_rename_at_56_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "/"),((char *) "/"))));
+	TArray<char *> const  & __e0_rename_at_56 = __e0_rename_at_56_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e0_rename_at_56) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_56(0,__context__)),cast<char *>::from(((char *) "")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e0_rename_at_56(1,__context__)),cast<char *>::from(((char *) "")),*__context__))));
+	TArray<char *> __e1_rename_at_60_ConstRef; das_zero(__e1_rename_at_60_ConstRef); das_move(__e1_rename_at_60_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "/1"),((char *) "/"))));
+	TArray<char *> const  & __e1_rename_at_60 = __e1_rename_at_60_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e1_rename_at_60) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_60(0,__context__)),cast<char *>::from(((char *) "")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e1_rename_at_60(1,__context__)),cast<char *>::from(((char *) "1")),*__context__))));
+	TArray<char *> __e2_rename_at_64_ConstRef; das_zero(__e2_rename_at_64_ConstRef); das_move(__e2_rename_at_64_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "1/"),((char *) "/"))));
+	TArray<char *> const  & __e2_rename_at_64 = __e2_rename_at_64_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e2_rename_at_64) == 2));
+	DAS_ASSERT(((SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_64(0,__context__)),cast<char *>::from(((char *) "1")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e2_rename_at_64(1,__context__)),cast<char *>::from(((char *) "")),*__context__))));
+	TArray<char *> __e3_rename_at_68_ConstRef; das_zero(__e3_rename_at_68_ConstRef); das_move(__e3_rename_at_68_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split_by_chars string#const string#const*/ 2212891483u)),((char *) "1/2/3"),((char *) "/"))));
+	TArray<char *> const  & __e3_rename_at_68 = __e3_rename_at_68_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__e3_rename_at_68) == 3));
+	DAS_ASSERT((((SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_68(0,__context__)),cast<char *>::from(((char *) "1")),*__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_68(1,__context__)),cast<char *>::from(((char *) "2")),*__context__))) && (SimPolicy<char *>::Equ(cast<char *>::from(__e3_rename_at_68(2,__context__)),cast<char *>::from(((char *) "3")),*__context__))));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Func_0x60_expect0_428af892eaf03276
+		aotLib[0x6220a1b7f604d5a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_428af892eaf03276>>();
+	};
+		// _Func_0x60_expect0_133e77ef5435d80b
+		aotLib[0xa12bc529d1505f1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect0_133e77ef5435d80b>>();
+	};
+		// _Func_0x60_expect1_33cd44437a591e58
+		aotLib[0x2b8ee20323bafed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_33cd44437a591e58>>();
+	};
+		// _Func_0x60_expect1_ea64eb2932de03d3
+		aotLib[0x1c4d962fbc8319a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect1_ea64eb2932de03d3>>();
+	};
+		// _Func_0x60_expect2_680f6ed7d822c3af
+		aotLib[0x9573c56543705ee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_680f6ed7d822c3af>>();
+	};
+		// _Func_0x60_expect2_16925944388eb05a
+		aotLib[0x47d8bd0938523641] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect2_16925944388eb05a>>();
+	};
+		// _Func_0x60_expect3_32920abcffc84399
+		aotLib[0x231484077e0c629d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_32920abcffc84399>>();
+	};
+		// _Func_0x60_expect3_675e2b047dbb30fe
+		aotLib[0x356fc81bceb85365] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3_675e2b047dbb30fe>>();
+	};
+		// _Func_0x60_expect3o_40590ae7c486ef1b
+		aotLib[0x80f31952c7bdc8b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_40590ae7c486ef1b>>();
+	};
+		// _Func_0x60_expect3o_5fef53897b0f2f7c
+		aotLib[0x7a034595680649a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> const  &  ),&_Func_0x60_expect3o_5fef53897b0f2f7c>>();
+	};
+		// _Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5
+		aotLib[0x8527eddfddb7979] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , char * const  , Block DAS_COMMENT((void,TArray<char *> const )) const  &  ),&_Funcstrings_boost_0x60_split_by_chars_9466b69c2809f3f5>>();
+	};
+		// test_f0a862a4372e89cb
+		aotLib[0x7ed214250bc6ce2b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f0a862a4372e89cb>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
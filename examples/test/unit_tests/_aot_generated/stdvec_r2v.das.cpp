@@ -0,0 +1,103 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__b7c3bfde;
+extern FuncInfo __func_info__6e739376;
+
+VarInfo __func_info__6e739376_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"UnitTest::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0xb7c3bfde, "arr", 0 };
+VarInfo * __func_info__6e739376_fields[1] =  { &__func_info__6e739376_field_0 };
+FuncInfo __func_info__6e739376 = {"invoke block<(arr:UnitTest::dasvector`TestObjectFoo const):void> const", "", __func_info__6e739376_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x6e739376, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool test_c733949b1500dcbd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_c733949b1500dcbd ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+	testFooArray(das_make_block<void,das::vector<TestObjectFoo> const  &>(__context__,80,0,&__func_info__6e739376,[&](das::vector<TestObjectFoo> const  & __arr_rename_at_5)->void{
+		{
+			bool __need_loop_6 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__arr_rename_at_5.size() /*length*/));
+			int32_t __i_rename_at_6;
+			__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+			for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+			{
+				if ( das_index<das::vector<TestObjectFoo> const >::at(__arr_rename_at_5,__i_rename_at_6,__context__).fooData /*fooData*/ != __i_rename_at_6 )
+				{
+					builtin_throw(((char *) "bad"),__context__);
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_6));
+		};
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_c733949b1500dcbd
+		aotLib[0xd4bf10166ac3af29] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c733949b1500dcbd>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,96 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Storage {
+	int8_t i8;
+	uint8_t ui8;
+	int16_t i16;
+	uint16_t ui16;
+};
+static_assert(sizeof(Storage)==6,"structure size mismatch with DAS");
+static_assert(offsetof(Storage,i8)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Storage,ui8)==1,"structure field offset mismatch with DAS");
+static_assert(offsetof(Storage,i16)==2,"structure field offset mismatch with DAS");
+static_assert(offsetof(Storage,ui16)==4,"structure field offset mismatch with DAS");
+}
+
+inline bool test_9342c5d2ce292f9b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_9342c5d2ce292f9b ( Context * __context__ )
+{
+	Storage __t_rename_at_9; das_zero(__t_rename_at_9); Storage __q_rename_at_9; das_zero(__q_rename_at_9);
+	das_copy(__t_rename_at_9.i8,int8_t(1));
+	das_copy(__t_rename_at_9.ui8,uint8_t(2));
+	das_copy(__t_rename_at_9.i16,int16_t(3));
+	das_copy(__t_rename_at_9.ui16,uint16_t(4));
+	DAS_ASSERT(((((int32_t(__t_rename_at_9.i8) == 1) && (uint32_t(__t_rename_at_9.ui8) == 0x2u)) && (int32_t(__t_rename_at_9.i16) == 3)) && (uint32_t(__t_rename_at_9.ui16) == 0x4u)));
+	int8_t __i8_rename_at_16 = ((int8_t)__t_rename_at_9.i8);
+	das_copy(__q_rename_at_9.i8,__i8_rename_at_16);
+	DAS_ASSERT((int32_t(__q_rename_at_9.i8) == 1));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_9342c5d2ce292f9b
+		aotLib[0x482e88a62e000a39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9342c5d2ce292f9b>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
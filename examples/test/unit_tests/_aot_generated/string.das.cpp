@@ -0,0 +1,133 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__359c1b32;
+
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__359c1b32 };
+
+inline bool test_908aaadcd0ee97e8 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_908aaadcd0ee97e8 ( Context * __context__ )
+{
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__95e97e5e,__FILE__,__LINE__,cast<int32_t>::from(string_to_int(((char *) "11abc"),__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non int string without exception")));
+	}, [&]()
+	{
+	});
+	char * __st_rename_at_58 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_58)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_58),cast<char * const >::from(((char *) "255 hex is "))));
+		format_and_write<int32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_58),((char *) "%2x"),255);
+	},__context__)))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_58),cast<char *>::from(((char *) "255 hex is ff")),*__context__)));
+	int32_t __count_rename_at_63 = 0;
+	int32_t __index_rename_at_64 = 0;
+	{
+		bool __need_loop_65 = true;
+		// ch : int const
+		das_iterator<char * const > __ch_iterator(__st_rename_at_58);
+		int32_t __ch_rename_at_65;
+		__need_loop_65 = __ch_iterator.first(__context__,(__ch_rename_at_65)) && __need_loop_65;
+		for ( ; __need_loop_65 ; __need_loop_65 = __ch_iterator.next(__context__,(__ch_rename_at_65)) )
+		{
+			if ( __ch_rename_at_65 == 53 )
+			{
+				__count_rename_at_63++;
+			};
+			int32_t __chAt_rename_at_68 = ((int32_t)get_character_at(__st_rename_at_58,__index_rename_at_64,__context__));
+			DAS_ASSERT((__ch_rename_at_65 == __chAt_rename_at_68));
+			__index_rename_at_64++;
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_65));
+	};
+	DAS_ASSERT((__count_rename_at_63 == 2));
+	char * __zzs_rename_at_73 = (char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_73)->void{
+		{
+			bool __need_loop_74 = true;
+			// zzx : int const
+			das_iterator<range> __zzx_iterator(range(0,100500));
+			int32_t __zzx_rename_at_74;
+			__need_loop_74 = __zzx_iterator.first(__context__,(__zzx_rename_at_74)) && __need_loop_74;
+			for ( ; __need_loop_74 ; __need_loop_74 = __zzx_iterator.next(__context__,(__zzx_rename_at_74)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_73),cast<int32_t>::from(__zzx_rename_at_74)));
+			}
+			__zzx_iterator.close(__context__,(__zzx_rename_at_74));
+		};
+	},__context__))));
+	delete_string(__zzs_rename_at_73,__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_908aaadcd0ee97e8
+		aotLib[0x5ae0e90c74049b7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_908aaadcd0ee97e8>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,270 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings_boost
+ // require ast_boost
+ // require string_builder
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__f7fba288;
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__17c16538;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__48b5725f;
+extern FuncInfo __func_info__2c47cca3;
+
+FuncInfo __func_info__2c47cca3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__48b5725f, nullptr,0,0x2c47cca3, 0x0 };
+TypeInfo __type_info__f7fba288 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 0xf7fba288 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__17c16538 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x17c16538 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_2[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_3[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_4[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_5[2] = { &__type_info__f7fba288, &__type_info__3ffbf730 };
+TypeInfo * __tinfo_6[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_7[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_8[1] = { &__type_info__359c1b32 };
+TypeInfo * __tinfo_9[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_10[2] = { &__type_info__f7fba288, &__type_info__17c16538 };
+TypeInfo * __tinfo_11[2] = { &__type_info__359c1b32, &__type_info__3ffbf730 };
+// unused enumeration CaptureMode
+// unused enumeration SideEffects
+// unused structure AstCallMacro
+// unused structure AstFunctionAnnotation
+// unused structure AstPassMacro
+// unused structure AstReaderMacro
+// unused structure AstStructureAnnotation
+// unused structure AstVariantMacro
+// unused structure AstVisitor
+// unused enumeration CompilationError
+// unused enumeration ConstMatters
+// unused enumeration RefMatters
+// unused enumeration TemporaryMatters
+// unused enumeration Type
+// unused structure BetterRttiVisitor
+// unused structure MacroMacro
+// unused structure SetupAnyAnnotation
+// unused structure SetupCallMacro
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupInferMacro
+// unused structure SetupReaderMacro
+// unused structure SetupStructureMacro
+// unused structure SetupVariantMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagFunctionMacro
+// unused structure TagStructureAnnotation
+// unused structure AppendToWriteVisitor
+// unused structure StringBuilderInferMacro
+// unused structure StringBuilderVisitor
+// unused structure StringUsesVisitor
+
+inline char * appends_from_block_d9a91bbfbde05927 ( Context * __context__, int32_t __n_rename_at_38 );
+inline char * appends_in_while_4686378cd28f0fcd ( Context * __context__, int32_t __n_rename_at_15 );
+inline char * appends_with_break_165e52bfec8f2647 ( Context * __context__, int32_t __n_rename_at_26 );
+inline char * join_ints_984a24ba5c21fdbe ( Context * __context__, int32_t __n_rename_at_3 );
+inline bool test_15e2cf92018a3dfa ( Context * __context__ );
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  & __blk_rename_at_34 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline char * appends_from_block_d9a91bbfbde05927 ( Context * __context__, int32_t __n_rename_at_38 ) { das_stack_prologue __prologue(__context__,176,"appends_from_block " DAS_FILE_LINE);
+{
+	char * __s_rename_at_39 = (char *)(((char *) ""));
+	das_copy(__s_rename_at_39,((char *)(builtin_build_string_T([&](StringBuilderWriter & __string_builder_writer_rename_at_40)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_40),cast<char *>::from(__s_rename_at_39)));
+		{
+			bool __need_loop_40 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_38));
+			int32_t __i_rename_at_40;
+			__need_loop_40 = __i_iterator.first(__context__,(__i_rename_at_40)) && __need_loop_40;
+			for ( ; __need_loop_40 ; __need_loop_40 = __i_iterator.next(__context__,(__i_rename_at_40)) )
+			{
+				twice_8e54f11b4ead5bbf(__context__,das_make_block<void>(__context__,0,0,&__func_info__2c47cca3,[&]()->void{
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_40),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_2, cast<int32_t>::from(__i_rename_at_40))))));
+				}));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_40));
+		};
+	},__context__))));
+	return das_auto_cast<char *>::cast(__s_rename_at_39);
+}}
+
+inline char * appends_in_while_4686378cd28f0fcd ( Context * __context__, int32_t __n_rename_at_15 )
+{
+	char * __s_rename_at_16 = (char *)(((char *) "a"));
+	int32_t __i_rename_at_17 = 0;
+	das_copy(__s_rename_at_16,((char *)(builtin_build_string_T([&](StringBuilderWriter & __string_builder_writer_rename_at_18)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_3,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_18),cast<char *>::from(__s_rename_at_16)));
+		while ( __i_rename_at_17 < __n_rename_at_15 )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_17,2,*__context__)) == 0 )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_4,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_18),cast<char * const >::from(((char *) "b"))));
+			} else {
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_5,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_18),cast<char * const >::from(((char *) "c"))));
+			};
+			__i_rename_at_17++;
+		};
+	},__context__))));
+	return das_auto_cast<char *>::cast(__s_rename_at_16);
+}
+
+inline char * appends_with_break_165e52bfec8f2647 ( Context * __context__, int32_t __n_rename_at_26 )
+{
+	char * __s_rename_at_27 = (char *)(((char *) ""));
+	das_copy(__s_rename_at_27,((char *)(builtin_build_string_T([&](StringBuilderWriter & __string_builder_writer_rename_at_28)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_6,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_28),cast<char *>::from(__s_rename_at_27)));
+		{
+			bool __need_loop_28 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_26));
+			int32_t __i_rename_at_28;
+			__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+			for ( ; __need_loop_28 ; __need_loop_28 = __i_iterator.next(__context__,(__i_rename_at_28)) )
+			{
+				if ( __i_rename_at_28 == 3 )
+				{
+					break;
+				} else {
+					das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_7,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_28),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_8, cast<int32_t>::from(__i_rename_at_28))))));
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_28));
+		};
+	},__context__))));
+	return das_auto_cast<char *>::cast(__s_rename_at_27);
+}
+
+inline char * join_ints_984a24ba5c21fdbe ( Context * __context__, int32_t __n_rename_at_3 )
+{
+	char * __s_rename_at_4 = (char *)(((char *) ""));
+	das_copy(__s_rename_at_4,((char *)(builtin_build_string_T([&](StringBuilderWriter & __string_builder_writer_rename_at_5)->void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_9,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_5),cast<char *>::from(__s_rename_at_4)));
+		{
+			bool __need_loop_5 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__n_rename_at_3));
+			int32_t __i_rename_at_5;
+			__need_loop_5 = __i_iterator.first(__context__,(__i_rename_at_5)) && __need_loop_5;
+			for ( ; __need_loop_5 ; __need_loop_5 = __i_iterator.next(__context__,(__i_rename_at_5)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_10,cast<StringBuilderWriter &>::from(__string_builder_writer_rename_at_5),cast<char *>::from(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<int32_t>::from(__i_rename_at_5), cast<char * const >::from(((char *) ",")))))));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_5));
+		};
+	},__context__))));
+	return das_auto_cast<char *>::cast(__s_rename_at_4);
+}
+
+inline bool test_15e2cf92018a3dfa ( Context * __context__ )
+{
+	char * __a_rename_at_47 = ((char *)(char *)(join_ints_984a24ba5c21fdbe(__context__,4)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_rename_at_47),cast<char *>::from(((char *) "0,1,2,3,")),*__context__)));
+	char * __c_rename_at_51 = ((char *)(char *)(appends_in_while_4686378cd28f0fcd(__context__,4)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__c_rename_at_51),cast<char *>::from(((char *) "abcbc")),*__context__)));
+	char * __d_rename_at_53 = ((char *)(char *)(appends_with_break_165e52bfec8f2647(__context__,10)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__d_rename_at_53),cast<char *>::from(((char *) "012")),*__context__)));
+	char * __e_rename_at_55 = ((char *)(char *)(appends_from_block_d9a91bbfbde05927(__context__,3)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__e_rename_at_55),cast<char *>::from(((char *) "001122")),*__context__)));
+	char * __f_rename_at_57 = ((char *)(char *)(join_ints_984a24ba5c21fdbe(__context__,0)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__f_rename_at_57),cast<char *>::from(((char *) "")),*__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void twice_8e54f11b4ead5bbf ( Context * __context__, Block DAS_COMMENT((void)) const  &  __blk_rename_at_34 )
+{
+	das_invoke<void>::invoke(__context__,__blk_rename_at_34);
+	das_invoke<void>::invoke(__context__,__blk_rename_at_34);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// appends_from_block_d9a91bbfbde05927
+		aotLib[0x68c4955dfd334cba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&appends_from_block_d9a91bbfbde05927>>();
+	};
+		// appends_in_while_4686378cd28f0fcd
+		aotLib[0x7985f67b8e8a1385] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&appends_in_while_4686378cd28f0fcd>>();
+	};
+		// appends_with_break_165e52bfec8f2647
+		aotLib[0x5de9ff05bbfacca9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&appends_with_break_165e52bfec8f2647>>();
+	};
+		// join_ints_984a24ba5c21fdbe
+		aotLib[0x2ee038ed67190175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, int32_t  ),&join_ints_984a24ba5c21fdbe>>();
+	};
+		// test_15e2cf92018a3dfa
+		aotLib[0x8874601b4cd1d3de] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_15e2cf92018a3dfa>>();
+	};
+		// twice_8e54f11b4ead5bbf
+		aotLib[0xde398c5380df08d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void)) const  &  ),&twice_8e54f11b4ead5bbf>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,207 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__a750bdde;
+extern FuncInfo __func_info__24e491aa;
+
+VarInfo __func_info__24e491aa_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"strings::string_view"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0xa750bdde, "tok", 0 };
+VarInfo * __func_info__24e491aa_fields[1] =  { &__func_info__24e491aa_field_0 };
+FuncInfo __func_info__24e491aa = {"invoke block<(tok:strings::string_view):void> const", "", __func_info__24e491aa_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x24e491aa, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_193 );
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> & __Arr_rename_at_37, char * const  __value_rename_at_37 );
+inline int32_t const  * _Funcstrings_boost_0x60_find_5b22b3868eb87626 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_58, das::StringView const  __at_rename_at_58 );
+inline bool _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_54, das::StringView const  __at_rename_at_54 );
+inline bool test_e2f660feae7e6a9c ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_finalize_acced84d6d724f6e ( Context * __context__, TArray<char *> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<char *>>::pass(__a_rename_at_186),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_bb3702af962b623e ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_193),8,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> &  __Arr_rename_at_37, char * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline int32_t const  * _Funcstrings_boost_0x60_find_5b22b3868eb87626 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_58, das::StringView const  __at_rename_at_58 )
+{
+	return das_auto_cast<int32_t const  *>::cast(builtin_table_find_string_view(__Tab_rename_at_58,__at_rename_at_58,4,__context__));
+}
+
+inline bool _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_54, das::StringView const  __at_rename_at_54 )
+{
+	return das_auto_cast<bool>::cast(builtin_table_find_string_view(__Tab_rename_at_54,__at_rename_at_54,4,__context__) != nullptr);
+}
+
+inline bool test_e2f660feae7e6a9c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"test " DAS_FILE_LINE);
+{
+	das::StringView __sv_rename_at_7 = ((das::StringView)builtin_string_view(((char *) "  key = 42 , pi=3.5  "),__context__));
+	DAS_ASSERT((builtin_string_view_length(__sv_rename_at_7) == 21));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(((char *)(builtin_string_view_to_string(builtin_string_view_strip(__sv_rename_at_7),__context__)))),cast<char *>::from(((char *) "key = 42 , pi=3.5")),*__context__)));
+	DAS_ASSERT((builtin_string_view_equ(builtin_string_view_strip_left(__sv_rename_at_7),builtin_string_view(((char *) "key = 42 , pi=3.5  "),__context__))));
+	DAS_ASSERT((builtin_string_view_equ_string(builtin_string_view_strip_right(__sv_rename_at_7),((char *) "  key = 42 , pi=3.5"))));
+	das::StringView __kv_rename_at_13 = ((das::StringView)builtin_string_view_strip(__sv_rename_at_7));
+	DAS_ASSERT((builtin_string_view_equ_string(builtin_string_view_slice1(__kv_rename_at_13,0,3),((char *) "key"))));
+	DAS_ASSERT((builtin_string_view_equ_string(builtin_string_view_slice2(__kv_rename_at_13,-3),((char *) "3.5"))));
+	DAS_ASSERT((builtin_string_view_empty(builtin_string_view_slice1(__kv_rename_at_13,5,2))));
+	DAS_ASSERT((builtin_string_view_equ_string(builtin_string_view_chop(__kv_rename_at_13,6,2,__context__),((char *) "42"))));
+	DAS_ASSERT((builtin_string_view_to_int(builtin_string_view_chop(__kv_rename_at_13,6,2,__context__)) == 42));
+	DAS_ASSERT((builtin_string_view_to_int(builtin_string_view(((char *) "-17abc"),__context__)) == -17));
+	DAS_ASSERT((builtin_string_view_to_int(builtin_string_view_slice1(builtin_string_view(((char *) "12345"),__context__),0,2)) == 12));
+	DAS_ASSERT((builtin_string_view_to_float(builtin_string_view_slice2(__kv_rename_at_13,-3)) == 3.5f));
+	DAS_ASSERT((get_string_view_character_at(__kv_rename_at_13,0,__context__) == 107));
+	DAS_ASSERT((builtin_string_view_find(__kv_rename_at_13,((char *) "pi"),__context__) == 11));
+	DAS_ASSERT((builtin_string_view_find(__kv_rename_at_13,((char *) "nope"),__context__) == -1));
+	DAS_ASSERT((builtin_string_view_find_char(__kv_rename_at_13,61) == 4));
+	DAS_ASSERT((builtin_string_view_starts_with(__kv_rename_at_13,((char *) "key"),__context__) && builtin_string_view_ends_with(__kv_rename_at_13,((char *) "3.5"),__context__)));
+	DAS_ASSERT((!builtin_string_view_starts_with(builtin_string_view_slice1(__kv_rename_at_13,0,2),((char *) "key"),__context__)));
+	DAS_ASSERT((builtin_string_view_equ(builtin_string_view_slice1(builtin_string_view(((char *) "abc"),__context__),0,2),builtin_string_view(((char *) "ab"),__context__))));
+	DAS_ASSERT((builtin_string_view_nequ(builtin_string_view(((char *) "ab"),__context__),builtin_string_view(((char *) "abc"),__context__))));
+	DAS_ASSERT(((builtin_string_view_less(builtin_string_view(((char *) "ab"),__context__),builtin_string_view(((char *) "abc"),__context__))) && (builtin_string_view_gt(builtin_string_view(((char *) "b"),__context__),builtin_string_view(((char *) "abc"),__context__)))));
+	DAS_ASSERT((builtin_string_equ_string_view(((char *) "ab"),builtin_string_view_slice1(builtin_string_view(((char *) "abc"),__context__),0,2))));
+	DAS_ASSERT((builtin_string_view_hash(builtin_string_view_slice2(builtin_string_view(((char *) "abc"),__context__),1)) == 0x3e2ba9f2u));
+	DAS_ASSERT((builtin_string_view_hash(builtin_string_view(((char *) ""),__context__)) == 0x811c9dc5u));
+	TArray<char *> __tokens_rename_at_38; das_zero(__tokens_rename_at_38);
+	builtin_string_view_tokenize(builtin_string_view(((char *) "a,b,,c,"),__context__),((char *) ","),das_make_block<void,das::StringView>(__context__,144,0,&__func_info__24e491aa,[&](das::StringView __tok_rename_at_39)->void{
+		_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(__tokens_rename_at_38),((char *)(builtin_string_view_to_string(__tok_rename_at_39,__context__))));
+	}),__context__);
+	TArray<char *> __words_rename_at_41_ConstRef; das_zero(__words_rename_at_41_ConstRef); das_move(__words_rename_at_41_ConstRef, ((TArray<char *>)das_invoke_function<TArray<char *>>::invoke_cmres<char * const ,char * const >(__context__,Func(__context__->fnIdxByMangledName(/*@strings_boost::split string#const string#const*/ 3766961595u)),((char *) "a,b,,c,"),((char *) ","))));
+	TArray<char *> const  & __words_rename_at_41 = __words_rename_at_41_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<char *>>::pass(__tokens_rename_at_38)) == builtin_array_size(__words_rename_at_41)));
+	{
+		bool __need_loop_43 = true;
+		// t : string&
+		das_iterator<TArray<char *>> __t_iterator(__tokens_rename_at_38);
+		char * * __t_rename_at_43;
+		__need_loop_43 = __t_iterator.first(__context__,(__t_rename_at_43)) && __need_loop_43;
+		// w : string const&
+		das_iterator<TArray<char *> const > __w_iterator(__words_rename_at_41);
+		char * const  * __w_rename_at_43;
+		__need_loop_43 = __w_iterator.first(__context__,(__w_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __t_iterator.next(__context__,(__t_rename_at_43)) && __w_iterator.next(__context__,(__w_rename_at_43)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from((*__t_rename_at_43)),cast<char *>::from((*__w_rename_at_43)),*__context__)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_43));
+		__w_iterator.close(__context__,(__w_rename_at_43));
+	};
+	int32_t __sum_rename_at_45 = 0;
+	builtin_string_view_tokenize(builtin_string_view(((char *) "1 2 3 4"),__context__),((char *) " "),das_make_block<void,das::StringView>(__context__,288,0,&__func_info__24e491aa,[&](das::StringView __tok_rename_at_46)->void{
+		__sum_rename_at_45 += builtin_string_view_to_int(__tok_rename_at_46);
+	}),__context__);
+	DAS_ASSERT((__sum_rename_at_45 == 10));
+	TTable<char *,int32_t> __tab_rename_at_50; das_zero(__tab_rename_at_50);
+	das_copy(__tab_rename_at_50(((char *) "key"),__context__),1);
+	das_copy(__tab_rename_at_50(((char *) "pi"),__context__),2);
+	DAS_ASSERT((_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50),builtin_string_view_slice1(__kv_rename_at_13,0,3))));
+	DAS_ASSERT((!_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50),builtin_string_view_slice1(__kv_rename_at_13,0,2))));
+	DAS_ASSERT((!_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50),builtin_string_view(((char *) ""),__context__))));
+	das_copy(__tab_rename_at_50(((char *) ""),__context__),3);
+	DAS_ASSERT((_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50),builtin_string_view(((char *) ""),__context__))));
+	int32_t __found_rename_at_58 = 0;
+	builtin_string_view_tokenize(builtin_string_view(((char *) "pi,key,nope"),__context__),((char *) ","),das_make_block<void,das::StringView>(__context__,416,0,&__func_info__24e491aa,[&](das::StringView __tok_rename_at_59)->void{
+		int32_t const  * __pv_rename_at_60 = ((int32_t const  *)_Funcstrings_boost_0x60_find_5b22b3868eb87626(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50),__tok_rename_at_59));
+		if ( __pv_rename_at_60 != nullptr )
+		{
+			__found_rename_at_58 += das_deref(__context__,__pv_rename_at_60);
+		};
+	}),__context__);
+	DAS_ASSERT((__found_rename_at_58 == 3));
+	_Funcbuiltin_0x60_finalize_bb3702af962b623e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_50));
+	_Funcbuiltin_0x60_finalize_acced84d6d724f6e(__context__,das_arg<TArray<char *>>::pass(__tokens_rename_at_38));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_finalize_acced84d6d724f6e
+		aotLib[0x8e77180c055acda1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_finalize_acced84d6d724f6e>>();
+	};
+		// _Funcbuiltin_0x60_finalize_bb3702af962b623e
+		aotLib[0x47ccc641525eada1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_finalize_bb3702af962b623e>>();
+	};
+		// _Funcbuiltin_0x60_push_5caef1f118709d18
+		aotLib[0x80f7de2e45124cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_5caef1f118709d18>>();
+	};
+		// _Funcstrings_boost_0x60_find_5b22b3868eb87626
+		aotLib[0x7ad70c7574fb34d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  * (*) ( Context * __context__, TTable<char *,int32_t> const  & , das::StringView const   ),&_Funcstrings_boost_0x60_find_5b22b3868eb87626>>();
+	};
+		// _Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089
+		aotLib[0x4f594e75ff2a361d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , das::StringView const   ),&_Funcstrings_boost_0x60_key_exists_3a5ce1d898a1089>>();
+	};
+		// test_e2f660feae7e6a9c
+		aotLib[0x3c5b4cb541b891f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e2f660feae7e6a9c>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,167 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Dummy {
+};
+}
+namespace  {
+
+struct Ball {
+	float3 position;
+	float radius;
+};
+static_assert(sizeof(Ball)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Ball,position)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ball,radius)==12,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Balls {
+	Ball a;
+	Ball b;
+};
+static_assert(sizeof(Balls)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Balls,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Balls,b)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L3 {
+	int32_t a;
+};
+static_assert(sizeof(L3)==4,"structure size mismatch with DAS");
+static_assert(offsetof(L3,a)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L2 {
+	L3 * l3;
+};
+static_assert(sizeof(L2)==8,"structure size mismatch with DAS");
+static_assert(offsetof(L2,l3)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct L1 {
+	L2 * l2;
+};
+static_assert(sizeof(L1)==8,"structure size mismatch with DAS");
+static_assert(offsetof(L1,l2)==0,"structure field offset mismatch with DAS");
+}
+
+inline bool test_67993b36853ffdd4 ( Context * __context__ );
+inline void test_ref_ptr_9e5db7a7084e121c ( Context * __context__, Ball * & __a_rename_at_31, Ball * const  __b_rename_at_31 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<L1 *,0x391d2682>(__context__) = nullptr;/*glob*/
+}
+
+inline bool test_67993b36853ffdd4 ( Context * __context__ )
+{
+	Ball * __b_rename_at_54 = das_new<Ball>::make(__context__);
+	das_copy(__b_rename_at_54->position,v_make_vec4f(1.f,2.f,3.f,0.f));
+	das_copy(__b_rename_at_54->radius,5.f);
+	Ball __xb_rename_at_59; das_zero(__xb_rename_at_59); Ball __qb_rename_at_59; das_zero(__qb_rename_at_59);
+	Ball * __qc_rename_at_60 = __b_rename_at_54;
+	Ball * __qd_rename_at_61 = das_new<Ball>::make(__context__);
+	das_copy(__qb_rename_at_59,das_deref(__context__,__qc_rename_at_60));
+	das_copy(__qc_rename_at_60,nullptr);
+	DAS_ASSERT((__qc_rename_at_60 == nullptr));
+	DAS_ASSERT((__qd_rename_at_61 != nullptr));
+	test_ref_ptr_9e5db7a7084e121c(__context__,__qc_rename_at_60,__qd_rename_at_61);
+	DAS_ASSERT((__qc_rename_at_60 == __qd_rename_at_61));
+	das_copy(__qd_rename_at_61,nullptr);
+	DAS_ASSERT((__qd_rename_at_61 == nullptr));
+	DAS_ASSERT((__qd_rename_at_61 != __qc_rename_at_60));
+	das_copy(__xb_rename_at_59,__qb_rename_at_59);
+	int32_t __dummy_rename_at_79 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0x391d2682>(__context__) /*glob*/))),__dummy_rename_at_79),1);
+	DAS_ASSERT((__dummy_rename_at_79 == 1));
+	das_copy(das_global<L1 *,0x391d2682>(__context__) /*glob*/,das_new<L1>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0x391d2682>(__context__) /*glob*/))),__dummy_rename_at_79),2);
+	DAS_ASSERT((__dummy_rename_at_79 == 2));
+	das_copy(das_global<L1 *,0x391d2682>(__context__) /*glob*/->l2,das_new<L2>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0x391d2682>(__context__) /*glob*/))),__dummy_rename_at_79),3);
+	DAS_ASSERT((__dummy_rename_at_79 == 3));
+	das_copy(das_global<L1 *,0x391d2682>(__context__) /*glob*/->l2->l3,das_new<L3>::make(__context__));
+	das_copy(das_null_coalescing<int32_t &>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0x391d2682>(__context__) /*glob*/))),__dummy_rename_at_79),4);
+	DAS_ASSERT((__dummy_rename_at_79 == 3));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation<L3,int32_t,&L3::a>::get(das_safe_navigation_ptr<L2,L3 *,&L2::l3>::get(das_safe_navigation_ptr<L1,L2 *,&L1::l2>::get(das_global<L1 *,0x391d2682>(__context__) /*glob*/))),5) == 4));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_ref_ptr_9e5db7a7084e121c ( Context * __context__, Ball * & __a_rename_at_31, Ball * const  __b_rename_at_31 )
+{
+	das_copy(__a_rename_at_31,__b_rename_at_31);
+	DAS_ASSERT((__a_rename_at_31 == __b_rename_at_31));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_67993b36853ffdd4
+		aotLib[0x69babd328ea9dc1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_67993b36853ffdd4>>();
+	};
+		// test_ref_ptr_9e5db7a7084e121c
+		aotLib[0x37ba0b8928ecd0dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Ball * & , Ball * const   ),&test_ref_ptr_9e5db7a7084e121c>>();
+	};
+		// [[ init script ]]
+		aotLib[0x27d3b4fda0f58cb1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
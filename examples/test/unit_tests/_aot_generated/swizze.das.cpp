@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+namespace  {
+
+struct Foo {
+	bool t;
+	int3 v;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,t)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,v)==4,"structure field offset mismatch with DAS");
+}
+
+inline Foo Foo_d8eca4a3006534df ( Context * __context__ );
+inline bool test_71c1730eeffbe5ed ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo Foo_d8eca4a3006534df ( Context * __context__ )
+{
+	return das_auto_cast<Foo>::cast((([&]() -> Foo {
+		Foo __mks_5;
+		das_zero(__mks_5);
+		das_copy((__mks_5.v),(int3(1,2,3)));
+		return __mks_5;
+	})()));
+}
+
+inline bool test_71c1730eeffbe5ed ( Context * __context__ )
+{
+	int3 __v_rename_at_15 = int3(1,2,3);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_15,int3(1,2,3),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_15)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_15)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_15)) /*z*/ == 3)));
+	DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,0>::swizzle(__v_rename_at_15) /*xy*/,int2(1,2),*__context__)) && (SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,1>::swizzle(__v_rename_at_15) /*yz*/,int2(2,3),*__context__))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,0>::swizzle(__v_rename_at_15) /*zx*/,int2(3,1),*__context__))));
+	DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle<int2,int3,1,0>::swizzle(__v_rename_at_15) /*yx*/,int2(2,1),*__context__)) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,1>::swizzle(__v_rename_at_15) /*zy*/,int2(3,2),*__context__))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,0,2>::swizzle(__v_rename_at_15) /*xz*/,int2(1,3),*__context__))));
+	DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_15,int3(1,2,3),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_15)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_15)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_15)) /*z*/ == 3)));
+	das_copy(das_swizzle_ref<int32_t,int3,0>::swizzle(__v_rename_at_15) /*x*/,11);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_15,int3(11,2,3),*__context__)));
+	das_copy(das_swizzle_ref<int32_t,int3,1>::swizzle(__v_rename_at_15) /*y*/,22);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_15,int3(11,22,3),*__context__)));
+	das_copy(das_swizzle_ref<int32_t,int3,2>::swizzle(__v_rename_at_15) /*z*/,33);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__v_rename_at_15,int3(11,22,33),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_15)) /*x*/ == 11) && (v_extract_yi(v_cast_vec4i(__v_rename_at_15)) /*y*/ == 22)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_15)) /*z*/ == 33)));
+	das_copy(das_swizzle_ref<int2,int3,0>::swizzle(__v_rename_at_15) /*xy*/,int2(1,2));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_15)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_15)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_15)) /*z*/ == 33)));
+	das_copy(das_swizzle_ref<int2,int3,1>::swizzle(__v_rename_at_15) /*yz*/,int2(2,3));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__v_rename_at_15)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__v_rename_at_15)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__v_rename_at_15)) /*z*/ == 3)));
+	das_copy(__v_rename_at_15,int3(11,22,33));
+	DAS_ASSERT((SimPolicy<int3>::Equ(das_swizzle_seq<int3,int3,0>::swizzle(__v_rename_at_15) /*xyz*/,int3(11,22,33),*__context__)));
+	Foo __fv_rename_at_36 = Foo_d8eca4a3006534df(__context__);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_36.v,int3(1,2,3),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_36.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_36.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_36.v)) /*z*/ == 3)));
+	DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,0>::swizzle(__fv_rename_at_36.v) /*xy*/,int2(1,2),*__context__)) && (SimPolicy<int2>::Equ(das_swizzle_seq<int2,int3,1>::swizzle(__fv_rename_at_36.v) /*yz*/,int2(2,3),*__context__))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,0>::swizzle(__fv_rename_at_36.v) /*zx*/,int2(3,1),*__context__))));
+	DAS_ASSERT((((SimPolicy<int2>::Equ(das_swizzle<int2,int3,1,0>::swizzle(__fv_rename_at_36.v) /*yx*/,int2(2,1),*__context__)) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,2,1>::swizzle(__fv_rename_at_36.v) /*zy*/,int2(3,2),*__context__))) && (SimPolicy<int2>::Equ(das_swizzle<int2,int3,0,2>::swizzle(__fv_rename_at_36.v) /*xz*/,int2(1,3),*__context__))));
+	DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_36.v,int3(1,2,3),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_36.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_36.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_36.v)) /*z*/ == 3)));
+	das_copy(das_swizzle_ref<int32_t,int3,0>::swizzle(__fv_rename_at_36.v) /*x*/,11);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_36.v,int3(11,2,3),*__context__)));
+	das_copy(das_swizzle_ref<int32_t,int3,1>::swizzle(__fv_rename_at_36.v) /*y*/,22);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_36.v,int3(11,22,3),*__context__)));
+	das_copy(das_swizzle_ref<int32_t,int3,2>::swizzle(__fv_rename_at_36.v) /*z*/,33);
+	DAS_ASSERT((SimPolicy<int3>::Equ(__fv_rename_at_36.v,int3(11,22,33),*__context__)));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_36.v)) /*x*/ == 11) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_36.v)) /*y*/ == 22)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_36.v)) /*z*/ == 33)));
+	das_copy(das_swizzle_ref<int2,int3,0>::swizzle(__fv_rename_at_36.v) /*xy*/,int2(1,2));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_36.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_36.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_36.v)) /*z*/ == 33)));
+	das_copy(das_swizzle_ref<int2,int3,1>::swizzle(__fv_rename_at_36.v) /*yz*/,int2(2,3));
+	DAS_ASSERT((((v_extract_xi(v_cast_vec4i(__fv_rename_at_36.v)) /*x*/ == 1) && (v_extract_yi(v_cast_vec4i(__fv_rename_at_36.v)) /*y*/ == 2)) && (v_extract_zi(v_cast_vec4i(__fv_rename_at_36.v)) /*z*/ == 3)));
+	das_copy(__fv_rename_at_36.v,int3(11,22,33));
+	DAS_ASSERT((SimPolicy<int3>::Equ(das_swizzle_seq<int3,int3,0>::swizzle(__fv_rename_at_36.v) /*xyz*/,int3(11,22,33),*__context__)));
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// Foo_d8eca4a3006534df
+		aotLib[0xee5b8f27726a37fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_d8eca4a3006534df>>();
+	};
+		// test_71c1730eeffbe5ed
+		aotLib[0x5841e6312d155d80] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_71c1730eeffbe5ed>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
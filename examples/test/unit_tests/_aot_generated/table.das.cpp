@@ -0,0 +1,677 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__359c1b32;
+extern TypeInfo __type_info__95e97e5e;
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__d8687ebe;
+extern VarInfo __var_info__84bd06e2;
+extern VarInfo __var_info__e7fb350e;
+extern VarInfo __var_info__209669f1;
+extern VarInfo __var_info__70b6b61f;
+extern FuncInfo __func_info__9768882b;
+extern FuncInfo __func_info__140259ba;
+extern FuncInfo __func_info__67be37f9;
+extern FuncInfo __func_info__370dd9bb;
+extern FuncInfo __func_info__9f953d46;
+
+VarInfo __func_info__9768882b_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x209669f1, "pVal", 0 };
+VarInfo * __func_info__9768882b_fields[1] =  { &__func_info__9768882b_field_0 };
+FuncInfo __func_info__9768882b = {"invoke block<(pVal:int? const):void> const", "", __func_info__9768882b_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x9768882b, 0x0 };
+VarInfo __func_info__140259ba_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xd8687ebe, "num", 0 };
+VarInfo * __func_info__140259ba_fields[1] =  { &__func_info__140259ba_field_0 };
+FuncInfo __func_info__140259ba = {"invoke block<(num:int? const):void> const", "", __func_info__140259ba_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x140259ba, 0x0 };
+VarInfo __func_info__67be37f9_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0x70b6b61f, "pValue", 0 };
+VarInfo * __func_info__67be37f9_fields[1] =  { &__func_info__67be37f9_field_0 };
+FuncInfo __func_info__67be37f9 = {"invoke block<(pValue:int? const):void> const", "", __func_info__67be37f9_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x67be37f9, 0x0 };
+VarInfo __func_info__370dd9bb_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 12, 0x84bd06e2, "num", 0 };
+VarInfo * __func_info__370dd9bb_fields[1] =  { &__func_info__370dd9bb_field_0 };
+FuncInfo __func_info__370dd9bb = {"invoke block<(num:int? -const):void> const", "", __func_info__370dd9bb_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x370dd9bb, 0x0 };
+VarInfo __func_info__9f953d46_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__95e97e5e, nullptr, nullptr, nullptr, 0, 0, nullptr, 44, 0xe7fb350e, "t", 0 };
+VarInfo * __func_info__9f953d46_fields[1] =  { &__func_info__9f953d46_field_0 };
+FuncInfo __func_info__9f953d46 = {"invoke block<(t:int? const):void> const", "", __func_info__9f953d46_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x9f953d46, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__359c1b32 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x359c1b32 };
+TypeInfo __type_info__95e97e5e = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x95e97e5e };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+TypeInfo * __tinfo_0[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+TypeInfo * __tinfo_2[2] = { &__type_info__3ffbf730, &__type_info__359c1b32 };
+namespace  {
+
+struct TestStruct {
+	char * test;
+};
+static_assert(sizeof(TestStruct)==8,"structure size mismatch with DAS");
+static_assert(offsetof(TestStruct,test)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct TableContainer {
+	TTable<char *,TestStruct> t;
+};
+static_assert(sizeof(TableContainer)==48,"structure size mismatch with DAS");
+static_assert(offsetof(TableContainer,t)==0,"structure field offset mismatch with DAS");
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> & __Tab_rename_at_117, int32_t __at_rename_at_117 );
+inline bool _Funcbuiltin_0x60_erase_2f78cacd7a9e1e9d ( Context * __context__, TTable<char *,TestStruct> & __Tab_rename_at_117, char * const  __at_rename_at_117 );
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_117, char * const  __at_rename_at_117 );
+inline void _Funcbuiltin_0x60_find_344543a0afd94e01 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_76, char * const  __at_rename_at_76, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_76 );
+inline int32_t * _Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_114, char * const  __at_rename_at_114 );
+inline void _Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_100, char * const  __at_rename_at_100, Block DAS_COMMENT((void,int32_t *)) const  & __blk_rename_at_100 );
+inline void _Funcbuiltin_0x60_find_for_edit_if_exists_3d1446f1c50d754a ( Context * __context__, TTable<char *,int32_t> & __Tab_rename_at_106, char * const  __at_rename_at_106, Block DAS_COMMENT((void,int32_t *)) const  & __blk_rename_at_106 );
+inline bool _Funcbuiltin_0x60_find_if_exists_9c7a1aa90dd61329 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_82, char * const  __at_rename_at_82, Block DAS_COMMENT((void,int32_t * const )) const  & __blk_rename_at_82 );
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_2373d8144a7e9849 ( Context * __context__, TTable<char *,int32_t> const  & __a_rename_at_163 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> & __Arr_rename_at_37, char * const  __value_rename_at_37 );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_318 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_57783ad06c4865cf ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_173 );
+inline bool check_e6ece5eee61069bc ( Context * __context__, TableContainer & __t_rename_at_190, TArray<int32_t> const  & __deletedEntries_rename_at_190 );
+inline bool test_f4d04b2b5f5370e7 ( Context * __context__ );
+inline void test_erase_collision_66150921c90310b3 ( Context * __context__ );
+inline bool test_find_391e2bfff7a57e7c ( Context * __context__ );
+inline bool test_lock_panic_81c7b4457b80cc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcbuiltin_0x60_erase_3b06d4792ac86bb9 ( Context * __context__, TTable<int32_t,int32_t> &  __Tab_rename_at_117, int32_t __at_rename_at_117 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_117,__at_rename_at_117));
+}
+
+inline bool _Funcbuiltin_0x60_erase_2f78cacd7a9e1e9d ( Context * __context__, TTable<char *,TestStruct> &  __Tab_rename_at_117, char * const  __at_rename_at_117 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_117,__at_rename_at_117));
+}
+
+inline bool _Funcbuiltin_0x60_erase_ea0fa82112615e17 ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_117, char * const  __at_rename_at_117 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_117,__at_rename_at_117));
+}
+
+inline void _Funcbuiltin_0x60_find_344543a0afd94e01 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_76, char * const  __at_rename_at_76, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_76 )
+{
+	builtin_table_lock(__Tab_rename_at_76,__context__);
+	int32_t * __val_rename_at_78 = __builtin_table_find(__context__,__Tab_rename_at_76,__at_rename_at_76);
+	das_invoke<void>::invoke<int32_t *>(__context__,__blk_rename_at_76,__val_rename_at_78);
+	builtin_table_unlock(__Tab_rename_at_76,__context__);
+}
+
+inline int32_t * _Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_114, char * const  __at_rename_at_114 )
+{
+	return das_auto_cast<int32_t *>::cast(__builtin_table_find(__context__,__Tab_rename_at_114,__at_rename_at_114));
+}
+
+inline void _Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_100, char * const  __at_rename_at_100, Block DAS_COMMENT((void,int32_t *)) const  &  __blk_rename_at_100 )
+{
+	builtin_table_lock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_100),__context__);
+	int32_t * __val_rename_at_102 = __builtin_table_find(__context__,__Tab_rename_at_100,__at_rename_at_100);
+	das_invoke<void>::invoke<int32_t *>(__context__,__blk_rename_at_100,__val_rename_at_102);
+	builtin_table_unlock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_100),__context__);
+}
+
+inline void _Funcbuiltin_0x60_find_for_edit_if_exists_3d1446f1c50d754a ( Context * __context__, TTable<char *,int32_t> &  __Tab_rename_at_106, char * const  __at_rename_at_106, Block DAS_COMMENT((void,int32_t *)) const  &  __blk_rename_at_106 )
+{
+	int32_t * __val_rename_at_107 = __builtin_table_find(__context__,__Tab_rename_at_106,__at_rename_at_106);
+	if ( __val_rename_at_107 != nullptr )
+	{
+		builtin_table_lock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_106),__context__);
+		das_invoke<void>::invoke<int32_t *>(__context__,__blk_rename_at_106,__val_rename_at_107);
+		builtin_table_unlock(das_arg<TTable<char *,int32_t>>::pass(__Tab_rename_at_106),__context__);
+	};
+}
+
+inline bool _Funcbuiltin_0x60_find_if_exists_9c7a1aa90dd61329 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_82, char * const  __at_rename_at_82, Block DAS_COMMENT((void,int32_t * const )) const  &  __blk_rename_at_82 )
+{
+	int32_t * __val_rename_at_83 = __builtin_table_find(__context__,__Tab_rename_at_82,__at_rename_at_82);
+	if ( __val_rename_at_83 != nullptr )
+	{
+		builtin_table_lock(__Tab_rename_at_82,__context__);
+		das_invoke<void>::invoke<int32_t *>(__context__,__blk_rename_at_82,__val_rename_at_83);
+		builtin_table_unlock(__Tab_rename_at_82,__context__);
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline Sequence DAS_COMMENT((char * const  &)) _Funcbuiltin_0x60_keys_2373d8144a7e9849 ( Context * __context__, TTable<char *,int32_t> const  &  __a_rename_at_163 )
+{
+	Sequence DAS_COMMENT((char * *)) __it_rename_at_164; das_zero(__it_rename_at_164);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((char * const ))>::pass(__it_rename_at_164),__a_rename_at_163,8,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((char * const  &))>::cast(__it_rename_at_164);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_push_5caef1f118709d18 ( Context * __context__, TArray<char *> &  __Arr_rename_at_37, char * const  __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<char *>>::pass(__Arr_rename_at_37),8,__context__),__context__),__value_rename_at_37);
+}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_318 )
+{
+	TTable<char *,int32_t> __tab_rename_at_319; das_zero(__tab_rename_at_319);
+	{
+		bool __need_loop_321 = true;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_318);
+		TTuple<16,char *,int32_t> * __x_rename_at_321;
+		__need_loop_321 = __x_iterator.first(__context__,(__x_rename_at_321)) && __need_loop_321;
+		for ( ; __need_loop_321 ; __need_loop_321 = __x_iterator.next(__context__,(__x_rename_at_321)) )
+		{
+			das_copy(__tab_rename_at_319(das_get_tuple_field<char *,0>::get((*__x_rename_at_321)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_321)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_321));
+	};
+	return /* <- */ das_auto_cast<TTable<char *,int32_t>>::cast(__tab_rename_at_319);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_values_57783ad06c4865cf ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_173 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_174; das_zero(__it_rename_at_174);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_174),das_arg<TTable<char *,int32_t>>::pass(__a_rename_at_173),4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_174);
+}
+
+inline bool check_e6ece5eee61069bc ( Context * __context__, TableContainer &  __t_rename_at_190, TArray<int32_t> const  &  __deletedEntries_rename_at_190 )
+{
+	{
+		bool __need_loop_191 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_191;
+		__need_loop_191 = __i_iterator.first(__context__,(__i_rename_at_191)) && __need_loop_191;
+		for ( ; __need_loop_191 ; __need_loop_191 = __i_iterator.next(__context__,(__i_rename_at_191)) )
+		{
+			bool __deleted_rename_at_192 = 0;
+			{
+				bool __need_loop_193 = true;
+				// x : int const&
+				das_iterator<TArray<int32_t> const > __x_iterator(__deletedEntries_rename_at_190);
+				int32_t const  * __x_rename_at_193;
+				__need_loop_193 = __x_iterator.first(__context__,(__x_rename_at_193)) && __need_loop_193;
+				for ( ; __need_loop_193 ; __need_loop_193 = __x_iterator.next(__context__,(__x_rename_at_193)) )
+				{
+					if ( (*__x_rename_at_193) == __i_rename_at_191 )
+					{
+						das_copy(__deleted_rename_at_192,true);
+						break;
+					};
+				}
+				__x_iterator.close(__context__,(__x_rename_at_193));
+			};
+			if ( __deleted_rename_at_192 )
+			{
+				continue;
+			} else {
+				char * __n_rename_at_199 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_191)))));
+				if ( SimPolicy<char *>::NotEqu(cast<char *>::from(__t_rename_at_190.t(__n_rename_at_199,__context__).test),cast<char *>::from(__n_rename_at_199),*__context__) )
+				{
+					return das_auto_cast<bool>::cast(false);
+				};
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_191));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_f4d04b2b5f5370e7 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,608,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((char * *)) _temp_make_local_113_400;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_113_416;
+	test_find_391e2bfff7a57e7c(__context__);
+	TTable<char *,int32_t> __tab_rename_at_36; das_zero(__tab_rename_at_36);
+	int32_t __i_rename_at_37 = 0; int32_t __del_rename_at_37 = 0;
+	DAS_VERIFY((!_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "0"))));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		das_copy(__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__),__i_rename_at_37);
+		__i_rename_at_37++;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		DAS_VERIFY((__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__) == __i_rename_at_37));
+		__i_rename_at_37++;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	das_copy(__del_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		DAS_VERIFY((_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))))));
+		DAS_VERIFY((!_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))))));
+		__del_rename_at_37++;
+		__i_rename_at_37 += 7;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == (32 - __del_rename_at_37)));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,160,0,&__func_info__67be37f9,[&](int32_t * const  __pValue_rename_at_64)->void{
+			if ( __pValue_rename_at_64 != nullptr )
+			{
+				DAS_ASSERT((das_deref(__context__,__pValue_rename_at_64) == __i_rename_at_37));
+			} else {
+				DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__)) == 0));
+			};
+		}));
+		__i_rename_at_37++;
+	};
+	while ( __i_rename_at_37 < 32 )
+	{
+		int32_t const  * __pValue_rename_at_71 = ((int32_t const  *)das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__tab_rename_at_36,((char *)(das_lexical_cast(__i_rename_at_37,__context__))))));
+		if ( __pValue_rename_at_71 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__pValue_rename_at_71) == __i_rename_at_37));
+		} else {
+			DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__)) == 0));
+		};
+		__i_rename_at_37++;
+	};
+	int32_t __j_rename_at_78 = 0; int32_t __k_rename_at_78 = 0;
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,272,0,&__func_info__9768882b,[&](int32_t * const  __pVal_rename_at_81)->void{
+			__j_rename_at_78 += das_null_coalescing<int32_t>::get(__pVal_rename_at_81,0);
+		}));
+		if ( (SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__)) != 0 )
+		{
+			__k_rename_at_78 += __i_rename_at_37;
+		} else {
+			DAS_ASSERT(((SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__)) == 0));
+		};
+		__i_rename_at_37++;
+	};
+	DAS_ASSERT((__j_rename_at_78 == __k_rename_at_78));
+	int32_t __j_rename_at_90 = 0; int32_t __k_rename_at_90 = 0;
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *)(das_lexical_cast(__i_rename_at_37,__context__))),das_make_block<void,int32_t * const >(__context__,368,0,&__func_info__9768882b,[&](int32_t * const  __pVal_rename_at_93)->void{
+			__j_rename_at_90 += das_null_coalescing<int32_t>::get(__pVal_rename_at_93,0);
+		}));
+		if ( (SimPolicy<int32_t>::Mod(__i_rename_at_37,7,*__context__)) != 0 )
+		{
+			__k_rename_at_90 += __i_rename_at_37;
+		};
+		__i_rename_at_37++;
+	};
+	DAS_ASSERT((__j_rename_at_90 == __k_rename_at_90));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 < 32 )
+	{
+		das_copy(__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__),__i_rename_at_37);
+		__i_rename_at_37 += 7;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	das_copy(__i_rename_at_37,0);
+	while ( __i_rename_at_37 != 32 )
+	{
+		DAS_VERIFY((__tab_rename_at_36(((char *)(das_lexical_cast(__i_rename_at_37,__context__))),__context__) == __i_rename_at_37));
+		__i_rename_at_37++;
+	};
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)) == 32));
+	int32_t __cnt_rename_at_112 = 0;
+	{
+		bool __need_loop_113 = true;
+		// k : string const&
+		das_iterator<Sequence DAS_COMMENT((char * const ))> __k_iterator((_temp_make_local_113_400 = (_Funcbuiltin_0x60_keys_2373d8144a7e9849(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)))));
+		char * const  * __k_rename_at_113;
+		__need_loop_113 = __k_iterator.first(__context__,(__k_rename_at_113)) && __need_loop_113;
+		// v : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __v_iterator((_temp_make_local_113_416 = (_Funcbuiltin_0x60_values_57783ad06c4865cf(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36)))));
+		int32_t * __v_rename_at_113;
+		__need_loop_113 = __v_iterator.first(__context__,(__v_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __k_iterator.next(__context__,(__k_rename_at_113)) && __v_iterator.next(__context__,(__v_rename_at_113)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from((*__k_rename_at_113)),cast<char *>::from(((char *)(das_lexical_cast((*__v_rename_at_113),__context__)))),*__context__)));
+			__cnt_rename_at_112++;
+		}
+		__k_iterator.close(__context__,(__k_rename_at_113));
+		__v_iterator.close(__context__,(__v_rename_at_113));
+	};
+	DAS_ASSERT((__cnt_rename_at_112 == 32));
+	DAS_VERIFY((_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "1"))));
+	DAS_VERIFY((!_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_36),((char *) "-1"))));
+	TTable<bool,int32_t> __tab_bool_rename_at_123; das_zero(__tab_bool_rename_at_123);
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_bool_rename_at_123,false)));
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_bool_rename_at_123,true)));
+	das_copy(__tab_bool_rename_at_123(true,__context__),0);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_bool_rename_at_123,true)));
+	das_copy(__tab_bool_rename_at_123(false,__context__),-1);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_bool_rename_at_123,false)));
+	TTable<int32_t,int32_t> __tab_int_rename_at_131; das_zero(__tab_int_rename_at_131);
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_int_rename_at_131,-1)));
+	das_copy(__tab_int_rename_at_131(-1,__context__),-1);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_int_rename_at_131,-1)));
+	_Funcbuiltin_0x60_erase_3b06d4792ac86bb9(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__tab_int_rename_at_131),-1);
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_int_rename_at_131,-1)));
+	TTable<char *,int32_t> __tab_string_rename_at_138; das_zero(__tab_string_rename_at_138);
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) "---"))));
+	das_copy(__tab_string_rename_at_138(((char *) "---"),__context__),-1);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) "---"))));
+	_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) "---"));
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) "---"))));
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) " "))));
+	das_copy(__tab_string_rename_at_138(((char *) " "),__context__),-1);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) " "))));
+	_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) " "));
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) " "))));
+	das_copy(__tab_string_rename_at_138(((char *) ""),__context__),-2);
+	DAS_ASSERT((__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) ""))));
+	DAS_VERIFY((__tab_string_rename_at_138(((char *) ""),__context__) == -2));
+	_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_string_rename_at_138),((char *) ""));
+	DAS_ASSERT((!__builtin_table_key_exists(__context__,__tab_string_rename_at_138,((char *) ""))));
+	test_erase_collision_66150921c90310b3(__context__);
+	test_lock_panic_81c7b4457b80cc(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline void test_erase_collision_66150921c90310b3 ( Context * __context__ )
+{
+	TableContainer __t_rename_at_206; das_zero(__t_rename_at_206);
+	TArray<char *> __names_rename_at_207; das_zero(__names_rename_at_207);
+	{
+		bool __need_loop_208 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_208;
+		__need_loop_208 = __i_iterator.first(__context__,(__i_rename_at_208)) && __need_loop_208;
+		for ( ; __need_loop_208 ; __need_loop_208 = __i_iterator.next(__context__,(__i_rename_at_208)) )
+		{
+			_Funcbuiltin_0x60_push_5caef1f118709d18(__context__,das_arg<TArray<char *>>::pass(__names_rename_at_207),das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_208))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_208));
+	};
+	{
+		bool __need_loop_210 = true;
+		// n : string&
+		das_iterator<TArray<char *>> __n_iterator(__names_rename_at_207);
+		char * * __n_rename_at_210;
+		__need_loop_210 = __n_iterator.first(__context__,(__n_rename_at_210)) && __need_loop_210;
+		for ( ; __need_loop_210 ; __need_loop_210 = __n_iterator.next(__context__,(__n_rename_at_210)) )
+		{
+			TestStruct _temp_make_local_211_144;
+			das_move(__t_rename_at_206.t((*__n_rename_at_210),__context__),(([&]() -> TestStruct& {
+				das_copy((_temp_make_local_211_144.test),((*__n_rename_at_210)));
+				return _temp_make_local_211_144;
+			})()));
+		}
+		__n_iterator.close(__context__,(__n_rename_at_210));
+	};
+	TArray<int32_t> __deletedEntries_rename_at_212; das_zero(__deletedEntries_rename_at_212);
+	DAS_VERIFY((check_e6ece5eee61069bc(__context__,das_arg<TableContainer>::pass(__t_rename_at_206),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212))));
+	{
+		bool __need_loop_214 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,100));
+		int32_t __i_rename_at_214;
+		__need_loop_214 = __i_iterator.first(__context__,(__i_rename_at_214)) && __need_loop_214;
+		for ( ; __need_loop_214 ; __need_loop_214 = __i_iterator.next(__context__,(__i_rename_at_214)) )
+		{
+			char * __x_rename_at_215 = ((char *)(char *)(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "name_")), cast<int32_t>::from(__i_rename_at_214)))));
+			_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212),__i_rename_at_214);
+			_Funcbuiltin_0x60_erase_2f78cacd7a9e1e9d(__context__,das_arg<TTable<char *,TestStruct>>::pass(__t_rename_at_206.t),__x_rename_at_215);
+			DAS_VERIFY((check_e6ece5eee61069bc(__context__,das_arg<TableContainer>::pass(__t_rename_at_206),das_arg<TArray<int32_t>>::pass(__deletedEntries_rename_at_212))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_214));
+	};
+}
+
+inline bool test_find_391e2bfff7a57e7c ( Context * __context__ ) { das_stack_prologue __prologue(__context__,640,"test_find " DAS_FILE_LINE);
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_2_80;
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_11_352;
+	TTable<char *,int32_t> __const_tab_rename_at_2_ConstRef; das_zero(__const_tab_rename_at_2_ConstRef); das_move(__const_tab_rename_at_2_ConstRef, ((TTable<char *,int32_t>)_Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_2_80(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 1;
+			return __mkt_2;
+		})());
+		_temp_make_local_2_80(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 2;
+			return __mkt_2;
+		})());
+		return _temp_make_local_2_80;
+	})())))));
+	TTable<char *,int32_t> const  & __const_tab_rename_at_2 = __const_tab_rename_at_2_ConstRef; ;
+	_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,160,0,&__func_info__140259ba,[&](int32_t * const  __num_rename_at_3)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_3) == 1));
+	}));
+	_Funcbuiltin_0x60_find_if_exists_9c7a1aa90dd61329(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,224,0,&__func_info__140259ba,[&](int32_t * const  __num_rename_at_5)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_5) == 1));
+	}));
+	_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,__const_tab_rename_at_2,((char *) "one"),das_make_block<void,int32_t * const >(__context__,288,0,&__func_info__140259ba,[&](int32_t * const  __num_rename_at_7)->void{
+		if ( __num_rename_at_7 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__num_rename_at_7) == 1));
+		};
+	}));
+	DAS_ASSERT((das_deref(__context__,das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__const_tab_rename_at_2,((char *) "one")))) == 1));
+	TTable<char *,int32_t> __tab_rename_at_11; das_zero(__tab_rename_at_11); das_move(__tab_rename_at_11, _Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_11_352(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_11;
+			das_get_tuple_field<char *,0>::get(__mkt_11) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_11) = 1;
+			return __mkt_11;
+		})());
+		_temp_make_local_11_352(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_11;
+			das_get_tuple_field<char *,0>::get(__mkt_11) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_11) = 2;
+			return __mkt_11;
+		})());
+		return _temp_make_local_11_352;
+	})()))));
+	_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t * const >(__context__,432,0,&__func_info__140259ba,[&](int32_t * const  __num_rename_at_12)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_12) == 1));
+	}));
+	_Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,496,0,&__func_info__370dd9bb,[&](int32_t * __num_rename_at_14)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_14) == 1));
+		das_copy(das_deref(__context__,__num_rename_at_14),3);
+	}));
+	DAS_ASSERT((das_deref(__context__,das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__tab_rename_at_11,((char *) "one")))) == 3));
+	_Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,560,0,&__func_info__370dd9bb,[&](int32_t * __num_rename_at_18)->void{
+		if ( __num_rename_at_18 != nullptr )
+		{
+			DAS_ASSERT((das_deref(__context__,__num_rename_at_18) == 3));
+			das_copy(das_deref(__context__,__num_rename_at_18),4);
+		};
+	}));
+	DAS_ASSERT((das_deref(__context__,das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__tab_rename_at_11,((char *) "one")))) == 4));
+	_Funcbuiltin_0x60_find_for_edit_if_exists_3d1446f1c50d754a(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"),das_make_block<void,int32_t *>(__context__,624,0,&__func_info__370dd9bb,[&](int32_t * __num_rename_at_23)->void{
+		DAS_ASSERT((das_deref(__context__,__num_rename_at_23) == 4));
+		das_copy(das_deref(__context__,__num_rename_at_23),5);
+	}));
+	DAS_ASSERT((das_deref(__context__,das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__tab_rename_at_11,((char *) "one")))) == 5));
+	das_copy(das_deref(__context__,_Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))),1);
+	DAS_ASSERT((das_deref(__context__,_Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_11),((char *) "one"))) == 1));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline bool test_lock_panic_81c7b4457b80cc ( Context * __context__ ) { das_stack_prologue __prologue(__context__,256,"test_lock_panic " DAS_FILE_LINE);
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_162_80;
+	TTable<char *,int32_t> __tab_rename_at_162; das_zero(__tab_rename_at_162); das_move(__tab_rename_at_162, _Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_162_80(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_162;
+			das_get_tuple_field<char *,0>::get(__mkt_162) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_162) = 1;
+			return __mkt_162;
+		})());
+		_temp_make_local_162_80(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_162;
+			das_get_tuple_field<char *,0>::get(__mkt_162) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_162) = 2;
+			return __mkt_162;
+		})());
+		return _temp_make_local_162_80;
+	})()))));
+	bool __failed_rename_at_163 = false;
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "one"),das_make_block<void,int32_t * const >(__context__,176,0,&__func_info__9f953d46,[&](int32_t * const  __t_rename_at_165)->void{
+			DAS_ASSERT((__t_rename_at_165 != nullptr));
+			das_copy(__tab_rename_at_162(((char *) "three"),__context__),3);
+		}));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_163,true);
+	});
+	DAS_ASSERT((__failed_rename_at_163));
+	das_copy(__failed_rename_at_163,false);
+	das_try_recover(__context__, [&]()
+	{
+		_Funcbuiltin_0x60_find_344543a0afd94e01(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "three"),das_make_block<void,int32_t * const >(__context__,240,0,&__func_info__9f953d46,[&](int32_t * const  __t_rename_at_173)->void{
+			DAS_ASSERT((__t_rename_at_173 == nullptr));
+			_Funcbuiltin_0x60_erase_ea0fa82112615e17(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_162),((char *) "three"));
+		}));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_163,true);
+	});
+	DAS_ASSERT((__failed_rename_at_163));
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_erase_3b06d4792ac86bb9
+		aotLib[0x25338066fdc3cf05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&_Funcbuiltin_0x60_erase_3b06d4792ac86bb9>>();
+	};
+		// _Funcbuiltin_0x60_erase_2f78cacd7a9e1e9d
+		aotLib[0x17338e7bd1052be1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,TestStruct> & , char * const   ),&_Funcbuiltin_0x60_erase_2f78cacd7a9e1e9d>>();
+	};
+		// _Funcbuiltin_0x60_erase_ea0fa82112615e17
+		aotLib[0x76b7d93e69aa6db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_erase_ea0fa82112615e17>>();
+	};
+		// _Funcbuiltin_0x60_find_344543a0afd94e01
+		aotLib[0xfe2aab5ce941e001] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_344543a0afd94e01>>();
+	};
+		// _Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e
+		aotLib[0x83b9b43b9bf8a241] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t * (*) ( Context * __context__, TTable<char *,int32_t> & , char * const   ),&_Funcbuiltin_0x60_find_for_edit_f2a7ca6122af952e>>();
+	};
+		// _Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd
+		aotLib[0xdf49966e341f70d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , char * const  , Block DAS_COMMENT((void,int32_t *)) const  &  ),&_Funcbuiltin_0x60_find_for_edit_b70ea3cbab1ad7cd>>();
+	};
+		// _Funcbuiltin_0x60_find_for_edit_if_exists_3d1446f1c50d754a
+		aotLib[0xe6912f4c315ac081] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> & , char * const  , Block DAS_COMMENT((void,int32_t *)) const  &  ),&_Funcbuiltin_0x60_find_for_edit_if_exists_3d1446f1c50d754a>>();
+	};
+		// _Funcbuiltin_0x60_find_if_exists_9c7a1aa90dd61329
+		aotLib[0x451ea4ece7ab7a85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const  , Block DAS_COMMENT((void,int32_t * const )) const  &  ),&_Funcbuiltin_0x60_find_if_exists_9c7a1aa90dd61329>>();
+	};
+		// _Funcbuiltin_0x60_keys_2373d8144a7e9849
+		aotLib[0xbfe42690840ec26d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((char * const  &)) (*) ( Context * __context__, TTable<char *,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_2373d8144a7e9849>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_push_5caef1f118709d18
+		aotLib[0x80f7de2e45124cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , char * const   ),&_Funcbuiltin_0x60_push_5caef1f118709d18>>();
+	};
+		// _Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39
+		aotLib[0x1855d73849d29725] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_142e80e0bcc1da39>>();
+	};
+		// _Funcbuiltin_0x60_values_57783ad06c4865cf
+		aotLib[0xba5eb5c17e3e777d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Funcbuiltin_0x60_values_57783ad06c4865cf>>();
+	};
+		// check_e6ece5eee61069bc
+		aotLib[0xb699fbe3f89a81dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TableContainer & , TArray<int32_t> const  &  ),&check_e6ece5eee61069bc>>();
+	};
+		// test_f4d04b2b5f5370e7
+		aotLib[0x83afb350e255ed6b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f4d04b2b5f5370e7>>();
+	};
+		// test_erase_collision_66150921c90310b3
+		aotLib[0x6026cbc8e5102c5a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_erase_collision_66150921c90310b3>>();
+	};
+		// test_find_391e2bfff7a57e7c
+		aotLib[0xe41a358167b677f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_find_391e2bfff7a57e7c>>();
+	};
+		// test_lock_panic_81c7b4457b80cc
+		aotLib[0xef1f7239c25b6d10] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_lock_panic_81c7b4457b80cc>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
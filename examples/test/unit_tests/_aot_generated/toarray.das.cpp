@@ -0,0 +1,353 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_258 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_a0f52ffe07990a00 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_250 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 );
+inline void _Funcbuiltin_0x60_push_clone_9da63e78acf395d5 ( Context * __context__, TArray<int32_t> & __Arr_rename_at_61, int32_t __value_rename_at_61 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_285 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_5492107232484089 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_285 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_327100c0c09b25d1 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_291 );
+inline bool test_77d01f0ee929a0c5 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_49ba41ea6e9b0c25 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_258 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_259; das_zero(__it_rename_at_259);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_259),__a_rename_at_258,4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_259);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_a0f52ffe07990a00 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_250 )
+{
+	void * __parr_rename_at_252 = das_cast<void *>::cast(das_ref(__context__,__a_rename_at_250(0,__context__)));
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_253; das_zero(__it_rename_at_253);
+	builtin_make_fixed_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_253),__parr_rename_at_252,4,4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_253);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_477e01940515e80f ( Context * __context__, range __rng_rename_at_234 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_235; das_zero(__it_rename_at_235);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_235),__rng_rename_at_234,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_235);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_9da63e78acf395d5 ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_61, int32_t __value_rename_at_61 )
+{
+	das_copy(__Arr_rename_at_61(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_61),4,__context__),__context__),__value_rename_at_61);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_285 )
+{
+	TArray<int32_t> __arr_rename_at_286; das_zero(__arr_rename_at_286);
+	{
+		bool __need_loop_287 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_285);
+		int32_t __x_rename_at_287;
+		__need_loop_287 = __x_iterator.first(__context__,(__x_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __x_iterator.next(__context__,(__x_rename_at_287)) )
+		{
+			_Funcbuiltin_0x60_push_clone_9da63e78acf395d5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_286),__x_rename_at_287);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_287));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_286);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_5492107232484089 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_285 )
+{
+	TArray<int32_t> __arr_rename_at_286; das_zero(__arr_rename_at_286);
+	{
+		bool __need_loop_287 = true;
+		// x : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__it_rename_at_285);
+		int32_t const  * __x_rename_at_287;
+		__need_loop_287 = __x_iterator.first(__context__,(__x_rename_at_287)) && __need_loop_287;
+		for ( ; __need_loop_287 ; __need_loop_287 = __x_iterator.next(__context__,(__x_rename_at_287)) )
+		{
+			_Funcbuiltin_0x60_push_clone_9da63e78acf395d5(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_286),(*__x_rename_at_287));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_287));
+	};
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_286);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_327100c0c09b25d1 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_291 )
+{
+	TArray<int32_t> __arr_rename_at_292; das_zero(__arr_rename_at_292);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_292),4);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_292(0,__context__))),__a_rename_at_291);
+	return /* <- */ das_auto_cast<TArray<int32_t>>::cast(__arr_rename_at_292);
+}
+
+inline bool test_77d01f0ee929a0c5 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_5_80;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_9_128;
+	TArray<int32_t> _temp_make_local_11_176;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_11_208;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_15_256;
+	TArray<int32_t> _temp_make_local_17_304;
+	TArray<int32_t> _temp_make_local_20_368;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_20_400;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_24_448;
+	TArray<int32_t> _temp_make_local_27_496;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_27_528;
+	TDim<int32_t,4> __d_rename_at_4_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_4;
+		__mka_4(0,__context__) = 1;
+		__mka_4(1,__context__) = 2;
+		__mka_4(2,__context__) = 3;
+		__mka_4(3,__context__) = 4;
+		return __mka_4;
+	})()));
+	TDim<int32_t,4> const  & __d_rename_at_4 = __d_rename_at_4_ConstRef; ;
+	TArray<int32_t> __a_rename_at_5_ConstRef; das_zero(__a_rename_at_5_ConstRef); das_move(__a_rename_at_5_ConstRef, ((TArray<int32_t>)_Funcbuiltin_0x60_to_array_327100c0c09b25d1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_5_80(0,__context__) = 1;
+		_temp_make_local_5_80(1,__context__) = 2;
+		_temp_make_local_5_80(2,__context__) = 3;
+		_temp_make_local_5_80(3,__context__) = 4;
+		return _temp_make_local_5_80;
+	})())))));
+	TArray<int32_t> const  & __a_rename_at_5 = __a_rename_at_5_ConstRef; ;
+	{
+		bool __need_loop_6 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_6;
+		__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+		// y : int const&
+		das_iterator<TArray<int32_t> const > __y_iterator(__a_rename_at_5);
+		int32_t const  * __y_rename_at_6;
+		__need_loop_6 = __y_iterator.first(__context__,(__y_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) && __y_iterator.next(__context__,(__y_rename_at_6)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_6) == (*__y_rename_at_6)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_6));
+		__y_iterator.close(__context__,(__y_rename_at_6));
+	};
+	{
+		bool __need_loop_9 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_9;
+		__need_loop_9 = __x_iterator.first(__context__,(__x_rename_at_9)) && __need_loop_9;
+		// y : int
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_9_128 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)))));
+		int32_t __y_rename_at_9;
+		__need_loop_9 = __y_iterator.first(__context__,(__y_rename_at_9)) && __need_loop_9;
+		for ( ; __need_loop_9 ; __need_loop_9 = __x_iterator.next(__context__,(__x_rename_at_9)) && __y_iterator.next(__context__,(__y_rename_at_9)) )
+		{
+			DAS_ASSERT((__x_rename_at_9 == __y_rename_at_9));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_9));
+		__y_iterator.close(__context__,(__y_rename_at_9));
+	};
+	{
+		bool __need_loop_11 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,5));
+		int32_t __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_11_176 = (_Funcbuiltin_0x60_to_array_272b3119a8e7dcd7(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_11_208 = (_Funcbuiltin_0x60_each_477e01940515e80f(__context__,range(0,5)))))))));
+		int32_t * __y_rename_at_11;
+		__need_loop_11 = __y_iterator.first(__context__,(__y_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) && __y_iterator.next(__context__,(__y_rename_at_11)) )
+		{
+			DAS_ASSERT((__x_rename_at_11 == (*__y_rename_at_11)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+		__y_iterator.close(__context__,(__y_rename_at_11));
+	};
+	{
+		bool __need_loop_15 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_15;
+		__need_loop_15 = __x_iterator.first(__context__,(__x_rename_at_15)) && __need_loop_15;
+		// y : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __y_iterator((_temp_make_local_15_256 = (_Funcbuiltin_0x60_each_a0f52ffe07990a00(__context__,__d_rename_at_4))));
+		int32_t const  * __y_rename_at_15;
+		__need_loop_15 = __y_iterator.first(__context__,(__y_rename_at_15)) && __need_loop_15;
+		for ( ; __need_loop_15 ; __need_loop_15 = __x_iterator.next(__context__,(__x_rename_at_15)) && __y_iterator.next(__context__,(__y_rename_at_15)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_15) == (*__y_rename_at_15)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_15));
+		__y_iterator.close(__context__,(__y_rename_at_15));
+	};
+	{
+		bool __need_loop_17 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_17;
+		__need_loop_17 = __x_iterator.first(__context__,(__x_rename_at_17)) && __need_loop_17;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_17_304 = (_Funcbuiltin_0x60_to_array_327100c0c09b25d1(__context__,__d_rename_at_4))));
+		int32_t * __y_rename_at_17;
+		__need_loop_17 = __y_iterator.first(__context__,(__y_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __x_iterator.next(__context__,(__x_rename_at_17)) && __y_iterator.next(__context__,(__y_rename_at_17)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_17) == (*__y_rename_at_17)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_17));
+		__y_iterator.close(__context__,(__y_rename_at_17));
+	};
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TDim<int32_t,4> const > __x_iterator(__d_rename_at_4);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_20_368 = (_Funcbuiltin_0x60_to_array_5492107232484089(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_20_400 = (_Funcbuiltin_0x60_each_a0f52ffe07990a00(__context__,__d_rename_at_4))))))));
+		int32_t * __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (*__y_rename_at_20)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+	{
+		bool __need_loop_24 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_24;
+		__need_loop_24 = __x_iterator.first(__context__,(__x_rename_at_24)) && __need_loop_24;
+		// y : int&
+		das_iterator<Sequence DAS_COMMENT((int32_t))> __y_iterator((_temp_make_local_24_448 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_5))));
+		int32_t * __y_rename_at_24;
+		__need_loop_24 = __y_iterator.first(__context__,(__y_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __x_iterator.next(__context__,(__x_rename_at_24)) && __y_iterator.next(__context__,(__y_rename_at_24)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_24) == (*__y_rename_at_24)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_24));
+		__y_iterator.close(__context__,(__y_rename_at_24));
+	};
+	{
+		bool __need_loop_27 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_5);
+		int32_t const  * __x_rename_at_27;
+		__need_loop_27 = __x_iterator.first(__context__,(__x_rename_at_27)) && __need_loop_27;
+		// y : int&
+		das_iterator<TArray<int32_t>> __y_iterator((_temp_make_local_27_496 = (_Funcbuiltin_0x60_to_array_5492107232484089(__context__,das_reinterpret<Sequence DAS_COMMENT((int32_t const )) const >::pass(das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_27_528 = (_Funcbuiltin_0x60_each_49ba41ea6e9b0c25(__context__,__a_rename_at_5)))))))));
+		int32_t * __y_rename_at_27;
+		__need_loop_27 = __y_iterator.first(__context__,(__y_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __x_iterator.next(__context__,(__x_rename_at_27)) && __y_iterator.next(__context__,(__y_rename_at_27)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_27) == (*__y_rename_at_27)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_27));
+		__y_iterator.close(__context__,(__y_rename_at_27));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_each_49ba41ea6e9b0c25
+		aotLib[0x6a4a051ab138a935] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_49ba41ea6e9b0c25>>();
+	};
+		// _Funcbuiltin_0x60_each_a0f52ffe07990a00
+		aotLib[0xc5711692f14e6fcd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_each_a0f52ffe07990a00>>();
+	};
+		// _Funcbuiltin_0x60_each_477e01940515e80f
+		aotLib[0xb663417ca20913c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_477e01940515e80f>>();
+	};
+		// _Funcbuiltin_0x60_push_clone_9da63e78acf395d5
+		aotLib[0x1eccd0d48d65cf7d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_clone_9da63e78acf395d5>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_to_array_272b3119a8e7dcd7
+		aotLib[0xd910ddfba5d591db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_272b3119a8e7dcd7>>();
+	};
+		// _Funcbuiltin_0x60_to_array_5492107232484089
+		aotLib[0x8236657297e41e93] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Funcbuiltin_0x60_to_array_5492107232484089>>();
+	};
+		// _Funcbuiltin_0x60_to_array_327100c0c09b25d1
+		aotLib[0xa7f806cc25cc3df5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_to_array_327100c0c09b25d1>>();
+	};
+		// test_77d01f0ee929a0c5
+		aotLib[0x944b984e757ccad7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_77d01f0ee929a0c5>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,320 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_3ed3b49e882f876 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  & __clone_src_rename_at_131 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline void clone_ac8995000fa0f25b ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & __dest_rename_at_133, TTuple<32,int32_t,float,TArray<int32_t>> const  & __src_rename_at_133 );
+inline void finalize_b32790cd9509405e ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & ____this_rename_at_18 );
+inline bool test_c73ec71a62be3af7 ( Context * __context__ );
+inline bool testFinalizeAndClone_9cac94888cd8e187 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline TTuple<32,int32_t,float,TArray<int32_t>> _Funcbuiltin_0x60_clone_to_move_3ed3b49e882f876 ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __clone_src_rename_at_131 )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_ac8995000fa0f25b(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__clone_dest_rename_at_132),__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<TTuple<32,int32_t,float,TArray<int32_t>>>::cast(__clone_dest_rename_at_132);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline void clone_ac8995000fa0f25b ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  __dest_rename_at_133, TTuple<32,int32_t,float,TArray<int32_t>> const  &  __src_rename_at_133 )
+{
+	das_copy(das_get_tuple_field<int32_t,0>::get(__dest_rename_at_133),das_get_tuple_field<int32_t,0>::get(__src_rename_at_133));
+	das_copy(das_get_tuple_field<float,4>::get(__dest_rename_at_133),das_get_tuple_field<float,4>::get(__src_rename_at_133));
+	_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__dest_rename_at_133)),das_get_tuple_field<TArray<int32_t>,8>::get(__src_rename_at_133));
+}
+
+inline void finalize_b32790cd9509405e ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ____this_rename_at_18 )
+{
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(____this_rename_at_18)));
+	memset(&(____this_rename_at_18), 0, 32);
+}
+
+inline bool test_c73ec71a62be3af7 ( Context * __context__ )
+{
+	TTuple<8,int32_t,float> _temp_new_49_112;
+	TTuple<8,int32_t,float> __ttt_rename_at_27_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_27;
+		das_get_tuple_field<int32_t,0>::get(__mkt_27) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_27) = 3.1400001f;
+		return __mkt_27;
+	})()));
+	TTuple<8,int32_t,float> const  & __ttt_rename_at_27 = __ttt_rename_at_27_ConstRef; ;
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__ttt_rename_at_27) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__ttt_rename_at_27) == 3.1400001f));
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__ttt_rename_at_27) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__ttt_rename_at_27) == 3.1400001f));
+	TTuple<16,int32_t,float,char *> __t_rename_at_32; das_zero(__t_rename_at_32);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__t_rename_at_32),1);
+	das_copy(das_get_tuple_field<float,4>::get(__t_rename_at_32),2.f);
+	das_copy(das_get_tuple_field<char *,8>::get(__t_rename_at_32),((char *) "3"));
+	TTuple<16,int32_t,float,char *> __q_rename_at_37 = __t_rename_at_32;
+	DAS_ASSERT((das_get_tuple_field<int32_t,0>::get(__q_rename_at_37) == 1));
+	DAS_ASSERT((das_get_tuple_field<float,4>::get(__q_rename_at_37) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field<char *,8>::get(__q_rename_at_37)),cast<char *>::from(((char *) "3")),*__context__)));
+	TTuple<16,int32_t,float,char *> * __pq_rename_at_42 = das_ref(__context__,__q_rename_at_37);
+	DAS_ASSERT((das_get_tuple_field_ptr<int32_t,0>::get(__pq_rename_at_42) == 1));
+	DAS_ASSERT((das_get_tuple_field_ptr<float,4>::get(__pq_rename_at_42) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_tuple_field_ptr<char *,8>::get(__pq_rename_at_42)),cast<char *>::from(((char *) "3")),*__context__)));
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__pq_rename_at_42),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__pq_rename_at_42),0.f) == 2.f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_null_coalescing<char * const >::get(das_safe_navigation_tuple<char *, 8>::get(__pq_rename_at_42),((char *) "nothing"))),cast<char *>::from(((char *) "3")),*__context__)));
+	TTuple<8,int32_t,float> * __qq_rename_at_49 = das_new_on_stack<TTuple<8,int32_t,float>>::make(_temp_new_49_112);
+	das_copy(das_get_tuple_field_ptr<int32_t,0>::get(__qq_rename_at_49),1);
+	das_copy(das_get_tuple_field_ptr<float,4>::get(__qq_rename_at_49),2.f);
+	DAS_ASSERT((das_null_coalescing<int32_t>::get(das_safe_navigation_tuple<int32_t, 0>::get(__qq_rename_at_49),0) == 1));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_safe_navigation_tuple<float, 4>::get(__qq_rename_at_49),0.f) == 2.f));
+	das_copy(__qq_rename_at_49,nullptr);
+	TTuple<8,int32_t,float> __mkt_rename_at_57_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_57;
+		das_get_tuple_field<int32_t,0>::get(__mkt_57) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_57) = 2.f;
+		return __mkt_57;
+	})()));
+	TTuple<8,int32_t,float> const  & __mkt_rename_at_57 = __mkt_rename_at_57_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkt_rename_at_57) == 1) && (das_get_tuple_field<float,4>::get(__mkt_rename_at_57) == 2.f)));
+	TDim<TTuple<8,int32_t,float>,2> __mkta_rename_at_59_ConstRef = ((TDim<TTuple<8,int32_t,float>,2>)(([&]() -> TDim<TTuple<8,int32_t,float>,2> {
+		TDim<TTuple<8,int32_t,float>,2> __mka_59;
+		__mka_59(0,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 1;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 2.f;
+			return __mkt_59;
+		})());
+		__mka_59(1,__context__) = (([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_59;
+			das_get_tuple_field<int32_t,0>::get(__mkt_59) = 3;
+			das_get_tuple_field<float,4>::get(__mkt_59) = 4.f;
+			return __mkt_59;
+		})());
+		return __mka_59;
+	})()));
+	TDim<TTuple<8,int32_t,float>,2> const  & __mkta_rename_at_59 = __mkta_rename_at_59_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(0,__context__)) == 1) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(0,__context__)) == 2.f)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__mkta_rename_at_59(1,__context__)) == 3) && (das_get_tuple_field<float,4>::get(__mkta_rename_at_59(1,__context__)) == 4.f)));
+	TDim<int32_t,4> __ti_rename_at_63_ConstRef = ((TDim<int32_t,4>)(([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_63;
+		__mka_63(0,__context__) = 1;
+		__mka_63(1,__context__) = 2;
+		__mka_63(2,__context__) = 3;
+		__mka_63(3,__context__) = 4;
+		return __mka_63;
+	})()));
+	TDim<int32_t,4> const  & __ti_rename_at_63 = __ti_rename_at_63_ConstRef; ;
+	DAS_ASSERT(((((__ti_rename_at_63(0,__context__) == 1) && (__ti_rename_at_63(1,__context__) == 2)) && (__ti_rename_at_63(2,__context__) == 3)) && (__ti_rename_at_63(3,__context__) == 4)));
+	TDim<TTuple<8,int32_t,int32_t>,2> __tt_rename_at_66_ConstRef = ((TDim<TTuple<8,int32_t,int32_t>,2>)(([&]() -> TDim<TTuple<8,int32_t,int32_t>,2> {
+		TDim<TTuple<8,int32_t,int32_t>,2> __mka_66;
+		__mka_66(0,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 1;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 2;
+			return __mkt_66;
+		})());
+		__mka_66(1,__context__) = (([&]() -> TTuple<8,int32_t,int32_t> {
+			TTuple<8,int32_t,int32_t> __mkt_66;
+			das_get_tuple_field<int32_t,0>::get(__mkt_66) = 3;
+			das_get_tuple_field<int32_t,4>::get(__mkt_66) = 4;
+			return __mkt_66;
+		})());
+		return __mka_66;
+	})()));
+	TDim<TTuple<8,int32_t,int32_t>,2> const  & __tt_rename_at_66 = __tt_rename_at_66_ConstRef; ;
+	DAS_ASSERT(((((das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(0,__context__)) == 1) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(0,__context__)) == 2)) && (das_get_tuple_field<int32_t,0>::get(__tt_rename_at_66(1,__context__)) == 3)) && (das_get_tuple_field<int32_t,4>::get(__tt_rename_at_66(1,__context__)) == 4)));
+	TTuple<8,int32_t,float> __tq_rename_at_69_ConstRef = ((TTuple<8,int32_t,float>)(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_69;
+		das_get_tuple_field<int32_t,0>::get(__mkt_69) = 1;
+		das_get_tuple_field<float,4>::get(__mkt_69) = 2.f;
+		return __mkt_69;
+	})()));
+	TTuple<8,int32_t,float> const  & __tq_rename_at_69 = __tq_rename_at_69_ConstRef; ;
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__tq_rename_at_69) == 1) && (das_get_tuple_field<float,4>::get(__tq_rename_at_69) == 2.f)));
+	testFinalizeAndClone_9cac94888cd8e187(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool testFinalizeAndClone_9cac94888cd8e187 ( Context * __context__ )
+{
+	TTuple<32,int32_t,float,TArray<int32_t>> __x_rename_at_10; das_zero(__x_rename_at_10);
+	das_copy(das_get_tuple_field<int32_t,0>::get(__x_rename_at_10),1);
+	das_copy(das_get_tuple_field<float,4>::get(__x_rename_at_10),2.f);
+	das_move(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10),das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_13_rename_at_13; das_zero(____acomp_13_rename_at_13);
+		{
+			bool __need_loop_13 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_13;
+			__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+			for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+			{
+				_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____acomp_13_rename_at_13),__x_rename_at_13);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_13));
+		};
+		return /* <- */ das_auto_cast<TArray<int32_t>>::cast(____acomp_13_rename_at_13);
+	}));
+	TTuple<32,int32_t,float,TArray<int32_t>> __y_rename_at_14; das_zero(__y_rename_at_14); das_move(__y_rename_at_14, _Funcbuiltin_0x60_clone_to_move_3ed3b49e882f876(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_16 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_16;
+		__need_loop_16 = __t_iterator.first(__context__,(__t_rename_at_16)) && __need_loop_16;
+		for ( ; __need_loop_16 ; __need_loop_16 = __t_iterator.next(__context__,(__t_rename_at_16)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_16,__context__) == __t_rename_at_16));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_16));
+	};
+	finalize_b32790cd9509405e(__context__,das_arg<TTuple<32,int32_t,float,TArray<int32_t>>>::pass(__x_rename_at_10));
+	DAS_ASSERT((((das_get_tuple_field<int32_t,0>::get(__x_rename_at_10) == 0) && (das_get_tuple_field<float,4>::get(__x_rename_at_10) == 0.f)) && (builtin_array_size(das_arg<TArray<int32_t>>::pass(das_get_tuple_field<TArray<int32_t>,8>::get(__x_rename_at_10))) == 0)));
+	DAS_ASSERT(((das_get_tuple_field<int32_t,0>::get(__y_rename_at_14) == 1) && (das_get_tuple_field<float,4>::get(__y_rename_at_14) == 2.f)));
+	{
+		bool __need_loop_21 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_21;
+		__need_loop_21 = __t_iterator.first(__context__,(__t_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __t_iterator.next(__context__,(__t_rename_at_21)) )
+		{
+			DAS_ASSERT((das_get_tuple_field<TArray<int32_t>,8>::get(__y_rename_at_14)(__t_rename_at_21,__context__) == __t_rename_at_21));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_21));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_3ed3b49e882f876
+		aotLib[0xfabb0209610b94ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<32,int32_t,float,TArray<int32_t>> (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_clone_to_move_3ed3b49e882f876>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// clone_ac8995000fa0f25b
+		aotLib[0x19aab3cb985e12c4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> & , TTuple<32,int32_t,float,TArray<int32_t>> const  &  ),&clone_ac8995000fa0f25b>>();
+	};
+		// finalize_b32790cd9509405e
+		aotLib[0xd576356d12a8899e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<32,int32_t,float,TArray<int32_t>> &  ),&finalize_b32790cd9509405e>>();
+	};
+		// test_c73ec71a62be3af7
+		aotLib[0x79b409ed9943ba4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c73ec71a62be3af7>>();
+	};
+		// testFinalizeAndClone_9cac94888cd8e187
+		aotLib[0x25b93a11af387c39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&testFinalizeAndClone_9cac94888cd8e187>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,166 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__3ffbf730;
+extern TypeInfo __type_info__48b5725f;
+extern TypeInfo __type_info__3e1f8715;
+extern TypeInfo __type_info__90875dde;
+extern VarInfo __var_info__9be58628;
+extern FuncInfo __func_info__3f0fc6a6;
+
+VarInfo __func_info__3f0fc6a6_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION(L"UnitTest::Point3Array"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 0x9be58628, "arr", 0 };
+VarInfo * __func_info__3f0fc6a6_fields[1] =  { &__func_info__3f0fc6a6_field_0 };
+FuncInfo __func_info__3f0fc6a6 = {"invoke block<(arr:UnitTest::Point3Array const):void> const", "", __func_info__3f0fc6a6_fields, 1, 32, &__type_info__48b5725f, nullptr,0,0x3f0fc6a6, 0x0 };
+TypeInfo __type_info__3ffbf730 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 36, 0x3ffbf730 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+TypeInfo __type_info__3e1f8715 = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x3e1f8715 };
+TypeInfo __type_info__90875dde = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 0x90875dde };
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3e1f8715 };
+TypeInfo * __tinfo_1[2] = { &__type_info__3ffbf730, &__type_info__90875dde };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void indexFail_a88aa80e445fdb04 ( Context * __context__, Point3Array const  & __arr_rename_at_10 );
+inline void swizzleFail_b6120b968eade664 ( Context * __context__, Point3Array const  & __battleAreaPoints_rename_at_16 );
+inline void take3_eda4be5be266e88 ( Context * __context__, float3 __t_rename_at_6 );
+inline bool test_cdd9fecfb280d4bf ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void indexFail_a88aa80e445fdb04 ( Context * __context__, Point3Array const  &  __arr_rename_at_10 )
+{
+	take3_eda4be5be266e88(__context__,das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_10,0,__context__)));
+	float3 * __t_rename_at_12 = ((float3 *)&(das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_10,1,__context__))));
+	take3_eda4be5be266e88(__context__,(*__t_rename_at_12));
+}
+
+inline void swizzleFail_b6120b968eade664 ( Context * __context__, Point3Array const  &  __battleAreaPoints_rename_at_16 )
+{
+	float2 __pointStart_rename_at_17 = v_zero();
+	das_copy(das_swizzle_ref<float,float2,0>::swizzle(__pointStart_rename_at_17) /*x*/,das_swizzle_ref<float const ,float3 const ,0>::swizzle(das_alias<Point3>::from(das_alias<Point3>::from(das_index<Point3Array const >::at(__battleAreaPoints_rename_at_16,0,__context__)))) /*x*/);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<float2>::from(__pointStart_rename_at_17))),__context__);
+}
+
+inline void take3_eda4be5be266e88 ( Context * __context__, float3 __t_rename_at_6 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "t=")), cast<float3>::from(__t_rename_at_6))),__context__);
+}
+
+inline bool test_cdd9fecfb280d4bf ( Context * __context__ ) { das_stack_prologue __prologue(__context__,304,"test " DAS_FILE_LINE);
+{
+	float3 __a_rename_at_23 = das_alias<Point3>::from(getSamplePoint3());
+	DAS_VERIFY((SimPolicy<float3>::Equ(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(__a_rename_at_23))),v_make_vec4f(0.f,2.f,4.f,0.f),*__context__)));
+	TestObjectFoo __foo_rename_at_27; das_zero(__foo_rename_at_27);
+	das_copy(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/),das_alias<Point3>::from(getSamplePoint3()));
+	DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/))) /*x*/ == 0.f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/))) /*y*/ == 1.f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/))) /*z*/ == 2.f)));
+	float3 __qq_rename_at_31 = das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/);
+	DAS_ASSERT((((v_extract_x(__qq_rename_at_31) /*x*/ == 0.f) && (v_extract_y(__qq_rename_at_31) /*y*/ == 1.f)) && (v_extract_z(__qq_rename_at_31) /*z*/ == 2.f)));
+	float3 __qq1_rename_at_33 = das_alias<Point3>::from(getSamplePoint3());
+	DAS_ASSERT((((v_extract_x(__qq1_rename_at_33) /*x*/ == 0.f) && (v_extract_y(__qq1_rename_at_33) /*y*/ == 1.f)) && (v_extract_z(__qq1_rename_at_33) /*z*/ == 2.f)));
+	float3 __qq2_rename_at_35 = ((float3)das_alias<Point3>::from(__foo_rename_at_27.hitPos() /*hitPos*/));
+	DAS_ASSERT((((v_extract_x(__qq2_rename_at_35) /*x*/ == 0.f) && (v_extract_y(__qq2_rename_at_35) /*y*/ == 1.f)) && (v_extract_z(__qq2_rename_at_35) /*z*/ == 2.f)));
+	float3 __qq3_rename_at_37 = das_alias<Point3>::from(__foo_rename_at_27.hitPos() /*hitPos*/);
+	DAS_ASSERT((((v_extract_x(__qq3_rename_at_37) /*x*/ == 0.f) && (v_extract_y(__qq3_rename_at_37) /*y*/ == 1.f)) && (v_extract_z(__qq3_rename_at_37) /*z*/ == 2.f)));
+	float3 __qq4_rename_at_39 = ((float3)(SimPolicy<float3>::Mul(das_alias<Point3>::from(__foo_rename_at_27.hitPosRef() /*hitPosRef*/),v_splats(1.f),*__context__)));
+	DAS_ASSERT((((v_extract_x(__qq4_rename_at_39) /*x*/ == 0.f) && (v_extract_y(__qq4_rename_at_39) /*y*/ == 1.f)) && (v_extract_z(__qq4_rename_at_39) /*z*/ == 2.f)));
+	float3 __hitDir_rename_at_41 = safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/)))),*__context__));
+	float3 __nhd_rename_at_42 = ((float3)v_make_vec4f(0.f,-0.44721359f,-0.89442718f,0.f));
+	DAS_ASSERT((((v_extract_x(__hitDir_rename_at_41) /*x*/ == v_extract_x(__nhd_rename_at_42) /*x*/) && (v_extract_y(__hitDir_rename_at_41) /*y*/ == v_extract_y(__nhd_rename_at_42) /*y*/)) && (v_extract_z(__hitDir_rename_at_41) /*z*/ == v_extract_z(__nhd_rename_at_42) /*z*/)));
+	das_copy(__hitDir_rename_at_41,safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(__foo_rename_at_27.hit /*hit*/),*__context__)));
+	float3 __nhdh_rename_at_45 = ((float3)v_make_vec4f(0.f,-0.44721359f,-0.89442718f,0.f));
+	DAS_ASSERT((((v_extract_x(__hitDir_rename_at_41) /*x*/ == v_extract_x(__nhdh_rename_at_45) /*x*/) && (v_extract_y(__hitDir_rename_at_41) /*y*/ == v_extract_y(__nhdh_rename_at_45) /*y*/)) && (v_extract_z(__hitDir_rename_at_41) /*z*/ == v_extract_z(__nhdh_rename_at_45) /*z*/)));
+	testPoint3Array(das_make_block<void,Point3Array const  &>(__context__,272,0,&__func_info__3f0fc6a6,[&](Point3Array const  & __arr_rename_at_48)->void{
+		DAS_ASSERT((__arr_rename_at_48.size() /*length*/ == 10));
+		{
+			bool __need_loop_50 = true;
+			// p : float3 aka Point3 const&
+			das_iterator<Point3Array const > __p_iterator(__arr_rename_at_48);
+			float3 const  * __p_rename_at_50;
+			__need_loop_50 = __p_iterator.first(__context__,reinterpret_cast<const Point3 *&>(__p_rename_at_50)) && __need_loop_50;
+			for ( ; __need_loop_50 ; __need_loop_50 = __p_iterator.next(__context__,reinterpret_cast<const Point3 *&>(__p_rename_at_50)) )
+			{
+				DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_50)))) /*x*/ == 1.f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_50)))) /*y*/ == 2.f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_50)))) /*z*/ == 3.f)));
+			}
+			__p_iterator.close(__context__,reinterpret_cast<const Point3 *&>(__p_rename_at_50));
+		};
+	}),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// indexFail_a88aa80e445fdb04
+		aotLib[0xf033fd91c1011afb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Point3Array const  &  ),&indexFail_a88aa80e445fdb04>>();
+	};
+		// swizzleFail_b6120b968eade664
+		aotLib[0x5b03a88fbf3340c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Point3Array const  &  ),&swizzleFail_b6120b968eade664>>();
+	};
+		// take3_eda4be5be266e88
+		aotLib[0x409383ce339f41c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3  ),&take3_eda4be5be266e88>>();
+	};
+		// test_cdd9fecfb280d4bf
+		aotLib[0x9efd41fab46870f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cdd9fecfb280d4bf>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,160 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+extern TypeInfo __type_info__48b5725f;
+extern VarInfo __var_info__686465e2;
+extern VarInfo __var_info__79879dd6;
+extern VarInfo __var_info__5588cbe8;
+extern FuncInfo __func_info__792b50d1;
+
+VarInfo __func_info__792b50d1_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x79879dd6, "b_var_i", 0 };
+VarInfo __func_info__792b50d1_field_1 =  { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x5588cbe8, "b_var_f", 0 };
+VarInfo __func_info__792b50d1_field_2 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 4, 0x686465e2, "b_var_s", 0 };
+VarInfo * __func_info__792b50d1_fields[3] =  { &__func_info__792b50d1_field_0, &__func_info__792b50d1_field_1, &__func_info__792b50d1_field_2 };
+FuncInfo __func_info__792b50d1 = {"invoke block<(b_var_i:int -const;b_var_f:float -const;b_var_s:string -const):void> const", "", __func_info__792b50d1_fields, 3, 32, &__type_info__48b5725f, nullptr,0,0x792b50d1, 0x0 };
+TypeInfo __type_info__48b5725f = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0x48b5725f };
+
+
+inline bool test_69213061d4fd234e ( Context * __context__ );
+inline void test_arg_13b9581f5711fcd2 ( Context * __context__, int32_t __a_var_i_rename_at_33, float __a_var_f_rename_at_33, char * __a_var_s_rename_at_33 );
+inline void test_block_invoke_9b86154d4493e403 ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  & __b_rename_at_44 );
+inline void test_block_var_8c5ac3fe8230a5f1 ( Context * __context__ );
+inline void test_global_var_2c55d207d342d8e7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x3434d43d>(__context__) = 1;/*g_var_i*/
+	das_global<float,0xa07d99a7>(__context__) = 3.1400001f;/*g_var_f*/
+	das_global<char *,0xa2e6b33f>(__context__) = ((char *) "blah");/*g_var_s*/
+}
+
+inline bool test_69213061d4fd234e ( Context * __context__ )
+{
+	test_global_var_2c55d207d342d8e7(__context__);
+	test_arg_13b9581f5711fcd2(__context__,1,3.1400001f,((char *) "blah"));
+	test_block_var_8c5ac3fe8230a5f1(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_arg_13b9581f5711fcd2 ( Context * __context__, int32_t __a_var_i_rename_at_33, float __a_var_f_rename_at_33, char * __a_var_s_rename_at_33 )
+{
+	DAS_ASSERT((__a_var_i_rename_at_33 == 1));
+	das_copy(__a_var_i_rename_at_33,__a_var_i_rename_at_33 + 1);
+	DAS_ASSERT((__a_var_i_rename_at_33 == 2));
+	DAS_ASSERT((__a_var_f_rename_at_33 == 3.1400001f));
+	das_copy(__a_var_f_rename_at_33,__a_var_f_rename_at_33 * 2.f);
+	DAS_ASSERT((__a_var_f_rename_at_33 == 6.28000021f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_33),cast<char *>::from(((char *) "blah")),*__context__)));
+	SimPolicy<char *>::SetAdd((char *)&(__a_var_s_rename_at_33),cast<char *>::from(((char *) "_blah")),*__context__);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__a_var_s_rename_at_33),cast<char *>::from(((char *) "blah_blah")),*__context__)));
+}
+
+inline void test_block_invoke_9b86154d4493e403 ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  &  __b_rename_at_44 )
+{
+	das_invoke<void>::invoke<int32_t,float,char * const >(__context__,__b_rename_at_44,1,3.1400001f,((char *) "blah"));
+}
+
+inline void test_block_var_8c5ac3fe8230a5f1 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test_block_var " DAS_FILE_LINE);
+{
+	test_block_invoke_9b86154d4493e403(__context__,das_make_block<void,int32_t,float,char *>(__context__,80,0,&__func_info__792b50d1,[&](int32_t __b_var_i_rename_at_48, float __b_var_f_rename_at_48, char * __b_var_s_rename_at_48)->void{
+		DAS_ASSERT((__b_var_i_rename_at_48 == 1));
+		das_copy(__b_var_i_rename_at_48,__b_var_i_rename_at_48 + 1);
+		DAS_ASSERT((__b_var_i_rename_at_48 == 2));
+		DAS_ASSERT((__b_var_f_rename_at_48 == 3.1400001f));
+		das_copy(__b_var_f_rename_at_48,__b_var_f_rename_at_48 * 2.f);
+		DAS_ASSERT((__b_var_f_rename_at_48 == 6.28000021f));
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_48),cast<char *>::from(((char *) "blah")),*__context__)));
+		SimPolicy<char *>::SetAdd((char *)&(__b_var_s_rename_at_48),cast<char *>::from(((char *) "_blah")),*__context__);
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__b_var_s_rename_at_48),cast<char *>::from(((char *) "blah_blah")),*__context__)));
+	}));
+}}
+
+inline void test_global_var_2c55d207d342d8e7 ( Context * __context__ )
+{
+	DAS_ASSERT((das_global<int32_t,0x3434d43d>(__context__) /*g_var_i*/ == 1));
+	das_copy(das_global<int32_t,0x3434d43d>(__context__) /*g_var_i*/,das_global<int32_t,0x3434d43d>(__context__) /*g_var_i*/ + 1);
+	DAS_ASSERT((das_global<int32_t,0x3434d43d>(__context__) /*g_var_i*/ == 2));
+	DAS_ASSERT((das_global<float,0xa07d99a7>(__context__) /*g_var_f*/ == 3.1400001f));
+	das_copy(das_global<float,0xa07d99a7>(__context__) /*g_var_f*/,das_global<float,0xa07d99a7>(__context__) /*g_var_f*/ * 2.f);
+	DAS_ASSERT((das_global<float,0xa07d99a7>(__context__) /*g_var_f*/ == 6.28000021f));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xa2e6b33f>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah")),*__context__)));
+	SimPolicy<char *>::SetAdd((char *)&(das_global<char *,0xa2e6b33f>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "_blah")),*__context__);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xa2e6b33f>(__context__) /*g_var_s*/),cast<char *>::from(((char *) "blah_blah")),*__context__)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// test_69213061d4fd234e
+		aotLib[0x9902a37964af14e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_69213061d4fd234e>>();
+	};
+		// test_arg_13b9581f5711fcd2
+		aotLib[0x7b87852b5e7b0cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , float , char *  ),&test_arg_13b9581f5711fcd2>>();
+	};
+		// test_block_invoke_9b86154d4493e403
+		aotLib[0xd9f935976910c8f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,int32_t,float,char *)) const  &  ),&test_block_invoke_9b86154d4493e403>>();
+	};
+		// test_block_var_8c5ac3fe8230a5f1
+		aotLib[0x74fc4cd68385d0c4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_block_var_8c5ac3fe8230a5f1>>();
+	};
+		// test_global_var_2c55d207d342d8e7
+		aotLib[0x992650260f16e5bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_global_var_2c55d207d342d8e7>>();
+	};
+		// [[ init script ]]
+		aotLib[0x274f8588506b4689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+		};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
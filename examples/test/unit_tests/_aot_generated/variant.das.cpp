@@ -0,0 +1,384 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace {
+
+
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	TVariant<8,uint32_t,float> * t;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,t)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> & __a_rename_at_143, TArray<int32_t> const  & __b_rename_at_143 );
+inline void _Funcbuiltin_0x60_clone_9f1eaf5101e5e27d ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_153, TTable<int32_t,int32_t> const  & __b_rename_at_153 );
+inline TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _Funcbuiltin_0x60_clone_to_move_f98de61336230da8 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & __clone_src_rename_at_131 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_186 );
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_193 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_163 );
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> & __Arr_rename_at_37, int32_t __value_rename_at_37 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_22, int32_t __newSize_rename_at_22 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_373056fed6bc23eb ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_168 );
+inline void clone_79c7c3bcf4885366 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & __dest_rename_at_133, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & __src_rename_at_133 );
+inline void finalize_411860f9d582b550 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & ____this_rename_at_100 );
+inline bool test_dc96d029fc1ed7a9 ( Context * __context__ );
+inline void test_ifs_904b539b2c243cb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9 ( Context * __context__, TArray<int32_t> &  __a_rename_at_143, TArray<int32_t> const  &  __b_rename_at_143 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_143),builtin_array_size(__b_rename_at_143));
+	{
+		bool __need_loop_145 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_143);
+		int32_t * __aV_rename_at_145;
+		__need_loop_145 = __aV_iterator.first(__context__,(__aV_rename_at_145)) && __need_loop_145;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_143);
+		int32_t const  * __bV_rename_at_145;
+		__need_loop_145 = __bV_iterator.first(__context__,(__bV_rename_at_145)) && __need_loop_145;
+		for ( ; __need_loop_145 ; __need_loop_145 = __aV_iterator.next(__context__,(__aV_rename_at_145)) && __bV_iterator.next(__context__,(__bV_rename_at_145)) )
+		{
+			das_copy((*__aV_rename_at_145),(*__bV_rename_at_145));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_145));
+		__bV_iterator.close(__context__,(__bV_rename_at_145));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_9f1eaf5101e5e27d ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_153, TTable<int32_t,int32_t> const  &  __b_rename_at_153 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_155_32;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_155_48;
+	builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_153),__context__);
+	{
+		bool __need_loop_155 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_155_32 = (_Funcbuiltin_0x60_keys_6c2830dfa4ff0355(__context__,__b_rename_at_153))));
+		int32_t const  * __k_rename_at_155;
+		__need_loop_155 = __k_iterator.first(__context__,(__k_rename_at_155)) && __need_loop_155;
+		// v : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __v_iterator((_temp_make_local_155_48 = (_Funcbuiltin_0x60_values_373056fed6bc23eb(__context__,__b_rename_at_153))));
+		int32_t const  * __v_rename_at_155;
+		__need_loop_155 = __v_iterator.first(__context__,(__v_rename_at_155)) && __need_loop_155;
+		for ( ; __need_loop_155 ; __need_loop_155 = __k_iterator.next(__context__,(__k_rename_at_155)) && __v_iterator.next(__context__,(__v_rename_at_155)) )
+		{
+			das_copy(__a_rename_at_153((*__k_rename_at_155),__context__),(*__v_rename_at_155));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_155));
+		__v_iterator.close(__context__,(__v_rename_at_155));
+	};
+}
+
+inline TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _Funcbuiltin_0x60_clone_to_move_f98de61336230da8 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  __clone_src_rename_at_131 )
+{
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __clone_dest_rename_at_132; das_zero(__clone_dest_rename_at_132);
+	clone_79c7c3bcf4885366(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__clone_dest_rename_at_132),__clone_src_rename_at_131);
+	return /* <- */ das_auto_cast<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::cast(__clone_dest_rename_at_132);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_186 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_186),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_193 )
+{
+	builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_193),4,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_6c2830dfa4ff0355 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_163 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_164; das_zero(__it_rename_at_164);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_164),__a_rename_at_163,4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_164);
+}
+
+inline void _Funcbuiltin_0x60_push_79d158f6c466575c ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_37, int32_t __value_rename_at_37 )
+{
+	das_copy(__Arr_rename_at_37(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_37),4,__context__),__context__),__value_rename_at_37);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_22, int32_t __newSize_rename_at_22 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_22),__newSize_rename_at_22,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_373056fed6bc23eb ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_168 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_169; das_zero(__it_rename_at_169);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_169),__a_rename_at_168,4,__context__);
+	return /* <- */ das_auto_cast<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_169);
+}
+
+inline void clone_79c7c3bcf4885366 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  __dest_rename_at_133, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  __src_rename_at_133 )
+{
+	if ( das_get_variant_field<int32_t,8,0>::is(__src_rename_at_133) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_133),0);
+		das_copy(das_get_variant_field<int32_t,8,0>::get(__dest_rename_at_133),das_get_variant_field<int32_t,8,0>::get(__src_rename_at_133));
+	} else if ( das_get_variant_field<TArray<int32_t>,8,1>::is(__src_rename_at_133) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_133),1);
+		_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(__dest_rename_at_133)),das_get_variant_field<TArray<int32_t>,8,1>::get(__src_rename_at_133));
+	} else if ( das_get_variant_field<float,8,2>::is(__src_rename_at_133) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_133),2);
+		das_copy(das_get_variant_field<float,8,2>::get(__dest_rename_at_133),das_get_variant_field<float,8,2>::get(__src_rename_at_133));
+	} else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(__src_rename_at_133) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_133),3);
+		_Funcbuiltin_0x60_clone_9f1eaf5101e5e27d(__context__,das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__dest_rename_at_133)),das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__src_rename_at_133));
+	};
+}
+
+inline void finalize_411860f9d582b550 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  ____this_rename_at_100 )
+{
+	if ( das_get_variant_field<TArray<int32_t>,8,1>::is(____this_rename_at_100) )
+	{
+		_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(____this_rename_at_100)));
+	} else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(____this_rename_at_100) )
+	{
+		_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c(__context__,das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(____this_rename_at_100)));
+	};
+	memset(&(____this_rename_at_100), 0, 56);
+}
+
+inline bool test_dc96d029fc1ed7a9 ( Context * __context__ )
+{
+	TVariant<8,uint32_t,float> __t_rename_at_30; das_zero(__t_rename_at_30);
+	das_copy(das_get_variant_field<float,4,1>::get(__t_rename_at_30),1.f);
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::get(__t_rename_at_30) == 0x3f800000u));
+	DAS_ASSERT((variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_30)) == 0));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t_rename_at_30)));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_30,__context__) == 0x3f800000u));
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_30),1);
+	DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_30,__context__) == 1.f));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_get_variant_field<float,4,1>::safe_as(__t_rename_at_30),2.f) == 1.f));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_get_variant_field<uint32_t,4,0>::safe_as(__t_rename_at_30),0x1u) == 0x1u));
+	das_copy(das_get_variant_field<float,4,1>::as(__t_rename_at_30,__context__),2.f);
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_30),0);
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_30,__context__) == 0x40000000u));
+	das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_30,__context__),0x3f800000u);
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_30),1);
+	DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_30,__context__) == 1.f));
+	bool __paniced_rename_at_64 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_30,__context__),0x40000000u);
+	}, [&]()
+	{
+		das_copy(__paniced_rename_at_64,true);
+	});
+	DAS_ASSERT((__paniced_rename_at_64));
+	DAS_ASSERT((das_get_variant_field<float,4,1>::get(__t_rename_at_30) == 1.f));
+	das_copy(__t_rename_at_30,(([&]() -> TVariant<8,uint32_t,float> {
+		TVariant<8,uint32_t,float> __mkv_73;
+		das_get_variant_field<uint32_t,4,0>::set(__mkv_73) = 0x40000000u;
+		return __mkv_73;
+	})()));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_30,__context__) == 0x40000000u));
+	das_copy(__t_rename_at_30,(([&]() -> TVariant<8,uint32_t,float> {
+		TVariant<8,uint32_t,float> __mkv_75;
+		das_get_variant_field<float,4,1>::set(__mkv_75) = 1.f;
+		return __mkv_75;
+	})()));
+	TDim<TVariant<8,uint32_t,float>,2> __t2_rename_at_77 = (([&]() -> TDim<TVariant<8,uint32_t,float>,2> {
+		TDim<TVariant<8,uint32_t,float>,2> __mkv_77;
+		das_get_variant_field<uint32_t,4,0>::set(__mkv_77(0,__context__)) = 0x1u;
+		das_get_variant_field<float,4,1>::set(__mkv_77(1,__context__)) = 2.f;
+		return __mkv_77;
+	})());
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t2_rename_at_77(0,__context__)) && (das_get_variant_field<uint32_t,4,0>::as(__t2_rename_at_77(0,__context__),__context__) == 0x1u)));
+	DAS_ASSERT((das_get_variant_field<float,4,1>::is(__t2_rename_at_77(1,__context__)) && (das_get_variant_field<float,4,1>::as(__t2_rename_at_77(1,__context__),__context__) == 2.f)));
+	Foo __f_rename_at_82; das_zero(__f_rename_at_82);
+	Foo * __fp_rename_at_83 = 0;
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_83)),0xdu) == 0xdu));
+	das_copy(__fp_rename_at_83,das_ref(__context__,__f_rename_at_82));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_83)),0xeu) == 0xeu));
+	das_copy(__f_rename_at_82.t,das_ref(__context__,__t_rename_at_30));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_83)),0xfu) == 0x3f800000u));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_get_variant_field<uint32_t,4,0>::safe_as(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_83)),0xfu) == 0xfu));
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __x_rename_at_92; das_zero(__x_rename_at_92);
+	set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_92),1);
+	das_move(das_get_variant_field<TArray<int32_t>,8,1>::get(__x_rename_at_92),das_invoke<TArray<int32_t>>::invoke_cmres(__context__,[&]()->TArray<int32_t>{
+		TArray<int32_t> ____acomp_95_rename_at_95; das_zero(____acomp_95_rename_at_95);
+		{
+			bool __need_loop_95 = true;
+			// t : int const
+			das_iterator<range> __t_iterator(range(0,10));
+			int32_t __t_rename_at_95;
+			__need_loop_95 = __t_iterator.first(__context__,(__t_rename_at_95)) && __need_loop_95;
+			for ( ; __need_loop_95 ; __need_loop_95 = __t_iterator.next(__context__,(__t_rename_at_95)) )
+			{
+				_Funcbuiltin_0x60_push_79d158f6c466575c(__context__,das_arg<TArray<int32_t>>::pass(____acomp_95_rename_at_95),__t_rename_at_95);
+			}
+			__t_iterator.close(__context__,(__t_rename_at_95));
+		};
+		return /* <- */ das_auto_cast<TArray<int32_t>>::cast(____acomp_95_rename_at_95);
+	}));
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __y_rename_at_96; das_zero(__y_rename_at_96); das_move(__y_rename_at_96, _Funcbuiltin_0x60_clone_to_move_f98de61336230da8(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_92)));
+	DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_96)));
+	{
+		bool __need_loop_98 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_98;
+		__need_loop_98 = __t_iterator.first(__context__,(__t_rename_at_98)) && __need_loop_98;
+		for ( ; __need_loop_98 ; __need_loop_98 = __t_iterator.next(__context__,(__t_rename_at_98)) )
+		{
+			DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_96,__context__)(__t_rename_at_98,__context__) == __t_rename_at_98));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_98));
+	};
+	finalize_411860f9d582b550(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_92));
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__x_rename_at_92)));
+	DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_96)));
+	{
+		bool __need_loop_103 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,10));
+		int32_t __t_rename_at_103;
+		__need_loop_103 = __t_iterator.first(__context__,(__t_rename_at_103)) && __need_loop_103;
+		for ( ; __need_loop_103 ; __need_loop_103 = __t_iterator.next(__context__,(__t_rename_at_103)) )
+		{
+			DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_96,__context__)(__t_rename_at_103,__context__) == __t_rename_at_103));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_103));
+	};
+	test_ifs_904b539b2c243cb(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void test_ifs_904b539b2c243cb ( Context * __context__ )
+{
+	TVariant<16,int32_t,float,char *> __i_rename_at_15_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(makeSampleI()));
+	TVariant<16,int32_t,float,char *> const  & __i_rename_at_15 = __i_rename_at_15_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__i_rename_at_15)));
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::as(__i_rename_at_15,__context__) == 1));
+	TVariant<16,int32_t,float,char *> __f_rename_at_18_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(makeSampleF()));
+	TVariant<16,int32_t,float,char *> const  & __f_rename_at_18 = __f_rename_at_18_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<float,8,1>::is(__f_rename_at_18)));
+	DAS_ASSERT((das_get_variant_field<float,8,1>::as(__f_rename_at_18,__context__) == 2.f));
+	TVariant<16,int32_t,float,char *> __s_rename_at_21_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(makeSampleS()));
+	TVariant<16,int32_t,float,char *> const  & __s_rename_at_21 = __s_rename_at_21_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<char *,8,2>::is(__s_rename_at_21)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_variant_field<char *,8,2>::as(__s_rename_at_21,__context__)),cast<char *>::from(((char *) "3")),*__context__)));
+}
+struct AotList_impl : AotListBase {
+	virtual void registerAotFunctions ( AotLibrary & aotLib ) override {
+		// _Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9
+		aotLib[0xeb2cb7a3674aef6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4ea08ba03ae9f8c9>>();
+	};
+		// _Funcbuiltin_0x60_clone_9f1eaf5101e5e27d
+		aotLib[0xe77a9c9bab19fac4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> & , TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_clone_9f1eaf5101e5e27d>>();
+	};
+		// _Funcbuiltin_0x60_clone_to_move_f98de61336230da8
+		aotLib[0x6957b489d3531db1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  ),&_Funcbuiltin_0x60_clone_to_move_f98de61336230da8>>();
+	};
+		// _Funcbuiltin_0x60_finalize_c5f896860856389a
+		aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+		// _Funcbuiltin_0x60_finalize_2b7028a2bc1f14c
+		aotLib[0x8773319e89d22a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> &  ),&_Funcbuiltin_0x60_finalize_2b7028a2bc1f14c>>();
+	};
+		// _Funcbuiltin_0x60_keys_6c2830dfa4ff0355
+		aotLib[0x40b58262c96d3a05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_6c2830dfa4ff0355>>();
+	};
+		// _Funcbuiltin_0x60_push_79d158f6c466575c
+		aotLib[0x7b8cd9f0543d1a99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_79d158f6c466575c>>();
+	};
+		// _Funcbuiltin_0x60_resize_ce974596f011d69b
+		aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+		// _Funcbuiltin_0x60_values_373056fed6bc23eb
+		aotLib[0x2ace0a355647ea65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_values_373056fed6bc23eb>>();
+	};
+		// clone_79c7c3bcf4885366
+		aotLib[0x463414e142eca1ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & , TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  ),&clone_79c7c3bcf4885366>>();
+	};
+		// finalize_411860f9d582b550
+		aotLib[0xf96295d5188f99a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  ),&finalize_411860f9d582b550>>();
+	};
+		// test_dc96d029fc1ed7a9
+		aotLib[0x2ce7bdfe04b62d01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_dc96d029fc1ed7a9>>();
+	};
+		// test_ifs_904b539b2c243cb
+		aotLib[0xb8dfa1fdee592025] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_ifs_904b539b2c243cb>>();
+	};
+	};
+};
+AotList_impl impl;
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
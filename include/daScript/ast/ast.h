@@ -42,6 +42,8 @@ namespace das
 
     struct AnnotationArgumentList;
 
+    struct PassWorklist;
+
     //      [annotation (value,value,...,value)]
     //  or  [annotation (key=value,key,value,...,key=value)]
     struct AnnotationArgument {
@@ -141,6 +143,7 @@ namespace das
             AnnotationArgumentList  annotation;
             LineInfo                at;
             int                     offset = 0;
+            int                     inlineCapacity = 0;     // [[inline_capacity=N]] array<T>, first N elements are stored in the structure
             union {
                 struct {
                     bool            moveSemantics : 1;
@@ -158,6 +161,9 @@ namespace das
                 : name(n), type(t), init(i), annotation(alist), at(a) {
                 moveSemantics = ms;
             }
+            int getSizeOf() const;
+            int getAlignOf() const;
+            int getInlineStorageOffset() const;
         };
     public:
         Structure() {}
@@ -401,6 +407,8 @@ namespace das
         Expression() = default;
         Expression(const LineInfo & a) : at(a) {}
         virtual ~Expression() {}
+        static void * operator new ( size_t size );                 // counted in CompilePhase
+        static void operator delete ( void * ptr, size_t size );
         friend TextWriter& operator<< (TextWriter& stream, const Expression & func);
         virtual ExpressionPtr visit(Visitor & /*vis*/ )  { DAS_ASSERT(0); return this; };
         virtual ExpressionPtr clone( const ExpressionPtr & expr = nullptr ) const;
@@ -941,6 +949,21 @@ namespace das
         das_map<string,EnumInfo *>          emn2e;
     };
 
+    // per-line sample counts of the previous run, collected with DAS_ENABLE_PROFILER (see Context::collectProfileData)
+    //  used for the profile guided optimization, i.e. inlining, fusion, and AOT branch and function hints
+    struct ProfileData : ptr_ref_count {
+        bool load ( const char * text, uint32_t length, string & error );
+        uint64_t getSamples ( const LineInfo & at ) const;  // all lines of the range
+        bool isHot ( const LineInfo & at ) const;           // at least hotPercent of all samples
+        bool isCold ( const LineInfo & at ) const;          // file was profiled, and none of the lines ever ran
+        das_hash_map<string,vector<uint64_t>>   files;
+        uint64_t                                totalSamples = 0;
+        double                                  hotPercent = 1.0;
+    };
+    typedef smart_ptr<ProfileData> ProfileDataPtr;
+
+    ProfileDataPtr loadProfileData ( const string & fileName, TextWriter & logs );
+
     struct CodeOfPolicies {
     // memory
         uint32_t    stack = 16*1024;                    // 0 for unique stack
@@ -965,6 +988,8 @@ namespace das
         bool no_optimizations = false;                  // disable optimizations, regardless of settings
         bool fail_on_no_aot = true;                     // AOT link failure is error
         bool fail_on_lack_of_aot_export = false;        // remove_unused_symbols = false is missing in the module, which is passed to AOT
+    // profile guided optimization
+        ProfileDataPtr profile;                         // samples of the previous run
     // debugger
         //  when enabled
         //      1. disables [fastcall]
@@ -972,6 +997,34 @@ namespace das
         bool debugger = false;
     };
 
+    // compilation phase, reported with log_compile_time and written to the compile trace
+    struct CompilePhase {
+        string      name;               // i.e. "infer pass", "macro"
+        string      detail;             // i.e. pass number, macro name
+        string      module;
+        int         start = 0;          // usec since compilation started
+        int         usec = 0;
+        int         depth = 0;          // nested phases, i.e. macros within inference
+        uint64_t    astNodes = 0;       // expressions and types allocated during the phase
+        uint64_t    astBytes = 0;
+        static uint64_t astNodesAllocated;
+        static uint64_t astBytesAllocated;
+        static int64_t  timeOrigin;
+        static void resetTimeOrigin();
+    };
+
+    class CompilePhaseScope {
+    public:
+        CompilePhaseScope ( Program * prog, const char * name, const string & detail = string() );
+        ~CompilePhaseScope();
+    protected:
+        Program *   program;
+        size_t      index;
+        int64_t     time0;
+        uint64_t    nodes0;
+        uint64_t    bytes0;
+    };
+
     class Program : public ptr_ref_count {
     public:
         Program();
@@ -995,13 +1048,17 @@ namespace das
         void inferTypes(TextWriter & logs, ModuleGroup & libGroup);
         void inferTypesDirty(TextWriter & logs);
         void lint ( ModuleGroup & libGroup );
-        void checkSideEffects();
+        void checkSideEffects(PassWorklist * worklist = nullptr);
         void foldUnsafe();
-        bool optimizationRefFolding();
-        bool optimizationConstFolding();
-        bool optimizationBlockFolding();
-        bool optimizationCondFolding();
-        bool optimizationUnused(TextWriter & logs);
+        bool optimizationRefFolding(PassWorklist * worklist = nullptr);
+        bool optimizationConstFolding(PassWorklist * worklist = nullptr);
+        bool optimizationBlockFolding(PassWorklist * worklist = nullptr);
+        bool optimizationCondFolding(PassWorklist * worklist = nullptr);
+        bool optimizationInline(PassWorklist * worklist = nullptr);
+        bool optimizationBoundsCheck();
+        bool optimizationEscape();
+        bool optimizationDevirtualize();
+        bool optimizationUnused(TextWriter & logs, PassWorklist * worklist = nullptr);
         void fusion ( Context & context, TextWriter & logs );
         void buildAccessFlags(TextWriter & logs);
         bool verifyAndFoldContracts();
@@ -1032,6 +1089,8 @@ namespace das
         bool getDebugger() const;
         void makeMacroModule( TextWriter & logs );
         vector<ReaderMacroPtr> getReaderMacro ( const string & markup ) const;
+        void logCompilePhases ( TextWriter & logs, bool summary = false ) const;
+        void writeCompileTrace ( TextWriter & tw ) const;
     public:
         template <typename TT>
         string describeCandidates ( const vector<TT> & result, bool needHeader = true ) const {
@@ -1053,7 +1112,11 @@ namespace das
         int                         totalFunctions = 0;
         int                         totalVariables = 0;
         int                         newLambdaIndex = 1;
+        int                         devirtualizedCalls = 0;   // invoke sites, replaced with direct calls
         vector<Error>               errors;
+        vector<CompilePhase>        compilePhases;
+        int                         compilePhaseDepth = 0;
+        string                      compileUnit;        // module or file name, for compilePhases
         uint32_t                    globalInitStackSize = 0;
         uint32_t                    globalStringHeapSize = 0;
         union {
@@ -125,6 +125,7 @@ namespace das
                 bool        r2v : 1;
                 bool        r2cr : 1;
                 bool        write : 1;
+                bool        unchecked : 1;      // index is known to be in range, no bounds check
             };
             uint32_t atFlags = 0;
         };
@@ -231,6 +232,7 @@ namespace das
         virtual ExpressionPtr clone( const ExpressionPtr & expr = nullptr ) const override;
         virtual SimNode * simulate (Context & context) const override;
         virtual SimNode * trySimulate (Context & context, uint32_t extraOffset, Type r2vType ) const override;
+        SimNode * trySimulateField (Context & context, uint32_t extraOffset, Type r2vType ) const;
         virtual ExpressionPtr visit(Visitor & vis) override;
         virtual bool rtti_isField() const override { return true; }
         int tupleFieldIndex() const;
@@ -1085,6 +1087,7 @@ namespace das
         virtual ExpressionPtr visit(Visitor & vis) override;
         TypeDeclPtr     typeexpr;
         bool            initializer = false;
+        bool            onStack = false;        // does not escape, allocated in the stack frame
     };
 
     struct ExprCall : ExprCallFunc {
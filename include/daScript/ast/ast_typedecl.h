@@ -44,6 +44,8 @@ namespace das {
         TypeDecl(Type tt) : baseType(tt) {}
         TypeDecl(const StructurePtr & sp) : baseType(Type::tStructure), structType(sp.get()) {}
         TypeDecl(const EnumerationPtr & ep);
+        static void * operator new ( size_t size );                 // counted in CompilePhase
+        static void operator delete ( void * ptr, size_t size );
         TypeDeclPtr visit ( Visitor & vis );
         friend TextWriter& operator<< (TextWriter& stream, const TypeDecl & decl);
         string getMangledName() const;
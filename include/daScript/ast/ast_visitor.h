@@ -262,15 +262,27 @@ namespace das {
 #pragma clang diagnostic pop
 #endif
 
+    // which functions optimization pass visits, and which ones it changed
+    struct PassWorklist {
+        das_set<Function *> functions;          // only when not 'all'
+        das_set<Function *> changed;
+        bool                all = true;
+        bool                changedGlobals = false;
+    };
+
     class PassVisitor : public Visitor {
     public:
         virtual void preVisitProgram ( Program * prog ) override;
         virtual void visitProgram ( Program * prog ) override;
+        virtual bool canVisitFunction ( Function * fun ) override;
         virtual void reportFolding();
         __forceinline bool didAnything() const { return anyFolding; }
+    public:
+        PassWorklist *  worklist = nullptr;
     protected:
         bool        anyFolding = false;
         Program *   program = nullptr;
+        Function *  currentFunction = nullptr;
     };
 
     class FoldingVisitor : public PassVisitor {
@@ -18,5 +18,6 @@ namespace das
     NEED_MODULE(Module_Debugger); \
     NEED_MODULE(Module_FIO); \
     NEED_MODULE(Module_Random); \
+    NEED_MODULE(Module_Bulk); \
     NEED_MODULE(Module_Network);
 
@@ -88,6 +88,7 @@ namespace das
             struct {
                 bool    shared : 1;
                 bool    hopeless : 1;   // needs to be deleted without fuss (exceptions)
+                bool    inlined : 1;    // data points to inline storage of the owner, not to the heap
             };
             uint32_t    flags;
         };
@@ -102,6 +103,7 @@ namespace das
     void array_resize ( Context & context, Array & arr, uint32_t newSize, uint32_t stride, bool zero );
     void array_grow ( Context & context, Array & arr, uint32_t newSize, uint32_t stride );  // always grows
     void array_clear ( Context & context, Array & arr );
+    void array_inline ( Array & arr, char * storage, uint32_t capacity );
 
     struct Table : Array {
         char *      keys;
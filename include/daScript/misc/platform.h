@@ -95,6 +95,18 @@
     #define DAS_NORETURN_SUFFIX
 #endif
 
+#if defined(__GNUC__) || defined(__clang__)
+    #define DAS_LIKELY(x)       __builtin_expect(!!(x),1)
+    #define DAS_UNLIKELY(x)     __builtin_expect(!!(x),0)
+    #define DAS_HOT_FUNCTION    __attribute__((hot))
+    #define DAS_COLD_FUNCTION   __attribute__((cold))
+#else
+    #define DAS_LIKELY(x)       (x)
+    #define DAS_UNLIKELY(x)     (x)
+    #define DAS_HOT_FUNCTION
+    #define DAS_COLD_FUNCTION
+#endif
+
 #if defined(_MSC_VER) && !defined(__clang__)
 __forceinline uint32_t __builtin_clz(uint32_t x) {
     unsigned long r = 0;
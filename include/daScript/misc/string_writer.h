@@ -12,7 +12,7 @@ namespace das {
         }
     protected:
         __forceinline void append(const char * s, int l) {
-            data.reserve(data.size() + l);
+            // no exact reserve here - it defeats geometric growth, and makes long builds quadratic
             data.insert(data.end(), s, s + l);
         }
         __forceinline char * allocate (int l) {
@@ -729,6 +729,20 @@ namespace das {
         }
     };
 
+    // [[inline_capacity=N]] structure field. first N elements live right after the array header
+    template <typename TT, uint32_t capacity>
+    struct TInlineArray : TArray<TT> {
+        TInlineArray() {}
+        __forceinline TArray<TT> & array () {
+            array_inline(*this, storage, capacity);
+            return *this;
+        }
+        __forceinline const TArray<TT> & array () const {
+            return const_cast<TInlineArray *>(this)->array();
+        }
+        alignas(TT) char storage[capacity*sizeof(TT)];
+    };
+
     template <typename TK, typename TV>
     struct TTable : Table {
         using THIS_TYPE = TTable<TK, TV>;
@@ -1097,6 +1111,19 @@ namespace das {
         }
     };
 
+    template <typename TT>
+    struct das_new_on_stack {
+        static __forceinline TT * make ( TT & data ) {
+            memset ( &data, 0, sizeof(TT) );
+            return &data;
+        }
+        template <typename QQ>
+        static __forceinline TT * make_and_init ( TT & data, QQ && init ) {
+            data = init();
+            return &data;
+        }
+    };
+
     template <typename TT>
     struct das_new_persistent {
         static __forceinline TT * make ( Context * ) {
@@ -1262,8 +1289,10 @@ namespace das {
         static __forceinline void clear ( Context * __context__, TArray<TT> & dim ) {
             if ( dim.data ) {
                 if ( !dim.lock ) {
-                    uint32_t oldSize = dim.capacity*sizeof(TT);
-                    __context__->heap->free(dim.data, oldSize);
+                    if ( !dim.inlined ) {
+                        uint32_t oldSize = dim.capacity*sizeof(TT);
+                        __context__->heap->free(dim.data, oldSize);
+                    }
                 } else {
                     __context__->throw_error("can't delete locked array");
                 }
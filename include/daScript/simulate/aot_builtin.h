@@ -52,6 +52,7 @@ namespace das {
     void resetProfiler( Context * context );
     void dumpProfileInfo( Context * context );
     char * collectProfileInfo( Context * context );
+    char * collectProfileData( Context * context );
 
     template <typename TT>
     __forceinline void builtin_sort ( TT * data, int32_t length ) {
@@ -441,6 +441,8 @@ namespace das {
     void forEachGenericFunction ( Module * module, const char * name, const TBlock<void,FunctionPtr> & block, Context * context, LineInfoArg * lineInfo );
     bool addModuleFunction ( Module * module, FunctionPtr func, Context * context );
     bool addModuleVariable ( Module * module, VariablePtr var, Context * );
+    bool addModuleStructure ( Module * module, StructurePtr st, Context * );
+    void addStructureField ( smart_ptr_raw<Structure> st, const char * name, TypeDeclPtr td, const LineInfo & at );
     void ast_error ( ProgramPtr prog, const LineInfo & at, const char * message );
     void addModuleReaderMacro ( Module * module, ReaderMacroPtr newM, Context * context );
     ReaderMacroPtr makeReaderMacro ( const char * name, const void * pClass, const StructInfo * info, Context * context );
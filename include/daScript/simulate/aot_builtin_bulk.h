@@ -0,0 +1,42 @@
+#pragma once
+
+namespace das {
+    // fill
+    void bulkFillFloat ( TArray<float> & arr, float value );
+    void bulkFillFloat4 ( TArray<float4> & arr, float4 value );
+    void bulkFillInt ( TArray<int32_t> & arr, int32_t value );
+    // copy, resizes destination
+    void bulkCopyFloat ( TArray<float> & dst, const TArray<float> & src, Context * context );
+    void bulkCopyFloat4 ( TArray<float4> & dst, const TArray<float4> & src, Context * context );
+    void bulkCopyInt ( TArray<int32_t> & dst, const TArray<int32_t> & src, Context * context );
+    // sum
+    float bulkSumFloat ( const TArray<float> & arr );
+    float4 bulkSumFloat4 ( const TArray<float4> & arr );
+    int32_t bulkSumInt ( const TArray<int32_t> & arr );
+    // min \ max
+    float bulkMinFloat ( const TArray<float> & arr, Context * context );
+    float4 bulkMinFloat4 ( const TArray<float4> & arr, Context * context );
+    int32_t bulkMinInt ( const TArray<int32_t> & arr, Context * context );
+    float bulkMaxFloat ( const TArray<float> & arr, Context * context );
+    float4 bulkMaxFloat4 ( const TArray<float4> & arr, Context * context );
+    int32_t bulkMaxInt ( const TArray<int32_t> & arr, Context * context );
+    // dot
+    float bulkDotFloat ( const TArray<float> & a, const TArray<float> & b, Context * context );
+    // scale, y *= s
+    void bulkScaleFloat ( TArray<float> & arr, float s );
+    void bulkScaleFloat4 ( TArray<float4> & arr, float s );
+    // axpy, y += a*x
+    void bulkAxpyFloat ( TArray<float> & y, float a, const TArray<float> & x, Context * context );
+    void bulkAxpyFloat4 ( TArray<float4> & y, float a, const TArray<float4> & x, Context * context );
+    // clamp, in place
+    void bulkClampFloat ( TArray<float> & arr, float lo, float hi );
+    void bulkClampFloat4 ( TArray<float4> & arr, float4 lo, float4 hi );
+    void bulkClampInt ( TArray<int32_t> & arr, int32_t lo, int32_t hi );
+    // count_if with simple predicates
+    int32_t bulkCountLessFloat ( const TArray<float> & arr, float value );
+    int32_t bulkCountGreaterFloat ( const TArray<float> & arr, float value );
+    int32_t bulkCountEqualFloat ( const TArray<float> & arr, float value );
+    int32_t bulkCountLessInt ( const TArray<int32_t> & arr, int32_t value );
+    int32_t bulkCountGreaterInt ( const TArray<int32_t> & arr, int32_t value );
+    int32_t bulkCountEqualInt ( const TArray<int32_t> & arr, int32_t value );
+}
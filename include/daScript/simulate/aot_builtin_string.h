@@ -3,6 +3,20 @@
 #include "daScript/ast/ast_typefactory.h"
 
 namespace das {
+    // pointer and length into an existing string or buffer, which has to outlive the view
+    struct StringView {
+        const char *    data;
+        uint32_t        length;
+        StringView() = default;
+        StringView ( const char * d, uint32_t l ) : data(d), length(l) {}
+    };
+
+    template <>
+    struct cast <StringView> {
+        static __forceinline StringView to ( vec4f x )         { union { StringView v; vec4f vec; } T; T.vec = x; return T.v; }
+        static __forceinline vec4f from ( StringView x )       { union { StringView v; vec4f vec; } T; T.v = x; return T.vec; }
+    };
+
     void delete_string ( char * & str, Context * context );
 
     char * builtin_das_root ( Context * context );
@@ -55,6 +69,36 @@ namespace das {
     char * builtin_string_from_array ( const TArray<uint8_t> & bytes, Context * context );
     char * builtin_string_replace ( const char * str, const char * toSearch, const char * replaceStr, Context * context );
 
+    StringView builtin_string_view ( const char * str, Context * context );
+    StringView builtin_string_view_slice1 ( StringView sv, int32_t start, int32_t end );
+    StringView builtin_string_view_slice2 ( StringView sv, int32_t start );
+    StringView builtin_string_view_chop ( StringView sv, int32_t start, int32_t length, Context * context );
+    StringView builtin_string_view_strip ( StringView sv );
+    StringView builtin_string_view_strip_left ( StringView sv );
+    StringView builtin_string_view_strip_right ( StringView sv );
+    char * builtin_string_view_to_string ( StringView sv, Context * context );
+    int32_t get_string_view_character_at ( StringView sv, int32_t index, Context * context );
+    bool builtin_string_view_equ ( StringView a, StringView b );
+    bool builtin_string_view_nequ ( StringView a, StringView b );
+    bool builtin_string_view_less ( StringView a, StringView b );
+    bool builtin_string_view_gt ( StringView a, StringView b );
+    bool builtin_string_view_equ_string ( StringView a, const char * b );
+    bool builtin_string_view_nequ_string ( StringView a, const char * b );
+    bool builtin_string_equ_string_view ( const char * a, StringView b );
+    bool builtin_string_nequ_string_view ( const char * a, StringView b );
+    uint32_t builtin_string_view_hash ( StringView sv );
+    int32_t builtin_string_view_find ( StringView sv, const char * substr, Context * context );
+    int32_t builtin_string_view_find_char ( StringView sv, int32_t ch );
+    bool builtin_string_view_starts_with ( StringView sv, const char * cmp, Context * context );
+    bool builtin_string_view_ends_with ( StringView sv, const char * cmp, Context * context );
+    int32_t builtin_string_view_to_int ( StringView sv );
+    float builtin_string_view_to_float ( StringView sv );
+    void builtin_string_view_tokenize ( StringView sv, const char * delim, const TBlock<void,StringView> & block, Context * context );
+    void * builtin_table_find_string_view ( const Table & tab, StringView key, int32_t valueTypeSize, Context * context );
+
+    __forceinline int32_t builtin_string_view_length ( StringView sv ) { return int32_t(sv.length); }
+    __forceinline bool builtin_string_view_empty ( StringView sv ) { return sv.length==0; }
+
     __forceinline bool builtin_empty(const char* str) { return !str || str[0] == 0; }
     __forceinline bool builtin_empty_das_string(const string & str) { return str.empty(); }
 
@@ -173,6 +173,7 @@ namespace das
             flag_refValue = 1<<8,
             flag_hasInitValue = 1<<9,
             flag_isSmartPtr = 1<<10,
+            flag_isInlineArray = 1<<11,     // structure field with [[inline_capacity=N]]
         };
         Type                type;
         StructInfo *        structType;
@@ -197,6 +198,7 @@ namespace das
         __forceinline bool isTemp() const { return flags & flag_isTemp; }
         __forceinline bool isImplicit() const { return flags & flag_isImplicit; }
         __forceinline bool isSmartPtr() const { return flags & flag_isSmartPtr; }
+        __forceinline bool isInlineArray() const { return flags & flag_isInlineArray; }
         TypeAnnotation * getAnnotation() const;
     };
 
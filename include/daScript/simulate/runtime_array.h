@@ -25,6 +25,22 @@ namespace das
         uint32_t stride, offset;
     };
 
+    // INLINE ARRAY (structure field with [[inline_capacity=N]])
+    struct SimNode_InlineArray : SimNode {
+        DAS_PTR_NODE;
+        SimNode_InlineArray ( const LineInfo & at, SimNode * s, uint32_t so, uint32_t cap )
+            : SimNode(at), subexpr(s), storageOffset(so), capacity(cap) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            DAS_PROFILE_NODE
+            Array * pA = (Array *) subexpr->evalPtr(context);
+            array_inline(*pA, ((char *)pA) + storageOffset, capacity);
+            return (char *) pA;
+        }
+        SimNode *   subexpr;
+        uint32_t    storageOffset, capacity;
+    };
+
     template <typename TT>
     struct SimNode_ArrayAtR2V : SimNode_ArrayAt {
         SimNode_ArrayAtR2V ( const LineInfo & at, SimNode * rv, SimNode * idx, uint32_t strd, uint32_t o )
@@ -52,6 +68,47 @@ namespace das
 #undef EVAL_NODE
     };
 
+    // AT (INDEX), where index is known to be in range
+    struct SimNode_ArrayAtUnchecked : SimNode_ArrayAt {
+        DAS_PTR_NODE;
+        SimNode_ArrayAtUnchecked ( const LineInfo & at, SimNode * ll, SimNode * rr, uint32_t sz, uint32_t o)
+            : SimNode_ArrayAt(at,ll,rr,sz,o) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            DAS_PROFILE_NODE
+            Array * pA = (Array *) l->evalPtr(context);
+            auto idx = uint32_t(r->evalInt(context));
+            return pA->data + idx*stride + offset;
+        }
+    };
+
+    template <typename TT>
+    struct SimNode_ArrayAtR2VUnchecked : SimNode_ArrayAtUnchecked {
+        SimNode_ArrayAtR2VUnchecked ( const LineInfo & at, SimNode * rv, SimNode * idx, uint32_t strd, uint32_t o )
+            : SimNode_ArrayAtUnchecked(at,rv,idx,strd,o) {}
+        SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP_TT(ArrayAtR2VUnchecked);
+            V_SUB(l);
+            V_SUB(r);
+            V_ARG(stride);
+            V_ARG(offset);
+            V_END();
+        }
+        virtual vec4f eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            TT * pR = (TT *) compute(context);
+            return cast<TT>::from(*pR);
+        }
+#define EVAL_NODE(TYPE,CTYPE)                                       \
+        virtual CTYPE eval##TYPE ( Context & context ) override {   \
+            DAS_PROFILE_NODE \
+            return *(CTYPE *)compute(context);                      \
+        }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+    };
+
     // AT (INDEX)
     struct SimNode_SafeArrayAt : SimNode_ArrayAt {
         DAS_PTR_NODE;
@@ -81,6 +81,26 @@ namespace das
             return -1;
         }
 
+        // find by a key of another type, which hashes the same way (i.e. string_view for string keys)
+        template <typename KeyMatch>
+        __forceinline int findWith ( const Table & tab, uint32_t hash, KeyMatch && match ) const {
+            uint32_t mask = tab.capacity - 1;
+            uint32_t index = indexFromHash(hash, tab.shift);
+            uint32_t lastI = (index+tab.maxLookups) & mask;
+            auto pKeys = (const KeyType *) tab.keys;
+            auto pHashes = tab.hashes;
+            while ( index != lastI ) {
+                auto kh = pHashes[index];
+                if ( kh==HASH_EMPTY32 ) {
+                    return -1;
+                } else if ( kh==hash && match(pKeys[index]) ) {
+                    return (int) index;
+                }
+                index = (index + 1) & mask;
+            }
+            return -1;
+        }
+
         __forceinline int insertNew ( Table & tab, uint32_t hash ) const {
             // TODO: take key under account and be less agressive?
             uint32_t mask = tab.capacity - 1;
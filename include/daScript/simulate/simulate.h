@@ -561,6 +561,7 @@ namespace das
 
         void resetProfiler();
         void collectProfileInfo( TextWriter & tout );
+        void collectProfileData( TextWriter & tout );   // machine readable, see ProfileData::load
 
         vector<FileInfo *> getAllFiles() const;
 
@@ -1959,6 +1959,22 @@ SIM_NODE_AT_VECTOR(Float, float)
         bool        persistent;
     };
 
+    // NEW of the object, which does not escape the function, in its stack frame
+    struct SimNode_NewOnStack : SimNode {
+        DAS_PTR_NODE;
+        SimNode_NewOnStack ( const LineInfo & at, int32_t b, uint32_t sp )
+            : SimNode(at), bytes(b), stackTop(sp) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            DAS_PROFILE_NODE
+            char * ptr = context.stack.sp() + stackTop;
+            memset ( ptr, 0, bytes );
+            return ptr;
+        }
+        int32_t     bytes;
+        uint32_t    stackTop;
+    };
+
     template <bool move>
     struct SimNode_Ascend : SimNode {
         DAS_PTR_NODE;
@@ -2088,6 +2104,24 @@ SIM_NODE_AT_VECTOR(Float, float)
         bool         persistent;
     };
 
+    template <int argCount>
+    struct SimNode_NewOnStackWithInitializer : SimNode_CallBase {
+        DAS_PTR_NODE;
+        SimNode_NewOnStackWithInitializer ( const LineInfo & at, uint32_t b, uint32_t sp )
+            : SimNode_CallBase(at), bytes(b), stackTop(sp) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        __forceinline char * compute ( Context & context ) {
+            DAS_PROFILE_NODE
+            char * ptr = context.stack.sp() + stackTop;
+            vec4f argValues[argCount ? argCount : 1];
+            EvalBlock<argCount>::eval(context, arguments, argValues);
+            context.callWithCopyOnReturn(fnPtr, argValues, ptr, &debugInfo);
+            return ptr;
+        }
+        uint32_t     bytes;
+        uint32_t     stackTop;
+    };
+
     struct SimNode_NewArray : SimNode {
         DAS_PTR_NODE;
         SimNode_NewArray ( const LineInfo & a, SimNode * nn, uint32_t sp, uint32_t c )
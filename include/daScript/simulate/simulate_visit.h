@@ -271,6 +271,16 @@ namespace das {
         V_END();
     }
 
+    template <int argCount>
+    SimNode * SimNode_NewOnStackWithInitializer<argCount>::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(NewOnStackWithInitializer);
+        V_CALL();
+        V_ARG(bytes);
+        V_SP(stackTop);
+        V_END();
+    }
+
     template <typename TT>
     SimNode * SimNode_Set<TT>::visit ( SimVisitor & vis ) {
         V_BEGIN();
@@ -2,6 +2,8 @@
 
 #include "daScript/ast/ast.h"
 #include "daScript/ast/ast_visitor.h"
+#include "daScript/misc/performance_time.h"
+#include "daScript/simulate/runtime_string.h"
 
 namespace das {
 
@@ -160,6 +162,7 @@ namespace das {
         cs->fields.reserve(fields.size());
         for ( auto & fd : fields ) {
             cs->fields.emplace_back(fd.name, fd.type, fd.init, fd.annotation, fd.moveSemantics, fd.at);
+            cs->fields.back().inlineCapacity = fd.inlineCapacity;
         }
         cs->at = at;
         cs->module = module;
@@ -181,6 +184,9 @@ namespace das {
             if ( !fd.type->isSameType(*cfd.type, RefMatters::yes, ConstMatters::yes, TemporaryMatters::yes) ) {
                 return false;
             }
+            if ( fd.inlineCapacity != cfd.inlineCapacity ) {
+                return false;
+            }
         }
         return true;
     }
@@ -253,11 +259,34 @@ namespace das {
         return true;
     }
 
+    int Structure::FieldDeclaration::getAlignOf() const {
+        int align = type->getAlignOf();
+        if ( inlineCapacity ) {
+            align = das::max ( type->firstType->getAlignOf(), align );
+        }
+        return align;
+    }
+
+    int Structure::FieldDeclaration::getInlineStorageOffset() const {
+        int al = getAlignOf() - 1;
+        return (type->getSizeOf() + al) & ~al;
+    }
+
+    int Structure::FieldDeclaration::getSizeOf() const {
+        if ( !inlineCapacity ) {
+            return type->getSizeOf();
+        }
+        // array header, followed by inline storage. padded to alignment, same as c++ would
+        int size = getInlineStorageOffset() + inlineCapacity * type->firstType->getSizeOf();
+        int al = getAlignOf() - 1;
+        return (size + al) & ~al;
+    }
+
     int Structure::getSizeOf() const {
         int size = 0;
         const Structure * cppLayoutParent = nullptr;
         for ( const auto & fd : fields ) {
-            int fieldAlignemnt = fd.type->getAlignOf();
+            int fieldAlignemnt = fd.getAlignOf();
             int al = fieldAlignemnt - 1;
             if ( cppLayout ) {
                 auto fp = findFieldParent(fd.name);
@@ -269,7 +298,7 @@ namespace das {
                 }
             }
             size = (size + al) & ~al;
-            size += fd.type->getSizeOf();
+            size += fd.getSizeOf();
         }
         int al = getAlignOf() - 1;
         size = (size + al) & ~al;
@@ -279,7 +308,7 @@ namespace das {
     int Structure::getAlignOf() const {
         int align = 1;
         for ( const auto & fd : fields ) {
-            align = das::max ( fd.type->getAlignOf(), align );
+            align = das::max ( fd.getAlignOf(), align );
         }
         return align;
     }
@@ -560,6 +589,16 @@ namespace das {
 
     // expression
 
+    void * Expression::operator new ( size_t size ) {
+        CompilePhase::astNodesAllocated ++;
+        CompilePhase::astBytesAllocated += size;
+        return ::operator new(size);
+    }
+
+    void Expression::operator delete ( void * ptr, size_t ) {
+        ::operator delete(ptr);
+    }
+
     ExpressionPtr Expression::clone( const ExpressionPtr & expr ) const {
         if ( !expr ) {
             DAS_ASSERTF(0,
@@ -1054,6 +1093,7 @@ namespace das {
         ExprLooksLikeCall::clone(cexpr);
         cexpr->typeexpr = typeexpr;
         cexpr->initializer = initializer;
+        cexpr->onStack = onStack;
         return cexpr;
     }
 
@@ -1072,6 +1112,7 @@ namespace das {
         Expression::clone(cexpr);
         cexpr->subexpr = subexpr->clone();
         cexpr->index = index->clone();
+        cexpr->atFlags = atFlags;
         return cexpr;
     }
 
@@ -1274,6 +1315,7 @@ namespace das {
         Expression::clone(cexpr);
         cexpr->mask = mask;
         cexpr->value = value->clone();
+        cexpr->fieldFlags = fieldFlags;
         return cexpr;
     }
 
@@ -1294,8 +1336,10 @@ namespace das {
         }
         cexpr->field = field;
         cexpr->fieldIndex = fieldIndex;
+        cexpr->annotation = annotation;
         cexpr->unsafeDeref = unsafeDeref;
         cexpr->atField = atField;
+        cexpr->fieldFlags = fieldFlags;
         return cexpr;
     }
 
@@ -1424,6 +1468,9 @@ namespace das {
         cexpr->pBlock = pBlock;
         cexpr->argument = argument;
         cexpr->argumentIndex = argumentIndex;
+        cexpr->r2v = r2v;
+        cexpr->r2cr = r2cr;
+        cexpr->write = write;
         return cexpr;
     }
 
@@ -2511,33 +2558,157 @@ namespace das {
         return policies.debugger || options.getBoolOption("debugger",false);
     }
 
+    // compile phases
+
+    uint64_t CompilePhase::astNodesAllocated = 0;
+    uint64_t CompilePhase::astBytesAllocated = 0;
+    int64_t  CompilePhase::timeOrigin = 0;
+
+    void CompilePhase::resetTimeOrigin() {
+        timeOrigin = ref_time_ticks();
+    }
+
+    CompilePhaseScope::CompilePhaseScope ( Program * prog, const char * name, const string & detail ) : program(prog) {
+        if ( !CompilePhase::timeOrigin ) {
+            CompilePhase::resetTimeOrigin();
+        }
+        index = program->compilePhases.size();
+        program->compilePhases.emplace_back();
+        auto & phase = program->compilePhases.back();
+        phase.name = name;
+        phase.detail = detail;
+        phase.depth = program->compilePhaseDepth ++;
+        phase.start = get_time_usec(CompilePhase::timeOrigin);
+        nodes0 = CompilePhase::astNodesAllocated;
+        bytes0 = CompilePhase::astBytesAllocated;
+        time0 = ref_time_ticks();
+    }
+
+    CompilePhaseScope::~CompilePhaseScope() {
+        auto & phase = program->compilePhases[index];
+        phase.usec = get_time_usec(time0);
+        phase.astNodes = CompilePhase::astNodesAllocated - nodes0;
+        phase.astBytes = CompilePhase::astBytesAllocated - bytes0;
+        phase.module = program->compileUnit;
+        program->compilePhaseDepth --;
+    }
+
+    static void logCompilePhase ( TextWriter & logs, int depth, const string & label, int usec, uint64_t nodes, uint64_t bytes ) {
+        int pad = 2 + depth*2;
+        logs.writeChars(' ', pad);
+        logs << label;
+        int len = pad + int(label.length());
+        if ( len < 48 ) logs.writeChars(' ', 48 - len);
+        logs.write(" %10.6f", usec / 1000000.);
+        logs.write(" %10llu nodes", (unsigned long long) nodes);
+        logs.write(" %12llu bytes\n", (unsigned long long) bytes);
+    }
+
+    // per phase, or when summary - per kind of phase, over all modules
+    void Program::logCompilePhases ( TextWriter & logs, bool summary ) const {
+        int total = 0;
+        for ( auto & ph : compilePhases ) {
+            if ( ph.depth==0 ) total += ph.usec;
+        }
+        if ( !summary ) {
+            logs << "compile phases of " << compileUnit << ":\n";
+            for ( auto & ph : compilePhases ) {
+                logCompilePhase(logs, ph.depth, ph.detail.empty() ? ph.name : ph.name + " " + ph.detail, ph.usec, ph.astNodes, ph.astBytes);
+            }
+        } else {
+            struct PhaseTotal { int depth = 0; int count = 0; int usec = 0; uint64_t nodes = 0; uint64_t bytes = 0; };
+            vector<string> order;
+            das_map<string,PhaseTotal> totals;
+            das_set<string> modules;
+            for ( auto & ph : compilePhases ) {
+                modules.insert(ph.module);
+                auto it = totals.find(ph.name);
+                if ( it==totals.end() ) {
+                    order.push_back(ph.name);
+                    it = totals.insert(make_pair(ph.name, PhaseTotal())).first;
+                    it->second.depth = ph.depth;
+                }
+                it->second.count ++;
+                it->second.usec += ph.usec;
+                it->second.nodes += ph.astNodes;
+                it->second.bytes += ph.astBytes;
+            }
+            logs << "compile phases of " << int(modules.size()) << " modules:\n";
+            for ( auto & name : order ) {
+                auto & pt = totals[name];
+                logCompilePhase(logs, pt.depth, name + " x" + to_string(pt.count), pt.usec, pt.nodes, pt.bytes);
+            }
+        }
+        logs << "total " << (total / 1000000.) << "\n";
+    }
+
+    // chrome://tracing (or ui.perfetto.dev) json
+    void Program::writeCompileTrace ( TextWriter & tw ) const {
+        tw << "{\"traceEvents\":[\n";
+        bool first = true;
+        for ( auto & ph : compilePhases ) {
+            if ( !first ) tw << ",\n";
+            first = false;
+            tw << "{\"name\":\"" << escapeString(ph.detail.empty() ? ph.name : ph.name + " " + ph.detail, false) << "\""
+                << ",\"cat\":\"" << escapeString(ph.module, false) << "\""
+                << ",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                << ",\"ts\":" << ph.start << ",\"dur\":" << ph.usec
+                << ",\"args\":{\"module\":\"" << escapeString(ph.module, false) << "\""
+                << ",\"ast_nodes\":" << ph.astNodes << ",\"ast_bytes\":" << ph.astBytes << "}}";
+        }
+        tw << "\n]}\n";
+    }
+
+    // after the first iteration only functions, which changed, or depend on something that changed, are optimized again
+    //  function depends on its callees (body and side effects), and on access flags of the globals it uses
+    //  folding of globals, or any optimization macro work, optimizes everything again
     void Program::optimize(TextWriter & logs, ModuleGroup & libGroup) {
         const bool log = options.getBoolOption("log_optimization_passes",false);
+        const bool incremental = options.getBoolOption("incremental_optimize",true);
         bool any, last;
         if (log) {
             logs << *this << "\n";
         }
+        // single target invokes become regular calls, which the rest of the passes can inline or fold
+        { CompilePhaseScope phase(this, "devirtualize"); last = optimizationDevirtualize(); }
+        if ( log ) logs << "DEVIRTUALIZE: " << devirtualizedCalls << " call sites\n" << *this;
+        PassWorklist worklist;
+        das_map<Function *,uint32_t> sideEffects;
+        das_map<Variable *,uint32_t> accessFlags;
+        int iteration = 0;
         do {
+            auto passNo = to_string(iteration++);
             if ( log ) logs << "OPTIMIZE:\n" << *this;
             any = false;
-            last = optimizationRefFolding();    if ( failed() ) break;  any |= last;
+            worklist.changed.clear();
+            worklist.changedGlobals = false;
+            for ( auto & fn : thisModule->functions ) {
+                sideEffects[fn.second.get()] = fn.second->sideEffectFlags;
+            }
+            for ( auto & var : thisModule->globals ) {
+                accessFlags[var.second.get()] = var.second->access_flags;
+            }
+            { CompilePhaseScope phase(this, "ref folding", passNo); last = optimizationRefFolding(&worklist); }    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REF FOLDING: " << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
+            { CompilePhaseScope phase(this, "remove unused", passNo); last = optimizationUnused(logs,&worklist); }   if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationConstFolding();  if ( failed() ) break;  any |= last;
+            { CompilePhaseScope phase(this, "inline", passNo); last = optimizationInline(&worklist); }  if ( failed() ) break;  any |= last;
+            if ( log ) logs << "INLINE:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            { CompilePhaseScope phase(this, "const folding", passNo); last = optimizationConstFolding(&worklist); }  if ( failed() ) break;  any |= last;
             if ( log ) logs << "CONST FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationCondFolding();  if ( failed() ) break;  any |= last;
+            { CompilePhaseScope phase(this, "cond folding", passNo); last = optimizationCondFolding(&worklist); }  if ( failed() ) break;  any |= last;
             if ( log ) logs << "COND FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
-            last = optimizationBlockFolding();  if ( failed() ) break;  any |= last;
+            { CompilePhaseScope phase(this, "block folding", passNo); last = optimizationBlockFolding(&worklist); }  if ( failed() ) break;  any |= last;
             if ( log ) logs << "BLOCK FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
             // this is here again for a reason
-            last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
+            { CompilePhaseScope phase(this, "remove unused", passNo); last = optimizationUnused(logs,&worklist); }   if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n" << *this;
             // now, user macros
             last = false;
             auto modMacro = [&](Module * mod) -> bool {    // we run all macros for each module
                 if ( thisModule->isVisibleDirectly(mod) && mod!=thisModule.get() ) {
                     for ( const auto & pm : mod->optimizationMacros ) {
+                        CompilePhaseScope phase(this, "optimization macro", mod->name + "::" + pm->name);
                         last |= pm->apply(this, thisModule.get());
                         if ( failed() ) {                       // if macro failed, we report it, and we are done
                             error("optimization macro " + mod->name + "::" + pm->name + " failed", "","",LineInfo());
@@ -2554,6 +2725,37 @@ namespace das {
             if ( failed() ) break;
             any |= last;
             if ( log ) logs << "MACROS:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            // next worklist
+            worklist.all = !incremental || last || worklist.changedGlobals;
+            worklist.functions.clear();
+            if ( any && !worklist.all ) {
+                auto changedFn = [&]( Function * fn ) {
+                    if ( worklist.changed.find(fn)!=worklist.changed.end() ) return true;
+                    auto it = sideEffects.find(fn);
+                    return it!=sideEffects.end() && it->second!=fn->sideEffectFlags;
+                };
+                for ( auto & fn : thisModule->functions ) {
+                    auto pfn = fn.second.get();
+                    bool dirty = worklist.changed.find(pfn)!=worklist.changed.end();
+                    for ( auto it = pfn->useFunctions.begin(); !dirty && it!=pfn->useFunctions.end(); ++it ) {
+                        dirty = changedFn(*it);
+                    }
+                    for ( auto it = pfn->useGlobalVariables.begin(); !dirty && it!=pfn->useGlobalVariables.end(); ++it ) {
+                        auto af = accessFlags.find(*it);
+                        dirty = af!=accessFlags.end() && af->second!=(*it)->access_flags;
+                    }
+                    if ( dirty ) {
+                        worklist.functions.insert(pfn);
+                    }
+                }
+                if ( log ) logs << "WORKLIST: " << worklist.functions.size() << " of " << thisModule->functions.size() << " functions\n";
+            }
         } while ( any );
+        if ( !failed() ) {
+            { CompilePhaseScope phase(this, "bounds check"); last = optimizationBoundsCheck(); }
+            if ( log ) logs << "BOUNDS CHECK:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            { CompilePhaseScope phase(this, "escape analysis"); last = optimizationEscape(); }
+            if ( log ) logs << "ESCAPE ANALYSIS:" << (last ? "optimized" : "nothing") << "\n" << *this;
+        }
     }
 }
@@ -467,6 +467,13 @@ namespace das {
                     logs << "\t" << expr->stackTop << "\t" << sz
                     << "\tNEW " << expr->typeexpr->describe() << ", line " << expr->at.line << "\n";
                 }
+            } else if ( expr->onStack ) {
+                auto sz = expr->type->firstType->getSizeOf();
+                expr->stackTop = allocateStack(sz);
+                if ( log ) {
+                    logs << "\t" << expr->stackTop << "\t" << sz
+                    << "\tNEW ON STACK " << expr->typeexpr->describe() << ", line " << expr->at.line << "\n";
+                }
             }
         }
     // ExprCopy
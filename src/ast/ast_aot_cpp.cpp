@@ -822,10 +822,17 @@ namespace das {
                 localTemps[block].push_back(expr);
             }
         }
+    // new, which does not escape
+        virtual void preVisit ( ExprNew * expr ) override {
+            if ( expr->onStack ) {
+                localNews[getCurrentBlock()].push_back(expr);
+            }
+        }
     public:
         vector<ExprBlock *>                     stack;
         das_map<ExprBlock *,vector<Variable *>>     variables;
         das_map<ExprBlock *,vector<Expression *>>   localTemps;
+        das_map<ExprBlock *,vector<ExprNew *>>      localNews;
     protected:
         das_map<Variable *,string>              rename;
         das_set<Variable *>                     moved;
@@ -960,7 +967,11 @@ namespace das {
                 ss << "\t/* skipping " << decl.name << ", from " << from->name << " */";
                 return;
             }
-            ss << "\t" << describeCppType(decl.type) << " " << decl.name << ";";
+            if ( decl.inlineCapacity ) {
+                ss << "\tTInlineArray<" << describeCppType(decl.type->firstType) << "," << decl.inlineCapacity << "> " << decl.name << ";";
+            } else {
+                ss << "\t" << describeCppType(decl.type) << " " << decl.name << ";";
+            }
             if ( decl.parentType ) {
                 ss << " /* from " << from->name << " */";
             }
@@ -991,7 +1002,7 @@ namespace das {
             for ( auto & fnI : prog->thisModule->functions ) {
                 auto & fn = fnI.second;
                 if ( !fn->builtIn && !fn->noAot ) {
-                    ss << describeCppFunc(fn.get(),&collector) << ";\n";
+                    ss << functionHint(fn.get()) << describeCppFunc(fn.get(),&collector) << ";\n";
                 }
             }
             ss << "\n";
@@ -1060,9 +1071,32 @@ namespace das {
             if ( fun->noAot ) return false;
             return true;
         }
+        // profile guided hints
+        const char * functionHint ( Function * fn ) const {
+            auto profile = program->policies.profile.get();
+            if ( !profile ) return "";
+            if ( profile->isHot(fn->atDecl) ) return "DAS_HOT_FUNCTION ";
+            if ( profile->isCold(fn->atDecl) ) return "DAS_COLD_FUNCTION ";
+            return "";
+        }
+        const char * branchHint ( ExprIfThenElse * ifte ) const {
+            auto profile = program->policies.profile.get();
+            if ( !profile || ifte->isStatic || !ifte->cond->at.fileInfo ) return nullptr;
+            auto condSamples = profile->getSamples(ifte->cond->at);
+            auto ifSamples = profile->getSamples(ifte->if_true->at);
+            if ( !condSamples ) return nullptr;
+            if ( ifte->if_false ) {
+                auto elseSamples = profile->getSamples(ifte->if_false->at);
+                if ( ifSamples && !elseSamples ) return "DAS_LIKELY";
+                if ( elseSamples && !ifSamples ) return "DAS_UNLIKELY";
+            } else if ( !ifSamples ) {
+                return "DAS_UNLIKELY";
+            }
+            return nullptr;
+        }
         virtual void preVisit ( Function * fn) override {
             Visitor::preVisit(fn);
-            ss << "\ninline ";
+            ss << "\n" << functionHint(fn) << "inline ";
             describeLocalCppType(ss,fn->result,CpptSubstitureRef::no);
             ss << " " << aotFuncName(fn) << " ( Context * __context__";
         }
@@ -1120,6 +1154,9 @@ namespace das {
             }
             return "_temp_make_local_" + to_string(expr->at.line) + "_" + to_string(stackTop);
         }
+        string newOnStackName ( ExprNew * expr ) const {
+            return "_temp_new_" + to_string(expr->at.line) + "_" + to_string(expr->stackTop);
+        }
         virtual void preVisit ( ExprBlock * block ) override {
             Visitor::preVisit(block);
             scopes.push_back(block);
@@ -1147,6 +1184,12 @@ namespace das {
                 describeVarLocalCppType(ss, tmp->type);
                 ss << " " << makeLocalTempName(tmp) << ";\n";
             }
+            auto & news = collector.localNews[block];
+            for ( auto & tmp : news ) {
+                ss << string(tab,'\t');
+                describeVarLocalCppType(ss, tmp->type->firstType);
+                ss << " " << newOnStackName(tmp) << ";\n";
+            }
         }
         virtual void preVisitBlockArgumentInit ( ExprBlock * block, const VariablePtr & var, Expression * init ) override {
             Visitor::preVisitBlockArgumentInit(block, var, init);
@@ -1805,6 +1848,9 @@ namespace das {
             } else {
                 ss << "." << field->name;
             }
+            if ( field->field && field->field->inlineCapacity ) {
+                ss << ".array()";
+            }
             if ( field->type->aotAlias ) {
                 ss << ")";
             }
@@ -1823,7 +1869,9 @@ namespace das {
         }
         virtual void preVisitAtIndex ( ExprAt * expr, Expression * index ) override {
             Visitor::preVisitAtIndex(expr, index);
-            if ( expr->subexpr->type->dim.size() || expr->subexpr->type->isGoodArrayType() || expr->subexpr->type->isGoodTableType() ) {
+            if ( expr->unchecked ) {
+                ss << "[";
+            } else if ( expr->subexpr->type->dim.size() || expr->subexpr->type->isGoodArrayType() || expr->subexpr->type->isGoodTableType() ) {
                 ss << "(";
             } else {
                 ss << ",";
@@ -1831,7 +1879,7 @@ namespace das {
 
         }
         virtual ExpressionPtr visit ( ExprAt * expr ) override {
-            ss << ",__context__)";
+            ss << (expr->unchecked ? "]" : ",__context__)");
             if ( expr->type->aotAlias ) {
                 ss << ")";
             }
@@ -2044,9 +2092,11 @@ namespace das {
         virtual void preVisit ( ExprIfThenElse * ifte ) override {
             Visitor::preVisit(ifte);
             ss << "if ( ";
+            if ( auto hint = branchHint(ifte) ) ss << hint << "(";
         }
         virtual void preVisitIfBlock ( ExprIfThenElse * ifte, Expression * block ) override {
             Visitor::preVisitIfBlock(ifte,block);
+            if ( branchHint(ifte) ) ss << ")";
             ss << " )\n";
             ss << string(tab,'\t');
         }
@@ -2335,6 +2385,15 @@ namespace das {
                     } else {
                         ss << ">::make(__context__";
                     }
+                } else if ( enew->onStack ) {
+                    ss << "das_new_on_stack<"
+                        << describeCppType(enew->type->firstType,CpptSubstitureRef::no,CpptSkipRef::yes,CpptSkipConst::yes);
+                    if ( enew->initializer ) {
+                        ss  << ">::make_and_init(" << newOnStackName(enew) << ",[&]() { return ";
+                        CallFunc_preVisit(enew);
+                    } else {
+                        ss << ">::make(" << newOnStackName(enew);
+                    }
                 } else {
                     if ( enew->type->firstType->isStructure() && enew->type->firstType->structType->persistent ) {
                         ss << "das_new_persistent<";
@@ -2471,6 +2530,12 @@ namespace das {
                 ss << " /*" << decl->name << "*/";
             } else {
                 ss << "." << decl->name;
+                if ( expr->makeType->baseType==Type::tStructure ) {
+                    auto fd = expr->makeType->structType->findField(decl->name);
+                    if ( fd && fd->inlineCapacity ) {
+                        ss << ".array()";
+                    }
+                }
             }
             ss << "),(";
         }
@@ -327,10 +327,11 @@ namespace das {
 
     // program
 
-    bool Program::optimizationRefFolding() {
+    bool Program::optimizationRefFolding(PassWorklist * worklist) {
         bool any = false, anything = false;
         do {
             RefFolding context;
+            context.worklist = worklist;
             visit(context);
             any = context.didAnything();
             anything |= any;
@@ -338,14 +339,16 @@ namespace das {
         return anything;
     }
 
-    bool Program::optimizationBlockFolding() {
+    bool Program::optimizationBlockFolding(PassWorklist * worklist) {
         BlockFolding context;
+        context.worklist = worklist;
         visit(context);
         return context.didAnything();
     }
 
-    bool Program::optimizationCondFolding() {
+    bool Program::optimizationCondFolding(PassWorklist * worklist) {
         CondFolding context;
+        context.worklist = worklist;
         visit(context);
         return context.didAnything();
     }
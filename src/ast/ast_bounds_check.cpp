@@ -0,0 +1,173 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // loop body is safe, if nothing in it can change the size of the array
+    //  array variable is only indexed, iterated over, or passed to builtins which do not modify their arguments
+    //  there are no calls to script functions, invokes, or builtins which can modify arguments of non-pod types
+    //  nothing of non-pod type is copied, moved, cloned, deleted or zeroed
+    //  indices are read-only loop variables
+    class BoundsCheckSafeLoop : public Visitor {
+    public:
+        BoundsCheckSafeLoop ( Variable * arr, Variable * idx ) : array(arr), index(idx) {}
+        bool                failed = false;
+        vector<ExprAt *>    accesses;
+    protected:
+        Variable *              array;
+        Variable *              index;
+        das_set<Expression *>   allowed;
+    protected:
+        static bool isTrivialType ( const TypeDeclPtr & type ) {
+            return type->isWorkhorseType() || type->isPod();
+        }
+        static bool canModifyArguments ( Function * fn ) {
+            return fn->sideEffectFlags & (uint32_t(SideEffects::modifyArgument)
+                | uint32_t(SideEffects::modifyExternal) | uint32_t(SideEffects::invoke));
+        }
+        bool isIndex ( Expression * expr ) const {
+            if ( expr->rtti_isR2V() ) expr = static_cast<ExprRef2Value *>(expr)->subexpr.get();
+            return expr->rtti_isVar() && static_cast<ExprVar *>(expr)->variable.get()==index;
+        }
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            if ( expr->rtti_isCallFunc() ) {
+                auto ecall = static_cast<ExprCallFunc *>(expr);
+                if ( !ecall->func || !ecall->func->builtIn ) {
+                    failed = true;
+                } else if ( canModifyArguments(ecall->func) ) {
+                    for ( auto & arg : ecall->arguments ) {
+                        if ( !isTrivialType(arg->type) ) failed = true;
+                    }
+                } else {
+                    for ( auto & arg : ecall->arguments ) {
+                        allowed.insert(arg.get());
+                    }
+                }
+            }
+        }
+        virtual void preVisit ( ExprAt * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->subexpr->rtti_isVar() ) {
+                allowed.insert(expr->subexpr.get());
+                auto evar = static_cast<ExprVar *>(expr->subexpr.get());
+                if ( evar->variable.get()==array && isIndex(expr->index.get()) ) {
+                    accesses.push_back(expr);
+                }
+            }
+        }
+        virtual void preVisit ( ExprFor * expr ) override {
+            Visitor::preVisit(expr);
+            for ( auto & src : expr->sources ) {
+                allowed.insert(src.get());
+            }
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->variable.get()==array ) {
+                if ( allowed.find(expr)==allowed.end() ) failed = true;
+            } else if ( expr->variable.get()==index ) {
+                if ( expr->write ) failed = true;
+            }
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            if ( var->init && (var->init_via_move || var->init_via_clone) && !isTrivialType(var->type) ) {
+                failed = true;
+            }
+        }
+        virtual void preVisit ( ExprCopy * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !isTrivialType(expr->left->type) ) failed = true;
+        }
+        virtual void preVisit ( ExprMove * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !isTrivialType(expr->left->type) ) failed = true;
+        }
+        virtual void preVisit ( ExprClone * expr ) override {
+            Visitor::preVisit(expr);
+            if ( !isTrivialType(expr->left->type) ) failed = true;
+        }
+        virtual void preVisit ( ExprDelete * expr ) override {
+            Visitor::preVisit(expr);
+            failed = true;
+        }
+        virtual void preVisit ( ExprMemZero * expr ) override {
+            Visitor::preVisit(expr);
+            failed = true;
+        }
+        virtual void preVisit ( ExprInvoke * expr ) override {
+            Visitor::preVisit(expr);
+            failed = true;
+        }
+        virtual void preVisit ( ExprYield * expr ) override {
+            Visitor::preVisit(expr);
+            failed = true;
+        }
+        virtual void preVisit ( ExprMakeGenerator * expr ) override {
+            Visitor::preVisit(expr);
+            failed = true;
+        }
+    };
+
+    // for i in range(length(arr))
+    //  or range(N,length(arr)), where N is non-negative constant
+    //      arr[i] is always in range, as long as body does not change arr
+    class BoundsCheckElimination : public PassVisitor {
+    protected:
+        static bool isBuiltinCall ( Expression * expr, const char * name, size_t nargs ) {
+            if ( !expr->rtti_isCall() ) return false;
+            auto ecall = static_cast<ExprCall *>(expr);
+            return ecall->func && ecall->func->builtIn && ecall->func->name==name && ecall->arguments.size()==nargs;
+        }
+        static Variable * rangeOfLength ( Expression * src ) {
+            ExprCall * elen = nullptr;
+            if ( isBuiltinCall(src, "range", 1) ) {
+                elen = static_cast<ExprCall *>(static_cast<ExprCall *>(src)->arguments[0].get());
+            } else if ( isBuiltinCall(src, "range", 2) ) {
+                auto erange = static_cast<ExprCall *>(src);
+                auto efrom = erange->arguments[0].get();
+                if ( !efrom->rtti_isConstant() || !efrom->type->isSimpleType(Type::tInt) ) return nullptr;
+                if ( static_cast<ExprConstInt *>(efrom)->getValue()<0 ) return nullptr;
+                elen = static_cast<ExprCall *>(erange->arguments[1].get());
+            } else {
+                return nullptr;
+            }
+            if ( !isBuiltinCall(elen, "length", 1) ) return nullptr;
+            auto earr = elen->arguments[0].get();
+            if ( !earr->rtti_isVar() || !earr->type->isGoodArrayType() ) return nullptr;
+            auto evar = static_cast<ExprVar *>(earr);
+            if ( evar->isGlobalVariable() ) return nullptr;
+            return evar->variable.get();
+        }
+        virtual void preVisit ( ExprFor * expr ) override {
+            PassVisitor::preVisit(expr);
+            if ( !expr->body ) return;
+            size_t count = das::min(expr->sources.size(), expr->iteratorVariables.size());
+            for ( size_t i=0; i!=count; ++i ) {
+                auto arr = rangeOfLength(expr->sources[i].get());
+                if ( !arr ) continue;
+                BoundsCheckSafeLoop safe(arr, expr->iteratorVariables[i].get());
+                expr->body->visit(safe);
+                if ( safe.failed ) continue;
+                for ( auto eat : safe.accesses ) {
+                    if ( !eat->unchecked ) {
+                        eat->unchecked = true;
+                        reportFolding();
+                    }
+                }
+            }
+        }
+    };
+
+    bool Program::optimizationBoundsCheck() {
+        if ( getDebugger() || options.getBoolOption("no_bounds_check_elimination",false) ) {
+            return false;
+        }
+        BoundsCheckElimination context;
+        visit(context);
+        return context.didAnything();
+    }
+}
@@ -16,6 +16,7 @@ namespace das {
         Visitor::preVisitProgram(prog);
         program = prog;
         anyFolding = false;
+        currentFunction = nullptr;
     }
 
     void PassVisitor::visitProgram ( Program * prog ) {
@@ -23,11 +24,23 @@ namespace das {
         Visitor::visitProgram(prog);
     }
 
+    bool PassVisitor::canVisitFunction ( Function * fun ) {
+        currentFunction = fun;
+        return !worklist || worklist->all || worklist->functions.find(fun)!=worklist->functions.end();
+    }
+
     void PassVisitor::reportFolding() {
         anyFolding = true;
+        if ( worklist ) {
+            if ( currentFunction ) {
+                worklist->changed.insert(currentFunction);
+            } else {
+                worklist->changedGlobals = true;
+            }
+        }
     }
 
-    class SetSideEffectVisitor : public Visitor {
+    class SetSideEffectVisitor : public PassVisitor {
         // any expression
         virtual void preVisitExpression ( Expression * expr ) override {
             Visitor::preVisitExpression(expr);
@@ -36,7 +49,7 @@ namespace das {
         }
     };
 
-    class NoSideEffectVisitor : public Visitor {
+    class NoSideEffectVisitor : public PassVisitor {
     protected:
     // make block
         virtual void preVisit ( ExprMakeBlock * expr ) override {
@@ -823,21 +836,25 @@ namespace das {
 
     // program
 
-    void Program::checkSideEffects() {
+    void Program::checkSideEffects(PassWorklist * worklist) {
         SetSideEffectVisitor sse;
+        sse.worklist = worklist;
         visit(sse);
         NoSideEffectVisitor nse;
+        nse.worklist = worklist;
         visit(nse);
     }
 
-    bool Program::optimizationConstFolding() {
-        checkSideEffects();
+    bool Program::optimizationConstFolding(PassWorklist * worklist) {
+        checkSideEffects(worklist);
         ConstFolding cfe(this);
+        cfe.worklist = worklist;
         visit(cfe);
         bool any = cfe.didAnything();
         if ( cfe.needRun() ) {
             if ( !options.getBoolOption("disable_run",false) ) {
                 RunFolding rfe(this);
+                rfe.worklist = worklist;
                 visit(rfe);
                 any |= rfe.didAnything();
             }
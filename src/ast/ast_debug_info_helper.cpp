@@ -232,6 +232,9 @@ namespace das {
         makeTypeInfo(vi, var.type);
         vi->name = debugInfo->allocateName(var.name);
         vi->offset = var.offset;
+        if ( var.inlineCapacity ) {
+            vi->flags |= TypeInfo::flag_isInlineArray;
+        }
         if ( rtti && !var.annotation.empty() ) {
             vi->annotation_arguments = (void *) &var.annotation;
         } else {
@@ -0,0 +1,109 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // variable of the function type has single target, if
+    //  its initialized with @@function, and is only ever read afterwards
+    //  (no assignment, no reference, no address of it)
+    //  global variable of the module can be written by the module, which requires it, unless its constant
+    class FunctionTargets : public Visitor {
+    public:
+        FunctionTargets ( Program * prog ) : program(prog) {}
+        das_map<Variable *,Function *>  targets;
+        das_set<Variable *>             poisoned;
+    protected:
+        Program *               program;
+        das_set<Expression *>   allowed;
+    protected:
+        static Function * addrTarget ( Expression * expr ) {
+            if ( !expr || !expr->rtti_isAddr() ) return nullptr;
+            auto fn = static_cast<ExprAddr *>(expr)->func;
+            return fn && !fn->builtIn ? fn : nullptr;
+        }
+        void initVariable ( Variable * var ) {
+            if ( !var->type->isGoodFunctionType() || var->type->ref ) return;
+            if ( auto fn = addrTarget(var->init.get()) ) {
+                targets[var] = fn;
+            }
+        }
+        virtual void preVisitGlobalLet ( const VariablePtr & var ) override {
+            Visitor::preVisitGlobalLet(var);
+            if ( var->type->isConst() || program->thisModule->name.empty() ) {
+                initVariable(var.get());
+            }
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            initVariable(var.get());
+        }
+        virtual void preVisit ( ExprRef2Value * expr ) override {
+            Visitor::preVisit(expr);
+            allowed.insert(expr->subexpr.get());
+        }
+        virtual void preVisit ( ExprInvoke * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->arguments.size() ) allowed.insert(expr->arguments[0].get());
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->write || (!expr->r2v && allowed.find(expr)==allowed.end()) ) {
+                poisoned.insert(expr->variable.get());
+            }
+        }
+    };
+
+    // invoke(fn,args) of the single target is replaced with the direct call
+    class Devirtualize : public PassVisitor {
+    public:
+        Devirtualize ( const das_map<Variable *,Function *> & t ) : targets(t) {}
+        int32_t count = 0;
+    protected:
+        const das_map<Variable *,Function *> & targets;
+    protected:
+        Function * getTarget ( Expression * expr ) const {
+            if ( expr->rtti_isR2V() ) expr = static_cast<ExprRef2Value *>(expr)->subexpr.get();
+            if ( expr->rtti_isAddr() ) {
+                auto fn = static_cast<ExprAddr *>(expr)->func;
+                return fn && !fn->builtIn ? fn : nullptr;
+            } else if ( expr->rtti_isVar() ) {
+                auto it = targets.find(static_cast<ExprVar *>(expr)->variable.get());
+                return it!=targets.end() ? it->second : nullptr;
+            }
+            return nullptr;
+        }
+        virtual ExpressionPtr visit ( ExprInvoke * expr ) override {
+            if ( expr->arguments.size() && expr->arguments[0]->type->isGoodFunctionType() ) {
+                auto fn = getTarget(expr->arguments[0].get());
+                if ( fn && fn->arguments.size()+1==expr->arguments.size() ) {
+                    auto call = make_smart<ExprCall>(expr->at, fn->name);
+                    call->func = fn;
+                    call->type = make_smart<TypeDecl>(*expr->type);
+                    call->arguments.insert(call->arguments.end(), expr->arguments.begin()+1, expr->arguments.end());
+                    if ( currentFunction ) currentFunction->useFunctions.insert(fn);
+                    count ++;
+                    reportFolding();
+                    return call;
+                }
+            }
+            return PassVisitor::visit(expr);
+        }
+    };
+
+    bool Program::optimizationDevirtualize() {
+        if ( options.getBoolOption("no_devirtualize",false) ) {
+            return false;
+        }
+        FunctionTargets ft(this);
+        visit(ft);
+        for ( auto var : ft.poisoned ) {
+            ft.targets.erase(var);
+        }
+        Devirtualize context(ft.targets);
+        visit(context);
+        devirtualizedCalls += context.count;
+        return context.didAnything();
+    }
+}
@@ -0,0 +1,174 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // 'delete p' is a call to the generated pointer finalizer '_::finalize(p)'
+    //  if nothing inside of the object needs to be deleted, it only frees the memory and resets 'p'
+    static bool isTrivialPointerFinalizer ( ExprCall * expr ) {
+        if ( !expr->func || !expr->func->generated || expr->func->name!="finalize" ) return false;
+        if ( expr->arguments.size()!=1 || !expr->arguments[0]->type->isPointer() ) return false;
+        const auto & ptype = expr->arguments[0]->type->firstType;
+        if ( !ptype ) return false;
+        if ( ptype->isStructure() ) {
+            for ( const auto & fd : ptype->structType->fields ) {
+                if ( fd.type->needDelete() ) return false;
+            }
+            return true;
+        } else if ( ptype->isTuple() ) {
+            for ( const auto & arg : ptype->argTypes ) {
+                if ( arg->needDelete() ) return false;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // 'var p = new Foo()' does not escape the function, if 'p' is
+    //  only dereferenced (p.x, p?.x, *p), compared (p==null, p!=null), or deleted
+    //  never written to, copied, passed to a function, returned, or captured
+    // such object can live in the stack frame of the function, and 'delete p' only needs to reset 'p'
+    class EscapeAnalysis : public Visitor {
+    public:
+        EscapeAnalysis ( uint32_t ms ) : maxSize(ms) {}
+        das_map<Variable *,ExprNew *>   candidates;
+        das_set<Variable *>             escaped;
+    protected:
+        uint32_t                        maxSize;
+        das_set<Expression *>           allowed;
+        das_map<Expression *,Variable *> inits;
+    protected:
+        bool isCandidate ( ExprNew * enew ) const {
+            if ( enew->type->dim.size() || enew->type->smartPtr || !enew->type->firstType ) return false;
+            const auto & ptype = enew->type->firstType;
+            if ( ptype->isStructure() ) {
+                if ( ptype->structType->isClass || ptype->structType->isLambda ) return false;
+            } else if ( !ptype->isTuple() ) {
+                return false;
+            }
+            return ptype->getSizeOf() <= maxSize;
+        }
+        void allow ( Expression * expr ) {
+            allowed.insert(expr);
+            if ( expr->rtti_isR2V() ) {
+                allowed.insert(static_cast<ExprRef2Value *>(expr)->subexpr.get());
+            }
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            Visitor::preVisitLet(let, var, last);
+            if ( var->init && !var->init_via_move && !var->init_via_clone ) {
+                inits[var->init.get()] = var.get();
+            }
+        }
+        virtual void preVisit ( ExprNew * expr ) override {
+            Visitor::preVisit(expr);
+            auto it = inits.find(expr);
+            if ( it!=inits.end() && isCandidate(expr) ) {
+                candidates[it->second] = expr;
+            }
+        }
+        virtual void preVisit ( ExprField * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->value->type->isPointer() ) allow(expr->value.get());
+        }
+        virtual void preVisit ( ExprSafeField * expr ) override {
+            Visitor::preVisit(expr);
+            allow(expr->value.get());
+        }
+        virtual void preVisit ( ExprPtr2Ref * expr ) override {
+            Visitor::preVisit(expr);
+            allow(expr->subexpr.get());
+        }
+        virtual void preVisit ( ExprOp2 * expr ) override {
+            Visitor::preVisit(expr);
+            if ( expr->func && expr->func->builtIn && (expr->op=="==" || expr->op=="!=") ) {
+                allow(expr->left.get());
+                allow(expr->right.get());
+            }
+        }
+        virtual void preVisit ( ExprCall * expr ) override {
+            Visitor::preVisit(expr);
+            if ( isTrivialPointerFinalizer(expr) ) allowed.insert(expr->arguments[0].get());
+        }
+        virtual void preVisit ( ExprRef2Ptr * expr ) override {
+            Visitor::preVisit(expr);
+            // addr(*p) can make a pointer to anything
+            if ( expr->subexpr->rtti_isPtr2Ref() ) {
+                auto sub = static_cast<ExprPtr2Ref *>(expr->subexpr.get())->subexpr.get();
+                if ( sub->rtti_isR2V() ) sub = static_cast<ExprRef2Value *>(sub)->subexpr.get();
+                if ( sub->rtti_isVar() ) escaped.insert(static_cast<ExprVar *>(sub)->variable.get());
+            }
+        }
+        virtual void preVisit ( ExprVar * expr ) override {
+            Visitor::preVisit(expr);
+            if ( allowed.find(expr)==allowed.end() ) {
+                escaped.insert(expr->variable.get());
+            }
+        }
+    };
+
+    class PlaceOnStack : public PassVisitor {
+    public:
+        PlaceOnStack ( const das_set<Variable *> & v ) : vars(v) {}
+    protected:
+        const das_set<Variable *> & vars;
+    protected:
+        bool isOnStack ( Expression * expr ) const {
+            return expr->rtti_isVar() && vars.find(static_cast<ExprVar *>(expr)->variable.get())!=vars.end();
+        }
+        virtual void preVisitLet ( ExprLet * let, const VariablePtr & var, bool last ) override {
+            PassVisitor::preVisitLet(let, var, last);
+            if ( vars.find(var.get())!=vars.end() ) {
+                auto enew = static_cast<ExprNew *>(var->init.get());
+                if ( !enew->onStack ) {
+                    enew->onStack = true;
+                    reportFolding();
+                }
+            }
+        }
+        // delete p is p = null
+        virtual ExpressionPtr visit ( ExprCall * expr ) override {
+            if ( isTrivialPointerFinalizer(expr) && isOnStack(expr->arguments[0].get()) ) {
+                auto arg = expr->arguments[0];
+                auto left = static_pointer_cast<ExprVar>(arg->clone());
+                left->type = make_smart<TypeDecl>(*arg->type);
+                left->type->ref = true;
+                left->write = true;
+                auto right = make_smart<ExprConstPtr>(expr->at, nullptr);
+                right->type = make_smart<TypeDecl>(*arg->type);
+                right->type->ref = false;
+                right->type->constant = false;
+                auto cp = make_smart<ExprCopy>(expr->at, left, right);
+                cp->type = make_smart<TypeDecl>();
+                reportFolding();
+                return cp;
+            }
+            return PassVisitor::visit(expr);
+        }
+    };
+
+    bool Program::optimizationEscape() {
+        if ( options.getBoolOption("no_escape_analysis",false) ) {
+            return false;
+        }
+        auto maxSize = uint32_t(options.getIntOption("max_stack_new_size",1024));
+        das_set<Variable *> vars;
+        for ( auto & fn : thisModule->functions ) {
+            auto func = fn.second.get();
+            if ( func->builtIn || func->generator || !func->body ) continue;
+            EscapeAnalysis esc(maxSize);
+            func->body->visit(esc);
+            for ( auto & it : esc.candidates ) {
+                if ( esc.escaped.find(it.first)==esc.escaped.end() ) {
+                    vars.insert(it.first);
+                }
+            }
+        }
+        if ( vars.empty() ) return false;
+        PlaceOnStack context(vars);
+        visit(context);
+        return context.didAnything();
+    }
+}
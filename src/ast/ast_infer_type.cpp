@@ -35,6 +35,13 @@ namespace das {
             disableAot = prog->options.getBoolOption("no_aot",false);
         }
         bool finished() const { return !needRestart; }
+    public:
+        // incremental inference. functions in the skip list are known to be inferred, and nothing they depend on changed
+        das_set<Function *>     skipFunctions;
+        const das_map<string,vector<Function *>> * callers = nullptr;  // callee name to functions in the skip list, which call it
+        vector<FunctionPtr>     cleanFunctions;             // visited, nothing changed, no errors
+        vector<FunctionPtr>     dirtyFunctions;             // visited, changed or failed
+        bool                    nonLocalChange = false;     // globals, structures, or other functions changed
     protected:
         FunctionPtr             func;
         vector<VariablePtr>     local;
@@ -54,6 +61,8 @@ namespace das {
         bool                    disableAot;
         Expression *            lastEnuValue = nullptr;
         int32_t                 unsafeDepth = 0;
+        bool                    needRestartBeforeFunction = false;
+        size_t                  errorsBeforeFunction = 0;
     public:
         vector<FunctionPtr>     extraFunctions;
     protected:
@@ -88,10 +97,12 @@ namespace das {
         }
         void reportAstChanged() {
             needRestart = true;
+            if ( !func ) nonLocalChange = true;
         }
         virtual void reportFolding() override {
             FoldingVisitor::reportFolding();
             needRestart = true;
+            if ( !func ) nonLocalChange = true;
         }
     protected:
         void verifyType ( const TypeDeclPtr & decl, bool allowExplicit = false ) const {
@@ -1316,11 +1327,26 @@ namespace das {
                     }
                 }
             }
+            if ( auto icArg = decl.annotation.find("inline_capacity", Type::tVoid) ) {
+                if ( icArg->type!=Type::tInt || icArg->iValue<=0 ) {
+                    error("inline_capacity expects positive integer, i.e. [[inline_capacity=4]]", "", "",
+                        decl.at, CompilationError::invalid_annotation);
+                } else if ( !decl.type->isGoodArrayType() ) {
+                    error("inline_capacity is only allowed for array<T> fields, not " + decl.type->describe(), "", "",
+                        decl.at, CompilationError::invalid_structure_field_type);
+                } else if ( st->cppLayout ) {
+                    error("inline_capacity is not allowed in structures with C++ layout", "", "",
+                        decl.at, CompilationError::invalid_structure_field_type);
+                } else if ( decl.inlineCapacity!=icArg->iValue ) {
+                    decl.inlineCapacity = icArg->iValue;
+                    reportAstChanged();
+                }
+            }
             // TODO: verify. correct test is in fact the one bellow
             //  if ( isFullySealedType(decl.type) ) {
             // but the auto \ alias test may be sufficient
             if ( !decl.type->isAutoOrAlias() ) {
-                int fieldAlignemnt = decl.type->getAlignOf();
+                int fieldAlignemnt = decl.getAlignOf();
                 int fa = fieldAlignemnt - 1;
                 if ( cppLayout ) {
                     auto fp = st->findFieldParent(decl.name);
@@ -1333,7 +1359,7 @@ namespace das {
                 }
                 fieldOffset = (fieldOffset + fa) & ~fa;
                 decl.offset = int(fieldOffset);
-                fieldOffset += decl.type->getSizeOf();
+                fieldOffset += decl.getSizeOf();
             }
             verifyType(decl.type);
         }
@@ -1463,8 +1489,14 @@ namespace das {
             if ( expr->alwaysSafe ) return true;
             return false;
         }
+        virtual bool canVisitFunction ( Function * fun ) override {
+            return skipFunctions.find(fun)==skipFunctions.end();
+        }
         virtual void preVisit ( Function * f ) override {
             Visitor::preVisit(f);
+            needRestartBeforeFunction = needRestart;
+            needRestart = false;
+            errorsBeforeFunction = program->errors.size();
             unsafeDepth = 0;
             func = f;
             func->hasReturn = false;
@@ -1570,6 +1602,20 @@ namespace das {
             DAS_ASSERT(local.size()==0);
             DAS_ASSERT(with.size()==0);
             labels.clear();
+            if ( needRestart || program->errors.size()!=errorsBeforeFunction ) {
+                dirtyFunctions.push_back(func);
+                if ( callers ) {    // callers, which are yet to be visited, should see the change this pass
+                    auto it = callers->find(func->name);
+                    if ( it!=callers->end() ) {
+                        for ( auto caller : it->second ) {
+                            skipFunctions.erase(caller);
+                        }
+                    }
+                }
+            } else {
+                cleanFunctions.push_back(func);
+            }
+            needRestart |= needRestartBeforeFunction;
             func.reset();
             return Visitor::visit(that);
         }
@@ -3915,6 +3961,10 @@ namespace das {
                     error("can't safe get field " + expr->name, "", "",
                         expr->at, CompilationError::cant_get_field);
                     return Visitor::visit(expr);
+                } else if ( expr->field->inlineCapacity ) {
+                    error("can't safe get inline_capacity field " + expr->name, "", "use . instead",
+                        expr->at, CompilationError::cant_get_field);
+                    return Visitor::visit(expr);
                 }
                 expr->type = make_smart<TypeDecl>(*expr->field->type);
             } else if ( valT->firstType->isHandle() ) {
@@ -4324,6 +4374,13 @@ namespace das {
                 return leftType->isSameType(*rightType, RefMatters::no, ConstMatters::no, tmatter, AllowSubstitute::no, true, true);
             }
         }
+        bool isInlineArrayField ( const Expression * expr ) const {
+            if ( expr->rtti_isField() ) {
+                auto ef = static_cast<const ExprField *>(expr);
+                return ef->field && ef->field->inlineCapacity;
+            }
+            return false;
+        }
         string moveErrorInfo(ExprMove * expr) const {
             return ", " + expr->left->type->describe() + " <- " + expr->right->type->describe();
         }
@@ -4345,6 +4402,9 @@ namespace das {
             } else if ( expr->right->type->constant ) {
                 error("can't move from a constant value"+moveErrorInfo(expr), "", "",
                     expr->at, CompilationError::cant_move);
+            } else if ( isInlineArrayField(expr->right.get()) ) {
+                error("can't move from an inline_capacity field, use clone (:=) instead"+moveErrorInfo(expr), "", "",
+                    expr->at, CompilationError::cant_move);
             } else if ( expr->right->type->isTemp(true,false) ) {
                 error("can't move temporary value"+moveErrorInfo(expr), "", "",
                     expr->at, CompilationError::cant_pass_temporary);
@@ -4587,6 +4647,9 @@ namespace das {
             if ( expr->moveSemantics && expr->subexpr->type->isConst() ) {
                 error("can't return via move from a constant value", "", "",
                     expr->at, CompilationError::cant_move);
+            } else if ( expr->moveSemantics && isInlineArrayField(expr->subexpr.get()) ) {
+                error("can't return via move from an inline_capacity field", "", "",
+                    expr->at, CompilationError::cant_move);
             }
             return false;
         }
@@ -5117,6 +5180,9 @@ namespace das {
             } else if ( var->init_via_move && var->init->type->isConst() ) {
                 error("local variable " + var->name + " can't init (move) from a constant value", "", "",
                     var->at, CompilationError::cant_move);
+            } else if ( var->init_via_move && isInlineArrayField(var->init.get()) ) {
+                error("local variable " + var->name + " can't init (move) from an inline_capacity field", "", "use := instead",
+                    var->at, CompilationError::cant_move);
             } else if ( var->init_via_clone && !var->init->type->canClone() ) {
                 auto varType = make_smart<TypeDecl>(*var->type);
                 varType->ref = true;
@@ -5163,6 +5229,7 @@ namespace das {
                     finFunc->body = newFinalizer->body;
                 }
                 // ---
+                nonLocalChange = true;      // generator structure and its finalizer changed
                 reportAstChanged();
                 return blk;
             }
@@ -5763,6 +5830,9 @@ namespace das {
                 } else if (decl->moveSemantics && decl->value->type->isConst()) {
                     error("can't move from a constant value " + decl->value->type->describe(), "", "",
                         decl->value->at, CompilationError::cant_move);
+                } else if ( decl->moveSemantics && isInlineArrayField(decl->value.get()) ) {
+                    error("can't move from an inline_capacity field " + decl->value->type->describe(), "", "",
+                        decl->value->at, CompilationError::cant_move);
                 }
             } else {
                 error("field not found, " + decl->name, "", "",
@@ -5849,6 +5919,9 @@ namespace das {
                     } else if (decl->moveSemantics && decl->value->type->isConst()) {
                         error("can't move from a constant value " + decl->value->type->describe(), "", "",
                             decl->value->at, CompilationError::cant_move);
+                    } else if ( decl->moveSemantics && isInlineArrayField(decl->value.get()) ) {
+                        error("can't move from an inline_capacity field " + decl->value->type->describe(), "", "",
+                            decl->value->at, CompilationError::cant_move);
                     }
                 } else {
                     error("field not found, " + decl->name, "", "",
@@ -5871,6 +5944,9 @@ namespace das {
                     } else if (decl->moveSemantics && decl->value->type->isConst()) {
                         error("can't move from a constant value " + decl->value->type->describe(), "", "",
                             decl->value->at, CompilationError::cant_move);
+                    } else if ( decl->moveSemantics && isInlineArrayField(decl->value.get()) ) {
+                        error("can't move from an inline_capacity field " + decl->value->type->describe(), "", "",
+                            decl->value->at, CompilationError::cant_move);
                     }
                 } else {
                     error("annotation field not found, " + decl->name, "", "",
@@ -6085,6 +6161,9 @@ namespace das {
             if (!init->type->canCopy() && init->type->canMove() && init->type->isConst()) {
                 error("can't move from a constant value " + init->type->describe(), "", "",
                     init->at, CompilationError::cant_move);
+            } else if ( isInlineArrayField(init) ) {
+                error("can't move from an inline_capacity field " + init->type->describe(), "", "",
+                    init->at, CompilationError::cant_move);
             }
             if ( init->rtti_isMakeLocal() ) {
                 auto initl = static_cast<ExprMakeLocal *>(init);
@@ -6232,6 +6311,9 @@ namespace das {
             } else if ( !expr->recordType->canCopy() && expr->recordType->canMove() && init->type->isConst() ) {
                 error("can't move from a constant value\n\t" + init->type->describe(), "", "",
                     init->at, CompilationError::cant_move);
+            } else if ( isInlineArrayField(init) ) {
+                error("can't move from an inline_capacity field\n\t" + init->type->describe(), "", "",
+                    init->at, CompilationError::cant_move);
             }
             if ( init->rtti_isMakeLocal() ) {
                 auto initl = static_cast<ExprMakeLocal *>(init);
@@ -6312,7 +6394,11 @@ namespace das {
             auto modMacro = [&](Module * mod) -> bool {    // we run all macros for each module
                 if ( thisModule->isVisibleDirectly(mod) && mod!=thisModule.get() ) {
                     for ( const auto & pm : mod->macros ) {
-                        bool anyWork = pm->apply(this, thisModule.get());
+                        bool anyWork;
+                        {
+                            CompilePhaseScope phase(this, "macro", mod->name + "::" + pm->name);
+                            anyWork = pm->apply(this, thisModule.get());
+                        }
                         if ( failed() ) {                       // if macro failed, we report it, and we are done
                             error("macro " + mod->name + "::" + pm->name + " failed", "", "", LineInfo());
                             return false;
@@ -6337,8 +6423,27 @@ namespace das {
         } while ( !failed() && anyMacrosDidWork );
     }
 
+    // names of all functions, which are called (or addressed) by the function
+    class CollectCallees : public Visitor {
+    public:
+        das_set<string> callees;
+    protected:
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            if ( expr->rtti_isCallFunc() ) {
+                if ( auto fn = static_cast<ExprCallFunc *>(expr)->func ) callees.insert(fn->name);
+            } else if ( expr->rtti_isAddr() ) {
+                if ( auto fn = static_cast<ExprAddr *>(expr)->func ) callees.insert(fn->name);
+            }
+        }
+    };
+
+    // after the first pass only functions, which changed, failed, or depend on something that changed, are visited
+    //  function depends on everything it calls by name, so a new overload or a generic instance invalidates the callers too
+    //  any non-local change (globals, structures, other functions), or any infer macro work, restarts with a full pass
     void Program::inferTypesDirty(TextWriter & logs) {
         const bool log = options.getBoolOption("log_infer_passes",false);
+        const bool incremental = options.getBoolOption("incremental_infer",true);
         int pass = 0, maxPasses = 50;
         if (auto maxP = options.find("max_infer_passes", Type::tInt)) {
             maxPasses = maxP->iValue;
@@ -6346,10 +6451,21 @@ namespace das {
         if ( log ) {
             logs << "INITIAL CODE:\n" << *this;
         }
+        das_map<Function *,FunctionPtr> cleanFunctions;    // holds on to the function, so that the pointer is not reused
+        das_map<string,vector<Function *>> callers;
         for ( pass = 0; pass < maxPasses; ++pass ) {
+            CompilePhaseScope phase(this, "infer pass", to_string(pass));
             failToCompile = false;
             errors.clear();
+            das_set<Function *> existingFunctions;
+            for ( auto & fn : thisModule->functions ) {
+                existingFunctions.insert(fn.second.get());
+            }
             InferTypes context(this);
+            for ( auto & cfn : cleanFunctions ) {
+                context.skipFunctions.insert(cfn.first);
+            }
+            context.callers = &callers;
             visit(context);
             for ( auto efn : context.extraFunctions ) {
                 addFunction(efn);
@@ -6358,6 +6474,7 @@ namespace das {
             auto modMacro = [&](Module * mod) -> bool {
                 if ( thisModule->isVisibleDirectly(mod) && mod!=thisModule.get() ) {
                     for ( const auto & pm : mod->inferMacros ) {
+                        CompilePhaseScope macroPhase(this, "infer macro", mod->name + "::" + pm->name);
                         anyMacrosDidWork |= pm->apply(this, thisModule.get());
                     }
                 }
@@ -6365,8 +6482,40 @@ namespace das {
             };
             Module::foreach(modMacro);
             library.foreach(modMacro, "*");
+            if ( !incremental || context.nonLocalChange || anyMacrosDidWork ) {
+                cleanFunctions.clear();
+                callers.clear();
+            } else {
+                for ( auto & fn : context.cleanFunctions ) {
+                    cleanFunctions[fn.get()] = fn;
+                    CollectCallees collect;
+                    fn->visit(collect);
+                    for ( auto & callee : collect.callees ) {
+                        callers[callee].push_back(fn.get());
+                    }
+                }
+                das_set<string> changed;
+                for ( auto & fn : context.dirtyFunctions ) {
+                    changed.insert(fn->name);
+                }
+                for ( auto & fn : thisModule->functions ) {
+                    if ( existingFunctions.find(fn.second.get())==existingFunctions.end() ) {
+                        changed.insert(fn.second->name);
+                    }
+                }
+                for ( auto & name : changed ) {
+                    auto it = callers.find(name);
+                    if ( it != callers.end() ) {
+                        for ( auto caller : it->second ) {
+                            cleanFunctions.erase(caller);
+                        }
+                        callers.erase(it);
+                    }
+                }
+            }
             if ( log ) {
-                logs << "PASS " << pass << ":\n" << *this;
+                logs << "PASS " << pass << ", visited " << (context.cleanFunctions.size() + context.dirtyFunctions.size())
+                    << " functions, skipped " << context.skipFunctions.size() << ":\n" << *this;
                 sort(errors.begin(), errors.end());
                 for (auto & err : errors) {
                     logs << reportError(err.at, err.what, err.extra, err.fixme, err.cerr);
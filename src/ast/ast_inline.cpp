@@ -0,0 +1,199 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // function can be inlined, if
+    //  its a pure leaf function of this module, which consists of a single 'return expr'
+    //  it only reads its arguments, which are workhorse types or are passed by reference
+    //  'expr' is cheap enough, and does not need its own stack
+    class InlineCandidate : public Visitor {
+    public:
+        InlineCandidate ( Function * f ) : fn(f) {}
+        bool        failed = false;
+        int         cost = 0;
+        vector<int> uses;           // per argument
+    protected:
+        Function *  fn;
+    protected:
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            cost ++;
+            if ( expr->rtti_isBlock() || expr->rtti_isMakeBlock() || expr->rtti_isLet()
+                    || expr->rtti_isMakeLocal() || expr->rtti_isAscend() || expr->rtti_isInvoke() ) {
+                failed = true;
+            } else if ( expr->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(expr);
+                if ( !evar->argument || evar->argumentIndex<0 || evar->write
+                        || evar->variable!=fn->arguments[evar->argumentIndex] ) {
+                    failed = true;
+                } else {
+                    uses[evar->argumentIndex] ++;
+                }
+            } else if ( expr->rtti_isCallFunc() ) {
+                auto ecall = static_cast<ExprCallFunc *>(expr);
+                if ( ecall->func && !ecall->func->builtIn ) {
+                    failed = true;      // only leaf functions, so that inlining always terminates
+                } else if ( ecall->type && !ecall->type->isWorkhorseType() && !ecall->type->isVoid() ) {
+                    failed = true;      // result would need stack
+                }
+            } else if ( expr->rtti_isAddr() ) {
+                failed = true;
+            }
+        }
+    };
+
+    // substitutes arguments of the inlined function with the call arguments
+    //  argument, which is read by value, is replaced with the value of the call argument
+    //  argument, which is used by reference, is replaced with the variable, which was passed to the call
+    class InlineArguments : public Visitor {
+    public:
+        InlineArguments ( ExprCallFunc * c ) : call(c) {}
+        bool failed = false;
+    protected:
+        ExprCallFunc *      call;
+        das_set<Expression *> valueUse;
+        das_set<Expression *> valueArg;
+    protected:
+        ExpressionPtr argValue ( int index ) {
+            auto arg = call->arguments[index]->clone();
+            return arg->type->isRef() && !arg->type->isRefType() ? Expression::autoDereference(arg) : arg;
+        }
+        ExpressionPtr argRef ( int index ) {
+            auto arg = call->arguments[index];
+            if ( arg->rtti_isR2V() ) {
+                arg = static_pointer_cast<ExprRef2Value>(arg)->subexpr;
+            }
+            if ( arg->rtti_isVar() ) {
+                auto evar = static_pointer_cast<ExprVar>(arg->clone());
+                if ( evar->r2v ) {
+                    evar->r2v = false;
+                    evar->type->ref = true;
+                }
+                return evar;
+            } else if ( arg->type->isRefType() && !arg->type->ref ) {
+                return arg->clone();
+            }
+            failed = true;
+            return nullptr;
+        }
+        virtual void preVisit ( ExprRef2Value * expr ) override {
+            Visitor::preVisit(expr);
+            valueUse.insert(expr->subexpr.get());
+        }
+        virtual ExpressionPtr visit ( ExprRef2Value * expr ) override {
+            if ( valueArg.find(expr->subexpr.get())!=valueArg.end() ) {
+                return expr->subexpr;
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprVar * expr ) override {
+            if ( failed || !expr->argument ) return Visitor::visit(expr);
+            int index = expr->argumentIndex;
+            if ( expr->r2v || valueUse.find(expr)!=valueUse.end() ) {
+                auto arg = argValue(index);
+                valueArg.insert(arg.get());
+                return arg;
+            } else if ( auto arg = argRef(index) ) {
+                return arg;
+            } else {
+                return Visitor::visit(expr);
+            }
+        }
+    };
+
+    class InlineCalls : public PassVisitor {
+    public:
+        InlineCalls ( int mc, int mhc, ProfileData * pd ) : maxCost(mc), maxHotCost(mhc), profile(pd) {}
+    protected:
+        int maxCost;
+        int maxHotCost;         // call site, which is hot in the profile
+        ProfileData * profile;
+        das_map<Function *,int> candidates;
+    protected:
+        // with the profile, hot call sites get bigger budget, and cold ones are left alone
+        int siteCost ( const LineInfo & at ) const {
+            if ( !profile ) return maxCost;
+            if ( profile->isHot(at) ) return maxHotCost;
+            if ( profile->isCold(at) ) return -1;
+            return maxCost;
+        }
+        bool isCandidate ( Function * fn, int budget ) {
+            auto it = candidates.find(fn);
+            if ( it==candidates.end() ) {
+                it = candidates.insert(make_pair(fn, candidateCost(fn))).first;
+            }
+            return it->second>=0 && it->second<=budget;
+        }
+        // cost of the inlined expression, or -1 if function can't be inlined
+        int candidateCost ( Function * fn ) {
+            if ( fn->builtIn || fn->module!=program->thisModule.get() || !fn->annotations.empty() ) return -1;
+            if ( fn->generator || fn->lambda || fn->sideEffectFlags ) return -1;
+            // public function of the module can be called from the outside (i.e. via macro),
+            // and should not lose its only use in the module, or AOT of the module will not have it
+            if ( !fn->module->name.empty() && !fn->privateFunction ) return -1;
+            if ( !fn->result->isWorkhorseType() || fn->result->isRef() ) return -1;
+            for ( auto & arg : fn->arguments ) {
+                if ( arg->type->ref || arg->type->isHandle() ) return -1;
+                if ( !arg->type->isWorkhorseType() && !arg->type->isRefType() ) return -1;
+            }
+            if ( !fn->body || !fn->body->rtti_isBlock() ) return -1;
+            auto block = static_pointer_cast<ExprBlock>(fn->body);
+            if ( block->list.size()!=1 || !block->finalList.empty() || !block->list.back()->rtti_isReturn() ) return -1;
+            auto ret = static_pointer_cast<ExprReturn>(block->list.back());
+            if ( !ret->subexpr || ret->returnFlags ) return -1;
+            InlineCandidate cand(fn);
+            cand.uses.resize(fn->arguments.size(), 0);
+            ret->subexpr->visit(cand);
+            return cand.failed ? -1 : cand.cost;
+        }
+        static bool isTrivial ( Expression * arg ) {
+            if ( arg->rtti_isR2V() ) arg = static_cast<ExprRef2Value *>(arg)->subexpr.get();
+            return arg->rtti_isConstant() || arg->rtti_isVar();
+        }
+        ExpressionPtr inlineCall ( ExprCallFunc * expr ) {
+            auto fn = expr->func;
+            if ( expr->arguments.size()!=fn->arguments.size() ) return nullptr;
+            auto ret = static_pointer_cast<ExprReturn>(static_pointer_cast<ExprBlock>(fn->body)->list.back());
+            InlineCandidate cand(fn);
+            cand.uses.resize(fn->arguments.size(), 0);
+            ret->subexpr->visit(cand);
+            // each argument is evaluated exactly once, or its a variable or a constant
+            for ( size_t i=0; i!=expr->arguments.size(); ++i ) {
+                auto arg = expr->arguments[i].get();
+                if ( !isTrivial(arg) && (cand.uses[i]!=1 || !arg->noSideEffects) ) {
+                    return nullptr;
+                }
+            }
+            InlineArguments subst(expr);
+            auto body = ret->subexpr->clone()->visit(subst);
+            if ( subst.failed ) return nullptr;
+            if ( body->type->isRef() && !expr->type->isRef() ) {
+                body = Expression::autoDereference(body);
+            }
+            return body;
+        }
+        virtual ExpressionPtr visit ( ExprCall * expr ) override {
+            if ( expr->func && expr->func!=currentFunction && isCandidate(expr->func, siteCost(expr->at)) ) {
+                if ( auto body = inlineCall(expr) ) {
+                    reportFolding();
+                    return body;
+                }
+            }
+            return Visitor::visit(expr);
+        }
+    };
+
+    bool Program::optimizationInline(PassWorklist * worklist) {
+        if ( getDebugger() || options.getBoolOption("no_inline",false) ) {
+            return false;
+        }
+        InlineCalls context(options.getIntOption("max_inline_cost",16),
+            options.getIntOption("max_hot_inline_cost",64), policies.profile.get());
+        context.worklist = worklist;
+        visit(context);
+        return context.didAnything();
+    }
+}
@@ -379,10 +379,19 @@ namespace das {
     // optimization
         "optimize",                     Type::tBool,
         "fusion",                       Type::tBool,
+        "incremental_optimize",         Type::tBool,
+        "no_inline",                    Type::tBool,
+        "max_inline_cost",              Type::tInt,
+        "max_hot_inline_cost",          Type::tInt,
+        "no_bounds_check_elimination",  Type::tBool,
+        "no_escape_analysis",           Type::tBool,
+        "max_stack_new_size",           Type::tInt,
+        "no_devirtualize",              Type::tBool,
         "remove_unused_symbols",        Type::tBool,
     // language
         "always_export_initializer",    Type::tBool,
         "infer_time_folding",           Type::tBool,
+        "incremental_infer",            Type::tBool,
         "disable_run",                  Type::tBool,
         "max_infer_passes",             Type::tInt,
         "indenting",                    Type::tInt,
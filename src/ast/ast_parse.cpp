@@ -216,6 +216,7 @@ namespace das {
         auto time0 = ref_time_ticks();
         int err;
         auto program = g_Program = make_smart<Program>();
+        program->compileUnit = fileName;
         program->isCompiling = true;
         g_Program->policies = policies;
         g_Access = access;
@@ -227,23 +228,29 @@ namespace das {
             return true;
         },"*");
         g_FileAccessStack.clear();
-        if ( auto fi = access->getFileInfo(fileName) ) {
-            g_FileAccessStack.push_back(fi);
-            if (isUtf8Text(fi->source, fi->sourceLength)) {
-                das_yybegin(fi->source + 3);
+        {
+            CompilePhaseScope phase(program.get(), "parse");
+            if ( auto fi = access->getFileInfo(fileName) ) {
+                g_FileAccessStack.push_back(fi);
+                if (isUtf8Text(fi->source, fi->sourceLength)) {
+                    das_yybegin(fi->source + 3);
+                } else {
+                    das_yybegin(fi->source);
+                }
             } else {
-                das_yybegin(fi->source);
+                g_Program->error(fileName + " not found", "","",LineInfo());
+                g_Program.reset();
+                g_Access.reset();
+                g_FileAccessStack.clear();
+                program->isCompiling = false;
+                return program;
+            }
+            err = das_yyparse();        // TODO: add mutex or make thread safe?
+            das_yylex_destroy();
+            if ( !program->thisModule->name.empty() ) {
+                program->compileUnit = program->thisModule->name;
             }
-        } else {
-            g_Program->error(fileName + " not found", "","",LineInfo());
-            g_Program.reset();
-            g_Access.reset();
-            g_FileAccessStack.clear();
-            program->isCompiling = false;
-            return program;
         }
-        err = das_yyparse();        // TODO: add mutex or make thread safe?
-        das_yylex_destroy();
         g_Access.reset();
         g_FileAccessStack.clear();
         if ( err || program->failed() ) {
@@ -252,23 +259,42 @@ namespace das {
             program->isCompiling = false;
             return program;
         } else {
-            program->inferTypes(logs, libGroup);
+            {
+                CompilePhaseScope phase(program.get(), "infer");
+                program->inferTypes(logs, libGroup);
+            }
             if ( !program->failed() ) {
-                program->lint(libGroup);
-                program->foldUnsafe();
+                {
+                    CompilePhaseScope phase(program.get(), "lint");
+                    program->lint(libGroup);
+                }
+                {
+                    CompilePhaseScope phase(program.get(), "fold unsafe");
+                    program->foldUnsafe();
+                }
                 if (program->getOptimize()) {
+                    CompilePhaseScope phase(program.get(), "optimize");
                     program->optimize(logs,libGroup);
                 } else {
+                    CompilePhaseScope phase(program.get(), "access flags");
                     program->buildAccessFlags(logs);
                 }
-                if (!program->failed())
+                if (!program->failed()) {
+                    CompilePhaseScope phase(program.get(), "contracts");
                     program->verifyAndFoldContracts();
-                if (!program->failed())
+                }
+                if (!program->failed()) {
+                    CompilePhaseScope phase(program.get(), "unused symbols");
                     program->markOrRemoveUnusedSymbols(exportAll);
-                if (!program->failed())
+                }
+                if (!program->failed()) {
+                    CompilePhaseScope phase(program.get(), "allocate stack");
                     program->allocateStack(logs);
-                if (!program->failed())
+                }
+                if (!program->failed()) {
+                    CompilePhaseScope phase(program.get(), "finalize annotations");
                     program->finalizeAnnotations();
+                }
             }
             if (!program->failed()) {
                 if (program->options.getBoolOption("log")) {
@@ -282,10 +308,15 @@ namespace das {
             sort(program->errors.begin(), program->errors.end());
             program->isCompiling = false;
             if ( program->needMacroModule ) {
+                CompilePhaseScope phase(program.get(), "macro module");
                 program->makeMacroModule(logs);
             }
             if ( program->options.getBoolOption("log_compile_time",false) ) {
                 auto dt = get_time_usec(time0) / 1000000.;
+                program->logCompilePhases(logs);
+                if ( program->devirtualizedCalls ) {
+                    logs << "devirtualized " << program->devirtualizedCalls << " call sites\n";
+                }
                 logs << "compiler took " << dt << "\n";
             }
             return program;
@@ -302,10 +333,20 @@ namespace das {
         vector<string> missing, circular;
         das_set<string> dependencies;
         TextWriter tw;
-        if ( getPrerequisits(fileName, access, req, missing, circular, dependencies, libGroup, tw, 1) ) {
+        CompilePhase::resetTimeOrigin();
+        vector<CompilePhase> phases;
+        CompilePhase prereq;
+        prereq.name = "require";
+        prereq.module = fileName;
+        auto timeR = ref_time_ticks();
+        bool prereqOk = getPrerequisits(fileName, access, req, missing, circular, dependencies, libGroup, tw, 1);
+        prereq.usec = get_time_usec(timeR);
+        phases.push_back(prereq);
+        if ( prereqOk ) {
             for ( auto & mod : req ) {
                 if ( !libGroup.findModule(mod.moduleName) ) {
                     auto program = parseDaScript(mod.fileName, access, logs, libGroup, true, policies);
+                    phases.insert(phases.end(), program->compilePhases.begin(), program->compilePhases.end());
                     if ( program->failed() ) {
                         return program;
                     }
@@ -340,9 +381,13 @@ namespace das {
                 }
             }
             auto res = parseDaScript(fileName, access, logs, libGroup, exportAll, policies);
+            res->compilePhases.insert(res->compilePhases.begin(), phases.begin(), phases.end());
             if ( res->options.getBoolOption("log_require",false) ) {
                 logs << "module dependency graph:\n" << tw.str();
             }
+            if ( res->options.getBoolOption("log_compile_time",false) ) {
+                res->logCompilePhases(logs, true);
+            }
             return res;
         } else {
             auto program = make_smart<Program>();
@@ -0,0 +1,87 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+
+namespace das {
+
+    // file fileName
+    // line samples
+    // ...
+    bool ProfileData::load ( const char * text, uint32_t length, string & error ) {
+        files.clear();
+        totalSamples = 0;
+        vector<uint64_t> * data = nullptr;
+        const char * end = text + length;
+        int lineNo = 0;
+        while ( text < end ) {
+            const char * eol = text;
+            while ( eol!=end && *eol!='\n' ) eol ++;
+            string ln(text, eol);
+            text = eol==end ? end : eol + 1;
+            lineNo ++;
+            if ( !ln.empty() && ln.back()=='\r' ) ln.pop_back();
+            if ( ln.empty() ) continue;
+            if ( ln.compare(0, 5, "file ")==0 ) {
+                data = &files[ln.substr(5)];
+                continue;
+            }
+            unsigned long line = 0;
+            unsigned long long samples = 0;
+            if ( !data || sscanf(ln.c_str(), "%lu %llu", &line, &samples)!=2 ) {
+                error = "invalid profile data at line " + to_string(lineNo);
+                files.clear();
+                totalSamples = 0;
+                return false;
+            }
+            if ( data->size()<=line ) data->resize(line + 1);
+            (*data)[line] += samples;
+            totalSamples += samples;
+        }
+        return true;
+    }
+
+    uint64_t ProfileData::getSamples ( const LineInfo & at ) const {
+        if ( !at.fileInfo ) return 0;
+        auto it = files.find(at.fileInfo->name);
+        if ( it==files.end() ) return 0;
+        const auto & data = it->second;
+        uint64_t samples = 0;
+        uint32_t last = at.last_line > at.line ? at.last_line : at.line;
+        for ( uint32_t line=at.line; line<=last && line<data.size(); ++line ) {
+            samples += data[line];
+        }
+        return samples;
+    }
+
+    bool ProfileData::isHot ( const LineInfo & at ) const {
+        return totalSamples && getSamples(at) * 100.0 >= totalSamples * hotPercent;
+    }
+
+    ProfileDataPtr loadProfileData ( const string & fileName, TextWriter & logs ) {
+        FILE * f = fopen(fileName.c_str(), "rb");
+        if ( !f ) {
+            logs << "can't open profile " << fileName << "\n";
+            return nullptr;
+        }
+        string text;
+        char buf[4096];
+        size_t len;
+        while ( (len = fread(buf, 1, sizeof(buf), f))!=0 ) {
+            text.append(buf, len);
+        }
+        fclose(f);
+        auto profile = make_smart<ProfileData>();
+        string error;
+        if ( !profile->load(text.c_str(), uint32_t(text.size()), error) ) {
+            logs << fileName << ": " << error << "\n";
+            return nullptr;
+        }
+        return profile;
+    }
+
+    bool ProfileData::isCold ( const LineInfo & at ) const {
+        if ( !at.fileInfo || !at.line ) return false;
+        if ( files.find(at.fileInfo->name)==files.end() ) return false;
+        return getSamples(at)==0;
+    }
+}
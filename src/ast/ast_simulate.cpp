@@ -13,6 +13,7 @@
 #include "daScript/simulate/simulate_nodes.h"
 
 #include "daScript/misc/lookup1.h"
+#include "daScript/misc/performance_time.h"
 
 #include "daScript/simulate/simulate_visit_op.h"
 
@@ -1322,7 +1323,15 @@ namespace das
                 persistent = typeexpr->structType->persistent;
             }
             int32_t bytes = type->firstType->getSizeOf();
-            if ( initializer ) {
+            if ( onStack ) {
+                if ( initializer ) {
+                    auto pCall = (SimNode_CallBase *) context.code->makeNodeUnroll<SimNode_NewOnStackWithInitializer>(int(arguments.size()),at,bytes,stackTop);
+                    pCall->cmresEval = nullptr;
+                    return ExprCall::simulateCall(func, this, context, pCall);
+                } else {
+                    return context.code->makeNode<SimNode_NewOnStack>(at,bytes,stackTop);
+                }
+            } else if ( initializer ) {
                 auto pCall = (SimNode_CallBase *) context.code->makeNodeUnroll<SimNode_NewWithInitializer>(int(arguments.size()),at,bytes,persistent);
                 pCall->cmresEval = nullptr;
                 newNode = ExprCall::simulateCall(func, this, context, pCall);
@@ -1363,7 +1372,13 @@ namespace das
             auto prv = subexpr->simulate(context);
             auto pidx = index->simulate(context);
             uint32_t stride = subexpr->type->firstType->getSizeOf();
-            if ( r2vType!=Type::none ) {
+            if ( unchecked ) {
+                if ( r2vType!=Type::none ) {
+                    return context.code->makeValueNode<SimNode_ArrayAtR2VUnchecked>(r2vType, at, prv, pidx, stride, extraOffset);
+                } else {
+                    return context.code->makeNode<SimNode_ArrayAtUnchecked>(at, prv, pidx, stride, extraOffset);
+                }
+            } else if ( r2vType!=Type::none ) {
                 return context.code->makeValueNode<SimNode_ArrayAtR2V>(r2vType, at, prv, pidx, stride, extraOffset);
             } else {
                 return context.code->makeNode<SimNode_ArrayAt>(at, prv, pidx, stride, extraOffset);
@@ -1703,6 +1718,19 @@ namespace das
     }
 
     SimNode * ExprField::trySimulate (Context & context, uint32_t extraOffset, Type r2vType ) const {
+        if ( field && field->inlineCapacity ) {
+            // inline array data is fixed up on every access, so nothing can be folded through it
+            if ( extraOffset || r2vType!=Type::none ) {
+                return nullptr;
+            }
+            auto simA = trySimulateField(context, 0, Type::none);
+            return context.code->makeNode<SimNode_InlineArray>(at, simA,
+                field->getInlineStorageOffset(), field->inlineCapacity);
+        }
+        return trySimulateField(context, extraOffset, r2vType);
+    }
+
+    SimNode * ExprField::trySimulateField (Context & context, uint32_t extraOffset, Type r2vType ) const {
         if ( !field && fieldIndex==-1 ) {
             return nullptr;
         }
@@ -2649,6 +2677,8 @@ namespace das
     }
 
     bool Program::simulate ( Context & context, TextWriter & logs, StackAllocator * sharedStack ) {
+        auto time0 = ref_time_ticks();
+        CompilePhaseScope phase(this, "simulate");
         isSimulating = true;
         context.thisProgram = this;
         context.persistent = options.getBoolOption("persistent_heap", policies.persistent_heap);
@@ -2762,7 +2792,10 @@ namespace das
             isSimulating = false;
             return false;
         }
-        fusion(context, logs);
+        {
+            CompilePhaseScope fusionPhase(this, "fusion");
+            fusion(context, logs);
+        }
         context.relocateCode();
         context.restart();
         // now call annotation simulate
@@ -2807,6 +2840,7 @@ namespace das
             }
         }
         // run init script and restart
+        CompilePhaseScope initPhase(this, "init script");
         if (!context.runWithCatch([&]() {
             if (context.stack.size()) {
                 context.runInitScript();
@@ -2851,6 +2885,9 @@ namespace das
         }
         context.debugger = getDebugger();
         isSimulating = false;
+        if ( options.getBoolOption("log_compile_time",false) ) {
+            logs << "simulate took " << (get_time_usec(time0) / 1000000.) << "\n";
+        }
         return errors.size() == 0;
     }
 
@@ -2879,6 +2916,8 @@ namespace das
     }
 
     void Program::linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs ) {
+        auto time0 = ref_time_ticks();
+        CompilePhaseScope phase(this, "aot link");
         bool logIt = options.getBoolOption("log_aot",false);
 
         // make list of functions
@@ -2935,5 +2974,8 @@ namespace das
                 if ( logIt ) logs << "INIT SCRIPT NOT FOUND, AOT=0x" << HEX << semHash << DEC << "\n";
             }
         }
+        if ( options.getBoolOption("log_compile_time",false) ) {
+            logs << "aot link took " << (get_time_usec(time0) / 1000000.) << "\n";
+        }
     }
 }
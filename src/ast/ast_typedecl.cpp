@@ -15,6 +15,16 @@ namespace das
     {
     }
 
+    void * TypeDecl::operator new ( size_t size ) {
+        CompilePhase::astNodesAllocated ++;
+        CompilePhase::astBytesAllocated += size;
+        return ::operator new(size);
+    }
+
+    void TypeDecl::operator delete ( void * ptr, size_t ) {
+        ::operator delete(ptr);
+    }
+
     bool TypeDecl::isExprType() const {
         for ( auto di : dim ) {
             if ( di==TypeDecl::dimConst ) {
@@ -596,10 +596,11 @@ namespace das {
         faf.MarkSideEffects(*thisModule);
     }
 
-    bool Program::optimizationUnused(TextWriter & logs) {
+    bool Program::optimizationUnused(TextWriter & logs, PassWorklist * worklist) {
         buildAccessFlags(logs);
         // remove itselft
         RemoveUnusedLocalVariables context;
+        context.worklist = worklist;
         visit(context);
         return context.didAnything();
     }
@@ -346,7 +346,7 @@ namespace das {
     TypeDeclPtr makeExprAtFlags() {
         auto ft = make_smart<TypeDecl>(Type::tBitfield);
         ft->alias = "ExprAtFlags";
-        ft->argNames = { "r2v", "r2cr", "write" };
+        ft->argNames = { "r2v", "r2cr", "write", "unchecked" };
         return ft;
     }
 
@@ -1008,6 +1008,7 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(annotation)>("annotation");
             addField<DAS_BIND_MANAGED_FIELD(at)>("at");
             addField<DAS_BIND_MANAGED_FIELD(offset)>("offset");
+            addField<DAS_BIND_MANAGED_FIELD(inlineCapacity)>("inlineCapacity");
             addFieldEx ( "flags", "flags", offsetof(Structure::FieldDeclaration, flags), makeFieldDeclarationFlags() );
         }
     };
@@ -2118,6 +2119,14 @@ namespace das {
         return module->addVariable(var, false);
     }
 
+    bool addModuleStructure ( Module * module, StructurePtr st, Context * ) {
+        return module->addStructure(st, true);
+    }
+
+    void addStructureField ( smart_ptr_raw<Structure> st, const char * name, TypeDeclPtr td, const LineInfo & at ) {
+        st->fields.emplace_back(name ? name : "", td, nullptr, AnnotationArgumentList(), false, at);
+    }
+
     void addModuleFunctionAnnotation ( Module * module, FunctionAnnotationPtr ann, Context * context ) {
         if ( !module->addAnnotation(ann, true) ) {
             context->throw_error_ex("can't add function annotation %s to module %s",
@@ -2539,6 +2548,11 @@ namespace das {
             // variables
             addExtern<DAS_BIND_FUN(addModuleVariable)>(*this, lib, "add_variable",
                 SideEffects::modifyExternal, "addModuleVariable");
+            // structures
+            addExtern<DAS_BIND_FUN(addModuleStructure)>(*this, lib, "add_structure",
+                SideEffects::modifyExternal, "addModuleStructure");
+            addExtern<DAS_BIND_FUN(addStructureField)>(*this, lib, "add_structure_field",
+                SideEffects::modifyExternal, "addStructureField");
             // structure annotation
             addAnnotation(make_smart<AstStructureAnnotationAnnotation>(lib));
             addExtern<DAS_BIND_FUN(makeStructureAnnotation)>(*this, lib,  "make_structure_annotation",
@@ -0,0 +1,359 @@
+#include "daScript/misc/platform.h"
+
+#include "module_builtin.h"
+
+#include "daScript/simulate/simulate_nodes.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/ast/ast_interop.h"
+#include "daScript/ast/ast_policy_types.h"
+#include "daScript/simulate/aot_builtin_bulk.h"
+
+#include "daScript/misc/performance_time.h"
+
+namespace das {
+
+    // number of set bits in the 4-bit v_signmask result
+    static const int32_t bulk_mask_count[16] = { 0,1,1,2, 1,2,2,3, 1,2,2,3, 2,3,3,4 };
+
+    __forceinline float * fdata ( const Array & arr ) { return (float *) arr.data; }
+    __forceinline int32_t * idata ( const Array & arr ) { return (int32_t *) arr.data; }
+
+    template <typename TT> __forceinline TT bulk_min ( TT a, TT b ) { return a<b ? a : b; }
+    template <typename TT> __forceinline TT bulk_max ( TT a, TT b ) { return a>b ? a : b; }
+
+    // fill
+
+    void bulkFillFloat ( TArray<float> & arr, float value ) {
+        float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4f v = v_splats(value);
+        for ( ; i+4<=size; i+=4 ) v_stu(data+i, v);
+        for ( ; i<size; ++i ) data[i] = value;
+    }
+
+    void bulkFillFloat4 ( TArray<float4> & arr, float4 value ) {
+        float * data = fdata(arr);
+        vec4f v = v_ldu(&value.x);
+        for ( uint32_t i=0, size=arr.size; i!=size; ++i ) v_stu(data+i*4, v);
+    }
+
+    void bulkFillInt ( TArray<int32_t> & arr, int32_t value ) {
+        int32_t * data = idata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4i v = v_splatsi(value);
+        for ( ; i+4<=size; i+=4 ) v_stu_w(data+i, v);
+        for ( ; i<size; ++i ) data[i] = value;
+    }
+
+    // copy
+
+    __forceinline void bulkCopy ( Array & dst, const Array & src, int stride, Context * context ) {
+        if ( &dst==&src ) return;
+        builtin_array_resize(dst, int(src.size), stride, context);
+        if ( src.size ) memcpy(dst.data, src.data, size_t(src.size)*stride);
+    }
+
+    void bulkCopyFloat ( TArray<float> & dst, const TArray<float> & src, Context * context ) { bulkCopy(dst, src, sizeof(float), context); }
+    void bulkCopyFloat4 ( TArray<float4> & dst, const TArray<float4> & src, Context * context ) { bulkCopy(dst, src, sizeof(float4), context); }
+    void bulkCopyInt ( TArray<int32_t> & dst, const TArray<int32_t> & src, Context * context ) { bulkCopy(dst, src, sizeof(int32_t), context); }
+
+    // sum
+
+    float bulkSumFloat ( const TArray<float> & arr ) {
+        const float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4f acc = v_zero();
+        for ( ; i+4<=size; i+=4 ) acc = v_add(acc, v_ldu(data+i));
+        float res = v_extract_x(v_dot4_x(acc, V_C_ONE));
+        for ( ; i<size; ++i ) res += data[i];
+        return res;
+    }
+
+    float4 bulkSumFloat4 ( const TArray<float4> & arr ) {
+        const float * data = fdata(arr);
+        vec4f acc = v_zero();
+        for ( uint32_t i=0, size=arr.size; i!=size; ++i ) acc = v_add(acc, v_ldu(data+i*4));
+        float4 res; v_stu(&res.x, acc);
+        return res;
+    }
+
+    int32_t bulkSumInt ( const TArray<int32_t> & arr ) {
+        const int32_t * data = idata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4i acc = v_cast_vec4i(v_zero());
+        for ( ; i+4<=size; i+=4 ) acc = v_addi(acc, v_ldu_w(data+i));
+        int32_t lanes[4]; v_stu_w(lanes, acc);
+        uint32_t res = uint32_t(lanes[0]) + uint32_t(lanes[1]) + uint32_t(lanes[2]) + uint32_t(lanes[3]);
+        for ( ; i<size; ++i ) res += uint32_t(data[i]);
+        return int32_t(res);
+    }
+
+    // min \ max
+
+    __forceinline void bulkVerifyNotEmpty ( const Array & arr, const char * what, Context * context ) {
+        if ( !arr.size ) context->throw_error_ex("%s of an empty array", what);
+    }
+
+    template <bool isMin>
+    __forceinline float bulkMinMaxFloat ( const Array & arr ) {
+        const float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        float res = data[0];
+        if ( size>=4 ) {
+            vec4f acc = v_ldu(data);
+            for ( i=4; i+4<=size; i+=4 ) {
+                vec4f v = v_ldu(data+i);
+                acc = isMin ? v_min(acc, v) : v_max(acc, v);
+            }
+            vec4f acc2 = isMin ? v_min(acc, v_rot_2(acc)) : v_max(acc, v_rot_2(acc));
+            acc2 = isMin ? v_min(acc2, v_rot_1(acc2)) : v_max(acc2, v_rot_1(acc2));
+            res = v_extract_x(acc2);
+        }
+        for ( ; i<size; ++i ) res = isMin ? bulk_min(res, data[i]) : bulk_max(res, data[i]);
+        return res;
+    }
+
+    template <bool isMin>
+    __forceinline float4 bulkMinMaxFloat4 ( const Array & arr ) {
+        const float * data = fdata(arr);
+        vec4f acc = v_ldu(data);
+        for ( uint32_t i=1, size=arr.size; i!=size; ++i ) {
+            vec4f v = v_ldu(data+i*4);
+            acc = isMin ? v_min(acc, v) : v_max(acc, v);
+        }
+        float4 res; v_stu(&res.x, acc);
+        return res;
+    }
+
+    template <bool isMin>
+    __forceinline int32_t bulkMinMaxInt ( const Array & arr ) {
+        const int32_t * data = idata(arr);
+        uint32_t i = 0, size = arr.size;
+        int32_t res = data[0];
+        if ( size>=4 ) {
+            vec4i acc = v_ldu_w(data);
+            for ( i=4; i+4<=size; i+=4 ) {
+                vec4i v = v_ldu_w(data+i);
+                acc = isMin ? v_mini(acc, v) : v_maxi(acc, v);
+            }
+            int32_t lanes[4]; v_stu_w(lanes, acc);
+            res = lanes[0];
+            for ( int32_t l=1; l!=4; ++l ) res = isMin ? bulk_min(res, lanes[l]) : bulk_max(res, lanes[l]);
+        }
+        for ( ; i<size; ++i ) res = isMin ? bulk_min(res, data[i]) : bulk_max(res, data[i]);
+        return res;
+    }
+
+    float bulkMinFloat ( const TArray<float> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "min_value", context);
+        return bulkMinMaxFloat<true>(arr);
+    }
+
+    float4 bulkMinFloat4 ( const TArray<float4> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "min_value", context);
+        return bulkMinMaxFloat4<true>(arr);
+    }
+
+    int32_t bulkMinInt ( const TArray<int32_t> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "min_value", context);
+        return bulkMinMaxInt<true>(arr);
+    }
+
+    float bulkMaxFloat ( const TArray<float> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "max_value", context);
+        return bulkMinMaxFloat<false>(arr);
+    }
+
+    float4 bulkMaxFloat4 ( const TArray<float4> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "max_value", context);
+        return bulkMinMaxFloat4<false>(arr);
+    }
+
+    int32_t bulkMaxInt ( const TArray<int32_t> & arr, Context * context ) {
+        bulkVerifyNotEmpty(arr, "max_value", context);
+        return bulkMinMaxInt<false>(arr);
+    }
+
+    // dot
+
+    __forceinline void bulkVerifySameSize ( const Array & a, const Array & b, const char * what, Context * context ) {
+        if ( a.size!=b.size ) context->throw_error_ex("%s array size mismatch, %u vs %u", what, a.size, b.size);
+    }
+
+    float bulkDotFloat ( const TArray<float> & a, const TArray<float> & b, Context * context ) {
+        bulkVerifySameSize(a, b, "dot", context);
+        const float * pa = fdata(a);
+        const float * pb = fdata(b);
+        uint32_t i = 0, size = a.size;
+        vec4f acc = v_zero();
+        for ( ; i+4<=size; i+=4 ) acc = v_madd(v_ldu(pa+i), v_ldu(pb+i), acc);
+        float res = v_extract_x(v_dot4_x(acc, V_C_ONE));
+        for ( ; i<size; ++i ) res += pa[i] * pb[i];
+        return res;
+    }
+
+    // scale
+
+    void bulkScaleFloat ( TArray<float> & arr, float s ) {
+        float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4f vs = v_splats(s);
+        for ( ; i+4<=size; i+=4 ) v_stu(data+i, v_mul(v_ldu(data+i), vs));
+        for ( ; i<size; ++i ) data[i] *= s;
+    }
+
+    void bulkScaleFloat4 ( TArray<float4> & arr, float s ) {
+        // float4 is 4 packed floats, so this is the same loop over 4x the elements
+        float * data = fdata(arr);
+        vec4f vs = v_splats(s);
+        for ( uint32_t i=0, size=arr.size*4; i!=size; i+=4 ) v_stu(data+i, v_mul(v_ldu(data+i), vs));
+    }
+
+    // axpy
+
+    void bulkAxpyFloat ( TArray<float> & y, float a, const TArray<float> & x, Context * context ) {
+        bulkVerifySameSize(y, x, "axpy", context);
+        float * py = fdata(y);
+        const float * px = fdata(x);
+        uint32_t i = 0, size = y.size;
+        vec4f va = v_splats(a);
+        for ( ; i+4<=size; i+=4 ) v_stu(py+i, v_madd(va, v_ldu(px+i), v_ldu(py+i)));
+        for ( ; i<size; ++i ) py[i] += a * px[i];
+    }
+
+    void bulkAxpyFloat4 ( TArray<float4> & y, float a, const TArray<float4> & x, Context * context ) {
+        bulkVerifySameSize(y, x, "axpy", context);
+        float * py = fdata(y);
+        const float * px = fdata(x);
+        vec4f va = v_splats(a);
+        for ( uint32_t i=0, size=y.size*4; i!=size; i+=4 ) v_stu(py+i, v_madd(va, v_ldu(px+i), v_ldu(py+i)));
+    }
+
+    // clamp
+
+    void bulkClampFloat ( TArray<float> & arr, float lo, float hi ) {
+        float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4f vlo = v_splats(lo), vhi = v_splats(hi);
+        for ( ; i+4<=size; i+=4 ) v_stu(data+i, v_min(v_max(v_ldu(data+i), vlo), vhi));
+        for ( ; i<size; ++i ) data[i] = bulk_min(bulk_max(data[i], lo), hi);
+    }
+
+    void bulkClampFloat4 ( TArray<float4> & arr, float4 lo, float4 hi ) {
+        float * data = fdata(arr);
+        vec4f vlo = v_ldu(&lo.x), vhi = v_ldu(&hi.x);
+        for ( uint32_t i=0, size=arr.size*4; i!=size; i+=4 ) v_stu(data+i, v_min(v_max(v_ldu(data+i), vlo), vhi));
+    }
+
+    void bulkClampInt ( TArray<int32_t> & arr, int32_t lo, int32_t hi ) {
+        int32_t * data = idata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4i vlo = v_splatsi(lo), vhi = v_splatsi(hi);
+        for ( ; i+4<=size; i+=4 ) v_stu_w(data+i, v_mini(v_maxi(v_ldu_w(data+i), vlo), vhi));
+        for ( ; i<size; ++i ) data[i] = bulk_min(bulk_max(data[i], lo), hi);
+    }
+
+    // count_if
+
+    enum class BulkCmp { less, greater, equal };
+
+    template <BulkCmp cmp>
+    __forceinline int32_t bulkCountFloat ( const Array & arr, float value ) {
+        const float * data = fdata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4f vv = v_splats(value);
+        int32_t res = 0;
+        for ( ; i+4<=size; i+=4 ) {
+            vec4f v = v_ldu(data+i);
+            vec4f m = cmp==BulkCmp::less ? v_cmp_gt(vv, v) : (cmp==BulkCmp::greater ? v_cmp_gt(v, vv) : v_cmp_eq(v, vv));
+            res += bulk_mask_count[v_signmask(m)];
+        }
+        for ( ; i<size; ++i ) {
+            float v = data[i];
+            res += (cmp==BulkCmp::less ? v<value : (cmp==BulkCmp::greater ? v>value : v==value)) ? 1 : 0;
+        }
+        return res;
+    }
+
+    template <BulkCmp cmp>
+    __forceinline int32_t bulkCountInt ( const Array & arr, int32_t value ) {
+        const int32_t * data = idata(arr);
+        uint32_t i = 0, size = arr.size;
+        vec4i vv = v_splatsi(value);
+        int32_t res = 0;
+        for ( ; i+4<=size; i+=4 ) {
+            vec4i v = v_ldu_w(data+i);
+            vec4i m = cmp==BulkCmp::less ? v_cmp_lti(v, vv) : (cmp==BulkCmp::greater ? v_cmp_gti(v, vv) : v_cmp_eqi(v, vv));
+            res += bulk_mask_count[v_signmask(v_cast_vec4f(m))];
+        }
+        for ( ; i<size; ++i ) {
+            int32_t v = data[i];
+            res += (cmp==BulkCmp::less ? v<value : (cmp==BulkCmp::greater ? v>value : v==value)) ? 1 : 0;
+        }
+        return res;
+    }
+
+    int32_t bulkCountLessFloat ( const TArray<float> & arr, float value ) { return bulkCountFloat<BulkCmp::less>(arr, value); }
+    int32_t bulkCountGreaterFloat ( const TArray<float> & arr, float value ) { return bulkCountFloat<BulkCmp::greater>(arr, value); }
+    int32_t bulkCountEqualFloat ( const TArray<float> & arr, float value ) { return bulkCountFloat<BulkCmp::equal>(arr, value); }
+    int32_t bulkCountLessInt ( const TArray<int32_t> & arr, int32_t value ) { return bulkCountInt<BulkCmp::less>(arr, value); }
+    int32_t bulkCountGreaterInt ( const TArray<int32_t> & arr, int32_t value ) { return bulkCountInt<BulkCmp::greater>(arr, value); }
+    int32_t bulkCountEqualInt ( const TArray<int32_t> & arr, int32_t value ) { return bulkCountInt<BulkCmp::equal>(arr, value); }
+
+    class Module_Bulk : public Module {
+    public:
+        Module_Bulk() : Module("bulk") {
+            DAS_PROFILE_SECTION("Module_Bulk");
+            ModuleLibrary lib;
+            lib.addModule(this);
+            lib.addBuiltInModule();
+            // fill
+            addExtern<DAS_BIND_FUN(bulkFillFloat )>(*this, lib, "fill", SideEffects::modifyArgument, "bulkFillFloat");
+            addExtern<DAS_BIND_FUN(bulkFillFloat4)>(*this, lib, "fill", SideEffects::modifyArgument, "bulkFillFloat4");
+            addExtern<DAS_BIND_FUN(bulkFillInt   )>(*this, lib, "fill", SideEffects::modifyArgument, "bulkFillInt");
+            // copy
+            addExtern<DAS_BIND_FUN(bulkCopyFloat )>(*this, lib, "copy", SideEffects::modifyArgument, "bulkCopyFloat");
+            addExtern<DAS_BIND_FUN(bulkCopyFloat4)>(*this, lib, "copy", SideEffects::modifyArgument, "bulkCopyFloat4");
+            addExtern<DAS_BIND_FUN(bulkCopyInt   )>(*this, lib, "copy", SideEffects::modifyArgument, "bulkCopyInt");
+            // sum
+            addExtern<DAS_BIND_FUN(bulkSumFloat )>(*this, lib, "sum", SideEffects::none, "bulkSumFloat");
+            addExtern<DAS_BIND_FUN(bulkSumFloat4)>(*this, lib, "sum", SideEffects::none, "bulkSumFloat4");
+            addExtern<DAS_BIND_FUN(bulkSumInt   )>(*this, lib, "sum", SideEffects::none, "bulkSumInt");
+            // min \ max
+            addExtern<DAS_BIND_FUN(bulkMinFloat )>(*this, lib, "min_value", SideEffects::none, "bulkMinFloat");
+            addExtern<DAS_BIND_FUN(bulkMinFloat4)>(*this, lib, "min_value", SideEffects::none, "bulkMinFloat4");
+            addExtern<DAS_BIND_FUN(bulkMinInt   )>(*this, lib, "min_value", SideEffects::none, "bulkMinInt");
+            addExtern<DAS_BIND_FUN(bulkMaxFloat )>(*this, lib, "max_value", SideEffects::none, "bulkMaxFloat");
+            addExtern<DAS_BIND_FUN(bulkMaxFloat4)>(*this, lib, "max_value", SideEffects::none, "bulkMaxFloat4");
+            addExtern<DAS_BIND_FUN(bulkMaxInt   )>(*this, lib, "max_value", SideEffects::none, "bulkMaxInt");
+            // dot
+            addExtern<DAS_BIND_FUN(bulkDotFloat)>(*this, lib, "dot", SideEffects::none, "bulkDotFloat");
+            // scale \ axpy \ clamp
+            addExtern<DAS_BIND_FUN(bulkScaleFloat )>(*this, lib, "scale", SideEffects::modifyArgument, "bulkScaleFloat");
+            addExtern<DAS_BIND_FUN(bulkScaleFloat4)>(*this, lib, "scale", SideEffects::modifyArgument, "bulkScaleFloat4");
+            addExtern<DAS_BIND_FUN(bulkAxpyFloat )>(*this, lib, "axpy", SideEffects::modifyArgument, "bulkAxpyFloat");
+            addExtern<DAS_BIND_FUN(bulkAxpyFloat4)>(*this, lib, "axpy", SideEffects::modifyArgument, "bulkAxpyFloat4");
+            addExtern<DAS_BIND_FUN(bulkClampFloat )>(*this, lib, "clamp", SideEffects::modifyArgument, "bulkClampFloat");
+            addExtern<DAS_BIND_FUN(bulkClampFloat4)>(*this, lib, "clamp", SideEffects::modifyArgument, "bulkClampFloat4");
+            addExtern<DAS_BIND_FUN(bulkClampInt   )>(*this, lib, "clamp", SideEffects::modifyArgument, "bulkClampInt");
+            // count_if
+            addExtern<DAS_BIND_FUN(bulkCountLessFloat   )>(*this, lib, "count_less",    SideEffects::none, "bulkCountLessFloat");
+            addExtern<DAS_BIND_FUN(bulkCountGreaterFloat)>(*this, lib, "count_greater", SideEffects::none, "bulkCountGreaterFloat");
+            addExtern<DAS_BIND_FUN(bulkCountEqualFloat  )>(*this, lib, "count_equal",   SideEffects::none, "bulkCountEqualFloat");
+            addExtern<DAS_BIND_FUN(bulkCountLessInt     )>(*this, lib, "count_less",    SideEffects::none, "bulkCountLessInt");
+            addExtern<DAS_BIND_FUN(bulkCountGreaterInt  )>(*this, lib, "count_greater", SideEffects::none, "bulkCountGreaterInt");
+            addExtern<DAS_BIND_FUN(bulkCountEqualInt    )>(*this, lib, "count_equal",   SideEffects::none, "bulkCountEqualInt");
+            // lets verify all names
+            uint32_t verifyFlags = uint32_t(VerifyBuiltinFlags::verifyAll);
+            verifyBuiltinNames(verifyFlags);
+            // and now its AOT ready
+            verifyAotReady();
+        }
+        virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
+            tw << "#include \"daScript/simulate/aot_builtin_bulk.h\"\n";
+            return ModuleAotType::cpp;
+        }
+    };
+}
+
+REGISTER_MODULE_IN_NAMESPACE(Module_Bulk,das);
@@ -564,11 +564,19 @@ namespace das
         return context->stringHeap->allocateString(tout.str());
     }
 
+    char * collectProfileData( Context * context ) {
+        TextWriter tout;
+        context->collectProfileData(tout);
+        return context->stringHeap->allocateString(tout.str());
+    }
+
     void builtin_array_free ( Array & dim, int szt, Context * __context__ ) {
         if ( dim.data ) {
             if ( !dim.lock || dim.hopeless ) {
-                uint32_t oldSize = dim.capacity*szt;
-                __context__->heap->free(dim.data, oldSize);
+                if ( !dim.inlined ) {
+                    uint32_t oldSize = dim.capacity*szt;
+                    __context__->heap->free(dim.data, oldSize);
+                }
             } else {
                 __context__->throw_error("can't delete locked array");
             }
@@ -882,6 +890,7 @@ namespace das
         addExtern<DAS_BIND_FUN(resetProfiler)>(*this, lib, "reset_profiler", SideEffects::modifyExternal, "resetProfiler");
         addExtern<DAS_BIND_FUN(dumpProfileInfo)>(*this, lib, "dump_profile_info", SideEffects::modifyExternal, "dumpProfileInfo");
         addExtern<DAS_BIND_FUN(collectProfileInfo)>(*this, lib, "collect_profile_info", SideEffects::modifyExternal, "collectProfileInfo");
+        addExtern<DAS_BIND_FUN(collectProfileData)>(*this, lib, "collect_profile_data", SideEffects::modifyExternal, "collectProfileData");
         // variant
         addExtern<DAS_BIND_FUN(variant_index)>(*this, lib, "variant_index", SideEffects::none, "variant_index");
         auto svi = addExtern<DAS_BIND_FUN(set_variant_index)>(*this, lib, "set_variant_index",
@@ -6,10 +6,12 @@
 #include "daScript/ast/ast_handle.h"
 #include "daScript/misc/performance_time.h"
 #include "daScript/simulate/aot_builtin_string.h"
+#include "daScript/simulate/runtime_table.h"
 #include "daScript/misc/string_writer.h"
 #include "daScript/misc/debug_break.h"
 
 MAKE_TYPE_FACTORY(StringBuilderWriter, StringBuilderWriter)
+MAKE_TYPE_FACTORY(string_view, das::StringView)
 
 namespace das
 {
@@ -19,6 +21,18 @@ namespace das
         }
     };
 
+    struct StringViewAnnotation : ManagedValueAnnotation<StringView> {
+        StringViewAnnotation() : ManagedValueAnnotation<StringView>("string_view","das::StringView") {}
+        virtual void walk ( DataWalker & walker, void * data ) override {
+            if ( !walker.reading ) {
+                auto sv = (StringView *) data;
+                string text(sv->length ? sv->data : "", sv->length);
+                char * str = (char *) text.c_str();
+                walker.String(str);
+            }
+        }
+    };
+
     int32_t get_character_at ( const char * str, int32_t index, Context * context ) {
         const uint32_t strLen = stringLengthSafe ( *context, str );
         if ( uint32_t(index)>=strLen ) {
@@ -455,6 +469,212 @@ namespace das
         str.resize(newLength);
     }
 
+    // string_view
+
+    StringView builtin_string_view ( const char * str, Context * context ) {
+        return StringView(str, stringLengthSafe(*context,str));
+    }
+
+    StringView builtin_string_view_slice1 ( StringView sv, int32_t start, int32_t end ) {
+        int32_t len = int32_t(sv.length);
+        start = clamp_int((start < 0) ? (len + start) : start, 0, len);
+        end = clamp_int((end < 0) ? (len + end) : end, 0, len);
+        return end > start ? StringView(sv.data + start, uint32_t(end-start)) : StringView(nullptr, 0);
+    }
+
+    StringView builtin_string_view_slice2 ( StringView sv, int32_t start ) {
+        int32_t len = int32_t(sv.length);
+        start = clamp_int((start < 0) ? (len + start) : start, 0, len);
+        return StringView(sv.data + start, uint32_t(len-start));
+    }
+
+    StringView builtin_string_view_chop ( StringView sv, int32_t start, int32_t length, Context * context ) {
+        if ( start<0 || length<0 || uint32_t(start)+uint32_t(length)>sv.length ) {
+            context->throw_error_ex("string_view chop out of range, %i..%i of %u", start, start+length, sv.length);
+        }
+        return StringView(sv.data + start, uint32_t(length));
+    }
+
+    StringView builtin_string_view_strip_left ( StringView sv ) {
+        while ( sv.length && isspace((uint8_t)sv.data[0]) ) {
+            sv.data ++;
+            sv.length --;
+        }
+        return sv;
+    }
+
+    StringView builtin_string_view_strip_right ( StringView sv ) {
+        while ( sv.length && isspace((uint8_t)sv.data[sv.length-1]) ) {
+            sv.length --;
+        }
+        return sv;
+    }
+
+    StringView builtin_string_view_strip ( StringView sv ) {
+        return builtin_string_view_strip_right(builtin_string_view_strip_left(sv));
+    }
+
+    char * builtin_string_view_to_string ( StringView sv, Context * context ) {
+        return sv.length ? context->stringHeap->allocateString(sv.data, sv.length) : nullptr;
+    }
+
+    int32_t get_string_view_character_at ( StringView sv, int32_t index, Context * context ) {
+        if ( uint32_t(index)>=sv.length ) {
+            context->throw_error_ex("string_view character index out of range, %u of %u", uint32_t(index), sv.length);
+        }
+        return ((uint8_t *)sv.data)[index];
+    }
+
+    bool builtin_string_view_equ ( StringView a, StringView b ) {
+        return a.length==b.length && (a.data==b.data || memcmp(a.data, b.data, a.length)==0);
+    }
+
+    bool builtin_string_view_nequ ( StringView a, StringView b ) {
+        return !builtin_string_view_equ(a, b);
+    }
+
+    // operators don't get the context in AOT
+    static __forceinline StringView string_view_of ( const char * str ) {
+        return StringView(str, str ? uint32_t(strlen(str)) : 0);
+    }
+
+    static inline int string_view_compare ( StringView a, StringView b ) {
+        uint32_t len = a.length < b.length ? a.length : b.length;
+        int res = len ? memcmp(a.data, b.data, len) : 0;
+        if ( res ) return res;
+        return a.length < b.length ? -1 : (a.length > b.length ? 1 : 0);
+    }
+
+    bool builtin_string_view_less ( StringView a, StringView b ) {
+        return string_view_compare(a, b) < 0;
+    }
+
+    bool builtin_string_view_gt ( StringView a, StringView b ) {
+        return string_view_compare(a, b) > 0;
+    }
+
+    bool builtin_string_view_equ_string ( StringView a, const char * b ) {
+        return builtin_string_view_equ(a, string_view_of(b));
+    }
+
+    bool builtin_string_view_nequ_string ( StringView a, const char * b ) {
+        return !builtin_string_view_equ(a, string_view_of(b));
+    }
+
+    bool builtin_string_equ_string_view ( const char * a, StringView b ) {
+        return builtin_string_view_equ(string_view_of(a), b);
+    }
+
+    bool builtin_string_nequ_string_view ( const char * a, StringView b ) {
+        return !builtin_string_view_equ(string_view_of(a), b);
+    }
+
+    uint32_t builtin_string_view_hash ( StringView sv ) {
+        // same as hash of the string with the same characters
+        return hash_block32((const uint8_t *)sv.data, sv.length);
+    }
+
+    int32_t builtin_string_view_find ( StringView sv, const char * substr, Context * context ) {
+        const uint32_t subLen = stringLengthSafe ( *context, substr );
+        if ( subLen>sv.length ) return -1;
+        if ( !subLen ) return 0;
+        const char * last = sv.data + sv.length - subLen;
+        for ( const char * ch = sv.data; ch<=last; ++ch ) {
+            if ( *ch==*substr && memcmp(ch, substr, subLen)==0 ) {
+                return int32_t(ch - sv.data);
+            }
+        }
+        return -1;
+    }
+
+    int32_t builtin_string_view_find_char ( StringView sv, int32_t ch ) {
+        auto at = sv.length ? (const char *) memchr(sv.data, ch, sv.length) : nullptr;
+        return at ? int32_t(at - sv.data) : -1;
+    }
+
+    bool builtin_string_view_starts_with ( StringView sv, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > sv.length) ? false : memcmp(sv.data, cmp, cmpLen) == 0;
+    }
+
+    bool builtin_string_view_ends_with ( StringView sv, const char * cmp, Context * context ) {
+        const uint32_t cmpLen = stringLengthSafe ( *context, cmp );
+        return (cmpLen > sv.length) ? false : memcmp(sv.data + sv.length - cmpLen, cmp, cmpLen) == 0;
+    }
+
+    int32_t builtin_string_view_to_int ( StringView sv ) {
+        // same rules as atoi, but never reads past the end of the view
+        const char * ch = sv.data;
+        const char * end = sv.data + sv.length;
+        while ( ch!=end && isspace((uint8_t)*ch) ) ch++;
+        bool negative = false;
+        if ( ch!=end && (*ch=='-' || *ch=='+') ) negative = *ch++=='-';
+        uint32_t res = 0;
+        while ( ch!=end && is_number(*ch) ) res = res*10 + uint32_t(*ch++ - '0');
+        return negative ? -int32_t(res) : int32_t(res);
+    }
+
+    float builtin_string_view_to_float ( StringView sv ) {
+        char buf[64];
+        uint32_t len = sv.length < sizeof(buf)-1 ? sv.length : uint32_t(sizeof(buf)-1);
+        if ( len ) memcpy(buf, sv.data, len);
+        buf[len] = 0;
+        return (float)atof(buf);
+    }
+
+    static __forceinline bool string_view_delim_at ( const char * ch, const char * end, const char * delim, uint32_t delimLen ) {
+        return uint32_t(end-ch)>=delimLen && memcmp(ch, delim, delimLen)==0;
+    }
+
+    // same tokens as builtin_string_split, but no strings are allocated
+    void builtin_string_view_tokenize ( StringView sv, const char * delim, const TBlock<void,StringView> & block, Context * context ) {
+        vec4f args[1];
+        auto token = [&]( const char * tok, uint32_t len ) {
+            args[0] = cast<StringView>::from(StringView(tok, len));
+            context->invoke(block, args, nullptr);
+        };
+        if ( !sv.length ) {
+            token(sv.data, 0);
+            return;
+        }
+        const uint32_t delimLen = stringLengthSafe(*context,delim);
+        const char * ch = sv.data;
+        const char * end = sv.data + sv.length;
+        if ( delimLen ) {
+            while ( ch!=end ) {
+                const char * tok = ch;
+                while ( ch!=end && !string_view_delim_at(ch,end,delim,delimLen) ) ch++;
+                token(tok, uint32_t(ch-tok));
+                if ( ch==end ) break;
+                while ( ch!=end && string_view_delim_at(ch,end,delim,delimLen) ) ch+=delimLen;
+                if ( ch==end ) token(ch, 0);
+            }
+        } else {
+            for ( ; ch!=end; ++ch ) {
+                token(ch, 1);
+            }
+        }
+    }
+
+    // looks up table<string;...> by view, without making the key string
+    void * builtin_table_find_string_view ( const Table & tab, StringView key, int32_t valueTypeSize, Context * context ) {
+        if ( !tab.size ) return nullptr;
+        TableHash<char *> thh(context, uint32_t(valueTypeSize));
+        auto cmp = [&]( const char * k ) {
+            if ( !k ) return key.length==0;
+            uint32_t i = 0;
+            for ( ; i!=key.length; ++i ) {
+                if ( !k[i] || k[i]!=key.data[i] ) return false;
+            }
+            return k[i]==0;
+        };
+        int index = thh.findWith(tab, hash_block32((const uint8_t *)key.data, key.length), cmp);
+        if ( index==-1 && !key.length ) {   // empty string keys are usually null, and hash differently
+            index = thh.findWith(tab, hash_function(*context, (char *)nullptr), cmp);
+        }
+        return index!=-1 ? tab.data + index*valueTypeSize : nullptr;
+    }
+
     class Module_Strings : public Module {
     public:
         Module_Strings() : Module("strings") {
@@ -575,6 +795,64 @@ namespace das
             // bitset helpers
             addExtern<DAS_BIND_FUN(is_char_in_set)>(*this, lib, "is_char_in_set",
                 SideEffects::none,"is_char_in_set");
+            // string view
+            addAnnotation(make_smart<StringViewAnnotation>());
+            addExtern<DAS_BIND_FUN(builtin_string_view)>(*this, lib, "view",
+                SideEffects::none, "builtin_string_view")->args({"str","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_string)>(*this, lib, "string",
+                SideEffects::none, "builtin_string_view_to_string")->args({"view","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_length)>(*this, lib, "length",
+                SideEffects::none, "builtin_string_view_length")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_empty)>(*this, lib, "empty",
+                SideEffects::none, "builtin_string_view_empty")->arg("view");
+            addExtern<DAS_BIND_FUN(get_string_view_character_at)>(*this, lib, "character_at",
+                SideEffects::none, "get_string_view_character_at")->args({"view","idx","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_slice1)>(*this, lib, "slice",
+                SideEffects::none, "builtin_string_view_slice1")->args({"view","start","end"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_slice2)>(*this, lib, "slice",
+                SideEffects::none, "builtin_string_view_slice2")->args({"view","start"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_chop)>(*this, lib, "chop",
+                SideEffects::none, "builtin_string_view_chop")->args({"view","start","length","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip)>(*this, lib, "strip",
+                SideEffects::none, "builtin_string_view_strip")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip_left)>(*this, lib, "strip_left",
+                SideEffects::none, "builtin_string_view_strip_left")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_strip_right)>(*this, lib, "strip_right",
+                SideEffects::none, "builtin_string_view_strip_right")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_equ)>(*this, lib, "==",
+                SideEffects::none, "builtin_string_view_equ");
+            addExtern<DAS_BIND_FUN(builtin_string_view_nequ)>(*this, lib, "!=",
+                SideEffects::none, "builtin_string_view_nequ");
+            addExtern<DAS_BIND_FUN(builtin_string_view_less)>(*this, lib, "<",
+                SideEffects::none, "builtin_string_view_less");
+            addExtern<DAS_BIND_FUN(builtin_string_view_gt)>(*this, lib, ">",
+                SideEffects::none, "builtin_string_view_gt");
+            addExtern<DAS_BIND_FUN(builtin_string_view_equ_string)>(*this, lib, "==",
+                SideEffects::none, "builtin_string_view_equ_string");
+            addExtern<DAS_BIND_FUN(builtin_string_view_nequ_string)>(*this, lib, "!=",
+                SideEffects::none, "builtin_string_view_nequ_string");
+            addExtern<DAS_BIND_FUN(builtin_string_equ_string_view)>(*this, lib, "==",
+                SideEffects::none, "builtin_string_equ_string_view");
+            addExtern<DAS_BIND_FUN(builtin_string_nequ_string_view)>(*this, lib, "!=",
+                SideEffects::none, "builtin_string_nequ_string_view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_hash)>(*this, lib, "hash",
+                SideEffects::none, "builtin_string_view_hash")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_find)>(*this, lib, "find",
+                SideEffects::none, "builtin_string_view_find")->args({"view","substr","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_find_char)>(*this, lib, "find",
+                SideEffects::none, "builtin_string_view_find_char")->args({"view","ch"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_starts_with)>(*this, lib, "starts_with",
+                SideEffects::none, "builtin_string_view_starts_with")->args({"view","cmp","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_ends_with)>(*this, lib, "ends_with",
+                SideEffects::none, "builtin_string_view_ends_with")->args({"view","cmp","context"});
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_int)>(*this, lib, "to_int",
+                SideEffects::none, "builtin_string_view_to_int")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_to_float)>(*this, lib, "to_float",
+                SideEffects::none, "builtin_string_view_to_float")->arg("view");
+            addExtern<DAS_BIND_FUN(builtin_string_view_tokenize)>(*this, lib, "tokenize",
+                SideEffects::modifyExternal, "builtin_string_view_tokenize")->args({"view","delimiter","block","context"});
+            addExtern<DAS_BIND_FUN(builtin_table_find_string_view)>(*this, lib, "builtin_table_find_string_view",
+                SideEffects::none, "builtin_table_find_string_view")->args({"table","key","valueTypeSize","context"})->unsafeOperation = true;
             // lets make sure its all aot ready
             verifyAotReady();
         }
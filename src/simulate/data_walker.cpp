@@ -32,6 +32,14 @@ namespace das {
                 bool last = i==(si->count-1);
                 VarInfo * vi = si->fields[i];
                 char * pf = ps + vi->offset;
+                if ( vi->isInlineArray() ) {
+                    auto arr = (Array *) pf;
+                    if ( arr->inlined ) {
+                        // structure could have moved since the last access
+                        int al = das::max(getTypeAlign(vi->firstType), int(alignof(Array))) - 1;
+                        arr->data = pf + ((sizeof(Array) + al) & ~al);
+                    }
+                }
                 beforeStructureField(ps, si, pf, vi, last);
                 if ( cancel ) {
                     afterStructureCancel(ps, si);
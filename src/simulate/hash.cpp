@@ -20,6 +20,7 @@ namespace das
             }
         }
         __forceinline void updateString ( char * & str ) {
+            if ( !str ) return;     // empty string
             uint8_t * block = (uint8_t *) str;
             while ( *block ) {
                 fnv_bias = ( fnv_bias ^ *block++ ) * fnv_prime;
@@ -21,9 +21,30 @@ namespace das
         arr.lock --;
     }
 
+    void array_inline ( Array & arr, char * storage, uint32_t capacity ) {
+        if ( arr.inlined ) {
+            arr.data = storage;         // owner could have been moved since the last access
+        } else if ( !arr.data ) {
+            arr.data = storage;
+            arr.capacity = capacity;
+            arr.inlined = true;
+        }
+    }
+
     void array_reserve(Context & context, Array & arr, uint32_t newCapacity, uint32_t stride) {
         if ( arr.isLocked() ) context.throw_error("can't change capacity of a locked array");
         if ( arr.capacity >= newCapacity ) return;
+        if ( arr.inlined ) {
+            // spill inline storage to the heap
+            auto newData = context.heap->allocate(newCapacity*stride);
+            if ( !newData ) context.throw_error("out of linear allocator memory");
+            context.heap->mark_comment(newData, "array");
+            memcpy ( newData, arr.data, arr.size*stride );
+            arr.data = newData;
+            arr.capacity = newCapacity;
+            arr.inlined = false;
+            return;
+        }
         auto newData = (char *)context.heap->reallocate(arr.data, arr.capacity*stride, newCapacity*stride);
         if ( !newData ) context.throw_error("out of linear allocator memory");
         context.heap->mark_comment(newData, "array");
@@ -129,8 +150,10 @@ namespace das
         for ( uint32_t i=0; i!=total; ++i, pArray-- ) {
             if ( pArray->data ) {
                 if ( !pArray->isLocked() ) {
-                    uint32_t oldSize = pArray->capacity*stride;
-                    context.heap->free(pArray->data, oldSize);
+                    if ( !pArray->inlined ) {
+                        uint32_t oldSize = pArray->capacity*stride;
+                        context.heap->free(pArray->data, oldSize);
+                    }
                 } else {
                     context.throw_error("deleting locked array");
                     return v_zero();
@@ -1289,6 +1289,26 @@ namespace das
 #endif
     }
 
+    void Context::collectProfileData( TextWriter & tout ) {
+#if DAS_ENABLE_PROFILER
+        auto allFiles = getAllFiles();
+        for ( auto fi : allFiles ) {
+            bool any = false;
+            for ( size_t line=0; line!=fi->profileData.size(); ++line ) {
+                if ( auto samples = fi->profileData[line] ) {
+                    if ( !any ) {
+                        tout << "file " << fi->name << "\n";
+                        any = true;
+                    }
+                    tout << uint32_t(line) << " " << samples << "\n";
+                }
+            }
+        }
+#else
+        (void)tout;
+#endif
+    }
+
     void Context::collectProfileInfo( TextWriter & tout ) {
 #if DAS_ENABLE_PROFILER
         uint64_t totalGoo = 0;
@@ -181,6 +181,18 @@ namespace das {
     void Program::fusion ( Context & context, TextWriter & logs ) {
         // log all functions
         if ( options.getBoolOption("fusion",true) ) {
+            // functions, which never ran in the profile, are not worth the time to fuse
+            vector<bool> cold(context.totalFunctions, false);
+            if ( auto profile = policies.profile.get() ) {
+                for ( auto & pm : library.modules ) {
+                    for ( auto & it : pm->functions ) {
+                        auto pfun = it.second.get();
+                        if ( pfun->index>=0 && pfun->used && pfun->index<context.totalFunctions ) {
+                            cold[pfun->index] = profile->isCold(pfun->atDecl);
+                        }
+                    }
+                }
+            }
             bool anyFusion = true;
             while ( anyFusion) {
                 anyFusion = false;
@@ -195,6 +207,7 @@ namespace das {
                     }
                 }
                 for ( int i=0; i!=context.totalFunctions; ++i ) {
+                    if ( cold[i] ) continue;
                     SimFunction * fn = context.getFunction(i);
                     SimNodeCollector collector;
                     fn->code->visit(collector);
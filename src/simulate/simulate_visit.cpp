@@ -565,6 +565,14 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_NewOnStack::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(NewOnStack);
+        V_ARG(bytes);
+        V_SP(stackTop);
+        V_END();
+    }
+
     SimNode * SimNode_NewArray::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(NewArray);
@@ -887,6 +895,25 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNode_ArrayAtUnchecked::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(ArrayAtUnchecked);
+        V_SUB(l);
+        V_SUB(r);
+        V_ARG(stride);
+        V_ARG(offset);
+        V_END();
+    }
+
+    SimNode * SimNode_InlineArray::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(InlineArray);
+        V_SUB(subexpr);
+        V_ARG(storageOffset);
+        V_ARG(capacity);
+        V_END();
+    }
+
     SimNode * SimNode_SafeArrayAt::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(SafeArrayAt);
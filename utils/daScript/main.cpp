@@ -5,10 +5,24 @@ using namespace das;
 
 TextPrinter tout;
 
-void compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode ) {
+bool saveToFile ( const string & fname, const string & str ) {
+    FILE * f = fopen ( fname.c_str(), "w" );
+    if ( !f ) {
+        tout << "can't open " << fname << "\n";
+        return false;
+    }
+    fwrite ( str.c_str(), str.length(), 1, f );
+    fclose ( f );
+    return true;
+}
+
+void compile_and_run ( const string & fn, const string & mainFnName, bool outputProgramCode, const string & traceFile,
+                      const ProfileDataPtr & profile, const string & saveProfileFile ) {
     auto access = make_smart<FsFileAccess>();
     ModuleGroup dummyGroup;
-    if ( auto program = compileDaScript(fn,access,tout,dummyGroup) ) {
+    CodeOfPolicies policies;
+    policies.profile = profile;
+    if ( auto program = compileDaScript(fn,access,tout,dummyGroup,false,policies) ) {
         if ( program->failed() ) {
             for ( auto & err : program->errors ) {
                 tout << reportError(err.at, err.what, err.extra, err.fixme, err.cerr );
@@ -18,9 +32,19 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
                 tout << *program << "\n";
             Context ctx(program->getContextStackSize());
             program->simulate(ctx, tout);
+            if ( !traceFile.empty() ) {
+                TextWriter tw;
+                program->writeCompileTrace(tw);
+                saveToFile(traceFile, tw.str());
+            }
             if ( auto fnTest = ctx.findFunction(mainFnName.c_str()) ) {
                 ctx.restart();
                 ctx.eval(fnTest, nullptr);
+                if ( !saveProfileFile.empty() ) {
+                    TextWriter tw;
+                    ctx.collectProfileData(tw);
+                    saveToFile(saveProfileFile, tw.str());
+                }
             } else {
                 tout << "function '"  << mainFnName << " ' not found\n";
             }
@@ -29,7 +53,8 @@ void compile_and_run ( const string & fn, const string & mainFnName, bool output
 }
 
 void print_help() {
-    tout << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log}\n";
+    tout << "daScript scriptName1 {scriptName2} .. {-main mainFnName} {-log} {-trace compileTrace.json}"
+        " {-profile profileData.txt} {-save-profile profileData.txt}\n";
 }
 
 void require_project_specific_modules();//link time resolved dependencies
@@ -42,6 +67,9 @@ int main(int argc, char * argv[]) {
     setCommandLineArguments(argc,argv);
     vector<string> files;
     string mainName = "main";
+    string traceFile;
+    string saveProfileFile;
+    ProfileDataPtr profile;
     bool scriptArgs = false;
     bool outputProgramCode = false;
     for ( int i=1; i < argc; ++i ) {
@@ -60,6 +88,27 @@ int main(int argc, char * argv[]) {
                 i += 1;
             } else if ( cmd=="log" ) {
                 outputProgramCode = true;
+            } else if ( cmd=="trace" ) {
+                if (i+1 >= argc)
+                {
+                    print_help();
+                    return -1;
+                }
+                traceFile = argv[i+1];
+                i += 1;
+            } else if ( cmd=="profile" || cmd=="save-profile" ) {
+                if (i+1 >= argc)
+                {
+                    print_help();
+                    return -1;
+                }
+                if ( cmd=="profile" ) {
+                    profile = loadProfileData(argv[i+1], tout);
+                    if ( !profile ) return -1;
+                } else {
+                    saveProfileFile = argv[i+1];
+                }
+                i += 1;
             } else if ( !scriptArgs) {
                 print_help();
                 return -1;
@@ -79,6 +128,7 @@ int main(int argc, char * argv[]) {
     NEED_MODULE(Module_Math);
     NEED_MODULE(Module_Strings);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Bulk);
     NEED_MODULE(Module_Rtti);
     NEED_MODULE(Module_Ast);
     NEED_MODULE(Module_Debugger);
@@ -87,8 +137,9 @@ int main(int argc, char * argv[]) {
     require_project_specific_modules();
     // compile and run
     for ( const auto & fn : files ) {
-        compile_and_run(fn, mainName, outputProgramCode);
+        compile_and_run(fn, mainName, outputProgramCode, traceFile, profile, saveProfileFile);
     }
+    profile.reset();
     // and done
     Module::Shutdown();
     return 0;
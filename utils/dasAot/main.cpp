@@ -21,6 +21,7 @@ void operator delete(void * p) throw()
 
 static bool quiet = false;
 static bool json = false;
+static ProfileDataPtr profile;
 
 TextPrinter tout;
 
@@ -43,6 +44,7 @@ bool compile ( const string & fn, const string & cppFn ) {
     bool firstError = true;
     CodeOfPolicies policies;
     policies.fail_on_lack_of_aot_export = true;
+    policies.profile = profile;
     if ( auto program = compileDaScript(fn,access,tout,dummyGroup,false,policies) ) {
         if ( program->failed() ) {
             if (json)
@@ -197,7 +199,7 @@ int MAIN_FUNC_NAME(int argc, char * argv[]) {
     _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
     #endif
     if ( argc<3 ) {
-        tout << "dasAot <in_script.das> <out_script.das.cpp> [-q] [-j]\n";
+        tout << "dasAot <in_script.das> <out_script.das.cpp> [-q] [-j] [-profile profileData.txt]\n";
         return -1;
     }
     if ( argc>3  ) {
@@ -207,6 +209,9 @@ int MAIN_FUNC_NAME(int argc, char * argv[]) {
                 quiet = true;
             } else if ( strcmp(argv[ai],"-j")==0 ) {
                 json = true;
+            } else if ( strcmp(argv[ai],"-profile")==0 && ai+1<argc ) {
+                profile = loadProfileData(argv[++ai], tout);
+                if ( !profile ) return -1;
             } else if ( strcmp(argv[ai],"--")==0 ) {
                 scriptArgs = true;
             } else if ( !scriptArgs ) {
@@ -222,10 +227,12 @@ int MAIN_FUNC_NAME(int argc, char * argv[]) {
     NEED_MODULE(Module_Ast);
     NEED_MODULE(Module_Debugger);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Bulk);
     NEED_MODULE(Module_Network);
     NEED_MODULE(Module_UriParser);
     require_project_specific_modules();
     bool compiled = compile(argv[1], argv[2]);
+    profile.reset();
     Module::Shutdown();
     return compiled ? 0 : -1;
 }
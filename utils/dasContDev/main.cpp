@@ -98,6 +98,7 @@ int main(int argc, char * argv[]) {
     NEED_MODULE(Module_Debugger);
     NEED_MODULE(Module_FIO);
     NEED_MODULE(Module_Random);
+    NEED_MODULE(Module_Bulk);
     NEED_MODULE(Module_Network);
     NEED_MODULE(Module_UriParser);
     require_project_specific_modules();